@@ -0,0 +1,102 @@
+#
+# Copyright (c) 2025 Nordic Semiconductor ASA
+#
+# SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+#
+
+# SRAM and RRAM split of the nRF54L15 between the application core and the
+# FLPR core, sized for the FFT pipeline of the FLPR core. From the top of
+# SRAM down: the FLPR core, the IPC buffers, the shared frame pool and the
+# application core. The FLPR flash ends where its default partition does,
+# and is as large as its SRAM, which the VPR launcher copies it into. The
+# fft_store partition is the top of the application core RRAM below it,
+# where the RRAM flash driver, bound to cpuapp_rram, writes.
+
+if("flpr-128k" IN_LIST SNIPPET OR "flpr-128k" IN_LIST ${DEFAULT_IMAGE}_SNIPPET)
+  message(FATAL_ERROR "SB_CONFIG_FLPR_MEMORY_SPLIT replaces the flpr-128k snippet, "
+                      "do not apply both")
+endif()
+
+set(FLPR_SRAM_END 0x20040000)
+set(FLPR_RRAM_END 0x165000)
+set(FFT_STORE_KB 32)
+# Spelled out here, configure_file() would take its @...@ for a variable
+set(FLPR_DEFAULT_PARTITION "/soc/rram-controller@5004b000/rram@165000/partitions/partition@0")
+
+# Fixed part, the FFT tables of every length up to FLPR_FFT_LEN, below
+# 8 bytes per point, and the frame buffers, so 4 KB aligned
+math(EXPR flpr_size
+     "${SB_CONFIG_FLPR_RAM_BASE_KB} * 1024 + 8 * ${SB_CONFIG_FLPR_FFT_LEN} + \
+      ${SB_CONFIG_FLPR_FFT_BUFFERS} * ${SB_CONFIG_FLPR_FFT_LEN} * 2")
+math(EXPR flpr_size "(${flpr_size} + 0xfff) & ~0xfff")
+
+math(EXPR FLPR_KB "${flpr_size} / 1024")
+math(EXPR POOL_KB "${SB_CONFIG_FLPR_SHM_POOL_KB}")
+math(EXPR flpr_sram_addr "${FLPR_SRAM_END} - ${flpr_size}")
+math(EXPR ipc_addr "${flpr_sram_addr} - 0x800")
+math(EXPR pool_addr "${ipc_addr} - ${POOL_KB} * 1024")
+math(EXPR APP_SRAM_KB "(${pool_addr} - 0x20000000) / 1024")
+math(EXPR flpr_rram_addr "${FLPR_RRAM_END} - ${flpr_size}")
+math(EXPR store_addr "(${flpr_rram_addr} - ${FFT_STORE_KB} * 1024) & ~0xfff")
+
+if(APP_SRAM_KB LESS SB_CONFIG_FLPR_APP_SRAM_MIN_KB)
+  message(FATAL_ERROR "FLPR memory split: ${FLPR_KB}KB for the FLPR core and a "
+                      "${POOL_KB}KB frame pool leave ${APP_SRAM_KB}KB to the "
+                      "application core, below SB_CONFIG_FLPR_APP_SRAM_MIN_KB")
+endif()
+
+# Addresses for reg, and without 0x for unit addresses
+function(flpr_memory_addr name value)
+  math(EXPR hex "${value}" OUTPUT_FORMAT HEXADECIMAL)
+  string(TOLOWER "${hex}" hex)
+  string(REGEX REPLACE "^0x" "" unit "${hex}")
+  set(${name}_ADDR ${hex} PARENT_SCOPE)
+  set(${name}_UNIT ${unit} PARENT_SCOPE)
+endfunction()
+
+flpr_memory_addr(FLPR_SRAM ${flpr_sram_addr})
+flpr_memory_addr(FLPR_RRAM ${flpr_rram_addr})
+flpr_memory_addr(IPC ${ipc_addr})
+flpr_memory_addr(IPC_TX "${ipc_addr} + 0x400")
+flpr_memory_addr(POOL ${pool_addr})
+flpr_memory_addr(STORE ${store_addr})
+flpr_memory_addr(STORE_END "${store_addr} + ${FFT_STORE_KB} * 1024")
+math(EXPR STORE_SIZE "${FFT_STORE_KB} * 1024" OUTPUT_FORMAT HEXADECIMAL)
+
+if(POOL_KB GREATER 0)
+  set(FFT_POOL_NODE "
+			// Shared FFT frame pool: ${POOL_KB}KB at ${POOL_ADDR}
+			fft_pool: memory@${POOL_UNIT} {
+				reg = <${POOL_ADDR} DT_SIZE_K(${POOL_KB})>;
+			};
+")
+else()
+  set(FFT_POOL_NODE "")
+endif()
+
+set(flpr_memory_dir ${CMAKE_BINARY_DIR}/flpr_memory)
+configure_file(${CMAKE_CURRENT_LIST_DIR}/flpr_memory/nrf54l15_cpuapp.overlay.in
+               ${flpr_memory_dir}/nrf54l15_cpuapp.overlay @ONLY)
+configure_file(${CMAKE_CURRENT_LIST_DIR}/flpr_memory/nrf54l15_cpuflpr.overlay.in
+               ${flpr_memory_dir}/nrf54l15_cpuflpr.overlay @ONLY)
+configure_file(${CMAKE_CURRENT_LIST_DIR}/flpr_memory/pm_static.yml.in
+               ${flpr_memory_dir}/pm_static.yml @ONLY)
+
+# After the board overlays, whose shared regions they move
+function(flpr_memory_add_overlay image overlay)
+  set(overlays ${${image}_EXTRA_DTC_OVERLAY_FILE})
+  if(NOT overlay IN_LIST overlays)
+    list(APPEND overlays ${overlay})
+    set(${image}_EXTRA_DTC_OVERLAY_FILE "${overlays}" CACHE INTERNAL "")
+  endif()
+endfunction()
+
+flpr_memory_add_overlay(${DEFAULT_IMAGE} ${flpr_memory_dir}/nrf54l15_cpuapp.overlay)
+flpr_memory_add_overlay(remote ${flpr_memory_dir}/nrf54l15_cpuflpr.overlay)
+
+set(PM_STATIC_YML_FILE ${flpr_memory_dir}/pm_static.yml CACHE INTERNAL "")
+
+message(STATUS "FLPR memory split: ${APP_SRAM_KB}KB application core, ${POOL_KB}KB frame "
+               "pool at ${POOL_ADDR}, 2KB IPC at ${IPC_ADDR}, ${FLPR_KB}KB FLPR core at "
+               "${FLPR_SRAM_ADDR}, FLPR flash at ${FLPR_RRAM_ADDR}, ${FFT_STORE_KB}KB "
+               "fft_store at ${STORE_ADDR}")
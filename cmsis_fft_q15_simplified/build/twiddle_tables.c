@@ -0,0 +1,5144 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library - Simplified Q15 FFT
+ * Title:        twiddle_tables.c
+ * Description:  Twiddle factor and bit reversal tables for 4096 to 8192 point RFFTs
+ *               Generated by gen_tables.py, do not edit
+ *
+ * Target Processor: ARM Cortex-M33
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2021 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "rfft_q15_simplified.h"
+
+#if RFFT_Q15_MIN_FFT_LEN != 4096 || RFFT_Q15_MAX_FFT_LEN != 8192
+#error "twiddle_tables.c was generated for other RFFT lengths, see gen_tables.py"
+#endif
+
+#if !defined(RFFT_Q15_COMPACT_TWIDDLES)
+
+/* ========================================================================= */
+/* Shared Twiddle Table                                                      */
+/* ========================================================================= */
+
+/*
+ * cos and sin of 2*pi*k/8192 for k < 6144, floor(32768 * x) saturated.
+ * Shared by all CFFT sizes and the RFFT split step, see
+ * RFFT_TWIDDLE_TABLE.
+ */
+const q15_t twiddleCoef_8192_q15[12288] RFFT_Q15_ALIGN =
+{
+    (q15_t)0x7FFF, (q15_t)0x0000, (q15_t)0x7FFF, (q15_t)0x0019, (q15_t)0x7FFF, (q15_t)0x0032, (q15_t)0x7FFF, (q15_t)0x004B,
+    (q15_t)0x7FFF, (q15_t)0x0064, (q15_t)0x7FFF, (q15_t)0x007D, (q15_t)0x7FFF, (q15_t)0x0096, (q15_t)0x7FFF, (q15_t)0x00AF,
+    (q15_t)0x7FFF, (q15_t)0x00C9, (q15_t)0x7FFF, (q15_t)0x00E2, (q15_t)0x7FFF, (q15_t)0x00FB, (q15_t)0x7FFE, (q15_t)0x0114,
+    (q15_t)0x7FFE, (q15_t)0x012D, (q15_t)0x7FFE, (q15_t)0x0146, (q15_t)0x7FFE, (q15_t)0x015F, (q15_t)0x7FFD, (q15_t)0x0178,
+    (q15_t)0x7FFD, (q15_t)0x0192, (q15_t)0x7FFD, (q15_t)0x01AB, (q15_t)0x7FFC, (q15_t)0x01C4, (q15_t)0x7FFC, (q15_t)0x01DD,
+    (q15_t)0x7FFC, (q15_t)0x01F6, (q15_t)0x7FFB, (q15_t)0x020F, (q15_t)0x7FFB, (q15_t)0x0228, (q15_t)0x7FFA, (q15_t)0x0242,
+    (q15_t)0x7FFA, (q15_t)0x025B, (q15_t)0x7FF9, (q15_t)0x0274, (q15_t)0x7FF9, (q15_t)0x028D, (q15_t)0x7FF8, (q15_t)0x02A6,
+    (q15_t)0x7FF8, (q15_t)0x02BF, (q15_t)0x7FF7, (q15_t)0x02D8, (q15_t)0x7FF7, (q15_t)0x02F1, (q15_t)0x7FF6, (q15_t)0x030B,
+    (q15_t)0x7FF6, (q15_t)0x0324, (q15_t)0x7FF5, (q15_t)0x033D, (q15_t)0x7FF4, (q15_t)0x0356, (q15_t)0x7FF4, (q15_t)0x036F,
+    (q15_t)0x7FF3, (q15_t)0x0388, (q15_t)0x7FF2, (q15_t)0x03A1, (q15_t)0x7FF2, (q15_t)0x03BA, (q15_t)0x7FF1, (q15_t)0x03D4,
+    (q15_t)0x7FF0, (q15_t)0x03ED, (q15_t)0x7FEF, (q15_t)0x0406, (q15_t)0x7FEE, (q15_t)0x041F, (q15_t)0x7FEE, (q15_t)0x0438,
+    (q15_t)0x7FED, (q15_t)0x0451, (q15_t)0x7FEC, (q15_t)0x046A, (q15_t)0x7FEB, (q15_t)0x0483, (q15_t)0x7FEA, (q15_t)0x049C,
+    (q15_t)0x7FE9, (q15_t)0x04B6, (q15_t)0x7FE8, (q15_t)0x04CF, (q15_t)0x7FE7, (q15_t)0x04E8, (q15_t)0x7FE6, (q15_t)0x0501,
+    (q15_t)0x7FE5, (q15_t)0x051A, (q15_t)0x7FE4, (q15_t)0x0533, (q15_t)0x7FE3, (q15_t)0x054C, (q15_t)0x7FE2, (q15_t)0x0565,
+    (q15_t)0x7FE1, (q15_t)0x057F, (q15_t)0x7FE0, (q15_t)0x0598, (q15_t)0x7FDF, (q15_t)0x05B1, (q15_t)0x7FDE, (q15_t)0x05CA,
+    (q15_t)0x7FDD, (q15_t)0x05E3, (q15_t)0x7FDC, (q15_t)0x05FC, (q15_t)0x7FDA, (q15_t)0x0615, (q15_t)0x7FD9, (q15_t)0x062E,
+    (q15_t)0x7FD8, (q15_t)0x0647, (q15_t)0x7FD7, (q15_t)0x0660, (q15_t)0x7FD6, (q15_t)0x067A, (q15_t)0x7FD4, (q15_t)0x0693,
+    (q15_t)0x7FD3, (q15_t)0x06AC, (q15_t)0x7FD2, (q15_t)0x06C5, (q15_t)0x7FD0, (q15_t)0x06DE, (q15_t)0x7FCF, (q15_t)0x06F7,
+    (q15_t)0x7FCE, (q15_t)0x0710, (q15_t)0x7FCC, (q15_t)0x0729, (q15_t)0x7FCB, (q15_t)0x0742, (q15_t)0x7FC9, (q15_t)0x075B,
+    (q15_t)0x7FC8, (q15_t)0x0775, (q15_t)0x7FC6, (q15_t)0x078E, (q15_t)0x7FC5, (q15_t)0x07A7, (q15_t)0x7FC3, (q15_t)0x07C0,
+    (q15_t)0x7FC2, (q15_t)0x07D9, (q15_t)0x7FC0, (q15_t)0x07F2, (q15_t)0x7FBF, (q15_t)0x080B, (q15_t)0x7FBD, (q15_t)0x0824,
+    (q15_t)0x7FBC, (q15_t)0x083D, (q15_t)0x7FBA, (q15_t)0x0856, (q15_t)0x7FB8, (q15_t)0x086F, (q15_t)0x7FB7, (q15_t)0x0888,
+    (q15_t)0x7FB5, (q15_t)0x08A2, (q15_t)0x7FB3, (q15_t)0x08BB, (q15_t)0x7FB1, (q15_t)0x08D4, (q15_t)0x7FB0, (q15_t)0x08ED,
+    (q15_t)0x7FAE, (q15_t)0x0906, (q15_t)0x7FAC, (q15_t)0x091F, (q15_t)0x7FAA, (q15_t)0x0938, (q15_t)0x7FA9, (q15_t)0x0951,
+    (q15_t)0x7FA7, (q15_t)0x096A, (q15_t)0x7FA5, (q15_t)0x0983, (q15_t)0x7FA3, (q15_t)0x099C, (q15_t)0x7FA1, (q15_t)0x09B5,
+    (q15_t)0x7F9F, (q15_t)0x09CE, (q15_t)0x7F9D, (q15_t)0x09E7, (q15_t)0x7F9B, (q15_t)0x0A00, (q15_t)0x7F99, (q15_t)0x0A19,
+    (q15_t)0x7F97, (q15_t)0x0A33, (q15_t)0x7F95, (q15_t)0x0A4C, (q15_t)0x7F93, (q15_t)0x0A65, (q15_t)0x7F91, (q15_t)0x0A7E,
+    (q15_t)0x7F8F, (q15_t)0x0A97, (q15_t)0x7F8D, (q15_t)0x0AB0, (q15_t)0x7F8B, (q15_t)0x0AC9, (q15_t)0x7F89, (q15_t)0x0AE2,
+    (q15_t)0x7F87, (q15_t)0x0AFB, (q15_t)0x7F85, (q15_t)0x0B14, (q15_t)0x7F82, (q15_t)0x0B2D, (q15_t)0x7F80, (q15_t)0x0B46,
+    (q15_t)0x7F7E, (q15_t)0x0B5F, (q15_t)0x7F7C, (q15_t)0x0B78, (q15_t)0x7F79, (q15_t)0x0B91, (q15_t)0x7F77, (q15_t)0x0BAA,
+    (q15_t)0x7F75, (q15_t)0x0BC3, (q15_t)0x7F72, (q15_t)0x0BDC, (q15_t)0x7F70, (q15_t)0x0BF5, (q15_t)0x7F6E, (q15_t)0x0C0E,
+    (q15_t)0x7F6B, (q15_t)0x0C27, (q15_t)0x7F69, (q15_t)0x0C40, (q15_t)0x7F67, (q15_t)0x0C59, (q15_t)0x7F64, (q15_t)0x0C72,
+    (q15_t)0x7F62, (q15_t)0x0C8B, (q15_t)0x7F5F, (q15_t)0x0CA4, (q15_t)0x7F5D, (q15_t)0x0CBD, (q15_t)0x7F5A, (q15_t)0x0CD6,
+    (q15_t)0x7F58, (q15_t)0x0CEF, (q15_t)0x7F55, (q15_t)0x0D08, (q15_t)0x7F53, (q15_t)0x0D21, (q15_t)0x7F50, (q15_t)0x0D3A,
+    (q15_t)0x7F4D, (q15_t)0x0D53, (q15_t)0x7F4B, (q15_t)0x0D6C, (q15_t)0x7F48, (q15_t)0x0D85, (q15_t)0x7F45, (q15_t)0x0D9E,
+    (q15_t)0x7F43, (q15_t)0x0DB7, (q15_t)0x7F40, (q15_t)0x0DD0, (q15_t)0x7F3D, (q15_t)0x0DE9, (q15_t)0x7F3B, (q15_t)0x0E02,
+    (q15_t)0x7F38, (q15_t)0x0E1B, (q15_t)0x7F35, (q15_t)0x0E34, (q15_t)0x7F32, (q15_t)0x0E4D, (q15_t)0x7F2F, (q15_t)0x0E66,
+    (q15_t)0x7F2D, (q15_t)0x0E7F, (q15_t)0x7F2A, (q15_t)0x0E98, (q15_t)0x7F27, (q15_t)0x0EB1, (q15_t)0x7F24, (q15_t)0x0ECA,
+    (q15_t)0x7F21, (q15_t)0x0EE3, (q15_t)0x7F1E, (q15_t)0x0EFC, (q15_t)0x7F1B, (q15_t)0x0F15, (q15_t)0x7F18, (q15_t)0x0F2E,
+    (q15_t)0x7F15, (q15_t)0x0F47, (q15_t)0x7F12, (q15_t)0x0F60, (q15_t)0x7F0F, (q15_t)0x0F79, (q15_t)0x7F0C, (q15_t)0x0F92,
+    (q15_t)0x7F09, (q15_t)0x0FAB, (q15_t)0x7F06, (q15_t)0x0FC4, (q15_t)0x7F03, (q15_t)0x0FDD, (q15_t)0x7F00, (q15_t)0x0FF5,
+    (q15_t)0x7EFD, (q15_t)0x100E, (q15_t)0x7EF9, (q15_t)0x1027, (q15_t)0x7EF6, (q15_t)0x1040, (q15_t)0x7EF3, (q15_t)0x1059,
+    (q15_t)0x7EF0, (q15_t)0x1072, (q15_t)0x7EED, (q15_t)0x108B, (q15_t)0x7EE9, (q15_t)0x10A4, (q15_t)0x7EE6, (q15_t)0x10BD,
+    (q15_t)0x7EE3, (q15_t)0x10D6, (q15_t)0x7EDF, (q15_t)0x10EF, (q15_t)0x7EDC, (q15_t)0x1108, (q15_t)0x7ED9, (q15_t)0x1121,
+    (q15_t)0x7ED5, (q15_t)0x1139, (q15_t)0x7ED2, (q15_t)0x1152, (q15_t)0x7ECF, (q15_t)0x116B, (q15_t)0x7ECB, (q15_t)0x1184,
+    (q15_t)0x7EC8, (q15_t)0x119D, (q15_t)0x7EC4, (q15_t)0x11B6, (q15_t)0x7EC1, (q15_t)0x11CF, (q15_t)0x7EBD, (q15_t)0x11E8,
+    (q15_t)0x7EBA, (q15_t)0x1201, (q15_t)0x7EB6, (q15_t)0x1219, (q15_t)0x7EB3, (q15_t)0x1232, (q15_t)0x7EAF, (q15_t)0x124B,
+    (q15_t)0x7EAB, (q15_t)0x1264, (q15_t)0x7EA8, (q15_t)0x127D, (q15_t)0x7EA4, (q15_t)0x1296, (q15_t)0x7EA1, (q15_t)0x12AF,
+    (q15_t)0x7E9D, (q15_t)0x12C8, (q15_t)0x7E99, (q15_t)0x12E0, (q15_t)0x7E95, (q15_t)0x12F9, (q15_t)0x7E92, (q15_t)0x1312,
+    (q15_t)0x7E8E, (q15_t)0x132B, (q15_t)0x7E8A, (q15_t)0x1344, (q15_t)0x7E86, (q15_t)0x135D, (q15_t)0x7E83, (q15_t)0x1376,
+    (q15_t)0x7E7F, (q15_t)0x138E, (q15_t)0x7E7B, (q15_t)0x13A7, (q15_t)0x7E77, (q15_t)0x13C0, (q15_t)0x7E73, (q15_t)0x13D9,
+    (q15_t)0x7E6F, (q15_t)0x13F2, (q15_t)0x7E6B, (q15_t)0x140B, (q15_t)0x7E67, (q15_t)0x1423, (q15_t)0x7E63, (q15_t)0x143C,
+    (q15_t)0x7E5F, (q15_t)0x1455, (q15_t)0x7E5B, (q15_t)0x146E, (q15_t)0x7E57, (q15_t)0x1487, (q15_t)0x7E53, (q15_t)0x149F,
+    (q15_t)0x7E4F, (q15_t)0x14B8, (q15_t)0x7E4B, (q15_t)0x14D1, (q15_t)0x7E47, (q15_t)0x14EA, (q15_t)0x7E43, (q15_t)0x1503,
+    (q15_t)0x7E3F, (q15_t)0x151B, (q15_t)0x7E3B, (q15_t)0x1534, (q15_t)0x7E37, (q15_t)0x154D, (q15_t)0x7E32, (q15_t)0x1566,
+    (q15_t)0x7E2E, (q15_t)0x157F, (q15_t)0x7E2A, (q15_t)0x1597, (q15_t)0x7E26, (q15_t)0x15B0, (q15_t)0x7E21, (q15_t)0x15C9,
+    (q15_t)0x7E1D, (q15_t)0x15E2, (q15_t)0x7E19, (q15_t)0x15FA, (q15_t)0x7E14, (q15_t)0x1613, (q15_t)0x7E10, (q15_t)0x162C,
+    (q15_t)0x7E0C, (q15_t)0x1645, (q15_t)0x7E07, (q15_t)0x165D, (q15_t)0x7E03, (q15_t)0x1676, (q15_t)0x7DFF, (q15_t)0x168F,
+    (q15_t)0x7DFA, (q15_t)0x16A8, (q15_t)0x7DF6, (q15_t)0x16C0, (q15_t)0x7DF1, (q15_t)0x16D9, (q15_t)0x7DED, (q15_t)0x16F2,
+    (q15_t)0x7DE8, (q15_t)0x170A, (q15_t)0x7DE4, (q15_t)0x1723, (q15_t)0x7DDF, (q15_t)0x173C, (q15_t)0x7DDA, (q15_t)0x1755,
+    (q15_t)0x7DD6, (q15_t)0x176D, (q15_t)0x7DD1, (q15_t)0x1786, (q15_t)0x7DCD, (q15_t)0x179F, (q15_t)0x7DC8, (q15_t)0x17B7,
+    (q15_t)0x7DC3, (q15_t)0x17D0, (q15_t)0x7DBF, (q15_t)0x17E9, (q15_t)0x7DBA, (q15_t)0x1802, (q15_t)0x7DB5, (q15_t)0x181A,
+    (q15_t)0x7DB0, (q15_t)0x1833, (q15_t)0x7DAC, (q15_t)0x184C, (q15_t)0x7DA7, (q15_t)0x1864, (q15_t)0x7DA2, (q15_t)0x187D,
+    (q15_t)0x7D9D, (q15_t)0x1896, (q15_t)0x7D98, (q15_t)0x18AE, (q15_t)0x7D94, (q15_t)0x18C7, (q15_t)0x7D8F, (q15_t)0x18E0,
+    (q15_t)0x7D8A, (q15_t)0x18F8, (q15_t)0x7D85, (q15_t)0x1911, (q15_t)0x7D80, (q15_t)0x192A, (q15_t)0x7D7B, (q15_t)0x1942,
+    (q15_t)0x7D76, (q15_t)0x195B, (q15_t)0x7D71, (q15_t)0x1973, (q15_t)0x7D6C, (q15_t)0x198C, (q15_t)0x7D67, (q15_t)0x19A5,
+    (q15_t)0x7D62, (q15_t)0x19BD, (q15_t)0x7D5D, (q15_t)0x19D6, (q15_t)0x7D58, (q15_t)0x19EF, (q15_t)0x7D53, (q15_t)0x1A07,
+    (q15_t)0x7D4E, (q15_t)0x1A20, (q15_t)0x7D49, (q15_t)0x1A38, (q15_t)0x7D43, (q15_t)0x1A51, (q15_t)0x7D3E, (q15_t)0x1A6A,
+    (q15_t)0x7D39, (q15_t)0x1A82, (q15_t)0x7D34, (q15_t)0x1A9B, (q15_t)0x7D2F, (q15_t)0x1AB3, (q15_t)0x7D29, (q15_t)0x1ACC,
+    (q15_t)0x7D24, (q15_t)0x1AE4, (q15_t)0x7D1F, (q15_t)0x1AFD, (q15_t)0x7D19, (q15_t)0x1B16, (q15_t)0x7D14, (q15_t)0x1B2E,
+    (q15_t)0x7D0F, (q15_t)0x1B47, (q15_t)0x7D09, (q15_t)0x1B5F, (q15_t)0x7D04, (q15_t)0x1B78, (q15_t)0x7CFF, (q15_t)0x1B90,
+    (q15_t)0x7CF9, (q15_t)0x1BA9, (q15_t)0x7CF4, (q15_t)0x1BC1, (q15_t)0x7CEE, (q15_t)0x1BDA, (q15_t)0x7CE9, (q15_t)0x1BF2,
+    (q15_t)0x7CE3, (q15_t)0x1C0B, (q15_t)0x7CDE, (q15_t)0x1C24, (q15_t)0x7CD8, (q15_t)0x1C3C, (q15_t)0x7CD3, (q15_t)0x1C55,
+    (q15_t)0x7CCD, (q15_t)0x1C6D, (q15_t)0x7CC8, (q15_t)0x1C86, (q15_t)0x7CC2, (q15_t)0x1C9E, (q15_t)0x7CBC, (q15_t)0x1CB7,
+    (q15_t)0x7CB7, (q15_t)0x1CCF, (q15_t)0x7CB1, (q15_t)0x1CE8, (q15_t)0x7CAB, (q15_t)0x1D00, (q15_t)0x7CA6, (q15_t)0x1D18,
+    (q15_t)0x7CA0, (q15_t)0x1D31, (q15_t)0x7C9A, (q15_t)0x1D49, (q15_t)0x7C94, (q15_t)0x1D62, (q15_t)0x7C8F, (q15_t)0x1D7A,
+    (q15_t)0x7C89, (q15_t)0x1D93, (q15_t)0x7C83, (q15_t)0x1DAB, (q15_t)0x7C7D, (q15_t)0x1DC4, (q15_t)0x7C77, (q15_t)0x1DDC,
+    (q15_t)0x7C71, (q15_t)0x1DF5, (q15_t)0x7C6C, (q15_t)0x1E0D, (q15_t)0x7C66, (q15_t)0x1E25, (q15_t)0x7C60, (q15_t)0x1E3E,
+    (q15_t)0x7C5A, (q15_t)0x1E56, (q15_t)0x7C54, (q15_t)0x1E6F, (q15_t)0x7C4E, (q15_t)0x1E87, (q15_t)0x7C48, (q15_t)0x1EA0,
+    (q15_t)0x7C42, (q15_t)0x1EB8, (q15_t)0x7C3C, (q15_t)0x1ED0, (q15_t)0x7C36, (q15_t)0x1EE9, (q15_t)0x7C30, (q15_t)0x1F01,
+    (q15_t)0x7C29, (q15_t)0x1F19, (q15_t)0x7C23, (q15_t)0x1F32, (q15_t)0x7C1D, (q15_t)0x1F4A, (q15_t)0x7C17, (q15_t)0x1F63,
+    (q15_t)0x7C11, (q15_t)0x1F7B, (q15_t)0x7C0B, (q15_t)0x1F93, (q15_t)0x7C05, (q15_t)0x1FAC, (q15_t)0x7BFE, (q15_t)0x1FC4,
+    (q15_t)0x7BF8, (q15_t)0x1FDC, (q15_t)0x7BF2, (q15_t)0x1FF5, (q15_t)0x7BEB, (q15_t)0x200D, (q15_t)0x7BE5, (q15_t)0x2025,
+    (q15_t)0x7BDF, (q15_t)0x203E, (q15_t)0x7BD9, (q15_t)0x2056, (q15_t)0x7BD2, (q15_t)0x206E, (q15_t)0x7BCC, (q15_t)0x2087,
+    (q15_t)0x7BC5, (q15_t)0x209F, (q15_t)0x7BBF, (q15_t)0x20B7, (q15_t)0x7BB9, (q15_t)0x20D0, (q15_t)0x7BB2, (q15_t)0x20E8,
+    (q15_t)0x7BAC, (q15_t)0x2100, (q15_t)0x7BA5, (q15_t)0x2118, (q15_t)0x7B9F, (q15_t)0x2131, (q15_t)0x7B98, (q15_t)0x2149,
+    (q15_t)0x7B92, (q15_t)0x2161, (q15_t)0x7B8B, (q15_t)0x2179, (q15_t)0x7B84, (q15_t)0x2192, (q15_t)0x7B7E, (q15_t)0x21AA,
+    (q15_t)0x7B77, (q15_t)0x21C2, (q15_t)0x7B71, (q15_t)0x21DA, (q15_t)0x7B6A, (q15_t)0x21F3, (q15_t)0x7B63, (q15_t)0x220B,
+    (q15_t)0x7B5D, (q15_t)0x2223, (q15_t)0x7B56, (q15_t)0x223B, (q15_t)0x7B4F, (q15_t)0x2254, (q15_t)0x7B48, (q15_t)0x226C,
+    (q15_t)0x7B42, (q15_t)0x2284, (q15_t)0x7B3B, (q15_t)0x229C, (q15_t)0x7B34, (q15_t)0x22B4, (q15_t)0x7B2D, (q15_t)0x22CD,
+    (q15_t)0x7B26, (q15_t)0x22E5, (q15_t)0x7B1F, (q15_t)0x22FD, (q15_t)0x7B19, (q15_t)0x2315, (q15_t)0x7B12, (q15_t)0x232D,
+    (q15_t)0x7B0B, (q15_t)0x2345, (q15_t)0x7B04, (q15_t)0x235E, (q15_t)0x7AFD, (q15_t)0x2376, (q15_t)0x7AF6, (q15_t)0x238E,
+    (q15_t)0x7AEF, (q15_t)0x23A6, (q15_t)0x7AE8, (q15_t)0x23BE, (q15_t)0x7AE1, (q15_t)0x23D6, (q15_t)0x7ADA, (q15_t)0x23EE,
+    (q15_t)0x7AD3, (q15_t)0x2407, (q15_t)0x7ACC, (q15_t)0x241F, (q15_t)0x7AC5, (q15_t)0x2437, (q15_t)0x7ABD, (q15_t)0x244F,
+    (q15_t)0x7AB6, (q15_t)0x2467, (q15_t)0x7AAF, (q15_t)0x247F, (q15_t)0x7AA8, (q15_t)0x2497, (q15_t)0x7AA1, (q15_t)0x24AF,
+    (q15_t)0x7A9A, (q15_t)0x24C7, (q15_t)0x7A92, (q15_t)0x24DF, (q15_t)0x7A8B, (q15_t)0x24F7, (q15_t)0x7A84, (q15_t)0x250F,
+    (q15_t)0x7A7D, (q15_t)0x2528, (q15_t)0x7A75, (q15_t)0x2540, (q15_t)0x7A6E, (q15_t)0x2558, (q15_t)0x7A67, (q15_t)0x2570,
+    (q15_t)0x7A5F, (q15_t)0x2588, (q15_t)0x7A58, (q15_t)0x25A0, (q15_t)0x7A50, (q15_t)0x25B8, (q15_t)0x7A49, (q15_t)0x25D0,
+    (q15_t)0x7A42, (q15_t)0x25E8, (q15_t)0x7A3A, (q15_t)0x2600, (q15_t)0x7A33, (q15_t)0x2618, (q15_t)0x7A2B, (q15_t)0x2630,
+    (q15_t)0x7A24, (q15_t)0x2648, (q15_t)0x7A1C, (q15_t)0x2660, (q15_t)0x7A15, (q15_t)0x2678, (q15_t)0x7A0D, (q15_t)0x2690,
+    (q15_t)0x7A05, (q15_t)0x26A8, (q15_t)0x79FE, (q15_t)0x26C0, (q15_t)0x79F6, (q15_t)0x26D8, (q15_t)0x79EF, (q15_t)0x26EF,
+    (q15_t)0x79E7, (q15_t)0x2707, (q15_t)0x79DF, (q15_t)0x271F, (q15_t)0x79D8, (q15_t)0x2737, (q15_t)0x79D0, (q15_t)0x274F,
+    (q15_t)0x79C8, (q15_t)0x2767, (q15_t)0x79C0, (q15_t)0x277F, (q15_t)0x79B9, (q15_t)0x2797, (q15_t)0x79B1, (q15_t)0x27AF,
+    (q15_t)0x79A9, (q15_t)0x27C7, (q15_t)0x79A1, (q15_t)0x27DF, (q15_t)0x7999, (q15_t)0x27F6, (q15_t)0x7992, (q15_t)0x280E,
+    (q15_t)0x798A, (q15_t)0x2826, (q15_t)0x7982, (q15_t)0x283E, (q15_t)0x797A, (q15_t)0x2856, (q15_t)0x7972, (q15_t)0x286E,
+    (q15_t)0x796A, (q15_t)0x2886, (q15_t)0x7962, (q15_t)0x289D, (q15_t)0x795A, (q15_t)0x28B5, (q15_t)0x7952, (q15_t)0x28CD,
+    (q15_t)0x794A, (q15_t)0x28E5, (q15_t)0x7942, (q15_t)0x28FD, (q15_t)0x793A, (q15_t)0x2915, (q15_t)0x7932, (q15_t)0x292C,
+    (q15_t)0x792A, (q15_t)0x2944, (q15_t)0x7922, (q15_t)0x295C, (q15_t)0x7919, (q15_t)0x2974, (q15_t)0x7911, (q15_t)0x298B,
+    (q15_t)0x7909, (q15_t)0x29A3, (q15_t)0x7901, (q15_t)0x29BB, (q15_t)0x78F9, (q15_t)0x29D3, (q15_t)0x78F1, (q15_t)0x29EB,
+    (q15_t)0x78E8, (q15_t)0x2A02, (q15_t)0x78E0, (q15_t)0x2A1A, (q15_t)0x78D8, (q15_t)0x2A32, (q15_t)0x78CF, (q15_t)0x2A49,
+    (q15_t)0x78C7, (q15_t)0x2A61, (q15_t)0x78BF, (q15_t)0x2A79, (q15_t)0x78B6, (q15_t)0x2A91, (q15_t)0x78AE, (q15_t)0x2AA8,
+    (q15_t)0x78A6, (q15_t)0x2AC0, (q15_t)0x789D, (q15_t)0x2AD8, (q15_t)0x7895, (q15_t)0x2AEF, (q15_t)0x788C, (q15_t)0x2B07,
+    (q15_t)0x7884, (q15_t)0x2B1F, (q15_t)0x787C, (q15_t)0x2B36, (q15_t)0x7873, (q15_t)0x2B4E, (q15_t)0x786B, (q15_t)0x2B66,
+    (q15_t)0x7862, (q15_t)0x2B7D, (q15_t)0x7859, (q15_t)0x2B95, (q15_t)0x7851, (q15_t)0x2BAD, (q15_t)0x7848, (q15_t)0x2BC4,
+    (q15_t)0x7840, (q15_t)0x2BDC, (q15_t)0x7837, (q15_t)0x2BF3, (q15_t)0x782E, (q15_t)0x2C0B, (q15_t)0x7826, (q15_t)0x2C23,
+    (q15_t)0x781D, (q15_t)0x2C3A, (q15_t)0x7814, (q15_t)0x2C52, (q15_t)0x780C, (q15_t)0x2C69, (q15_t)0x7803, (q15_t)0x2C81,
+    (q15_t)0x77FA, (q15_t)0x2C98, (q15_t)0x77F1, (q15_t)0x2CB0, (q15_t)0x77E9, (q15_t)0x2CC8, (q15_t)0x77E0, (q15_t)0x2CDF,
+    (q15_t)0x77D7, (q15_t)0x2CF7, (q15_t)0x77CE, (q15_t)0x2D0E, (q15_t)0x77C5, (q15_t)0x2D26, (q15_t)0x77BC, (q15_t)0x2D3D,
+    (q15_t)0x77B4, (q15_t)0x2D55, (q15_t)0x77AB, (q15_t)0x2D6C, (q15_t)0x77A2, (q15_t)0x2D84, (q15_t)0x7799, (q15_t)0x2D9B,
+    (q15_t)0x7790, (q15_t)0x2DB3, (q15_t)0x7787, (q15_t)0x2DCA, (q15_t)0x777E, (q15_t)0x2DE2, (q15_t)0x7775, (q15_t)0x2DF9,
+    (q15_t)0x776C, (q15_t)0x2E11, (q15_t)0x7763, (q15_t)0x2E28, (q15_t)0x775A, (q15_t)0x2E3F, (q15_t)0x7751, (q15_t)0x2E57,
+    (q15_t)0x7747, (q15_t)0x2E6E, (q15_t)0x773E, (q15_t)0x2E86, (q15_t)0x7735, (q15_t)0x2E9D, (q15_t)0x772C, (q15_t)0x2EB5,
+    (q15_t)0x7723, (q15_t)0x2ECC, (q15_t)0x771A, (q15_t)0x2EE3, (q15_t)0x7710, (q15_t)0x2EFB, (q15_t)0x7707, (q15_t)0x2F12,
+    (q15_t)0x76FE, (q15_t)0x2F29, (q15_t)0x76F5, (q15_t)0x2F41, (q15_t)0x76EB, (q15_t)0x2F58, (q15_t)0x76E2, (q15_t)0x2F6F,
+    (q15_t)0x76D9, (q15_t)0x2F87, (q15_t)0x76CF, (q15_t)0x2F9E, (q15_t)0x76C6, (q15_t)0x2FB5, (q15_t)0x76BD, (q15_t)0x2FCD,
+    (q15_t)0x76B3, (q15_t)0x2FE4, (q15_t)0x76AA, (q15_t)0x2FFB, (q15_t)0x76A0, (q15_t)0x3013, (q15_t)0x7697, (q15_t)0x302A,
+    (q15_t)0x768E, (q15_t)0x3041, (q15_t)0x7684, (q15_t)0x3059, (q15_t)0x767B, (q15_t)0x3070, (q15_t)0x7671, (q15_t)0x3087,
+    (q15_t)0x7668, (q15_t)0x309E, (q15_t)0x765E, (q15_t)0x30B6, (q15_t)0x7654, (q15_t)0x30CD, (q15_t)0x764B, (q15_t)0x30E4,
+    (q15_t)0x7641, (q15_t)0x30FB, (q15_t)0x7638, (q15_t)0x3112, (q15_t)0x762E, (q15_t)0x312A, (q15_t)0x7624, (q15_t)0x3141,
+    (q15_t)0x761B, (q15_t)0x3158, (q15_t)0x7611, (q15_t)0x316F, (q15_t)0x7607, (q15_t)0x3186, (q15_t)0x75FD, (q15_t)0x319E,
+    (q15_t)0x75F4, (q15_t)0x31B5, (q15_t)0x75EA, (q15_t)0x31CC, (q15_t)0x75E0, (q15_t)0x31E3, (q15_t)0x75D6, (q15_t)0x31FA,
+    (q15_t)0x75CC, (q15_t)0x3211, (q15_t)0x75C3, (q15_t)0x3228, (q15_t)0x75B9, (q15_t)0x3240, (q15_t)0x75AF, (q15_t)0x3257,
+    (q15_t)0x75A5, (q15_t)0x326E, (q15_t)0x759B, (q15_t)0x3285, (q15_t)0x7591, (q15_t)0x329C, (q15_t)0x7587, (q15_t)0x32B3,
+    (q15_t)0x757D, (q15_t)0x32CA, (q15_t)0x7573, (q15_t)0x32E1, (q15_t)0x7569, (q15_t)0x32F8, (q15_t)0x755F, (q15_t)0x330F,
+    (q15_t)0x7555, (q15_t)0x3326, (q15_t)0x754B, (q15_t)0x333D, (q15_t)0x7541, (q15_t)0x3354, (q15_t)0x7537, (q15_t)0x336B,
+    (q15_t)0x752D, (q15_t)0x3382, (q15_t)0x7523, (q15_t)0x3399, (q15_t)0x7519, (q15_t)0x33B0, (q15_t)0x750F, (q15_t)0x33C7,
+    (q15_t)0x7504, (q15_t)0x33DE, (q15_t)0x74FA, (q15_t)0x33F5, (q15_t)0x74F0, (q15_t)0x340C, (q15_t)0x74E6, (q15_t)0x3423,
+    (q15_t)0x74DB, (q15_t)0x343A, (q15_t)0x74D1, (q15_t)0x3451, (q15_t)0x74C7, (q15_t)0x3468, (q15_t)0x74BD, (q15_t)0x347F,
+    (q15_t)0x74B2, (q15_t)0x3496, (q15_t)0x74A8, (q15_t)0x34AD, (q15_t)0x749E, (q15_t)0x34C4, (q15_t)0x7493, (q15_t)0x34DB,
+    (q15_t)0x7489, (q15_t)0x34F2, (q15_t)0x747E, (q15_t)0x3508, (q15_t)0x7474, (q15_t)0x351F, (q15_t)0x746A, (q15_t)0x3536,
+    (q15_t)0x745F, (q15_t)0x354D, (q15_t)0x7455, (q15_t)0x3564, (q15_t)0x744A, (q15_t)0x357B, (q15_t)0x7440, (q15_t)0x3592,
+    (q15_t)0x7435, (q15_t)0x35A8, (q15_t)0x742B, (q15_t)0x35BF, (q15_t)0x7420, (q15_t)0x35D6, (q15_t)0x7415, (q15_t)0x35ED,
+    (q15_t)0x740B, (q15_t)0x3604, (q15_t)0x7400, (q15_t)0x361A, (q15_t)0x73F6, (q15_t)0x3631, (q15_t)0x73EB, (q15_t)0x3648,
+    (q15_t)0x73E0, (q15_t)0x365F, (q15_t)0x73D6, (q15_t)0x3675, (q15_t)0x73CB, (q15_t)0x368C, (q15_t)0x73C0, (q15_t)0x36A3,
+    (q15_t)0x73B5, (q15_t)0x36BA, (q15_t)0x73AB, (q15_t)0x36D0, (q15_t)0x73A0, (q15_t)0x36E7, (q15_t)0x7395, (q15_t)0x36FE,
+    (q15_t)0x738A, (q15_t)0x3714, (q15_t)0x737F, (q15_t)0x372B, (q15_t)0x7375, (q15_t)0x3742, (q15_t)0x736A, (q15_t)0x3758,
+    (q15_t)0x735F, (q15_t)0x376F, (q15_t)0x7354, (q15_t)0x3786, (q15_t)0x7349, (q15_t)0x379C, (q15_t)0x733E, (q15_t)0x37B3,
+    (q15_t)0x7333, (q15_t)0x37CA, (q15_t)0x7328, (q15_t)0x37E0, (q15_t)0x731D, (q15_t)0x37F7, (q15_t)0x7312, (q15_t)0x380D,
+    (q15_t)0x7307, (q15_t)0x3824, (q15_t)0x72FC, (q15_t)0x383B, (q15_t)0x72F1, (q15_t)0x3851, (q15_t)0x72E6, (q15_t)0x3868,
+    (q15_t)0x72DB, (q15_t)0x387E, (q15_t)0x72D0, (q15_t)0x3895, (q15_t)0x72C5, (q15_t)0x38AB, (q15_t)0x72BA, (q15_t)0x38C2,
+    (q15_t)0x72AF, (q15_t)0x38D8, (q15_t)0x72A3, (q15_t)0x38EF, (q15_t)0x7298, (q15_t)0x3906, (q15_t)0x728D, (q15_t)0x391C,
+    (q15_t)0x7282, (q15_t)0x3932, (q15_t)0x7276, (q15_t)0x3949, (q15_t)0x726B, (q15_t)0x395F, (q15_t)0x7260, (q15_t)0x3976,
+    (q15_t)0x7255, (q15_t)0x398C, (q15_t)0x7249, (q15_t)0x39A3, (q15_t)0x723E, (q15_t)0x39B9, (q15_t)0x7233, (q15_t)0x39D0,
+    (q15_t)0x7227, (q15_t)0x39E6, (q15_t)0x721C, (q15_t)0x39FD, (q15_t)0x7211, (q15_t)0x3A13, (q15_t)0x7205, (q15_t)0x3A29,
+    (q15_t)0x71FA, (q15_t)0x3A40, (q15_t)0x71EE, (q15_t)0x3A56, (q15_t)0x71E3, (q15_t)0x3A6C, (q15_t)0x71D7, (q15_t)0x3A83,
+    (q15_t)0x71CC, (q15_t)0x3A99, (q15_t)0x71C0, (q15_t)0x3AAF, (q15_t)0x71B5, (q15_t)0x3AC6, (q15_t)0x71A9, (q15_t)0x3ADC,
+    (q15_t)0x719E, (q15_t)0x3AF2, (q15_t)0x7192, (q15_t)0x3B09, (q15_t)0x7186, (q15_t)0x3B1F, (q15_t)0x717B, (q15_t)0x3B35,
+    (q15_t)0x716F, (q15_t)0x3B4C, (q15_t)0x7164, (q15_t)0x3B62, (q15_t)0x7158, (q15_t)0x3B78, (q15_t)0x714C, (q15_t)0x3B8E,
+    (q15_t)0x7141, (q15_t)0x3BA5, (q15_t)0x7135, (q15_t)0x3BBB, (q15_t)0x7129, (q15_t)0x3BD1, (q15_t)0x711D, (q15_t)0x3BE7,
+    (q15_t)0x7112, (q15_t)0x3BFD, (q15_t)0x7106, (q15_t)0x3C14, (q15_t)0x70FA, (q15_t)0x3C2A, (q15_t)0x70EE, (q15_t)0x3C40,
+    (q15_t)0x70E2, (q15_t)0x3C56, (q15_t)0x70D6, (q15_t)0x3C6C, (q15_t)0x70CB, (q15_t)0x3C83, (q15_t)0x70BF, (q15_t)0x3C99,
+    (q15_t)0x70B3, (q15_t)0x3CAF, (q15_t)0x70A7, (q15_t)0x3CC5, (q15_t)0x709B, (q15_t)0x3CDB, (q15_t)0x708F, (q15_t)0x3CF1,
+    (q15_t)0x7083, (q15_t)0x3D07, (q15_t)0x7077, (q15_t)0x3D1D, (q15_t)0x706B, (q15_t)0x3D33, (q15_t)0x705F, (q15_t)0x3D49,
+    (q15_t)0x7053, (q15_t)0x3D60, (q15_t)0x7047, (q15_t)0x3D76, (q15_t)0x703B, (q15_t)0x3D8C, (q15_t)0x702F, (q15_t)0x3DA2,
+    (q15_t)0x7023, (q15_t)0x3DB8, (q15_t)0x7016, (q15_t)0x3DCE, (q15_t)0x700A, (q15_t)0x3DE4, (q15_t)0x6FFE, (q15_t)0x3DFA,
+    (q15_t)0x6FF2, (q15_t)0x3E10, (q15_t)0x6FE6, (q15_t)0x3E26, (q15_t)0x6FDA, (q15_t)0x3E3C, (q15_t)0x6FCD, (q15_t)0x3E52,
+    (q15_t)0x6FC1, (q15_t)0x3E68, (q15_t)0x6FB5, (q15_t)0x3E7D, (q15_t)0x6FA9, (q15_t)0x3E93, (q15_t)0x6F9C, (q15_t)0x3EA9,
+    (q15_t)0x6F90, (q15_t)0x3EBF, (q15_t)0x6F84, (q15_t)0x3ED5, (q15_t)0x6F77, (q15_t)0x3EEB, (q15_t)0x6F6B, (q15_t)0x3F01,
+    (q15_t)0x6F5F, (q15_t)0x3F17, (q15_t)0x6F52, (q15_t)0x3F2D, (q15_t)0x6F46, (q15_t)0x3F43, (q15_t)0x6F39, (q15_t)0x3F58,
+    (q15_t)0x6F2D, (q15_t)0x3F6E, (q15_t)0x6F20, (q15_t)0x3F84, (q15_t)0x6F14, (q15_t)0x3F9A, (q15_t)0x6F07, (q15_t)0x3FB0,
+    (q15_t)0x6EFB, (q15_t)0x3FC5, (q15_t)0x6EEE, (q15_t)0x3FDB, (q15_t)0x6EE2, (q15_t)0x3FF1, (q15_t)0x6ED5, (q15_t)0x4007,
+    (q15_t)0x6EC9, (q15_t)0x401D, (q15_t)0x6EBC, (q15_t)0x4032, (q15_t)0x6EAF, (q15_t)0x4048, (q15_t)0x6EA3, (q15_t)0x405E,
+    (q15_t)0x6E96, (q15_t)0x4073, (q15_t)0x6E89, (q15_t)0x4089, (q15_t)0x6E7D, (q15_t)0x409F, (q15_t)0x6E70, (q15_t)0x40B5,
+    (q15_t)0x6E63, (q15_t)0x40CA, (q15_t)0x6E57, (q15_t)0x40E0, (q15_t)0x6E4A, (q15_t)0x40F6, (q15_t)0x6E3D, (q15_t)0x410B,
+    (q15_t)0x6E30, (q15_t)0x4121, (q15_t)0x6E24, (q15_t)0x4136, (q15_t)0x6E17, (q15_t)0x414C, (q15_t)0x6E0A, (q15_t)0x4162,
+    (q15_t)0x6DFD, (q15_t)0x4177, (q15_t)0x6DF0, (q15_t)0x418D, (q15_t)0x6DE3, (q15_t)0x41A2, (q15_t)0x6DD6, (q15_t)0x41B8,
+    (q15_t)0x6DCA, (q15_t)0x41CE, (q15_t)0x6DBD, (q15_t)0x41E3, (q15_t)0x6DB0, (q15_t)0x41F9, (q15_t)0x6DA3, (q15_t)0x420E,
+    (q15_t)0x6D96, (q15_t)0x4224, (q15_t)0x6D89, (q15_t)0x4239, (q15_t)0x6D7C, (q15_t)0x424F, (q15_t)0x6D6F, (q15_t)0x4264,
+    (q15_t)0x6D62, (q15_t)0x427A, (q15_t)0x6D55, (q15_t)0x428F, (q15_t)0x6D48, (q15_t)0x42A5, (q15_t)0x6D3A, (q15_t)0x42BA,
+    (q15_t)0x6D2D, (q15_t)0x42D0, (q15_t)0x6D20, (q15_t)0x42E5, (q15_t)0x6D13, (q15_t)0x42FA, (q15_t)0x6D06, (q15_t)0x4310,
+    (q15_t)0x6CF9, (q15_t)0x4325, (q15_t)0x6CEC, (q15_t)0x433B, (q15_t)0x6CDE, (q15_t)0x4350, (q15_t)0x6CD1, (q15_t)0x4365,
+    (q15_t)0x6CC4, (q15_t)0x437B, (q15_t)0x6CB7, (q15_t)0x4390, (q15_t)0x6CA9, (q15_t)0x43A5, (q15_t)0x6C9C, (q15_t)0x43BB,
+    (q15_t)0x6C8F, (q15_t)0x43D0, (q15_t)0x6C81, (q15_t)0x43E5, (q15_t)0x6C74, (q15_t)0x43FB, (q15_t)0x6C67, (q15_t)0x4410,
+    (q15_t)0x6C59, (q15_t)0x4425, (q15_t)0x6C4C, (q15_t)0x443B, (q15_t)0x6C3F, (q15_t)0x4450, (q15_t)0x6C31, (q15_t)0x4465,
+    (q15_t)0x6C24, (q15_t)0x447A, (q15_t)0x6C16, (q15_t)0x4490, (q15_t)0x6C09, (q15_t)0x44A5, (q15_t)0x6BFB, (q15_t)0x44BA,
+    (q15_t)0x6BEE, (q15_t)0x44CF, (q15_t)0x6BE0, (q15_t)0x44E4, (q15_t)0x6BD3, (q15_t)0x44FA, (q15_t)0x6BC5, (q15_t)0x450F,
+    (q15_t)0x6BB8, (q15_t)0x4524, (q15_t)0x6BAA, (q15_t)0x4539, (q15_t)0x6B9C, (q15_t)0x454E, (q15_t)0x6B8F, (q15_t)0x4563,
+    (q15_t)0x6B81, (q15_t)0x4578, (q15_t)0x6B73, (q15_t)0x458D, (q15_t)0x6B66, (q15_t)0x45A3, (q15_t)0x6B58, (q15_t)0x45B8,
+    (q15_t)0x6B4A, (q15_t)0x45CD, (q15_t)0x6B3D, (q15_t)0x45E2, (q15_t)0x6B2F, (q15_t)0x45F7, (q15_t)0x6B21, (q15_t)0x460C,
+    (q15_t)0x6B13, (q15_t)0x4621, (q15_t)0x6B06, (q15_t)0x4636, (q15_t)0x6AF8, (q15_t)0x464B, (q15_t)0x6AEA, (q15_t)0x4660,
+    (q15_t)0x6ADC, (q15_t)0x4675, (q15_t)0x6ACE, (q15_t)0x468A, (q15_t)0x6AC1, (q15_t)0x469F, (q15_t)0x6AB3, (q15_t)0x46B4,
+    (q15_t)0x6AA5, (q15_t)0x46C9, (q15_t)0x6A97, (q15_t)0x46DE, (q15_t)0x6A89, (q15_t)0x46F3, (q15_t)0x6A7B, (q15_t)0x4708,
+    (q15_t)0x6A6D, (q15_t)0x471C, (q15_t)0x6A5F, (q15_t)0x4731, (q15_t)0x6A51, (q15_t)0x4746, (q15_t)0x6A43, (q15_t)0x475B,
+    (q15_t)0x6A35, (q15_t)0x4770, (q15_t)0x6A27, (q15_t)0x4785, (q15_t)0x6A19, (q15_t)0x479A, (q15_t)0x6A0B, (q15_t)0x47AE,
+    (q15_t)0x69FD, (q15_t)0x47C3, (q15_t)0x69EF, (q15_t)0x47D8, (q15_t)0x69E1, (q15_t)0x47ED, (q15_t)0x69D3, (q15_t)0x4802,
+    (q15_t)0x69C4, (q15_t)0x4816, (q15_t)0x69B6, (q15_t)0x482B, (q15_t)0x69A8, (q15_t)0x4840, (q15_t)0x699A, (q15_t)0x4855,
+    (q15_t)0x698C, (q15_t)0x4869, (q15_t)0x697D, (q15_t)0x487E, (q15_t)0x696F, (q15_t)0x4893, (q15_t)0x6961, (q15_t)0x48A8,
+    (q15_t)0x6953, (q15_t)0x48BC, (q15_t)0x6944, (q15_t)0x48D1, (q15_t)0x6936, (q15_t)0x48E6, (q15_t)0x6928, (q15_t)0x48FA,
+    (q15_t)0x6919, (q15_t)0x490F, (q15_t)0x690B, (q15_t)0x4923, (q15_t)0x68FD, (q15_t)0x4938, (q15_t)0x68EE, (q15_t)0x494D,
+    (q15_t)0x68E0, (q15_t)0x4961, (q15_t)0x68D1, (q15_t)0x4976, (q15_t)0x68C3, (q15_t)0x498A, (q15_t)0x68B5, (q15_t)0x499F,
+    (q15_t)0x68A6, (q15_t)0x49B4, (q15_t)0x6898, (q15_t)0x49C8, (q15_t)0x6889, (q15_t)0x49DD, (q15_t)0x687B, (q15_t)0x49F1,
+    (q15_t)0x686C, (q15_t)0x4A06, (q15_t)0x685E, (q15_t)0x4A1A, (q15_t)0x684F, (q15_t)0x4A2F, (q15_t)0x6840, (q15_t)0x4A43,
+    (q15_t)0x6832, (q15_t)0x4A58, (q15_t)0x6823, (q15_t)0x4A6C, (q15_t)0x6815, (q15_t)0x4A81, (q15_t)0x6806, (q15_t)0x4A95,
+    (q15_t)0x67F7, (q15_t)0x4AA9, (q15_t)0x67E9, (q15_t)0x4ABE, (q15_t)0x67DA, (q15_t)0x4AD2, (q15_t)0x67CB, (q15_t)0x4AE7,
+    (q15_t)0x67BD, (q15_t)0x4AFB, (q15_t)0x67AE, (q15_t)0x4B0F, (q15_t)0x679F, (q15_t)0x4B24, (q15_t)0x6790, (q15_t)0x4B38,
+    (q15_t)0x6782, (q15_t)0x4B4C, (q15_t)0x6773, (q15_t)0x4B61, (q15_t)0x6764, (q15_t)0x4B75, (q15_t)0x6755, (q15_t)0x4B89,
+    (q15_t)0x6746, (q15_t)0x4B9E, (q15_t)0x6737, (q15_t)0x4BB2, (q15_t)0x6729, (q15_t)0x4BC6, (q15_t)0x671A, (q15_t)0x4BDA,
+    (q15_t)0x670B, (q15_t)0x4BEF, (q15_t)0x66FC, (q15_t)0x4C03, (q15_t)0x66ED, (q15_t)0x4C17, (q15_t)0x66DE, (q15_t)0x4C2B,
+    (q15_t)0x66CF, (q15_t)0x4C3F, (q15_t)0x66C0, (q15_t)0x4C54, (q15_t)0x66B1, (q15_t)0x4C68, (q15_t)0x66A2, (q15_t)0x4C7C,
+    (q15_t)0x6693, (q15_t)0x4C90, (q15_t)0x6684, (q15_t)0x4CA4, (q15_t)0x6675, (q15_t)0x4CB8, (q15_t)0x6666, (q15_t)0x4CCC,
+    (q15_t)0x6657, (q15_t)0x4CE1, (q15_t)0x6648, (q15_t)0x4CF5, (q15_t)0x6639, (q15_t)0x4D09, (q15_t)0x6629, (q15_t)0x4D1D,
+    (q15_t)0x661A, (q15_t)0x4D31, (q15_t)0x660B, (q15_t)0x4D45, (q15_t)0x65FC, (q15_t)0x4D59, (q15_t)0x65ED, (q15_t)0x4D6D,
+    (q15_t)0x65DD, (q15_t)0x4D81, (q15_t)0x65CE, (q15_t)0x4D95, (q15_t)0x65BF, (q15_t)0x4DA9, (q15_t)0x65B0, (q15_t)0x4DBD,
+    (q15_t)0x65A0, (q15_t)0x4DD1, (q15_t)0x6591, (q15_t)0x4DE5, (q15_t)0x6582, (q15_t)0x4DF9, (q15_t)0x6573, (q15_t)0x4E0D,
+    (q15_t)0x6563, (q15_t)0x4E21, (q15_t)0x6554, (q15_t)0x4E34, (q15_t)0x6545, (q15_t)0x4E48, (q15_t)0x6535, (q15_t)0x4E5C,
+    (q15_t)0x6526, (q15_t)0x4E70, (q15_t)0x6516, (q15_t)0x4E84, (q15_t)0x6507, (q15_t)0x4E98, (q15_t)0x64F7, (q15_t)0x4EAC,
+    (q15_t)0x64E8, (q15_t)0x4EBF, (q15_t)0x64D9, (q15_t)0x4ED3, (q15_t)0x64C9, (q15_t)0x4EE7, (q15_t)0x64BA, (q15_t)0x4EFB,
+    (q15_t)0x64AA, (q15_t)0x4F0F, (q15_t)0x649B, (q15_t)0x4F22, (q15_t)0x648B, (q15_t)0x4F36, (q15_t)0x647B, (q15_t)0x4F4A,
+    (q15_t)0x646C, (q15_t)0x4F5E, (q15_t)0x645C, (q15_t)0x4F71, (q15_t)0x644D, (q15_t)0x4F85, (q15_t)0x643D, (q15_t)0x4F99,
+    (q15_t)0x642D, (q15_t)0x4FAC, (q15_t)0x641E, (q15_t)0x4FC0, (q15_t)0x640E, (q15_t)0x4FD4, (q15_t)0x63FE, (q15_t)0x4FE7,
+    (q15_t)0x63EF, (q15_t)0x4FFB, (q15_t)0x63DF, (q15_t)0x500F, (q15_t)0x63CF, (q15_t)0x5022, (q15_t)0x63C0, (q15_t)0x5036,
+    (q15_t)0x63B0, (q15_t)0x5049, (q15_t)0x63A0, (q15_t)0x505D, (q15_t)0x6390, (q15_t)0x5070, (q15_t)0x6380, (q15_t)0x5084,
+    (q15_t)0x6371, (q15_t)0x5097, (q15_t)0x6361, (q15_t)0x50AB, (q15_t)0x6351, (q15_t)0x50BF, (q15_t)0x6341, (q15_t)0x50D2,
+    (q15_t)0x6331, (q15_t)0x50E5, (q15_t)0x6321, (q15_t)0x50F9, (q15_t)0x6311, (q15_t)0x510C, (q15_t)0x6301, (q15_t)0x5120,
+    (q15_t)0x62F2, (q15_t)0x5133, (q15_t)0x62E2, (q15_t)0x5147, (q15_t)0x62D2, (q15_t)0x515A, (q15_t)0x62C2, (q15_t)0x516E,
+    (q15_t)0x62B2, (q15_t)0x5181, (q15_t)0x62A2, (q15_t)0x5194, (q15_t)0x6292, (q15_t)0x51A8, (q15_t)0x6282, (q15_t)0x51BB,
+    (q15_t)0x6271, (q15_t)0x51CE, (q15_t)0x6261, (q15_t)0x51E2, (q15_t)0x6251, (q15_t)0x51F5, (q15_t)0x6241, (q15_t)0x5208,
+    (q15_t)0x6231, (q15_t)0x521C, (q15_t)0x6221, (q15_t)0x522F, (q15_t)0x6211, (q15_t)0x5242, (q15_t)0x6201, (q15_t)0x5255,
+    (q15_t)0x61F1, (q15_t)0x5269, (q15_t)0x61E0, (q15_t)0x527C, (q15_t)0x61D0, (q15_t)0x528F, (q15_t)0x61C0, (q15_t)0x52A2,
+    (q15_t)0x61B0, (q15_t)0x52B5, (q15_t)0x619F, (q15_t)0x52C9, (q15_t)0x618F, (q15_t)0x52DC, (q15_t)0x617F, (q15_t)0x52EF,
+    (q15_t)0x616F, (q15_t)0x5302, (q15_t)0x615E, (q15_t)0x5315, (q15_t)0x614E, (q15_t)0x5328, (q15_t)0x613E, (q15_t)0x533B,
+    (q15_t)0x612D, (q15_t)0x534E, (q15_t)0x611D, (q15_t)0x5362, (q15_t)0x610D, (q15_t)0x5375, (q15_t)0x60FC, (q15_t)0x5388,
+    (q15_t)0x60EC, (q15_t)0x539B, (q15_t)0x60DB, (q15_t)0x53AE, (q15_t)0x60CB, (q15_t)0x53C1, (q15_t)0x60BA, (q15_t)0x53D4,
+    (q15_t)0x60AA, (q15_t)0x53E7, (q15_t)0x6099, (q15_t)0x53FA, (q15_t)0x6089, (q15_t)0x540D, (q15_t)0x6078, (q15_t)0x5420,
+    (q15_t)0x6068, (q15_t)0x5433, (q15_t)0x6057, (q15_t)0x5445, (q15_t)0x6047, (q15_t)0x5458, (q15_t)0x6036, (q15_t)0x546B,
+    (q15_t)0x6026, (q15_t)0x547E, (q15_t)0x6015, (q15_t)0x5491, (q15_t)0x6004, (q15_t)0x54A4, (q15_t)0x5FF4, (q15_t)0x54B7,
+    (q15_t)0x5FE3, (q15_t)0x54CA, (q15_t)0x5FD3, (q15_t)0x54DC, (q15_t)0x5FC2, (q15_t)0x54EF, (q15_t)0x5FB1, (q15_t)0x5502,
+    (q15_t)0x5FA0, (q15_t)0x5515, (q15_t)0x5F90, (q15_t)0x5528, (q15_t)0x5F7F, (q15_t)0x553A, (q15_t)0x5F6E, (q15_t)0x554D,
+    (q15_t)0x5F5E, (q15_t)0x5560, (q15_t)0x5F4D, (q15_t)0x5572, (q15_t)0x5F3C, (q15_t)0x5585, (q15_t)0x5F2B, (q15_t)0x5598,
+    (q15_t)0x5F1A, (q15_t)0x55AB, (q15_t)0x5F0A, (q15_t)0x55BD, (q15_t)0x5EF9, (q15_t)0x55D0, (q15_t)0x5EE8, (q15_t)0x55E3,
+    (q15_t)0x5ED7, (q15_t)0x55F5, (q15_t)0x5EC6, (q15_t)0x5608, (q15_t)0x5EB5, (q15_t)0x561A, (q15_t)0x5EA4, (q15_t)0x562D,
+    (q15_t)0x5E93, (q15_t)0x5640, (q15_t)0x5E82, (q15_t)0x5652, (q15_t)0x5E71, (q15_t)0x5665, (q15_t)0x5E60, (q15_t)0x5677,
+    (q15_t)0x5E50, (q15_t)0x568A, (q15_t)0x5E3F, (q15_t)0x569C, (q15_t)0x5E2D, (q15_t)0x56AF, (q15_t)0x5E1C, (q15_t)0x56C1,
+    (q15_t)0x5E0B, (q15_t)0x56D4, (q15_t)0x5DFA, (q15_t)0x56E6, (q15_t)0x5DE9, (q15_t)0x56F9, (q15_t)0x5DD8, (q15_t)0x570B,
+    (q15_t)0x5DC7, (q15_t)0x571D, (q15_t)0x5DB6, (q15_t)0x5730, (q15_t)0x5DA5, (q15_t)0x5742, (q15_t)0x5D94, (q15_t)0x5755,
+    (q15_t)0x5D83, (q15_t)0x5767, (q15_t)0x5D71, (q15_t)0x5779, (q15_t)0x5D60, (q15_t)0x578C, (q15_t)0x5D4F, (q15_t)0x579E,
+    (q15_t)0x5D3E, (q15_t)0x57B0, (q15_t)0x5D2D, (q15_t)0x57C3, (q15_t)0x5D1B, (q15_t)0x57D5, (q15_t)0x5D0A, (q15_t)0x57E7,
+    (q15_t)0x5CF9, (q15_t)0x57F9, (q15_t)0x5CE8, (q15_t)0x580C, (q15_t)0x5CD6, (q15_t)0x581E, (q15_t)0x5CC5, (q15_t)0x5830,
+    (q15_t)0x5CB4, (q15_t)0x5842, (q15_t)0x5CA2, (q15_t)0x5855, (q15_t)0x5C91, (q15_t)0x5867, (q15_t)0x5C80, (q15_t)0x5879,
+    (q15_t)0x5C6E, (q15_t)0x588B, (q15_t)0x5C5D, (q15_t)0x589D, (q15_t)0x5C4B, (q15_t)0x58AF, (q15_t)0x5C3A, (q15_t)0x58C1,
+    (q15_t)0x5C29, (q15_t)0x58D4, (q15_t)0x5C17, (q15_t)0x58E6, (q15_t)0x5C06, (q15_t)0x58F8, (q15_t)0x5BF4, (q15_t)0x590A,
+    (q15_t)0x5BE3, (q15_t)0x591C, (q15_t)0x5BD1, (q15_t)0x592E, (q15_t)0x5BC0, (q15_t)0x5940, (q15_t)0x5BAE, (q15_t)0x5952,
+    (q15_t)0x5B9D, (q15_t)0x5964, (q15_t)0x5B8B, (q15_t)0x5976, (q15_t)0x5B79, (q15_t)0x5988, (q15_t)0x5B68, (q15_t)0x599A,
+    (q15_t)0x5B56, (q15_t)0x59AC, (q15_t)0x5B45, (q15_t)0x59BE, (q15_t)0x5B33, (q15_t)0x59D0, (q15_t)0x5B21, (q15_t)0x59E1,
+    (q15_t)0x5B10, (q15_t)0x59F3, (q15_t)0x5AFE, (q15_t)0x5A05, (q15_t)0x5AEC, (q15_t)0x5A17, (q15_t)0x5ADB, (q15_t)0x5A29,
+    (q15_t)0x5AC9, (q15_t)0x5A3B, (q15_t)0x5AB7, (q15_t)0x5A4D, (q15_t)0x5AA5, (q15_t)0x5A5E, (q15_t)0x5A94, (q15_t)0x5A70,
+    (q15_t)0x5A82, (q15_t)0x5A82, (q15_t)0x5A70, (q15_t)0x5A94, (q15_t)0x5A5E, (q15_t)0x5AA5, (q15_t)0x5A4D, (q15_t)0x5AB7,
+    (q15_t)0x5A3B, (q15_t)0x5AC9, (q15_t)0x5A29, (q15_t)0x5ADB, (q15_t)0x5A17, (q15_t)0x5AEC, (q15_t)0x5A05, (q15_t)0x5AFE,
+    (q15_t)0x59F3, (q15_t)0x5B10, (q15_t)0x59E1, (q15_t)0x5B21, (q15_t)0x59D0, (q15_t)0x5B33, (q15_t)0x59BE, (q15_t)0x5B45,
+    (q15_t)0x59AC, (q15_t)0x5B56, (q15_t)0x599A, (q15_t)0x5B68, (q15_t)0x5988, (q15_t)0x5B79, (q15_t)0x5976, (q15_t)0x5B8B,
+    (q15_t)0x5964, (q15_t)0x5B9D, (q15_t)0x5952, (q15_t)0x5BAE, (q15_t)0x5940, (q15_t)0x5BC0, (q15_t)0x592E, (q15_t)0x5BD1,
+    (q15_t)0x591C, (q15_t)0x5BE3, (q15_t)0x590A, (q15_t)0x5BF4, (q15_t)0x58F8, (q15_t)0x5C06, (q15_t)0x58E6, (q15_t)0x5C17,
+    (q15_t)0x58D4, (q15_t)0x5C29, (q15_t)0x58C1, (q15_t)0x5C3A, (q15_t)0x58AF, (q15_t)0x5C4B, (q15_t)0x589D, (q15_t)0x5C5D,
+    (q15_t)0x588B, (q15_t)0x5C6E, (q15_t)0x5879, (q15_t)0x5C80, (q15_t)0x5867, (q15_t)0x5C91, (q15_t)0x5855, (q15_t)0x5CA2,
+    (q15_t)0x5842, (q15_t)0x5CB4, (q15_t)0x5830, (q15_t)0x5CC5, (q15_t)0x581E, (q15_t)0x5CD6, (q15_t)0x580C, (q15_t)0x5CE8,
+    (q15_t)0x57F9, (q15_t)0x5CF9, (q15_t)0x57E7, (q15_t)0x5D0A, (q15_t)0x57D5, (q15_t)0x5D1B, (q15_t)0x57C3, (q15_t)0x5D2D,
+    (q15_t)0x57B0, (q15_t)0x5D3E, (q15_t)0x579E, (q15_t)0x5D4F, (q15_t)0x578C, (q15_t)0x5D60, (q15_t)0x5779, (q15_t)0x5D71,
+    (q15_t)0x5767, (q15_t)0x5D83, (q15_t)0x5755, (q15_t)0x5D94, (q15_t)0x5742, (q15_t)0x5DA5, (q15_t)0x5730, (q15_t)0x5DB6,
+    (q15_t)0x571D, (q15_t)0x5DC7, (q15_t)0x570B, (q15_t)0x5DD8, (q15_t)0x56F9, (q15_t)0x5DE9, (q15_t)0x56E6, (q15_t)0x5DFA,
+    (q15_t)0x56D4, (q15_t)0x5E0B, (q15_t)0x56C1, (q15_t)0x5E1C, (q15_t)0x56AF, (q15_t)0x5E2D, (q15_t)0x569C, (q15_t)0x5E3F,
+    (q15_t)0x568A, (q15_t)0x5E50, (q15_t)0x5677, (q15_t)0x5E60, (q15_t)0x5665, (q15_t)0x5E71, (q15_t)0x5652, (q15_t)0x5E82,
+    (q15_t)0x5640, (q15_t)0x5E93, (q15_t)0x562D, (q15_t)0x5EA4, (q15_t)0x561A, (q15_t)0x5EB5, (q15_t)0x5608, (q15_t)0x5EC6,
+    (q15_t)0x55F5, (q15_t)0x5ED7, (q15_t)0x55E3, (q15_t)0x5EE8, (q15_t)0x55D0, (q15_t)0x5EF9, (q15_t)0x55BD, (q15_t)0x5F0A,
+    (q15_t)0x55AB, (q15_t)0x5F1A, (q15_t)0x5598, (q15_t)0x5F2B, (q15_t)0x5585, (q15_t)0x5F3C, (q15_t)0x5572, (q15_t)0x5F4D,
+    (q15_t)0x5560, (q15_t)0x5F5E, (q15_t)0x554D, (q15_t)0x5F6E, (q15_t)0x553A, (q15_t)0x5F7F, (q15_t)0x5528, (q15_t)0x5F90,
+    (q15_t)0x5515, (q15_t)0x5FA0, (q15_t)0x5502, (q15_t)0x5FB1, (q15_t)0x54EF, (q15_t)0x5FC2, (q15_t)0x54DC, (q15_t)0x5FD3,
+    (q15_t)0x54CA, (q15_t)0x5FE3, (q15_t)0x54B7, (q15_t)0x5FF4, (q15_t)0x54A4, (q15_t)0x6004, (q15_t)0x5491, (q15_t)0x6015,
+    (q15_t)0x547E, (q15_t)0x6026, (q15_t)0x546B, (q15_t)0x6036, (q15_t)0x5458, (q15_t)0x6047, (q15_t)0x5445, (q15_t)0x6057,
+    (q15_t)0x5433, (q15_t)0x6068, (q15_t)0x5420, (q15_t)0x6078, (q15_t)0x540D, (q15_t)0x6089, (q15_t)0x53FA, (q15_t)0x6099,
+    (q15_t)0x53E7, (q15_t)0x60AA, (q15_t)0x53D4, (q15_t)0x60BA, (q15_t)0x53C1, (q15_t)0x60CB, (q15_t)0x53AE, (q15_t)0x60DB,
+    (q15_t)0x539B, (q15_t)0x60EC, (q15_t)0x5388, (q15_t)0x60FC, (q15_t)0x5375, (q15_t)0x610D, (q15_t)0x5362, (q15_t)0x611D,
+    (q15_t)0x534E, (q15_t)0x612D, (q15_t)0x533B, (q15_t)0x613E, (q15_t)0x5328, (q15_t)0x614E, (q15_t)0x5315, (q15_t)0x615E,
+    (q15_t)0x5302, (q15_t)0x616F, (q15_t)0x52EF, (q15_t)0x617F, (q15_t)0x52DC, (q15_t)0x618F, (q15_t)0x52C9, (q15_t)0x619F,
+    (q15_t)0x52B5, (q15_t)0x61B0, (q15_t)0x52A2, (q15_t)0x61C0, (q15_t)0x528F, (q15_t)0x61D0, (q15_t)0x527C, (q15_t)0x61E0,
+    (q15_t)0x5269, (q15_t)0x61F1, (q15_t)0x5255, (q15_t)0x6201, (q15_t)0x5242, (q15_t)0x6211, (q15_t)0x522F, (q15_t)0x6221,
+    (q15_t)0x521C, (q15_t)0x6231, (q15_t)0x5208, (q15_t)0x6241, (q15_t)0x51F5, (q15_t)0x6251, (q15_t)0x51E2, (q15_t)0x6261,
+    (q15_t)0x51CE, (q15_t)0x6271, (q15_t)0x51BB, (q15_t)0x6282, (q15_t)0x51A8, (q15_t)0x6292, (q15_t)0x5194, (q15_t)0x62A2,
+    (q15_t)0x5181, (q15_t)0x62B2, (q15_t)0x516E, (q15_t)0x62C2, (q15_t)0x515A, (q15_t)0x62D2, (q15_t)0x5147, (q15_t)0x62E2,
+    (q15_t)0x5133, (q15_t)0x62F2, (q15_t)0x5120, (q15_t)0x6301, (q15_t)0x510C, (q15_t)0x6311, (q15_t)0x50F9, (q15_t)0x6321,
+    (q15_t)0x50E5, (q15_t)0x6331, (q15_t)0x50D2, (q15_t)0x6341, (q15_t)0x50BF, (q15_t)0x6351, (q15_t)0x50AB, (q15_t)0x6361,
+    (q15_t)0x5097, (q15_t)0x6371, (q15_t)0x5084, (q15_t)0x6380, (q15_t)0x5070, (q15_t)0x6390, (q15_t)0x505D, (q15_t)0x63A0,
+    (q15_t)0x5049, (q15_t)0x63B0, (q15_t)0x5036, (q15_t)0x63C0, (q15_t)0x5022, (q15_t)0x63CF, (q15_t)0x500F, (q15_t)0x63DF,
+    (q15_t)0x4FFB, (q15_t)0x63EF, (q15_t)0x4FE7, (q15_t)0x63FE, (q15_t)0x4FD4, (q15_t)0x640E, (q15_t)0x4FC0, (q15_t)0x641E,
+    (q15_t)0x4FAC, (q15_t)0x642D, (q15_t)0x4F99, (q15_t)0x643D, (q15_t)0x4F85, (q15_t)0x644D, (q15_t)0x4F71, (q15_t)0x645C,
+    (q15_t)0x4F5E, (q15_t)0x646C, (q15_t)0x4F4A, (q15_t)0x647B, (q15_t)0x4F36, (q15_t)0x648B, (q15_t)0x4F22, (q15_t)0x649B,
+    (q15_t)0x4F0F, (q15_t)0x64AA, (q15_t)0x4EFB, (q15_t)0x64BA, (q15_t)0x4EE7, (q15_t)0x64C9, (q15_t)0x4ED3, (q15_t)0x64D9,
+    (q15_t)0x4EBF, (q15_t)0x64E8, (q15_t)0x4EAC, (q15_t)0x64F7, (q15_t)0x4E98, (q15_t)0x6507, (q15_t)0x4E84, (q15_t)0x6516,
+    (q15_t)0x4E70, (q15_t)0x6526, (q15_t)0x4E5C, (q15_t)0x6535, (q15_t)0x4E48, (q15_t)0x6545, (q15_t)0x4E34, (q15_t)0x6554,
+    (q15_t)0x4E21, (q15_t)0x6563, (q15_t)0x4E0D, (q15_t)0x6573, (q15_t)0x4DF9, (q15_t)0x6582, (q15_t)0x4DE5, (q15_t)0x6591,
+    (q15_t)0x4DD1, (q15_t)0x65A0, (q15_t)0x4DBD, (q15_t)0x65B0, (q15_t)0x4DA9, (q15_t)0x65BF, (q15_t)0x4D95, (q15_t)0x65CE,
+    (q15_t)0x4D81, (q15_t)0x65DD, (q15_t)0x4D6D, (q15_t)0x65ED, (q15_t)0x4D59, (q15_t)0x65FC, (q15_t)0x4D45, (q15_t)0x660B,
+    (q15_t)0x4D31, (q15_t)0x661A, (q15_t)0x4D1D, (q15_t)0x6629, (q15_t)0x4D09, (q15_t)0x6639, (q15_t)0x4CF5, (q15_t)0x6648,
+    (q15_t)0x4CE1, (q15_t)0x6657, (q15_t)0x4CCC, (q15_t)0x6666, (q15_t)0x4CB8, (q15_t)0x6675, (q15_t)0x4CA4, (q15_t)0x6684,
+    (q15_t)0x4C90, (q15_t)0x6693, (q15_t)0x4C7C, (q15_t)0x66A2, (q15_t)0x4C68, (q15_t)0x66B1, (q15_t)0x4C54, (q15_t)0x66C0,
+    (q15_t)0x4C3F, (q15_t)0x66CF, (q15_t)0x4C2B, (q15_t)0x66DE, (q15_t)0x4C17, (q15_t)0x66ED, (q15_t)0x4C03, (q15_t)0x66FC,
+    (q15_t)0x4BEF, (q15_t)0x670B, (q15_t)0x4BDA, (q15_t)0x671A, (q15_t)0x4BC6, (q15_t)0x6729, (q15_t)0x4BB2, (q15_t)0x6737,
+    (q15_t)0x4B9E, (q15_t)0x6746, (q15_t)0x4B89, (q15_t)0x6755, (q15_t)0x4B75, (q15_t)0x6764, (q15_t)0x4B61, (q15_t)0x6773,
+    (q15_t)0x4B4C, (q15_t)0x6782, (q15_t)0x4B38, (q15_t)0x6790, (q15_t)0x4B24, (q15_t)0x679F, (q15_t)0x4B0F, (q15_t)0x67AE,
+    (q15_t)0x4AFB, (q15_t)0x67BD, (q15_t)0x4AE7, (q15_t)0x67CB, (q15_t)0x4AD2, (q15_t)0x67DA, (q15_t)0x4ABE, (q15_t)0x67E9,
+    (q15_t)0x4AA9, (q15_t)0x67F7, (q15_t)0x4A95, (q15_t)0x6806, (q15_t)0x4A81, (q15_t)0x6815, (q15_t)0x4A6C, (q15_t)0x6823,
+    (q15_t)0x4A58, (q15_t)0x6832, (q15_t)0x4A43, (q15_t)0x6840, (q15_t)0x4A2F, (q15_t)0x684F, (q15_t)0x4A1A, (q15_t)0x685E,
+    (q15_t)0x4A06, (q15_t)0x686C, (q15_t)0x49F1, (q15_t)0x687B, (q15_t)0x49DD, (q15_t)0x6889, (q15_t)0x49C8, (q15_t)0x6898,
+    (q15_t)0x49B4, (q15_t)0x68A6, (q15_t)0x499F, (q15_t)0x68B5, (q15_t)0x498A, (q15_t)0x68C3, (q15_t)0x4976, (q15_t)0x68D1,
+    (q15_t)0x4961, (q15_t)0x68E0, (q15_t)0x494D, (q15_t)0x68EE, (q15_t)0x4938, (q15_t)0x68FD, (q15_t)0x4923, (q15_t)0x690B,
+    (q15_t)0x490F, (q15_t)0x6919, (q15_t)0x48FA, (q15_t)0x6928, (q15_t)0x48E6, (q15_t)0x6936, (q15_t)0x48D1, (q15_t)0x6944,
+    (q15_t)0x48BC, (q15_t)0x6953, (q15_t)0x48A8, (q15_t)0x6961, (q15_t)0x4893, (q15_t)0x696F, (q15_t)0x487E, (q15_t)0x697D,
+    (q15_t)0x4869, (q15_t)0x698C, (q15_t)0x4855, (q15_t)0x699A, (q15_t)0x4840, (q15_t)0x69A8, (q15_t)0x482B, (q15_t)0x69B6,
+    (q15_t)0x4816, (q15_t)0x69C4, (q15_t)0x4802, (q15_t)0x69D3, (q15_t)0x47ED, (q15_t)0x69E1, (q15_t)0x47D8, (q15_t)0x69EF,
+    (q15_t)0x47C3, (q15_t)0x69FD, (q15_t)0x47AE, (q15_t)0x6A0B, (q15_t)0x479A, (q15_t)0x6A19, (q15_t)0x4785, (q15_t)0x6A27,
+    (q15_t)0x4770, (q15_t)0x6A35, (q15_t)0x475B, (q15_t)0x6A43, (q15_t)0x4746, (q15_t)0x6A51, (q15_t)0x4731, (q15_t)0x6A5F,
+    (q15_t)0x471C, (q15_t)0x6A6D, (q15_t)0x4708, (q15_t)0x6A7B, (q15_t)0x46F3, (q15_t)0x6A89, (q15_t)0x46DE, (q15_t)0x6A97,
+    (q15_t)0x46C9, (q15_t)0x6AA5, (q15_t)0x46B4, (q15_t)0x6AB3, (q15_t)0x469F, (q15_t)0x6AC1, (q15_t)0x468A, (q15_t)0x6ACE,
+    (q15_t)0x4675, (q15_t)0x6ADC, (q15_t)0x4660, (q15_t)0x6AEA, (q15_t)0x464B, (q15_t)0x6AF8, (q15_t)0x4636, (q15_t)0x6B06,
+    (q15_t)0x4621, (q15_t)0x6B13, (q15_t)0x460C, (q15_t)0x6B21, (q15_t)0x45F7, (q15_t)0x6B2F, (q15_t)0x45E2, (q15_t)0x6B3D,
+    (q15_t)0x45CD, (q15_t)0x6B4A, (q15_t)0x45B8, (q15_t)0x6B58, (q15_t)0x45A3, (q15_t)0x6B66, (q15_t)0x458D, (q15_t)0x6B73,
+    (q15_t)0x4578, (q15_t)0x6B81, (q15_t)0x4563, (q15_t)0x6B8F, (q15_t)0x454E, (q15_t)0x6B9C, (q15_t)0x4539, (q15_t)0x6BAA,
+    (q15_t)0x4524, (q15_t)0x6BB8, (q15_t)0x450F, (q15_t)0x6BC5, (q15_t)0x44FA, (q15_t)0x6BD3, (q15_t)0x44E4, (q15_t)0x6BE0,
+    (q15_t)0x44CF, (q15_t)0x6BEE, (q15_t)0x44BA, (q15_t)0x6BFB, (q15_t)0x44A5, (q15_t)0x6C09, (q15_t)0x4490, (q15_t)0x6C16,
+    (q15_t)0x447A, (q15_t)0x6C24, (q15_t)0x4465, (q15_t)0x6C31, (q15_t)0x4450, (q15_t)0x6C3F, (q15_t)0x443B, (q15_t)0x6C4C,
+    (q15_t)0x4425, (q15_t)0x6C59, (q15_t)0x4410, (q15_t)0x6C67, (q15_t)0x43FB, (q15_t)0x6C74, (q15_t)0x43E5, (q15_t)0x6C81,
+    (q15_t)0x43D0, (q15_t)0x6C8F, (q15_t)0x43BB, (q15_t)0x6C9C, (q15_t)0x43A5, (q15_t)0x6CA9, (q15_t)0x4390, (q15_t)0x6CB7,
+    (q15_t)0x437B, (q15_t)0x6CC4, (q15_t)0x4365, (q15_t)0x6CD1, (q15_t)0x4350, (q15_t)0x6CDE, (q15_t)0x433B, (q15_t)0x6CEC,
+    (q15_t)0x4325, (q15_t)0x6CF9, (q15_t)0x4310, (q15_t)0x6D06, (q15_t)0x42FA, (q15_t)0x6D13, (q15_t)0x42E5, (q15_t)0x6D20,
+    (q15_t)0x42D0, (q15_t)0x6D2D, (q15_t)0x42BA, (q15_t)0x6D3A, (q15_t)0x42A5, (q15_t)0x6D48, (q15_t)0x428F, (q15_t)0x6D55,
+    (q15_t)0x427A, (q15_t)0x6D62, (q15_t)0x4264, (q15_t)0x6D6F, (q15_t)0x424F, (q15_t)0x6D7C, (q15_t)0x4239, (q15_t)0x6D89,
+    (q15_t)0x4224, (q15_t)0x6D96, (q15_t)0x420E, (q15_t)0x6DA3, (q15_t)0x41F9, (q15_t)0x6DB0, (q15_t)0x41E3, (q15_t)0x6DBD,
+    (q15_t)0x41CE, (q15_t)0x6DCA, (q15_t)0x41B8, (q15_t)0x6DD6, (q15_t)0x41A2, (q15_t)0x6DE3, (q15_t)0x418D, (q15_t)0x6DF0,
+    (q15_t)0x4177, (q15_t)0x6DFD, (q15_t)0x4162, (q15_t)0x6E0A, (q15_t)0x414C, (q15_t)0x6E17, (q15_t)0x4136, (q15_t)0x6E24,
+    (q15_t)0x4121, (q15_t)0x6E30, (q15_t)0x410B, (q15_t)0x6E3D, (q15_t)0x40F6, (q15_t)0x6E4A, (q15_t)0x40E0, (q15_t)0x6E57,
+    (q15_t)0x40CA, (q15_t)0x6E63, (q15_t)0x40B5, (q15_t)0x6E70, (q15_t)0x409F, (q15_t)0x6E7D, (q15_t)0x4089, (q15_t)0x6E89,
+    (q15_t)0x4073, (q15_t)0x6E96, (q15_t)0x405E, (q15_t)0x6EA3, (q15_t)0x4048, (q15_t)0x6EAF, (q15_t)0x4032, (q15_t)0x6EBC,
+    (q15_t)0x401D, (q15_t)0x6EC9, (q15_t)0x4007, (q15_t)0x6ED5, (q15_t)0x3FF1, (q15_t)0x6EE2, (q15_t)0x3FDB, (q15_t)0x6EEE,
+    (q15_t)0x3FC5, (q15_t)0x6EFB, (q15_t)0x3FB0, (q15_t)0x6F07, (q15_t)0x3F9A, (q15_t)0x6F14, (q15_t)0x3F84, (q15_t)0x6F20,
+    (q15_t)0x3F6E, (q15_t)0x6F2D, (q15_t)0x3F58, (q15_t)0x6F39, (q15_t)0x3F43, (q15_t)0x6F46, (q15_t)0x3F2D, (q15_t)0x6F52,
+    (q15_t)0x3F17, (q15_t)0x6F5F, (q15_t)0x3F01, (q15_t)0x6F6B, (q15_t)0x3EEB, (q15_t)0x6F77, (q15_t)0x3ED5, (q15_t)0x6F84,
+    (q15_t)0x3EBF, (q15_t)0x6F90, (q15_t)0x3EA9, (q15_t)0x6F9C, (q15_t)0x3E93, (q15_t)0x6FA9, (q15_t)0x3E7D, (q15_t)0x6FB5,
+    (q15_t)0x3E68, (q15_t)0x6FC1, (q15_t)0x3E52, (q15_t)0x6FCD, (q15_t)0x3E3C, (q15_t)0x6FDA, (q15_t)0x3E26, (q15_t)0x6FE6,
+    (q15_t)0x3E10, (q15_t)0x6FF2, (q15_t)0x3DFA, (q15_t)0x6FFE, (q15_t)0x3DE4, (q15_t)0x700A, (q15_t)0x3DCE, (q15_t)0x7016,
+    (q15_t)0x3DB8, (q15_t)0x7023, (q15_t)0x3DA2, (q15_t)0x702F, (q15_t)0x3D8C, (q15_t)0x703B, (q15_t)0x3D76, (q15_t)0x7047,
+    (q15_t)0x3D60, (q15_t)0x7053, (q15_t)0x3D49, (q15_t)0x705F, (q15_t)0x3D33, (q15_t)0x706B, (q15_t)0x3D1D, (q15_t)0x7077,
+    (q15_t)0x3D07, (q15_t)0x7083, (q15_t)0x3CF1, (q15_t)0x708F, (q15_t)0x3CDB, (q15_t)0x709B, (q15_t)0x3CC5, (q15_t)0x70A7,
+    (q15_t)0x3CAF, (q15_t)0x70B3, (q15_t)0x3C99, (q15_t)0x70BF, (q15_t)0x3C83, (q15_t)0x70CB, (q15_t)0x3C6C, (q15_t)0x70D6,
+    (q15_t)0x3C56, (q15_t)0x70E2, (q15_t)0x3C40, (q15_t)0x70EE, (q15_t)0x3C2A, (q15_t)0x70FA, (q15_t)0x3C14, (q15_t)0x7106,
+    (q15_t)0x3BFD, (q15_t)0x7112, (q15_t)0x3BE7, (q15_t)0x711D, (q15_t)0x3BD1, (q15_t)0x7129, (q15_t)0x3BBB, (q15_t)0x7135,
+    (q15_t)0x3BA5, (q15_t)0x7141, (q15_t)0x3B8E, (q15_t)0x714C, (q15_t)0x3B78, (q15_t)0x7158, (q15_t)0x3B62, (q15_t)0x7164,
+    (q15_t)0x3B4C, (q15_t)0x716F, (q15_t)0x3B35, (q15_t)0x717B, (q15_t)0x3B1F, (q15_t)0x7186, (q15_t)0x3B09, (q15_t)0x7192,
+    (q15_t)0x3AF2, (q15_t)0x719E, (q15_t)0x3ADC, (q15_t)0x71A9, (q15_t)0x3AC6, (q15_t)0x71B5, (q15_t)0x3AAF, (q15_t)0x71C0,
+    (q15_t)0x3A99, (q15_t)0x71CC, (q15_t)0x3A83, (q15_t)0x71D7, (q15_t)0x3A6C, (q15_t)0x71E3, (q15_t)0x3A56, (q15_t)0x71EE,
+    (q15_t)0x3A40, (q15_t)0x71FA, (q15_t)0x3A29, (q15_t)0x7205, (q15_t)0x3A13, (q15_t)0x7211, (q15_t)0x39FD, (q15_t)0x721C,
+    (q15_t)0x39E6, (q15_t)0x7227, (q15_t)0x39D0, (q15_t)0x7233, (q15_t)0x39B9, (q15_t)0x723E, (q15_t)0x39A3, (q15_t)0x7249,
+    (q15_t)0x398C, (q15_t)0x7255, (q15_t)0x3976, (q15_t)0x7260, (q15_t)0x395F, (q15_t)0x726B, (q15_t)0x3949, (q15_t)0x7276,
+    (q15_t)0x3932, (q15_t)0x7282, (q15_t)0x391C, (q15_t)0x728D, (q15_t)0x3906, (q15_t)0x7298, (q15_t)0x38EF, (q15_t)0x72A3,
+    (q15_t)0x38D8, (q15_t)0x72AF, (q15_t)0x38C2, (q15_t)0x72BA, (q15_t)0x38AB, (q15_t)0x72C5, (q15_t)0x3895, (q15_t)0x72D0,
+    (q15_t)0x387E, (q15_t)0x72DB, (q15_t)0x3868, (q15_t)0x72E6, (q15_t)0x3851, (q15_t)0x72F1, (q15_t)0x383B, (q15_t)0x72FC,
+    (q15_t)0x3824, (q15_t)0x7307, (q15_t)0x380D, (q15_t)0x7312, (q15_t)0x37F7, (q15_t)0x731D, (q15_t)0x37E0, (q15_t)0x7328,
+    (q15_t)0x37CA, (q15_t)0x7333, (q15_t)0x37B3, (q15_t)0x733E, (q15_t)0x379C, (q15_t)0x7349, (q15_t)0x3786, (q15_t)0x7354,
+    (q15_t)0x376F, (q15_t)0x735F, (q15_t)0x3758, (q15_t)0x736A, (q15_t)0x3742, (q15_t)0x7375, (q15_t)0x372B, (q15_t)0x737F,
+    (q15_t)0x3714, (q15_t)0x738A, (q15_t)0x36FE, (q15_t)0x7395, (q15_t)0x36E7, (q15_t)0x73A0, (q15_t)0x36D0, (q15_t)0x73AB,
+    (q15_t)0x36BA, (q15_t)0x73B5, (q15_t)0x36A3, (q15_t)0x73C0, (q15_t)0x368C, (q15_t)0x73CB, (q15_t)0x3675, (q15_t)0x73D6,
+    (q15_t)0x365F, (q15_t)0x73E0, (q15_t)0x3648, (q15_t)0x73EB, (q15_t)0x3631, (q15_t)0x73F6, (q15_t)0x361A, (q15_t)0x7400,
+    (q15_t)0x3604, (q15_t)0x740B, (q15_t)0x35ED, (q15_t)0x7415, (q15_t)0x35D6, (q15_t)0x7420, (q15_t)0x35BF, (q15_t)0x742B,
+    (q15_t)0x35A8, (q15_t)0x7435, (q15_t)0x3592, (q15_t)0x7440, (q15_t)0x357B, (q15_t)0x744A, (q15_t)0x3564, (q15_t)0x7455,
+    (q15_t)0x354D, (q15_t)0x745F, (q15_t)0x3536, (q15_t)0x746A, (q15_t)0x351F, (q15_t)0x7474, (q15_t)0x3508, (q15_t)0x747E,
+    (q15_t)0x34F2, (q15_t)0x7489, (q15_t)0x34DB, (q15_t)0x7493, (q15_t)0x34C4, (q15_t)0x749E, (q15_t)0x34AD, (q15_t)0x74A8,
+    (q15_t)0x3496, (q15_t)0x74B2, (q15_t)0x347F, (q15_t)0x74BD, (q15_t)0x3468, (q15_t)0x74C7, (q15_t)0x3451, (q15_t)0x74D1,
+    (q15_t)0x343A, (q15_t)0x74DB, (q15_t)0x3423, (q15_t)0x74E6, (q15_t)0x340C, (q15_t)0x74F0, (q15_t)0x33F5, (q15_t)0x74FA,
+    (q15_t)0x33DE, (q15_t)0x7504, (q15_t)0x33C7, (q15_t)0x750F, (q15_t)0x33B0, (q15_t)0x7519, (q15_t)0x3399, (q15_t)0x7523,
+    (q15_t)0x3382, (q15_t)0x752D, (q15_t)0x336B, (q15_t)0x7537, (q15_t)0x3354, (q15_t)0x7541, (q15_t)0x333D, (q15_t)0x754B,
+    (q15_t)0x3326, (q15_t)0x7555, (q15_t)0x330F, (q15_t)0x755F, (q15_t)0x32F8, (q15_t)0x7569, (q15_t)0x32E1, (q15_t)0x7573,
+    (q15_t)0x32CA, (q15_t)0x757D, (q15_t)0x32B3, (q15_t)0x7587, (q15_t)0x329C, (q15_t)0x7591, (q15_t)0x3285, (q15_t)0x759B,
+    (q15_t)0x326E, (q15_t)0x75A5, (q15_t)0x3257, (q15_t)0x75AF, (q15_t)0x3240, (q15_t)0x75B9, (q15_t)0x3228, (q15_t)0x75C3,
+    (q15_t)0x3211, (q15_t)0x75CC, (q15_t)0x31FA, (q15_t)0x75D6, (q15_t)0x31E3, (q15_t)0x75E0, (q15_t)0x31CC, (q15_t)0x75EA,
+    (q15_t)0x31B5, (q15_t)0x75F4, (q15_t)0x319E, (q15_t)0x75FD, (q15_t)0x3186, (q15_t)0x7607, (q15_t)0x316F, (q15_t)0x7611,
+    (q15_t)0x3158, (q15_t)0x761B, (q15_t)0x3141, (q15_t)0x7624, (q15_t)0x312A, (q15_t)0x762E, (q15_t)0x3112, (q15_t)0x7638,
+    (q15_t)0x30FB, (q15_t)0x7641, (q15_t)0x30E4, (q15_t)0x764B, (q15_t)0x30CD, (q15_t)0x7654, (q15_t)0x30B6, (q15_t)0x765E,
+    (q15_t)0x309E, (q15_t)0x7668, (q15_t)0x3087, (q15_t)0x7671, (q15_t)0x3070, (q15_t)0x767B, (q15_t)0x3059, (q15_t)0x7684,
+    (q15_t)0x3041, (q15_t)0x768E, (q15_t)0x302A, (q15_t)0x7697, (q15_t)0x3013, (q15_t)0x76A0, (q15_t)0x2FFB, (q15_t)0x76AA,
+    (q15_t)0x2FE4, (q15_t)0x76B3, (q15_t)0x2FCD, (q15_t)0x76BD, (q15_t)0x2FB5, (q15_t)0x76C6, (q15_t)0x2F9E, (q15_t)0x76CF,
+    (q15_t)0x2F87, (q15_t)0x76D9, (q15_t)0x2F6F, (q15_t)0x76E2, (q15_t)0x2F58, (q15_t)0x76EB, (q15_t)0x2F41, (q15_t)0x76F5,
+    (q15_t)0x2F29, (q15_t)0x76FE, (q15_t)0x2F12, (q15_t)0x7707, (q15_t)0x2EFB, (q15_t)0x7710, (q15_t)0x2EE3, (q15_t)0x771A,
+    (q15_t)0x2ECC, (q15_t)0x7723, (q15_t)0x2EB5, (q15_t)0x772C, (q15_t)0x2E9D, (q15_t)0x7735, (q15_t)0x2E86, (q15_t)0x773E,
+    (q15_t)0x2E6E, (q15_t)0x7747, (q15_t)0x2E57, (q15_t)0x7751, (q15_t)0x2E3F, (q15_t)0x775A, (q15_t)0x2E28, (q15_t)0x7763,
+    (q15_t)0x2E11, (q15_t)0x776C, (q15_t)0x2DF9, (q15_t)0x7775, (q15_t)0x2DE2, (q15_t)0x777E, (q15_t)0x2DCA, (q15_t)0x7787,
+    (q15_t)0x2DB3, (q15_t)0x7790, (q15_t)0x2D9B, (q15_t)0x7799, (q15_t)0x2D84, (q15_t)0x77A2, (q15_t)0x2D6C, (q15_t)0x77AB,
+    (q15_t)0x2D55, (q15_t)0x77B4, (q15_t)0x2D3D, (q15_t)0x77BC, (q15_t)0x2D26, (q15_t)0x77C5, (q15_t)0x2D0E, (q15_t)0x77CE,
+    (q15_t)0x2CF7, (q15_t)0x77D7, (q15_t)0x2CDF, (q15_t)0x77E0, (q15_t)0x2CC8, (q15_t)0x77E9, (q15_t)0x2CB0, (q15_t)0x77F1,
+    (q15_t)0x2C98, (q15_t)0x77FA, (q15_t)0x2C81, (q15_t)0x7803, (q15_t)0x2C69, (q15_t)0x780C, (q15_t)0x2C52, (q15_t)0x7814,
+    (q15_t)0x2C3A, (q15_t)0x781D, (q15_t)0x2C23, (q15_t)0x7826, (q15_t)0x2C0B, (q15_t)0x782E, (q15_t)0x2BF3, (q15_t)0x7837,
+    (q15_t)0x2BDC, (q15_t)0x7840, (q15_t)0x2BC4, (q15_t)0x7848, (q15_t)0x2BAD, (q15_t)0x7851, (q15_t)0x2B95, (q15_t)0x7859,
+    (q15_t)0x2B7D, (q15_t)0x7862, (q15_t)0x2B66, (q15_t)0x786B, (q15_t)0x2B4E, (q15_t)0x7873, (q15_t)0x2B36, (q15_t)0x787C,
+    (q15_t)0x2B1F, (q15_t)0x7884, (q15_t)0x2B07, (q15_t)0x788C, (q15_t)0x2AEF, (q15_t)0x7895, (q15_t)0x2AD8, (q15_t)0x789D,
+    (q15_t)0x2AC0, (q15_t)0x78A6, (q15_t)0x2AA8, (q15_t)0x78AE, (q15_t)0x2A91, (q15_t)0x78B6, (q15_t)0x2A79, (q15_t)0x78BF,
+    (q15_t)0x2A61, (q15_t)0x78C7, (q15_t)0x2A49, (q15_t)0x78CF, (q15_t)0x2A32, (q15_t)0x78D8, (q15_t)0x2A1A, (q15_t)0x78E0,
+    (q15_t)0x2A02, (q15_t)0x78E8, (q15_t)0x29EB, (q15_t)0x78F1, (q15_t)0x29D3, (q15_t)0x78F9, (q15_t)0x29BB, (q15_t)0x7901,
+    (q15_t)0x29A3, (q15_t)0x7909, (q15_t)0x298B, (q15_t)0x7911, (q15_t)0x2974, (q15_t)0x7919, (q15_t)0x295C, (q15_t)0x7922,
+    (q15_t)0x2944, (q15_t)0x792A, (q15_t)0x292C, (q15_t)0x7932, (q15_t)0x2915, (q15_t)0x793A, (q15_t)0x28FD, (q15_t)0x7942,
+    (q15_t)0x28E5, (q15_t)0x794A, (q15_t)0x28CD, (q15_t)0x7952, (q15_t)0x28B5, (q15_t)0x795A, (q15_t)0x289D, (q15_t)0x7962,
+    (q15_t)0x2886, (q15_t)0x796A, (q15_t)0x286E, (q15_t)0x7972, (q15_t)0x2856, (q15_t)0x797A, (q15_t)0x283E, (q15_t)0x7982,
+    (q15_t)0x2826, (q15_t)0x798A, (q15_t)0x280E, (q15_t)0x7992, (q15_t)0x27F6, (q15_t)0x7999, (q15_t)0x27DF, (q15_t)0x79A1,
+    (q15_t)0x27C7, (q15_t)0x79A9, (q15_t)0x27AF, (q15_t)0x79B1, (q15_t)0x2797, (q15_t)0x79B9, (q15_t)0x277F, (q15_t)0x79C0,
+    (q15_t)0x2767, (q15_t)0x79C8, (q15_t)0x274F, (q15_t)0x79D0, (q15_t)0x2737, (q15_t)0x79D8, (q15_t)0x271F, (q15_t)0x79DF,
+    (q15_t)0x2707, (q15_t)0x79E7, (q15_t)0x26EF, (q15_t)0x79EF, (q15_t)0x26D8, (q15_t)0x79F6, (q15_t)0x26C0, (q15_t)0x79FE,
+    (q15_t)0x26A8, (q15_t)0x7A05, (q15_t)0x2690, (q15_t)0x7A0D, (q15_t)0x2678, (q15_t)0x7A15, (q15_t)0x2660, (q15_t)0x7A1C,
+    (q15_t)0x2648, (q15_t)0x7A24, (q15_t)0x2630, (q15_t)0x7A2B, (q15_t)0x2618, (q15_t)0x7A33, (q15_t)0x2600, (q15_t)0x7A3A,
+    (q15_t)0x25E8, (q15_t)0x7A42, (q15_t)0x25D0, (q15_t)0x7A49, (q15_t)0x25B8, (q15_t)0x7A50, (q15_t)0x25A0, (q15_t)0x7A58,
+    (q15_t)0x2588, (q15_t)0x7A5F, (q15_t)0x2570, (q15_t)0x7A67, (q15_t)0x2558, (q15_t)0x7A6E, (q15_t)0x2540, (q15_t)0x7A75,
+    (q15_t)0x2528, (q15_t)0x7A7D, (q15_t)0x250F, (q15_t)0x7A84, (q15_t)0x24F7, (q15_t)0x7A8B, (q15_t)0x24DF, (q15_t)0x7A92,
+    (q15_t)0x24C7, (q15_t)0x7A9A, (q15_t)0x24AF, (q15_t)0x7AA1, (q15_t)0x2497, (q15_t)0x7AA8, (q15_t)0x247F, (q15_t)0x7AAF,
+    (q15_t)0x2467, (q15_t)0x7AB6, (q15_t)0x244F, (q15_t)0x7ABD, (q15_t)0x2437, (q15_t)0x7AC5, (q15_t)0x241F, (q15_t)0x7ACC,
+    (q15_t)0x2407, (q15_t)0x7AD3, (q15_t)0x23EE, (q15_t)0x7ADA, (q15_t)0x23D6, (q15_t)0x7AE1, (q15_t)0x23BE, (q15_t)0x7AE8,
+    (q15_t)0x23A6, (q15_t)0x7AEF, (q15_t)0x238E, (q15_t)0x7AF6, (q15_t)0x2376, (q15_t)0x7AFD, (q15_t)0x235E, (q15_t)0x7B04,
+    (q15_t)0x2345, (q15_t)0x7B0B, (q15_t)0x232D, (q15_t)0x7B12, (q15_t)0x2315, (q15_t)0x7B19, (q15_t)0x22FD, (q15_t)0x7B1F,
+    (q15_t)0x22E5, (q15_t)0x7B26, (q15_t)0x22CD, (q15_t)0x7B2D, (q15_t)0x22B4, (q15_t)0x7B34, (q15_t)0x229C, (q15_t)0x7B3B,
+    (q15_t)0x2284, (q15_t)0x7B42, (q15_t)0x226C, (q15_t)0x7B48, (q15_t)0x2254, (q15_t)0x7B4F, (q15_t)0x223B, (q15_t)0x7B56,
+    (q15_t)0x2223, (q15_t)0x7B5D, (q15_t)0x220B, (q15_t)0x7B63, (q15_t)0x21F3, (q15_t)0x7B6A, (q15_t)0x21DA, (q15_t)0x7B71,
+    (q15_t)0x21C2, (q15_t)0x7B77, (q15_t)0x21AA, (q15_t)0x7B7E, (q15_t)0x2192, (q15_t)0x7B84, (q15_t)0x2179, (q15_t)0x7B8B,
+    (q15_t)0x2161, (q15_t)0x7B92, (q15_t)0x2149, (q15_t)0x7B98, (q15_t)0x2131, (q15_t)0x7B9F, (q15_t)0x2118, (q15_t)0x7BA5,
+    (q15_t)0x2100, (q15_t)0x7BAC, (q15_t)0x20E8, (q15_t)0x7BB2, (q15_t)0x20D0, (q15_t)0x7BB9, (q15_t)0x20B7, (q15_t)0x7BBF,
+    (q15_t)0x209F, (q15_t)0x7BC5, (q15_t)0x2087, (q15_t)0x7BCC, (q15_t)0x206E, (q15_t)0x7BD2, (q15_t)0x2056, (q15_t)0x7BD9,
+    (q15_t)0x203E, (q15_t)0x7BDF, (q15_t)0x2025, (q15_t)0x7BE5, (q15_t)0x200D, (q15_t)0x7BEB, (q15_t)0x1FF5, (q15_t)0x7BF2,
+    (q15_t)0x1FDC, (q15_t)0x7BF8, (q15_t)0x1FC4, (q15_t)0x7BFE, (q15_t)0x1FAC, (q15_t)0x7C05, (q15_t)0x1F93, (q15_t)0x7C0B,
+    (q15_t)0x1F7B, (q15_t)0x7C11, (q15_t)0x1F63, (q15_t)0x7C17, (q15_t)0x1F4A, (q15_t)0x7C1D, (q15_t)0x1F32, (q15_t)0x7C23,
+    (q15_t)0x1F19, (q15_t)0x7C29, (q15_t)0x1F01, (q15_t)0x7C30, (q15_t)0x1EE9, (q15_t)0x7C36, (q15_t)0x1ED0, (q15_t)0x7C3C,
+    (q15_t)0x1EB8, (q15_t)0x7C42, (q15_t)0x1EA0, (q15_t)0x7C48, (q15_t)0x1E87, (q15_t)0x7C4E, (q15_t)0x1E6F, (q15_t)0x7C54,
+    (q15_t)0x1E56, (q15_t)0x7C5A, (q15_t)0x1E3E, (q15_t)0x7C60, (q15_t)0x1E25, (q15_t)0x7C66, (q15_t)0x1E0D, (q15_t)0x7C6C,
+    (q15_t)0x1DF5, (q15_t)0x7C71, (q15_t)0x1DDC, (q15_t)0x7C77, (q15_t)0x1DC4, (q15_t)0x7C7D, (q15_t)0x1DAB, (q15_t)0x7C83,
+    (q15_t)0x1D93, (q15_t)0x7C89, (q15_t)0x1D7A, (q15_t)0x7C8F, (q15_t)0x1D62, (q15_t)0x7C94, (q15_t)0x1D49, (q15_t)0x7C9A,
+    (q15_t)0x1D31, (q15_t)0x7CA0, (q15_t)0x1D18, (q15_t)0x7CA6, (q15_t)0x1D00, (q15_t)0x7CAB, (q15_t)0x1CE8, (q15_t)0x7CB1,
+    (q15_t)0x1CCF, (q15_t)0x7CB7, (q15_t)0x1CB7, (q15_t)0x7CBC, (q15_t)0x1C9E, (q15_t)0x7CC2, (q15_t)0x1C86, (q15_t)0x7CC8,
+    (q15_t)0x1C6D, (q15_t)0x7CCD, (q15_t)0x1C55, (q15_t)0x7CD3, (q15_t)0x1C3C, (q15_t)0x7CD8, (q15_t)0x1C24, (q15_t)0x7CDE,
+    (q15_t)0x1C0B, (q15_t)0x7CE3, (q15_t)0x1BF2, (q15_t)0x7CE9, (q15_t)0x1BDA, (q15_t)0x7CEE, (q15_t)0x1BC1, (q15_t)0x7CF4,
+    (q15_t)0x1BA9, (q15_t)0x7CF9, (q15_t)0x1B90, (q15_t)0x7CFF, (q15_t)0x1B78, (q15_t)0x7D04, (q15_t)0x1B5F, (q15_t)0x7D09,
+    (q15_t)0x1B47, (q15_t)0x7D0F, (q15_t)0x1B2E, (q15_t)0x7D14, (q15_t)0x1B16, (q15_t)0x7D19, (q15_t)0x1AFD, (q15_t)0x7D1F,
+    (q15_t)0x1AE4, (q15_t)0x7D24, (q15_t)0x1ACC, (q15_t)0x7D29, (q15_t)0x1AB3, (q15_t)0x7D2F, (q15_t)0x1A9B, (q15_t)0x7D34,
+    (q15_t)0x1A82, (q15_t)0x7D39, (q15_t)0x1A6A, (q15_t)0x7D3E, (q15_t)0x1A51, (q15_t)0x7D43, (q15_t)0x1A38, (q15_t)0x7D49,
+    (q15_t)0x1A20, (q15_t)0x7D4E, (q15_t)0x1A07, (q15_t)0x7D53, (q15_t)0x19EF, (q15_t)0x7D58, (q15_t)0x19D6, (q15_t)0x7D5D,
+    (q15_t)0x19BD, (q15_t)0x7D62, (q15_t)0x19A5, (q15_t)0x7D67, (q15_t)0x198C, (q15_t)0x7D6C, (q15_t)0x1973, (q15_t)0x7D71,
+    (q15_t)0x195B, (q15_t)0x7D76, (q15_t)0x1942, (q15_t)0x7D7B, (q15_t)0x192A, (q15_t)0x7D80, (q15_t)0x1911, (q15_t)0x7D85,
+    (q15_t)0x18F8, (q15_t)0x7D8A, (q15_t)0x18E0, (q15_t)0x7D8F, (q15_t)0x18C7, (q15_t)0x7D94, (q15_t)0x18AE, (q15_t)0x7D98,
+    (q15_t)0x1896, (q15_t)0x7D9D, (q15_t)0x187D, (q15_t)0x7DA2, (q15_t)0x1864, (q15_t)0x7DA7, (q15_t)0x184C, (q15_t)0x7DAC,
+    (q15_t)0x1833, (q15_t)0x7DB0, (q15_t)0x181A, (q15_t)0x7DB5, (q15_t)0x1802, (q15_t)0x7DBA, (q15_t)0x17E9, (q15_t)0x7DBF,
+    (q15_t)0x17D0, (q15_t)0x7DC3, (q15_t)0x17B7, (q15_t)0x7DC8, (q15_t)0x179F, (q15_t)0x7DCD, (q15_t)0x1786, (q15_t)0x7DD1,
+    (q15_t)0x176D, (q15_t)0x7DD6, (q15_t)0x1755, (q15_t)0x7DDA, (q15_t)0x173C, (q15_t)0x7DDF, (q15_t)0x1723, (q15_t)0x7DE4,
+    (q15_t)0x170A, (q15_t)0x7DE8, (q15_t)0x16F2, (q15_t)0x7DED, (q15_t)0x16D9, (q15_t)0x7DF1, (q15_t)0x16C0, (q15_t)0x7DF6,
+    (q15_t)0x16A8, (q15_t)0x7DFA, (q15_t)0x168F, (q15_t)0x7DFF, (q15_t)0x1676, (q15_t)0x7E03, (q15_t)0x165D, (q15_t)0x7E07,
+    (q15_t)0x1645, (q15_t)0x7E0C, (q15_t)0x162C, (q15_t)0x7E10, (q15_t)0x1613, (q15_t)0x7E14, (q15_t)0x15FA, (q15_t)0x7E19,
+    (q15_t)0x15E2, (q15_t)0x7E1D, (q15_t)0x15C9, (q15_t)0x7E21, (q15_t)0x15B0, (q15_t)0x7E26, (q15_t)0x1597, (q15_t)0x7E2A,
+    (q15_t)0x157F, (q15_t)0x7E2E, (q15_t)0x1566, (q15_t)0x7E32, (q15_t)0x154D, (q15_t)0x7E37, (q15_t)0x1534, (q15_t)0x7E3B,
+    (q15_t)0x151B, (q15_t)0x7E3F, (q15_t)0x1503, (q15_t)0x7E43, (q15_t)0x14EA, (q15_t)0x7E47, (q15_t)0x14D1, (q15_t)0x7E4B,
+    (q15_t)0x14B8, (q15_t)0x7E4F, (q15_t)0x149F, (q15_t)0x7E53, (q15_t)0x1487, (q15_t)0x7E57, (q15_t)0x146E, (q15_t)0x7E5B,
+    (q15_t)0x1455, (q15_t)0x7E5F, (q15_t)0x143C, (q15_t)0x7E63, (q15_t)0x1423, (q15_t)0x7E67, (q15_t)0x140B, (q15_t)0x7E6B,
+    (q15_t)0x13F2, (q15_t)0x7E6F, (q15_t)0x13D9, (q15_t)0x7E73, (q15_t)0x13C0, (q15_t)0x7E77, (q15_t)0x13A7, (q15_t)0x7E7B,
+    (q15_t)0x138E, (q15_t)0x7E7F, (q15_t)0x1376, (q15_t)0x7E83, (q15_t)0x135D, (q15_t)0x7E86, (q15_t)0x1344, (q15_t)0x7E8A,
+    (q15_t)0x132B, (q15_t)0x7E8E, (q15_t)0x1312, (q15_t)0x7E92, (q15_t)0x12F9, (q15_t)0x7E95, (q15_t)0x12E0, (q15_t)0x7E99,
+    (q15_t)0x12C8, (q15_t)0x7E9D, (q15_t)0x12AF, (q15_t)0x7EA1, (q15_t)0x1296, (q15_t)0x7EA4, (q15_t)0x127D, (q15_t)0x7EA8,
+    (q15_t)0x1264, (q15_t)0x7EAB, (q15_t)0x124B, (q15_t)0x7EAF, (q15_t)0x1232, (q15_t)0x7EB3, (q15_t)0x1219, (q15_t)0x7EB6,
+    (q15_t)0x1201, (q15_t)0x7EBA, (q15_t)0x11E8, (q15_t)0x7EBD, (q15_t)0x11CF, (q15_t)0x7EC1, (q15_t)0x11B6, (q15_t)0x7EC4,
+    (q15_t)0x119D, (q15_t)0x7EC8, (q15_t)0x1184, (q15_t)0x7ECB, (q15_t)0x116B, (q15_t)0x7ECF, (q15_t)0x1152, (q15_t)0x7ED2,
+    (q15_t)0x1139, (q15_t)0x7ED5, (q15_t)0x1121, (q15_t)0x7ED9, (q15_t)0x1108, (q15_t)0x7EDC, (q15_t)0x10EF, (q15_t)0x7EDF,
+    (q15_t)0x10D6, (q15_t)0x7EE3, (q15_t)0x10BD, (q15_t)0x7EE6, (q15_t)0x10A4, (q15_t)0x7EE9, (q15_t)0x108B, (q15_t)0x7EED,
+    (q15_t)0x1072, (q15_t)0x7EF0, (q15_t)0x1059, (q15_t)0x7EF3, (q15_t)0x1040, (q15_t)0x7EF6, (q15_t)0x1027, (q15_t)0x7EF9,
+    (q15_t)0x100E, (q15_t)0x7EFD, (q15_t)0x0FF5, (q15_t)0x7F00, (q15_t)0x0FDD, (q15_t)0x7F03, (q15_t)0x0FC4, (q15_t)0x7F06,
+    (q15_t)0x0FAB, (q15_t)0x7F09, (q15_t)0x0F92, (q15_t)0x7F0C, (q15_t)0x0F79, (q15_t)0x7F0F, (q15_t)0x0F60, (q15_t)0x7F12,
+    (q15_t)0x0F47, (q15_t)0x7F15, (q15_t)0x0F2E, (q15_t)0x7F18, (q15_t)0x0F15, (q15_t)0x7F1B, (q15_t)0x0EFC, (q15_t)0x7F1E,
+    (q15_t)0x0EE3, (q15_t)0x7F21, (q15_t)0x0ECA, (q15_t)0x7F24, (q15_t)0x0EB1, (q15_t)0x7F27, (q15_t)0x0E98, (q15_t)0x7F2A,
+    (q15_t)0x0E7F, (q15_t)0x7F2D, (q15_t)0x0E66, (q15_t)0x7F2F, (q15_t)0x0E4D, (q15_t)0x7F32, (q15_t)0x0E34, (q15_t)0x7F35,
+    (q15_t)0x0E1B, (q15_t)0x7F38, (q15_t)0x0E02, (q15_t)0x7F3B, (q15_t)0x0DE9, (q15_t)0x7F3D, (q15_t)0x0DD0, (q15_t)0x7F40,
+    (q15_t)0x0DB7, (q15_t)0x7F43, (q15_t)0x0D9E, (q15_t)0x7F45, (q15_t)0x0D85, (q15_t)0x7F48, (q15_t)0x0D6C, (q15_t)0x7F4B,
+    (q15_t)0x0D53, (q15_t)0x7F4D, (q15_t)0x0D3A, (q15_t)0x7F50, (q15_t)0x0D21, (q15_t)0x7F53, (q15_t)0x0D08, (q15_t)0x7F55,
+    (q15_t)0x0CEF, (q15_t)0x7F58, (q15_t)0x0CD6, (q15_t)0x7F5A, (q15_t)0x0CBD, (q15_t)0x7F5D, (q15_t)0x0CA4, (q15_t)0x7F5F,
+    (q15_t)0x0C8B, (q15_t)0x7F62, (q15_t)0x0C72, (q15_t)0x7F64, (q15_t)0x0C59, (q15_t)0x7F67, (q15_t)0x0C40, (q15_t)0x7F69,
+    (q15_t)0x0C27, (q15_t)0x7F6B, (q15_t)0x0C0E, (q15_t)0x7F6E, (q15_t)0x0BF5, (q15_t)0x7F70, (q15_t)0x0BDC, (q15_t)0x7F72,
+    (q15_t)0x0BC3, (q15_t)0x7F75, (q15_t)0x0BAA, (q15_t)0x7F77, (q15_t)0x0B91, (q15_t)0x7F79, (q15_t)0x0B78, (q15_t)0x7F7C,
+    (q15_t)0x0B5F, (q15_t)0x7F7E, (q15_t)0x0B46, (q15_t)0x7F80, (q15_t)0x0B2D, (q15_t)0x7F82, (q15_t)0x0B14, (q15_t)0x7F85,
+    (q15_t)0x0AFB, (q15_t)0x7F87, (q15_t)0x0AE2, (q15_t)0x7F89, (q15_t)0x0AC9, (q15_t)0x7F8B, (q15_t)0x0AB0, (q15_t)0x7F8D,
+    (q15_t)0x0A97, (q15_t)0x7F8F, (q15_t)0x0A7E, (q15_t)0x7F91, (q15_t)0x0A65, (q15_t)0x7F93, (q15_t)0x0A4C, (q15_t)0x7F95,
+    (q15_t)0x0A33, (q15_t)0x7F97, (q15_t)0x0A19, (q15_t)0x7F99, (q15_t)0x0A00, (q15_t)0x7F9B, (q15_t)0x09E7, (q15_t)0x7F9D,
+    (q15_t)0x09CE, (q15_t)0x7F9F, (q15_t)0x09B5, (q15_t)0x7FA1, (q15_t)0x099C, (q15_t)0x7FA3, (q15_t)0x0983, (q15_t)0x7FA5,
+    (q15_t)0x096A, (q15_t)0x7FA7, (q15_t)0x0951, (q15_t)0x7FA9, (q15_t)0x0938, (q15_t)0x7FAA, (q15_t)0x091F, (q15_t)0x7FAC,
+    (q15_t)0x0906, (q15_t)0x7FAE, (q15_t)0x08ED, (q15_t)0x7FB0, (q15_t)0x08D4, (q15_t)0x7FB1, (q15_t)0x08BB, (q15_t)0x7FB3,
+    (q15_t)0x08A2, (q15_t)0x7FB5, (q15_t)0x0888, (q15_t)0x7FB7, (q15_t)0x086F, (q15_t)0x7FB8, (q15_t)0x0856, (q15_t)0x7FBA,
+    (q15_t)0x083D, (q15_t)0x7FBC, (q15_t)0x0824, (q15_t)0x7FBD, (q15_t)0x080B, (q15_t)0x7FBF, (q15_t)0x07F2, (q15_t)0x7FC0,
+    (q15_t)0x07D9, (q15_t)0x7FC2, (q15_t)0x07C0, (q15_t)0x7FC3, (q15_t)0x07A7, (q15_t)0x7FC5, (q15_t)0x078E, (q15_t)0x7FC6,
+    (q15_t)0x0775, (q15_t)0x7FC8, (q15_t)0x075B, (q15_t)0x7FC9, (q15_t)0x0742, (q15_t)0x7FCB, (q15_t)0x0729, (q15_t)0x7FCC,
+    (q15_t)0x0710, (q15_t)0x7FCE, (q15_t)0x06F7, (q15_t)0x7FCF, (q15_t)0x06DE, (q15_t)0x7FD0, (q15_t)0x06C5, (q15_t)0x7FD2,
+    (q15_t)0x06AC, (q15_t)0x7FD3, (q15_t)0x0693, (q15_t)0x7FD4, (q15_t)0x067A, (q15_t)0x7FD6, (q15_t)0x0660, (q15_t)0x7FD7,
+    (q15_t)0x0647, (q15_t)0x7FD8, (q15_t)0x062E, (q15_t)0x7FD9, (q15_t)0x0615, (q15_t)0x7FDA, (q15_t)0x05FC, (q15_t)0x7FDC,
+    (q15_t)0x05E3, (q15_t)0x7FDD, (q15_t)0x05CA, (q15_t)0x7FDE, (q15_t)0x05B1, (q15_t)0x7FDF, (q15_t)0x0598, (q15_t)0x7FE0,
+    (q15_t)0x057F, (q15_t)0x7FE1, (q15_t)0x0565, (q15_t)0x7FE2, (q15_t)0x054C, (q15_t)0x7FE3, (q15_t)0x0533, (q15_t)0x7FE4,
+    (q15_t)0x051A, (q15_t)0x7FE5, (q15_t)0x0501, (q15_t)0x7FE6, (q15_t)0x04E8, (q15_t)0x7FE7, (q15_t)0x04CF, (q15_t)0x7FE8,
+    (q15_t)0x04B6, (q15_t)0x7FE9, (q15_t)0x049C, (q15_t)0x7FEA, (q15_t)0x0483, (q15_t)0x7FEB, (q15_t)0x046A, (q15_t)0x7FEC,
+    (q15_t)0x0451, (q15_t)0x7FED, (q15_t)0x0438, (q15_t)0x7FEE, (q15_t)0x041F, (q15_t)0x7FEE, (q15_t)0x0406, (q15_t)0x7FEF,
+    (q15_t)0x03ED, (q15_t)0x7FF0, (q15_t)0x03D4, (q15_t)0x7FF1, (q15_t)0x03BA, (q15_t)0x7FF2, (q15_t)0x03A1, (q15_t)0x7FF2,
+    (q15_t)0x0388, (q15_t)0x7FF3, (q15_t)0x036F, (q15_t)0x7FF4, (q15_t)0x0356, (q15_t)0x7FF4, (q15_t)0x033D, (q15_t)0x7FF5,
+    (q15_t)0x0324, (q15_t)0x7FF6, (q15_t)0x030B, (q15_t)0x7FF6, (q15_t)0x02F1, (q15_t)0x7FF7, (q15_t)0x02D8, (q15_t)0x7FF7,
+    (q15_t)0x02BF, (q15_t)0x7FF8, (q15_t)0x02A6, (q15_t)0x7FF8, (q15_t)0x028D, (q15_t)0x7FF9, (q15_t)0x0274, (q15_t)0x7FF9,
+    (q15_t)0x025B, (q15_t)0x7FFA, (q15_t)0x0242, (q15_t)0x7FFA, (q15_t)0x0228, (q15_t)0x7FFB, (q15_t)0x020F, (q15_t)0x7FFB,
+    (q15_t)0x01F6, (q15_t)0x7FFC, (q15_t)0x01DD, (q15_t)0x7FFC, (q15_t)0x01C4, (q15_t)0x7FFC, (q15_t)0x01AB, (q15_t)0x7FFD,
+    (q15_t)0x0192, (q15_t)0x7FFD, (q15_t)0x0178, (q15_t)0x7FFD, (q15_t)0x015F, (q15_t)0x7FFE, (q15_t)0x0146, (q15_t)0x7FFE,
+    (q15_t)0x012D, (q15_t)0x7FFE, (q15_t)0x0114, (q15_t)0x7FFE, (q15_t)0x00FB, (q15_t)0x7FFF, (q15_t)0x00E2, (q15_t)0x7FFF,
+    (q15_t)0x00C9, (q15_t)0x7FFF, (q15_t)0x00AF, (q15_t)0x7FFF, (q15_t)0x0096, (q15_t)0x7FFF, (q15_t)0x007D, (q15_t)0x7FFF,
+    (q15_t)0x0064, (q15_t)0x7FFF, (q15_t)0x004B, (q15_t)0x7FFF, (q15_t)0x0032, (q15_t)0x7FFF, (q15_t)0x0019, (q15_t)0x7FFF,
+    (q15_t)0x0000, (q15_t)0x7FFF, (q15_t)0xFFE6, (q15_t)0x7FFF, (q15_t)0xFFCD, (q15_t)0x7FFF, (q15_t)0xFFB4, (q15_t)0x7FFF,
+    (q15_t)0xFF9B, (q15_t)0x7FFF, (q15_t)0xFF82, (q15_t)0x7FFF, (q15_t)0xFF69, (q15_t)0x7FFF, (q15_t)0xFF50, (q15_t)0x7FFF,
+    (q15_t)0xFF36, (q15_t)0x7FFF, (q15_t)0xFF1D, (q15_t)0x7FFF, (q15_t)0xFF04, (q15_t)0x7FFF, (q15_t)0xFEEB, (q15_t)0x7FFE,
+    (q15_t)0xFED2, (q15_t)0x7FFE, (q15_t)0xFEB9, (q15_t)0x7FFE, (q15_t)0xFEA0, (q15_t)0x7FFE, (q15_t)0xFE87, (q15_t)0x7FFD,
+    (q15_t)0xFE6D, (q15_t)0x7FFD, (q15_t)0xFE54, (q15_t)0x7FFD, (q15_t)0xFE3B, (q15_t)0x7FFC, (q15_t)0xFE22, (q15_t)0x7FFC,
+    (q15_t)0xFE09, (q15_t)0x7FFC, (q15_t)0xFDF0, (q15_t)0x7FFB, (q15_t)0xFDD7, (q15_t)0x7FFB, (q15_t)0xFDBD, (q15_t)0x7FFA,
+    (q15_t)0xFDA4, (q15_t)0x7FFA, (q15_t)0xFD8B, (q15_t)0x7FF9, (q15_t)0xFD72, (q15_t)0x7FF9, (q15_t)0xFD59, (q15_t)0x7FF8,
+    (q15_t)0xFD40, (q15_t)0x7FF8, (q15_t)0xFD27, (q15_t)0x7FF7, (q15_t)0xFD0E, (q15_t)0x7FF7, (q15_t)0xFCF4, (q15_t)0x7FF6,
+    (q15_t)0xFCDB, (q15_t)0x7FF6, (q15_t)0xFCC2, (q15_t)0x7FF5, (q15_t)0xFCA9, (q15_t)0x7FF4, (q15_t)0xFC90, (q15_t)0x7FF4,
+    (q15_t)0xFC77, (q15_t)0x7FF3, (q15_t)0xFC5E, (q15_t)0x7FF2, (q15_t)0xFC45, (q15_t)0x7FF2, (q15_t)0xFC2B, (q15_t)0x7FF1,
+    (q15_t)0xFC12, (q15_t)0x7FF0, (q15_t)0xFBF9, (q15_t)0x7FEF, (q15_t)0xFBE0, (q15_t)0x7FEE, (q15_t)0xFBC7, (q15_t)0x7FEE,
+    (q15_t)0xFBAE, (q15_t)0x7FED, (q15_t)0xFB95, (q15_t)0x7FEC, (q15_t)0xFB7C, (q15_t)0x7FEB, (q15_t)0xFB63, (q15_t)0x7FEA,
+    (q15_t)0xFB49, (q15_t)0x7FE9, (q15_t)0xFB30, (q15_t)0x7FE8, (q15_t)0xFB17, (q15_t)0x7FE7, (q15_t)0xFAFE, (q15_t)0x7FE6,
+    (q15_t)0xFAE5, (q15_t)0x7FE5, (q15_t)0xFACC, (q15_t)0x7FE4, (q15_t)0xFAB3, (q15_t)0x7FE3, (q15_t)0xFA9A, (q15_t)0x7FE2,
+    (q15_t)0xFA80, (q15_t)0x7FE1, (q15_t)0xFA67, (q15_t)0x7FE0, (q15_t)0xFA4E, (q15_t)0x7FDF, (q15_t)0xFA35, (q15_t)0x7FDE,
+    (q15_t)0xFA1C, (q15_t)0x7FDD, (q15_t)0xFA03, (q15_t)0x7FDC, (q15_t)0xF9EA, (q15_t)0x7FDA, (q15_t)0xF9D1, (q15_t)0x7FD9,
+    (q15_t)0xF9B8, (q15_t)0x7FD8, (q15_t)0xF99F, (q15_t)0x7FD7, (q15_t)0xF985, (q15_t)0x7FD6, (q15_t)0xF96C, (q15_t)0x7FD4,
+    (q15_t)0xF953, (q15_t)0x7FD3, (q15_t)0xF93A, (q15_t)0x7FD2, (q15_t)0xF921, (q15_t)0x7FD0, (q15_t)0xF908, (q15_t)0x7FCF,
+    (q15_t)0xF8EF, (q15_t)0x7FCE, (q15_t)0xF8D6, (q15_t)0x7FCC, (q15_t)0xF8BD, (q15_t)0x7FCB, (q15_t)0xF8A4, (q15_t)0x7FC9,
+    (q15_t)0xF88A, (q15_t)0x7FC8, (q15_t)0xF871, (q15_t)0x7FC6, (q15_t)0xF858, (q15_t)0x7FC5, (q15_t)0xF83F, (q15_t)0x7FC3,
+    (q15_t)0xF826, (q15_t)0x7FC2, (q15_t)0xF80D, (q15_t)0x7FC0, (q15_t)0xF7F4, (q15_t)0x7FBF, (q15_t)0xF7DB, (q15_t)0x7FBD,
+    (q15_t)0xF7C2, (q15_t)0x7FBC, (q15_t)0xF7A9, (q15_t)0x7FBA, (q15_t)0xF790, (q15_t)0x7FB8, (q15_t)0xF777, (q15_t)0x7FB7,
+    (q15_t)0xF75D, (q15_t)0x7FB5, (q15_t)0xF744, (q15_t)0x7FB3, (q15_t)0xF72B, (q15_t)0x7FB1, (q15_t)0xF712, (q15_t)0x7FB0,
+    (q15_t)0xF6F9, (q15_t)0x7FAE, (q15_t)0xF6E0, (q15_t)0x7FAC, (q15_t)0xF6C7, (q15_t)0x7FAA, (q15_t)0xF6AE, (q15_t)0x7FA9,
+    (q15_t)0xF695, (q15_t)0x7FA7, (q15_t)0xF67C, (q15_t)0x7FA5, (q15_t)0xF663, (q15_t)0x7FA3, (q15_t)0xF64A, (q15_t)0x7FA1,
+    (q15_t)0xF631, (q15_t)0x7F9F, (q15_t)0xF618, (q15_t)0x7F9D, (q15_t)0xF5FF, (q15_t)0x7F9B, (q15_t)0xF5E6, (q15_t)0x7F99,
+    (q15_t)0xF5CC, (q15_t)0x7F97, (q15_t)0xF5B3, (q15_t)0x7F95, (q15_t)0xF59A, (q15_t)0x7F93, (q15_t)0xF581, (q15_t)0x7F91,
+    (q15_t)0xF568, (q15_t)0x7F8F, (q15_t)0xF54F, (q15_t)0x7F8D, (q15_t)0xF536, (q15_t)0x7F8B, (q15_t)0xF51D, (q15_t)0x7F89,
+    (q15_t)0xF504, (q15_t)0x7F87, (q15_t)0xF4EB, (q15_t)0x7F85, (q15_t)0xF4D2, (q15_t)0x7F82, (q15_t)0xF4B9, (q15_t)0x7F80,
+    (q15_t)0xF4A0, (q15_t)0x7F7E, (q15_t)0xF487, (q15_t)0x7F7C, (q15_t)0xF46E, (q15_t)0x7F79, (q15_t)0xF455, (q15_t)0x7F77,
+    (q15_t)0xF43C, (q15_t)0x7F75, (q15_t)0xF423, (q15_t)0x7F72, (q15_t)0xF40A, (q15_t)0x7F70, (q15_t)0xF3F1, (q15_t)0x7F6E,
+    (q15_t)0xF3D8, (q15_t)0x7F6B, (q15_t)0xF3BF, (q15_t)0x7F69, (q15_t)0xF3A6, (q15_t)0x7F67, (q15_t)0xF38D, (q15_t)0x7F64,
+    (q15_t)0xF374, (q15_t)0x7F62, (q15_t)0xF35B, (q15_t)0x7F5F, (q15_t)0xF342, (q15_t)0x7F5D, (q15_t)0xF329, (q15_t)0x7F5A,
+    (q15_t)0xF310, (q15_t)0x7F58, (q15_t)0xF2F7, (q15_t)0x7F55, (q15_t)0xF2DE, (q15_t)0x7F53, (q15_t)0xF2C5, (q15_t)0x7F50,
+    (q15_t)0xF2AC, (q15_t)0x7F4D, (q15_t)0xF293, (q15_t)0x7F4B, (q15_t)0xF27A, (q15_t)0x7F48, (q15_t)0xF261, (q15_t)0x7F45,
+    (q15_t)0xF248, (q15_t)0x7F43, (q15_t)0xF22F, (q15_t)0x7F40, (q15_t)0xF216, (q15_t)0x7F3D, (q15_t)0xF1FD, (q15_t)0x7F3B,
+    (q15_t)0xF1E4, (q15_t)0x7F38, (q15_t)0xF1CB, (q15_t)0x7F35, (q15_t)0xF1B2, (q15_t)0x7F32, (q15_t)0xF199, (q15_t)0x7F2F,
+    (q15_t)0xF180, (q15_t)0x7F2D, (q15_t)0xF167, (q15_t)0x7F2A, (q15_t)0xF14E, (q15_t)0x7F27, (q15_t)0xF135, (q15_t)0x7F24,
+    (q15_t)0xF11C, (q15_t)0x7F21, (q15_t)0xF103, (q15_t)0x7F1E, (q15_t)0xF0EA, (q15_t)0x7F1B, (q15_t)0xF0D1, (q15_t)0x7F18,
+    (q15_t)0xF0B8, (q15_t)0x7F15, (q15_t)0xF09F, (q15_t)0x7F12, (q15_t)0xF086, (q15_t)0x7F0F, (q15_t)0xF06D, (q15_t)0x7F0C,
+    (q15_t)0xF054, (q15_t)0x7F09, (q15_t)0xF03B, (q15_t)0x7F06, (q15_t)0xF022, (q15_t)0x7F03, (q15_t)0xF00A, (q15_t)0x7F00,
+    (q15_t)0xEFF1, (q15_t)0x7EFD, (q15_t)0xEFD8, (q15_t)0x7EF9, (q15_t)0xEFBF, (q15_t)0x7EF6, (q15_t)0xEFA6, (q15_t)0x7EF3,
+    (q15_t)0xEF8D, (q15_t)0x7EF0, (q15_t)0xEF74, (q15_t)0x7EED, (q15_t)0xEF5B, (q15_t)0x7EE9, (q15_t)0xEF42, (q15_t)0x7EE6,
+    (q15_t)0xEF29, (q15_t)0x7EE3, (q15_t)0xEF10, (q15_t)0x7EDF, (q15_t)0xEEF7, (q15_t)0x7EDC, (q15_t)0xEEDE, (q15_t)0x7ED9,
+    (q15_t)0xEEC6, (q15_t)0x7ED5, (q15_t)0xEEAD, (q15_t)0x7ED2, (q15_t)0xEE94, (q15_t)0x7ECF, (q15_t)0xEE7B, (q15_t)0x7ECB,
+    (q15_t)0xEE62, (q15_t)0x7EC8, (q15_t)0xEE49, (q15_t)0x7EC4, (q15_t)0xEE30, (q15_t)0x7EC1, (q15_t)0xEE17, (q15_t)0x7EBD,
+    (q15_t)0xEDFE, (q15_t)0x7EBA, (q15_t)0xEDE6, (q15_t)0x7EB6, (q15_t)0xEDCD, (q15_t)0x7EB3, (q15_t)0xEDB4, (q15_t)0x7EAF,
+    (q15_t)0xED9B, (q15_t)0x7EAB, (q15_t)0xED82, (q15_t)0x7EA8, (q15_t)0xED69, (q15_t)0x7EA4, (q15_t)0xED50, (q15_t)0x7EA1,
+    (q15_t)0xED37, (q15_t)0x7E9D, (q15_t)0xED1F, (q15_t)0x7E99, (q15_t)0xED06, (q15_t)0x7E95, (q15_t)0xECED, (q15_t)0x7E92,
+    (q15_t)0xECD4, (q15_t)0x7E8E, (q15_t)0xECBB, (q15_t)0x7E8A, (q15_t)0xECA2, (q15_t)0x7E86, (q15_t)0xEC89, (q15_t)0x7E83,
+    (q15_t)0xEC71, (q15_t)0x7E7F, (q15_t)0xEC58, (q15_t)0x7E7B, (q15_t)0xEC3F, (q15_t)0x7E77, (q15_t)0xEC26, (q15_t)0x7E73,
+    (q15_t)0xEC0D, (q15_t)0x7E6F, (q15_t)0xEBF4, (q15_t)0x7E6B, (q15_t)0xEBDC, (q15_t)0x7E67, (q15_t)0xEBC3, (q15_t)0x7E63,
+    (q15_t)0xEBAA, (q15_t)0x7E5F, (q15_t)0xEB91, (q15_t)0x7E5B, (q15_t)0xEB78, (q15_t)0x7E57, (q15_t)0xEB60, (q15_t)0x7E53,
+    (q15_t)0xEB47, (q15_t)0x7E4F, (q15_t)0xEB2E, (q15_t)0x7E4B, (q15_t)0xEB15, (q15_t)0x7E47, (q15_t)0xEAFC, (q15_t)0x7E43,
+    (q15_t)0xEAE4, (q15_t)0x7E3F, (q15_t)0xEACB, (q15_t)0x7E3B, (q15_t)0xEAB2, (q15_t)0x7E37, (q15_t)0xEA99, (q15_t)0x7E32,
+    (q15_t)0xEA80, (q15_t)0x7E2E, (q15_t)0xEA68, (q15_t)0x7E2A, (q15_t)0xEA4F, (q15_t)0x7E26, (q15_t)0xEA36, (q15_t)0x7E21,
+    (q15_t)0xEA1D, (q15_t)0x7E1D, (q15_t)0xEA05, (q15_t)0x7E19, (q15_t)0xE9EC, (q15_t)0x7E14, (q15_t)0xE9D3, (q15_t)0x7E10,
+    (q15_t)0xE9BA, (q15_t)0x7E0C, (q15_t)0xE9A2, (q15_t)0x7E07, (q15_t)0xE989, (q15_t)0x7E03, (q15_t)0xE970, (q15_t)0x7DFF,
+    (q15_t)0xE957, (q15_t)0x7DFA, (q15_t)0xE93F, (q15_t)0x7DF6, (q15_t)0xE926, (q15_t)0x7DF1, (q15_t)0xE90D, (q15_t)0x7DED,
+    (q15_t)0xE8F5, (q15_t)0x7DE8, (q15_t)0xE8DC, (q15_t)0x7DE4, (q15_t)0xE8C3, (q15_t)0x7DDF, (q15_t)0xE8AA, (q15_t)0x7DDA,
+    (q15_t)0xE892, (q15_t)0x7DD6, (q15_t)0xE879, (q15_t)0x7DD1, (q15_t)0xE860, (q15_t)0x7DCD, (q15_t)0xE848, (q15_t)0x7DC8,
+    (q15_t)0xE82F, (q15_t)0x7DC3, (q15_t)0xE816, (q15_t)0x7DBF, (q15_t)0xE7FD, (q15_t)0x7DBA, (q15_t)0xE7E5, (q15_t)0x7DB5,
+    (q15_t)0xE7CC, (q15_t)0x7DB0, (q15_t)0xE7B3, (q15_t)0x7DAC, (q15_t)0xE79B, (q15_t)0x7DA7, (q15_t)0xE782, (q15_t)0x7DA2,
+    (q15_t)0xE769, (q15_t)0x7D9D, (q15_t)0xE751, (q15_t)0x7D98, (q15_t)0xE738, (q15_t)0x7D94, (q15_t)0xE71F, (q15_t)0x7D8F,
+    (q15_t)0xE707, (q15_t)0x7D8A, (q15_t)0xE6EE, (q15_t)0x7D85, (q15_t)0xE6D5, (q15_t)0x7D80, (q15_t)0xE6BD, (q15_t)0x7D7B,
+    (q15_t)0xE6A4, (q15_t)0x7D76, (q15_t)0xE68C, (q15_t)0x7D71, (q15_t)0xE673, (q15_t)0x7D6C, (q15_t)0xE65A, (q15_t)0x7D67,
+    (q15_t)0xE642, (q15_t)0x7D62, (q15_t)0xE629, (q15_t)0x7D5D, (q15_t)0xE610, (q15_t)0x7D58, (q15_t)0xE5F8, (q15_t)0x7D53,
+    (q15_t)0xE5DF, (q15_t)0x7D4E, (q15_t)0xE5C7, (q15_t)0x7D49, (q15_t)0xE5AE, (q15_t)0x7D43, (q15_t)0xE595, (q15_t)0x7D3E,
+    (q15_t)0xE57D, (q15_t)0x7D39, (q15_t)0xE564, (q15_t)0x7D34, (q15_t)0xE54C, (q15_t)0x7D2F, (q15_t)0xE533, (q15_t)0x7D29,
+    (q15_t)0xE51B, (q15_t)0x7D24, (q15_t)0xE502, (q15_t)0x7D1F, (q15_t)0xE4E9, (q15_t)0x7D19, (q15_t)0xE4D1, (q15_t)0x7D14,
+    (q15_t)0xE4B8, (q15_t)0x7D0F, (q15_t)0xE4A0, (q15_t)0x7D09, (q15_t)0xE487, (q15_t)0x7D04, (q15_t)0xE46F, (q15_t)0x7CFF,
+    (q15_t)0xE456, (q15_t)0x7CF9, (q15_t)0xE43E, (q15_t)0x7CF4, (q15_t)0xE425, (q15_t)0x7CEE, (q15_t)0xE40D, (q15_t)0x7CE9,
+    (q15_t)0xE3F4, (q15_t)0x7CE3, (q15_t)0xE3DB, (q15_t)0x7CDE, (q15_t)0xE3C3, (q15_t)0x7CD8, (q15_t)0xE3AA, (q15_t)0x7CD3,
+    (q15_t)0xE392, (q15_t)0x7CCD, (q15_t)0xE379, (q15_t)0x7CC8, (q15_t)0xE361, (q15_t)0x7CC2, (q15_t)0xE348, (q15_t)0x7CBC,
+    (q15_t)0xE330, (q15_t)0x7CB7, (q15_t)0xE317, (q15_t)0x7CB1, (q15_t)0xE2FF, (q15_t)0x7CAB, (q15_t)0xE2E7, (q15_t)0x7CA6,
+    (q15_t)0xE2CE, (q15_t)0x7CA0, (q15_t)0xE2B6, (q15_t)0x7C9A, (q15_t)0xE29D, (q15_t)0x7C94, (q15_t)0xE285, (q15_t)0x7C8F,
+    (q15_t)0xE26C, (q15_t)0x7C89, (q15_t)0xE254, (q15_t)0x7C83, (q15_t)0xE23B, (q15_t)0x7C7D, (q15_t)0xE223, (q15_t)0x7C77,
+    (q15_t)0xE20A, (q15_t)0x7C71, (q15_t)0xE1F2, (q15_t)0x7C6C, (q15_t)0xE1DA, (q15_t)0x7C66, (q15_t)0xE1C1, (q15_t)0x7C60,
+    (q15_t)0xE1A9, (q15_t)0x7C5A, (q15_t)0xE190, (q15_t)0x7C54, (q15_t)0xE178, (q15_t)0x7C4E, (q15_t)0xE15F, (q15_t)0x7C48,
+    (q15_t)0xE147, (q15_t)0x7C42, (q15_t)0xE12F, (q15_t)0x7C3C, (q15_t)0xE116, (q15_t)0x7C36, (q15_t)0xE0FE, (q15_t)0x7C30,
+    (q15_t)0xE0E6, (q15_t)0x7C29, (q15_t)0xE0CD, (q15_t)0x7C23, (q15_t)0xE0B5, (q15_t)0x7C1D, (q15_t)0xE09C, (q15_t)0x7C17,
+    (q15_t)0xE084, (q15_t)0x7C11, (q15_t)0xE06C, (q15_t)0x7C0B, (q15_t)0xE053, (q15_t)0x7C05, (q15_t)0xE03B, (q15_t)0x7BFE,
+    (q15_t)0xE023, (q15_t)0x7BF8, (q15_t)0xE00A, (q15_t)0x7BF2, (q15_t)0xDFF2, (q15_t)0x7BEB, (q15_t)0xDFDA, (q15_t)0x7BE5,
+    (q15_t)0xDFC1, (q15_t)0x7BDF, (q15_t)0xDFA9, (q15_t)0x7BD9, (q15_t)0xDF91, (q15_t)0x7BD2, (q15_t)0xDF78, (q15_t)0x7BCC,
+    (q15_t)0xDF60, (q15_t)0x7BC5, (q15_t)0xDF48, (q15_t)0x7BBF, (q15_t)0xDF2F, (q15_t)0x7BB9, (q15_t)0xDF17, (q15_t)0x7BB2,
+    (q15_t)0xDEFF, (q15_t)0x7BAC, (q15_t)0xDEE7, (q15_t)0x7BA5, (q15_t)0xDECE, (q15_t)0x7B9F, (q15_t)0xDEB6, (q15_t)0x7B98,
+    (q15_t)0xDE9E, (q15_t)0x7B92, (q15_t)0xDE86, (q15_t)0x7B8B, (q15_t)0xDE6D, (q15_t)0x7B84, (q15_t)0xDE55, (q15_t)0x7B7E,
+    (q15_t)0xDE3D, (q15_t)0x7B77, (q15_t)0xDE25, (q15_t)0x7B71, (q15_t)0xDE0C, (q15_t)0x7B6A, (q15_t)0xDDF4, (q15_t)0x7B63,
+    (q15_t)0xDDDC, (q15_t)0x7B5D, (q15_t)0xDDC4, (q15_t)0x7B56, (q15_t)0xDDAB, (q15_t)0x7B4F, (q15_t)0xDD93, (q15_t)0x7B48,
+    (q15_t)0xDD7B, (q15_t)0x7B42, (q15_t)0xDD63, (q15_t)0x7B3B, (q15_t)0xDD4B, (q15_t)0x7B34, (q15_t)0xDD32, (q15_t)0x7B2D,
+    (q15_t)0xDD1A, (q15_t)0x7B26, (q15_t)0xDD02, (q15_t)0x7B1F, (q15_t)0xDCEA, (q15_t)0x7B19, (q15_t)0xDCD2, (q15_t)0x7B12,
+    (q15_t)0xDCBA, (q15_t)0x7B0B, (q15_t)0xDCA1, (q15_t)0x7B04, (q15_t)0xDC89, (q15_t)0x7AFD, (q15_t)0xDC71, (q15_t)0x7AF6,
+    (q15_t)0xDC59, (q15_t)0x7AEF, (q15_t)0xDC41, (q15_t)0x7AE8, (q15_t)0xDC29, (q15_t)0x7AE1, (q15_t)0xDC11, (q15_t)0x7ADA,
+    (q15_t)0xDBF8, (q15_t)0x7AD3, (q15_t)0xDBE0, (q15_t)0x7ACC, (q15_t)0xDBC8, (q15_t)0x7AC5, (q15_t)0xDBB0, (q15_t)0x7ABD,
+    (q15_t)0xDB98, (q15_t)0x7AB6, (q15_t)0xDB80, (q15_t)0x7AAF, (q15_t)0xDB68, (q15_t)0x7AA8, (q15_t)0xDB50, (q15_t)0x7AA1,
+    (q15_t)0xDB38, (q15_t)0x7A9A, (q15_t)0xDB20, (q15_t)0x7A92, (q15_t)0xDB08, (q15_t)0x7A8B, (q15_t)0xDAF0, (q15_t)0x7A84,
+    (q15_t)0xDAD7, (q15_t)0x7A7D, (q15_t)0xDABF, (q15_t)0x7A75, (q15_t)0xDAA7, (q15_t)0x7A6E, (q15_t)0xDA8F, (q15_t)0x7A67,
+    (q15_t)0xDA77, (q15_t)0x7A5F, (q15_t)0xDA5F, (q15_t)0x7A58, (q15_t)0xDA47, (q15_t)0x7A50, (q15_t)0xDA2F, (q15_t)0x7A49,
+    (q15_t)0xDA17, (q15_t)0x7A42, (q15_t)0xD9FF, (q15_t)0x7A3A, (q15_t)0xD9E7, (q15_t)0x7A33, (q15_t)0xD9CF, (q15_t)0x7A2B,
+    (q15_t)0xD9B7, (q15_t)0x7A24, (q15_t)0xD99F, (q15_t)0x7A1C, (q15_t)0xD987, (q15_t)0x7A15, (q15_t)0xD96F, (q15_t)0x7A0D,
+    (q15_t)0xD957, (q15_t)0x7A05, (q15_t)0xD93F, (q15_t)0x79FE, (q15_t)0xD927, (q15_t)0x79F6, (q15_t)0xD910, (q15_t)0x79EF,
+    (q15_t)0xD8F8, (q15_t)0x79E7, (q15_t)0xD8E0, (q15_t)0x79DF, (q15_t)0xD8C8, (q15_t)0x79D8, (q15_t)0xD8B0, (q15_t)0x79D0,
+    (q15_t)0xD898, (q15_t)0x79C8, (q15_t)0xD880, (q15_t)0x79C0, (q15_t)0xD868, (q15_t)0x79B9, (q15_t)0xD850, (q15_t)0x79B1,
+    (q15_t)0xD838, (q15_t)0x79A9, (q15_t)0xD820, (q15_t)0x79A1, (q15_t)0xD809, (q15_t)0x7999, (q15_t)0xD7F1, (q15_t)0x7992,
+    (q15_t)0xD7D9, (q15_t)0x798A, (q15_t)0xD7C1, (q15_t)0x7982, (q15_t)0xD7A9, (q15_t)0x797A, (q15_t)0xD791, (q15_t)0x7972,
+    (q15_t)0xD779, (q15_t)0x796A, (q15_t)0xD762, (q15_t)0x7962, (q15_t)0xD74A, (q15_t)0x795A, (q15_t)0xD732, (q15_t)0x7952,
+    (q15_t)0xD71A, (q15_t)0x794A, (q15_t)0xD702, (q15_t)0x7942, (q15_t)0xD6EA, (q15_t)0x793A, (q15_t)0xD6D3, (q15_t)0x7932,
+    (q15_t)0xD6BB, (q15_t)0x792A, (q15_t)0xD6A3, (q15_t)0x7922, (q15_t)0xD68B, (q15_t)0x7919, (q15_t)0xD674, (q15_t)0x7911,
+    (q15_t)0xD65C, (q15_t)0x7909, (q15_t)0xD644, (q15_t)0x7901, (q15_t)0xD62C, (q15_t)0x78F9, (q15_t)0xD614, (q15_t)0x78F1,
+    (q15_t)0xD5FD, (q15_t)0x78E8, (q15_t)0xD5E5, (q15_t)0x78E0, (q15_t)0xD5CD, (q15_t)0x78D8, (q15_t)0xD5B6, (q15_t)0x78CF,
+    (q15_t)0xD59E, (q15_t)0x78C7, (q15_t)0xD586, (q15_t)0x78BF, (q15_t)0xD56E, (q15_t)0x78B6, (q15_t)0xD557, (q15_t)0x78AE,
+    (q15_t)0xD53F, (q15_t)0x78A6, (q15_t)0xD527, (q15_t)0x789D, (q15_t)0xD510, (q15_t)0x7895, (q15_t)0xD4F8, (q15_t)0x788C,
+    (q15_t)0xD4E0, (q15_t)0x7884, (q15_t)0xD4C9, (q15_t)0x787C, (q15_t)0xD4B1, (q15_t)0x7873, (q15_t)0xD499, (q15_t)0x786B,
+    (q15_t)0xD482, (q15_t)0x7862, (q15_t)0xD46A, (q15_t)0x7859, (q15_t)0xD452, (q15_t)0x7851, (q15_t)0xD43B, (q15_t)0x7848,
+    (q15_t)0xD423, (q15_t)0x7840, (q15_t)0xD40C, (q15_t)0x7837, (q15_t)0xD3F4, (q15_t)0x782E, (q15_t)0xD3DC, (q15_t)0x7826,
+    (q15_t)0xD3C5, (q15_t)0x781D, (q15_t)0xD3AD, (q15_t)0x7814, (q15_t)0xD396, (q15_t)0x780C, (q15_t)0xD37E, (q15_t)0x7803,
+    (q15_t)0xD367, (q15_t)0x77FA, (q15_t)0xD34F, (q15_t)0x77F1, (q15_t)0xD337, (q15_t)0x77E9, (q15_t)0xD320, (q15_t)0x77E0,
+    (q15_t)0xD308, (q15_t)0x77D7, (q15_t)0xD2F1, (q15_t)0x77CE, (q15_t)0xD2D9, (q15_t)0x77C5, (q15_t)0xD2C2, (q15_t)0x77BC,
+    (q15_t)0xD2AA, (q15_t)0x77B4, (q15_t)0xD293, (q15_t)0x77AB, (q15_t)0xD27B, (q15_t)0x77A2, (q15_t)0xD264, (q15_t)0x7799,
+    (q15_t)0xD24C, (q15_t)0x7790, (q15_t)0xD235, (q15_t)0x7787, (q15_t)0xD21D, (q15_t)0x777E, (q15_t)0xD206, (q15_t)0x7775,
+    (q15_t)0xD1EE, (q15_t)0x776C, (q15_t)0xD1D7, (q15_t)0x7763, (q15_t)0xD1C0, (q15_t)0x775A, (q15_t)0xD1A8, (q15_t)0x7751,
+    (q15_t)0xD191, (q15_t)0x7747, (q15_t)0xD179, (q15_t)0x773E, (q15_t)0xD162, (q15_t)0x7735, (q15_t)0xD14A, (q15_t)0x772C,
+    (q15_t)0xD133, (q15_t)0x7723, (q15_t)0xD11C, (q15_t)0x771A, (q15_t)0xD104, (q15_t)0x7710, (q15_t)0xD0ED, (q15_t)0x7707,
+    (q15_t)0xD0D6, (q15_t)0x76FE, (q15_t)0xD0BE, (q15_t)0x76F5, (q15_t)0xD0A7, (q15_t)0x76EB, (q15_t)0xD090, (q15_t)0x76E2,
+    (q15_t)0xD078, (q15_t)0x76D9, (q15_t)0xD061, (q15_t)0x76CF, (q15_t)0xD04A, (q15_t)0x76C6, (q15_t)0xD032, (q15_t)0x76BD,
+    (q15_t)0xD01B, (q15_t)0x76B3, (q15_t)0xD004, (q15_t)0x76AA, (q15_t)0xCFEC, (q15_t)0x76A0, (q15_t)0xCFD5, (q15_t)0x7697,
+    (q15_t)0xCFBE, (q15_t)0x768E, (q15_t)0xCFA6, (q15_t)0x7684, (q15_t)0xCF8F, (q15_t)0x767B, (q15_t)0xCF78, (q15_t)0x7671,
+    (q15_t)0xCF61, (q15_t)0x7668, (q15_t)0xCF49, (q15_t)0x765E, (q15_t)0xCF32, (q15_t)0x7654, (q15_t)0xCF1B, (q15_t)0x764B,
+    (q15_t)0xCF04, (q15_t)0x7641, (q15_t)0xCEED, (q15_t)0x7638, (q15_t)0xCED5, (q15_t)0x762E, (q15_t)0xCEBE, (q15_t)0x7624,
+    (q15_t)0xCEA7, (q15_t)0x761B, (q15_t)0xCE90, (q15_t)0x7611, (q15_t)0xCE79, (q15_t)0x7607, (q15_t)0xCE61, (q15_t)0x75FD,
+    (q15_t)0xCE4A, (q15_t)0x75F4, (q15_t)0xCE33, (q15_t)0x75EA, (q15_t)0xCE1C, (q15_t)0x75E0, (q15_t)0xCE05, (q15_t)0x75D6,
+    (q15_t)0xCDEE, (q15_t)0x75CC, (q15_t)0xCDD7, (q15_t)0x75C3, (q15_t)0xCDBF, (q15_t)0x75B9, (q15_t)0xCDA8, (q15_t)0x75AF,
+    (q15_t)0xCD91, (q15_t)0x75A5, (q15_t)0xCD7A, (q15_t)0x759B, (q15_t)0xCD63, (q15_t)0x7591, (q15_t)0xCD4C, (q15_t)0x7587,
+    (q15_t)0xCD35, (q15_t)0x757D, (q15_t)0xCD1E, (q15_t)0x7573, (q15_t)0xCD07, (q15_t)0x7569, (q15_t)0xCCF0, (q15_t)0x755F,
+    (q15_t)0xCCD9, (q15_t)0x7555, (q15_t)0xCCC2, (q15_t)0x754B, (q15_t)0xCCAB, (q15_t)0x7541, (q15_t)0xCC94, (q15_t)0x7537,
+    (q15_t)0xCC7D, (q15_t)0x752D, (q15_t)0xCC66, (q15_t)0x7523, (q15_t)0xCC4F, (q15_t)0x7519, (q15_t)0xCC38, (q15_t)0x750F,
+    (q15_t)0xCC21, (q15_t)0x7504, (q15_t)0xCC0A, (q15_t)0x74FA, (q15_t)0xCBF3, (q15_t)0x74F0, (q15_t)0xCBDC, (q15_t)0x74E6,
+    (q15_t)0xCBC5, (q15_t)0x74DB, (q15_t)0xCBAE, (q15_t)0x74D1, (q15_t)0xCB97, (q15_t)0x74C7, (q15_t)0xCB80, (q15_t)0x74BD,
+    (q15_t)0xCB69, (q15_t)0x74B2, (q15_t)0xCB52, (q15_t)0x74A8, (q15_t)0xCB3B, (q15_t)0x749E, (q15_t)0xCB24, (q15_t)0x7493,
+    (q15_t)0xCB0D, (q15_t)0x7489, (q15_t)0xCAF7, (q15_t)0x747E, (q15_t)0xCAE0, (q15_t)0x7474, (q15_t)0xCAC9, (q15_t)0x746A,
+    (q15_t)0xCAB2, (q15_t)0x745F, (q15_t)0xCA9B, (q15_t)0x7455, (q15_t)0xCA84, (q15_t)0x744A, (q15_t)0xCA6D, (q15_t)0x7440,
+    (q15_t)0xCA57, (q15_t)0x7435, (q15_t)0xCA40, (q15_t)0x742B, (q15_t)0xCA29, (q15_t)0x7420, (q15_t)0xCA12, (q15_t)0x7415,
+    (q15_t)0xC9FB, (q15_t)0x740B, (q15_t)0xC9E5, (q15_t)0x7400, (q15_t)0xC9CE, (q15_t)0x73F6, (q15_t)0xC9B7, (q15_t)0x73EB,
+    (q15_t)0xC9A0, (q15_t)0x73E0, (q15_t)0xC98A, (q15_t)0x73D6, (q15_t)0xC973, (q15_t)0x73CB, (q15_t)0xC95C, (q15_t)0x73C0,
+    (q15_t)0xC945, (q15_t)0x73B5, (q15_t)0xC92F, (q15_t)0x73AB, (q15_t)0xC918, (q15_t)0x73A0, (q15_t)0xC901, (q15_t)0x7395,
+    (q15_t)0xC8EB, (q15_t)0x738A, (q15_t)0xC8D4, (q15_t)0x737F, (q15_t)0xC8BD, (q15_t)0x7375, (q15_t)0xC8A7, (q15_t)0x736A,
+    (q15_t)0xC890, (q15_t)0x735F, (q15_t)0xC879, (q15_t)0x7354, (q15_t)0xC863, (q15_t)0x7349, (q15_t)0xC84C, (q15_t)0x733E,
+    (q15_t)0xC835, (q15_t)0x7333, (q15_t)0xC81F, (q15_t)0x7328, (q15_t)0xC808, (q15_t)0x731D, (q15_t)0xC7F2, (q15_t)0x7312,
+    (q15_t)0xC7DB, (q15_t)0x7307, (q15_t)0xC7C4, (q15_t)0x72FC, (q15_t)0xC7AE, (q15_t)0x72F1, (q15_t)0xC797, (q15_t)0x72E6,
+    (q15_t)0xC781, (q15_t)0x72DB, (q15_t)0xC76A, (q15_t)0x72D0, (q15_t)0xC754, (q15_t)0x72C5, (q15_t)0xC73D, (q15_t)0x72BA,
+    (q15_t)0xC727, (q15_t)0x72AF, (q15_t)0xC710, (q15_t)0x72A3, (q15_t)0xC6F9, (q15_t)0x7298, (q15_t)0xC6E3, (q15_t)0x728D,
+    (q15_t)0xC6CD, (q15_t)0x7282, (q15_t)0xC6B6, (q15_t)0x7276, (q15_t)0xC6A0, (q15_t)0x726B, (q15_t)0xC689, (q15_t)0x7260,
+    (q15_t)0xC673, (q15_t)0x7255, (q15_t)0xC65C, (q15_t)0x7249, (q15_t)0xC646, (q15_t)0x723E, (q15_t)0xC62F, (q15_t)0x7233,
+    (q15_t)0xC619, (q15_t)0x7227, (q15_t)0xC602, (q15_t)0x721C, (q15_t)0xC5EC, (q15_t)0x7211, (q15_t)0xC5D6, (q15_t)0x7205,
+    (q15_t)0xC5BF, (q15_t)0x71FA, (q15_t)0xC5A9, (q15_t)0x71EE, (q15_t)0xC593, (q15_t)0x71E3, (q15_t)0xC57C, (q15_t)0x71D7,
+    (q15_t)0xC566, (q15_t)0x71CC, (q15_t)0xC550, (q15_t)0x71C0, (q15_t)0xC539, (q15_t)0x71B5, (q15_t)0xC523, (q15_t)0x71A9,
+    (q15_t)0xC50D, (q15_t)0x719E, (q15_t)0xC4F6, (q15_t)0x7192, (q15_t)0xC4E0, (q15_t)0x7186, (q15_t)0xC4CA, (q15_t)0x717B,
+    (q15_t)0xC4B3, (q15_t)0x716F, (q15_t)0xC49D, (q15_t)0x7164, (q15_t)0xC487, (q15_t)0x7158, (q15_t)0xC471, (q15_t)0x714C,
+    (q15_t)0xC45A, (q15_t)0x7141, (q15_t)0xC444, (q15_t)0x7135, (q15_t)0xC42E, (q15_t)0x7129, (q15_t)0xC418, (q15_t)0x711D,
+    (q15_t)0xC402, (q15_t)0x7112, (q15_t)0xC3EB, (q15_t)0x7106, (q15_t)0xC3D5, (q15_t)0x70FA, (q15_t)0xC3BF, (q15_t)0x70EE,
+    (q15_t)0xC3A9, (q15_t)0x70E2, (q15_t)0xC393, (q15_t)0x70D6, (q15_t)0xC37C, (q15_t)0x70CB, (q15_t)0xC366, (q15_t)0x70BF,
+    (q15_t)0xC350, (q15_t)0x70B3, (q15_t)0xC33A, (q15_t)0x70A7, (q15_t)0xC324, (q15_t)0x709B, (q15_t)0xC30E, (q15_t)0x708F,
+    (q15_t)0xC2F8, (q15_t)0x7083, (q15_t)0xC2E2, (q15_t)0x7077, (q15_t)0xC2CC, (q15_t)0x706B, (q15_t)0xC2B6, (q15_t)0x705F,
+    (q15_t)0xC29F, (q15_t)0x7053, (q15_t)0xC289, (q15_t)0x7047, (q15_t)0xC273, (q15_t)0x703B, (q15_t)0xC25D, (q15_t)0x702F,
+    (q15_t)0xC247, (q15_t)0x7023, (q15_t)0xC231, (q15_t)0x7016, (q15_t)0xC21B, (q15_t)0x700A, (q15_t)0xC205, (q15_t)0x6FFE,
+    (q15_t)0xC1EF, (q15_t)0x6FF2, (q15_t)0xC1D9, (q15_t)0x6FE6, (q15_t)0xC1C3, (q15_t)0x6FDA, (q15_t)0xC1AD, (q15_t)0x6FCD,
+    (q15_t)0xC197, (q15_t)0x6FC1, (q15_t)0xC182, (q15_t)0x6FB5, (q15_t)0xC16C, (q15_t)0x6FA9, (q15_t)0xC156, (q15_t)0x6F9C,
+    (q15_t)0xC140, (q15_t)0x6F90, (q15_t)0xC12A, (q15_t)0x6F84, (q15_t)0xC114, (q15_t)0x6F77, (q15_t)0xC0FE, (q15_t)0x6F6B,
+    (q15_t)0xC0E8, (q15_t)0x6F5F, (q15_t)0xC0D2, (q15_t)0x6F52, (q15_t)0xC0BC, (q15_t)0x6F46, (q15_t)0xC0A7, (q15_t)0x6F39,
+    (q15_t)0xC091, (q15_t)0x6F2D, (q15_t)0xC07B, (q15_t)0x6F20, (q15_t)0xC065, (q15_t)0x6F14, (q15_t)0xC04F, (q15_t)0x6F07,
+    (q15_t)0xC03A, (q15_t)0x6EFB, (q15_t)0xC024, (q15_t)0x6EEE, (q15_t)0xC00E, (q15_t)0x6EE2, (q15_t)0xBFF8, (q15_t)0x6ED5,
+    (q15_t)0xBFE2, (q15_t)0x6EC9, (q15_t)0xBFCD, (q15_t)0x6EBC, (q15_t)0xBFB7, (q15_t)0x6EAF, (q15_t)0xBFA1, (q15_t)0x6EA3,
+    (q15_t)0xBF8C, (q15_t)0x6E96, (q15_t)0xBF76, (q15_t)0x6E89, (q15_t)0xBF60, (q15_t)0x6E7D, (q15_t)0xBF4A, (q15_t)0x6E70,
+    (q15_t)0xBF35, (q15_t)0x6E63, (q15_t)0xBF1F, (q15_t)0x6E57, (q15_t)0xBF09, (q15_t)0x6E4A, (q15_t)0xBEF4, (q15_t)0x6E3D,
+    (q15_t)0xBEDE, (q15_t)0x6E30, (q15_t)0xBEC9, (q15_t)0x6E24, (q15_t)0xBEB3, (q15_t)0x6E17, (q15_t)0xBE9D, (q15_t)0x6E0A,
+    (q15_t)0xBE88, (q15_t)0x6DFD, (q15_t)0xBE72, (q15_t)0x6DF0, (q15_t)0xBE5D, (q15_t)0x6DE3, (q15_t)0xBE47, (q15_t)0x6DD6,
+    (q15_t)0xBE31, (q15_t)0x6DCA, (q15_t)0xBE1C, (q15_t)0x6DBD, (q15_t)0xBE06, (q15_t)0x6DB0, (q15_t)0xBDF1, (q15_t)0x6DA3,
+    (q15_t)0xBDDB, (q15_t)0x6D96, (q15_t)0xBDC6, (q15_t)0x6D89, (q15_t)0xBDB0, (q15_t)0x6D7C, (q15_t)0xBD9B, (q15_t)0x6D6F,
+    (q15_t)0xBD85, (q15_t)0x6D62, (q15_t)0xBD70, (q15_t)0x6D55, (q15_t)0xBD5A, (q15_t)0x6D48, (q15_t)0xBD45, (q15_t)0x6D3A,
+    (q15_t)0xBD2F, (q15_t)0x6D2D, (q15_t)0xBD1A, (q15_t)0x6D20, (q15_t)0xBD05, (q15_t)0x6D13, (q15_t)0xBCEF, (q15_t)0x6D06,
+    (q15_t)0xBCDA, (q15_t)0x6CF9, (q15_t)0xBCC4, (q15_t)0x6CEC, (q15_t)0xBCAF, (q15_t)0x6CDE, (q15_t)0xBC9A, (q15_t)0x6CD1,
+    (q15_t)0xBC84, (q15_t)0x6CC4, (q15_t)0xBC6F, (q15_t)0x6CB7, (q15_t)0xBC5A, (q15_t)0x6CA9, (q15_t)0xBC44, (q15_t)0x6C9C,
+    (q15_t)0xBC2F, (q15_t)0x6C8F, (q15_t)0xBC1A, (q15_t)0x6C81, (q15_t)0xBC04, (q15_t)0x6C74, (q15_t)0xBBEF, (q15_t)0x6C67,
+    (q15_t)0xBBDA, (q15_t)0x6C59, (q15_t)0xBBC4, (q15_t)0x6C4C, (q15_t)0xBBAF, (q15_t)0x6C3F, (q15_t)0xBB9A, (q15_t)0x6C31,
+    (q15_t)0xBB85, (q15_t)0x6C24, (q15_t)0xBB6F, (q15_t)0x6C16, (q15_t)0xBB5A, (q15_t)0x6C09, (q15_t)0xBB45, (q15_t)0x6BFB,
+    (q15_t)0xBB30, (q15_t)0x6BEE, (q15_t)0xBB1B, (q15_t)0x6BE0, (q15_t)0xBB05, (q15_t)0x6BD3, (q15_t)0xBAF0, (q15_t)0x6BC5,
+    (q15_t)0xBADB, (q15_t)0x6BB8, (q15_t)0xBAC6, (q15_t)0x6BAA, (q15_t)0xBAB1, (q15_t)0x6B9C, (q15_t)0xBA9C, (q15_t)0x6B8F,
+    (q15_t)0xBA87, (q15_t)0x6B81, (q15_t)0xBA72, (q15_t)0x6B73, (q15_t)0xBA5C, (q15_t)0x6B66, (q15_t)0xBA47, (q15_t)0x6B58,
+    (q15_t)0xBA32, (q15_t)0x6B4A, (q15_t)0xBA1D, (q15_t)0x6B3D, (q15_t)0xBA08, (q15_t)0x6B2F, (q15_t)0xB9F3, (q15_t)0x6B21,
+    (q15_t)0xB9DE, (q15_t)0x6B13, (q15_t)0xB9C9, (q15_t)0x6B06, (q15_t)0xB9B4, (q15_t)0x6AF8, (q15_t)0xB99F, (q15_t)0x6AEA,
+    (q15_t)0xB98A, (q15_t)0x6ADC, (q15_t)0xB975, (q15_t)0x6ACE, (q15_t)0xB960, (q15_t)0x6AC1, (q15_t)0xB94B, (q15_t)0x6AB3,
+    (q15_t)0xB936, (q15_t)0x6AA5, (q15_t)0xB921, (q15_t)0x6A97, (q15_t)0xB90C, (q15_t)0x6A89, (q15_t)0xB8F7, (q15_t)0x6A7B,
+    (q15_t)0xB8E3, (q15_t)0x6A6D, (q15_t)0xB8CE, (q15_t)0x6A5F, (q15_t)0xB8B9, (q15_t)0x6A51, (q15_t)0xB8A4, (q15_t)0x6A43,
+    (q15_t)0xB88F, (q15_t)0x6A35, (q15_t)0xB87A, (q15_t)0x6A27, (q15_t)0xB865, (q15_t)0x6A19, (q15_t)0xB851, (q15_t)0x6A0B,
+    (q15_t)0xB83C, (q15_t)0x69FD, (q15_t)0xB827, (q15_t)0x69EF, (q15_t)0xB812, (q15_t)0x69E1, (q15_t)0xB7FD, (q15_t)0x69D3,
+    (q15_t)0xB7E9, (q15_t)0x69C4, (q15_t)0xB7D4, (q15_t)0x69B6, (q15_t)0xB7BF, (q15_t)0x69A8, (q15_t)0xB7AA, (q15_t)0x699A,
+    (q15_t)0xB796, (q15_t)0x698C, (q15_t)0xB781, (q15_t)0x697D, (q15_t)0xB76C, (q15_t)0x696F, (q15_t)0xB757, (q15_t)0x6961,
+    (q15_t)0xB743, (q15_t)0x6953, (q15_t)0xB72E, (q15_t)0x6944, (q15_t)0xB719, (q15_t)0x6936, (q15_t)0xB705, (q15_t)0x6928,
+    (q15_t)0xB6F0, (q15_t)0x6919, (q15_t)0xB6DC, (q15_t)0x690B, (q15_t)0xB6C7, (q15_t)0x68FD, (q15_t)0xB6B2, (q15_t)0x68EE,
+    (q15_t)0xB69E, (q15_t)0x68E0, (q15_t)0xB689, (q15_t)0x68D1, (q15_t)0xB675, (q15_t)0x68C3, (q15_t)0xB660, (q15_t)0x68B5,
+    (q15_t)0xB64B, (q15_t)0x68A6, (q15_t)0xB637, (q15_t)0x6898, (q15_t)0xB622, (q15_t)0x6889, (q15_t)0xB60E, (q15_t)0x687B,
+    (q15_t)0xB5F9, (q15_t)0x686C, (q15_t)0xB5E5, (q15_t)0x685E, (q15_t)0xB5D0, (q15_t)0x684F, (q15_t)0xB5BC, (q15_t)0x6840,
+    (q15_t)0xB5A7, (q15_t)0x6832, (q15_t)0xB593, (q15_t)0x6823, (q15_t)0xB57E, (q15_t)0x6815, (q15_t)0xB56A, (q15_t)0x6806,
+    (q15_t)0xB556, (q15_t)0x67F7, (q15_t)0xB541, (q15_t)0x67E9, (q15_t)0xB52D, (q15_t)0x67DA, (q15_t)0xB518, (q15_t)0x67CB,
+    (q15_t)0xB504, (q15_t)0x67BD, (q15_t)0xB4F0, (q15_t)0x67AE, (q15_t)0xB4DB, (q15_t)0x679F, (q15_t)0xB4C7, (q15_t)0x6790,
+    (q15_t)0xB4B3, (q15_t)0x6782, (q15_t)0xB49E, (q15_t)0x6773, (q15_t)0xB48A, (q15_t)0x6764, (q15_t)0xB476, (q15_t)0x6755,
+    (q15_t)0xB461, (q15_t)0x6746, (q15_t)0xB44D, (q15_t)0x6737, (q15_t)0xB439, (q15_t)0x6729, (q15_t)0xB425, (q15_t)0x671A,
+    (q15_t)0xB410, (q15_t)0x670B, (q15_t)0xB3FC, (q15_t)0x66FC, (q15_t)0xB3E8, (q15_t)0x66ED, (q15_t)0xB3D4, (q15_t)0x66DE,
+    (q15_t)0xB3C0, (q15_t)0x66CF, (q15_t)0xB3AB, (q15_t)0x66C0, (q15_t)0xB397, (q15_t)0x66B1, (q15_t)0xB383, (q15_t)0x66A2,
+    (q15_t)0xB36F, (q15_t)0x6693, (q15_t)0xB35B, (q15_t)0x6684, (q15_t)0xB347, (q15_t)0x6675, (q15_t)0xB333, (q15_t)0x6666,
+    (q15_t)0xB31E, (q15_t)0x6657, (q15_t)0xB30A, (q15_t)0x6648, (q15_t)0xB2F6, (q15_t)0x6639, (q15_t)0xB2E2, (q15_t)0x6629,
+    (q15_t)0xB2CE, (q15_t)0x661A, (q15_t)0xB2BA, (q15_t)0x660B, (q15_t)0xB2A6, (q15_t)0x65FC, (q15_t)0xB292, (q15_t)0x65ED,
+    (q15_t)0xB27E, (q15_t)0x65DD, (q15_t)0xB26A, (q15_t)0x65CE, (q15_t)0xB256, (q15_t)0x65BF, (q15_t)0xB242, (q15_t)0x65B0,
+    (q15_t)0xB22E, (q15_t)0x65A0, (q15_t)0xB21A, (q15_t)0x6591, (q15_t)0xB206, (q15_t)0x6582, (q15_t)0xB1F2, (q15_t)0x6573,
+    (q15_t)0xB1DE, (q15_t)0x6563, (q15_t)0xB1CB, (q15_t)0x6554, (q15_t)0xB1B7, (q15_t)0x6545, (q15_t)0xB1A3, (q15_t)0x6535,
+    (q15_t)0xB18F, (q15_t)0x6526, (q15_t)0xB17B, (q15_t)0x6516, (q15_t)0xB167, (q15_t)0x6507, (q15_t)0xB153, (q15_t)0x64F7,
+    (q15_t)0xB140, (q15_t)0x64E8, (q15_t)0xB12C, (q15_t)0x64D9, (q15_t)0xB118, (q15_t)0x64C9, (q15_t)0xB104, (q15_t)0x64BA,
+    (q15_t)0xB0F0, (q15_t)0x64AA, (q15_t)0xB0DD, (q15_t)0x649B, (q15_t)0xB0C9, (q15_t)0x648B, (q15_t)0xB0B5, (q15_t)0x647B,
+    (q15_t)0xB0A1, (q15_t)0x646C, (q15_t)0xB08E, (q15_t)0x645C, (q15_t)0xB07A, (q15_t)0x644D, (q15_t)0xB066, (q15_t)0x643D,
+    (q15_t)0xB053, (q15_t)0x642D, (q15_t)0xB03F, (q15_t)0x641E, (q15_t)0xB02B, (q15_t)0x640E, (q15_t)0xB018, (q15_t)0x63FE,
+    (q15_t)0xB004, (q15_t)0x63EF, (q15_t)0xAFF0, (q15_t)0x63DF, (q15_t)0xAFDD, (q15_t)0x63CF, (q15_t)0xAFC9, (q15_t)0x63C0,
+    (q15_t)0xAFB6, (q15_t)0x63B0, (q15_t)0xAFA2, (q15_t)0x63A0, (q15_t)0xAF8F, (q15_t)0x6390, (q15_t)0xAF7B, (q15_t)0x6380,
+    (q15_t)0xAF68, (q15_t)0x6371, (q15_t)0xAF54, (q15_t)0x6361, (q15_t)0xAF40, (q15_t)0x6351, (q15_t)0xAF2D, (q15_t)0x6341,
+    (q15_t)0xAF1A, (q15_t)0x6331, (q15_t)0xAF06, (q15_t)0x6321, (q15_t)0xAEF3, (q15_t)0x6311, (q15_t)0xAEDF, (q15_t)0x6301,
+    (q15_t)0xAECC, (q15_t)0x62F2, (q15_t)0xAEB8, (q15_t)0x62E2, (q15_t)0xAEA5, (q15_t)0x62D2, (q15_t)0xAE91, (q15_t)0x62C2,
+    (q15_t)0xAE7E, (q15_t)0x62B2, (q15_t)0xAE6B, (q15_t)0x62A2, (q15_t)0xAE57, (q15_t)0x6292, (q15_t)0xAE44, (q15_t)0x6282,
+    (q15_t)0xAE31, (q15_t)0x6271, (q15_t)0xAE1D, (q15_t)0x6261, (q15_t)0xAE0A, (q15_t)0x6251, (q15_t)0xADF7, (q15_t)0x6241,
+    (q15_t)0xADE3, (q15_t)0x6231, (q15_t)0xADD0, (q15_t)0x6221, (q15_t)0xADBD, (q15_t)0x6211, (q15_t)0xADAA, (q15_t)0x6201,
+    (q15_t)0xAD96, (q15_t)0x61F1, (q15_t)0xAD83, (q15_t)0x61E0, (q15_t)0xAD70, (q15_t)0x61D0, (q15_t)0xAD5D, (q15_t)0x61C0,
+    (q15_t)0xAD4A, (q15_t)0x61B0, (q15_t)0xAD36, (q15_t)0x619F, (q15_t)0xAD23, (q15_t)0x618F, (q15_t)0xAD10, (q15_t)0x617F,
+    (q15_t)0xACFD, (q15_t)0x616F, (q15_t)0xACEA, (q15_t)0x615E, (q15_t)0xACD7, (q15_t)0x614E, (q15_t)0xACC4, (q15_t)0x613E,
+    (q15_t)0xACB1, (q15_t)0x612D, (q15_t)0xAC9D, (q15_t)0x611D, (q15_t)0xAC8A, (q15_t)0x610D, (q15_t)0xAC77, (q15_t)0x60FC,
+    (q15_t)0xAC64, (q15_t)0x60EC, (q15_t)0xAC51, (q15_t)0x60DB, (q15_t)0xAC3E, (q15_t)0x60CB, (q15_t)0xAC2B, (q15_t)0x60BA,
+    (q15_t)0xAC18, (q15_t)0x60AA, (q15_t)0xAC05, (q15_t)0x6099, (q15_t)0xABF2, (q15_t)0x6089, (q15_t)0xABDF, (q15_t)0x6078,
+    (q15_t)0xABCC, (q15_t)0x6068, (q15_t)0xABBA, (q15_t)0x6057, (q15_t)0xABA7, (q15_t)0x6047, (q15_t)0xAB94, (q15_t)0x6036,
+    (q15_t)0xAB81, (q15_t)0x6026, (q15_t)0xAB6E, (q15_t)0x6015, (q15_t)0xAB5B, (q15_t)0x6004, (q15_t)0xAB48, (q15_t)0x5FF4,
+    (q15_t)0xAB35, (q15_t)0x5FE3, (q15_t)0xAB23, (q15_t)0x5FD3, (q15_t)0xAB10, (q15_t)0x5FC2, (q15_t)0xAAFD, (q15_t)0x5FB1,
+    (q15_t)0xAAEA, (q15_t)0x5FA0, (q15_t)0xAAD7, (q15_t)0x5F90, (q15_t)0xAAC5, (q15_t)0x5F7F, (q15_t)0xAAB2, (q15_t)0x5F6E,
+    (q15_t)0xAA9F, (q15_t)0x5F5E, (q15_t)0xAA8D, (q15_t)0x5F4D, (q15_t)0xAA7A, (q15_t)0x5F3C, (q15_t)0xAA67, (q15_t)0x5F2B,
+    (q15_t)0xAA54, (q15_t)0x5F1A, (q15_t)0xAA42, (q15_t)0x5F0A, (q15_t)0xAA2F, (q15_t)0x5EF9, (q15_t)0xAA1C, (q15_t)0x5EE8,
+    (q15_t)0xAA0A, (q15_t)0x5ED7, (q15_t)0xA9F7, (q15_t)0x5EC6, (q15_t)0xA9E5, (q15_t)0x5EB5, (q15_t)0xA9D2, (q15_t)0x5EA4,
+    (q15_t)0xA9BF, (q15_t)0x5E93, (q15_t)0xA9AD, (q15_t)0x5E82, (q15_t)0xA99A, (q15_t)0x5E71, (q15_t)0xA988, (q15_t)0x5E60,
+    (q15_t)0xA975, (q15_t)0x5E50, (q15_t)0xA963, (q15_t)0x5E3F, (q15_t)0xA950, (q15_t)0x5E2D, (q15_t)0xA93E, (q15_t)0x5E1C,
+    (q15_t)0xA92B, (q15_t)0x5E0B, (q15_t)0xA919, (q15_t)0x5DFA, (q15_t)0xA906, (q15_t)0x5DE9, (q15_t)0xA8F4, (q15_t)0x5DD8,
+    (q15_t)0xA8E2, (q15_t)0x5DC7, (q15_t)0xA8CF, (q15_t)0x5DB6, (q15_t)0xA8BD, (q15_t)0x5DA5, (q15_t)0xA8AA, (q15_t)0x5D94,
+    (q15_t)0xA898, (q15_t)0x5D83, (q15_t)0xA886, (q15_t)0x5D71, (q15_t)0xA873, (q15_t)0x5D60, (q15_t)0xA861, (q15_t)0x5D4F,
+    (q15_t)0xA84F, (q15_t)0x5D3E, (q15_t)0xA83C, (q15_t)0x5D2D, (q15_t)0xA82A, (q15_t)0x5D1B, (q15_t)0xA818, (q15_t)0x5D0A,
+    (q15_t)0xA806, (q15_t)0x5CF9, (q15_t)0xA7F3, (q15_t)0x5CE8, (q15_t)0xA7E1, (q15_t)0x5CD6, (q15_t)0xA7CF, (q15_t)0x5CC5,
+    (q15_t)0xA7BD, (q15_t)0x5CB4, (q15_t)0xA7AA, (q15_t)0x5CA2, (q15_t)0xA798, (q15_t)0x5C91, (q15_t)0xA786, (q15_t)0x5C80,
+    (q15_t)0xA774, (q15_t)0x5C6E, (q15_t)0xA762, (q15_t)0x5C5D, (q15_t)0xA750, (q15_t)0x5C4B, (q15_t)0xA73E, (q15_t)0x5C3A,
+    (q15_t)0xA72B, (q15_t)0x5C29, (q15_t)0xA719, (q15_t)0x5C17, (q15_t)0xA707, (q15_t)0x5C06, (q15_t)0xA6F5, (q15_t)0x5BF4,
+    (q15_t)0xA6E3, (q15_t)0x5BE3, (q15_t)0xA6D1, (q15_t)0x5BD1, (q15_t)0xA6BF, (q15_t)0x5BC0, (q15_t)0xA6AD, (q15_t)0x5BAE,
+    (q15_t)0xA69B, (q15_t)0x5B9D, (q15_t)0xA689, (q15_t)0x5B8B, (q15_t)0xA677, (q15_t)0x5B79, (q15_t)0xA665, (q15_t)0x5B68,
+    (q15_t)0xA653, (q15_t)0x5B56, (q15_t)0xA641, (q15_t)0x5B45, (q15_t)0xA62F, (q15_t)0x5B33, (q15_t)0xA61E, (q15_t)0x5B21,
+    (q15_t)0xA60C, (q15_t)0x5B10, (q15_t)0xA5FA, (q15_t)0x5AFE, (q15_t)0xA5E8, (q15_t)0x5AEC, (q15_t)0xA5D6, (q15_t)0x5ADB,
+    (q15_t)0xA5C4, (q15_t)0x5AC9, (q15_t)0xA5B2, (q15_t)0x5AB7, (q15_t)0xA5A1, (q15_t)0x5AA5, (q15_t)0xA58F, (q15_t)0x5A94,
+    (q15_t)0xA57D, (q15_t)0x5A82, (q15_t)0xA56B, (q15_t)0x5A70, (q15_t)0xA55A, (q15_t)0x5A5E, (q15_t)0xA548, (q15_t)0x5A4D,
+    (q15_t)0xA536, (q15_t)0x5A3B, (q15_t)0xA524, (q15_t)0x5A29, (q15_t)0xA513, (q15_t)0x5A17, (q15_t)0xA501, (q15_t)0x5A05,
+    (q15_t)0xA4EF, (q15_t)0x59F3, (q15_t)0xA4DE, (q15_t)0x59E1, (q15_t)0xA4CC, (q15_t)0x59D0, (q15_t)0xA4BA, (q15_t)0x59BE,
+    (q15_t)0xA4A9, (q15_t)0x59AC, (q15_t)0xA497, (q15_t)0x599A, (q15_t)0xA486, (q15_t)0x5988, (q15_t)0xA474, (q15_t)0x5976,
+    (q15_t)0xA462, (q15_t)0x5964, (q15_t)0xA451, (q15_t)0x5952, (q15_t)0xA43F, (q15_t)0x5940, (q15_t)0xA42E, (q15_t)0x592E,
+    (q15_t)0xA41C, (q15_t)0x591C, (q15_t)0xA40B, (q15_t)0x590A, (q15_t)0xA3F9, (q15_t)0x58F8, (q15_t)0xA3E8, (q15_t)0x58E6,
+    (q15_t)0xA3D6, (q15_t)0x58D4, (q15_t)0xA3C5, (q15_t)0x58C1, (q15_t)0xA3B4, (q15_t)0x58AF, (q15_t)0xA3A2, (q15_t)0x589D,
+    (q15_t)0xA391, (q15_t)0x588B, (q15_t)0xA37F, (q15_t)0x5879, (q15_t)0xA36E, (q15_t)0x5867, (q15_t)0xA35D, (q15_t)0x5855,
+    (q15_t)0xA34B, (q15_t)0x5842, (q15_t)0xA33A, (q15_t)0x5830, (q15_t)0xA329, (q15_t)0x581E, (q15_t)0xA317, (q15_t)0x580C,
+    (q15_t)0xA306, (q15_t)0x57F9, (q15_t)0xA2F5, (q15_t)0x57E7, (q15_t)0xA2E4, (q15_t)0x57D5, (q15_t)0xA2D2, (q15_t)0x57C3,
+    (q15_t)0xA2C1, (q15_t)0x57B0, (q15_t)0xA2B0, (q15_t)0x579E, (q15_t)0xA29F, (q15_t)0x578C, (q15_t)0xA28E, (q15_t)0x5779,
+    (q15_t)0xA27C, (q15_t)0x5767, (q15_t)0xA26B, (q15_t)0x5755, (q15_t)0xA25A, (q15_t)0x5742, (q15_t)0xA249, (q15_t)0x5730,
+    (q15_t)0xA238, (q15_t)0x571D, (q15_t)0xA227, (q15_t)0x570B, (q15_t)0xA216, (q15_t)0x56F9, (q15_t)0xA205, (q15_t)0x56E6,
+    (q15_t)0xA1F4, (q15_t)0x56D4, (q15_t)0xA1E3, (q15_t)0x56C1, (q15_t)0xA1D2, (q15_t)0x56AF, (q15_t)0xA1C0, (q15_t)0x569C,
+    (q15_t)0xA1AF, (q15_t)0x568A, (q15_t)0xA19F, (q15_t)0x5677, (q15_t)0xA18E, (q15_t)0x5665, (q15_t)0xA17D, (q15_t)0x5652,
+    (q15_t)0xA16C, (q15_t)0x5640, (q15_t)0xA15B, (q15_t)0x562D, (q15_t)0xA14A, (q15_t)0x561A, (q15_t)0xA139, (q15_t)0x5608,
+    (q15_t)0xA128, (q15_t)0x55F5, (q15_t)0xA117, (q15_t)0x55E3, (q15_t)0xA106, (q15_t)0x55D0, (q15_t)0xA0F5, (q15_t)0x55BD,
+    (q15_t)0xA0E5, (q15_t)0x55AB, (q15_t)0xA0D4, (q15_t)0x5598, (q15_t)0xA0C3, (q15_t)0x5585, (q15_t)0xA0B2, (q15_t)0x5572,
+    (q15_t)0xA0A1, (q15_t)0x5560, (q15_t)0xA091, (q15_t)0x554D, (q15_t)0xA080, (q15_t)0x553A, (q15_t)0xA06F, (q15_t)0x5528,
+    (q15_t)0xA05F, (q15_t)0x5515, (q15_t)0xA04E, (q15_t)0x5502, (q15_t)0xA03D, (q15_t)0x54EF, (q15_t)0xA02C, (q15_t)0x54DC,
+    (q15_t)0xA01C, (q15_t)0x54CA, (q15_t)0xA00B, (q15_t)0x54B7, (q15_t)0x9FFB, (q15_t)0x54A4, (q15_t)0x9FEA, (q15_t)0x5491,
+    (q15_t)0x9FD9, (q15_t)0x547E, (q15_t)0x9FC9, (q15_t)0x546B, (q15_t)0x9FB8, (q15_t)0x5458, (q15_t)0x9FA8, (q15_t)0x5445,
+    (q15_t)0x9F97, (q15_t)0x5433, (q15_t)0x9F87, (q15_t)0x5420, (q15_t)0x9F76, (q15_t)0x540D, (q15_t)0x9F66, (q15_t)0x53FA,
+    (q15_t)0x9F55, (q15_t)0x53E7, (q15_t)0x9F45, (q15_t)0x53D4, (q15_t)0x9F34, (q15_t)0x53C1, (q15_t)0x9F24, (q15_t)0x53AE,
+    (q15_t)0x9F13, (q15_t)0x539B, (q15_t)0x9F03, (q15_t)0x5388, (q15_t)0x9EF2, (q15_t)0x5375, (q15_t)0x9EE2, (q15_t)0x5362,
+    (q15_t)0x9ED2, (q15_t)0x534E, (q15_t)0x9EC1, (q15_t)0x533B, (q15_t)0x9EB1, (q15_t)0x5328, (q15_t)0x9EA1, (q15_t)0x5315,
+    (q15_t)0x9E90, (q15_t)0x5302, (q15_t)0x9E80, (q15_t)0x52EF, (q15_t)0x9E70, (q15_t)0x52DC, (q15_t)0x9E60, (q15_t)0x52C9,
+    (q15_t)0x9E4F, (q15_t)0x52B5, (q15_t)0x9E3F, (q15_t)0x52A2, (q15_t)0x9E2F, (q15_t)0x528F, (q15_t)0x9E1F, (q15_t)0x527C,
+    (q15_t)0x9E0E, (q15_t)0x5269, (q15_t)0x9DFE, (q15_t)0x5255, (q15_t)0x9DEE, (q15_t)0x5242, (q15_t)0x9DDE, (q15_t)0x522F,
+    (q15_t)0x9DCE, (q15_t)0x521C, (q15_t)0x9DBE, (q15_t)0x5208, (q15_t)0x9DAE, (q15_t)0x51F5, (q15_t)0x9D9E, (q15_t)0x51E2,
+    (q15_t)0x9D8E, (q15_t)0x51CE, (q15_t)0x9D7D, (q15_t)0x51BB, (q15_t)0x9D6D, (q15_t)0x51A8, (q15_t)0x9D5D, (q15_t)0x5194,
+    (q15_t)0x9D4D, (q15_t)0x5181, (q15_t)0x9D3D, (q15_t)0x516E, (q15_t)0x9D2D, (q15_t)0x515A, (q15_t)0x9D1D, (q15_t)0x5147,
+    (q15_t)0x9D0D, (q15_t)0x5133, (q15_t)0x9CFE, (q15_t)0x5120, (q15_t)0x9CEE, (q15_t)0x510C, (q15_t)0x9CDE, (q15_t)0x50F9,
+    (q15_t)0x9CCE, (q15_t)0x50E5, (q15_t)0x9CBE, (q15_t)0x50D2, (q15_t)0x9CAE, (q15_t)0x50BF, (q15_t)0x9C9E, (q15_t)0x50AB,
+    (q15_t)0x9C8E, (q15_t)0x5097, (q15_t)0x9C7F, (q15_t)0x5084, (q15_t)0x9C6F, (q15_t)0x5070, (q15_t)0x9C5F, (q15_t)0x505D,
+    (q15_t)0x9C4F, (q15_t)0x5049, (q15_t)0x9C3F, (q15_t)0x5036, (q15_t)0x9C30, (q15_t)0x5022, (q15_t)0x9C20, (q15_t)0x500F,
+    (q15_t)0x9C10, (q15_t)0x4FFB, (q15_t)0x9C01, (q15_t)0x4FE7, (q15_t)0x9BF1, (q15_t)0x4FD4, (q15_t)0x9BE1, (q15_t)0x4FC0,
+    (q15_t)0x9BD2, (q15_t)0x4FAC, (q15_t)0x9BC2, (q15_t)0x4F99, (q15_t)0x9BB2, (q15_t)0x4F85, (q15_t)0x9BA3, (q15_t)0x4F71,
+    (q15_t)0x9B93, (q15_t)0x4F5E, (q15_t)0x9B84, (q15_t)0x4F4A, (q15_t)0x9B74, (q15_t)0x4F36, (q15_t)0x9B64, (q15_t)0x4F22,
+    (q15_t)0x9B55, (q15_t)0x4F0F, (q15_t)0x9B45, (q15_t)0x4EFB, (q15_t)0x9B36, (q15_t)0x4EE7, (q15_t)0x9B26, (q15_t)0x4ED3,
+    (q15_t)0x9B17, (q15_t)0x4EBF, (q15_t)0x9B08, (q15_t)0x4EAC, (q15_t)0x9AF8, (q15_t)0x4E98, (q15_t)0x9AE9, (q15_t)0x4E84,
+    (q15_t)0x9AD9, (q15_t)0x4E70, (q15_t)0x9ACA, (q15_t)0x4E5C, (q15_t)0x9ABA, (q15_t)0x4E48, (q15_t)0x9AAB, (q15_t)0x4E34,
+    (q15_t)0x9A9C, (q15_t)0x4E21, (q15_t)0x9A8C, (q15_t)0x4E0D, (q15_t)0x9A7D, (q15_t)0x4DF9, (q15_t)0x9A6E, (q15_t)0x4DE5,
+    (q15_t)0x9A5F, (q15_t)0x4DD1, (q15_t)0x9A4F, (q15_t)0x4DBD, (q15_t)0x9A40, (q15_t)0x4DA9, (q15_t)0x9A31, (q15_t)0x4D95,
+    (q15_t)0x9A22, (q15_t)0x4D81, (q15_t)0x9A12, (q15_t)0x4D6D, (q15_t)0x9A03, (q15_t)0x4D59, (q15_t)0x99F4, (q15_t)0x4D45,
+    (q15_t)0x99E5, (q15_t)0x4D31, (q15_t)0x99D6, (q15_t)0x4D1D, (q15_t)0x99C6, (q15_t)0x4D09, (q15_t)0x99B7, (q15_t)0x4CF5,
+    (q15_t)0x99A8, (q15_t)0x4CE1, (q15_t)0x9999, (q15_t)0x4CCC, (q15_t)0x998A, (q15_t)0x4CB8, (q15_t)0x997B, (q15_t)0x4CA4,
+    (q15_t)0x996C, (q15_t)0x4C90, (q15_t)0x995D, (q15_t)0x4C7C, (q15_t)0x994E, (q15_t)0x4C68, (q15_t)0x993F, (q15_t)0x4C54,
+    (q15_t)0x9930, (q15_t)0x4C3F, (q15_t)0x9921, (q15_t)0x4C2B, (q15_t)0x9912, (q15_t)0x4C17, (q15_t)0x9903, (q15_t)0x4C03,
+    (q15_t)0x98F4, (q15_t)0x4BEF, (q15_t)0x98E5, (q15_t)0x4BDA, (q15_t)0x98D6, (q15_t)0x4BC6, (q15_t)0x98C8, (q15_t)0x4BB2,
+    (q15_t)0x98B9, (q15_t)0x4B9E, (q15_t)0x98AA, (q15_t)0x4B89, (q15_t)0x989B, (q15_t)0x4B75, (q15_t)0x988C, (q15_t)0x4B61,
+    (q15_t)0x987D, (q15_t)0x4B4C, (q15_t)0x986F, (q15_t)0x4B38, (q15_t)0x9860, (q15_t)0x4B24, (q15_t)0x9851, (q15_t)0x4B0F,
+    (q15_t)0x9842, (q15_t)0x4AFB, (q15_t)0x9834, (q15_t)0x4AE7, (q15_t)0x9825, (q15_t)0x4AD2, (q15_t)0x9816, (q15_t)0x4ABE,
+    (q15_t)0x9808, (q15_t)0x4AA9, (q15_t)0x97F9, (q15_t)0x4A95, (q15_t)0x97EA, (q15_t)0x4A81, (q15_t)0x97DC, (q15_t)0x4A6C,
+    (q15_t)0x97CD, (q15_t)0x4A58, (q15_t)0x97BF, (q15_t)0x4A43, (q15_t)0x97B0, (q15_t)0x4A2F, (q15_t)0x97A1, (q15_t)0x4A1A,
+    (q15_t)0x9793, (q15_t)0x4A06, (q15_t)0x9784, (q15_t)0x49F1, (q15_t)0x9776, (q15_t)0x49DD, (q15_t)0x9767, (q15_t)0x49C8,
+    (q15_t)0x9759, (q15_t)0x49B4, (q15_t)0x974A, (q15_t)0x499F, (q15_t)0x973C, (q15_t)0x498A, (q15_t)0x972E, (q15_t)0x4976,
+    (q15_t)0x971F, (q15_t)0x4961, (q15_t)0x9711, (q15_t)0x494D, (q15_t)0x9702, (q15_t)0x4938, (q15_t)0x96F4, (q15_t)0x4923,
+    (q15_t)0x96E6, (q15_t)0x490F, (q15_t)0x96D7, (q15_t)0x48FA, (q15_t)0x96C9, (q15_t)0x48E6, (q15_t)0x96BB, (q15_t)0x48D1,
+    (q15_t)0x96AC, (q15_t)0x48BC, (q15_t)0x969E, (q15_t)0x48A8, (q15_t)0x9690, (q15_t)0x4893, (q15_t)0x9682, (q15_t)0x487E,
+    (q15_t)0x9673, (q15_t)0x4869, (q15_t)0x9665, (q15_t)0x4855, (q15_t)0x9657, (q15_t)0x4840, (q15_t)0x9649, (q15_t)0x482B,
+    (q15_t)0x963B, (q15_t)0x4816, (q15_t)0x962C, (q15_t)0x4802, (q15_t)0x961E, (q15_t)0x47ED, (q15_t)0x9610, (q15_t)0x47D8,
+    (q15_t)0x9602, (q15_t)0x47C3, (q15_t)0x95F4, (q15_t)0x47AE, (q15_t)0x95E6, (q15_t)0x479A, (q15_t)0x95D8, (q15_t)0x4785,
+    (q15_t)0x95CA, (q15_t)0x4770, (q15_t)0x95BC, (q15_t)0x475B, (q15_t)0x95AE, (q15_t)0x4746, (q15_t)0x95A0, (q15_t)0x4731,
+    (q15_t)0x9592, (q15_t)0x471C, (q15_t)0x9584, (q15_t)0x4708, (q15_t)0x9576, (q15_t)0x46F3, (q15_t)0x9568, (q15_t)0x46DE,
+    (q15_t)0x955A, (q15_t)0x46C9, (q15_t)0x954C, (q15_t)0x46B4, (q15_t)0x953E, (q15_t)0x469F, (q15_t)0x9531, (q15_t)0x468A,
+    (q15_t)0x9523, (q15_t)0x4675, (q15_t)0x9515, (q15_t)0x4660, (q15_t)0x9507, (q15_t)0x464B, (q15_t)0x94F9, (q15_t)0x4636,
+    (q15_t)0x94EC, (q15_t)0x4621, (q15_t)0x94DE, (q15_t)0x460C, (q15_t)0x94D0, (q15_t)0x45F7, (q15_t)0x94C2, (q15_t)0x45E2,
+    (q15_t)0x94B5, (q15_t)0x45CD, (q15_t)0x94A7, (q15_t)0x45B8, (q15_t)0x9499, (q15_t)0x45A3, (q15_t)0x948C, (q15_t)0x458D,
+    (q15_t)0x947E, (q15_t)0x4578, (q15_t)0x9470, (q15_t)0x4563, (q15_t)0x9463, (q15_t)0x454E, (q15_t)0x9455, (q15_t)0x4539,
+    (q15_t)0x9447, (q15_t)0x4524, (q15_t)0x943A, (q15_t)0x450F, (q15_t)0x942C, (q15_t)0x44FA, (q15_t)0x941F, (q15_t)0x44E4,
+    (q15_t)0x9411, (q15_t)0x44CF, (q15_t)0x9404, (q15_t)0x44BA, (q15_t)0x93F6, (q15_t)0x44A5, (q15_t)0x93E9, (q15_t)0x4490,
+    (q15_t)0x93DB, (q15_t)0x447A, (q15_t)0x93CE, (q15_t)0x4465, (q15_t)0x93C0, (q15_t)0x4450, (q15_t)0x93B3, (q15_t)0x443B,
+    (q15_t)0x93A6, (q15_t)0x4425, (q15_t)0x9398, (q15_t)0x4410, (q15_t)0x938B, (q15_t)0x43FB, (q15_t)0x937E, (q15_t)0x43E5,
+    (q15_t)0x9370, (q15_t)0x43D0, (q15_t)0x9363, (q15_t)0x43BB, (q15_t)0x9356, (q15_t)0x43A5, (q15_t)0x9348, (q15_t)0x4390,
+    (q15_t)0x933B, (q15_t)0x437B, (q15_t)0x932E, (q15_t)0x4365, (q15_t)0x9321, (q15_t)0x4350, (q15_t)0x9313, (q15_t)0x433B,
+    (q15_t)0x9306, (q15_t)0x4325, (q15_t)0x92F9, (q15_t)0x4310, (q15_t)0x92EC, (q15_t)0x42FA, (q15_t)0x92DF, (q15_t)0x42E5,
+    (q15_t)0x92D2, (q15_t)0x42D0, (q15_t)0x92C5, (q15_t)0x42BA, (q15_t)0x92B7, (q15_t)0x42A5, (q15_t)0x92AA, (q15_t)0x428F,
+    (q15_t)0x929D, (q15_t)0x427A, (q15_t)0x9290, (q15_t)0x4264, (q15_t)0x9283, (q15_t)0x424F, (q15_t)0x9276, (q15_t)0x4239,
+    (q15_t)0x9269, (q15_t)0x4224, (q15_t)0x925C, (q15_t)0x420E, (q15_t)0x924F, (q15_t)0x41F9, (q15_t)0x9242, (q15_t)0x41E3,
+    (q15_t)0x9235, (q15_t)0x41CE, (q15_t)0x9229, (q15_t)0x41B8, (q15_t)0x921C, (q15_t)0x41A2, (q15_t)0x920F, (q15_t)0x418D,
+    (q15_t)0x9202, (q15_t)0x4177, (q15_t)0x91F5, (q15_t)0x4162, (q15_t)0x91E8, (q15_t)0x414C, (q15_t)0x91DB, (q15_t)0x4136,
+    (q15_t)0x91CF, (q15_t)0x4121, (q15_t)0x91C2, (q15_t)0x410B, (q15_t)0x91B5, (q15_t)0x40F6, (q15_t)0x91A8, (q15_t)0x40E0,
+    (q15_t)0x919C, (q15_t)0x40CA, (q15_t)0x918F, (q15_t)0x40B5, (q15_t)0x9182, (q15_t)0x409F, (q15_t)0x9176, (q15_t)0x4089,
+    (q15_t)0x9169, (q15_t)0x4073, (q15_t)0x915C, (q15_t)0x405E, (q15_t)0x9150, (q15_t)0x4048, (q15_t)0x9143, (q15_t)0x4032,
+    (q15_t)0x9136, (q15_t)0x401D, (q15_t)0x912A, (q15_t)0x4007, (q15_t)0x911D, (q15_t)0x3FF1, (q15_t)0x9111, (q15_t)0x3FDB,
+    (q15_t)0x9104, (q15_t)0x3FC5, (q15_t)0x90F8, (q15_t)0x3FB0, (q15_t)0x90EB, (q15_t)0x3F9A, (q15_t)0x90DF, (q15_t)0x3F84,
+    (q15_t)0x90D2, (q15_t)0x3F6E, (q15_t)0x90C6, (q15_t)0x3F58, (q15_t)0x90B9, (q15_t)0x3F43, (q15_t)0x90AD, (q15_t)0x3F2D,
+    (q15_t)0x90A0, (q15_t)0x3F17, (q15_t)0x9094, (q15_t)0x3F01, (q15_t)0x9088, (q15_t)0x3EEB, (q15_t)0x907B, (q15_t)0x3ED5,
+    (q15_t)0x906F, (q15_t)0x3EBF, (q15_t)0x9063, (q15_t)0x3EA9, (q15_t)0x9056, (q15_t)0x3E93, (q15_t)0x904A, (q15_t)0x3E7D,
+    (q15_t)0x903E, (q15_t)0x3E68, (q15_t)0x9032, (q15_t)0x3E52, (q15_t)0x9025, (q15_t)0x3E3C, (q15_t)0x9019, (q15_t)0x3E26,
+    (q15_t)0x900D, (q15_t)0x3E10, (q15_t)0x9001, (q15_t)0x3DFA, (q15_t)0x8FF5, (q15_t)0x3DE4, (q15_t)0x8FE9, (q15_t)0x3DCE,
+    (q15_t)0x8FDC, (q15_t)0x3DB8, (q15_t)0x8FD0, (q15_t)0x3DA2, (q15_t)0x8FC4, (q15_t)0x3D8C, (q15_t)0x8FB8, (q15_t)0x3D76,
+    (q15_t)0x8FAC, (q15_t)0x3D60, (q15_t)0x8FA0, (q15_t)0x3D49, (q15_t)0x8F94, (q15_t)0x3D33, (q15_t)0x8F88, (q15_t)0x3D1D,
+    (q15_t)0x8F7C, (q15_t)0x3D07, (q15_t)0x8F70, (q15_t)0x3CF1, (q15_t)0x8F64, (q15_t)0x3CDB, (q15_t)0x8F58, (q15_t)0x3CC5,
+    (q15_t)0x8F4C, (q15_t)0x3CAF, (q15_t)0x8F40, (q15_t)0x3C99, (q15_t)0x8F34, (q15_t)0x3C83, (q15_t)0x8F29, (q15_t)0x3C6C,
+    (q15_t)0x8F1D, (q15_t)0x3C56, (q15_t)0x8F11, (q15_t)0x3C40, (q15_t)0x8F05, (q15_t)0x3C2A, (q15_t)0x8EF9, (q15_t)0x3C14,
+    (q15_t)0x8EED, (q15_t)0x3BFD, (q15_t)0x8EE2, (q15_t)0x3BE7, (q15_t)0x8ED6, (q15_t)0x3BD1, (q15_t)0x8ECA, (q15_t)0x3BBB,
+    (q15_t)0x8EBE, (q15_t)0x3BA5, (q15_t)0x8EB3, (q15_t)0x3B8E, (q15_t)0x8EA7, (q15_t)0x3B78, (q15_t)0x8E9B, (q15_t)0x3B62,
+    (q15_t)0x8E90, (q15_t)0x3B4C, (q15_t)0x8E84, (q15_t)0x3B35, (q15_t)0x8E79, (q15_t)0x3B1F, (q15_t)0x8E6D, (q15_t)0x3B09,
+    (q15_t)0x8E61, (q15_t)0x3AF2, (q15_t)0x8E56, (q15_t)0x3ADC, (q15_t)0x8E4A, (q15_t)0x3AC6, (q15_t)0x8E3F, (q15_t)0x3AAF,
+    (q15_t)0x8E33, (q15_t)0x3A99, (q15_t)0x8E28, (q15_t)0x3A83, (q15_t)0x8E1C, (q15_t)0x3A6C, (q15_t)0x8E11, (q15_t)0x3A56,
+    (q15_t)0x8E05, (q15_t)0x3A40, (q15_t)0x8DFA, (q15_t)0x3A29, (q15_t)0x8DEE, (q15_t)0x3A13, (q15_t)0x8DE3, (q15_t)0x39FD,
+    (q15_t)0x8DD8, (q15_t)0x39E6, (q15_t)0x8DCC, (q15_t)0x39D0, (q15_t)0x8DC1, (q15_t)0x39B9, (q15_t)0x8DB6, (q15_t)0x39A3,
+    (q15_t)0x8DAA, (q15_t)0x398C, (q15_t)0x8D9F, (q15_t)0x3976, (q15_t)0x8D94, (q15_t)0x395F, (q15_t)0x8D89, (q15_t)0x3949,
+    (q15_t)0x8D7D, (q15_t)0x3932, (q15_t)0x8D72, (q15_t)0x391C, (q15_t)0x8D67, (q15_t)0x3906, (q15_t)0x8D5C, (q15_t)0x38EF,
+    (q15_t)0x8D50, (q15_t)0x38D8, (q15_t)0x8D45, (q15_t)0x38C2, (q15_t)0x8D3A, (q15_t)0x38AB, (q15_t)0x8D2F, (q15_t)0x3895,
+    (q15_t)0x8D24, (q15_t)0x387E, (q15_t)0x8D19, (q15_t)0x3868, (q15_t)0x8D0E, (q15_t)0x3851, (q15_t)0x8D03, (q15_t)0x383B,
+    (q15_t)0x8CF8, (q15_t)0x3824, (q15_t)0x8CED, (q15_t)0x380D, (q15_t)0x8CE2, (q15_t)0x37F7, (q15_t)0x8CD7, (q15_t)0x37E0,
+    (q15_t)0x8CCC, (q15_t)0x37CA, (q15_t)0x8CC1, (q15_t)0x37B3, (q15_t)0x8CB6, (q15_t)0x379C, (q15_t)0x8CAB, (q15_t)0x3786,
+    (q15_t)0x8CA0, (q15_t)0x376F, (q15_t)0x8C95, (q15_t)0x3758, (q15_t)0x8C8A, (q15_t)0x3742, (q15_t)0x8C80, (q15_t)0x372B,
+    (q15_t)0x8C75, (q15_t)0x3714, (q15_t)0x8C6A, (q15_t)0x36FE, (q15_t)0x8C5F, (q15_t)0x36E7, (q15_t)0x8C54, (q15_t)0x36D0,
+    (q15_t)0x8C4A, (q15_t)0x36BA, (q15_t)0x8C3F, (q15_t)0x36A3, (q15_t)0x8C34, (q15_t)0x368C, (q15_t)0x8C29, (q15_t)0x3675,
+    (q15_t)0x8C1F, (q15_t)0x365F, (q15_t)0x8C14, (q15_t)0x3648, (q15_t)0x8C09, (q15_t)0x3631, (q15_t)0x8BFF, (q15_t)0x361A,
+    (q15_t)0x8BF4, (q15_t)0x3604, (q15_t)0x8BEA, (q15_t)0x35ED, (q15_t)0x8BDF, (q15_t)0x35D6, (q15_t)0x8BD4, (q15_t)0x35BF,
+    (q15_t)0x8BCA, (q15_t)0x35A8, (q15_t)0x8BBF, (q15_t)0x3592, (q15_t)0x8BB5, (q15_t)0x357B, (q15_t)0x8BAA, (q15_t)0x3564,
+    (q15_t)0x8BA0, (q15_t)0x354D, (q15_t)0x8B95, (q15_t)0x3536, (q15_t)0x8B8B, (q15_t)0x351F, (q15_t)0x8B81, (q15_t)0x3508,
+    (q15_t)0x8B76, (q15_t)0x34F2, (q15_t)0x8B6C, (q15_t)0x34DB, (q15_t)0x8B61, (q15_t)0x34C4, (q15_t)0x8B57, (q15_t)0x34AD,
+    (q15_t)0x8B4D, (q15_t)0x3496, (q15_t)0x8B42, (q15_t)0x347F, (q15_t)0x8B38, (q15_t)0x3468, (q15_t)0x8B2E, (q15_t)0x3451,
+    (q15_t)0x8B24, (q15_t)0x343A, (q15_t)0x8B19, (q15_t)0x3423, (q15_t)0x8B0F, (q15_t)0x340C, (q15_t)0x8B05, (q15_t)0x33F5,
+    (q15_t)0x8AFB, (q15_t)0x33DE, (q15_t)0x8AF0, (q15_t)0x33C7, (q15_t)0x8AE6, (q15_t)0x33B0, (q15_t)0x8ADC, (q15_t)0x3399,
+    (q15_t)0x8AD2, (q15_t)0x3382, (q15_t)0x8AC8, (q15_t)0x336B, (q15_t)0x8ABE, (q15_t)0x3354, (q15_t)0x8AB4, (q15_t)0x333D,
+    (q15_t)0x8AAA, (q15_t)0x3326, (q15_t)0x8AA0, (q15_t)0x330F, (q15_t)0x8A96, (q15_t)0x32F8, (q15_t)0x8A8C, (q15_t)0x32E1,
+    (q15_t)0x8A82, (q15_t)0x32CA, (q15_t)0x8A78, (q15_t)0x32B3, (q15_t)0x8A6E, (q15_t)0x329C, (q15_t)0x8A64, (q15_t)0x3285,
+    (q15_t)0x8A5A, (q15_t)0x326E, (q15_t)0x8A50, (q15_t)0x3257, (q15_t)0x8A46, (q15_t)0x3240, (q15_t)0x8A3C, (q15_t)0x3228,
+    (q15_t)0x8A33, (q15_t)0x3211, (q15_t)0x8A29, (q15_t)0x31FA, (q15_t)0x8A1F, (q15_t)0x31E3, (q15_t)0x8A15, (q15_t)0x31CC,
+    (q15_t)0x8A0B, (q15_t)0x31B5, (q15_t)0x8A02, (q15_t)0x319E, (q15_t)0x89F8, (q15_t)0x3186, (q15_t)0x89EE, (q15_t)0x316F,
+    (q15_t)0x89E4, (q15_t)0x3158, (q15_t)0x89DB, (q15_t)0x3141, (q15_t)0x89D1, (q15_t)0x312A, (q15_t)0x89C7, (q15_t)0x3112,
+    (q15_t)0x89BE, (q15_t)0x30FB, (q15_t)0x89B4, (q15_t)0x30E4, (q15_t)0x89AB, (q15_t)0x30CD, (q15_t)0x89A1, (q15_t)0x30B6,
+    (q15_t)0x8997, (q15_t)0x309E, (q15_t)0x898E, (q15_t)0x3087, (q15_t)0x8984, (q15_t)0x3070, (q15_t)0x897B, (q15_t)0x3059,
+    (q15_t)0x8971, (q15_t)0x3041, (q15_t)0x8968, (q15_t)0x302A, (q15_t)0x895F, (q15_t)0x3013, (q15_t)0x8955, (q15_t)0x2FFB,
+    (q15_t)0x894C, (q15_t)0x2FE4, (q15_t)0x8942, (q15_t)0x2FCD, (q15_t)0x8939, (q15_t)0x2FB5, (q15_t)0x8930, (q15_t)0x2F9E,
+    (q15_t)0x8926, (q15_t)0x2F87, (q15_t)0x891D, (q15_t)0x2F6F, (q15_t)0x8914, (q15_t)0x2F58, (q15_t)0x890A, (q15_t)0x2F41,
+    (q15_t)0x8901, (q15_t)0x2F29, (q15_t)0x88F8, (q15_t)0x2F12, (q15_t)0x88EF, (q15_t)0x2EFB, (q15_t)0x88E5, (q15_t)0x2EE3,
+    (q15_t)0x88DC, (q15_t)0x2ECC, (q15_t)0x88D3, (q15_t)0x2EB5, (q15_t)0x88CA, (q15_t)0x2E9D, (q15_t)0x88C1, (q15_t)0x2E86,
+    (q15_t)0x88B8, (q15_t)0x2E6E, (q15_t)0x88AE, (q15_t)0x2E57, (q15_t)0x88A5, (q15_t)0x2E3F, (q15_t)0x889C, (q15_t)0x2E28,
+    (q15_t)0x8893, (q15_t)0x2E11, (q15_t)0x888A, (q15_t)0x2DF9, (q15_t)0x8881, (q15_t)0x2DE2, (q15_t)0x8878, (q15_t)0x2DCA,
+    (q15_t)0x886F, (q15_t)0x2DB3, (q15_t)0x8866, (q15_t)0x2D9B, (q15_t)0x885D, (q15_t)0x2D84, (q15_t)0x8854, (q15_t)0x2D6C,
+    (q15_t)0x884B, (q15_t)0x2D55, (q15_t)0x8843, (q15_t)0x2D3D, (q15_t)0x883A, (q15_t)0x2D26, (q15_t)0x8831, (q15_t)0x2D0E,
+    (q15_t)0x8828, (q15_t)0x2CF7, (q15_t)0x881F, (q15_t)0x2CDF, (q15_t)0x8816, (q15_t)0x2CC8, (q15_t)0x880E, (q15_t)0x2CB0,
+    (q15_t)0x8805, (q15_t)0x2C98, (q15_t)0x87FC, (q15_t)0x2C81, (q15_t)0x87F3, (q15_t)0x2C69, (q15_t)0x87EB, (q15_t)0x2C52,
+    (q15_t)0x87E2, (q15_t)0x2C3A, (q15_t)0x87D9, (q15_t)0x2C23, (q15_t)0x87D1, (q15_t)0x2C0B, (q15_t)0x87C8, (q15_t)0x2BF3,
+    (q15_t)0x87BF, (q15_t)0x2BDC, (q15_t)0x87B7, (q15_t)0x2BC4, (q15_t)0x87AE, (q15_t)0x2BAD, (q15_t)0x87A6, (q15_t)0x2B95,
+    (q15_t)0x879D, (q15_t)0x2B7D, (q15_t)0x8794, (q15_t)0x2B66, (q15_t)0x878C, (q15_t)0x2B4E, (q15_t)0x8783, (q15_t)0x2B36,
+    (q15_t)0x877B, (q15_t)0x2B1F, (q15_t)0x8773, (q15_t)0x2B07, (q15_t)0x876A, (q15_t)0x2AEF, (q15_t)0x8762, (q15_t)0x2AD8,
+    (q15_t)0x8759, (q15_t)0x2AC0, (q15_t)0x8751, (q15_t)0x2AA8, (q15_t)0x8749, (q15_t)0x2A91, (q15_t)0x8740, (q15_t)0x2A79,
+    (q15_t)0x8738, (q15_t)0x2A61, (q15_t)0x8730, (q15_t)0x2A49, (q15_t)0x8727, (q15_t)0x2A32, (q15_t)0x871F, (q15_t)0x2A1A,
+    (q15_t)0x8717, (q15_t)0x2A02, (q15_t)0x870E, (q15_t)0x29EB, (q15_t)0x8706, (q15_t)0x29D3, (q15_t)0x86FE, (q15_t)0x29BB,
+    (q15_t)0x86F6, (q15_t)0x29A3, (q15_t)0x86EE, (q15_t)0x298B, (q15_t)0x86E6, (q15_t)0x2974, (q15_t)0x86DD, (q15_t)0x295C,
+    (q15_t)0x86D5, (q15_t)0x2944, (q15_t)0x86CD, (q15_t)0x292C, (q15_t)0x86C5, (q15_t)0x2915, (q15_t)0x86BD, (q15_t)0x28FD,
+    (q15_t)0x86B5, (q15_t)0x28E5, (q15_t)0x86AD, (q15_t)0x28CD, (q15_t)0x86A5, (q15_t)0x28B5, (q15_t)0x869D, (q15_t)0x289D,
+    (q15_t)0x8695, (q15_t)0x2886, (q15_t)0x868D, (q15_t)0x286E, (q15_t)0x8685, (q15_t)0x2856, (q15_t)0x867D, (q15_t)0x283E,
+    (q15_t)0x8675, (q15_t)0x2826, (q15_t)0x866D, (q15_t)0x280E, (q15_t)0x8666, (q15_t)0x27F6, (q15_t)0x865E, (q15_t)0x27DF,
+    (q15_t)0x8656, (q15_t)0x27C7, (q15_t)0x864E, (q15_t)0x27AF, (q15_t)0x8646, (q15_t)0x2797, (q15_t)0x863F, (q15_t)0x277F,
+    (q15_t)0x8637, (q15_t)0x2767, (q15_t)0x862F, (q15_t)0x274F, (q15_t)0x8627, (q15_t)0x2737, (q15_t)0x8620, (q15_t)0x271F,
+    (q15_t)0x8618, (q15_t)0x2707, (q15_t)0x8610, (q15_t)0x26EF, (q15_t)0x8609, (q15_t)0x26D8, (q15_t)0x8601, (q15_t)0x26C0,
+    (q15_t)0x85FA, (q15_t)0x26A8, (q15_t)0x85F2, (q15_t)0x2690, (q15_t)0x85EA, (q15_t)0x2678, (q15_t)0x85E3, (q15_t)0x2660,
+    (q15_t)0x85DB, (q15_t)0x2648, (q15_t)0x85D4, (q15_t)0x2630, (q15_t)0x85CC, (q15_t)0x2618, (q15_t)0x85C5, (q15_t)0x2600,
+    (q15_t)0x85BD, (q15_t)0x25E8, (q15_t)0x85B6, (q15_t)0x25D0, (q15_t)0x85AF, (q15_t)0x25B8, (q15_t)0x85A7, (q15_t)0x25A0,
+    (q15_t)0x85A0, (q15_t)0x2588, (q15_t)0x8598, (q15_t)0x2570, (q15_t)0x8591, (q15_t)0x2558, (q15_t)0x858A, (q15_t)0x2540,
+    (q15_t)0x8582, (q15_t)0x2528, (q15_t)0x857B, (q15_t)0x250F, (q15_t)0x8574, (q15_t)0x24F7, (q15_t)0x856D, (q15_t)0x24DF,
+    (q15_t)0x8565, (q15_t)0x24C7, (q15_t)0x855E, (q15_t)0x24AF, (q15_t)0x8557, (q15_t)0x2497, (q15_t)0x8550, (q15_t)0x247F,
+    (q15_t)0x8549, (q15_t)0x2467, (q15_t)0x8542, (q15_t)0x244F, (q15_t)0x853A, (q15_t)0x2437, (q15_t)0x8533, (q15_t)0x241F,
+    (q15_t)0x852C, (q15_t)0x2407, (q15_t)0x8525, (q15_t)0x23EE, (q15_t)0x851E, (q15_t)0x23D6, (q15_t)0x8517, (q15_t)0x23BE,
+    (q15_t)0x8510, (q15_t)0x23A6, (q15_t)0x8509, (q15_t)0x238E, (q15_t)0x8502, (q15_t)0x2376, (q15_t)0x84FB, (q15_t)0x235E,
+    (q15_t)0x84F4, (q15_t)0x2345, (q15_t)0x84ED, (q15_t)0x232D, (q15_t)0x84E6, (q15_t)0x2315, (q15_t)0x84E0, (q15_t)0x22FD,
+    (q15_t)0x84D9, (q15_t)0x22E5, (q15_t)0x84D2, (q15_t)0x22CD, (q15_t)0x84CB, (q15_t)0x22B4, (q15_t)0x84C4, (q15_t)0x229C,
+    (q15_t)0x84BD, (q15_t)0x2284, (q15_t)0x84B7, (q15_t)0x226C, (q15_t)0x84B0, (q15_t)0x2254, (q15_t)0x84A9, (q15_t)0x223B,
+    (q15_t)0x84A2, (q15_t)0x2223, (q15_t)0x849C, (q15_t)0x220B, (q15_t)0x8495, (q15_t)0x21F3, (q15_t)0x848E, (q15_t)0x21DA,
+    (q15_t)0x8488, (q15_t)0x21C2, (q15_t)0x8481, (q15_t)0x21AA, (q15_t)0x847B, (q15_t)0x2192, (q15_t)0x8474, (q15_t)0x2179,
+    (q15_t)0x846D, (q15_t)0x2161, (q15_t)0x8467, (q15_t)0x2149, (q15_t)0x8460, (q15_t)0x2131, (q15_t)0x845A, (q15_t)0x2118,
+    (q15_t)0x8453, (q15_t)0x2100, (q15_t)0x844D, (q15_t)0x20E8, (q15_t)0x8446, (q15_t)0x20D0, (q15_t)0x8440, (q15_t)0x20B7,
+    (q15_t)0x843A, (q15_t)0x209F, (q15_t)0x8433, (q15_t)0x2087, (q15_t)0x842D, (q15_t)0x206E, (q15_t)0x8426, (q15_t)0x2056,
+    (q15_t)0x8420, (q15_t)0x203E, (q15_t)0x841A, (q15_t)0x2025, (q15_t)0x8414, (q15_t)0x200D, (q15_t)0x840D, (q15_t)0x1FF5,
+    (q15_t)0x8407, (q15_t)0x1FDC, (q15_t)0x8401, (q15_t)0x1FC4, (q15_t)0x83FA, (q15_t)0x1FAC, (q15_t)0x83F4, (q15_t)0x1F93,
+    (q15_t)0x83EE, (q15_t)0x1F7B, (q15_t)0x83E8, (q15_t)0x1F63, (q15_t)0x83E2, (q15_t)0x1F4A, (q15_t)0x83DC, (q15_t)0x1F32,
+    (q15_t)0x83D6, (q15_t)0x1F19, (q15_t)0x83CF, (q15_t)0x1F01, (q15_t)0x83C9, (q15_t)0x1EE9, (q15_t)0x83C3, (q15_t)0x1ED0,
+    (q15_t)0x83BD, (q15_t)0x1EB8, (q15_t)0x83B7, (q15_t)0x1EA0, (q15_t)0x83B1, (q15_t)0x1E87, (q15_t)0x83AB, (q15_t)0x1E6F,
+    (q15_t)0x83A5, (q15_t)0x1E56, (q15_t)0x839F, (q15_t)0x1E3E, (q15_t)0x8399, (q15_t)0x1E25, (q15_t)0x8393, (q15_t)0x1E0D,
+    (q15_t)0x838E, (q15_t)0x1DF5, (q15_t)0x8388, (q15_t)0x1DDC, (q15_t)0x8382, (q15_t)0x1DC4, (q15_t)0x837C, (q15_t)0x1DAB,
+    (q15_t)0x8376, (q15_t)0x1D93, (q15_t)0x8370, (q15_t)0x1D7A, (q15_t)0x836B, (q15_t)0x1D62, (q15_t)0x8365, (q15_t)0x1D49,
+    (q15_t)0x835F, (q15_t)0x1D31, (q15_t)0x8359, (q15_t)0x1D18, (q15_t)0x8354, (q15_t)0x1D00, (q15_t)0x834E, (q15_t)0x1CE8,
+    (q15_t)0x8348, (q15_t)0x1CCF, (q15_t)0x8343, (q15_t)0x1CB7, (q15_t)0x833D, (q15_t)0x1C9E, (q15_t)0x8337, (q15_t)0x1C86,
+    (q15_t)0x8332, (q15_t)0x1C6D, (q15_t)0x832C, (q15_t)0x1C55, (q15_t)0x8327, (q15_t)0x1C3C, (q15_t)0x8321, (q15_t)0x1C24,
+    (q15_t)0x831C, (q15_t)0x1C0B, (q15_t)0x8316, (q15_t)0x1BF2, (q15_t)0x8311, (q15_t)0x1BDA, (q15_t)0x830B, (q15_t)0x1BC1,
+    (q15_t)0x8306, (q15_t)0x1BA9, (q15_t)0x8300, (q15_t)0x1B90, (q15_t)0x82FB, (q15_t)0x1B78, (q15_t)0x82F6, (q15_t)0x1B5F,
+    (q15_t)0x82F0, (q15_t)0x1B47, (q15_t)0x82EB, (q15_t)0x1B2E, (q15_t)0x82E6, (q15_t)0x1B16, (q15_t)0x82E0, (q15_t)0x1AFD,
+    (q15_t)0x82DB, (q15_t)0x1AE4, (q15_t)0x82D6, (q15_t)0x1ACC, (q15_t)0x82D0, (q15_t)0x1AB3, (q15_t)0x82CB, (q15_t)0x1A9B,
+    (q15_t)0x82C6, (q15_t)0x1A82, (q15_t)0x82C1, (q15_t)0x1A6A, (q15_t)0x82BC, (q15_t)0x1A51, (q15_t)0x82B6, (q15_t)0x1A38,
+    (q15_t)0x82B1, (q15_t)0x1A20, (q15_t)0x82AC, (q15_t)0x1A07, (q15_t)0x82A7, (q15_t)0x19EF, (q15_t)0x82A2, (q15_t)0x19D6,
+    (q15_t)0x829D, (q15_t)0x19BD, (q15_t)0x8298, (q15_t)0x19A5, (q15_t)0x8293, (q15_t)0x198C, (q15_t)0x828E, (q15_t)0x1973,
+    (q15_t)0x8289, (q15_t)0x195B, (q15_t)0x8284, (q15_t)0x1942, (q15_t)0x827F, (q15_t)0x192A, (q15_t)0x827A, (q15_t)0x1911,
+    (q15_t)0x8275, (q15_t)0x18F8, (q15_t)0x8270, (q15_t)0x18E0, (q15_t)0x826B, (q15_t)0x18C7, (q15_t)0x8267, (q15_t)0x18AE,
+    (q15_t)0x8262, (q15_t)0x1896, (q15_t)0x825D, (q15_t)0x187D, (q15_t)0x8258, (q15_t)0x1864, (q15_t)0x8253, (q15_t)0x184C,
+    (q15_t)0x824F, (q15_t)0x1833, (q15_t)0x824A, (q15_t)0x181A, (q15_t)0x8245, (q15_t)0x1802, (q15_t)0x8240, (q15_t)0x17E9,
+    (q15_t)0x823C, (q15_t)0x17D0, (q15_t)0x8237, (q15_t)0x17B7, (q15_t)0x8232, (q15_t)0x179F, (q15_t)0x822E, (q15_t)0x1786,
+    (q15_t)0x8229, (q15_t)0x176D, (q15_t)0x8225, (q15_t)0x1755, (q15_t)0x8220, (q15_t)0x173C, (q15_t)0x821B, (q15_t)0x1723,
+    (q15_t)0x8217, (q15_t)0x170A, (q15_t)0x8212, (q15_t)0x16F2, (q15_t)0x820E, (q15_t)0x16D9, (q15_t)0x8209, (q15_t)0x16C0,
+    (q15_t)0x8205, (q15_t)0x16A8, (q15_t)0x8200, (q15_t)0x168F, (q15_t)0x81FC, (q15_t)0x1676, (q15_t)0x81F8, (q15_t)0x165D,
+    (q15_t)0x81F3, (q15_t)0x1645, (q15_t)0x81EF, (q15_t)0x162C, (q15_t)0x81EB, (q15_t)0x1613, (q15_t)0x81E6, (q15_t)0x15FA,
+    (q15_t)0x81E2, (q15_t)0x15E2, (q15_t)0x81DE, (q15_t)0x15C9, (q15_t)0x81D9, (q15_t)0x15B0, (q15_t)0x81D5, (q15_t)0x1597,
+    (q15_t)0x81D1, (q15_t)0x157F, (q15_t)0x81CD, (q15_t)0x1566, (q15_t)0x81C8, (q15_t)0x154D, (q15_t)0x81C4, (q15_t)0x1534,
+    (q15_t)0x81C0, (q15_t)0x151B, (q15_t)0x81BC, (q15_t)0x1503, (q15_t)0x81B8, (q15_t)0x14EA, (q15_t)0x81B4, (q15_t)0x14D1,
+    (q15_t)0x81B0, (q15_t)0x14B8, (q15_t)0x81AC, (q15_t)0x149F, (q15_t)0x81A8, (q15_t)0x1487, (q15_t)0x81A4, (q15_t)0x146E,
+    (q15_t)0x81A0, (q15_t)0x1455, (q15_t)0x819C, (q15_t)0x143C, (q15_t)0x8198, (q15_t)0x1423, (q15_t)0x8194, (q15_t)0x140B,
+    (q15_t)0x8190, (q15_t)0x13F2, (q15_t)0x818C, (q15_t)0x13D9, (q15_t)0x8188, (q15_t)0x13C0, (q15_t)0x8184, (q15_t)0x13A7,
+    (q15_t)0x8180, (q15_t)0x138E, (q15_t)0x817C, (q15_t)0x1376, (q15_t)0x8179, (q15_t)0x135D, (q15_t)0x8175, (q15_t)0x1344,
+    (q15_t)0x8171, (q15_t)0x132B, (q15_t)0x816D, (q15_t)0x1312, (q15_t)0x816A, (q15_t)0x12F9, (q15_t)0x8166, (q15_t)0x12E0,
+    (q15_t)0x8162, (q15_t)0x12C8, (q15_t)0x815E, (q15_t)0x12AF, (q15_t)0x815B, (q15_t)0x1296, (q15_t)0x8157, (q15_t)0x127D,
+    (q15_t)0x8154, (q15_t)0x1264, (q15_t)0x8150, (q15_t)0x124B, (q15_t)0x814C, (q15_t)0x1232, (q15_t)0x8149, (q15_t)0x1219,
+    (q15_t)0x8145, (q15_t)0x1201, (q15_t)0x8142, (q15_t)0x11E8, (q15_t)0x813E, (q15_t)0x11CF, (q15_t)0x813B, (q15_t)0x11B6,
+    (q15_t)0x8137, (q15_t)0x119D, (q15_t)0x8134, (q15_t)0x1184, (q15_t)0x8130, (q15_t)0x116B, (q15_t)0x812D, (q15_t)0x1152,
+    (q15_t)0x812A, (q15_t)0x1139, (q15_t)0x8126, (q15_t)0x1121, (q15_t)0x8123, (q15_t)0x1108, (q15_t)0x8120, (q15_t)0x10EF,
+    (q15_t)0x811C, (q15_t)0x10D6, (q15_t)0x8119, (q15_t)0x10BD, (q15_t)0x8116, (q15_t)0x10A4, (q15_t)0x8112, (q15_t)0x108B,
+    (q15_t)0x810F, (q15_t)0x1072, (q15_t)0x810C, (q15_t)0x1059, (q15_t)0x8109, (q15_t)0x1040, (q15_t)0x8106, (q15_t)0x1027,
+    (q15_t)0x8102, (q15_t)0x100E, (q15_t)0x80FF, (q15_t)0x0FF5, (q15_t)0x80FC, (q15_t)0x0FDD, (q15_t)0x80F9, (q15_t)0x0FC4,
+    (q15_t)0x80F6, (q15_t)0x0FAB, (q15_t)0x80F3, (q15_t)0x0F92, (q15_t)0x80F0, (q15_t)0x0F79, (q15_t)0x80ED, (q15_t)0x0F60,
+    (q15_t)0x80EA, (q15_t)0x0F47, (q15_t)0x80E7, (q15_t)0x0F2E, (q15_t)0x80E4, (q15_t)0x0F15, (q15_t)0x80E1, (q15_t)0x0EFC,
+    (q15_t)0x80DE, (q15_t)0x0EE3, (q15_t)0x80DB, (q15_t)0x0ECA, (q15_t)0x80D8, (q15_t)0x0EB1, (q15_t)0x80D5, (q15_t)0x0E98,
+    (q15_t)0x80D2, (q15_t)0x0E7F, (q15_t)0x80D0, (q15_t)0x0E66, (q15_t)0x80CD, (q15_t)0x0E4D, (q15_t)0x80CA, (q15_t)0x0E34,
+    (q15_t)0x80C7, (q15_t)0x0E1B, (q15_t)0x80C4, (q15_t)0x0E02, (q15_t)0x80C2, (q15_t)0x0DE9, (q15_t)0x80BF, (q15_t)0x0DD0,
+    (q15_t)0x80BC, (q15_t)0x0DB7, (q15_t)0x80BA, (q15_t)0x0D9E, (q15_t)0x80B7, (q15_t)0x0D85, (q15_t)0x80B4, (q15_t)0x0D6C,
+    (q15_t)0x80B2, (q15_t)0x0D53, (q15_t)0x80AF, (q15_t)0x0D3A, (q15_t)0x80AC, (q15_t)0x0D21, (q15_t)0x80AA, (q15_t)0x0D08,
+    (q15_t)0x80A7, (q15_t)0x0CEF, (q15_t)0x80A5, (q15_t)0x0CD6, (q15_t)0x80A2, (q15_t)0x0CBD, (q15_t)0x80A0, (q15_t)0x0CA4,
+    (q15_t)0x809D, (q15_t)0x0C8B, (q15_t)0x809B, (q15_t)0x0C72, (q15_t)0x8098, (q15_t)0x0C59, (q15_t)0x8096, (q15_t)0x0C40,
+    (q15_t)0x8094, (q15_t)0x0C27, (q15_t)0x8091, (q15_t)0x0C0E, (q15_t)0x808F, (q15_t)0x0BF5, (q15_t)0x808D, (q15_t)0x0BDC,
+    (q15_t)0x808A, (q15_t)0x0BC3, (q15_t)0x8088, (q15_t)0x0BAA, (q15_t)0x8086, (q15_t)0x0B91, (q15_t)0x8083, (q15_t)0x0B78,
+    (q15_t)0x8081, (q15_t)0x0B5F, (q15_t)0x807F, (q15_t)0x0B46, (q15_t)0x807D, (q15_t)0x0B2D, (q15_t)0x807A, (q15_t)0x0B14,
+    (q15_t)0x8078, (q15_t)0x0AFB, (q15_t)0x8076, (q15_t)0x0AE2, (q15_t)0x8074, (q15_t)0x0AC9, (q15_t)0x8072, (q15_t)0x0AB0,
+    (q15_t)0x8070, (q15_t)0x0A97, (q15_t)0x806E, (q15_t)0x0A7E, (q15_t)0x806C, (q15_t)0x0A65, (q15_t)0x806A, (q15_t)0x0A4C,
+    (q15_t)0x8068, (q15_t)0x0A33, (q15_t)0x8066, (q15_t)0x0A19, (q15_t)0x8064, (q15_t)0x0A00, (q15_t)0x8062, (q15_t)0x09E7,
+    (q15_t)0x8060, (q15_t)0x09CE, (q15_t)0x805E, (q15_t)0x09B5, (q15_t)0x805C, (q15_t)0x099C, (q15_t)0x805A, (q15_t)0x0983,
+    (q15_t)0x8058, (q15_t)0x096A, (q15_t)0x8056, (q15_t)0x0951, (q15_t)0x8055, (q15_t)0x0938, (q15_t)0x8053, (q15_t)0x091F,
+    (q15_t)0x8051, (q15_t)0x0906, (q15_t)0x804F, (q15_t)0x08ED, (q15_t)0x804E, (q15_t)0x08D4, (q15_t)0x804C, (q15_t)0x08BB,
+    (q15_t)0x804A, (q15_t)0x08A2, (q15_t)0x8048, (q15_t)0x0888, (q15_t)0x8047, (q15_t)0x086F, (q15_t)0x8045, (q15_t)0x0856,
+    (q15_t)0x8043, (q15_t)0x083D, (q15_t)0x8042, (q15_t)0x0824, (q15_t)0x8040, (q15_t)0x080B, (q15_t)0x803F, (q15_t)0x07F2,
+    (q15_t)0x803D, (q15_t)0x07D9, (q15_t)0x803C, (q15_t)0x07C0, (q15_t)0x803A, (q15_t)0x07A7, (q15_t)0x8039, (q15_t)0x078E,
+    (q15_t)0x8037, (q15_t)0x0775, (q15_t)0x8036, (q15_t)0x075B, (q15_t)0x8034, (q15_t)0x0742, (q15_t)0x8033, (q15_t)0x0729,
+    (q15_t)0x8031, (q15_t)0x0710, (q15_t)0x8030, (q15_t)0x06F7, (q15_t)0x802F, (q15_t)0x06DE, (q15_t)0x802D, (q15_t)0x06C5,
+    (q15_t)0x802C, (q15_t)0x06AC, (q15_t)0x802B, (q15_t)0x0693, (q15_t)0x8029, (q15_t)0x067A, (q15_t)0x8028, (q15_t)0x0660,
+    (q15_t)0x8027, (q15_t)0x0647, (q15_t)0x8026, (q15_t)0x062E, (q15_t)0x8025, (q15_t)0x0615, (q15_t)0x8023, (q15_t)0x05FC,
+    (q15_t)0x8022, (q15_t)0x05E3, (q15_t)0x8021, (q15_t)0x05CA, (q15_t)0x8020, (q15_t)0x05B1, (q15_t)0x801F, (q15_t)0x0598,
+    (q15_t)0x801E, (q15_t)0x057F, (q15_t)0x801D, (q15_t)0x0565, (q15_t)0x801C, (q15_t)0x054C, (q15_t)0x801B, (q15_t)0x0533,
+    (q15_t)0x801A, (q15_t)0x051A, (q15_t)0x8019, (q15_t)0x0501, (q15_t)0x8018, (q15_t)0x04E8, (q15_t)0x8017, (q15_t)0x04CF,
+    (q15_t)0x8016, (q15_t)0x04B6, (q15_t)0x8015, (q15_t)0x049C, (q15_t)0x8014, (q15_t)0x0483, (q15_t)0x8013, (q15_t)0x046A,
+    (q15_t)0x8012, (q15_t)0x0451, (q15_t)0x8011, (q15_t)0x0438, (q15_t)0x8011, (q15_t)0x041F, (q15_t)0x8010, (q15_t)0x0406,
+    (q15_t)0x800F, (q15_t)0x03ED, (q15_t)0x800E, (q15_t)0x03D4, (q15_t)0x800D, (q15_t)0x03BA, (q15_t)0x800D, (q15_t)0x03A1,
+    (q15_t)0x800C, (q15_t)0x0388, (q15_t)0x800B, (q15_t)0x036F, (q15_t)0x800B, (q15_t)0x0356, (q15_t)0x800A, (q15_t)0x033D,
+    (q15_t)0x8009, (q15_t)0x0324, (q15_t)0x8009, (q15_t)0x030B, (q15_t)0x8008, (q15_t)0x02F1, (q15_t)0x8008, (q15_t)0x02D8,
+    (q15_t)0x8007, (q15_t)0x02BF, (q15_t)0x8007, (q15_t)0x02A6, (q15_t)0x8006, (q15_t)0x028D, (q15_t)0x8006, (q15_t)0x0274,
+    (q15_t)0x8005, (q15_t)0x025B, (q15_t)0x8005, (q15_t)0x0242, (q15_t)0x8004, (q15_t)0x0228, (q15_t)0x8004, (q15_t)0x020F,
+    (q15_t)0x8003, (q15_t)0x01F6, (q15_t)0x8003, (q15_t)0x01DD, (q15_t)0x8003, (q15_t)0x01C4, (q15_t)0x8002, (q15_t)0x01AB,
+    (q15_t)0x8002, (q15_t)0x0192, (q15_t)0x8002, (q15_t)0x0178, (q15_t)0x8001, (q15_t)0x015F, (q15_t)0x8001, (q15_t)0x0146,
+    (q15_t)0x8001, (q15_t)0x012D, (q15_t)0x8001, (q15_t)0x0114, (q15_t)0x8000, (q15_t)0x00FB, (q15_t)0x8000, (q15_t)0x00E2,
+    (q15_t)0x8000, (q15_t)0x00C9, (q15_t)0x8000, (q15_t)0x00AF, (q15_t)0x8000, (q15_t)0x0096, (q15_t)0x8000, (q15_t)0x007D,
+    (q15_t)0x8000, (q15_t)0x0064, (q15_t)0x8000, (q15_t)0x004B, (q15_t)0x8000, (q15_t)0x0032, (q15_t)0x8000, (q15_t)0x0019,
+    (q15_t)0x8000, (q15_t)0x0000, (q15_t)0x8000, (q15_t)0xFFE6, (q15_t)0x8000, (q15_t)0xFFCD, (q15_t)0x8000, (q15_t)0xFFB4,
+    (q15_t)0x8000, (q15_t)0xFF9B, (q15_t)0x8000, (q15_t)0xFF82, (q15_t)0x8000, (q15_t)0xFF69, (q15_t)0x8000, (q15_t)0xFF50,
+    (q15_t)0x8000, (q15_t)0xFF36, (q15_t)0x8000, (q15_t)0xFF1D, (q15_t)0x8000, (q15_t)0xFF04, (q15_t)0x8001, (q15_t)0xFEEB,
+    (q15_t)0x8001, (q15_t)0xFED2, (q15_t)0x8001, (q15_t)0xFEB9, (q15_t)0x8001, (q15_t)0xFEA0, (q15_t)0x8002, (q15_t)0xFE87,
+    (q15_t)0x8002, (q15_t)0xFE6D, (q15_t)0x8002, (q15_t)0xFE54, (q15_t)0x8003, (q15_t)0xFE3B, (q15_t)0x8003, (q15_t)0xFE22,
+    (q15_t)0x8003, (q15_t)0xFE09, (q15_t)0x8004, (q15_t)0xFDF0, (q15_t)0x8004, (q15_t)0xFDD7, (q15_t)0x8005, (q15_t)0xFDBD,
+    (q15_t)0x8005, (q15_t)0xFDA4, (q15_t)0x8006, (q15_t)0xFD8B, (q15_t)0x8006, (q15_t)0xFD72, (q15_t)0x8007, (q15_t)0xFD59,
+    (q15_t)0x8007, (q15_t)0xFD40, (q15_t)0x8008, (q15_t)0xFD27, (q15_t)0x8008, (q15_t)0xFD0E, (q15_t)0x8009, (q15_t)0xFCF4,
+    (q15_t)0x8009, (q15_t)0xFCDB, (q15_t)0x800A, (q15_t)0xFCC2, (q15_t)0x800B, (q15_t)0xFCA9, (q15_t)0x800B, (q15_t)0xFC90,
+    (q15_t)0x800C, (q15_t)0xFC77, (q15_t)0x800D, (q15_t)0xFC5E, (q15_t)0x800D, (q15_t)0xFC45, (q15_t)0x800E, (q15_t)0xFC2B,
+    (q15_t)0x800F, (q15_t)0xFC12, (q15_t)0x8010, (q15_t)0xFBF9, (q15_t)0x8011, (q15_t)0xFBE0, (q15_t)0x8011, (q15_t)0xFBC7,
+    (q15_t)0x8012, (q15_t)0xFBAE, (q15_t)0x8013, (q15_t)0xFB95, (q15_t)0x8014, (q15_t)0xFB7C, (q15_t)0x8015, (q15_t)0xFB63,
+    (q15_t)0x8016, (q15_t)0xFB49, (q15_t)0x8017, (q15_t)0xFB30, (q15_t)0x8018, (q15_t)0xFB17, (q15_t)0x8019, (q15_t)0xFAFE,
+    (q15_t)0x801A, (q15_t)0xFAE5, (q15_t)0x801B, (q15_t)0xFACC, (q15_t)0x801C, (q15_t)0xFAB3, (q15_t)0x801D, (q15_t)0xFA9A,
+    (q15_t)0x801E, (q15_t)0xFA80, (q15_t)0x801F, (q15_t)0xFA67, (q15_t)0x8020, (q15_t)0xFA4E, (q15_t)0x8021, (q15_t)0xFA35,
+    (q15_t)0x8022, (q15_t)0xFA1C, (q15_t)0x8023, (q15_t)0xFA03, (q15_t)0x8025, (q15_t)0xF9EA, (q15_t)0x8026, (q15_t)0xF9D1,
+    (q15_t)0x8027, (q15_t)0xF9B8, (q15_t)0x8028, (q15_t)0xF99F, (q15_t)0x8029, (q15_t)0xF985, (q15_t)0x802B, (q15_t)0xF96C,
+    (q15_t)0x802C, (q15_t)0xF953, (q15_t)0x802D, (q15_t)0xF93A, (q15_t)0x802F, (q15_t)0xF921, (q15_t)0x8030, (q15_t)0xF908,
+    (q15_t)0x8031, (q15_t)0xF8EF, (q15_t)0x8033, (q15_t)0xF8D6, (q15_t)0x8034, (q15_t)0xF8BD, (q15_t)0x8036, (q15_t)0xF8A4,
+    (q15_t)0x8037, (q15_t)0xF88A, (q15_t)0x8039, (q15_t)0xF871, (q15_t)0x803A, (q15_t)0xF858, (q15_t)0x803C, (q15_t)0xF83F,
+    (q15_t)0x803D, (q15_t)0xF826, (q15_t)0x803F, (q15_t)0xF80D, (q15_t)0x8040, (q15_t)0xF7F4, (q15_t)0x8042, (q15_t)0xF7DB,
+    (q15_t)0x8043, (q15_t)0xF7C2, (q15_t)0x8045, (q15_t)0xF7A9, (q15_t)0x8047, (q15_t)0xF790, (q15_t)0x8048, (q15_t)0xF777,
+    (q15_t)0x804A, (q15_t)0xF75D, (q15_t)0x804C, (q15_t)0xF744, (q15_t)0x804E, (q15_t)0xF72B, (q15_t)0x804F, (q15_t)0xF712,
+    (q15_t)0x8051, (q15_t)0xF6F9, (q15_t)0x8053, (q15_t)0xF6E0, (q15_t)0x8055, (q15_t)0xF6C7, (q15_t)0x8056, (q15_t)0xF6AE,
+    (q15_t)0x8058, (q15_t)0xF695, (q15_t)0x805A, (q15_t)0xF67C, (q15_t)0x805C, (q15_t)0xF663, (q15_t)0x805E, (q15_t)0xF64A,
+    (q15_t)0x8060, (q15_t)0xF631, (q15_t)0x8062, (q15_t)0xF618, (q15_t)0x8064, (q15_t)0xF5FF, (q15_t)0x8066, (q15_t)0xF5E6,
+    (q15_t)0x8068, (q15_t)0xF5CC, (q15_t)0x806A, (q15_t)0xF5B3, (q15_t)0x806C, (q15_t)0xF59A, (q15_t)0x806E, (q15_t)0xF581,
+    (q15_t)0x8070, (q15_t)0xF568, (q15_t)0x8072, (q15_t)0xF54F, (q15_t)0x8074, (q15_t)0xF536, (q15_t)0x8076, (q15_t)0xF51D,
+    (q15_t)0x8078, (q15_t)0xF504, (q15_t)0x807A, (q15_t)0xF4EB, (q15_t)0x807D, (q15_t)0xF4D2, (q15_t)0x807F, (q15_t)0xF4B9,
+    (q15_t)0x8081, (q15_t)0xF4A0, (q15_t)0x8083, (q15_t)0xF487, (q15_t)0x8086, (q15_t)0xF46E, (q15_t)0x8088, (q15_t)0xF455,
+    (q15_t)0x808A, (q15_t)0xF43C, (q15_t)0x808D, (q15_t)0xF423, (q15_t)0x808F, (q15_t)0xF40A, (q15_t)0x8091, (q15_t)0xF3F1,
+    (q15_t)0x8094, (q15_t)0xF3D8, (q15_t)0x8096, (q15_t)0xF3BF, (q15_t)0x8098, (q15_t)0xF3A6, (q15_t)0x809B, (q15_t)0xF38D,
+    (q15_t)0x809D, (q15_t)0xF374, (q15_t)0x80A0, (q15_t)0xF35B, (q15_t)0x80A2, (q15_t)0xF342, (q15_t)0x80A5, (q15_t)0xF329,
+    (q15_t)0x80A7, (q15_t)0xF310, (q15_t)0x80AA, (q15_t)0xF2F7, (q15_t)0x80AC, (q15_t)0xF2DE, (q15_t)0x80AF, (q15_t)0xF2C5,
+    (q15_t)0x80B2, (q15_t)0xF2AC, (q15_t)0x80B4, (q15_t)0xF293, (q15_t)0x80B7, (q15_t)0xF27A, (q15_t)0x80BA, (q15_t)0xF261,
+    (q15_t)0x80BC, (q15_t)0xF248, (q15_t)0x80BF, (q15_t)0xF22F, (q15_t)0x80C2, (q15_t)0xF216, (q15_t)0x80C4, (q15_t)0xF1FD,
+    (q15_t)0x80C7, (q15_t)0xF1E4, (q15_t)0x80CA, (q15_t)0xF1CB, (q15_t)0x80CD, (q15_t)0xF1B2, (q15_t)0x80D0, (q15_t)0xF199,
+    (q15_t)0x80D2, (q15_t)0xF180, (q15_t)0x80D5, (q15_t)0xF167, (q15_t)0x80D8, (q15_t)0xF14E, (q15_t)0x80DB, (q15_t)0xF135,
+    (q15_t)0x80DE, (q15_t)0xF11C, (q15_t)0x80E1, (q15_t)0xF103, (q15_t)0x80E4, (q15_t)0xF0EA, (q15_t)0x80E7, (q15_t)0xF0D1,
+    (q15_t)0x80EA, (q15_t)0xF0B8, (q15_t)0x80ED, (q15_t)0xF09F, (q15_t)0x80F0, (q15_t)0xF086, (q15_t)0x80F3, (q15_t)0xF06D,
+    (q15_t)0x80F6, (q15_t)0xF054, (q15_t)0x80F9, (q15_t)0xF03B, (q15_t)0x80FC, (q15_t)0xF022, (q15_t)0x80FF, (q15_t)0xF00A,
+    (q15_t)0x8102, (q15_t)0xEFF1, (q15_t)0x8106, (q15_t)0xEFD8, (q15_t)0x8109, (q15_t)0xEFBF, (q15_t)0x810C, (q15_t)0xEFA6,
+    (q15_t)0x810F, (q15_t)0xEF8D, (q15_t)0x8112, (q15_t)0xEF74, (q15_t)0x8116, (q15_t)0xEF5B, (q15_t)0x8119, (q15_t)0xEF42,
+    (q15_t)0x811C, (q15_t)0xEF29, (q15_t)0x8120, (q15_t)0xEF10, (q15_t)0x8123, (q15_t)0xEEF7, (q15_t)0x8126, (q15_t)0xEEDE,
+    (q15_t)0x812A, (q15_t)0xEEC6, (q15_t)0x812D, (q15_t)0xEEAD, (q15_t)0x8130, (q15_t)0xEE94, (q15_t)0x8134, (q15_t)0xEE7B,
+    (q15_t)0x8137, (q15_t)0xEE62, (q15_t)0x813B, (q15_t)0xEE49, (q15_t)0x813E, (q15_t)0xEE30, (q15_t)0x8142, (q15_t)0xEE17,
+    (q15_t)0x8145, (q15_t)0xEDFE, (q15_t)0x8149, (q15_t)0xEDE6, (q15_t)0x814C, (q15_t)0xEDCD, (q15_t)0x8150, (q15_t)0xEDB4,
+    (q15_t)0x8154, (q15_t)0xED9B, (q15_t)0x8157, (q15_t)0xED82, (q15_t)0x815B, (q15_t)0xED69, (q15_t)0x815E, (q15_t)0xED50,
+    (q15_t)0x8162, (q15_t)0xED37, (q15_t)0x8166, (q15_t)0xED1F, (q15_t)0x816A, (q15_t)0xED06, (q15_t)0x816D, (q15_t)0xECED,
+    (q15_t)0x8171, (q15_t)0xECD4, (q15_t)0x8175, (q15_t)0xECBB, (q15_t)0x8179, (q15_t)0xECA2, (q15_t)0x817C, (q15_t)0xEC89,
+    (q15_t)0x8180, (q15_t)0xEC71, (q15_t)0x8184, (q15_t)0xEC58, (q15_t)0x8188, (q15_t)0xEC3F, (q15_t)0x818C, (q15_t)0xEC26,
+    (q15_t)0x8190, (q15_t)0xEC0D, (q15_t)0x8194, (q15_t)0xEBF4, (q15_t)0x8198, (q15_t)0xEBDC, (q15_t)0x819C, (q15_t)0xEBC3,
+    (q15_t)0x81A0, (q15_t)0xEBAA, (q15_t)0x81A4, (q15_t)0xEB91, (q15_t)0x81A8, (q15_t)0xEB78, (q15_t)0x81AC, (q15_t)0xEB60,
+    (q15_t)0x81B0, (q15_t)0xEB47, (q15_t)0x81B4, (q15_t)0xEB2E, (q15_t)0x81B8, (q15_t)0xEB15, (q15_t)0x81BC, (q15_t)0xEAFC,
+    (q15_t)0x81C0, (q15_t)0xEAE4, (q15_t)0x81C4, (q15_t)0xEACB, (q15_t)0x81C8, (q15_t)0xEAB2, (q15_t)0x81CD, (q15_t)0xEA99,
+    (q15_t)0x81D1, (q15_t)0xEA80, (q15_t)0x81D5, (q15_t)0xEA68, (q15_t)0x81D9, (q15_t)0xEA4F, (q15_t)0x81DE, (q15_t)0xEA36,
+    (q15_t)0x81E2, (q15_t)0xEA1D, (q15_t)0x81E6, (q15_t)0xEA05, (q15_t)0x81EB, (q15_t)0xE9EC, (q15_t)0x81EF, (q15_t)0xE9D3,
+    (q15_t)0x81F3, (q15_t)0xE9BA, (q15_t)0x81F8, (q15_t)0xE9A2, (q15_t)0x81FC, (q15_t)0xE989, (q15_t)0x8200, (q15_t)0xE970,
+    (q15_t)0x8205, (q15_t)0xE957, (q15_t)0x8209, (q15_t)0xE93F, (q15_t)0x820E, (q15_t)0xE926, (q15_t)0x8212, (q15_t)0xE90D,
+    (q15_t)0x8217, (q15_t)0xE8F5, (q15_t)0x821B, (q15_t)0xE8DC, (q15_t)0x8220, (q15_t)0xE8C3, (q15_t)0x8225, (q15_t)0xE8AA,
+    (q15_t)0x8229, (q15_t)0xE892, (q15_t)0x822E, (q15_t)0xE879, (q15_t)0x8232, (q15_t)0xE860, (q15_t)0x8237, (q15_t)0xE848,
+    (q15_t)0x823C, (q15_t)0xE82F, (q15_t)0x8240, (q15_t)0xE816, (q15_t)0x8245, (q15_t)0xE7FD, (q15_t)0x824A, (q15_t)0xE7E5,
+    (q15_t)0x824F, (q15_t)0xE7CC, (q15_t)0x8253, (q15_t)0xE7B3, (q15_t)0x8258, (q15_t)0xE79B, (q15_t)0x825D, (q15_t)0xE782,
+    (q15_t)0x8262, (q15_t)0xE769, (q15_t)0x8267, (q15_t)0xE751, (q15_t)0x826B, (q15_t)0xE738, (q15_t)0x8270, (q15_t)0xE71F,
+    (q15_t)0x8275, (q15_t)0xE707, (q15_t)0x827A, (q15_t)0xE6EE, (q15_t)0x827F, (q15_t)0xE6D5, (q15_t)0x8284, (q15_t)0xE6BD,
+    (q15_t)0x8289, (q15_t)0xE6A4, (q15_t)0x828E, (q15_t)0xE68C, (q15_t)0x8293, (q15_t)0xE673, (q15_t)0x8298, (q15_t)0xE65A,
+    (q15_t)0x829D, (q15_t)0xE642, (q15_t)0x82A2, (q15_t)0xE629, (q15_t)0x82A7, (q15_t)0xE610, (q15_t)0x82AC, (q15_t)0xE5F8,
+    (q15_t)0x82B1, (q15_t)0xE5DF, (q15_t)0x82B6, (q15_t)0xE5C7, (q15_t)0x82BC, (q15_t)0xE5AE, (q15_t)0x82C1, (q15_t)0xE595,
+    (q15_t)0x82C6, (q15_t)0xE57D, (q15_t)0x82CB, (q15_t)0xE564, (q15_t)0x82D0, (q15_t)0xE54C, (q15_t)0x82D6, (q15_t)0xE533,
+    (q15_t)0x82DB, (q15_t)0xE51B, (q15_t)0x82E0, (q15_t)0xE502, (q15_t)0x82E6, (q15_t)0xE4E9, (q15_t)0x82EB, (q15_t)0xE4D1,
+    (q15_t)0x82F0, (q15_t)0xE4B8, (q15_t)0x82F6, (q15_t)0xE4A0, (q15_t)0x82FB, (q15_t)0xE487, (q15_t)0x8300, (q15_t)0xE46F,
+    (q15_t)0x8306, (q15_t)0xE456, (q15_t)0x830B, (q15_t)0xE43E, (q15_t)0x8311, (q15_t)0xE425, (q15_t)0x8316, (q15_t)0xE40D,
+    (q15_t)0x831C, (q15_t)0xE3F4, (q15_t)0x8321, (q15_t)0xE3DB, (q15_t)0x8327, (q15_t)0xE3C3, (q15_t)0x832C, (q15_t)0xE3AA,
+    (q15_t)0x8332, (q15_t)0xE392, (q15_t)0x8337, (q15_t)0xE379, (q15_t)0x833D, (q15_t)0xE361, (q15_t)0x8343, (q15_t)0xE348,
+    (q15_t)0x8348, (q15_t)0xE330, (q15_t)0x834E, (q15_t)0xE317, (q15_t)0x8354, (q15_t)0xE2FF, (q15_t)0x8359, (q15_t)0xE2E7,
+    (q15_t)0x835F, (q15_t)0xE2CE, (q15_t)0x8365, (q15_t)0xE2B6, (q15_t)0x836B, (q15_t)0xE29D, (q15_t)0x8370, (q15_t)0xE285,
+    (q15_t)0x8376, (q15_t)0xE26C, (q15_t)0x837C, (q15_t)0xE254, (q15_t)0x8382, (q15_t)0xE23B, (q15_t)0x8388, (q15_t)0xE223,
+    (q15_t)0x838E, (q15_t)0xE20A, (q15_t)0x8393, (q15_t)0xE1F2, (q15_t)0x8399, (q15_t)0xE1DA, (q15_t)0x839F, (q15_t)0xE1C1,
+    (q15_t)0x83A5, (q15_t)0xE1A9, (q15_t)0x83AB, (q15_t)0xE190, (q15_t)0x83B1, (q15_t)0xE178, (q15_t)0x83B7, (q15_t)0xE15F,
+    (q15_t)0x83BD, (q15_t)0xE147, (q15_t)0x83C3, (q15_t)0xE12F, (q15_t)0x83C9, (q15_t)0xE116, (q15_t)0x83CF, (q15_t)0xE0FE,
+    (q15_t)0x83D6, (q15_t)0xE0E6, (q15_t)0x83DC, (q15_t)0xE0CD, (q15_t)0x83E2, (q15_t)0xE0B5, (q15_t)0x83E8, (q15_t)0xE09C,
+    (q15_t)0x83EE, (q15_t)0xE084, (q15_t)0x83F4, (q15_t)0xE06C, (q15_t)0x83FA, (q15_t)0xE053, (q15_t)0x8401, (q15_t)0xE03B,
+    (q15_t)0x8407, (q15_t)0xE023, (q15_t)0x840D, (q15_t)0xE00A, (q15_t)0x8414, (q15_t)0xDFF2, (q15_t)0x841A, (q15_t)0xDFDA,
+    (q15_t)0x8420, (q15_t)0xDFC1, (q15_t)0x8426, (q15_t)0xDFA9, (q15_t)0x842D, (q15_t)0xDF91, (q15_t)0x8433, (q15_t)0xDF78,
+    (q15_t)0x843A, (q15_t)0xDF60, (q15_t)0x8440, (q15_t)0xDF48, (q15_t)0x8446, (q15_t)0xDF2F, (q15_t)0x844D, (q15_t)0xDF17,
+    (q15_t)0x8453, (q15_t)0xDEFF, (q15_t)0x845A, (q15_t)0xDEE7, (q15_t)0x8460, (q15_t)0xDECE, (q15_t)0x8467, (q15_t)0xDEB6,
+    (q15_t)0x846D, (q15_t)0xDE9E, (q15_t)0x8474, (q15_t)0xDE86, (q15_t)0x847B, (q15_t)0xDE6D, (q15_t)0x8481, (q15_t)0xDE55,
+    (q15_t)0x8488, (q15_t)0xDE3D, (q15_t)0x848E, (q15_t)0xDE25, (q15_t)0x8495, (q15_t)0xDE0C, (q15_t)0x849C, (q15_t)0xDDF4,
+    (q15_t)0x84A2, (q15_t)0xDDDC, (q15_t)0x84A9, (q15_t)0xDDC4, (q15_t)0x84B0, (q15_t)0xDDAB, (q15_t)0x84B7, (q15_t)0xDD93,
+    (q15_t)0x84BD, (q15_t)0xDD7B, (q15_t)0x84C4, (q15_t)0xDD63, (q15_t)0x84CB, (q15_t)0xDD4B, (q15_t)0x84D2, (q15_t)0xDD32,
+    (q15_t)0x84D9, (q15_t)0xDD1A, (q15_t)0x84E0, (q15_t)0xDD02, (q15_t)0x84E6, (q15_t)0xDCEA, (q15_t)0x84ED, (q15_t)0xDCD2,
+    (q15_t)0x84F4, (q15_t)0xDCBA, (q15_t)0x84FB, (q15_t)0xDCA1, (q15_t)0x8502, (q15_t)0xDC89, (q15_t)0x8509, (q15_t)0xDC71,
+    (q15_t)0x8510, (q15_t)0xDC59, (q15_t)0x8517, (q15_t)0xDC41, (q15_t)0x851E, (q15_t)0xDC29, (q15_t)0x8525, (q15_t)0xDC11,
+    (q15_t)0x852C, (q15_t)0xDBF8, (q15_t)0x8533, (q15_t)0xDBE0, (q15_t)0x853A, (q15_t)0xDBC8, (q15_t)0x8542, (q15_t)0xDBB0,
+    (q15_t)0x8549, (q15_t)0xDB98, (q15_t)0x8550, (q15_t)0xDB80, (q15_t)0x8557, (q15_t)0xDB68, (q15_t)0x855E, (q15_t)0xDB50,
+    (q15_t)0x8565, (q15_t)0xDB38, (q15_t)0x856D, (q15_t)0xDB20, (q15_t)0x8574, (q15_t)0xDB08, (q15_t)0x857B, (q15_t)0xDAF0,
+    (q15_t)0x8582, (q15_t)0xDAD7, (q15_t)0x858A, (q15_t)0xDABF, (q15_t)0x8591, (q15_t)0xDAA7, (q15_t)0x8598, (q15_t)0xDA8F,
+    (q15_t)0x85A0, (q15_t)0xDA77, (q15_t)0x85A7, (q15_t)0xDA5F, (q15_t)0x85AF, (q15_t)0xDA47, (q15_t)0x85B6, (q15_t)0xDA2F,
+    (q15_t)0x85BD, (q15_t)0xDA17, (q15_t)0x85C5, (q15_t)0xD9FF, (q15_t)0x85CC, (q15_t)0xD9E7, (q15_t)0x85D4, (q15_t)0xD9CF,
+    (q15_t)0x85DB, (q15_t)0xD9B7, (q15_t)0x85E3, (q15_t)0xD99F, (q15_t)0x85EA, (q15_t)0xD987, (q15_t)0x85F2, (q15_t)0xD96F,
+    (q15_t)0x85FA, (q15_t)0xD957, (q15_t)0x8601, (q15_t)0xD93F, (q15_t)0x8609, (q15_t)0xD927, (q15_t)0x8610, (q15_t)0xD910,
+    (q15_t)0x8618, (q15_t)0xD8F8, (q15_t)0x8620, (q15_t)0xD8E0, (q15_t)0x8627, (q15_t)0xD8C8, (q15_t)0x862F, (q15_t)0xD8B0,
+    (q15_t)0x8637, (q15_t)0xD898, (q15_t)0x863F, (q15_t)0xD880, (q15_t)0x8646, (q15_t)0xD868, (q15_t)0x864E, (q15_t)0xD850,
+    (q15_t)0x8656, (q15_t)0xD838, (q15_t)0x865E, (q15_t)0xD820, (q15_t)0x8666, (q15_t)0xD809, (q15_t)0x866D, (q15_t)0xD7F1,
+    (q15_t)0x8675, (q15_t)0xD7D9, (q15_t)0x867D, (q15_t)0xD7C1, (q15_t)0x8685, (q15_t)0xD7A9, (q15_t)0x868D, (q15_t)0xD791,
+    (q15_t)0x8695, (q15_t)0xD779, (q15_t)0x869D, (q15_t)0xD762, (q15_t)0x86A5, (q15_t)0xD74A, (q15_t)0x86AD, (q15_t)0xD732,
+    (q15_t)0x86B5, (q15_t)0xD71A, (q15_t)0x86BD, (q15_t)0xD702, (q15_t)0x86C5, (q15_t)0xD6EA, (q15_t)0x86CD, (q15_t)0xD6D3,
+    (q15_t)0x86D5, (q15_t)0xD6BB, (q15_t)0x86DD, (q15_t)0xD6A3, (q15_t)0x86E6, (q15_t)0xD68B, (q15_t)0x86EE, (q15_t)0xD674,
+    (q15_t)0x86F6, (q15_t)0xD65C, (q15_t)0x86FE, (q15_t)0xD644, (q15_t)0x8706, (q15_t)0xD62C, (q15_t)0x870E, (q15_t)0xD614,
+    (q15_t)0x8717, (q15_t)0xD5FD, (q15_t)0x871F, (q15_t)0xD5E5, (q15_t)0x8727, (q15_t)0xD5CD, (q15_t)0x8730, (q15_t)0xD5B6,
+    (q15_t)0x8738, (q15_t)0xD59E, (q15_t)0x8740, (q15_t)0xD586, (q15_t)0x8749, (q15_t)0xD56E, (q15_t)0x8751, (q15_t)0xD557,
+    (q15_t)0x8759, (q15_t)0xD53F, (q15_t)0x8762, (q15_t)0xD527, (q15_t)0x876A, (q15_t)0xD510, (q15_t)0x8773, (q15_t)0xD4F8,
+    (q15_t)0x877B, (q15_t)0xD4E0, (q15_t)0x8783, (q15_t)0xD4C9, (q15_t)0x878C, (q15_t)0xD4B1, (q15_t)0x8794, (q15_t)0xD499,
+    (q15_t)0x879D, (q15_t)0xD482, (q15_t)0x87A6, (q15_t)0xD46A, (q15_t)0x87AE, (q15_t)0xD452, (q15_t)0x87B7, (q15_t)0xD43B,
+    (q15_t)0x87BF, (q15_t)0xD423, (q15_t)0x87C8, (q15_t)0xD40C, (q15_t)0x87D1, (q15_t)0xD3F4, (q15_t)0x87D9, (q15_t)0xD3DC,
+    (q15_t)0x87E2, (q15_t)0xD3C5, (q15_t)0x87EB, (q15_t)0xD3AD, (q15_t)0x87F3, (q15_t)0xD396, (q15_t)0x87FC, (q15_t)0xD37E,
+    (q15_t)0x8805, (q15_t)0xD367, (q15_t)0x880E, (q15_t)0xD34F, (q15_t)0x8816, (q15_t)0xD337, (q15_t)0x881F, (q15_t)0xD320,
+    (q15_t)0x8828, (q15_t)0xD308, (q15_t)0x8831, (q15_t)0xD2F1, (q15_t)0x883A, (q15_t)0xD2D9, (q15_t)0x8843, (q15_t)0xD2C2,
+    (q15_t)0x884B, (q15_t)0xD2AA, (q15_t)0x8854, (q15_t)0xD293, (q15_t)0x885D, (q15_t)0xD27B, (q15_t)0x8866, (q15_t)0xD264,
+    (q15_t)0x886F, (q15_t)0xD24C, (q15_t)0x8878, (q15_t)0xD235, (q15_t)0x8881, (q15_t)0xD21D, (q15_t)0x888A, (q15_t)0xD206,
+    (q15_t)0x8893, (q15_t)0xD1EE, (q15_t)0x889C, (q15_t)0xD1D7, (q15_t)0x88A5, (q15_t)0xD1C0, (q15_t)0x88AE, (q15_t)0xD1A8,
+    (q15_t)0x88B8, (q15_t)0xD191, (q15_t)0x88C1, (q15_t)0xD179, (q15_t)0x88CA, (q15_t)0xD162, (q15_t)0x88D3, (q15_t)0xD14A,
+    (q15_t)0x88DC, (q15_t)0xD133, (q15_t)0x88E5, (q15_t)0xD11C, (q15_t)0x88EF, (q15_t)0xD104, (q15_t)0x88F8, (q15_t)0xD0ED,
+    (q15_t)0x8901, (q15_t)0xD0D6, (q15_t)0x890A, (q15_t)0xD0BE, (q15_t)0x8914, (q15_t)0xD0A7, (q15_t)0x891D, (q15_t)0xD090,
+    (q15_t)0x8926, (q15_t)0xD078, (q15_t)0x8930, (q15_t)0xD061, (q15_t)0x8939, (q15_t)0xD04A, (q15_t)0x8942, (q15_t)0xD032,
+    (q15_t)0x894C, (q15_t)0xD01B, (q15_t)0x8955, (q15_t)0xD004, (q15_t)0x895F, (q15_t)0xCFEC, (q15_t)0x8968, (q15_t)0xCFD5,
+    (q15_t)0x8971, (q15_t)0xCFBE, (q15_t)0x897B, (q15_t)0xCFA6, (q15_t)0x8984, (q15_t)0xCF8F, (q15_t)0x898E, (q15_t)0xCF78,
+    (q15_t)0x8997, (q15_t)0xCF61, (q15_t)0x89A1, (q15_t)0xCF49, (q15_t)0x89AB, (q15_t)0xCF32, (q15_t)0x89B4, (q15_t)0xCF1B,
+    (q15_t)0x89BE, (q15_t)0xCF04, (q15_t)0x89C7, (q15_t)0xCEED, (q15_t)0x89D1, (q15_t)0xCED5, (q15_t)0x89DB, (q15_t)0xCEBE,
+    (q15_t)0x89E4, (q15_t)0xCEA7, (q15_t)0x89EE, (q15_t)0xCE90, (q15_t)0x89F8, (q15_t)0xCE79, (q15_t)0x8A02, (q15_t)0xCE61,
+    (q15_t)0x8A0B, (q15_t)0xCE4A, (q15_t)0x8A15, (q15_t)0xCE33, (q15_t)0x8A1F, (q15_t)0xCE1C, (q15_t)0x8A29, (q15_t)0xCE05,
+    (q15_t)0x8A33, (q15_t)0xCDEE, (q15_t)0x8A3C, (q15_t)0xCDD7, (q15_t)0x8A46, (q15_t)0xCDBF, (q15_t)0x8A50, (q15_t)0xCDA8,
+    (q15_t)0x8A5A, (q15_t)0xCD91, (q15_t)0x8A64, (q15_t)0xCD7A, (q15_t)0x8A6E, (q15_t)0xCD63, (q15_t)0x8A78, (q15_t)0xCD4C,
+    (q15_t)0x8A82, (q15_t)0xCD35, (q15_t)0x8A8C, (q15_t)0xCD1E, (q15_t)0x8A96, (q15_t)0xCD07, (q15_t)0x8AA0, (q15_t)0xCCF0,
+    (q15_t)0x8AAA, (q15_t)0xCCD9, (q15_t)0x8AB4, (q15_t)0xCCC2, (q15_t)0x8ABE, (q15_t)0xCCAB, (q15_t)0x8AC8, (q15_t)0xCC94,
+    (q15_t)0x8AD2, (q15_t)0xCC7D, (q15_t)0x8ADC, (q15_t)0xCC66, (q15_t)0x8AE6, (q15_t)0xCC4F, (q15_t)0x8AF0, (q15_t)0xCC38,
+    (q15_t)0x8AFB, (q15_t)0xCC21, (q15_t)0x8B05, (q15_t)0xCC0A, (q15_t)0x8B0F, (q15_t)0xCBF3, (q15_t)0x8B19, (q15_t)0xCBDC,
+    (q15_t)0x8B24, (q15_t)0xCBC5, (q15_t)0x8B2E, (q15_t)0xCBAE, (q15_t)0x8B38, (q15_t)0xCB97, (q15_t)0x8B42, (q15_t)0xCB80,
+    (q15_t)0x8B4D, (q15_t)0xCB69, (q15_t)0x8B57, (q15_t)0xCB52, (q15_t)0x8B61, (q15_t)0xCB3B, (q15_t)0x8B6C, (q15_t)0xCB24,
+    (q15_t)0x8B76, (q15_t)0xCB0D, (q15_t)0x8B81, (q15_t)0xCAF7, (q15_t)0x8B8B, (q15_t)0xCAE0, (q15_t)0x8B95, (q15_t)0xCAC9,
+    (q15_t)0x8BA0, (q15_t)0xCAB2, (q15_t)0x8BAA, (q15_t)0xCA9B, (q15_t)0x8BB5, (q15_t)0xCA84, (q15_t)0x8BBF, (q15_t)0xCA6D,
+    (q15_t)0x8BCA, (q15_t)0xCA57, (q15_t)0x8BD4, (q15_t)0xCA40, (q15_t)0x8BDF, (q15_t)0xCA29, (q15_t)0x8BEA, (q15_t)0xCA12,
+    (q15_t)0x8BF4, (q15_t)0xC9FB, (q15_t)0x8BFF, (q15_t)0xC9E5, (q15_t)0x8C09, (q15_t)0xC9CE, (q15_t)0x8C14, (q15_t)0xC9B7,
+    (q15_t)0x8C1F, (q15_t)0xC9A0, (q15_t)0x8C29, (q15_t)0xC98A, (q15_t)0x8C34, (q15_t)0xC973, (q15_t)0x8C3F, (q15_t)0xC95C,
+    (q15_t)0x8C4A, (q15_t)0xC945, (q15_t)0x8C54, (q15_t)0xC92F, (q15_t)0x8C5F, (q15_t)0xC918, (q15_t)0x8C6A, (q15_t)0xC901,
+    (q15_t)0x8C75, (q15_t)0xC8EB, (q15_t)0x8C80, (q15_t)0xC8D4, (q15_t)0x8C8A, (q15_t)0xC8BD, (q15_t)0x8C95, (q15_t)0xC8A7,
+    (q15_t)0x8CA0, (q15_t)0xC890, (q15_t)0x8CAB, (q15_t)0xC879, (q15_t)0x8CB6, (q15_t)0xC863, (q15_t)0x8CC1, (q15_t)0xC84C,
+    (q15_t)0x8CCC, (q15_t)0xC835, (q15_t)0x8CD7, (q15_t)0xC81F, (q15_t)0x8CE2, (q15_t)0xC808, (q15_t)0x8CED, (q15_t)0xC7F2,
+    (q15_t)0x8CF8, (q15_t)0xC7DB, (q15_t)0x8D03, (q15_t)0xC7C4, (q15_t)0x8D0E, (q15_t)0xC7AE, (q15_t)0x8D19, (q15_t)0xC797,
+    (q15_t)0x8D24, (q15_t)0xC781, (q15_t)0x8D2F, (q15_t)0xC76A, (q15_t)0x8D3A, (q15_t)0xC754, (q15_t)0x8D45, (q15_t)0xC73D,
+    (q15_t)0x8D50, (q15_t)0xC727, (q15_t)0x8D5C, (q15_t)0xC710, (q15_t)0x8D67, (q15_t)0xC6F9, (q15_t)0x8D72, (q15_t)0xC6E3,
+    (q15_t)0x8D7D, (q15_t)0xC6CD, (q15_t)0x8D89, (q15_t)0xC6B6, (q15_t)0x8D94, (q15_t)0xC6A0, (q15_t)0x8D9F, (q15_t)0xC689,
+    (q15_t)0x8DAA, (q15_t)0xC673, (q15_t)0x8DB6, (q15_t)0xC65C, (q15_t)0x8DC1, (q15_t)0xC646, (q15_t)0x8DCC, (q15_t)0xC62F,
+    (q15_t)0x8DD8, (q15_t)0xC619, (q15_t)0x8DE3, (q15_t)0xC602, (q15_t)0x8DEE, (q15_t)0xC5EC, (q15_t)0x8DFA, (q15_t)0xC5D6,
+    (q15_t)0x8E05, (q15_t)0xC5BF, (q15_t)0x8E11, (q15_t)0xC5A9, (q15_t)0x8E1C, (q15_t)0xC593, (q15_t)0x8E28, (q15_t)0xC57C,
+    (q15_t)0x8E33, (q15_t)0xC566, (q15_t)0x8E3F, (q15_t)0xC550, (q15_t)0x8E4A, (q15_t)0xC539, (q15_t)0x8E56, (q15_t)0xC523,
+    (q15_t)0x8E61, (q15_t)0xC50D, (q15_t)0x8E6D, (q15_t)0xC4F6, (q15_t)0x8E79, (q15_t)0xC4E0, (q15_t)0x8E84, (q15_t)0xC4CA,
+    (q15_t)0x8E90, (q15_t)0xC4B3, (q15_t)0x8E9B, (q15_t)0xC49D, (q15_t)0x8EA7, (q15_t)0xC487, (q15_t)0x8EB3, (q15_t)0xC471,
+    (q15_t)0x8EBE, (q15_t)0xC45A, (q15_t)0x8ECA, (q15_t)0xC444, (q15_t)0x8ED6, (q15_t)0xC42E, (q15_t)0x8EE2, (q15_t)0xC418,
+    (q15_t)0x8EED, (q15_t)0xC402, (q15_t)0x8EF9, (q15_t)0xC3EB, (q15_t)0x8F05, (q15_t)0xC3D5, (q15_t)0x8F11, (q15_t)0xC3BF,
+    (q15_t)0x8F1D, (q15_t)0xC3A9, (q15_t)0x8F29, (q15_t)0xC393, (q15_t)0x8F34, (q15_t)0xC37C, (q15_t)0x8F40, (q15_t)0xC366,
+    (q15_t)0x8F4C, (q15_t)0xC350, (q15_t)0x8F58, (q15_t)0xC33A, (q15_t)0x8F64, (q15_t)0xC324, (q15_t)0x8F70, (q15_t)0xC30E,
+    (q15_t)0x8F7C, (q15_t)0xC2F8, (q15_t)0x8F88, (q15_t)0xC2E2, (q15_t)0x8F94, (q15_t)0xC2CC, (q15_t)0x8FA0, (q15_t)0xC2B6,
+    (q15_t)0x8FAC, (q15_t)0xC29F, (q15_t)0x8FB8, (q15_t)0xC289, (q15_t)0x8FC4, (q15_t)0xC273, (q15_t)0x8FD0, (q15_t)0xC25D,
+    (q15_t)0x8FDC, (q15_t)0xC247, (q15_t)0x8FE9, (q15_t)0xC231, (q15_t)0x8FF5, (q15_t)0xC21B, (q15_t)0x9001, (q15_t)0xC205,
+    (q15_t)0x900D, (q15_t)0xC1EF, (q15_t)0x9019, (q15_t)0xC1D9, (q15_t)0x9025, (q15_t)0xC1C3, (q15_t)0x9032, (q15_t)0xC1AD,
+    (q15_t)0x903E, (q15_t)0xC197, (q15_t)0x904A, (q15_t)0xC182, (q15_t)0x9056, (q15_t)0xC16C, (q15_t)0x9063, (q15_t)0xC156,
+    (q15_t)0x906F, (q15_t)0xC140, (q15_t)0x907B, (q15_t)0xC12A, (q15_t)0x9088, (q15_t)0xC114, (q15_t)0x9094, (q15_t)0xC0FE,
+    (q15_t)0x90A0, (q15_t)0xC0E8, (q15_t)0x90AD, (q15_t)0xC0D2, (q15_t)0x90B9, (q15_t)0xC0BC, (q15_t)0x90C6, (q15_t)0xC0A7,
+    (q15_t)0x90D2, (q15_t)0xC091, (q15_t)0x90DF, (q15_t)0xC07B, (q15_t)0x90EB, (q15_t)0xC065, (q15_t)0x90F8, (q15_t)0xC04F,
+    (q15_t)0x9104, (q15_t)0xC03A, (q15_t)0x9111, (q15_t)0xC024, (q15_t)0x911D, (q15_t)0xC00E, (q15_t)0x912A, (q15_t)0xBFF8,
+    (q15_t)0x9136, (q15_t)0xBFE2, (q15_t)0x9143, (q15_t)0xBFCD, (q15_t)0x9150, (q15_t)0xBFB7, (q15_t)0x915C, (q15_t)0xBFA1,
+    (q15_t)0x9169, (q15_t)0xBF8C, (q15_t)0x9176, (q15_t)0xBF76, (q15_t)0x9182, (q15_t)0xBF60, (q15_t)0x918F, (q15_t)0xBF4A,
+    (q15_t)0x919C, (q15_t)0xBF35, (q15_t)0x91A8, (q15_t)0xBF1F, (q15_t)0x91B5, (q15_t)0xBF09, (q15_t)0x91C2, (q15_t)0xBEF4,
+    (q15_t)0x91CF, (q15_t)0xBEDE, (q15_t)0x91DB, (q15_t)0xBEC9, (q15_t)0x91E8, (q15_t)0xBEB3, (q15_t)0x91F5, (q15_t)0xBE9D,
+    (q15_t)0x9202, (q15_t)0xBE88, (q15_t)0x920F, (q15_t)0xBE72, (q15_t)0x921C, (q15_t)0xBE5D, (q15_t)0x9229, (q15_t)0xBE47,
+    (q15_t)0x9235, (q15_t)0xBE31, (q15_t)0x9242, (q15_t)0xBE1C, (q15_t)0x924F, (q15_t)0xBE06, (q15_t)0x925C, (q15_t)0xBDF1,
+    (q15_t)0x9269, (q15_t)0xBDDB, (q15_t)0x9276, (q15_t)0xBDC6, (q15_t)0x9283, (q15_t)0xBDB0, (q15_t)0x9290, (q15_t)0xBD9B,
+    (q15_t)0x929D, (q15_t)0xBD85, (q15_t)0x92AA, (q15_t)0xBD70, (q15_t)0x92B7, (q15_t)0xBD5A, (q15_t)0x92C5, (q15_t)0xBD45,
+    (q15_t)0x92D2, (q15_t)0xBD2F, (q15_t)0x92DF, (q15_t)0xBD1A, (q15_t)0x92EC, (q15_t)0xBD05, (q15_t)0x92F9, (q15_t)0xBCEF,
+    (q15_t)0x9306, (q15_t)0xBCDA, (q15_t)0x9313, (q15_t)0xBCC4, (q15_t)0x9321, (q15_t)0xBCAF, (q15_t)0x932E, (q15_t)0xBC9A,
+    (q15_t)0x933B, (q15_t)0xBC84, (q15_t)0x9348, (q15_t)0xBC6F, (q15_t)0x9356, (q15_t)0xBC5A, (q15_t)0x9363, (q15_t)0xBC44,
+    (q15_t)0x9370, (q15_t)0xBC2F, (q15_t)0x937E, (q15_t)0xBC1A, (q15_t)0x938B, (q15_t)0xBC04, (q15_t)0x9398, (q15_t)0xBBEF,
+    (q15_t)0x93A6, (q15_t)0xBBDA, (q15_t)0x93B3, (q15_t)0xBBC4, (q15_t)0x93C0, (q15_t)0xBBAF, (q15_t)0x93CE, (q15_t)0xBB9A,
+    (q15_t)0x93DB, (q15_t)0xBB85, (q15_t)0x93E9, (q15_t)0xBB6F, (q15_t)0x93F6, (q15_t)0xBB5A, (q15_t)0x9404, (q15_t)0xBB45,
+    (q15_t)0x9411, (q15_t)0xBB30, (q15_t)0x941F, (q15_t)0xBB1B, (q15_t)0x942C, (q15_t)0xBB05, (q15_t)0x943A, (q15_t)0xBAF0,
+    (q15_t)0x9447, (q15_t)0xBADB, (q15_t)0x9455, (q15_t)0xBAC6, (q15_t)0x9463, (q15_t)0xBAB1, (q15_t)0x9470, (q15_t)0xBA9C,
+    (q15_t)0x947E, (q15_t)0xBA87, (q15_t)0x948C, (q15_t)0xBA72, (q15_t)0x9499, (q15_t)0xBA5C, (q15_t)0x94A7, (q15_t)0xBA47,
+    (q15_t)0x94B5, (q15_t)0xBA32, (q15_t)0x94C2, (q15_t)0xBA1D, (q15_t)0x94D0, (q15_t)0xBA08, (q15_t)0x94DE, (q15_t)0xB9F3,
+    (q15_t)0x94EC, (q15_t)0xB9DE, (q15_t)0x94F9, (q15_t)0xB9C9, (q15_t)0x9507, (q15_t)0xB9B4, (q15_t)0x9515, (q15_t)0xB99F,
+    (q15_t)0x9523, (q15_t)0xB98A, (q15_t)0x9531, (q15_t)0xB975, (q15_t)0x953E, (q15_t)0xB960, (q15_t)0x954C, (q15_t)0xB94B,
+    (q15_t)0x955A, (q15_t)0xB936, (q15_t)0x9568, (q15_t)0xB921, (q15_t)0x9576, (q15_t)0xB90C, (q15_t)0x9584, (q15_t)0xB8F7,
+    (q15_t)0x9592, (q15_t)0xB8E3, (q15_t)0x95A0, (q15_t)0xB8CE, (q15_t)0x95AE, (q15_t)0xB8B9, (q15_t)0x95BC, (q15_t)0xB8A4,
+    (q15_t)0x95CA, (q15_t)0xB88F, (q15_t)0x95D8, (q15_t)0xB87A, (q15_t)0x95E6, (q15_t)0xB865, (q15_t)0x95F4, (q15_t)0xB851,
+    (q15_t)0x9602, (q15_t)0xB83C, (q15_t)0x9610, (q15_t)0xB827, (q15_t)0x961E, (q15_t)0xB812, (q15_t)0x962C, (q15_t)0xB7FD,
+    (q15_t)0x963B, (q15_t)0xB7E9, (q15_t)0x9649, (q15_t)0xB7D4, (q15_t)0x9657, (q15_t)0xB7BF, (q15_t)0x9665, (q15_t)0xB7AA,
+    (q15_t)0x9673, (q15_t)0xB796, (q15_t)0x9682, (q15_t)0xB781, (q15_t)0x9690, (q15_t)0xB76C, (q15_t)0x969E, (q15_t)0xB757,
+    (q15_t)0x96AC, (q15_t)0xB743, (q15_t)0x96BB, (q15_t)0xB72E, (q15_t)0x96C9, (q15_t)0xB719, (q15_t)0x96D7, (q15_t)0xB705,
+    (q15_t)0x96E6, (q15_t)0xB6F0, (q15_t)0x96F4, (q15_t)0xB6DC, (q15_t)0x9702, (q15_t)0xB6C7, (q15_t)0x9711, (q15_t)0xB6B2,
+    (q15_t)0x971F, (q15_t)0xB69E, (q15_t)0x972E, (q15_t)0xB689, (q15_t)0x973C, (q15_t)0xB675, (q15_t)0x974A, (q15_t)0xB660,
+    (q15_t)0x9759, (q15_t)0xB64B, (q15_t)0x9767, (q15_t)0xB637, (q15_t)0x9776, (q15_t)0xB622, (q15_t)0x9784, (q15_t)0xB60E,
+    (q15_t)0x9793, (q15_t)0xB5F9, (q15_t)0x97A1, (q15_t)0xB5E5, (q15_t)0x97B0, (q15_t)0xB5D0, (q15_t)0x97BF, (q15_t)0xB5BC,
+    (q15_t)0x97CD, (q15_t)0xB5A7, (q15_t)0x97DC, (q15_t)0xB593, (q15_t)0x97EA, (q15_t)0xB57E, (q15_t)0x97F9, (q15_t)0xB56A,
+    (q15_t)0x9808, (q15_t)0xB556, (q15_t)0x9816, (q15_t)0xB541, (q15_t)0x9825, (q15_t)0xB52D, (q15_t)0x9834, (q15_t)0xB518,
+    (q15_t)0x9842, (q15_t)0xB504, (q15_t)0x9851, (q15_t)0xB4F0, (q15_t)0x9860, (q15_t)0xB4DB, (q15_t)0x986F, (q15_t)0xB4C7,
+    (q15_t)0x987D, (q15_t)0xB4B3, (q15_t)0x988C, (q15_t)0xB49E, (q15_t)0x989B, (q15_t)0xB48A, (q15_t)0x98AA, (q15_t)0xB476,
+    (q15_t)0x98B9, (q15_t)0xB461, (q15_t)0x98C8, (q15_t)0xB44D, (q15_t)0x98D6, (q15_t)0xB439, (q15_t)0x98E5, (q15_t)0xB425,
+    (q15_t)0x98F4, (q15_t)0xB410, (q15_t)0x9903, (q15_t)0xB3FC, (q15_t)0x9912, (q15_t)0xB3E8, (q15_t)0x9921, (q15_t)0xB3D4,
+    (q15_t)0x9930, (q15_t)0xB3C0, (q15_t)0x993F, (q15_t)0xB3AB, (q15_t)0x994E, (q15_t)0xB397, (q15_t)0x995D, (q15_t)0xB383,
+    (q15_t)0x996C, (q15_t)0xB36F, (q15_t)0x997B, (q15_t)0xB35B, (q15_t)0x998A, (q15_t)0xB347, (q15_t)0x9999, (q15_t)0xB333,
+    (q15_t)0x99A8, (q15_t)0xB31E, (q15_t)0x99B7, (q15_t)0xB30A, (q15_t)0x99C6, (q15_t)0xB2F6, (q15_t)0x99D6, (q15_t)0xB2E2,
+    (q15_t)0x99E5, (q15_t)0xB2CE, (q15_t)0x99F4, (q15_t)0xB2BA, (q15_t)0x9A03, (q15_t)0xB2A6, (q15_t)0x9A12, (q15_t)0xB292,
+    (q15_t)0x9A22, (q15_t)0xB27E, (q15_t)0x9A31, (q15_t)0xB26A, (q15_t)0x9A40, (q15_t)0xB256, (q15_t)0x9A4F, (q15_t)0xB242,
+    (q15_t)0x9A5F, (q15_t)0xB22E, (q15_t)0x9A6E, (q15_t)0xB21A, (q15_t)0x9A7D, (q15_t)0xB206, (q15_t)0x9A8C, (q15_t)0xB1F2,
+    (q15_t)0x9A9C, (q15_t)0xB1DE, (q15_t)0x9AAB, (q15_t)0xB1CB, (q15_t)0x9ABA, (q15_t)0xB1B7, (q15_t)0x9ACA, (q15_t)0xB1A3,
+    (q15_t)0x9AD9, (q15_t)0xB18F, (q15_t)0x9AE9, (q15_t)0xB17B, (q15_t)0x9AF8, (q15_t)0xB167, (q15_t)0x9B08, (q15_t)0xB153,
+    (q15_t)0x9B17, (q15_t)0xB140, (q15_t)0x9B26, (q15_t)0xB12C, (q15_t)0x9B36, (q15_t)0xB118, (q15_t)0x9B45, (q15_t)0xB104,
+    (q15_t)0x9B55, (q15_t)0xB0F0, (q15_t)0x9B64, (q15_t)0xB0DD, (q15_t)0x9B74, (q15_t)0xB0C9, (q15_t)0x9B84, (q15_t)0xB0B5,
+    (q15_t)0x9B93, (q15_t)0xB0A1, (q15_t)0x9BA3, (q15_t)0xB08E, (q15_t)0x9BB2, (q15_t)0xB07A, (q15_t)0x9BC2, (q15_t)0xB066,
+    (q15_t)0x9BD2, (q15_t)0xB053, (q15_t)0x9BE1, (q15_t)0xB03F, (q15_t)0x9BF1, (q15_t)0xB02B, (q15_t)0x9C01, (q15_t)0xB018,
+    (q15_t)0x9C10, (q15_t)0xB004, (q15_t)0x9C20, (q15_t)0xAFF0, (q15_t)0x9C30, (q15_t)0xAFDD, (q15_t)0x9C3F, (q15_t)0xAFC9,
+    (q15_t)0x9C4F, (q15_t)0xAFB6, (q15_t)0x9C5F, (q15_t)0xAFA2, (q15_t)0x9C6F, (q15_t)0xAF8F, (q15_t)0x9C7F, (q15_t)0xAF7B,
+    (q15_t)0x9C8E, (q15_t)0xAF68, (q15_t)0x9C9E, (q15_t)0xAF54, (q15_t)0x9CAE, (q15_t)0xAF40, (q15_t)0x9CBE, (q15_t)0xAF2D,
+    (q15_t)0x9CCE, (q15_t)0xAF1A, (q15_t)0x9CDE, (q15_t)0xAF06, (q15_t)0x9CEE, (q15_t)0xAEF3, (q15_t)0x9CFE, (q15_t)0xAEDF,
+    (q15_t)0x9D0D, (q15_t)0xAECC, (q15_t)0x9D1D, (q15_t)0xAEB8, (q15_t)0x9D2D, (q15_t)0xAEA5, (q15_t)0x9D3D, (q15_t)0xAE91,
+    (q15_t)0x9D4D, (q15_t)0xAE7E, (q15_t)0x9D5D, (q15_t)0xAE6B, (q15_t)0x9D6D, (q15_t)0xAE57, (q15_t)0x9D7D, (q15_t)0xAE44,
+    (q15_t)0x9D8E, (q15_t)0xAE31, (q15_t)0x9D9E, (q15_t)0xAE1D, (q15_t)0x9DAE, (q15_t)0xAE0A, (q15_t)0x9DBE, (q15_t)0xADF7,
+    (q15_t)0x9DCE, (q15_t)0xADE3, (q15_t)0x9DDE, (q15_t)0xADD0, (q15_t)0x9DEE, (q15_t)0xADBD, (q15_t)0x9DFE, (q15_t)0xADAA,
+    (q15_t)0x9E0E, (q15_t)0xAD96, (q15_t)0x9E1F, (q15_t)0xAD83, (q15_t)0x9E2F, (q15_t)0xAD70, (q15_t)0x9E3F, (q15_t)0xAD5D,
+    (q15_t)0x9E4F, (q15_t)0xAD4A, (q15_t)0x9E60, (q15_t)0xAD36, (q15_t)0x9E70, (q15_t)0xAD23, (q15_t)0x9E80, (q15_t)0xAD10,
+    (q15_t)0x9E90, (q15_t)0xACFD, (q15_t)0x9EA1, (q15_t)0xACEA, (q15_t)0x9EB1, (q15_t)0xACD7, (q15_t)0x9EC1, (q15_t)0xACC4,
+    (q15_t)0x9ED2, (q15_t)0xACB1, (q15_t)0x9EE2, (q15_t)0xAC9D, (q15_t)0x9EF2, (q15_t)0xAC8A, (q15_t)0x9F03, (q15_t)0xAC77,
+    (q15_t)0x9F13, (q15_t)0xAC64, (q15_t)0x9F24, (q15_t)0xAC51, (q15_t)0x9F34, (q15_t)0xAC3E, (q15_t)0x9F45, (q15_t)0xAC2B,
+    (q15_t)0x9F55, (q15_t)0xAC18, (q15_t)0x9F66, (q15_t)0xAC05, (q15_t)0x9F76, (q15_t)0xABF2, (q15_t)0x9F87, (q15_t)0xABDF,
+    (q15_t)0x9F97, (q15_t)0xABCC, (q15_t)0x9FA8, (q15_t)0xABBA, (q15_t)0x9FB8, (q15_t)0xABA7, (q15_t)0x9FC9, (q15_t)0xAB94,
+    (q15_t)0x9FD9, (q15_t)0xAB81, (q15_t)0x9FEA, (q15_t)0xAB6E, (q15_t)0x9FFB, (q15_t)0xAB5B, (q15_t)0xA00B, (q15_t)0xAB48,
+    (q15_t)0xA01C, (q15_t)0xAB35, (q15_t)0xA02C, (q15_t)0xAB23, (q15_t)0xA03D, (q15_t)0xAB10, (q15_t)0xA04E, (q15_t)0xAAFD,
+    (q15_t)0xA05F, (q15_t)0xAAEA, (q15_t)0xA06F, (q15_t)0xAAD7, (q15_t)0xA080, (q15_t)0xAAC5, (q15_t)0xA091, (q15_t)0xAAB2,
+    (q15_t)0xA0A1, (q15_t)0xAA9F, (q15_t)0xA0B2, (q15_t)0xAA8D, (q15_t)0xA0C3, (q15_t)0xAA7A, (q15_t)0xA0D4, (q15_t)0xAA67,
+    (q15_t)0xA0E5, (q15_t)0xAA54, (q15_t)0xA0F5, (q15_t)0xAA42, (q15_t)0xA106, (q15_t)0xAA2F, (q15_t)0xA117, (q15_t)0xAA1C,
+    (q15_t)0xA128, (q15_t)0xAA0A, (q15_t)0xA139, (q15_t)0xA9F7, (q15_t)0xA14A, (q15_t)0xA9E5, (q15_t)0xA15B, (q15_t)0xA9D2,
+    (q15_t)0xA16C, (q15_t)0xA9BF, (q15_t)0xA17D, (q15_t)0xA9AD, (q15_t)0xA18E, (q15_t)0xA99A, (q15_t)0xA19F, (q15_t)0xA988,
+    (q15_t)0xA1AF, (q15_t)0xA975, (q15_t)0xA1C0, (q15_t)0xA963, (q15_t)0xA1D2, (q15_t)0xA950, (q15_t)0xA1E3, (q15_t)0xA93E,
+    (q15_t)0xA1F4, (q15_t)0xA92B, (q15_t)0xA205, (q15_t)0xA919, (q15_t)0xA216, (q15_t)0xA906, (q15_t)0xA227, (q15_t)0xA8F4,
+    (q15_t)0xA238, (q15_t)0xA8E2, (q15_t)0xA249, (q15_t)0xA8CF, (q15_t)0xA25A, (q15_t)0xA8BD, (q15_t)0xA26B, (q15_t)0xA8AA,
+    (q15_t)0xA27C, (q15_t)0xA898, (q15_t)0xA28E, (q15_t)0xA886, (q15_t)0xA29F, (q15_t)0xA873, (q15_t)0xA2B0, (q15_t)0xA861,
+    (q15_t)0xA2C1, (q15_t)0xA84F, (q15_t)0xA2D2, (q15_t)0xA83C, (q15_t)0xA2E4, (q15_t)0xA82A, (q15_t)0xA2F5, (q15_t)0xA818,
+    (q15_t)0xA306, (q15_t)0xA806, (q15_t)0xA317, (q15_t)0xA7F3, (q15_t)0xA329, (q15_t)0xA7E1, (q15_t)0xA33A, (q15_t)0xA7CF,
+    (q15_t)0xA34B, (q15_t)0xA7BD, (q15_t)0xA35D, (q15_t)0xA7AA, (q15_t)0xA36E, (q15_t)0xA798, (q15_t)0xA37F, (q15_t)0xA786,
+    (q15_t)0xA391, (q15_t)0xA774, (q15_t)0xA3A2, (q15_t)0xA762, (q15_t)0xA3B4, (q15_t)0xA750, (q15_t)0xA3C5, (q15_t)0xA73E,
+    (q15_t)0xA3D6, (q15_t)0xA72B, (q15_t)0xA3E8, (q15_t)0xA719, (q15_t)0xA3F9, (q15_t)0xA707, (q15_t)0xA40B, (q15_t)0xA6F5,
+    (q15_t)0xA41C, (q15_t)0xA6E3, (q15_t)0xA42E, (q15_t)0xA6D1, (q15_t)0xA43F, (q15_t)0xA6BF, (q15_t)0xA451, (q15_t)0xA6AD,
+    (q15_t)0xA462, (q15_t)0xA69B, (q15_t)0xA474, (q15_t)0xA689, (q15_t)0xA486, (q15_t)0xA677, (q15_t)0xA497, (q15_t)0xA665,
+    (q15_t)0xA4A9, (q15_t)0xA653, (q15_t)0xA4BA, (q15_t)0xA641, (q15_t)0xA4CC, (q15_t)0xA62F, (q15_t)0xA4DE, (q15_t)0xA61E,
+    (q15_t)0xA4EF, (q15_t)0xA60C, (q15_t)0xA501, (q15_t)0xA5FA, (q15_t)0xA513, (q15_t)0xA5E8, (q15_t)0xA524, (q15_t)0xA5D6,
+    (q15_t)0xA536, (q15_t)0xA5C4, (q15_t)0xA548, (q15_t)0xA5B2, (q15_t)0xA55A, (q15_t)0xA5A1, (q15_t)0xA56B, (q15_t)0xA58F,
+    (q15_t)0xA57D, (q15_t)0xA57D, (q15_t)0xA58F, (q15_t)0xA56B, (q15_t)0xA5A1, (q15_t)0xA55A, (q15_t)0xA5B2, (q15_t)0xA548,
+    (q15_t)0xA5C4, (q15_t)0xA536, (q15_t)0xA5D6, (q15_t)0xA524, (q15_t)0xA5E8, (q15_t)0xA513, (q15_t)0xA5FA, (q15_t)0xA501,
+    (q15_t)0xA60C, (q15_t)0xA4EF, (q15_t)0xA61E, (q15_t)0xA4DE, (q15_t)0xA62F, (q15_t)0xA4CC, (q15_t)0xA641, (q15_t)0xA4BA,
+    (q15_t)0xA653, (q15_t)0xA4A9, (q15_t)0xA665, (q15_t)0xA497, (q15_t)0xA677, (q15_t)0xA486, (q15_t)0xA689, (q15_t)0xA474,
+    (q15_t)0xA69B, (q15_t)0xA462, (q15_t)0xA6AD, (q15_t)0xA451, (q15_t)0xA6BF, (q15_t)0xA43F, (q15_t)0xA6D1, (q15_t)0xA42E,
+    (q15_t)0xA6E3, (q15_t)0xA41C, (q15_t)0xA6F5, (q15_t)0xA40B, (q15_t)0xA707, (q15_t)0xA3F9, (q15_t)0xA719, (q15_t)0xA3E8,
+    (q15_t)0xA72B, (q15_t)0xA3D6, (q15_t)0xA73E, (q15_t)0xA3C5, (q15_t)0xA750, (q15_t)0xA3B4, (q15_t)0xA762, (q15_t)0xA3A2,
+    (q15_t)0xA774, (q15_t)0xA391, (q15_t)0xA786, (q15_t)0xA37F, (q15_t)0xA798, (q15_t)0xA36E, (q15_t)0xA7AA, (q15_t)0xA35D,
+    (q15_t)0xA7BD, (q15_t)0xA34B, (q15_t)0xA7CF, (q15_t)0xA33A, (q15_t)0xA7E1, (q15_t)0xA329, (q15_t)0xA7F3, (q15_t)0xA317,
+    (q15_t)0xA806, (q15_t)0xA306, (q15_t)0xA818, (q15_t)0xA2F5, (q15_t)0xA82A, (q15_t)0xA2E4, (q15_t)0xA83C, (q15_t)0xA2D2,
+    (q15_t)0xA84F, (q15_t)0xA2C1, (q15_t)0xA861, (q15_t)0xA2B0, (q15_t)0xA873, (q15_t)0xA29F, (q15_t)0xA886, (q15_t)0xA28E,
+    (q15_t)0xA898, (q15_t)0xA27C, (q15_t)0xA8AA, (q15_t)0xA26B, (q15_t)0xA8BD, (q15_t)0xA25A, (q15_t)0xA8CF, (q15_t)0xA249,
+    (q15_t)0xA8E2, (q15_t)0xA238, (q15_t)0xA8F4, (q15_t)0xA227, (q15_t)0xA906, (q15_t)0xA216, (q15_t)0xA919, (q15_t)0xA205,
+    (q15_t)0xA92B, (q15_t)0xA1F4, (q15_t)0xA93E, (q15_t)0xA1E3, (q15_t)0xA950, (q15_t)0xA1D2, (q15_t)0xA963, (q15_t)0xA1C0,
+    (q15_t)0xA975, (q15_t)0xA1AF, (q15_t)0xA988, (q15_t)0xA19F, (q15_t)0xA99A, (q15_t)0xA18E, (q15_t)0xA9AD, (q15_t)0xA17D,
+    (q15_t)0xA9BF, (q15_t)0xA16C, (q15_t)0xA9D2, (q15_t)0xA15B, (q15_t)0xA9E5, (q15_t)0xA14A, (q15_t)0xA9F7, (q15_t)0xA139,
+    (q15_t)0xAA0A, (q15_t)0xA128, (q15_t)0xAA1C, (q15_t)0xA117, (q15_t)0xAA2F, (q15_t)0xA106, (q15_t)0xAA42, (q15_t)0xA0F5,
+    (q15_t)0xAA54, (q15_t)0xA0E5, (q15_t)0xAA67, (q15_t)0xA0D4, (q15_t)0xAA7A, (q15_t)0xA0C3, (q15_t)0xAA8D, (q15_t)0xA0B2,
+    (q15_t)0xAA9F, (q15_t)0xA0A1, (q15_t)0xAAB2, (q15_t)0xA091, (q15_t)0xAAC5, (q15_t)0xA080, (q15_t)0xAAD7, (q15_t)0xA06F,
+    (q15_t)0xAAEA, (q15_t)0xA05F, (q15_t)0xAAFD, (q15_t)0xA04E, (q15_t)0xAB10, (q15_t)0xA03D, (q15_t)0xAB23, (q15_t)0xA02C,
+    (q15_t)0xAB35, (q15_t)0xA01C, (q15_t)0xAB48, (q15_t)0xA00B, (q15_t)0xAB5B, (q15_t)0x9FFB, (q15_t)0xAB6E, (q15_t)0x9FEA,
+    (q15_t)0xAB81, (q15_t)0x9FD9, (q15_t)0xAB94, (q15_t)0x9FC9, (q15_t)0xABA7, (q15_t)0x9FB8, (q15_t)0xABBA, (q15_t)0x9FA8,
+    (q15_t)0xABCC, (q15_t)0x9F97, (q15_t)0xABDF, (q15_t)0x9F87, (q15_t)0xABF2, (q15_t)0x9F76, (q15_t)0xAC05, (q15_t)0x9F66,
+    (q15_t)0xAC18, (q15_t)0x9F55, (q15_t)0xAC2B, (q15_t)0x9F45, (q15_t)0xAC3E, (q15_t)0x9F34, (q15_t)0xAC51, (q15_t)0x9F24,
+    (q15_t)0xAC64, (q15_t)0x9F13, (q15_t)0xAC77, (q15_t)0x9F03, (q15_t)0xAC8A, (q15_t)0x9EF2, (q15_t)0xAC9D, (q15_t)0x9EE2,
+    (q15_t)0xACB1, (q15_t)0x9ED2, (q15_t)0xACC4, (q15_t)0x9EC1, (q15_t)0xACD7, (q15_t)0x9EB1, (q15_t)0xACEA, (q15_t)0x9EA1,
+    (q15_t)0xACFD, (q15_t)0x9E90, (q15_t)0xAD10, (q15_t)0x9E80, (q15_t)0xAD23, (q15_t)0x9E70, (q15_t)0xAD36, (q15_t)0x9E60,
+    (q15_t)0xAD4A, (q15_t)0x9E4F, (q15_t)0xAD5D, (q15_t)0x9E3F, (q15_t)0xAD70, (q15_t)0x9E2F, (q15_t)0xAD83, (q15_t)0x9E1F,
+    (q15_t)0xAD96, (q15_t)0x9E0E, (q15_t)0xADAA, (q15_t)0x9DFE, (q15_t)0xADBD, (q15_t)0x9DEE, (q15_t)0xADD0, (q15_t)0x9DDE,
+    (q15_t)0xADE3, (q15_t)0x9DCE, (q15_t)0xADF7, (q15_t)0x9DBE, (q15_t)0xAE0A, (q15_t)0x9DAE, (q15_t)0xAE1D, (q15_t)0x9D9E,
+    (q15_t)0xAE31, (q15_t)0x9D8E, (q15_t)0xAE44, (q15_t)0x9D7D, (q15_t)0xAE57, (q15_t)0x9D6D, (q15_t)0xAE6B, (q15_t)0x9D5D,
+    (q15_t)0xAE7E, (q15_t)0x9D4D, (q15_t)0xAE91, (q15_t)0x9D3D, (q15_t)0xAEA5, (q15_t)0x9D2D, (q15_t)0xAEB8, (q15_t)0x9D1D,
+    (q15_t)0xAECC, (q15_t)0x9D0D, (q15_t)0xAEDF, (q15_t)0x9CFE, (q15_t)0xAEF3, (q15_t)0x9CEE, (q15_t)0xAF06, (q15_t)0x9CDE,
+    (q15_t)0xAF1A, (q15_t)0x9CCE, (q15_t)0xAF2D, (q15_t)0x9CBE, (q15_t)0xAF40, (q15_t)0x9CAE, (q15_t)0xAF54, (q15_t)0x9C9E,
+    (q15_t)0xAF68, (q15_t)0x9C8E, (q15_t)0xAF7B, (q15_t)0x9C7F, (q15_t)0xAF8F, (q15_t)0x9C6F, (q15_t)0xAFA2, (q15_t)0x9C5F,
+    (q15_t)0xAFB6, (q15_t)0x9C4F, (q15_t)0xAFC9, (q15_t)0x9C3F, (q15_t)0xAFDD, (q15_t)0x9C30, (q15_t)0xAFF0, (q15_t)0x9C20,
+    (q15_t)0xB004, (q15_t)0x9C10, (q15_t)0xB018, (q15_t)0x9C01, (q15_t)0xB02B, (q15_t)0x9BF1, (q15_t)0xB03F, (q15_t)0x9BE1,
+    (q15_t)0xB053, (q15_t)0x9BD2, (q15_t)0xB066, (q15_t)0x9BC2, (q15_t)0xB07A, (q15_t)0x9BB2, (q15_t)0xB08E, (q15_t)0x9BA3,
+    (q15_t)0xB0A1, (q15_t)0x9B93, (q15_t)0xB0B5, (q15_t)0x9B84, (q15_t)0xB0C9, (q15_t)0x9B74, (q15_t)0xB0DD, (q15_t)0x9B64,
+    (q15_t)0xB0F0, (q15_t)0x9B55, (q15_t)0xB104, (q15_t)0x9B45, (q15_t)0xB118, (q15_t)0x9B36, (q15_t)0xB12C, (q15_t)0x9B26,
+    (q15_t)0xB140, (q15_t)0x9B17, (q15_t)0xB153, (q15_t)0x9B08, (q15_t)0xB167, (q15_t)0x9AF8, (q15_t)0xB17B, (q15_t)0x9AE9,
+    (q15_t)0xB18F, (q15_t)0x9AD9, (q15_t)0xB1A3, (q15_t)0x9ACA, (q15_t)0xB1B7, (q15_t)0x9ABA, (q15_t)0xB1CB, (q15_t)0x9AAB,
+    (q15_t)0xB1DE, (q15_t)0x9A9C, (q15_t)0xB1F2, (q15_t)0x9A8C, (q15_t)0xB206, (q15_t)0x9A7D, (q15_t)0xB21A, (q15_t)0x9A6E,
+    (q15_t)0xB22E, (q15_t)0x9A5F, (q15_t)0xB242, (q15_t)0x9A4F, (q15_t)0xB256, (q15_t)0x9A40, (q15_t)0xB26A, (q15_t)0x9A31,
+    (q15_t)0xB27E, (q15_t)0x9A22, (q15_t)0xB292, (q15_t)0x9A12, (q15_t)0xB2A6, (q15_t)0x9A03, (q15_t)0xB2BA, (q15_t)0x99F4,
+    (q15_t)0xB2CE, (q15_t)0x99E5, (q15_t)0xB2E2, (q15_t)0x99D6, (q15_t)0xB2F6, (q15_t)0x99C6, (q15_t)0xB30A, (q15_t)0x99B7,
+    (q15_t)0xB31E, (q15_t)0x99A8, (q15_t)0xB333, (q15_t)0x9999, (q15_t)0xB347, (q15_t)0x998A, (q15_t)0xB35B, (q15_t)0x997B,
+    (q15_t)0xB36F, (q15_t)0x996C, (q15_t)0xB383, (q15_t)0x995D, (q15_t)0xB397, (q15_t)0x994E, (q15_t)0xB3AB, (q15_t)0x993F,
+    (q15_t)0xB3C0, (q15_t)0x9930, (q15_t)0xB3D4, (q15_t)0x9921, (q15_t)0xB3E8, (q15_t)0x9912, (q15_t)0xB3FC, (q15_t)0x9903,
+    (q15_t)0xB410, (q15_t)0x98F4, (q15_t)0xB425, (q15_t)0x98E5, (q15_t)0xB439, (q15_t)0x98D6, (q15_t)0xB44D, (q15_t)0x98C8,
+    (q15_t)0xB461, (q15_t)0x98B9, (q15_t)0xB476, (q15_t)0x98AA, (q15_t)0xB48A, (q15_t)0x989B, (q15_t)0xB49E, (q15_t)0x988C,
+    (q15_t)0xB4B3, (q15_t)0x987D, (q15_t)0xB4C7, (q15_t)0x986F, (q15_t)0xB4DB, (q15_t)0x9860, (q15_t)0xB4F0, (q15_t)0x9851,
+    (q15_t)0xB504, (q15_t)0x9842, (q15_t)0xB518, (q15_t)0x9834, (q15_t)0xB52D, (q15_t)0x9825, (q15_t)0xB541, (q15_t)0x9816,
+    (q15_t)0xB556, (q15_t)0x9808, (q15_t)0xB56A, (q15_t)0x97F9, (q15_t)0xB57E, (q15_t)0x97EA, (q15_t)0xB593, (q15_t)0x97DC,
+    (q15_t)0xB5A7, (q15_t)0x97CD, (q15_t)0xB5BC, (q15_t)0x97BF, (q15_t)0xB5D0, (q15_t)0x97B0, (q15_t)0xB5E5, (q15_t)0x97A1,
+    (q15_t)0xB5F9, (q15_t)0x9793, (q15_t)0xB60E, (q15_t)0x9784, (q15_t)0xB622, (q15_t)0x9776, (q15_t)0xB637, (q15_t)0x9767,
+    (q15_t)0xB64B, (q15_t)0x9759, (q15_t)0xB660, (q15_t)0x974A, (q15_t)0xB675, (q15_t)0x973C, (q15_t)0xB689, (q15_t)0x972E,
+    (q15_t)0xB69E, (q15_t)0x971F, (q15_t)0xB6B2, (q15_t)0x9711, (q15_t)0xB6C7, (q15_t)0x9702, (q15_t)0xB6DC, (q15_t)0x96F4,
+    (q15_t)0xB6F0, (q15_t)0x96E6, (q15_t)0xB705, (q15_t)0x96D7, (q15_t)0xB719, (q15_t)0x96C9, (q15_t)0xB72E, (q15_t)0x96BB,
+    (q15_t)0xB743, (q15_t)0x96AC, (q15_t)0xB757, (q15_t)0x969E, (q15_t)0xB76C, (q15_t)0x9690, (q15_t)0xB781, (q15_t)0x9682,
+    (q15_t)0xB796, (q15_t)0x9673, (q15_t)0xB7AA, (q15_t)0x9665, (q15_t)0xB7BF, (q15_t)0x9657, (q15_t)0xB7D4, (q15_t)0x9649,
+    (q15_t)0xB7E9, (q15_t)0x963B, (q15_t)0xB7FD, (q15_t)0x962C, (q15_t)0xB812, (q15_t)0x961E, (q15_t)0xB827, (q15_t)0x9610,
+    (q15_t)0xB83C, (q15_t)0x9602, (q15_t)0xB851, (q15_t)0x95F4, (q15_t)0xB865, (q15_t)0x95E6, (q15_t)0xB87A, (q15_t)0x95D8,
+    (q15_t)0xB88F, (q15_t)0x95CA, (q15_t)0xB8A4, (q15_t)0x95BC, (q15_t)0xB8B9, (q15_t)0x95AE, (q15_t)0xB8CE, (q15_t)0x95A0,
+    (q15_t)0xB8E3, (q15_t)0x9592, (q15_t)0xB8F7, (q15_t)0x9584, (q15_t)0xB90C, (q15_t)0x9576, (q15_t)0xB921, (q15_t)0x9568,
+    (q15_t)0xB936, (q15_t)0x955A, (q15_t)0xB94B, (q15_t)0x954C, (q15_t)0xB960, (q15_t)0x953E, (q15_t)0xB975, (q15_t)0x9531,
+    (q15_t)0xB98A, (q15_t)0x9523, (q15_t)0xB99F, (q15_t)0x9515, (q15_t)0xB9B4, (q15_t)0x9507, (q15_t)0xB9C9, (q15_t)0x94F9,
+    (q15_t)0xB9DE, (q15_t)0x94EC, (q15_t)0xB9F3, (q15_t)0x94DE, (q15_t)0xBA08, (q15_t)0x94D0, (q15_t)0xBA1D, (q15_t)0x94C2,
+    (q15_t)0xBA32, (q15_t)0x94B5, (q15_t)0xBA47, (q15_t)0x94A7, (q15_t)0xBA5C, (q15_t)0x9499, (q15_t)0xBA72, (q15_t)0x948C,
+    (q15_t)0xBA87, (q15_t)0x947E, (q15_t)0xBA9C, (q15_t)0x9470, (q15_t)0xBAB1, (q15_t)0x9463, (q15_t)0xBAC6, (q15_t)0x9455,
+    (q15_t)0xBADB, (q15_t)0x9447, (q15_t)0xBAF0, (q15_t)0x943A, (q15_t)0xBB05, (q15_t)0x942C, (q15_t)0xBB1B, (q15_t)0x941F,
+    (q15_t)0xBB30, (q15_t)0x9411, (q15_t)0xBB45, (q15_t)0x9404, (q15_t)0xBB5A, (q15_t)0x93F6, (q15_t)0xBB6F, (q15_t)0x93E9,
+    (q15_t)0xBB85, (q15_t)0x93DB, (q15_t)0xBB9A, (q15_t)0x93CE, (q15_t)0xBBAF, (q15_t)0x93C0, (q15_t)0xBBC4, (q15_t)0x93B3,
+    (q15_t)0xBBDA, (q15_t)0x93A6, (q15_t)0xBBEF, (q15_t)0x9398, (q15_t)0xBC04, (q15_t)0x938B, (q15_t)0xBC1A, (q15_t)0x937E,
+    (q15_t)0xBC2F, (q15_t)0x9370, (q15_t)0xBC44, (q15_t)0x9363, (q15_t)0xBC5A, (q15_t)0x9356, (q15_t)0xBC6F, (q15_t)0x9348,
+    (q15_t)0xBC84, (q15_t)0x933B, (q15_t)0xBC9A, (q15_t)0x932E, (q15_t)0xBCAF, (q15_t)0x9321, (q15_t)0xBCC4, (q15_t)0x9313,
+    (q15_t)0xBCDA, (q15_t)0x9306, (q15_t)0xBCEF, (q15_t)0x92F9, (q15_t)0xBD05, (q15_t)0x92EC, (q15_t)0xBD1A, (q15_t)0x92DF,
+    (q15_t)0xBD2F, (q15_t)0x92D2, (q15_t)0xBD45, (q15_t)0x92C5, (q15_t)0xBD5A, (q15_t)0x92B7, (q15_t)0xBD70, (q15_t)0x92AA,
+    (q15_t)0xBD85, (q15_t)0x929D, (q15_t)0xBD9B, (q15_t)0x9290, (q15_t)0xBDB0, (q15_t)0x9283, (q15_t)0xBDC6, (q15_t)0x9276,
+    (q15_t)0xBDDB, (q15_t)0x9269, (q15_t)0xBDF1, (q15_t)0x925C, (q15_t)0xBE06, (q15_t)0x924F, (q15_t)0xBE1C, (q15_t)0x9242,
+    (q15_t)0xBE31, (q15_t)0x9235, (q15_t)0xBE47, (q15_t)0x9229, (q15_t)0xBE5D, (q15_t)0x921C, (q15_t)0xBE72, (q15_t)0x920F,
+    (q15_t)0xBE88, (q15_t)0x9202, (q15_t)0xBE9D, (q15_t)0x91F5, (q15_t)0xBEB3, (q15_t)0x91E8, (q15_t)0xBEC9, (q15_t)0x91DB,
+    (q15_t)0xBEDE, (q15_t)0x91CF, (q15_t)0xBEF4, (q15_t)0x91C2, (q15_t)0xBF09, (q15_t)0x91B5, (q15_t)0xBF1F, (q15_t)0x91A8,
+    (q15_t)0xBF35, (q15_t)0x919C, (q15_t)0xBF4A, (q15_t)0x918F, (q15_t)0xBF60, (q15_t)0x9182, (q15_t)0xBF76, (q15_t)0x9176,
+    (q15_t)0xBF8C, (q15_t)0x9169, (q15_t)0xBFA1, (q15_t)0x915C, (q15_t)0xBFB7, (q15_t)0x9150, (q15_t)0xBFCD, (q15_t)0x9143,
+    (q15_t)0xBFE2, (q15_t)0x9136, (q15_t)0xBFF8, (q15_t)0x912A, (q15_t)0xC00E, (q15_t)0x911D, (q15_t)0xC024, (q15_t)0x9111,
+    (q15_t)0xC03A, (q15_t)0x9104, (q15_t)0xC04F, (q15_t)0x90F8, (q15_t)0xC065, (q15_t)0x90EB, (q15_t)0xC07B, (q15_t)0x90DF,
+    (q15_t)0xC091, (q15_t)0x90D2, (q15_t)0xC0A7, (q15_t)0x90C6, (q15_t)0xC0BC, (q15_t)0x90B9, (q15_t)0xC0D2, (q15_t)0x90AD,
+    (q15_t)0xC0E8, (q15_t)0x90A0, (q15_t)0xC0FE, (q15_t)0x9094, (q15_t)0xC114, (q15_t)0x9088, (q15_t)0xC12A, (q15_t)0x907B,
+    (q15_t)0xC140, (q15_t)0x906F, (q15_t)0xC156, (q15_t)0x9063, (q15_t)0xC16C, (q15_t)0x9056, (q15_t)0xC182, (q15_t)0x904A,
+    (q15_t)0xC197, (q15_t)0x903E, (q15_t)0xC1AD, (q15_t)0x9032, (q15_t)0xC1C3, (q15_t)0x9025, (q15_t)0xC1D9, (q15_t)0x9019,
+    (q15_t)0xC1EF, (q15_t)0x900D, (q15_t)0xC205, (q15_t)0x9001, (q15_t)0xC21B, (q15_t)0x8FF5, (q15_t)0xC231, (q15_t)0x8FE9,
+    (q15_t)0xC247, (q15_t)0x8FDC, (q15_t)0xC25D, (q15_t)0x8FD0, (q15_t)0xC273, (q15_t)0x8FC4, (q15_t)0xC289, (q15_t)0x8FB8,
+    (q15_t)0xC29F, (q15_t)0x8FAC, (q15_t)0xC2B6, (q15_t)0x8FA0, (q15_t)0xC2CC, (q15_t)0x8F94, (q15_t)0xC2E2, (q15_t)0x8F88,
+    (q15_t)0xC2F8, (q15_t)0x8F7C, (q15_t)0xC30E, (q15_t)0x8F70, (q15_t)0xC324, (q15_t)0x8F64, (q15_t)0xC33A, (q15_t)0x8F58,
+    (q15_t)0xC350, (q15_t)0x8F4C, (q15_t)0xC366, (q15_t)0x8F40, (q15_t)0xC37C, (q15_t)0x8F34, (q15_t)0xC393, (q15_t)0x8F29,
+    (q15_t)0xC3A9, (q15_t)0x8F1D, (q15_t)0xC3BF, (q15_t)0x8F11, (q15_t)0xC3D5, (q15_t)0x8F05, (q15_t)0xC3EB, (q15_t)0x8EF9,
+    (q15_t)0xC402, (q15_t)0x8EED, (q15_t)0xC418, (q15_t)0x8EE2, (q15_t)0xC42E, (q15_t)0x8ED6, (q15_t)0xC444, (q15_t)0x8ECA,
+    (q15_t)0xC45A, (q15_t)0x8EBE, (q15_t)0xC471, (q15_t)0x8EB3, (q15_t)0xC487, (q15_t)0x8EA7, (q15_t)0xC49D, (q15_t)0x8E9B,
+    (q15_t)0xC4B3, (q15_t)0x8E90, (q15_t)0xC4CA, (q15_t)0x8E84, (q15_t)0xC4E0, (q15_t)0x8E79, (q15_t)0xC4F6, (q15_t)0x8E6D,
+    (q15_t)0xC50D, (q15_t)0x8E61, (q15_t)0xC523, (q15_t)0x8E56, (q15_t)0xC539, (q15_t)0x8E4A, (q15_t)0xC550, (q15_t)0x8E3F,
+    (q15_t)0xC566, (q15_t)0x8E33, (q15_t)0xC57C, (q15_t)0x8E28, (q15_t)0xC593, (q15_t)0x8E1C, (q15_t)0xC5A9, (q15_t)0x8E11,
+    (q15_t)0xC5BF, (q15_t)0x8E05, (q15_t)0xC5D6, (q15_t)0x8DFA, (q15_t)0xC5EC, (q15_t)0x8DEE, (q15_t)0xC602, (q15_t)0x8DE3,
+    (q15_t)0xC619, (q15_t)0x8DD8, (q15_t)0xC62F, (q15_t)0x8DCC, (q15_t)0xC646, (q15_t)0x8DC1, (q15_t)0xC65C, (q15_t)0x8DB6,
+    (q15_t)0xC673, (q15_t)0x8DAA, (q15_t)0xC689, (q15_t)0x8D9F, (q15_t)0xC6A0, (q15_t)0x8D94, (q15_t)0xC6B6, (q15_t)0x8D89,
+    (q15_t)0xC6CD, (q15_t)0x8D7D, (q15_t)0xC6E3, (q15_t)0x8D72, (q15_t)0xC6F9, (q15_t)0x8D67, (q15_t)0xC710, (q15_t)0x8D5C,
+    (q15_t)0xC727, (q15_t)0x8D50, (q15_t)0xC73D, (q15_t)0x8D45, (q15_t)0xC754, (q15_t)0x8D3A, (q15_t)0xC76A, (q15_t)0x8D2F,
+    (q15_t)0xC781, (q15_t)0x8D24, (q15_t)0xC797, (q15_t)0x8D19, (q15_t)0xC7AE, (q15_t)0x8D0E, (q15_t)0xC7C4, (q15_t)0x8D03,
+    (q15_t)0xC7DB, (q15_t)0x8CF8, (q15_t)0xC7F2, (q15_t)0x8CED, (q15_t)0xC808, (q15_t)0x8CE2, (q15_t)0xC81F, (q15_t)0x8CD7,
+    (q15_t)0xC835, (q15_t)0x8CCC, (q15_t)0xC84C, (q15_t)0x8CC1, (q15_t)0xC863, (q15_t)0x8CB6, (q15_t)0xC879, (q15_t)0x8CAB,
+    (q15_t)0xC890, (q15_t)0x8CA0, (q15_t)0xC8A7, (q15_t)0x8C95, (q15_t)0xC8BD, (q15_t)0x8C8A, (q15_t)0xC8D4, (q15_t)0x8C80,
+    (q15_t)0xC8EB, (q15_t)0x8C75, (q15_t)0xC901, (q15_t)0x8C6A, (q15_t)0xC918, (q15_t)0x8C5F, (q15_t)0xC92F, (q15_t)0x8C54,
+    (q15_t)0xC945, (q15_t)0x8C4A, (q15_t)0xC95C, (q15_t)0x8C3F, (q15_t)0xC973, (q15_t)0x8C34, (q15_t)0xC98A, (q15_t)0x8C29,
+    (q15_t)0xC9A0, (q15_t)0x8C1F, (q15_t)0xC9B7, (q15_t)0x8C14, (q15_t)0xC9CE, (q15_t)0x8C09, (q15_t)0xC9E5, (q15_t)0x8BFF,
+    (q15_t)0xC9FB, (q15_t)0x8BF4, (q15_t)0xCA12, (q15_t)0x8BEA, (q15_t)0xCA29, (q15_t)0x8BDF, (q15_t)0xCA40, (q15_t)0x8BD4,
+    (q15_t)0xCA57, (q15_t)0x8BCA, (q15_t)0xCA6D, (q15_t)0x8BBF, (q15_t)0xCA84, (q15_t)0x8BB5, (q15_t)0xCA9B, (q15_t)0x8BAA,
+    (q15_t)0xCAB2, (q15_t)0x8BA0, (q15_t)0xCAC9, (q15_t)0x8B95, (q15_t)0xCAE0, (q15_t)0x8B8B, (q15_t)0xCAF7, (q15_t)0x8B81,
+    (q15_t)0xCB0D, (q15_t)0x8B76, (q15_t)0xCB24, (q15_t)0x8B6C, (q15_t)0xCB3B, (q15_t)0x8B61, (q15_t)0xCB52, (q15_t)0x8B57,
+    (q15_t)0xCB69, (q15_t)0x8B4D, (q15_t)0xCB80, (q15_t)0x8B42, (q15_t)0xCB97, (q15_t)0x8B38, (q15_t)0xCBAE, (q15_t)0x8B2E,
+    (q15_t)0xCBC5, (q15_t)0x8B24, (q15_t)0xCBDC, (q15_t)0x8B19, (q15_t)0xCBF3, (q15_t)0x8B0F, (q15_t)0xCC0A, (q15_t)0x8B05,
+    (q15_t)0xCC21, (q15_t)0x8AFB, (q15_t)0xCC38, (q15_t)0x8AF0, (q15_t)0xCC4F, (q15_t)0x8AE6, (q15_t)0xCC66, (q15_t)0x8ADC,
+    (q15_t)0xCC7D, (q15_t)0x8AD2, (q15_t)0xCC94, (q15_t)0x8AC8, (q15_t)0xCCAB, (q15_t)0x8ABE, (q15_t)0xCCC2, (q15_t)0x8AB4,
+    (q15_t)0xCCD9, (q15_t)0x8AAA, (q15_t)0xCCF0, (q15_t)0x8AA0, (q15_t)0xCD07, (q15_t)0x8A96, (q15_t)0xCD1E, (q15_t)0x8A8C,
+    (q15_t)0xCD35, (q15_t)0x8A82, (q15_t)0xCD4C, (q15_t)0x8A78, (q15_t)0xCD63, (q15_t)0x8A6E, (q15_t)0xCD7A, (q15_t)0x8A64,
+    (q15_t)0xCD91, (q15_t)0x8A5A, (q15_t)0xCDA8, (q15_t)0x8A50, (q15_t)0xCDBF, (q15_t)0x8A46, (q15_t)0xCDD7, (q15_t)0x8A3C,
+    (q15_t)0xCDEE, (q15_t)0x8A33, (q15_t)0xCE05, (q15_t)0x8A29, (q15_t)0xCE1C, (q15_t)0x8A1F, (q15_t)0xCE33, (q15_t)0x8A15,
+    (q15_t)0xCE4A, (q15_t)0x8A0B, (q15_t)0xCE61, (q15_t)0x8A02, (q15_t)0xCE79, (q15_t)0x89F8, (q15_t)0xCE90, (q15_t)0x89EE,
+    (q15_t)0xCEA7, (q15_t)0x89E4, (q15_t)0xCEBE, (q15_t)0x89DB, (q15_t)0xCED5, (q15_t)0x89D1, (q15_t)0xCEED, (q15_t)0x89C7,
+    (q15_t)0xCF04, (q15_t)0x89BE, (q15_t)0xCF1B, (q15_t)0x89B4, (q15_t)0xCF32, (q15_t)0x89AB, (q15_t)0xCF49, (q15_t)0x89A1,
+    (q15_t)0xCF61, (q15_t)0x8997, (q15_t)0xCF78, (q15_t)0x898E, (q15_t)0xCF8F, (q15_t)0x8984, (q15_t)0xCFA6, (q15_t)0x897B,
+    (q15_t)0xCFBE, (q15_t)0x8971, (q15_t)0xCFD5, (q15_t)0x8968, (q15_t)0xCFEC, (q15_t)0x895F, (q15_t)0xD004, (q15_t)0x8955,
+    (q15_t)0xD01B, (q15_t)0x894C, (q15_t)0xD032, (q15_t)0x8942, (q15_t)0xD04A, (q15_t)0x8939, (q15_t)0xD061, (q15_t)0x8930,
+    (q15_t)0xD078, (q15_t)0x8926, (q15_t)0xD090, (q15_t)0x891D, (q15_t)0xD0A7, (q15_t)0x8914, (q15_t)0xD0BE, (q15_t)0x890A,
+    (q15_t)0xD0D6, (q15_t)0x8901, (q15_t)0xD0ED, (q15_t)0x88F8, (q15_t)0xD104, (q15_t)0x88EF, (q15_t)0xD11C, (q15_t)0x88E5,
+    (q15_t)0xD133, (q15_t)0x88DC, (q15_t)0xD14A, (q15_t)0x88D3, (q15_t)0xD162, (q15_t)0x88CA, (q15_t)0xD179, (q15_t)0x88C1,
+    (q15_t)0xD191, (q15_t)0x88B8, (q15_t)0xD1A8, (q15_t)0x88AE, (q15_t)0xD1C0, (q15_t)0x88A5, (q15_t)0xD1D7, (q15_t)0x889C,
+    (q15_t)0xD1EE, (q15_t)0x8893, (q15_t)0xD206, (q15_t)0x888A, (q15_t)0xD21D, (q15_t)0x8881, (q15_t)0xD235, (q15_t)0x8878,
+    (q15_t)0xD24C, (q15_t)0x886F, (q15_t)0xD264, (q15_t)0x8866, (q15_t)0xD27B, (q15_t)0x885D, (q15_t)0xD293, (q15_t)0x8854,
+    (q15_t)0xD2AA, (q15_t)0x884B, (q15_t)0xD2C2, (q15_t)0x8843, (q15_t)0xD2D9, (q15_t)0x883A, (q15_t)0xD2F1, (q15_t)0x8831,
+    (q15_t)0xD308, (q15_t)0x8828, (q15_t)0xD320, (q15_t)0x881F, (q15_t)0xD337, (q15_t)0x8816, (q15_t)0xD34F, (q15_t)0x880E,
+    (q15_t)0xD367, (q15_t)0x8805, (q15_t)0xD37E, (q15_t)0x87FC, (q15_t)0xD396, (q15_t)0x87F3, (q15_t)0xD3AD, (q15_t)0x87EB,
+    (q15_t)0xD3C5, (q15_t)0x87E2, (q15_t)0xD3DC, (q15_t)0x87D9, (q15_t)0xD3F4, (q15_t)0x87D1, (q15_t)0xD40C, (q15_t)0x87C8,
+    (q15_t)0xD423, (q15_t)0x87BF, (q15_t)0xD43B, (q15_t)0x87B7, (q15_t)0xD452, (q15_t)0x87AE, (q15_t)0xD46A, (q15_t)0x87A6,
+    (q15_t)0xD482, (q15_t)0x879D, (q15_t)0xD499, (q15_t)0x8794, (q15_t)0xD4B1, (q15_t)0x878C, (q15_t)0xD4C9, (q15_t)0x8783,
+    (q15_t)0xD4E0, (q15_t)0x877B, (q15_t)0xD4F8, (q15_t)0x8773, (q15_t)0xD510, (q15_t)0x876A, (q15_t)0xD527, (q15_t)0x8762,
+    (q15_t)0xD53F, (q15_t)0x8759, (q15_t)0xD557, (q15_t)0x8751, (q15_t)0xD56E, (q15_t)0x8749, (q15_t)0xD586, (q15_t)0x8740,
+    (q15_t)0xD59E, (q15_t)0x8738, (q15_t)0xD5B6, (q15_t)0x8730, (q15_t)0xD5CD, (q15_t)0x8727, (q15_t)0xD5E5, (q15_t)0x871F,
+    (q15_t)0xD5FD, (q15_t)0x8717, (q15_t)0xD614, (q15_t)0x870E, (q15_t)0xD62C, (q15_t)0x8706, (q15_t)0xD644, (q15_t)0x86FE,
+    (q15_t)0xD65C, (q15_t)0x86F6, (q15_t)0xD674, (q15_t)0x86EE, (q15_t)0xD68B, (q15_t)0x86E6, (q15_t)0xD6A3, (q15_t)0x86DD,
+    (q15_t)0xD6BB, (q15_t)0x86D5, (q15_t)0xD6D3, (q15_t)0x86CD, (q15_t)0xD6EA, (q15_t)0x86C5, (q15_t)0xD702, (q15_t)0x86BD,
+    (q15_t)0xD71A, (q15_t)0x86B5, (q15_t)0xD732, (q15_t)0x86AD, (q15_t)0xD74A, (q15_t)0x86A5, (q15_t)0xD762, (q15_t)0x869D,
+    (q15_t)0xD779, (q15_t)0x8695, (q15_t)0xD791, (q15_t)0x868D, (q15_t)0xD7A9, (q15_t)0x8685, (q15_t)0xD7C1, (q15_t)0x867D,
+    (q15_t)0xD7D9, (q15_t)0x8675, (q15_t)0xD7F1, (q15_t)0x866D, (q15_t)0xD809, (q15_t)0x8666, (q15_t)0xD820, (q15_t)0x865E,
+    (q15_t)0xD838, (q15_t)0x8656, (q15_t)0xD850, (q15_t)0x864E, (q15_t)0xD868, (q15_t)0x8646, (q15_t)0xD880, (q15_t)0x863F,
+    (q15_t)0xD898, (q15_t)0x8637, (q15_t)0xD8B0, (q15_t)0x862F, (q15_t)0xD8C8, (q15_t)0x8627, (q15_t)0xD8E0, (q15_t)0x8620,
+    (q15_t)0xD8F8, (q15_t)0x8618, (q15_t)0xD910, (q15_t)0x8610, (q15_t)0xD927, (q15_t)0x8609, (q15_t)0xD93F, (q15_t)0x8601,
+    (q15_t)0xD957, (q15_t)0x85FA, (q15_t)0xD96F, (q15_t)0x85F2, (q15_t)0xD987, (q15_t)0x85EA, (q15_t)0xD99F, (q15_t)0x85E3,
+    (q15_t)0xD9B7, (q15_t)0x85DB, (q15_t)0xD9CF, (q15_t)0x85D4, (q15_t)0xD9E7, (q15_t)0x85CC, (q15_t)0xD9FF, (q15_t)0x85C5,
+    (q15_t)0xDA17, (q15_t)0x85BD, (q15_t)0xDA2F, (q15_t)0x85B6, (q15_t)0xDA47, (q15_t)0x85AF, (q15_t)0xDA5F, (q15_t)0x85A7,
+    (q15_t)0xDA77, (q15_t)0x85A0, (q15_t)0xDA8F, (q15_t)0x8598, (q15_t)0xDAA7, (q15_t)0x8591, (q15_t)0xDABF, (q15_t)0x858A,
+    (q15_t)0xDAD7, (q15_t)0x8582, (q15_t)0xDAF0, (q15_t)0x857B, (q15_t)0xDB08, (q15_t)0x8574, (q15_t)0xDB20, (q15_t)0x856D,
+    (q15_t)0xDB38, (q15_t)0x8565, (q15_t)0xDB50, (q15_t)0x855E, (q15_t)0xDB68, (q15_t)0x8557, (q15_t)0xDB80, (q15_t)0x8550,
+    (q15_t)0xDB98, (q15_t)0x8549, (q15_t)0xDBB0, (q15_t)0x8542, (q15_t)0xDBC8, (q15_t)0x853A, (q15_t)0xDBE0, (q15_t)0x8533,
+    (q15_t)0xDBF8, (q15_t)0x852C, (q15_t)0xDC11, (q15_t)0x8525, (q15_t)0xDC29, (q15_t)0x851E, (q15_t)0xDC41, (q15_t)0x8517,
+    (q15_t)0xDC59, (q15_t)0x8510, (q15_t)0xDC71, (q15_t)0x8509, (q15_t)0xDC89, (q15_t)0x8502, (q15_t)0xDCA1, (q15_t)0x84FB,
+    (q15_t)0xDCBA, (q15_t)0x84F4, (q15_t)0xDCD2, (q15_t)0x84ED, (q15_t)0xDCEA, (q15_t)0x84E6, (q15_t)0xDD02, (q15_t)0x84E0,
+    (q15_t)0xDD1A, (q15_t)0x84D9, (q15_t)0xDD32, (q15_t)0x84D2, (q15_t)0xDD4B, (q15_t)0x84CB, (q15_t)0xDD63, (q15_t)0x84C4,
+    (q15_t)0xDD7B, (q15_t)0x84BD, (q15_t)0xDD93, (q15_t)0x84B7, (q15_t)0xDDAB, (q15_t)0x84B0, (q15_t)0xDDC4, (q15_t)0x84A9,
+    (q15_t)0xDDDC, (q15_t)0x84A2, (q15_t)0xDDF4, (q15_t)0x849C, (q15_t)0xDE0C, (q15_t)0x8495, (q15_t)0xDE25, (q15_t)0x848E,
+    (q15_t)0xDE3D, (q15_t)0x8488, (q15_t)0xDE55, (q15_t)0x8481, (q15_t)0xDE6D, (q15_t)0x847B, (q15_t)0xDE86, (q15_t)0x8474,
+    (q15_t)0xDE9E, (q15_t)0x846D, (q15_t)0xDEB6, (q15_t)0x8467, (q15_t)0xDECE, (q15_t)0x8460, (q15_t)0xDEE7, (q15_t)0x845A,
+    (q15_t)0xDEFF, (q15_t)0x8453, (q15_t)0xDF17, (q15_t)0x844D, (q15_t)0xDF2F, (q15_t)0x8446, (q15_t)0xDF48, (q15_t)0x8440,
+    (q15_t)0xDF60, (q15_t)0x843A, (q15_t)0xDF78, (q15_t)0x8433, (q15_t)0xDF91, (q15_t)0x842D, (q15_t)0xDFA9, (q15_t)0x8426,
+    (q15_t)0xDFC1, (q15_t)0x8420, (q15_t)0xDFDA, (q15_t)0x841A, (q15_t)0xDFF2, (q15_t)0x8414, (q15_t)0xE00A, (q15_t)0x840D,
+    (q15_t)0xE023, (q15_t)0x8407, (q15_t)0xE03B, (q15_t)0x8401, (q15_t)0xE053, (q15_t)0x83FA, (q15_t)0xE06C, (q15_t)0x83F4,
+    (q15_t)0xE084, (q15_t)0x83EE, (q15_t)0xE09C, (q15_t)0x83E8, (q15_t)0xE0B5, (q15_t)0x83E2, (q15_t)0xE0CD, (q15_t)0x83DC,
+    (q15_t)0xE0E6, (q15_t)0x83D6, (q15_t)0xE0FE, (q15_t)0x83CF, (q15_t)0xE116, (q15_t)0x83C9, (q15_t)0xE12F, (q15_t)0x83C3,
+    (q15_t)0xE147, (q15_t)0x83BD, (q15_t)0xE15F, (q15_t)0x83B7, (q15_t)0xE178, (q15_t)0x83B1, (q15_t)0xE190, (q15_t)0x83AB,
+    (q15_t)0xE1A9, (q15_t)0x83A5, (q15_t)0xE1C1, (q15_t)0x839F, (q15_t)0xE1DA, (q15_t)0x8399, (q15_t)0xE1F2, (q15_t)0x8393,
+    (q15_t)0xE20A, (q15_t)0x838E, (q15_t)0xE223, (q15_t)0x8388, (q15_t)0xE23B, (q15_t)0x8382, (q15_t)0xE254, (q15_t)0x837C,
+    (q15_t)0xE26C, (q15_t)0x8376, (q15_t)0xE285, (q15_t)0x8370, (q15_t)0xE29D, (q15_t)0x836B, (q15_t)0xE2B6, (q15_t)0x8365,
+    (q15_t)0xE2CE, (q15_t)0x835F, (q15_t)0xE2E7, (q15_t)0x8359, (q15_t)0xE2FF, (q15_t)0x8354, (q15_t)0xE317, (q15_t)0x834E,
+    (q15_t)0xE330, (q15_t)0x8348, (q15_t)0xE348, (q15_t)0x8343, (q15_t)0xE361, (q15_t)0x833D, (q15_t)0xE379, (q15_t)0x8337,
+    (q15_t)0xE392, (q15_t)0x8332, (q15_t)0xE3AA, (q15_t)0x832C, (q15_t)0xE3C3, (q15_t)0x8327, (q15_t)0xE3DB, (q15_t)0x8321,
+    (q15_t)0xE3F4, (q15_t)0x831C, (q15_t)0xE40D, (q15_t)0x8316, (q15_t)0xE425, (q15_t)0x8311, (q15_t)0xE43E, (q15_t)0x830B,
+    (q15_t)0xE456, (q15_t)0x8306, (q15_t)0xE46F, (q15_t)0x8300, (q15_t)0xE487, (q15_t)0x82FB, (q15_t)0xE4A0, (q15_t)0x82F6,
+    (q15_t)0xE4B8, (q15_t)0x82F0, (q15_t)0xE4D1, (q15_t)0x82EB, (q15_t)0xE4E9, (q15_t)0x82E6, (q15_t)0xE502, (q15_t)0x82E0,
+    (q15_t)0xE51B, (q15_t)0x82DB, (q15_t)0xE533, (q15_t)0x82D6, (q15_t)0xE54C, (q15_t)0x82D0, (q15_t)0xE564, (q15_t)0x82CB,
+    (q15_t)0xE57D, (q15_t)0x82C6, (q15_t)0xE595, (q15_t)0x82C1, (q15_t)0xE5AE, (q15_t)0x82BC, (q15_t)0xE5C7, (q15_t)0x82B6,
+    (q15_t)0xE5DF, (q15_t)0x82B1, (q15_t)0xE5F8, (q15_t)0x82AC, (q15_t)0xE610, (q15_t)0x82A7, (q15_t)0xE629, (q15_t)0x82A2,
+    (q15_t)0xE642, (q15_t)0x829D, (q15_t)0xE65A, (q15_t)0x8298, (q15_t)0xE673, (q15_t)0x8293, (q15_t)0xE68C, (q15_t)0x828E,
+    (q15_t)0xE6A4, (q15_t)0x8289, (q15_t)0xE6BD, (q15_t)0x8284, (q15_t)0xE6D5, (q15_t)0x827F, (q15_t)0xE6EE, (q15_t)0x827A,
+    (q15_t)0xE707, (q15_t)0x8275, (q15_t)0xE71F, (q15_t)0x8270, (q15_t)0xE738, (q15_t)0x826B, (q15_t)0xE751, (q15_t)0x8267,
+    (q15_t)0xE769, (q15_t)0x8262, (q15_t)0xE782, (q15_t)0x825D, (q15_t)0xE79B, (q15_t)0x8258, (q15_t)0xE7B3, (q15_t)0x8253,
+    (q15_t)0xE7CC, (q15_t)0x824F, (q15_t)0xE7E5, (q15_t)0x824A, (q15_t)0xE7FD, (q15_t)0x8245, (q15_t)0xE816, (q15_t)0x8240,
+    (q15_t)0xE82F, (q15_t)0x823C, (q15_t)0xE848, (q15_t)0x8237, (q15_t)0xE860, (q15_t)0x8232, (q15_t)0xE879, (q15_t)0x822E,
+    (q15_t)0xE892, (q15_t)0x8229, (q15_t)0xE8AA, (q15_t)0x8225, (q15_t)0xE8C3, (q15_t)0x8220, (q15_t)0xE8DC, (q15_t)0x821B,
+    (q15_t)0xE8F5, (q15_t)0x8217, (q15_t)0xE90D, (q15_t)0x8212, (q15_t)0xE926, (q15_t)0x820E, (q15_t)0xE93F, (q15_t)0x8209,
+    (q15_t)0xE957, (q15_t)0x8205, (q15_t)0xE970, (q15_t)0x8200, (q15_t)0xE989, (q15_t)0x81FC, (q15_t)0xE9A2, (q15_t)0x81F8,
+    (q15_t)0xE9BA, (q15_t)0x81F3, (q15_t)0xE9D3, (q15_t)0x81EF, (q15_t)0xE9EC, (q15_t)0x81EB, (q15_t)0xEA05, (q15_t)0x81E6,
+    (q15_t)0xEA1D, (q15_t)0x81E2, (q15_t)0xEA36, (q15_t)0x81DE, (q15_t)0xEA4F, (q15_t)0x81D9, (q15_t)0xEA68, (q15_t)0x81D5,
+    (q15_t)0xEA80, (q15_t)0x81D1, (q15_t)0xEA99, (q15_t)0x81CD, (q15_t)0xEAB2, (q15_t)0x81C8, (q15_t)0xEACB, (q15_t)0x81C4,
+    (q15_t)0xEAE4, (q15_t)0x81C0, (q15_t)0xEAFC, (q15_t)0x81BC, (q15_t)0xEB15, (q15_t)0x81B8, (q15_t)0xEB2E, (q15_t)0x81B4,
+    (q15_t)0xEB47, (q15_t)0x81B0, (q15_t)0xEB60, (q15_t)0x81AC, (q15_t)0xEB78, (q15_t)0x81A8, (q15_t)0xEB91, (q15_t)0x81A4,
+    (q15_t)0xEBAA, (q15_t)0x81A0, (q15_t)0xEBC3, (q15_t)0x819C, (q15_t)0xEBDC, (q15_t)0x8198, (q15_t)0xEBF4, (q15_t)0x8194,
+    (q15_t)0xEC0D, (q15_t)0x8190, (q15_t)0xEC26, (q15_t)0x818C, (q15_t)0xEC3F, (q15_t)0x8188, (q15_t)0xEC58, (q15_t)0x8184,
+    (q15_t)0xEC71, (q15_t)0x8180, (q15_t)0xEC89, (q15_t)0x817C, (q15_t)0xECA2, (q15_t)0x8179, (q15_t)0xECBB, (q15_t)0x8175,
+    (q15_t)0xECD4, (q15_t)0x8171, (q15_t)0xECED, (q15_t)0x816D, (q15_t)0xED06, (q15_t)0x816A, (q15_t)0xED1F, (q15_t)0x8166,
+    (q15_t)0xED37, (q15_t)0x8162, (q15_t)0xED50, (q15_t)0x815E, (q15_t)0xED69, (q15_t)0x815B, (q15_t)0xED82, (q15_t)0x8157,
+    (q15_t)0xED9B, (q15_t)0x8154, (q15_t)0xEDB4, (q15_t)0x8150, (q15_t)0xEDCD, (q15_t)0x814C, (q15_t)0xEDE6, (q15_t)0x8149,
+    (q15_t)0xEDFE, (q15_t)0x8145, (q15_t)0xEE17, (q15_t)0x8142, (q15_t)0xEE30, (q15_t)0x813E, (q15_t)0xEE49, (q15_t)0x813B,
+    (q15_t)0xEE62, (q15_t)0x8137, (q15_t)0xEE7B, (q15_t)0x8134, (q15_t)0xEE94, (q15_t)0x8130, (q15_t)0xEEAD, (q15_t)0x812D,
+    (q15_t)0xEEC6, (q15_t)0x812A, (q15_t)0xEEDE, (q15_t)0x8126, (q15_t)0xEEF7, (q15_t)0x8123, (q15_t)0xEF10, (q15_t)0x8120,
+    (q15_t)0xEF29, (q15_t)0x811C, (q15_t)0xEF42, (q15_t)0x8119, (q15_t)0xEF5B, (q15_t)0x8116, (q15_t)0xEF74, (q15_t)0x8112,
+    (q15_t)0xEF8D, (q15_t)0x810F, (q15_t)0xEFA6, (q15_t)0x810C, (q15_t)0xEFBF, (q15_t)0x8109, (q15_t)0xEFD8, (q15_t)0x8106,
+    (q15_t)0xEFF1, (q15_t)0x8102, (q15_t)0xF00A, (q15_t)0x80FF, (q15_t)0xF022, (q15_t)0x80FC, (q15_t)0xF03B, (q15_t)0x80F9,
+    (q15_t)0xF054, (q15_t)0x80F6, (q15_t)0xF06D, (q15_t)0x80F3, (q15_t)0xF086, (q15_t)0x80F0, (q15_t)0xF09F, (q15_t)0x80ED,
+    (q15_t)0xF0B8, (q15_t)0x80EA, (q15_t)0xF0D1, (q15_t)0x80E7, (q15_t)0xF0EA, (q15_t)0x80E4, (q15_t)0xF103, (q15_t)0x80E1,
+    (q15_t)0xF11C, (q15_t)0x80DE, (q15_t)0xF135, (q15_t)0x80DB, (q15_t)0xF14E, (q15_t)0x80D8, (q15_t)0xF167, (q15_t)0x80D5,
+    (q15_t)0xF180, (q15_t)0x80D2, (q15_t)0xF199, (q15_t)0x80D0, (q15_t)0xF1B2, (q15_t)0x80CD, (q15_t)0xF1CB, (q15_t)0x80CA,
+    (q15_t)0xF1E4, (q15_t)0x80C7, (q15_t)0xF1FD, (q15_t)0x80C4, (q15_t)0xF216, (q15_t)0x80C2, (q15_t)0xF22F, (q15_t)0x80BF,
+    (q15_t)0xF248, (q15_t)0x80BC, (q15_t)0xF261, (q15_t)0x80BA, (q15_t)0xF27A, (q15_t)0x80B7, (q15_t)0xF293, (q15_t)0x80B4,
+    (q15_t)0xF2AC, (q15_t)0x80B2, (q15_t)0xF2C5, (q15_t)0x80AF, (q15_t)0xF2DE, (q15_t)0x80AC, (q15_t)0xF2F7, (q15_t)0x80AA,
+    (q15_t)0xF310, (q15_t)0x80A7, (q15_t)0xF329, (q15_t)0x80A5, (q15_t)0xF342, (q15_t)0x80A2, (q15_t)0xF35B, (q15_t)0x80A0,
+    (q15_t)0xF374, (q15_t)0x809D, (q15_t)0xF38D, (q15_t)0x809B, (q15_t)0xF3A6, (q15_t)0x8098, (q15_t)0xF3BF, (q15_t)0x8096,
+    (q15_t)0xF3D8, (q15_t)0x8094, (q15_t)0xF3F1, (q15_t)0x8091, (q15_t)0xF40A, (q15_t)0x808F, (q15_t)0xF423, (q15_t)0x808D,
+    (q15_t)0xF43C, (q15_t)0x808A, (q15_t)0xF455, (q15_t)0x8088, (q15_t)0xF46E, (q15_t)0x8086, (q15_t)0xF487, (q15_t)0x8083,
+    (q15_t)0xF4A0, (q15_t)0x8081, (q15_t)0xF4B9, (q15_t)0x807F, (q15_t)0xF4D2, (q15_t)0x807D, (q15_t)0xF4EB, (q15_t)0x807A,
+    (q15_t)0xF504, (q15_t)0x8078, (q15_t)0xF51D, (q15_t)0x8076, (q15_t)0xF536, (q15_t)0x8074, (q15_t)0xF54F, (q15_t)0x8072,
+    (q15_t)0xF568, (q15_t)0x8070, (q15_t)0xF581, (q15_t)0x806E, (q15_t)0xF59A, (q15_t)0x806C, (q15_t)0xF5B3, (q15_t)0x806A,
+    (q15_t)0xF5CC, (q15_t)0x8068, (q15_t)0xF5E6, (q15_t)0x8066, (q15_t)0xF5FF, (q15_t)0x8064, (q15_t)0xF618, (q15_t)0x8062,
+    (q15_t)0xF631, (q15_t)0x8060, (q15_t)0xF64A, (q15_t)0x805E, (q15_t)0xF663, (q15_t)0x805C, (q15_t)0xF67C, (q15_t)0x805A,
+    (q15_t)0xF695, (q15_t)0x8058, (q15_t)0xF6AE, (q15_t)0x8056, (q15_t)0xF6C7, (q15_t)0x8055, (q15_t)0xF6E0, (q15_t)0x8053,
+    (q15_t)0xF6F9, (q15_t)0x8051, (q15_t)0xF712, (q15_t)0x804F, (q15_t)0xF72B, (q15_t)0x804E, (q15_t)0xF744, (q15_t)0x804C,
+    (q15_t)0xF75D, (q15_t)0x804A, (q15_t)0xF777, (q15_t)0x8048, (q15_t)0xF790, (q15_t)0x8047, (q15_t)0xF7A9, (q15_t)0x8045,
+    (q15_t)0xF7C2, (q15_t)0x8043, (q15_t)0xF7DB, (q15_t)0x8042, (q15_t)0xF7F4, (q15_t)0x8040, (q15_t)0xF80D, (q15_t)0x803F,
+    (q15_t)0xF826, (q15_t)0x803D, (q15_t)0xF83F, (q15_t)0x803C, (q15_t)0xF858, (q15_t)0x803A, (q15_t)0xF871, (q15_t)0x8039,
+    (q15_t)0xF88A, (q15_t)0x8037, (q15_t)0xF8A4, (q15_t)0x8036, (q15_t)0xF8BD, (q15_t)0x8034, (q15_t)0xF8D6, (q15_t)0x8033,
+    (q15_t)0xF8EF, (q15_t)0x8031, (q15_t)0xF908, (q15_t)0x8030, (q15_t)0xF921, (q15_t)0x802F, (q15_t)0xF93A, (q15_t)0x802D,
+    (q15_t)0xF953, (q15_t)0x802C, (q15_t)0xF96C, (q15_t)0x802B, (q15_t)0xF985, (q15_t)0x8029, (q15_t)0xF99F, (q15_t)0x8028,
+    (q15_t)0xF9B8, (q15_t)0x8027, (q15_t)0xF9D1, (q15_t)0x8026, (q15_t)0xF9EA, (q15_t)0x8025, (q15_t)0xFA03, (q15_t)0x8023,
+    (q15_t)0xFA1C, (q15_t)0x8022, (q15_t)0xFA35, (q15_t)0x8021, (q15_t)0xFA4E, (q15_t)0x8020, (q15_t)0xFA67, (q15_t)0x801F,
+    (q15_t)0xFA80, (q15_t)0x801E, (q15_t)0xFA9A, (q15_t)0x801D, (q15_t)0xFAB3, (q15_t)0x801C, (q15_t)0xFACC, (q15_t)0x801B,
+    (q15_t)0xFAE5, (q15_t)0x801A, (q15_t)0xFAFE, (q15_t)0x8019, (q15_t)0xFB17, (q15_t)0x8018, (q15_t)0xFB30, (q15_t)0x8017,
+    (q15_t)0xFB49, (q15_t)0x8016, (q15_t)0xFB63, (q15_t)0x8015, (q15_t)0xFB7C, (q15_t)0x8014, (q15_t)0xFB95, (q15_t)0x8013,
+    (q15_t)0xFBAE, (q15_t)0x8012, (q15_t)0xFBC7, (q15_t)0x8011, (q15_t)0xFBE0, (q15_t)0x8011, (q15_t)0xFBF9, (q15_t)0x8010,
+    (q15_t)0xFC12, (q15_t)0x800F, (q15_t)0xFC2B, (q15_t)0x800E, (q15_t)0xFC45, (q15_t)0x800D, (q15_t)0xFC5E, (q15_t)0x800D,
+    (q15_t)0xFC77, (q15_t)0x800C, (q15_t)0xFC90, (q15_t)0x800B, (q15_t)0xFCA9, (q15_t)0x800B, (q15_t)0xFCC2, (q15_t)0x800A,
+    (q15_t)0xFCDB, (q15_t)0x8009, (q15_t)0xFCF4, (q15_t)0x8009, (q15_t)0xFD0E, (q15_t)0x8008, (q15_t)0xFD27, (q15_t)0x8008,
+    (q15_t)0xFD40, (q15_t)0x8007, (q15_t)0xFD59, (q15_t)0x8007, (q15_t)0xFD72, (q15_t)0x8006, (q15_t)0xFD8B, (q15_t)0x8006,
+    (q15_t)0xFDA4, (q15_t)0x8005, (q15_t)0xFDBD, (q15_t)0x8005, (q15_t)0xFDD7, (q15_t)0x8004, (q15_t)0xFDF0, (q15_t)0x8004,
+    (q15_t)0xFE09, (q15_t)0x8003, (q15_t)0xFE22, (q15_t)0x8003, (q15_t)0xFE3B, (q15_t)0x8003, (q15_t)0xFE54, (q15_t)0x8002,
+    (q15_t)0xFE6D, (q15_t)0x8002, (q15_t)0xFE87, (q15_t)0x8002, (q15_t)0xFEA0, (q15_t)0x8001, (q15_t)0xFEB9, (q15_t)0x8001,
+    (q15_t)0xFED2, (q15_t)0x8001, (q15_t)0xFEEB, (q15_t)0x8001, (q15_t)0xFF04, (q15_t)0x8000, (q15_t)0xFF1D, (q15_t)0x8000,
+    (q15_t)0xFF36, (q15_t)0x8000, (q15_t)0xFF50, (q15_t)0x8000, (q15_t)0xFF69, (q15_t)0x8000, (q15_t)0xFF82, (q15_t)0x8000,
+    (q15_t)0xFF9B, (q15_t)0x8000, (q15_t)0xFFB4, (q15_t)0x8000, (q15_t)0xFFCD, (q15_t)0x8000, (q15_t)0xFFE6, (q15_t)0x8000
+};
+
+#else /* RFFT_Q15_COMPACT_TWIDDLES */
+
+/* ========================================================================= */
+/* Quarter-Wave Sine Table                                                   */
+/* ========================================================================= */
+
+/*
+ * floor(32768 * sin(2*pi*k/8192)), saturated, for k = 0..2048. All CFFT
+ * twiddles and RFFT split coefficients are derived from it, see
+ * RFFT_TWIDDLE_COS() and RFFT_TWIDDLE_SIN().
+ */
+const q15_t twiddleSinQ15_8192[2049] RFFT_Q15_ALIGN =
+{
+    (q15_t)0x0000, (q15_t)0x0019, (q15_t)0x0032, (q15_t)0x004B, (q15_t)0x0064, (q15_t)0x007D, (q15_t)0x0096, (q15_t)0x00AF,
+    (q15_t)0x00C9, (q15_t)0x00E2, (q15_t)0x00FB, (q15_t)0x0114, (q15_t)0x012D, (q15_t)0x0146, (q15_t)0x015F, (q15_t)0x0178,
+    (q15_t)0x0192, (q15_t)0x01AB, (q15_t)0x01C4, (q15_t)0x01DD, (q15_t)0x01F6, (q15_t)0x020F, (q15_t)0x0228, (q15_t)0x0242,
+    (q15_t)0x025B, (q15_t)0x0274, (q15_t)0x028D, (q15_t)0x02A6, (q15_t)0x02BF, (q15_t)0x02D8, (q15_t)0x02F1, (q15_t)0x030B,
+    (q15_t)0x0324, (q15_t)0x033D, (q15_t)0x0356, (q15_t)0x036F, (q15_t)0x0388, (q15_t)0x03A1, (q15_t)0x03BA, (q15_t)0x03D4,
+    (q15_t)0x03ED, (q15_t)0x0406, (q15_t)0x041F, (q15_t)0x0438, (q15_t)0x0451, (q15_t)0x046A, (q15_t)0x0483, (q15_t)0x049C,
+    (q15_t)0x04B6, (q15_t)0x04CF, (q15_t)0x04E8, (q15_t)0x0501, (q15_t)0x051A, (q15_t)0x0533, (q15_t)0x054C, (q15_t)0x0565,
+    (q15_t)0x057F, (q15_t)0x0598, (q15_t)0x05B1, (q15_t)0x05CA, (q15_t)0x05E3, (q15_t)0x05FC, (q15_t)0x0615, (q15_t)0x062E,
+    (q15_t)0x0647, (q15_t)0x0660, (q15_t)0x067A, (q15_t)0x0693, (q15_t)0x06AC, (q15_t)0x06C5, (q15_t)0x06DE, (q15_t)0x06F7,
+    (q15_t)0x0710, (q15_t)0x0729, (q15_t)0x0742, (q15_t)0x075B, (q15_t)0x0775, (q15_t)0x078E, (q15_t)0x07A7, (q15_t)0x07C0,
+    (q15_t)0x07D9, (q15_t)0x07F2, (q15_t)0x080B, (q15_t)0x0824, (q15_t)0x083D, (q15_t)0x0856, (q15_t)0x086F, (q15_t)0x0888,
+    (q15_t)0x08A2, (q15_t)0x08BB, (q15_t)0x08D4, (q15_t)0x08ED, (q15_t)0x0906, (q15_t)0x091F, (q15_t)0x0938, (q15_t)0x0951,
+    (q15_t)0x096A, (q15_t)0x0983, (q15_t)0x099C, (q15_t)0x09B5, (q15_t)0x09CE, (q15_t)0x09E7, (q15_t)0x0A00, (q15_t)0x0A19,
+    (q15_t)0x0A33, (q15_t)0x0A4C, (q15_t)0x0A65, (q15_t)0x0A7E, (q15_t)0x0A97, (q15_t)0x0AB0, (q15_t)0x0AC9, (q15_t)0x0AE2,
+    (q15_t)0x0AFB, (q15_t)0x0B14, (q15_t)0x0B2D, (q15_t)0x0B46, (q15_t)0x0B5F, (q15_t)0x0B78, (q15_t)0x0B91, (q15_t)0x0BAA,
+    (q15_t)0x0BC3, (q15_t)0x0BDC, (q15_t)0x0BF5, (q15_t)0x0C0E, (q15_t)0x0C27, (q15_t)0x0C40, (q15_t)0x0C59, (q15_t)0x0C72,
+    (q15_t)0x0C8B, (q15_t)0x0CA4, (q15_t)0x0CBD, (q15_t)0x0CD6, (q15_t)0x0CEF, (q15_t)0x0D08, (q15_t)0x0D21, (q15_t)0x0D3A,
+    (q15_t)0x0D53, (q15_t)0x0D6C, (q15_t)0x0D85, (q15_t)0x0D9E, (q15_t)0x0DB7, (q15_t)0x0DD0, (q15_t)0x0DE9, (q15_t)0x0E02,
+    (q15_t)0x0E1B, (q15_t)0x0E34, (q15_t)0x0E4D, (q15_t)0x0E66, (q15_t)0x0E7F, (q15_t)0x0E98, (q15_t)0x0EB1, (q15_t)0x0ECA,
+    (q15_t)0x0EE3, (q15_t)0x0EFC, (q15_t)0x0F15, (q15_t)0x0F2E, (q15_t)0x0F47, (q15_t)0x0F60, (q15_t)0x0F79, (q15_t)0x0F92,
+    (q15_t)0x0FAB, (q15_t)0x0FC4, (q15_t)0x0FDD, (q15_t)0x0FF5, (q15_t)0x100E, (q15_t)0x1027, (q15_t)0x1040, (q15_t)0x1059,
+    (q15_t)0x1072, (q15_t)0x108B, (q15_t)0x10A4, (q15_t)0x10BD, (q15_t)0x10D6, (q15_t)0x10EF, (q15_t)0x1108, (q15_t)0x1121,
+    (q15_t)0x1139, (q15_t)0x1152, (q15_t)0x116B, (q15_t)0x1184, (q15_t)0x119D, (q15_t)0x11B6, (q15_t)0x11CF, (q15_t)0x11E8,
+    (q15_t)0x1201, (q15_t)0x1219, (q15_t)0x1232, (q15_t)0x124B, (q15_t)0x1264, (q15_t)0x127D, (q15_t)0x1296, (q15_t)0x12AF,
+    (q15_t)0x12C8, (q15_t)0x12E0, (q15_t)0x12F9, (q15_t)0x1312, (q15_t)0x132B, (q15_t)0x1344, (q15_t)0x135D, (q15_t)0x1376,
+    (q15_t)0x138E, (q15_t)0x13A7, (q15_t)0x13C0, (q15_t)0x13D9, (q15_t)0x13F2, (q15_t)0x140B, (q15_t)0x1423, (q15_t)0x143C,
+    (q15_t)0x1455, (q15_t)0x146E, (q15_t)0x1487, (q15_t)0x149F, (q15_t)0x14B8, (q15_t)0x14D1, (q15_t)0x14EA, (q15_t)0x1503,
+    (q15_t)0x151B, (q15_t)0x1534, (q15_t)0x154D, (q15_t)0x1566, (q15_t)0x157F, (q15_t)0x1597, (q15_t)0x15B0, (q15_t)0x15C9,
+    (q15_t)0x15E2, (q15_t)0x15FA, (q15_t)0x1613, (q15_t)0x162C, (q15_t)0x1645, (q15_t)0x165D, (q15_t)0x1676, (q15_t)0x168F,
+    (q15_t)0x16A8, (q15_t)0x16C0, (q15_t)0x16D9, (q15_t)0x16F2, (q15_t)0x170A, (q15_t)0x1723, (q15_t)0x173C, (q15_t)0x1755,
+    (q15_t)0x176D, (q15_t)0x1786, (q15_t)0x179F, (q15_t)0x17B7, (q15_t)0x17D0, (q15_t)0x17E9, (q15_t)0x1802, (q15_t)0x181A,
+    (q15_t)0x1833, (q15_t)0x184C, (q15_t)0x1864, (q15_t)0x187D, (q15_t)0x1896, (q15_t)0x18AE, (q15_t)0x18C7, (q15_t)0x18E0,
+    (q15_t)0x18F8, (q15_t)0x1911, (q15_t)0x192A, (q15_t)0x1942, (q15_t)0x195B, (q15_t)0x1973, (q15_t)0x198C, (q15_t)0x19A5,
+    (q15_t)0x19BD, (q15_t)0x19D6, (q15_t)0x19EF, (q15_t)0x1A07, (q15_t)0x1A20, (q15_t)0x1A38, (q15_t)0x1A51, (q15_t)0x1A6A,
+    (q15_t)0x1A82, (q15_t)0x1A9B, (q15_t)0x1AB3, (q15_t)0x1ACC, (q15_t)0x1AE4, (q15_t)0x1AFD, (q15_t)0x1B16, (q15_t)0x1B2E,
+    (q15_t)0x1B47, (q15_t)0x1B5F, (q15_t)0x1B78, (q15_t)0x1B90, (q15_t)0x1BA9, (q15_t)0x1BC1, (q15_t)0x1BDA, (q15_t)0x1BF2,
+    (q15_t)0x1C0B, (q15_t)0x1C24, (q15_t)0x1C3C, (q15_t)0x1C55, (q15_t)0x1C6D, (q15_t)0x1C86, (q15_t)0x1C9E, (q15_t)0x1CB7,
+    (q15_t)0x1CCF, (q15_t)0x1CE8, (q15_t)0x1D00, (q15_t)0x1D18, (q15_t)0x1D31, (q15_t)0x1D49, (q15_t)0x1D62, (q15_t)0x1D7A,
+    (q15_t)0x1D93, (q15_t)0x1DAB, (q15_t)0x1DC4, (q15_t)0x1DDC, (q15_t)0x1DF5, (q15_t)0x1E0D, (q15_t)0x1E25, (q15_t)0x1E3E,
+    (q15_t)0x1E56, (q15_t)0x1E6F, (q15_t)0x1E87, (q15_t)0x1EA0, (q15_t)0x1EB8, (q15_t)0x1ED0, (q15_t)0x1EE9, (q15_t)0x1F01,
+    (q15_t)0x1F19, (q15_t)0x1F32, (q15_t)0x1F4A, (q15_t)0x1F63, (q15_t)0x1F7B, (q15_t)0x1F93, (q15_t)0x1FAC, (q15_t)0x1FC4,
+    (q15_t)0x1FDC, (q15_t)0x1FF5, (q15_t)0x200D, (q15_t)0x2025, (q15_t)0x203E, (q15_t)0x2056, (q15_t)0x206E, (q15_t)0x2087,
+    (q15_t)0x209F, (q15_t)0x20B7, (q15_t)0x20D0, (q15_t)0x20E8, (q15_t)0x2100, (q15_t)0x2118, (q15_t)0x2131, (q15_t)0x2149,
+    (q15_t)0x2161, (q15_t)0x2179, (q15_t)0x2192, (q15_t)0x21AA, (q15_t)0x21C2, (q15_t)0x21DA, (q15_t)0x21F3, (q15_t)0x220B,
+    (q15_t)0x2223, (q15_t)0x223B, (q15_t)0x2254, (q15_t)0x226C, (q15_t)0x2284, (q15_t)0x229C, (q15_t)0x22B4, (q15_t)0x22CD,
+    (q15_t)0x22E5, (q15_t)0x22FD, (q15_t)0x2315, (q15_t)0x232D, (q15_t)0x2345, (q15_t)0x235E, (q15_t)0x2376, (q15_t)0x238E,
+    (q15_t)0x23A6, (q15_t)0x23BE, (q15_t)0x23D6, (q15_t)0x23EE, (q15_t)0x2407, (q15_t)0x241F, (q15_t)0x2437, (q15_t)0x244F,
+    (q15_t)0x2467, (q15_t)0x247F, (q15_t)0x2497, (q15_t)0x24AF, (q15_t)0x24C7, (q15_t)0x24DF, (q15_t)0x24F7, (q15_t)0x250F,
+    (q15_t)0x2528, (q15_t)0x2540, (q15_t)0x2558, (q15_t)0x2570, (q15_t)0x2588, (q15_t)0x25A0, (q15_t)0x25B8, (q15_t)0x25D0,
+    (q15_t)0x25E8, (q15_t)0x2600, (q15_t)0x2618, (q15_t)0x2630, (q15_t)0x2648, (q15_t)0x2660, (q15_t)0x2678, (q15_t)0x2690,
+    (q15_t)0x26A8, (q15_t)0x26C0, (q15_t)0x26D8, (q15_t)0x26EF, (q15_t)0x2707, (q15_t)0x271F, (q15_t)0x2737, (q15_t)0x274F,
+    (q15_t)0x2767, (q15_t)0x277F, (q15_t)0x2797, (q15_t)0x27AF, (q15_t)0x27C7, (q15_t)0x27DF, (q15_t)0x27F6, (q15_t)0x280E,
+    (q15_t)0x2826, (q15_t)0x283E, (q15_t)0x2856, (q15_t)0x286E, (q15_t)0x2886, (q15_t)0x289D, (q15_t)0x28B5, (q15_t)0x28CD,
+    (q15_t)0x28E5, (q15_t)0x28FD, (q15_t)0x2915, (q15_t)0x292C, (q15_t)0x2944, (q15_t)0x295C, (q15_t)0x2974, (q15_t)0x298B,
+    (q15_t)0x29A3, (q15_t)0x29BB, (q15_t)0x29D3, (q15_t)0x29EB, (q15_t)0x2A02, (q15_t)0x2A1A, (q15_t)0x2A32, (q15_t)0x2A49,
+    (q15_t)0x2A61, (q15_t)0x2A79, (q15_t)0x2A91, (q15_t)0x2AA8, (q15_t)0x2AC0, (q15_t)0x2AD8, (q15_t)0x2AEF, (q15_t)0x2B07,
+    (q15_t)0x2B1F, (q15_t)0x2B36, (q15_t)0x2B4E, (q15_t)0x2B66, (q15_t)0x2B7D, (q15_t)0x2B95, (q15_t)0x2BAD, (q15_t)0x2BC4,
+    (q15_t)0x2BDC, (q15_t)0x2BF3, (q15_t)0x2C0B, (q15_t)0x2C23, (q15_t)0x2C3A, (q15_t)0x2C52, (q15_t)0x2C69, (q15_t)0x2C81,
+    (q15_t)0x2C98, (q15_t)0x2CB0, (q15_t)0x2CC8, (q15_t)0x2CDF, (q15_t)0x2CF7, (q15_t)0x2D0E, (q15_t)0x2D26, (q15_t)0x2D3D,
+    (q15_t)0x2D55, (q15_t)0x2D6C, (q15_t)0x2D84, (q15_t)0x2D9B, (q15_t)0x2DB3, (q15_t)0x2DCA, (q15_t)0x2DE2, (q15_t)0x2DF9,
+    (q15_t)0x2E11, (q15_t)0x2E28, (q15_t)0x2E3F, (q15_t)0x2E57, (q15_t)0x2E6E, (q15_t)0x2E86, (q15_t)0x2E9D, (q15_t)0x2EB5,
+    (q15_t)0x2ECC, (q15_t)0x2EE3, (q15_t)0x2EFB, (q15_t)0x2F12, (q15_t)0x2F29, (q15_t)0x2F41, (q15_t)0x2F58, (q15_t)0x2F6F,
+    (q15_t)0x2F87, (q15_t)0x2F9E, (q15_t)0x2FB5, (q15_t)0x2FCD, (q15_t)0x2FE4, (q15_t)0x2FFB, (q15_t)0x3013, (q15_t)0x302A,
+    (q15_t)0x3041, (q15_t)0x3059, (q15_t)0x3070, (q15_t)0x3087, (q15_t)0x309E, (q15_t)0x30B6, (q15_t)0x30CD, (q15_t)0x30E4,
+    (q15_t)0x30FB, (q15_t)0x3112, (q15_t)0x312A, (q15_t)0x3141, (q15_t)0x3158, (q15_t)0x316F, (q15_t)0x3186, (q15_t)0x319E,
+    (q15_t)0x31B5, (q15_t)0x31CC, (q15_t)0x31E3, (q15_t)0x31FA, (q15_t)0x3211, (q15_t)0x3228, (q15_t)0x3240, (q15_t)0x3257,
+    (q15_t)0x326E, (q15_t)0x3285, (q15_t)0x329C, (q15_t)0x32B3, (q15_t)0x32CA, (q15_t)0x32E1, (q15_t)0x32F8, (q15_t)0x330F,
+    (q15_t)0x3326, (q15_t)0x333D, (q15_t)0x3354, (q15_t)0x336B, (q15_t)0x3382, (q15_t)0x3399, (q15_t)0x33B0, (q15_t)0x33C7,
+    (q15_t)0x33DE, (q15_t)0x33F5, (q15_t)0x340C, (q15_t)0x3423, (q15_t)0x343A, (q15_t)0x3451, (q15_t)0x3468, (q15_t)0x347F,
+    (q15_t)0x3496, (q15_t)0x34AD, (q15_t)0x34C4, (q15_t)0x34DB, (q15_t)0x34F2, (q15_t)0x3508, (q15_t)0x351F, (q15_t)0x3536,
+    (q15_t)0x354D, (q15_t)0x3564, (q15_t)0x357B, (q15_t)0x3592, (q15_t)0x35A8, (q15_t)0x35BF, (q15_t)0x35D6, (q15_t)0x35ED,
+    (q15_t)0x3604, (q15_t)0x361A, (q15_t)0x3631, (q15_t)0x3648, (q15_t)0x365F, (q15_t)0x3675, (q15_t)0x368C, (q15_t)0x36A3,
+    (q15_t)0x36BA, (q15_t)0x36D0, (q15_t)0x36E7, (q15_t)0x36FE, (q15_t)0x3714, (q15_t)0x372B, (q15_t)0x3742, (q15_t)0x3758,
+    (q15_t)0x376F, (q15_t)0x3786, (q15_t)0x379C, (q15_t)0x37B3, (q15_t)0x37CA, (q15_t)0x37E0, (q15_t)0x37F7, (q15_t)0x380D,
+    (q15_t)0x3824, (q15_t)0x383B, (q15_t)0x3851, (q15_t)0x3868, (q15_t)0x387E, (q15_t)0x3895, (q15_t)0x38AB, (q15_t)0x38C2,
+    (q15_t)0x38D8, (q15_t)0x38EF, (q15_t)0x3906, (q15_t)0x391C, (q15_t)0x3932, (q15_t)0x3949, (q15_t)0x395F, (q15_t)0x3976,
+    (q15_t)0x398C, (q15_t)0x39A3, (q15_t)0x39B9, (q15_t)0x39D0, (q15_t)0x39E6, (q15_t)0x39FD, (q15_t)0x3A13, (q15_t)0x3A29,
+    (q15_t)0x3A40, (q15_t)0x3A56, (q15_t)0x3A6C, (q15_t)0x3A83, (q15_t)0x3A99, (q15_t)0x3AAF, (q15_t)0x3AC6, (q15_t)0x3ADC,
+    (q15_t)0x3AF2, (q15_t)0x3B09, (q15_t)0x3B1F, (q15_t)0x3B35, (q15_t)0x3B4C, (q15_t)0x3B62, (q15_t)0x3B78, (q15_t)0x3B8E,
+    (q15_t)0x3BA5, (q15_t)0x3BBB, (q15_t)0x3BD1, (q15_t)0x3BE7, (q15_t)0x3BFD, (q15_t)0x3C14, (q15_t)0x3C2A, (q15_t)0x3C40,
+    (q15_t)0x3C56, (q15_t)0x3C6C, (q15_t)0x3C83, (q15_t)0x3C99, (q15_t)0x3CAF, (q15_t)0x3CC5, (q15_t)0x3CDB, (q15_t)0x3CF1,
+    (q15_t)0x3D07, (q15_t)0x3D1D, (q15_t)0x3D33, (q15_t)0x3D49, (q15_t)0x3D60, (q15_t)0x3D76, (q15_t)0x3D8C, (q15_t)0x3DA2,
+    (q15_t)0x3DB8, (q15_t)0x3DCE, (q15_t)0x3DE4, (q15_t)0x3DFA, (q15_t)0x3E10, (q15_t)0x3E26, (q15_t)0x3E3C, (q15_t)0x3E52,
+    (q15_t)0x3E68, (q15_t)0x3E7D, (q15_t)0x3E93, (q15_t)0x3EA9, (q15_t)0x3EBF, (q15_t)0x3ED5, (q15_t)0x3EEB, (q15_t)0x3F01,
+    (q15_t)0x3F17, (q15_t)0x3F2D, (q15_t)0x3F43, (q15_t)0x3F58, (q15_t)0x3F6E, (q15_t)0x3F84, (q15_t)0x3F9A, (q15_t)0x3FB0,
+    (q15_t)0x3FC5, (q15_t)0x3FDB, (q15_t)0x3FF1, (q15_t)0x4007, (q15_t)0x401D, (q15_t)0x4032, (q15_t)0x4048, (q15_t)0x405E,
+    (q15_t)0x4073, (q15_t)0x4089, (q15_t)0x409F, (q15_t)0x40B5, (q15_t)0x40CA, (q15_t)0x40E0, (q15_t)0x40F6, (q15_t)0x410B,
+    (q15_t)0x4121, (q15_t)0x4136, (q15_t)0x414C, (q15_t)0x4162, (q15_t)0x4177, (q15_t)0x418D, (q15_t)0x41A2, (q15_t)0x41B8,
+    (q15_t)0x41CE, (q15_t)0x41E3, (q15_t)0x41F9, (q15_t)0x420E, (q15_t)0x4224, (q15_t)0x4239, (q15_t)0x424F, (q15_t)0x4264,
+    (q15_t)0x427A, (q15_t)0x428F, (q15_t)0x42A5, (q15_t)0x42BA, (q15_t)0x42D0, (q15_t)0x42E5, (q15_t)0x42FA, (q15_t)0x4310,
+    (q15_t)0x4325, (q15_t)0x433B, (q15_t)0x4350, (q15_t)0x4365, (q15_t)0x437B, (q15_t)0x4390, (q15_t)0x43A5, (q15_t)0x43BB,
+    (q15_t)0x43D0, (q15_t)0x43E5, (q15_t)0x43FB, (q15_t)0x4410, (q15_t)0x4425, (q15_t)0x443B, (q15_t)0x4450, (q15_t)0x4465,
+    (q15_t)0x447A, (q15_t)0x4490, (q15_t)0x44A5, (q15_t)0x44BA, (q15_t)0x44CF, (q15_t)0x44E4, (q15_t)0x44FA, (q15_t)0x450F,
+    (q15_t)0x4524, (q15_t)0x4539, (q15_t)0x454E, (q15_t)0x4563, (q15_t)0x4578, (q15_t)0x458D, (q15_t)0x45A3, (q15_t)0x45B8,
+    (q15_t)0x45CD, (q15_t)0x45E2, (q15_t)0x45F7, (q15_t)0x460C, (q15_t)0x4621, (q15_t)0x4636, (q15_t)0x464B, (q15_t)0x4660,
+    (q15_t)0x4675, (q15_t)0x468A, (q15_t)0x469F, (q15_t)0x46B4, (q15_t)0x46C9, (q15_t)0x46DE, (q15_t)0x46F3, (q15_t)0x4708,
+    (q15_t)0x471C, (q15_t)0x4731, (q15_t)0x4746, (q15_t)0x475B, (q15_t)0x4770, (q15_t)0x4785, (q15_t)0x479A, (q15_t)0x47AE,
+    (q15_t)0x47C3, (q15_t)0x47D8, (q15_t)0x47ED, (q15_t)0x4802, (q15_t)0x4816, (q15_t)0x482B, (q15_t)0x4840, (q15_t)0x4855,
+    (q15_t)0x4869, (q15_t)0x487E, (q15_t)0x4893, (q15_t)0x48A8, (q15_t)0x48BC, (q15_t)0x48D1, (q15_t)0x48E6, (q15_t)0x48FA,
+    (q15_t)0x490F, (q15_t)0x4923, (q15_t)0x4938, (q15_t)0x494D, (q15_t)0x4961, (q15_t)0x4976, (q15_t)0x498A, (q15_t)0x499F,
+    (q15_t)0x49B4, (q15_t)0x49C8, (q15_t)0x49DD, (q15_t)0x49F1, (q15_t)0x4A06, (q15_t)0x4A1A, (q15_t)0x4A2F, (q15_t)0x4A43,
+    (q15_t)0x4A58, (q15_t)0x4A6C, (q15_t)0x4A81, (q15_t)0x4A95, (q15_t)0x4AA9, (q15_t)0x4ABE, (q15_t)0x4AD2, (q15_t)0x4AE7,
+    (q15_t)0x4AFB, (q15_t)0x4B0F, (q15_t)0x4B24, (q15_t)0x4B38, (q15_t)0x4B4C, (q15_t)0x4B61, (q15_t)0x4B75, (q15_t)0x4B89,
+    (q15_t)0x4B9E, (q15_t)0x4BB2, (q15_t)0x4BC6, (q15_t)0x4BDA, (q15_t)0x4BEF, (q15_t)0x4C03, (q15_t)0x4C17, (q15_t)0x4C2B,
+    (q15_t)0x4C3F, (q15_t)0x4C54, (q15_t)0x4C68, (q15_t)0x4C7C, (q15_t)0x4C90, (q15_t)0x4CA4, (q15_t)0x4CB8, (q15_t)0x4CCC,
+    (q15_t)0x4CE1, (q15_t)0x4CF5, (q15_t)0x4D09, (q15_t)0x4D1D, (q15_t)0x4D31, (q15_t)0x4D45, (q15_t)0x4D59, (q15_t)0x4D6D,
+    (q15_t)0x4D81, (q15_t)0x4D95, (q15_t)0x4DA9, (q15_t)0x4DBD, (q15_t)0x4DD1, (q15_t)0x4DE5, (q15_t)0x4DF9, (q15_t)0x4E0D,
+    (q15_t)0x4E21, (q15_t)0x4E34, (q15_t)0x4E48, (q15_t)0x4E5C, (q15_t)0x4E70, (q15_t)0x4E84, (q15_t)0x4E98, (q15_t)0x4EAC,
+    (q15_t)0x4EBF, (q15_t)0x4ED3, (q15_t)0x4EE7, (q15_t)0x4EFB, (q15_t)0x4F0F, (q15_t)0x4F22, (q15_t)0x4F36, (q15_t)0x4F4A,
+    (q15_t)0x4F5E, (q15_t)0x4F71, (q15_t)0x4F85, (q15_t)0x4F99, (q15_t)0x4FAC, (q15_t)0x4FC0, (q15_t)0x4FD4, (q15_t)0x4FE7,
+    (q15_t)0x4FFB, (q15_t)0x500F, (q15_t)0x5022, (q15_t)0x5036, (q15_t)0x5049, (q15_t)0x505D, (q15_t)0x5070, (q15_t)0x5084,
+    (q15_t)0x5097, (q15_t)0x50AB, (q15_t)0x50BF, (q15_t)0x50D2, (q15_t)0x50E5, (q15_t)0x50F9, (q15_t)0x510C, (q15_t)0x5120,
+    (q15_t)0x5133, (q15_t)0x5147, (q15_t)0x515A, (q15_t)0x516E, (q15_t)0x5181, (q15_t)0x5194, (q15_t)0x51A8, (q15_t)0x51BB,
+    (q15_t)0x51CE, (q15_t)0x51E2, (q15_t)0x51F5, (q15_t)0x5208, (q15_t)0x521C, (q15_t)0x522F, (q15_t)0x5242, (q15_t)0x5255,
+    (q15_t)0x5269, (q15_t)0x527C, (q15_t)0x528F, (q15_t)0x52A2, (q15_t)0x52B5, (q15_t)0x52C9, (q15_t)0x52DC, (q15_t)0x52EF,
+    (q15_t)0x5302, (q15_t)0x5315, (q15_t)0x5328, (q15_t)0x533B, (q15_t)0x534E, (q15_t)0x5362, (q15_t)0x5375, (q15_t)0x5388,
+    (q15_t)0x539B, (q15_t)0x53AE, (q15_t)0x53C1, (q15_t)0x53D4, (q15_t)0x53E7, (q15_t)0x53FA, (q15_t)0x540D, (q15_t)0x5420,
+    (q15_t)0x5433, (q15_t)0x5445, (q15_t)0x5458, (q15_t)0x546B, (q15_t)0x547E, (q15_t)0x5491, (q15_t)0x54A4, (q15_t)0x54B7,
+    (q15_t)0x54CA, (q15_t)0x54DC, (q15_t)0x54EF, (q15_t)0x5502, (q15_t)0x5515, (q15_t)0x5528, (q15_t)0x553A, (q15_t)0x554D,
+    (q15_t)0x5560, (q15_t)0x5572, (q15_t)0x5585, (q15_t)0x5598, (q15_t)0x55AB, (q15_t)0x55BD, (q15_t)0x55D0, (q15_t)0x55E3,
+    (q15_t)0x55F5, (q15_t)0x5608, (q15_t)0x561A, (q15_t)0x562D, (q15_t)0x5640, (q15_t)0x5652, (q15_t)0x5665, (q15_t)0x5677,
+    (q15_t)0x568A, (q15_t)0x569C, (q15_t)0x56AF, (q15_t)0x56C1, (q15_t)0x56D4, (q15_t)0x56E6, (q15_t)0x56F9, (q15_t)0x570B,
+    (q15_t)0x571D, (q15_t)0x5730, (q15_t)0x5742, (q15_t)0x5755, (q15_t)0x5767, (q15_t)0x5779, (q15_t)0x578C, (q15_t)0x579E,
+    (q15_t)0x57B0, (q15_t)0x57C3, (q15_t)0x57D5, (q15_t)0x57E7, (q15_t)0x57F9, (q15_t)0x580C, (q15_t)0x581E, (q15_t)0x5830,
+    (q15_t)0x5842, (q15_t)0x5855, (q15_t)0x5867, (q15_t)0x5879, (q15_t)0x588B, (q15_t)0x589D, (q15_t)0x58AF, (q15_t)0x58C1,
+    (q15_t)0x58D4, (q15_t)0x58E6, (q15_t)0x58F8, (q15_t)0x590A, (q15_t)0x591C, (q15_t)0x592E, (q15_t)0x5940, (q15_t)0x5952,
+    (q15_t)0x5964, (q15_t)0x5976, (q15_t)0x5988, (q15_t)0x599A, (q15_t)0x59AC, (q15_t)0x59BE, (q15_t)0x59D0, (q15_t)0x59E1,
+    (q15_t)0x59F3, (q15_t)0x5A05, (q15_t)0x5A17, (q15_t)0x5A29, (q15_t)0x5A3B, (q15_t)0x5A4D, (q15_t)0x5A5E, (q15_t)0x5A70,
+    (q15_t)0x5A82, (q15_t)0x5A94, (q15_t)0x5AA5, (q15_t)0x5AB7, (q15_t)0x5AC9, (q15_t)0x5ADB, (q15_t)0x5AEC, (q15_t)0x5AFE,
+    (q15_t)0x5B10, (q15_t)0x5B21, (q15_t)0x5B33, (q15_t)0x5B45, (q15_t)0x5B56, (q15_t)0x5B68, (q15_t)0x5B79, (q15_t)0x5B8B,
+    (q15_t)0x5B9D, (q15_t)0x5BAE, (q15_t)0x5BC0, (q15_t)0x5BD1, (q15_t)0x5BE3, (q15_t)0x5BF4, (q15_t)0x5C06, (q15_t)0x5C17,
+    (q15_t)0x5C29, (q15_t)0x5C3A, (q15_t)0x5C4B, (q15_t)0x5C5D, (q15_t)0x5C6E, (q15_t)0x5C80, (q15_t)0x5C91, (q15_t)0x5CA2,
+    (q15_t)0x5CB4, (q15_t)0x5CC5, (q15_t)0x5CD6, (q15_t)0x5CE8, (q15_t)0x5CF9, (q15_t)0x5D0A, (q15_t)0x5D1B, (q15_t)0x5D2D,
+    (q15_t)0x5D3E, (q15_t)0x5D4F, (q15_t)0x5D60, (q15_t)0x5D71, (q15_t)0x5D83, (q15_t)0x5D94, (q15_t)0x5DA5, (q15_t)0x5DB6,
+    (q15_t)0x5DC7, (q15_t)0x5DD8, (q15_t)0x5DE9, (q15_t)0x5DFA, (q15_t)0x5E0B, (q15_t)0x5E1C, (q15_t)0x5E2D, (q15_t)0x5E3F,
+    (q15_t)0x5E50, (q15_t)0x5E60, (q15_t)0x5E71, (q15_t)0x5E82, (q15_t)0x5E93, (q15_t)0x5EA4, (q15_t)0x5EB5, (q15_t)0x5EC6,
+    (q15_t)0x5ED7, (q15_t)0x5EE8, (q15_t)0x5EF9, (q15_t)0x5F0A, (q15_t)0x5F1A, (q15_t)0x5F2B, (q15_t)0x5F3C, (q15_t)0x5F4D,
+    (q15_t)0x5F5E, (q15_t)0x5F6E, (q15_t)0x5F7F, (q15_t)0x5F90, (q15_t)0x5FA0, (q15_t)0x5FB1, (q15_t)0x5FC2, (q15_t)0x5FD3,
+    (q15_t)0x5FE3, (q15_t)0x5FF4, (q15_t)0x6004, (q15_t)0x6015, (q15_t)0x6026, (q15_t)0x6036, (q15_t)0x6047, (q15_t)0x6057,
+    (q15_t)0x6068, (q15_t)0x6078, (q15_t)0x6089, (q15_t)0x6099, (q15_t)0x60AA, (q15_t)0x60BA, (q15_t)0x60CB, (q15_t)0x60DB,
+    (q15_t)0x60EC, (q15_t)0x60FC, (q15_t)0x610D, (q15_t)0x611D, (q15_t)0x612D, (q15_t)0x613E, (q15_t)0x614E, (q15_t)0x615E,
+    (q15_t)0x616F, (q15_t)0x617F, (q15_t)0x618F, (q15_t)0x619F, (q15_t)0x61B0, (q15_t)0x61C0, (q15_t)0x61D0, (q15_t)0x61E0,
+    (q15_t)0x61F1, (q15_t)0x6201, (q15_t)0x6211, (q15_t)0x6221, (q15_t)0x6231, (q15_t)0x6241, (q15_t)0x6251, (q15_t)0x6261,
+    (q15_t)0x6271, (q15_t)0x6282, (q15_t)0x6292, (q15_t)0x62A2, (q15_t)0x62B2, (q15_t)0x62C2, (q15_t)0x62D2, (q15_t)0x62E2,
+    (q15_t)0x62F2, (q15_t)0x6301, (q15_t)0x6311, (q15_t)0x6321, (q15_t)0x6331, (q15_t)0x6341, (q15_t)0x6351, (q15_t)0x6361,
+    (q15_t)0x6371, (q15_t)0x6380, (q15_t)0x6390, (q15_t)0x63A0, (q15_t)0x63B0, (q15_t)0x63C0, (q15_t)0x63CF, (q15_t)0x63DF,
+    (q15_t)0x63EF, (q15_t)0x63FE, (q15_t)0x640E, (q15_t)0x641E, (q15_t)0x642D, (q15_t)0x643D, (q15_t)0x644D, (q15_t)0x645C,
+    (q15_t)0x646C, (q15_t)0x647B, (q15_t)0x648B, (q15_t)0x649B, (q15_t)0x64AA, (q15_t)0x64BA, (q15_t)0x64C9, (q15_t)0x64D9,
+    (q15_t)0x64E8, (q15_t)0x64F7, (q15_t)0x6507, (q15_t)0x6516, (q15_t)0x6526, (q15_t)0x6535, (q15_t)0x6545, (q15_t)0x6554,
+    (q15_t)0x6563, (q15_t)0x6573, (q15_t)0x6582, (q15_t)0x6591, (q15_t)0x65A0, (q15_t)0x65B0, (q15_t)0x65BF, (q15_t)0x65CE,
+    (q15_t)0x65DD, (q15_t)0x65ED, (q15_t)0x65FC, (q15_t)0x660B, (q15_t)0x661A, (q15_t)0x6629, (q15_t)0x6639, (q15_t)0x6648,
+    (q15_t)0x6657, (q15_t)0x6666, (q15_t)0x6675, (q15_t)0x6684, (q15_t)0x6693, (q15_t)0x66A2, (q15_t)0x66B1, (q15_t)0x66C0,
+    (q15_t)0x66CF, (q15_t)0x66DE, (q15_t)0x66ED, (q15_t)0x66FC, (q15_t)0x670B, (q15_t)0x671A, (q15_t)0x6729, (q15_t)0x6737,
+    (q15_t)0x6746, (q15_t)0x6755, (q15_t)0x6764, (q15_t)0x6773, (q15_t)0x6782, (q15_t)0x6790, (q15_t)0x679F, (q15_t)0x67AE,
+    (q15_t)0x67BD, (q15_t)0x67CB, (q15_t)0x67DA, (q15_t)0x67E9, (q15_t)0x67F7, (q15_t)0x6806, (q15_t)0x6815, (q15_t)0x6823,
+    (q15_t)0x6832, (q15_t)0x6840, (q15_t)0x684F, (q15_t)0x685E, (q15_t)0x686C, (q15_t)0x687B, (q15_t)0x6889, (q15_t)0x6898,
+    (q15_t)0x68A6, (q15_t)0x68B5, (q15_t)0x68C3, (q15_t)0x68D1, (q15_t)0x68E0, (q15_t)0x68EE, (q15_t)0x68FD, (q15_t)0x690B,
+    (q15_t)0x6919, (q15_t)0x6928, (q15_t)0x6936, (q15_t)0x6944, (q15_t)0x6953, (q15_t)0x6961, (q15_t)0x696F, (q15_t)0x697D,
+    (q15_t)0x698C, (q15_t)0x699A, (q15_t)0x69A8, (q15_t)0x69B6, (q15_t)0x69C4, (q15_t)0x69D3, (q15_t)0x69E1, (q15_t)0x69EF,
+    (q15_t)0x69FD, (q15_t)0x6A0B, (q15_t)0x6A19, (q15_t)0x6A27, (q15_t)0x6A35, (q15_t)0x6A43, (q15_t)0x6A51, (q15_t)0x6A5F,
+    (q15_t)0x6A6D, (q15_t)0x6A7B, (q15_t)0x6A89, (q15_t)0x6A97, (q15_t)0x6AA5, (q15_t)0x6AB3, (q15_t)0x6AC1, (q15_t)0x6ACE,
+    (q15_t)0x6ADC, (q15_t)0x6AEA, (q15_t)0x6AF8, (q15_t)0x6B06, (q15_t)0x6B13, (q15_t)0x6B21, (q15_t)0x6B2F, (q15_t)0x6B3D,
+    (q15_t)0x6B4A, (q15_t)0x6B58, (q15_t)0x6B66, (q15_t)0x6B73, (q15_t)0x6B81, (q15_t)0x6B8F, (q15_t)0x6B9C, (q15_t)0x6BAA,
+    (q15_t)0x6BB8, (q15_t)0x6BC5, (q15_t)0x6BD3, (q15_t)0x6BE0, (q15_t)0x6BEE, (q15_t)0x6BFB, (q15_t)0x6C09, (q15_t)0x6C16,
+    (q15_t)0x6C24, (q15_t)0x6C31, (q15_t)0x6C3F, (q15_t)0x6C4C, (q15_t)0x6C59, (q15_t)0x6C67, (q15_t)0x6C74, (q15_t)0x6C81,
+    (q15_t)0x6C8F, (q15_t)0x6C9C, (q15_t)0x6CA9, (q15_t)0x6CB7, (q15_t)0x6CC4, (q15_t)0x6CD1, (q15_t)0x6CDE, (q15_t)0x6CEC,
+    (q15_t)0x6CF9, (q15_t)0x6D06, (q15_t)0x6D13, (q15_t)0x6D20, (q15_t)0x6D2D, (q15_t)0x6D3A, (q15_t)0x6D48, (q15_t)0x6D55,
+    (q15_t)0x6D62, (q15_t)0x6D6F, (q15_t)0x6D7C, (q15_t)0x6D89, (q15_t)0x6D96, (q15_t)0x6DA3, (q15_t)0x6DB0, (q15_t)0x6DBD,
+    (q15_t)0x6DCA, (q15_t)0x6DD6, (q15_t)0x6DE3, (q15_t)0x6DF0, (q15_t)0x6DFD, (q15_t)0x6E0A, (q15_t)0x6E17, (q15_t)0x6E24,
+    (q15_t)0x6E30, (q15_t)0x6E3D, (q15_t)0x6E4A, (q15_t)0x6E57, (q15_t)0x6E63, (q15_t)0x6E70, (q15_t)0x6E7D, (q15_t)0x6E89,
+    (q15_t)0x6E96, (q15_t)0x6EA3, (q15_t)0x6EAF, (q15_t)0x6EBC, (q15_t)0x6EC9, (q15_t)0x6ED5, (q15_t)0x6EE2, (q15_t)0x6EEE,
+    (q15_t)0x6EFB, (q15_t)0x6F07, (q15_t)0x6F14, (q15_t)0x6F20, (q15_t)0x6F2D, (q15_t)0x6F39, (q15_t)0x6F46, (q15_t)0x6F52,
+    (q15_t)0x6F5F, (q15_t)0x6F6B, (q15_t)0x6F77, (q15_t)0x6F84, (q15_t)0x6F90, (q15_t)0x6F9C, (q15_t)0x6FA9, (q15_t)0x6FB5,
+    (q15_t)0x6FC1, (q15_t)0x6FCD, (q15_t)0x6FDA, (q15_t)0x6FE6, (q15_t)0x6FF2, (q15_t)0x6FFE, (q15_t)0x700A, (q15_t)0x7016,
+    (q15_t)0x7023, (q15_t)0x702F, (q15_t)0x703B, (q15_t)0x7047, (q15_t)0x7053, (q15_t)0x705F, (q15_t)0x706B, (q15_t)0x7077,
+    (q15_t)0x7083, (q15_t)0x708F, (q15_t)0x709B, (q15_t)0x70A7, (q15_t)0x70B3, (q15_t)0x70BF, (q15_t)0x70CB, (q15_t)0x70D6,
+    (q15_t)0x70E2, (q15_t)0x70EE, (q15_t)0x70FA, (q15_t)0x7106, (q15_t)0x7112, (q15_t)0x711D, (q15_t)0x7129, (q15_t)0x7135,
+    (q15_t)0x7141, (q15_t)0x714C, (q15_t)0x7158, (q15_t)0x7164, (q15_t)0x716F, (q15_t)0x717B, (q15_t)0x7186, (q15_t)0x7192,
+    (q15_t)0x719E, (q15_t)0x71A9, (q15_t)0x71B5, (q15_t)0x71C0, (q15_t)0x71CC, (q15_t)0x71D7, (q15_t)0x71E3, (q15_t)0x71EE,
+    (q15_t)0x71FA, (q15_t)0x7205, (q15_t)0x7211, (q15_t)0x721C, (q15_t)0x7227, (q15_t)0x7233, (q15_t)0x723E, (q15_t)0x7249,
+    (q15_t)0x7255, (q15_t)0x7260, (q15_t)0x726B, (q15_t)0x7276, (q15_t)0x7282, (q15_t)0x728D, (q15_t)0x7298, (q15_t)0x72A3,
+    (q15_t)0x72AF, (q15_t)0x72BA, (q15_t)0x72C5, (q15_t)0x72D0, (q15_t)0x72DB, (q15_t)0x72E6, (q15_t)0x72F1, (q15_t)0x72FC,
+    (q15_t)0x7307, (q15_t)0x7312, (q15_t)0x731D, (q15_t)0x7328, (q15_t)0x7333, (q15_t)0x733E, (q15_t)0x7349, (q15_t)0x7354,
+    (q15_t)0x735F, (q15_t)0x736A, (q15_t)0x7375, (q15_t)0x737F, (q15_t)0x738A, (q15_t)0x7395, (q15_t)0x73A0, (q15_t)0x73AB,
+    (q15_t)0x73B5, (q15_t)0x73C0, (q15_t)0x73CB, (q15_t)0x73D6, (q15_t)0x73E0, (q15_t)0x73EB, (q15_t)0x73F6, (q15_t)0x7400,
+    (q15_t)0x740B, (q15_t)0x7415, (q15_t)0x7420, (q15_t)0x742B, (q15_t)0x7435, (q15_t)0x7440, (q15_t)0x744A, (q15_t)0x7455,
+    (q15_t)0x745F, (q15_t)0x746A, (q15_t)0x7474, (q15_t)0x747E, (q15_t)0x7489, (q15_t)0x7493, (q15_t)0x749E, (q15_t)0x74A8,
+    (q15_t)0x74B2, (q15_t)0x74BD, (q15_t)0x74C7, (q15_t)0x74D1, (q15_t)0x74DB, (q15_t)0x74E6, (q15_t)0x74F0, (q15_t)0x74FA,
+    (q15_t)0x7504, (q15_t)0x750F, (q15_t)0x7519, (q15_t)0x7523, (q15_t)0x752D, (q15_t)0x7537, (q15_t)0x7541, (q15_t)0x754B,
+    (q15_t)0x7555, (q15_t)0x755F, (q15_t)0x7569, (q15_t)0x7573, (q15_t)0x757D, (q15_t)0x7587, (q15_t)0x7591, (q15_t)0x759B,
+    (q15_t)0x75A5, (q15_t)0x75AF, (q15_t)0x75B9, (q15_t)0x75C3, (q15_t)0x75CC, (q15_t)0x75D6, (q15_t)0x75E0, (q15_t)0x75EA,
+    (q15_t)0x75F4, (q15_t)0x75FD, (q15_t)0x7607, (q15_t)0x7611, (q15_t)0x761B, (q15_t)0x7624, (q15_t)0x762E, (q15_t)0x7638,
+    (q15_t)0x7641, (q15_t)0x764B, (q15_t)0x7654, (q15_t)0x765E, (q15_t)0x7668, (q15_t)0x7671, (q15_t)0x767B, (q15_t)0x7684,
+    (q15_t)0x768E, (q15_t)0x7697, (q15_t)0x76A0, (q15_t)0x76AA, (q15_t)0x76B3, (q15_t)0x76BD, (q15_t)0x76C6, (q15_t)0x76CF,
+    (q15_t)0x76D9, (q15_t)0x76E2, (q15_t)0x76EB, (q15_t)0x76F5, (q15_t)0x76FE, (q15_t)0x7707, (q15_t)0x7710, (q15_t)0x771A,
+    (q15_t)0x7723, (q15_t)0x772C, (q15_t)0x7735, (q15_t)0x773E, (q15_t)0x7747, (q15_t)0x7751, (q15_t)0x775A, (q15_t)0x7763,
+    (q15_t)0x776C, (q15_t)0x7775, (q15_t)0x777E, (q15_t)0x7787, (q15_t)0x7790, (q15_t)0x7799, (q15_t)0x77A2, (q15_t)0x77AB,
+    (q15_t)0x77B4, (q15_t)0x77BC, (q15_t)0x77C5, (q15_t)0x77CE, (q15_t)0x77D7, (q15_t)0x77E0, (q15_t)0x77E9, (q15_t)0x77F1,
+    (q15_t)0x77FA, (q15_t)0x7803, (q15_t)0x780C, (q15_t)0x7814, (q15_t)0x781D, (q15_t)0x7826, (q15_t)0x782E, (q15_t)0x7837,
+    (q15_t)0x7840, (q15_t)0x7848, (q15_t)0x7851, (q15_t)0x7859, (q15_t)0x7862, (q15_t)0x786B, (q15_t)0x7873, (q15_t)0x787C,
+    (q15_t)0x7884, (q15_t)0x788C, (q15_t)0x7895, (q15_t)0x789D, (q15_t)0x78A6, (q15_t)0x78AE, (q15_t)0x78B6, (q15_t)0x78BF,
+    (q15_t)0x78C7, (q15_t)0x78CF, (q15_t)0x78D8, (q15_t)0x78E0, (q15_t)0x78E8, (q15_t)0x78F1, (q15_t)0x78F9, (q15_t)0x7901,
+    (q15_t)0x7909, (q15_t)0x7911, (q15_t)0x7919, (q15_t)0x7922, (q15_t)0x792A, (q15_t)0x7932, (q15_t)0x793A, (q15_t)0x7942,
+    (q15_t)0x794A, (q15_t)0x7952, (q15_t)0x795A, (q15_t)0x7962, (q15_t)0x796A, (q15_t)0x7972, (q15_t)0x797A, (q15_t)0x7982,
+    (q15_t)0x798A, (q15_t)0x7992, (q15_t)0x7999, (q15_t)0x79A1, (q15_t)0x79A9, (q15_t)0x79B1, (q15_t)0x79B9, (q15_t)0x79C0,
+    (q15_t)0x79C8, (q15_t)0x79D0, (q15_t)0x79D8, (q15_t)0x79DF, (q15_t)0x79E7, (q15_t)0x79EF, (q15_t)0x79F6, (q15_t)0x79FE,
+    (q15_t)0x7A05, (q15_t)0x7A0D, (q15_t)0x7A15, (q15_t)0x7A1C, (q15_t)0x7A24, (q15_t)0x7A2B, (q15_t)0x7A33, (q15_t)0x7A3A,
+    (q15_t)0x7A42, (q15_t)0x7A49, (q15_t)0x7A50, (q15_t)0x7A58, (q15_t)0x7A5F, (q15_t)0x7A67, (q15_t)0x7A6E, (q15_t)0x7A75,
+    (q15_t)0x7A7D, (q15_t)0x7A84, (q15_t)0x7A8B, (q15_t)0x7A92, (q15_t)0x7A9A, (q15_t)0x7AA1, (q15_t)0x7AA8, (q15_t)0x7AAF,
+    (q15_t)0x7AB6, (q15_t)0x7ABD, (q15_t)0x7AC5, (q15_t)0x7ACC, (q15_t)0x7AD3, (q15_t)0x7ADA, (q15_t)0x7AE1, (q15_t)0x7AE8,
+    (q15_t)0x7AEF, (q15_t)0x7AF6, (q15_t)0x7AFD, (q15_t)0x7B04, (q15_t)0x7B0B, (q15_t)0x7B12, (q15_t)0x7B19, (q15_t)0x7B1F,
+    (q15_t)0x7B26, (q15_t)0x7B2D, (q15_t)0x7B34, (q15_t)0x7B3B, (q15_t)0x7B42, (q15_t)0x7B48, (q15_t)0x7B4F, (q15_t)0x7B56,
+    (q15_t)0x7B5D, (q15_t)0x7B63, (q15_t)0x7B6A, (q15_t)0x7B71, (q15_t)0x7B77, (q15_t)0x7B7E, (q15_t)0x7B84, (q15_t)0x7B8B,
+    (q15_t)0x7B92, (q15_t)0x7B98, (q15_t)0x7B9F, (q15_t)0x7BA5, (q15_t)0x7BAC, (q15_t)0x7BB2, (q15_t)0x7BB9, (q15_t)0x7BBF,
+    (q15_t)0x7BC5, (q15_t)0x7BCC, (q15_t)0x7BD2, (q15_t)0x7BD9, (q15_t)0x7BDF, (q15_t)0x7BE5, (q15_t)0x7BEB, (q15_t)0x7BF2,
+    (q15_t)0x7BF8, (q15_t)0x7BFE, (q15_t)0x7C05, (q15_t)0x7C0B, (q15_t)0x7C11, (q15_t)0x7C17, (q15_t)0x7C1D, (q15_t)0x7C23,
+    (q15_t)0x7C29, (q15_t)0x7C30, (q15_t)0x7C36, (q15_t)0x7C3C, (q15_t)0x7C42, (q15_t)0x7C48, (q15_t)0x7C4E, (q15_t)0x7C54,
+    (q15_t)0x7C5A, (q15_t)0x7C60, (q15_t)0x7C66, (q15_t)0x7C6C, (q15_t)0x7C71, (q15_t)0x7C77, (q15_t)0x7C7D, (q15_t)0x7C83,
+    (q15_t)0x7C89, (q15_t)0x7C8F, (q15_t)0x7C94, (q15_t)0x7C9A, (q15_t)0x7CA0, (q15_t)0x7CA6, (q15_t)0x7CAB, (q15_t)0x7CB1,
+    (q15_t)0x7CB7, (q15_t)0x7CBC, (q15_t)0x7CC2, (q15_t)0x7CC8, (q15_t)0x7CCD, (q15_t)0x7CD3, (q15_t)0x7CD8, (q15_t)0x7CDE,
+    (q15_t)0x7CE3, (q15_t)0x7CE9, (q15_t)0x7CEE, (q15_t)0x7CF4, (q15_t)0x7CF9, (q15_t)0x7CFF, (q15_t)0x7D04, (q15_t)0x7D09,
+    (q15_t)0x7D0F, (q15_t)0x7D14, (q15_t)0x7D19, (q15_t)0x7D1F, (q15_t)0x7D24, (q15_t)0x7D29, (q15_t)0x7D2F, (q15_t)0x7D34,
+    (q15_t)0x7D39, (q15_t)0x7D3E, (q15_t)0x7D43, (q15_t)0x7D49, (q15_t)0x7D4E, (q15_t)0x7D53, (q15_t)0x7D58, (q15_t)0x7D5D,
+    (q15_t)0x7D62, (q15_t)0x7D67, (q15_t)0x7D6C, (q15_t)0x7D71, (q15_t)0x7D76, (q15_t)0x7D7B, (q15_t)0x7D80, (q15_t)0x7D85,
+    (q15_t)0x7D8A, (q15_t)0x7D8F, (q15_t)0x7D94, (q15_t)0x7D98, (q15_t)0x7D9D, (q15_t)0x7DA2, (q15_t)0x7DA7, (q15_t)0x7DAC,
+    (q15_t)0x7DB0, (q15_t)0x7DB5, (q15_t)0x7DBA, (q15_t)0x7DBF, (q15_t)0x7DC3, (q15_t)0x7DC8, (q15_t)0x7DCD, (q15_t)0x7DD1,
+    (q15_t)0x7DD6, (q15_t)0x7DDA, (q15_t)0x7DDF, (q15_t)0x7DE4, (q15_t)0x7DE8, (q15_t)0x7DED, (q15_t)0x7DF1, (q15_t)0x7DF6,
+    (q15_t)0x7DFA, (q15_t)0x7DFF, (q15_t)0x7E03, (q15_t)0x7E07, (q15_t)0x7E0C, (q15_t)0x7E10, (q15_t)0x7E14, (q15_t)0x7E19,
+    (q15_t)0x7E1D, (q15_t)0x7E21, (q15_t)0x7E26, (q15_t)0x7E2A, (q15_t)0x7E2E, (q15_t)0x7E32, (q15_t)0x7E37, (q15_t)0x7E3B,
+    (q15_t)0x7E3F, (q15_t)0x7E43, (q15_t)0x7E47, (q15_t)0x7E4B, (q15_t)0x7E4F, (q15_t)0x7E53, (q15_t)0x7E57, (q15_t)0x7E5B,
+    (q15_t)0x7E5F, (q15_t)0x7E63, (q15_t)0x7E67, (q15_t)0x7E6B, (q15_t)0x7E6F, (q15_t)0x7E73, (q15_t)0x7E77, (q15_t)0x7E7B,
+    (q15_t)0x7E7F, (q15_t)0x7E83, (q15_t)0x7E86, (q15_t)0x7E8A, (q15_t)0x7E8E, (q15_t)0x7E92, (q15_t)0x7E95, (q15_t)0x7E99,
+    (q15_t)0x7E9D, (q15_t)0x7EA1, (q15_t)0x7EA4, (q15_t)0x7EA8, (q15_t)0x7EAB, (q15_t)0x7EAF, (q15_t)0x7EB3, (q15_t)0x7EB6,
+    (q15_t)0x7EBA, (q15_t)0x7EBD, (q15_t)0x7EC1, (q15_t)0x7EC4, (q15_t)0x7EC8, (q15_t)0x7ECB, (q15_t)0x7ECF, (q15_t)0x7ED2,
+    (q15_t)0x7ED5, (q15_t)0x7ED9, (q15_t)0x7EDC, (q15_t)0x7EDF, (q15_t)0x7EE3, (q15_t)0x7EE6, (q15_t)0x7EE9, (q15_t)0x7EED,
+    (q15_t)0x7EF0, (q15_t)0x7EF3, (q15_t)0x7EF6, (q15_t)0x7EF9, (q15_t)0x7EFD, (q15_t)0x7F00, (q15_t)0x7F03, (q15_t)0x7F06,
+    (q15_t)0x7F09, (q15_t)0x7F0C, (q15_t)0x7F0F, (q15_t)0x7F12, (q15_t)0x7F15, (q15_t)0x7F18, (q15_t)0x7F1B, (q15_t)0x7F1E,
+    (q15_t)0x7F21, (q15_t)0x7F24, (q15_t)0x7F27, (q15_t)0x7F2A, (q15_t)0x7F2D, (q15_t)0x7F2F, (q15_t)0x7F32, (q15_t)0x7F35,
+    (q15_t)0x7F38, (q15_t)0x7F3B, (q15_t)0x7F3D, (q15_t)0x7F40, (q15_t)0x7F43, (q15_t)0x7F45, (q15_t)0x7F48, (q15_t)0x7F4B,
+    (q15_t)0x7F4D, (q15_t)0x7F50, (q15_t)0x7F53, (q15_t)0x7F55, (q15_t)0x7F58, (q15_t)0x7F5A, (q15_t)0x7F5D, (q15_t)0x7F5F,
+    (q15_t)0x7F62, (q15_t)0x7F64, (q15_t)0x7F67, (q15_t)0x7F69, (q15_t)0x7F6B, (q15_t)0x7F6E, (q15_t)0x7F70, (q15_t)0x7F72,
+    (q15_t)0x7F75, (q15_t)0x7F77, (q15_t)0x7F79, (q15_t)0x7F7C, (q15_t)0x7F7E, (q15_t)0x7F80, (q15_t)0x7F82, (q15_t)0x7F85,
+    (q15_t)0x7F87, (q15_t)0x7F89, (q15_t)0x7F8B, (q15_t)0x7F8D, (q15_t)0x7F8F, (q15_t)0x7F91, (q15_t)0x7F93, (q15_t)0x7F95,
+    (q15_t)0x7F97, (q15_t)0x7F99, (q15_t)0x7F9B, (q15_t)0x7F9D, (q15_t)0x7F9F, (q15_t)0x7FA1, (q15_t)0x7FA3, (q15_t)0x7FA5,
+    (q15_t)0x7FA7, (q15_t)0x7FA9, (q15_t)0x7FAA, (q15_t)0x7FAC, (q15_t)0x7FAE, (q15_t)0x7FB0, (q15_t)0x7FB1, (q15_t)0x7FB3,
+    (q15_t)0x7FB5, (q15_t)0x7FB7, (q15_t)0x7FB8, (q15_t)0x7FBA, (q15_t)0x7FBC, (q15_t)0x7FBD, (q15_t)0x7FBF, (q15_t)0x7FC0,
+    (q15_t)0x7FC2, (q15_t)0x7FC3, (q15_t)0x7FC5, (q15_t)0x7FC6, (q15_t)0x7FC8, (q15_t)0x7FC9, (q15_t)0x7FCB, (q15_t)0x7FCC,
+    (q15_t)0x7FCE, (q15_t)0x7FCF, (q15_t)0x7FD0, (q15_t)0x7FD2, (q15_t)0x7FD3, (q15_t)0x7FD4, (q15_t)0x7FD6, (q15_t)0x7FD7,
+    (q15_t)0x7FD8, (q15_t)0x7FD9, (q15_t)0x7FDA, (q15_t)0x7FDC, (q15_t)0x7FDD, (q15_t)0x7FDE, (q15_t)0x7FDF, (q15_t)0x7FE0,
+    (q15_t)0x7FE1, (q15_t)0x7FE2, (q15_t)0x7FE3, (q15_t)0x7FE4, (q15_t)0x7FE5, (q15_t)0x7FE6, (q15_t)0x7FE7, (q15_t)0x7FE8,
+    (q15_t)0x7FE9, (q15_t)0x7FEA, (q15_t)0x7FEB, (q15_t)0x7FEC, (q15_t)0x7FED, (q15_t)0x7FEE, (q15_t)0x7FEE, (q15_t)0x7FEF,
+    (q15_t)0x7FF0, (q15_t)0x7FF1, (q15_t)0x7FF2, (q15_t)0x7FF2, (q15_t)0x7FF3, (q15_t)0x7FF4, (q15_t)0x7FF4, (q15_t)0x7FF5,
+    (q15_t)0x7FF6, (q15_t)0x7FF6, (q15_t)0x7FF7, (q15_t)0x7FF7, (q15_t)0x7FF8, (q15_t)0x7FF8, (q15_t)0x7FF9, (q15_t)0x7FF9,
+    (q15_t)0x7FFA, (q15_t)0x7FFA, (q15_t)0x7FFB, (q15_t)0x7FFB, (q15_t)0x7FFC, (q15_t)0x7FFC, (q15_t)0x7FFC, (q15_t)0x7FFD,
+    (q15_t)0x7FFD, (q15_t)0x7FFD, (q15_t)0x7FFE, (q15_t)0x7FFE, (q15_t)0x7FFE, (q15_t)0x7FFE, (q15_t)0x7FFF, (q15_t)0x7FFF,
+    (q15_t)0x7FFF, (q15_t)0x7FFF, (q15_t)0x7FFF, (q15_t)0x7FFF, (q15_t)0x7FFF, (q15_t)0x7FFF, (q15_t)0x7FFF, (q15_t)0x7FFF,
+    (q15_t)0x7FFF
+};
+
+#endif /* RFFT_Q15_COMPACT_TWIDDLES */
+
+/* ========================================================================= */
+/* Bit Reversal Tables                                                       */
+/* ========================================================================= */
+
+#if !defined(RFFT_Q15_NO_BITREV_TABLES)
+
+const uint16_t armBitRevIndexTable_fixed_2048[ARMBITREVINDEXTABLE_FIXED_2048_TABLE_LENGTH] =
+{
+    /* 4x2, size 1984 */
+    8,8192, 16,4096, 24,12288, 32,2048, 40,10240, 48,6144, 56,14336, 64,1024,
+    72,9216, 80,5120, 88,13312, 96,3072, 104,11264, 112,7168, 120,15360, 128,512,
+    136,8704, 144,4608, 152,12800, 160,2560, 168,10752, 176,6656, 184,14848, 192,1536,
+    200,9728, 208,5632, 216,13824, 224,3584, 232,11776, 240,7680, 248,15872, 264,8448,
+    272,4352, 280,12544, 288,2304, 296,10496, 304,6400, 312,14592, 320,1280, 328,9472,
+    336,5376, 344,13568, 352,3328, 360,11520, 368,7424, 376,15616, 384,768, 392,8960,
+    400,4864, 408,13056, 416,2816, 424,11008, 432,6912, 440,15104, 448,1792, 456,9984,
+    464,5888, 472,14080, 480,3840, 488,12032, 496,7936, 504,16128, 520,8320, 528,4224,
+    536,12416, 544,2176, 552,10368, 560,6272, 568,14464, 576,1152, 584,9344, 592,5248,
+    600,13440, 608,3200, 616,11392, 624,7296, 632,15488, 648,8832, 656,4736, 664,12928,
+    672,2688, 680,10880, 688,6784, 696,14976, 704,1664, 712,9856, 720,5760, 728,13952,
+    736,3712, 744,11904, 752,7808, 760,16000, 776,8576, 784,4480, 792,12672, 800,2432,
+    808,10624, 816,6528, 824,14720, 832,1408, 840,9600, 848,5504, 856,13696, 864,3456,
+    872,11648, 880,7552, 888,15744, 904,9088, 912,4992, 920,13184, 928,2944, 936,11136,
+    944,7040, 952,15232, 960,1920, 968,10112, 976,6016, 984,14208, 992,3968, 1000,12160,
+    1008,8064, 1016,16256, 1032,8256, 1040,4160, 1048,12352, 1056,2112, 1064,10304, 1072,6208,
+    1080,14400, 1096,9280, 1104,5184, 1112,13376, 1120,3136, 1128,11328, 1136,7232, 1144,15424,
+    1160,8768, 1168,4672, 1176,12864, 1184,2624, 1192,10816, 1200,6720, 1208,14912, 1216,1600,
+    1224,9792, 1232,5696, 1240,13888, 1248,3648, 1256,11840, 1264,7744, 1272,15936, 1288,8512,
+    1296,4416, 1304,12608, 1312,2368, 1320,10560, 1328,6464, 1336,14656, 1352,9536, 1360,5440,
+    1368,13632, 1376,3392, 1384,11584, 1392,7488, 1400,15680, 1416,9024, 1424,4928, 1432,13120,
+    1440,2880, 1448,11072, 1456,6976, 1464,15168, 1472,1856, 1480,10048, 1488,5952, 1496,14144,
+    1504,3904, 1512,12096, 1520,8000, 1528,16192, 1544,8384, 1552,4288, 1560,12480, 1568,2240,
+    1576,10432, 1584,6336, 1592,14528, 1608,9408, 1616,5312, 1624,13504, 1632,3264, 1640,11456,
+    1648,7360, 1656,15552, 1672,8896, 1680,4800, 1688,12992, 1696,2752, 1704,10944, 1712,6848,
+    1720,15040, 1736,9920, 1744,5824, 1752,14016, 1760,3776, 1768,11968, 1776,7872, 1784,16064,
+    1800,8640, 1808,4544, 1816,12736, 1824,2496, 1832,10688, 1840,6592, 1848,14784, 1864,9664,
+    1872,5568, 1880,13760, 1888,3520, 1896,11712, 1904,7616, 1912,15808, 1928,9152, 1936,5056,
+    1944,13248, 1952,3008, 1960,11200, 1968,7104, 1976,15296, 1992,10176, 2000,6080, 2008,14272,
+    2016,4032, 2024,12224, 2032,8128, 2040,16320, 2056,8224, 2064,4128, 2072,12320, 2088,10272,
+    2096,6176, 2104,14368, 2120,9248, 2128,5152, 2136,13344, 2144,3104, 2152,11296, 2160,7200,
+    2168,15392, 2184,8736, 2192,4640, 2200,12832, 2208,2592, 2216,10784, 2224,6688, 2232,14880,
+    2248,9760, 2256,5664, 2264,13856, 2272,3616, 2280,11808, 2288,7712, 2296,15904, 2312,8480,
+    2320,4384, 2328,12576, 2344,10528, 2352,6432, 2360,14624, 2376,9504, 2384,5408, 2392,13600,
+    2400,3360, 2408,11552, 2416,7456, 2424,15648, 2440,8992, 2448,4896, 2456,13088, 2464,2848,
+    2472,11040, 2480,6944, 2488,15136, 2504,10016, 2512,5920, 2520,14112, 2528,3872, 2536,12064,
+    2544,7968, 2552,16160, 2568,8352, 2576,4256, 2584,12448, 2600,10400, 2608,6304, 2616,14496,
+    2632,9376, 2640,5280, 2648,13472, 2656,3232, 2664,11424, 2672,7328, 2680,15520, 2696,8864,
+    2704,4768, 2712,12960, 2728,10912, 2736,6816, 2744,15008, 2760,9888, 2768,5792, 2776,13984,
+    2784,3744, 2792,11936, 2800,7840, 2808,16032, 2824,8608, 2832,4512, 2840,12704, 2856,10656,
+    2864,6560, 2872,14752, 2888,9632, 2896,5536, 2904,13728, 2912,3488, 2920,11680, 2928,7584,
+    2936,15776, 2952,9120, 2960,5024, 2968,13216, 2984,11168, 2992,7072, 3000,15264, 3016,10144,
+    3024,6048, 3032,14240, 3040,4000, 3048,12192, 3056,8096, 3064,16288, 3080,8288, 3088,4192,
+    3096,12384, 3112,10336, 3120,6240, 3128,14432, 3144,9312, 3152,5216, 3160,13408, 3176,11360,
+    3184,7264, 3192,15456, 3208,8800, 3216,4704, 3224,12896, 3240,10848, 3248,6752, 3256,14944,
+    3272,9824, 3280,5728, 3288,13920, 3296,3680, 3304,11872, 3312,7776, 3320,15968, 3336,8544,
+    3344,4448, 3352,12640, 3368,10592, 3376,6496, 3384,14688, 3400,9568, 3408,5472, 3416,13664,
+    3432,11616, 3440,7520, 3448,15712, 3464,9056, 3472,4960, 3480,13152, 3496,11104, 3504,7008,
+    3512,15200, 3528,10080, 3536,5984, 3544,14176, 3552,3936, 3560,12128, 3568,8032, 3576,16224,
+    3592,8416, 3600,4320, 3608,12512, 3624,10464, 3632,6368, 3640,14560, 3656,9440, 3664,5344,
+    3672,13536, 3688,11488, 3696,7392, 3704,15584, 3720,8928, 3728,4832, 3736,13024, 3752,10976,
+    3760,6880, 3768,15072, 3784,9952, 3792,5856, 3800,14048, 3816,12000, 3824,7904, 3832,16096,
+    3848,8672, 3856,4576, 3864,12768, 3880,10720, 3888,6624, 3896,14816, 3912,9696, 3920,5600,
+    3928,13792, 3944,11744, 3952,7648, 3960,15840, 3976,9184, 3984,5088, 3992,13280, 4008,11232,
+    4016,7136, 4024,15328, 4040,10208, 4048,6112, 4056,14304, 4072,12256, 4080,8160, 4088,16352,
+    4104,8208, 4120,12304, 4136,10256, 4144,6160, 4152,14352, 4168,9232, 4176,5136, 4184,13328,
+    4200,11280, 4208,7184, 4216,15376, 4232,8720, 4240,4624, 4248,12816, 4264,10768, 4272,6672,
+    4280,14864, 4296,9744, 4304,5648, 4312,13840, 4328,11792, 4336,7696, 4344,15888, 4360,8464,
+    4376,12560, 4392,10512, 4400,6416, 4408,14608, 4424,9488, 4432,5392, 4440,13584, 4456,11536,
+    4464,7440, 4472,15632, 4488,8976, 4496,4880, 4504,13072, 4520,11024, 4528,6928, 4536,15120,
+    4552,10000, 4560,5904, 4568,14096, 4584,12048, 4592,7952, 4600,16144, 4616,8336, 4632,12432,
+    4648,10384, 4656,6288, 4664,14480, 4680,9360, 4688,5264, 4696,13456, 4712,11408, 4720,7312,
+    4728,15504, 4744,8848, 4760,12944, 4776,10896, 4784,6800, 4792,14992, 4808,9872, 4816,5776,
+    4824,13968, 4840,11920, 4848,7824, 4856,16016, 4872,8592, 4888,12688, 4904,10640, 4912,6544,
+    4920,14736, 4936,9616, 4944,5520, 4952,13712, 4968,11664, 4976,7568, 4984,15760, 5000,9104,
+    5016,13200, 5032,11152, 5040,7056, 5048,15248, 5064,10128, 5072,6032, 5080,14224, 5096,12176,
+    5104,8080, 5112,16272, 5128,8272, 5144,12368, 5160,10320, 5168,6224, 5176,14416, 5192,9296,
+    5208,13392, 5224,11344, 5232,7248, 5240,15440, 5256,8784, 5272,12880, 5288,10832, 5296,6736,
+    5304,14928, 5320,9808, 5328,5712, 5336,13904, 5352,11856, 5360,7760, 5368,15952, 5384,8528,
+    5400,12624, 5416,10576, 5424,6480, 5432,14672, 5448,9552, 5464,13648, 5480,11600, 5488,7504,
+    5496,15696, 5512,9040, 5528,13136, 5544,11088, 5552,6992, 5560,15184, 5576,10064, 5584,5968,
+    5592,14160, 5608,12112, 5616,8016, 5624,16208, 5640,8400, 5656,12496, 5672,10448, 5680,6352,
+    5688,14544, 5704,9424, 5720,13520, 5736,11472, 5744,7376, 5752,15568, 5768,8912, 5784,13008,
+    5800,10960, 5808,6864, 5816,15056, 5832,9936, 5848,14032, 5864,11984, 5872,7888, 5880,16080,
+    5896,8656, 5912,12752, 5928,10704, 5936,6608, 5944,14800, 5960,9680, 5976,13776, 5992,11728,
+    6000,7632, 6008,15824, 6024,9168, 6040,13264, 6056,11216, 6064,7120, 6072,15312, 6088,10192,
+    6104,14288, 6120,12240, 6128,8144, 6136,16336, 6152,8240, 6168,12336, 6184,10288, 6200,14384,
+    6216,9264, 6232,13360, 6248,11312, 6256,7216, 6264,15408, 6280,8752, 6296,12848, 6312,10800,
+    6320,6704, 6328,14896, 6344,9776, 6360,13872, 6376,11824, 6384,7728, 6392,15920, 6408,8496,
+    6424,12592, 6440,10544, 6456,14640, 6472,9520, 6488,13616, 6504,11568, 6512,7472, 6520,15664,
+    6536,9008, 6552,13104, 6568,11056, 6576,6960, 6584,15152, 6600,10032, 6616,14128, 6632,12080,
+    6640,7984, 6648,16176, 6664,8368, 6680,12464, 6696,10416, 6712,14512, 6728,9392, 6744,13488,
+    6760,11440, 6768,7344, 6776,15536, 6792,8880, 6808,12976, 6824,10928, 6840,15024, 6856,9904,
+    6872,14000, 6888,11952, 6896,7856, 6904,16048, 6920,8624, 6936,12720, 6952,10672, 6968,14768,
+    6984,9648, 7000,13744, 7016,11696, 7024,7600, 7032,15792, 7048,9136, 7064,13232, 7080,11184,
+    7096,15280, 7112,10160, 7128,14256, 7144,12208, 7152,8112, 7160,16304, 7176,8304, 7192,12400,
+    7208,10352, 7224,14448, 7240,9328, 7256,13424, 7272,11376, 7288,15472, 7304,8816, 7320,12912,
+    7336,10864, 7352,14960, 7368,9840, 7384,13936, 7400,11888, 7408,7792, 7416,15984, 7432,8560,
+    7448,12656, 7464,10608, 7480,14704, 7496,9584, 7512,13680, 7528,11632, 7544,15728, 7560,9072,
+    7576,13168, 7592,11120, 7608,15216, 7624,10096, 7640,14192, 7656,12144, 7664,8048, 7672,16240,
+    7688,8432, 7704,12528, 7720,10480, 7736,14576, 7752,9456, 7768,13552, 7784,11504, 7800,15600,
+    7816,8944, 7832,13040, 7848,10992, 7864,15088, 7880,9968, 7896,14064, 7912,12016, 7928,16112,
+    7944,8688, 7960,12784, 7976,10736, 7992,14832, 8008,9712, 8024,13808, 8040,11760, 8056,15856,
+    8072,9200, 8088,13296, 8104,11248, 8120,15344, 8136,10224, 8152,14320, 8168,12272, 8184,16368,
+    8216,12296, 8232,10248, 8248,14344, 8264,9224, 8280,13320, 8296,11272, 8312,15368, 8328,8712,
+    8344,12808, 8360,10760, 8376,14856, 8392,9736, 8408,13832, 8424,11784, 8440,15880, 8472,12552,
+    8488,10504, 8504,14600, 8520,9480, 8536,13576, 8552,11528, 8568,15624, 8584,8968, 8600,13064,
+    8616,11016, 8632,15112, 8648,9992, 8664,14088, 8680,12040, 8696,16136, 8728,12424, 8744,10376,
+    8760,14472, 8776,9352, 8792,13448, 8808,11400, 8824,15496, 8856,12936, 8872,10888, 8888,14984,
+    8904,9864, 8920,13960, 8936,11912, 8952,16008, 8984,12680, 9000,10632, 9016,14728, 9032,9608,
+    9048,13704, 9064,11656, 9080,15752, 9112,13192, 9128,11144, 9144,15240, 9160,10120, 9176,14216,
+    9192,12168, 9208,16264, 9240,12360, 9256,10312, 9272,14408, 9304,13384, 9320,11336, 9336,15432,
+    9368,12872, 9384,10824, 9400,14920, 9416,9800, 9432,13896, 9448,11848, 9464,15944, 9496,12616,
+    9512,10568, 9528,14664, 9560,13640, 9576,11592, 9592,15688, 9624,13128, 9640,11080, 9656,15176,
+    9672,10056, 9688,14152, 9704,12104, 9720,16200, 9752,12488, 9768,10440, 9784,14536, 9816,13512,
+    9832,11464, 9848,15560, 9880,13000, 9896,10952, 9912,15048, 9944,14024, 9960,11976, 9976,16072,
+    10008,12744, 10024,10696, 10040,14792, 10072,13768, 10088,11720, 10104,15816, 10136,13256, 10152,11208,
+    10168,15304, 10200,14280, 10216,12232, 10232,16328, 10264,12328, 10296,14376, 10328,13352, 10344,11304,
+    10360,15400, 10392,12840, 10408,10792, 10424,14888, 10456,13864, 10472,11816, 10488,15912, 10520,12584,
+    10552,14632, 10584,13608, 10600,11560, 10616,15656, 10648,13096, 10664,11048, 10680,15144, 10712,14120,
+    10728,12072, 10744,16168, 10776,12456, 10808,14504, 10840,13480, 10856,11432, 10872,15528, 10904,12968,
+    10936,15016, 10968,13992, 10984,11944, 11000,16040, 11032,12712, 11064,14760, 11096,13736, 11112,11688,
+    11128,15784, 11160,13224, 11192,15272, 11224,14248, 11240,12200, 11256,16296, 11288,12392, 11320,14440,
+    11352,13416, 11384,15464, 11416,12904, 11448,14952, 11480,13928, 11496,11880, 11512,15976, 11544,12648,
+    11576,14696, 11608,13672, 11640,15720, 11672,13160, 11704,15208, 11736,14184, 11752,12136, 11768,16232,
+    11800,12520, 11832,14568, 11864,13544, 11896,15592, 11928,13032, 11960,15080, 11992,14056, 12024,16104,
+    12056,12776, 12088,14824, 12120,13800, 12152,15848, 12184,13288, 12216,15336, 12248,14312, 12280,16360,
+    12344,14360, 12376,13336, 12408,15384, 12440,12824, 12472,14872, 12504,13848, 12536,15896, 12600,14616,
+    12632,13592, 12664,15640, 12696,13080, 12728,15128, 12760,14104, 12792,16152, 12856,14488, 12888,13464,
+    12920,15512, 12984,15000, 13016,13976, 13048,16024, 13112,14744, 13144,13720, 13176,15768, 13240,15256,
+    13272,14232, 13304,16280, 13368,14424, 13432,15448, 13496,14936, 13528,13912, 13560,15960, 13624,14680,
+    13688,15704, 13752,15192, 13784,14168, 13816,16216, 13880,14552, 13944,15576, 14008,15064, 14072,16088,
+    14136,14808, 14200,15832, 14264,15320, 14328,16344, 14456,15416, 14520,14904, 14584,15928, 14712,15672,
+    14776,15160, 14840,16184, 14968,15544, 15096,16056, 15224,15800, 15352,16312, 15608,15992, 15864,16248
+};
+
+const uint16_t armBitRevIndexTable_fixed_4096[ARMBITREVINDEXTABLE_FIXED_4096_TABLE_LENGTH] =
+{
+    /* radix 4, size 4032 */
+    8,16384, 16,8192, 24,24576, 32,4096, 40,20480, 48,12288, 56,28672, 64,2048,
+    72,18432, 80,10240, 88,26624, 96,6144, 104,22528, 112,14336, 120,30720, 128,1024,
+    136,17408, 144,9216, 152,25600, 160,5120, 168,21504, 176,13312, 184,29696, 192,3072,
+    200,19456, 208,11264, 216,27648, 224,7168, 232,23552, 240,15360, 248,31744, 256,512,
+    264,16896, 272,8704, 280,25088, 288,4608, 296,20992, 304,12800, 312,29184, 320,2560,
+    328,18944, 336,10752, 344,27136, 352,6656, 360,23040, 368,14848, 376,31232, 384,1536,
+    392,17920, 400,9728, 408,26112, 416,5632, 424,22016, 432,13824, 440,30208, 448,3584,
+    456,19968, 464,11776, 472,28160, 480,7680, 488,24064, 496,15872, 504,32256, 520,16640,
+    528,8448, 536,24832, 544,4352, 552,20736, 560,12544, 568,28928, 576,2304, 584,18688,
+    592,10496, 600,26880, 608,6400, 616,22784, 624,14592, 632,30976, 640,1280, 648,17664,
+    656,9472, 664,25856, 672,5376, 680,21760, 688,13568, 696,29952, 704,3328, 712,19712,
+    720,11520, 728,27904, 736,7424, 744,23808, 752,15616, 760,32000, 776,17152, 784,8960,
+    792,25344, 800,4864, 808,21248, 816,13056, 824,29440, 832,2816, 840,19200, 848,11008,
+    856,27392, 864,6912, 872,23296, 880,15104, 888,31488, 896,1792, 904,18176, 912,9984,
+    920,26368, 928,5888, 936,22272, 944,14080, 952,30464, 960,3840, 968,20224, 976,12032,
+    984,28416, 992,7936, 1000,24320, 1008,16128, 1016,32512, 1032,16512, 1040,8320, 1048,24704,
+    1056,4224, 1064,20608, 1072,12416, 1080,28800, 1088,2176, 1096,18560, 1104,10368, 1112,26752,
+    1120,6272, 1128,22656, 1136,14464, 1144,30848, 1160,17536, 1168,9344, 1176,25728, 1184,5248,
+    1192,21632, 1200,13440, 1208,29824, 1216,3200, 1224,19584, 1232,11392, 1240,27776, 1248,7296,
+    1256,23680, 1264,15488, 1272,31872, 1288,17024, 1296,8832, 1304,25216, 1312,4736, 1320,21120,
+    1328,12928, 1336,29312, 1344,2688, 1352,19072, 1360,10880, 1368,27264, 1376,6784, 1384,23168,
+    1392,14976, 1400,31360, 1408,1664, 1416,18048, 1424,9856, 1432,26240, 1440,5760, 1448,22144,
+    1456,13952, 1464,30336, 1472,3712, 1480,20096, 1488,11904, 1496,28288, 1504,7808, 1512,24192,
+    1520,16000, 1528,32384, 1544,16768, 1552,8576, 1560,24960, 1568,4480, 1576,20864, 1584,12672,
+    1592,29056, 1600,2432, 1608,18816, 1616,10624, 1624,27008, 1632,6528, 1640,22912, 1648,14720,
+    1656,31104, 1672,17792, 1680,9600, 1688,25984, 1696,5504, 1704,21888, 1712,13696, 1720,30080,
+    1728,3456, 1736,19840, 1744,11648, 1752,28032, 1760,7552, 1768,23936, 1776,15744, 1784,32128,
+    1800,17280, 1808,9088, 1816,25472, 1824,4992, 1832,21376, 1840,13184, 1848,29568, 1856,2944,
+    1864,19328, 1872,11136, 1880,27520, 1888,7040, 1896,23424, 1904,15232, 1912,31616, 1928,18304,
+    1936,10112, 1944,26496, 1952,6016, 1960,22400, 1968,14208, 1976,30592, 1984,3968, 1992,20352,
+    2000,12160, 2008,28544, 2016,8064, 2024,24448, 2032,16256, 2040,32640, 2056,16448, 2064,8256,
+    2072,24640, 2080,4160, 2088,20544, 2096,12352, 2104,28736, 2120,18496, 2128,10304, 2136,26688,
+    2144,6208, 2152,22592, 2160,14400, 2168,30784, 2184,17472, 2192,9280, 2200,25664, 2208,5184,
+    2216,21568, 2224,13376, 2232,29760, 2240,3136, 2248,19520, 2256,11328, 2264,27712, 2272,7232,
+    2280,23616, 2288,15424, 2296,31808, 2312,16960, 2320,8768, 2328,25152, 2336,4672, 2344,21056,
+    2352,12864, 2360,29248, 2368,2624, 2376,19008, 2384,10816, 2392,27200, 2400,6720, 2408,23104,
+    2416,14912, 2424,31296, 2440,17984, 2448,9792, 2456,26176, 2464,5696, 2472,22080, 2480,13888,
+    2488,30272, 2496,3648, 2504,20032, 2512,11840, 2520,28224, 2528,7744, 2536,24128, 2544,15936,
+    2552,32320, 2568,16704, 2576,8512, 2584,24896, 2592,4416, 2600,20800, 2608,12608, 2616,28992,
+    2632,18752, 2640,10560, 2648,26944, 2656,6464, 2664,22848, 2672,14656, 2680,31040, 2696,17728,
+    2704,9536, 2712,25920, 2720,5440, 2728,21824, 2736,13632, 2744,30016, 2752,3392, 2760,19776,
+    2768,11584, 2776,27968, 2784,7488, 2792,23872, 2800,15680, 2808,32064, 2824,17216, 2832,9024,
+    2840,25408, 2848,4928, 2856,21312, 2864,13120, 2872,29504, 2888,19264, 2896,11072, 2904,27456,
+    2912,6976, 2920,23360, 2928,15168, 2936,31552, 2952,18240, 2960,10048, 2968,26432, 2976,5952,
+    2984,22336, 2992,14144, 3000,30528, 3008,3904, 3016,20288, 3024,12096, 3032,28480, 3040,8000,
+    3048,24384, 3056,16192, 3064,32576, 3080,16576, 3088,8384, 3096,24768, 3104,4288, 3112,20672,
+    3120,12480, 3128,28864, 3144,18624, 3152,10432, 3160,26816, 3168,6336, 3176,22720, 3184,14528,
+    3192,30912, 3208,17600, 3216,9408, 3224,25792, 3232,5312, 3240,21696, 3248,13504, 3256,29888,
+    3272,19648, 3280,11456, 3288,27840, 3296,7360, 3304,23744, 3312,15552, 3320,31936, 3336,17088,
+    3344,8896, 3352,25280, 3360,4800, 3368,21184, 3376,12992, 3384,29376, 3400,19136, 3408,10944,
+    3416,27328, 3424,6848, 3432,23232, 3440,15040, 3448,31424, 3464,18112, 3472,9920, 3480,26304,
+    3488,5824, 3496,22208, 3504,14016, 3512,30400, 3520,3776, 3528,20160, 3536,11968, 3544,28352,
+    3552,7872, 3560,24256, 3568,16064, 3576,32448, 3592,16832, 3600,8640, 3608,25024, 3616,4544,
+    3624,20928, 3632,12736, 3640,29120, 3656,18880, 3664,10688, 3672,27072, 3680,6592, 3688,22976,
+    3696,14784, 3704,31168, 3720,17856, 3728,9664, 3736,26048, 3744,5568, 3752,21952, 3760,13760,
+    3768,30144, 3784,19904, 3792,11712, 3800,28096, 3808,7616, 3816,24000, 3824,15808, 3832,32192,
+    3848,17344, 3856,9152, 3864,25536, 3872,5056, 3880,21440, 3888,13248, 3896,29632, 3912,19392,
+    3920,11200, 3928,27584, 3936,7104, 3944,23488, 3952,15296, 3960,31680, 3976,18368, 3984,10176,
+    3992,26560, 4000,6080, 4008,22464, 4016,14272, 4024,30656, 4040,20416, 4048,12224, 4056,28608,
+    4064,8128, 4072,24512, 4080,16320, 4088,32704, 4104,16416, 4112,8224, 4120,24608, 4136,20512,
+    4144,12320, 4152,28704, 4168,18464, 4176,10272, 4184,26656, 4192,6176, 4200,22560, 4208,14368,
+    4216,30752, 4232,17440, 4240,9248, 4248,25632, 4256,5152, 4264,21536, 4272,13344, 4280,29728,
+    4296,19488, 4304,11296, 4312,27680, 4320,7200, 4328,23584, 4336,15392, 4344,31776, 4360,16928,
+    4368,8736, 4376,25120, 4384,4640, 4392,21024, 4400,12832, 4408,29216, 4424,18976, 4432,10784,
+    4440,27168, 4448,6688, 4456,23072, 4464,14880, 4472,31264, 4488,17952, 4496,9760, 4504,26144,
+    4512,5664, 4520,22048, 4528,13856, 4536,30240, 4552,20000, 4560,11808, 4568,28192, 4576,7712,
+    4584,24096, 4592,15904, 4600,32288, 4616,16672, 4624,8480, 4632,24864, 4648,20768, 4656,12576,
+    4664,28960, 4680,18720, 4688,10528, 4696,26912, 4704,6432, 4712,22816, 4720,14624, 4728,31008,
+    4744,17696, 4752,9504, 4760,25888, 4768,5408, 4776,21792, 4784,13600, 4792,29984, 4808,19744,
+    4816,11552, 4824,27936, 4832,7456, 4840,23840, 4848,15648, 4856,32032, 4872,17184, 4880,8992,
+    4888,25376, 4904,21280, 4912,13088, 4920,29472, 4936,19232, 4944,11040, 4952,27424, 4960,6944,
+    4968,23328, 4976,15136, 4984,31520, 5000,18208, 5008,10016, 5016,26400, 5024,5920, 5032,22304,
+    5040,14112, 5048,30496, 5064,20256, 5072,12064, 5080,28448, 5088,7968, 5096,24352, 5104,16160,
+    5112,32544, 5128,16544, 5136,8352, 5144,24736, 5160,20640, 5168,12448, 5176,28832, 5192,18592,
+    5200,10400, 5208,26784, 5216,6304, 5224,22688, 5232,14496, 5240,30880, 5256,17568, 5264,9376,
+    5272,25760, 5288,21664, 5296,13472, 5304,29856, 5320,19616, 5328,11424, 5336,27808, 5344,7328,
+    5352,23712, 5360,15520, 5368,31904, 5384,17056, 5392,8864, 5400,25248, 5416,21152, 5424,12960,
+    5432,29344, 5448,19104, 5456,10912, 5464,27296, 5472,6816, 5480,23200, 5488,15008, 5496,31392,
+    5512,18080, 5520,9888, 5528,26272, 5536,5792, 5544,22176, 5552,13984, 5560,30368, 5576,20128,
+    5584,11936, 5592,28320, 5600,7840, 5608,24224, 5616,16032, 5624,32416, 5640,16800, 5648,8608,
+    5656,24992, 5672,20896, 5680,12704, 5688,29088, 5704,18848, 5712,10656, 5720,27040, 5728,6560,
+    5736,22944, 5744,14752, 5752,31136, 5768,17824, 5776,9632, 5784,26016, 5800,21920, 5808,13728,
+    5816,30112, 5832,19872, 5840,11680, 5848,28064, 5856,7584, 5864,23968, 5872,15776, 5880,32160,
+    5896,17312, 5904,9120, 5912,25504, 5928,21408, 5936,13216, 5944,29600, 5960,19360, 5968,11168,
+    5976,27552, 5984,7072, 5992,23456, 6000,15264, 6008,31648, 6024,18336, 6032,10144, 6040,26528,
+    6056,22432, 6064,14240, 6072,30624, 6088,20384, 6096,12192, 6104,28576, 6112,8096, 6120,24480,
+    6128,16288, 6136,32672, 6152,16480, 6160,8288, 6168,24672, 6184,20576, 6192,12384, 6200,28768,
+    6216,18528, 6224,10336, 6232,26720, 6248,22624, 6256,14432, 6264,30816, 6280,17504, 6288,9312,
+    6296,25696, 6312,21600, 6320,13408, 6328,29792, 6344,19552, 6352,11360, 6360,27744, 6368,7264,
+    6376,23648, 6384,15456, 6392,31840, 6408,16992, 6416,8800, 6424,25184, 6440,21088, 6448,12896,
+    6456,29280, 6472,19040, 6480,10848, 6488,27232, 6496,6752, 6504,23136, 6512,14944, 6520,31328,
+    6536,18016, 6544,9824, 6552,26208, 6568,22112, 6576,13920, 6584,30304, 6600,20064, 6608,11872,
+    6616,28256, 6624,7776, 6632,24160, 6640,15968, 6648,32352, 6664,16736, 6672,8544, 6680,24928,
+    6696,20832, 6704,12640, 6712,29024, 6728,18784, 6736,10592, 6744,26976, 6760,22880, 6768,14688,
+    6776,31072, 6792,17760, 6800,9568, 6808,25952, 6824,21856, 6832,13664, 6840,30048, 6856,19808,
+    6864,11616, 6872,28000, 6880,7520, 6888,23904, 6896,15712, 6904,32096, 6920,17248, 6928,9056,
+    6936,25440, 6952,21344, 6960,13152, 6968,29536, 6984,19296, 6992,11104, 7000,27488, 7016,23392,
+    7024,15200, 7032,31584, 7048,18272, 7056,10080, 7064,26464, 7080,22368, 7088,14176, 7096,30560,
+    7112,20320, 7120,12128, 7128,28512, 7136,8032, 7144,24416, 7152,16224, 7160,32608, 7176,16608,
+    7184,8416, 7192,24800, 7208,20704, 7216,12512, 7224,28896, 7240,18656, 7248,10464, 7256,26848,
+    7272,22752, 7280,14560, 7288,30944, 7304,17632, 7312,9440, 7320,25824, 7336,21728, 7344,13536,
+    7352,29920, 7368,19680, 7376,11488, 7384,27872, 7400,23776, 7408,15584, 7416,31968, 7432,17120,
+    7440,8928, 7448,25312, 7464,21216, 7472,13024, 7480,29408, 7496,19168, 7504,10976, 7512,27360,
+    7528,23264, 7536,15072, 7544,31456, 7560,18144, 7568,9952, 7576,26336, 7592,22240, 7600,14048,
+    7608,30432, 7624,20192, 7632,12000, 7640,28384, 7648,7904, 7656,24288, 7664,16096, 7672,32480,
+    7688,16864, 7696,8672, 7704,25056, 7720,20960, 7728,12768, 7736,29152, 7752,18912, 7760,10720,
+    7768,27104, 7784,23008, 7792,14816, 7800,31200, 7816,17888, 7824,9696, 7832,26080, 7848,21984,
+    7856,13792, 7864,30176, 7880,19936, 7888,11744, 7896,28128, 7912,24032, 7920,15840, 7928,32224,
+    7944,17376, 7952,9184, 7960,25568, 7976,21472, 7984,13280, 7992,29664, 8008,19424, 8016,11232,
+    8024,27616, 8040,23520, 8048,15328, 8056,31712, 8072,18400, 8080,10208, 8088,26592, 8104,22496,
+    8112,14304, 8120,30688, 8136,20448, 8144,12256, 8152,28640, 8168,24544, 8176,16352, 8184,32736,
+    8200,16400, 8216,24592, 8232,20496, 8240,12304, 8248,28688, 8264,18448, 8272,10256, 8280,26640,
+    8296,22544, 8304,14352, 8312,30736, 8328,17424, 8336,9232, 8344,25616, 8360,21520, 8368,13328,
+    8376,29712, 8392,19472, 8400,11280, 8408,27664, 8424,23568, 8432,15376, 8440,31760, 8456,16912,
+    8464,8720, 8472,25104, 8488,21008, 8496,12816, 8504,29200, 8520,18960, 8528,10768, 8536,27152,
+    8552,23056, 8560,14864, 8568,31248, 8584,17936, 8592,9744, 8600,26128, 8616,22032, 8624,13840,
+    8632,30224, 8648,19984, 8656,11792, 8664,28176, 8680,24080, 8688,15888, 8696,32272, 8712,16656,
+    8728,24848, 8744,20752, 8752,12560, 8760,28944, 8776,18704, 8784,10512, 8792,26896, 8808,22800,
+    8816,14608, 8824,30992, 8840,17680, 8848,9488, 8856,25872, 8872,21776, 8880,13584, 8888,29968,
+    8904,19728, 8912,11536, 8920,27920, 8936,23824, 8944,15632, 8952,32016, 8968,17168, 8984,25360,
+    9000,21264, 9008,13072, 9016,29456, 9032,19216, 9040,11024, 9048,27408, 9064,23312, 9072,15120,
+    9080,31504, 9096,18192, 9104,10000, 9112,26384, 9128,22288, 9136,14096, 9144,30480, 9160,20240,
+    9168,12048, 9176,28432, 9192,24336, 9200,16144, 9208,32528, 9224,16528, 9240,24720, 9256,20624,
+    9264,12432, 9272,28816, 9288,18576, 9296,10384, 9304,26768, 9320,22672, 9328,14480, 9336,30864,
+    9352,17552, 9368,25744, 9384,21648, 9392,13456, 9400,29840, 9416,19600, 9424,11408, 9432,27792,
+    9448,23696, 9456,15504, 9464,31888, 9480,17040, 9496,25232, 9512,21136, 9520,12944, 9528,29328,
+    9544,19088, 9552,10896, 9560,27280, 9576,23184, 9584,14992, 9592,31376, 9608,18064, 9616,9872,
+    9624,26256, 9640,22160, 9648,13968, 9656,30352, 9672,20112, 9680,11920, 9688,28304, 9704,24208,
+    9712,16016, 9720,32400, 9736,16784, 9752,24976, 9768,20880, 9776,12688, 9784,29072, 9800,18832,
+    9808,10640, 9816,27024, 9832,22928, 9840,14736, 9848,31120, 9864,17808, 9880,26000, 9896,21904,
+    9904,13712, 9912,30096, 9928,19856, 9936,11664, 9944,28048, 9960,23952, 9968,15760, 9976,32144,
+    9992,17296, 10008,25488, 10024,21392, 10032,13200, 10040,29584, 10056,19344, 10064,11152, 10072,27536,
+    10088,23440, 10096,15248, 10104,31632, 10120,18320, 10136,26512, 10152,22416, 10160,14224, 10168,30608,
+    10184,20368, 10192,12176, 10200,28560, 10216,24464, 10224,16272, 10232,32656, 10248,16464, 10264,24656,
+    10280,20560, 10288,12368, 10296,28752, 10312,18512, 10328,26704, 10344,22608, 10352,14416, 10360,30800,
+    10376,17488, 10392,25680, 10408,21584, 10416,13392, 10424,29776, 10440,19536, 10448,11344, 10456,27728,
+    10472,23632, 10480,15440, 10488,31824, 10504,16976, 10520,25168, 10536,21072, 10544,12880, 10552,29264,
+    10568,19024, 10576,10832, 10584,27216, 10600,23120, 10608,14928, 10616,31312, 10632,18000, 10648,26192,
+    10664,22096, 10672,13904, 10680,30288, 10696,20048, 10704,11856, 10712,28240, 10728,24144, 10736,15952,
+    10744,32336, 10760,16720, 10776,24912, 10792,20816, 10800,12624, 10808,29008, 10824,18768, 10840,26960,
+    10856,22864, 10864,14672, 10872,31056, 10888,17744, 10904,25936, 10920,21840, 10928,13648, 10936,30032,
+    10952,19792, 10960,11600, 10968,27984, 10984,23888, 10992,15696, 11000,32080, 11016,17232, 11032,25424,
+    11048,21328, 11056,13136, 11064,29520, 11080,19280, 11096,27472, 11112,23376, 11120,15184, 11128,31568,
+    11144,18256, 11160,26448, 11176,22352, 11184,14160, 11192,30544, 11208,20304, 11216,12112, 11224,28496,
+    11240,24400, 11248,16208, 11256,32592, 11272,16592, 11288,24784, 11304,20688, 11312,12496, 11320,28880,
+    11336,18640, 11352,26832, 11368,22736, 11376,14544, 11384,30928, 11400,17616, 11416,25808, 11432,21712,
+    11440,13520, 11448,29904, 11464,19664, 11480,27856, 11496,23760, 11504,15568, 11512,31952, 11528,17104,
+    11544,25296, 11560,21200, 11568,13008, 11576,29392, 11592,19152, 11608,27344, 11624,23248, 11632,15056,
+    11640,31440, 11656,18128, 11672,26320, 11688,22224, 11696,14032, 11704,30416, 11720,20176, 11728,11984,
+    11736,28368, 11752,24272, 11760,16080, 11768,32464, 11784,16848, 11800,25040, 11816,20944, 11824,12752,
+    11832,29136, 11848,18896, 11864,27088, 11880,22992, 11888,14800, 11896,31184, 11912,17872, 11928,26064,
+    11944,21968, 11952,13776, 11960,30160, 11976,19920, 11992,28112, 12008,24016, 12016,15824, 12024,32208,
+    12040,17360, 12056,25552, 12072,21456, 12080,13264, 12088,29648, 12104,19408, 12120,27600, 12136,23504,
+    12144,15312, 12152,31696, 12168,18384, 12184,26576, 12200,22480, 12208,14288, 12216,30672, 12232,20432,
+    12248,28624, 12264,24528, 12272,16336, 12280,32720, 12296,16432, 12312,24624, 12328,20528, 12344,28720,
+    12360,18480, 12376,26672, 12392,22576, 12400,14384, 12408,30768, 12424,17456, 12440,25648, 12456,21552,
+    12464,13360, 12472,29744, 12488,19504, 12504,27696, 12520,23600, 12528,15408, 12536,31792, 12552,16944,
+    12568,25136, 12584,21040, 12592,12848, 12600,29232, 12616,18992, 12632,27184, 12648,23088, 12656,14896,
+    12664,31280, 12680,17968, 12696,26160, 12712,22064, 12720,13872, 12728,30256, 12744,20016, 12760,28208,
+    12776,24112, 12784,15920, 12792,32304, 12808,16688, 12824,24880, 12840,20784, 12856,28976, 12872,18736,
+    12888,26928, 12904,22832, 12912,14640, 12920,31024, 12936,17712, 12952,25904, 12968,21808, 12976,13616,
+    12984,30000, 13000,19760, 13016,27952, 13032,23856, 13040,15664, 13048,32048, 13064,17200, 13080,25392,
+    13096,21296, 13112,29488, 13128,19248, 13144,27440, 13160,23344, 13168,15152, 13176,31536, 13192,18224,
+    13208,26416, 13224,22320, 13232,14128, 13240,30512, 13256,20272, 13272,28464, 13288,24368, 13296,16176,
+    13304,32560, 13320,16560, 13336,24752, 13352,20656, 13368,28848, 13384,18608, 13400,26800, 13416,22704,
+    13424,14512, 13432,30896, 13448,17584, 13464,25776, 13480,21680, 13496,29872, 13512,19632, 13528,27824,
+    13544,23728, 13552,15536, 13560,31920, 13576,17072, 13592,25264, 13608,21168, 13624,29360, 13640,19120,
+    13656,27312, 13672,23216, 13680,15024, 13688,31408, 13704,18096, 13720,26288, 13736,22192, 13744,14000,
+    13752,30384, 13768,20144, 13784,28336, 13800,24240, 13808,16048, 13816,32432, 13832,16816, 13848,25008,
+    13864,20912, 13880,29104, 13896,18864, 13912,27056, 13928,22960, 13936,14768, 13944,31152, 13960,17840,
+    13976,26032, 13992,21936, 14008,30128, 14024,19888, 14040,28080, 14056,23984, 14064,15792, 14072,32176,
+    14088,17328, 14104,25520, 14120,21424, 14136,29616, 14152,19376, 14168,27568, 14184,23472, 14192,15280,
+    14200,31664, 14216,18352, 14232,26544, 14248,22448, 14264,30640, 14280,20400, 14296,28592, 14312,24496,
+    14320,16304, 14328,32688, 14344,16496, 14360,24688, 14376,20592, 14392,28784, 14408,18544, 14424,26736,
+    14440,22640, 14456,30832, 14472,17520, 14488,25712, 14504,21616, 14520,29808, 14536,19568, 14552,27760,
+    14568,23664, 14576,15472, 14584,31856, 14600,17008, 14616,25200, 14632,21104, 14648,29296, 14664,19056,
+    14680,27248, 14696,23152, 14704,14960, 14712,31344, 14728,18032, 14744,26224, 14760,22128, 14776,30320,
+    14792,20080, 14808,28272, 14824,24176, 14832,15984, 14840,32368, 14856,16752, 14872,24944, 14888,20848,
+    14904,29040, 14920,18800, 14936,26992, 14952,22896, 14968,31088, 14984,17776, 15000,25968, 15016,21872,
+    15032,30064, 15048,19824, 15064,28016, 15080,23920, 15088,15728, 15096,32112, 15112,17264, 15128,25456,
+    15144,21360, 15160,29552, 15176,19312, 15192,27504, 15208,23408, 15224,31600, 15240,18288, 15256,26480,
+    15272,22384, 15288,30576, 15304,20336, 15320,28528, 15336,24432, 15344,16240, 15352,32624, 15368,16624,
+    15384,24816, 15400,20720, 15416,28912, 15432,18672, 15448,26864, 15464,22768, 15480,30960, 15496,17648,
+    15512,25840, 15528,21744, 15544,29936, 15560,19696, 15576,27888, 15592,23792, 15608,31984, 15624,17136,
+    15640,25328, 15656,21232, 15672,29424, 15688,19184, 15704,27376, 15720,23280, 15736,31472, 15752,18160,
+    15768,26352, 15784,22256, 15800,30448, 15816,20208, 15832,28400, 15848,24304, 15856,16112, 15864,32496,
+    15880,16880, 15896,25072, 15912,20976, 15928,29168, 15944,18928, 15960,27120, 15976,23024, 15992,31216,
+    16008,17904, 16024,26096, 16040,22000, 16056,30192, 16072,19952, 16088,28144, 16104,24048, 16120,32240,
+    16136,17392, 16152,25584, 16168,21488, 16184,29680, 16200,19440, 16216,27632, 16232,23536, 16248,31728,
+    16264,18416, 16280,26608, 16296,22512, 16312,30704, 16328,20464, 16344,28656, 16360,24560, 16376,32752,
+    16408,24584, 16424,20488, 16440,28680, 16456,18440, 16472,26632, 16488,22536, 16504,30728, 16520,17416,
+    16536,25608, 16552,21512, 16568,29704, 16584,19464, 16600,27656, 16616,23560, 16632,31752, 16648,16904,
+    16664,25096, 16680,21000, 16696,29192, 16712,18952, 16728,27144, 16744,23048, 16760,31240, 16776,17928,
+    16792,26120, 16808,22024, 16824,30216, 16840,19976, 16856,28168, 16872,24072, 16888,32264, 16920,24840,
+    16936,20744, 16952,28936, 16968,18696, 16984,26888, 17000,22792, 17016,30984, 17032,17672, 17048,25864,
+    17064,21768, 17080,29960, 17096,19720, 17112,27912, 17128,23816, 17144,32008, 17176,25352, 17192,21256,
+    17208,29448, 17224,19208, 17240,27400, 17256,23304, 17272,31496, 17288,18184, 17304,26376, 17320,22280,
+    17336,30472, 17352,20232, 17368,28424, 17384,24328, 17400,32520, 17432,24712, 17448,20616, 17464,28808,
+    17480,18568, 17496,26760, 17512,22664, 17528,30856, 17560,25736, 17576,21640, 17592,29832, 17608,19592,
+    17624,27784, 17640,23688, 17656,31880, 17688,25224, 17704,21128, 17720,29320, 17736,19080, 17752,27272,
+    17768,23176, 17784,31368, 17800,18056, 17816,26248, 17832,22152, 17848,30344, 17864,20104, 17880,28296,
+    17896,24200, 17912,32392, 17944,24968, 17960,20872, 17976,29064, 17992,18824, 18008,27016, 18024,22920,
+    18040,31112, 18072,25992, 18088,21896, 18104,30088, 18120,19848, 18136,28040, 18152,23944, 18168,32136,
+    18200,25480, 18216,21384, 18232,29576, 18248,19336, 18264,27528, 18280,23432, 18296,31624, 18328,26504,
+    18344,22408, 18360,30600, 18376,20360, 18392,28552, 18408,24456, 18424,32648, 18456,24648, 18472,20552,
+    18488,28744, 18520,26696, 18536,22600, 18552,30792, 18584,25672, 18600,21576, 18616,29768, 18632,19528,
+    18648,27720, 18664,23624, 18680,31816, 18712,25160, 18728,21064, 18744,29256, 18760,19016, 18776,27208,
+    18792,23112, 18808,31304, 18840,26184, 18856,22088, 18872,30280, 18888,20040, 18904,28232, 18920,24136,
+    18936,32328, 18968,24904, 18984,20808, 19000,29000, 19032,26952, 19048,22856, 19064,31048, 19096,25928,
+    19112,21832, 19128,30024, 19144,19784, 19160,27976, 19176,23880, 19192,32072, 19224,25416, 19240,21320,
+    19256,29512, 19288,27464, 19304,23368, 19320,31560, 19352,26440, 19368,22344, 19384,30536, 19400,20296,
+    19416,28488, 19432,24392, 19448,32584, 19480,24776, 19496,20680, 19512,28872, 19544,26824, 19560,22728,
+    19576,30920, 19608,25800, 19624,21704, 19640,29896, 19672,27848, 19688,23752, 19704,31944, 19736,25288,
+    19752,21192, 19768,29384, 19800,27336, 19816,23240, 19832,31432, 19864,26312, 19880,22216, 19896,30408,
+    19912,20168, 19928,28360, 19944,24264, 19960,32456, 19992,25032, 20008,20936, 20024,29128, 20056,27080,
+    20072,22984, 20088,31176, 20120,26056, 20136,21960, 20152,30152, 20184,28104, 20200,24008, 20216,32200,
+    20248,25544, 20264,21448, 20280,29640, 20312,27592, 20328,23496, 20344,31688, 20376,26568, 20392,22472,
+    20408,30664, 20440,28616, 20456,24520, 20472,32712, 20504,24616, 20536,28712, 20568,26664, 20584,22568,
+    20600,30760, 20632,25640, 20648,21544, 20664,29736, 20696,27688, 20712,23592, 20728,31784, 20760,25128,
+    20776,21032, 20792,29224, 20824,27176, 20840,23080, 20856,31272, 20888,26152, 20904,22056, 20920,30248,
+    20952,28200, 20968,24104, 20984,32296, 21016,24872, 21048,28968, 21080,26920, 21096,22824, 21112,31016,
+    21144,25896, 21160,21800, 21176,29992, 21208,27944, 21224,23848, 21240,32040, 21272,25384, 21304,29480,
+    21336,27432, 21352,23336, 21368,31528, 21400,26408, 21416,22312, 21432,30504, 21464,28456, 21480,24360,
+    21496,32552, 21528,24744, 21560,28840, 21592,26792, 21608,22696, 21624,30888, 21656,25768, 21688,29864,
+    21720,27816, 21736,23720, 21752,31912, 21784,25256, 21816,29352, 21848,27304, 21864,23208, 21880,31400,
+    21912,26280, 21928,22184, 21944,30376, 21976,28328, 21992,24232, 22008,32424, 22040,25000, 22072,29096,
+    22104,27048, 22120,22952, 22136,31144, 22168,26024, 22200,30120, 22232,28072, 22248,23976, 22264,32168,
+    22296,25512, 22328,29608, 22360,27560, 22376,23464, 22392,31656, 22424,26536, 22456,30632, 22488,28584,
+    22504,24488, 22520,32680, 22552,24680, 22584,28776, 22616,26728, 22648,30824, 22680,25704, 22712,29800,
+    22744,27752, 22760,23656, 22776,31848, 22808,25192, 22840,29288, 22872,27240, 22888,23144, 22904,31336,
+    22936,26216, 22968,30312, 23000,28264, 23016,24168, 23032,32360, 23064,24936, 23096,29032, 23128,26984,
+    23160,31080, 23192,25960, 23224,30056, 23256,28008, 23272,23912, 23288,32104, 23320,25448, 23352,29544,
+    23384,27496, 23416,31592, 23448,26472, 23480,30568, 23512,28520, 23528,24424, 23544,32616, 23576,24808,
+    23608,28904, 23640,26856, 23672,30952, 23704,25832, 23736,29928, 23768,27880, 23800,31976, 23832,25320,
+    23864,29416, 23896,27368, 23928,31464, 23960,26344, 23992,30440, 24024,28392, 24040,24296, 24056,32488,
+    24088,25064, 24120,29160, 24152,27112, 24184,31208, 24216,26088, 24248,30184, 24280,28136, 24312,32232,
+    24344,25576, 24376,29672, 24408,27624, 24440,31720, 24472,26600, 24504,30696, 24536,28648, 24568,32744,
+    24632,28696, 24664,26648, 24696,30744, 24728,25624, 24760,29720, 24792,27672, 24824,31768, 24856,25112,
+    24888,29208, 24920,27160, 24952,31256, 24984,26136, 25016,30232, 25048,28184, 25080,32280, 25144,28952,
+    25176,26904, 25208,31000, 25240,25880, 25272,29976, 25304,27928, 25336,32024, 25400,29464, 25432,27416,
+    25464,31512, 25496,26392, 25528,30488, 25560,28440, 25592,32536, 25656,28824, 25688,26776, 25720,30872,
+    25784,29848, 25816,27800, 25848,31896, 25912,29336, 25944,27288, 25976,31384, 26008,26264, 26040,30360,
+    26072,28312, 26104,32408, 26168,29080, 26200,27032, 26232,31128, 26296,30104, 26328,28056, 26360,32152,
+    26424,29592, 26456,27544, 26488,31640, 26552,30616, 26584,28568, 26616,32664, 26680,28760, 26744,30808,
+    26808,29784, 26840,27736, 26872,31832, 26936,29272, 26968,27224, 27000,31320, 27064,30296, 27096,28248,
+    27128,32344, 27192,29016, 27256,31064, 27320,30040, 27352,27992, 27384,32088, 27448,29528, 27512,31576,
+    27576,30552, 27608,28504, 27640,32600, 27704,28888, 27768,30936, 27832,29912, 27896,31960, 27960,29400,
+    28024,31448, 28088,30424, 28120,28376, 28152,32472, 28216,29144, 28280,31192, 28344,30168, 28408,32216,
+    28472,29656, 28536,31704, 28600,30680, 28664,32728, 28792,30776, 28856,29752, 28920,31800, 28984,29240,
+    29048,31288, 29112,30264, 29176,32312, 29304,31032, 29368,30008, 29432,32056, 29560,31544, 29624,30520,
+    29688,32568, 29816,30904, 29944,31928, 30072,31416, 30136,30392, 30200,32440, 30328,31160, 30456,32184,
+    30584,31672, 30712,32696, 30968,31864, 31096,31352, 31224,32376, 31480,32120, 31736,32632, 32248,32504
+};
+
+#endif /* !RFFT_Q15_NO_BITREV_TABLES */
+
+#if defined(RFFT_Q15_STOCKHAM)
+
+/* ========================================================================= */
+/* Stockham Stage Tables                                                     */
+/* ========================================================================= */
+
+/*
+ * The twiddles of RFFT_TWIDDLE_TABLE in the order arm_cfft_q15_stockham()
+ * reads them, so each stage reads its table front to back. Values are
+ * those of the shared table, whatever the twiddle build.
+ */
+
+/* (w1, w2, w3) per butterfly of the 16-point radix-4 stages */
+const q15_t rfftStockhamQ15_16[24] RFFT_Q15_ALIGN =
+{
+    (q15_t)0x7FFF, (q15_t)0x0000, (q15_t)0x7FFF, (q15_t)0x0000, (q15_t)0x7FFF, (q15_t)0x0000, (q15_t)0x7641, (q15_t)0x30FB,
+    (q15_t)0x5A82, (q15_t)0x5A82, (q15_t)0x30FB, (q15_t)0x7641, (q15_t)0x5A82, (q15_t)0x5A82, (q15_t)0x0000, (q15_t)0x7FFF,
+    (q15_t)0xA57D, (q15_t)0x5A82, (q15_t)0x30FB, (q15_t)0x7641, (q15_t)0xA57D, (q15_t)0x5A82, (q15_t)0x89BE, (q15_t)0xCF04
+};
+
+/* (w1, w2, w3) per butterfly of the 64-point radix-4 stages */
+const q15_t rfftStockhamQ15_64[96] RFFT_Q15_ALIGN =
+{
+    (q15_t)0x7FFF, (q15_t)0x0000, (q15_t)0x7FFF, (q15_t)0x0000, (q15_t)0x7FFF, (q15_t)0x0000, (q15_t)0x7F62, (q15_t)0x0C8B,
+    (q15_t)0x7D8A, (q15_t)0x18F8, (q15_t)0x7A7D, (q15_t)0x2528, (q15_t)0x7D8A, (q15_t)0x18F8, (q15_t)0x7641, (q15_t)0x30FB,
+    (q15_t)0x6A6D, (q15_t)0x471C, (q15_t)0x7A7D, (q15_t)0x2528, (q15_t)0x6A6D, (q15_t)0x471C, (q15_t)0x5133, (q15_t)0x62F2,
+    (q15_t)0x7641, (q15_t)0x30FB, (q15_t)0x5A82, (q15_t)0x5A82, (q15_t)0x30FB, (q15_t)0x7641, (q15_t)0x70E2, (q15_t)0x3C56,
+    (q15_t)0x471C, (q15_t)0x6A6D, (q15_t)0x0C8B, (q15_t)0x7F62, (q15_t)0x6A6D, (q15_t)0x471C, (q15_t)0x30FB, (q15_t)0x7641,
+    (q15_t)0xE707, (q15_t)0x7D8A, (q15_t)0x62F2, (q15_t)0x5133, (q15_t)0x18F8, (q15_t)0x7D8A, (q15_t)0xC3A9, (q15_t)0x70E2,
+    (q15_t)0x5A82, (q15_t)0x5A82, (q15_t)0x0000, (q15_t)0x7FFF, (q15_t)0xA57D, (q15_t)0x5A82, (q15_t)0x5133, (q15_t)0x62F2,
+    (q15_t)0xE707, (q15_t)0x7D8A, (q15_t)0x8F1D, (q15_t)0x3C56, (q15_t)0x471C, (q15_t)0x6A6D, (q15_t)0xCF04, (q15_t)0x7641,
+    (q15_t)0x8275, (q15_t)0x18F8, (q15_t)0x3C56, (q15_t)0x70E2, (q15_t)0xB8E3, (q15_t)0x6A6D, (q15_t)0x809D, (q15_t)0xF374,
+    (q15_t)0x30FB, (q15_t)0x7641, (q15_t)0xA57D, (q15_t)0x5A82, (q15_t)0x89BE, (q15_t)0xCF04, (q15_t)0x2528, (q15_t)0x7A7D,
+    (q15_t)0x9592, (q15_t)0x471C, (q15_t)0x9D0D, (q15_t)0xAECC, (q15_t)0x18F8, (q15_t)0x7D8A, (q15_t)0x89BE, (q15_t)0x30FB,
+    (q15_t)0xB8E3, (q15_t)0x9592, (q15_t)0x0C8B, (q15_t)0x7F62, (q15_t)0x8275, (q15_t)0x18F8, (q15_t)0xDAD7, (q15_t)0x8582
+};
+
+/* (w1, w2, w3) per butterfly of the 256-point radix-4 stages */
+const q15_t rfftStockhamQ15_256[384] RFFT_Q15_ALIGN =
+{
+    (q15_t)0x7FFF, (q15_t)0x0000, (q15_t)0x7FFF, (q15_t)0x0000, (q15_t)0x7FFF, (q15_t)0x0000, (q15_t)0x7FF6, (q15_t)0x0324,
+    (q15_t)0x7FD8, (q15_t)0x0647, (q15_t)0x7FA7, (q15_t)0x096A, (q15_t)0x7FD8, (q15_t)0x0647, (q15_t)0x7F62, (q15_t)0x0C8B,
+    (q15_t)0x7E9D, (q15_t)0x12C8, (q15_t)0x7FA7, (q15_t)0x096A, (q15_t)0x7E9D, (q15_t)0x12C8, (q15_t)0x7CE3, (q15_t)0x1C0B,
+    (q15_t)0x7F62, (q15_t)0x0C8B, (q15_t)0x7D8A, (q15_t)0x18F8, (q15_t)0x7A7D, (q15_t)0x2528, (q15_t)0x7F09, (q15_t)0x0FAB,
+    (q15_t)0x7C29, (q15_t)0x1F19, (q15_t)0x776C, (q15_t)0x2E11, (q15_t)0x7E9D, (q15_t)0x12C8, (q15_t)0x7A7D, (q15_t)0x2528,
+    (q15_t)0x73B5, (q15_t)0x36BA, (q15_t)0x7E1D, (q15_t)0x15E2, (q15_t)0x7884, (q15_t)0x2B1F, (q15_t)0x6F5F, (q15_t)0x3F17,
+    (q15_t)0x7D8A, (q15_t)0x18F8, (q15_t)0x7641, (q15_t)0x30FB, (q15_t)0x6A6D, (q15_t)0x471C, (q15_t)0x7CE3, (q15_t)0x1C0B,
+    (q15_t)0x73B5, (q15_t)0x36BA, (q15_t)0x64E8, (q15_t)0x4EBF, (q15_t)0x7C29, (q15_t)0x1F19, (q15_t)0x70E2, (q15_t)0x3C56,
+    (q15_t)0x5ED7, (q15_t)0x55F5, (q15_t)0x7B5D, (q15_t)0x2223, (q15_t)0x6DCA, (q15_t)0x41CE, (q15_t)0x5842, (q15_t)0x5CB4,
+    (q15_t)0x7A7D, (q15_t)0x2528, (q15_t)0x6A6D, (q15_t)0x471C, (q15_t)0x5133, (q15_t)0x62F2, (q15_t)0x798A, (q15_t)0x2826,
+    (q15_t)0x66CF, (q15_t)0x4C3F, (q15_t)0x49B4, (q15_t)0x68A6, (q15_t)0x7884, (q15_t)0x2B1F, (q15_t)0x62F2, (q15_t)0x5133,
+    (q15_t)0x41CE, (q15_t)0x6DCA, (q15_t)0x776C, (q15_t)0x2E11, (q15_t)0x5ED7, (q15_t)0x55F5, (q15_t)0x398C, (q15_t)0x7255,
+    (q15_t)0x7641, (q15_t)0x30FB, (q15_t)0x5A82, (q15_t)0x5A82, (q15_t)0x30FB, (q15_t)0x7641, (q15_t)0x7504, (q15_t)0x33DE,
+    (q15_t)0x55F5, (q15_t)0x5ED7, (q15_t)0x2826, (q15_t)0x798A, (q15_t)0x73B5, (q15_t)0x36BA, (q15_t)0x5133, (q15_t)0x62F2,
+    (q15_t)0x1F19, (q15_t)0x7C29, (q15_t)0x7255, (q15_t)0x398C, (q15_t)0x4C3F, (q15_t)0x66CF, (q15_t)0x15E2, (q15_t)0x7E1D,
+    (q15_t)0x70E2, (q15_t)0x3C56, (q15_t)0x471C, (q15_t)0x6A6D, (q15_t)0x0C8B, (q15_t)0x7F62, (q15_t)0x6F5F, (q15_t)0x3F17,
+    (q15_t)0x41CE, (q15_t)0x6DCA, (q15_t)0x0324, (q15_t)0x7FF6, (q15_t)0x6DCA, (q15_t)0x41CE, (q15_t)0x3C56, (q15_t)0x70E2,
+    (q15_t)0xF9B8, (q15_t)0x7FD8, (q15_t)0x6C24, (q15_t)0x447A, (q15_t)0x36BA, (q15_t)0x73B5, (q15_t)0xF054, (q15_t)0x7F09,
+    (q15_t)0x6A6D, (q15_t)0x471C, (q15_t)0x30FB, (q15_t)0x7641, (q15_t)0xE707, (q15_t)0x7D8A, (q15_t)0x68A6, (q15_t)0x49B4,
+    (q15_t)0x2B1F, (q15_t)0x7884, (q15_t)0xDDDC, (q15_t)0x7B5D, (q15_t)0x66CF, (q15_t)0x4C3F, (q15_t)0x2528, (q15_t)0x7A7D,
+    (q15_t)0xD4E0, (q15_t)0x7884, (q15_t)0x64E8, (q15_t)0x4EBF, (q15_t)0x1F19, (q15_t)0x7C29, (q15_t)0xCC21, (q15_t)0x7504,
+    (q15_t)0x62F2, (q15_t)0x5133, (q15_t)0x18F8, (q15_t)0x7D8A, (q15_t)0xC3A9, (q15_t)0x70E2, (q15_t)0x60EC, (q15_t)0x539B,
+    (q15_t)0x12C8, (q15_t)0x7E9D, (q15_t)0xBB85, (q15_t)0x6C24, (q15_t)0x5ED7, (q15_t)0x55F5, (q15_t)0x0C8B, (q15_t)0x7F62,
+    (q15_t)0xB3C0, (q15_t)0x66CF, (q15_t)0x5CB4, (q15_t)0x5842, (q15_t)0x0647, (q15_t)0x7FD8, (q15_t)0xAC64, (q15_t)0x60EC,
+    (q15_t)0x5A82, (q15_t)0x5A82, (q15_t)0x0000, (q15_t)0x7FFF, (q15_t)0xA57D, (q15_t)0x5A82, (q15_t)0x5842, (q15_t)0x5CB4,
+    (q15_t)0xF9B8, (q15_t)0x7FD8, (q15_t)0x9F13, (q15_t)0x539B, (q15_t)0x55F5, (q15_t)0x5ED7, (q15_t)0xF374, (q15_t)0x7F62,
+    (q15_t)0x9930, (q15_t)0x4C3F, (q15_t)0x539B, (q15_t)0x60EC, (q15_t)0xED37, (q15_t)0x7E9D, (q15_t)0x93DB, (q15_t)0x447A,
+    (q15_t)0x5133, (q15_t)0x62F2, (q15_t)0xE707, (q15_t)0x7D8A, (q15_t)0x8F1D, (q15_t)0x3C56, (q15_t)0x4EBF, (q15_t)0x64E8,
+    (q15_t)0xE0E6, (q15_t)0x7C29, (q15_t)0x8AFB, (q15_t)0x33DE, (q15_t)0x4C3F, (q15_t)0x66CF, (q15_t)0xDAD7, (q15_t)0x7A7D,
+    (q15_t)0x877B, (q15_t)0x2B1F, (q15_t)0x49B4, (q15_t)0x68A6, (q15_t)0xD4E0, (q15_t)0x7884, (q15_t)0x84A2, (q15_t)0x2223,
+    (q15_t)0x471C, (q15_t)0x6A6D, (q15_t)0xCF04, (q15_t)0x7641, (q15_t)0x8275, (q15_t)0x18F8, (q15_t)0x447A, (q15_t)0x6C24,
+    (q15_t)0xC945, (q15_t)0x73B5, (q15_t)0x80F6, (q15_t)0x0FAB, (q15_t)0x41CE, (q15_t)0x6DCA, (q15_t)0xC3A9, (q15_t)0x70E2,
+    (q15_t)0x8027, (q15_t)0x0647, (q15_t)0x3F17, (q15_t)0x6F5F, (q15_t)0xBE31, (q15_t)0x6DCA, (q15_t)0x8009, (q15_t)0xFCDB,
+    (q15_t)0x3C56, (q15_t)0x70E2, (q15_t)0xB8E3, (q15_t)0x6A6D, (q15_t)0x809D, (q15_t)0xF374, (q15_t)0x398C, (q15_t)0x7255,
+    (q15_t)0xB3C0, (q15_t)0x66CF, (q15_t)0x81E2, (q15_t)0xEA1D, (q15_t)0x36BA, (q15_t)0x73B5, (q15_t)0xAECC, (q15_t)0x62F2,
+    (q15_t)0x83D6, (q15_t)0xE0E6, (q15_t)0x33DE, (q15_t)0x7504, (q15_t)0xAA0A, (q15_t)0x5ED7, (q15_t)0x8675, (q15_t)0xD7D9,
+    (q15_t)0x30FB, (q15_t)0x7641, (q15_t)0xA57D, (q15_t)0x5A82, (q15_t)0x89BE, (q15_t)0xCF04, (q15_t)0x2E11, (q15_t)0x776C,
+    (q15_t)0xA128, (q15_t)0x55F5, (q15_t)0x8DAA, (q15_t)0xC673, (q15_t)0x2B1F, (q15_t)0x7884, (q15_t)0x9D0D, (q15_t)0x5133,
+    (q15_t)0x9235, (q15_t)0xBE31, (q15_t)0x2826, (q15_t)0x798A, (q15_t)0x9930, (q15_t)0x4C3F, (q15_t)0x9759, (q15_t)0xB64B,
+    (q15_t)0x2528, (q15_t)0x7A7D, (q15_t)0x9592, (q15_t)0x471C, (q15_t)0x9D0D, (q15_t)0xAECC, (q15_t)0x2223, (q15_t)0x7B5D,
+    (q15_t)0x9235, (q15_t)0x41CE, (q15_t)0xA34B, (q15_t)0xA7BD, (q15_t)0x1F19, (q15_t)0x7C29, (q15_t)0x8F1D, (q15_t)0x3C56,
+    (q15_t)0xAA0A, (q15_t)0xA128, (q15_t)0x1C0B, (q15_t)0x7CE3, (q15_t)0x8C4A, (q15_t)0x36BA, (q15_t)0xB140, (q15_t)0x9B17,
+    (q15_t)0x18F8, (q15_t)0x7D8A, (q15_t)0x89BE, (q15_t)0x30FB, (q15_t)0xB8E3, (q15_t)0x9592, (q15_t)0x15E2, (q15_t)0x7E1D,
+    (q15_t)0x877B, (q15_t)0x2B1F, (q15_t)0xC0E8, (q15_t)0x90A0, (q15_t)0x12C8, (q15_t)0x7E9D, (q15_t)0x8582, (q15_t)0x2528,
+    (q15_t)0xC945, (q15_t)0x8C4A, (q15_t)0x0FAB, (q15_t)0x7F09, (q15_t)0x83D6, (q15_t)0x1F19, (q15_t)0xD1EE, (q15_t)0x8893,
+    (q15_t)0x0C8B, (q15_t)0x7F62, (q15_t)0x8275, (q15_t)0x18F8, (q15_t)0xDAD7, (q15_t)0x8582, (q15_t)0x096A, (q15_t)0x7FA7,
+    (q15_t)0x8162, (q15_t)0x12C8, (q15_t)0xE3F4, (q15_t)0x831C, (q15_t)0x0647, (q15_t)0x7FD8, (q15_t)0x809D, (q15_t)0x0C8B,
+    (q15_t)0xED37, (q15_t)0x8162, (q15_t)0x0324, (q15_t)0x7FF6, (q15_t)0x8027, (q15_t)0x0647, (q15_t)0xF695, (q15_t)0x8058
+};
+
+/* (w1, w2, w3) per butterfly of the 1024-point radix-4 stages */
+const q15_t rfftStockhamQ15_1024[1536] RFFT_Q15_ALIGN =
+{
+    (q15_t)0x7FFF, (q15_t)0x0000, (q15_t)0x7FFF, (q15_t)0x0000, (q15_t)0x7FFF, (q15_t)0x0000, (q15_t)0x7FFF, (q15_t)0x00C9,
+    (q15_t)0x7FFD, (q15_t)0x0192, (q15_t)0x7FFA, (q15_t)0x025B, (q15_t)0x7FFD, (q15_t)0x0192, (q15_t)0x7FF6, (q15_t)0x0324,
+    (q15_t)0x7FE9, (q15_t)0x04B6, (q15_t)0x7FFA, (q15_t)0x025B, (q15_t)0x7FE9, (q15_t)0x04B6, (q15_t)0x7FCE, (q15_t)0x0710,
+    (q15_t)0x7FF6, (q15_t)0x0324, (q15_t)0x7FD8, (q15_t)0x0647, (q15_t)0x7FA7, (q15_t)0x096A, (q15_t)0x7FF0, (q15_t)0x03ED,
+    (q15_t)0x7FC2, (q15_t)0x07D9, (q15_t)0x7F75, (q15_t)0x0BC3, (q15_t)0x7FE9, (q15_t)0x04B6, (q15_t)0x7FA7, (q15_t)0x096A,
+    (q15_t)0x7F38, (q15_t)0x0E1B, (q15_t)0x7FE1, (q15_t)0x057F, (q15_t)0x7F87, (q15_t)0x0AFB, (q15_t)0x7EF0, (q15_t)0x1072,
+    (q15_t)0x7FD8, (q15_t)0x0647, (q15_t)0x7F62, (q15_t)0x0C8B, (q15_t)0x7E9D, (q15_t)0x12C8, (q15_t)0x7FCE, (q15_t)0x0710,
+    (q15_t)0x7F38, (q15_t)0x0E1B, (q15_t)0x7E3F, (q15_t)0x151B, (q15_t)0x7FC2, (q15_t)0x07D9, (q15_t)0x7F09, (q15_t)0x0FAB,
+    (q15_t)0x7DD6, (q15_t)0x176D, (q15_t)0x7FB5, (q15_t)0x08A2, (q15_t)0x7ED5, (q15_t)0x1139, (q15_t)0x7D62, (q15_t)0x19BD,
+    (q15_t)0x7FA7, (q15_t)0x096A, (q15_t)0x7E9D, (q15_t)0x12C8, (q15_t)0x7CE3, (q15_t)0x1C0B, (q15_t)0x7F97, (q15_t)0x0A33,
+    (q15_t)0x7E5F, (q15_t)0x1455, (q15_t)0x7C5A, (q15_t)0x1E56, (q15_t)0x7F87, (q15_t)0x0AFB, (q15_t)0x7E1D, (q15_t)0x15E2,
+    (q15_t)0x7BC5, (q15_t)0x209F, (q15_t)0x7F75, (q15_t)0x0BC3, (q15_t)0x7DD6, (q15_t)0x176D, (q15_t)0x7B26, (q15_t)0x22E5,
+    (q15_t)0x7F62, (q15_t)0x0C8B, (q15_t)0x7D8A, (q15_t)0x18F8, (q15_t)0x7A7D, (q15_t)0x2528, (q15_t)0x7F4D, (q15_t)0x0D53,
+    (q15_t)0x7D39, (q15_t)0x1A82, (q15_t)0x79C8, (q15_t)0x2767, (q15_t)0x7F38, (q15_t)0x0E1B, (q15_t)0x7CE3, (q15_t)0x1C0B,
+    (q15_t)0x7909, (q15_t)0x29A3, (q15_t)0x7F21, (q15_t)0x0EE3, (q15_t)0x7C89, (q15_t)0x1D93, (q15_t)0x7840, (q15_t)0x2BDC,
+    (q15_t)0x7F09, (q15_t)0x0FAB, (q15_t)0x7C29, (q15_t)0x1F19, (q15_t)0x776C, (q15_t)0x2E11, (q15_t)0x7EF0, (q15_t)0x1072,
+    (q15_t)0x7BC5, (q15_t)0x209F, (q15_t)0x768E, (q15_t)0x3041, (q15_t)0x7ED5, (q15_t)0x1139, (q15_t)0x7B5D, (q15_t)0x2223,
+    (q15_t)0x75A5, (q15_t)0x326E, (q15_t)0x7EBA, (q15_t)0x1201, (q15_t)0x7AEF, (q15_t)0x23A6, (q15_t)0x74B2, (q15_t)0x3496,
+    (q15_t)0x7E9D, (q15_t)0x12C8, (q15_t)0x7A7D, (q15_t)0x2528, (q15_t)0x73B5, (q15_t)0x36BA, (q15_t)0x7E7F, (q15_t)0x138E,
+    (q15_t)0x7A05, (q15_t)0x26A8, (q15_t)0x72AF, (q15_t)0x38D8, (q15_t)0x7E5F, (q15_t)0x1455, (q15_t)0x798A, (q15_t)0x2826,
+    (q15_t)0x719E, (q15_t)0x3AF2, (q15_t)0x7E3F, (q15_t)0x151B, (q15_t)0x7909, (q15_t)0x29A3, (q15_t)0x7083, (q15_t)0x3D07,
+    (q15_t)0x7E1D, (q15_t)0x15E2, (q15_t)0x7884, (q15_t)0x2B1F, (q15_t)0x6F5F, (q15_t)0x3F17, (q15_t)0x7DFA, (q15_t)0x16A8,
+    (q15_t)0x77FA, (q15_t)0x2C98, (q15_t)0x6E30, (q15_t)0x4121, (q15_t)0x7DD6, (q15_t)0x176D, (q15_t)0x776C, (q15_t)0x2E11,
+    (q15_t)0x6CF9, (q15_t)0x4325, (q15_t)0x7DB0, (q15_t)0x1833, (q15_t)0x76D9, (q15_t)0x2F87, (q15_t)0x6BB8, (q15_t)0x4524,
+    (q15_t)0x7D8A, (q15_t)0x18F8, (q15_t)0x7641, (q15_t)0x30FB, (q15_t)0x6A6D, (q15_t)0x471C, (q15_t)0x7D62, (q15_t)0x19BD,
+    (q15_t)0x75A5, (q15_t)0x326E, (q15_t)0x6919, (q15_t)0x490F, (q15_t)0x7D39, (q15_t)0x1A82, (q15_t)0x7504, (q15_t)0x33DE,
+    (q15_t)0x67BD, (q15_t)0x4AFB, (q15_t)0x7D0F, (q15_t)0x1B47, (q15_t)0x745F, (q15_t)0x354D, (q15_t)0x6657, (q15_t)0x4CE1,
+    (q15_t)0x7CE3, (q15_t)0x1C0B, (q15_t)0x73B5, (q15_t)0x36BA, (q15_t)0x64E8, (q15_t)0x4EBF, (q15_t)0x7CB7, (q15_t)0x1CCF,
+    (q15_t)0x7307, (q15_t)0x3824, (q15_t)0x6371, (q15_t)0x5097, (q15_t)0x7C89, (q15_t)0x1D93, (q15_t)0x7255, (q15_t)0x398C,
+    (q15_t)0x61F1, (q15_t)0x5269, (q15_t)0x7C5A, (q15_t)0x1E56, (q15_t)0x719E, (q15_t)0x3AF2, (q15_t)0x6068, (q15_t)0x5433,
+    (q15_t)0x7C29, (q15_t)0x1F19, (q15_t)0x70E2, (q15_t)0x3C56, (q15_t)0x5ED7, (q15_t)0x55F5, (q15_t)0x7BF8, (q15_t)0x1FDC,
+    (q15_t)0x7023, (q15_t)0x3DB8, (q15_t)0x5D3E, (q15_t)0x57B0, (q15_t)0x7BC5, (q15_t)0x209F, (q15_t)0x6F5F, (q15_t)0x3F17,
+    (q15_t)0x5B9D, (q15_t)0x5964, (q15_t)0x7B92, (q15_t)0x2161, (q15_t)0x6E96, (q15_t)0x4073, (q15_t)0x59F3, (q15_t)0x5B10,
+    (q15_t)0x7B5D, (q15_t)0x2223, (q15_t)0x6DCA, (q15_t)0x41CE, (q15_t)0x5842, (q15_t)0x5CB4, (q15_t)0x7B26, (q15_t)0x22E5,
+    (q15_t)0x6CF9, (q15_t)0x4325, (q15_t)0x568A, (q15_t)0x5E50, (q15_t)0x7AEF, (q15_t)0x23A6, (q15_t)0x6C24, (q15_t)0x447A,
+    (q15_t)0x54CA, (q15_t)0x5FE3, (q15_t)0x7AB6, (q15_t)0x2467, (q15_t)0x6B4A, (q15_t)0x45CD, (q15_t)0x5302, (q15_t)0x616F,
+    (q15_t)0x7A7D, (q15_t)0x2528, (q15_t)0x6A6D, (q15_t)0x471C, (q15_t)0x5133, (q15_t)0x62F2, (q15_t)0x7A42, (q15_t)0x25E8,
+    (q15_t)0x698C, (q15_t)0x4869, (q15_t)0x4F5E, (q15_t)0x646C, (q15_t)0x7A05, (q15_t)0x26A8, (q15_t)0x68A6, (q15_t)0x49B4,
+    (q15_t)0x4D81, (q15_t)0x65DD, (q15_t)0x79C8, (q15_t)0x2767, (q15_t)0x67BD, (q15_t)0x4AFB, (q15_t)0x4B9E, (q15_t)0x6746,
+    (q15_t)0x798A, (q15_t)0x2826, (q15_t)0x66CF, (q15_t)0x4C3F, (q15_t)0x49B4, (q15_t)0x68A6, (q15_t)0x794A, (q15_t)0x28E5,
+    (q15_t)0x65DD, (q15_t)0x4D81, (q15_t)0x47C3, (q15_t)0x69FD, (q15_t)0x7909, (q15_t)0x29A3, (q15_t)0x64E8, (q15_t)0x4EBF,
+    (q15_t)0x45CD, (q15_t)0x6B4A, (q15_t)0x78C7, (q15_t)0x2A61, (q15_t)0x63EF, (q15_t)0x4FFB, (q15_t)0x43D0, (q15_t)0x6C8F,
+    (q15_t)0x7884, (q15_t)0x2B1F, (q15_t)0x62F2, (q15_t)0x5133, (q15_t)0x41CE, (q15_t)0x6DCA, (q15_t)0x7840, (q15_t)0x2BDC,
+    (q15_t)0x61F1, (q15_t)0x5269, (q15_t)0x3FC5, (q15_t)0x6EFB, (q15_t)0x77FA, (q15_t)0x2C98, (q15_t)0x60EC, (q15_t)0x539B,
+    (q15_t)0x3DB8, (q15_t)0x7023, (q15_t)0x77B4, (q15_t)0x2D55, (q15_t)0x5FE3, (q15_t)0x54CA, (q15_t)0x3BA5, (q15_t)0x7141,
+    (q15_t)0x776C, (q15_t)0x2E11, (q15_t)0x5ED7, (q15_t)0x55F5, (q15_t)0x398C, (q15_t)0x7255, (q15_t)0x7723, (q15_t)0x2ECC,
+    (q15_t)0x5DC7, (q15_t)0x571D, (q15_t)0x376F, (q15_t)0x735F, (q15_t)0x76D9, (q15_t)0x2F87, (q15_t)0x5CB4, (q15_t)0x5842,
+    (q15_t)0x354D, (q15_t)0x745F, (q15_t)0x768E, (q15_t)0x3041, (q15_t)0x5B9D, (q15_t)0x5964, (q15_t)0x3326, (q15_t)0x7555,
+    (q15_t)0x7641, (q15_t)0x30FB, (q15_t)0x5A82, (q15_t)0x5A82, (q15_t)0x30FB, (q15_t)0x7641, (q15_t)0x75F4, (q15_t)0x31B5,
+    (q15_t)0x5964, (q15_t)0x5B9D, (q15_t)0x2ECC, (q15_t)0x7723, (q15_t)0x75A5, (q15_t)0x326E, (q15_t)0x5842, (q15_t)0x5CB4,
+    (q15_t)0x2C98, (q15_t)0x77FA, (q15_t)0x7555, (q15_t)0x3326, (q15_t)0x571D, (q15_t)0x5DC7, (q15_t)0x2A61, (q15_t)0x78C7,
+    (q15_t)0x7504, (q15_t)0x33DE, (q15_t)0x55F5, (q15_t)0x5ED7, (q15_t)0x2826, (q15_t)0x798A, (q15_t)0x74B2, (q15_t)0x3496,
+    (q15_t)0x54CA, (q15_t)0x5FE3, (q15_t)0x25E8, (q15_t)0x7A42, (q15_t)0x745F, (q15_t)0x354D, (q15_t)0x539B, (q15_t)0x60EC,
+    (q15_t)0x23A6, (q15_t)0x7AEF, (q15_t)0x740B, (q15_t)0x3604, (q15_t)0x5269, (q15_t)0x61F1, (q15_t)0x2161, (q15_t)0x7B92,
+    (q15_t)0x73B5, (q15_t)0x36BA, (q15_t)0x5133, (q15_t)0x62F2, (q15_t)0x1F19, (q15_t)0x7C29, (q15_t)0x735F, (q15_t)0x376F,
+    (q15_t)0x4FFB, (q15_t)0x63EF, (q15_t)0x1CCF, (q15_t)0x7CB7, (q15_t)0x7307, (q15_t)0x3824, (q15_t)0x4EBF, (q15_t)0x64E8,
+    (q15_t)0x1A82, (q15_t)0x7D39, (q15_t)0x72AF, (q15_t)0x38D8, (q15_t)0x4D81, (q15_t)0x65DD, (q15_t)0x1833, (q15_t)0x7DB0,
+    (q15_t)0x7255, (q15_t)0x398C, (q15_t)0x4C3F, (q15_t)0x66CF, (q15_t)0x15E2, (q15_t)0x7E1D, (q15_t)0x71FA, (q15_t)0x3A40,
+    (q15_t)0x4AFB, (q15_t)0x67BD, (q15_t)0x138E, (q15_t)0x7E7F, (q15_t)0x719E, (q15_t)0x3AF2, (q15_t)0x49B4, (q15_t)0x68A6,
+    (q15_t)0x1139, (q15_t)0x7ED5, (q15_t)0x7141, (q15_t)0x3BA5, (q15_t)0x4869, (q15_t)0x698C, (q15_t)0x0EE3, (q15_t)0x7F21,
+    (q15_t)0x70E2, (q15_t)0x3C56, (q15_t)0x471C, (q15_t)0x6A6D, (q15_t)0x0C8B, (q15_t)0x7F62, (q15_t)0x7083, (q15_t)0x3D07,
+    (q15_t)0x45CD, (q15_t)0x6B4A, (q15_t)0x0A33, (q15_t)0x7F97, (q15_t)0x7023, (q15_t)0x3DB8, (q15_t)0x447A, (q15_t)0x6C24,
+    (q15_t)0x07D9, (q15_t)0x7FC2, (q15_t)0x6FC1, (q15_t)0x3E68, (q15_t)0x4325, (q15_t)0x6CF9, (q15_t)0x057F, (q15_t)0x7FE1,
+    (q15_t)0x6F5F, (q15_t)0x3F17, (q15_t)0x41CE, (q15_t)0x6DCA, (q15_t)0x0324, (q15_t)0x7FF6, (q15_t)0x6EFB, (q15_t)0x3FC5,
+    (q15_t)0x4073, (q15_t)0x6E96, (q15_t)0x00C9, (q15_t)0x7FFF, (q15_t)0x6E96, (q15_t)0x4073, (q15_t)0x3F17, (q15_t)0x6F5F,
+    (q15_t)0xFE6D, (q15_t)0x7FFD, (q15_t)0x6E30, (q15_t)0x4121, (q15_t)0x3DB8, (q15_t)0x7023, (q15_t)0xFC12, (q15_t)0x7FF0,
+    (q15_t)0x6DCA, (q15_t)0x41CE, (q15_t)0x3C56, (q15_t)0x70E2, (q15_t)0xF9B8, (q15_t)0x7FD8, (q15_t)0x6D62, (q15_t)0x427A,
+    (q15_t)0x3AF2, (q15_t)0x719E, (q15_t)0xF75D, (q15_t)0x7FB5, (q15_t)0x6CF9, (q15_t)0x4325, (q15_t)0x398C, (q15_t)0x7255,
+    (q15_t)0xF504, (q15_t)0x7F87, (q15_t)0x6C8F, (q15_t)0x43D0, (q15_t)0x3824, (q15_t)0x7307, (q15_t)0xF2AC, (q15_t)0x7F4D,
+    (q15_t)0x6C24, (q15_t)0x447A, (q15_t)0x36BA, (q15_t)0x73B5, (q15_t)0xF054, (q15_t)0x7F09, (q15_t)0x6BB8, (q15_t)0x4524,
+    (q15_t)0x354D, (q15_t)0x745F, (q15_t)0xEDFE, (q15_t)0x7EBA, (q15_t)0x6B4A, (q15_t)0x45CD, (q15_t)0x33DE, (q15_t)0x7504,
+    (q15_t)0xEBAA, (q15_t)0x7E5F, (q15_t)0x6ADC, (q15_t)0x4675, (q15_t)0x326E, (q15_t)0x75A5, (q15_t)0xE957, (q15_t)0x7DFA,
+    (q15_t)0x6A6D, (q15_t)0x471C, (q15_t)0x30FB, (q15_t)0x7641, (q15_t)0xE707, (q15_t)0x7D8A, (q15_t)0x69FD, (q15_t)0x47C3,
+    (q15_t)0x2F87, (q15_t)0x76D9, (q15_t)0xE4B8, (q15_t)0x7D0F, (q15_t)0x698C, (q15_t)0x4869, (q15_t)0x2E11, (q15_t)0x776C,
+    (q15_t)0xE26C, (q15_t)0x7C89, (q15_t)0x6919, (q15_t)0x490F, (q15_t)0x2C98, (q15_t)0x77FA, (q15_t)0xE023, (q15_t)0x7BF8,
+    (q15_t)0x68A6, (q15_t)0x49B4, (q15_t)0x2B1F, (q15_t)0x7884, (q15_t)0xDDDC, (q15_t)0x7B5D, (q15_t)0x6832, (q15_t)0x4A58,
+    (q15_t)0x29A3, (q15_t)0x7909, (q15_t)0xDB98, (q15_t)0x7AB6, (q15_t)0x67BD, (q15_t)0x4AFB, (q15_t)0x2826, (q15_t)0x798A,
+    (q15_t)0xD957, (q15_t)0x7A05, (q15_t)0x6746, (q15_t)0x4B9E, (q15_t)0x26A8, (q15_t)0x7A05, (q15_t)0xD71A, (q15_t)0x794A,
+    (q15_t)0x66CF, (q15_t)0x4C3F, (q15_t)0x2528, (q15_t)0x7A7D, (q15_t)0xD4E0, (q15_t)0x7884, (q15_t)0x6657, (q15_t)0x4CE1,
+    (q15_t)0x23A6, (q15_t)0x7AEF, (q15_t)0xD2AA, (q15_t)0x77B4, (q15_t)0x65DD, (q15_t)0x4D81, (q15_t)0x2223, (q15_t)0x7B5D,
+    (q15_t)0xD078, (q15_t)0x76D9, (q15_t)0x6563, (q15_t)0x4E21, (q15_t)0x209F, (q15_t)0x7BC5, (q15_t)0xCE4A, (q15_t)0x75F4,
+    (q15_t)0x64E8, (q15_t)0x4EBF, (q15_t)0x1F19, (q15_t)0x7C29, (q15_t)0xCC21, (q15_t)0x7504, (q15_t)0x646C, (q15_t)0x4F5E,
+    (q15_t)0x1D93, (q15_t)0x7C89, (q15_t)0xC9FB, (q15_t)0x740B, (q15_t)0x63EF, (q15_t)0x4FFB, (q15_t)0x1C0B, (q15_t)0x7CE3,
+    (q15_t)0xC7DB, (q15_t)0x7307, (q15_t)0x6371, (q15_t)0x5097, (q15_t)0x1A82, (q15_t)0x7D39, (q15_t)0xC5BF, (q15_t)0x71FA,
+    (q15_t)0x62F2, (q15_t)0x5133, (q15_t)0x18F8, (q15_t)0x7D8A, (q15_t)0xC3A9, (q15_t)0x70E2, (q15_t)0x6271, (q15_t)0x51CE,
+    (q15_t)0x176D, (q15_t)0x7DD6, (q15_t)0xC197, (q15_t)0x6FC1, (q15_t)0x61F1, (q15_t)0x5269, (q15_t)0x15E2, (q15_t)0x7E1D,
+    (q15_t)0xBF8C, (q15_t)0x6E96, (q15_t)0x616F, (q15_t)0x5302, (q15_t)0x1455, (q15_t)0x7E5F, (q15_t)0xBD85, (q15_t)0x6D62,
+    (q15_t)0x60EC, (q15_t)0x539B, (q15_t)0x12C8, (q15_t)0x7E9D, (q15_t)0xBB85, (q15_t)0x6C24, (q15_t)0x6068, (q15_t)0x5433,
+    (q15_t)0x1139, (q15_t)0x7ED5, (q15_t)0xB98A, (q15_t)0x6ADC, (q15_t)0x5FE3, (q15_t)0x54CA, (q15_t)0x0FAB, (q15_t)0x7F09,
+    (q15_t)0xB796, (q15_t)0x698C, (q15_t)0x5F5E, (q15_t)0x5560, (q15_t)0x0E1B, (q15_t)0x7F38, (q15_t)0xB5A7, (q15_t)0x6832,
+    (q15_t)0x5ED7, (q15_t)0x55F5, (q15_t)0x0C8B, (q15_t)0x7F62, (q15_t)0xB3C0, (q15_t)0x66CF, (q15_t)0x5E50, (q15_t)0x568A,
+    (q15_t)0x0AFB, (q15_t)0x7F87, (q15_t)0xB1DE, (q15_t)0x6563, (q15_t)0x5DC7, (q15_t)0x571D, (q15_t)0x096A, (q15_t)0x7FA7,
+    (q15_t)0xB004, (q15_t)0x63EF, (q15_t)0x5D3E, (q15_t)0x57B0, (q15_t)0x07D9, (q15_t)0x7FC2, (q15_t)0xAE31, (q15_t)0x6271,
+    (q15_t)0x5CB4, (q15_t)0x5842, (q15_t)0x0647, (q15_t)0x7FD8, (q15_t)0xAC64, (q15_t)0x60EC, (q15_t)0x5C29, (q15_t)0x58D4,
+    (q15_t)0x04B6, (q15_t)0x7FE9, (q15_t)0xAA9F, (q15_t)0x5F5E, (q15_t)0x5B9D, (q15_t)0x5964, (q15_t)0x0324, (q15_t)0x7FF6,
+    (q15_t)0xA8E2, (q15_t)0x5DC7, (q15_t)0x5B10, (q15_t)0x59F3, (q15_t)0x0192, (q15_t)0x7FFD, (q15_t)0xA72B, (q15_t)0x5C29,
+    (q15_t)0x5A82, (q15_t)0x5A82, (q15_t)0x0000, (q15_t)0x7FFF, (q15_t)0xA57D, (q15_t)0x5A82, (q15_t)0x59F3, (q15_t)0x5B10,
+    (q15_t)0xFE6D, (q15_t)0x7FFD, (q15_t)0xA3D6, (q15_t)0x58D4, (q15_t)0x5964, (q15_t)0x5B9D, (q15_t)0xFCDB, (q15_t)0x7FF6,
+    (q15_t)0xA238, (q15_t)0x571D, (q15_t)0x58D4, (q15_t)0x5C29, (q15_t)0xFB49, (q15_t)0x7FE9, (q15_t)0xA0A1, (q15_t)0x5560,
+    (q15_t)0x5842, (q15_t)0x5CB4, (q15_t)0xF9B8, (q15_t)0x7FD8, (q15_t)0x9F13, (q15_t)0x539B, (q15_t)0x57B0, (q15_t)0x5D3E,
+    (q15_t)0xF826, (q15_t)0x7FC2, (q15_t)0x9D8E, (q15_t)0x51CE, (q15_t)0x571D, (q15_t)0x5DC7, (q15_t)0xF695, (q15_t)0x7FA7,
+    (q15_t)0x9C10, (q15_t)0x4FFB, (q15_t)0x568A, (q15_t)0x5E50, (q15_t)0xF504, (q15_t)0x7F87, (q15_t)0x9A9C, (q15_t)0x4E21,
+    (q15_t)0x55F5, (q15_t)0x5ED7, (q15_t)0xF374, (q15_t)0x7F62, (q15_t)0x9930, (q15_t)0x4C3F, (q15_t)0x5560, (q15_t)0x5F5E,
+    (q15_t)0xF1E4, (q15_t)0x7F38, (q15_t)0x97CD, (q15_t)0x4A58, (q15_t)0x54CA, (q15_t)0x5FE3, (q15_t)0xF054, (q15_t)0x7F09,
+    (q15_t)0x9673, (q15_t)0x4869, (q15_t)0x5433, (q15_t)0x6068, (q15_t)0xEEC6, (q15_t)0x7ED5, (q15_t)0x9523, (q15_t)0x4675,
+    (q15_t)0x539B, (q15_t)0x60EC, (q15_t)0xED37, (q15_t)0x7E9D, (q15_t)0x93DB, (q15_t)0x447A, (q15_t)0x5302, (q15_t)0x616F,
+    (q15_t)0xEBAA, (q15_t)0x7E5F, (q15_t)0x929D, (q15_t)0x427A, (q15_t)0x5269, (q15_t)0x61F1, (q15_t)0xEA1D, (q15_t)0x7E1D,
+    (q15_t)0x9169, (q15_t)0x4073, (q15_t)0x51CE, (q15_t)0x6271, (q15_t)0xE892, (q15_t)0x7DD6, (q15_t)0x903E, (q15_t)0x3E68,
+    (q15_t)0x5133, (q15_t)0x62F2, (q15_t)0xE707, (q15_t)0x7D8A, (q15_t)0x8F1D, (q15_t)0x3C56, (q15_t)0x5097, (q15_t)0x6371,
+    (q15_t)0xE57D, (q15_t)0x7D39, (q15_t)0x8E05, (q15_t)0x3A40, (q15_t)0x4FFB, (q15_t)0x63EF, (q15_t)0xE3F4, (q15_t)0x7CE3,
+    (q15_t)0x8CF8, (q15_t)0x3824, (q15_t)0x4F5E, (q15_t)0x646C, (q15_t)0xE26C, (q15_t)0x7C89, (q15_t)0x8BF4, (q15_t)0x3604,
+    (q15_t)0x4EBF, (q15_t)0x64E8, (q15_t)0xE0E6, (q15_t)0x7C29, (q15_t)0x8AFB, (q15_t)0x33DE, (q15_t)0x4E21, (q15_t)0x6563,
+    (q15_t)0xDF60, (q15_t)0x7BC5, (q15_t)0x8A0B, (q15_t)0x31B5, (q15_t)0x4D81, (q15_t)0x65DD, (q15_t)0xDDDC, (q15_t)0x7B5D,
+    (q15_t)0x8926, (q15_t)0x2F87, (q15_t)0x4CE1, (q15_t)0x6657, (q15_t)0xDC59, (q15_t)0x7AEF, (q15_t)0x884B, (q15_t)0x2D55,
+    (q15_t)0x4C3F, (q15_t)0x66CF, (q15_t)0xDAD7, (q15_t)0x7A7D, (q15_t)0x877B, (q15_t)0x2B1F, (q15_t)0x4B9E, (q15_t)0x6746,
+    (q15_t)0xD957, (q15_t)0x7A05, (q15_t)0x86B5, (q15_t)0x28E5, (q15_t)0x4AFB, (q15_t)0x67BD, (q15_t)0xD7D9, (q15_t)0x798A,
+    (q15_t)0x85FA, (q15_t)0x26A8, (q15_t)0x4A58, (q15_t)0x6832, (q15_t)0xD65C, (q15_t)0x7909, (q15_t)0x8549, (q15_t)0x2467,
+    (q15_t)0x49B4, (q15_t)0x68A6, (q15_t)0xD4E0, (q15_t)0x7884, (q15_t)0x84A2, (q15_t)0x2223, (q15_t)0x490F, (q15_t)0x6919,
+    (q15_t)0xD367, (q15_t)0x77FA, (q15_t)0x8407, (q15_t)0x1FDC, (q15_t)0x4869, (q15_t)0x698C, (q15_t)0xD1EE, (q15_t)0x776C,
+    (q15_t)0x8376, (q15_t)0x1D93, (q15_t)0x47C3, (q15_t)0x69FD, (q15_t)0xD078, (q15_t)0x76D9, (q15_t)0x82F0, (q15_t)0x1B47,
+    (q15_t)0x471C, (q15_t)0x6A6D, (q15_t)0xCF04, (q15_t)0x7641, (q15_t)0x8275, (q15_t)0x18F8, (q15_t)0x4675, (q15_t)0x6ADC,
+    (q15_t)0xCD91, (q15_t)0x75A5, (q15_t)0x8205, (q15_t)0x16A8, (q15_t)0x45CD, (q15_t)0x6B4A, (q15_t)0xCC21, (q15_t)0x7504,
+    (q15_t)0x81A0, (q15_t)0x1455, (q15_t)0x4524, (q15_t)0x6BB8, (q15_t)0xCAB2, (q15_t)0x745F, (q15_t)0x8145, (q15_t)0x1201,
+    (q15_t)0x447A, (q15_t)0x6C24, (q15_t)0xC945, (q15_t)0x73B5, (q15_t)0x80F6, (q15_t)0x0FAB, (q15_t)0x43D0, (q15_t)0x6C8F,
+    (q15_t)0xC7DB, (q15_t)0x7307, (q15_t)0x80B2, (q15_t)0x0D53, (q15_t)0x4325, (q15_t)0x6CF9, (q15_t)0xC673, (q15_t)0x7255,
+    (q15_t)0x8078, (q15_t)0x0AFB, (q15_t)0x427A, (q15_t)0x6D62, (q15_t)0xC50D, (q15_t)0x719E, (q15_t)0x804A, (q15_t)0x08A2,
+    (q15_t)0x41CE, (q15_t)0x6DCA, (q15_t)0xC3A9, (q15_t)0x70E2, (q15_t)0x8027, (q15_t)0x0647, (q15_t)0x4121, (q15_t)0x6E30,
+    (q15_t)0xC247, (q15_t)0x7023, (q15_t)0x800F, (q15_t)0x03ED, (q15_t)0x4073, (q15_t)0x6E96, (q15_t)0xC0E8, (q15_t)0x6F5F,
+    (q15_t)0x8002, (q15_t)0x0192, (q15_t)0x3FC5, (q15_t)0x6EFB, (q15_t)0xBF8C, (q15_t)0x6E96, (q15_t)0x8000, (q15_t)0xFF36,
+    (q15_t)0x3F17, (q15_t)0x6F5F, (q15_t)0xBE31, (q15_t)0x6DCA, (q15_t)0x8009, (q15_t)0xFCDB, (q15_t)0x3E68, (q15_t)0x6FC1,
+    (q15_t)0xBCDA, (q15_t)0x6CF9, (q15_t)0x801E, (q15_t)0xFA80, (q15_t)0x3DB8, (q15_t)0x7023, (q15_t)0xBB85, (q15_t)0x6C24,
+    (q15_t)0x803D, (q15_t)0xF826, (q15_t)0x3D07, (q15_t)0x7083, (q15_t)0xBA32, (q15_t)0x6B4A, (q15_t)0x8068, (q15_t)0xF5CC,
+    (q15_t)0x3C56, (q15_t)0x70E2, (q15_t)0xB8E3, (q15_t)0x6A6D, (q15_t)0x809D, (q15_t)0xF374, (q15_t)0x3BA5, (q15_t)0x7141,
+    (q15_t)0xB796, (q15_t)0x698C, (q15_t)0x80DE, (q15_t)0xF11C, (q15_t)0x3AF2, (q15_t)0x719E, (q15_t)0xB64B, (q15_t)0x68A6,
+    (q15_t)0x812A, (q15_t)0xEEC6, (q15_t)0x3A40, (q15_t)0x71FA, (q15_t)0xB504, (q15_t)0x67BD, (q15_t)0x8180, (q15_t)0xEC71,
+    (q15_t)0x398C, (q15_t)0x7255, (q15_t)0xB3C0, (q15_t)0x66CF, (q15_t)0x81E2, (q15_t)0xEA1D, (q15_t)0x38D8, (q15_t)0x72AF,
+    (q15_t)0xB27E, (q15_t)0x65DD, (q15_t)0x824F, (q15_t)0xE7CC, (q15_t)0x3824, (q15_t)0x7307, (q15_t)0xB140, (q15_t)0x64E8,
+    (q15_t)0x82C6, (q15_t)0xE57D, (q15_t)0x376F, (q15_t)0x735F, (q15_t)0xB004, (q15_t)0x63EF, (q15_t)0x8348, (q15_t)0xE330,
+    (q15_t)0x36BA, (q15_t)0x73B5, (q15_t)0xAECC, (q15_t)0x62F2, (q15_t)0x83D6, (q15_t)0xE0E6, (q15_t)0x3604, (q15_t)0x740B,
+    (q15_t)0xAD96, (q15_t)0x61F1, (q15_t)0x846D, (q15_t)0xDE9E, (q15_t)0x354D, (q15_t)0x745F, (q15_t)0xAC64, (q15_t)0x60EC,
+    (q15_t)0x8510, (q15_t)0xDC59, (q15_t)0x3496, (q15_t)0x74B2, (q15_t)0xAB35, (q15_t)0x5FE3, (q15_t)0x85BD, (q15_t)0xDA17,
+    (q15_t)0x33DE, (q15_t)0x7504, (q15_t)0xAA0A, (q15_t)0x5ED7, (q15_t)0x8675, (q15_t)0xD7D9, (q15_t)0x3326, (q15_t)0x7555,
+    (q15_t)0xA8E2, (q15_t)0x5DC7, (q15_t)0x8738, (q15_t)0xD59E, (q15_t)0x326E, (q15_t)0x75A5, (q15_t)0xA7BD, (q15_t)0x5CB4,
+    (q15_t)0x8805, (q15_t)0xD367, (q15_t)0x31B5, (q15_t)0x75F4, (q15_t)0xA69B, (q15_t)0x5B9D, (q15_t)0x88DC, (q15_t)0xD133,
+    (q15_t)0x30FB, (q15_t)0x7641, (q15_t)0xA57D, (q15_t)0x5A82, (q15_t)0x89BE, (q15_t)0xCF04, (q15_t)0x3041, (q15_t)0x768E,
+    (q15_t)0xA462, (q15_t)0x5964, (q15_t)0x8AAA, (q15_t)0xCCD9, (q15_t)0x2F87, (q15_t)0x76D9, (q15_t)0xA34B, (q15_t)0x5842,
+    (q15_t)0x8BA0, (q15_t)0xCAB2, (q15_t)0x2ECC, (q15_t)0x7723, (q15_t)0xA238, (q15_t)0x571D, (q15_t)0x8CA0, (q15_t)0xC890,
+    (q15_t)0x2E11, (q15_t)0x776C, (q15_t)0xA128, (q15_t)0x55F5, (q15_t)0x8DAA, (q15_t)0xC673, (q15_t)0x2D55, (q15_t)0x77B4,
+    (q15_t)0xA01C, (q15_t)0x54CA, (q15_t)0x8EBE, (q15_t)0xC45A, (q15_t)0x2C98, (q15_t)0x77FA, (q15_t)0x9F13, (q15_t)0x539B,
+    (q15_t)0x8FDC, (q15_t)0xC247, (q15_t)0x2BDC, (q15_t)0x7840, (q15_t)0x9E0E, (q15_t)0x5269, (q15_t)0x9104, (q15_t)0xC03A,
+    (q15_t)0x2B1F, (q15_t)0x7884, (q15_t)0x9D0D, (q15_t)0x5133, (q15_t)0x9235, (q15_t)0xBE31, (q15_t)0x2A61, (q15_t)0x78C7,
+    (q15_t)0x9C10, (q15_t)0x4FFB, (q15_t)0x9370, (q15_t)0xBC2F, (q15_t)0x29A3, (q15_t)0x7909, (q15_t)0x9B17, (q15_t)0x4EBF,
+    (q15_t)0x94B5, (q15_t)0xBA32, (q15_t)0x28E5, (q15_t)0x794A, (q15_t)0x9A22, (q15_t)0x4D81, (q15_t)0x9602, (q15_t)0xB83C,
+    (q15_t)0x2826, (q15_t)0x798A, (q15_t)0x9930, (q15_t)0x4C3F, (q15_t)0x9759, (q15_t)0xB64B, (q15_t)0x2767, (q15_t)0x79C8,
+    (q15_t)0x9842, (q15_t)0x4AFB, (q15_t)0x98B9, (q15_t)0xB461, (q15_t)0x26A8, (q15_t)0x7A05, (q15_t)0x9759, (q15_t)0x49B4,
+    (q15_t)0x9A22, (q15_t)0xB27E, (q15_t)0x25E8, (q15_t)0x7A42, (q15_t)0x9673, (q15_t)0x4869, (q15_t)0x9B93, (q15_t)0xB0A1,
+    (q15_t)0x2528, (q15_t)0x7A7D, (q15_t)0x9592, (q15_t)0x471C, (q15_t)0x9D0D, (q15_t)0xAECC, (q15_t)0x2467, (q15_t)0x7AB6,
+    (q15_t)0x94B5, (q15_t)0x45CD, (q15_t)0x9E90, (q15_t)0xACFD, (q15_t)0x23A6, (q15_t)0x7AEF, (q15_t)0x93DB, (q15_t)0x447A,
+    (q15_t)0xA01C, (q15_t)0xAB35, (q15_t)0x22E5, (q15_t)0x7B26, (q15_t)0x9306, (q15_t)0x4325, (q15_t)0xA1AF, (q15_t)0xA975,
+    (q15_t)0x2223, (q15_t)0x7B5D, (q15_t)0x9235, (q15_t)0x41CE, (q15_t)0xA34B, (q15_t)0xA7BD, (q15_t)0x2161, (q15_t)0x7B92,
+    (q15_t)0x9169, (q15_t)0x4073, (q15_t)0xA4EF, (q15_t)0xA60C, (q15_t)0x209F, (q15_t)0x7BC5, (q15_t)0x90A0, (q15_t)0x3F17,
+    (q15_t)0xA69B, (q15_t)0xA462, (q15_t)0x1FDC, (q15_t)0x7BF8, (q15_t)0x8FDC, (q15_t)0x3DB8, (q15_t)0xA84F, (q15_t)0xA2C1,
+    (q15_t)0x1F19, (q15_t)0x7C29, (q15_t)0x8F1D, (q15_t)0x3C56, (q15_t)0xAA0A, (q15_t)0xA128, (q15_t)0x1E56, (q15_t)0x7C5A,
+    (q15_t)0x8E61, (q15_t)0x3AF2, (q15_t)0xABCC, (q15_t)0x9F97, (q15_t)0x1D93, (q15_t)0x7C89, (q15_t)0x8DAA, (q15_t)0x398C,
+    (q15_t)0xAD96, (q15_t)0x9E0E, (q15_t)0x1CCF, (q15_t)0x7CB7, (q15_t)0x8CF8, (q15_t)0x3824, (q15_t)0xAF68, (q15_t)0x9C8E,
+    (q15_t)0x1C0B, (q15_t)0x7CE3, (q15_t)0x8C4A, (q15_t)0x36BA, (q15_t)0xB140, (q15_t)0x9B17, (q15_t)0x1B47, (q15_t)0x7D0F,
+    (q15_t)0x8BA0, (q15_t)0x354D, (q15_t)0xB31E, (q15_t)0x99A8, (q15_t)0x1A82, (q15_t)0x7D39, (q15_t)0x8AFB, (q15_t)0x33DE,
+    (q15_t)0xB504, (q15_t)0x9842, (q15_t)0x19BD, (q15_t)0x7D62, (q15_t)0x8A5A, (q15_t)0x326E, (q15_t)0xB6F0, (q15_t)0x96E6,
+    (q15_t)0x18F8, (q15_t)0x7D8A, (q15_t)0x89BE, (q15_t)0x30FB, (q15_t)0xB8E3, (q15_t)0x9592, (q15_t)0x1833, (q15_t)0x7DB0,
+    (q15_t)0x8926, (q15_t)0x2F87, (q15_t)0xBADB, (q15_t)0x9447, (q15_t)0x176D, (q15_t)0x7DD6, (q15_t)0x8893, (q15_t)0x2E11,
+    (q15_t)0xBCDA, (q15_t)0x9306, (q15_t)0x16A8, (q15_t)0x7DFA, (q15_t)0x8805, (q15_t)0x2C98, (q15_t)0xBEDE, (q15_t)0x91CF,
+    (q15_t)0x15E2, (q15_t)0x7E1D, (q15_t)0x877B, (q15_t)0x2B1F, (q15_t)0xC0E8, (q15_t)0x90A0, (q15_t)0x151B, (q15_t)0x7E3F,
+    (q15_t)0x86F6, (q15_t)0x29A3, (q15_t)0xC2F8, (q15_t)0x8F7C, (q15_t)0x1455, (q15_t)0x7E5F, (q15_t)0x8675, (q15_t)0x2826,
+    (q15_t)0xC50D, (q15_t)0x8E61, (q15_t)0x138E, (q15_t)0x7E7F, (q15_t)0x85FA, (q15_t)0x26A8, (q15_t)0xC727, (q15_t)0x8D50,
+    (q15_t)0x12C8, (q15_t)0x7E9D, (q15_t)0x8582, (q15_t)0x2528, (q15_t)0xC945, (q15_t)0x8C4A, (q15_t)0x1201, (q15_t)0x7EBA,
+    (q15_t)0x8510, (q15_t)0x23A6, (q15_t)0xCB69, (q15_t)0x8B4D, (q15_t)0x1139, (q15_t)0x7ED5, (q15_t)0x84A2, (q15_t)0x2223,
+    (q15_t)0xCD91, (q15_t)0x8A5A, (q15_t)0x1072, (q15_t)0x7EF0, (q15_t)0x843A, (q15_t)0x209F, (q15_t)0xCFBE, (q15_t)0x8971,
+    (q15_t)0x0FAB, (q15_t)0x7F09, (q15_t)0x83D6, (q15_t)0x1F19, (q15_t)0xD1EE, (q15_t)0x8893, (q15_t)0x0EE3, (q15_t)0x7F21,
+    (q15_t)0x8376, (q15_t)0x1D93, (q15_t)0xD423, (q15_t)0x87BF, (q15_t)0x0E1B, (q15_t)0x7F38, (q15_t)0x831C, (q15_t)0x1C0B,
+    (q15_t)0xD65C, (q15_t)0x86F6, (q15_t)0x0D53, (q15_t)0x7F4D, (q15_t)0x82C6, (q15_t)0x1A82, (q15_t)0xD898, (q15_t)0x8637,
+    (q15_t)0x0C8B, (q15_t)0x7F62, (q15_t)0x8275, (q15_t)0x18F8, (q15_t)0xDAD7, (q15_t)0x8582, (q15_t)0x0BC3, (q15_t)0x7F75,
+    (q15_t)0x8229, (q15_t)0x176D, (q15_t)0xDD1A, (q15_t)0x84D9, (q15_t)0x0AFB, (q15_t)0x7F87, (q15_t)0x81E2, (q15_t)0x15E2,
+    (q15_t)0xDF60, (q15_t)0x843A, (q15_t)0x0A33, (q15_t)0x7F97, (q15_t)0x81A0, (q15_t)0x1455, (q15_t)0xE1A9, (q15_t)0x83A5,
+    (q15_t)0x096A, (q15_t)0x7FA7, (q15_t)0x8162, (q15_t)0x12C8, (q15_t)0xE3F4, (q15_t)0x831C, (q15_t)0x08A2, (q15_t)0x7FB5,
+    (q15_t)0x812A, (q15_t)0x1139, (q15_t)0xE642, (q15_t)0x829D, (q15_t)0x07D9, (q15_t)0x7FC2, (q15_t)0x80F6, (q15_t)0x0FAB,
+    (q15_t)0xE892, (q15_t)0x8229, (q15_t)0x0710, (q15_t)0x7FCE, (q15_t)0x80C7, (q15_t)0x0E1B, (q15_t)0xEAE4, (q15_t)0x81C0,
+    (q15_t)0x0647, (q15_t)0x7FD8, (q15_t)0x809D, (q15_t)0x0C8B, (q15_t)0xED37, (q15_t)0x8162, (q15_t)0x057F, (q15_t)0x7FE1,
+    (q15_t)0x8078, (q15_t)0x0AFB, (q15_t)0xEF8D, (q15_t)0x810F, (q15_t)0x04B6, (q15_t)0x7FE9, (q15_t)0x8058, (q15_t)0x096A,
+    (q15_t)0xF1E4, (q15_t)0x80C7, (q15_t)0x03ED, (q15_t)0x7FF0, (q15_t)0x803D, (q15_t)0x07D9, (q15_t)0xF43C, (q15_t)0x808A,
+    (q15_t)0x0324, (q15_t)0x7FF6, (q15_t)0x8027, (q15_t)0x0647, (q15_t)0xF695, (q15_t)0x8058, (q15_t)0x025B, (q15_t)0x7FFA,
+    (q15_t)0x8016, (q15_t)0x04B6, (q15_t)0xF8EF, (q15_t)0x8031, (q15_t)0x0192, (q15_t)0x7FFD, (q15_t)0x8009, (q15_t)0x0324,
+    (q15_t)0xFB49, (q15_t)0x8016, (q15_t)0x00C9, (q15_t)0x7FFF, (q15_t)0x8002, (q15_t)0x0192, (q15_t)0xFDA4, (q15_t)0x8005
+};
+
+/* (w1, w2, w3) per butterfly of the 4096-point radix-4 stages */
+const q15_t rfftStockhamQ15_4096[6144] RFFT_Q15_ALIGN =
+{
+    (q15_t)0x7FFF, (q15_t)0x0000, (q15_t)0x7FFF, (q15_t)0x0000, (q15_t)0x7FFF, (q15_t)0x0000, (q15_t)0x7FFF, (q15_t)0x0032,
+    (q15_t)0x7FFF, (q15_t)0x0064, (q15_t)0x7FFF, (q15_t)0x0096, (q15_t)0x7FFF, (q15_t)0x0064, (q15_t)0x7FFF, (q15_t)0x00C9,
+    (q15_t)0x7FFE, (q15_t)0x012D, (q15_t)0x7FFF, (q15_t)0x0096, (q15_t)0x7FFE, (q15_t)0x012D, (q15_t)0x7FFC, (q15_t)0x01C4,
+    (q15_t)0x7FFF, (q15_t)0x00C9, (q15_t)0x7FFD, (q15_t)0x0192, (q15_t)0x7FFA, (q15_t)0x025B, (q15_t)0x7FFF, (q15_t)0x00FB,
+    (q15_t)0x7FFC, (q15_t)0x01F6, (q15_t)0x7FF7, (q15_t)0x02F1, (q15_t)0x7FFE, (q15_t)0x012D, (q15_t)0x7FFA, (q15_t)0x025B,
+    (q15_t)0x7FF3, (q15_t)0x0388, (q15_t)0x7FFE, (q15_t)0x015F, (q15_t)0x7FF8, (q15_t)0x02BF, (q15_t)0x7FEE, (q15_t)0x041F,
+    (q15_t)0x7FFD, (q15_t)0x0192, (q15_t)0x7FF6, (q15_t)0x0324, (q15_t)0x7FE9, (q15_t)0x04B6, (q15_t)0x7FFC, (q15_t)0x01C4,
+    (q15_t)0x7FF3, (q15_t)0x0388, (q15_t)0x7FE3, (q15_t)0x054C, (q15_t)0x7FFC, (q15_t)0x01F6, (q15_t)0x7FF0, (q15_t)0x03ED,
+    (q15_t)0x7FDD, (q15_t)0x05E3, (q15_t)0x7FFB, (q15_t)0x0228, (q15_t)0x7FED, (q15_t)0x0451, (q15_t)0x7FD6, (q15_t)0x067A,
+    (q15_t)0x7FFA, (q15_t)0x025B, (q15_t)0x7FE9, (q15_t)0x04B6, (q15_t)0x7FCE, (q15_t)0x0710, (q15_t)0x7FF9, (q15_t)0x028D,
+    (q15_t)0x7FE5, (q15_t)0x051A, (q15_t)0x7FC5, (q15_t)0x07A7, (q15_t)0x7FF8, (q15_t)0x02BF, (q15_t)0x7FE1, (q15_t)0x057F,
+    (q15_t)0x7FBC, (q15_t)0x083D, (q15_t)0x7FF7, (q15_t)0x02F1, (q15_t)0x7FDD, (q15_t)0x05E3, (q15_t)0x7FB1, (q15_t)0x08D4,
+    (q15_t)0x7FF6, (q15_t)0x0324, (q15_t)0x7FD8, (q15_t)0x0647, (q15_t)0x7FA7, (q15_t)0x096A, (q15_t)0x7FF4, (q15_t)0x0356,
+    (q15_t)0x7FD3, (q15_t)0x06AC, (q15_t)0x7F9B, (q15_t)0x0A00, (q15_t)0x7FF3, (q15_t)0x0388, (q15_t)0x7FCE, (q15_t)0x0710,
+    (q15_t)0x7F8F, (q15_t)0x0A97, (q15_t)0x7FF2, (q15_t)0x03BA, (q15_t)0x7FC8, (q15_t)0x0775, (q15_t)0x7F82, (q15_t)0x0B2D,
+    (q15_t)0x7FF0, (q15_t)0x03ED, (q15_t)0x7FC2, (q15_t)0x07D9, (q15_t)0x7F75, (q15_t)0x0BC3, (q15_t)0x7FEE, (q15_t)0x041F,
+    (q15_t)0x7FBC, (q15_t)0x083D, (q15_t)0x7F67, (q15_t)0x0C59, (q15_t)0x7FED, (q15_t)0x0451, (q15_t)0x7FB5, (q15_t)0x08A2,
+    (q15_t)0x7F58, (q15_t)0x0CEF, (q15_t)0x7FEB, (q15_t)0x0483, (q15_t)0x7FAE, (q15_t)0x0906, (q15_t)0x7F48, (q15_t)0x0D85,
+    (q15_t)0x7FE9, (q15_t)0x04B6, (q15_t)0x7FA7, (q15_t)0x096A, (q15_t)0x7F38, (q15_t)0x0E1B, (q15_t)0x7FE7, (q15_t)0x04E8,
+    (q15_t)0x7F9F, (q15_t)0x09CE, (q15_t)0x7F27, (q15_t)0x0EB1, (q15_t)0x7FE5, (q15_t)0x051A, (q15_t)0x7F97, (q15_t)0x0A33,
+    (q15_t)0x7F15, (q15_t)0x0F47, (q15_t)0x7FE3, (q15_t)0x054C, (q15_t)0x7F8F, (q15_t)0x0A97, (q15_t)0x7F03, (q15_t)0x0FDD,
+    (q15_t)0x7FE1, (q15_t)0x057F, (q15_t)0x7F87, (q15_t)0x0AFB, (q15_t)0x7EF0, (q15_t)0x1072, (q15_t)0x7FDF, (q15_t)0x05B1,
+    (q15_t)0x7F7E, (q15_t)0x0B5F, (q15_t)0x7EDC, (q15_t)0x1108, (q15_t)0x7FDD, (q15_t)0x05E3, (q15_t)0x7F75, (q15_t)0x0BC3,
+    (q15_t)0x7EC8, (q15_t)0x119D, (q15_t)0x7FDA, (q15_t)0x0615, (q15_t)0x7F6B, (q15_t)0x0C27, (q15_t)0x7EB3, (q15_t)0x1232,
+    (q15_t)0x7FD8, (q15_t)0x0647, (q15_t)0x7F62, (q15_t)0x0C8B, (q15_t)0x7E9D, (q15_t)0x12C8, (q15_t)0x7FD6, (q15_t)0x067A,
+    (q15_t)0x7F58, (q15_t)0x0CEF, (q15_t)0x7E86, (q15_t)0x135D, (q15_t)0x7FD3, (q15_t)0x06AC, (q15_t)0x7F4D, (q15_t)0x0D53,
+    (q15_t)0x7E6F, (q15_t)0x13F2, (q15_t)0x7FD0, (q15_t)0x06DE, (q15_t)0x7F43, (q15_t)0x0DB7, (q15_t)0x7E57, (q15_t)0x1487,
+    (q15_t)0x7FCE, (q15_t)0x0710, (q15_t)0x7F38, (q15_t)0x0E1B, (q15_t)0x7E3F, (q15_t)0x151B, (q15_t)0x7FCB, (q15_t)0x0742,
+    (q15_t)0x7F2D, (q15_t)0x0E7F, (q15_t)0x7E26, (q15_t)0x15B0, (q15_t)0x7FC8, (q15_t)0x0775, (q15_t)0x7F21, (q15_t)0x0EE3,
+    (q15_t)0x7E0C, (q15_t)0x1645, (q15_t)0x7FC5, (q15_t)0x07A7, (q15_t)0x7F15, (q15_t)0x0F47, (q15_t)0x7DF1, (q15_t)0x16D9,
+    (q15_t)0x7FC2, (q15_t)0x07D9, (q15_t)0x7F09, (q15_t)0x0FAB, (q15_t)0x7DD6, (q15_t)0x176D, (q15_t)0x7FBF, (q15_t)0x080B,
+    (q15_t)0x7EFD, (q15_t)0x100E, (q15_t)0x7DBA, (q15_t)0x1802, (q15_t)0x7FBC, (q15_t)0x083D, (q15_t)0x7EF0, (q15_t)0x1072,
+    (q15_t)0x7D9D, (q15_t)0x1896, (q15_t)0x7FB8, (q15_t)0x086F, (q15_t)0x7EE3, (q15_t)0x10D6, (q15_t)0x7D80, (q15_t)0x192A,
+    (q15_t)0x7FB5, (q15_t)0x08A2, (q15_t)0x7ED5, (q15_t)0x1139, (q15_t)0x7D62, (q15_t)0x19BD, (q15_t)0x7FB1, (q15_t)0x08D4,
+    (q15_t)0x7EC8, (q15_t)0x119D, (q15_t)0x7D43, (q15_t)0x1A51, (q15_t)0x7FAE, (q15_t)0x0906, (q15_t)0x7EBA, (q15_t)0x1201,
+    (q15_t)0x7D24, (q15_t)0x1AE4, (q15_t)0x7FAA, (q15_t)0x0938, (q15_t)0x7EAB, (q15_t)0x1264, (q15_t)0x7D04, (q15_t)0x1B78,
+    (q15_t)0x7FA7, (q15_t)0x096A, (q15_t)0x7E9D, (q15_t)0x12C8, (q15_t)0x7CE3, (q15_t)0x1C0B, (q15_t)0x7FA3, (q15_t)0x099C,
+    (q15_t)0x7E8E, (q15_t)0x132B, (q15_t)0x7CC2, (q15_t)0x1C9E, (q15_t)0x7F9F, (q15_t)0x09CE, (q15_t)0x7E7F, (q15_t)0x138E,
+    (q15_t)0x7CA0, (q15_t)0x1D31, (q15_t)0x7F9B, (q15_t)0x0A00, (q15_t)0x7E6F, (q15_t)0x13F2, (q15_t)0x7C7D, (q15_t)0x1DC4,
+    (q15_t)0x7F97, (q15_t)0x0A33, (q15_t)0x7E5F, (q15_t)0x1455, (q15_t)0x7C5A, (q15_t)0x1E56, (q15_t)0x7F93, (q15_t)0x0A65,
+    (q15_t)0x7E4F, (q15_t)0x14B8, (q15_t)0x7C36, (q15_t)0x1EE9, (q15_t)0x7F8F, (q15_t)0x0A97, (q15_t)0x7E3F, (q15_t)0x151B,
+    (q15_t)0x7C11, (q15_t)0x1F7B, (q15_t)0x7F8B, (q15_t)0x0AC9, (q15_t)0x7E2E, (q15_t)0x157F, (q15_t)0x7BEB, (q15_t)0x200D,
+    (q15_t)0x7F87, (q15_t)0x0AFB, (q15_t)0x7E1D, (q15_t)0x15E2, (q15_t)0x7BC5, (q15_t)0x209F, (q15_t)0x7F82, (q15_t)0x0B2D,
+    (q15_t)0x7E0C, (q15_t)0x1645, (q15_t)0x7B9F, (q15_t)0x2131, (q15_t)0x7F7E, (q15_t)0x0B5F, (q15_t)0x7DFA, (q15_t)0x16A8,
+    (q15_t)0x7B77, (q15_t)0x21C2, (q15_t)0x7F79, (q15_t)0x0B91, (q15_t)0x7DE8, (q15_t)0x170A, (q15_t)0x7B4F, (q15_t)0x2254,
+    (q15_t)0x7F75, (q15_t)0x0BC3, (q15_t)0x7DD6, (q15_t)0x176D, (q15_t)0x7B26, (q15_t)0x22E5, (q15_t)0x7F70, (q15_t)0x0BF5,
+    (q15_t)0x7DC3, (q15_t)0x17D0, (q15_t)0x7AFD, (q15_t)0x2376, (q15_t)0x7F6B, (q15_t)0x0C27, (q15_t)0x7DB0, (q15_t)0x1833,
+    (q15_t)0x7AD3, (q15_t)0x2407, (q15_t)0x7F67, (q15_t)0x0C59, (q15_t)0x7D9D, (q15_t)0x1896, (q15_t)0x7AA8, (q15_t)0x2497,
+    (q15_t)0x7F62, (q15_t)0x0C8B, (q15_t)0x7D8A, (q15_t)0x18F8, (q15_t)0x7A7D, (q15_t)0x2528, (q15_t)0x7F5D, (q15_t)0x0CBD,
+    (q15_t)0x7D76, (q15_t)0x195B, (q15_t)0x7A50, (q15_t)0x25B8, (q15_t)0x7F58, (q15_t)0x0CEF, (q15_t)0x7D62, (q15_t)0x19BD,
+    (q15_t)0x7A24, (q15_t)0x2648, (q15_t)0x7F53, (q15_t)0x0D21, (q15_t)0x7D4E, (q15_t)0x1A20, (q15_t)0x79F6, (q15_t)0x26D8,
+    (q15_t)0x7F4D, (q15_t)0x0D53, (q15_t)0x7D39, (q15_t)0x1A82, (q15_t)0x79C8, (q15_t)0x2767, (q15_t)0x7F48, (q15_t)0x0D85,
+    (q15_t)0x7D24, (q15_t)0x1AE4, (q15_t)0x7999, (q15_t)0x27F6, (q15_t)0x7F43, (q15_t)0x0DB7, (q15_t)0x7D0F, (q15_t)0x1B47,
+    (q15_t)0x796A, (q15_t)0x2886, (q15_t)0x7F3D, (q15_t)0x0DE9, (q15_t)0x7CF9, (q15_t)0x1BA9, (q15_t)0x793A, (q15_t)0x2915,
+    (q15_t)0x7F38, (q15_t)0x0E1B, (q15_t)0x7CE3, (q15_t)0x1C0B, (q15_t)0x7909, (q15_t)0x29A3, (q15_t)0x7F32, (q15_t)0x0E4D,
+    (q15_t)0x7CCD, (q15_t)0x1C6D, (q15_t)0x78D8, (q15_t)0x2A32, (q15_t)0x7F2D, (q15_t)0x0E7F, (q15_t)0x7CB7, (q15_t)0x1CCF,
+    (q15_t)0x78A6, (q15_t)0x2AC0, (q15_t)0x7F27, (q15_t)0x0EB1, (q15_t)0x7CA0, (q15_t)0x1D31, (q15_t)0x7873, (q15_t)0x2B4E,
+    (q15_t)0x7F21, (q15_t)0x0EE3, (q15_t)0x7C89, (q15_t)0x1D93, (q15_t)0x7840, (q15_t)0x2BDC, (q15_t)0x7F1B, (q15_t)0x0F15,
+    (q15_t)0x7C71, (q15_t)0x1DF5, (q15_t)0x780C, (q15_t)0x2C69, (q15_t)0x7F15, (q15_t)0x0F47, (q15_t)0x7C5A, (q15_t)0x1E56,
+    (q15_t)0x77D7, (q15_t)0x2CF7, (q15_t)0x7F0F, (q15_t)0x0F79, (q15_t)0x7C42, (q15_t)0x1EB8, (q15_t)0x77A2, (q15_t)0x2D84,
+    (q15_t)0x7F09, (q15_t)0x0FAB, (q15_t)0x7C29, (q15_t)0x1F19, (q15_t)0x776C, (q15_t)0x2E11, (q15_t)0x7F03, (q15_t)0x0FDD,
+    (q15_t)0x7C11, (q15_t)0x1F7B, (q15_t)0x7735, (q15_t)0x2E9D, (q15_t)0x7EFD, (q15_t)0x100E, (q15_t)0x7BF8, (q15_t)0x1FDC,
+    (q15_t)0x76FE, (q15_t)0x2F29, (q15_t)0x7EF6, (q15_t)0x1040, (q15_t)0x7BDF, (q15_t)0x203E, (q15_t)0x76C6, (q15_t)0x2FB5,
+    (q15_t)0x7EF0, (q15_t)0x1072, (q15_t)0x7BC5, (q15_t)0x209F, (q15_t)0x768E, (q15_t)0x3041, (q15_t)0x7EE9, (q15_t)0x10A4,
+    (q15_t)0x7BAC, (q15_t)0x2100, (q15_t)0x7654, (q15_t)0x30CD, (q15_t)0x7EE3, (q15_t)0x10D6, (q15_t)0x7B92, (q15_t)0x2161,
+    (q15_t)0x761B, (q15_t)0x3158, (q15_t)0x7EDC, (q15_t)0x1108, (q15_t)0x7B77, (q15_t)0x21C2, (q15_t)0x75E0, (q15_t)0x31E3,
+    (q15_t)0x7ED5, (q15_t)0x1139, (q15_t)0x7B5D, (q15_t)0x2223, (q15_t)0x75A5, (q15_t)0x326E, (q15_t)0x7ECF, (q15_t)0x116B,
+    (q15_t)0x7B42, (q15_t)0x2284, (q15_t)0x7569, (q15_t)0x32F8, (q15_t)0x7EC8, (q15_t)0x119D, (q15_t)0x7B26, (q15_t)0x22E5,
+    (q15_t)0x752D, (q15_t)0x3382, (q15_t)0x7EC1, (q15_t)0x11CF, (q15_t)0x7B0B, (q15_t)0x2345, (q15_t)0x74F0, (q15_t)0x340C,
+    (q15_t)0x7EBA, (q15_t)0x1201, (q15_t)0x7AEF, (q15_t)0x23A6, (q15_t)0x74B2, (q15_t)0x3496, (q15_t)0x7EB3, (q15_t)0x1232,
+    (q15_t)0x7AD3, (q15_t)0x2407, (q15_t)0x7474, (q15_t)0x351F, (q15_t)0x7EAB, (q15_t)0x1264, (q15_t)0x7AB6, (q15_t)0x2467,
+    (q15_t)0x7435, (q15_t)0x35A8, (q15_t)0x7EA4, (q15_t)0x1296, (q15_t)0x7A9A, (q15_t)0x24C7, (q15_t)0x73F6, (q15_t)0x3631,
+    (q15_t)0x7E9D, (q15_t)0x12C8, (q15_t)0x7A7D, (q15_t)0x2528, (q15_t)0x73B5, (q15_t)0x36BA, (q15_t)0x7E95, (q15_t)0x12F9,
+    (q15_t)0x7A5F, (q15_t)0x2588, (q15_t)0x7375, (q15_t)0x3742, (q15_t)0x7E8E, (q15_t)0x132B, (q15_t)0x7A42, (q15_t)0x25E8,
+    (q15_t)0x7333, (q15_t)0x37CA, (q15_t)0x7E86, (q15_t)0x135D, (q15_t)0x7A24, (q15_t)0x2648, (q15_t)0x72F1, (q15_t)0x3851,
+    (q15_t)0x7E7F, (q15_t)0x138E, (q15_t)0x7A05, (q15_t)0x26A8, (q15_t)0x72AF, (q15_t)0x38D8, (q15_t)0x7E77, (q15_t)0x13C0,
+    (q15_t)0x79E7, (q15_t)0x2707, (q15_t)0x726B, (q15_t)0x395F, (q15_t)0x7E6F, (q15_t)0x13F2, (q15_t)0x79C8, (q15_t)0x2767,
+    (q15_t)0x7227, (q15_t)0x39E6, (q15_t)0x7E67, (q15_t)0x1423, (q15_t)0x79A9, (q15_t)0x27C7, (q15_t)0x71E3, (q15_t)0x3A6C,
+    (q15_t)0x7E5F, (q15_t)0x1455, (q15_t)0x798A, (q15_t)0x2826, (q15_t)0x719E, (q15_t)0x3AF2, (q15_t)0x7E57, (q15_t)0x1487,
+    (q15_t)0x796A, (q15_t)0x2886, (q15_t)0x7158, (q15_t)0x3B78, (q15_t)0x7E4F, (q15_t)0x14B8, (q15_t)0x794A, (q15_t)0x28E5,
+    (q15_t)0x7112, (q15_t)0x3BFD, (q15_t)0x7E47, (q15_t)0x14EA, (q15_t)0x792A, (q15_t)0x2944, (q15_t)0x70CB, (q15_t)0x3C83,
+    (q15_t)0x7E3F, (q15_t)0x151B, (q15_t)0x7909, (q15_t)0x29A3, (q15_t)0x7083, (q15_t)0x3D07, (q15_t)0x7E37, (q15_t)0x154D,
+    (q15_t)0x78E8, (q15_t)0x2A02, (q15_t)0x703B, (q15_t)0x3D8C, (q15_t)0x7E2E, (q15_t)0x157F, (q15_t)0x78C7, (q15_t)0x2A61,
+    (q15_t)0x6FF2, (q15_t)0x3E10, (q15_t)0x7E26, (q15_t)0x15B0, (q15_t)0x78A6, (q15_t)0x2AC0, (q15_t)0x6FA9, (q15_t)0x3E93,
+    (q15_t)0x7E1D, (q15_t)0x15E2, (q15_t)0x7884, (q15_t)0x2B1F, (q15_t)0x6F5F, (q15_t)0x3F17, (q15_t)0x7E14, (q15_t)0x1613,
+    (q15_t)0x7862, (q15_t)0x2B7D, (q15_t)0x6F14, (q15_t)0x3F9A, (q15_t)0x7E0C, (q15_t)0x1645, (q15_t)0x7840, (q15_t)0x2BDC,
+    (q15_t)0x6EC9, (q15_t)0x401D, (q15_t)0x7E03, (q15_t)0x1676, (q15_t)0x781D, (q15_t)0x2C3A, (q15_t)0x6E7D, (q15_t)0x409F,
+    (q15_t)0x7DFA, (q15_t)0x16A8, (q15_t)0x77FA, (q15_t)0x2C98, (q15_t)0x6E30, (q15_t)0x4121, (q15_t)0x7DF1, (q15_t)0x16D9,
+    (q15_t)0x77D7, (q15_t)0x2CF7, (q15_t)0x6DE3, (q15_t)0x41A2, (q15_t)0x7DE8, (q15_t)0x170A, (q15_t)0x77B4, (q15_t)0x2D55,
+    (q15_t)0x6D96, (q15_t)0x4224, (q15_t)0x7DDF, (q15_t)0x173C, (q15_t)0x7790, (q15_t)0x2DB3, (q15_t)0x6D48, (q15_t)0x42A5,
+    (q15_t)0x7DD6, (q15_t)0x176D, (q15_t)0x776C, (q15_t)0x2E11, (q15_t)0x6CF9, (q15_t)0x4325, (q15_t)0x7DCD, (q15_t)0x179F,
+    (q15_t)0x7747, (q15_t)0x2E6E, (q15_t)0x6CA9, (q15_t)0x43A5, (q15_t)0x7DC3, (q15_t)0x17D0, (q15_t)0x7723, (q15_t)0x2ECC,
+    (q15_t)0x6C59, (q15_t)0x4425, (q15_t)0x7DBA, (q15_t)0x1802, (q15_t)0x76FE, (q15_t)0x2F29, (q15_t)0x6C09, (q15_t)0x44A5,
+    (q15_t)0x7DB0, (q15_t)0x1833, (q15_t)0x76D9, (q15_t)0x2F87, (q15_t)0x6BB8, (q15_t)0x4524, (q15_t)0x7DA7, (q15_t)0x1864,
+    (q15_t)0x76B3, (q15_t)0x2FE4, (q15_t)0x6B66, (q15_t)0x45A3, (q15_t)0x7D9D, (q15_t)0x1896, (q15_t)0x768E, (q15_t)0x3041,
+    (q15_t)0x6B13, (q15_t)0x4621, (q15_t)0x7D94, (q15_t)0x18C7, (q15_t)0x7668, (q15_t)0x309E, (q15_t)0x6AC1, (q15_t)0x469F,
+    (q15_t)0x7D8A, (q15_t)0x18F8, (q15_t)0x7641, (q15_t)0x30FB, (q15_t)0x6A6D, (q15_t)0x471C, (q15_t)0x7D80, (q15_t)0x192A,
+    (q15_t)0x761B, (q15_t)0x3158, (q15_t)0x6A19, (q15_t)0x479A, (q15_t)0x7D76, (q15_t)0x195B, (q15_t)0x75F4, (q15_t)0x31B5,
+    (q15_t)0x69C4, (q15_t)0x4816, (q15_t)0x7D6C, (q15_t)0x198C, (q15_t)0x75CC, (q15_t)0x3211, (q15_t)0x696F, (q15_t)0x4893,
+    (q15_t)0x7D62, (q15_t)0x19BD, (q15_t)0x75A5, (q15_t)0x326E, (q15_t)0x6919, (q15_t)0x490F, (q15_t)0x7D58, (q15_t)0x19EF,
+    (q15_t)0x757D, (q15_t)0x32CA, (q15_t)0x68C3, (q15_t)0x498A, (q15_t)0x7D4E, (q15_t)0x1A20, (q15_t)0x7555, (q15_t)0x3326,
+    (q15_t)0x686C, (q15_t)0x4A06, (q15_t)0x7D43, (q15_t)0x1A51, (q15_t)0x752D, (q15_t)0x3382, (q15_t)0x6815, (q15_t)0x4A81,
+    (q15_t)0x7D39, (q15_t)0x1A82, (q15_t)0x7504, (q15_t)0x33DE, (q15_t)0x67BD, (q15_t)0x4AFB, (q15_t)0x7D2F, (q15_t)0x1AB3,
+    (q15_t)0x74DB, (q15_t)0x343A, (q15_t)0x6764, (q15_t)0x4B75, (q15_t)0x7D24, (q15_t)0x1AE4, (q15_t)0x74B2, (q15_t)0x3496,
+    (q15_t)0x670B, (q15_t)0x4BEF, (q15_t)0x7D19, (q15_t)0x1B16, (q15_t)0x7489, (q15_t)0x34F2, (q15_t)0x66B1, (q15_t)0x4C68,
+    (q15_t)0x7D0F, (q15_t)0x1B47, (q15_t)0x745F, (q15_t)0x354D, (q15_t)0x6657, (q15_t)0x4CE1, (q15_t)0x7D04, (q15_t)0x1B78,
+    (q15_t)0x7435, (q15_t)0x35A8, (q15_t)0x65FC, (q15_t)0x4D59, (q15_t)0x7CF9, (q15_t)0x1BA9, (q15_t)0x740B, (q15_t)0x3604,
+    (q15_t)0x65A0, (q15_t)0x4DD1, (q15_t)0x7CEE, (q15_t)0x1BDA, (q15_t)0x73E0, (q15_t)0x365F, (q15_t)0x6545, (q15_t)0x4E48,
+    (q15_t)0x7CE3, (q15_t)0x1C0B, (q15_t)0x73B5, (q15_t)0x36BA, (q15_t)0x64E8, (q15_t)0x4EBF, (q15_t)0x7CD8, (q15_t)0x1C3C,
+    (q15_t)0x738A, (q15_t)0x3714, (q15_t)0x648B, (q15_t)0x4F36, (q15_t)0x7CCD, (q15_t)0x1C6D, (q15_t)0x735F, (q15_t)0x376F,
+    (q15_t)0x642D, (q15_t)0x4FAC, (q15_t)0x7CC2, (q15_t)0x1C9E, (q15_t)0x7333, (q15_t)0x37CA, (q15_t)0x63CF, (q15_t)0x5022,
+    (q15_t)0x7CB7, (q15_t)0x1CCF, (q15_t)0x7307, (q15_t)0x3824, (q15_t)0x6371, (q15_t)0x5097, (q15_t)0x7CAB, (q15_t)0x1D00,
+    (q15_t)0x72DB, (q15_t)0x387E, (q15_t)0x6311, (q15_t)0x510C, (q15_t)0x7CA0, (q15_t)0x1D31, (q15_t)0x72AF, (q15_t)0x38D8,
+    (q15_t)0x62B2, (q15_t)0x5181, (q15_t)0x7C94, (q15_t)0x1D62, (q15_t)0x7282, (q15_t)0x3932, (q15_t)0x6251, (q15_t)0x51F5,
+    (q15_t)0x7C89, (q15_t)0x1D93, (q15_t)0x7255, (q15_t)0x398C, (q15_t)0x61F1, (q15_t)0x5269, (q15_t)0x7C7D, (q15_t)0x1DC4,
+    (q15_t)0x7227, (q15_t)0x39E6, (q15_t)0x618F, (q15_t)0x52DC, (q15_t)0x7C71, (q15_t)0x1DF5, (q15_t)0x71FA, (q15_t)0x3A40,
+    (q15_t)0x612D, (q15_t)0x534E, (q15_t)0x7C66, (q15_t)0x1E25, (q15_t)0x71CC, (q15_t)0x3A99, (q15_t)0x60CB, (q15_t)0x53C1,
+    (q15_t)0x7C5A, (q15_t)0x1E56, (q15_t)0x719E, (q15_t)0x3AF2, (q15_t)0x6068, (q15_t)0x5433, (q15_t)0x7C4E, (q15_t)0x1E87,
+    (q15_t)0x716F, (q15_t)0x3B4C, (q15_t)0x6004, (q15_t)0x54A4, (q15_t)0x7C42, (q15_t)0x1EB8, (q15_t)0x7141, (q15_t)0x3BA5,
+    (q15_t)0x5FA0, (q15_t)0x5515, (q15_t)0x7C36, (q15_t)0x1EE9, (q15_t)0x7112, (q15_t)0x3BFD, (q15_t)0x5F3C, (q15_t)0x5585,
+    (q15_t)0x7C29, (q15_t)0x1F19, (q15_t)0x70E2, (q15_t)0x3C56, (q15_t)0x5ED7, (q15_t)0x55F5, (q15_t)0x7C1D, (q15_t)0x1F4A,
+    (q15_t)0x70B3, (q15_t)0x3CAF, (q15_t)0x5E71, (q15_t)0x5665, (q15_t)0x7C11, (q15_t)0x1F7B, (q15_t)0x7083, (q15_t)0x3D07,
+    (q15_t)0x5E0B, (q15_t)0x56D4, (q15_t)0x7C05, (q15_t)0x1FAC, (q15_t)0x7053, (q15_t)0x3D60, (q15_t)0x5DA5, (q15_t)0x5742,
+    (q15_t)0x7BF8, (q15_t)0x1FDC, (q15_t)0x7023, (q15_t)0x3DB8, (q15_t)0x5D3E, (q15_t)0x57B0, (q15_t)0x7BEB, (q15_t)0x200D,
+    (q15_t)0x6FF2, (q15_t)0x3E10, (q15_t)0x5CD6, (q15_t)0x581E, (q15_t)0x7BDF, (q15_t)0x203E, (q15_t)0x6FC1, (q15_t)0x3E68,
+    (q15_t)0x5C6E, (q15_t)0x588B, (q15_t)0x7BD2, (q15_t)0x206E, (q15_t)0x6F90, (q15_t)0x3EBF, (q15_t)0x5C06, (q15_t)0x58F8,
+    (q15_t)0x7BC5, (q15_t)0x209F, (q15_t)0x6F5F, (q15_t)0x3F17, (q15_t)0x5B9D, (q15_t)0x5964, (q15_t)0x7BB9, (q15_t)0x20D0,
+    (q15_t)0x6F2D, (q15_t)0x3F6E, (q15_t)0x5B33, (q15_t)0x59D0, (q15_t)0x7BAC, (q15_t)0x2100, (q15_t)0x6EFB, (q15_t)0x3FC5,
+    (q15_t)0x5AC9, (q15_t)0x5A3B, (q15_t)0x7B9F, (q15_t)0x2131, (q15_t)0x6EC9, (q15_t)0x401D, (q15_t)0x5A5E, (q15_t)0x5AA5,
+    (q15_t)0x7B92, (q15_t)0x2161, (q15_t)0x6E96, (q15_t)0x4073, (q15_t)0x59F3, (q15_t)0x5B10, (q15_t)0x7B84, (q15_t)0x2192,
+    (q15_t)0x6E63, (q15_t)0x40CA, (q15_t)0x5988, (q15_t)0x5B79, (q15_t)0x7B77, (q15_t)0x21C2, (q15_t)0x6E30, (q15_t)0x4121,
+    (q15_t)0x591C, (q15_t)0x5BE3, (q15_t)0x7B6A, (q15_t)0x21F3, (q15_t)0x6DFD, (q15_t)0x4177, (q15_t)0x58AF, (q15_t)0x5C4B,
+    (q15_t)0x7B5D, (q15_t)0x2223, (q15_t)0x6DCA, (q15_t)0x41CE, (q15_t)0x5842, (q15_t)0x5CB4, (q15_t)0x7B4F, (q15_t)0x2254,
+    (q15_t)0x6D96, (q15_t)0x4224, (q15_t)0x57D5, (q15_t)0x5D1B, (q15_t)0x7B42, (q15_t)0x2284, (q15_t)0x6D62, (q15_t)0x427A,
+    (q15_t)0x5767, (q15_t)0x5D83, (q15_t)0x7B34, (q15_t)0x22B4, (q15_t)0x6D2D, (q15_t)0x42D0, (q15_t)0x56F9, (q15_t)0x5DE9,
+    (q15_t)0x7B26, (q15_t)0x22E5, (q15_t)0x6CF9, (q15_t)0x4325, (q15_t)0x568A, (q15_t)0x5E50, (q15_t)0x7B19, (q15_t)0x2315,
+    (q15_t)0x6CC4, (q15_t)0x437B, (q15_t)0x561A, (q15_t)0x5EB5, (q15_t)0x7B0B, (q15_t)0x2345, (q15_t)0x6C8F, (q15_t)0x43D0,
+    (q15_t)0x55AB, (q15_t)0x5F1A, (q15_t)0x7AFD, (q15_t)0x2376, (q15_t)0x6C59, (q15_t)0x4425, (q15_t)0x553A, (q15_t)0x5F7F,
+    (q15_t)0x7AEF, (q15_t)0x23A6, (q15_t)0x6C24, (q15_t)0x447A, (q15_t)0x54CA, (q15_t)0x5FE3, (q15_t)0x7AE1, (q15_t)0x23D6,
+    (q15_t)0x6BEE, (q15_t)0x44CF, (q15_t)0x5458, (q15_t)0x6047, (q15_t)0x7AD3, (q15_t)0x2407, (q15_t)0x6BB8, (q15_t)0x4524,
+    (q15_t)0x53E7, (q15_t)0x60AA, (q15_t)0x7AC5, (q15_t)0x2437, (q15_t)0x6B81, (q15_t)0x4578, (q15_t)0x5375, (q15_t)0x610D,
+    (q15_t)0x7AB6, (q15_t)0x2467, (q15_t)0x6B4A, (q15_t)0x45CD, (q15_t)0x5302, (q15_t)0x616F, (q15_t)0x7AA8, (q15_t)0x2497,
+    (q15_t)0x6B13, (q15_t)0x4621, (q15_t)0x528F, (q15_t)0x61D0, (q15_t)0x7A9A, (q15_t)0x24C7, (q15_t)0x6ADC, (q15_t)0x4675,
+    (q15_t)0x521C, (q15_t)0x6231, (q15_t)0x7A8B, (q15_t)0x24F7, (q15_t)0x6AA5, (q15_t)0x46C9, (q15_t)0x51A8, (q15_t)0x6292,
+    (q15_t)0x7A7D, (q15_t)0x2528, (q15_t)0x6A6D, (q15_t)0x471C, (q15_t)0x5133, (q15_t)0x62F2, (q15_t)0x7A6E, (q15_t)0x2558,
+    (q15_t)0x6A35, (q15_t)0x4770, (q15_t)0x50BF, (q15_t)0x6351, (q15_t)0x7A5F, (q15_t)0x2588, (q15_t)0x69FD, (q15_t)0x47C3,
+    (q15_t)0x5049, (q15_t)0x63B0, (q15_t)0x7A50, (q15_t)0x25B8, (q15_t)0x69C4, (q15_t)0x4816, (q15_t)0x4FD4, (q15_t)0x640E,
+    (q15_t)0x7A42, (q15_t)0x25E8, (q15_t)0x698C, (q15_t)0x4869, (q15_t)0x4F5E, (q15_t)0x646C, (q15_t)0x7A33, (q15_t)0x2618,
+    (q15_t)0x6953, (q15_t)0x48BC, (q15_t)0x4EE7, (q15_t)0x64C9, (q15_t)0x7A24, (q15_t)0x2648, (q15_t)0x6919, (q15_t)0x490F,
+    (q15_t)0x4E70, (q15_t)0x6526, (q15_t)0x7A15, (q15_t)0x2678, (q15_t)0x68E0, (q15_t)0x4961, (q15_t)0x4DF9, (q15_t)0x6582,
+    (q15_t)0x7A05, (q15_t)0x26A8, (q15_t)0x68A6, (q15_t)0x49B4, (q15_t)0x4D81, (q15_t)0x65DD, (q15_t)0x79F6, (q15_t)0x26D8,
+    (q15_t)0x686C, (q15_t)0x4A06, (q15_t)0x4D09, (q15_t)0x6639, (q15_t)0x79E7, (q15_t)0x2707, (q15_t)0x6832, (q15_t)0x4A58,
+    (q15_t)0x4C90, (q15_t)0x6693, (q15_t)0x79D8, (q15_t)0x2737, (q15_t)0x67F7, (q15_t)0x4AA9, (q15_t)0x4C17, (q15_t)0x66ED,
+    (q15_t)0x79C8, (q15_t)0x2767, (q15_t)0x67BD, (q15_t)0x4AFB, (q15_t)0x4B9E, (q15_t)0x6746, (q15_t)0x79B9, (q15_t)0x2797,
+    (q15_t)0x6782, (q15_t)0x4B4C, (q15_t)0x4B24, (q15_t)0x679F, (q15_t)0x79A9, (q15_t)0x27C7, (q15_t)0x6746, (q15_t)0x4B9E,
+    (q15_t)0x4AA9, (q15_t)0x67F7, (q15_t)0x7999, (q15_t)0x27F6, (q15_t)0x670B, (q15_t)0x4BEF, (q15_t)0x4A2F, (q15_t)0x684F,
+    (q15_t)0x798A, (q15_t)0x2826, (q15_t)0x66CF, (q15_t)0x4C3F, (q15_t)0x49B4, (q15_t)0x68A6, (q15_t)0x797A, (q15_t)0x2856,
+    (q15_t)0x6693, (q15_t)0x4C90, (q15_t)0x4938, (q15_t)0x68FD, (q15_t)0x796A, (q15_t)0x2886, (q15_t)0x6657, (q15_t)0x4CE1,
+    (q15_t)0x48BC, (q15_t)0x6953, (q15_t)0x795A, (q15_t)0x28B5, (q15_t)0x661A, (q15_t)0x4D31, (q15_t)0x4840, (q15_t)0x69A8,
+    (q15_t)0x794A, (q15_t)0x28E5, (q15_t)0x65DD, (q15_t)0x4D81, (q15_t)0x47C3, (q15_t)0x69FD, (q15_t)0x793A, (q15_t)0x2915,
+    (q15_t)0x65A0, (q15_t)0x4DD1, (q15_t)0x4746, (q15_t)0x6A51, (q15_t)0x792A, (q15_t)0x2944, (q15_t)0x6563, (q15_t)0x4E21,
+    (q15_t)0x46C9, (q15_t)0x6AA5, (q15_t)0x7919, (q15_t)0x2974, (q15_t)0x6526, (q15_t)0x4E70, (q15_t)0x464B, (q15_t)0x6AF8,
+    (q15_t)0x7909, (q15_t)0x29A3, (q15_t)0x64E8, (q15_t)0x4EBF, (q15_t)0x45CD, (q15_t)0x6B4A, (q15_t)0x78F9, (q15_t)0x29D3,
+    (q15_t)0x64AA, (q15_t)0x4F0F, (q15_t)0x454E, (q15_t)0x6B9C, (q15_t)0x78E8, (q15_t)0x2A02, (q15_t)0x646C, (q15_t)0x4F5E,
+    (q15_t)0x44CF, (q15_t)0x6BEE, (q15_t)0x78D8, (q15_t)0x2A32, (q15_t)0x642D, (q15_t)0x4FAC, (q15_t)0x4450, (q15_t)0x6C3F,
+    (q15_t)0x78C7, (q15_t)0x2A61, (q15_t)0x63EF, (q15_t)0x4FFB, (q15_t)0x43D0, (q15_t)0x6C8F, (q15_t)0x78B6, (q15_t)0x2A91,
+    (q15_t)0x63B0, (q15_t)0x5049, (q15_t)0x4350, (q15_t)0x6CDE, (q15_t)0x78A6, (q15_t)0x2AC0, (q15_t)0x6371, (q15_t)0x5097,
+    (q15_t)0x42D0, (q15_t)0x6D2D, (q15_t)0x7895, (q15_t)0x2AEF, (q15_t)0x6331, (q15_t)0x50E5, (q15_t)0x424F, (q15_t)0x6D7C,
+    (q15_t)0x7884, (q15_t)0x2B1F, (q15_t)0x62F2, (q15_t)0x5133, (q15_t)0x41CE, (q15_t)0x6DCA, (q15_t)0x7873, (q15_t)0x2B4E,
+    (q15_t)0x62B2, (q15_t)0x5181, (q15_t)0x414C, (q15_t)0x6E17, (q15_t)0x7862, (q15_t)0x2B7D, (q15_t)0x6271, (q15_t)0x51CE,
+    (q15_t)0x40CA, (q15_t)0x6E63, (q15_t)0x7851, (q15_t)0x2BAD, (q15_t)0x6231, (q15_t)0x521C, (q15_t)0x4048, (q15_t)0x6EAF,
+    (q15_t)0x7840, (q15_t)0x2BDC, (q15_t)0x61F1, (q15_t)0x5269, (q15_t)0x3FC5, (q15_t)0x6EFB, (q15_t)0x782E, (q15_t)0x2C0B,
+    (q15_t)0x61B0, (q15_t)0x52B5, (q15_t)0x3F43, (q15_t)0x6F46, (q15_t)0x781D, (q15_t)0x2C3A, (q15_t)0x616F, (q15_t)0x5302,
+    (q15_t)0x3EBF, (q15_t)0x6F90, (q15_t)0x780C, (q15_t)0x2C69, (q15_t)0x612D, (q15_t)0x534E, (q15_t)0x3E3C, (q15_t)0x6FDA,
+    (q15_t)0x77FA, (q15_t)0x2C98, (q15_t)0x60EC, (q15_t)0x539B, (q15_t)0x3DB8, (q15_t)0x7023, (q15_t)0x77E9, (q15_t)0x2CC8,
+    (q15_t)0x60AA, (q15_t)0x53E7, (q15_t)0x3D33, (q15_t)0x706B, (q15_t)0x77D7, (q15_t)0x2CF7, (q15_t)0x6068, (q15_t)0x5433,
+    (q15_t)0x3CAF, (q15_t)0x70B3, (q15_t)0x77C5, (q15_t)0x2D26, (q15_t)0x6026, (q15_t)0x547E, (q15_t)0x3C2A, (q15_t)0x70FA,
+    (q15_t)0x77B4, (q15_t)0x2D55, (q15_t)0x5FE3, (q15_t)0x54CA, (q15_t)0x3BA5, (q15_t)0x7141, (q15_t)0x77A2, (q15_t)0x2D84,
+    (q15_t)0x5FA0, (q15_t)0x5515, (q15_t)0x3B1F, (q15_t)0x7186, (q15_t)0x7790, (q15_t)0x2DB3, (q15_t)0x5F5E, (q15_t)0x5560,
+    (q15_t)0x3A99, (q15_t)0x71CC, (q15_t)0x777E, (q15_t)0x2DE2, (q15_t)0x5F1A, (q15_t)0x55AB, (q15_t)0x3A13, (q15_t)0x7211,
+    (q15_t)0x776C, (q15_t)0x2E11, (q15_t)0x5ED7, (q15_t)0x55F5, (q15_t)0x398C, (q15_t)0x7255, (q15_t)0x775A, (q15_t)0x2E3F,
+    (q15_t)0x5E93, (q15_t)0x5640, (q15_t)0x3906, (q15_t)0x7298, (q15_t)0x7747, (q15_t)0x2E6E, (q15_t)0x5E50, (q15_t)0x568A,
+    (q15_t)0x387E, (q15_t)0x72DB, (q15_t)0x7735, (q15_t)0x2E9D, (q15_t)0x5E0B, (q15_t)0x56D4, (q15_t)0x37F7, (q15_t)0x731D,
+    (q15_t)0x7723, (q15_t)0x2ECC, (q15_t)0x5DC7, (q15_t)0x571D, (q15_t)0x376F, (q15_t)0x735F, (q15_t)0x7710, (q15_t)0x2EFB,
+    (q15_t)0x5D83, (q15_t)0x5767, (q15_t)0x36E7, (q15_t)0x73A0, (q15_t)0x76FE, (q15_t)0x2F29, (q15_t)0x5D3E, (q15_t)0x57B0,
+    (q15_t)0x365F, (q15_t)0x73E0, (q15_t)0x76EB, (q15_t)0x2F58, (q15_t)0x5CF9, (q15_t)0x57F9, (q15_t)0x35D6, (q15_t)0x7420,
+    (q15_t)0x76D9, (q15_t)0x2F87, (q15_t)0x5CB4, (q15_t)0x5842, (q15_t)0x354D, (q15_t)0x745F, (q15_t)0x76C6, (q15_t)0x2FB5,
+    (q15_t)0x5C6E, (q15_t)0x588B, (q15_t)0x34C4, (q15_t)0x749E, (q15_t)0x76B3, (q15_t)0x2FE4, (q15_t)0x5C29, (q15_t)0x58D4,
+    (q15_t)0x343A, (q15_t)0x74DB, (q15_t)0x76A0, (q15_t)0x3013, (q15_t)0x5BE3, (q15_t)0x591C, (q15_t)0x33B0, (q15_t)0x7519,
+    (q15_t)0x768E, (q15_t)0x3041, (q15_t)0x5B9D, (q15_t)0x5964, (q15_t)0x3326, (q15_t)0x7555, (q15_t)0x767B, (q15_t)0x3070,
+    (q15_t)0x5B56, (q15_t)0x59AC, (q15_t)0x329C, (q15_t)0x7591, (q15_t)0x7668, (q15_t)0x309E, (q15_t)0x5B10, (q15_t)0x59F3,
+    (q15_t)0x3211, (q15_t)0x75CC, (q15_t)0x7654, (q15_t)0x30CD, (q15_t)0x5AC9, (q15_t)0x5A3B, (q15_t)0x3186, (q15_t)0x7607,
+    (q15_t)0x7641, (q15_t)0x30FB, (q15_t)0x5A82, (q15_t)0x5A82, (q15_t)0x30FB, (q15_t)0x7641, (q15_t)0x762E, (q15_t)0x312A,
+    (q15_t)0x5A3B, (q15_t)0x5AC9, (q15_t)0x3070, (q15_t)0x767B, (q15_t)0x761B, (q15_t)0x3158, (q15_t)0x59F3, (q15_t)0x5B10,
+    (q15_t)0x2FE4, (q15_t)0x76B3, (q15_t)0x7607, (q15_t)0x3186, (q15_t)0x59AC, (q15_t)0x5B56, (q15_t)0x2F58, (q15_t)0x76EB,
+    (q15_t)0x75F4, (q15_t)0x31B5, (q15_t)0x5964, (q15_t)0x5B9D, (q15_t)0x2ECC, (q15_t)0x7723, (q15_t)0x75E0, (q15_t)0x31E3,
+    (q15_t)0x591C, (q15_t)0x5BE3, (q15_t)0x2E3F, (q15_t)0x775A, (q15_t)0x75CC, (q15_t)0x3211, (q15_t)0x58D4, (q15_t)0x5C29,
+    (q15_t)0x2DB3, (q15_t)0x7790, (q15_t)0x75B9, (q15_t)0x3240, (q15_t)0x588B, (q15_t)0x5C6E, (q15_t)0x2D26, (q15_t)0x77C5,
+    (q15_t)0x75A5, (q15_t)0x326E, (q15_t)0x5842, (q15_t)0x5CB4, (q15_t)0x2C98, (q15_t)0x77FA, (q15_t)0x7591, (q15_t)0x329C,
+    (q15_t)0x57F9, (q15_t)0x5CF9, (q15_t)0x2C0B, (q15_t)0x782E, (q15_t)0x757D, (q15_t)0x32CA, (q15_t)0x57B0, (q15_t)0x5D3E,
+    (q15_t)0x2B7D, (q15_t)0x7862, (q15_t)0x7569, (q15_t)0x32F8, (q15_t)0x5767, (q15_t)0x5D83, (q15_t)0x2AEF, (q15_t)0x7895,
+    (q15_t)0x7555, (q15_t)0x3326, (q15_t)0x571D, (q15_t)0x5DC7, (q15_t)0x2A61, (q15_t)0x78C7, (q15_t)0x7541, (q15_t)0x3354,
+    (q15_t)0x56D4, (q15_t)0x5E0B, (q15_t)0x29D3, (q15_t)0x78F9, (q15_t)0x752D, (q15_t)0x3382, (q15_t)0x568A, (q15_t)0x5E50,
+    (q15_t)0x2944, (q15_t)0x792A, (q15_t)0x7519, (q15_t)0x33B0, (q15_t)0x5640, (q15_t)0x5E93, (q15_t)0x28B5, (q15_t)0x795A,
+    (q15_t)0x7504, (q15_t)0x33DE, (q15_t)0x55F5, (q15_t)0x5ED7, (q15_t)0x2826, (q15_t)0x798A, (q15_t)0x74F0, (q15_t)0x340C,
+    (q15_t)0x55AB, (q15_t)0x5F1A, (q15_t)0x2797, (q15_t)0x79B9, (q15_t)0x74DB, (q15_t)0x343A, (q15_t)0x5560, (q15_t)0x5F5E,
+    (q15_t)0x2707, (q15_t)0x79E7, (q15_t)0x74C7, (q15_t)0x3468, (q15_t)0x5515, (q15_t)0x5FA0, (q15_t)0x2678, (q15_t)0x7A15,
+    (q15_t)0x74B2, (q15_t)0x3496, (q15_t)0x54CA, (q15_t)0x5FE3, (q15_t)0x25E8, (q15_t)0x7A42, (q15_t)0x749E, (q15_t)0x34C4,
+    (q15_t)0x547E, (q15_t)0x6026, (q15_t)0x2558, (q15_t)0x7A6E, (q15_t)0x7489, (q15_t)0x34F2, (q15_t)0x5433, (q15_t)0x6068,
+    (q15_t)0x24C7, (q15_t)0x7A9A, (q15_t)0x7474, (q15_t)0x351F, (q15_t)0x53E7, (q15_t)0x60AA, (q15_t)0x2437, (q15_t)0x7AC5,
+    (q15_t)0x745F, (q15_t)0x354D, (q15_t)0x539B, (q15_t)0x60EC, (q15_t)0x23A6, (q15_t)0x7AEF, (q15_t)0x744A, (q15_t)0x357B,
+    (q15_t)0x534E, (q15_t)0x612D, (q15_t)0x2315, (q15_t)0x7B19, (q15_t)0x7435, (q15_t)0x35A8, (q15_t)0x5302, (q15_t)0x616F,
+    (q15_t)0x2284, (q15_t)0x7B42, (q15_t)0x7420, (q15_t)0x35D6, (q15_t)0x52B5, (q15_t)0x61B0, (q15_t)0x21F3, (q15_t)0x7B6A,
+    (q15_t)0x740B, (q15_t)0x3604, (q15_t)0x5269, (q15_t)0x61F1, (q15_t)0x2161, (q15_t)0x7B92, (q15_t)0x73F6, (q15_t)0x3631,
+    (q15_t)0x521C, (q15_t)0x6231, (q15_t)0x20D0, (q15_t)0x7BB9, (q15_t)0x73E0, (q15_t)0x365F, (q15_t)0x51CE, (q15_t)0x6271,
+    (q15_t)0x203E, (q15_t)0x7BDF, (q15_t)0x73CB, (q15_t)0x368C, (q15_t)0x5181, (q15_t)0x62B2, (q15_t)0x1FAC, (q15_t)0x7C05,
+    (q15_t)0x73B5, (q15_t)0x36BA, (q15_t)0x5133, (q15_t)0x62F2, (q15_t)0x1F19, (q15_t)0x7C29, (q15_t)0x73A0, (q15_t)0x36E7,
+    (q15_t)0x50E5, (q15_t)0x6331, (q15_t)0x1E87, (q15_t)0x7C4E, (q15_t)0x738A, (q15_t)0x3714, (q15_t)0x5097, (q15_t)0x6371,
+    (q15_t)0x1DF5, (q15_t)0x7C71, (q15_t)0x7375, (q15_t)0x3742, (q15_t)0x5049, (q15_t)0x63B0, (q15_t)0x1D62, (q15_t)0x7C94,
+    (q15_t)0x735F, (q15_t)0x376F, (q15_t)0x4FFB, (q15_t)0x63EF, (q15_t)0x1CCF, (q15_t)0x7CB7, (q15_t)0x7349, (q15_t)0x379C,
+    (q15_t)0x4FAC, (q15_t)0x642D, (q15_t)0x1C3C, (q15_t)0x7CD8, (q15_t)0x7333, (q15_t)0x37CA, (q15_t)0x4F5E, (q15_t)0x646C,
+    (q15_t)0x1BA9, (q15_t)0x7CF9, (q15_t)0x731D, (q15_t)0x37F7, (q15_t)0x4F0F, (q15_t)0x64AA, (q15_t)0x1B16, (q15_t)0x7D19,
+    (q15_t)0x7307, (q15_t)0x3824, (q15_t)0x4EBF, (q15_t)0x64E8, (q15_t)0x1A82, (q15_t)0x7D39, (q15_t)0x72F1, (q15_t)0x3851,
+    (q15_t)0x4E70, (q15_t)0x6526, (q15_t)0x19EF, (q15_t)0x7D58, (q15_t)0x72DB, (q15_t)0x387E, (q15_t)0x4E21, (q15_t)0x6563,
+    (q15_t)0x195B, (q15_t)0x7D76, (q15_t)0x72C5, (q15_t)0x38AB, (q15_t)0x4DD1, (q15_t)0x65A0, (q15_t)0x18C7, (q15_t)0x7D94,
+    (q15_t)0x72AF, (q15_t)0x38D8, (q15_t)0x4D81, (q15_t)0x65DD, (q15_t)0x1833, (q15_t)0x7DB0, (q15_t)0x7298, (q15_t)0x3906,
+    (q15_t)0x4D31, (q15_t)0x661A, (q15_t)0x179F, (q15_t)0x7DCD, (q15_t)0x7282, (q15_t)0x3932, (q15_t)0x4CE1, (q15_t)0x6657,
+    (q15_t)0x170A, (q15_t)0x7DE8, (q15_t)0x726B, (q15_t)0x395F, (q15_t)0x4C90, (q15_t)0x6693, (q15_t)0x1676, (q15_t)0x7E03,
+    (q15_t)0x7255, (q15_t)0x398C, (q15_t)0x4C3F, (q15_t)0x66CF, (q15_t)0x15E2, (q15_t)0x7E1D, (q15_t)0x723E, (q15_t)0x39B9,
+    (q15_t)0x4BEF, (q15_t)0x670B, (q15_t)0x154D, (q15_t)0x7E37, (q15_t)0x7227, (q15_t)0x39E6, (q15_t)0x4B9E, (q15_t)0x6746,
+    (q15_t)0x14B8, (q15_t)0x7E4F, (q15_t)0x7211, (q15_t)0x3A13, (q15_t)0x4B4C, (q15_t)0x6782, (q15_t)0x1423, (q15_t)0x7E67,
+    (q15_t)0x71FA, (q15_t)0x3A40, (q15_t)0x4AFB, (q15_t)0x67BD, (q15_t)0x138E, (q15_t)0x7E7F, (q15_t)0x71E3, (q15_t)0x3A6C,
+    (q15_t)0x4AA9, (q15_t)0x67F7, (q15_t)0x12F9, (q15_t)0x7E95, (q15_t)0x71CC, (q15_t)0x3A99, (q15_t)0x4A58, (q15_t)0x6832,
+    (q15_t)0x1264, (q15_t)0x7EAB, (q15_t)0x71B5, (q15_t)0x3AC6, (q15_t)0x4A06, (q15_t)0x686C, (q15_t)0x11CF, (q15_t)0x7EC1,
+    (q15_t)0x719E, (q15_t)0x3AF2, (q15_t)0x49B4, (q15_t)0x68A6, (q15_t)0x1139, (q15_t)0x7ED5, (q15_t)0x7186, (q15_t)0x3B1F,
+    (q15_t)0x4961, (q15_t)0x68E0, (q15_t)0x10A4, (q15_t)0x7EE9, (q15_t)0x716F, (q15_t)0x3B4C, (q15_t)0x490F, (q15_t)0x6919,
+    (q15_t)0x100E, (q15_t)0x7EFD, (q15_t)0x7158, (q15_t)0x3B78, (q15_t)0x48BC, (q15_t)0x6953, (q15_t)0x0F79, (q15_t)0x7F0F,
+    (q15_t)0x7141, (q15_t)0x3BA5, (q15_t)0x4869, (q15_t)0x698C, (q15_t)0x0EE3, (q15_t)0x7F21, (q15_t)0x7129, (q15_t)0x3BD1,
+    (q15_t)0x4816, (q15_t)0x69C4, (q15_t)0x0E4D, (q15_t)0x7F32, (q15_t)0x7112, (q15_t)0x3BFD, (q15_t)0x47C3, (q15_t)0x69FD,
+    (q15_t)0x0DB7, (q15_t)0x7F43, (q15_t)0x70FA, (q15_t)0x3C2A, (q15_t)0x4770, (q15_t)0x6A35, (q15_t)0x0D21, (q15_t)0x7F53,
+    (q15_t)0x70E2, (q15_t)0x3C56, (q15_t)0x471C, (q15_t)0x6A6D, (q15_t)0x0C8B, (q15_t)0x7F62, (q15_t)0x70CB, (q15_t)0x3C83,
+    (q15_t)0x46C9, (q15_t)0x6AA5, (q15_t)0x0BF5, (q15_t)0x7F70, (q15_t)0x70B3, (q15_t)0x3CAF, (q15_t)0x4675, (q15_t)0x6ADC,
+    (q15_t)0x0B5F, (q15_t)0x7F7E, (q15_t)0x709B, (q15_t)0x3CDB, (q15_t)0x4621, (q15_t)0x6B13, (q15_t)0x0AC9, (q15_t)0x7F8B,
+    (q15_t)0x7083, (q15_t)0x3D07, (q15_t)0x45CD, (q15_t)0x6B4A, (q15_t)0x0A33, (q15_t)0x7F97, (q15_t)0x706B, (q15_t)0x3D33,
+    (q15_t)0x4578, (q15_t)0x6B81, (q15_t)0x099C, (q15_t)0x7FA3, (q15_t)0x7053, (q15_t)0x3D60, (q15_t)0x4524, (q15_t)0x6BB8,
+    (q15_t)0x0906, (q15_t)0x7FAE, (q15_t)0x703B, (q15_t)0x3D8C, (q15_t)0x44CF, (q15_t)0x6BEE, (q15_t)0x086F, (q15_t)0x7FB8,
+    (q15_t)0x7023, (q15_t)0x3DB8, (q15_t)0x447A, (q15_t)0x6C24, (q15_t)0x07D9, (q15_t)0x7FC2, (q15_t)0x700A, (q15_t)0x3DE4,
+    (q15_t)0x4425, (q15_t)0x6C59, (q15_t)0x0742, (q15_t)0x7FCB, (q15_t)0x6FF2, (q15_t)0x3E10, (q15_t)0x43D0, (q15_t)0x6C8F,
+    (q15_t)0x06AC, (q15_t)0x7FD3, (q15_t)0x6FDA, (q15_t)0x3E3C, (q15_t)0x437B, (q15_t)0x6CC4, (q15_t)0x0615, (q15_t)0x7FDA,
+    (q15_t)0x6FC1, (q15_t)0x3E68, (q15_t)0x4325, (q15_t)0x6CF9, (q15_t)0x057F, (q15_t)0x7FE1, (q15_t)0x6FA9, (q15_t)0x3E93,
+    (q15_t)0x42D0, (q15_t)0x6D2D, (q15_t)0x04E8, (q15_t)0x7FE7, (q15_t)0x6F90, (q15_t)0x3EBF, (q15_t)0x427A, (q15_t)0x6D62,
+    (q15_t)0x0451, (q15_t)0x7FED, (q15_t)0x6F77, (q15_t)0x3EEB, (q15_t)0x4224, (q15_t)0x6D96, (q15_t)0x03BA, (q15_t)0x7FF2,
+    (q15_t)0x6F5F, (q15_t)0x3F17, (q15_t)0x41CE, (q15_t)0x6DCA, (q15_t)0x0324, (q15_t)0x7FF6, (q15_t)0x6F46, (q15_t)0x3F43,
+    (q15_t)0x4177, (q15_t)0x6DFD, (q15_t)0x028D, (q15_t)0x7FF9, (q15_t)0x6F2D, (q15_t)0x3F6E, (q15_t)0x4121, (q15_t)0x6E30,
+    (q15_t)0x01F6, (q15_t)0x7FFC, (q15_t)0x6F14, (q15_t)0x3F9A, (q15_t)0x40CA, (q15_t)0x6E63, (q15_t)0x015F, (q15_t)0x7FFE,
+    (q15_t)0x6EFB, (q15_t)0x3FC5, (q15_t)0x4073, (q15_t)0x6E96, (q15_t)0x00C9, (q15_t)0x7FFF, (q15_t)0x6EE2, (q15_t)0x3FF1,
+    (q15_t)0x401D, (q15_t)0x6EC9, (q15_t)0x0032, (q15_t)0x7FFF, (q15_t)0x6EC9, (q15_t)0x401D, (q15_t)0x3FC5, (q15_t)0x6EFB,
+    (q15_t)0xFF9B, (q15_t)0x7FFF, (q15_t)0x6EAF, (q15_t)0x4048, (q15_t)0x3F6E, (q15_t)0x6F2D, (q15_t)0xFF04, (q15_t)0x7FFF,
+    (q15_t)0x6E96, (q15_t)0x4073, (q15_t)0x3F17, (q15_t)0x6F5F, (q15_t)0xFE6D, (q15_t)0x7FFD, (q15_t)0x6E7D, (q15_t)0x409F,
+    (q15_t)0x3EBF, (q15_t)0x6F90, (q15_t)0xFDD7, (q15_t)0x7FFB, (q15_t)0x6E63, (q15_t)0x40CA, (q15_t)0x3E68, (q15_t)0x6FC1,
+    (q15_t)0xFD40, (q15_t)0x7FF8, (q15_t)0x6E4A, (q15_t)0x40F6, (q15_t)0x3E10, (q15_t)0x6FF2, (q15_t)0xFCA9, (q15_t)0x7FF4,
+    (q15_t)0x6E30, (q15_t)0x4121, (q15_t)0x3DB8, (q15_t)0x7023, (q15_t)0xFC12, (q15_t)0x7FF0, (q15_t)0x6E17, (q15_t)0x414C,
+    (q15_t)0x3D60, (q15_t)0x7053, (q15_t)0xFB7C, (q15_t)0x7FEB, (q15_t)0x6DFD, (q15_t)0x4177, (q15_t)0x3D07, (q15_t)0x7083,
+    (q15_t)0xFAE5, (q15_t)0x7FE5, (q15_t)0x6DE3, (q15_t)0x41A2, (q15_t)0x3CAF, (q15_t)0x70B3, (q15_t)0xFA4E, (q15_t)0x7FDF,
+    (q15_t)0x6DCA, (q15_t)0x41CE, (q15_t)0x3C56, (q15_t)0x70E2, (q15_t)0xF9B8, (q15_t)0x7FD8, (q15_t)0x6DB0, (q15_t)0x41F9,
+    (q15_t)0x3BFD, (q15_t)0x7112, (q15_t)0xF921, (q15_t)0x7FD0, (q15_t)0x6D96, (q15_t)0x4224, (q15_t)0x3BA5, (q15_t)0x7141,
+    (q15_t)0xF88A, (q15_t)0x7FC8, (q15_t)0x6D7C, (q15_t)0x424F, (q15_t)0x3B4C, (q15_t)0x716F, (q15_t)0xF7F4, (q15_t)0x7FBF,
+    (q15_t)0x6D62, (q15_t)0x427A, (q15_t)0x3AF2, (q15_t)0x719E, (q15_t)0xF75D, (q15_t)0x7FB5, (q15_t)0x6D48, (q15_t)0x42A5,
+    (q15_t)0x3A99, (q15_t)0x71CC, (q15_t)0xF6C7, (q15_t)0x7FAA, (q15_t)0x6D2D, (q15_t)0x42D0, (q15_t)0x3A40, (q15_t)0x71FA,
+    (q15_t)0xF631, (q15_t)0x7F9F, (q15_t)0x6D13, (q15_t)0x42FA, (q15_t)0x39E6, (q15_t)0x7227, (q15_t)0xF59A, (q15_t)0x7F93,
+    (q15_t)0x6CF9, (q15_t)0x4325, (q15_t)0x398C, (q15_t)0x7255, (q15_t)0xF504, (q15_t)0x7F87, (q15_t)0x6CDE, (q15_t)0x4350,
+    (q15_t)0x3932, (q15_t)0x7282, (q15_t)0xF46E, (q15_t)0x7F79, (q15_t)0x6CC4, (q15_t)0x437B, (q15_t)0x38D8, (q15_t)0x72AF,
+    (q15_t)0xF3D8, (q15_t)0x7F6B, (q15_t)0x6CA9, (q15_t)0x43A5, (q15_t)0x387E, (q15_t)0x72DB, (q15_t)0xF342, (q15_t)0x7F5D,
+    (q15_t)0x6C8F, (q15_t)0x43D0, (q15_t)0x3824, (q15_t)0x7307, (q15_t)0xF2AC, (q15_t)0x7F4D, (q15_t)0x6C74, (q15_t)0x43FB,
+    (q15_t)0x37CA, (q15_t)0x7333, (q15_t)0xF216, (q15_t)0x7F3D, (q15_t)0x6C59, (q15_t)0x4425, (q15_t)0x376F, (q15_t)0x735F,
+    (q15_t)0xF180, (q15_t)0x7F2D, (q15_t)0x6C3F, (q15_t)0x4450, (q15_t)0x3714, (q15_t)0x738A, (q15_t)0xF0EA, (q15_t)0x7F1B,
+    (q15_t)0x6C24, (q15_t)0x447A, (q15_t)0x36BA, (q15_t)0x73B5, (q15_t)0xF054, (q15_t)0x7F09, (q15_t)0x6C09, (q15_t)0x44A5,
+    (q15_t)0x365F, (q15_t)0x73E0, (q15_t)0xEFBF, (q15_t)0x7EF6, (q15_t)0x6BEE, (q15_t)0x44CF, (q15_t)0x3604, (q15_t)0x740B,
+    (q15_t)0xEF29, (q15_t)0x7EE3, (q15_t)0x6BD3, (q15_t)0x44FA, (q15_t)0x35A8, (q15_t)0x7435, (q15_t)0xEE94, (q15_t)0x7ECF,
+    (q15_t)0x6BB8, (q15_t)0x4524, (q15_t)0x354D, (q15_t)0x745F, (q15_t)0xEDFE, (q15_t)0x7EBA, (q15_t)0x6B9C, (q15_t)0x454E,
+    (q15_t)0x34F2, (q15_t)0x7489, (q15_t)0xED69, (q15_t)0x7EA4, (q15_t)0x6B81, (q15_t)0x4578, (q15_t)0x3496, (q15_t)0x74B2,
+    (q15_t)0xECD4, (q15_t)0x7E8E, (q15_t)0x6B66, (q15_t)0x45A3, (q15_t)0x343A, (q15_t)0x74DB, (q15_t)0xEC3F, (q15_t)0x7E77,
+    (q15_t)0x6B4A, (q15_t)0x45CD, (q15_t)0x33DE, (q15_t)0x7504, (q15_t)0xEBAA, (q15_t)0x7E5F, (q15_t)0x6B2F, (q15_t)0x45F7,
+    (q15_t)0x3382, (q15_t)0x752D, (q15_t)0xEB15, (q15_t)0x7E47, (q15_t)0x6B13, (q15_t)0x4621, (q15_t)0x3326, (q15_t)0x7555,
+    (q15_t)0xEA80, (q15_t)0x7E2E, (q15_t)0x6AF8, (q15_t)0x464B, (q15_t)0x32CA, (q15_t)0x757D, (q15_t)0xE9EC, (q15_t)0x7E14,
+    (q15_t)0x6ADC, (q15_t)0x4675, (q15_t)0x326E, (q15_t)0x75A5, (q15_t)0xE957, (q15_t)0x7DFA, (q15_t)0x6AC1, (q15_t)0x469F,
+    (q15_t)0x3211, (q15_t)0x75CC, (q15_t)0xE8C3, (q15_t)0x7DDF, (q15_t)0x6AA5, (q15_t)0x46C9, (q15_t)0x31B5, (q15_t)0x75F4,
+    (q15_t)0xE82F, (q15_t)0x7DC3, (q15_t)0x6A89, (q15_t)0x46F3, (q15_t)0x3158, (q15_t)0x761B, (q15_t)0xE79B, (q15_t)0x7DA7,
+    (q15_t)0x6A6D, (q15_t)0x471C, (q15_t)0x30FB, (q15_t)0x7641, (q15_t)0xE707, (q15_t)0x7D8A, (q15_t)0x6A51, (q15_t)0x4746,
+    (q15_t)0x309E, (q15_t)0x7668, (q15_t)0xE673, (q15_t)0x7D6C, (q15_t)0x6A35, (q15_t)0x4770, (q15_t)0x3041, (q15_t)0x768E,
+    (q15_t)0xE5DF, (q15_t)0x7D4E, (q15_t)0x6A19, (q15_t)0x479A, (q15_t)0x2FE4, (q15_t)0x76B3, (q15_t)0xE54C, (q15_t)0x7D2F,
+    (q15_t)0x69FD, (q15_t)0x47C3, (q15_t)0x2F87, (q15_t)0x76D9, (q15_t)0xE4B8, (q15_t)0x7D0F, (q15_t)0x69E1, (q15_t)0x47ED,
+    (q15_t)0x2F29, (q15_t)0x76FE, (q15_t)0xE425, (q15_t)0x7CEE, (q15_t)0x69C4, (q15_t)0x4816, (q15_t)0x2ECC, (q15_t)0x7723,
+    (q15_t)0xE392, (q15_t)0x7CCD, (q15_t)0x69A8, (q15_t)0x4840, (q15_t)0x2E6E, (q15_t)0x7747, (q15_t)0xE2FF, (q15_t)0x7CAB,
+    (q15_t)0x698C, (q15_t)0x4869, (q15_t)0x2E11, (q15_t)0x776C, (q15_t)0xE26C, (q15_t)0x7C89, (q15_t)0x696F, (q15_t)0x4893,
+    (q15_t)0x2DB3, (q15_t)0x7790, (q15_t)0xE1DA, (q15_t)0x7C66, (q15_t)0x6953, (q15_t)0x48BC, (q15_t)0x2D55, (q15_t)0x77B4,
+    (q15_t)0xE147, (q15_t)0x7C42, (q15_t)0x6936, (q15_t)0x48E6, (q15_t)0x2CF7, (q15_t)0x77D7, (q15_t)0xE0B5, (q15_t)0x7C1D,
+    (q15_t)0x6919, (q15_t)0x490F, (q15_t)0x2C98, (q15_t)0x77FA, (q15_t)0xE023, (q15_t)0x7BF8, (q15_t)0x68FD, (q15_t)0x4938,
+    (q15_t)0x2C3A, (q15_t)0x781D, (q15_t)0xDF91, (q15_t)0x7BD2, (q15_t)0x68E0, (q15_t)0x4961, (q15_t)0x2BDC, (q15_t)0x7840,
+    (q15_t)0xDEFF, (q15_t)0x7BAC, (q15_t)0x68C3, (q15_t)0x498A, (q15_t)0x2B7D, (q15_t)0x7862, (q15_t)0xDE6D, (q15_t)0x7B84,
+    (q15_t)0x68A6, (q15_t)0x49B4, (q15_t)0x2B1F, (q15_t)0x7884, (q15_t)0xDDDC, (q15_t)0x7B5D, (q15_t)0x6889, (q15_t)0x49DD,
+    (q15_t)0x2AC0, (q15_t)0x78A6, (q15_t)0xDD4B, (q15_t)0x7B34, (q15_t)0x686C, (q15_t)0x4A06, (q15_t)0x2A61, (q15_t)0x78C7,
+    (q15_t)0xDCBA, (q15_t)0x7B0B, (q15_t)0x684F, (q15_t)0x4A2F, (q15_t)0x2A02, (q15_t)0x78E8, (q15_t)0xDC29, (q15_t)0x7AE1,
+    (q15_t)0x6832, (q15_t)0x4A58, (q15_t)0x29A3, (q15_t)0x7909, (q15_t)0xDB98, (q15_t)0x7AB6, (q15_t)0x6815, (q15_t)0x4A81,
+    (q15_t)0x2944, (q15_t)0x792A, (q15_t)0xDB08, (q15_t)0x7A8B, (q15_t)0x67F7, (q15_t)0x4AA9, (q15_t)0x28E5, (q15_t)0x794A,
+    (q15_t)0xDA77, (q15_t)0x7A5F, (q15_t)0x67DA, (q15_t)0x4AD2, (q15_t)0x2886, (q15_t)0x796A, (q15_t)0xD9E7, (q15_t)0x7A33,
+    (q15_t)0x67BD, (q15_t)0x4AFB, (q15_t)0x2826, (q15_t)0x798A, (q15_t)0xD957, (q15_t)0x7A05, (q15_t)0x679F, (q15_t)0x4B24,
+    (q15_t)0x27C7, (q15_t)0x79A9, (q15_t)0xD8C8, (q15_t)0x79D8, (q15_t)0x6782, (q15_t)0x4B4C, (q15_t)0x2767, (q15_t)0x79C8,
+    (q15_t)0xD838, (q15_t)0x79A9, (q15_t)0x6764, (q15_t)0x4B75, (q15_t)0x2707, (q15_t)0x79E7, (q15_t)0xD7A9, (q15_t)0x797A,
+    (q15_t)0x6746, (q15_t)0x4B9E, (q15_t)0x26A8, (q15_t)0x7A05, (q15_t)0xD71A, (q15_t)0x794A, (q15_t)0x6729, (q15_t)0x4BC6,
+    (q15_t)0x2648, (q15_t)0x7A24, (q15_t)0xD68B, (q15_t)0x7919, (q15_t)0x670B, (q15_t)0x4BEF, (q15_t)0x25E8, (q15_t)0x7A42,
+    (q15_t)0xD5FD, (q15_t)0x78E8, (q15_t)0x66ED, (q15_t)0x4C17, (q15_t)0x2588, (q15_t)0x7A5F, (q15_t)0xD56E, (q15_t)0x78B6,
+    (q15_t)0x66CF, (q15_t)0x4C3F, (q15_t)0x2528, (q15_t)0x7A7D, (q15_t)0xD4E0, (q15_t)0x7884, (q15_t)0x66B1, (q15_t)0x4C68,
+    (q15_t)0x24C7, (q15_t)0x7A9A, (q15_t)0xD452, (q15_t)0x7851, (q15_t)0x6693, (q15_t)0x4C90, (q15_t)0x2467, (q15_t)0x7AB6,
+    (q15_t)0xD3C5, (q15_t)0x781D, (q15_t)0x6675, (q15_t)0x4CB8, (q15_t)0x2407, (q15_t)0x7AD3, (q15_t)0xD337, (q15_t)0x77E9,
+    (q15_t)0x6657, (q15_t)0x4CE1, (q15_t)0x23A6, (q15_t)0x7AEF, (q15_t)0xD2AA, (q15_t)0x77B4, (q15_t)0x6639, (q15_t)0x4D09,
+    (q15_t)0x2345, (q15_t)0x7B0B, (q15_t)0xD21D, (q15_t)0x777E, (q15_t)0x661A, (q15_t)0x4D31, (q15_t)0x22E5, (q15_t)0x7B26,
+    (q15_t)0xD191, (q15_t)0x7747, (q15_t)0x65FC, (q15_t)0x4D59, (q15_t)0x2284, (q15_t)0x7B42, (q15_t)0xD104, (q15_t)0x7710,
+    (q15_t)0x65DD, (q15_t)0x4D81, (q15_t)0x2223, (q15_t)0x7B5D, (q15_t)0xD078, (q15_t)0x76D9, (q15_t)0x65BF, (q15_t)0x4DA9,
+    (q15_t)0x21C2, (q15_t)0x7B77, (q15_t)0xCFEC, (q15_t)0x76A0, (q15_t)0x65A0, (q15_t)0x4DD1, (q15_t)0x2161, (q15_t)0x7B92,
+    (q15_t)0xCF61, (q15_t)0x7668, (q15_t)0x6582, (q15_t)0x4DF9, (q15_t)0x2100, (q15_t)0x7BAC, (q15_t)0xCED5, (q15_t)0x762E,
+    (q15_t)0x6563, (q15_t)0x4E21, (q15_t)0x209F, (q15_t)0x7BC5, (q15_t)0xCE4A, (q15_t)0x75F4, (q15_t)0x6545, (q15_t)0x4E48,
+    (q15_t)0x203E, (q15_t)0x7BDF, (q15_t)0xCDBF, (q15_t)0x75B9, (q15_t)0x6526, (q15_t)0x4E70, (q15_t)0x1FDC, (q15_t)0x7BF8,
+    (q15_t)0xCD35, (q15_t)0x757D, (q15_t)0x6507, (q15_t)0x4E98, (q15_t)0x1F7B, (q15_t)0x7C11, (q15_t)0xCCAB, (q15_t)0x7541,
+    (q15_t)0x64E8, (q15_t)0x4EBF, (q15_t)0x1F19, (q15_t)0x7C29, (q15_t)0xCC21, (q15_t)0x7504, (q15_t)0x64C9, (q15_t)0x4EE7,
+    (q15_t)0x1EB8, (q15_t)0x7C42, (q15_t)0xCB97, (q15_t)0x74C7, (q15_t)0x64AA, (q15_t)0x4F0F, (q15_t)0x1E56, (q15_t)0x7C5A,
+    (q15_t)0xCB0D, (q15_t)0x7489, (q15_t)0x648B, (q15_t)0x4F36, (q15_t)0x1DF5, (q15_t)0x7C71, (q15_t)0xCA84, (q15_t)0x744A,
+    (q15_t)0x646C, (q15_t)0x4F5E, (q15_t)0x1D93, (q15_t)0x7C89, (q15_t)0xC9FB, (q15_t)0x740B, (q15_t)0x644D, (q15_t)0x4F85,
+    (q15_t)0x1D31, (q15_t)0x7CA0, (q15_t)0xC973, (q15_t)0x73CB, (q15_t)0x642D, (q15_t)0x4FAC, (q15_t)0x1CCF, (q15_t)0x7CB7,
+    (q15_t)0xC8EB, (q15_t)0x738A, (q15_t)0x640E, (q15_t)0x4FD4, (q15_t)0x1C6D, (q15_t)0x7CCD, (q15_t)0xC863, (q15_t)0x7349,
+    (q15_t)0x63EF, (q15_t)0x4FFB, (q15_t)0x1C0B, (q15_t)0x7CE3, (q15_t)0xC7DB, (q15_t)0x7307, (q15_t)0x63CF, (q15_t)0x5022,
+    (q15_t)0x1BA9, (q15_t)0x7CF9, (q15_t)0xC754, (q15_t)0x72C5, (q15_t)0x63B0, (q15_t)0x5049, (q15_t)0x1B47, (q15_t)0x7D0F,
+    (q15_t)0xC6CD, (q15_t)0x7282, (q15_t)0x6390, (q15_t)0x5070, (q15_t)0x1AE4, (q15_t)0x7D24, (q15_t)0xC646, (q15_t)0x723E,
+    (q15_t)0x6371, (q15_t)0x5097, (q15_t)0x1A82, (q15_t)0x7D39, (q15_t)0xC5BF, (q15_t)0x71FA, (q15_t)0x6351, (q15_t)0x50BF,
+    (q15_t)0x1A20, (q15_t)0x7D4E, (q15_t)0xC539, (q15_t)0x71B5, (q15_t)0x6331, (q15_t)0x50E5, (q15_t)0x19BD, (q15_t)0x7D62,
+    (q15_t)0xC4B3, (q15_t)0x716F, (q15_t)0x6311, (q15_t)0x510C, (q15_t)0x195B, (q15_t)0x7D76, (q15_t)0xC42E, (q15_t)0x7129,
+    (q15_t)0x62F2, (q15_t)0x5133, (q15_t)0x18F8, (q15_t)0x7D8A, (q15_t)0xC3A9, (q15_t)0x70E2, (q15_t)0x62D2, (q15_t)0x515A,
+    (q15_t)0x1896, (q15_t)0x7D9D, (q15_t)0xC324, (q15_t)0x709B, (q15_t)0x62B2, (q15_t)0x5181, (q15_t)0x1833, (q15_t)0x7DB0,
+    (q15_t)0xC29F, (q15_t)0x7053, (q15_t)0x6292, (q15_t)0x51A8, (q15_t)0x17D0, (q15_t)0x7DC3, (q15_t)0xC21B, (q15_t)0x700A,
+    (q15_t)0x6271, (q15_t)0x51CE, (q15_t)0x176D, (q15_t)0x7DD6, (q15_t)0xC197, (q15_t)0x6FC1, (q15_t)0x6251, (q15_t)0x51F5,
+    (q15_t)0x170A, (q15_t)0x7DE8, (q15_t)0xC114, (q15_t)0x6F77, (q15_t)0x6231, (q15_t)0x521C, (q15_t)0x16A8, (q15_t)0x7DFA,
+    (q15_t)0xC091, (q15_t)0x6F2D, (q15_t)0x6211, (q15_t)0x5242, (q15_t)0x1645, (q15_t)0x7E0C, (q15_t)0xC00E, (q15_t)0x6EE2,
+    (q15_t)0x61F1, (q15_t)0x5269, (q15_t)0x15E2, (q15_t)0x7E1D, (q15_t)0xBF8C, (q15_t)0x6E96, (q15_t)0x61D0, (q15_t)0x528F,
+    (q15_t)0x157F, (q15_t)0x7E2E, (q15_t)0xBF09, (q15_t)0x6E4A, (q15_t)0x61B0, (q15_t)0x52B5, (q15_t)0x151B, (q15_t)0x7E3F,
+    (q15_t)0xBE88, (q15_t)0x6DFD, (q15_t)0x618F, (q15_t)0x52DC, (q15_t)0x14B8, (q15_t)0x7E4F, (q15_t)0xBE06, (q15_t)0x6DB0,
+    (q15_t)0x616F, (q15_t)0x5302, (q15_t)0x1455, (q15_t)0x7E5F, (q15_t)0xBD85, (q15_t)0x6D62, (q15_t)0x614E, (q15_t)0x5328,
+    (q15_t)0x13F2, (q15_t)0x7E6F, (q15_t)0xBD05, (q15_t)0x6D13, (q15_t)0x612D, (q15_t)0x534E, (q15_t)0x138E, (q15_t)0x7E7F,
+    (q15_t)0xBC84, (q15_t)0x6CC4, (q15_t)0x610D, (q15_t)0x5375, (q15_t)0x132B, (q15_t)0x7E8E, (q15_t)0xBC04, (q15_t)0x6C74,
+    (q15_t)0x60EC, (q15_t)0x539B, (q15_t)0x12C8, (q15_t)0x7E9D, (q15_t)0xBB85, (q15_t)0x6C24, (q15_t)0x60CB, (q15_t)0x53C1,
+    (q15_t)0x1264, (q15_t)0x7EAB, (q15_t)0xBB05, (q15_t)0x6BD3, (q15_t)0x60AA, (q15_t)0x53E7, (q15_t)0x1201, (q15_t)0x7EBA,
+    (q15_t)0xBA87, (q15_t)0x6B81, (q15_t)0x6089, (q15_t)0x540D, (q15_t)0x119D, (q15_t)0x7EC8, (q15_t)0xBA08, (q15_t)0x6B2F,
+    (q15_t)0x6068, (q15_t)0x5433, (q15_t)0x1139, (q15_t)0x7ED5, (q15_t)0xB98A, (q15_t)0x6ADC, (q15_t)0x6047, (q15_t)0x5458,
+    (q15_t)0x10D6, (q15_t)0x7EE3, (q15_t)0xB90C, (q15_t)0x6A89, (q15_t)0x6026, (q15_t)0x547E, (q15_t)0x1072, (q15_t)0x7EF0,
+    (q15_t)0xB88F, (q15_t)0x6A35, (q15_t)0x6004, (q15_t)0x54A4, (q15_t)0x100E, (q15_t)0x7EFD, (q15_t)0xB812, (q15_t)0x69E1,
+    (q15_t)0x5FE3, (q15_t)0x54CA, (q15_t)0x0FAB, (q15_t)0x7F09, (q15_t)0xB796, (q15_t)0x698C, (q15_t)0x5FC2, (q15_t)0x54EF,
+    (q15_t)0x0F47, (q15_t)0x7F15, (q15_t)0xB719, (q15_t)0x6936, (q15_t)0x5FA0, (q15_t)0x5515, (q15_t)0x0EE3, (q15_t)0x7F21,
+    (q15_t)0xB69E, (q15_t)0x68E0, (q15_t)0x5F7F, (q15_t)0x553A, (q15_t)0x0E7F, (q15_t)0x7F2D, (q15_t)0xB622, (q15_t)0x6889,
+    (q15_t)0x5F5E, (q15_t)0x5560, (q15_t)0x0E1B, (q15_t)0x7F38, (q15_t)0xB5A7, (q15_t)0x6832, (q15_t)0x5F3C, (q15_t)0x5585,
+    (q15_t)0x0DB7, (q15_t)0x7F43, (q15_t)0xB52D, (q15_t)0x67DA, (q15_t)0x5F1A, (q15_t)0x55AB, (q15_t)0x0D53, (q15_t)0x7F4D,
+    (q15_t)0xB4B3, (q15_t)0x6782, (q15_t)0x5EF9, (q15_t)0x55D0, (q15_t)0x0CEF, (q15_t)0x7F58, (q15_t)0xB439, (q15_t)0x6729,
+    (q15_t)0x5ED7, (q15_t)0x55F5, (q15_t)0x0C8B, (q15_t)0x7F62, (q15_t)0xB3C0, (q15_t)0x66CF, (q15_t)0x5EB5, (q15_t)0x561A,
+    (q15_t)0x0C27, (q15_t)0x7F6B, (q15_t)0xB347, (q15_t)0x6675, (q15_t)0x5E93, (q15_t)0x5640, (q15_t)0x0BC3, (q15_t)0x7F75,
+    (q15_t)0xB2CE, (q15_t)0x661A, (q15_t)0x5E71, (q15_t)0x5665, (q15_t)0x0B5F, (q15_t)0x7F7E, (q15_t)0xB256, (q15_t)0x65BF,
+    (q15_t)0x5E50, (q15_t)0x568A, (q15_t)0x0AFB, (q15_t)0x7F87, (q15_t)0xB1DE, (q15_t)0x6563, (q15_t)0x5E2D, (q15_t)0x56AF,
+    (q15_t)0x0A97, (q15_t)0x7F8F, (q15_t)0xB167, (q15_t)0x6507, (q15_t)0x5E0B, (q15_t)0x56D4, (q15_t)0x0A33, (q15_t)0x7F97,
+    (q15_t)0xB0F0, (q15_t)0x64AA, (q15_t)0x5DE9, (q15_t)0x56F9, (q15_t)0x09CE, (q15_t)0x7F9F, (q15_t)0xB07A, (q15_t)0x644D,
+    (q15_t)0x5DC7, (q15_t)0x571D, (q15_t)0x096A, (q15_t)0x7FA7, (q15_t)0xB004, (q15_t)0x63EF, (q15_t)0x5DA5, (q15_t)0x5742,
+    (q15_t)0x0906, (q15_t)0x7FAE, (q15_t)0xAF8F, (q15_t)0x6390, (q15_t)0x5D83, (q15_t)0x5767, (q15_t)0x08A2, (q15_t)0x7FB5,
+    (q15_t)0xAF1A, (q15_t)0x6331, (q15_t)0x5D60, (q15_t)0x578C, (q15_t)0x083D, (q15_t)0x7FBC, (q15_t)0xAEA5, (q15_t)0x62D2,
+    (q15_t)0x5D3E, (q15_t)0x57B0, (q15_t)0x07D9, (q15_t)0x7FC2, (q15_t)0xAE31, (q15_t)0x6271, (q15_t)0x5D1B, (q15_t)0x57D5,
+    (q15_t)0x0775, (q15_t)0x7FC8, (q15_t)0xADBD, (q15_t)0x6211, (q15_t)0x5CF9, (q15_t)0x57F9, (q15_t)0x0710, (q15_t)0x7FCE,
+    (q15_t)0xAD4A, (q15_t)0x61B0, (q15_t)0x5CD6, (q15_t)0x581E, (q15_t)0x06AC, (q15_t)0x7FD3, (q15_t)0xACD7, (q15_t)0x614E,
+    (q15_t)0x5CB4, (q15_t)0x5842, (q15_t)0x0647, (q15_t)0x7FD8, (q15_t)0xAC64, (q15_t)0x60EC, (q15_t)0x5C91, (q15_t)0x5867,
+    (q15_t)0x05E3, (q15_t)0x7FDD, (q15_t)0xABF2, (q15_t)0x6089, (q15_t)0x5C6E, (q15_t)0x588B, (q15_t)0x057F, (q15_t)0x7FE1,
+    (q15_t)0xAB81, (q15_t)0x6026, (q15_t)0x5C4B, (q15_t)0x58AF, (q15_t)0x051A, (q15_t)0x7FE5, (q15_t)0xAB10, (q15_t)0x5FC2,
+    (q15_t)0x5C29, (q15_t)0x58D4, (q15_t)0x04B6, (q15_t)0x7FE9, (q15_t)0xAA9F, (q15_t)0x5F5E, (q15_t)0x5C06, (q15_t)0x58F8,
+    (q15_t)0x0451, (q15_t)0x7FED, (q15_t)0xAA2F, (q15_t)0x5EF9, (q15_t)0x5BE3, (q15_t)0x591C, (q15_t)0x03ED, (q15_t)0x7FF0,
+    (q15_t)0xA9BF, (q15_t)0x5E93, (q15_t)0x5BC0, (q15_t)0x5940, (q15_t)0x0388, (q15_t)0x7FF3, (q15_t)0xA950, (q15_t)0x5E2D,
+    (q15_t)0x5B9D, (q15_t)0x5964, (q15_t)0x0324, (q15_t)0x7FF6, (q15_t)0xA8E2, (q15_t)0x5DC7, (q15_t)0x5B79, (q15_t)0x5988,
+    (q15_t)0x02BF, (q15_t)0x7FF8, (q15_t)0xA873, (q15_t)0x5D60, (q15_t)0x5B56, (q15_t)0x59AC, (q15_t)0x025B, (q15_t)0x7FFA,
+    (q15_t)0xA806, (q15_t)0x5CF9, (q15_t)0x5B33, (q15_t)0x59D0, (q15_t)0x01F6, (q15_t)0x7FFC, (q15_t)0xA798, (q15_t)0x5C91,
+    (q15_t)0x5B10, (q15_t)0x59F3, (q15_t)0x0192, (q15_t)0x7FFD, (q15_t)0xA72B, (q15_t)0x5C29, (q15_t)0x5AEC, (q15_t)0x5A17,
+    (q15_t)0x012D, (q15_t)0x7FFE, (q15_t)0xA6BF, (q15_t)0x5BC0, (q15_t)0x5AC9, (q15_t)0x5A3B, (q15_t)0x00C9, (q15_t)0x7FFF,
+    (q15_t)0xA653, (q15_t)0x5B56, (q15_t)0x5AA5, (q15_t)0x5A5E, (q15_t)0x0064, (q15_t)0x7FFF, (q15_t)0xA5E8, (q15_t)0x5AEC,
+    (q15_t)0x5A82, (q15_t)0x5A82, (q15_t)0x0000, (q15_t)0x7FFF, (q15_t)0xA57D, (q15_t)0x5A82, (q15_t)0x5A5E, (q15_t)0x5AA5,
+    (q15_t)0xFF9B, (q15_t)0x7FFF, (q15_t)0xA513, (q15_t)0x5A17, (q15_t)0x5A3B, (q15_t)0x5AC9, (q15_t)0xFF36, (q15_t)0x7FFF,
+    (q15_t)0xA4A9, (q15_t)0x59AC, (q15_t)0x5A17, (q15_t)0x5AEC, (q15_t)0xFED2, (q15_t)0x7FFE, (q15_t)0xA43F, (q15_t)0x5940,
+    (q15_t)0x59F3, (q15_t)0x5B10, (q15_t)0xFE6D, (q15_t)0x7FFD, (q15_t)0xA3D6, (q15_t)0x58D4, (q15_t)0x59D0, (q15_t)0x5B33,
+    (q15_t)0xFE09, (q15_t)0x7FFC, (q15_t)0xA36E, (q15_t)0x5867, (q15_t)0x59AC, (q15_t)0x5B56, (q15_t)0xFDA4, (q15_t)0x7FFA,
+    (q15_t)0xA306, (q15_t)0x57F9, (q15_t)0x5988, (q15_t)0x5B79, (q15_t)0xFD40, (q15_t)0x7FF8, (q15_t)0xA29F, (q15_t)0x578C,
+    (q15_t)0x5964, (q15_t)0x5B9D, (q15_t)0xFCDB, (q15_t)0x7FF6, (q15_t)0xA238, (q15_t)0x571D, (q15_t)0x5940, (q15_t)0x5BC0,
+    (q15_t)0xFC77, (q15_t)0x7FF3, (q15_t)0xA1D2, (q15_t)0x56AF, (q15_t)0x591C, (q15_t)0x5BE3, (q15_t)0xFC12, (q15_t)0x7FF0,
+    (q15_t)0xA16C, (q15_t)0x5640, (q15_t)0x58F8, (q15_t)0x5C06, (q15_t)0xFBAE, (q15_t)0x7FED, (q15_t)0xA106, (q15_t)0x55D0,
+    (q15_t)0x58D4, (q15_t)0x5C29, (q15_t)0xFB49, (q15_t)0x7FE9, (q15_t)0xA0A1, (q15_t)0x5560, (q15_t)0x58AF, (q15_t)0x5C4B,
+    (q15_t)0xFAE5, (q15_t)0x7FE5, (q15_t)0xA03D, (q15_t)0x54EF, (q15_t)0x588B, (q15_t)0x5C6E, (q15_t)0xFA80, (q15_t)0x7FE1,
+    (q15_t)0x9FD9, (q15_t)0x547E, (q15_t)0x5867, (q15_t)0x5C91, (q15_t)0xFA1C, (q15_t)0x7FDD, (q15_t)0x9F76, (q15_t)0x540D,
+    (q15_t)0x5842, (q15_t)0x5CB4, (q15_t)0xF9B8, (q15_t)0x7FD8, (q15_t)0x9F13, (q15_t)0x539B, (q15_t)0x581E, (q15_t)0x5CD6,
+    (q15_t)0xF953, (q15_t)0x7FD3, (q15_t)0x9EB1, (q15_t)0x5328, (q15_t)0x57F9, (q15_t)0x5CF9, (q15_t)0xF8EF, (q15_t)0x7FCE,
+    (q15_t)0x9E4F, (q15_t)0x52B5, (q15_t)0x57D5, (q15_t)0x5D1B, (q15_t)0xF88A, (q15_t)0x7FC8, (q15_t)0x9DEE, (q15_t)0x5242,
+    (q15_t)0x57B0, (q15_t)0x5D3E, (q15_t)0xF826, (q15_t)0x7FC2, (q15_t)0x9D8E, (q15_t)0x51CE, (q15_t)0x578C, (q15_t)0x5D60,
+    (q15_t)0xF7C2, (q15_t)0x7FBC, (q15_t)0x9D2D, (q15_t)0x515A, (q15_t)0x5767, (q15_t)0x5D83, (q15_t)0xF75D, (q15_t)0x7FB5,
+    (q15_t)0x9CCE, (q15_t)0x50E5, (q15_t)0x5742, (q15_t)0x5DA5, (q15_t)0xF6F9, (q15_t)0x7FAE, (q15_t)0x9C6F, (q15_t)0x5070,
+    (q15_t)0x571D, (q15_t)0x5DC7, (q15_t)0xF695, (q15_t)0x7FA7, (q15_t)0x9C10, (q15_t)0x4FFB, (q15_t)0x56F9, (q15_t)0x5DE9,
+    (q15_t)0xF631, (q15_t)0x7F9F, (q15_t)0x9BB2, (q15_t)0x4F85, (q15_t)0x56D4, (q15_t)0x5E0B, (q15_t)0xF5CC, (q15_t)0x7F97,
+    (q15_t)0x9B55, (q15_t)0x4F0F, (q15_t)0x56AF, (q15_t)0x5E2D, (q15_t)0xF568, (q15_t)0x7F8F, (q15_t)0x9AF8, (q15_t)0x4E98,
+    (q15_t)0x568A, (q15_t)0x5E50, (q15_t)0xF504, (q15_t)0x7F87, (q15_t)0x9A9C, (q15_t)0x4E21, (q15_t)0x5665, (q15_t)0x5E71,
+    (q15_t)0xF4A0, (q15_t)0x7F7E, (q15_t)0x9A40, (q15_t)0x4DA9, (q15_t)0x5640, (q15_t)0x5E93, (q15_t)0xF43C, (q15_t)0x7F75,
+    (q15_t)0x99E5, (q15_t)0x4D31, (q15_t)0x561A, (q15_t)0x5EB5, (q15_t)0xF3D8, (q15_t)0x7F6B, (q15_t)0x998A, (q15_t)0x4CB8,
+    (q15_t)0x55F5, (q15_t)0x5ED7, (q15_t)0xF374, (q15_t)0x7F62, (q15_t)0x9930, (q15_t)0x4C3F, (q15_t)0x55D0, (q15_t)0x5EF9,
+    (q15_t)0xF310, (q15_t)0x7F58, (q15_t)0x98D6, (q15_t)0x4BC6, (q15_t)0x55AB, (q15_t)0x5F1A, (q15_t)0xF2AC, (q15_t)0x7F4D,
+    (q15_t)0x987D, (q15_t)0x4B4C, (q15_t)0x5585, (q15_t)0x5F3C, (q15_t)0xF248, (q15_t)0x7F43, (q15_t)0x9825, (q15_t)0x4AD2,
+    (q15_t)0x5560, (q15_t)0x5F5E, (q15_t)0xF1E4, (q15_t)0x7F38, (q15_t)0x97CD, (q15_t)0x4A58, (q15_t)0x553A, (q15_t)0x5F7F,
+    (q15_t)0xF180, (q15_t)0x7F2D, (q15_t)0x9776, (q15_t)0x49DD, (q15_t)0x5515, (q15_t)0x5FA0, (q15_t)0xF11C, (q15_t)0x7F21,
+    (q15_t)0x971F, (q15_t)0x4961, (q15_t)0x54EF, (q15_t)0x5FC2, (q15_t)0xF0B8, (q15_t)0x7F15, (q15_t)0x96C9, (q15_t)0x48E6,
+    (q15_t)0x54CA, (q15_t)0x5FE3, (q15_t)0xF054, (q15_t)0x7F09, (q15_t)0x9673, (q15_t)0x4869, (q15_t)0x54A4, (q15_t)0x6004,
+    (q15_t)0xEFF1, (q15_t)0x7EFD, (q15_t)0x961E, (q15_t)0x47ED, (q15_t)0x547E, (q15_t)0x6026, (q15_t)0xEF8D, (q15_t)0x7EF0,
+    (q15_t)0x95CA, (q15_t)0x4770, (q15_t)0x5458, (q15_t)0x6047, (q15_t)0xEF29, (q15_t)0x7EE3, (q15_t)0x9576, (q15_t)0x46F3,
+    (q15_t)0x5433, (q15_t)0x6068, (q15_t)0xEEC6, (q15_t)0x7ED5, (q15_t)0x9523, (q15_t)0x4675, (q15_t)0x540D, (q15_t)0x6089,
+    (q15_t)0xEE62, (q15_t)0x7EC8, (q15_t)0x94D0, (q15_t)0x45F7, (q15_t)0x53E7, (q15_t)0x60AA, (q15_t)0xEDFE, (q15_t)0x7EBA,
+    (q15_t)0x947E, (q15_t)0x4578, (q15_t)0x53C1, (q15_t)0x60CB, (q15_t)0xED9B, (q15_t)0x7EAB, (q15_t)0x942C, (q15_t)0x44FA,
+    (q15_t)0x539B, (q15_t)0x60EC, (q15_t)0xED37, (q15_t)0x7E9D, (q15_t)0x93DB, (q15_t)0x447A, (q15_t)0x5375, (q15_t)0x610D,
+    (q15_t)0xECD4, (q15_t)0x7E8E, (q15_t)0x938B, (q15_t)0x43FB, (q15_t)0x534E, (q15_t)0x612D, (q15_t)0xEC71, (q15_t)0x7E7F,
+    (q15_t)0x933B, (q15_t)0x437B, (q15_t)0x5328, (q15_t)0x614E, (q15_t)0xEC0D, (q15_t)0x7E6F, (q15_t)0x92EC, (q15_t)0x42FA,
+    (q15_t)0x5302, (q15_t)0x616F, (q15_t)0xEBAA, (q15_t)0x7E5F, (q15_t)0x929D, (q15_t)0x427A, (q15_t)0x52DC, (q15_t)0x618F,
+    (q15_t)0xEB47, (q15_t)0x7E4F, (q15_t)0x924F, (q15_t)0x41F9, (q15_t)0x52B5, (q15_t)0x61B0, (q15_t)0xEAE4, (q15_t)0x7E3F,
+    (q15_t)0x9202, (q15_t)0x4177, (q15_t)0x528F, (q15_t)0x61D0, (q15_t)0xEA80, (q15_t)0x7E2E, (q15_t)0x91B5, (q15_t)0x40F6,
+    (q15_t)0x5269, (q15_t)0x61F1, (q15_t)0xEA1D, (q15_t)0x7E1D, (q15_t)0x9169, (q15_t)0x4073, (q15_t)0x5242, (q15_t)0x6211,
+    (q15_t)0xE9BA, (q15_t)0x7E0C, (q15_t)0x911D, (q15_t)0x3FF1, (q15_t)0x521C, (q15_t)0x6231, (q15_t)0xE957, (q15_t)0x7DFA,
+    (q15_t)0x90D2, (q15_t)0x3F6E, (q15_t)0x51F5, (q15_t)0x6251, (q15_t)0xE8F5, (q15_t)0x7DE8, (q15_t)0x9088, (q15_t)0x3EEB,
+    (q15_t)0x51CE, (q15_t)0x6271, (q15_t)0xE892, (q15_t)0x7DD6, (q15_t)0x903E, (q15_t)0x3E68, (q15_t)0x51A8, (q15_t)0x6292,
+    (q15_t)0xE82F, (q15_t)0x7DC3, (q15_t)0x8FF5, (q15_t)0x3DE4, (q15_t)0x5181, (q15_t)0x62B2, (q15_t)0xE7CC, (q15_t)0x7DB0,
+    (q15_t)0x8FAC, (q15_t)0x3D60, (q15_t)0x515A, (q15_t)0x62D2, (q15_t)0xE769, (q15_t)0x7D9D, (q15_t)0x8F64, (q15_t)0x3CDB,
+    (q15_t)0x5133, (q15_t)0x62F2, (q15_t)0xE707, (q15_t)0x7D8A, (q15_t)0x8F1D, (q15_t)0x3C56, (q15_t)0x510C, (q15_t)0x6311,
+    (q15_t)0xE6A4, (q15_t)0x7D76, (q15_t)0x8ED6, (q15_t)0x3BD1, (q15_t)0x50E5, (q15_t)0x6331, (q15_t)0xE642, (q15_t)0x7D62,
+    (q15_t)0x8E90, (q15_t)0x3B4C, (q15_t)0x50BF, (q15_t)0x6351, (q15_t)0xE5DF, (q15_t)0x7D4E, (q15_t)0x8E4A, (q15_t)0x3AC6,
+    (q15_t)0x5097, (q15_t)0x6371, (q15_t)0xE57D, (q15_t)0x7D39, (q15_t)0x8E05, (q15_t)0x3A40, (q15_t)0x5070, (q15_t)0x6390,
+    (q15_t)0xE51B, (q15_t)0x7D24, (q15_t)0x8DC1, (q15_t)0x39B9, (q15_t)0x5049, (q15_t)0x63B0, (q15_t)0xE4B8, (q15_t)0x7D0F,
+    (q15_t)0x8D7D, (q15_t)0x3932, (q15_t)0x5022, (q15_t)0x63CF, (q15_t)0xE456, (q15_t)0x7CF9, (q15_t)0x8D3A, (q15_t)0x38AB,
+    (q15_t)0x4FFB, (q15_t)0x63EF, (q15_t)0xE3F4, (q15_t)0x7CE3, (q15_t)0x8CF8, (q15_t)0x3824, (q15_t)0x4FD4, (q15_t)0x640E,
+    (q15_t)0xE392, (q15_t)0x7CCD, (q15_t)0x8CB6, (q15_t)0x379C, (q15_t)0x4FAC, (q15_t)0x642D, (q15_t)0xE330, (q15_t)0x7CB7,
+    (q15_t)0x8C75, (q15_t)0x3714, (q15_t)0x4F85, (q15_t)0x644D, (q15_t)0xE2CE, (q15_t)0x7CA0, (q15_t)0x8C34, (q15_t)0x368C,
+    (q15_t)0x4F5E, (q15_t)0x646C, (q15_t)0xE26C, (q15_t)0x7C89, (q15_t)0x8BF4, (q15_t)0x3604, (q15_t)0x4F36, (q15_t)0x648B,
+    (q15_t)0xE20A, (q15_t)0x7C71, (q15_t)0x8BB5, (q15_t)0x357B, (q15_t)0x4F0F, (q15_t)0x64AA, (q15_t)0xE1A9, (q15_t)0x7C5A,
+    (q15_t)0x8B76, (q15_t)0x34F2, (q15_t)0x4EE7, (q15_t)0x64C9, (q15_t)0xE147, (q15_t)0x7C42, (q15_t)0x8B38, (q15_t)0x3468,
+    (q15_t)0x4EBF, (q15_t)0x64E8, (q15_t)0xE0E6, (q15_t)0x7C29, (q15_t)0x8AFB, (q15_t)0x33DE, (q15_t)0x4E98, (q15_t)0x6507,
+    (q15_t)0xE084, (q15_t)0x7C11, (q15_t)0x8ABE, (q15_t)0x3354, (q15_t)0x4E70, (q15_t)0x6526, (q15_t)0xE023, (q15_t)0x7BF8,
+    (q15_t)0x8A82, (q15_t)0x32CA, (q15_t)0x4E48, (q15_t)0x6545, (q15_t)0xDFC1, (q15_t)0x7BDF, (q15_t)0x8A46, (q15_t)0x3240,
+    (q15_t)0x4E21, (q15_t)0x6563, (q15_t)0xDF60, (q15_t)0x7BC5, (q15_t)0x8A0B, (q15_t)0x31B5, (q15_t)0x4DF9, (q15_t)0x6582,
+    (q15_t)0xDEFF, (q15_t)0x7BAC, (q15_t)0x89D1, (q15_t)0x312A, (q15_t)0x4DD1, (q15_t)0x65A0, (q15_t)0xDE9E, (q15_t)0x7B92,
+    (q15_t)0x8997, (q15_t)0x309E, (q15_t)0x4DA9, (q15_t)0x65BF, (q15_t)0xDE3D, (q15_t)0x7B77, (q15_t)0x895F, (q15_t)0x3013,
+    (q15_t)0x4D81, (q15_t)0x65DD, (q15_t)0xDDDC, (q15_t)0x7B5D, (q15_t)0x8926, (q15_t)0x2F87, (q15_t)0x4D59, (q15_t)0x65FC,
+    (q15_t)0xDD7B, (q15_t)0x7B42, (q15_t)0x88EF, (q15_t)0x2EFB, (q15_t)0x4D31, (q15_t)0x661A, (q15_t)0xDD1A, (q15_t)0x7B26,
+    (q15_t)0x88B8, (q15_t)0x2E6E, (q15_t)0x4D09, (q15_t)0x6639, (q15_t)0xDCBA, (q15_t)0x7B0B, (q15_t)0x8881, (q15_t)0x2DE2,
+    (q15_t)0x4CE1, (q15_t)0x6657, (q15_t)0xDC59, (q15_t)0x7AEF, (q15_t)0x884B, (q15_t)0x2D55, (q15_t)0x4CB8, (q15_t)0x6675,
+    (q15_t)0xDBF8, (q15_t)0x7AD3, (q15_t)0x8816, (q15_t)0x2CC8, (q15_t)0x4C90, (q15_t)0x6693, (q15_t)0xDB98, (q15_t)0x7AB6,
+    (q15_t)0x87E2, (q15_t)0x2C3A, (q15_t)0x4C68, (q15_t)0x66B1, (q15_t)0xDB38, (q15_t)0x7A9A, (q15_t)0x87AE, (q15_t)0x2BAD,
+    (q15_t)0x4C3F, (q15_t)0x66CF, (q15_t)0xDAD7, (q15_t)0x7A7D, (q15_t)0x877B, (q15_t)0x2B1F, (q15_t)0x4C17, (q15_t)0x66ED,
+    (q15_t)0xDA77, (q15_t)0x7A5F, (q15_t)0x8749, (q15_t)0x2A91, (q15_t)0x4BEF, (q15_t)0x670B, (q15_t)0xDA17, (q15_t)0x7A42,
+    (q15_t)0x8717, (q15_t)0x2A02, (q15_t)0x4BC6, (q15_t)0x6729, (q15_t)0xD9B7, (q15_t)0x7A24, (q15_t)0x86E6, (q15_t)0x2974,
+    (q15_t)0x4B9E, (q15_t)0x6746, (q15_t)0xD957, (q15_t)0x7A05, (q15_t)0x86B5, (q15_t)0x28E5, (q15_t)0x4B75, (q15_t)0x6764,
+    (q15_t)0xD8F8, (q15_t)0x79E7, (q15_t)0x8685, (q15_t)0x2856, (q15_t)0x4B4C, (q15_t)0x6782, (q15_t)0xD898, (q15_t)0x79C8,
+    (q15_t)0x8656, (q15_t)0x27C7, (q15_t)0x4B24, (q15_t)0x679F, (q15_t)0xD838, (q15_t)0x79A9, (q15_t)0x8627, (q15_t)0x2737,
+    (q15_t)0x4AFB, (q15_t)0x67BD, (q15_t)0xD7D9, (q15_t)0x798A, (q15_t)0x85FA, (q15_t)0x26A8, (q15_t)0x4AD2, (q15_t)0x67DA,
+    (q15_t)0xD779, (q15_t)0x796A, (q15_t)0x85CC, (q15_t)0x2618, (q15_t)0x4AA9, (q15_t)0x67F7, (q15_t)0xD71A, (q15_t)0x794A,
+    (q15_t)0x85A0, (q15_t)0x2588, (q15_t)0x4A81, (q15_t)0x6815, (q15_t)0xD6BB, (q15_t)0x792A, (q15_t)0x8574, (q15_t)0x24F7,
+    (q15_t)0x4A58, (q15_t)0x6832, (q15_t)0xD65C, (q15_t)0x7909, (q15_t)0x8549, (q15_t)0x2467, (q15_t)0x4A2F, (q15_t)0x684F,
+    (q15_t)0xD5FD, (q15_t)0x78E8, (q15_t)0x851E, (q15_t)0x23D6, (q15_t)0x4A06, (q15_t)0x686C, (q15_t)0xD59E, (q15_t)0x78C7,
+    (q15_t)0x84F4, (q15_t)0x2345, (q15_t)0x49DD, (q15_t)0x6889, (q15_t)0xD53F, (q15_t)0x78A6, (q15_t)0x84CB, (q15_t)0x22B4,
+    (q15_t)0x49B4, (q15_t)0x68A6, (q15_t)0xD4E0, (q15_t)0x7884, (q15_t)0x84A2, (q15_t)0x2223, (q15_t)0x498A, (q15_t)0x68C3,
+    (q15_t)0xD482, (q15_t)0x7862, (q15_t)0x847B, (q15_t)0x2192, (q15_t)0x4961, (q15_t)0x68E0, (q15_t)0xD423, (q15_t)0x7840,
+    (q15_t)0x8453, (q15_t)0x2100, (q15_t)0x4938, (q15_t)0x68FD, (q15_t)0xD3C5, (q15_t)0x781D, (q15_t)0x842D, (q15_t)0x206E,
+    (q15_t)0x490F, (q15_t)0x6919, (q15_t)0xD367, (q15_t)0x77FA, (q15_t)0x8407, (q15_t)0x1FDC, (q15_t)0x48E6, (q15_t)0x6936,
+    (q15_t)0xD308, (q15_t)0x77D7, (q15_t)0x83E2, (q15_t)0x1F4A, (q15_t)0x48BC, (q15_t)0x6953, (q15_t)0xD2AA, (q15_t)0x77B4,
+    (q15_t)0x83BD, (q15_t)0x1EB8, (q15_t)0x4893, (q15_t)0x696F, (q15_t)0xD24C, (q15_t)0x7790, (q15_t)0x8399, (q15_t)0x1E25,
+    (q15_t)0x4869, (q15_t)0x698C, (q15_t)0xD1EE, (q15_t)0x776C, (q15_t)0x8376, (q15_t)0x1D93, (q15_t)0x4840, (q15_t)0x69A8,
+    (q15_t)0xD191, (q15_t)0x7747, (q15_t)0x8354, (q15_t)0x1D00, (q15_t)0x4816, (q15_t)0x69C4, (q15_t)0xD133, (q15_t)0x7723,
+    (q15_t)0x8332, (q15_t)0x1C6D, (q15_t)0x47ED, (q15_t)0x69E1, (q15_t)0xD0D6, (q15_t)0x76FE, (q15_t)0x8311, (q15_t)0x1BDA,
+    (q15_t)0x47C3, (q15_t)0x69FD, (q15_t)0xD078, (q15_t)0x76D9, (q15_t)0x82F0, (q15_t)0x1B47, (q15_t)0x479A, (q15_t)0x6A19,
+    (q15_t)0xD01B, (q15_t)0x76B3, (q15_t)0x82D0, (q15_t)0x1AB3, (q15_t)0x4770, (q15_t)0x6A35, (q15_t)0xCFBE, (q15_t)0x768E,
+    (q15_t)0x82B1, (q15_t)0x1A20, (q15_t)0x4746, (q15_t)0x6A51, (q15_t)0xCF61, (q15_t)0x7668, (q15_t)0x8293, (q15_t)0x198C,
+    (q15_t)0x471C, (q15_t)0x6A6D, (q15_t)0xCF04, (q15_t)0x7641, (q15_t)0x8275, (q15_t)0x18F8, (q15_t)0x46F3, (q15_t)0x6A89,
+    (q15_t)0xCEA7, (q15_t)0x761B, (q15_t)0x8258, (q15_t)0x1864, (q15_t)0x46C9, (q15_t)0x6AA5, (q15_t)0xCE4A, (q15_t)0x75F4,
+    (q15_t)0x823C, (q15_t)0x17D0, (q15_t)0x469F, (q15_t)0x6AC1, (q15_t)0xCDEE, (q15_t)0x75CC, (q15_t)0x8220, (q15_t)0x173C,
+    (q15_t)0x4675, (q15_t)0x6ADC, (q15_t)0xCD91, (q15_t)0x75A5, (q15_t)0x8205, (q15_t)0x16A8, (q15_t)0x464B, (q15_t)0x6AF8,
+    (q15_t)0xCD35, (q15_t)0x757D, (q15_t)0x81EB, (q15_t)0x1613, (q15_t)0x4621, (q15_t)0x6B13, (q15_t)0xCCD9, (q15_t)0x7555,
+    (q15_t)0x81D1, (q15_t)0x157F, (q15_t)0x45F7, (q15_t)0x6B2F, (q15_t)0xCC7D, (q15_t)0x752D, (q15_t)0x81B8, (q15_t)0x14EA,
+    (q15_t)0x45CD, (q15_t)0x6B4A, (q15_t)0xCC21, (q15_t)0x7504, (q15_t)0x81A0, (q15_t)0x1455, (q15_t)0x45A3, (q15_t)0x6B66,
+    (q15_t)0xCBC5, (q15_t)0x74DB, (q15_t)0x8188, (q15_t)0x13C0, (q15_t)0x4578, (q15_t)0x6B81, (q15_t)0xCB69, (q15_t)0x74B2,
+    (q15_t)0x8171, (q15_t)0x132B, (q15_t)0x454E, (q15_t)0x6B9C, (q15_t)0xCB0D, (q15_t)0x7489, (q15_t)0x815B, (q15_t)0x1296,
+    (q15_t)0x4524, (q15_t)0x6BB8, (q15_t)0xCAB2, (q15_t)0x745F, (q15_t)0x8145, (q15_t)0x1201, (q15_t)0x44FA, (q15_t)0x6BD3,
+    (q15_t)0xCA57, (q15_t)0x7435, (q15_t)0x8130, (q15_t)0x116B, (q15_t)0x44CF, (q15_t)0x6BEE, (q15_t)0xC9FB, (q15_t)0x740B,
+    (q15_t)0x811C, (q15_t)0x10D6, (q15_t)0x44A5, (q15_t)0x6C09, (q15_t)0xC9A0, (q15_t)0x73E0, (q15_t)0x8109, (q15_t)0x1040,
+    (q15_t)0x447A, (q15_t)0x6C24, (q15_t)0xC945, (q15_t)0x73B5, (q15_t)0x80F6, (q15_t)0x0FAB, (q15_t)0x4450, (q15_t)0x6C3F,
+    (q15_t)0xC8EB, (q15_t)0x738A, (q15_t)0x80E4, (q15_t)0x0F15, (q15_t)0x4425, (q15_t)0x6C59, (q15_t)0xC890, (q15_t)0x735F,
+    (q15_t)0x80D2, (q15_t)0x0E7F, (q15_t)0x43FB, (q15_t)0x6C74, (q15_t)0xC835, (q15_t)0x7333, (q15_t)0x80C2, (q15_t)0x0DE9,
+    (q15_t)0x43D0, (q15_t)0x6C8F, (q15_t)0xC7DB, (q15_t)0x7307, (q15_t)0x80B2, (q15_t)0x0D53, (q15_t)0x43A5, (q15_t)0x6CA9,
+    (q15_t)0xC781, (q15_t)0x72DB, (q15_t)0x80A2, (q15_t)0x0CBD, (q15_t)0x437B, (q15_t)0x6CC4, (q15_t)0xC727, (q15_t)0x72AF,
+    (q15_t)0x8094, (q15_t)0x0C27, (q15_t)0x4350, (q15_t)0x6CDE, (q15_t)0xC6CD, (q15_t)0x7282, (q15_t)0x8086, (q15_t)0x0B91,
+    (q15_t)0x4325, (q15_t)0x6CF9, (q15_t)0xC673, (q15_t)0x7255, (q15_t)0x8078, (q15_t)0x0AFB, (q15_t)0x42FA, (q15_t)0x6D13,
+    (q15_t)0xC619, (q15_t)0x7227, (q15_t)0x806C, (q15_t)0x0A65, (q15_t)0x42D0, (q15_t)0x6D2D, (q15_t)0xC5BF, (q15_t)0x71FA,
+    (q15_t)0x8060, (q15_t)0x09CE, (q15_t)0x42A5, (q15_t)0x6D48, (q15_t)0xC566, (q15_t)0x71CC, (q15_t)0x8055, (q15_t)0x0938,
+    (q15_t)0x427A, (q15_t)0x6D62, (q15_t)0xC50D, (q15_t)0x719E, (q15_t)0x804A, (q15_t)0x08A2, (q15_t)0x424F, (q15_t)0x6D7C,
+    (q15_t)0xC4B3, (q15_t)0x716F, (q15_t)0x8040, (q15_t)0x080B, (q15_t)0x4224, (q15_t)0x6D96, (q15_t)0xC45A, (q15_t)0x7141,
+    (q15_t)0x8037, (q15_t)0x0775, (q15_t)0x41F9, (q15_t)0x6DB0, (q15_t)0xC402, (q15_t)0x7112, (q15_t)0x802F, (q15_t)0x06DE,
+    (q15_t)0x41CE, (q15_t)0x6DCA, (q15_t)0xC3A9, (q15_t)0x70E2, (q15_t)0x8027, (q15_t)0x0647, (q15_t)0x41A2, (q15_t)0x6DE3,
+    (q15_t)0xC350, (q15_t)0x70B3, (q15_t)0x8020, (q15_t)0x05B1, (q15_t)0x4177, (q15_t)0x6DFD, (q15_t)0xC2F8, (q15_t)0x7083,
+    (q15_t)0x801A, (q15_t)0x051A, (q15_t)0x414C, (q15_t)0x6E17, (q15_t)0xC29F, (q15_t)0x7053, (q15_t)0x8014, (q15_t)0x0483,
+    (q15_t)0x4121, (q15_t)0x6E30, (q15_t)0xC247, (q15_t)0x7023, (q15_t)0x800F, (q15_t)0x03ED, (q15_t)0x40F6, (q15_t)0x6E4A,
+    (q15_t)0xC1EF, (q15_t)0x6FF2, (q15_t)0x800B, (q15_t)0x0356, (q15_t)0x40CA, (q15_t)0x6E63, (q15_t)0xC197, (q15_t)0x6FC1,
+    (q15_t)0x8007, (q15_t)0x02BF, (q15_t)0x409F, (q15_t)0x6E7D, (q15_t)0xC140, (q15_t)0x6F90, (q15_t)0x8004, (q15_t)0x0228,
+    (q15_t)0x4073, (q15_t)0x6E96, (q15_t)0xC0E8, (q15_t)0x6F5F, (q15_t)0x8002, (q15_t)0x0192, (q15_t)0x4048, (q15_t)0x6EAF,
+    (q15_t)0xC091, (q15_t)0x6F2D, (q15_t)0x8000, (q15_t)0x00FB, (q15_t)0x401D, (q15_t)0x6EC9, (q15_t)0xC03A, (q15_t)0x6EFB,
+    (q15_t)0x8000, (q15_t)0x0064, (q15_t)0x3FF1, (q15_t)0x6EE2, (q15_t)0xBFE2, (q15_t)0x6EC9, (q15_t)0x8000, (q15_t)0xFFCD,
+    (q15_t)0x3FC5, (q15_t)0x6EFB, (q15_t)0xBF8C, (q15_t)0x6E96, (q15_t)0x8000, (q15_t)0xFF36, (q15_t)0x3F9A, (q15_t)0x6F14,
+    (q15_t)0xBF35, (q15_t)0x6E63, (q15_t)0x8001, (q15_t)0xFEA0, (q15_t)0x3F6E, (q15_t)0x6F2D, (q15_t)0xBEDE, (q15_t)0x6E30,
+    (q15_t)0x8003, (q15_t)0xFE09, (q15_t)0x3F43, (q15_t)0x6F46, (q15_t)0xBE88, (q15_t)0x6DFD, (q15_t)0x8006, (q15_t)0xFD72,
+    (q15_t)0x3F17, (q15_t)0x6F5F, (q15_t)0xBE31, (q15_t)0x6DCA, (q15_t)0x8009, (q15_t)0xFCDB, (q15_t)0x3EEB, (q15_t)0x6F77,
+    (q15_t)0xBDDB, (q15_t)0x6D96, (q15_t)0x800D, (q15_t)0xFC45, (q15_t)0x3EBF, (q15_t)0x6F90, (q15_t)0xBD85, (q15_t)0x6D62,
+    (q15_t)0x8012, (q15_t)0xFBAE, (q15_t)0x3E93, (q15_t)0x6FA9, (q15_t)0xBD2F, (q15_t)0x6D2D, (q15_t)0x8018, (q15_t)0xFB17,
+    (q15_t)0x3E68, (q15_t)0x6FC1, (q15_t)0xBCDA, (q15_t)0x6CF9, (q15_t)0x801E, (q15_t)0xFA80, (q15_t)0x3E3C, (q15_t)0x6FDA,
+    (q15_t)0xBC84, (q15_t)0x6CC4, (q15_t)0x8025, (q15_t)0xF9EA, (q15_t)0x3E10, (q15_t)0x6FF2, (q15_t)0xBC2F, (q15_t)0x6C8F,
+    (q15_t)0x802C, (q15_t)0xF953, (q15_t)0x3DE4, (q15_t)0x700A, (q15_t)0xBBDA, (q15_t)0x6C59, (q15_t)0x8034, (q15_t)0xF8BD,
+    (q15_t)0x3DB8, (q15_t)0x7023, (q15_t)0xBB85, (q15_t)0x6C24, (q15_t)0x803D, (q15_t)0xF826, (q15_t)0x3D8C, (q15_t)0x703B,
+    (q15_t)0xBB30, (q15_t)0x6BEE, (q15_t)0x8047, (q15_t)0xF790, (q15_t)0x3D60, (q15_t)0x7053, (q15_t)0xBADB, (q15_t)0x6BB8,
+    (q15_t)0x8051, (q15_t)0xF6F9, (q15_t)0x3D33, (q15_t)0x706B, (q15_t)0xBA87, (q15_t)0x6B81, (q15_t)0x805C, (q15_t)0xF663,
+    (q15_t)0x3D07, (q15_t)0x7083, (q15_t)0xBA32, (q15_t)0x6B4A, (q15_t)0x8068, (q15_t)0xF5CC, (q15_t)0x3CDB, (q15_t)0x709B,
+    (q15_t)0xB9DE, (q15_t)0x6B13, (q15_t)0x8074, (q15_t)0xF536, (q15_t)0x3CAF, (q15_t)0x70B3, (q15_t)0xB98A, (q15_t)0x6ADC,
+    (q15_t)0x8081, (q15_t)0xF4A0, (q15_t)0x3C83, (q15_t)0x70CB, (q15_t)0xB936, (q15_t)0x6AA5, (q15_t)0x808F, (q15_t)0xF40A,
+    (q15_t)0x3C56, (q15_t)0x70E2, (q15_t)0xB8E3, (q15_t)0x6A6D, (q15_t)0x809D, (q15_t)0xF374, (q15_t)0x3C2A, (q15_t)0x70FA,
+    (q15_t)0xB88F, (q15_t)0x6A35, (q15_t)0x80AC, (q15_t)0xF2DE, (q15_t)0x3BFD, (q15_t)0x7112, (q15_t)0xB83C, (q15_t)0x69FD,
+    (q15_t)0x80BC, (q15_t)0xF248, (q15_t)0x3BD1, (q15_t)0x7129, (q15_t)0xB7E9, (q15_t)0x69C4, (q15_t)0x80CD, (q15_t)0xF1B2,
+    (q15_t)0x3BA5, (q15_t)0x7141, (q15_t)0xB796, (q15_t)0x698C, (q15_t)0x80DE, (q15_t)0xF11C, (q15_t)0x3B78, (q15_t)0x7158,
+    (q15_t)0xB743, (q15_t)0x6953, (q15_t)0x80F0, (q15_t)0xF086, (q15_t)0x3B4C, (q15_t)0x716F, (q15_t)0xB6F0, (q15_t)0x6919,
+    (q15_t)0x8102, (q15_t)0xEFF1, (q15_t)0x3B1F, (q15_t)0x7186, (q15_t)0xB69E, (q15_t)0x68E0, (q15_t)0x8116, (q15_t)0xEF5B,
+    (q15_t)0x3AF2, (q15_t)0x719E, (q15_t)0xB64B, (q15_t)0x68A6, (q15_t)0x812A, (q15_t)0xEEC6, (q15_t)0x3AC6, (q15_t)0x71B5,
+    (q15_t)0xB5F9, (q15_t)0x686C, (q15_t)0x813E, (q15_t)0xEE30, (q15_t)0x3A99, (q15_t)0x71CC, (q15_t)0xB5A7, (q15_t)0x6832,
+    (q15_t)0x8154, (q15_t)0xED9B, (q15_t)0x3A6C, (q15_t)0x71E3, (q15_t)0xB556, (q15_t)0x67F7, (q15_t)0x816A, (q15_t)0xED06,
+    (q15_t)0x3A40, (q15_t)0x71FA, (q15_t)0xB504, (q15_t)0x67BD, (q15_t)0x8180, (q15_t)0xEC71, (q15_t)0x3A13, (q15_t)0x7211,
+    (q15_t)0xB4B3, (q15_t)0x6782, (q15_t)0x8198, (q15_t)0xEBDC, (q15_t)0x39E6, (q15_t)0x7227, (q15_t)0xB461, (q15_t)0x6746,
+    (q15_t)0x81B0, (q15_t)0xEB47, (q15_t)0x39B9, (q15_t)0x723E, (q15_t)0xB410, (q15_t)0x670B, (q15_t)0x81C8, (q15_t)0xEAB2,
+    (q15_t)0x398C, (q15_t)0x7255, (q15_t)0xB3C0, (q15_t)0x66CF, (q15_t)0x81E2, (q15_t)0xEA1D, (q15_t)0x395F, (q15_t)0x726B,
+    (q15_t)0xB36F, (q15_t)0x6693, (q15_t)0x81FC, (q15_t)0xE989, (q15_t)0x3932, (q15_t)0x7282, (q15_t)0xB31E, (q15_t)0x6657,
+    (q15_t)0x8217, (q15_t)0xE8F5, (q15_t)0x3906, (q15_t)0x7298, (q15_t)0xB2CE, (q15_t)0x661A, (q15_t)0x8232, (q15_t)0xE860,
+    (q15_t)0x38D8, (q15_t)0x72AF, (q15_t)0xB27E, (q15_t)0x65DD, (q15_t)0x824F, (q15_t)0xE7CC, (q15_t)0x38AB, (q15_t)0x72C5,
+    (q15_t)0xB22E, (q15_t)0x65A0, (q15_t)0x826B, (q15_t)0xE738, (q15_t)0x387E, (q15_t)0x72DB, (q15_t)0xB1DE, (q15_t)0x6563,
+    (q15_t)0x8289, (q15_t)0xE6A4, (q15_t)0x3851, (q15_t)0x72F1, (q15_t)0xB18F, (q15_t)0x6526, (q15_t)0x82A7, (q15_t)0xE610,
+    (q15_t)0x3824, (q15_t)0x7307, (q15_t)0xB140, (q15_t)0x64E8, (q15_t)0x82C6, (q15_t)0xE57D, (q15_t)0x37F7, (q15_t)0x731D,
+    (q15_t)0xB0F0, (q15_t)0x64AA, (q15_t)0x82E6, (q15_t)0xE4E9, (q15_t)0x37CA, (q15_t)0x7333, (q15_t)0xB0A1, (q15_t)0x646C,
+    (q15_t)0x8306, (q15_t)0xE456, (q15_t)0x379C, (q15_t)0x7349, (q15_t)0xB053, (q15_t)0x642D, (q15_t)0x8327, (q15_t)0xE3C3,
+    (q15_t)0x376F, (q15_t)0x735F, (q15_t)0xB004, (q15_t)0x63EF, (q15_t)0x8348, (q15_t)0xE330, (q15_t)0x3742, (q15_t)0x7375,
+    (q15_t)0xAFB6, (q15_t)0x63B0, (q15_t)0x836B, (q15_t)0xE29D, (q15_t)0x3714, (q15_t)0x738A, (q15_t)0xAF68, (q15_t)0x6371,
+    (q15_t)0x838E, (q15_t)0xE20A, (q15_t)0x36E7, (q15_t)0x73A0, (q15_t)0xAF1A, (q15_t)0x6331, (q15_t)0x83B1, (q15_t)0xE178,
+    (q15_t)0x36BA, (q15_t)0x73B5, (q15_t)0xAECC, (q15_t)0x62F2, (q15_t)0x83D6, (q15_t)0xE0E6, (q15_t)0x368C, (q15_t)0x73CB,
+    (q15_t)0xAE7E, (q15_t)0x62B2, (q15_t)0x83FA, (q15_t)0xE053, (q15_t)0x365F, (q15_t)0x73E0, (q15_t)0xAE31, (q15_t)0x6271,
+    (q15_t)0x8420, (q15_t)0xDFC1, (q15_t)0x3631, (q15_t)0x73F6, (q15_t)0xADE3, (q15_t)0x6231, (q15_t)0x8446, (q15_t)0xDF2F,
+    (q15_t)0x3604, (q15_t)0x740B, (q15_t)0xAD96, (q15_t)0x61F1, (q15_t)0x846D, (q15_t)0xDE9E, (q15_t)0x35D6, (q15_t)0x7420,
+    (q15_t)0xAD4A, (q15_t)0x61B0, (q15_t)0x8495, (q15_t)0xDE0C, (q15_t)0x35A8, (q15_t)0x7435, (q15_t)0xACFD, (q15_t)0x616F,
+    (q15_t)0x84BD, (q15_t)0xDD7B, (q15_t)0x357B, (q15_t)0x744A, (q15_t)0xACB1, (q15_t)0x612D, (q15_t)0x84E6, (q15_t)0xDCEA,
+    (q15_t)0x354D, (q15_t)0x745F, (q15_t)0xAC64, (q15_t)0x60EC, (q15_t)0x8510, (q15_t)0xDC59, (q15_t)0x351F, (q15_t)0x7474,
+    (q15_t)0xAC18, (q15_t)0x60AA, (q15_t)0x853A, (q15_t)0xDBC8, (q15_t)0x34F2, (q15_t)0x7489, (q15_t)0xABCC, (q15_t)0x6068,
+    (q15_t)0x8565, (q15_t)0xDB38, (q15_t)0x34C4, (q15_t)0x749E, (q15_t)0xAB81, (q15_t)0x6026, (q15_t)0x8591, (q15_t)0xDAA7,
+    (q15_t)0x3496, (q15_t)0x74B2, (q15_t)0xAB35, (q15_t)0x5FE3, (q15_t)0x85BD, (q15_t)0xDA17, (q15_t)0x3468, (q15_t)0x74C7,
+    (q15_t)0xAAEA, (q15_t)0x5FA0, (q15_t)0x85EA, (q15_t)0xD987, (q15_t)0x343A, (q15_t)0x74DB, (q15_t)0xAA9F, (q15_t)0x5F5E,
+    (q15_t)0x8618, (q15_t)0xD8F8, (q15_t)0x340C, (q15_t)0x74F0, (q15_t)0xAA54, (q15_t)0x5F1A, (q15_t)0x8646, (q15_t)0xD868,
+    (q15_t)0x33DE, (q15_t)0x7504, (q15_t)0xAA0A, (q15_t)0x5ED7, (q15_t)0x8675, (q15_t)0xD7D9, (q15_t)0x33B0, (q15_t)0x7519,
+    (q15_t)0xA9BF, (q15_t)0x5E93, (q15_t)0x86A5, (q15_t)0xD74A, (q15_t)0x3382, (q15_t)0x752D, (q15_t)0xA975, (q15_t)0x5E50,
+    (q15_t)0x86D5, (q15_t)0xD6BB, (q15_t)0x3354, (q15_t)0x7541, (q15_t)0xA92B, (q15_t)0x5E0B, (q15_t)0x8706, (q15_t)0xD62C,
+    (q15_t)0x3326, (q15_t)0x7555, (q15_t)0xA8E2, (q15_t)0x5DC7, (q15_t)0x8738, (q15_t)0xD59E, (q15_t)0x32F8, (q15_t)0x7569,
+    (q15_t)0xA898, (q15_t)0x5D83, (q15_t)0x876A, (q15_t)0xD510, (q15_t)0x32CA, (q15_t)0x757D, (q15_t)0xA84F, (q15_t)0x5D3E,
+    (q15_t)0x879D, (q15_t)0xD482, (q15_t)0x329C, (q15_t)0x7591, (q15_t)0xA806, (q15_t)0x5CF9, (q15_t)0x87D1, (q15_t)0xD3F4,
+    (q15_t)0x326E, (q15_t)0x75A5, (q15_t)0xA7BD, (q15_t)0x5CB4, (q15_t)0x8805, (q15_t)0xD367, (q15_t)0x3240, (q15_t)0x75B9,
+    (q15_t)0xA774, (q15_t)0x5C6E, (q15_t)0x883A, (q15_t)0xD2D9, (q15_t)0x3211, (q15_t)0x75CC, (q15_t)0xA72B, (q15_t)0x5C29,
+    (q15_t)0x886F, (q15_t)0xD24C, (q15_t)0x31E3, (q15_t)0x75E0, (q15_t)0xA6E3, (q15_t)0x5BE3, (q15_t)0x88A5, (q15_t)0xD1C0,
+    (q15_t)0x31B5, (q15_t)0x75F4, (q15_t)0xA69B, (q15_t)0x5B9D, (q15_t)0x88DC, (q15_t)0xD133, (q15_t)0x3186, (q15_t)0x7607,
+    (q15_t)0xA653, (q15_t)0x5B56, (q15_t)0x8914, (q15_t)0xD0A7, (q15_t)0x3158, (q15_t)0x761B, (q15_t)0xA60C, (q15_t)0x5B10,
+    (q15_t)0x894C, (q15_t)0xD01B, (q15_t)0x312A, (q15_t)0x762E, (q15_t)0xA5C4, (q15_t)0x5AC9, (q15_t)0x8984, (q15_t)0xCF8F,
+    (q15_t)0x30FB, (q15_t)0x7641, (q15_t)0xA57D, (q15_t)0x5A82, (q15_t)0x89BE, (q15_t)0xCF04, (q15_t)0x30CD, (q15_t)0x7654,
+    (q15_t)0xA536, (q15_t)0x5A3B, (q15_t)0x89F8, (q15_t)0xCE79, (q15_t)0x309E, (q15_t)0x7668, (q15_t)0xA4EF, (q15_t)0x59F3,
+    (q15_t)0x8A33, (q15_t)0xCDEE, (q15_t)0x3070, (q15_t)0x767B, (q15_t)0xA4A9, (q15_t)0x59AC, (q15_t)0x8A6E, (q15_t)0xCD63,
+    (q15_t)0x3041, (q15_t)0x768E, (q15_t)0xA462, (q15_t)0x5964, (q15_t)0x8AAA, (q15_t)0xCCD9, (q15_t)0x3013, (q15_t)0x76A0,
+    (q15_t)0xA41C, (q15_t)0x591C, (q15_t)0x8AE6, (q15_t)0xCC4F, (q15_t)0x2FE4, (q15_t)0x76B3, (q15_t)0xA3D6, (q15_t)0x58D4,
+    (q15_t)0x8B24, (q15_t)0xCBC5, (q15_t)0x2FB5, (q15_t)0x76C6, (q15_t)0xA391, (q15_t)0x588B, (q15_t)0x8B61, (q15_t)0xCB3B,
+    (q15_t)0x2F87, (q15_t)0x76D9, (q15_t)0xA34B, (q15_t)0x5842, (q15_t)0x8BA0, (q15_t)0xCAB2, (q15_t)0x2F58, (q15_t)0x76EB,
+    (q15_t)0xA306, (q15_t)0x57F9, (q15_t)0x8BDF, (q15_t)0xCA29, (q15_t)0x2F29, (q15_t)0x76FE, (q15_t)0xA2C1, (q15_t)0x57B0,
+    (q15_t)0x8C1F, (q15_t)0xC9A0, (q15_t)0x2EFB, (q15_t)0x7710, (q15_t)0xA27C, (q15_t)0x5767, (q15_t)0x8C5F, (q15_t)0xC918,
+    (q15_t)0x2ECC, (q15_t)0x7723, (q15_t)0xA238, (q15_t)0x571D, (q15_t)0x8CA0, (q15_t)0xC890, (q15_t)0x2E9D, (q15_t)0x7735,
+    (q15_t)0xA1F4, (q15_t)0x56D4, (q15_t)0x8CE2, (q15_t)0xC808, (q15_t)0x2E6E, (q15_t)0x7747, (q15_t)0xA1AF, (q15_t)0x568A,
+    (q15_t)0x8D24, (q15_t)0xC781, (q15_t)0x2E3F, (q15_t)0x775A, (q15_t)0xA16C, (q15_t)0x5640, (q15_t)0x8D67, (q15_t)0xC6F9,
+    (q15_t)0x2E11, (q15_t)0x776C, (q15_t)0xA128, (q15_t)0x55F5, (q15_t)0x8DAA, (q15_t)0xC673, (q15_t)0x2DE2, (q15_t)0x777E,
+    (q15_t)0xA0E5, (q15_t)0x55AB, (q15_t)0x8DEE, (q15_t)0xC5EC, (q15_t)0x2DB3, (q15_t)0x7790, (q15_t)0xA0A1, (q15_t)0x5560,
+    (q15_t)0x8E33, (q15_t)0xC566, (q15_t)0x2D84, (q15_t)0x77A2, (q15_t)0xA05F, (q15_t)0x5515, (q15_t)0x8E79, (q15_t)0xC4E0,
+    (q15_t)0x2D55, (q15_t)0x77B4, (q15_t)0xA01C, (q15_t)0x54CA, (q15_t)0x8EBE, (q15_t)0xC45A, (q15_t)0x2D26, (q15_t)0x77C5,
+    (q15_t)0x9FD9, (q15_t)0x547E, (q15_t)0x8F05, (q15_t)0xC3D5, (q15_t)0x2CF7, (q15_t)0x77D7, (q15_t)0x9F97, (q15_t)0x5433,
+    (q15_t)0x8F4C, (q15_t)0xC350, (q15_t)0x2CC8, (q15_t)0x77E9, (q15_t)0x9F55, (q15_t)0x53E7, (q15_t)0x8F94, (q15_t)0xC2CC,
+    (q15_t)0x2C98, (q15_t)0x77FA, (q15_t)0x9F13, (q15_t)0x539B, (q15_t)0x8FDC, (q15_t)0xC247, (q15_t)0x2C69, (q15_t)0x780C,
+    (q15_t)0x9ED2, (q15_t)0x534E, (q15_t)0x9025, (q15_t)0xC1C3, (q15_t)0x2C3A, (q15_t)0x781D, (q15_t)0x9E90, (q15_t)0x5302,
+    (q15_t)0x906F, (q15_t)0xC140, (q15_t)0x2C0B, (q15_t)0x782E, (q15_t)0x9E4F, (q15_t)0x52B5, (q15_t)0x90B9, (q15_t)0xC0BC,
+    (q15_t)0x2BDC, (q15_t)0x7840, (q15_t)0x9E0E, (q15_t)0x5269, (q15_t)0x9104, (q15_t)0xC03A, (q15_t)0x2BAD, (q15_t)0x7851,
+    (q15_t)0x9DCE, (q15_t)0x521C, (q15_t)0x9150, (q15_t)0xBFB7, (q15_t)0x2B7D, (q15_t)0x7862, (q15_t)0x9D8E, (q15_t)0x51CE,
+    (q15_t)0x919C, (q15_t)0xBF35, (q15_t)0x2B4E, (q15_t)0x7873, (q15_t)0x9D4D, (q15_t)0x5181, (q15_t)0x91E8, (q15_t)0xBEB3,
+    (q15_t)0x2B1F, (q15_t)0x7884, (q15_t)0x9D0D, (q15_t)0x5133, (q15_t)0x9235, (q15_t)0xBE31, (q15_t)0x2AEF, (q15_t)0x7895,
+    (q15_t)0x9CCE, (q15_t)0x50E5, (q15_t)0x9283, (q15_t)0xBDB0, (q15_t)0x2AC0, (q15_t)0x78A6, (q15_t)0x9C8E, (q15_t)0x5097,
+    (q15_t)0x92D2, (q15_t)0xBD2F, (q15_t)0x2A91, (q15_t)0x78B6, (q15_t)0x9C4F, (q15_t)0x5049, (q15_t)0x9321, (q15_t)0xBCAF,
+    (q15_t)0x2A61, (q15_t)0x78C7, (q15_t)0x9C10, (q15_t)0x4FFB, (q15_t)0x9370, (q15_t)0xBC2F, (q15_t)0x2A32, (q15_t)0x78D8,
+    (q15_t)0x9BD2, (q15_t)0x4FAC, (q15_t)0x93C0, (q15_t)0xBBAF, (q15_t)0x2A02, (q15_t)0x78E8, (q15_t)0x9B93, (q15_t)0x4F5E,
+    (q15_t)0x9411, (q15_t)0xBB30, (q15_t)0x29D3, (q15_t)0x78F9, (q15_t)0x9B55, (q15_t)0x4F0F, (q15_t)0x9463, (q15_t)0xBAB1,
+    (q15_t)0x29A3, (q15_t)0x7909, (q15_t)0x9B17, (q15_t)0x4EBF, (q15_t)0x94B5, (q15_t)0xBA32, (q15_t)0x2974, (q15_t)0x7919,
+    (q15_t)0x9AD9, (q15_t)0x4E70, (q15_t)0x9507, (q15_t)0xB9B4, (q15_t)0x2944, (q15_t)0x792A, (q15_t)0x9A9C, (q15_t)0x4E21,
+    (q15_t)0x955A, (q15_t)0xB936, (q15_t)0x2915, (q15_t)0x793A, (q15_t)0x9A5F, (q15_t)0x4DD1, (q15_t)0x95AE, (q15_t)0xB8B9,
+    (q15_t)0x28E5, (q15_t)0x794A, (q15_t)0x9A22, (q15_t)0x4D81, (q15_t)0x9602, (q15_t)0xB83C, (q15_t)0x28B5, (q15_t)0x795A,
+    (q15_t)0x99E5, (q15_t)0x4D31, (q15_t)0x9657, (q15_t)0xB7BF, (q15_t)0x2886, (q15_t)0x796A, (q15_t)0x99A8, (q15_t)0x4CE1,
+    (q15_t)0x96AC, (q15_t)0xB743, (q15_t)0x2856, (q15_t)0x797A, (q15_t)0x996C, (q15_t)0x4C90, (q15_t)0x9702, (q15_t)0xB6C7,
+    (q15_t)0x2826, (q15_t)0x798A, (q15_t)0x9930, (q15_t)0x4C3F, (q15_t)0x9759, (q15_t)0xB64B, (q15_t)0x27F6, (q15_t)0x7999,
+    (q15_t)0x98F4, (q15_t)0x4BEF, (q15_t)0x97B0, (q15_t)0xB5D0, (q15_t)0x27C7, (q15_t)0x79A9, (q15_t)0x98B9, (q15_t)0x4B9E,
+    (q15_t)0x9808, (q15_t)0xB556, (q15_t)0x2797, (q15_t)0x79B9, (q15_t)0x987D, (q15_t)0x4B4C, (q15_t)0x9860, (q15_t)0xB4DB,
+    (q15_t)0x2767, (q15_t)0x79C8, (q15_t)0x9842, (q15_t)0x4AFB, (q15_t)0x98B9, (q15_t)0xB461, (q15_t)0x2737, (q15_t)0x79D8,
+    (q15_t)0x9808, (q15_t)0x4AA9, (q15_t)0x9912, (q15_t)0xB3E8, (q15_t)0x2707, (q15_t)0x79E7, (q15_t)0x97CD, (q15_t)0x4A58,
+    (q15_t)0x996C, (q15_t)0xB36F, (q15_t)0x26D8, (q15_t)0x79F6, (q15_t)0x9793, (q15_t)0x4A06, (q15_t)0x99C6, (q15_t)0xB2F6,
+    (q15_t)0x26A8, (q15_t)0x7A05, (q15_t)0x9759, (q15_t)0x49B4, (q15_t)0x9A22, (q15_t)0xB27E, (q15_t)0x2678, (q15_t)0x7A15,
+    (q15_t)0x971F, (q15_t)0x4961, (q15_t)0x9A7D, (q15_t)0xB206, (q15_t)0x2648, (q15_t)0x7A24, (q15_t)0x96E6, (q15_t)0x490F,
+    (q15_t)0x9AD9, (q15_t)0xB18F, (q15_t)0x2618, (q15_t)0x7A33, (q15_t)0x96AC, (q15_t)0x48BC, (q15_t)0x9B36, (q15_t)0xB118,
+    (q15_t)0x25E8, (q15_t)0x7A42, (q15_t)0x9673, (q15_t)0x4869, (q15_t)0x9B93, (q15_t)0xB0A1, (q15_t)0x25B8, (q15_t)0x7A50,
+    (q15_t)0x963B, (q15_t)0x4816, (q15_t)0x9BF1, (q15_t)0xB02B, (q15_t)0x2588, (q15_t)0x7A5F, (q15_t)0x9602, (q15_t)0x47C3,
+    (q15_t)0x9C4F, (q15_t)0xAFB6, (q15_t)0x2558, (q15_t)0x7A6E, (q15_t)0x95CA, (q15_t)0x4770, (q15_t)0x9CAE, (q15_t)0xAF40,
+    (q15_t)0x2528, (q15_t)0x7A7D, (q15_t)0x9592, (q15_t)0x471C, (q15_t)0x9D0D, (q15_t)0xAECC, (q15_t)0x24F7, (q15_t)0x7A8B,
+    (q15_t)0x955A, (q15_t)0x46C9, (q15_t)0x9D6D, (q15_t)0xAE57, (q15_t)0x24C7, (q15_t)0x7A9A, (q15_t)0x9523, (q15_t)0x4675,
+    (q15_t)0x9DCE, (q15_t)0xADE3, (q15_t)0x2497, (q15_t)0x7AA8, (q15_t)0x94EC, (q15_t)0x4621, (q15_t)0x9E2F, (q15_t)0xAD70,
+    (q15_t)0x2467, (q15_t)0x7AB6, (q15_t)0x94B5, (q15_t)0x45CD, (q15_t)0x9E90, (q15_t)0xACFD, (q15_t)0x2437, (q15_t)0x7AC5,
+    (q15_t)0x947E, (q15_t)0x4578, (q15_t)0x9EF2, (q15_t)0xAC8A, (q15_t)0x2407, (q15_t)0x7AD3, (q15_t)0x9447, (q15_t)0x4524,
+    (q15_t)0x9F55, (q15_t)0xAC18, (q15_t)0x23D6, (q15_t)0x7AE1, (q15_t)0x9411, (q15_t)0x44CF, (q15_t)0x9FB8, (q15_t)0xABA7,
+    (q15_t)0x23A6, (q15_t)0x7AEF, (q15_t)0x93DB, (q15_t)0x447A, (q15_t)0xA01C, (q15_t)0xAB35, (q15_t)0x2376, (q15_t)0x7AFD,
+    (q15_t)0x93A6, (q15_t)0x4425, (q15_t)0xA080, (q15_t)0xAAC5, (q15_t)0x2345, (q15_t)0x7B0B, (q15_t)0x9370, (q15_t)0x43D0,
+    (q15_t)0xA0E5, (q15_t)0xAA54, (q15_t)0x2315, (q15_t)0x7B19, (q15_t)0x933B, (q15_t)0x437B, (q15_t)0xA14A, (q15_t)0xA9E5,
+    (q15_t)0x22E5, (q15_t)0x7B26, (q15_t)0x9306, (q15_t)0x4325, (q15_t)0xA1AF, (q15_t)0xA975, (q15_t)0x22B4, (q15_t)0x7B34,
+    (q15_t)0x92D2, (q15_t)0x42D0, (q15_t)0xA216, (q15_t)0xA906, (q15_t)0x2284, (q15_t)0x7B42, (q15_t)0x929D, (q15_t)0x427A,
+    (q15_t)0xA27C, (q15_t)0xA898, (q15_t)0x2254, (q15_t)0x7B4F, (q15_t)0x9269, (q15_t)0x4224, (q15_t)0xA2E4, (q15_t)0xA82A,
+    (q15_t)0x2223, (q15_t)0x7B5D, (q15_t)0x9235, (q15_t)0x41CE, (q15_t)0xA34B, (q15_t)0xA7BD, (q15_t)0x21F3, (q15_t)0x7B6A,
+    (q15_t)0x9202, (q15_t)0x4177, (q15_t)0xA3B4, (q15_t)0xA750, (q15_t)0x21C2, (q15_t)0x7B77, (q15_t)0x91CF, (q15_t)0x4121,
+    (q15_t)0xA41C, (q15_t)0xA6E3, (q15_t)0x2192, (q15_t)0x7B84, (q15_t)0x919C, (q15_t)0x40CA, (q15_t)0xA486, (q15_t)0xA677,
+    (q15_t)0x2161, (q15_t)0x7B92, (q15_t)0x9169, (q15_t)0x4073, (q15_t)0xA4EF, (q15_t)0xA60C, (q15_t)0x2131, (q15_t)0x7B9F,
+    (q15_t)0x9136, (q15_t)0x401D, (q15_t)0xA55A, (q15_t)0xA5A1, (q15_t)0x2100, (q15_t)0x7BAC, (q15_t)0x9104, (q15_t)0x3FC5,
+    (q15_t)0xA5C4, (q15_t)0xA536, (q15_t)0x20D0, (q15_t)0x7BB9, (q15_t)0x90D2, (q15_t)0x3F6E, (q15_t)0xA62F, (q15_t)0xA4CC,
+    (q15_t)0x209F, (q15_t)0x7BC5, (q15_t)0x90A0, (q15_t)0x3F17, (q15_t)0xA69B, (q15_t)0xA462, (q15_t)0x206E, (q15_t)0x7BD2,
+    (q15_t)0x906F, (q15_t)0x3EBF, (q15_t)0xA707, (q15_t)0xA3F9, (q15_t)0x203E, (q15_t)0x7BDF, (q15_t)0x903E, (q15_t)0x3E68,
+    (q15_t)0xA774, (q15_t)0xA391, (q15_t)0x200D, (q15_t)0x7BEB, (q15_t)0x900D, (q15_t)0x3E10, (q15_t)0xA7E1, (q15_t)0xA329,
+    (q15_t)0x1FDC, (q15_t)0x7BF8, (q15_t)0x8FDC, (q15_t)0x3DB8, (q15_t)0xA84F, (q15_t)0xA2C1, (q15_t)0x1FAC, (q15_t)0x7C05,
+    (q15_t)0x8FAC, (q15_t)0x3D60, (q15_t)0xA8BD, (q15_t)0xA25A, (q15_t)0x1F7B, (q15_t)0x7C11, (q15_t)0x8F7C, (q15_t)0x3D07,
+    (q15_t)0xA92B, (q15_t)0xA1F4, (q15_t)0x1F4A, (q15_t)0x7C1D, (q15_t)0x8F4C, (q15_t)0x3CAF, (q15_t)0xA99A, (q15_t)0xA18E,
+    (q15_t)0x1F19, (q15_t)0x7C29, (q15_t)0x8F1D, (q15_t)0x3C56, (q15_t)0xAA0A, (q15_t)0xA128, (q15_t)0x1EE9, (q15_t)0x7C36,
+    (q15_t)0x8EED, (q15_t)0x3BFD, (q15_t)0xAA7A, (q15_t)0xA0C3, (q15_t)0x1EB8, (q15_t)0x7C42, (q15_t)0x8EBE, (q15_t)0x3BA5,
+    (q15_t)0xAAEA, (q15_t)0xA05F, (q15_t)0x1E87, (q15_t)0x7C4E, (q15_t)0x8E90, (q15_t)0x3B4C, (q15_t)0xAB5B, (q15_t)0x9FFB,
+    (q15_t)0x1E56, (q15_t)0x7C5A, (q15_t)0x8E61, (q15_t)0x3AF2, (q15_t)0xABCC, (q15_t)0x9F97, (q15_t)0x1E25, (q15_t)0x7C66,
+    (q15_t)0x8E33, (q15_t)0x3A99, (q15_t)0xAC3E, (q15_t)0x9F34, (q15_t)0x1DF5, (q15_t)0x7C71, (q15_t)0x8E05, (q15_t)0x3A40,
+    (q15_t)0xACB1, (q15_t)0x9ED2, (q15_t)0x1DC4, (q15_t)0x7C7D, (q15_t)0x8DD8, (q15_t)0x39E6, (q15_t)0xAD23, (q15_t)0x9E70,
+    (q15_t)0x1D93, (q15_t)0x7C89, (q15_t)0x8DAA, (q15_t)0x398C, (q15_t)0xAD96, (q15_t)0x9E0E, (q15_t)0x1D62, (q15_t)0x7C94,
+    (q15_t)0x8D7D, (q15_t)0x3932, (q15_t)0xAE0A, (q15_t)0x9DAE, (q15_t)0x1D31, (q15_t)0x7CA0, (q15_t)0x8D50, (q15_t)0x38D8,
+    (q15_t)0xAE7E, (q15_t)0x9D4D, (q15_t)0x1D00, (q15_t)0x7CAB, (q15_t)0x8D24, (q15_t)0x387E, (q15_t)0xAEF3, (q15_t)0x9CEE,
+    (q15_t)0x1CCF, (q15_t)0x7CB7, (q15_t)0x8CF8, (q15_t)0x3824, (q15_t)0xAF68, (q15_t)0x9C8E, (q15_t)0x1C9E, (q15_t)0x7CC2,
+    (q15_t)0x8CCC, (q15_t)0x37CA, (q15_t)0xAFDD, (q15_t)0x9C30, (q15_t)0x1C6D, (q15_t)0x7CCD, (q15_t)0x8CA0, (q15_t)0x376F,
+    (q15_t)0xB053, (q15_t)0x9BD2, (q15_t)0x1C3C, (q15_t)0x7CD8, (q15_t)0x8C75, (q15_t)0x3714, (q15_t)0xB0C9, (q15_t)0x9B74,
+    (q15_t)0x1C0B, (q15_t)0x7CE3, (q15_t)0x8C4A, (q15_t)0x36BA, (q15_t)0xB140, (q15_t)0x9B17, (q15_t)0x1BDA, (q15_t)0x7CEE,
+    (q15_t)0x8C1F, (q15_t)0x365F, (q15_t)0xB1B7, (q15_t)0x9ABA, (q15_t)0x1BA9, (q15_t)0x7CF9, (q15_t)0x8BF4, (q15_t)0x3604,
+    (q15_t)0xB22E, (q15_t)0x9A5F, (q15_t)0x1B78, (q15_t)0x7D04, (q15_t)0x8BCA, (q15_t)0x35A8, (q15_t)0xB2A6, (q15_t)0x9A03,
+    (q15_t)0x1B47, (q15_t)0x7D0F, (q15_t)0x8BA0, (q15_t)0x354D, (q15_t)0xB31E, (q15_t)0x99A8, (q15_t)0x1B16, (q15_t)0x7D19,
+    (q15_t)0x8B76, (q15_t)0x34F2, (q15_t)0xB397, (q15_t)0x994E, (q15_t)0x1AE4, (q15_t)0x7D24, (q15_t)0x8B4D, (q15_t)0x3496,
+    (q15_t)0xB410, (q15_t)0x98F4, (q15_t)0x1AB3, (q15_t)0x7D2F, (q15_t)0x8B24, (q15_t)0x343A, (q15_t)0xB48A, (q15_t)0x989B,
+    (q15_t)0x1A82, (q15_t)0x7D39, (q15_t)0x8AFB, (q15_t)0x33DE, (q15_t)0xB504, (q15_t)0x9842, (q15_t)0x1A51, (q15_t)0x7D43,
+    (q15_t)0x8AD2, (q15_t)0x3382, (q15_t)0xB57E, (q15_t)0x97EA, (q15_t)0x1A20, (q15_t)0x7D4E, (q15_t)0x8AAA, (q15_t)0x3326,
+    (q15_t)0xB5F9, (q15_t)0x9793, (q15_t)0x19EF, (q15_t)0x7D58, (q15_t)0x8A82, (q15_t)0x32CA, (q15_t)0xB675, (q15_t)0x973C,
+    (q15_t)0x19BD, (q15_t)0x7D62, (q15_t)0x8A5A, (q15_t)0x326E, (q15_t)0xB6F0, (q15_t)0x96E6, (q15_t)0x198C, (q15_t)0x7D6C,
+    (q15_t)0x8A33, (q15_t)0x3211, (q15_t)0xB76C, (q15_t)0x9690, (q15_t)0x195B, (q15_t)0x7D76, (q15_t)0x8A0B, (q15_t)0x31B5,
+    (q15_t)0xB7E9, (q15_t)0x963B, (q15_t)0x192A, (q15_t)0x7D80, (q15_t)0x89E4, (q15_t)0x3158, (q15_t)0xB865, (q15_t)0x95E6,
+    (q15_t)0x18F8, (q15_t)0x7D8A, (q15_t)0x89BE, (q15_t)0x30FB, (q15_t)0xB8E3, (q15_t)0x9592, (q15_t)0x18C7, (q15_t)0x7D94,
+    (q15_t)0x8997, (q15_t)0x309E, (q15_t)0xB960, (q15_t)0x953E, (q15_t)0x1896, (q15_t)0x7D9D, (q15_t)0x8971, (q15_t)0x3041,
+    (q15_t)0xB9DE, (q15_t)0x94EC, (q15_t)0x1864, (q15_t)0x7DA7, (q15_t)0x894C, (q15_t)0x2FE4, (q15_t)0xBA5C, (q15_t)0x9499,
+    (q15_t)0x1833, (q15_t)0x7DB0, (q15_t)0x8926, (q15_t)0x2F87, (q15_t)0xBADB, (q15_t)0x9447, (q15_t)0x1802, (q15_t)0x7DBA,
+    (q15_t)0x8901, (q15_t)0x2F29, (q15_t)0xBB5A, (q15_t)0x93F6, (q15_t)0x17D0, (q15_t)0x7DC3, (q15_t)0x88DC, (q15_t)0x2ECC,
+    (q15_t)0xBBDA, (q15_t)0x93A6, (q15_t)0x179F, (q15_t)0x7DCD, (q15_t)0x88B8, (q15_t)0x2E6E, (q15_t)0xBC5A, (q15_t)0x9356,
+    (q15_t)0x176D, (q15_t)0x7DD6, (q15_t)0x8893, (q15_t)0x2E11, (q15_t)0xBCDA, (q15_t)0x9306, (q15_t)0x173C, (q15_t)0x7DDF,
+    (q15_t)0x886F, (q15_t)0x2DB3, (q15_t)0xBD5A, (q15_t)0x92B7, (q15_t)0x170A, (q15_t)0x7DE8, (q15_t)0x884B, (q15_t)0x2D55,
+    (q15_t)0xBDDB, (q15_t)0x9269, (q15_t)0x16D9, (q15_t)0x7DF1, (q15_t)0x8828, (q15_t)0x2CF7, (q15_t)0xBE5D, (q15_t)0x921C,
+    (q15_t)0x16A8, (q15_t)0x7DFA, (q15_t)0x8805, (q15_t)0x2C98, (q15_t)0xBEDE, (q15_t)0x91CF, (q15_t)0x1676, (q15_t)0x7E03,
+    (q15_t)0x87E2, (q15_t)0x2C3A, (q15_t)0xBF60, (q15_t)0x9182, (q15_t)0x1645, (q15_t)0x7E0C, (q15_t)0x87BF, (q15_t)0x2BDC,
+    (q15_t)0xBFE2, (q15_t)0x9136, (q15_t)0x1613, (q15_t)0x7E14, (q15_t)0x879D, (q15_t)0x2B7D, (q15_t)0xC065, (q15_t)0x90EB,
+    (q15_t)0x15E2, (q15_t)0x7E1D, (q15_t)0x877B, (q15_t)0x2B1F, (q15_t)0xC0E8, (q15_t)0x90A0, (q15_t)0x15B0, (q15_t)0x7E26,
+    (q15_t)0x8759, (q15_t)0x2AC0, (q15_t)0xC16C, (q15_t)0x9056, (q15_t)0x157F, (q15_t)0x7E2E, (q15_t)0x8738, (q15_t)0x2A61,
+    (q15_t)0xC1EF, (q15_t)0x900D, (q15_t)0x154D, (q15_t)0x7E37, (q15_t)0x8717, (q15_t)0x2A02, (q15_t)0xC273, (q15_t)0x8FC4,
+    (q15_t)0x151B, (q15_t)0x7E3F, (q15_t)0x86F6, (q15_t)0x29A3, (q15_t)0xC2F8, (q15_t)0x8F7C, (q15_t)0x14EA, (q15_t)0x7E47,
+    (q15_t)0x86D5, (q15_t)0x2944, (q15_t)0xC37C, (q15_t)0x8F34, (q15_t)0x14B8, (q15_t)0x7E4F, (q15_t)0x86B5, (q15_t)0x28E5,
+    (q15_t)0xC402, (q15_t)0x8EED, (q15_t)0x1487, (q15_t)0x7E57, (q15_t)0x8695, (q15_t)0x2886, (q15_t)0xC487, (q15_t)0x8EA7,
+    (q15_t)0x1455, (q15_t)0x7E5F, (q15_t)0x8675, (q15_t)0x2826, (q15_t)0xC50D, (q15_t)0x8E61, (q15_t)0x1423, (q15_t)0x7E67,
+    (q15_t)0x8656, (q15_t)0x27C7, (q15_t)0xC593, (q15_t)0x8E1C, (q15_t)0x13F2, (q15_t)0x7E6F, (q15_t)0x8637, (q15_t)0x2767,
+    (q15_t)0xC619, (q15_t)0x8DD8, (q15_t)0x13C0, (q15_t)0x7E77, (q15_t)0x8618, (q15_t)0x2707, (q15_t)0xC6A0, (q15_t)0x8D94,
+    (q15_t)0x138E, (q15_t)0x7E7F, (q15_t)0x85FA, (q15_t)0x26A8, (q15_t)0xC727, (q15_t)0x8D50, (q15_t)0x135D, (q15_t)0x7E86,
+    (q15_t)0x85DB, (q15_t)0x2648, (q15_t)0xC7AE, (q15_t)0x8D0E, (q15_t)0x132B, (q15_t)0x7E8E, (q15_t)0x85BD, (q15_t)0x25E8,
+    (q15_t)0xC835, (q15_t)0x8CCC, (q15_t)0x12F9, (q15_t)0x7E95, (q15_t)0x85A0, (q15_t)0x2588, (q15_t)0xC8BD, (q15_t)0x8C8A,
+    (q15_t)0x12C8, (q15_t)0x7E9D, (q15_t)0x8582, (q15_t)0x2528, (q15_t)0xC945, (q15_t)0x8C4A, (q15_t)0x1296, (q15_t)0x7EA4,
+    (q15_t)0x8565, (q15_t)0x24C7, (q15_t)0xC9CE, (q15_t)0x8C09, (q15_t)0x1264, (q15_t)0x7EAB, (q15_t)0x8549, (q15_t)0x2467,
+    (q15_t)0xCA57, (q15_t)0x8BCA, (q15_t)0x1232, (q15_t)0x7EB3, (q15_t)0x852C, (q15_t)0x2407, (q15_t)0xCAE0, (q15_t)0x8B8B,
+    (q15_t)0x1201, (q15_t)0x7EBA, (q15_t)0x8510, (q15_t)0x23A6, (q15_t)0xCB69, (q15_t)0x8B4D, (q15_t)0x11CF, (q15_t)0x7EC1,
+    (q15_t)0x84F4, (q15_t)0x2345, (q15_t)0xCBF3, (q15_t)0x8B0F, (q15_t)0x119D, (q15_t)0x7EC8, (q15_t)0x84D9, (q15_t)0x22E5,
+    (q15_t)0xCC7D, (q15_t)0x8AD2, (q15_t)0x116B, (q15_t)0x7ECF, (q15_t)0x84BD, (q15_t)0x2284, (q15_t)0xCD07, (q15_t)0x8A96,
+    (q15_t)0x1139, (q15_t)0x7ED5, (q15_t)0x84A2, (q15_t)0x2223, (q15_t)0xCD91, (q15_t)0x8A5A, (q15_t)0x1108, (q15_t)0x7EDC,
+    (q15_t)0x8488, (q15_t)0x21C2, (q15_t)0xCE1C, (q15_t)0x8A1F, (q15_t)0x10D6, (q15_t)0x7EE3, (q15_t)0x846D, (q15_t)0x2161,
+    (q15_t)0xCEA7, (q15_t)0x89E4, (q15_t)0x10A4, (q15_t)0x7EE9, (q15_t)0x8453, (q15_t)0x2100, (q15_t)0xCF32, (q15_t)0x89AB,
+    (q15_t)0x1072, (q15_t)0x7EF0, (q15_t)0x843A, (q15_t)0x209F, (q15_t)0xCFBE, (q15_t)0x8971, (q15_t)0x1040, (q15_t)0x7EF6,
+    (q15_t)0x8420, (q15_t)0x203E, (q15_t)0xD04A, (q15_t)0x8939, (q15_t)0x100E, (q15_t)0x7EFD, (q15_t)0x8407, (q15_t)0x1FDC,
+    (q15_t)0xD0D6, (q15_t)0x8901, (q15_t)0x0FDD, (q15_t)0x7F03, (q15_t)0x83EE, (q15_t)0x1F7B, (q15_t)0xD162, (q15_t)0x88CA,
+    (q15_t)0x0FAB, (q15_t)0x7F09, (q15_t)0x83D6, (q15_t)0x1F19, (q15_t)0xD1EE, (q15_t)0x8893, (q15_t)0x0F79, (q15_t)0x7F0F,
+    (q15_t)0x83BD, (q15_t)0x1EB8, (q15_t)0xD27B, (q15_t)0x885D, (q15_t)0x0F47, (q15_t)0x7F15, (q15_t)0x83A5, (q15_t)0x1E56,
+    (q15_t)0xD308, (q15_t)0x8828, (q15_t)0x0F15, (q15_t)0x7F1B, (q15_t)0x838E, (q15_t)0x1DF5, (q15_t)0xD396, (q15_t)0x87F3,
+    (q15_t)0x0EE3, (q15_t)0x7F21, (q15_t)0x8376, (q15_t)0x1D93, (q15_t)0xD423, (q15_t)0x87BF, (q15_t)0x0EB1, (q15_t)0x7F27,
+    (q15_t)0x835F, (q15_t)0x1D31, (q15_t)0xD4B1, (q15_t)0x878C, (q15_t)0x0E7F, (q15_t)0x7F2D, (q15_t)0x8348, (q15_t)0x1CCF,
+    (q15_t)0xD53F, (q15_t)0x8759, (q15_t)0x0E4D, (q15_t)0x7F32, (q15_t)0x8332, (q15_t)0x1C6D, (q15_t)0xD5CD, (q15_t)0x8727,
+    (q15_t)0x0E1B, (q15_t)0x7F38, (q15_t)0x831C, (q15_t)0x1C0B, (q15_t)0xD65C, (q15_t)0x86F6, (q15_t)0x0DE9, (q15_t)0x7F3D,
+    (q15_t)0x8306, (q15_t)0x1BA9, (q15_t)0xD6EA, (q15_t)0x86C5, (q15_t)0x0DB7, (q15_t)0x7F43, (q15_t)0x82F0, (q15_t)0x1B47,
+    (q15_t)0xD779, (q15_t)0x8695, (q15_t)0x0D85, (q15_t)0x7F48, (q15_t)0x82DB, (q15_t)0x1AE4, (q15_t)0xD809, (q15_t)0x8666,
+    (q15_t)0x0D53, (q15_t)0x7F4D, (q15_t)0x82C6, (q15_t)0x1A82, (q15_t)0xD898, (q15_t)0x8637, (q15_t)0x0D21, (q15_t)0x7F53,
+    (q15_t)0x82B1, (q15_t)0x1A20, (q15_t)0xD927, (q15_t)0x8609, (q15_t)0x0CEF, (q15_t)0x7F58, (q15_t)0x829D, (q15_t)0x19BD,
+    (q15_t)0xD9B7, (q15_t)0x85DB, (q15_t)0x0CBD, (q15_t)0x7F5D, (q15_t)0x8289, (q15_t)0x195B, (q15_t)0xDA47, (q15_t)0x85AF,
+    (q15_t)0x0C8B, (q15_t)0x7F62, (q15_t)0x8275, (q15_t)0x18F8, (q15_t)0xDAD7, (q15_t)0x8582, (q15_t)0x0C59, (q15_t)0x7F67,
+    (q15_t)0x8262, (q15_t)0x1896, (q15_t)0xDB68, (q15_t)0x8557, (q15_t)0x0C27, (q15_t)0x7F6B, (q15_t)0x824F, (q15_t)0x1833,
+    (q15_t)0xDBF8, (q15_t)0x852C, (q15_t)0x0BF5, (q15_t)0x7F70, (q15_t)0x823C, (q15_t)0x17D0, (q15_t)0xDC89, (q15_t)0x8502,
+    (q15_t)0x0BC3, (q15_t)0x7F75, (q15_t)0x8229, (q15_t)0x176D, (q15_t)0xDD1A, (q15_t)0x84D9, (q15_t)0x0B91, (q15_t)0x7F79,
+    (q15_t)0x8217, (q15_t)0x170A, (q15_t)0xDDAB, (q15_t)0x84B0, (q15_t)0x0B5F, (q15_t)0x7F7E, (q15_t)0x8205, (q15_t)0x16A8,
+    (q15_t)0xDE3D, (q15_t)0x8488, (q15_t)0x0B2D, (q15_t)0x7F82, (q15_t)0x81F3, (q15_t)0x1645, (q15_t)0xDECE, (q15_t)0x8460,
+    (q15_t)0x0AFB, (q15_t)0x7F87, (q15_t)0x81E2, (q15_t)0x15E2, (q15_t)0xDF60, (q15_t)0x843A, (q15_t)0x0AC9, (q15_t)0x7F8B,
+    (q15_t)0x81D1, (q15_t)0x157F, (q15_t)0xDFF2, (q15_t)0x8414, (q15_t)0x0A97, (q15_t)0x7F8F, (q15_t)0x81C0, (q15_t)0x151B,
+    (q15_t)0xE084, (q15_t)0x83EE, (q15_t)0x0A65, (q15_t)0x7F93, (q15_t)0x81B0, (q15_t)0x14B8, (q15_t)0xE116, (q15_t)0x83C9,
+    (q15_t)0x0A33, (q15_t)0x7F97, (q15_t)0x81A0, (q15_t)0x1455, (q15_t)0xE1A9, (q15_t)0x83A5, (q15_t)0x0A00, (q15_t)0x7F9B,
+    (q15_t)0x8190, (q15_t)0x13F2, (q15_t)0xE23B, (q15_t)0x8382, (q15_t)0x09CE, (q15_t)0x7F9F, (q15_t)0x8180, (q15_t)0x138E,
+    (q15_t)0xE2CE, (q15_t)0x835F, (q15_t)0x099C, (q15_t)0x7FA3, (q15_t)0x8171, (q15_t)0x132B, (q15_t)0xE361, (q15_t)0x833D,
+    (q15_t)0x096A, (q15_t)0x7FA7, (q15_t)0x8162, (q15_t)0x12C8, (q15_t)0xE3F4, (q15_t)0x831C, (q15_t)0x0938, (q15_t)0x7FAA,
+    (q15_t)0x8154, (q15_t)0x1264, (q15_t)0xE487, (q15_t)0x82FB, (q15_t)0x0906, (q15_t)0x7FAE, (q15_t)0x8145, (q15_t)0x1201,
+    (q15_t)0xE51B, (q15_t)0x82DB, (q15_t)0x08D4, (q15_t)0x7FB1, (q15_t)0x8137, (q15_t)0x119D, (q15_t)0xE5AE, (q15_t)0x82BC,
+    (q15_t)0x08A2, (q15_t)0x7FB5, (q15_t)0x812A, (q15_t)0x1139, (q15_t)0xE642, (q15_t)0x829D, (q15_t)0x086F, (q15_t)0x7FB8,
+    (q15_t)0x811C, (q15_t)0x10D6, (q15_t)0xE6D5, (q15_t)0x827F, (q15_t)0x083D, (q15_t)0x7FBC, (q15_t)0x810F, (q15_t)0x1072,
+    (q15_t)0xE769, (q15_t)0x8262, (q15_t)0x080B, (q15_t)0x7FBF, (q15_t)0x8102, (q15_t)0x100E, (q15_t)0xE7FD, (q15_t)0x8245,
+    (q15_t)0x07D9, (q15_t)0x7FC2, (q15_t)0x80F6, (q15_t)0x0FAB, (q15_t)0xE892, (q15_t)0x8229, (q15_t)0x07A7, (q15_t)0x7FC5,
+    (q15_t)0x80EA, (q15_t)0x0F47, (q15_t)0xE926, (q15_t)0x820E, (q15_t)0x0775, (q15_t)0x7FC8, (q15_t)0x80DE, (q15_t)0x0EE3,
+    (q15_t)0xE9BA, (q15_t)0x81F3, (q15_t)0x0742, (q15_t)0x7FCB, (q15_t)0x80D2, (q15_t)0x0E7F, (q15_t)0xEA4F, (q15_t)0x81D9,
+    (q15_t)0x0710, (q15_t)0x7FCE, (q15_t)0x80C7, (q15_t)0x0E1B, (q15_t)0xEAE4, (q15_t)0x81C0, (q15_t)0x06DE, (q15_t)0x7FD0,
+    (q15_t)0x80BC, (q15_t)0x0DB7, (q15_t)0xEB78, (q15_t)0x81A8, (q15_t)0x06AC, (q15_t)0x7FD3, (q15_t)0x80B2, (q15_t)0x0D53,
+    (q15_t)0xEC0D, (q15_t)0x8190, (q15_t)0x067A, (q15_t)0x7FD6, (q15_t)0x80A7, (q15_t)0x0CEF, (q15_t)0xECA2, (q15_t)0x8179,
+    (q15_t)0x0647, (q15_t)0x7FD8, (q15_t)0x809D, (q15_t)0x0C8B, (q15_t)0xED37, (q15_t)0x8162, (q15_t)0x0615, (q15_t)0x7FDA,
+    (q15_t)0x8094, (q15_t)0x0C27, (q15_t)0xEDCD, (q15_t)0x814C, (q15_t)0x05E3, (q15_t)0x7FDD, (q15_t)0x808A, (q15_t)0x0BC3,
+    (q15_t)0xEE62, (q15_t)0x8137, (q15_t)0x05B1, (q15_t)0x7FDF, (q15_t)0x8081, (q15_t)0x0B5F, (q15_t)0xEEF7, (q15_t)0x8123,
+    (q15_t)0x057F, (q15_t)0x7FE1, (q15_t)0x8078, (q15_t)0x0AFB, (q15_t)0xEF8D, (q15_t)0x810F, (q15_t)0x054C, (q15_t)0x7FE3,
+    (q15_t)0x8070, (q15_t)0x0A97, (q15_t)0xF022, (q15_t)0x80FC, (q15_t)0x051A, (q15_t)0x7FE5, (q15_t)0x8068, (q15_t)0x0A33,
+    (q15_t)0xF0B8, (q15_t)0x80EA, (q15_t)0x04E8, (q15_t)0x7FE7, (q15_t)0x8060, (q15_t)0x09CE, (q15_t)0xF14E, (q15_t)0x80D8,
+    (q15_t)0x04B6, (q15_t)0x7FE9, (q15_t)0x8058, (q15_t)0x096A, (q15_t)0xF1E4, (q15_t)0x80C7, (q15_t)0x0483, (q15_t)0x7FEB,
+    (q15_t)0x8051, (q15_t)0x0906, (q15_t)0xF27A, (q15_t)0x80B7, (q15_t)0x0451, (q15_t)0x7FED, (q15_t)0x804A, (q15_t)0x08A2,
+    (q15_t)0xF310, (q15_t)0x80A7, (q15_t)0x041F, (q15_t)0x7FEE, (q15_t)0x8043, (q15_t)0x083D, (q15_t)0xF3A6, (q15_t)0x8098,
+    (q15_t)0x03ED, (q15_t)0x7FF0, (q15_t)0x803D, (q15_t)0x07D9, (q15_t)0xF43C, (q15_t)0x808A, (q15_t)0x03BA, (q15_t)0x7FF2,
+    (q15_t)0x8037, (q15_t)0x0775, (q15_t)0xF4D2, (q15_t)0x807D, (q15_t)0x0388, (q15_t)0x7FF3, (q15_t)0x8031, (q15_t)0x0710,
+    (q15_t)0xF568, (q15_t)0x8070, (q15_t)0x0356, (q15_t)0x7FF4, (q15_t)0x802C, (q15_t)0x06AC, (q15_t)0xF5FF, (q15_t)0x8064,
+    (q15_t)0x0324, (q15_t)0x7FF6, (q15_t)0x8027, (q15_t)0x0647, (q15_t)0xF695, (q15_t)0x8058, (q15_t)0x02F1, (q15_t)0x7FF7,
+    (q15_t)0x8022, (q15_t)0x05E3, (q15_t)0xF72B, (q15_t)0x804E, (q15_t)0x02BF, (q15_t)0x7FF8, (q15_t)0x801E, (q15_t)0x057F,
+    (q15_t)0xF7C2, (q15_t)0x8043, (q15_t)0x028D, (q15_t)0x7FF9, (q15_t)0x801A, (q15_t)0x051A, (q15_t)0xF858, (q15_t)0x803A,
+    (q15_t)0x025B, (q15_t)0x7FFA, (q15_t)0x8016, (q15_t)0x04B6, (q15_t)0xF8EF, (q15_t)0x8031, (q15_t)0x0228, (q15_t)0x7FFB,
+    (q15_t)0x8012, (q15_t)0x0451, (q15_t)0xF985, (q15_t)0x8029, (q15_t)0x01F6, (q15_t)0x7FFC, (q15_t)0x800F, (q15_t)0x03ED,
+    (q15_t)0xFA1C, (q15_t)0x8022, (q15_t)0x01C4, (q15_t)0x7FFC, (q15_t)0x800C, (q15_t)0x0388, (q15_t)0xFAB3, (q15_t)0x801C,
+    (q15_t)0x0192, (q15_t)0x7FFD, (q15_t)0x8009, (q15_t)0x0324, (q15_t)0xFB49, (q15_t)0x8016, (q15_t)0x015F, (q15_t)0x7FFE,
+    (q15_t)0x8007, (q15_t)0x02BF, (q15_t)0xFBE0, (q15_t)0x8011, (q15_t)0x012D, (q15_t)0x7FFE, (q15_t)0x8005, (q15_t)0x025B,
+    (q15_t)0xFC77, (q15_t)0x800C, (q15_t)0x00FB, (q15_t)0x7FFF, (q15_t)0x8003, (q15_t)0x01F6, (q15_t)0xFD0E, (q15_t)0x8008,
+    (q15_t)0x00C9, (q15_t)0x7FFF, (q15_t)0x8002, (q15_t)0x0192, (q15_t)0xFDA4, (q15_t)0x8005, (q15_t)0x0096, (q15_t)0x7FFF,
+    (q15_t)0x8001, (q15_t)0x012D, (q15_t)0xFE3B, (q15_t)0x8003, (q15_t)0x0064, (q15_t)0x7FFF, (q15_t)0x8000, (q15_t)0x00C9,
+    (q15_t)0xFED2, (q15_t)0x8001, (q15_t)0x0032, (q15_t)0x7FFF, (q15_t)0x8000, (q15_t)0x0064, (q15_t)0xFF69, (q15_t)0x8000
+};
+
+/* Radix-2 step of the 2048-point 4x2 CFFT */
+const q15_t rfftStockhamR2Q15_2048[2048] RFFT_Q15_ALIGN =
+{
+    (q15_t)0x7FFF, (q15_t)0x0000, (q15_t)0x5A82, (q15_t)0x5A82, (q15_t)0x0000, (q15_t)0x7FFF, (q15_t)0xA57D, (q15_t)0x5A82,
+    (q15_t)0x7FFF, (q15_t)0x0064, (q15_t)0x5A3B, (q15_t)0x5AC9, (q15_t)0xFF9B, (q15_t)0x7FFF, (q15_t)0xA536, (q15_t)0x5A3B,
+    (q15_t)0x7FFF, (q15_t)0x00C9, (q15_t)0x59F3, (q15_t)0x5B10, (q15_t)0xFF36, (q15_t)0x7FFF, (q15_t)0xA4EF, (q15_t)0x59F3,
+    (q15_t)0x7FFE, (q15_t)0x012D, (q15_t)0x59AC, (q15_t)0x5B56, (q15_t)0xFED2, (q15_t)0x7FFE, (q15_t)0xA4A9, (q15_t)0x59AC,
+    (q15_t)0x7FFD, (q15_t)0x0192, (q15_t)0x5964, (q15_t)0x5B9D, (q15_t)0xFE6D, (q15_t)0x7FFD, (q15_t)0xA462, (q15_t)0x5964,
+    (q15_t)0x7FFC, (q15_t)0x01F6, (q15_t)0x591C, (q15_t)0x5BE3, (q15_t)0xFE09, (q15_t)0x7FFC, (q15_t)0xA41C, (q15_t)0x591C,
+    (q15_t)0x7FFA, (q15_t)0x025B, (q15_t)0x58D4, (q15_t)0x5C29, (q15_t)0xFDA4, (q15_t)0x7FFA, (q15_t)0xA3D6, (q15_t)0x58D4,
+    (q15_t)0x7FF8, (q15_t)0x02BF, (q15_t)0x588B, (q15_t)0x5C6E, (q15_t)0xFD40, (q15_t)0x7FF8, (q15_t)0xA391, (q15_t)0x588B,
+    (q15_t)0x7FF6, (q15_t)0x0324, (q15_t)0x5842, (q15_t)0x5CB4, (q15_t)0xFCDB, (q15_t)0x7FF6, (q15_t)0xA34B, (q15_t)0x5842,
+    (q15_t)0x7FF3, (q15_t)0x0388, (q15_t)0x57F9, (q15_t)0x5CF9, (q15_t)0xFC77, (q15_t)0x7FF3, (q15_t)0xA306, (q15_t)0x57F9,
+    (q15_t)0x7FF0, (q15_t)0x03ED, (q15_t)0x57B0, (q15_t)0x5D3E, (q15_t)0xFC12, (q15_t)0x7FF0, (q15_t)0xA2C1, (q15_t)0x57B0,
+    (q15_t)0x7FED, (q15_t)0x0451, (q15_t)0x5767, (q15_t)0x5D83, (q15_t)0xFBAE, (q15_t)0x7FED, (q15_t)0xA27C, (q15_t)0x5767,
+    (q15_t)0x7FE9, (q15_t)0x04B6, (q15_t)0x571D, (q15_t)0x5DC7, (q15_t)0xFB49, (q15_t)0x7FE9, (q15_t)0xA238, (q15_t)0x571D,
+    (q15_t)0x7FE5, (q15_t)0x051A, (q15_t)0x56D4, (q15_t)0x5E0B, (q15_t)0xFAE5, (q15_t)0x7FE5, (q15_t)0xA1F4, (q15_t)0x56D4,
+    (q15_t)0x7FE1, (q15_t)0x057F, (q15_t)0x568A, (q15_t)0x5E50, (q15_t)0xFA80, (q15_t)0x7FE1, (q15_t)0xA1AF, (q15_t)0x568A,
+    (q15_t)0x7FDD, (q15_t)0x05E3, (q15_t)0x5640, (q15_t)0x5E93, (q15_t)0xFA1C, (q15_t)0x7FDD, (q15_t)0xA16C, (q15_t)0x5640,
+    (q15_t)0x7FD8, (q15_t)0x0647, (q15_t)0x55F5, (q15_t)0x5ED7, (q15_t)0xF9B8, (q15_t)0x7FD8, (q15_t)0xA128, (q15_t)0x55F5,
+    (q15_t)0x7FD3, (q15_t)0x06AC, (q15_t)0x55AB, (q15_t)0x5F1A, (q15_t)0xF953, (q15_t)0x7FD3, (q15_t)0xA0E5, (q15_t)0x55AB,
+    (q15_t)0x7FCE, (q15_t)0x0710, (q15_t)0x5560, (q15_t)0x5F5E, (q15_t)0xF8EF, (q15_t)0x7FCE, (q15_t)0xA0A1, (q15_t)0x5560,
+    (q15_t)0x7FC8, (q15_t)0x0775, (q15_t)0x5515, (q15_t)0x5FA0, (q15_t)0xF88A, (q15_t)0x7FC8, (q15_t)0xA05F, (q15_t)0x5515,
+    (q15_t)0x7FC2, (q15_t)0x07D9, (q15_t)0x54CA, (q15_t)0x5FE3, (q15_t)0xF826, (q15_t)0x7FC2, (q15_t)0xA01C, (q15_t)0x54CA,
+    (q15_t)0x7FBC, (q15_t)0x083D, (q15_t)0x547E, (q15_t)0x6026, (q15_t)0xF7C2, (q15_t)0x7FBC, (q15_t)0x9FD9, (q15_t)0x547E,
+    (q15_t)0x7FB5, (q15_t)0x08A2, (q15_t)0x5433, (q15_t)0x6068, (q15_t)0xF75D, (q15_t)0x7FB5, (q15_t)0x9F97, (q15_t)0x5433,
+    (q15_t)0x7FAE, (q15_t)0x0906, (q15_t)0x53E7, (q15_t)0x60AA, (q15_t)0xF6F9, (q15_t)0x7FAE, (q15_t)0x9F55, (q15_t)0x53E7,
+    (q15_t)0x7FA7, (q15_t)0x096A, (q15_t)0x539B, (q15_t)0x60EC, (q15_t)0xF695, (q15_t)0x7FA7, (q15_t)0x9F13, (q15_t)0x539B,
+    (q15_t)0x7F9F, (q15_t)0x09CE, (q15_t)0x534E, (q15_t)0x612D, (q15_t)0xF631, (q15_t)0x7F9F, (q15_t)0x9ED2, (q15_t)0x534E,
+    (q15_t)0x7F97, (q15_t)0x0A33, (q15_t)0x5302, (q15_t)0x616F, (q15_t)0xF5CC, (q15_t)0x7F97, (q15_t)0x9E90, (q15_t)0x5302,
+    (q15_t)0x7F8F, (q15_t)0x0A97, (q15_t)0x52B5, (q15_t)0x61B0, (q15_t)0xF568, (q15_t)0x7F8F, (q15_t)0x9E4F, (q15_t)0x52B5,
+    (q15_t)0x7F87, (q15_t)0x0AFB, (q15_t)0x5269, (q15_t)0x61F1, (q15_t)0xF504, (q15_t)0x7F87, (q15_t)0x9E0E, (q15_t)0x5269,
+    (q15_t)0x7F7E, (q15_t)0x0B5F, (q15_t)0x521C, (q15_t)0x6231, (q15_t)0xF4A0, (q15_t)0x7F7E, (q15_t)0x9DCE, (q15_t)0x521C,
+    (q15_t)0x7F75, (q15_t)0x0BC3, (q15_t)0x51CE, (q15_t)0x6271, (q15_t)0xF43C, (q15_t)0x7F75, (q15_t)0x9D8E, (q15_t)0x51CE,
+    (q15_t)0x7F6B, (q15_t)0x0C27, (q15_t)0x5181, (q15_t)0x62B2, (q15_t)0xF3D8, (q15_t)0x7F6B, (q15_t)0x9D4D, (q15_t)0x5181,
+    (q15_t)0x7F62, (q15_t)0x0C8B, (q15_t)0x5133, (q15_t)0x62F2, (q15_t)0xF374, (q15_t)0x7F62, (q15_t)0x9D0D, (q15_t)0x5133,
+    (q15_t)0x7F58, (q15_t)0x0CEF, (q15_t)0x50E5, (q15_t)0x6331, (q15_t)0xF310, (q15_t)0x7F58, (q15_t)0x9CCE, (q15_t)0x50E5,
+    (q15_t)0x7F4D, (q15_t)0x0D53, (q15_t)0x5097, (q15_t)0x6371, (q15_t)0xF2AC, (q15_t)0x7F4D, (q15_t)0x9C8E, (q15_t)0x5097,
+    (q15_t)0x7F43, (q15_t)0x0DB7, (q15_t)0x5049, (q15_t)0x63B0, (q15_t)0xF248, (q15_t)0x7F43, (q15_t)0x9C4F, (q15_t)0x5049,
+    (q15_t)0x7F38, (q15_t)0x0E1B, (q15_t)0x4FFB, (q15_t)0x63EF, (q15_t)0xF1E4, (q15_t)0x7F38, (q15_t)0x9C10, (q15_t)0x4FFB,
+    (q15_t)0x7F2D, (q15_t)0x0E7F, (q15_t)0x4FAC, (q15_t)0x642D, (q15_t)0xF180, (q15_t)0x7F2D, (q15_t)0x9BD2, (q15_t)0x4FAC,
+    (q15_t)0x7F21, (q15_t)0x0EE3, (q15_t)0x4F5E, (q15_t)0x646C, (q15_t)0xF11C, (q15_t)0x7F21, (q15_t)0x9B93, (q15_t)0x4F5E,
+    (q15_t)0x7F15, (q15_t)0x0F47, (q15_t)0x4F0F, (q15_t)0x64AA, (q15_t)0xF0B8, (q15_t)0x7F15, (q15_t)0x9B55, (q15_t)0x4F0F,
+    (q15_t)0x7F09, (q15_t)0x0FAB, (q15_t)0x4EBF, (q15_t)0x64E8, (q15_t)0xF054, (q15_t)0x7F09, (q15_t)0x9B17, (q15_t)0x4EBF,
+    (q15_t)0x7EFD, (q15_t)0x100E, (q15_t)0x4E70, (q15_t)0x6526, (q15_t)0xEFF1, (q15_t)0x7EFD, (q15_t)0x9AD9, (q15_t)0x4E70,
+    (q15_t)0x7EF0, (q15_t)0x1072, (q15_t)0x4E21, (q15_t)0x6563, (q15_t)0xEF8D, (q15_t)0x7EF0, (q15_t)0x9A9C, (q15_t)0x4E21,
+    (q15_t)0x7EE3, (q15_t)0x10D6, (q15_t)0x4DD1, (q15_t)0x65A0, (q15_t)0xEF29, (q15_t)0x7EE3, (q15_t)0x9A5F, (q15_t)0x4DD1,
+    (q15_t)0x7ED5, (q15_t)0x1139, (q15_t)0x4D81, (q15_t)0x65DD, (q15_t)0xEEC6, (q15_t)0x7ED5, (q15_t)0x9A22, (q15_t)0x4D81,
+    (q15_t)0x7EC8, (q15_t)0x119D, (q15_t)0x4D31, (q15_t)0x661A, (q15_t)0xEE62, (q15_t)0x7EC8, (q15_t)0x99E5, (q15_t)0x4D31,
+    (q15_t)0x7EBA, (q15_t)0x1201, (q15_t)0x4CE1, (q15_t)0x6657, (q15_t)0xEDFE, (q15_t)0x7EBA, (q15_t)0x99A8, (q15_t)0x4CE1,
+    (q15_t)0x7EAB, (q15_t)0x1264, (q15_t)0x4C90, (q15_t)0x6693, (q15_t)0xED9B, (q15_t)0x7EAB, (q15_t)0x996C, (q15_t)0x4C90,
+    (q15_t)0x7E9D, (q15_t)0x12C8, (q15_t)0x4C3F, (q15_t)0x66CF, (q15_t)0xED37, (q15_t)0x7E9D, (q15_t)0x9930, (q15_t)0x4C3F,
+    (q15_t)0x7E8E, (q15_t)0x132B, (q15_t)0x4BEF, (q15_t)0x670B, (q15_t)0xECD4, (q15_t)0x7E8E, (q15_t)0x98F4, (q15_t)0x4BEF,
+    (q15_t)0x7E7F, (q15_t)0x138E, (q15_t)0x4B9E, (q15_t)0x6746, (q15_t)0xEC71, (q15_t)0x7E7F, (q15_t)0x98B9, (q15_t)0x4B9E,
+    (q15_t)0x7E6F, (q15_t)0x13F2, (q15_t)0x4B4C, (q15_t)0x6782, (q15_t)0xEC0D, (q15_t)0x7E6F, (q15_t)0x987D, (q15_t)0x4B4C,
+    (q15_t)0x7E5F, (q15_t)0x1455, (q15_t)0x4AFB, (q15_t)0x67BD, (q15_t)0xEBAA, (q15_t)0x7E5F, (q15_t)0x9842, (q15_t)0x4AFB,
+    (q15_t)0x7E4F, (q15_t)0x14B8, (q15_t)0x4AA9, (q15_t)0x67F7, (q15_t)0xEB47, (q15_t)0x7E4F, (q15_t)0x9808, (q15_t)0x4AA9,
+    (q15_t)0x7E3F, (q15_t)0x151B, (q15_t)0x4A58, (q15_t)0x6832, (q15_t)0xEAE4, (q15_t)0x7E3F, (q15_t)0x97CD, (q15_t)0x4A58,
+    (q15_t)0x7E2E, (q15_t)0x157F, (q15_t)0x4A06, (q15_t)0x686C, (q15_t)0xEA80, (q15_t)0x7E2E, (q15_t)0x9793, (q15_t)0x4A06,
+    (q15_t)0x7E1D, (q15_t)0x15E2, (q15_t)0x49B4, (q15_t)0x68A6, (q15_t)0xEA1D, (q15_t)0x7E1D, (q15_t)0x9759, (q15_t)0x49B4,
+    (q15_t)0x7E0C, (q15_t)0x1645, (q15_t)0x4961, (q15_t)0x68E0, (q15_t)0xE9BA, (q15_t)0x7E0C, (q15_t)0x971F, (q15_t)0x4961,
+    (q15_t)0x7DFA, (q15_t)0x16A8, (q15_t)0x490F, (q15_t)0x6919, (q15_t)0xE957, (q15_t)0x7DFA, (q15_t)0x96E6, (q15_t)0x490F,
+    (q15_t)0x7DE8, (q15_t)0x170A, (q15_t)0x48BC, (q15_t)0x6953, (q15_t)0xE8F5, (q15_t)0x7DE8, (q15_t)0x96AC, (q15_t)0x48BC,
+    (q15_t)0x7DD6, (q15_t)0x176D, (q15_t)0x4869, (q15_t)0x698C, (q15_t)0xE892, (q15_t)0x7DD6, (q15_t)0x9673, (q15_t)0x4869,
+    (q15_t)0x7DC3, (q15_t)0x17D0, (q15_t)0x4816, (q15_t)0x69C4, (q15_t)0xE82F, (q15_t)0x7DC3, (q15_t)0x963B, (q15_t)0x4816,
+    (q15_t)0x7DB0, (q15_t)0x1833, (q15_t)0x47C3, (q15_t)0x69FD, (q15_t)0xE7CC, (q15_t)0x7DB0, (q15_t)0x9602, (q15_t)0x47C3,
+    (q15_t)0x7D9D, (q15_t)0x1896, (q15_t)0x4770, (q15_t)0x6A35, (q15_t)0xE769, (q15_t)0x7D9D, (q15_t)0x95CA, (q15_t)0x4770,
+    (q15_t)0x7D8A, (q15_t)0x18F8, (q15_t)0x471C, (q15_t)0x6A6D, (q15_t)0xE707, (q15_t)0x7D8A, (q15_t)0x9592, (q15_t)0x471C,
+    (q15_t)0x7D76, (q15_t)0x195B, (q15_t)0x46C9, (q15_t)0x6AA5, (q15_t)0xE6A4, (q15_t)0x7D76, (q15_t)0x955A, (q15_t)0x46C9,
+    (q15_t)0x7D62, (q15_t)0x19BD, (q15_t)0x4675, (q15_t)0x6ADC, (q15_t)0xE642, (q15_t)0x7D62, (q15_t)0x9523, (q15_t)0x4675,
+    (q15_t)0x7D4E, (q15_t)0x1A20, (q15_t)0x4621, (q15_t)0x6B13, (q15_t)0xE5DF, (q15_t)0x7D4E, (q15_t)0x94EC, (q15_t)0x4621,
+    (q15_t)0x7D39, (q15_t)0x1A82, (q15_t)0x45CD, (q15_t)0x6B4A, (q15_t)0xE57D, (q15_t)0x7D39, (q15_t)0x94B5, (q15_t)0x45CD,
+    (q15_t)0x7D24, (q15_t)0x1AE4, (q15_t)0x4578, (q15_t)0x6B81, (q15_t)0xE51B, (q15_t)0x7D24, (q15_t)0x947E, (q15_t)0x4578,
+    (q15_t)0x7D0F, (q15_t)0x1B47, (q15_t)0x4524, (q15_t)0x6BB8, (q15_t)0xE4B8, (q15_t)0x7D0F, (q15_t)0x9447, (q15_t)0x4524,
+    (q15_t)0x7CF9, (q15_t)0x1BA9, (q15_t)0x44CF, (q15_t)0x6BEE, (q15_t)0xE456, (q15_t)0x7CF9, (q15_t)0x9411, (q15_t)0x44CF,
+    (q15_t)0x7CE3, (q15_t)0x1C0B, (q15_t)0x447A, (q15_t)0x6C24, (q15_t)0xE3F4, (q15_t)0x7CE3, (q15_t)0x93DB, (q15_t)0x447A,
+    (q15_t)0x7CCD, (q15_t)0x1C6D, (q15_t)0x4425, (q15_t)0x6C59, (q15_t)0xE392, (q15_t)0x7CCD, (q15_t)0x93A6, (q15_t)0x4425,
+    (q15_t)0x7CB7, (q15_t)0x1CCF, (q15_t)0x43D0, (q15_t)0x6C8F, (q15_t)0xE330, (q15_t)0x7CB7, (q15_t)0x9370, (q15_t)0x43D0,
+    (q15_t)0x7CA0, (q15_t)0x1D31, (q15_t)0x437B, (q15_t)0x6CC4, (q15_t)0xE2CE, (q15_t)0x7CA0, (q15_t)0x933B, (q15_t)0x437B,
+    (q15_t)0x7C89, (q15_t)0x1D93, (q15_t)0x4325, (q15_t)0x6CF9, (q15_t)0xE26C, (q15_t)0x7C89, (q15_t)0x9306, (q15_t)0x4325,
+    (q15_t)0x7C71, (q15_t)0x1DF5, (q15_t)0x42D0, (q15_t)0x6D2D, (q15_t)0xE20A, (q15_t)0x7C71, (q15_t)0x92D2, (q15_t)0x42D0,
+    (q15_t)0x7C5A, (q15_t)0x1E56, (q15_t)0x427A, (q15_t)0x6D62, (q15_t)0xE1A9, (q15_t)0x7C5A, (q15_t)0x929D, (q15_t)0x427A,
+    (q15_t)0x7C42, (q15_t)0x1EB8, (q15_t)0x4224, (q15_t)0x6D96, (q15_t)0xE147, (q15_t)0x7C42, (q15_t)0x9269, (q15_t)0x4224,
+    (q15_t)0x7C29, (q15_t)0x1F19, (q15_t)0x41CE, (q15_t)0x6DCA, (q15_t)0xE0E6, (q15_t)0x7C29, (q15_t)0x9235, (q15_t)0x41CE,
+    (q15_t)0x7C11, (q15_t)0x1F7B, (q15_t)0x4177, (q15_t)0x6DFD, (q15_t)0xE084, (q15_t)0x7C11, (q15_t)0x9202, (q15_t)0x4177,
+    (q15_t)0x7BF8, (q15_t)0x1FDC, (q15_t)0x4121, (q15_t)0x6E30, (q15_t)0xE023, (q15_t)0x7BF8, (q15_t)0x91CF, (q15_t)0x4121,
+    (q15_t)0x7BDF, (q15_t)0x203E, (q15_t)0x40CA, (q15_t)0x6E63, (q15_t)0xDFC1, (q15_t)0x7BDF, (q15_t)0x919C, (q15_t)0x40CA,
+    (q15_t)0x7BC5, (q15_t)0x209F, (q15_t)0x4073, (q15_t)0x6E96, (q15_t)0xDF60, (q15_t)0x7BC5, (q15_t)0x9169, (q15_t)0x4073,
+    (q15_t)0x7BAC, (q15_t)0x2100, (q15_t)0x401D, (q15_t)0x6EC9, (q15_t)0xDEFF, (q15_t)0x7BAC, (q15_t)0x9136, (q15_t)0x401D,
+    (q15_t)0x7B92, (q15_t)0x2161, (q15_t)0x3FC5, (q15_t)0x6EFB, (q15_t)0xDE9E, (q15_t)0x7B92, (q15_t)0x9104, (q15_t)0x3FC5,
+    (q15_t)0x7B77, (q15_t)0x21C2, (q15_t)0x3F6E, (q15_t)0x6F2D, (q15_t)0xDE3D, (q15_t)0x7B77, (q15_t)0x90D2, (q15_t)0x3F6E,
+    (q15_t)0x7B5D, (q15_t)0x2223, (q15_t)0x3F17, (q15_t)0x6F5F, (q15_t)0xDDDC, (q15_t)0x7B5D, (q15_t)0x90A0, (q15_t)0x3F17,
+    (q15_t)0x7B42, (q15_t)0x2284, (q15_t)0x3EBF, (q15_t)0x6F90, (q15_t)0xDD7B, (q15_t)0x7B42, (q15_t)0x906F, (q15_t)0x3EBF,
+    (q15_t)0x7B26, (q15_t)0x22E5, (q15_t)0x3E68, (q15_t)0x6FC1, (q15_t)0xDD1A, (q15_t)0x7B26, (q15_t)0x903E, (q15_t)0x3E68,
+    (q15_t)0x7B0B, (q15_t)0x2345, (q15_t)0x3E10, (q15_t)0x6FF2, (q15_t)0xDCBA, (q15_t)0x7B0B, (q15_t)0x900D, (q15_t)0x3E10,
+    (q15_t)0x7AEF, (q15_t)0x23A6, (q15_t)0x3DB8, (q15_t)0x7023, (q15_t)0xDC59, (q15_t)0x7AEF, (q15_t)0x8FDC, (q15_t)0x3DB8,
+    (q15_t)0x7AD3, (q15_t)0x2407, (q15_t)0x3D60, (q15_t)0x7053, (q15_t)0xDBF8, (q15_t)0x7AD3, (q15_t)0x8FAC, (q15_t)0x3D60,
+    (q15_t)0x7AB6, (q15_t)0x2467, (q15_t)0x3D07, (q15_t)0x7083, (q15_t)0xDB98, (q15_t)0x7AB6, (q15_t)0x8F7C, (q15_t)0x3D07,
+    (q15_t)0x7A9A, (q15_t)0x24C7, (q15_t)0x3CAF, (q15_t)0x70B3, (q15_t)0xDB38, (q15_t)0x7A9A, (q15_t)0x8F4C, (q15_t)0x3CAF,
+    (q15_t)0x7A7D, (q15_t)0x2528, (q15_t)0x3C56, (q15_t)0x70E2, (q15_t)0xDAD7, (q15_t)0x7A7D, (q15_t)0x8F1D, (q15_t)0x3C56,
+    (q15_t)0x7A5F, (q15_t)0x2588, (q15_t)0x3BFD, (q15_t)0x7112, (q15_t)0xDA77, (q15_t)0x7A5F, (q15_t)0x8EED, (q15_t)0x3BFD,
+    (q15_t)0x7A42, (q15_t)0x25E8, (q15_t)0x3BA5, (q15_t)0x7141, (q15_t)0xDA17, (q15_t)0x7A42, (q15_t)0x8EBE, (q15_t)0x3BA5,
+    (q15_t)0x7A24, (q15_t)0x2648, (q15_t)0x3B4C, (q15_t)0x716F, (q15_t)0xD9B7, (q15_t)0x7A24, (q15_t)0x8E90, (q15_t)0x3B4C,
+    (q15_t)0x7A05, (q15_t)0x26A8, (q15_t)0x3AF2, (q15_t)0x719E, (q15_t)0xD957, (q15_t)0x7A05, (q15_t)0x8E61, (q15_t)0x3AF2,
+    (q15_t)0x79E7, (q15_t)0x2707, (q15_t)0x3A99, (q15_t)0x71CC, (q15_t)0xD8F8, (q15_t)0x79E7, (q15_t)0x8E33, (q15_t)0x3A99,
+    (q15_t)0x79C8, (q15_t)0x2767, (q15_t)0x3A40, (q15_t)0x71FA, (q15_t)0xD898, (q15_t)0x79C8, (q15_t)0x8E05, (q15_t)0x3A40,
+    (q15_t)0x79A9, (q15_t)0x27C7, (q15_t)0x39E6, (q15_t)0x7227, (q15_t)0xD838, (q15_t)0x79A9, (q15_t)0x8DD8, (q15_t)0x39E6,
+    (q15_t)0x798A, (q15_t)0x2826, (q15_t)0x398C, (q15_t)0x7255, (q15_t)0xD7D9, (q15_t)0x798A, (q15_t)0x8DAA, (q15_t)0x398C,
+    (q15_t)0x796A, (q15_t)0x2886, (q15_t)0x3932, (q15_t)0x7282, (q15_t)0xD779, (q15_t)0x796A, (q15_t)0x8D7D, (q15_t)0x3932,
+    (q15_t)0x794A, (q15_t)0x28E5, (q15_t)0x38D8, (q15_t)0x72AF, (q15_t)0xD71A, (q15_t)0x794A, (q15_t)0x8D50, (q15_t)0x38D8,
+    (q15_t)0x792A, (q15_t)0x2944, (q15_t)0x387E, (q15_t)0x72DB, (q15_t)0xD6BB, (q15_t)0x792A, (q15_t)0x8D24, (q15_t)0x387E,
+    (q15_t)0x7909, (q15_t)0x29A3, (q15_t)0x3824, (q15_t)0x7307, (q15_t)0xD65C, (q15_t)0x7909, (q15_t)0x8CF8, (q15_t)0x3824,
+    (q15_t)0x78E8, (q15_t)0x2A02, (q15_t)0x37CA, (q15_t)0x7333, (q15_t)0xD5FD, (q15_t)0x78E8, (q15_t)0x8CCC, (q15_t)0x37CA,
+    (q15_t)0x78C7, (q15_t)0x2A61, (q15_t)0x376F, (q15_t)0x735F, (q15_t)0xD59E, (q15_t)0x78C7, (q15_t)0x8CA0, (q15_t)0x376F,
+    (q15_t)0x78A6, (q15_t)0x2AC0, (q15_t)0x3714, (q15_t)0x738A, (q15_t)0xD53F, (q15_t)0x78A6, (q15_t)0x8C75, (q15_t)0x3714,
+    (q15_t)0x7884, (q15_t)0x2B1F, (q15_t)0x36BA, (q15_t)0x73B5, (q15_t)0xD4E0, (q15_t)0x7884, (q15_t)0x8C4A, (q15_t)0x36BA,
+    (q15_t)0x7862, (q15_t)0x2B7D, (q15_t)0x365F, (q15_t)0x73E0, (q15_t)0xD482, (q15_t)0x7862, (q15_t)0x8C1F, (q15_t)0x365F,
+    (q15_t)0x7840, (q15_t)0x2BDC, (q15_t)0x3604, (q15_t)0x740B, (q15_t)0xD423, (q15_t)0x7840, (q15_t)0x8BF4, (q15_t)0x3604,
+    (q15_t)0x781D, (q15_t)0x2C3A, (q15_t)0x35A8, (q15_t)0x7435, (q15_t)0xD3C5, (q15_t)0x781D, (q15_t)0x8BCA, (q15_t)0x35A8,
+    (q15_t)0x77FA, (q15_t)0x2C98, (q15_t)0x354D, (q15_t)0x745F, (q15_t)0xD367, (q15_t)0x77FA, (q15_t)0x8BA0, (q15_t)0x354D,
+    (q15_t)0x77D7, (q15_t)0x2CF7, (q15_t)0x34F2, (q15_t)0x7489, (q15_t)0xD308, (q15_t)0x77D7, (q15_t)0x8B76, (q15_t)0x34F2,
+    (q15_t)0x77B4, (q15_t)0x2D55, (q15_t)0x3496, (q15_t)0x74B2, (q15_t)0xD2AA, (q15_t)0x77B4, (q15_t)0x8B4D, (q15_t)0x3496,
+    (q15_t)0x7790, (q15_t)0x2DB3, (q15_t)0x343A, (q15_t)0x74DB, (q15_t)0xD24C, (q15_t)0x7790, (q15_t)0x8B24, (q15_t)0x343A,
+    (q15_t)0x776C, (q15_t)0x2E11, (q15_t)0x33DE, (q15_t)0x7504, (q15_t)0xD1EE, (q15_t)0x776C, (q15_t)0x8AFB, (q15_t)0x33DE,
+    (q15_t)0x7747, (q15_t)0x2E6E, (q15_t)0x3382, (q15_t)0x752D, (q15_t)0xD191, (q15_t)0x7747, (q15_t)0x8AD2, (q15_t)0x3382,
+    (q15_t)0x7723, (q15_t)0x2ECC, (q15_t)0x3326, (q15_t)0x7555, (q15_t)0xD133, (q15_t)0x7723, (q15_t)0x8AAA, (q15_t)0x3326,
+    (q15_t)0x76FE, (q15_t)0x2F29, (q15_t)0x32CA, (q15_t)0x757D, (q15_t)0xD0D6, (q15_t)0x76FE, (q15_t)0x8A82, (q15_t)0x32CA,
+    (q15_t)0x76D9, (q15_t)0x2F87, (q15_t)0x326E, (q15_t)0x75A5, (q15_t)0xD078, (q15_t)0x76D9, (q15_t)0x8A5A, (q15_t)0x326E,
+    (q15_t)0x76B3, (q15_t)0x2FE4, (q15_t)0x3211, (q15_t)0x75CC, (q15_t)0xD01B, (q15_t)0x76B3, (q15_t)0x8A33, (q15_t)0x3211,
+    (q15_t)0x768E, (q15_t)0x3041, (q15_t)0x31B5, (q15_t)0x75F4, (q15_t)0xCFBE, (q15_t)0x768E, (q15_t)0x8A0B, (q15_t)0x31B5,
+    (q15_t)0x7668, (q15_t)0x309E, (q15_t)0x3158, (q15_t)0x761B, (q15_t)0xCF61, (q15_t)0x7668, (q15_t)0x89E4, (q15_t)0x3158,
+    (q15_t)0x7641, (q15_t)0x30FB, (q15_t)0x30FB, (q15_t)0x7641, (q15_t)0xCF04, (q15_t)0x7641, (q15_t)0x89BE, (q15_t)0x30FB,
+    (q15_t)0x761B, (q15_t)0x3158, (q15_t)0x309E, (q15_t)0x7668, (q15_t)0xCEA7, (q15_t)0x761B, (q15_t)0x8997, (q15_t)0x309E,
+    (q15_t)0x75F4, (q15_t)0x31B5, (q15_t)0x3041, (q15_t)0x768E, (q15_t)0xCE4A, (q15_t)0x75F4, (q15_t)0x8971, (q15_t)0x3041,
+    (q15_t)0x75CC, (q15_t)0x3211, (q15_t)0x2FE4, (q15_t)0x76B3, (q15_t)0xCDEE, (q15_t)0x75CC, (q15_t)0x894C, (q15_t)0x2FE4,
+    (q15_t)0x75A5, (q15_t)0x326E, (q15_t)0x2F87, (q15_t)0x76D9, (q15_t)0xCD91, (q15_t)0x75A5, (q15_t)0x8926, (q15_t)0x2F87,
+    (q15_t)0x757D, (q15_t)0x32CA, (q15_t)0x2F29, (q15_t)0x76FE, (q15_t)0xCD35, (q15_t)0x757D, (q15_t)0x8901, (q15_t)0x2F29,
+    (q15_t)0x7555, (q15_t)0x3326, (q15_t)0x2ECC, (q15_t)0x7723, (q15_t)0xCCD9, (q15_t)0x7555, (q15_t)0x88DC, (q15_t)0x2ECC,
+    (q15_t)0x752D, (q15_t)0x3382, (q15_t)0x2E6E, (q15_t)0x7747, (q15_t)0xCC7D, (q15_t)0x752D, (q15_t)0x88B8, (q15_t)0x2E6E,
+    (q15_t)0x7504, (q15_t)0x33DE, (q15_t)0x2E11, (q15_t)0x776C, (q15_t)0xCC21, (q15_t)0x7504, (q15_t)0x8893, (q15_t)0x2E11,
+    (q15_t)0x74DB, (q15_t)0x343A, (q15_t)0x2DB3, (q15_t)0x7790, (q15_t)0xCBC5, (q15_t)0x74DB, (q15_t)0x886F, (q15_t)0x2DB3,
+    (q15_t)0x74B2, (q15_t)0x3496, (q15_t)0x2D55, (q15_t)0x77B4, (q15_t)0xCB69, (q15_t)0x74B2, (q15_t)0x884B, (q15_t)0x2D55,
+    (q15_t)0x7489, (q15_t)0x34F2, (q15_t)0x2CF7, (q15_t)0x77D7, (q15_t)0xCB0D, (q15_t)0x7489, (q15_t)0x8828, (q15_t)0x2CF7,
+    (q15_t)0x745F, (q15_t)0x354D, (q15_t)0x2C98, (q15_t)0x77FA, (q15_t)0xCAB2, (q15_t)0x745F, (q15_t)0x8805, (q15_t)0x2C98,
+    (q15_t)0x7435, (q15_t)0x35A8, (q15_t)0x2C3A, (q15_t)0x781D, (q15_t)0xCA57, (q15_t)0x7435, (q15_t)0x87E2, (q15_t)0x2C3A,
+    (q15_t)0x740B, (q15_t)0x3604, (q15_t)0x2BDC, (q15_t)0x7840, (q15_t)0xC9FB, (q15_t)0x740B, (q15_t)0x87BF, (q15_t)0x2BDC,
+    (q15_t)0x73E0, (q15_t)0x365F, (q15_t)0x2B7D, (q15_t)0x7862, (q15_t)0xC9A0, (q15_t)0x73E0, (q15_t)0x879D, (q15_t)0x2B7D,
+    (q15_t)0x73B5, (q15_t)0x36BA, (q15_t)0x2B1F, (q15_t)0x7884, (q15_t)0xC945, (q15_t)0x73B5, (q15_t)0x877B, (q15_t)0x2B1F,
+    (q15_t)0x738A, (q15_t)0x3714, (q15_t)0x2AC0, (q15_t)0x78A6, (q15_t)0xC8EB, (q15_t)0x738A, (q15_t)0x8759, (q15_t)0x2AC0,
+    (q15_t)0x735F, (q15_t)0x376F, (q15_t)0x2A61, (q15_t)0x78C7, (q15_t)0xC890, (q15_t)0x735F, (q15_t)0x8738, (q15_t)0x2A61,
+    (q15_t)0x7333, (q15_t)0x37CA, (q15_t)0x2A02, (q15_t)0x78E8, (q15_t)0xC835, (q15_t)0x7333, (q15_t)0x8717, (q15_t)0x2A02,
+    (q15_t)0x7307, (q15_t)0x3824, (q15_t)0x29A3, (q15_t)0x7909, (q15_t)0xC7DB, (q15_t)0x7307, (q15_t)0x86F6, (q15_t)0x29A3,
+    (q15_t)0x72DB, (q15_t)0x387E, (q15_t)0x2944, (q15_t)0x792A, (q15_t)0xC781, (q15_t)0x72DB, (q15_t)0x86D5, (q15_t)0x2944,
+    (q15_t)0x72AF, (q15_t)0x38D8, (q15_t)0x28E5, (q15_t)0x794A, (q15_t)0xC727, (q15_t)0x72AF, (q15_t)0x86B5, (q15_t)0x28E5,
+    (q15_t)0x7282, (q15_t)0x3932, (q15_t)0x2886, (q15_t)0x796A, (q15_t)0xC6CD, (q15_t)0x7282, (q15_t)0x8695, (q15_t)0x2886,
+    (q15_t)0x7255, (q15_t)0x398C, (q15_t)0x2826, (q15_t)0x798A, (q15_t)0xC673, (q15_t)0x7255, (q15_t)0x8675, (q15_t)0x2826,
+    (q15_t)0x7227, (q15_t)0x39E6, (q15_t)0x27C7, (q15_t)0x79A9, (q15_t)0xC619, (q15_t)0x7227, (q15_t)0x8656, (q15_t)0x27C7,
+    (q15_t)0x71FA, (q15_t)0x3A40, (q15_t)0x2767, (q15_t)0x79C8, (q15_t)0xC5BF, (q15_t)0x71FA, (q15_t)0x8637, (q15_t)0x2767,
+    (q15_t)0x71CC, (q15_t)0x3A99, (q15_t)0x2707, (q15_t)0x79E7, (q15_t)0xC566, (q15_t)0x71CC, (q15_t)0x8618, (q15_t)0x2707,
+    (q15_t)0x719E, (q15_t)0x3AF2, (q15_t)0x26A8, (q15_t)0x7A05, (q15_t)0xC50D, (q15_t)0x719E, (q15_t)0x85FA, (q15_t)0x26A8,
+    (q15_t)0x716F, (q15_t)0x3B4C, (q15_t)0x2648, (q15_t)0x7A24, (q15_t)0xC4B3, (q15_t)0x716F, (q15_t)0x85DB, (q15_t)0x2648,
+    (q15_t)0x7141, (q15_t)0x3BA5, (q15_t)0x25E8, (q15_t)0x7A42, (q15_t)0xC45A, (q15_t)0x7141, (q15_t)0x85BD, (q15_t)0x25E8,
+    (q15_t)0x7112, (q15_t)0x3BFD, (q15_t)0x2588, (q15_t)0x7A5F, (q15_t)0xC402, (q15_t)0x7112, (q15_t)0x85A0, (q15_t)0x2588,
+    (q15_t)0x70E2, (q15_t)0x3C56, (q15_t)0x2528, (q15_t)0x7A7D, (q15_t)0xC3A9, (q15_t)0x70E2, (q15_t)0x8582, (q15_t)0x2528,
+    (q15_t)0x70B3, (q15_t)0x3CAF, (q15_t)0x24C7, (q15_t)0x7A9A, (q15_t)0xC350, (q15_t)0x70B3, (q15_t)0x8565, (q15_t)0x24C7,
+    (q15_t)0x7083, (q15_t)0x3D07, (q15_t)0x2467, (q15_t)0x7AB6, (q15_t)0xC2F8, (q15_t)0x7083, (q15_t)0x8549, (q15_t)0x2467,
+    (q15_t)0x7053, (q15_t)0x3D60, (q15_t)0x2407, (q15_t)0x7AD3, (q15_t)0xC29F, (q15_t)0x7053, (q15_t)0x852C, (q15_t)0x2407,
+    (q15_t)0x7023, (q15_t)0x3DB8, (q15_t)0x23A6, (q15_t)0x7AEF, (q15_t)0xC247, (q15_t)0x7023, (q15_t)0x8510, (q15_t)0x23A6,
+    (q15_t)0x6FF2, (q15_t)0x3E10, (q15_t)0x2345, (q15_t)0x7B0B, (q15_t)0xC1EF, (q15_t)0x6FF2, (q15_t)0x84F4, (q15_t)0x2345,
+    (q15_t)0x6FC1, (q15_t)0x3E68, (q15_t)0x22E5, (q15_t)0x7B26, (q15_t)0xC197, (q15_t)0x6FC1, (q15_t)0x84D9, (q15_t)0x22E5,
+    (q15_t)0x6F90, (q15_t)0x3EBF, (q15_t)0x2284, (q15_t)0x7B42, (q15_t)0xC140, (q15_t)0x6F90, (q15_t)0x84BD, (q15_t)0x2284,
+    (q15_t)0x6F5F, (q15_t)0x3F17, (q15_t)0x2223, (q15_t)0x7B5D, (q15_t)0xC0E8, (q15_t)0x6F5F, (q15_t)0x84A2, (q15_t)0x2223,
+    (q15_t)0x6F2D, (q15_t)0x3F6E, (q15_t)0x21C2, (q15_t)0x7B77, (q15_t)0xC091, (q15_t)0x6F2D, (q15_t)0x8488, (q15_t)0x21C2,
+    (q15_t)0x6EFB, (q15_t)0x3FC5, (q15_t)0x2161, (q15_t)0x7B92, (q15_t)0xC03A, (q15_t)0x6EFB, (q15_t)0x846D, (q15_t)0x2161,
+    (q15_t)0x6EC9, (q15_t)0x401D, (q15_t)0x2100, (q15_t)0x7BAC, (q15_t)0xBFE2, (q15_t)0x6EC9, (q15_t)0x8453, (q15_t)0x2100,
+    (q15_t)0x6E96, (q15_t)0x4073, (q15_t)0x209F, (q15_t)0x7BC5, (q15_t)0xBF8C, (q15_t)0x6E96, (q15_t)0x843A, (q15_t)0x209F,
+    (q15_t)0x6E63, (q15_t)0x40CA, (q15_t)0x203E, (q15_t)0x7BDF, (q15_t)0xBF35, (q15_t)0x6E63, (q15_t)0x8420, (q15_t)0x203E,
+    (q15_t)0x6E30, (q15_t)0x4121, (q15_t)0x1FDC, (q15_t)0x7BF8, (q15_t)0xBEDE, (q15_t)0x6E30, (q15_t)0x8407, (q15_t)0x1FDC,
+    (q15_t)0x6DFD, (q15_t)0x4177, (q15_t)0x1F7B, (q15_t)0x7C11, (q15_t)0xBE88, (q15_t)0x6DFD, (q15_t)0x83EE, (q15_t)0x1F7B,
+    (q15_t)0x6DCA, (q15_t)0x41CE, (q15_t)0x1F19, (q15_t)0x7C29, (q15_t)0xBE31, (q15_t)0x6DCA, (q15_t)0x83D6, (q15_t)0x1F19,
+    (q15_t)0x6D96, (q15_t)0x4224, (q15_t)0x1EB8, (q15_t)0x7C42, (q15_t)0xBDDB, (q15_t)0x6D96, (q15_t)0x83BD, (q15_t)0x1EB8,
+    (q15_t)0x6D62, (q15_t)0x427A, (q15_t)0x1E56, (q15_t)0x7C5A, (q15_t)0xBD85, (q15_t)0x6D62, (q15_t)0x83A5, (q15_t)0x1E56,
+    (q15_t)0x6D2D, (q15_t)0x42D0, (q15_t)0x1DF5, (q15_t)0x7C71, (q15_t)0xBD2F, (q15_t)0x6D2D, (q15_t)0x838E, (q15_t)0x1DF5,
+    (q15_t)0x6CF9, (q15_t)0x4325, (q15_t)0x1D93, (q15_t)0x7C89, (q15_t)0xBCDA, (q15_t)0x6CF9, (q15_t)0x8376, (q15_t)0x1D93,
+    (q15_t)0x6CC4, (q15_t)0x437B, (q15_t)0x1D31, (q15_t)0x7CA0, (q15_t)0xBC84, (q15_t)0x6CC4, (q15_t)0x835F, (q15_t)0x1D31,
+    (q15_t)0x6C8F, (q15_t)0x43D0, (q15_t)0x1CCF, (q15_t)0x7CB7, (q15_t)0xBC2F, (q15_t)0x6C8F, (q15_t)0x8348, (q15_t)0x1CCF,
+    (q15_t)0x6C59, (q15_t)0x4425, (q15_t)0x1C6D, (q15_t)0x7CCD, (q15_t)0xBBDA, (q15_t)0x6C59, (q15_t)0x8332, (q15_t)0x1C6D,
+    (q15_t)0x6C24, (q15_t)0x447A, (q15_t)0x1C0B, (q15_t)0x7CE3, (q15_t)0xBB85, (q15_t)0x6C24, (q15_t)0x831C, (q15_t)0x1C0B,
+    (q15_t)0x6BEE, (q15_t)0x44CF, (q15_t)0x1BA9, (q15_t)0x7CF9, (q15_t)0xBB30, (q15_t)0x6BEE, (q15_t)0x8306, (q15_t)0x1BA9,
+    (q15_t)0x6BB8, (q15_t)0x4524, (q15_t)0x1B47, (q15_t)0x7D0F, (q15_t)0xBADB, (q15_t)0x6BB8, (q15_t)0x82F0, (q15_t)0x1B47,
+    (q15_t)0x6B81, (q15_t)0x4578, (q15_t)0x1AE4, (q15_t)0x7D24, (q15_t)0xBA87, (q15_t)0x6B81, (q15_t)0x82DB, (q15_t)0x1AE4,
+    (q15_t)0x6B4A, (q15_t)0x45CD, (q15_t)0x1A82, (q15_t)0x7D39, (q15_t)0xBA32, (q15_t)0x6B4A, (q15_t)0x82C6, (q15_t)0x1A82,
+    (q15_t)0x6B13, (q15_t)0x4621, (q15_t)0x1A20, (q15_t)0x7D4E, (q15_t)0xB9DE, (q15_t)0x6B13, (q15_t)0x82B1, (q15_t)0x1A20,
+    (q15_t)0x6ADC, (q15_t)0x4675, (q15_t)0x19BD, (q15_t)0x7D62, (q15_t)0xB98A, (q15_t)0x6ADC, (q15_t)0x829D, (q15_t)0x19BD,
+    (q15_t)0x6AA5, (q15_t)0x46C9, (q15_t)0x195B, (q15_t)0x7D76, (q15_t)0xB936, (q15_t)0x6AA5, (q15_t)0x8289, (q15_t)0x195B,
+    (q15_t)0x6A6D, (q15_t)0x471C, (q15_t)0x18F8, (q15_t)0x7D8A, (q15_t)0xB8E3, (q15_t)0x6A6D, (q15_t)0x8275, (q15_t)0x18F8,
+    (q15_t)0x6A35, (q15_t)0x4770, (q15_t)0x1896, (q15_t)0x7D9D, (q15_t)0xB88F, (q15_t)0x6A35, (q15_t)0x8262, (q15_t)0x1896,
+    (q15_t)0x69FD, (q15_t)0x47C3, (q15_t)0x1833, (q15_t)0x7DB0, (q15_t)0xB83C, (q15_t)0x69FD, (q15_t)0x824F, (q15_t)0x1833,
+    (q15_t)0x69C4, (q15_t)0x4816, (q15_t)0x17D0, (q15_t)0x7DC3, (q15_t)0xB7E9, (q15_t)0x69C4, (q15_t)0x823C, (q15_t)0x17D0,
+    (q15_t)0x698C, (q15_t)0x4869, (q15_t)0x176D, (q15_t)0x7DD6, (q15_t)0xB796, (q15_t)0x698C, (q15_t)0x8229, (q15_t)0x176D,
+    (q15_t)0x6953, (q15_t)0x48BC, (q15_t)0x170A, (q15_t)0x7DE8, (q15_t)0xB743, (q15_t)0x6953, (q15_t)0x8217, (q15_t)0x170A,
+    (q15_t)0x6919, (q15_t)0x490F, (q15_t)0x16A8, (q15_t)0x7DFA, (q15_t)0xB6F0, (q15_t)0x6919, (q15_t)0x8205, (q15_t)0x16A8,
+    (q15_t)0x68E0, (q15_t)0x4961, (q15_t)0x1645, (q15_t)0x7E0C, (q15_t)0xB69E, (q15_t)0x68E0, (q15_t)0x81F3, (q15_t)0x1645,
+    (q15_t)0x68A6, (q15_t)0x49B4, (q15_t)0x15E2, (q15_t)0x7E1D, (q15_t)0xB64B, (q15_t)0x68A6, (q15_t)0x81E2, (q15_t)0x15E2,
+    (q15_t)0x686C, (q15_t)0x4A06, (q15_t)0x157F, (q15_t)0x7E2E, (q15_t)0xB5F9, (q15_t)0x686C, (q15_t)0x81D1, (q15_t)0x157F,
+    (q15_t)0x6832, (q15_t)0x4A58, (q15_t)0x151B, (q15_t)0x7E3F, (q15_t)0xB5A7, (q15_t)0x6832, (q15_t)0x81C0, (q15_t)0x151B,
+    (q15_t)0x67F7, (q15_t)0x4AA9, (q15_t)0x14B8, (q15_t)0x7E4F, (q15_t)0xB556, (q15_t)0x67F7, (q15_t)0x81B0, (q15_t)0x14B8,
+    (q15_t)0x67BD, (q15_t)0x4AFB, (q15_t)0x1455, (q15_t)0x7E5F, (q15_t)0xB504, (q15_t)0x67BD, (q15_t)0x81A0, (q15_t)0x1455,
+    (q15_t)0x6782, (q15_t)0x4B4C, (q15_t)0x13F2, (q15_t)0x7E6F, (q15_t)0xB4B3, (q15_t)0x6782, (q15_t)0x8190, (q15_t)0x13F2,
+    (q15_t)0x6746, (q15_t)0x4B9E, (q15_t)0x138E, (q15_t)0x7E7F, (q15_t)0xB461, (q15_t)0x6746, (q15_t)0x8180, (q15_t)0x138E,
+    (q15_t)0x670B, (q15_t)0x4BEF, (q15_t)0x132B, (q15_t)0x7E8E, (q15_t)0xB410, (q15_t)0x670B, (q15_t)0x8171, (q15_t)0x132B,
+    (q15_t)0x66CF, (q15_t)0x4C3F, (q15_t)0x12C8, (q15_t)0x7E9D, (q15_t)0xB3C0, (q15_t)0x66CF, (q15_t)0x8162, (q15_t)0x12C8,
+    (q15_t)0x6693, (q15_t)0x4C90, (q15_t)0x1264, (q15_t)0x7EAB, (q15_t)0xB36F, (q15_t)0x6693, (q15_t)0x8154, (q15_t)0x1264,
+    (q15_t)0x6657, (q15_t)0x4CE1, (q15_t)0x1201, (q15_t)0x7EBA, (q15_t)0xB31E, (q15_t)0x6657, (q15_t)0x8145, (q15_t)0x1201,
+    (q15_t)0x661A, (q15_t)0x4D31, (q15_t)0x119D, (q15_t)0x7EC8, (q15_t)0xB2CE, (q15_t)0x661A, (q15_t)0x8137, (q15_t)0x119D,
+    (q15_t)0x65DD, (q15_t)0x4D81, (q15_t)0x1139, (q15_t)0x7ED5, (q15_t)0xB27E, (q15_t)0x65DD, (q15_t)0x812A, (q15_t)0x1139,
+    (q15_t)0x65A0, (q15_t)0x4DD1, (q15_t)0x10D6, (q15_t)0x7EE3, (q15_t)0xB22E, (q15_t)0x65A0, (q15_t)0x811C, (q15_t)0x10D6,
+    (q15_t)0x6563, (q15_t)0x4E21, (q15_t)0x1072, (q15_t)0x7EF0, (q15_t)0xB1DE, (q15_t)0x6563, (q15_t)0x810F, (q15_t)0x1072,
+    (q15_t)0x6526, (q15_t)0x4E70, (q15_t)0x100E, (q15_t)0x7EFD, (q15_t)0xB18F, (q15_t)0x6526, (q15_t)0x8102, (q15_t)0x100E,
+    (q15_t)0x64E8, (q15_t)0x4EBF, (q15_t)0x0FAB, (q15_t)0x7F09, (q15_t)0xB140, (q15_t)0x64E8, (q15_t)0x80F6, (q15_t)0x0FAB,
+    (q15_t)0x64AA, (q15_t)0x4F0F, (q15_t)0x0F47, (q15_t)0x7F15, (q15_t)0xB0F0, (q15_t)0x64AA, (q15_t)0x80EA, (q15_t)0x0F47,
+    (q15_t)0x646C, (q15_t)0x4F5E, (q15_t)0x0EE3, (q15_t)0x7F21, (q15_t)0xB0A1, (q15_t)0x646C, (q15_t)0x80DE, (q15_t)0x0EE3,
+    (q15_t)0x642D, (q15_t)0x4FAC, (q15_t)0x0E7F, (q15_t)0x7F2D, (q15_t)0xB053, (q15_t)0x642D, (q15_t)0x80D2, (q15_t)0x0E7F,
+    (q15_t)0x63EF, (q15_t)0x4FFB, (q15_t)0x0E1B, (q15_t)0x7F38, (q15_t)0xB004, (q15_t)0x63EF, (q15_t)0x80C7, (q15_t)0x0E1B,
+    (q15_t)0x63B0, (q15_t)0x5049, (q15_t)0x0DB7, (q15_t)0x7F43, (q15_t)0xAFB6, (q15_t)0x63B0, (q15_t)0x80BC, (q15_t)0x0DB7,
+    (q15_t)0x6371, (q15_t)0x5097, (q15_t)0x0D53, (q15_t)0x7F4D, (q15_t)0xAF68, (q15_t)0x6371, (q15_t)0x80B2, (q15_t)0x0D53,
+    (q15_t)0x6331, (q15_t)0x50E5, (q15_t)0x0CEF, (q15_t)0x7F58, (q15_t)0xAF1A, (q15_t)0x6331, (q15_t)0x80A7, (q15_t)0x0CEF,
+    (q15_t)0x62F2, (q15_t)0x5133, (q15_t)0x0C8B, (q15_t)0x7F62, (q15_t)0xAECC, (q15_t)0x62F2, (q15_t)0x809D, (q15_t)0x0C8B,
+    (q15_t)0x62B2, (q15_t)0x5181, (q15_t)0x0C27, (q15_t)0x7F6B, (q15_t)0xAE7E, (q15_t)0x62B2, (q15_t)0x8094, (q15_t)0x0C27,
+    (q15_t)0x6271, (q15_t)0x51CE, (q15_t)0x0BC3, (q15_t)0x7F75, (q15_t)0xAE31, (q15_t)0x6271, (q15_t)0x808A, (q15_t)0x0BC3,
+    (q15_t)0x6231, (q15_t)0x521C, (q15_t)0x0B5F, (q15_t)0x7F7E, (q15_t)0xADE3, (q15_t)0x6231, (q15_t)0x8081, (q15_t)0x0B5F,
+    (q15_t)0x61F1, (q15_t)0x5269, (q15_t)0x0AFB, (q15_t)0x7F87, (q15_t)0xAD96, (q15_t)0x61F1, (q15_t)0x8078, (q15_t)0x0AFB,
+    (q15_t)0x61B0, (q15_t)0x52B5, (q15_t)0x0A97, (q15_t)0x7F8F, (q15_t)0xAD4A, (q15_t)0x61B0, (q15_t)0x8070, (q15_t)0x0A97,
+    (q15_t)0x616F, (q15_t)0x5302, (q15_t)0x0A33, (q15_t)0x7F97, (q15_t)0xACFD, (q15_t)0x616F, (q15_t)0x8068, (q15_t)0x0A33,
+    (q15_t)0x612D, (q15_t)0x534E, (q15_t)0x09CE, (q15_t)0x7F9F, (q15_t)0xACB1, (q15_t)0x612D, (q15_t)0x8060, (q15_t)0x09CE,
+    (q15_t)0x60EC, (q15_t)0x539B, (q15_t)0x096A, (q15_t)0x7FA7, (q15_t)0xAC64, (q15_t)0x60EC, (q15_t)0x8058, (q15_t)0x096A,
+    (q15_t)0x60AA, (q15_t)0x53E7, (q15_t)0x0906, (q15_t)0x7FAE, (q15_t)0xAC18, (q15_t)0x60AA, (q15_t)0x8051, (q15_t)0x0906,
+    (q15_t)0x6068, (q15_t)0x5433, (q15_t)0x08A2, (q15_t)0x7FB5, (q15_t)0xABCC, (q15_t)0x6068, (q15_t)0x804A, (q15_t)0x08A2,
+    (q15_t)0x6026, (q15_t)0x547E, (q15_t)0x083D, (q15_t)0x7FBC, (q15_t)0xAB81, (q15_t)0x6026, (q15_t)0x8043, (q15_t)0x083D,
+    (q15_t)0x5FE3, (q15_t)0x54CA, (q15_t)0x07D9, (q15_t)0x7FC2, (q15_t)0xAB35, (q15_t)0x5FE3, (q15_t)0x803D, (q15_t)0x07D9,
+    (q15_t)0x5FA0, (q15_t)0x5515, (q15_t)0x0775, (q15_t)0x7FC8, (q15_t)0xAAEA, (q15_t)0x5FA0, (q15_t)0x8037, (q15_t)0x0775,
+    (q15_t)0x5F5E, (q15_t)0x5560, (q15_t)0x0710, (q15_t)0x7FCE, (q15_t)0xAA9F, (q15_t)0x5F5E, (q15_t)0x8031, (q15_t)0x0710,
+    (q15_t)0x5F1A, (q15_t)0x55AB, (q15_t)0x06AC, (q15_t)0x7FD3, (q15_t)0xAA54, (q15_t)0x5F1A, (q15_t)0x802C, (q15_t)0x06AC,
+    (q15_t)0x5ED7, (q15_t)0x55F5, (q15_t)0x0647, (q15_t)0x7FD8, (q15_t)0xAA0A, (q15_t)0x5ED7, (q15_t)0x8027, (q15_t)0x0647,
+    (q15_t)0x5E93, (q15_t)0x5640, (q15_t)0x05E3, (q15_t)0x7FDD, (q15_t)0xA9BF, (q15_t)0x5E93, (q15_t)0x8022, (q15_t)0x05E3,
+    (q15_t)0x5E50, (q15_t)0x568A, (q15_t)0x057F, (q15_t)0x7FE1, (q15_t)0xA975, (q15_t)0x5E50, (q15_t)0x801E, (q15_t)0x057F,
+    (q15_t)0x5E0B, (q15_t)0x56D4, (q15_t)0x051A, (q15_t)0x7FE5, (q15_t)0xA92B, (q15_t)0x5E0B, (q15_t)0x801A, (q15_t)0x051A,
+    (q15_t)0x5DC7, (q15_t)0x571D, (q15_t)0x04B6, (q15_t)0x7FE9, (q15_t)0xA8E2, (q15_t)0x5DC7, (q15_t)0x8016, (q15_t)0x04B6,
+    (q15_t)0x5D83, (q15_t)0x5767, (q15_t)0x0451, (q15_t)0x7FED, (q15_t)0xA898, (q15_t)0x5D83, (q15_t)0x8012, (q15_t)0x0451,
+    (q15_t)0x5D3E, (q15_t)0x57B0, (q15_t)0x03ED, (q15_t)0x7FF0, (q15_t)0xA84F, (q15_t)0x5D3E, (q15_t)0x800F, (q15_t)0x03ED,
+    (q15_t)0x5CF9, (q15_t)0x57F9, (q15_t)0x0388, (q15_t)0x7FF3, (q15_t)0xA806, (q15_t)0x5CF9, (q15_t)0x800C, (q15_t)0x0388,
+    (q15_t)0x5CB4, (q15_t)0x5842, (q15_t)0x0324, (q15_t)0x7FF6, (q15_t)0xA7BD, (q15_t)0x5CB4, (q15_t)0x8009, (q15_t)0x0324,
+    (q15_t)0x5C6E, (q15_t)0x588B, (q15_t)0x02BF, (q15_t)0x7FF8, (q15_t)0xA774, (q15_t)0x5C6E, (q15_t)0x8007, (q15_t)0x02BF,
+    (q15_t)0x5C29, (q15_t)0x58D4, (q15_t)0x025B, (q15_t)0x7FFA, (q15_t)0xA72B, (q15_t)0x5C29, (q15_t)0x8005, (q15_t)0x025B,
+    (q15_t)0x5BE3, (q15_t)0x591C, (q15_t)0x01F6, (q15_t)0x7FFC, (q15_t)0xA6E3, (q15_t)0x5BE3, (q15_t)0x8003, (q15_t)0x01F6,
+    (q15_t)0x5B9D, (q15_t)0x5964, (q15_t)0x0192, (q15_t)0x7FFD, (q15_t)0xA69B, (q15_t)0x5B9D, (q15_t)0x8002, (q15_t)0x0192,
+    (q15_t)0x5B56, (q15_t)0x59AC, (q15_t)0x012D, (q15_t)0x7FFE, (q15_t)0xA653, (q15_t)0x5B56, (q15_t)0x8001, (q15_t)0x012D,
+    (q15_t)0x5B10, (q15_t)0x59F3, (q15_t)0x00C9, (q15_t)0x7FFF, (q15_t)0xA60C, (q15_t)0x5B10, (q15_t)0x8000, (q15_t)0x00C9,
+    (q15_t)0x5AC9, (q15_t)0x5A3B, (q15_t)0x0064, (q15_t)0x7FFF, (q15_t)0xA5C4, (q15_t)0x5AC9, (q15_t)0x8000, (q15_t)0x0064
+};
+
+#endif /* RFFT_Q15_STOCKHAM */
+
+#if defined(RFFT_Q15_SPLIT_TABLES)
+
+/* ========================================================================= */
+/* Split Coefficient Tables                                                  */
+/* ========================================================================= */
+
+/*
+ * A[0], A[1], B[0], B[1] of bins 0 to n/4 of each RFFT length, derived
+ * from the shared table as arm_rfft_coef_q15() does. The bins above are
+ * mirrored, see pTwiddleBReal.
+ */
+
+/* 4096-point RFFT */
+const q15_t rfftSplitQ15_4096[4100] RFFT_Q15_ALIGN =
+{
+    (q15_t)0x4000, (q15_t)0xC000, (q15_t)0x4000, (q15_t)0x4000, (q15_t)0x3FE7, (q15_t)0xC000, (q15_t)0x4019, (q15_t)0x4000,
+    (q15_t)0x3FCE, (q15_t)0xC000, (q15_t)0x4032, (q15_t)0x4000, (q15_t)0x3FB5, (q15_t)0xC000, (q15_t)0x404B, (q15_t)0x4000,
+    (q15_t)0x3F9B, (q15_t)0xC000, (q15_t)0x4065, (q15_t)0x4000, (q15_t)0x3F82, (q15_t)0xC000, (q15_t)0x407E, (q15_t)0x4000,
+    (q15_t)0x3F69, (q15_t)0xC001, (q15_t)0x4097, (q15_t)0x3FFF, (q15_t)0x3F50, (q15_t)0xC001, (q15_t)0x40B0, (q15_t)0x3FFF,
+    (q15_t)0x3F37, (q15_t)0xC001, (q15_t)0x40C9, (q15_t)0x3FFF, (q15_t)0x3F1E, (q15_t)0xC002, (q15_t)0x40E2, (q15_t)0x3FFE,
+    (q15_t)0x3F05, (q15_t)0xC002, (q15_t)0x40FB, (q15_t)0x3FFE, (q15_t)0x3EEC, (q15_t)0xC002, (q15_t)0x4114, (q15_t)0x3FFE,
+    (q15_t)0x3ED2, (q15_t)0xC003, (q15_t)0x412E, (q15_t)0x3FFD, (q15_t)0x3EB9, (q15_t)0xC003, (q15_t)0x4147, (q15_t)0x3FFD,
+    (q15_t)0x3EA0, (q15_t)0xC004, (q15_t)0x4160, (q15_t)0x3FFC, (q15_t)0x3E87, (q15_t)0xC004, (q15_t)0x4179, (q15_t)0x3FFC,
+    (q15_t)0x3E6E, (q15_t)0xC005, (q15_t)0x4192, (q15_t)0x3FFB, (q15_t)0x3E55, (q15_t)0xC006, (q15_t)0x41AB, (q15_t)0x3FFA,
+    (q15_t)0x3E3C, (q15_t)0xC006, (q15_t)0x41C4, (q15_t)0x3FFA, (q15_t)0x3E23, (q15_t)0xC007, (q15_t)0x41DD, (q15_t)0x3FF9,
+    (q15_t)0x3E09, (q15_t)0xC008, (q15_t)0x41F7, (q15_t)0x3FF8, (q15_t)0x3DF0, (q15_t)0xC009, (q15_t)0x4210, (q15_t)0x3FF7,
+    (q15_t)0x3DD7, (q15_t)0xC009, (q15_t)0x4229, (q15_t)0x3FF7, (q15_t)0x3DBE, (q15_t)0xC00A, (q15_t)0x4242, (q15_t)0x3FF6,
+    (q15_t)0x3DA5, (q15_t)0xC00B, (q15_t)0x425B, (q15_t)0x3FF5, (q15_t)0x3D8C, (q15_t)0xC00C, (q15_t)0x4274, (q15_t)0x3FF4,
+    (q15_t)0x3D73, (q15_t)0xC00D, (q15_t)0x428D, (q15_t)0x3FF3, (q15_t)0x3D5A, (q15_t)0xC00E, (q15_t)0x42A6, (q15_t)0x3FF2,
+    (q15_t)0x3D40, (q15_t)0xC00F, (q15_t)0x42C0, (q15_t)0x3FF1, (q15_t)0x3D27, (q15_t)0xC010, (q15_t)0x42D9, (q15_t)0x3FF0,
+    (q15_t)0x3D0E, (q15_t)0xC011, (q15_t)0x42F2, (q15_t)0x3FEF, (q15_t)0x3CF5, (q15_t)0xC013, (q15_t)0x430B, (q15_t)0x3FED,
+    (q15_t)0x3CDC, (q15_t)0xC014, (q15_t)0x4324, (q15_t)0x3FEC, (q15_t)0x3CC3, (q15_t)0xC015, (q15_t)0x433D, (q15_t)0x3FEB,
+    (q15_t)0x3CAA, (q15_t)0xC016, (q15_t)0x4356, (q15_t)0x3FEA, (q15_t)0x3C91, (q15_t)0xC018, (q15_t)0x436F, (q15_t)0x3FE8,
+    (q15_t)0x3C78, (q15_t)0xC019, (q15_t)0x4388, (q15_t)0x3FE7, (q15_t)0x3C5F, (q15_t)0xC01A, (q15_t)0x43A1, (q15_t)0x3FE6,
+    (q15_t)0x3C45, (q15_t)0xC01C, (q15_t)0x43BB, (q15_t)0x3FE4, (q15_t)0x3C2C, (q15_t)0xC01D, (q15_t)0x43D4, (q15_t)0x3FE3,
+    (q15_t)0x3C13, (q15_t)0xC01F, (q15_t)0x43ED, (q15_t)0x3FE1, (q15_t)0x3BFA, (q15_t)0xC020, (q15_t)0x4406, (q15_t)0x3FE0,
+    (q15_t)0x3BE1, (q15_t)0xC022, (q15_t)0x441F, (q15_t)0x3FDE, (q15_t)0x3BC8, (q15_t)0xC024, (q15_t)0x4438, (q15_t)0x3FDC,
+    (q15_t)0x3BAF, (q15_t)0xC025, (q15_t)0x4451, (q15_t)0x3FDB, (q15_t)0x3B96, (q15_t)0xC027, (q15_t)0x446A, (q15_t)0x3FD9,
+    (q15_t)0x3B7D, (q15_t)0xC029, (q15_t)0x4483, (q15_t)0x3FD7, (q15_t)0x3B64, (q15_t)0xC02B, (q15_t)0x449C, (q15_t)0x3FD5,
+    (q15_t)0x3B4B, (q15_t)0xC02C, (q15_t)0x44B5, (q15_t)0x3FD4, (q15_t)0x3B32, (q15_t)0xC02E, (q15_t)0x44CE, (q15_t)0x3FD2,
+    (q15_t)0x3B19, (q15_t)0xC030, (q15_t)0x44E7, (q15_t)0x3FD0, (q15_t)0x3B00, (q15_t)0xC032, (q15_t)0x4500, (q15_t)0x3FCE,
+    (q15_t)0x3AE6, (q15_t)0xC034, (q15_t)0x451A, (q15_t)0x3FCC, (q15_t)0x3ACD, (q15_t)0xC036, (q15_t)0x4533, (q15_t)0x3FCA,
+    (q15_t)0x3AB4, (q15_t)0xC038, (q15_t)0x454C, (q15_t)0x3FC8, (q15_t)0x3A9B, (q15_t)0xC03A, (q15_t)0x4565, (q15_t)0x3FC6,
+    (q15_t)0x3A82, (q15_t)0xC03C, (q15_t)0x457E, (q15_t)0x3FC4, (q15_t)0x3A69, (q15_t)0xC03F, (q15_t)0x4597, (q15_t)0x3FC1,
+    (q15_t)0x3A50, (q15_t)0xC041, (q15_t)0x45B0, (q15_t)0x3FBF, (q15_t)0x3A37, (q15_t)0xC043, (q15_t)0x45C9, (q15_t)0x3FBD,
+    (q15_t)0x3A1E, (q15_t)0xC045, (q15_t)0x45E2, (q15_t)0x3FBB, (q15_t)0x3A05, (q15_t)0xC048, (q15_t)0x45FB, (q15_t)0x3FB8,
+    (q15_t)0x39EC, (q15_t)0xC04A, (q15_t)0x4614, (q15_t)0x3FB6, (q15_t)0x39D3, (q15_t)0xC04C, (q15_t)0x462D, (q15_t)0x3FB4,
+    (q15_t)0x39BA, (q15_t)0xC04F, (q15_t)0x4646, (q15_t)0x3FB1, (q15_t)0x39A1, (q15_t)0xC051, (q15_t)0x465F, (q15_t)0x3FAF,
+    (q15_t)0x3988, (q15_t)0xC054, (q15_t)0x4678, (q15_t)0x3FAC, (q15_t)0x396F, (q15_t)0xC056, (q15_t)0x4691, (q15_t)0x3FAA,
+    (q15_t)0x3956, (q15_t)0xC059, (q15_t)0x46AA, (q15_t)0x3FA7, (q15_t)0x393D, (q15_t)0xC05C, (q15_t)0x46C3, (q15_t)0x3FA4,
+    (q15_t)0x3924, (q15_t)0xC05E, (q15_t)0x46DC, (q15_t)0x3FA2, (q15_t)0x390B, (q15_t)0xC061, (q15_t)0x46F5, (q15_t)0x3F9F,
+    (q15_t)0x38F2, (q15_t)0xC064, (q15_t)0x470E, (q15_t)0x3F9C, (q15_t)0x38D9, (q15_t)0xC067, (q15_t)0x4727, (q15_t)0x3F99,
+    (q15_t)0x38C0, (q15_t)0xC069, (q15_t)0x4740, (q15_t)0x3F97, (q15_t)0x38A7, (q15_t)0xC06C, (q15_t)0x4759, (q15_t)0x3F94,
+    (q15_t)0x388E, (q15_t)0xC06F, (q15_t)0x4772, (q15_t)0x3F91, (q15_t)0x3875, (q15_t)0xC072, (q15_t)0x478B, (q15_t)0x3F8E,
+    (q15_t)0x385C, (q15_t)0xC075, (q15_t)0x47A4, (q15_t)0x3F8B, (q15_t)0x3843, (q15_t)0xC078, (q15_t)0x47BD, (q15_t)0x3F88,
+    (q15_t)0x382A, (q15_t)0xC07B, (q15_t)0x47D6, (q15_t)0x3F85, (q15_t)0x3811, (q15_t)0xC07E, (q15_t)0x47EF, (q15_t)0x3F82,
+    (q15_t)0x37F9, (q15_t)0xC081, (q15_t)0x4807, (q15_t)0x3F7F, (q15_t)0x37E0, (q15_t)0xC085, (q15_t)0x4820, (q15_t)0x3F7B,
+    (q15_t)0x37C7, (q15_t)0xC088, (q15_t)0x4839, (q15_t)0x3F78, (q15_t)0x37AE, (q15_t)0xC08B, (q15_t)0x4852, (q15_t)0x3F75,
+    (q15_t)0x3795, (q15_t)0xC08E, (q15_t)0x486B, (q15_t)0x3F72, (q15_t)0x377C, (q15_t)0xC092, (q15_t)0x4884, (q15_t)0x3F6E,
+    (q15_t)0x3763, (q15_t)0xC095, (q15_t)0x489D, (q15_t)0x3F6B, (q15_t)0x374A, (q15_t)0xC098, (q15_t)0x48B6, (q15_t)0x3F68,
+    (q15_t)0x3731, (q15_t)0xC09C, (q15_t)0x48CF, (q15_t)0x3F64, (q15_t)0x3718, (q15_t)0xC09F, (q15_t)0x48E8, (q15_t)0x3F61,
+    (q15_t)0x36FF, (q15_t)0xC0A3, (q15_t)0x4901, (q15_t)0x3F5D, (q15_t)0x36E7, (q15_t)0xC0A6, (q15_t)0x4919, (q15_t)0x3F5A,
+    (q15_t)0x36CE, (q15_t)0xC0AA, (q15_t)0x4932, (q15_t)0x3F56, (q15_t)0x36B5, (q15_t)0xC0AE, (q15_t)0x494B, (q15_t)0x3F52,
+    (q15_t)0x369C, (q15_t)0xC0B1, (q15_t)0x4964, (q15_t)0x3F4F, (q15_t)0x3683, (q15_t)0xC0B5, (q15_t)0x497D, (q15_t)0x3F4B,
+    (q15_t)0x366A, (q15_t)0xC0B9, (q15_t)0x4996, (q15_t)0x3F47, (q15_t)0x3651, (q15_t)0xC0BD, (q15_t)0x49AF, (q15_t)0x3F43,
+    (q15_t)0x3639, (q15_t)0xC0C0, (q15_t)0x49C7, (q15_t)0x3F40, (q15_t)0x3620, (q15_t)0xC0C4, (q15_t)0x49E0, (q15_t)0x3F3C,
+    (q15_t)0x3607, (q15_t)0xC0C8, (q15_t)0x49F9, (q15_t)0x3F38, (q15_t)0x35EE, (q15_t)0xC0CC, (q15_t)0x4A12, (q15_t)0x3F34,
+    (q15_t)0x35D5, (q15_t)0xC0D0, (q15_t)0x4A2B, (q15_t)0x3F30, (q15_t)0x35BC, (q15_t)0xC0D4, (q15_t)0x4A44, (q15_t)0x3F2C,
+    (q15_t)0x35A4, (q15_t)0xC0D8, (q15_t)0x4A5C, (q15_t)0x3F28, (q15_t)0x358B, (q15_t)0xC0DC, (q15_t)0x4A75, (q15_t)0x3F24,
+    (q15_t)0x3572, (q15_t)0xC0E0, (q15_t)0x4A8E, (q15_t)0x3F20, (q15_t)0x3559, (q15_t)0xC0E4, (q15_t)0x4AA7, (q15_t)0x3F1C,
+    (q15_t)0x3540, (q15_t)0xC0E9, (q15_t)0x4AC0, (q15_t)0x3F17, (q15_t)0x3528, (q15_t)0xC0ED, (q15_t)0x4AD8, (q15_t)0x3F13,
+    (q15_t)0x350F, (q15_t)0xC0F1, (q15_t)0x4AF1, (q15_t)0x3F0F, (q15_t)0x34F6, (q15_t)0xC0F6, (q15_t)0x4B0A, (q15_t)0x3F0A,
+    (q15_t)0x34DD, (q15_t)0xC0FA, (q15_t)0x4B23, (q15_t)0x3F06, (q15_t)0x34C5, (q15_t)0xC0FE, (q15_t)0x4B3B, (q15_t)0x3F02,
+    (q15_t)0x34AC, (q15_t)0xC103, (q15_t)0x4B54, (q15_t)0x3EFD, (q15_t)0x3493, (q15_t)0xC107, (q15_t)0x4B6D, (q15_t)0x3EF9,
+    (q15_t)0x347B, (q15_t)0xC10C, (q15_t)0x4B85, (q15_t)0x3EF4, (q15_t)0x3462, (q15_t)0xC110, (q15_t)0x4B9E, (q15_t)0x3EF0,
+    (q15_t)0x3449, (q15_t)0xC115, (q15_t)0x4BB7, (q15_t)0x3EEB, (q15_t)0x3430, (q15_t)0xC119, (q15_t)0x4BD0, (q15_t)0x3EE7,
+    (q15_t)0x3418, (q15_t)0xC11E, (q15_t)0x4BE8, (q15_t)0x3EE2, (q15_t)0x33FF, (q15_t)0xC123, (q15_t)0x4C01, (q15_t)0x3EDD,
+    (q15_t)0x33E6, (q15_t)0xC128, (q15_t)0x4C1A, (q15_t)0x3ED8, (q15_t)0x33CE, (q15_t)0xC12C, (q15_t)0x4C32, (q15_t)0x3ED4,
+    (q15_t)0x33B5, (q15_t)0xC131, (q15_t)0x4C4B, (q15_t)0x3ECF, (q15_t)0x339C, (q15_t)0xC136, (q15_t)0x4C64, (q15_t)0x3ECA,
+    (q15_t)0x3384, (q15_t)0xC13B, (q15_t)0x4C7C, (q15_t)0x3EC5, (q15_t)0x336B, (q15_t)0xC140, (q15_t)0x4C95, (q15_t)0x3EC0,
+    (q15_t)0x3352, (q15_t)0xC145, (q15_t)0x4CAE, (q15_t)0x3EBB, (q15_t)0x333A, (q15_t)0xC14A, (q15_t)0x4CC6, (q15_t)0x3EB6,
+    (q15_t)0x3321, (q15_t)0xC14F, (q15_t)0x4CDF, (q15_t)0x3EB1, (q15_t)0x3308, (q15_t)0xC154, (q15_t)0x4CF8, (q15_t)0x3EAC,
+    (q15_t)0x32F0, (q15_t)0xC159, (q15_t)0x4D10, (q15_t)0x3EA7, (q15_t)0x32D7, (q15_t)0xC15E, (q15_t)0x4D29, (q15_t)0x3EA2,
+    (q15_t)0x32BF, (q15_t)0xC163, (q15_t)0x4D41, (q15_t)0x3E9D, (q15_t)0x32A6, (q15_t)0xC168, (q15_t)0x4D5A, (q15_t)0x3E98,
+    (q15_t)0x328E, (q15_t)0xC16E, (q15_t)0x4D72, (q15_t)0x3E92, (q15_t)0x3275, (q15_t)0xC173, (q15_t)0x4D8B, (q15_t)0x3E8D,
+    (q15_t)0x325C, (q15_t)0xC178, (q15_t)0x4DA4, (q15_t)0x3E88, (q15_t)0x3244, (q15_t)0xC17E, (q15_t)0x4DBC, (q15_t)0x3E82,
+    (q15_t)0x322B, (q15_t)0xC183, (q15_t)0x4DD5, (q15_t)0x3E7D, (q15_t)0x3213, (q15_t)0xC189, (q15_t)0x4DED, (q15_t)0x3E77,
+    (q15_t)0x31FA, (q15_t)0xC18E, (q15_t)0x4E06, (q15_t)0x3E72, (q15_t)0x31E2, (q15_t)0xC194, (q15_t)0x4E1E, (q15_t)0x3E6C,
+    (q15_t)0x31C9, (q15_t)0xC199, (q15_t)0x4E37, (q15_t)0x3E67, (q15_t)0x31B1, (q15_t)0xC19F, (q15_t)0x4E4F, (q15_t)0x3E61,
+    (q15_t)0x3198, (q15_t)0xC1A4, (q15_t)0x4E68, (q15_t)0x3E5C, (q15_t)0x3180, (q15_t)0xC1AA, (q15_t)0x4E80, (q15_t)0x3E56,
+    (q15_t)0x3167, (q15_t)0xC1B0, (q15_t)0x4E99, (q15_t)0x3E50, (q15_t)0x314F, (q15_t)0xC1B6, (q15_t)0x4EB1, (q15_t)0x3E4A,
+    (q15_t)0x3136, (q15_t)0xC1BB, (q15_t)0x4ECA, (q15_t)0x3E45, (q15_t)0x311E, (q15_t)0xC1C1, (q15_t)0x4EE2, (q15_t)0x3E3F,
+    (q15_t)0x3105, (q15_t)0xC1C7, (q15_t)0x4EFB, (q15_t)0x3E39, (q15_t)0x30ED, (q15_t)0xC1CD, (q15_t)0x4F13, (q15_t)0x3E33,
+    (q15_t)0x30D5, (q15_t)0xC1D3, (q15_t)0x4F2B, (q15_t)0x3E2D, (q15_t)0x30BC, (q15_t)0xC1D9, (q15_t)0x4F44, (q15_t)0x3E27,
+    (q15_t)0x30A4, (q15_t)0xC1DF, (q15_t)0x4F5C, (q15_t)0x3E21, (q15_t)0x308B, (q15_t)0xC1E5, (q15_t)0x4F75, (q15_t)0x3E1B,
+    (q15_t)0x3073, (q15_t)0xC1EB, (q15_t)0x4F8D, (q15_t)0x3E15, (q15_t)0x305B, (q15_t)0xC1F1, (q15_t)0x4FA5, (q15_t)0x3E0F,
+    (q15_t)0x3042, (q15_t)0xC1F7, (q15_t)0x4FBE, (q15_t)0x3E09, (q15_t)0x302A, (q15_t)0xC1FD, (q15_t)0x4FD6, (q15_t)0x3E03,
+    (q15_t)0x3012, (q15_t)0xC204, (q15_t)0x4FEE, (q15_t)0x3DFC, (q15_t)0x2FF9, (q15_t)0xC20A, (q15_t)0x5007, (q15_t)0x3DF6,
+    (q15_t)0x2FE1, (q15_t)0xC210, (q15_t)0x501F, (q15_t)0x3DF0, (q15_t)0x2FC9, (q15_t)0xC217, (q15_t)0x5037, (q15_t)0x3DE9,
+    (q15_t)0x2FB0, (q15_t)0xC21D, (q15_t)0x5050, (q15_t)0x3DE3, (q15_t)0x2F98, (q15_t)0xC223, (q15_t)0x5068, (q15_t)0x3DDD,
+    (q15_t)0x2F80, (q15_t)0xC22A, (q15_t)0x5080, (q15_t)0x3DD6, (q15_t)0x2F67, (q15_t)0xC230, (q15_t)0x5099, (q15_t)0x3DD0,
+    (q15_t)0x2F4F, (q15_t)0xC237, (q15_t)0x50B1, (q15_t)0x3DC9, (q15_t)0x2F37, (q15_t)0xC23E, (q15_t)0x50C9, (q15_t)0x3DC2,
+    (q15_t)0x2F1F, (q15_t)0xC244, (q15_t)0x50E1, (q15_t)0x3DBC, (q15_t)0x2F06, (q15_t)0xC24B, (q15_t)0x50FA, (q15_t)0x3DB5,
+    (q15_t)0x2EEE, (q15_t)0xC251, (q15_t)0x5112, (q15_t)0x3DAF, (q15_t)0x2ED6, (q15_t)0xC258, (q15_t)0x512A, (q15_t)0x3DA8,
+    (q15_t)0x2EBE, (q15_t)0xC25F, (q15_t)0x5142, (q15_t)0x3DA1, (q15_t)0x2EA6, (q15_t)0xC266, (q15_t)0x515A, (q15_t)0x3D9A,
+    (q15_t)0x2E8D, (q15_t)0xC26D, (q15_t)0x5173, (q15_t)0x3D93, (q15_t)0x2E75, (q15_t)0xC273, (q15_t)0x518B, (q15_t)0x3D8D,
+    (q15_t)0x2E5D, (q15_t)0xC27A, (q15_t)0x51A3, (q15_t)0x3D86, (q15_t)0x2E45, (q15_t)0xC281, (q15_t)0x51BB, (q15_t)0x3D7F,
+    (q15_t)0x2E2D, (q15_t)0xC288, (q15_t)0x51D3, (q15_t)0x3D78, (q15_t)0x2E15, (q15_t)0xC28F, (q15_t)0x51EB, (q15_t)0x3D71,
+    (q15_t)0x2DFC, (q15_t)0xC296, (q15_t)0x5204, (q15_t)0x3D6A, (q15_t)0x2DE4, (q15_t)0xC29D, (q15_t)0x521C, (q15_t)0x3D63,
+    (q15_t)0x2DCC, (q15_t)0xC2A5, (q15_t)0x5234, (q15_t)0x3D5B, (q15_t)0x2DB4, (q15_t)0xC2AC, (q15_t)0x524C, (q15_t)0x3D54,
+    (q15_t)0x2D9C, (q15_t)0xC2B3, (q15_t)0x5264, (q15_t)0x3D4D, (q15_t)0x2D84, (q15_t)0xC2BA, (q15_t)0x527C, (q15_t)0x3D46,
+    (q15_t)0x2D6C, (q15_t)0xC2C1, (q15_t)0x5294, (q15_t)0x3D3F, (q15_t)0x2D54, (q15_t)0xC2C9, (q15_t)0x52AC, (q15_t)0x3D37,
+    (q15_t)0x2D3C, (q15_t)0xC2D0, (q15_t)0x52C4, (q15_t)0x3D30, (q15_t)0x2D24, (q15_t)0xC2D8, (q15_t)0x52DC, (q15_t)0x3D28,
+    (q15_t)0x2D0C, (q15_t)0xC2DF, (q15_t)0x52F4, (q15_t)0x3D21, (q15_t)0x2CF4, (q15_t)0xC2E6, (q15_t)0x530C, (q15_t)0x3D1A,
+    (q15_t)0x2CDC, (q15_t)0xC2EE, (q15_t)0x5324, (q15_t)0x3D12, (q15_t)0x2CC4, (q15_t)0xC2F5, (q15_t)0x533C, (q15_t)0x3D0B,
+    (q15_t)0x2CAC, (q15_t)0xC2FD, (q15_t)0x5354, (q15_t)0x3D03, (q15_t)0x2C94, (q15_t)0xC305, (q15_t)0x536C, (q15_t)0x3CFB,
+    (q15_t)0x2C7C, (q15_t)0xC30C, (q15_t)0x5384, (q15_t)0x3CF4, (q15_t)0x2C64, (q15_t)0xC314, (q15_t)0x539C, (q15_t)0x3CEC,
+    (q15_t)0x2C4C, (q15_t)0xC31C, (q15_t)0x53B4, (q15_t)0x3CE4, (q15_t)0x2C34, (q15_t)0xC323, (q15_t)0x53CC, (q15_t)0x3CDD,
+    (q15_t)0x2C1C, (q15_t)0xC32B, (q15_t)0x53E4, (q15_t)0x3CD5, (q15_t)0x2C05, (q15_t)0xC333, (q15_t)0x53FB, (q15_t)0x3CCD,
+    (q15_t)0x2BED, (q15_t)0xC33B, (q15_t)0x5413, (q15_t)0x3CC5, (q15_t)0x2BD5, (q15_t)0xC343, (q15_t)0x542B, (q15_t)0x3CBD,
+    (q15_t)0x2BBD, (q15_t)0xC34B, (q15_t)0x5443, (q15_t)0x3CB5, (q15_t)0x2BA5, (q15_t)0xC353, (q15_t)0x545B, (q15_t)0x3CAD,
+    (q15_t)0x2B8D, (q15_t)0xC35B, (q15_t)0x5473, (q15_t)0x3CA5, (q15_t)0x2B75, (q15_t)0xC363, (q15_t)0x548B, (q15_t)0x3C9D,
+    (q15_t)0x2B5E, (q15_t)0xC36B, (q15_t)0x54A2, (q15_t)0x3C95, (q15_t)0x2B46, (q15_t)0xC373, (q15_t)0x54BA, (q15_t)0x3C8D,
+    (q15_t)0x2B2E, (q15_t)0xC37B, (q15_t)0x54D2, (q15_t)0x3C85, (q15_t)0x2B16, (q15_t)0xC383, (q15_t)0x54EA, (q15_t)0x3C7D,
+    (q15_t)0x2AFF, (q15_t)0xC38C, (q15_t)0x5501, (q15_t)0x3C74, (q15_t)0x2AE7, (q15_t)0xC394, (q15_t)0x5519, (q15_t)0x3C6C,
+    (q15_t)0x2ACF, (q15_t)0xC39C, (q15_t)0x5531, (q15_t)0x3C64, (q15_t)0x2AB7, (q15_t)0xC3A5, (q15_t)0x5549, (q15_t)0x3C5B,
+    (q15_t)0x2AA0, (q15_t)0xC3AD, (q15_t)0x5560, (q15_t)0x3C53, (q15_t)0x2A88, (q15_t)0xC3B5, (q15_t)0x5578, (q15_t)0x3C4B,
+    (q15_t)0x2A70, (q15_t)0xC3BE, (q15_t)0x5590, (q15_t)0x3C42, (q15_t)0x2A59, (q15_t)0xC3C6, (q15_t)0x55A7, (q15_t)0x3C3A,
+    (q15_t)0x2A41, (q15_t)0xC3CF, (q15_t)0x55BF, (q15_t)0x3C31, (q15_t)0x2A29, (q15_t)0xC3D7, (q15_t)0x55D7, (q15_t)0x3C29,
+    (q15_t)0x2A12, (q15_t)0xC3E0, (q15_t)0x55EE, (q15_t)0x3C20, (q15_t)0x29FA, (q15_t)0xC3E9, (q15_t)0x5606, (q15_t)0x3C17,
+    (q15_t)0x29E3, (q15_t)0xC3F1, (q15_t)0x561D, (q15_t)0x3C0F, (q15_t)0x29CB, (q15_t)0xC3FA, (q15_t)0x5635, (q15_t)0x3C06,
+    (q15_t)0x29B4, (q15_t)0xC403, (q15_t)0x564C, (q15_t)0x3BFD, (q15_t)0x299C, (q15_t)0xC40B, (q15_t)0x5664, (q15_t)0x3BF5,
+    (q15_t)0x2984, (q15_t)0xC414, (q15_t)0x567C, (q15_t)0x3BEC, (q15_t)0x296D, (q15_t)0xC41D, (q15_t)0x5693, (q15_t)0x3BE3,
+    (q15_t)0x2955, (q15_t)0xC426, (q15_t)0x56AB, (q15_t)0x3BDA, (q15_t)0x293E, (q15_t)0xC42F, (q15_t)0x56C2, (q15_t)0x3BD1,
+    (q15_t)0x2926, (q15_t)0xC438, (q15_t)0x56DA, (q15_t)0x3BC8, (q15_t)0x290F, (q15_t)0xC441, (q15_t)0x56F1, (q15_t)0x3BBF,
+    (q15_t)0x28F7, (q15_t)0xC44A, (q15_t)0x5709, (q15_t)0x3BB6, (q15_t)0x28E0, (q15_t)0xC453, (q15_t)0x5720, (q15_t)0x3BAD,
+    (q15_t)0x28C9, (q15_t)0xC45C, (q15_t)0x5737, (q15_t)0x3BA4, (q15_t)0x28B1, (q15_t)0xC465, (q15_t)0x574F, (q15_t)0x3B9B,
+    (q15_t)0x289A, (q15_t)0xC46E, (q15_t)0x5766, (q15_t)0x3B92, (q15_t)0x2882, (q15_t)0xC478, (q15_t)0x577E, (q15_t)0x3B88,
+    (q15_t)0x286B, (q15_t)0xC481, (q15_t)0x5795, (q15_t)0x3B7F, (q15_t)0x2854, (q15_t)0xC48A, (q15_t)0x57AC, (q15_t)0x3B76,
+    (q15_t)0x283C, (q15_t)0xC493, (q15_t)0x57C4, (q15_t)0x3B6D, (q15_t)0x2825, (q15_t)0xC49D, (q15_t)0x57DB, (q15_t)0x3B63,
+    (q15_t)0x280E, (q15_t)0xC4A6, (q15_t)0x57F2, (q15_t)0x3B5A, (q15_t)0x27F6, (q15_t)0xC4B0, (q15_t)0x580A, (q15_t)0x3B50,
+    (q15_t)0x27DF, (q15_t)0xC4B9, (q15_t)0x5821, (q15_t)0x3B47, (q15_t)0x27C8, (q15_t)0xC4C2, (q15_t)0x5838, (q15_t)0x3B3E,
+    (q15_t)0x27B1, (q15_t)0xC4CC, (q15_t)0x584F, (q15_t)0x3B34, (q15_t)0x2799, (q15_t)0xC4D6, (q15_t)0x5867, (q15_t)0x3B2A,
+    (q15_t)0x2782, (q15_t)0xC4DF, (q15_t)0x587E, (q15_t)0x3B21, (q15_t)0x276B, (q15_t)0xC4E9, (q15_t)0x5895, (q15_t)0x3B17,
+    (q15_t)0x2754, (q15_t)0xC4F2, (q15_t)0x58AC, (q15_t)0x3B0E, (q15_t)0x273D, (q15_t)0xC4FC, (q15_t)0x58C3, (q15_t)0x3B04,
+    (q15_t)0x2725, (q15_t)0xC506, (q15_t)0x58DB, (q15_t)0x3AFA, (q15_t)0x270E, (q15_t)0xC510, (q15_t)0x58F2, (q15_t)0x3AF0,
+    (q15_t)0x26F7, (q15_t)0xC51A, (q15_t)0x5909, (q15_t)0x3AE6, (q15_t)0x26E0, (q15_t)0xC523, (q15_t)0x5920, (q15_t)0x3ADD,
+    (q15_t)0x26C9, (q15_t)0xC52D, (q15_t)0x5937, (q15_t)0x3AD3, (q15_t)0x26B2, (q15_t)0xC537, (q15_t)0x594E, (q15_t)0x3AC9,
+    (q15_t)0x269B, (q15_t)0xC541, (q15_t)0x5965, (q15_t)0x3ABF, (q15_t)0x2684, (q15_t)0xC54B, (q15_t)0x597C, (q15_t)0x3AB5,
+    (q15_t)0x266D, (q15_t)0xC555, (q15_t)0x5993, (q15_t)0x3AAB, (q15_t)0x2656, (q15_t)0xC55F, (q15_t)0x59AA, (q15_t)0x3AA1,
+    (q15_t)0x263F, (q15_t)0xC569, (q15_t)0x59C1, (q15_t)0x3A97, (q15_t)0x2628, (q15_t)0xC573, (q15_t)0x59D8, (q15_t)0x3A8D,
+    (q15_t)0x2611, (q15_t)0xC57E, (q15_t)0x59EF, (q15_t)0x3A82, (q15_t)0x25FA, (q15_t)0xC588, (q15_t)0x5A06, (q15_t)0x3A78,
+    (q15_t)0x25E3, (q15_t)0xC592, (q15_t)0x5A1D, (q15_t)0x3A6E, (q15_t)0x25CC, (q15_t)0xC59C, (q15_t)0x5A34, (q15_t)0x3A64,
+    (q15_t)0x25B5, (q15_t)0xC5A7, (q15_t)0x5A4B, (q15_t)0x3A59, (q15_t)0x259E, (q15_t)0xC5B1, (q15_t)0x5A62, (q15_t)0x3A4F,
+    (q15_t)0x2587, (q15_t)0xC5BB, (q15_t)0x5A79, (q15_t)0x3A45, (q15_t)0x2570, (q15_t)0xC5C6, (q15_t)0x5A90, (q15_t)0x3A3A,
+    (q15_t)0x2559, (q15_t)0xC5D0, (q15_t)0x5AA7, (q15_t)0x3A30, (q15_t)0x2542, (q15_t)0xC5DB, (q15_t)0x5ABE, (q15_t)0x3A25,
+    (q15_t)0x252C, (q15_t)0xC5E5, (q15_t)0x5AD4, (q15_t)0x3A1B, (q15_t)0x2515, (q15_t)0xC5F0, (q15_t)0x5AEB, (q15_t)0x3A10,
+    (q15_t)0x24FE, (q15_t)0xC5FA, (q15_t)0x5B02, (q15_t)0x3A06, (q15_t)0x24E7, (q15_t)0xC605, (q15_t)0x5B19, (q15_t)0x39FB,
+    (q15_t)0x24D0, (q15_t)0xC610, (q15_t)0x5B30, (q15_t)0x39F0, (q15_t)0x24BA, (q15_t)0xC61A, (q15_t)0x5B46, (q15_t)0x39E6,
+    (q15_t)0x24A3, (q15_t)0xC625, (q15_t)0x5B5D, (q15_t)0x39DB, (q15_t)0x248C, (q15_t)0xC630, (q15_t)0x5B74, (q15_t)0x39D0,
+    (q15_t)0x2476, (q15_t)0xC63B, (q15_t)0x5B8A, (q15_t)0x39C5, (q15_t)0x245F, (q15_t)0xC645, (q15_t)0x5BA1, (q15_t)0x39BB,
+    (q15_t)0x2448, (q15_t)0xC650, (q15_t)0x5BB8, (q15_t)0x39B0, (q15_t)0x2432, (q15_t)0xC65B, (q15_t)0x5BCE, (q15_t)0x39A5,
+    (q15_t)0x241B, (q15_t)0xC666, (q15_t)0x5BE5, (q15_t)0x399A, (q15_t)0x2404, (q15_t)0xC671, (q15_t)0x5BFC, (q15_t)0x398F,
+    (q15_t)0x23EE, (q15_t)0xC67C, (q15_t)0x5C12, (q15_t)0x3984, (q15_t)0x23D7, (q15_t)0xC687, (q15_t)0x5C29, (q15_t)0x3979,
+    (q15_t)0x23C1, (q15_t)0xC692, (q15_t)0x5C3F, (q15_t)0x396E, (q15_t)0x23AA, (q15_t)0xC69D, (q15_t)0x5C56, (q15_t)0x3963,
+    (q15_t)0x2394, (q15_t)0xC6A8, (q15_t)0x5C6C, (q15_t)0x3958, (q15_t)0x237D, (q15_t)0xC6B4, (q15_t)0x5C83, (q15_t)0x394C,
+    (q15_t)0x2367, (q15_t)0xC6BF, (q15_t)0x5C99, (q15_t)0x3941, (q15_t)0x2350, (q15_t)0xC6CA, (q15_t)0x5CB0, (q15_t)0x3936,
+    (q15_t)0x233A, (q15_t)0xC6D5, (q15_t)0x5CC6, (q15_t)0x392B, (q15_t)0x2323, (q15_t)0xC6E1, (q15_t)0x5CDD, (q15_t)0x391F,
+    (q15_t)0x230D, (q15_t)0xC6EC, (q15_t)0x5CF3, (q15_t)0x3914, (q15_t)0x22F6, (q15_t)0xC6F7, (q15_t)0x5D0A, (q15_t)0x3909,
+    (q15_t)0x22E0, (q15_t)0xC703, (q15_t)0x5D20, (q15_t)0x38FD, (q15_t)0x22CA, (q15_t)0xC70E, (q15_t)0x5D36, (q15_t)0x38F2,
+    (q15_t)0x22B3, (q15_t)0xC71A, (q15_t)0x5D4D, (q15_t)0x38E6, (q15_t)0x229D, (q15_t)0xC725, (q15_t)0x5D63, (q15_t)0x38DB,
+    (q15_t)0x2287, (q15_t)0xC731, (q15_t)0x5D79, (q15_t)0x38CF, (q15_t)0x2270, (q15_t)0xC73D, (q15_t)0x5D90, (q15_t)0x38C3,
+    (q15_t)0x225A, (q15_t)0xC748, (q15_t)0x5DA6, (q15_t)0x38B8, (q15_t)0x2244, (q15_t)0xC754, (q15_t)0x5DBC, (q15_t)0x38AC,
+    (q15_t)0x222D, (q15_t)0xC75F, (q15_t)0x5DD3, (q15_t)0x38A1, (q15_t)0x2217, (q15_t)0xC76B, (q15_t)0x5DE9, (q15_t)0x3895,
+    (q15_t)0x2201, (q15_t)0xC777, (q15_t)0x5DFF, (q15_t)0x3889, (q15_t)0x21EB, (q15_t)0xC783, (q15_t)0x5E15, (q15_t)0x387D,
+    (q15_t)0x21D5, (q15_t)0xC78F, (q15_t)0x5E2B, (q15_t)0x3871, (q15_t)0x21BE, (q15_t)0xC79A, (q15_t)0x5E42, (q15_t)0x3866,
+    (q15_t)0x21A8, (q15_t)0xC7A6, (q15_t)0x5E58, (q15_t)0x385A, (q15_t)0x2192, (q15_t)0xC7B2, (q15_t)0x5E6E, (q15_t)0x384E,
+    (q15_t)0x217C, (q15_t)0xC7BE, (q15_t)0x5E84, (q15_t)0x3842, (q15_t)0x2166, (q15_t)0xC7CA, (q15_t)0x5E9A, (q15_t)0x3836,
+    (q15_t)0x2150, (q15_t)0xC7D6, (q15_t)0x5EB0, (q15_t)0x382A, (q15_t)0x213A, (q15_t)0xC7E2, (q15_t)0x5EC6, (q15_t)0x381E,
+    (q15_t)0x2124, (q15_t)0xC7EE, (q15_t)0x5EDC, (q15_t)0x3812, (q15_t)0x210E, (q15_t)0xC7FB, (q15_t)0x5EF2, (q15_t)0x3805,
+    (q15_t)0x20F8, (q15_t)0xC807, (q15_t)0x5F08, (q15_t)0x37F9, (q15_t)0x20E2, (q15_t)0xC813, (q15_t)0x5F1E, (q15_t)0x37ED,
+    (q15_t)0x20CC, (q15_t)0xC81F, (q15_t)0x5F34, (q15_t)0x37E1, (q15_t)0x20B6, (q15_t)0xC82B, (q15_t)0x5F4A, (q15_t)0x37D5,
+    (q15_t)0x20A0, (q15_t)0xC838, (q15_t)0x5F60, (q15_t)0x37C8, (q15_t)0x208A, (q15_t)0xC844, (q15_t)0x5F76, (q15_t)0x37BC,
+    (q15_t)0x2074, (q15_t)0xC850, (q15_t)0x5F8C, (q15_t)0x37B0, (q15_t)0x205E, (q15_t)0xC85D, (q15_t)0x5FA2, (q15_t)0x37A3,
+    (q15_t)0x2049, (q15_t)0xC869, (q15_t)0x5FB7, (q15_t)0x3797, (q15_t)0x2033, (q15_t)0xC876, (q15_t)0x5FCD, (q15_t)0x378A,
+    (q15_t)0x201D, (q15_t)0xC882, (q15_t)0x5FE3, (q15_t)0x377E, (q15_t)0x2007, (q15_t)0xC88F, (q15_t)0x5FF9, (q15_t)0x3771,
+    (q15_t)0x1FF1, (q15_t)0xC89B, (q15_t)0x600F, (q15_t)0x3765, (q15_t)0x1FDC, (q15_t)0xC8A8, (q15_t)0x6024, (q15_t)0x3758,
+    (q15_t)0x1FC6, (q15_t)0xC8B5, (q15_t)0x603A, (q15_t)0x374B, (q15_t)0x1FB0, (q15_t)0xC8C1, (q15_t)0x6050, (q15_t)0x373F,
+    (q15_t)0x1F9B, (q15_t)0xC8CE, (q15_t)0x6065, (q15_t)0x3732, (q15_t)0x1F85, (q15_t)0xC8DB, (q15_t)0x607B, (q15_t)0x3725,
+    (q15_t)0x1F6F, (q15_t)0xC8E8, (q15_t)0x6091, (q15_t)0x3718, (q15_t)0x1F5A, (q15_t)0xC8F4, (q15_t)0x60A6, (q15_t)0x370C,
+    (q15_t)0x1F44, (q15_t)0xC901, (q15_t)0x60BC, (q15_t)0x36FF, (q15_t)0x1F2F, (q15_t)0xC90E, (q15_t)0x60D1, (q15_t)0x36F2,
+    (q15_t)0x1F19, (q15_t)0xC91B, (q15_t)0x60E7, (q15_t)0x36E5, (q15_t)0x1F03, (q15_t)0xC928, (q15_t)0x60FD, (q15_t)0x36D8,
+    (q15_t)0x1EEE, (q15_t)0xC935, (q15_t)0x6112, (q15_t)0x36CB, (q15_t)0x1ED8, (q15_t)0xC942, (q15_t)0x6128, (q15_t)0x36BE,
+    (q15_t)0x1EC3, (q15_t)0xC94F, (q15_t)0x613D, (q15_t)0x36B1, (q15_t)0x1EAD, (q15_t)0xC95C, (q15_t)0x6153, (q15_t)0x36A4,
+    (q15_t)0x1E98, (q15_t)0xC969, (q15_t)0x6168, (q15_t)0x3697, (q15_t)0x1E83, (q15_t)0xC976, (q15_t)0x617D, (q15_t)0x368A,
+    (q15_t)0x1E6D, (q15_t)0xC983, (q15_t)0x6193, (q15_t)0x367D, (q15_t)0x1E58, (q15_t)0xC991, (q15_t)0x61A8, (q15_t)0x366F,
+    (q15_t)0x1E42, (q15_t)0xC99E, (q15_t)0x61BE, (q15_t)0x3662, (q15_t)0x1E2D, (q15_t)0xC9AB, (q15_t)0x61D3, (q15_t)0x3655,
+    (q15_t)0x1E18, (q15_t)0xC9B8, (q15_t)0x61E8, (q15_t)0x3648, (q15_t)0x1E02, (q15_t)0xC9C6, (q15_t)0x61FE, (q15_t)0x363A,
+    (q15_t)0x1DED, (q15_t)0xC9D3, (q15_t)0x6213, (q15_t)0x362D, (q15_t)0x1DD8, (q15_t)0xC9E0, (q15_t)0x6228, (q15_t)0x3620,
+    (q15_t)0x1DC3, (q15_t)0xC9EE, (q15_t)0x623D, (q15_t)0x3612, (q15_t)0x1DAD, (q15_t)0xC9FB, (q15_t)0x6253, (q15_t)0x3605,
+    (q15_t)0x1D98, (q15_t)0xCA09, (q15_t)0x6268, (q15_t)0x35F7, (q15_t)0x1D83, (q15_t)0xCA16, (q15_t)0x627D, (q15_t)0x35EA,
+    (q15_t)0x1D6E, (q15_t)0xCA24, (q15_t)0x6292, (q15_t)0x35DC, (q15_t)0x1D59, (q15_t)0xCA32, (q15_t)0x62A7, (q15_t)0x35CE,
+    (q15_t)0x1D44, (q15_t)0xCA3F, (q15_t)0x62BC, (q15_t)0x35C1, (q15_t)0x1D2E, (q15_t)0xCA4D, (q15_t)0x62D2, (q15_t)0x35B3,
+    (q15_t)0x1D19, (q15_t)0xCA5B, (q15_t)0x62E7, (q15_t)0x35A5, (q15_t)0x1D04, (q15_t)0xCA68, (q15_t)0x62FC, (q15_t)0x3598,
+    (q15_t)0x1CEF, (q15_t)0xCA76, (q15_t)0x6311, (q15_t)0x358A, (q15_t)0x1CDA, (q15_t)0xCA84, (q15_t)0x6326, (q15_t)0x357C,
+    (q15_t)0x1CC5, (q15_t)0xCA92, (q15_t)0x633B, (q15_t)0x356E, (q15_t)0x1CB0, (q15_t)0xCA9F, (q15_t)0x6350, (q15_t)0x3561,
+    (q15_t)0x1C9B, (q15_t)0xCAAD, (q15_t)0x6365, (q15_t)0x3553, (q15_t)0x1C86, (q15_t)0xCABB, (q15_t)0x637A, (q15_t)0x3545,
+    (q15_t)0x1C72, (q15_t)0xCAC9, (q15_t)0x638E, (q15_t)0x3537, (q15_t)0x1C5D, (q15_t)0xCAD7, (q15_t)0x63A3, (q15_t)0x3529,
+    (q15_t)0x1C48, (q15_t)0xCAE5, (q15_t)0x63B8, (q15_t)0x351B, (q15_t)0x1C33, (q15_t)0xCAF3, (q15_t)0x63CD, (q15_t)0x350D,
+    (q15_t)0x1C1E, (q15_t)0xCB01, (q15_t)0x63E2, (q15_t)0x34FF, (q15_t)0x1C09, (q15_t)0xCB0F, (q15_t)0x63F7, (q15_t)0x34F1,
+    (q15_t)0x1BF5, (q15_t)0xCB1E, (q15_t)0x640B, (q15_t)0x34E2, (q15_t)0x1BE0, (q15_t)0xCB2C, (q15_t)0x6420, (q15_t)0x34D4,
+    (q15_t)0x1BCB, (q15_t)0xCB3A, (q15_t)0x6435, (q15_t)0x34C6, (q15_t)0x1BB6, (q15_t)0xCB48, (q15_t)0x644A, (q15_t)0x34B8,
+    (q15_t)0x1BA2, (q15_t)0xCB56, (q15_t)0x645E, (q15_t)0x34AA, (q15_t)0x1B8D, (q15_t)0xCB65, (q15_t)0x6473, (q15_t)0x349B,
+    (q15_t)0x1B78, (q15_t)0xCB73, (q15_t)0x6488, (q15_t)0x348D, (q15_t)0x1B64, (q15_t)0xCB81, (q15_t)0x649C, (q15_t)0x347F,
+    (q15_t)0x1B4F, (q15_t)0xCB90, (q15_t)0x64B1, (q15_t)0x3470, (q15_t)0x1B3B, (q15_t)0xCB9E, (q15_t)0x64C5, (q15_t)0x3462,
+    (q15_t)0x1B26, (q15_t)0xCBAD, (q15_t)0x64DA, (q15_t)0x3453, (q15_t)0x1B11, (q15_t)0xCBBB, (q15_t)0x64EF, (q15_t)0x3445,
+    (q15_t)0x1AFD, (q15_t)0xCBCA, (q15_t)0x6503, (q15_t)0x3436, (q15_t)0x1AE8, (q15_t)0xCBD8, (q15_t)0x6518, (q15_t)0x3428,
+    (q15_t)0x1AD4, (q15_t)0xCBE7, (q15_t)0x652C, (q15_t)0x3419, (q15_t)0x1ABF, (q15_t)0xCBF5, (q15_t)0x6541, (q15_t)0x340B,
+    (q15_t)0x1AAB, (q15_t)0xCC04, (q15_t)0x6555, (q15_t)0x33FC, (q15_t)0x1A97, (q15_t)0xCC13, (q15_t)0x6569, (q15_t)0x33ED,
+    (q15_t)0x1A82, (q15_t)0xCC21, (q15_t)0x657E, (q15_t)0x33DF, (q15_t)0x1A6E, (q15_t)0xCC30, (q15_t)0x6592, (q15_t)0x33D0,
+    (q15_t)0x1A5A, (q15_t)0xCC3F, (q15_t)0x65A6, (q15_t)0x33C1, (q15_t)0x1A45, (q15_t)0xCC4E, (q15_t)0x65BB, (q15_t)0x33B2,
+    (q15_t)0x1A31, (q15_t)0xCC5D, (q15_t)0x65CF, (q15_t)0x33A3, (q15_t)0x1A1D, (q15_t)0xCC6B, (q15_t)0x65E3, (q15_t)0x3395,
+    (q15_t)0x1A08, (q15_t)0xCC7A, (q15_t)0x65F8, (q15_t)0x3386, (q15_t)0x19F4, (q15_t)0xCC89, (q15_t)0x660C, (q15_t)0x3377,
+    (q15_t)0x19E0, (q15_t)0xCC98, (q15_t)0x6620, (q15_t)0x3368, (q15_t)0x19CC, (q15_t)0xCCA7, (q15_t)0x6634, (q15_t)0x3359,
+    (q15_t)0x19B8, (q15_t)0xCCB6, (q15_t)0x6648, (q15_t)0x334A, (q15_t)0x19A4, (q15_t)0xCCC5, (q15_t)0x665C, (q15_t)0x333B,
+    (q15_t)0x198F, (q15_t)0xCCD4, (q15_t)0x6671, (q15_t)0x332C, (q15_t)0x197B, (q15_t)0xCCE3, (q15_t)0x6685, (q15_t)0x331D,
+    (q15_t)0x1967, (q15_t)0xCCF3, (q15_t)0x6699, (q15_t)0x330D, (q15_t)0x1953, (q15_t)0xCD02, (q15_t)0x66AD, (q15_t)0x32FE,
+    (q15_t)0x193F, (q15_t)0xCD11, (q15_t)0x66C1, (q15_t)0x32EF, (q15_t)0x192B, (q15_t)0xCD20, (q15_t)0x66D5, (q15_t)0x32E0,
+    (q15_t)0x1917, (q15_t)0xCD30, (q15_t)0x66E9, (q15_t)0x32D0, (q15_t)0x1903, (q15_t)0xCD3F, (q15_t)0x66FD, (q15_t)0x32C1,
+    (q15_t)0x18EF, (q15_t)0xCD4E, (q15_t)0x6711, (q15_t)0x32B2, (q15_t)0x18DC, (q15_t)0xCD5D, (q15_t)0x6724, (q15_t)0x32A3,
+    (q15_t)0x18C8, (q15_t)0xCD6D, (q15_t)0x6738, (q15_t)0x3293, (q15_t)0x18B4, (q15_t)0xCD7C, (q15_t)0x674C, (q15_t)0x3284,
+    (q15_t)0x18A0, (q15_t)0xCD8C, (q15_t)0x6760, (q15_t)0x3274, (q15_t)0x188C, (q15_t)0xCD9B, (q15_t)0x6774, (q15_t)0x3265,
+    (q15_t)0x1878, (q15_t)0xCDAB, (q15_t)0x6788, (q15_t)0x3255, (q15_t)0x1865, (q15_t)0xCDBA, (q15_t)0x679B, (q15_t)0x3246,
+    (q15_t)0x1851, (q15_t)0xCDCA, (q15_t)0x67AF, (q15_t)0x3236, (q15_t)0x183D, (q15_t)0xCDD9, (q15_t)0x67C3, (q15_t)0x3227,
+    (q15_t)0x182A, (q15_t)0xCDE9, (q15_t)0x67D6, (q15_t)0x3217, (q15_t)0x1816, (q15_t)0xCDF9, (q15_t)0x67EA, (q15_t)0x3207,
+    (q15_t)0x1802, (q15_t)0xCE08, (q15_t)0x67FE, (q15_t)0x31F8, (q15_t)0x17EF, (q15_t)0xCE18, (q15_t)0x6811, (q15_t)0x31E8,
+    (q15_t)0x17DB, (q15_t)0xCE28, (q15_t)0x6825, (q15_t)0x31D8, (q15_t)0x17C8, (q15_t)0xCE38, (q15_t)0x6838, (q15_t)0x31C8,
+    (q15_t)0x17B4, (q15_t)0xCE47, (q15_t)0x684C, (q15_t)0x31B9, (q15_t)0x17A0, (q15_t)0xCE57, (q15_t)0x6860, (q15_t)0x31A9,
+    (q15_t)0x178D, (q15_t)0xCE67, (q15_t)0x6873, (q15_t)0x3199, (q15_t)0x177A, (q15_t)0xCE77, (q15_t)0x6886, (q15_t)0x3189,
+    (q15_t)0x1766, (q15_t)0xCE87, (q15_t)0x689A, (q15_t)0x3179, (q15_t)0x1753, (q15_t)0xCE97, (q15_t)0x68AD, (q15_t)0x3169,
+    (q15_t)0x173F, (q15_t)0xCEA7, (q15_t)0x68C1, (q15_t)0x3159, (q15_t)0x172C, (q15_t)0xCEB7, (q15_t)0x68D4, (q15_t)0x3149,
+    (q15_t)0x1719, (q15_t)0xCEC7, (q15_t)0x68E7, (q15_t)0x3139, (q15_t)0x1705, (q15_t)0xCED7, (q15_t)0x68FB, (q15_t)0x3129,
+    (q15_t)0x16F2, (q15_t)0xCEE7, (q15_t)0x690E, (q15_t)0x3119, (q15_t)0x16DF, (q15_t)0xCEF7, (q15_t)0x6921, (q15_t)0x3109,
+    (q15_t)0x16CB, (q15_t)0xCF07, (q15_t)0x6935, (q15_t)0x30F9, (q15_t)0x16B8, (q15_t)0xCF18, (q15_t)0x6948, (q15_t)0x30E8,
+    (q15_t)0x16A5, (q15_t)0xCF28, (q15_t)0x695B, (q15_t)0x30D8, (q15_t)0x1692, (q15_t)0xCF38, (q15_t)0x696E, (q15_t)0x30C8,
+    (q15_t)0x167F, (q15_t)0xCF48, (q15_t)0x6981, (q15_t)0x30B8, (q15_t)0x166C, (q15_t)0xCF59, (q15_t)0x6994, (q15_t)0x30A7,
+    (q15_t)0x1659, (q15_t)0xCF69, (q15_t)0x69A7, (q15_t)0x3097, (q15_t)0x1645, (q15_t)0xCF79, (q15_t)0x69BB, (q15_t)0x3087,
+    (q15_t)0x1632, (q15_t)0xCF8A, (q15_t)0x69CE, (q15_t)0x3076, (q15_t)0x161F, (q15_t)0xCF9A, (q15_t)0x69E1, (q15_t)0x3066,
+    (q15_t)0x160C, (q15_t)0xCFAB, (q15_t)0x69F4, (q15_t)0x3055, (q15_t)0x15F9, (q15_t)0xCFBB, (q15_t)0x6A07, (q15_t)0x3045,
+    (q15_t)0x15E6, (q15_t)0xCFCC, (q15_t)0x6A1A, (q15_t)0x3034, (q15_t)0x15D4, (q15_t)0xCFDC, (q15_t)0x6A2C, (q15_t)0x3024,
+    (q15_t)0x15C1, (q15_t)0xCFED, (q15_t)0x6A3F, (q15_t)0x3013, (q15_t)0x15AE, (q15_t)0xCFFE, (q15_t)0x6A52, (q15_t)0x3002,
+    (q15_t)0x159B, (q15_t)0xD00E, (q15_t)0x6A65, (q15_t)0x2FF2, (q15_t)0x1588, (q15_t)0xD01F, (q15_t)0x6A78, (q15_t)0x2FE1,
+    (q15_t)0x1575, (q15_t)0xD030, (q15_t)0x6A8B, (q15_t)0x2FD0, (q15_t)0x1563, (q15_t)0xD040, (q15_t)0x6A9D, (q15_t)0x2FC0,
+    (q15_t)0x1550, (q15_t)0xD051, (q15_t)0x6AB0, (q15_t)0x2FAF, (q15_t)0x153D, (q15_t)0xD062, (q15_t)0x6AC3, (q15_t)0x2F9E,
+    (q15_t)0x152A, (q15_t)0xD073, (q15_t)0x6AD6, (q15_t)0x2F8D, (q15_t)0x1518, (q15_t)0xD083, (q15_t)0x6AE8, (q15_t)0x2F7D,
+    (q15_t)0x1505, (q15_t)0xD094, (q15_t)0x6AFB, (q15_t)0x2F6C, (q15_t)0x14F3, (q15_t)0xD0A5, (q15_t)0x6B0D, (q15_t)0x2F5B,
+    (q15_t)0x14E0, (q15_t)0xD0B6, (q15_t)0x6B20, (q15_t)0x2F4A, (q15_t)0x14CD, (q15_t)0xD0C7, (q15_t)0x6B33, (q15_t)0x2F39,
+    (q15_t)0x14BB, (q15_t)0xD0D8, (q15_t)0x6B45, (q15_t)0x2F28, (q15_t)0x14A8, (q15_t)0xD0E9, (q15_t)0x6B58, (q15_t)0x2F17,
+    (q15_t)0x1496, (q15_t)0xD0FA, (q15_t)0x6B6A, (q15_t)0x2F06, (q15_t)0x1483, (q15_t)0xD10B, (q15_t)0x6B7D, (q15_t)0x2EF5,
+    (q15_t)0x1471, (q15_t)0xD11C, (q15_t)0x6B8F, (q15_t)0x2EE4, (q15_t)0x145F, (q15_t)0xD12D, (q15_t)0x6BA1, (q15_t)0x2ED3,
+    (q15_t)0x144C, (q15_t)0xD13E, (q15_t)0x6BB4, (q15_t)0x2EC2, (q15_t)0x143A, (q15_t)0xD150, (q15_t)0x6BC6, (q15_t)0x2EB0,
+    (q15_t)0x1428, (q15_t)0xD161, (q15_t)0x6BD8, (q15_t)0x2E9F, (q15_t)0x1415, (q15_t)0xD172, (q15_t)0x6BEB, (q15_t)0x2E8E,
+    (q15_t)0x1403, (q15_t)0xD183, (q15_t)0x6BFD, (q15_t)0x2E7D, (q15_t)0x13F1, (q15_t)0xD195, (q15_t)0x6C0F, (q15_t)0x2E6B,
+    (q15_t)0x13DF, (q15_t)0xD1A6, (q15_t)0x6C21, (q15_t)0x2E5A, (q15_t)0x13CC, (q15_t)0xD1B7, (q15_t)0x6C34, (q15_t)0x2E49,
+    (q15_t)0x13BA, (q15_t)0xD1C9, (q15_t)0x6C46, (q15_t)0x2E37, (q15_t)0x13A8, (q15_t)0xD1DA, (q15_t)0x6C58, (q15_t)0x2E26,
+    (q15_t)0x1396, (q15_t)0xD1EB, (q15_t)0x6C6A, (q15_t)0x2E15, (q15_t)0x1384, (q15_t)0xD1FD, (q15_t)0x6C7C, (q15_t)0x2E03,
+    (q15_t)0x1372, (q15_t)0xD20E, (q15_t)0x6C8E, (q15_t)0x2DF2, (q15_t)0x1360, (q15_t)0xD220, (q15_t)0x6CA0, (q15_t)0x2DE0,
+    (q15_t)0x134E, (q15_t)0xD231, (q15_t)0x6CB2, (q15_t)0x2DCF, (q15_t)0x133C, (q15_t)0xD243, (q15_t)0x6CC4, (q15_t)0x2DBD,
+    (q15_t)0x132A, (q15_t)0xD255, (q15_t)0x6CD6, (q15_t)0x2DAB, (q15_t)0x1318, (q15_t)0xD266, (q15_t)0x6CE8, (q15_t)0x2D9A,
+    (q15_t)0x1306, (q15_t)0xD278, (q15_t)0x6CFA, (q15_t)0x2D88, (q15_t)0x12F4, (q15_t)0xD28A, (q15_t)0x6D0C, (q15_t)0x2D76,
+    (q15_t)0x12E2, (q15_t)0xD29B, (q15_t)0x6D1E, (q15_t)0x2D65, (q15_t)0x12D1, (q15_t)0xD2AD, (q15_t)0x6D2F, (q15_t)0x2D53,
+    (q15_t)0x12BF, (q15_t)0xD2BF, (q15_t)0x6D41, (q15_t)0x2D41, (q15_t)0x12AD, (q15_t)0xD2D1, (q15_t)0x6D53, (q15_t)0x2D2F,
+    (q15_t)0x129B, (q15_t)0xD2E2, (q15_t)0x6D65, (q15_t)0x2D1E, (q15_t)0x128A, (q15_t)0xD2F4, (q15_t)0x6D76, (q15_t)0x2D0C,
+    (q15_t)0x1278, (q15_t)0xD306, (q15_t)0x6D88, (q15_t)0x2CFA, (q15_t)0x1266, (q15_t)0xD318, (q15_t)0x6D9A, (q15_t)0x2CE8,
+    (q15_t)0x1255, (q15_t)0xD32A, (q15_t)0x6DAB, (q15_t)0x2CD6, (q15_t)0x1243, (q15_t)0xD33C, (q15_t)0x6DBD, (q15_t)0x2CC4,
+    (q15_t)0x1231, (q15_t)0xD34E, (q15_t)0x6DCF, (q15_t)0x2CB2, (q15_t)0x1220, (q15_t)0xD360, (q15_t)0x6DE0, (q15_t)0x2CA0,
+    (q15_t)0x120E, (q15_t)0xD372, (q15_t)0x6DF2, (q15_t)0x2C8E, (q15_t)0x11FD, (q15_t)0xD384, (q15_t)0x6E03, (q15_t)0x2C7C,
+    (q15_t)0x11EB, (q15_t)0xD396, (q15_t)0x6E15, (q15_t)0x2C6A, (q15_t)0x11DA, (q15_t)0xD3A8, (q15_t)0x6E26, (q15_t)0x2C58,
+    (q15_t)0x11C9, (q15_t)0xD3BA, (q15_t)0x6E37, (q15_t)0x2C46, (q15_t)0x11B7, (q15_t)0xD3CC, (q15_t)0x6E49, (q15_t)0x2C34,
+    (q15_t)0x11A6, (q15_t)0xD3DF, (q15_t)0x6E5A, (q15_t)0x2C21, (q15_t)0x1195, (q15_t)0xD3F1, (q15_t)0x6E6B, (q15_t)0x2C0F,
+    (q15_t)0x1183, (q15_t)0xD403, (q15_t)0x6E7D, (q15_t)0x2BFD, (q15_t)0x1172, (q15_t)0xD415, (q15_t)0x6E8E, (q15_t)0x2BEB,
+    (q15_t)0x1161, (q15_t)0xD428, (q15_t)0x6E9F, (q15_t)0x2BD8, (q15_t)0x1150, (q15_t)0xD43A, (q15_t)0x6EB0, (q15_t)0x2BC6,
+    (q15_t)0x113E, (q15_t)0xD44C, (q15_t)0x6EC2, (q15_t)0x2BB4, (q15_t)0x112D, (q15_t)0xD45F, (q15_t)0x6ED3, (q15_t)0x2BA1,
+    (q15_t)0x111C, (q15_t)0xD471, (q15_t)0x6EE4, (q15_t)0x2B8F, (q15_t)0x110B, (q15_t)0xD483, (q15_t)0x6EF5, (q15_t)0x2B7D,
+    (q15_t)0x10FA, (q15_t)0xD496, (q15_t)0x6F06, (q15_t)0x2B6A, (q15_t)0x10E9, (q15_t)0xD4A8, (q15_t)0x6F17, (q15_t)0x2B58,
+    (q15_t)0x10D8, (q15_t)0xD4BB, (q15_t)0x6F28, (q15_t)0x2B45, (q15_t)0x10C7, (q15_t)0xD4CD, (q15_t)0x6F39, (q15_t)0x2B33,
+    (q15_t)0x10B6, (q15_t)0xD4E0, (q15_t)0x6F4A, (q15_t)0x2B20, (q15_t)0x10A5, (q15_t)0xD4F3, (q15_t)0x6F5B, (q15_t)0x2B0D,
+    (q15_t)0x1094, (q15_t)0xD505, (q15_t)0x6F6C, (q15_t)0x2AFB, (q15_t)0x1083, (q15_t)0xD518, (q15_t)0x6F7D, (q15_t)0x2AE8,
+    (q15_t)0x1073, (q15_t)0xD52A, (q15_t)0x6F8D, (q15_t)0x2AD6, (q15_t)0x1062, (q15_t)0xD53D, (q15_t)0x6F9E, (q15_t)0x2AC3,
+    (q15_t)0x1051, (q15_t)0xD550, (q15_t)0x6FAF, (q15_t)0x2AB0, (q15_t)0x1040, (q15_t)0xD563, (q15_t)0x6FC0, (q15_t)0x2A9D,
+    (q15_t)0x1030, (q15_t)0xD575, (q15_t)0x6FD0, (q15_t)0x2A8B, (q15_t)0x101F, (q15_t)0xD588, (q15_t)0x6FE1, (q15_t)0x2A78,
+    (q15_t)0x100E, (q15_t)0xD59B, (q15_t)0x6FF2, (q15_t)0x2A65, (q15_t)0x0FFE, (q15_t)0xD5AE, (q15_t)0x7002, (q15_t)0x2A52,
+    (q15_t)0x0FED, (q15_t)0xD5C1, (q15_t)0x7013, (q15_t)0x2A3F, (q15_t)0x0FDC, (q15_t)0xD5D4, (q15_t)0x7024, (q15_t)0x2A2C,
+    (q15_t)0x0FCC, (q15_t)0xD5E6, (q15_t)0x7034, (q15_t)0x2A1A, (q15_t)0x0FBB, (q15_t)0xD5F9, (q15_t)0x7045, (q15_t)0x2A07,
+    (q15_t)0x0FAB, (q15_t)0xD60C, (q15_t)0x7055, (q15_t)0x29F4, (q15_t)0x0F9A, (q15_t)0xD61F, (q15_t)0x7066, (q15_t)0x29E1,
+    (q15_t)0x0F8A, (q15_t)0xD632, (q15_t)0x7076, (q15_t)0x29CE, (q15_t)0x0F79, (q15_t)0xD645, (q15_t)0x7087, (q15_t)0x29BB,
+    (q15_t)0x0F69, (q15_t)0xD659, (q15_t)0x7097, (q15_t)0x29A7, (q15_t)0x0F59, (q15_t)0xD66C, (q15_t)0x70A7, (q15_t)0x2994,
+    (q15_t)0x0F48, (q15_t)0xD67F, (q15_t)0x70B8, (q15_t)0x2981, (q15_t)0x0F38, (q15_t)0xD692, (q15_t)0x70C8, (q15_t)0x296E,
+    (q15_t)0x0F28, (q15_t)0xD6A5, (q15_t)0x70D8, (q15_t)0x295B, (q15_t)0x0F18, (q15_t)0xD6B8, (q15_t)0x70E8, (q15_t)0x2948,
+    (q15_t)0x0F07, (q15_t)0xD6CB, (q15_t)0x70F9, (q15_t)0x2935, (q15_t)0x0EF7, (q15_t)0xD6DF, (q15_t)0x7109, (q15_t)0x2921,
+    (q15_t)0x0EE7, (q15_t)0xD6F2, (q15_t)0x7119, (q15_t)0x290E, (q15_t)0x0ED7, (q15_t)0xD705, (q15_t)0x7129, (q15_t)0x28FB,
+    (q15_t)0x0EC7, (q15_t)0xD719, (q15_t)0x7139, (q15_t)0x28E7, (q15_t)0x0EB7, (q15_t)0xD72C, (q15_t)0x7149, (q15_t)0x28D4,
+    (q15_t)0x0EA7, (q15_t)0xD73F, (q15_t)0x7159, (q15_t)0x28C1, (q15_t)0x0E97, (q15_t)0xD753, (q15_t)0x7169, (q15_t)0x28AD,
+    (q15_t)0x0E87, (q15_t)0xD766, (q15_t)0x7179, (q15_t)0x289A, (q15_t)0x0E77, (q15_t)0xD77A, (q15_t)0x7189, (q15_t)0x2886,
+    (q15_t)0x0E67, (q15_t)0xD78D, (q15_t)0x7199, (q15_t)0x2873, (q15_t)0x0E57, (q15_t)0xD7A0, (q15_t)0x71A9, (q15_t)0x2860,
+    (q15_t)0x0E47, (q15_t)0xD7B4, (q15_t)0x71B9, (q15_t)0x284C, (q15_t)0x0E38, (q15_t)0xD7C8, (q15_t)0x71C8, (q15_t)0x2838,
+    (q15_t)0x0E28, (q15_t)0xD7DB, (q15_t)0x71D8, (q15_t)0x2825, (q15_t)0x0E18, (q15_t)0xD7EF, (q15_t)0x71E8, (q15_t)0x2811,
+    (q15_t)0x0E08, (q15_t)0xD802, (q15_t)0x71F8, (q15_t)0x27FE, (q15_t)0x0DF9, (q15_t)0xD816, (q15_t)0x7207, (q15_t)0x27EA,
+    (q15_t)0x0DE9, (q15_t)0xD82A, (q15_t)0x7217, (q15_t)0x27D6, (q15_t)0x0DD9, (q15_t)0xD83D, (q15_t)0x7227, (q15_t)0x27C3,
+    (q15_t)0x0DCA, (q15_t)0xD851, (q15_t)0x7236, (q15_t)0x27AF, (q15_t)0x0DBA, (q15_t)0xD865, (q15_t)0x7246, (q15_t)0x279B,
+    (q15_t)0x0DAB, (q15_t)0xD878, (q15_t)0x7255, (q15_t)0x2788, (q15_t)0x0D9B, (q15_t)0xD88C, (q15_t)0x7265, (q15_t)0x2774,
+    (q15_t)0x0D8C, (q15_t)0xD8A0, (q15_t)0x7274, (q15_t)0x2760, (q15_t)0x0D7C, (q15_t)0xD8B4, (q15_t)0x7284, (q15_t)0x274C,
+    (q15_t)0x0D6D, (q15_t)0xD8C8, (q15_t)0x7293, (q15_t)0x2738, (q15_t)0x0D5D, (q15_t)0xD8DC, (q15_t)0x72A3, (q15_t)0x2724,
+    (q15_t)0x0D4E, (q15_t)0xD8EF, (q15_t)0x72B2, (q15_t)0x2711, (q15_t)0x0D3F, (q15_t)0xD903, (q15_t)0x72C1, (q15_t)0x26FD,
+    (q15_t)0x0D30, (q15_t)0xD917, (q15_t)0x72D0, (q15_t)0x26E9, (q15_t)0x0D20, (q15_t)0xD92B, (q15_t)0x72E0, (q15_t)0x26D5,
+    (q15_t)0x0D11, (q15_t)0xD93F, (q15_t)0x72EF, (q15_t)0x26C1, (q15_t)0x0D02, (q15_t)0xD953, (q15_t)0x72FE, (q15_t)0x26AD,
+    (q15_t)0x0CF3, (q15_t)0xD967, (q15_t)0x730D, (q15_t)0x2699, (q15_t)0x0CE3, (q15_t)0xD97B, (q15_t)0x731D, (q15_t)0x2685,
+    (q15_t)0x0CD4, (q15_t)0xD98F, (q15_t)0x732C, (q15_t)0x2671, (q15_t)0x0CC5, (q15_t)0xD9A4, (q15_t)0x733B, (q15_t)0x265C,
+    (q15_t)0x0CB6, (q15_t)0xD9B8, (q15_t)0x734A, (q15_t)0x2648, (q15_t)0x0CA7, (q15_t)0xD9CC, (q15_t)0x7359, (q15_t)0x2634,
+    (q15_t)0x0C98, (q15_t)0xD9E0, (q15_t)0x7368, (q15_t)0x2620, (q15_t)0x0C89, (q15_t)0xD9F4, (q15_t)0x7377, (q15_t)0x260C,
+    (q15_t)0x0C7A, (q15_t)0xDA08, (q15_t)0x7386, (q15_t)0x25F8, (q15_t)0x0C6B, (q15_t)0xDA1D, (q15_t)0x7395, (q15_t)0x25E3,
+    (q15_t)0x0C5D, (q15_t)0xDA31, (q15_t)0x73A3, (q15_t)0x25CF, (q15_t)0x0C4E, (q15_t)0xDA45, (q15_t)0x73B2, (q15_t)0x25BB,
+    (q15_t)0x0C3F, (q15_t)0xDA5A, (q15_t)0x73C1, (q15_t)0x25A6, (q15_t)0x0C30, (q15_t)0xDA6E, (q15_t)0x73D0, (q15_t)0x2592,
+    (q15_t)0x0C21, (q15_t)0xDA82, (q15_t)0x73DF, (q15_t)0x257E, (q15_t)0x0C13, (q15_t)0xDA97, (q15_t)0x73ED, (q15_t)0x2569,
+    (q15_t)0x0C04, (q15_t)0xDAAB, (q15_t)0x73FC, (q15_t)0x2555, (q15_t)0x0BF5, (q15_t)0xDABF, (q15_t)0x740B, (q15_t)0x2541,
+    (q15_t)0x0BE7, (q15_t)0xDAD4, (q15_t)0x7419, (q15_t)0x252C, (q15_t)0x0BD8, (q15_t)0xDAE8, (q15_t)0x7428, (q15_t)0x2518,
+    (q15_t)0x0BCA, (q15_t)0xDAFD, (q15_t)0x7436, (q15_t)0x2503, (q15_t)0x0BBB, (q15_t)0xDB11, (q15_t)0x7445, (q15_t)0x24EF,
+    (q15_t)0x0BAD, (q15_t)0xDB26, (q15_t)0x7453, (q15_t)0x24DA, (q15_t)0x0B9E, (q15_t)0xDB3B, (q15_t)0x7462, (q15_t)0x24C5,
+    (q15_t)0x0B90, (q15_t)0xDB4F, (q15_t)0x7470, (q15_t)0x24B1, (q15_t)0x0B81, (q15_t)0xDB64, (q15_t)0x747F, (q15_t)0x249C,
+    (q15_t)0x0B73, (q15_t)0xDB78, (q15_t)0x748D, (q15_t)0x2488, (q15_t)0x0B65, (q15_t)0xDB8D, (q15_t)0x749B, (q15_t)0x2473,
+    (q15_t)0x0B56, (q15_t)0xDBA2, (q15_t)0x74AA, (q15_t)0x245E, (q15_t)0x0B48, (q15_t)0xDBB6, (q15_t)0x74B8, (q15_t)0x244A,
+    (q15_t)0x0B3A, (q15_t)0xDBCB, (q15_t)0x74C6, (q15_t)0x2435, (q15_t)0x0B2C, (q15_t)0xDBE0, (q15_t)0x74D4, (q15_t)0x2420,
+    (q15_t)0x0B1E, (q15_t)0xDBF5, (q15_t)0x74E2, (q15_t)0x240B, (q15_t)0x0B0F, (q15_t)0xDC09, (q15_t)0x74F1, (q15_t)0x23F7,
+    (q15_t)0x0B01, (q15_t)0xDC1E, (q15_t)0x74FF, (q15_t)0x23E2, (q15_t)0x0AF3, (q15_t)0xDC33, (q15_t)0x750D, (q15_t)0x23CD,
+    (q15_t)0x0AE5, (q15_t)0xDC48, (q15_t)0x751B, (q15_t)0x23B8, (q15_t)0x0AD7, (q15_t)0xDC5D, (q15_t)0x7529, (q15_t)0x23A3,
+    (q15_t)0x0AC9, (q15_t)0xDC72, (q15_t)0x7537, (q15_t)0x238E, (q15_t)0x0ABB, (q15_t)0xDC86, (q15_t)0x7545, (q15_t)0x237A,
+    (q15_t)0x0AAD, (q15_t)0xDC9B, (q15_t)0x7553, (q15_t)0x2365, (q15_t)0x0A9F, (q15_t)0xDCB0, (q15_t)0x7561, (q15_t)0x2350,
+    (q15_t)0x0A92, (q15_t)0xDCC5, (q15_t)0x756E, (q15_t)0x233B, (q15_t)0x0A84, (q15_t)0xDCDA, (q15_t)0x757C, (q15_t)0x2326,
+    (q15_t)0x0A76, (q15_t)0xDCEF, (q15_t)0x758A, (q15_t)0x2311, (q15_t)0x0A68, (q15_t)0xDD04, (q15_t)0x7598, (q15_t)0x22FC,
+    (q15_t)0x0A5B, (q15_t)0xDD19, (q15_t)0x75A5, (q15_t)0x22E7, (q15_t)0x0A4D, (q15_t)0xDD2E, (q15_t)0x75B3, (q15_t)0x22D2,
+    (q15_t)0x0A3F, (q15_t)0xDD44, (q15_t)0x75C1, (q15_t)0x22BC, (q15_t)0x0A32, (q15_t)0xDD59, (q15_t)0x75CE, (q15_t)0x22A7,
+    (q15_t)0x0A24, (q15_t)0xDD6E, (q15_t)0x75DC, (q15_t)0x2292, (q15_t)0x0A16, (q15_t)0xDD83, (q15_t)0x75EA, (q15_t)0x227D,
+    (q15_t)0x0A09, (q15_t)0xDD98, (q15_t)0x75F7, (q15_t)0x2268, (q15_t)0x09FB, (q15_t)0xDDAD, (q15_t)0x7605, (q15_t)0x2253,
+    (q15_t)0x09EE, (q15_t)0xDDC3, (q15_t)0x7612, (q15_t)0x223D, (q15_t)0x09E0, (q15_t)0xDDD8, (q15_t)0x7620, (q15_t)0x2228,
+    (q15_t)0x09D3, (q15_t)0xDDED, (q15_t)0x762D, (q15_t)0x2213, (q15_t)0x09C6, (q15_t)0xDE02, (q15_t)0x763A, (q15_t)0x21FE,
+    (q15_t)0x09B8, (q15_t)0xDE18, (q15_t)0x7648, (q15_t)0x21E8, (q15_t)0x09AB, (q15_t)0xDE2D, (q15_t)0x7655, (q15_t)0x21D3,
+    (q15_t)0x099E, (q15_t)0xDE42, (q15_t)0x7662, (q15_t)0x21BE, (q15_t)0x0991, (q15_t)0xDE58, (q15_t)0x766F, (q15_t)0x21A8,
+    (q15_t)0x0983, (q15_t)0xDE6D, (q15_t)0x767D, (q15_t)0x2193, (q15_t)0x0976, (q15_t)0xDE83, (q15_t)0x768A, (q15_t)0x217D,
+    (q15_t)0x0969, (q15_t)0xDE98, (q15_t)0x7697, (q15_t)0x2168, (q15_t)0x095C, (q15_t)0xDEAD, (q15_t)0x76A4, (q15_t)0x2153,
+    (q15_t)0x094F, (q15_t)0xDEC3, (q15_t)0x76B1, (q15_t)0x213D, (q15_t)0x0942, (q15_t)0xDED8, (q15_t)0x76BE, (q15_t)0x2128,
+    (q15_t)0x0935, (q15_t)0xDEEE, (q15_t)0x76CB, (q15_t)0x2112, (q15_t)0x0928, (q15_t)0xDF03, (q15_t)0x76D8, (q15_t)0x20FD,
+    (q15_t)0x091B, (q15_t)0xDF19, (q15_t)0x76E5, (q15_t)0x20E7, (q15_t)0x090E, (q15_t)0xDF2F, (q15_t)0x76F2, (q15_t)0x20D1,
+    (q15_t)0x0901, (q15_t)0xDF44, (q15_t)0x76FF, (q15_t)0x20BC, (q15_t)0x08F4, (q15_t)0xDF5A, (q15_t)0x770C, (q15_t)0x20A6,
+    (q15_t)0x08E8, (q15_t)0xDF6F, (q15_t)0x7718, (q15_t)0x2091, (q15_t)0x08DB, (q15_t)0xDF85, (q15_t)0x7725, (q15_t)0x207B,
+    (q15_t)0x08CE, (q15_t)0xDF9B, (q15_t)0x7732, (q15_t)0x2065, (q15_t)0x08C1, (q15_t)0xDFB0, (q15_t)0x773F, (q15_t)0x2050,
+    (q15_t)0x08B5, (q15_t)0xDFC6, (q15_t)0x774B, (q15_t)0x203A, (q15_t)0x08A8, (q15_t)0xDFDC, (q15_t)0x7758, (q15_t)0x2024,
+    (q15_t)0x089B, (q15_t)0xDFF1, (q15_t)0x7765, (q15_t)0x200F, (q15_t)0x088F, (q15_t)0xE007, (q15_t)0x7771, (q15_t)0x1FF9,
+    (q15_t)0x0882, (q15_t)0xE01D, (q15_t)0x777E, (q15_t)0x1FE3, (q15_t)0x0876, (q15_t)0xE033, (q15_t)0x778A, (q15_t)0x1FCD,
+    (q15_t)0x0869, (q15_t)0xE049, (q15_t)0x7797, (q15_t)0x1FB7, (q15_t)0x085D, (q15_t)0xE05E, (q15_t)0x77A3, (q15_t)0x1FA2,
+    (q15_t)0x0850, (q15_t)0xE074, (q15_t)0x77B0, (q15_t)0x1F8C, (q15_t)0x0844, (q15_t)0xE08A, (q15_t)0x77BC, (q15_t)0x1F76,
+    (q15_t)0x0838, (q15_t)0xE0A0, (q15_t)0x77C8, (q15_t)0x1F60, (q15_t)0x082B, (q15_t)0xE0B6, (q15_t)0x77D5, (q15_t)0x1F4A,
+    (q15_t)0x081F, (q15_t)0xE0CC, (q15_t)0x77E1, (q15_t)0x1F34, (q15_t)0x0813, (q15_t)0xE0E2, (q15_t)0x77ED, (q15_t)0x1F1E,
+    (q15_t)0x0807, (q15_t)0xE0F8, (q15_t)0x77F9, (q15_t)0x1F08, (q15_t)0x07FB, (q15_t)0xE10E, (q15_t)0x7805, (q15_t)0x1EF2,
+    (q15_t)0x07EE, (q15_t)0xE124, (q15_t)0x7812, (q15_t)0x1EDC, (q15_t)0x07E2, (q15_t)0xE13A, (q15_t)0x781E, (q15_t)0x1EC6,
+    (q15_t)0x07D6, (q15_t)0xE150, (q15_t)0x782A, (q15_t)0x1EB0, (q15_t)0x07CA, (q15_t)0xE166, (q15_t)0x7836, (q15_t)0x1E9A,
+    (q15_t)0x07BE, (q15_t)0xE17C, (q15_t)0x7842, (q15_t)0x1E84, (q15_t)0x07B2, (q15_t)0xE192, (q15_t)0x784E, (q15_t)0x1E6E,
+    (q15_t)0x07A6, (q15_t)0xE1A8, (q15_t)0x785A, (q15_t)0x1E58, (q15_t)0x079A, (q15_t)0xE1BE, (q15_t)0x7866, (q15_t)0x1E42,
+    (q15_t)0x078F, (q15_t)0xE1D5, (q15_t)0x7871, (q15_t)0x1E2B, (q15_t)0x0783, (q15_t)0xE1EB, (q15_t)0x787D, (q15_t)0x1E15,
+    (q15_t)0x0777, (q15_t)0xE201, (q15_t)0x7889, (q15_t)0x1DFF, (q15_t)0x076B, (q15_t)0xE217, (q15_t)0x7895, (q15_t)0x1DE9,
+    (q15_t)0x075F, (q15_t)0xE22D, (q15_t)0x78A1, (q15_t)0x1DD3, (q15_t)0x0754, (q15_t)0xE244, (q15_t)0x78AC, (q15_t)0x1DBC,
+    (q15_t)0x0748, (q15_t)0xE25A, (q15_t)0x78B8, (q15_t)0x1DA6, (q15_t)0x073D, (q15_t)0xE270, (q15_t)0x78C3, (q15_t)0x1D90,
+    (q15_t)0x0731, (q15_t)0xE287, (q15_t)0x78CF, (q15_t)0x1D79, (q15_t)0x0725, (q15_t)0xE29D, (q15_t)0x78DB, (q15_t)0x1D63,
+    (q15_t)0x071A, (q15_t)0xE2B3, (q15_t)0x78E6, (q15_t)0x1D4D, (q15_t)0x070E, (q15_t)0xE2CA, (q15_t)0x78F2, (q15_t)0x1D36,
+    (q15_t)0x0703, (q15_t)0xE2E0, (q15_t)0x78FD, (q15_t)0x1D20, (q15_t)0x06F7, (q15_t)0xE2F6, (q15_t)0x7909, (q15_t)0x1D0A,
+    (q15_t)0x06EC, (q15_t)0xE30D, (q15_t)0x7914, (q15_t)0x1CF3, (q15_t)0x06E1, (q15_t)0xE323, (q15_t)0x791F, (q15_t)0x1CDD,
+    (q15_t)0x06D5, (q15_t)0xE33A, (q15_t)0x792B, (q15_t)0x1CC6, (q15_t)0x06CA, (q15_t)0xE350, (q15_t)0x7936, (q15_t)0x1CB0,
+    (q15_t)0x06BF, (q15_t)0xE367, (q15_t)0x7941, (q15_t)0x1C99, (q15_t)0x06B4, (q15_t)0xE37D, (q15_t)0x794C, (q15_t)0x1C83,
+    (q15_t)0x06A8, (q15_t)0xE394, (q15_t)0x7958, (q15_t)0x1C6C, (q15_t)0x069D, (q15_t)0xE3AA, (q15_t)0x7963, (q15_t)0x1C56,
+    (q15_t)0x0692, (q15_t)0xE3C1, (q15_t)0x796E, (q15_t)0x1C3F, (q15_t)0x0687, (q15_t)0xE3D7, (q15_t)0x7979, (q15_t)0x1C29,
+    (q15_t)0x067C, (q15_t)0xE3EE, (q15_t)0x7984, (q15_t)0x1C12, (q15_t)0x0671, (q15_t)0xE404, (q15_t)0x798F, (q15_t)0x1BFC,
+    (q15_t)0x0666, (q15_t)0xE41B, (q15_t)0x799A, (q15_t)0x1BE5, (q15_t)0x065B, (q15_t)0xE432, (q15_t)0x79A5, (q15_t)0x1BCE,
+    (q15_t)0x0650, (q15_t)0xE448, (q15_t)0x79B0, (q15_t)0x1BB8, (q15_t)0x0645, (q15_t)0xE45F, (q15_t)0x79BB, (q15_t)0x1BA1,
+    (q15_t)0x063B, (q15_t)0xE476, (q15_t)0x79C5, (q15_t)0x1B8A, (q15_t)0x0630, (q15_t)0xE48C, (q15_t)0x79D0, (q15_t)0x1B74,
+    (q15_t)0x0625, (q15_t)0xE4A3, (q15_t)0x79DB, (q15_t)0x1B5D, (q15_t)0x061A, (q15_t)0xE4BA, (q15_t)0x79E6, (q15_t)0x1B46,
+    (q15_t)0x0610, (q15_t)0xE4D0, (q15_t)0x79F0, (q15_t)0x1B30, (q15_t)0x0605, (q15_t)0xE4E7, (q15_t)0x79FB, (q15_t)0x1B19,
+    (q15_t)0x05FA, (q15_t)0xE4FE, (q15_t)0x7A06, (q15_t)0x1B02, (q15_t)0x05F0, (q15_t)0xE515, (q15_t)0x7A10, (q15_t)0x1AEB,
+    (q15_t)0x05E5, (q15_t)0xE52C, (q15_t)0x7A1B, (q15_t)0x1AD4, (q15_t)0x05DB, (q15_t)0xE542, (q15_t)0x7A25, (q15_t)0x1ABE,
+    (q15_t)0x05D0, (q15_t)0xE559, (q15_t)0x7A30, (q15_t)0x1AA7, (q15_t)0x05C6, (q15_t)0xE570, (q15_t)0x7A3A, (q15_t)0x1A90,
+    (q15_t)0x05BB, (q15_t)0xE587, (q15_t)0x7A45, (q15_t)0x1A79, (q15_t)0x05B1, (q15_t)0xE59E, (q15_t)0x7A4F, (q15_t)0x1A62,
+    (q15_t)0x05A7, (q15_t)0xE5B5, (q15_t)0x7A59, (q15_t)0x1A4B, (q15_t)0x059C, (q15_t)0xE5CC, (q15_t)0x7A64, (q15_t)0x1A34,
+    (q15_t)0x0592, (q15_t)0xE5E3, (q15_t)0x7A6E, (q15_t)0x1A1D, (q15_t)0x0588, (q15_t)0xE5FA, (q15_t)0x7A78, (q15_t)0x1A06,
+    (q15_t)0x057E, (q15_t)0xE611, (q15_t)0x7A82, (q15_t)0x19EF, (q15_t)0x0573, (q15_t)0xE628, (q15_t)0x7A8D, (q15_t)0x19D8,
+    (q15_t)0x0569, (q15_t)0xE63F, (q15_t)0x7A97, (q15_t)0x19C1, (q15_t)0x055F, (q15_t)0xE656, (q15_t)0x7AA1, (q15_t)0x19AA,
+    (q15_t)0x0555, (q15_t)0xE66D, (q15_t)0x7AAB, (q15_t)0x1993, (q15_t)0x054B, (q15_t)0xE684, (q15_t)0x7AB5, (q15_t)0x197C,
+    (q15_t)0x0541, (q15_t)0xE69B, (q15_t)0x7ABF, (q15_t)0x1965, (q15_t)0x0537, (q15_t)0xE6B2, (q15_t)0x7AC9, (q15_t)0x194E,
+    (q15_t)0x052D, (q15_t)0xE6C9, (q15_t)0x7AD3, (q15_t)0x1937, (q15_t)0x0523, (q15_t)0xE6E0, (q15_t)0x7ADD, (q15_t)0x1920,
+    (q15_t)0x051A, (q15_t)0xE6F7, (q15_t)0x7AE6, (q15_t)0x1909, (q15_t)0x0510, (q15_t)0xE70E, (q15_t)0x7AF0, (q15_t)0x18F2,
+    (q15_t)0x0506, (q15_t)0xE725, (q15_t)0x7AFA, (q15_t)0x18DB, (q15_t)0x04FC, (q15_t)0xE73D, (q15_t)0x7B04, (q15_t)0x18C3,
+    (q15_t)0x04F2, (q15_t)0xE754, (q15_t)0x7B0E, (q15_t)0x18AC, (q15_t)0x04E9, (q15_t)0xE76B, (q15_t)0x7B17, (q15_t)0x1895,
+    (q15_t)0x04DF, (q15_t)0xE782, (q15_t)0x7B21, (q15_t)0x187E, (q15_t)0x04D6, (q15_t)0xE799, (q15_t)0x7B2A, (q15_t)0x1867,
+    (q15_t)0x04CC, (q15_t)0xE7B1, (q15_t)0x7B34, (q15_t)0x184F, (q15_t)0x04C2, (q15_t)0xE7C8, (q15_t)0x7B3E, (q15_t)0x1838,
+    (q15_t)0x04B9, (q15_t)0xE7DF, (q15_t)0x7B47, (q15_t)0x1821, (q15_t)0x04B0, (q15_t)0xE7F6, (q15_t)0x7B50, (q15_t)0x180A,
+    (q15_t)0x04A6, (q15_t)0xE80E, (q15_t)0x7B5A, (q15_t)0x17F2, (q15_t)0x049D, (q15_t)0xE825, (q15_t)0x7B63, (q15_t)0x17DB,
+    (q15_t)0x0493, (q15_t)0xE83C, (q15_t)0x7B6D, (q15_t)0x17C4, (q15_t)0x048A, (q15_t)0xE854, (q15_t)0x7B76, (q15_t)0x17AC,
+    (q15_t)0x0481, (q15_t)0xE86B, (q15_t)0x7B7F, (q15_t)0x1795, (q15_t)0x0478, (q15_t)0xE882, (q15_t)0x7B88, (q15_t)0x177E,
+    (q15_t)0x046E, (q15_t)0xE89A, (q15_t)0x7B92, (q15_t)0x1766, (q15_t)0x0465, (q15_t)0xE8B1, (q15_t)0x7B9B, (q15_t)0x174F,
+    (q15_t)0x045C, (q15_t)0xE8C9, (q15_t)0x7BA4, (q15_t)0x1737, (q15_t)0x0453, (q15_t)0xE8E0, (q15_t)0x7BAD, (q15_t)0x1720,
+    (q15_t)0x044A, (q15_t)0xE8F7, (q15_t)0x7BB6, (q15_t)0x1709, (q15_t)0x0441, (q15_t)0xE90F, (q15_t)0x7BBF, (q15_t)0x16F1,
+    (q15_t)0x0438, (q15_t)0xE926, (q15_t)0x7BC8, (q15_t)0x16DA, (q15_t)0x042F, (q15_t)0xE93E, (q15_t)0x7BD1, (q15_t)0x16C2,
+    (q15_t)0x0426, (q15_t)0xE955, (q15_t)0x7BDA, (q15_t)0x16AB, (q15_t)0x041D, (q15_t)0xE96D, (q15_t)0x7BE3, (q15_t)0x1693,
+    (q15_t)0x0414, (q15_t)0xE984, (q15_t)0x7BEC, (q15_t)0x167C, (q15_t)0x040B, (q15_t)0xE99C, (q15_t)0x7BF5, (q15_t)0x1664,
+    (q15_t)0x0403, (q15_t)0xE9B4, (q15_t)0x7BFD, (q15_t)0x164C, (q15_t)0x03FA, (q15_t)0xE9CB, (q15_t)0x7C06, (q15_t)0x1635,
+    (q15_t)0x03F1, (q15_t)0xE9E3, (q15_t)0x7C0F, (q15_t)0x161D, (q15_t)0x03E9, (q15_t)0xE9FA, (q15_t)0x7C17, (q15_t)0x1606,
+    (q15_t)0x03E0, (q15_t)0xEA12, (q15_t)0x7C20, (q15_t)0x15EE, (q15_t)0x03D7, (q15_t)0xEA29, (q15_t)0x7C29, (q15_t)0x15D7,
+    (q15_t)0x03CF, (q15_t)0xEA41, (q15_t)0x7C31, (q15_t)0x15BF, (q15_t)0x03C6, (q15_t)0xEA59, (q15_t)0x7C3A, (q15_t)0x15A7,
+    (q15_t)0x03BE, (q15_t)0xEA70, (q15_t)0x7C42, (q15_t)0x1590, (q15_t)0x03B5, (q15_t)0xEA88, (q15_t)0x7C4B, (q15_t)0x1578,
+    (q15_t)0x03AD, (q15_t)0xEAA0, (q15_t)0x7C53, (q15_t)0x1560, (q15_t)0x03A5, (q15_t)0xEAB7, (q15_t)0x7C5B, (q15_t)0x1549,
+    (q15_t)0x039C, (q15_t)0xEACF, (q15_t)0x7C64, (q15_t)0x1531, (q15_t)0x0394, (q15_t)0xEAE7, (q15_t)0x7C6C, (q15_t)0x1519,
+    (q15_t)0x038C, (q15_t)0xEAFF, (q15_t)0x7C74, (q15_t)0x1501, (q15_t)0x0383, (q15_t)0xEB16, (q15_t)0x7C7D, (q15_t)0x14EA,
+    (q15_t)0x037B, (q15_t)0xEB2E, (q15_t)0x7C85, (q15_t)0x14D2, (q15_t)0x0373, (q15_t)0xEB46, (q15_t)0x7C8D, (q15_t)0x14BA,
+    (q15_t)0x036B, (q15_t)0xEB5E, (q15_t)0x7C95, (q15_t)0x14A2, (q15_t)0x0363, (q15_t)0xEB75, (q15_t)0x7C9D, (q15_t)0x148B,
+    (q15_t)0x035B, (q15_t)0xEB8D, (q15_t)0x7CA5, (q15_t)0x1473, (q15_t)0x0353, (q15_t)0xEBA5, (q15_t)0x7CAD, (q15_t)0x145B,
+    (q15_t)0x034B, (q15_t)0xEBBD, (q15_t)0x7CB5, (q15_t)0x1443, (q15_t)0x0343, (q15_t)0xEBD5, (q15_t)0x7CBD, (q15_t)0x142B,
+    (q15_t)0x033B, (q15_t)0xEBED, (q15_t)0x7CC5, (q15_t)0x1413, (q15_t)0x0333, (q15_t)0xEC05, (q15_t)0x7CCD, (q15_t)0x13FB,
+    (q15_t)0x032B, (q15_t)0xEC1C, (q15_t)0x7CD5, (q15_t)0x13E4, (q15_t)0x0323, (q15_t)0xEC34, (q15_t)0x7CDD, (q15_t)0x13CC,
+    (q15_t)0x031C, (q15_t)0xEC4C, (q15_t)0x7CE4, (q15_t)0x13B4, (q15_t)0x0314, (q15_t)0xEC64, (q15_t)0x7CEC, (q15_t)0x139C,
+    (q15_t)0x030C, (q15_t)0xEC7C, (q15_t)0x7CF4, (q15_t)0x1384, (q15_t)0x0305, (q15_t)0xEC94, (q15_t)0x7CFB, (q15_t)0x136C,
+    (q15_t)0x02FD, (q15_t)0xECAC, (q15_t)0x7D03, (q15_t)0x1354, (q15_t)0x02F5, (q15_t)0xECC4, (q15_t)0x7D0B, (q15_t)0x133C,
+    (q15_t)0x02EE, (q15_t)0xECDC, (q15_t)0x7D12, (q15_t)0x1324, (q15_t)0x02E6, (q15_t)0xECF4, (q15_t)0x7D1A, (q15_t)0x130C,
+    (q15_t)0x02DF, (q15_t)0xED0C, (q15_t)0x7D21, (q15_t)0x12F4, (q15_t)0x02D8, (q15_t)0xED24, (q15_t)0x7D28, (q15_t)0x12DC,
+    (q15_t)0x02D0, (q15_t)0xED3C, (q15_t)0x7D30, (q15_t)0x12C4, (q15_t)0x02C9, (q15_t)0xED54, (q15_t)0x7D37, (q15_t)0x12AC,
+    (q15_t)0x02C1, (q15_t)0xED6C, (q15_t)0x7D3F, (q15_t)0x1294, (q15_t)0x02BA, (q15_t)0xED84, (q15_t)0x7D46, (q15_t)0x127C,
+    (q15_t)0x02B3, (q15_t)0xED9C, (q15_t)0x7D4D, (q15_t)0x1264, (q15_t)0x02AC, (q15_t)0xEDB4, (q15_t)0x7D54, (q15_t)0x124C,
+    (q15_t)0x02A5, (q15_t)0xEDCC, (q15_t)0x7D5B, (q15_t)0x1234, (q15_t)0x029D, (q15_t)0xEDE4, (q15_t)0x7D63, (q15_t)0x121C,
+    (q15_t)0x0296, (q15_t)0xEDFC, (q15_t)0x7D6A, (q15_t)0x1204, (q15_t)0x028F, (q15_t)0xEE15, (q15_t)0x7D71, (q15_t)0x11EB,
+    (q15_t)0x0288, (q15_t)0xEE2D, (q15_t)0x7D78, (q15_t)0x11D3, (q15_t)0x0281, (q15_t)0xEE45, (q15_t)0x7D7F, (q15_t)0x11BB,
+    (q15_t)0x027A, (q15_t)0xEE5D, (q15_t)0x7D86, (q15_t)0x11A3, (q15_t)0x0273, (q15_t)0xEE75, (q15_t)0x7D8D, (q15_t)0x118B,
+    (q15_t)0x026D, (q15_t)0xEE8D, (q15_t)0x7D93, (q15_t)0x1173, (q15_t)0x0266, (q15_t)0xEEA6, (q15_t)0x7D9A, (q15_t)0x115A,
+    (q15_t)0x025F, (q15_t)0xEEBE, (q15_t)0x7DA1, (q15_t)0x1142, (q15_t)0x0258, (q15_t)0xEED6, (q15_t)0x7DA8, (q15_t)0x112A,
+    (q15_t)0x0251, (q15_t)0xEEEE, (q15_t)0x7DAF, (q15_t)0x1112, (q15_t)0x024B, (q15_t)0xEF06, (q15_t)0x7DB5, (q15_t)0x10FA,
+    (q15_t)0x0244, (q15_t)0xEF1F, (q15_t)0x7DBC, (q15_t)0x10E1, (q15_t)0x023E, (q15_t)0xEF37, (q15_t)0x7DC2, (q15_t)0x10C9,
+    (q15_t)0x0237, (q15_t)0xEF4F, (q15_t)0x7DC9, (q15_t)0x10B1, (q15_t)0x0230, (q15_t)0xEF67, (q15_t)0x7DD0, (q15_t)0x1099,
+    (q15_t)0x022A, (q15_t)0xEF80, (q15_t)0x7DD6, (q15_t)0x1080, (q15_t)0x0223, (q15_t)0xEF98, (q15_t)0x7DDD, (q15_t)0x1068,
+    (q15_t)0x021D, (q15_t)0xEFB0, (q15_t)0x7DE3, (q15_t)0x1050, (q15_t)0x0217, (q15_t)0xEFC9, (q15_t)0x7DE9, (q15_t)0x1037,
+    (q15_t)0x0210, (q15_t)0xEFE1, (q15_t)0x7DF0, (q15_t)0x101F, (q15_t)0x020A, (q15_t)0xEFF9, (q15_t)0x7DF6, (q15_t)0x1007,
+    (q15_t)0x0204, (q15_t)0xF012, (q15_t)0x7DFC, (q15_t)0x0FEE, (q15_t)0x01FD, (q15_t)0xF02A, (q15_t)0x7E03, (q15_t)0x0FD6,
+    (q15_t)0x01F7, (q15_t)0xF042, (q15_t)0x7E09, (q15_t)0x0FBE, (q15_t)0x01F1, (q15_t)0xF05B, (q15_t)0x7E0F, (q15_t)0x0FA5,
+    (q15_t)0x01EB, (q15_t)0xF073, (q15_t)0x7E15, (q15_t)0x0F8D, (q15_t)0x01E5, (q15_t)0xF08B, (q15_t)0x7E1B, (q15_t)0x0F75,
+    (q15_t)0x01DF, (q15_t)0xF0A4, (q15_t)0x7E21, (q15_t)0x0F5C, (q15_t)0x01D9, (q15_t)0xF0BC, (q15_t)0x7E27, (q15_t)0x0F44,
+    (q15_t)0x01D3, (q15_t)0xF0D5, (q15_t)0x7E2D, (q15_t)0x0F2B, (q15_t)0x01CD, (q15_t)0xF0ED, (q15_t)0x7E33, (q15_t)0x0F13,
+    (q15_t)0x01C7, (q15_t)0xF105, (q15_t)0x7E39, (q15_t)0x0EFB, (q15_t)0x01C1, (q15_t)0xF11E, (q15_t)0x7E3F, (q15_t)0x0EE2,
+    (q15_t)0x01BB, (q15_t)0xF136, (q15_t)0x7E45, (q15_t)0x0ECA, (q15_t)0x01B6, (q15_t)0xF14F, (q15_t)0x7E4A, (q15_t)0x0EB1,
+    (q15_t)0x01B0, (q15_t)0xF167, (q15_t)0x7E50, (q15_t)0x0E99, (q15_t)0x01AA, (q15_t)0xF180, (q15_t)0x7E56, (q15_t)0x0E80,
+    (q15_t)0x01A4, (q15_t)0xF198, (q15_t)0x7E5C, (q15_t)0x0E68, (q15_t)0x019F, (q15_t)0xF1B1, (q15_t)0x7E61, (q15_t)0x0E4F,
+    (q15_t)0x0199, (q15_t)0xF1C9, (q15_t)0x7E67, (q15_t)0x0E37, (q15_t)0x0194, (q15_t)0xF1E2, (q15_t)0x7E6C, (q15_t)0x0E1E,
+    (q15_t)0x018E, (q15_t)0xF1FA, (q15_t)0x7E72, (q15_t)0x0E06, (q15_t)0x0189, (q15_t)0xF213, (q15_t)0x7E77, (q15_t)0x0DED,
+    (q15_t)0x0183, (q15_t)0xF22B, (q15_t)0x7E7D, (q15_t)0x0DD5, (q15_t)0x017E, (q15_t)0xF244, (q15_t)0x7E82, (q15_t)0x0DBC,
+    (q15_t)0x0178, (q15_t)0xF25C, (q15_t)0x7E88, (q15_t)0x0DA4, (q15_t)0x0173, (q15_t)0xF275, (q15_t)0x7E8D, (q15_t)0x0D8B,
+    (q15_t)0x016E, (q15_t)0xF28E, (q15_t)0x7E92, (q15_t)0x0D72, (q15_t)0x0168, (q15_t)0xF2A6, (q15_t)0x7E98, (q15_t)0x0D5A,
+    (q15_t)0x0163, (q15_t)0xF2BF, (q15_t)0x7E9D, (q15_t)0x0D41, (q15_t)0x015E, (q15_t)0xF2D7, (q15_t)0x7EA2, (q15_t)0x0D29,
+    (q15_t)0x0159, (q15_t)0xF2F0, (q15_t)0x7EA7, (q15_t)0x0D10, (q15_t)0x0154, (q15_t)0xF308, (q15_t)0x7EAC, (q15_t)0x0CF8,
+    (q15_t)0x014F, (q15_t)0xF321, (q15_t)0x7EB1, (q15_t)0x0CDF, (q15_t)0x014A, (q15_t)0xF33A, (q15_t)0x7EB6, (q15_t)0x0CC6,
+    (q15_t)0x0145, (q15_t)0xF352, (q15_t)0x7EBB, (q15_t)0x0CAE, (q15_t)0x0140, (q15_t)0xF36B, (q15_t)0x7EC0, (q15_t)0x0C95,
+    (q15_t)0x013B, (q15_t)0xF384, (q15_t)0x7EC5, (q15_t)0x0C7C, (q15_t)0x0136, (q15_t)0xF39C, (q15_t)0x7ECA, (q15_t)0x0C64,
+    (q15_t)0x0131, (q15_t)0xF3B5, (q15_t)0x7ECF, (q15_t)0x0C4B, (q15_t)0x012C, (q15_t)0xF3CE, (q15_t)0x7ED4, (q15_t)0x0C32,
+    (q15_t)0x0128, (q15_t)0xF3E6, (q15_t)0x7ED8, (q15_t)0x0C1A, (q15_t)0x0123, (q15_t)0xF3FF, (q15_t)0x7EDD, (q15_t)0x0C01,
+    (q15_t)0x011E, (q15_t)0xF418, (q15_t)0x7EE2, (q15_t)0x0BE8, (q15_t)0x0119, (q15_t)0xF430, (q15_t)0x7EE7, (q15_t)0x0BD0,
+    (q15_t)0x0115, (q15_t)0xF449, (q15_t)0x7EEB, (q15_t)0x0BB7, (q15_t)0x0110, (q15_t)0xF462, (q15_t)0x7EF0, (q15_t)0x0B9E,
+    (q15_t)0x010C, (q15_t)0xF47B, (q15_t)0x7EF4, (q15_t)0x0B85, (q15_t)0x0107, (q15_t)0xF493, (q15_t)0x7EF9, (q15_t)0x0B6D,
+    (q15_t)0x0103, (q15_t)0xF4AC, (q15_t)0x7EFD, (q15_t)0x0B54, (q15_t)0x00FE, (q15_t)0xF4C5, (q15_t)0x7F02, (q15_t)0x0B3B,
+    (q15_t)0x00FA, (q15_t)0xF4DD, (q15_t)0x7F06, (q15_t)0x0B23, (q15_t)0x00F6, (q15_t)0xF4F6, (q15_t)0x7F0A, (q15_t)0x0B0A,
+    (q15_t)0x00F1, (q15_t)0xF50F, (q15_t)0x7F0F, (q15_t)0x0AF1, (q15_t)0x00ED, (q15_t)0xF528, (q15_t)0x7F13, (q15_t)0x0AD8,
+    (q15_t)0x00E9, (q15_t)0xF540, (q15_t)0x7F17, (q15_t)0x0AC0, (q15_t)0x00E4, (q15_t)0xF559, (q15_t)0x7F1C, (q15_t)0x0AA7,
+    (q15_t)0x00E0, (q15_t)0xF572, (q15_t)0x7F20, (q15_t)0x0A8E, (q15_t)0x00DC, (q15_t)0xF58B, (q15_t)0x7F24, (q15_t)0x0A75,
+    (q15_t)0x00D8, (q15_t)0xF5A4, (q15_t)0x7F28, (q15_t)0x0A5C, (q15_t)0x00D4, (q15_t)0xF5BC, (q15_t)0x7F2C, (q15_t)0x0A44,
+    (q15_t)0x00D0, (q15_t)0xF5D5, (q15_t)0x7F30, (q15_t)0x0A2B, (q15_t)0x00CC, (q15_t)0xF5EE, (q15_t)0x7F34, (q15_t)0x0A12,
+    (q15_t)0x00C8, (q15_t)0xF607, (q15_t)0x7F38, (q15_t)0x09F9, (q15_t)0x00C4, (q15_t)0xF620, (q15_t)0x7F3C, (q15_t)0x09E0,
+    (q15_t)0x00C0, (q15_t)0xF639, (q15_t)0x7F40, (q15_t)0x09C7, (q15_t)0x00BD, (q15_t)0xF651, (q15_t)0x7F43, (q15_t)0x09AF,
+    (q15_t)0x00B9, (q15_t)0xF66A, (q15_t)0x7F47, (q15_t)0x0996, (q15_t)0x00B5, (q15_t)0xF683, (q15_t)0x7F4B, (q15_t)0x097D,
+    (q15_t)0x00B1, (q15_t)0xF69C, (q15_t)0x7F4F, (q15_t)0x0964, (q15_t)0x00AE, (q15_t)0xF6B5, (q15_t)0x7F52, (q15_t)0x094B,
+    (q15_t)0x00AA, (q15_t)0xF6CE, (q15_t)0x7F56, (q15_t)0x0932, (q15_t)0x00A6, (q15_t)0xF6E7, (q15_t)0x7F5A, (q15_t)0x0919,
+    (q15_t)0x00A3, (q15_t)0xF6FF, (q15_t)0x7F5D, (q15_t)0x0901, (q15_t)0x009F, (q15_t)0xF718, (q15_t)0x7F61, (q15_t)0x08E8,
+    (q15_t)0x009C, (q15_t)0xF731, (q15_t)0x7F64, (q15_t)0x08CF, (q15_t)0x0098, (q15_t)0xF74A, (q15_t)0x7F68, (q15_t)0x08B6,
+    (q15_t)0x0095, (q15_t)0xF763, (q15_t)0x7F6B, (q15_t)0x089D, (q15_t)0x0092, (q15_t)0xF77C, (q15_t)0x7F6E, (q15_t)0x0884,
+    (q15_t)0x008E, (q15_t)0xF795, (q15_t)0x7F72, (q15_t)0x086B, (q15_t)0x008B, (q15_t)0xF7AE, (q15_t)0x7F75, (q15_t)0x0852,
+    (q15_t)0x0088, (q15_t)0xF7C7, (q15_t)0x7F78, (q15_t)0x0839, (q15_t)0x0085, (q15_t)0xF7E0, (q15_t)0x7F7B, (q15_t)0x0820,
+    (q15_t)0x0081, (q15_t)0xF7F9, (q15_t)0x7F7F, (q15_t)0x0807, (q15_t)0x007E, (q15_t)0xF811, (q15_t)0x7F82, (q15_t)0x07EF,
+    (q15_t)0x007B, (q15_t)0xF82A, (q15_t)0x7F85, (q15_t)0x07D6, (q15_t)0x0078, (q15_t)0xF843, (q15_t)0x7F88, (q15_t)0x07BD,
+    (q15_t)0x0075, (q15_t)0xF85C, (q15_t)0x7F8B, (q15_t)0x07A4, (q15_t)0x0072, (q15_t)0xF875, (q15_t)0x7F8E, (q15_t)0x078B,
+    (q15_t)0x006F, (q15_t)0xF88E, (q15_t)0x7F91, (q15_t)0x0772, (q15_t)0x006C, (q15_t)0xF8A7, (q15_t)0x7F94, (q15_t)0x0759,
+    (q15_t)0x0069, (q15_t)0xF8C0, (q15_t)0x7F97, (q15_t)0x0740, (q15_t)0x0067, (q15_t)0xF8D9, (q15_t)0x7F99, (q15_t)0x0727,
+    (q15_t)0x0064, (q15_t)0xF8F2, (q15_t)0x7F9C, (q15_t)0x070E, (q15_t)0x0061, (q15_t)0xF90B, (q15_t)0x7F9F, (q15_t)0x06F5,
+    (q15_t)0x005E, (q15_t)0xF924, (q15_t)0x7FA2, (q15_t)0x06DC, (q15_t)0x005C, (q15_t)0xF93D, (q15_t)0x7FA4, (q15_t)0x06C3,
+    (q15_t)0x0059, (q15_t)0xF956, (q15_t)0x7FA7, (q15_t)0x06AA, (q15_t)0x0056, (q15_t)0xF96F, (q15_t)0x7FAA, (q15_t)0x0691,
+    (q15_t)0x0054, (q15_t)0xF988, (q15_t)0x7FAC, (q15_t)0x0678, (q15_t)0x0051, (q15_t)0xF9A1, (q15_t)0x7FAF, (q15_t)0x065F,
+    (q15_t)0x004F, (q15_t)0xF9BA, (q15_t)0x7FB1, (q15_t)0x0646, (q15_t)0x004C, (q15_t)0xF9D3, (q15_t)0x7FB4, (q15_t)0x062D,
+    (q15_t)0x004A, (q15_t)0xF9EC, (q15_t)0x7FB6, (q15_t)0x0614, (q15_t)0x0048, (q15_t)0xFA05, (q15_t)0x7FB8, (q15_t)0x05FB,
+    (q15_t)0x0045, (q15_t)0xFA1E, (q15_t)0x7FBB, (q15_t)0x05E2, (q15_t)0x0043, (q15_t)0xFA37, (q15_t)0x7FBD, (q15_t)0x05C9,
+    (q15_t)0x0041, (q15_t)0xFA50, (q15_t)0x7FBF, (q15_t)0x05B0, (q15_t)0x003F, (q15_t)0xFA69, (q15_t)0x7FC1, (q15_t)0x0597,
+    (q15_t)0x003C, (q15_t)0xFA82, (q15_t)0x7FC4, (q15_t)0x057E, (q15_t)0x003A, (q15_t)0xFA9B, (q15_t)0x7FC6, (q15_t)0x0565,
+    (q15_t)0x0038, (q15_t)0xFAB4, (q15_t)0x7FC8, (q15_t)0x054C, (q15_t)0x0036, (q15_t)0xFACD, (q15_t)0x7FCA, (q15_t)0x0533,
+    (q15_t)0x0034, (q15_t)0xFAE6, (q15_t)0x7FCC, (q15_t)0x051A, (q15_t)0x0032, (q15_t)0xFB00, (q15_t)0x7FCE, (q15_t)0x0500,
+    (q15_t)0x0030, (q15_t)0xFB19, (q15_t)0x7FD0, (q15_t)0x04E7, (q15_t)0x002E, (q15_t)0xFB32, (q15_t)0x7FD2, (q15_t)0x04CE,
+    (q15_t)0x002C, (q15_t)0xFB4B, (q15_t)0x7FD4, (q15_t)0x04B5, (q15_t)0x002B, (q15_t)0xFB64, (q15_t)0x7FD5, (q15_t)0x049C,
+    (q15_t)0x0029, (q15_t)0xFB7D, (q15_t)0x7FD7, (q15_t)0x0483, (q15_t)0x0027, (q15_t)0xFB96, (q15_t)0x7FD9, (q15_t)0x046A,
+    (q15_t)0x0025, (q15_t)0xFBAF, (q15_t)0x7FDB, (q15_t)0x0451, (q15_t)0x0024, (q15_t)0xFBC8, (q15_t)0x7FDC, (q15_t)0x0438,
+    (q15_t)0x0022, (q15_t)0xFBE1, (q15_t)0x7FDE, (q15_t)0x041F, (q15_t)0x0020, (q15_t)0xFBFA, (q15_t)0x7FE0, (q15_t)0x0406,
+    (q15_t)0x001F, (q15_t)0xFC13, (q15_t)0x7FE1, (q15_t)0x03ED, (q15_t)0x001D, (q15_t)0xFC2C, (q15_t)0x7FE3, (q15_t)0x03D4,
+    (q15_t)0x001C, (q15_t)0xFC45, (q15_t)0x7FE4, (q15_t)0x03BB, (q15_t)0x001A, (q15_t)0xFC5F, (q15_t)0x7FE6, (q15_t)0x03A1,
+    (q15_t)0x0019, (q15_t)0xFC78, (q15_t)0x7FE7, (q15_t)0x0388, (q15_t)0x0018, (q15_t)0xFC91, (q15_t)0x7FE8, (q15_t)0x036F,
+    (q15_t)0x0016, (q15_t)0xFCAA, (q15_t)0x7FEA, (q15_t)0x0356, (q15_t)0x0015, (q15_t)0xFCC3, (q15_t)0x7FEB, (q15_t)0x033D,
+    (q15_t)0x0014, (q15_t)0xFCDC, (q15_t)0x7FEC, (q15_t)0x0324, (q15_t)0x0013, (q15_t)0xFCF5, (q15_t)0x7FED, (q15_t)0x030B,
+    (q15_t)0x0011, (q15_t)0xFD0E, (q15_t)0x7FEF, (q15_t)0x02F2, (q15_t)0x0010, (q15_t)0xFD27, (q15_t)0x7FF0, (q15_t)0x02D9,
+    (q15_t)0x000F, (q15_t)0xFD40, (q15_t)0x7FF1, (q15_t)0x02C0, (q15_t)0x000E, (q15_t)0xFD5A, (q15_t)0x7FF2, (q15_t)0x02A6,
+    (q15_t)0x000D, (q15_t)0xFD73, (q15_t)0x7FF3, (q15_t)0x028D, (q15_t)0x000C, (q15_t)0xFD8C, (q15_t)0x7FF4, (q15_t)0x0274,
+    (q15_t)0x000B, (q15_t)0xFDA5, (q15_t)0x7FF5, (q15_t)0x025B, (q15_t)0x000A, (q15_t)0xFDBE, (q15_t)0x7FF6, (q15_t)0x0242,
+    (q15_t)0x0009, (q15_t)0xFDD7, (q15_t)0x7FF7, (q15_t)0x0229, (q15_t)0x0009, (q15_t)0xFDF0, (q15_t)0x7FF7, (q15_t)0x0210,
+    (q15_t)0x0008, (q15_t)0xFE09, (q15_t)0x7FF8, (q15_t)0x01F7, (q15_t)0x0007, (q15_t)0xFE23, (q15_t)0x7FF9, (q15_t)0x01DD,
+    (q15_t)0x0006, (q15_t)0xFE3C, (q15_t)0x7FFA, (q15_t)0x01C4, (q15_t)0x0006, (q15_t)0xFE55, (q15_t)0x7FFA, (q15_t)0x01AB,
+    (q15_t)0x0005, (q15_t)0xFE6E, (q15_t)0x7FFB, (q15_t)0x0192, (q15_t)0x0004, (q15_t)0xFE87, (q15_t)0x7FFC, (q15_t)0x0179,
+    (q15_t)0x0004, (q15_t)0xFEA0, (q15_t)0x7FFC, (q15_t)0x0160, (q15_t)0x0003, (q15_t)0xFEB9, (q15_t)0x7FFD, (q15_t)0x0147,
+    (q15_t)0x0003, (q15_t)0xFED2, (q15_t)0x7FFD, (q15_t)0x012E, (q15_t)0x0002, (q15_t)0xFEEC, (q15_t)0x7FFE, (q15_t)0x0114,
+    (q15_t)0x0002, (q15_t)0xFF05, (q15_t)0x7FFE, (q15_t)0x00FB, (q15_t)0x0002, (q15_t)0xFF1E, (q15_t)0x7FFE, (q15_t)0x00E2,
+    (q15_t)0x0001, (q15_t)0xFF37, (q15_t)0x7FFF, (q15_t)0x00C9, (q15_t)0x0001, (q15_t)0xFF50, (q15_t)0x7FFF, (q15_t)0x00B0,
+    (q15_t)0x0001, (q15_t)0xFF69, (q15_t)0x7FFF, (q15_t)0x0097, (q15_t)0x0000, (q15_t)0xFF82, (q15_t)0x7FFF, (q15_t)0x007E,
+    (q15_t)0x0000, (q15_t)0xFF9B, (q15_t)0x7FFF, (q15_t)0x0065, (q15_t)0x0000, (q15_t)0xFFB5, (q15_t)0x7FFF, (q15_t)0x004B,
+    (q15_t)0x0000, (q15_t)0xFFCE, (q15_t)0x7FFF, (q15_t)0x0032, (q15_t)0x0000, (q15_t)0xFFE7, (q15_t)0x7FFF, (q15_t)0x0019,
+    (q15_t)0x0000, (q15_t)0x0000, (q15_t)0x7FFF, (q15_t)0x0000
+};
+
+/* 8192-point RFFT */
+const q15_t rfftSplitQ15_8192[8196] RFFT_Q15_ALIGN =
+{
+    (q15_t)0x4000, (q15_t)0xC000, (q15_t)0x4000, (q15_t)0x4000, (q15_t)0x3FF3, (q15_t)0xC000, (q15_t)0x400D, (q15_t)0x4000,
+    (q15_t)0x3FE7, (q15_t)0xC000, (q15_t)0x4019, (q15_t)0x4000, (q15_t)0x3FDA, (q15_t)0xC000, (q15_t)0x4026, (q15_t)0x4000,
+    (q15_t)0x3FCE, (q15_t)0xC000, (q15_t)0x4032, (q15_t)0x4000, (q15_t)0x3FC1, (q15_t)0xC000, (q15_t)0x403F, (q15_t)0x4000,
+    (q15_t)0x3FB5, (q15_t)0xC000, (q15_t)0x404B, (q15_t)0x4000, (q15_t)0x3FA8, (q15_t)0xC000, (q15_t)0x4058, (q15_t)0x4000,
+    (q15_t)0x3F9B, (q15_t)0xC000, (q15_t)0x4065, (q15_t)0x4000, (q15_t)0x3F8F, (q15_t)0xC000, (q15_t)0x4071, (q15_t)0x4000,
+    (q15_t)0x3F82, (q15_t)0xC000, (q15_t)0x407E, (q15_t)0x4000, (q15_t)0x3F76, (q15_t)0xC001, (q15_t)0x408A, (q15_t)0x3FFF,
+    (q15_t)0x3F69, (q15_t)0xC001, (q15_t)0x4097, (q15_t)0x3FFF, (q15_t)0x3F5D, (q15_t)0xC001, (q15_t)0x40A3, (q15_t)0x3FFF,
+    (q15_t)0x3F50, (q15_t)0xC001, (q15_t)0x40B0, (q15_t)0x3FFF, (q15_t)0x3F44, (q15_t)0xC001, (q15_t)0x40BC, (q15_t)0x3FFF,
+    (q15_t)0x3F37, (q15_t)0xC001, (q15_t)0x40C9, (q15_t)0x3FFF, (q15_t)0x3F2A, (q15_t)0xC001, (q15_t)0x40D6, (q15_t)0x3FFF,
+    (q15_t)0x3F1E, (q15_t)0xC002, (q15_t)0x40E2, (q15_t)0x3FFE, (q15_t)0x3F11, (q15_t)0xC002, (q15_t)0x40EF, (q15_t)0x3FFE,
+    (q15_t)0x3F05, (q15_t)0xC002, (q15_t)0x40FB, (q15_t)0x3FFE, (q15_t)0x3EF8, (q15_t)0xC002, (q15_t)0x4108, (q15_t)0x3FFE,
+    (q15_t)0x3EEC, (q15_t)0xC002, (q15_t)0x4114, (q15_t)0x3FFE, (q15_t)0x3EDF, (q15_t)0xC003, (q15_t)0x4121, (q15_t)0x3FFD,
+    (q15_t)0x3ED2, (q15_t)0xC003, (q15_t)0x412E, (q15_t)0x3FFD, (q15_t)0x3EC6, (q15_t)0xC003, (q15_t)0x413A, (q15_t)0x3FFD,
+    (q15_t)0x3EB9, (q15_t)0xC003, (q15_t)0x4147, (q15_t)0x3FFD, (q15_t)0x3EAD, (q15_t)0xC004, (q15_t)0x4153, (q15_t)0x3FFC,
+    (q15_t)0x3EA0, (q15_t)0xC004, (q15_t)0x4160, (q15_t)0x3FFC, (q15_t)0x3E94, (q15_t)0xC004, (q15_t)0x416C, (q15_t)0x3FFC,
+    (q15_t)0x3E87, (q15_t)0xC004, (q15_t)0x4179, (q15_t)0x3FFC, (q15_t)0x3E7A, (q15_t)0xC005, (q15_t)0x4186, (q15_t)0x3FFB,
+    (q15_t)0x3E6E, (q15_t)0xC005, (q15_t)0x4192, (q15_t)0x3FFB, (q15_t)0x3E61, (q15_t)0xC005, (q15_t)0x419F, (q15_t)0x3FFB,
+    (q15_t)0x3E55, (q15_t)0xC006, (q15_t)0x41AB, (q15_t)0x3FFA, (q15_t)0x3E48, (q15_t)0xC006, (q15_t)0x41B8, (q15_t)0x3FFA,
+    (q15_t)0x3E3C, (q15_t)0xC006, (q15_t)0x41C4, (q15_t)0x3FFA, (q15_t)0x3E2F, (q15_t)0xC007, (q15_t)0x41D1, (q15_t)0x3FF9,
+    (q15_t)0x3E23, (q15_t)0xC007, (q15_t)0x41DD, (q15_t)0x3FF9, (q15_t)0x3E16, (q15_t)0xC007, (q15_t)0x41EA, (q15_t)0x3FF9,
+    (q15_t)0x3E09, (q15_t)0xC008, (q15_t)0x41F7, (q15_t)0x3FF8, (q15_t)0x3DFD, (q15_t)0xC008, (q15_t)0x4203, (q15_t)0x3FF8,
+    (q15_t)0x3DF0, (q15_t)0xC009, (q15_t)0x4210, (q15_t)0x3FF7, (q15_t)0x3DE4, (q15_t)0xC009, (q15_t)0x421C, (q15_t)0x3FF7,
+    (q15_t)0x3DD7, (q15_t)0xC009, (q15_t)0x4229, (q15_t)0x3FF7, (q15_t)0x3DCB, (q15_t)0xC00A, (q15_t)0x4235, (q15_t)0x3FF6,
+    (q15_t)0x3DBE, (q15_t)0xC00A, (q15_t)0x4242, (q15_t)0x3FF6, (q15_t)0x3DB2, (q15_t)0xC00B, (q15_t)0x424E, (q15_t)0x3FF5,
+    (q15_t)0x3DA5, (q15_t)0xC00B, (q15_t)0x425B, (q15_t)0x3FF5, (q15_t)0x3D98, (q15_t)0xC00C, (q15_t)0x4268, (q15_t)0x3FF4,
+    (q15_t)0x3D8C, (q15_t)0xC00C, (q15_t)0x4274, (q15_t)0x3FF4, (q15_t)0x3D7F, (q15_t)0xC00D, (q15_t)0x4281, (q15_t)0x3FF3,
+    (q15_t)0x3D73, (q15_t)0xC00D, (q15_t)0x428D, (q15_t)0x3FF3, (q15_t)0x3D66, (q15_t)0xC00E, (q15_t)0x429A, (q15_t)0x3FF2,
+    (q15_t)0x3D5A, (q15_t)0xC00E, (q15_t)0x42A6, (q15_t)0x3FF2, (q15_t)0x3D4D, (q15_t)0xC00F, (q15_t)0x42B3, (q15_t)0x3FF1,
+    (q15_t)0x3D40, (q15_t)0xC00F, (q15_t)0x42C0, (q15_t)0x3FF1, (q15_t)0x3D34, (q15_t)0xC010, (q15_t)0x42CC, (q15_t)0x3FF0,
+    (q15_t)0x3D27, (q15_t)0xC010, (q15_t)0x42D9, (q15_t)0x3FF0, (q15_t)0x3D1B, (q15_t)0xC011, (q15_t)0x42E5, (q15_t)0x3FEF,
+    (q15_t)0x3D0E, (q15_t)0xC011, (q15_t)0x42F2, (q15_t)0x3FEF, (q15_t)0x3D02, (q15_t)0xC012, (q15_t)0x42FE, (q15_t)0x3FEE,
+    (q15_t)0x3CF5, (q15_t)0xC013, (q15_t)0x430B, (q15_t)0x3FED, (q15_t)0x3CE9, (q15_t)0xC013, (q15_t)0x4317, (q15_t)0x3FED,
+    (q15_t)0x3CDC, (q15_t)0xC014, (q15_t)0x4324, (q15_t)0x3FEC, (q15_t)0x3CD0, (q15_t)0xC014, (q15_t)0x4330, (q15_t)0x3FEC,
+    (q15_t)0x3CC3, (q15_t)0xC015, (q15_t)0x433D, (q15_t)0x3FEB, (q15_t)0x3CB6, (q15_t)0xC016, (q15_t)0x434A, (q15_t)0x3FEA,
+    (q15_t)0x3CAA, (q15_t)0xC016, (q15_t)0x4356, (q15_t)0x3FEA, (q15_t)0x3C9D, (q15_t)0xC017, (q15_t)0x4363, (q15_t)0x3FE9,
+    (q15_t)0x3C91, (q15_t)0xC018, (q15_t)0x436F, (q15_t)0x3FE8, (q15_t)0x3C84, (q15_t)0xC018, (q15_t)0x437C, (q15_t)0x3FE8,
+    (q15_t)0x3C78, (q15_t)0xC019, (q15_t)0x4388, (q15_t)0x3FE7, (q15_t)0x3C6B, (q15_t)0xC01A, (q15_t)0x4395, (q15_t)0x3FE6,
+    (q15_t)0x3C5F, (q15_t)0xC01A, (q15_t)0x43A1, (q15_t)0x3FE6, (q15_t)0x3C52, (q15_t)0xC01B, (q15_t)0x43AE, (q15_t)0x3FE5,
+    (q15_t)0x3C45, (q15_t)0xC01C, (q15_t)0x43BB, (q15_t)0x3FE4, (q15_t)0x3C39, (q15_t)0xC01D, (q15_t)0x43C7, (q15_t)0x3FE3,
+    (q15_t)0x3C2C, (q15_t)0xC01D, (q15_t)0x43D4, (q15_t)0x3FE3, (q15_t)0x3C20, (q15_t)0xC01E, (q15_t)0x43E0, (q15_t)0x3FE2,
+    (q15_t)0x3C13, (q15_t)0xC01F, (q15_t)0x43ED, (q15_t)0x3FE1, (q15_t)0x3C07, (q15_t)0xC020, (q15_t)0x43F9, (q15_t)0x3FE0,
+    (q15_t)0x3BFA, (q15_t)0xC020, (q15_t)0x4406, (q15_t)0x3FE0, (q15_t)0x3BEE, (q15_t)0xC021, (q15_t)0x4412, (q15_t)0x3FDF,
+    (q15_t)0x3BE1, (q15_t)0xC022, (q15_t)0x441F, (q15_t)0x3FDE, (q15_t)0x3BD5, (q15_t)0xC023, (q15_t)0x442B, (q15_t)0x3FDD,
+    (q15_t)0x3BC8, (q15_t)0xC024, (q15_t)0x4438, (q15_t)0x3FDC, (q15_t)0x3BBC, (q15_t)0xC024, (q15_t)0x4444, (q15_t)0x3FDC,
+    (q15_t)0x3BAF, (q15_t)0xC025, (q15_t)0x4451, (q15_t)0x3FDB, (q15_t)0x3BA2, (q15_t)0xC026, (q15_t)0x445E, (q15_t)0x3FDA,
+    (q15_t)0x3B96, (q15_t)0xC027, (q15_t)0x446A, (q15_t)0x3FD9, (q15_t)0x3B89, (q15_t)0xC028, (q15_t)0x4477, (q15_t)0x3FD8,
+    (q15_t)0x3B7D, (q15_t)0xC029, (q15_t)0x4483, (q15_t)0x3FD7, (q15_t)0x3B70, (q15_t)0xC02A, (q15_t)0x4490, (q15_t)0x3FD6,
+    (q15_t)0x3B64, (q15_t)0xC02B, (q15_t)0x449C, (q15_t)0x3FD5, (q15_t)0x3B57, (q15_t)0xC02B, (q15_t)0x44A9, (q15_t)0x3FD5,
+    (q15_t)0x3B4B, (q15_t)0xC02C, (q15_t)0x44B5, (q15_t)0x3FD4, (q15_t)0x3B3E, (q15_t)0xC02D, (q15_t)0x44C2, (q15_t)0x3FD3,
+    (q15_t)0x3B32, (q15_t)0xC02E, (q15_t)0x44CE, (q15_t)0x3FD2, (q15_t)0x3B25, (q15_t)0xC02F, (q15_t)0x44DB, (q15_t)0x3FD1,
+    (q15_t)0x3B19, (q15_t)0xC030, (q15_t)0x44E7, (q15_t)0x3FD0, (q15_t)0x3B0C, (q15_t)0xC031, (q15_t)0x44F4, (q15_t)0x3FCF,
+    (q15_t)0x3B00, (q15_t)0xC032, (q15_t)0x4500, (q15_t)0x3FCE, (q15_t)0x3AF3, (q15_t)0xC033, (q15_t)0x450D, (q15_t)0x3FCD,
+    (q15_t)0x3AE6, (q15_t)0xC034, (q15_t)0x451A, (q15_t)0x3FCC, (q15_t)0x3ADA, (q15_t)0xC035, (q15_t)0x4526, (q15_t)0x3FCB,
+    (q15_t)0x3ACD, (q15_t)0xC036, (q15_t)0x4533, (q15_t)0x3FCA, (q15_t)0x3AC1, (q15_t)0xC037, (q15_t)0x453F, (q15_t)0x3FC9,
+    (q15_t)0x3AB4, (q15_t)0xC038, (q15_t)0x454C, (q15_t)0x3FC8, (q15_t)0x3AA8, (q15_t)0xC039, (q15_t)0x4558, (q15_t)0x3FC7,
+    (q15_t)0x3A9B, (q15_t)0xC03A, (q15_t)0x4565, (q15_t)0x3FC6, (q15_t)0x3A8F, (q15_t)0xC03B, (q15_t)0x4571, (q15_t)0x3FC5,
+    (q15_t)0x3A82, (q15_t)0xC03C, (q15_t)0x457E, (q15_t)0x3FC4, (q15_t)0x3A76, (q15_t)0xC03D, (q15_t)0x458A, (q15_t)0x3FC3,
+    (q15_t)0x3A69, (q15_t)0xC03F, (q15_t)0x4597, (q15_t)0x3FC1, (q15_t)0x3A5D, (q15_t)0xC040, (q15_t)0x45A3, (q15_t)0x3FC0,
+    (q15_t)0x3A50, (q15_t)0xC041, (q15_t)0x45B0, (q15_t)0x3FBF, (q15_t)0x3A44, (q15_t)0xC042, (q15_t)0x45BC, (q15_t)0x3FBE,
+    (q15_t)0x3A37, (q15_t)0xC043, (q15_t)0x45C9, (q15_t)0x3FBD, (q15_t)0x3A2B, (q15_t)0xC044, (q15_t)0x45D5, (q15_t)0x3FBC,
+    (q15_t)0x3A1E, (q15_t)0xC045, (q15_t)0x45E2, (q15_t)0x3FBB, (q15_t)0x3A12, (q15_t)0xC047, (q15_t)0x45EE, (q15_t)0x3FB9,
+    (q15_t)0x3A05, (q15_t)0xC048, (q15_t)0x45FB, (q15_t)0x3FB8, (q15_t)0x39F9, (q15_t)0xC049, (q15_t)0x4607, (q15_t)0x3FB7,
+    (q15_t)0x39EC, (q15_t)0xC04A, (q15_t)0x4614, (q15_t)0x3FB6, (q15_t)0x39E0, (q15_t)0xC04B, (q15_t)0x4620, (q15_t)0x3FB5,
+    (q15_t)0x39D3, (q15_t)0xC04C, (q15_t)0x462D, (q15_t)0x3FB4, (q15_t)0x39C7, (q15_t)0xC04E, (q15_t)0x4639, (q15_t)0x3FB2,
+    (q15_t)0x39BA, (q15_t)0xC04F, (q15_t)0x4646, (q15_t)0x3FB1, (q15_t)0x39AE, (q15_t)0xC050, (q15_t)0x4652, (q15_t)0x3FB0,
+    (q15_t)0x39A1, (q15_t)0xC051, (q15_t)0x465F, (q15_t)0x3FAF, (q15_t)0x3995, (q15_t)0xC053, (q15_t)0x466B, (q15_t)0x3FAD,
+    (q15_t)0x3988, (q15_t)0xC054, (q15_t)0x4678, (q15_t)0x3FAC, (q15_t)0x397C, (q15_t)0xC055, (q15_t)0x4684, (q15_t)0x3FAB,
+    (q15_t)0x396F, (q15_t)0xC056, (q15_t)0x4691, (q15_t)0x3FAA, (q15_t)0x3963, (q15_t)0xC058, (q15_t)0x469D, (q15_t)0x3FA8,
+    (q15_t)0x3956, (q15_t)0xC059, (q15_t)0x46AA, (q15_t)0x3FA7, (q15_t)0x394A, (q15_t)0xC05A, (q15_t)0x46B6, (q15_t)0x3FA6,
+    (q15_t)0x393D, (q15_t)0xC05C, (q15_t)0x46C3, (q15_t)0x3FA4, (q15_t)0x3931, (q15_t)0xC05D, (q15_t)0x46CF, (q15_t)0x3FA3,
+    (q15_t)0x3924, (q15_t)0xC05E, (q15_t)0x46DC, (q15_t)0x3FA2, (q15_t)0x3918, (q15_t)0xC060, (q15_t)0x46E8, (q15_t)0x3FA0,
+    (q15_t)0x390B, (q15_t)0xC061, (q15_t)0x46F5, (q15_t)0x3F9F, (q15_t)0x38FF, (q15_t)0xC062, (q15_t)0x4701, (q15_t)0x3F9E,
+    (q15_t)0x38F2, (q15_t)0xC064, (q15_t)0x470E, (q15_t)0x3F9C, (q15_t)0x38E6, (q15_t)0xC065, (q15_t)0x471A, (q15_t)0x3F9B,
+    (q15_t)0x38D9, (q15_t)0xC067, (q15_t)0x4727, (q15_t)0x3F99, (q15_t)0x38CD, (q15_t)0xC068, (q15_t)0x4733, (q15_t)0x3F98,
+    (q15_t)0x38C0, (q15_t)0xC069, (q15_t)0x4740, (q15_t)0x3F97, (q15_t)0x38B4, (q15_t)0xC06B, (q15_t)0x474C, (q15_t)0x3F95,
+    (q15_t)0x38A7, (q15_t)0xC06C, (q15_t)0x4759, (q15_t)0x3F94, (q15_t)0x389B, (q15_t)0xC06E, (q15_t)0x4765, (q15_t)0x3F92,
+    (q15_t)0x388E, (q15_t)0xC06F, (q15_t)0x4772, (q15_t)0x3F91, (q15_t)0x3882, (q15_t)0xC071, (q15_t)0x477E, (q15_t)0x3F8F,
+    (q15_t)0x3875, (q15_t)0xC072, (q15_t)0x478B, (q15_t)0x3F8E, (q15_t)0x3869, (q15_t)0xC074, (q15_t)0x4797, (q15_t)0x3F8C,
+    (q15_t)0x385C, (q15_t)0xC075, (q15_t)0x47A4, (q15_t)0x3F8B, (q15_t)0x3850, (q15_t)0xC077, (q15_t)0x47B0, (q15_t)0x3F89,
+    (q15_t)0x3843, (q15_t)0xC078, (q15_t)0x47BD, (q15_t)0x3F88, (q15_t)0x3837, (q15_t)0xC07A, (q15_t)0x47C9, (q15_t)0x3F86,
+    (q15_t)0x382A, (q15_t)0xC07B, (q15_t)0x47D6, (q15_t)0x3F85, (q15_t)0x381E, (q15_t)0xC07D, (q15_t)0x47E2, (q15_t)0x3F83,
+    (q15_t)0x3811, (q15_t)0xC07E, (q15_t)0x47EF, (q15_t)0x3F82, (q15_t)0x3805, (q15_t)0xC080, (q15_t)0x47FB, (q15_t)0x3F80,
+    (q15_t)0x37F9, (q15_t)0xC081, (q15_t)0x4807, (q15_t)0x3F7F, (q15_t)0x37EC, (q15_t)0xC083, (q15_t)0x4814, (q15_t)0x3F7D,
+    (q15_t)0x37E0, (q15_t)0xC085, (q15_t)0x4820, (q15_t)0x3F7B, (q15_t)0x37D3, (q15_t)0xC086, (q15_t)0x482D, (q15_t)0x3F7A,
+    (q15_t)0x37C7, (q15_t)0xC088, (q15_t)0x4839, (q15_t)0x3F78, (q15_t)0x37BA, (q15_t)0xC089, (q15_t)0x4846, (q15_t)0x3F77,
+    (q15_t)0x37AE, (q15_t)0xC08B, (q15_t)0x4852, (q15_t)0x3F75, (q15_t)0x37A1, (q15_t)0xC08D, (q15_t)0x485F, (q15_t)0x3F73,
+    (q15_t)0x3795, (q15_t)0xC08E, (q15_t)0x486B, (q15_t)0x3F72, (q15_t)0x3788, (q15_t)0xC090, (q15_t)0x4878, (q15_t)0x3F70,
+    (q15_t)0x377C, (q15_t)0xC092, (q15_t)0x4884, (q15_t)0x3F6E, (q15_t)0x376F, (q15_t)0xC093, (q15_t)0x4891, (q15_t)0x3F6D,
+    (q15_t)0x3763, (q15_t)0xC095, (q15_t)0x489D, (q15_t)0x3F6B, (q15_t)0x3757, (q15_t)0xC097, (q15_t)0x48A9, (q15_t)0x3F69,
+    (q15_t)0x374A, (q15_t)0xC098, (q15_t)0x48B6, (q15_t)0x3F68, (q15_t)0x373E, (q15_t)0xC09A, (q15_t)0x48C2, (q15_t)0x3F66,
+    (q15_t)0x3731, (q15_t)0xC09C, (q15_t)0x48CF, (q15_t)0x3F64, (q15_t)0x3725, (q15_t)0xC09E, (q15_t)0x48DB, (q15_t)0x3F62,
+    (q15_t)0x3718, (q15_t)0xC09F, (q15_t)0x48E8, (q15_t)0x3F61, (q15_t)0x370C, (q15_t)0xC0A1, (q15_t)0x48F4, (q15_t)0x3F5F,
+    (q15_t)0x36FF, (q15_t)0xC0A3, (q15_t)0x4901, (q15_t)0x3F5D, (q15_t)0x36F3, (q15_t)0xC0A5, (q15_t)0x490D, (q15_t)0x3F5B,
+    (q15_t)0x36E7, (q15_t)0xC0A6, (q15_t)0x4919, (q15_t)0x3F5A, (q15_t)0x36DA, (q15_t)0xC0A8, (q15_t)0x4926, (q15_t)0x3F58,
+    (q15_t)0x36CE, (q15_t)0xC0AA, (q15_t)0x4932, (q15_t)0x3F56, (q15_t)0x36C1, (q15_t)0xC0AC, (q15_t)0x493F, (q15_t)0x3F54,
+    (q15_t)0x36B5, (q15_t)0xC0AE, (q15_t)0x494B, (q15_t)0x3F52, (q15_t)0x36A8, (q15_t)0xC0AF, (q15_t)0x4958, (q15_t)0x3F51,
+    (q15_t)0x369C, (q15_t)0xC0B1, (q15_t)0x4964, (q15_t)0x3F4F, (q15_t)0x3690, (q15_t)0xC0B3, (q15_t)0x4970, (q15_t)0x3F4D,
+    (q15_t)0x3683, (q15_t)0xC0B5, (q15_t)0x497D, (q15_t)0x3F4B, (q15_t)0x3677, (q15_t)0xC0B7, (q15_t)0x4989, (q15_t)0x3F49,
+    (q15_t)0x366A, (q15_t)0xC0B9, (q15_t)0x4996, (q15_t)0x3F47, (q15_t)0x365E, (q15_t)0xC0BB, (q15_t)0x49A2, (q15_t)0x3F45,
+    (q15_t)0x3651, (q15_t)0xC0BD, (q15_t)0x49AF, (q15_t)0x3F43, (q15_t)0x3645, (q15_t)0xC0BE, (q15_t)0x49BB, (q15_t)0x3F42,
+    (q15_t)0x3639, (q15_t)0xC0C0, (q15_t)0x49C7, (q15_t)0x3F40, (q15_t)0x362C, (q15_t)0xC0C2, (q15_t)0x49D4, (q15_t)0x3F3E,
+    (q15_t)0x3620, (q15_t)0xC0C4, (q15_t)0x49E0, (q15_t)0x3F3C, (q15_t)0x3613, (q15_t)0xC0C6, (q15_t)0x49ED, (q15_t)0x3F3A,
+    (q15_t)0x3607, (q15_t)0xC0C8, (q15_t)0x49F9, (q15_t)0x3F38, (q15_t)0x35FA, (q15_t)0xC0CA, (q15_t)0x4A06, (q15_t)0x3F36,
+    (q15_t)0x35EE, (q15_t)0xC0CC, (q15_t)0x4A12, (q15_t)0x3F34, (q15_t)0x35E2, (q15_t)0xC0CE, (q15_t)0x4A1E, (q15_t)0x3F32,
+    (q15_t)0x35D5, (q15_t)0xC0D0, (q15_t)0x4A2B, (q15_t)0x3F30, (q15_t)0x35C9, (q15_t)0xC0D2, (q15_t)0x4A37, (q15_t)0x3F2E,
+    (q15_t)0x35BC, (q15_t)0xC0D4, (q15_t)0x4A44, (q15_t)0x3F2C, (q15_t)0x35B0, (q15_t)0xC0D6, (q15_t)0x4A50, (q15_t)0x3F2A,
+    (q15_t)0x35A4, (q15_t)0xC0D8, (q15_t)0x4A5C, (q15_t)0x3F28, (q15_t)0x3597, (q15_t)0xC0DA, (q15_t)0x4A69, (q15_t)0x3F26,
+    (q15_t)0x358B, (q15_t)0xC0DC, (q15_t)0x4A75, (q15_t)0x3F24, (q15_t)0x357E, (q15_t)0xC0DE, (q15_t)0x4A82, (q15_t)0x3F22,
+    (q15_t)0x3572, (q15_t)0xC0E0, (q15_t)0x4A8E, (q15_t)0x3F20, (q15_t)0x3566, (q15_t)0xC0E2, (q15_t)0x4A9A, (q15_t)0x3F1E,
+    (q15_t)0x3559, (q15_t)0xC0E4, (q15_t)0x4AA7, (q15_t)0x3F1C, (q15_t)0x354D, (q15_t)0xC0E7, (q15_t)0x4AB3, (q15_t)0x3F19,
+    (q15_t)0x3540, (q15_t)0xC0E9, (q15_t)0x4AC0, (q15_t)0x3F17, (q15_t)0x3534, (q15_t)0xC0EB, (q15_t)0x4ACC, (q15_t)0x3F15,
+    (q15_t)0x3528, (q15_t)0xC0ED, (q15_t)0x4AD8, (q15_t)0x3F13, (q15_t)0x351B, (q15_t)0xC0EF, (q15_t)0x4AE5, (q15_t)0x3F11,
+    (q15_t)0x350F, (q15_t)0xC0F1, (q15_t)0x4AF1, (q15_t)0x3F0F, (q15_t)0x3503, (q15_t)0xC0F3, (q15_t)0x4AFD, (q15_t)0x3F0D,
+    (q15_t)0x34F6, (q15_t)0xC0F6, (q15_t)0x4B0A, (q15_t)0x3F0A, (q15_t)0x34EA, (q15_t)0xC0F8, (q15_t)0x4B16, (q15_t)0x3F08,
+    (q15_t)0x34DD, (q15_t)0xC0FA, (q15_t)0x4B23, (q15_t)0x3F06, (q15_t)0x34D1, (q15_t)0xC0FC, (q15_t)0x4B2F, (q15_t)0x3F04,
+    (q15_t)0x34C5, (q15_t)0xC0FE, (q15_t)0x4B3B, (q15_t)0x3F02, (q15_t)0x34B8, (q15_t)0xC100, (q15_t)0x4B48, (q15_t)0x3F00,
+    (q15_t)0x34AC, (q15_t)0xC103, (q15_t)0x4B54, (q15_t)0x3EFD, (q15_t)0x34A0, (q15_t)0xC105, (q15_t)0x4B60, (q15_t)0x3EFB,
+    (q15_t)0x3493, (q15_t)0xC107, (q15_t)0x4B6D, (q15_t)0x3EF9, (q15_t)0x3487, (q15_t)0xC109, (q15_t)0x4B79, (q15_t)0x3EF7,
+    (q15_t)0x347B, (q15_t)0xC10C, (q15_t)0x4B85, (q15_t)0x3EF4, (q15_t)0x346E, (q15_t)0xC10E, (q15_t)0x4B92, (q15_t)0x3EF2,
+    (q15_t)0x3462, (q15_t)0xC110, (q15_t)0x4B9E, (q15_t)0x3EF0, (q15_t)0x3455, (q15_t)0xC113, (q15_t)0x4BAB, (q15_t)0x3EED,
+    (q15_t)0x3449, (q15_t)0xC115, (q15_t)0x4BB7, (q15_t)0x3EEB, (q15_t)0x343D, (q15_t)0xC117, (q15_t)0x4BC3, (q15_t)0x3EE9,
+    (q15_t)0x3430, (q15_t)0xC119, (q15_t)0x4BD0, (q15_t)0x3EE7, (q15_t)0x3424, (q15_t)0xC11C, (q15_t)0x4BDC, (q15_t)0x3EE4,
+    (q15_t)0x3418, (q15_t)0xC11E, (q15_t)0x4BE8, (q15_t)0x3EE2, (q15_t)0x340B, (q15_t)0xC120, (q15_t)0x4BF5, (q15_t)0x3EE0,
+    (q15_t)0x33FF, (q15_t)0xC123, (q15_t)0x4C01, (q15_t)0x3EDD, (q15_t)0x33F3, (q15_t)0xC125, (q15_t)0x4C0D, (q15_t)0x3EDB,
+    (q15_t)0x33E6, (q15_t)0xC128, (q15_t)0x4C1A, (q15_t)0x3ED8, (q15_t)0x33DA, (q15_t)0xC12A, (q15_t)0x4C26, (q15_t)0x3ED6,
+    (q15_t)0x33CE, (q15_t)0xC12C, (q15_t)0x4C32, (q15_t)0x3ED4, (q15_t)0x33C1, (q15_t)0xC12F, (q15_t)0x4C3F, (q15_t)0x3ED1,
+    (q15_t)0x33B5, (q15_t)0xC131, (q15_t)0x4C4B, (q15_t)0x3ECF, (q15_t)0x33A9, (q15_t)0xC134, (q15_t)0x4C57, (q15_t)0x3ECC,
+    (q15_t)0x339C, (q15_t)0xC136, (q15_t)0x4C64, (q15_t)0x3ECA, (q15_t)0x3390, (q15_t)0xC138, (q15_t)0x4C70, (q15_t)0x3EC8,
+    (q15_t)0x3384, (q15_t)0xC13B, (q15_t)0x4C7C, (q15_t)0x3EC5, (q15_t)0x3377, (q15_t)0xC13D, (q15_t)0x4C89, (q15_t)0x3EC3,
+    (q15_t)0x336B, (q15_t)0xC140, (q15_t)0x4C95, (q15_t)0x3EC0, (q15_t)0x335F, (q15_t)0xC142, (q15_t)0x4CA1, (q15_t)0x3EBE,
+    (q15_t)0x3352, (q15_t)0xC145, (q15_t)0x4CAE, (q15_t)0x3EBB, (q15_t)0x3346, (q15_t)0xC147, (q15_t)0x4CBA, (q15_t)0x3EB9,
+    (q15_t)0x333A, (q15_t)0xC14A, (q15_t)0x4CC6, (q15_t)0x3EB6, (q15_t)0x332D, (q15_t)0xC14C, (q15_t)0x4CD3, (q15_t)0x3EB4,
+    (q15_t)0x3321, (q15_t)0xC14F, (q15_t)0x4CDF, (q15_t)0x3EB1, (q15_t)0x3315, (q15_t)0xC151, (q15_t)0x4CEB, (q15_t)0x3EAF,
+    (q15_t)0x3308, (q15_t)0xC154, (q15_t)0x4CF8, (q15_t)0x3EAC, (q15_t)0x32FC, (q15_t)0xC156, (q15_t)0x4D04, (q15_t)0x3EAA,
+    (q15_t)0x32F0, (q15_t)0xC159, (q15_t)0x4D10, (q15_t)0x3EA7, (q15_t)0x32E4, (q15_t)0xC15B, (q15_t)0x4D1C, (q15_t)0x3EA5,
+    (q15_t)0x32D7, (q15_t)0xC15E, (q15_t)0x4D29, (q15_t)0x3EA2, (q15_t)0x32CB, (q15_t)0xC161, (q15_t)0x4D35, (q15_t)0x3E9F,
+    (q15_t)0x32BF, (q15_t)0xC163, (q15_t)0x4D41, (q15_t)0x3E9D, (q15_t)0x32B2, (q15_t)0xC166, (q15_t)0x4D4E, (q15_t)0x3E9A,
+    (q15_t)0x32A6, (q15_t)0xC168, (q15_t)0x4D5A, (q15_t)0x3E98, (q15_t)0x329A, (q15_t)0xC16B, (q15_t)0x4D66, (q15_t)0x3E95,
+    (q15_t)0x328E, (q15_t)0xC16E, (q15_t)0x4D72, (q15_t)0x3E92, (q15_t)0x3281, (q15_t)0xC170, (q15_t)0x4D7F, (q15_t)0x3E90,
+    (q15_t)0x3275, (q15_t)0xC173, (q15_t)0x4D8B, (q15_t)0x3E8D, (q15_t)0x3269, (q15_t)0xC176, (q15_t)0x4D97, (q15_t)0x3E8A,
+    (q15_t)0x325C, (q15_t)0xC178, (q15_t)0x4DA4, (q15_t)0x3E88, (q15_t)0x3250, (q15_t)0xC17B, (q15_t)0x4DB0, (q15_t)0x3E85,
+    (q15_t)0x3244, (q15_t)0xC17E, (q15_t)0x4DBC, (q15_t)0x3E82, (q15_t)0x3238, (q15_t)0xC180, (q15_t)0x4DC8, (q15_t)0x3E80,
+    (q15_t)0x322B, (q15_t)0xC183, (q15_t)0x4DD5, (q15_t)0x3E7D, (q15_t)0x321F, (q15_t)0xC186, (q15_t)0x4DE1, (q15_t)0x3E7A,
+    (q15_t)0x3213, (q15_t)0xC189, (q15_t)0x4DED, (q15_t)0x3E77, (q15_t)0x3207, (q15_t)0xC18B, (q15_t)0x4DF9, (q15_t)0x3E75,
+    (q15_t)0x31FA, (q15_t)0xC18E, (q15_t)0x4E06, (q15_t)0x3E72, (q15_t)0x31EE, (q15_t)0xC191, (q15_t)0x4E12, (q15_t)0x3E6F,
+    (q15_t)0x31E2, (q15_t)0xC194, (q15_t)0x4E1E, (q15_t)0x3E6C, (q15_t)0x31D5, (q15_t)0xC196, (q15_t)0x4E2B, (q15_t)0x3E6A,
+    (q15_t)0x31C9, (q15_t)0xC199, (q15_t)0x4E37, (q15_t)0x3E67, (q15_t)0x31BD, (q15_t)0xC19C, (q15_t)0x4E43, (q15_t)0x3E64,
+    (q15_t)0x31B1, (q15_t)0xC19F, (q15_t)0x4E4F, (q15_t)0x3E61, (q15_t)0x31A4, (q15_t)0xC1A2, (q15_t)0x4E5C, (q15_t)0x3E5E,
+    (q15_t)0x3198, (q15_t)0xC1A4, (q15_t)0x4E68, (q15_t)0x3E5C, (q15_t)0x318C, (q15_t)0xC1A7, (q15_t)0x4E74, (q15_t)0x3E59,
+    (q15_t)0x3180, (q15_t)0xC1AA, (q15_t)0x4E80, (q15_t)0x3E56, (q15_t)0x3174, (q15_t)0xC1AD, (q15_t)0x4E8C, (q15_t)0x3E53,
+    (q15_t)0x3167, (q15_t)0xC1B0, (q15_t)0x4E99, (q15_t)0x3E50, (q15_t)0x315B, (q15_t)0xC1B3, (q15_t)0x4EA5, (q15_t)0x3E4D,
+    (q15_t)0x314F, (q15_t)0xC1B6, (q15_t)0x4EB1, (q15_t)0x3E4A, (q15_t)0x3143, (q15_t)0xC1B8, (q15_t)0x4EBD, (q15_t)0x3E48,
+    (q15_t)0x3136, (q15_t)0xC1BB, (q15_t)0x4ECA, (q15_t)0x3E45, (q15_t)0x312A, (q15_t)0xC1BE, (q15_t)0x4ED6, (q15_t)0x3E42,
+    (q15_t)0x311E, (q15_t)0xC1C1, (q15_t)0x4EE2, (q15_t)0x3E3F, (q15_t)0x3112, (q15_t)0xC1C4, (q15_t)0x4EEE, (q15_t)0x3E3C,
+    (q15_t)0x3105, (q15_t)0xC1C7, (q15_t)0x4EFB, (q15_t)0x3E39, (q15_t)0x30F9, (q15_t)0xC1CA, (q15_t)0x4F07, (q15_t)0x3E36,
+    (q15_t)0x30ED, (q15_t)0xC1CD, (q15_t)0x4F13, (q15_t)0x3E33, (q15_t)0x30E1, (q15_t)0xC1D0, (q15_t)0x4F1F, (q15_t)0x3E30,
+    (q15_t)0x30D5, (q15_t)0xC1D3, (q15_t)0x4F2B, (q15_t)0x3E2D, (q15_t)0x30C8, (q15_t)0xC1D6, (q15_t)0x4F38, (q15_t)0x3E2A,
+    (q15_t)0x30BC, (q15_t)0xC1D9, (q15_t)0x4F44, (q15_t)0x3E27, (q15_t)0x30B0, (q15_t)0xC1DC, (q15_t)0x4F50, (q15_t)0x3E24,
+    (q15_t)0x30A4, (q15_t)0xC1DF, (q15_t)0x4F5C, (q15_t)0x3E21, (q15_t)0x3098, (q15_t)0xC1E2, (q15_t)0x4F68, (q15_t)0x3E1E,
+    (q15_t)0x308B, (q15_t)0xC1E5, (q15_t)0x4F75, (q15_t)0x3E1B, (q15_t)0x307F, (q15_t)0xC1E8, (q15_t)0x4F81, (q15_t)0x3E18,
+    (q15_t)0x3073, (q15_t)0xC1EB, (q15_t)0x4F8D, (q15_t)0x3E15, (q15_t)0x3067, (q15_t)0xC1EE, (q15_t)0x4F99, (q15_t)0x3E12,
+    (q15_t)0x305B, (q15_t)0xC1F1, (q15_t)0x4FA5, (q15_t)0x3E0F, (q15_t)0x304E, (q15_t)0xC1F4, (q15_t)0x4FB2, (q15_t)0x3E0C,
+    (q15_t)0x3042, (q15_t)0xC1F7, (q15_t)0x4FBE, (q15_t)0x3E09, (q15_t)0x3036, (q15_t)0xC1FA, (q15_t)0x4FCA, (q15_t)0x3E06,
+    (q15_t)0x302A, (q15_t)0xC1FD, (q15_t)0x4FD6, (q15_t)0x3E03, (q15_t)0x301E, (q15_t)0xC201, (q15_t)0x4FE2, (q15_t)0x3DFF,
+    (q15_t)0x3012, (q15_t)0xC204, (q15_t)0x4FEE, (q15_t)0x3DFC, (q15_t)0x3005, (q15_t)0xC207, (q15_t)0x4FFB, (q15_t)0x3DF9,
+    (q15_t)0x2FF9, (q15_t)0xC20A, (q15_t)0x5007, (q15_t)0x3DF6, (q15_t)0x2FED, (q15_t)0xC20D, (q15_t)0x5013, (q15_t)0x3DF3,
+    (q15_t)0x2FE1, (q15_t)0xC210, (q15_t)0x501F, (q15_t)0x3DF0, (q15_t)0x2FD5, (q15_t)0xC213, (q15_t)0x502B, (q15_t)0x3DED,
+    (q15_t)0x2FC9, (q15_t)0xC217, (q15_t)0x5037, (q15_t)0x3DE9, (q15_t)0x2FBC, (q15_t)0xC21A, (q15_t)0x5044, (q15_t)0x3DE6,
+    (q15_t)0x2FB0, (q15_t)0xC21D, (q15_t)0x5050, (q15_t)0x3DE3, (q15_t)0x2FA4, (q15_t)0xC220, (q15_t)0x505C, (q15_t)0x3DE0,
+    (q15_t)0x2F98, (q15_t)0xC223, (q15_t)0x5068, (q15_t)0x3DDD, (q15_t)0x2F8C, (q15_t)0xC227, (q15_t)0x5074, (q15_t)0x3DD9,
+    (q15_t)0x2F80, (q15_t)0xC22A, (q15_t)0x5080, (q15_t)0x3DD6, (q15_t)0x2F74, (q15_t)0xC22D, (q15_t)0x508C, (q15_t)0x3DD3,
+    (q15_t)0x2F67, (q15_t)0xC230, (q15_t)0x5099, (q15_t)0x3DD0, (q15_t)0x2F5B, (q15_t)0xC234, (q15_t)0x50A5, (q15_t)0x3DCC,
+    (q15_t)0x2F4F, (q15_t)0xC237, (q15_t)0x50B1, (q15_t)0x3DC9, (q15_t)0x2F43, (q15_t)0xC23A, (q15_t)0x50BD, (q15_t)0x3DC6,
+    (q15_t)0x2F37, (q15_t)0xC23E, (q15_t)0x50C9, (q15_t)0x3DC2, (q15_t)0x2F2B, (q15_t)0xC241, (q15_t)0x50D5, (q15_t)0x3DBF,
+    (q15_t)0x2F1F, (q15_t)0xC244, (q15_t)0x50E1, (q15_t)0x3DBC, (q15_t)0x2F13, (q15_t)0xC247, (q15_t)0x50ED, (q15_t)0x3DB9,
+    (q15_t)0x2F06, (q15_t)0xC24B, (q15_t)0x50FA, (q15_t)0x3DB5, (q15_t)0x2EFA, (q15_t)0xC24E, (q15_t)0x5106, (q15_t)0x3DB2,
+    (q15_t)0x2EEE, (q15_t)0xC251, (q15_t)0x5112, (q15_t)0x3DAF, (q15_t)0x2EE2, (q15_t)0xC255, (q15_t)0x511E, (q15_t)0x3DAB,
+    (q15_t)0x2ED6, (q15_t)0xC258, (q15_t)0x512A, (q15_t)0x3DA8, (q15_t)0x2ECA, (q15_t)0xC25C, (q15_t)0x5136, (q15_t)0x3DA4,
+    (q15_t)0x2EBE, (q15_t)0xC25F, (q15_t)0x5142, (q15_t)0x3DA1, (q15_t)0x2EB2, (q15_t)0xC262, (q15_t)0x514E, (q15_t)0x3D9E,
+    (q15_t)0x2EA6, (q15_t)0xC266, (q15_t)0x515A, (q15_t)0x3D9A, (q15_t)0x2E99, (q15_t)0xC269, (q15_t)0x5167, (q15_t)0x3D97,
+    (q15_t)0x2E8D, (q15_t)0xC26D, (q15_t)0x5173, (q15_t)0x3D93, (q15_t)0x2E81, (q15_t)0xC270, (q15_t)0x517F, (q15_t)0x3D90,
+    (q15_t)0x2E75, (q15_t)0xC273, (q15_t)0x518B, (q15_t)0x3D8D, (q15_t)0x2E69, (q15_t)0xC277, (q15_t)0x5197, (q15_t)0x3D89,
+    (q15_t)0x2E5D, (q15_t)0xC27A, (q15_t)0x51A3, (q15_t)0x3D86, (q15_t)0x2E51, (q15_t)0xC27E, (q15_t)0x51AF, (q15_t)0x3D82,
+    (q15_t)0x2E45, (q15_t)0xC281, (q15_t)0x51BB, (q15_t)0x3D7F, (q15_t)0x2E39, (q15_t)0xC285, (q15_t)0x51C7, (q15_t)0x3D7B,
+    (q15_t)0x2E2D, (q15_t)0xC288, (q15_t)0x51D3, (q15_t)0x3D78, (q15_t)0x2E21, (q15_t)0xC28C, (q15_t)0x51DF, (q15_t)0x3D74,
+    (q15_t)0x2E15, (q15_t)0xC28F, (q15_t)0x51EB, (q15_t)0x3D71, (q15_t)0x2E09, (q15_t)0xC293, (q15_t)0x51F7, (q15_t)0x3D6D,
+    (q15_t)0x2DFC, (q15_t)0xC296, (q15_t)0x5204, (q15_t)0x3D6A, (q15_t)0x2DF0, (q15_t)0xC29A, (q15_t)0x5210, (q15_t)0x3D66,
+    (q15_t)0x2DE4, (q15_t)0xC29D, (q15_t)0x521C, (q15_t)0x3D63, (q15_t)0x2DD8, (q15_t)0xC2A1, (q15_t)0x5228, (q15_t)0x3D5F,
+    (q15_t)0x2DCC, (q15_t)0xC2A5, (q15_t)0x5234, (q15_t)0x3D5B, (q15_t)0x2DC0, (q15_t)0xC2A8, (q15_t)0x5240, (q15_t)0x3D58,
+    (q15_t)0x2DB4, (q15_t)0xC2AC, (q15_t)0x524C, (q15_t)0x3D54, (q15_t)0x2DA8, (q15_t)0xC2AF, (q15_t)0x5258, (q15_t)0x3D51,
+    (q15_t)0x2D9C, (q15_t)0xC2B3, (q15_t)0x5264, (q15_t)0x3D4D, (q15_t)0x2D90, (q15_t)0xC2B7, (q15_t)0x5270, (q15_t)0x3D49,
+    (q15_t)0x2D84, (q15_t)0xC2BA, (q15_t)0x527C, (q15_t)0x3D46, (q15_t)0x2D78, (q15_t)0xC2BE, (q15_t)0x5288, (q15_t)0x3D42,
+    (q15_t)0x2D6C, (q15_t)0xC2C1, (q15_t)0x5294, (q15_t)0x3D3F, (q15_t)0x2D60, (q15_t)0xC2C5, (q15_t)0x52A0, (q15_t)0x3D3B,
+    (q15_t)0x2D54, (q15_t)0xC2C9, (q15_t)0x52AC, (q15_t)0x3D37, (q15_t)0x2D48, (q15_t)0xC2CC, (q15_t)0x52B8, (q15_t)0x3D34,
+    (q15_t)0x2D3C, (q15_t)0xC2D0, (q15_t)0x52C4, (q15_t)0x3D30, (q15_t)0x2D30, (q15_t)0xC2D4, (q15_t)0x52D0, (q15_t)0x3D2C,
+    (q15_t)0x2D24, (q15_t)0xC2D8, (q15_t)0x52DC, (q15_t)0x3D28, (q15_t)0x2D18, (q15_t)0xC2DB, (q15_t)0x52E8, (q15_t)0x3D25,
+    (q15_t)0x2D0C, (q15_t)0xC2DF, (q15_t)0x52F4, (q15_t)0x3D21, (q15_t)0x2D00, (q15_t)0xC2E3, (q15_t)0x5300, (q15_t)0x3D1D,
+    (q15_t)0x2CF4, (q15_t)0xC2E6, (q15_t)0x530C, (q15_t)0x3D1A, (q15_t)0x2CE8, (q15_t)0xC2EA, (q15_t)0x5318, (q15_t)0x3D16,
+    (q15_t)0x2CDC, (q15_t)0xC2EE, (q15_t)0x5324, (q15_t)0x3D12, (q15_t)0x2CD0, (q15_t)0xC2F2, (q15_t)0x5330, (q15_t)0x3D0E,
+    (q15_t)0x2CC4, (q15_t)0xC2F5, (q15_t)0x533C, (q15_t)0x3D0B, (q15_t)0x2CB8, (q15_t)0xC2F9, (q15_t)0x5348, (q15_t)0x3D07,
+    (q15_t)0x2CAC, (q15_t)0xC2FD, (q15_t)0x5354, (q15_t)0x3D03, (q15_t)0x2CA0, (q15_t)0xC301, (q15_t)0x5360, (q15_t)0x3CFF,
+    (q15_t)0x2C94, (q15_t)0xC305, (q15_t)0x536C, (q15_t)0x3CFB, (q15_t)0x2C88, (q15_t)0xC308, (q15_t)0x5378, (q15_t)0x3CF8,
+    (q15_t)0x2C7C, (q15_t)0xC30C, (q15_t)0x5384, (q15_t)0x3CF4, (q15_t)0x2C70, (q15_t)0xC310, (q15_t)0x5390, (q15_t)0x3CF0,
+    (q15_t)0x2C64, (q15_t)0xC314, (q15_t)0x539C, (q15_t)0x3CEC, (q15_t)0x2C58, (q15_t)0xC318, (q15_t)0x53A8, (q15_t)0x3CE8,
+    (q15_t)0x2C4C, (q15_t)0xC31C, (q15_t)0x53B4, (q15_t)0x3CE4, (q15_t)0x2C40, (q15_t)0xC320, (q15_t)0x53C0, (q15_t)0x3CE0,
+    (q15_t)0x2C34, (q15_t)0xC323, (q15_t)0x53CC, (q15_t)0x3CDD, (q15_t)0x2C28, (q15_t)0xC327, (q15_t)0x53D8, (q15_t)0x3CD9,
+    (q15_t)0x2C1C, (q15_t)0xC32B, (q15_t)0x53E4, (q15_t)0x3CD5, (q15_t)0x2C10, (q15_t)0xC32F, (q15_t)0x53F0, (q15_t)0x3CD1,
+    (q15_t)0x2C05, (q15_t)0xC333, (q15_t)0x53FB, (q15_t)0x3CCD, (q15_t)0x2BF9, (q15_t)0xC337, (q15_t)0x5407, (q15_t)0x3CC9,
+    (q15_t)0x2BED, (q15_t)0xC33B, (q15_t)0x5413, (q15_t)0x3CC5, (q15_t)0x2BE1, (q15_t)0xC33F, (q15_t)0x541F, (q15_t)0x3CC1,
+    (q15_t)0x2BD5, (q15_t)0xC343, (q15_t)0x542B, (q15_t)0x3CBD, (q15_t)0x2BC9, (q15_t)0xC347, (q15_t)0x5437, (q15_t)0x3CB9,
+    (q15_t)0x2BBD, (q15_t)0xC34B, (q15_t)0x5443, (q15_t)0x3CB5, (q15_t)0x2BB1, (q15_t)0xC34F, (q15_t)0x544F, (q15_t)0x3CB1,
+    (q15_t)0x2BA5, (q15_t)0xC353, (q15_t)0x545B, (q15_t)0x3CAD, (q15_t)0x2B99, (q15_t)0xC357, (q15_t)0x5467, (q15_t)0x3CA9,
+    (q15_t)0x2B8D, (q15_t)0xC35B, (q15_t)0x5473, (q15_t)0x3CA5, (q15_t)0x2B81, (q15_t)0xC35F, (q15_t)0x547F, (q15_t)0x3CA1,
+    (q15_t)0x2B75, (q15_t)0xC363, (q15_t)0x548B, (q15_t)0x3C9D, (q15_t)0x2B6A, (q15_t)0xC367, (q15_t)0x5496, (q15_t)0x3C99,
+    (q15_t)0x2B5E, (q15_t)0xC36B, (q15_t)0x54A2, (q15_t)0x3C95, (q15_t)0x2B52, (q15_t)0xC36F, (q15_t)0x54AE, (q15_t)0x3C91,
+    (q15_t)0x2B46, (q15_t)0xC373, (q15_t)0x54BA, (q15_t)0x3C8D, (q15_t)0x2B3A, (q15_t)0xC377, (q15_t)0x54C6, (q15_t)0x3C89,
+    (q15_t)0x2B2E, (q15_t)0xC37B, (q15_t)0x54D2, (q15_t)0x3C85, (q15_t)0x2B22, (q15_t)0xC37F, (q15_t)0x54DE, (q15_t)0x3C81,
+    (q15_t)0x2B16, (q15_t)0xC383, (q15_t)0x54EA, (q15_t)0x3C7D, (q15_t)0x2B0A, (q15_t)0xC387, (q15_t)0x54F6, (q15_t)0x3C79,
+    (q15_t)0x2AFF, (q15_t)0xC38C, (q15_t)0x5501, (q15_t)0x3C74, (q15_t)0x2AF3, (q15_t)0xC390, (q15_t)0x550D, (q15_t)0x3C70,
+    (q15_t)0x2AE7, (q15_t)0xC394, (q15_t)0x5519, (q15_t)0x3C6C, (q15_t)0x2ADB, (q15_t)0xC398, (q15_t)0x5525, (q15_t)0x3C68,
+    (q15_t)0x2ACF, (q15_t)0xC39C, (q15_t)0x5531, (q15_t)0x3C64, (q15_t)0x2AC3, (q15_t)0xC3A0, (q15_t)0x553D, (q15_t)0x3C60,
+    (q15_t)0x2AB7, (q15_t)0xC3A5, (q15_t)0x5549, (q15_t)0x3C5B, (q15_t)0x2AAC, (q15_t)0xC3A9, (q15_t)0x5554, (q15_t)0x3C57,
+    (q15_t)0x2AA0, (q15_t)0xC3AD, (q15_t)0x5560, (q15_t)0x3C53, (q15_t)0x2A94, (q15_t)0xC3B1, (q15_t)0x556C, (q15_t)0x3C4F,
+    (q15_t)0x2A88, (q15_t)0xC3B5, (q15_t)0x5578, (q15_t)0x3C4B, (q15_t)0x2A7C, (q15_t)0xC3BA, (q15_t)0x5584, (q15_t)0x3C46,
+    (q15_t)0x2A70, (q15_t)0xC3BE, (q15_t)0x5590, (q15_t)0x3C42, (q15_t)0x2A65, (q15_t)0xC3C2, (q15_t)0x559B, (q15_t)0x3C3E,
+    (q15_t)0x2A59, (q15_t)0xC3C6, (q15_t)0x55A7, (q15_t)0x3C3A, (q15_t)0x2A4D, (q15_t)0xC3CA, (q15_t)0x55B3, (q15_t)0x3C36,
+    (q15_t)0x2A41, (q15_t)0xC3CF, (q15_t)0x55BF, (q15_t)0x3C31, (q15_t)0x2A35, (q15_t)0xC3D3, (q15_t)0x55CB, (q15_t)0x3C2D,
+    (q15_t)0x2A29, (q15_t)0xC3D7, (q15_t)0x55D7, (q15_t)0x3C29, (q15_t)0x2A1E, (q15_t)0xC3DC, (q15_t)0x55E2, (q15_t)0x3C24,
+    (q15_t)0x2A12, (q15_t)0xC3E0, (q15_t)0x55EE, (q15_t)0x3C20, (q15_t)0x2A06, (q15_t)0xC3E4, (q15_t)0x55FA, (q15_t)0x3C1C,
+    (q15_t)0x29FA, (q15_t)0xC3E9, (q15_t)0x5606, (q15_t)0x3C17, (q15_t)0x29EE, (q15_t)0xC3ED, (q15_t)0x5612, (q15_t)0x3C13,
+    (q15_t)0x29E3, (q15_t)0xC3F1, (q15_t)0x561D, (q15_t)0x3C0F, (q15_t)0x29D7, (q15_t)0xC3F6, (q15_t)0x5629, (q15_t)0x3C0A,
+    (q15_t)0x29CB, (q15_t)0xC3FA, (q15_t)0x5635, (q15_t)0x3C06, (q15_t)0x29BF, (q15_t)0xC3FE, (q15_t)0x5641, (q15_t)0x3C02,
+    (q15_t)0x29B4, (q15_t)0xC403, (q15_t)0x564C, (q15_t)0x3BFD, (q15_t)0x29A8, (q15_t)0xC407, (q15_t)0x5658, (q15_t)0x3BF9,
+    (q15_t)0x299C, (q15_t)0xC40B, (q15_t)0x5664, (q15_t)0x3BF5, (q15_t)0x2990, (q15_t)0xC410, (q15_t)0x5670, (q15_t)0x3BF0,
+    (q15_t)0x2984, (q15_t)0xC414, (q15_t)0x567C, (q15_t)0x3BEC, (q15_t)0x2979, (q15_t)0xC419, (q15_t)0x5687, (q15_t)0x3BE7,
+    (q15_t)0x296D, (q15_t)0xC41D, (q15_t)0x5693, (q15_t)0x3BE3, (q15_t)0x2961, (q15_t)0xC422, (q15_t)0x569F, (q15_t)0x3BDE,
+    (q15_t)0x2955, (q15_t)0xC426, (q15_t)0x56AB, (q15_t)0x3BDA, (q15_t)0x294A, (q15_t)0xC42A, (q15_t)0x56B6, (q15_t)0x3BD6,
+    (q15_t)0x293E, (q15_t)0xC42F, (q15_t)0x56C2, (q15_t)0x3BD1, (q15_t)0x2932, (q15_t)0xC433, (q15_t)0x56CE, (q15_t)0x3BCD,
+    (q15_t)0x2926, (q15_t)0xC438, (q15_t)0x56DA, (q15_t)0x3BC8, (q15_t)0x291B, (q15_t)0xC43C, (q15_t)0x56E5, (q15_t)0x3BC4,
+    (q15_t)0x290F, (q15_t)0xC441, (q15_t)0x56F1, (q15_t)0x3BBF, (q15_t)0x2903, (q15_t)0xC445, (q15_t)0x56FD, (q15_t)0x3BBB,
+    (q15_t)0x28F7, (q15_t)0xC44A, (q15_t)0x5709, (q15_t)0x3BB6, (q15_t)0x28EC, (q15_t)0xC44E, (q15_t)0x5714, (q15_t)0x3BB2,
+    (q15_t)0x28E0, (q15_t)0xC453, (q15_t)0x5720, (q15_t)0x3BAD, (q15_t)0x28D4, (q15_t)0xC457, (q15_t)0x572C, (q15_t)0x3BA9,
+    (q15_t)0x28C9, (q15_t)0xC45C, (q15_t)0x5737, (q15_t)0x3BA4, (q15_t)0x28BD, (q15_t)0xC461, (q15_t)0x5743, (q15_t)0x3B9F,
+    (q15_t)0x28B1, (q15_t)0xC465, (q15_t)0x574F, (q15_t)0x3B9B, (q15_t)0x28A5, (q15_t)0xC46A, (q15_t)0x575B, (q15_t)0x3B96,
+    (q15_t)0x289A, (q15_t)0xC46E, (q15_t)0x5766, (q15_t)0x3B92, (q15_t)0x288E, (q15_t)0xC473, (q15_t)0x5772, (q15_t)0x3B8D,
+    (q15_t)0x2882, (q15_t)0xC478, (q15_t)0x577E, (q15_t)0x3B88, (q15_t)0x2877, (q15_t)0xC47C, (q15_t)0x5789, (q15_t)0x3B84,
+    (q15_t)0x286B, (q15_t)0xC481, (q15_t)0x5795, (q15_t)0x3B7F, (q15_t)0x285F, (q15_t)0xC485, (q15_t)0x57A1, (q15_t)0x3B7B,
+    (q15_t)0x2854, (q15_t)0xC48A, (q15_t)0x57AC, (q15_t)0x3B76, (q15_t)0x2848, (q15_t)0xC48F, (q15_t)0x57B8, (q15_t)0x3B71,
+    (q15_t)0x283C, (q15_t)0xC493, (q15_t)0x57C4, (q15_t)0x3B6D, (q15_t)0x2831, (q15_t)0xC498, (q15_t)0x57CF, (q15_t)0x3B68,
+    (q15_t)0x2825, (q15_t)0xC49D, (q15_t)0x57DB, (q15_t)0x3B63, (q15_t)0x2819, (q15_t)0xC4A1, (q15_t)0x57E7, (q15_t)0x3B5F,
+    (q15_t)0x280E, (q15_t)0xC4A6, (q15_t)0x57F2, (q15_t)0x3B5A, (q15_t)0x2802, (q15_t)0xC4AB, (q15_t)0x57FE, (q15_t)0x3B55,
+    (q15_t)0x27F6, (q15_t)0xC4B0, (q15_t)0x580A, (q15_t)0x3B50, (q15_t)0x27EB, (q15_t)0xC4B4, (q15_t)0x5815, (q15_t)0x3B4C,
+    (q15_t)0x27DF, (q15_t)0xC4B9, (q15_t)0x5821, (q15_t)0x3B47, (q15_t)0x27D3, (q15_t)0xC4BE, (q15_t)0x582D, (q15_t)0x3B42,
+    (q15_t)0x27C8, (q15_t)0xC4C2, (q15_t)0x5838, (q15_t)0x3B3E, (q15_t)0x27BC, (q15_t)0xC4C7, (q15_t)0x5844, (q15_t)0x3B39,
+    (q15_t)0x27B1, (q15_t)0xC4CC, (q15_t)0x584F, (q15_t)0x3B34, (q15_t)0x27A5, (q15_t)0xC4D1, (q15_t)0x585B, (q15_t)0x3B2F,
+    (q15_t)0x2799, (q15_t)0xC4D6, (q15_t)0x5867, (q15_t)0x3B2A, (q15_t)0x278E, (q15_t)0xC4DA, (q15_t)0x5872, (q15_t)0x3B26,
+    (q15_t)0x2782, (q15_t)0xC4DF, (q15_t)0x587E, (q15_t)0x3B21, (q15_t)0x2777, (q15_t)0xC4E4, (q15_t)0x5889, (q15_t)0x3B1C,
+    (q15_t)0x276B, (q15_t)0xC4E9, (q15_t)0x5895, (q15_t)0x3B17, (q15_t)0x275F, (q15_t)0xC4EE, (q15_t)0x58A1, (q15_t)0x3B12,
+    (q15_t)0x2754, (q15_t)0xC4F2, (q15_t)0x58AC, (q15_t)0x3B0E, (q15_t)0x2748, (q15_t)0xC4F7, (q15_t)0x58B8, (q15_t)0x3B09,
+    (q15_t)0x273D, (q15_t)0xC4FC, (q15_t)0x58C3, (q15_t)0x3B04, (q15_t)0x2731, (q15_t)0xC501, (q15_t)0x58CF, (q15_t)0x3AFF,
+    (q15_t)0x2725, (q15_t)0xC506, (q15_t)0x58DB, (q15_t)0x3AFA, (q15_t)0x271A, (q15_t)0xC50B, (q15_t)0x58E6, (q15_t)0x3AF5,
+    (q15_t)0x270E, (q15_t)0xC510, (q15_t)0x58F2, (q15_t)0x3AF0, (q15_t)0x2703, (q15_t)0xC515, (q15_t)0x58FD, (q15_t)0x3AEB,
+    (q15_t)0x26F7, (q15_t)0xC51A, (q15_t)0x5909, (q15_t)0x3AE6, (q15_t)0x26EC, (q15_t)0xC51E, (q15_t)0x5914, (q15_t)0x3AE2,
+    (q15_t)0x26E0, (q15_t)0xC523, (q15_t)0x5920, (q15_t)0x3ADD, (q15_t)0x26D4, (q15_t)0xC528, (q15_t)0x592C, (q15_t)0x3AD8,
+    (q15_t)0x26C9, (q15_t)0xC52D, (q15_t)0x5937, (q15_t)0x3AD3, (q15_t)0x26BD, (q15_t)0xC532, (q15_t)0x5943, (q15_t)0x3ACE,
+    (q15_t)0x26B2, (q15_t)0xC537, (q15_t)0x594E, (q15_t)0x3AC9, (q15_t)0x26A6, (q15_t)0xC53C, (q15_t)0x595A, (q15_t)0x3AC4,
+    (q15_t)0x269B, (q15_t)0xC541, (q15_t)0x5965, (q15_t)0x3ABF, (q15_t)0x268F, (q15_t)0xC546, (q15_t)0x5971, (q15_t)0x3ABA,
+    (q15_t)0x2684, (q15_t)0xC54B, (q15_t)0x597C, (q15_t)0x3AB5, (q15_t)0x2678, (q15_t)0xC550, (q15_t)0x5988, (q15_t)0x3AB0,
+    (q15_t)0x266D, (q15_t)0xC555, (q15_t)0x5993, (q15_t)0x3AAB, (q15_t)0x2661, (q15_t)0xC55A, (q15_t)0x599F, (q15_t)0x3AA6,
+    (q15_t)0x2656, (q15_t)0xC55F, (q15_t)0x59AA, (q15_t)0x3AA1, (q15_t)0x264A, (q15_t)0xC564, (q15_t)0x59B6, (q15_t)0x3A9C,
+    (q15_t)0x263F, (q15_t)0xC569, (q15_t)0x59C1, (q15_t)0x3A97, (q15_t)0x2633, (q15_t)0xC56E, (q15_t)0x59CD, (q15_t)0x3A92,
+    (q15_t)0x2628, (q15_t)0xC573, (q15_t)0x59D8, (q15_t)0x3A8D, (q15_t)0x261C, (q15_t)0xC578, (q15_t)0x59E4, (q15_t)0x3A88,
+    (q15_t)0x2611, (q15_t)0xC57E, (q15_t)0x59EF, (q15_t)0x3A82, (q15_t)0x2605, (q15_t)0xC583, (q15_t)0x59FB, (q15_t)0x3A7D,
+    (q15_t)0x25FA, (q15_t)0xC588, (q15_t)0x5A06, (q15_t)0x3A78, (q15_t)0x25EE, (q15_t)0xC58D, (q15_t)0x5A12, (q15_t)0x3A73,
+    (q15_t)0x25E3, (q15_t)0xC592, (q15_t)0x5A1D, (q15_t)0x3A6E, (q15_t)0x25D7, (q15_t)0xC597, (q15_t)0x5A29, (q15_t)0x3A69,
+    (q15_t)0x25CC, (q15_t)0xC59C, (q15_t)0x5A34, (q15_t)0x3A64, (q15_t)0x25C0, (q15_t)0xC5A1, (q15_t)0x5A40, (q15_t)0x3A5F,
+    (q15_t)0x25B5, (q15_t)0xC5A7, (q15_t)0x5A4B, (q15_t)0x3A59, (q15_t)0x25A9, (q15_t)0xC5AC, (q15_t)0x5A57, (q15_t)0x3A54,
+    (q15_t)0x259E, (q15_t)0xC5B1, (q15_t)0x5A62, (q15_t)0x3A4F, (q15_t)0x2592, (q15_t)0xC5B6, (q15_t)0x5A6E, (q15_t)0x3A4A,
+    (q15_t)0x2587, (q15_t)0xC5BB, (q15_t)0x5A79, (q15_t)0x3A45, (q15_t)0x257C, (q15_t)0xC5C1, (q15_t)0x5A84, (q15_t)0x3A3F,
+    (q15_t)0x2570, (q15_t)0xC5C6, (q15_t)0x5A90, (q15_t)0x3A3A, (q15_t)0x2565, (q15_t)0xC5CB, (q15_t)0x5A9B, (q15_t)0x3A35,
+    (q15_t)0x2559, (q15_t)0xC5D0, (q15_t)0x5AA7, (q15_t)0x3A30, (q15_t)0x254E, (q15_t)0xC5D5, (q15_t)0x5AB2, (q15_t)0x3A2B,
+    (q15_t)0x2542, (q15_t)0xC5DB, (q15_t)0x5ABE, (q15_t)0x3A25, (q15_t)0x2537, (q15_t)0xC5E0, (q15_t)0x5AC9, (q15_t)0x3A20,
+    (q15_t)0x252C, (q15_t)0xC5E5, (q15_t)0x5AD4, (q15_t)0x3A1B, (q15_t)0x2520, (q15_t)0xC5EA, (q15_t)0x5AE0, (q15_t)0x3A16,
+    (q15_t)0x2515, (q15_t)0xC5F0, (q15_t)0x5AEB, (q15_t)0x3A10, (q15_t)0x2509, (q15_t)0xC5F5, (q15_t)0x5AF7, (q15_t)0x3A0B,
+    (q15_t)0x24FE, (q15_t)0xC5FA, (q15_t)0x5B02, (q15_t)0x3A06, (q15_t)0x24F3, (q15_t)0xC600, (q15_t)0x5B0D, (q15_t)0x3A00,
+    (q15_t)0x24E7, (q15_t)0xC605, (q15_t)0x5B19, (q15_t)0x39FB, (q15_t)0x24DC, (q15_t)0xC60A, (q15_t)0x5B24, (q15_t)0x39F6,
+    (q15_t)0x24D0, (q15_t)0xC610, (q15_t)0x5B30, (q15_t)0x39F0, (q15_t)0x24C5, (q15_t)0xC615, (q15_t)0x5B3B, (q15_t)0x39EB,
+    (q15_t)0x24BA, (q15_t)0xC61A, (q15_t)0x5B46, (q15_t)0x39E6, (q15_t)0x24AE, (q15_t)0xC620, (q15_t)0x5B52, (q15_t)0x39E0,
+    (q15_t)0x24A3, (q15_t)0xC625, (q15_t)0x5B5D, (q15_t)0x39DB, (q15_t)0x2498, (q15_t)0xC62A, (q15_t)0x5B68, (q15_t)0x39D6,
+    (q15_t)0x248C, (q15_t)0xC630, (q15_t)0x5B74, (q15_t)0x39D0, (q15_t)0x2481, (q15_t)0xC635, (q15_t)0x5B7F, (q15_t)0x39CB,
+    (q15_t)0x2476, (q15_t)0xC63B, (q15_t)0x5B8A, (q15_t)0x39C5, (q15_t)0x246A, (q15_t)0xC640, (q15_t)0x5B96, (q15_t)0x39C0,
+    (q15_t)0x245F, (q15_t)0xC645, (q15_t)0x5BA1, (q15_t)0x39BB, (q15_t)0x2454, (q15_t)0xC64B, (q15_t)0x5BAC, (q15_t)0x39B5,
+    (q15_t)0x2448, (q15_t)0xC650, (q15_t)0x5BB8, (q15_t)0x39B0, (q15_t)0x243D, (q15_t)0xC656, (q15_t)0x5BC3, (q15_t)0x39AA,
+    (q15_t)0x2432, (q15_t)0xC65B, (q15_t)0x5BCE, (q15_t)0x39A5, (q15_t)0x2426, (q15_t)0xC661, (q15_t)0x5BDA, (q15_t)0x399F,
+    (q15_t)0x241B, (q15_t)0xC666, (q15_t)0x5BE5, (q15_t)0x399A, (q15_t)0x2410, (q15_t)0xC66C, (q15_t)0x5BF0, (q15_t)0x3994,
+    (q15_t)0x2404, (q15_t)0xC671, (q15_t)0x5BFC, (q15_t)0x398F, (q15_t)0x23F9, (q15_t)0xC677, (q15_t)0x5C07, (q15_t)0x3989,
+    (q15_t)0x23EE, (q15_t)0xC67C, (q15_t)0x5C12, (q15_t)0x3984, (q15_t)0x23E2, (q15_t)0xC682, (q15_t)0x5C1E, (q15_t)0x397E,
+    (q15_t)0x23D7, (q15_t)0xC687, (q15_t)0x5C29, (q15_t)0x3979, (q15_t)0x23CC, (q15_t)0xC68D, (q15_t)0x5C34, (q15_t)0x3973,
+    (q15_t)0x23C1, (q15_t)0xC692, (q15_t)0x5C3F, (q15_t)0x396E, (q15_t)0x23B5, (q15_t)0xC698, (q15_t)0x5C4B, (q15_t)0x3968,
+    (q15_t)0x23AA, (q15_t)0xC69D, (q15_t)0x5C56, (q15_t)0x3963, (q15_t)0x239F, (q15_t)0xC6A3, (q15_t)0x5C61, (q15_t)0x395D,
+    (q15_t)0x2394, (q15_t)0xC6A8, (q15_t)0x5C6C, (q15_t)0x3958, (q15_t)0x2388, (q15_t)0xC6AE, (q15_t)0x5C78, (q15_t)0x3952,
+    (q15_t)0x237D, (q15_t)0xC6B4, (q15_t)0x5C83, (q15_t)0x394C, (q15_t)0x2372, (q15_t)0xC6B9, (q15_t)0x5C8E, (q15_t)0x3947,
+    (q15_t)0x2367, (q15_t)0xC6BF, (q15_t)0x5C99, (q15_t)0x3941, (q15_t)0x235B, (q15_t)0xC6C5, (q15_t)0x5CA5, (q15_t)0x393B,
+    (q15_t)0x2350, (q15_t)0xC6CA, (q15_t)0x5CB0, (q15_t)0x3936, (q15_t)0x2345, (q15_t)0xC6D0, (q15_t)0x5CBB, (q15_t)0x3930,
+    (q15_t)0x233A, (q15_t)0xC6D5, (q15_t)0x5CC6, (q15_t)0x392B, (q15_t)0x232E, (q15_t)0xC6DB, (q15_t)0x5CD2, (q15_t)0x3925,
+    (q15_t)0x2323, (q15_t)0xC6E1, (q15_t)0x5CDD, (q15_t)0x391F, (q15_t)0x2318, (q15_t)0xC6E6, (q15_t)0x5CE8, (q15_t)0x391A,
+    (q15_t)0x230D, (q15_t)0xC6EC, (q15_t)0x5CF3, (q15_t)0x3914, (q15_t)0x2301, (q15_t)0xC6F2, (q15_t)0x5CFF, (q15_t)0x390E,
+    (q15_t)0x22F6, (q15_t)0xC6F7, (q15_t)0x5D0A, (q15_t)0x3909, (q15_t)0x22EB, (q15_t)0xC6FD, (q15_t)0x5D15, (q15_t)0x3903,
+    (q15_t)0x22E0, (q15_t)0xC703, (q15_t)0x5D20, (q15_t)0x38FD, (q15_t)0x22D5, (q15_t)0xC709, (q15_t)0x5D2B, (q15_t)0x38F7,
+    (q15_t)0x22CA, (q15_t)0xC70E, (q15_t)0x5D36, (q15_t)0x38F2, (q15_t)0x22BE, (q15_t)0xC714, (q15_t)0x5D42, (q15_t)0x38EC,
+    (q15_t)0x22B3, (q15_t)0xC71A, (q15_t)0x5D4D, (q15_t)0x38E6, (q15_t)0x22A8, (q15_t)0xC720, (q15_t)0x5D58, (q15_t)0x38E0,
+    (q15_t)0x229D, (q15_t)0xC725, (q15_t)0x5D63, (q15_t)0x38DB, (q15_t)0x2292, (q15_t)0xC72B, (q15_t)0x5D6E, (q15_t)0x38D5,
+    (q15_t)0x2287, (q15_t)0xC731, (q15_t)0x5D79, (q15_t)0x38CF, (q15_t)0x227B, (q15_t)0xC737, (q15_t)0x5D85, (q15_t)0x38C9,
+    (q15_t)0x2270, (q15_t)0xC73D, (q15_t)0x5D90, (q15_t)0x38C3, (q15_t)0x2265, (q15_t)0xC742, (q15_t)0x5D9B, (q15_t)0x38BE,
+    (q15_t)0x225A, (q15_t)0xC748, (q15_t)0x5DA6, (q15_t)0x38B8, (q15_t)0x224F, (q15_t)0xC74E, (q15_t)0x5DB1, (q15_t)0x38B2,
+    (q15_t)0x2244, (q15_t)0xC754, (q15_t)0x5DBC, (q15_t)0x38AC, (q15_t)0x2239, (q15_t)0xC75A, (q15_t)0x5DC7, (q15_t)0x38A6,
+    (q15_t)0x222D, (q15_t)0xC75F, (q15_t)0x5DD3, (q15_t)0x38A1, (q15_t)0x2222, (q15_t)0xC765, (q15_t)0x5DDE, (q15_t)0x389B,
+    (q15_t)0x2217, (q15_t)0xC76B, (q15_t)0x5DE9, (q15_t)0x3895, (q15_t)0x220C, (q15_t)0xC771, (q15_t)0x5DF4, (q15_t)0x388F,
+    (q15_t)0x2201, (q15_t)0xC777, (q15_t)0x5DFF, (q15_t)0x3889, (q15_t)0x21F6, (q15_t)0xC77D, (q15_t)0x5E0A, (q15_t)0x3883,
+    (q15_t)0x21EB, (q15_t)0xC783, (q15_t)0x5E15, (q15_t)0x387D, (q15_t)0x21E0, (q15_t)0xC789, (q15_t)0x5E20, (q15_t)0x3877,
+    (q15_t)0x21D5, (q15_t)0xC78F, (q15_t)0x5E2B, (q15_t)0x3871, (q15_t)0x21CA, (q15_t)0xC795, (q15_t)0x5E36, (q15_t)0x386B,
+    (q15_t)0x21BE, (q15_t)0xC79A, (q15_t)0x5E42, (q15_t)0x3866, (q15_t)0x21B3, (q15_t)0xC7A0, (q15_t)0x5E4D, (q15_t)0x3860,
+    (q15_t)0x21A8, (q15_t)0xC7A6, (q15_t)0x5E58, (q15_t)0x385A, (q15_t)0x219D, (q15_t)0xC7AC, (q15_t)0x5E63, (q15_t)0x3854,
+    (q15_t)0x2192, (q15_t)0xC7B2, (q15_t)0x5E6E, (q15_t)0x384E, (q15_t)0x2187, (q15_t)0xC7B8, (q15_t)0x5E79, (q15_t)0x3848,
+    (q15_t)0x217C, (q15_t)0xC7BE, (q15_t)0x5E84, (q15_t)0x3842, (q15_t)0x2171, (q15_t)0xC7C4, (q15_t)0x5E8F, (q15_t)0x383C,
+    (q15_t)0x2166, (q15_t)0xC7CA, (q15_t)0x5E9A, (q15_t)0x3836, (q15_t)0x215B, (q15_t)0xC7D0, (q15_t)0x5EA5, (q15_t)0x3830,
+    (q15_t)0x2150, (q15_t)0xC7D6, (q15_t)0x5EB0, (q15_t)0x382A, (q15_t)0x2145, (q15_t)0xC7DC, (q15_t)0x5EBB, (q15_t)0x3824,
+    (q15_t)0x213A, (q15_t)0xC7E2, (q15_t)0x5EC6, (q15_t)0x381E, (q15_t)0x212F, (q15_t)0xC7E8, (q15_t)0x5ED1, (q15_t)0x3818,
+    (q15_t)0x2124, (q15_t)0xC7EE, (q15_t)0x5EDC, (q15_t)0x3812, (q15_t)0x2119, (q15_t)0xC7F5, (q15_t)0x5EE7, (q15_t)0x380B,
+    (q15_t)0x210E, (q15_t)0xC7FB, (q15_t)0x5EF2, (q15_t)0x3805, (q15_t)0x2103, (q15_t)0xC801, (q15_t)0x5EFD, (q15_t)0x37FF,
+    (q15_t)0x20F8, (q15_t)0xC807, (q15_t)0x5F08, (q15_t)0x37F9, (q15_t)0x20ED, (q15_t)0xC80D, (q15_t)0x5F13, (q15_t)0x37F3,
+    (q15_t)0x20E2, (q15_t)0xC813, (q15_t)0x5F1E, (q15_t)0x37ED, (q15_t)0x20D7, (q15_t)0xC819, (q15_t)0x5F29, (q15_t)0x37E7,
+    (q15_t)0x20CC, (q15_t)0xC81F, (q15_t)0x5F34, (q15_t)0x37E1, (q15_t)0x20C1, (q15_t)0xC825, (q15_t)0x5F3F, (q15_t)0x37DB,
+    (q15_t)0x20B6, (q15_t)0xC82B, (q15_t)0x5F4A, (q15_t)0x37D5, (q15_t)0x20AB, (q15_t)0xC832, (q15_t)0x5F55, (q15_t)0x37CE,
+    (q15_t)0x20A0, (q15_t)0xC838, (q15_t)0x5F60, (q15_t)0x37C8, (q15_t)0x2095, (q15_t)0xC83E, (q15_t)0x5F6B, (q15_t)0x37C2,
+    (q15_t)0x208A, (q15_t)0xC844, (q15_t)0x5F76, (q15_t)0x37BC, (q15_t)0x207F, (q15_t)0xC84A, (q15_t)0x5F81, (q15_t)0x37B6,
+    (q15_t)0x2074, (q15_t)0xC850, (q15_t)0x5F8C, (q15_t)0x37B0, (q15_t)0x2069, (q15_t)0xC857, (q15_t)0x5F97, (q15_t)0x37A9,
+    (q15_t)0x205E, (q15_t)0xC85D, (q15_t)0x5FA2, (q15_t)0x37A3, (q15_t)0x2054, (q15_t)0xC863, (q15_t)0x5FAC, (q15_t)0x379D,
+    (q15_t)0x2049, (q15_t)0xC869, (q15_t)0x5FB7, (q15_t)0x3797, (q15_t)0x203E, (q15_t)0xC870, (q15_t)0x5FC2, (q15_t)0x3790,
+    (q15_t)0x2033, (q15_t)0xC876, (q15_t)0x5FCD, (q15_t)0x378A, (q15_t)0x2028, (q15_t)0xC87C, (q15_t)0x5FD8, (q15_t)0x3784,
+    (q15_t)0x201D, (q15_t)0xC882, (q15_t)0x5FE3, (q15_t)0x377E, (q15_t)0x2012, (q15_t)0xC889, (q15_t)0x5FEE, (q15_t)0x3777,
+    (q15_t)0x2007, (q15_t)0xC88F, (q15_t)0x5FF9, (q15_t)0x3771, (q15_t)0x1FFC, (q15_t)0xC895, (q15_t)0x6004, (q15_t)0x376B,
+    (q15_t)0x1FF1, (q15_t)0xC89B, (q15_t)0x600F, (q15_t)0x3765, (q15_t)0x1FE7, (q15_t)0xC8A2, (q15_t)0x6019, (q15_t)0x375E,
+    (q15_t)0x1FDC, (q15_t)0xC8A8, (q15_t)0x6024, (q15_t)0x3758, (q15_t)0x1FD1, (q15_t)0xC8AE, (q15_t)0x602F, (q15_t)0x3752,
+    (q15_t)0x1FC6, (q15_t)0xC8B5, (q15_t)0x603A, (q15_t)0x374B, (q15_t)0x1FBB, (q15_t)0xC8BB, (q15_t)0x6045, (q15_t)0x3745,
+    (q15_t)0x1FB0, (q15_t)0xC8C1, (q15_t)0x6050, (q15_t)0x373F, (q15_t)0x1FA5, (q15_t)0xC8C8, (q15_t)0x605B, (q15_t)0x3738,
+    (q15_t)0x1F9B, (q15_t)0xC8CE, (q15_t)0x6065, (q15_t)0x3732, (q15_t)0x1F90, (q15_t)0xC8D4, (q15_t)0x6070, (q15_t)0x372C,
+    (q15_t)0x1F85, (q15_t)0xC8DB, (q15_t)0x607B, (q15_t)0x3725, (q15_t)0x1F7A, (q15_t)0xC8E1, (q15_t)0x6086, (q15_t)0x371F,
+    (q15_t)0x1F6F, (q15_t)0xC8E8, (q15_t)0x6091, (q15_t)0x3718, (q15_t)0x1F65, (q15_t)0xC8EE, (q15_t)0x609B, (q15_t)0x3712,
+    (q15_t)0x1F5A, (q15_t)0xC8F4, (q15_t)0x60A6, (q15_t)0x370C, (q15_t)0x1F4F, (q15_t)0xC8FB, (q15_t)0x60B1, (q15_t)0x3705,
+    (q15_t)0x1F44, (q15_t)0xC901, (q15_t)0x60BC, (q15_t)0x36FF, (q15_t)0x1F39, (q15_t)0xC908, (q15_t)0x60C7, (q15_t)0x36F8,
+    (q15_t)0x1F2F, (q15_t)0xC90E, (q15_t)0x60D1, (q15_t)0x36F2, (q15_t)0x1F24, (q15_t)0xC915, (q15_t)0x60DC, (q15_t)0x36EB,
+    (q15_t)0x1F19, (q15_t)0xC91B, (q15_t)0x60E7, (q15_t)0x36E5, (q15_t)0x1F0E, (q15_t)0xC921, (q15_t)0x60F2, (q15_t)0x36DF,
+    (q15_t)0x1F03, (q15_t)0xC928, (q15_t)0x60FD, (q15_t)0x36D8, (q15_t)0x1EF9, (q15_t)0xC92E, (q15_t)0x6107, (q15_t)0x36D2,
+    (q15_t)0x1EEE, (q15_t)0xC935, (q15_t)0x6112, (q15_t)0x36CB, (q15_t)0x1EE3, (q15_t)0xC93B, (q15_t)0x611D, (q15_t)0x36C5,
+    (q15_t)0x1ED8, (q15_t)0xC942, (q15_t)0x6128, (q15_t)0x36BE, (q15_t)0x1ECE, (q15_t)0xC948, (q15_t)0x6132, (q15_t)0x36B8,
+    (q15_t)0x1EC3, (q15_t)0xC94F, (q15_t)0x613D, (q15_t)0x36B1, (q15_t)0x1EB8, (q15_t)0xC955, (q15_t)0x6148, (q15_t)0x36AB,
+    (q15_t)0x1EAD, (q15_t)0xC95C, (q15_t)0x6153, (q15_t)0x36A4, (q15_t)0x1EA3, (q15_t)0xC963, (q15_t)0x615D, (q15_t)0x369D,
+    (q15_t)0x1E98, (q15_t)0xC969, (q15_t)0x6168, (q15_t)0x3697, (q15_t)0x1E8D, (q15_t)0xC970, (q15_t)0x6173, (q15_t)0x3690,
+    (q15_t)0x1E83, (q15_t)0xC976, (q15_t)0x617D, (q15_t)0x368A, (q15_t)0x1E78, (q15_t)0xC97D, (q15_t)0x6188, (q15_t)0x3683,
+    (q15_t)0x1E6D, (q15_t)0xC983, (q15_t)0x6193, (q15_t)0x367D, (q15_t)0x1E62, (q15_t)0xC98A, (q15_t)0x619E, (q15_t)0x3676,
+    (q15_t)0x1E58, (q15_t)0xC991, (q15_t)0x61A8, (q15_t)0x366F, (q15_t)0x1E4D, (q15_t)0xC997, (q15_t)0x61B3, (q15_t)0x3669,
+    (q15_t)0x1E42, (q15_t)0xC99E, (q15_t)0x61BE, (q15_t)0x3662, (q15_t)0x1E38, (q15_t)0xC9A4, (q15_t)0x61C8, (q15_t)0x365C,
+    (q15_t)0x1E2D, (q15_t)0xC9AB, (q15_t)0x61D3, (q15_t)0x3655, (q15_t)0x1E22, (q15_t)0xC9B2, (q15_t)0x61DE, (q15_t)0x364E,
+    (q15_t)0x1E18, (q15_t)0xC9B8, (q15_t)0x61E8, (q15_t)0x3648, (q15_t)0x1E0D, (q15_t)0xC9BF, (q15_t)0x61F3, (q15_t)0x3641,
+    (q15_t)0x1E02, (q15_t)0xC9C6, (q15_t)0x61FE, (q15_t)0x363A, (q15_t)0x1DF8, (q15_t)0xC9CC, (q15_t)0x6208, (q15_t)0x3634,
+    (q15_t)0x1DED, (q15_t)0xC9D3, (q15_t)0x6213, (q15_t)0x362D, (q15_t)0x1DE2, (q15_t)0xC9DA, (q15_t)0x621E, (q15_t)0x3626,
+    (q15_t)0x1DD8, (q15_t)0xC9E0, (q15_t)0x6228, (q15_t)0x3620, (q15_t)0x1DCD, (q15_t)0xC9E7, (q15_t)0x6233, (q15_t)0x3619,
+    (q15_t)0x1DC3, (q15_t)0xC9EE, (q15_t)0x623D, (q15_t)0x3612, (q15_t)0x1DB8, (q15_t)0xC9F5, (q15_t)0x6248, (q15_t)0x360B,
+    (q15_t)0x1DAD, (q15_t)0xC9FB, (q15_t)0x6253, (q15_t)0x3605, (q15_t)0x1DA3, (q15_t)0xCA02, (q15_t)0x625D, (q15_t)0x35FE,
+    (q15_t)0x1D98, (q15_t)0xCA09, (q15_t)0x6268, (q15_t)0x35F7, (q15_t)0x1D8E, (q15_t)0xCA10, (q15_t)0x6272, (q15_t)0x35F0,
+    (q15_t)0x1D83, (q15_t)0xCA16, (q15_t)0x627D, (q15_t)0x35EA, (q15_t)0x1D78, (q15_t)0xCA1D, (q15_t)0x6288, (q15_t)0x35E3,
+    (q15_t)0x1D6E, (q15_t)0xCA24, (q15_t)0x6292, (q15_t)0x35DC, (q15_t)0x1D63, (q15_t)0xCA2B, (q15_t)0x629D, (q15_t)0x35D5,
+    (q15_t)0x1D59, (q15_t)0xCA32, (q15_t)0x62A7, (q15_t)0x35CE, (q15_t)0x1D4E, (q15_t)0xCA38, (q15_t)0x62B2, (q15_t)0x35C8,
+    (q15_t)0x1D44, (q15_t)0xCA3F, (q15_t)0x62BC, (q15_t)0x35C1, (q15_t)0x1D39, (q15_t)0xCA46, (q15_t)0x62C7, (q15_t)0x35BA,
+    (q15_t)0x1D2E, (q15_t)0xCA4D, (q15_t)0x62D2, (q15_t)0x35B3, (q15_t)0x1D24, (q15_t)0xCA54, (q15_t)0x62DC, (q15_t)0x35AC,
+    (q15_t)0x1D19, (q15_t)0xCA5B, (q15_t)0x62E7, (q15_t)0x35A5, (q15_t)0x1D0F, (q15_t)0xCA61, (q15_t)0x62F1, (q15_t)0x359F,
+    (q15_t)0x1D04, (q15_t)0xCA68, (q15_t)0x62FC, (q15_t)0x3598, (q15_t)0x1CFA, (q15_t)0xCA6F, (q15_t)0x6306, (q15_t)0x3591,
+    (q15_t)0x1CEF, (q15_t)0xCA76, (q15_t)0x6311, (q15_t)0x358A, (q15_t)0x1CE5, (q15_t)0xCA7D, (q15_t)0x631B, (q15_t)0x3583,
+    (q15_t)0x1CDA, (q15_t)0xCA84, (q15_t)0x6326, (q15_t)0x357C, (q15_t)0x1CD0, (q15_t)0xCA8B, (q15_t)0x6330, (q15_t)0x3575,
+    (q15_t)0x1CC5, (q15_t)0xCA92, (q15_t)0x633B, (q15_t)0x356E, (q15_t)0x1CBB, (q15_t)0xCA99, (q15_t)0x6345, (q15_t)0x3567,
+    (q15_t)0x1CB0, (q15_t)0xCA9F, (q15_t)0x6350, (q15_t)0x3561, (q15_t)0x1CA6, (q15_t)0xCAA6, (q15_t)0x635A, (q15_t)0x355A,
+    (q15_t)0x1C9B, (q15_t)0xCAAD, (q15_t)0x6365, (q15_t)0x3553, (q15_t)0x1C91, (q15_t)0xCAB4, (q15_t)0x636F, (q15_t)0x354C,
+    (q15_t)0x1C86, (q15_t)0xCABB, (q15_t)0x637A, (q15_t)0x3545, (q15_t)0x1C7C, (q15_t)0xCAC2, (q15_t)0x6384, (q15_t)0x353E,
+    (q15_t)0x1C72, (q15_t)0xCAC9, (q15_t)0x638E, (q15_t)0x3537, (q15_t)0x1C67, (q15_t)0xCAD0, (q15_t)0x6399, (q15_t)0x3530,
+    (q15_t)0x1C5D, (q15_t)0xCAD7, (q15_t)0x63A3, (q15_t)0x3529, (q15_t)0x1C52, (q15_t)0xCADE, (q15_t)0x63AE, (q15_t)0x3522,
+    (q15_t)0x1C48, (q15_t)0xCAE5, (q15_t)0x63B8, (q15_t)0x351B, (q15_t)0x1C3D, (q15_t)0xCAEC, (q15_t)0x63C3, (q15_t)0x3514,
+    (q15_t)0x1C33, (q15_t)0xCAF3, (q15_t)0x63CD, (q15_t)0x350D, (q15_t)0x1C29, (q15_t)0xCAFA, (q15_t)0x63D7, (q15_t)0x3506,
+    (q15_t)0x1C1E, (q15_t)0xCB01, (q15_t)0x63E2, (q15_t)0x34FF, (q15_t)0x1C14, (q15_t)0xCB08, (q15_t)0x63EC, (q15_t)0x34F8,
+    (q15_t)0x1C09, (q15_t)0xCB0F, (q15_t)0x63F7, (q15_t)0x34F1, (q15_t)0x1BFF, (q15_t)0xCB16, (q15_t)0x6401, (q15_t)0x34EA,
+    (q15_t)0x1BF5, (q15_t)0xCB1E, (q15_t)0x640B, (q15_t)0x34E2, (q15_t)0x1BEA, (q15_t)0xCB25, (q15_t)0x6416, (q15_t)0x34DB,
+    (q15_t)0x1BE0, (q15_t)0xCB2C, (q15_t)0x6420, (q15_t)0x34D4, (q15_t)0x1BD5, (q15_t)0xCB33, (q15_t)0x642B, (q15_t)0x34CD,
+    (q15_t)0x1BCB, (q15_t)0xCB3A, (q15_t)0x6435, (q15_t)0x34C6, (q15_t)0x1BC1, (q15_t)0xCB41, (q15_t)0x643F, (q15_t)0x34BF,
+    (q15_t)0x1BB6, (q15_t)0xCB48, (q15_t)0x644A, (q15_t)0x34B8, (q15_t)0x1BAC, (q15_t)0xCB4F, (q15_t)0x6454, (q15_t)0x34B1,
+    (q15_t)0x1BA2, (q15_t)0xCB56, (q15_t)0x645E, (q15_t)0x34AA, (q15_t)0x1B97, (q15_t)0xCB5E, (q15_t)0x6469, (q15_t)0x34A2,
+    (q15_t)0x1B8D, (q15_t)0xCB65, (q15_t)0x6473, (q15_t)0x349B, (q15_t)0x1B83, (q15_t)0xCB6C, (q15_t)0x647D, (q15_t)0x3494,
+    (q15_t)0x1B78, (q15_t)0xCB73, (q15_t)0x6488, (q15_t)0x348D, (q15_t)0x1B6E, (q15_t)0xCB7A, (q15_t)0x6492, (q15_t)0x3486,
+    (q15_t)0x1B64, (q15_t)0xCB81, (q15_t)0x649C, (q15_t)0x347F, (q15_t)0x1B59, (q15_t)0xCB89, (q15_t)0x64A7, (q15_t)0x3477,
+    (q15_t)0x1B4F, (q15_t)0xCB90, (q15_t)0x64B1, (q15_t)0x3470, (q15_t)0x1B45, (q15_t)0xCB97, (q15_t)0x64BB, (q15_t)0x3469,
+    (q15_t)0x1B3B, (q15_t)0xCB9E, (q15_t)0x64C5, (q15_t)0x3462, (q15_t)0x1B30, (q15_t)0xCBA5, (q15_t)0x64D0, (q15_t)0x345B,
+    (q15_t)0x1B26, (q15_t)0xCBAD, (q15_t)0x64DA, (q15_t)0x3453, (q15_t)0x1B1C, (q15_t)0xCBB4, (q15_t)0x64E4, (q15_t)0x344C,
+    (q15_t)0x1B11, (q15_t)0xCBBB, (q15_t)0x64EF, (q15_t)0x3445, (q15_t)0x1B07, (q15_t)0xCBC2, (q15_t)0x64F9, (q15_t)0x343E,
+    (q15_t)0x1AFD, (q15_t)0xCBCA, (q15_t)0x6503, (q15_t)0x3436, (q15_t)0x1AF3, (q15_t)0xCBD1, (q15_t)0x650D, (q15_t)0x342F,
+    (q15_t)0x1AE8, (q15_t)0xCBD8, (q15_t)0x6518, (q15_t)0x3428, (q15_t)0x1ADE, (q15_t)0xCBE0, (q15_t)0x6522, (q15_t)0x3420,
+    (q15_t)0x1AD4, (q15_t)0xCBE7, (q15_t)0x652C, (q15_t)0x3419, (q15_t)0x1ACA, (q15_t)0xCBEE, (q15_t)0x6536, (q15_t)0x3412,
+    (q15_t)0x1ABF, (q15_t)0xCBF5, (q15_t)0x6541, (q15_t)0x340B, (q15_t)0x1AB5, (q15_t)0xCBFD, (q15_t)0x654B, (q15_t)0x3403,
+    (q15_t)0x1AAB, (q15_t)0xCC04, (q15_t)0x6555, (q15_t)0x33FC, (q15_t)0x1AA1, (q15_t)0xCC0B, (q15_t)0x655F, (q15_t)0x33F5,
+    (q15_t)0x1A97, (q15_t)0xCC13, (q15_t)0x6569, (q15_t)0x33ED, (q15_t)0x1A8C, (q15_t)0xCC1A, (q15_t)0x6574, (q15_t)0x33E6,
+    (q15_t)0x1A82, (q15_t)0xCC21, (q15_t)0x657E, (q15_t)0x33DF, (q15_t)0x1A78, (q15_t)0xCC29, (q15_t)0x6588, (q15_t)0x33D7,
+    (q15_t)0x1A6E, (q15_t)0xCC30, (q15_t)0x6592, (q15_t)0x33D0, (q15_t)0x1A64, (q15_t)0xCC38, (q15_t)0x659C, (q15_t)0x33C8,
+    (q15_t)0x1A5A, (q15_t)0xCC3F, (q15_t)0x65A6, (q15_t)0x33C1, (q15_t)0x1A4F, (q15_t)0xCC46, (q15_t)0x65B1, (q15_t)0x33BA,
+    (q15_t)0x1A45, (q15_t)0xCC4E, (q15_t)0x65BB, (q15_t)0x33B2, (q15_t)0x1A3B, (q15_t)0xCC55, (q15_t)0x65C5, (q15_t)0x33AB,
+    (q15_t)0x1A31, (q15_t)0xCC5D, (q15_t)0x65CF, (q15_t)0x33A3, (q15_t)0x1A27, (q15_t)0xCC64, (q15_t)0x65D9, (q15_t)0x339C,
+    (q15_t)0x1A1D, (q15_t)0xCC6B, (q15_t)0x65E3, (q15_t)0x3395, (q15_t)0x1A13, (q15_t)0xCC73, (q15_t)0x65ED, (q15_t)0x338D,
+    (q15_t)0x1A08, (q15_t)0xCC7A, (q15_t)0x65F8, (q15_t)0x3386, (q15_t)0x19FE, (q15_t)0xCC82, (q15_t)0x6602, (q15_t)0x337E,
+    (q15_t)0x19F4, (q15_t)0xCC89, (q15_t)0x660C, (q15_t)0x3377, (q15_t)0x19EA, (q15_t)0xCC91, (q15_t)0x6616, (q15_t)0x336F,
+    (q15_t)0x19E0, (q15_t)0xCC98, (q15_t)0x6620, (q15_t)0x3368, (q15_t)0x19D6, (q15_t)0xCCA0, (q15_t)0x662A, (q15_t)0x3360,
+    (q15_t)0x19CC, (q15_t)0xCCA7, (q15_t)0x6634, (q15_t)0x3359, (q15_t)0x19C2, (q15_t)0xCCAF, (q15_t)0x663E, (q15_t)0x3351,
+    (q15_t)0x19B8, (q15_t)0xCCB6, (q15_t)0x6648, (q15_t)0x334A, (q15_t)0x19AE, (q15_t)0xCCBE, (q15_t)0x6652, (q15_t)0x3342,
+    (q15_t)0x19A4, (q15_t)0xCCC5, (q15_t)0x665C, (q15_t)0x333B, (q15_t)0x199A, (q15_t)0xCCCD, (q15_t)0x6666, (q15_t)0x3333,
+    (q15_t)0x198F, (q15_t)0xCCD4, (q15_t)0x6671, (q15_t)0x332C, (q15_t)0x1985, (q15_t)0xCCDC, (q15_t)0x667B, (q15_t)0x3324,
+    (q15_t)0x197B, (q15_t)0xCCE3, (q15_t)0x6685, (q15_t)0x331D, (q15_t)0x1971, (q15_t)0xCCEB, (q15_t)0x668F, (q15_t)0x3315,
+    (q15_t)0x1967, (q15_t)0xCCF3, (q15_t)0x6699, (q15_t)0x330D, (q15_t)0x195D, (q15_t)0xCCFA, (q15_t)0x66A3, (q15_t)0x3306,
+    (q15_t)0x1953, (q15_t)0xCD02, (q15_t)0x66AD, (q15_t)0x32FE, (q15_t)0x1949, (q15_t)0xCD09, (q15_t)0x66B7, (q15_t)0x32F7,
+    (q15_t)0x193F, (q15_t)0xCD11, (q15_t)0x66C1, (q15_t)0x32EF, (q15_t)0x1935, (q15_t)0xCD19, (q15_t)0x66CB, (q15_t)0x32E7,
+    (q15_t)0x192B, (q15_t)0xCD20, (q15_t)0x66D5, (q15_t)0x32E0, (q15_t)0x1921, (q15_t)0xCD28, (q15_t)0x66DF, (q15_t)0x32D8,
+    (q15_t)0x1917, (q15_t)0xCD30, (q15_t)0x66E9, (q15_t)0x32D0, (q15_t)0x190D, (q15_t)0xCD37, (q15_t)0x66F3, (q15_t)0x32C9,
+    (q15_t)0x1903, (q15_t)0xCD3F, (q15_t)0x66FD, (q15_t)0x32C1, (q15_t)0x18F9, (q15_t)0xCD46, (q15_t)0x6707, (q15_t)0x32BA,
+    (q15_t)0x18EF, (q15_t)0xCD4E, (q15_t)0x6711, (q15_t)0x32B2, (q15_t)0x18E6, (q15_t)0xCD56, (q15_t)0x671A, (q15_t)0x32AA,
+    (q15_t)0x18DC, (q15_t)0xCD5D, (q15_t)0x6724, (q15_t)0x32A3, (q15_t)0x18D2, (q15_t)0xCD65, (q15_t)0x672E, (q15_t)0x329B,
+    (q15_t)0x18C8, (q15_t)0xCD6D, (q15_t)0x6738, (q15_t)0x3293, (q15_t)0x18BE, (q15_t)0xCD75, (q15_t)0x6742, (q15_t)0x328B,
+    (q15_t)0x18B4, (q15_t)0xCD7C, (q15_t)0x674C, (q15_t)0x3284, (q15_t)0x18AA, (q15_t)0xCD84, (q15_t)0x6756, (q15_t)0x327C,
+    (q15_t)0x18A0, (q15_t)0xCD8C, (q15_t)0x6760, (q15_t)0x3274, (q15_t)0x1896, (q15_t)0xCD93, (q15_t)0x676A, (q15_t)0x326D,
+    (q15_t)0x188C, (q15_t)0xCD9B, (q15_t)0x6774, (q15_t)0x3265, (q15_t)0x1882, (q15_t)0xCDA3, (q15_t)0x677E, (q15_t)0x325D,
+    (q15_t)0x1878, (q15_t)0xCDAB, (q15_t)0x6788, (q15_t)0x3255, (q15_t)0x186F, (q15_t)0xCDB2, (q15_t)0x6791, (q15_t)0x324E,
+    (q15_t)0x1865, (q15_t)0xCDBA, (q15_t)0x679B, (q15_t)0x3246, (q15_t)0x185B, (q15_t)0xCDC2, (q15_t)0x67A5, (q15_t)0x323E,
+    (q15_t)0x1851, (q15_t)0xCDCA, (q15_t)0x67AF, (q15_t)0x3236, (q15_t)0x1847, (q15_t)0xCDD2, (q15_t)0x67B9, (q15_t)0x322E,
+    (q15_t)0x183D, (q15_t)0xCDD9, (q15_t)0x67C3, (q15_t)0x3227, (q15_t)0x1833, (q15_t)0xCDE1, (q15_t)0x67CD, (q15_t)0x321F,
+    (q15_t)0x182A, (q15_t)0xCDE9, (q15_t)0x67D6, (q15_t)0x3217, (q15_t)0x1820, (q15_t)0xCDF1, (q15_t)0x67E0, (q15_t)0x320F,
+    (q15_t)0x1816, (q15_t)0xCDF9, (q15_t)0x67EA, (q15_t)0x3207, (q15_t)0x180C, (q15_t)0xCE01, (q15_t)0x67F4, (q15_t)0x31FF,
+    (q15_t)0x1802, (q15_t)0xCE08, (q15_t)0x67FE, (q15_t)0x31F8, (q15_t)0x17F8, (q15_t)0xCE10, (q15_t)0x6808, (q15_t)0x31F0,
+    (q15_t)0x17EF, (q15_t)0xCE18, (q15_t)0x6811, (q15_t)0x31E8, (q15_t)0x17E5, (q15_t)0xCE20, (q15_t)0x681B, (q15_t)0x31E0,
+    (q15_t)0x17DB, (q15_t)0xCE28, (q15_t)0x6825, (q15_t)0x31D8, (q15_t)0x17D1, (q15_t)0xCE30, (q15_t)0x682F, (q15_t)0x31D0,
+    (q15_t)0x17C8, (q15_t)0xCE38, (q15_t)0x6838, (q15_t)0x31C8, (q15_t)0x17BE, (q15_t)0xCE40, (q15_t)0x6842, (q15_t)0x31C0,
+    (q15_t)0x17B4, (q15_t)0xCE47, (q15_t)0x684C, (q15_t)0x31B9, (q15_t)0x17AA, (q15_t)0xCE4F, (q15_t)0x6856, (q15_t)0x31B1,
+    (q15_t)0x17A0, (q15_t)0xCE57, (q15_t)0x6860, (q15_t)0x31A9, (q15_t)0x1797, (q15_t)0xCE5F, (q15_t)0x6869, (q15_t)0x31A1,
+    (q15_t)0x178D, (q15_t)0xCE67, (q15_t)0x6873, (q15_t)0x3199, (q15_t)0x1783, (q15_t)0xCE6F, (q15_t)0x687D, (q15_t)0x3191,
+    (q15_t)0x177A, (q15_t)0xCE77, (q15_t)0x6886, (q15_t)0x3189, (q15_t)0x1770, (q15_t)0xCE7F, (q15_t)0x6890, (q15_t)0x3181,
+    (q15_t)0x1766, (q15_t)0xCE87, (q15_t)0x689A, (q15_t)0x3179, (q15_t)0x175C, (q15_t)0xCE8F, (q15_t)0x68A4, (q15_t)0x3171,
+    (q15_t)0x1753, (q15_t)0xCE97, (q15_t)0x68AD, (q15_t)0x3169, (q15_t)0x1749, (q15_t)0xCE9F, (q15_t)0x68B7, (q15_t)0x3161,
+    (q15_t)0x173F, (q15_t)0xCEA7, (q15_t)0x68C1, (q15_t)0x3159, (q15_t)0x1736, (q15_t)0xCEAF, (q15_t)0x68CA, (q15_t)0x3151,
+    (q15_t)0x172C, (q15_t)0xCEB7, (q15_t)0x68D4, (q15_t)0x3149, (q15_t)0x1722, (q15_t)0xCEBF, (q15_t)0x68DE, (q15_t)0x3141,
+    (q15_t)0x1719, (q15_t)0xCEC7, (q15_t)0x68E7, (q15_t)0x3139, (q15_t)0x170F, (q15_t)0xCECF, (q15_t)0x68F1, (q15_t)0x3131,
+    (q15_t)0x1705, (q15_t)0xCED7, (q15_t)0x68FB, (q15_t)0x3129, (q15_t)0x16FC, (q15_t)0xCEDF, (q15_t)0x6904, (q15_t)0x3121,
+    (q15_t)0x16F2, (q15_t)0xCEE7, (q15_t)0x690E, (q15_t)0x3119, (q15_t)0x16E8, (q15_t)0xCEEF, (q15_t)0x6918, (q15_t)0x3111,
+    (q15_t)0x16DF, (q15_t)0xCEF7, (q15_t)0x6921, (q15_t)0x3109, (q15_t)0x16D5, (q15_t)0xCEFF, (q15_t)0x692B, (q15_t)0x3101,
+    (q15_t)0x16CB, (q15_t)0xCF07, (q15_t)0x6935, (q15_t)0x30F9, (q15_t)0x16C2, (q15_t)0xCF10, (q15_t)0x693E, (q15_t)0x30F0,
+    (q15_t)0x16B8, (q15_t)0xCF18, (q15_t)0x6948, (q15_t)0x30E8, (q15_t)0x16AF, (q15_t)0xCF20, (q15_t)0x6951, (q15_t)0x30E0,
+    (q15_t)0x16A5, (q15_t)0xCF28, (q15_t)0x695B, (q15_t)0x30D8, (q15_t)0x169B, (q15_t)0xCF30, (q15_t)0x6965, (q15_t)0x30D0,
+    (q15_t)0x1692, (q15_t)0xCF38, (q15_t)0x696E, (q15_t)0x30C8, (q15_t)0x1688, (q15_t)0xCF40, (q15_t)0x6978, (q15_t)0x30C0,
+    (q15_t)0x167F, (q15_t)0xCF48, (q15_t)0x6981, (q15_t)0x30B8, (q15_t)0x1675, (q15_t)0xCF51, (q15_t)0x698B, (q15_t)0x30AF,
+    (q15_t)0x166C, (q15_t)0xCF59, (q15_t)0x6994, (q15_t)0x30A7, (q15_t)0x1662, (q15_t)0xCF61, (q15_t)0x699E, (q15_t)0x309F,
+    (q15_t)0x1659, (q15_t)0xCF69, (q15_t)0x69A7, (q15_t)0x3097, (q15_t)0x164F, (q15_t)0xCF71, (q15_t)0x69B1, (q15_t)0x308F,
+    (q15_t)0x1645, (q15_t)0xCF79, (q15_t)0x69BB, (q15_t)0x3087, (q15_t)0x163C, (q15_t)0xCF82, (q15_t)0x69C4, (q15_t)0x307E,
+    (q15_t)0x1632, (q15_t)0xCF8A, (q15_t)0x69CE, (q15_t)0x3076, (q15_t)0x1629, (q15_t)0xCF92, (q15_t)0x69D7, (q15_t)0x306E,
+    (q15_t)0x161F, (q15_t)0xCF9A, (q15_t)0x69E1, (q15_t)0x3066, (q15_t)0x1616, (q15_t)0xCFA3, (q15_t)0x69EA, (q15_t)0x305D,
+    (q15_t)0x160C, (q15_t)0xCFAB, (q15_t)0x69F4, (q15_t)0x3055, (q15_t)0x1603, (q15_t)0xCFB3, (q15_t)0x69FD, (q15_t)0x304D,
+    (q15_t)0x15F9, (q15_t)0xCFBB, (q15_t)0x6A07, (q15_t)0x3045, (q15_t)0x15F0, (q15_t)0xCFC4, (q15_t)0x6A10, (q15_t)0x303C,
+    (q15_t)0x15E6, (q15_t)0xCFCC, (q15_t)0x6A1A, (q15_t)0x3034, (q15_t)0x15DD, (q15_t)0xCFD4, (q15_t)0x6A23, (q15_t)0x302C,
+    (q15_t)0x15D4, (q15_t)0xCFDC, (q15_t)0x6A2C, (q15_t)0x3024, (q15_t)0x15CA, (q15_t)0xCFE5, (q15_t)0x6A36, (q15_t)0x301B,
+    (q15_t)0x15C1, (q15_t)0xCFED, (q15_t)0x6A3F, (q15_t)0x3013, (q15_t)0x15B7, (q15_t)0xCFF5, (q15_t)0x6A49, (q15_t)0x300B,
+    (q15_t)0x15AE, (q15_t)0xCFFE, (q15_t)0x6A52, (q15_t)0x3002, (q15_t)0x15A4, (q15_t)0xD006, (q15_t)0x6A5C, (q15_t)0x2FFA,
+    (q15_t)0x159B, (q15_t)0xD00E, (q15_t)0x6A65, (q15_t)0x2FF2, (q15_t)0x1592, (q15_t)0xD016, (q15_t)0x6A6E, (q15_t)0x2FEA,
+    (q15_t)0x1588, (q15_t)0xD01F, (q15_t)0x6A78, (q15_t)0x2FE1, (q15_t)0x157F, (q15_t)0xD027, (q15_t)0x6A81, (q15_t)0x2FD9,
+    (q15_t)0x1575, (q15_t)0xD030, (q15_t)0x6A8B, (q15_t)0x2FD0, (q15_t)0x156C, (q15_t)0xD038, (q15_t)0x6A94, (q15_t)0x2FC8,
+    (q15_t)0x1563, (q15_t)0xD040, (q15_t)0x6A9D, (q15_t)0x2FC0, (q15_t)0x1559, (q15_t)0xD049, (q15_t)0x6AA7, (q15_t)0x2FB7,
+    (q15_t)0x1550, (q15_t)0xD051, (q15_t)0x6AB0, (q15_t)0x2FAF, (q15_t)0x1547, (q15_t)0xD059, (q15_t)0x6AB9, (q15_t)0x2FA7,
+    (q15_t)0x153D, (q15_t)0xD062, (q15_t)0x6AC3, (q15_t)0x2F9E, (q15_t)0x1534, (q15_t)0xD06A, (q15_t)0x6ACC, (q15_t)0x2F96,
+    (q15_t)0x152A, (q15_t)0xD073, (q15_t)0x6AD6, (q15_t)0x2F8D, (q15_t)0x1521, (q15_t)0xD07B, (q15_t)0x6ADF, (q15_t)0x2F85,
+    (q15_t)0x1518, (q15_t)0xD083, (q15_t)0x6AE8, (q15_t)0x2F7D, (q15_t)0x150E, (q15_t)0xD08C, (q15_t)0x6AF2, (q15_t)0x2F74,
+    (q15_t)0x1505, (q15_t)0xD094, (q15_t)0x6AFB, (q15_t)0x2F6C, (q15_t)0x14FC, (q15_t)0xD09D, (q15_t)0x6B04, (q15_t)0x2F63,
+    (q15_t)0x14F3, (q15_t)0xD0A5, (q15_t)0x6B0D, (q15_t)0x2F5B, (q15_t)0x14E9, (q15_t)0xD0AE, (q15_t)0x6B17, (q15_t)0x2F52,
+    (q15_t)0x14E0, (q15_t)0xD0B6, (q15_t)0x6B20, (q15_t)0x2F4A, (q15_t)0x14D7, (q15_t)0xD0BF, (q15_t)0x6B29, (q15_t)0x2F41,
+    (q15_t)0x14CD, (q15_t)0xD0C7, (q15_t)0x6B33, (q15_t)0x2F39, (q15_t)0x14C4, (q15_t)0xD0D0, (q15_t)0x6B3C, (q15_t)0x2F30,
+    (q15_t)0x14BB, (q15_t)0xD0D8, (q15_t)0x6B45, (q15_t)0x2F28, (q15_t)0x14B2, (q15_t)0xD0E0, (q15_t)0x6B4E, (q15_t)0x2F20,
+    (q15_t)0x14A8, (q15_t)0xD0E9, (q15_t)0x6B58, (q15_t)0x2F17, (q15_t)0x149F, (q15_t)0xD0F2, (q15_t)0x6B61, (q15_t)0x2F0E,
+    (q15_t)0x1496, (q15_t)0xD0FA, (q15_t)0x6B6A, (q15_t)0x2F06, (q15_t)0x148D, (q15_t)0xD103, (q15_t)0x6B73, (q15_t)0x2EFD,
+    (q15_t)0x1483, (q15_t)0xD10B, (q15_t)0x6B7D, (q15_t)0x2EF5, (q15_t)0x147A, (q15_t)0xD114, (q15_t)0x6B86, (q15_t)0x2EEC,
+    (q15_t)0x1471, (q15_t)0xD11C, (q15_t)0x6B8F, (q15_t)0x2EE4, (q15_t)0x1468, (q15_t)0xD125, (q15_t)0x6B98, (q15_t)0x2EDB,
+    (q15_t)0x145F, (q15_t)0xD12D, (q15_t)0x6BA1, (q15_t)0x2ED3, (q15_t)0x1455, (q15_t)0xD136, (q15_t)0x6BAB, (q15_t)0x2ECA,
+    (q15_t)0x144C, (q15_t)0xD13E, (q15_t)0x6BB4, (q15_t)0x2EC2, (q15_t)0x1443, (q15_t)0xD147, (q15_t)0x6BBD, (q15_t)0x2EB9,
+    (q15_t)0x143A, (q15_t)0xD150, (q15_t)0x6BC6, (q15_t)0x2EB0, (q15_t)0x1431, (q15_t)0xD158, (q15_t)0x6BCF, (q15_t)0x2EA8,
+    (q15_t)0x1428, (q15_t)0xD161, (q15_t)0x6BD8, (q15_t)0x2E9F, (q15_t)0x141E, (q15_t)0xD169, (q15_t)0x6BE2, (q15_t)0x2E97,
+    (q15_t)0x1415, (q15_t)0xD172, (q15_t)0x6BEB, (q15_t)0x2E8E, (q15_t)0x140C, (q15_t)0xD17B, (q15_t)0x6BF4, (q15_t)0x2E85,
+    (q15_t)0x1403, (q15_t)0xD183, (q15_t)0x6BFD, (q15_t)0x2E7D, (q15_t)0x13FA, (q15_t)0xD18C, (q15_t)0x6C06, (q15_t)0x2E74,
+    (q15_t)0x13F1, (q15_t)0xD195, (q15_t)0x6C0F, (q15_t)0x2E6B, (q15_t)0x13E8, (q15_t)0xD19D, (q15_t)0x6C18, (q15_t)0x2E63,
+    (q15_t)0x13DF, (q15_t)0xD1A6, (q15_t)0x6C21, (q15_t)0x2E5A, (q15_t)0x13D5, (q15_t)0xD1AF, (q15_t)0x6C2B, (q15_t)0x2E51,
+    (q15_t)0x13CC, (q15_t)0xD1B7, (q15_t)0x6C34, (q15_t)0x2E49, (q15_t)0x13C3, (q15_t)0xD1C0, (q15_t)0x6C3D, (q15_t)0x2E40,
+    (q15_t)0x13BA, (q15_t)0xD1C9, (q15_t)0x6C46, (q15_t)0x2E37, (q15_t)0x13B1, (q15_t)0xD1D1, (q15_t)0x6C4F, (q15_t)0x2E2F,
+    (q15_t)0x13A8, (q15_t)0xD1DA, (q15_t)0x6C58, (q15_t)0x2E26, (q15_t)0x139F, (q15_t)0xD1E3, (q15_t)0x6C61, (q15_t)0x2E1D,
+    (q15_t)0x1396, (q15_t)0xD1EB, (q15_t)0x6C6A, (q15_t)0x2E15, (q15_t)0x138D, (q15_t)0xD1F4, (q15_t)0x6C73, (q15_t)0x2E0C,
+    (q15_t)0x1384, (q15_t)0xD1FD, (q15_t)0x6C7C, (q15_t)0x2E03, (q15_t)0x137B, (q15_t)0xD206, (q15_t)0x6C85, (q15_t)0x2DFA,
+    (q15_t)0x1372, (q15_t)0xD20E, (q15_t)0x6C8E, (q15_t)0x2DF2, (q15_t)0x1369, (q15_t)0xD217, (q15_t)0x6C97, (q15_t)0x2DE9,
+    (q15_t)0x1360, (q15_t)0xD220, (q15_t)0x6CA0, (q15_t)0x2DE0, (q15_t)0x1357, (q15_t)0xD229, (q15_t)0x6CA9, (q15_t)0x2DD7,
+    (q15_t)0x134E, (q15_t)0xD231, (q15_t)0x6CB2, (q15_t)0x2DCF, (q15_t)0x1345, (q15_t)0xD23A, (q15_t)0x6CBB, (q15_t)0x2DC6,
+    (q15_t)0x133C, (q15_t)0xD243, (q15_t)0x6CC4, (q15_t)0x2DBD, (q15_t)0x1333, (q15_t)0xD24C, (q15_t)0x6CCD, (q15_t)0x2DB4,
+    (q15_t)0x132A, (q15_t)0xD255, (q15_t)0x6CD6, (q15_t)0x2DAB, (q15_t)0x1321, (q15_t)0xD25D, (q15_t)0x6CDF, (q15_t)0x2DA3,
+    (q15_t)0x1318, (q15_t)0xD266, (q15_t)0x6CE8, (q15_t)0x2D9A, (q15_t)0x130F, (q15_t)0xD26F, (q15_t)0x6CF1, (q15_t)0x2D91,
+    (q15_t)0x1306, (q15_t)0xD278, (q15_t)0x6CFA, (q15_t)0x2D88, (q15_t)0x12FD, (q15_t)0xD281, (q15_t)0x6D03, (q15_t)0x2D7F,
+    (q15_t)0x12F4, (q15_t)0xD28A, (q15_t)0x6D0C, (q15_t)0x2D76, (q15_t)0x12EB, (q15_t)0xD292, (q15_t)0x6D15, (q15_t)0x2D6E,
+    (q15_t)0x12E2, (q15_t)0xD29B, (q15_t)0x6D1E, (q15_t)0x2D65, (q15_t)0x12D9, (q15_t)0xD2A4, (q15_t)0x6D27, (q15_t)0x2D5C,
+    (q15_t)0x12D1, (q15_t)0xD2AD, (q15_t)0x6D2F, (q15_t)0x2D53, (q15_t)0x12C8, (q15_t)0xD2B6, (q15_t)0x6D38, (q15_t)0x2D4A,
+    (q15_t)0x12BF, (q15_t)0xD2BF, (q15_t)0x6D41, (q15_t)0x2D41, (q15_t)0x12B6, (q15_t)0xD2C8, (q15_t)0x6D4A, (q15_t)0x2D38,
+    (q15_t)0x12AD, (q15_t)0xD2D1, (q15_t)0x6D53, (q15_t)0x2D2F, (q15_t)0x12A4, (q15_t)0xD2D9, (q15_t)0x6D5C, (q15_t)0x2D27,
+    (q15_t)0x129B, (q15_t)0xD2E2, (q15_t)0x6D65, (q15_t)0x2D1E, (q15_t)0x1292, (q15_t)0xD2EB, (q15_t)0x6D6E, (q15_t)0x2D15,
+    (q15_t)0x128A, (q15_t)0xD2F4, (q15_t)0x6D76, (q15_t)0x2D0C, (q15_t)0x1281, (q15_t)0xD2FD, (q15_t)0x6D7F, (q15_t)0x2D03,
+    (q15_t)0x1278, (q15_t)0xD306, (q15_t)0x6D88, (q15_t)0x2CFA, (q15_t)0x126F, (q15_t)0xD30F, (q15_t)0x6D91, (q15_t)0x2CF1,
+    (q15_t)0x1266, (q15_t)0xD318, (q15_t)0x6D9A, (q15_t)0x2CE8, (q15_t)0x125D, (q15_t)0xD321, (q15_t)0x6DA3, (q15_t)0x2CDF,
+    (q15_t)0x1255, (q15_t)0xD32A, (q15_t)0x6DAB, (q15_t)0x2CD6, (q15_t)0x124C, (q15_t)0xD333, (q15_t)0x6DB4, (q15_t)0x2CCD,
+    (q15_t)0x1243, (q15_t)0xD33C, (q15_t)0x6DBD, (q15_t)0x2CC4, (q15_t)0x123A, (q15_t)0xD345, (q15_t)0x6DC6, (q15_t)0x2CBB,
+    (q15_t)0x1231, (q15_t)0xD34E, (q15_t)0x6DCF, (q15_t)0x2CB2, (q15_t)0x1229, (q15_t)0xD357, (q15_t)0x6DD7, (q15_t)0x2CA9,
+    (q15_t)0x1220, (q15_t)0xD360, (q15_t)0x6DE0, (q15_t)0x2CA0, (q15_t)0x1217, (q15_t)0xD369, (q15_t)0x6DE9, (q15_t)0x2C97,
+    (q15_t)0x120E, (q15_t)0xD372, (q15_t)0x6DF2, (q15_t)0x2C8E, (q15_t)0x1206, (q15_t)0xD37B, (q15_t)0x6DFA, (q15_t)0x2C85,
+    (q15_t)0x11FD, (q15_t)0xD384, (q15_t)0x6E03, (q15_t)0x2C7C, (q15_t)0x11F4, (q15_t)0xD38D, (q15_t)0x6E0C, (q15_t)0x2C73,
+    (q15_t)0x11EB, (q15_t)0xD396, (q15_t)0x6E15, (q15_t)0x2C6A, (q15_t)0x11E3, (q15_t)0xD39F, (q15_t)0x6E1D, (q15_t)0x2C61,
+    (q15_t)0x11DA, (q15_t)0xD3A8, (q15_t)0x6E26, (q15_t)0x2C58, (q15_t)0x11D1, (q15_t)0xD3B1, (q15_t)0x6E2F, (q15_t)0x2C4F,
+    (q15_t)0x11C9, (q15_t)0xD3BA, (q15_t)0x6E37, (q15_t)0x2C46, (q15_t)0x11C0, (q15_t)0xD3C3, (q15_t)0x6E40, (q15_t)0x2C3D,
+    (q15_t)0x11B7, (q15_t)0xD3CC, (q15_t)0x6E49, (q15_t)0x2C34, (q15_t)0x11AF, (q15_t)0xD3D5, (q15_t)0x6E51, (q15_t)0x2C2B,
+    (q15_t)0x11A6, (q15_t)0xD3DF, (q15_t)0x6E5A, (q15_t)0x2C21, (q15_t)0x119D, (q15_t)0xD3E8, (q15_t)0x6E63, (q15_t)0x2C18,
+    (q15_t)0x1195, (q15_t)0xD3F1, (q15_t)0x6E6B, (q15_t)0x2C0F, (q15_t)0x118C, (q15_t)0xD3FA, (q15_t)0x6E74, (q15_t)0x2C06,
+    (q15_t)0x1183, (q15_t)0xD403, (q15_t)0x6E7D, (q15_t)0x2BFD, (q15_t)0x117B, (q15_t)0xD40C, (q15_t)0x6E85, (q15_t)0x2BF4,
+    (q15_t)0x1172, (q15_t)0xD415, (q15_t)0x6E8E, (q15_t)0x2BEB, (q15_t)0x1169, (q15_t)0xD41E, (q15_t)0x6E97, (q15_t)0x2BE2,
+    (q15_t)0x1161, (q15_t)0xD428, (q15_t)0x6E9F, (q15_t)0x2BD8, (q15_t)0x1158, (q15_t)0xD431, (q15_t)0x6EA8, (q15_t)0x2BCF,
+    (q15_t)0x1150, (q15_t)0xD43A, (q15_t)0x6EB0, (q15_t)0x2BC6, (q15_t)0x1147, (q15_t)0xD443, (q15_t)0x6EB9, (q15_t)0x2BBD,
+    (q15_t)0x113E, (q15_t)0xD44C, (q15_t)0x6EC2, (q15_t)0x2BB4, (q15_t)0x1136, (q15_t)0xD455, (q15_t)0x6ECA, (q15_t)0x2BAB,
+    (q15_t)0x112D, (q15_t)0xD45F, (q15_t)0x6ED3, (q15_t)0x2BA1, (q15_t)0x1125, (q15_t)0xD468, (q15_t)0x6EDB, (q15_t)0x2B98,
+    (q15_t)0x111C, (q15_t)0xD471, (q15_t)0x6EE4, (q15_t)0x2B8F, (q15_t)0x1114, (q15_t)0xD47A, (q15_t)0x6EEC, (q15_t)0x2B86,
+    (q15_t)0x110B, (q15_t)0xD483, (q15_t)0x6EF5, (q15_t)0x2B7D, (q15_t)0x1103, (q15_t)0xD48D, (q15_t)0x6EFD, (q15_t)0x2B73,
+    (q15_t)0x10FA, (q15_t)0xD496, (q15_t)0x6F06, (q15_t)0x2B6A, (q15_t)0x10F2, (q15_t)0xD49F, (q15_t)0x6F0E, (q15_t)0x2B61,
+    (q15_t)0x10E9, (q15_t)0xD4A8, (q15_t)0x6F17, (q15_t)0x2B58, (q15_t)0x10E0, (q15_t)0xD4B2, (q15_t)0x6F20, (q15_t)0x2B4E,
+    (q15_t)0x10D8, (q15_t)0xD4BB, (q15_t)0x6F28, (q15_t)0x2B45, (q15_t)0x10D0, (q15_t)0xD4C4, (q15_t)0x6F30, (q15_t)0x2B3C,
+    (q15_t)0x10C7, (q15_t)0xD4CD, (q15_t)0x6F39, (q15_t)0x2B33, (q15_t)0x10BF, (q15_t)0xD4D7, (q15_t)0x6F41, (q15_t)0x2B29,
+    (q15_t)0x10B6, (q15_t)0xD4E0, (q15_t)0x6F4A, (q15_t)0x2B20, (q15_t)0x10AE, (q15_t)0xD4E9, (q15_t)0x6F52, (q15_t)0x2B17,
+    (q15_t)0x10A5, (q15_t)0xD4F3, (q15_t)0x6F5B, (q15_t)0x2B0D, (q15_t)0x109D, (q15_t)0xD4FC, (q15_t)0x6F63, (q15_t)0x2B04,
+    (q15_t)0x1094, (q15_t)0xD505, (q15_t)0x6F6C, (q15_t)0x2AFB, (q15_t)0x108C, (q15_t)0xD50E, (q15_t)0x6F74, (q15_t)0x2AF2,
+    (q15_t)0x1083, (q15_t)0xD518, (q15_t)0x6F7D, (q15_t)0x2AE8, (q15_t)0x107B, (q15_t)0xD521, (q15_t)0x6F85, (q15_t)0x2ADF,
+    (q15_t)0x1073, (q15_t)0xD52A, (q15_t)0x6F8D, (q15_t)0x2AD6, (q15_t)0x106A, (q15_t)0xD534, (q15_t)0x6F96, (q15_t)0x2ACC,
+    (q15_t)0x1062, (q15_t)0xD53D, (q15_t)0x6F9E, (q15_t)0x2AC3, (q15_t)0x1059, (q15_t)0xD547, (q15_t)0x6FA7, (q15_t)0x2AB9,
+    (q15_t)0x1051, (q15_t)0xD550, (q15_t)0x6FAF, (q15_t)0x2AB0, (q15_t)0x1049, (q15_t)0xD559, (q15_t)0x6FB7, (q15_t)0x2AA7,
+    (q15_t)0x1040, (q15_t)0xD563, (q15_t)0x6FC0, (q15_t)0x2A9D, (q15_t)0x1038, (q15_t)0xD56C, (q15_t)0x6FC8, (q15_t)0x2A94,
+    (q15_t)0x1030, (q15_t)0xD575, (q15_t)0x6FD0, (q15_t)0x2A8B, (q15_t)0x1027, (q15_t)0xD57F, (q15_t)0x6FD9, (q15_t)0x2A81,
+    (q15_t)0x101F, (q15_t)0xD588, (q15_t)0x6FE1, (q15_t)0x2A78, (q15_t)0x1016, (q15_t)0xD592, (q15_t)0x6FEA, (q15_t)0x2A6E,
+    (q15_t)0x100E, (q15_t)0xD59B, (q15_t)0x6FF2, (q15_t)0x2A65, (q15_t)0x1006, (q15_t)0xD5A4, (q15_t)0x6FFA, (q15_t)0x2A5C,
+    (q15_t)0x0FFE, (q15_t)0xD5AE, (q15_t)0x7002, (q15_t)0x2A52, (q15_t)0x0FF5, (q15_t)0xD5B7, (q15_t)0x700B, (q15_t)0x2A49,
+    (q15_t)0x0FED, (q15_t)0xD5C1, (q15_t)0x7013, (q15_t)0x2A3F, (q15_t)0x0FE5, (q15_t)0xD5CA, (q15_t)0x701B, (q15_t)0x2A36,
+    (q15_t)0x0FDC, (q15_t)0xD5D4, (q15_t)0x7024, (q15_t)0x2A2C, (q15_t)0x0FD4, (q15_t)0xD5DD, (q15_t)0x702C, (q15_t)0x2A23,
+    (q15_t)0x0FCC, (q15_t)0xD5E6, (q15_t)0x7034, (q15_t)0x2A1A, (q15_t)0x0FC4, (q15_t)0xD5F0, (q15_t)0x703C, (q15_t)0x2A10,
+    (q15_t)0x0FBB, (q15_t)0xD5F9, (q15_t)0x7045, (q15_t)0x2A07, (q15_t)0x0FB3, (q15_t)0xD603, (q15_t)0x704D, (q15_t)0x29FD,
+    (q15_t)0x0FAB, (q15_t)0xD60C, (q15_t)0x7055, (q15_t)0x29F4, (q15_t)0x0FA3, (q15_t)0xD616, (q15_t)0x705D, (q15_t)0x29EA,
+    (q15_t)0x0F9A, (q15_t)0xD61F, (q15_t)0x7066, (q15_t)0x29E1, (q15_t)0x0F92, (q15_t)0xD629, (q15_t)0x706E, (q15_t)0x29D7,
+    (q15_t)0x0F8A, (q15_t)0xD632, (q15_t)0x7076, (q15_t)0x29CE, (q15_t)0x0F82, (q15_t)0xD63C, (q15_t)0x707E, (q15_t)0x29C4,
+    (q15_t)0x0F79, (q15_t)0xD645, (q15_t)0x7087, (q15_t)0x29BB, (q15_t)0x0F71, (q15_t)0xD64F, (q15_t)0x708F, (q15_t)0x29B1,
+    (q15_t)0x0F69, (q15_t)0xD659, (q15_t)0x7097, (q15_t)0x29A7, (q15_t)0x0F61, (q15_t)0xD662, (q15_t)0x709F, (q15_t)0x299E,
+    (q15_t)0x0F59, (q15_t)0xD66C, (q15_t)0x70A7, (q15_t)0x2994, (q15_t)0x0F51, (q15_t)0xD675, (q15_t)0x70AF, (q15_t)0x298B,
+    (q15_t)0x0F48, (q15_t)0xD67F, (q15_t)0x70B8, (q15_t)0x2981, (q15_t)0x0F40, (q15_t)0xD688, (q15_t)0x70C0, (q15_t)0x2978,
+    (q15_t)0x0F38, (q15_t)0xD692, (q15_t)0x70C8, (q15_t)0x296E, (q15_t)0x0F30, (q15_t)0xD69B, (q15_t)0x70D0, (q15_t)0x2965,
+    (q15_t)0x0F28, (q15_t)0xD6A5, (q15_t)0x70D8, (q15_t)0x295B, (q15_t)0x0F20, (q15_t)0xD6AF, (q15_t)0x70E0, (q15_t)0x2951,
+    (q15_t)0x0F18, (q15_t)0xD6B8, (q15_t)0x70E8, (q15_t)0x2948, (q15_t)0x0F10, (q15_t)0xD6C2, (q15_t)0x70F0, (q15_t)0x293E,
+    (q15_t)0x0F07, (q15_t)0xD6CB, (q15_t)0x70F9, (q15_t)0x2935, (q15_t)0x0EFF, (q15_t)0xD6D5, (q15_t)0x7101, (q15_t)0x292B,
+    (q15_t)0x0EF7, (q15_t)0xD6DF, (q15_t)0x7109, (q15_t)0x2921, (q15_t)0x0EEF, (q15_t)0xD6E8, (q15_t)0x7111, (q15_t)0x2918,
+    (q15_t)0x0EE7, (q15_t)0xD6F2, (q15_t)0x7119, (q15_t)0x290E, (q15_t)0x0EDF, (q15_t)0xD6FC, (q15_t)0x7121, (q15_t)0x2904,
+    (q15_t)0x0ED7, (q15_t)0xD705, (q15_t)0x7129, (q15_t)0x28FB, (q15_t)0x0ECF, (q15_t)0xD70F, (q15_t)0x7131, (q15_t)0x28F1,
+    (q15_t)0x0EC7, (q15_t)0xD719, (q15_t)0x7139, (q15_t)0x28E7, (q15_t)0x0EBF, (q15_t)0xD722, (q15_t)0x7141, (q15_t)0x28DE,
+    (q15_t)0x0EB7, (q15_t)0xD72C, (q15_t)0x7149, (q15_t)0x28D4, (q15_t)0x0EAF, (q15_t)0xD736, (q15_t)0x7151, (q15_t)0x28CA,
+    (q15_t)0x0EA7, (q15_t)0xD73F, (q15_t)0x7159, (q15_t)0x28C1, (q15_t)0x0E9F, (q15_t)0xD749, (q15_t)0x7161, (q15_t)0x28B7,
+    (q15_t)0x0E97, (q15_t)0xD753, (q15_t)0x7169, (q15_t)0x28AD, (q15_t)0x0E8F, (q15_t)0xD75C, (q15_t)0x7171, (q15_t)0x28A4,
+    (q15_t)0x0E87, (q15_t)0xD766, (q15_t)0x7179, (q15_t)0x289A, (q15_t)0x0E7F, (q15_t)0xD770, (q15_t)0x7181, (q15_t)0x2890,
+    (q15_t)0x0E77, (q15_t)0xD77A, (q15_t)0x7189, (q15_t)0x2886, (q15_t)0x0E6F, (q15_t)0xD783, (q15_t)0x7191, (q15_t)0x287D,
+    (q15_t)0x0E67, (q15_t)0xD78D, (q15_t)0x7199, (q15_t)0x2873, (q15_t)0x0E5F, (q15_t)0xD797, (q15_t)0x71A1, (q15_t)0x2869,
+    (q15_t)0x0E57, (q15_t)0xD7A0, (q15_t)0x71A9, (q15_t)0x2860, (q15_t)0x0E4F, (q15_t)0xD7AA, (q15_t)0x71B1, (q15_t)0x2856,
+    (q15_t)0x0E47, (q15_t)0xD7B4, (q15_t)0x71B9, (q15_t)0x284C, (q15_t)0x0E40, (q15_t)0xD7BE, (q15_t)0x71C0, (q15_t)0x2842,
+    (q15_t)0x0E38, (q15_t)0xD7C8, (q15_t)0x71C8, (q15_t)0x2838, (q15_t)0x0E30, (q15_t)0xD7D1, (q15_t)0x71D0, (q15_t)0x282F,
+    (q15_t)0x0E28, (q15_t)0xD7DB, (q15_t)0x71D8, (q15_t)0x2825, (q15_t)0x0E20, (q15_t)0xD7E5, (q15_t)0x71E0, (q15_t)0x281B,
+    (q15_t)0x0E18, (q15_t)0xD7EF, (q15_t)0x71E8, (q15_t)0x2811, (q15_t)0x0E10, (q15_t)0xD7F8, (q15_t)0x71F0, (q15_t)0x2808,
+    (q15_t)0x0E08, (q15_t)0xD802, (q15_t)0x71F8, (q15_t)0x27FE, (q15_t)0x0E01, (q15_t)0xD80C, (q15_t)0x71FF, (q15_t)0x27F4,
+    (q15_t)0x0DF9, (q15_t)0xD816, (q15_t)0x7207, (q15_t)0x27EA, (q15_t)0x0DF1, (q15_t)0xD820, (q15_t)0x720F, (q15_t)0x27E0,
+    (q15_t)0x0DE9, (q15_t)0xD82A, (q15_t)0x7217, (q15_t)0x27D6, (q15_t)0x0DE1, (q15_t)0xD833, (q15_t)0x721F, (q15_t)0x27CD,
+    (q15_t)0x0DD9, (q15_t)0xD83D, (q15_t)0x7227, (q15_t)0x27C3, (q15_t)0x0DD2, (q15_t)0xD847, (q15_t)0x722E, (q15_t)0x27B9,
+    (q15_t)0x0DCA, (q15_t)0xD851, (q15_t)0x7236, (q15_t)0x27AF, (q15_t)0x0DC2, (q15_t)0xD85B, (q15_t)0x723E, (q15_t)0x27A5,
+    (q15_t)0x0DBA, (q15_t)0xD865, (q15_t)0x7246, (q15_t)0x279B, (q15_t)0x0DB2, (q15_t)0xD86F, (q15_t)0x724E, (q15_t)0x2791,
+    (q15_t)0x0DAB, (q15_t)0xD878, (q15_t)0x7255, (q15_t)0x2788, (q15_t)0x0DA3, (q15_t)0xD882, (q15_t)0x725D, (q15_t)0x277E,
+    (q15_t)0x0D9B, (q15_t)0xD88C, (q15_t)0x7265, (q15_t)0x2774, (q15_t)0x0D93, (q15_t)0xD896, (q15_t)0x726D, (q15_t)0x276A,
+    (q15_t)0x0D8C, (q15_t)0xD8A0, (q15_t)0x7274, (q15_t)0x2760, (q15_t)0x0D84, (q15_t)0xD8AA, (q15_t)0x727C, (q15_t)0x2756,
+    (q15_t)0x0D7C, (q15_t)0xD8B4, (q15_t)0x7284, (q15_t)0x274C, (q15_t)0x0D75, (q15_t)0xD8BE, (q15_t)0x728B, (q15_t)0x2742,
+    (q15_t)0x0D6D, (q15_t)0xD8C8, (q15_t)0x7293, (q15_t)0x2738, (q15_t)0x0D65, (q15_t)0xD8D2, (q15_t)0x729B, (q15_t)0x272E,
+    (q15_t)0x0D5D, (q15_t)0xD8DC, (q15_t)0x72A3, (q15_t)0x2724, (q15_t)0x0D56, (q15_t)0xD8E6, (q15_t)0x72AA, (q15_t)0x271A,
+    (q15_t)0x0D4E, (q15_t)0xD8EF, (q15_t)0x72B2, (q15_t)0x2711, (q15_t)0x0D46, (q15_t)0xD8F9, (q15_t)0x72BA, (q15_t)0x2707,
+    (q15_t)0x0D3F, (q15_t)0xD903, (q15_t)0x72C1, (q15_t)0x26FD, (q15_t)0x0D37, (q15_t)0xD90D, (q15_t)0x72C9, (q15_t)0x26F3,
+    (q15_t)0x0D30, (q15_t)0xD917, (q15_t)0x72D0, (q15_t)0x26E9, (q15_t)0x0D28, (q15_t)0xD921, (q15_t)0x72D8, (q15_t)0x26DF,
+    (q15_t)0x0D20, (q15_t)0xD92B, (q15_t)0x72E0, (q15_t)0x26D5, (q15_t)0x0D19, (q15_t)0xD935, (q15_t)0x72E7, (q15_t)0x26CB,
+    (q15_t)0x0D11, (q15_t)0xD93F, (q15_t)0x72EF, (q15_t)0x26C1, (q15_t)0x0D09, (q15_t)0xD949, (q15_t)0x72F7, (q15_t)0x26B7,
+    (q15_t)0x0D02, (q15_t)0xD953, (q15_t)0x72FE, (q15_t)0x26AD, (q15_t)0x0CFA, (q15_t)0xD95D, (q15_t)0x7306, (q15_t)0x26A3,
+    (q15_t)0x0CF3, (q15_t)0xD967, (q15_t)0x730D, (q15_t)0x2699, (q15_t)0x0CEB, (q15_t)0xD971, (q15_t)0x7315, (q15_t)0x268F,
+    (q15_t)0x0CE3, (q15_t)0xD97B, (q15_t)0x731D, (q15_t)0x2685, (q15_t)0x0CDC, (q15_t)0xD985, (q15_t)0x7324, (q15_t)0x267B,
+    (q15_t)0x0CD4, (q15_t)0xD98F, (q15_t)0x732C, (q15_t)0x2671, (q15_t)0x0CCD, (q15_t)0xD99A, (q15_t)0x7333, (q15_t)0x2666,
+    (q15_t)0x0CC5, (q15_t)0xD9A4, (q15_t)0x733B, (q15_t)0x265C, (q15_t)0x0CBE, (q15_t)0xD9AE, (q15_t)0x7342, (q15_t)0x2652,
+    (q15_t)0x0CB6, (q15_t)0xD9B8, (q15_t)0x734A, (q15_t)0x2648, (q15_t)0x0CAF, (q15_t)0xD9C2, (q15_t)0x7351, (q15_t)0x263E,
+    (q15_t)0x0CA7, (q15_t)0xD9CC, (q15_t)0x7359, (q15_t)0x2634, (q15_t)0x0CA0, (q15_t)0xD9D6, (q15_t)0x7360, (q15_t)0x262A,
+    (q15_t)0x0C98, (q15_t)0xD9E0, (q15_t)0x7368, (q15_t)0x2620, (q15_t)0x0C91, (q15_t)0xD9EA, (q15_t)0x736F, (q15_t)0x2616,
+    (q15_t)0x0C89, (q15_t)0xD9F4, (q15_t)0x7377, (q15_t)0x260C, (q15_t)0x0C82, (q15_t)0xD9FE, (q15_t)0x737E, (q15_t)0x2602,
+    (q15_t)0x0C7A, (q15_t)0xDA08, (q15_t)0x7386, (q15_t)0x25F8, (q15_t)0x0C73, (q15_t)0xDA13, (q15_t)0x738D, (q15_t)0x25ED,
+    (q15_t)0x0C6B, (q15_t)0xDA1D, (q15_t)0x7395, (q15_t)0x25E3, (q15_t)0x0C64, (q15_t)0xDA27, (q15_t)0x739C, (q15_t)0x25D9,
+    (q15_t)0x0C5D, (q15_t)0xDA31, (q15_t)0x73A3, (q15_t)0x25CF, (q15_t)0x0C55, (q15_t)0xDA3B, (q15_t)0x73AB, (q15_t)0x25C5,
+    (q15_t)0x0C4E, (q15_t)0xDA45, (q15_t)0x73B2, (q15_t)0x25BB, (q15_t)0x0C46, (q15_t)0xDA4F, (q15_t)0x73BA, (q15_t)0x25B1,
+    (q15_t)0x0C3F, (q15_t)0xDA5A, (q15_t)0x73C1, (q15_t)0x25A6, (q15_t)0x0C38, (q15_t)0xDA64, (q15_t)0x73C8, (q15_t)0x259C,
+    (q15_t)0x0C30, (q15_t)0xDA6E, (q15_t)0x73D0, (q15_t)0x2592, (q15_t)0x0C29, (q15_t)0xDA78, (q15_t)0x73D7, (q15_t)0x2588,
+    (q15_t)0x0C21, (q15_t)0xDA82, (q15_t)0x73DF, (q15_t)0x257E, (q15_t)0x0C1A, (q15_t)0xDA8C, (q15_t)0x73E6, (q15_t)0x2574,
+    (q15_t)0x0C13, (q15_t)0xDA97, (q15_t)0x73ED, (q15_t)0x2569, (q15_t)0x0C0B, (q15_t)0xDAA1, (q15_t)0x73F5, (q15_t)0x255F,
+    (q15_t)0x0C04, (q15_t)0xDAAB, (q15_t)0x73FC, (q15_t)0x2555, (q15_t)0x0BFD, (q15_t)0xDAB5, (q15_t)0x7403, (q15_t)0x254B,
+    (q15_t)0x0BF5, (q15_t)0xDABF, (q15_t)0x740B, (q15_t)0x2541, (q15_t)0x0BEE, (q15_t)0xDACA, (q15_t)0x7412, (q15_t)0x2536,
+    (q15_t)0x0BE7, (q15_t)0xDAD4, (q15_t)0x7419, (q15_t)0x252C, (q15_t)0x0BE0, (q15_t)0xDADE, (q15_t)0x7420, (q15_t)0x2522,
+    (q15_t)0x0BD8, (q15_t)0xDAE8, (q15_t)0x7428, (q15_t)0x2518, (q15_t)0x0BD1, (q15_t)0xDAF3, (q15_t)0x742F, (q15_t)0x250D,
+    (q15_t)0x0BCA, (q15_t)0xDAFD, (q15_t)0x7436, (q15_t)0x2503, (q15_t)0x0BC2, (q15_t)0xDB07, (q15_t)0x743E, (q15_t)0x24F9,
+    (q15_t)0x0BBB, (q15_t)0xDB11, (q15_t)0x7445, (q15_t)0x24EF, (q15_t)0x0BB4, (q15_t)0xDB1C, (q15_t)0x744C, (q15_t)0x24E4,
+    (q15_t)0x0BAD, (q15_t)0xDB26, (q15_t)0x7453, (q15_t)0x24DA, (q15_t)0x0BA5, (q15_t)0xDB30, (q15_t)0x745B, (q15_t)0x24D0,
+    (q15_t)0x0B9E, (q15_t)0xDB3B, (q15_t)0x7462, (q15_t)0x24C5, (q15_t)0x0B97, (q15_t)0xDB45, (q15_t)0x7469, (q15_t)0x24BB,
+    (q15_t)0x0B90, (q15_t)0xDB4F, (q15_t)0x7470, (q15_t)0x24B1, (q15_t)0x0B89, (q15_t)0xDB59, (q15_t)0x7477, (q15_t)0x24A7,
+    (q15_t)0x0B81, (q15_t)0xDB64, (q15_t)0x747F, (q15_t)0x249C, (q15_t)0x0B7A, (q15_t)0xDB6E, (q15_t)0x7486, (q15_t)0x2492,
+    (q15_t)0x0B73, (q15_t)0xDB78, (q15_t)0x748D, (q15_t)0x2488, (q15_t)0x0B6C, (q15_t)0xDB83, (q15_t)0x7494, (q15_t)0x247D,
+    (q15_t)0x0B65, (q15_t)0xDB8D, (q15_t)0x749B, (q15_t)0x2473, (q15_t)0x0B5E, (q15_t)0xDB97, (q15_t)0x74A2, (q15_t)0x2469,
+    (q15_t)0x0B56, (q15_t)0xDBA2, (q15_t)0x74AA, (q15_t)0x245E, (q15_t)0x0B4F, (q15_t)0xDBAC, (q15_t)0x74B1, (q15_t)0x2454,
+    (q15_t)0x0B48, (q15_t)0xDBB6, (q15_t)0x74B8, (q15_t)0x244A, (q15_t)0x0B41, (q15_t)0xDBC1, (q15_t)0x74BF, (q15_t)0x243F,
+    (q15_t)0x0B3A, (q15_t)0xDBCB, (q15_t)0x74C6, (q15_t)0x2435, (q15_t)0x0B33, (q15_t)0xDBD5, (q15_t)0x74CD, (q15_t)0x242B,
+    (q15_t)0x0B2C, (q15_t)0xDBE0, (q15_t)0x74D4, (q15_t)0x2420, (q15_t)0x0B25, (q15_t)0xDBEA, (q15_t)0x74DB, (q15_t)0x2416,
+    (q15_t)0x0B1E, (q15_t)0xDBF5, (q15_t)0x74E2, (q15_t)0x240B, (q15_t)0x0B16, (q15_t)0xDBFF, (q15_t)0x74EA, (q15_t)0x2401,
+    (q15_t)0x0B0F, (q15_t)0xDC09, (q15_t)0x74F1, (q15_t)0x23F7, (q15_t)0x0B08, (q15_t)0xDC14, (q15_t)0x74F8, (q15_t)0x23EC,
+    (q15_t)0x0B01, (q15_t)0xDC1E, (q15_t)0x74FF, (q15_t)0x23E2, (q15_t)0x0AFA, (q15_t)0xDC29, (q15_t)0x7506, (q15_t)0x23D7,
+    (q15_t)0x0AF3, (q15_t)0xDC33, (q15_t)0x750D, (q15_t)0x23CD, (q15_t)0x0AEC, (q15_t)0xDC3D, (q15_t)0x7514, (q15_t)0x23C3,
+    (q15_t)0x0AE5, (q15_t)0xDC48, (q15_t)0x751B, (q15_t)0x23B8, (q15_t)0x0ADE, (q15_t)0xDC52, (q15_t)0x7522, (q15_t)0x23AE,
+    (q15_t)0x0AD7, (q15_t)0xDC5D, (q15_t)0x7529, (q15_t)0x23A3, (q15_t)0x0AD0, (q15_t)0xDC67, (q15_t)0x7530, (q15_t)0x2399,
+    (q15_t)0x0AC9, (q15_t)0xDC72, (q15_t)0x7537, (q15_t)0x238E, (q15_t)0x0AC2, (q15_t)0xDC7C, (q15_t)0x753E, (q15_t)0x2384,
+    (q15_t)0x0ABB, (q15_t)0xDC86, (q15_t)0x7545, (q15_t)0x237A, (q15_t)0x0AB4, (q15_t)0xDC91, (q15_t)0x754C, (q15_t)0x236F,
+    (q15_t)0x0AAD, (q15_t)0xDC9B, (q15_t)0x7553, (q15_t)0x2365, (q15_t)0x0AA6, (q15_t)0xDCA6, (q15_t)0x755A, (q15_t)0x235A,
+    (q15_t)0x0A9F, (q15_t)0xDCB0, (q15_t)0x7561, (q15_t)0x2350, (q15_t)0x0A99, (q15_t)0xDCBB, (q15_t)0x7567, (q15_t)0x2345,
+    (q15_t)0x0A92, (q15_t)0xDCC5, (q15_t)0x756E, (q15_t)0x233B, (q15_t)0x0A8B, (q15_t)0xDCD0, (q15_t)0x7575, (q15_t)0x2330,
+    (q15_t)0x0A84, (q15_t)0xDCDA, (q15_t)0x757C, (q15_t)0x2326, (q15_t)0x0A7D, (q15_t)0xDCE5, (q15_t)0x7583, (q15_t)0x231B,
+    (q15_t)0x0A76, (q15_t)0xDCEF, (q15_t)0x758A, (q15_t)0x2311, (q15_t)0x0A6F, (q15_t)0xDCFA, (q15_t)0x7591, (q15_t)0x2306,
+    (q15_t)0x0A68, (q15_t)0xDD04, (q15_t)0x7598, (q15_t)0x22FC, (q15_t)0x0A61, (q15_t)0xDD0F, (q15_t)0x759F, (q15_t)0x22F1,
+    (q15_t)0x0A5B, (q15_t)0xDD19, (q15_t)0x75A5, (q15_t)0x22E7, (q15_t)0x0A54, (q15_t)0xDD24, (q15_t)0x75AC, (q15_t)0x22DC,
+    (q15_t)0x0A4D, (q15_t)0xDD2E, (q15_t)0x75B3, (q15_t)0x22D2, (q15_t)0x0A46, (q15_t)0xDD39, (q15_t)0x75BA, (q15_t)0x22C7,
+    (q15_t)0x0A3F, (q15_t)0xDD44, (q15_t)0x75C1, (q15_t)0x22BC, (q15_t)0x0A38, (q15_t)0xDD4E, (q15_t)0x75C8, (q15_t)0x22B2,
+    (q15_t)0x0A32, (q15_t)0xDD59, (q15_t)0x75CE, (q15_t)0x22A7, (q15_t)0x0A2B, (q15_t)0xDD63, (q15_t)0x75D5, (q15_t)0x229D,
+    (q15_t)0x0A24, (q15_t)0xDD6E, (q15_t)0x75DC, (q15_t)0x2292, (q15_t)0x0A1D, (q15_t)0xDD78, (q15_t)0x75E3, (q15_t)0x2288,
+    (q15_t)0x0A16, (q15_t)0xDD83, (q15_t)0x75EA, (q15_t)0x227D, (q15_t)0x0A10, (q15_t)0xDD8E, (q15_t)0x75F0, (q15_t)0x2272,
+    (q15_t)0x0A09, (q15_t)0xDD98, (q15_t)0x75F7, (q15_t)0x2268, (q15_t)0x0A02, (q15_t)0xDDA3, (q15_t)0x75FE, (q15_t)0x225D,
+    (q15_t)0x09FB, (q15_t)0xDDAD, (q15_t)0x7605, (q15_t)0x2253, (q15_t)0x09F5, (q15_t)0xDDB8, (q15_t)0x760B, (q15_t)0x2248,
+    (q15_t)0x09EE, (q15_t)0xDDC3, (q15_t)0x7612, (q15_t)0x223D, (q15_t)0x09E7, (q15_t)0xDDCD, (q15_t)0x7619, (q15_t)0x2233,
+    (q15_t)0x09E0, (q15_t)0xDDD8, (q15_t)0x7620, (q15_t)0x2228, (q15_t)0x09DA, (q15_t)0xDDE2, (q15_t)0x7626, (q15_t)0x221E,
+    (q15_t)0x09D3, (q15_t)0xDDED, (q15_t)0x762D, (q15_t)0x2213, (q15_t)0x09CC, (q15_t)0xDDF8, (q15_t)0x7634, (q15_t)0x2208,
+    (q15_t)0x09C6, (q15_t)0xDE02, (q15_t)0x763A, (q15_t)0x21FE, (q15_t)0x09BF, (q15_t)0xDE0D, (q15_t)0x7641, (q15_t)0x21F3,
+    (q15_t)0x09B8, (q15_t)0xDE18, (q15_t)0x7648, (q15_t)0x21E8, (q15_t)0x09B2, (q15_t)0xDE22, (q15_t)0x764E, (q15_t)0x21DE,
+    (q15_t)0x09AB, (q15_t)0xDE2D, (q15_t)0x7655, (q15_t)0x21D3, (q15_t)0x09A4, (q15_t)0xDE38, (q15_t)0x765C, (q15_t)0x21C8,
+    (q15_t)0x099E, (q15_t)0xDE42, (q15_t)0x7662, (q15_t)0x21BE, (q15_t)0x0997, (q15_t)0xDE4D, (q15_t)0x7669, (q15_t)0x21B3,
+    (q15_t)0x0991, (q15_t)0xDE58, (q15_t)0x766F, (q15_t)0x21A8, (q15_t)0x098A, (q15_t)0xDE62, (q15_t)0x7676, (q15_t)0x219E,
+    (q15_t)0x0983, (q15_t)0xDE6D, (q15_t)0x767D, (q15_t)0x2193, (q15_t)0x097D, (q15_t)0xDE78, (q15_t)0x7683, (q15_t)0x2188,
+    (q15_t)0x0976, (q15_t)0xDE83, (q15_t)0x768A, (q15_t)0x217D, (q15_t)0x0970, (q15_t)0xDE8D, (q15_t)0x7690, (q15_t)0x2173,
+    (q15_t)0x0969, (q15_t)0xDE98, (q15_t)0x7697, (q15_t)0x2168, (q15_t)0x0963, (q15_t)0xDEA3, (q15_t)0x769D, (q15_t)0x215D,
+    (q15_t)0x095C, (q15_t)0xDEAD, (q15_t)0x76A4, (q15_t)0x2153, (q15_t)0x0955, (q15_t)0xDEB8, (q15_t)0x76AB, (q15_t)0x2148,
+    (q15_t)0x094F, (q15_t)0xDEC3, (q15_t)0x76B1, (q15_t)0x213D, (q15_t)0x0948, (q15_t)0xDECE, (q15_t)0x76B8, (q15_t)0x2132,
+    (q15_t)0x0942, (q15_t)0xDED8, (q15_t)0x76BE, (q15_t)0x2128, (q15_t)0x093B, (q15_t)0xDEE3, (q15_t)0x76C5, (q15_t)0x211D,
+    (q15_t)0x0935, (q15_t)0xDEEE, (q15_t)0x76CB, (q15_t)0x2112, (q15_t)0x092E, (q15_t)0xDEF9, (q15_t)0x76D2, (q15_t)0x2107,
+    (q15_t)0x0928, (q15_t)0xDF03, (q15_t)0x76D8, (q15_t)0x20FD, (q15_t)0x0921, (q15_t)0xDF0E, (q15_t)0x76DF, (q15_t)0x20F2,
+    (q15_t)0x091B, (q15_t)0xDF19, (q15_t)0x76E5, (q15_t)0x20E7, (q15_t)0x0915, (q15_t)0xDF24, (q15_t)0x76EB, (q15_t)0x20DC,
+    (q15_t)0x090E, (q15_t)0xDF2F, (q15_t)0x76F2, (q15_t)0x20D1, (q15_t)0x0908, (q15_t)0xDF39, (q15_t)0x76F8, (q15_t)0x20C7,
+    (q15_t)0x0901, (q15_t)0xDF44, (q15_t)0x76FF, (q15_t)0x20BC, (q15_t)0x08FB, (q15_t)0xDF4F, (q15_t)0x7705, (q15_t)0x20B1,
+    (q15_t)0x08F4, (q15_t)0xDF5A, (q15_t)0x770C, (q15_t)0x20A6, (q15_t)0x08EE, (q15_t)0xDF65, (q15_t)0x7712, (q15_t)0x209B,
+    (q15_t)0x08E8, (q15_t)0xDF6F, (q15_t)0x7718, (q15_t)0x2091, (q15_t)0x08E1, (q15_t)0xDF7A, (q15_t)0x771F, (q15_t)0x2086,
+    (q15_t)0x08DB, (q15_t)0xDF85, (q15_t)0x7725, (q15_t)0x207B, (q15_t)0x08D4, (q15_t)0xDF90, (q15_t)0x772C, (q15_t)0x2070,
+    (q15_t)0x08CE, (q15_t)0xDF9B, (q15_t)0x7732, (q15_t)0x2065, (q15_t)0x08C8, (q15_t)0xDFA5, (q15_t)0x7738, (q15_t)0x205B,
+    (q15_t)0x08C1, (q15_t)0xDFB0, (q15_t)0x773F, (q15_t)0x2050, (q15_t)0x08BB, (q15_t)0xDFBB, (q15_t)0x7745, (q15_t)0x2045,
+    (q15_t)0x08B5, (q15_t)0xDFC6, (q15_t)0x774B, (q15_t)0x203A, (q15_t)0x08AE, (q15_t)0xDFD1, (q15_t)0x7752, (q15_t)0x202F,
+    (q15_t)0x08A8, (q15_t)0xDFDC, (q15_t)0x7758, (q15_t)0x2024, (q15_t)0x08A2, (q15_t)0xDFE7, (q15_t)0x775E, (q15_t)0x2019,
+    (q15_t)0x089B, (q15_t)0xDFF1, (q15_t)0x7765, (q15_t)0x200F, (q15_t)0x0895, (q15_t)0xDFFC, (q15_t)0x776B, (q15_t)0x2004,
+    (q15_t)0x088F, (q15_t)0xE007, (q15_t)0x7771, (q15_t)0x1FF9, (q15_t)0x0889, (q15_t)0xE012, (q15_t)0x7777, (q15_t)0x1FEE,
+    (q15_t)0x0882, (q15_t)0xE01D, (q15_t)0x777E, (q15_t)0x1FE3, (q15_t)0x087C, (q15_t)0xE028, (q15_t)0x7784, (q15_t)0x1FD8,
+    (q15_t)0x0876, (q15_t)0xE033, (q15_t)0x778A, (q15_t)0x1FCD, (q15_t)0x0870, (q15_t)0xE03E, (q15_t)0x7790, (q15_t)0x1FC2,
+    (q15_t)0x0869, (q15_t)0xE049, (q15_t)0x7797, (q15_t)0x1FB7, (q15_t)0x0863, (q15_t)0xE054, (q15_t)0x779D, (q15_t)0x1FAC,
+    (q15_t)0x085D, (q15_t)0xE05E, (q15_t)0x77A3, (q15_t)0x1FA2, (q15_t)0x0857, (q15_t)0xE069, (q15_t)0x77A9, (q15_t)0x1F97,
+    (q15_t)0x0850, (q15_t)0xE074, (q15_t)0x77B0, (q15_t)0x1F8C, (q15_t)0x084A, (q15_t)0xE07F, (q15_t)0x77B6, (q15_t)0x1F81,
+    (q15_t)0x0844, (q15_t)0xE08A, (q15_t)0x77BC, (q15_t)0x1F76, (q15_t)0x083E, (q15_t)0xE095, (q15_t)0x77C2, (q15_t)0x1F6B,
+    (q15_t)0x0838, (q15_t)0xE0A0, (q15_t)0x77C8, (q15_t)0x1F60, (q15_t)0x0832, (q15_t)0xE0AB, (q15_t)0x77CE, (q15_t)0x1F55,
+    (q15_t)0x082B, (q15_t)0xE0B6, (q15_t)0x77D5, (q15_t)0x1F4A, (q15_t)0x0825, (q15_t)0xE0C1, (q15_t)0x77DB, (q15_t)0x1F3F,
+    (q15_t)0x081F, (q15_t)0xE0CC, (q15_t)0x77E1, (q15_t)0x1F34, (q15_t)0x0819, (q15_t)0xE0D7, (q15_t)0x77E7, (q15_t)0x1F29,
+    (q15_t)0x0813, (q15_t)0xE0E2, (q15_t)0x77ED, (q15_t)0x1F1E, (q15_t)0x080D, (q15_t)0xE0ED, (q15_t)0x77F3, (q15_t)0x1F13,
+    (q15_t)0x0807, (q15_t)0xE0F8, (q15_t)0x77F9, (q15_t)0x1F08, (q15_t)0x0801, (q15_t)0xE103, (q15_t)0x77FF, (q15_t)0x1EFD,
+    (q15_t)0x07FB, (q15_t)0xE10E, (q15_t)0x7805, (q15_t)0x1EF2, (q15_t)0x07F5, (q15_t)0xE119, (q15_t)0x780B, (q15_t)0x1EE7,
+    (q15_t)0x07EE, (q15_t)0xE124, (q15_t)0x7812, (q15_t)0x1EDC, (q15_t)0x07E8, (q15_t)0xE12F, (q15_t)0x7818, (q15_t)0x1ED1,
+    (q15_t)0x07E2, (q15_t)0xE13A, (q15_t)0x781E, (q15_t)0x1EC6, (q15_t)0x07DC, (q15_t)0xE145, (q15_t)0x7824, (q15_t)0x1EBB,
+    (q15_t)0x07D6, (q15_t)0xE150, (q15_t)0x782A, (q15_t)0x1EB0, (q15_t)0x07D0, (q15_t)0xE15B, (q15_t)0x7830, (q15_t)0x1EA5,
+    (q15_t)0x07CA, (q15_t)0xE166, (q15_t)0x7836, (q15_t)0x1E9A, (q15_t)0x07C4, (q15_t)0xE171, (q15_t)0x783C, (q15_t)0x1E8F,
+    (q15_t)0x07BE, (q15_t)0xE17C, (q15_t)0x7842, (q15_t)0x1E84, (q15_t)0x07B8, (q15_t)0xE187, (q15_t)0x7848, (q15_t)0x1E79,
+    (q15_t)0x07B2, (q15_t)0xE192, (q15_t)0x784E, (q15_t)0x1E6E, (q15_t)0x07AC, (q15_t)0xE19D, (q15_t)0x7854, (q15_t)0x1E63,
+    (q15_t)0x07A6, (q15_t)0xE1A8, (q15_t)0x785A, (q15_t)0x1E58, (q15_t)0x07A0, (q15_t)0xE1B3, (q15_t)0x7860, (q15_t)0x1E4D,
+    (q15_t)0x079A, (q15_t)0xE1BE, (q15_t)0x7866, (q15_t)0x1E42, (q15_t)0x0795, (q15_t)0xE1CA, (q15_t)0x786B, (q15_t)0x1E36,
+    (q15_t)0x078F, (q15_t)0xE1D5, (q15_t)0x7871, (q15_t)0x1E2B, (q15_t)0x0789, (q15_t)0xE1E0, (q15_t)0x7877, (q15_t)0x1E20,
+    (q15_t)0x0783, (q15_t)0xE1EB, (q15_t)0x787D, (q15_t)0x1E15, (q15_t)0x077D, (q15_t)0xE1F6, (q15_t)0x7883, (q15_t)0x1E0A,
+    (q15_t)0x0777, (q15_t)0xE201, (q15_t)0x7889, (q15_t)0x1DFF, (q15_t)0x0771, (q15_t)0xE20C, (q15_t)0x788F, (q15_t)0x1DF4,
+    (q15_t)0x076B, (q15_t)0xE217, (q15_t)0x7895, (q15_t)0x1DE9, (q15_t)0x0765, (q15_t)0xE222, (q15_t)0x789B, (q15_t)0x1DDE,
+    (q15_t)0x075F, (q15_t)0xE22D, (q15_t)0x78A1, (q15_t)0x1DD3, (q15_t)0x075A, (q15_t)0xE239, (q15_t)0x78A6, (q15_t)0x1DC7,
+    (q15_t)0x0754, (q15_t)0xE244, (q15_t)0x78AC, (q15_t)0x1DBC, (q15_t)0x074E, (q15_t)0xE24F, (q15_t)0x78B2, (q15_t)0x1DB1,
+    (q15_t)0x0748, (q15_t)0xE25A, (q15_t)0x78B8, (q15_t)0x1DA6, (q15_t)0x0742, (q15_t)0xE265, (q15_t)0x78BE, (q15_t)0x1D9B,
+    (q15_t)0x073D, (q15_t)0xE270, (q15_t)0x78C3, (q15_t)0x1D90, (q15_t)0x0737, (q15_t)0xE27B, (q15_t)0x78C9, (q15_t)0x1D85,
+    (q15_t)0x0731, (q15_t)0xE287, (q15_t)0x78CF, (q15_t)0x1D79, (q15_t)0x072B, (q15_t)0xE292, (q15_t)0x78D5, (q15_t)0x1D6E,
+    (q15_t)0x0725, (q15_t)0xE29D, (q15_t)0x78DB, (q15_t)0x1D63, (q15_t)0x0720, (q15_t)0xE2A8, (q15_t)0x78E0, (q15_t)0x1D58,
+    (q15_t)0x071A, (q15_t)0xE2B3, (q15_t)0x78E6, (q15_t)0x1D4D, (q15_t)0x0714, (q15_t)0xE2BE, (q15_t)0x78EC, (q15_t)0x1D42,
+    (q15_t)0x070E, (q15_t)0xE2CA, (q15_t)0x78F2, (q15_t)0x1D36, (q15_t)0x0709, (q15_t)0xE2D5, (q15_t)0x78F7, (q15_t)0x1D2B,
+    (q15_t)0x0703, (q15_t)0xE2E0, (q15_t)0x78FD, (q15_t)0x1D20, (q15_t)0x06FD, (q15_t)0xE2EB, (q15_t)0x7903, (q15_t)0x1D15,
+    (q15_t)0x06F7, (q15_t)0xE2F6, (q15_t)0x7909, (q15_t)0x1D0A, (q15_t)0x06F2, (q15_t)0xE301, (q15_t)0x790E, (q15_t)0x1CFF,
+    (q15_t)0x06EC, (q15_t)0xE30D, (q15_t)0x7914, (q15_t)0x1CF3, (q15_t)0x06E6, (q15_t)0xE318, (q15_t)0x791A, (q15_t)0x1CE8,
+    (q15_t)0x06E1, (q15_t)0xE323, (q15_t)0x791F, (q15_t)0x1CDD, (q15_t)0x06DB, (q15_t)0xE32E, (q15_t)0x7925, (q15_t)0x1CD2,
+    (q15_t)0x06D5, (q15_t)0xE33A, (q15_t)0x792B, (q15_t)0x1CC6, (q15_t)0x06D0, (q15_t)0xE345, (q15_t)0x7930, (q15_t)0x1CBB,
+    (q15_t)0x06CA, (q15_t)0xE350, (q15_t)0x7936, (q15_t)0x1CB0, (q15_t)0x06C5, (q15_t)0xE35B, (q15_t)0x793B, (q15_t)0x1CA5,
+    (q15_t)0x06BF, (q15_t)0xE367, (q15_t)0x7941, (q15_t)0x1C99, (q15_t)0x06B9, (q15_t)0xE372, (q15_t)0x7947, (q15_t)0x1C8E,
+    (q15_t)0x06B4, (q15_t)0xE37D, (q15_t)0x794C, (q15_t)0x1C83, (q15_t)0x06AE, (q15_t)0xE388, (q15_t)0x7952, (q15_t)0x1C78,
+    (q15_t)0x06A8, (q15_t)0xE394, (q15_t)0x7958, (q15_t)0x1C6C, (q15_t)0x06A3, (q15_t)0xE39F, (q15_t)0x795D, (q15_t)0x1C61,
+    (q15_t)0x069D, (q15_t)0xE3AA, (q15_t)0x7963, (q15_t)0x1C56, (q15_t)0x0698, (q15_t)0xE3B5, (q15_t)0x7968, (q15_t)0x1C4B,
+    (q15_t)0x0692, (q15_t)0xE3C1, (q15_t)0x796E, (q15_t)0x1C3F, (q15_t)0x068D, (q15_t)0xE3CC, (q15_t)0x7973, (q15_t)0x1C34,
+    (q15_t)0x0687, (q15_t)0xE3D7, (q15_t)0x7979, (q15_t)0x1C29, (q15_t)0x0682, (q15_t)0xE3E2, (q15_t)0x797E, (q15_t)0x1C1E,
+    (q15_t)0x067C, (q15_t)0xE3EE, (q15_t)0x7984, (q15_t)0x1C12, (q15_t)0x0677, (q15_t)0xE3F9, (q15_t)0x7989, (q15_t)0x1C07,
+    (q15_t)0x0671, (q15_t)0xE404, (q15_t)0x798F, (q15_t)0x1BFC, (q15_t)0x066C, (q15_t)0xE410, (q15_t)0x7994, (q15_t)0x1BF0,
+    (q15_t)0x0666, (q15_t)0xE41B, (q15_t)0x799A, (q15_t)0x1BE5, (q15_t)0x0661, (q15_t)0xE426, (q15_t)0x799F, (q15_t)0x1BDA,
+    (q15_t)0x065B, (q15_t)0xE432, (q15_t)0x79A5, (q15_t)0x1BCE, (q15_t)0x0656, (q15_t)0xE43D, (q15_t)0x79AA, (q15_t)0x1BC3,
+    (q15_t)0x0650, (q15_t)0xE448, (q15_t)0x79B0, (q15_t)0x1BB8, (q15_t)0x064B, (q15_t)0xE454, (q15_t)0x79B5, (q15_t)0x1BAC,
+    (q15_t)0x0645, (q15_t)0xE45F, (q15_t)0x79BB, (q15_t)0x1BA1, (q15_t)0x0640, (q15_t)0xE46A, (q15_t)0x79C0, (q15_t)0x1B96,
+    (q15_t)0x063B, (q15_t)0xE476, (q15_t)0x79C5, (q15_t)0x1B8A, (q15_t)0x0635, (q15_t)0xE481, (q15_t)0x79CB, (q15_t)0x1B7F,
+    (q15_t)0x0630, (q15_t)0xE48C, (q15_t)0x79D0, (q15_t)0x1B74, (q15_t)0x062A, (q15_t)0xE498, (q15_t)0x79D6, (q15_t)0x1B68,
+    (q15_t)0x0625, (q15_t)0xE4A3, (q15_t)0x79DB, (q15_t)0x1B5D, (q15_t)0x0620, (q15_t)0xE4AE, (q15_t)0x79E0, (q15_t)0x1B52,
+    (q15_t)0x061A, (q15_t)0xE4BA, (q15_t)0x79E6, (q15_t)0x1B46, (q15_t)0x0615, (q15_t)0xE4C5, (q15_t)0x79EB, (q15_t)0x1B3B,
+    (q15_t)0x0610, (q15_t)0xE4D0, (q15_t)0x79F0, (q15_t)0x1B30, (q15_t)0x060A, (q15_t)0xE4DC, (q15_t)0x79F6, (q15_t)0x1B24,
+    (q15_t)0x0605, (q15_t)0xE4E7, (q15_t)0x79FB, (q15_t)0x1B19, (q15_t)0x0600, (q15_t)0xE4F3, (q15_t)0x7A00, (q15_t)0x1B0D,
+    (q15_t)0x05FA, (q15_t)0xE4FE, (q15_t)0x7A06, (q15_t)0x1B02, (q15_t)0x05F5, (q15_t)0xE509, (q15_t)0x7A0B, (q15_t)0x1AF7,
+    (q15_t)0x05F0, (q15_t)0xE515, (q15_t)0x7A10, (q15_t)0x1AEB, (q15_t)0x05EA, (q15_t)0xE520, (q15_t)0x7A16, (q15_t)0x1AE0,
+    (q15_t)0x05E5, (q15_t)0xE52C, (q15_t)0x7A1B, (q15_t)0x1AD4, (q15_t)0x05E0, (q15_t)0xE537, (q15_t)0x7A20, (q15_t)0x1AC9,
+    (q15_t)0x05DB, (q15_t)0xE542, (q15_t)0x7A25, (q15_t)0x1ABE, (q15_t)0x05D5, (q15_t)0xE54E, (q15_t)0x7A2B, (q15_t)0x1AB2,
+    (q15_t)0x05D0, (q15_t)0xE559, (q15_t)0x7A30, (q15_t)0x1AA7, (q15_t)0x05CB, (q15_t)0xE565, (q15_t)0x7A35, (q15_t)0x1A9B,
+    (q15_t)0x05C6, (q15_t)0xE570, (q15_t)0x7A3A, (q15_t)0x1A90, (q15_t)0x05C1, (q15_t)0xE57C, (q15_t)0x7A3F, (q15_t)0x1A84,
+    (q15_t)0x05BB, (q15_t)0xE587, (q15_t)0x7A45, (q15_t)0x1A79, (q15_t)0x05B6, (q15_t)0xE592, (q15_t)0x7A4A, (q15_t)0x1A6E,
+    (q15_t)0x05B1, (q15_t)0xE59E, (q15_t)0x7A4F, (q15_t)0x1A62, (q15_t)0x05AC, (q15_t)0xE5A9, (q15_t)0x7A54, (q15_t)0x1A57,
+    (q15_t)0x05A7, (q15_t)0xE5B5, (q15_t)0x7A59, (q15_t)0x1A4B, (q15_t)0x05A1, (q15_t)0xE5C0, (q15_t)0x7A5F, (q15_t)0x1A40,
+    (q15_t)0x059C, (q15_t)0xE5CC, (q15_t)0x7A64, (q15_t)0x1A34, (q15_t)0x0597, (q15_t)0xE5D7, (q15_t)0x7A69, (q15_t)0x1A29,
+    (q15_t)0x0592, (q15_t)0xE5E3, (q15_t)0x7A6E, (q15_t)0x1A1D, (q15_t)0x058D, (q15_t)0xE5EE, (q15_t)0x7A73, (q15_t)0x1A12,
+    (q15_t)0x0588, (q15_t)0xE5FA, (q15_t)0x7A78, (q15_t)0x1A06, (q15_t)0x0583, (q15_t)0xE605, (q15_t)0x7A7D, (q15_t)0x19FB,
+    (q15_t)0x057E, (q15_t)0xE611, (q15_t)0x7A82, (q15_t)0x19EF, (q15_t)0x0578, (q15_t)0xE61C, (q15_t)0x7A88, (q15_t)0x19E4,
+    (q15_t)0x0573, (q15_t)0xE628, (q15_t)0x7A8D, (q15_t)0x19D8, (q15_t)0x056E, (q15_t)0xE633, (q15_t)0x7A92, (q15_t)0x19CD,
+    (q15_t)0x0569, (q15_t)0xE63F, (q15_t)0x7A97, (q15_t)0x19C1, (q15_t)0x0564, (q15_t)0xE64A, (q15_t)0x7A9C, (q15_t)0x19B6,
+    (q15_t)0x055F, (q15_t)0xE656, (q15_t)0x7AA1, (q15_t)0x19AA, (q15_t)0x055A, (q15_t)0xE661, (q15_t)0x7AA6, (q15_t)0x199F,
+    (q15_t)0x0555, (q15_t)0xE66D, (q15_t)0x7AAB, (q15_t)0x1993, (q15_t)0x0550, (q15_t)0xE678, (q15_t)0x7AB0, (q15_t)0x1988,
+    (q15_t)0x054B, (q15_t)0xE684, (q15_t)0x7AB5, (q15_t)0x197C, (q15_t)0x0546, (q15_t)0xE68F, (q15_t)0x7ABA, (q15_t)0x1971,
+    (q15_t)0x0541, (q15_t)0xE69B, (q15_t)0x7ABF, (q15_t)0x1965, (q15_t)0x053C, (q15_t)0xE6A6, (q15_t)0x7AC4, (q15_t)0x195A,
+    (q15_t)0x0537, (q15_t)0xE6B2, (q15_t)0x7AC9, (q15_t)0x194E, (q15_t)0x0532, (q15_t)0xE6BD, (q15_t)0x7ACE, (q15_t)0x1943,
+    (q15_t)0x052D, (q15_t)0xE6C9, (q15_t)0x7AD3, (q15_t)0x1937, (q15_t)0x0528, (q15_t)0xE6D4, (q15_t)0x7AD8, (q15_t)0x192C,
+    (q15_t)0x0523, (q15_t)0xE6E0, (q15_t)0x7ADD, (q15_t)0x1920, (q15_t)0x051E, (q15_t)0xE6EC, (q15_t)0x7AE2, (q15_t)0x1914,
+    (q15_t)0x051A, (q15_t)0xE6F7, (q15_t)0x7AE6, (q15_t)0x1909, (q15_t)0x0515, (q15_t)0xE703, (q15_t)0x7AEB, (q15_t)0x18FD,
+    (q15_t)0x0510, (q15_t)0xE70E, (q15_t)0x7AF0, (q15_t)0x18F2, (q15_t)0x050B, (q15_t)0xE71A, (q15_t)0x7AF5, (q15_t)0x18E6,
+    (q15_t)0x0506, (q15_t)0xE725, (q15_t)0x7AFA, (q15_t)0x18DB, (q15_t)0x0501, (q15_t)0xE731, (q15_t)0x7AFF, (q15_t)0x18CF,
+    (q15_t)0x04FC, (q15_t)0xE73D, (q15_t)0x7B04, (q15_t)0x18C3, (q15_t)0x04F7, (q15_t)0xE748, (q15_t)0x7B09, (q15_t)0x18B8,
+    (q15_t)0x04F2, (q15_t)0xE754, (q15_t)0x7B0E, (q15_t)0x18AC, (q15_t)0x04EE, (q15_t)0xE75F, (q15_t)0x7B12, (q15_t)0x18A1,
+    (q15_t)0x04E9, (q15_t)0xE76B, (q15_t)0x7B17, (q15_t)0x1895, (q15_t)0x04E4, (q15_t)0xE777, (q15_t)0x7B1C, (q15_t)0x1889,
+    (q15_t)0x04DF, (q15_t)0xE782, (q15_t)0x7B21, (q15_t)0x187E, (q15_t)0x04DA, (q15_t)0xE78E, (q15_t)0x7B26, (q15_t)0x1872,
+    (q15_t)0x04D6, (q15_t)0xE799, (q15_t)0x7B2A, (q15_t)0x1867, (q15_t)0x04D1, (q15_t)0xE7A5, (q15_t)0x7B2F, (q15_t)0x185B,
+    (q15_t)0x04CC, (q15_t)0xE7B1, (q15_t)0x7B34, (q15_t)0x184F, (q15_t)0x04C7, (q15_t)0xE7BC, (q15_t)0x7B39, (q15_t)0x1844,
+    (q15_t)0x04C2, (q15_t)0xE7C8, (q15_t)0x7B3E, (q15_t)0x1838, (q15_t)0x04BE, (q15_t)0xE7D3, (q15_t)0x7B42, (q15_t)0x182D,
+    (q15_t)0x04B9, (q15_t)0xE7DF, (q15_t)0x7B47, (q15_t)0x1821, (q15_t)0x04B4, (q15_t)0xE7EB, (q15_t)0x7B4C, (q15_t)0x1815,
+    (q15_t)0x04B0, (q15_t)0xE7F6, (q15_t)0x7B50, (q15_t)0x180A, (q15_t)0x04AB, (q15_t)0xE802, (q15_t)0x7B55, (q15_t)0x17FE,
+    (q15_t)0x04A6, (q15_t)0xE80E, (q15_t)0x7B5A, (q15_t)0x17F2, (q15_t)0x04A1, (q15_t)0xE819, (q15_t)0x7B5F, (q15_t)0x17E7,
+    (q15_t)0x049D, (q15_t)0xE825, (q15_t)0x7B63, (q15_t)0x17DB, (q15_t)0x0498, (q15_t)0xE831, (q15_t)0x7B68, (q15_t)0x17CF,
+    (q15_t)0x0493, (q15_t)0xE83C, (q15_t)0x7B6D, (q15_t)0x17C4, (q15_t)0x048F, (q15_t)0xE848, (q15_t)0x7B71, (q15_t)0x17B8,
+    (q15_t)0x048A, (q15_t)0xE854, (q15_t)0x7B76, (q15_t)0x17AC, (q15_t)0x0485, (q15_t)0xE85F, (q15_t)0x7B7B, (q15_t)0x17A1,
+    (q15_t)0x0481, (q15_t)0xE86B, (q15_t)0x7B7F, (q15_t)0x1795, (q15_t)0x047C, (q15_t)0xE877, (q15_t)0x7B84, (q15_t)0x1789,
+    (q15_t)0x0478, (q15_t)0xE882, (q15_t)0x7B88, (q15_t)0x177E, (q15_t)0x0473, (q15_t)0xE88E, (q15_t)0x7B8D, (q15_t)0x1772,
+    (q15_t)0x046E, (q15_t)0xE89A, (q15_t)0x7B92, (q15_t)0x1766, (q15_t)0x046A, (q15_t)0xE8A5, (q15_t)0x7B96, (q15_t)0x175B,
+    (q15_t)0x0465, (q15_t)0xE8B1, (q15_t)0x7B9B, (q15_t)0x174F, (q15_t)0x0461, (q15_t)0xE8BD, (q15_t)0x7B9F, (q15_t)0x1743,
+    (q15_t)0x045C, (q15_t)0xE8C9, (q15_t)0x7BA4, (q15_t)0x1737, (q15_t)0x0457, (q15_t)0xE8D4, (q15_t)0x7BA9, (q15_t)0x172C,
+    (q15_t)0x0453, (q15_t)0xE8E0, (q15_t)0x7BAD, (q15_t)0x1720, (q15_t)0x044E, (q15_t)0xE8EC, (q15_t)0x7BB2, (q15_t)0x1714,
+    (q15_t)0x044A, (q15_t)0xE8F7, (q15_t)0x7BB6, (q15_t)0x1709, (q15_t)0x0445, (q15_t)0xE903, (q15_t)0x7BBB, (q15_t)0x16FD,
+    (q15_t)0x0441, (q15_t)0xE90F, (q15_t)0x7BBF, (q15_t)0x16F1, (q15_t)0x043C, (q15_t)0xE91B, (q15_t)0x7BC4, (q15_t)0x16E5,
+    (q15_t)0x0438, (q15_t)0xE926, (q15_t)0x7BC8, (q15_t)0x16DA, (q15_t)0x0433, (q15_t)0xE932, (q15_t)0x7BCD, (q15_t)0x16CE,
+    (q15_t)0x042F, (q15_t)0xE93E, (q15_t)0x7BD1, (q15_t)0x16C2, (q15_t)0x042A, (q15_t)0xE94A, (q15_t)0x7BD6, (q15_t)0x16B6,
+    (q15_t)0x0426, (q15_t)0xE955, (q15_t)0x7BDA, (q15_t)0x16AB, (q15_t)0x0422, (q15_t)0xE961, (q15_t)0x7BDE, (q15_t)0x169F,
+    (q15_t)0x041D, (q15_t)0xE96D, (q15_t)0x7BE3, (q15_t)0x1693, (q15_t)0x0419, (q15_t)0xE979, (q15_t)0x7BE7, (q15_t)0x1687,
+    (q15_t)0x0414, (q15_t)0xE984, (q15_t)0x7BEC, (q15_t)0x167C, (q15_t)0x0410, (q15_t)0xE990, (q15_t)0x7BF0, (q15_t)0x1670,
+    (q15_t)0x040B, (q15_t)0xE99C, (q15_t)0x7BF5, (q15_t)0x1664, (q15_t)0x0407, (q15_t)0xE9A8, (q15_t)0x7BF9, (q15_t)0x1658,
+    (q15_t)0x0403, (q15_t)0xE9B4, (q15_t)0x7BFD, (q15_t)0x164C, (q15_t)0x03FE, (q15_t)0xE9BF, (q15_t)0x7C02, (q15_t)0x1641,
+    (q15_t)0x03FA, (q15_t)0xE9CB, (q15_t)0x7C06, (q15_t)0x1635, (q15_t)0x03F6, (q15_t)0xE9D7, (q15_t)0x7C0A, (q15_t)0x1629,
+    (q15_t)0x03F1, (q15_t)0xE9E3, (q15_t)0x7C0F, (q15_t)0x161D, (q15_t)0x03ED, (q15_t)0xE9EE, (q15_t)0x7C13, (q15_t)0x1612,
+    (q15_t)0x03E9, (q15_t)0xE9FA, (q15_t)0x7C17, (q15_t)0x1606, (q15_t)0x03E4, (q15_t)0xEA06, (q15_t)0x7C1C, (q15_t)0x15FA,
+    (q15_t)0x03E0, (q15_t)0xEA12, (q15_t)0x7C20, (q15_t)0x15EE, (q15_t)0x03DC, (q15_t)0xEA1E, (q15_t)0x7C24, (q15_t)0x15E2,
+    (q15_t)0x03D7, (q15_t)0xEA29, (q15_t)0x7C29, (q15_t)0x15D7, (q15_t)0x03D3, (q15_t)0xEA35, (q15_t)0x7C2D, (q15_t)0x15CB,
+    (q15_t)0x03CF, (q15_t)0xEA41, (q15_t)0x7C31, (q15_t)0x15BF, (q15_t)0x03CA, (q15_t)0xEA4D, (q15_t)0x7C36, (q15_t)0x15B3,
+    (q15_t)0x03C6, (q15_t)0xEA59, (q15_t)0x7C3A, (q15_t)0x15A7, (q15_t)0x03C2, (q15_t)0xEA65, (q15_t)0x7C3E, (q15_t)0x159B,
+    (q15_t)0x03BE, (q15_t)0xEA70, (q15_t)0x7C42, (q15_t)0x1590, (q15_t)0x03BA, (q15_t)0xEA7C, (q15_t)0x7C46, (q15_t)0x1584,
+    (q15_t)0x03B5, (q15_t)0xEA88, (q15_t)0x7C4B, (q15_t)0x1578, (q15_t)0x03B1, (q15_t)0xEA94, (q15_t)0x7C4F, (q15_t)0x156C,
+    (q15_t)0x03AD, (q15_t)0xEAA0, (q15_t)0x7C53, (q15_t)0x1560, (q15_t)0x03A9, (q15_t)0xEAAC, (q15_t)0x7C57, (q15_t)0x1554,
+    (q15_t)0x03A5, (q15_t)0xEAB7, (q15_t)0x7C5B, (q15_t)0x1549, (q15_t)0x03A0, (q15_t)0xEAC3, (q15_t)0x7C60, (q15_t)0x153D,
+    (q15_t)0x039C, (q15_t)0xEACF, (q15_t)0x7C64, (q15_t)0x1531, (q15_t)0x0398, (q15_t)0xEADB, (q15_t)0x7C68, (q15_t)0x1525,
+    (q15_t)0x0394, (q15_t)0xEAE7, (q15_t)0x7C6C, (q15_t)0x1519, (q15_t)0x0390, (q15_t)0xEAF3, (q15_t)0x7C70, (q15_t)0x150D,
+    (q15_t)0x038C, (q15_t)0xEAFF, (q15_t)0x7C74, (q15_t)0x1501, (q15_t)0x0387, (q15_t)0xEB0A, (q15_t)0x7C79, (q15_t)0x14F6,
+    (q15_t)0x0383, (q15_t)0xEB16, (q15_t)0x7C7D, (q15_t)0x14EA, (q15_t)0x037F, (q15_t)0xEB22, (q15_t)0x7C81, (q15_t)0x14DE,
+    (q15_t)0x037B, (q15_t)0xEB2E, (q15_t)0x7C85, (q15_t)0x14D2, (q15_t)0x0377, (q15_t)0xEB3A, (q15_t)0x7C89, (q15_t)0x14C6,
+    (q15_t)0x0373, (q15_t)0xEB46, (q15_t)0x7C8D, (q15_t)0x14BA, (q15_t)0x036F, (q15_t)0xEB52, (q15_t)0x7C91, (q15_t)0x14AE,
+    (q15_t)0x036B, (q15_t)0xEB5E, (q15_t)0x7C95, (q15_t)0x14A2, (q15_t)0x0367, (q15_t)0xEB6A, (q15_t)0x7C99, (q15_t)0x1496,
+    (q15_t)0x0363, (q15_t)0xEB75, (q15_t)0x7C9D, (q15_t)0x148B, (q15_t)0x035F, (q15_t)0xEB81, (q15_t)0x7CA1, (q15_t)0x147F,
+    (q15_t)0x035B, (q15_t)0xEB8D, (q15_t)0x7CA5, (q15_t)0x1473, (q15_t)0x0357, (q15_t)0xEB99, (q15_t)0x7CA9, (q15_t)0x1467,
+    (q15_t)0x0353, (q15_t)0xEBA5, (q15_t)0x7CAD, (q15_t)0x145B, (q15_t)0x034F, (q15_t)0xEBB1, (q15_t)0x7CB1, (q15_t)0x144F,
+    (q15_t)0x034B, (q15_t)0xEBBD, (q15_t)0x7CB5, (q15_t)0x1443, (q15_t)0x0347, (q15_t)0xEBC9, (q15_t)0x7CB9, (q15_t)0x1437,
+    (q15_t)0x0343, (q15_t)0xEBD5, (q15_t)0x7CBD, (q15_t)0x142B, (q15_t)0x033F, (q15_t)0xEBE1, (q15_t)0x7CC1, (q15_t)0x141F,
+    (q15_t)0x033B, (q15_t)0xEBED, (q15_t)0x7CC5, (q15_t)0x1413, (q15_t)0x0337, (q15_t)0xEBF9, (q15_t)0x7CC9, (q15_t)0x1407,
+    (q15_t)0x0333, (q15_t)0xEC05, (q15_t)0x7CCD, (q15_t)0x13FB, (q15_t)0x032F, (q15_t)0xEC10, (q15_t)0x7CD1, (q15_t)0x13F0,
+    (q15_t)0x032B, (q15_t)0xEC1C, (q15_t)0x7CD5, (q15_t)0x13E4, (q15_t)0x0327, (q15_t)0xEC28, (q15_t)0x7CD9, (q15_t)0x13D8,
+    (q15_t)0x0323, (q15_t)0xEC34, (q15_t)0x7CDD, (q15_t)0x13CC, (q15_t)0x0320, (q15_t)0xEC40, (q15_t)0x7CE0, (q15_t)0x13C0,
+    (q15_t)0x031C, (q15_t)0xEC4C, (q15_t)0x7CE4, (q15_t)0x13B4, (q15_t)0x0318, (q15_t)0xEC58, (q15_t)0x7CE8, (q15_t)0x13A8,
+    (q15_t)0x0314, (q15_t)0xEC64, (q15_t)0x7CEC, (q15_t)0x139C, (q15_t)0x0310, (q15_t)0xEC70, (q15_t)0x7CF0, (q15_t)0x1390,
+    (q15_t)0x030C, (q15_t)0xEC7C, (q15_t)0x7CF4, (q15_t)0x1384, (q15_t)0x0308, (q15_t)0xEC88, (q15_t)0x7CF8, (q15_t)0x1378,
+    (q15_t)0x0305, (q15_t)0xEC94, (q15_t)0x7CFB, (q15_t)0x136C, (q15_t)0x0301, (q15_t)0xECA0, (q15_t)0x7CFF, (q15_t)0x1360,
+    (q15_t)0x02FD, (q15_t)0xECAC, (q15_t)0x7D03, (q15_t)0x1354, (q15_t)0x02F9, (q15_t)0xECB8, (q15_t)0x7D07, (q15_t)0x1348,
+    (q15_t)0x02F5, (q15_t)0xECC4, (q15_t)0x7D0B, (q15_t)0x133C, (q15_t)0x02F2, (q15_t)0xECD0, (q15_t)0x7D0E, (q15_t)0x1330,
+    (q15_t)0x02EE, (q15_t)0xECDC, (q15_t)0x7D12, (q15_t)0x1324, (q15_t)0x02EA, (q15_t)0xECE8, (q15_t)0x7D16, (q15_t)0x1318,
+    (q15_t)0x02E6, (q15_t)0xECF4, (q15_t)0x7D1A, (q15_t)0x130C, (q15_t)0x02E3, (q15_t)0xED00, (q15_t)0x7D1D, (q15_t)0x1300,
+    (q15_t)0x02DF, (q15_t)0xED0C, (q15_t)0x7D21, (q15_t)0x12F4, (q15_t)0x02DB, (q15_t)0xED18, (q15_t)0x7D25, (q15_t)0x12E8,
+    (q15_t)0x02D8, (q15_t)0xED24, (q15_t)0x7D28, (q15_t)0x12DC, (q15_t)0x02D4, (q15_t)0xED30, (q15_t)0x7D2C, (q15_t)0x12D0,
+    (q15_t)0x02D0, (q15_t)0xED3C, (q15_t)0x7D30, (q15_t)0x12C4, (q15_t)0x02CC, (q15_t)0xED48, (q15_t)0x7D34, (q15_t)0x12B8,
+    (q15_t)0x02C9, (q15_t)0xED54, (q15_t)0x7D37, (q15_t)0x12AC, (q15_t)0x02C5, (q15_t)0xED60, (q15_t)0x7D3B, (q15_t)0x12A0,
+    (q15_t)0x02C1, (q15_t)0xED6C, (q15_t)0x7D3F, (q15_t)0x1294, (q15_t)0x02BE, (q15_t)0xED78, (q15_t)0x7D42, (q15_t)0x1288,
+    (q15_t)0x02BA, (q15_t)0xED84, (q15_t)0x7D46, (q15_t)0x127C, (q15_t)0x02B7, (q15_t)0xED90, (q15_t)0x7D49, (q15_t)0x1270,
+    (q15_t)0x02B3, (q15_t)0xED9C, (q15_t)0x7D4D, (q15_t)0x1264, (q15_t)0x02AF, (q15_t)0xEDA8, (q15_t)0x7D51, (q15_t)0x1258,
+    (q15_t)0x02AC, (q15_t)0xEDB4, (q15_t)0x7D54, (q15_t)0x124C, (q15_t)0x02A8, (q15_t)0xEDC0, (q15_t)0x7D58, (q15_t)0x1240,
+    (q15_t)0x02A5, (q15_t)0xEDCC, (q15_t)0x7D5B, (q15_t)0x1234, (q15_t)0x02A1, (q15_t)0xEDD8, (q15_t)0x7D5F, (q15_t)0x1228,
+    (q15_t)0x029D, (q15_t)0xEDE4, (q15_t)0x7D63, (q15_t)0x121C, (q15_t)0x029A, (q15_t)0xEDF0, (q15_t)0x7D66, (q15_t)0x1210,
+    (q15_t)0x0296, (q15_t)0xEDFC, (q15_t)0x7D6A, (q15_t)0x1204, (q15_t)0x0293, (q15_t)0xEE09, (q15_t)0x7D6D, (q15_t)0x11F7,
+    (q15_t)0x028F, (q15_t)0xEE15, (q15_t)0x7D71, (q15_t)0x11EB, (q15_t)0x028C, (q15_t)0xEE21, (q15_t)0x7D74, (q15_t)0x11DF,
+    (q15_t)0x0288, (q15_t)0xEE2D, (q15_t)0x7D78, (q15_t)0x11D3, (q15_t)0x0285, (q15_t)0xEE39, (q15_t)0x7D7B, (q15_t)0x11C7,
+    (q15_t)0x0281, (q15_t)0xEE45, (q15_t)0x7D7F, (q15_t)0x11BB, (q15_t)0x027E, (q15_t)0xEE51, (q15_t)0x7D82, (q15_t)0x11AF,
+    (q15_t)0x027A, (q15_t)0xEE5D, (q15_t)0x7D86, (q15_t)0x11A3, (q15_t)0x0277, (q15_t)0xEE69, (q15_t)0x7D89, (q15_t)0x1197,
+    (q15_t)0x0273, (q15_t)0xEE75, (q15_t)0x7D8D, (q15_t)0x118B, (q15_t)0x0270, (q15_t)0xEE81, (q15_t)0x7D90, (q15_t)0x117F,
+    (q15_t)0x026D, (q15_t)0xEE8D, (q15_t)0x7D93, (q15_t)0x1173, (q15_t)0x0269, (q15_t)0xEE99, (q15_t)0x7D97, (q15_t)0x1167,
+    (q15_t)0x0266, (q15_t)0xEEA6, (q15_t)0x7D9A, (q15_t)0x115A, (q15_t)0x0262, (q15_t)0xEEB2, (q15_t)0x7D9E, (q15_t)0x114E,
+    (q15_t)0x025F, (q15_t)0xEEBE, (q15_t)0x7DA1, (q15_t)0x1142, (q15_t)0x025C, (q15_t)0xEECA, (q15_t)0x7DA4, (q15_t)0x1136,
+    (q15_t)0x0258, (q15_t)0xEED6, (q15_t)0x7DA8, (q15_t)0x112A, (q15_t)0x0255, (q15_t)0xEEE2, (q15_t)0x7DAB, (q15_t)0x111E,
+    (q15_t)0x0251, (q15_t)0xEEEE, (q15_t)0x7DAF, (q15_t)0x1112, (q15_t)0x024E, (q15_t)0xEEFA, (q15_t)0x7DB2, (q15_t)0x1106,
+    (q15_t)0x024B, (q15_t)0xEF06, (q15_t)0x7DB5, (q15_t)0x10FA, (q15_t)0x0247, (q15_t)0xEF13, (q15_t)0x7DB9, (q15_t)0x10ED,
+    (q15_t)0x0244, (q15_t)0xEF1F, (q15_t)0x7DBC, (q15_t)0x10E1, (q15_t)0x0241, (q15_t)0xEF2B, (q15_t)0x7DBF, (q15_t)0x10D5,
+    (q15_t)0x023E, (q15_t)0xEF37, (q15_t)0x7DC2, (q15_t)0x10C9, (q15_t)0x023A, (q15_t)0xEF43, (q15_t)0x7DC6, (q15_t)0x10BD,
+    (q15_t)0x0237, (q15_t)0xEF4F, (q15_t)0x7DC9, (q15_t)0x10B1, (q15_t)0x0234, (q15_t)0xEF5B, (q15_t)0x7DCC, (q15_t)0x10A5,
+    (q15_t)0x0230, (q15_t)0xEF67, (q15_t)0x7DD0, (q15_t)0x1099, (q15_t)0x022D, (q15_t)0xEF74, (q15_t)0x7DD3, (q15_t)0x108C,
+    (q15_t)0x022A, (q15_t)0xEF80, (q15_t)0x7DD6, (q15_t)0x1080, (q15_t)0x0227, (q15_t)0xEF8C, (q15_t)0x7DD9, (q15_t)0x1074,
+    (q15_t)0x0223, (q15_t)0xEF98, (q15_t)0x7DDD, (q15_t)0x1068, (q15_t)0x0220, (q15_t)0xEFA4, (q15_t)0x7DE0, (q15_t)0x105C,
+    (q15_t)0x021D, (q15_t)0xEFB0, (q15_t)0x7DE3, (q15_t)0x1050, (q15_t)0x021A, (q15_t)0xEFBC, (q15_t)0x7DE6, (q15_t)0x1044,
+    (q15_t)0x0217, (q15_t)0xEFC9, (q15_t)0x7DE9, (q15_t)0x1037, (q15_t)0x0213, (q15_t)0xEFD5, (q15_t)0x7DED, (q15_t)0x102B,
+    (q15_t)0x0210, (q15_t)0xEFE1, (q15_t)0x7DF0, (q15_t)0x101F, (q15_t)0x020D, (q15_t)0xEFED, (q15_t)0x7DF3, (q15_t)0x1013,
+    (q15_t)0x020A, (q15_t)0xEFF9, (q15_t)0x7DF6, (q15_t)0x1007, (q15_t)0x0207, (q15_t)0xF005, (q15_t)0x7DF9, (q15_t)0x0FFB,
+    (q15_t)0x0204, (q15_t)0xF012, (q15_t)0x7DFC, (q15_t)0x0FEE, (q15_t)0x0201, (q15_t)0xF01E, (q15_t)0x7DFF, (q15_t)0x0FE2,
+    (q15_t)0x01FD, (q15_t)0xF02A, (q15_t)0x7E03, (q15_t)0x0FD6, (q15_t)0x01FA, (q15_t)0xF036, (q15_t)0x7E06, (q15_t)0x0FCA,
+    (q15_t)0x01F7, (q15_t)0xF042, (q15_t)0x7E09, (q15_t)0x0FBE, (q15_t)0x01F4, (q15_t)0xF04E, (q15_t)0x7E0C, (q15_t)0x0FB2,
+    (q15_t)0x01F1, (q15_t)0xF05B, (q15_t)0x7E0F, (q15_t)0x0FA5, (q15_t)0x01EE, (q15_t)0xF067, (q15_t)0x7E12, (q15_t)0x0F99,
+    (q15_t)0x01EB, (q15_t)0xF073, (q15_t)0x7E15, (q15_t)0x0F8D, (q15_t)0x01E8, (q15_t)0xF07F, (q15_t)0x7E18, (q15_t)0x0F81,
+    (q15_t)0x01E5, (q15_t)0xF08B, (q15_t)0x7E1B, (q15_t)0x0F75, (q15_t)0x01E2, (q15_t)0xF098, (q15_t)0x7E1E, (q15_t)0x0F68,
+    (q15_t)0x01DF, (q15_t)0xF0A4, (q15_t)0x7E21, (q15_t)0x0F5C, (q15_t)0x01DC, (q15_t)0xF0B0, (q15_t)0x7E24, (q15_t)0x0F50,
+    (q15_t)0x01D9, (q15_t)0xF0BC, (q15_t)0x7E27, (q15_t)0x0F44, (q15_t)0x01D6, (q15_t)0xF0C8, (q15_t)0x7E2A, (q15_t)0x0F38,
+    (q15_t)0x01D3, (q15_t)0xF0D5, (q15_t)0x7E2D, (q15_t)0x0F2B, (q15_t)0x01D0, (q15_t)0xF0E1, (q15_t)0x7E30, (q15_t)0x0F1F,
+    (q15_t)0x01CD, (q15_t)0xF0ED, (q15_t)0x7E33, (q15_t)0x0F13, (q15_t)0x01CA, (q15_t)0xF0F9, (q15_t)0x7E36, (q15_t)0x0F07,
+    (q15_t)0x01C7, (q15_t)0xF105, (q15_t)0x7E39, (q15_t)0x0EFB, (q15_t)0x01C4, (q15_t)0xF112, (q15_t)0x7E3C, (q15_t)0x0EEE,
+    (q15_t)0x01C1, (q15_t)0xF11E, (q15_t)0x7E3F, (q15_t)0x0EE2, (q15_t)0x01BE, (q15_t)0xF12A, (q15_t)0x7E42, (q15_t)0x0ED6,
+    (q15_t)0x01BB, (q15_t)0xF136, (q15_t)0x7E45, (q15_t)0x0ECA, (q15_t)0x01B8, (q15_t)0xF143, (q15_t)0x7E48, (q15_t)0x0EBD,
+    (q15_t)0x01B6, (q15_t)0xF14F, (q15_t)0x7E4A, (q15_t)0x0EB1, (q15_t)0x01B3, (q15_t)0xF15B, (q15_t)0x7E4D, (q15_t)0x0EA5,
+    (q15_t)0x01B0, (q15_t)0xF167, (q15_t)0x7E50, (q15_t)0x0E99, (q15_t)0x01AD, (q15_t)0xF174, (q15_t)0x7E53, (q15_t)0x0E8C,
+    (q15_t)0x01AA, (q15_t)0xF180, (q15_t)0x7E56, (q15_t)0x0E80, (q15_t)0x01A7, (q15_t)0xF18C, (q15_t)0x7E59, (q15_t)0x0E74,
+    (q15_t)0x01A4, (q15_t)0xF198, (q15_t)0x7E5C, (q15_t)0x0E68, (q15_t)0x01A2, (q15_t)0xF1A4, (q15_t)0x7E5E, (q15_t)0x0E5C,
+    (q15_t)0x019F, (q15_t)0xF1B1, (q15_t)0x7E61, (q15_t)0x0E4F, (q15_t)0x019C, (q15_t)0xF1BD, (q15_t)0x7E64, (q15_t)0x0E43,
+    (q15_t)0x0199, (q15_t)0xF1C9, (q15_t)0x7E67, (q15_t)0x0E37, (q15_t)0x0196, (q15_t)0xF1D5, (q15_t)0x7E6A, (q15_t)0x0E2B,
+    (q15_t)0x0194, (q15_t)0xF1E2, (q15_t)0x7E6C, (q15_t)0x0E1E, (q15_t)0x0191, (q15_t)0xF1EE, (q15_t)0x7E6F, (q15_t)0x0E12,
+    (q15_t)0x018E, (q15_t)0xF1FA, (q15_t)0x7E72, (q15_t)0x0E06, (q15_t)0x018B, (q15_t)0xF207, (q15_t)0x7E75, (q15_t)0x0DF9,
+    (q15_t)0x0189, (q15_t)0xF213, (q15_t)0x7E77, (q15_t)0x0DED, (q15_t)0x0186, (q15_t)0xF21F, (q15_t)0x7E7A, (q15_t)0x0DE1,
+    (q15_t)0x0183, (q15_t)0xF22B, (q15_t)0x7E7D, (q15_t)0x0DD5, (q15_t)0x0180, (q15_t)0xF238, (q15_t)0x7E80, (q15_t)0x0DC8,
+    (q15_t)0x017E, (q15_t)0xF244, (q15_t)0x7E82, (q15_t)0x0DBC, (q15_t)0x017B, (q15_t)0xF250, (q15_t)0x7E85, (q15_t)0x0DB0,
+    (q15_t)0x0178, (q15_t)0xF25C, (q15_t)0x7E88, (q15_t)0x0DA4, (q15_t)0x0176, (q15_t)0xF269, (q15_t)0x7E8A, (q15_t)0x0D97,
+    (q15_t)0x0173, (q15_t)0xF275, (q15_t)0x7E8D, (q15_t)0x0D8B, (q15_t)0x0170, (q15_t)0xF281, (q15_t)0x7E90, (q15_t)0x0D7F,
+    (q15_t)0x016E, (q15_t)0xF28E, (q15_t)0x7E92, (q15_t)0x0D72, (q15_t)0x016B, (q15_t)0xF29A, (q15_t)0x7E95, (q15_t)0x0D66,
+    (q15_t)0x0168, (q15_t)0xF2A6, (q15_t)0x7E98, (q15_t)0x0D5A, (q15_t)0x0166, (q15_t)0xF2B2, (q15_t)0x7E9A, (q15_t)0x0D4E,
+    (q15_t)0x0163, (q15_t)0xF2BF, (q15_t)0x7E9D, (q15_t)0x0D41, (q15_t)0x0161, (q15_t)0xF2CB, (q15_t)0x7E9F, (q15_t)0x0D35,
+    (q15_t)0x015E, (q15_t)0xF2D7, (q15_t)0x7EA2, (q15_t)0x0D29, (q15_t)0x015B, (q15_t)0xF2E4, (q15_t)0x7EA5, (q15_t)0x0D1C,
+    (q15_t)0x0159, (q15_t)0xF2F0, (q15_t)0x7EA7, (q15_t)0x0D10, (q15_t)0x0156, (q15_t)0xF2FC, (q15_t)0x7EAA, (q15_t)0x0D04,
+    (q15_t)0x0154, (q15_t)0xF308, (q15_t)0x7EAC, (q15_t)0x0CF8, (q15_t)0x0151, (q15_t)0xF315, (q15_t)0x7EAF, (q15_t)0x0CEB,
+    (q15_t)0x014F, (q15_t)0xF321, (q15_t)0x7EB1, (q15_t)0x0CDF, (q15_t)0x014C, (q15_t)0xF32D, (q15_t)0x7EB4, (q15_t)0x0CD3,
+    (q15_t)0x014A, (q15_t)0xF33A, (q15_t)0x7EB6, (q15_t)0x0CC6, (q15_t)0x0147, (q15_t)0xF346, (q15_t)0x7EB9, (q15_t)0x0CBA,
+    (q15_t)0x0145, (q15_t)0xF352, (q15_t)0x7EBB, (q15_t)0x0CAE, (q15_t)0x0142, (q15_t)0xF35F, (q15_t)0x7EBE, (q15_t)0x0CA1,
+    (q15_t)0x0140, (q15_t)0xF36B, (q15_t)0x7EC0, (q15_t)0x0C95, (q15_t)0x013D, (q15_t)0xF377, (q15_t)0x7EC3, (q15_t)0x0C89,
+    (q15_t)0x013B, (q15_t)0xF384, (q15_t)0x7EC5, (q15_t)0x0C7C, (q15_t)0x0138, (q15_t)0xF390, (q15_t)0x7EC8, (q15_t)0x0C70,
+    (q15_t)0x0136, (q15_t)0xF39C, (q15_t)0x7ECA, (q15_t)0x0C64, (q15_t)0x0134, (q15_t)0xF3A9, (q15_t)0x7ECC, (q15_t)0x0C57,
+    (q15_t)0x0131, (q15_t)0xF3B5, (q15_t)0x7ECF, (q15_t)0x0C4B, (q15_t)0x012F, (q15_t)0xF3C1, (q15_t)0x7ED1, (q15_t)0x0C3F,
+    (q15_t)0x012C, (q15_t)0xF3CE, (q15_t)0x7ED4, (q15_t)0x0C32, (q15_t)0x012A, (q15_t)0xF3DA, (q15_t)0x7ED6, (q15_t)0x0C26,
+    (q15_t)0x0128, (q15_t)0xF3E6, (q15_t)0x7ED8, (q15_t)0x0C1A, (q15_t)0x0125, (q15_t)0xF3F3, (q15_t)0x7EDB, (q15_t)0x0C0D,
+    (q15_t)0x0123, (q15_t)0xF3FF, (q15_t)0x7EDD, (q15_t)0x0C01, (q15_t)0x0120, (q15_t)0xF40B, (q15_t)0x7EE0, (q15_t)0x0BF5,
+    (q15_t)0x011E, (q15_t)0xF418, (q15_t)0x7EE2, (q15_t)0x0BE8, (q15_t)0x011C, (q15_t)0xF424, (q15_t)0x7EE4, (q15_t)0x0BDC,
+    (q15_t)0x0119, (q15_t)0xF430, (q15_t)0x7EE7, (q15_t)0x0BD0, (q15_t)0x0117, (q15_t)0xF43D, (q15_t)0x7EE9, (q15_t)0x0BC3,
+    (q15_t)0x0115, (q15_t)0xF449, (q15_t)0x7EEB, (q15_t)0x0BB7, (q15_t)0x0113, (q15_t)0xF455, (q15_t)0x7EED, (q15_t)0x0BAB,
+    (q15_t)0x0110, (q15_t)0xF462, (q15_t)0x7EF0, (q15_t)0x0B9E, (q15_t)0x010E, (q15_t)0xF46E, (q15_t)0x7EF2, (q15_t)0x0B92,
+    (q15_t)0x010C, (q15_t)0xF47B, (q15_t)0x7EF4, (q15_t)0x0B85, (q15_t)0x0109, (q15_t)0xF487, (q15_t)0x7EF7, (q15_t)0x0B79,
+    (q15_t)0x0107, (q15_t)0xF493, (q15_t)0x7EF9, (q15_t)0x0B6D, (q15_t)0x0105, (q15_t)0xF4A0, (q15_t)0x7EFB, (q15_t)0x0B60,
+    (q15_t)0x0103, (q15_t)0xF4AC, (q15_t)0x7EFD, (q15_t)0x0B54, (q15_t)0x0100, (q15_t)0xF4B8, (q15_t)0x7F00, (q15_t)0x0B48,
+    (q15_t)0x00FE, (q15_t)0xF4C5, (q15_t)0x7F02, (q15_t)0x0B3B, (q15_t)0x00FC, (q15_t)0xF4D1, (q15_t)0x7F04, (q15_t)0x0B2F,
+    (q15_t)0x00FA, (q15_t)0xF4DD, (q15_t)0x7F06, (q15_t)0x0B23, (q15_t)0x00F8, (q15_t)0xF4EA, (q15_t)0x7F08, (q15_t)0x0B16,
+    (q15_t)0x00F6, (q15_t)0xF4F6, (q15_t)0x7F0A, (q15_t)0x0B0A, (q15_t)0x00F3, (q15_t)0xF503, (q15_t)0x7F0D, (q15_t)0x0AFD,
+    (q15_t)0x00F1, (q15_t)0xF50F, (q15_t)0x7F0F, (q15_t)0x0AF1, (q15_t)0x00EF, (q15_t)0xF51B, (q15_t)0x7F11, (q15_t)0x0AE5,
+    (q15_t)0x00ED, (q15_t)0xF528, (q15_t)0x7F13, (q15_t)0x0AD8, (q15_t)0x00EB, (q15_t)0xF534, (q15_t)0x7F15, (q15_t)0x0ACC,
+    (q15_t)0x00E9, (q15_t)0xF540, (q15_t)0x7F17, (q15_t)0x0AC0, (q15_t)0x00E7, (q15_t)0xF54D, (q15_t)0x7F19, (q15_t)0x0AB3,
+    (q15_t)0x00E4, (q15_t)0xF559, (q15_t)0x7F1C, (q15_t)0x0AA7, (q15_t)0x00E2, (q15_t)0xF566, (q15_t)0x7F1E, (q15_t)0x0A9A,
+    (q15_t)0x00E0, (q15_t)0xF572, (q15_t)0x7F20, (q15_t)0x0A8E, (q15_t)0x00DE, (q15_t)0xF57E, (q15_t)0x7F22, (q15_t)0x0A82,
+    (q15_t)0x00DC, (q15_t)0xF58B, (q15_t)0x7F24, (q15_t)0x0A75, (q15_t)0x00DA, (q15_t)0xF597, (q15_t)0x7F26, (q15_t)0x0A69,
+    (q15_t)0x00D8, (q15_t)0xF5A4, (q15_t)0x7F28, (q15_t)0x0A5C, (q15_t)0x00D6, (q15_t)0xF5B0, (q15_t)0x7F2A, (q15_t)0x0A50,
+    (q15_t)0x00D4, (q15_t)0xF5BC, (q15_t)0x7F2C, (q15_t)0x0A44, (q15_t)0x00D2, (q15_t)0xF5C9, (q15_t)0x7F2E, (q15_t)0x0A37,
+    (q15_t)0x00D0, (q15_t)0xF5D5, (q15_t)0x7F30, (q15_t)0x0A2B, (q15_t)0x00CE, (q15_t)0xF5E2, (q15_t)0x7F32, (q15_t)0x0A1E,
+    (q15_t)0x00CC, (q15_t)0xF5EE, (q15_t)0x7F34, (q15_t)0x0A12, (q15_t)0x00CA, (q15_t)0xF5FA, (q15_t)0x7F36, (q15_t)0x0A06,
+    (q15_t)0x00C8, (q15_t)0xF607, (q15_t)0x7F38, (q15_t)0x09F9, (q15_t)0x00C6, (q15_t)0xF613, (q15_t)0x7F3A, (q15_t)0x09ED,
+    (q15_t)0x00C4, (q15_t)0xF620, (q15_t)0x7F3C, (q15_t)0x09E0, (q15_t)0x00C2, (q15_t)0xF62C, (q15_t)0x7F3E, (q15_t)0x09D4,
+    (q15_t)0x00C0, (q15_t)0xF639, (q15_t)0x7F40, (q15_t)0x09C7, (q15_t)0x00BE, (q15_t)0xF645, (q15_t)0x7F42, (q15_t)0x09BB,
+    (q15_t)0x00BD, (q15_t)0xF651, (q15_t)0x7F43, (q15_t)0x09AF, (q15_t)0x00BB, (q15_t)0xF65E, (q15_t)0x7F45, (q15_t)0x09A2,
+    (q15_t)0x00B9, (q15_t)0xF66A, (q15_t)0x7F47, (q15_t)0x0996, (q15_t)0x00B7, (q15_t)0xF677, (q15_t)0x7F49, (q15_t)0x0989,
+    (q15_t)0x00B5, (q15_t)0xF683, (q15_t)0x7F4B, (q15_t)0x097D, (q15_t)0x00B3, (q15_t)0xF690, (q15_t)0x7F4D, (q15_t)0x0970,
+    (q15_t)0x00B1, (q15_t)0xF69C, (q15_t)0x7F4F, (q15_t)0x0964, (q15_t)0x00AF, (q15_t)0xF6A8, (q15_t)0x7F51, (q15_t)0x0958,
+    (q15_t)0x00AE, (q15_t)0xF6B5, (q15_t)0x7F52, (q15_t)0x094B, (q15_t)0x00AC, (q15_t)0xF6C1, (q15_t)0x7F54, (q15_t)0x093F,
+    (q15_t)0x00AA, (q15_t)0xF6CE, (q15_t)0x7F56, (q15_t)0x0932, (q15_t)0x00A8, (q15_t)0xF6DA, (q15_t)0x7F58, (q15_t)0x0926,
+    (q15_t)0x00A6, (q15_t)0xF6E7, (q15_t)0x7F5A, (q15_t)0x0919, (q15_t)0x00A5, (q15_t)0xF6F3, (q15_t)0x7F5B, (q15_t)0x090D,
+    (q15_t)0x00A3, (q15_t)0xF6FF, (q15_t)0x7F5D, (q15_t)0x0901, (q15_t)0x00A1, (q15_t)0xF70C, (q15_t)0x7F5F, (q15_t)0x08F4,
+    (q15_t)0x009F, (q15_t)0xF718, (q15_t)0x7F61, (q15_t)0x08E8, (q15_t)0x009E, (q15_t)0xF725, (q15_t)0x7F62, (q15_t)0x08DB,
+    (q15_t)0x009C, (q15_t)0xF731, (q15_t)0x7F64, (q15_t)0x08CF, (q15_t)0x009A, (q15_t)0xF73E, (q15_t)0x7F66, (q15_t)0x08C2,
+    (q15_t)0x0098, (q15_t)0xF74A, (q15_t)0x7F68, (q15_t)0x08B6, (q15_t)0x0097, (q15_t)0xF757, (q15_t)0x7F69, (q15_t)0x08A9,
+    (q15_t)0x0095, (q15_t)0xF763, (q15_t)0x7F6B, (q15_t)0x089D, (q15_t)0x0093, (q15_t)0xF76F, (q15_t)0x7F6D, (q15_t)0x0891,
+    (q15_t)0x0092, (q15_t)0xF77C, (q15_t)0x7F6E, (q15_t)0x0884, (q15_t)0x0090, (q15_t)0xF788, (q15_t)0x7F70, (q15_t)0x0878,
+    (q15_t)0x008E, (q15_t)0xF795, (q15_t)0x7F72, (q15_t)0x086B, (q15_t)0x008D, (q15_t)0xF7A1, (q15_t)0x7F73, (q15_t)0x085F,
+    (q15_t)0x008B, (q15_t)0xF7AE, (q15_t)0x7F75, (q15_t)0x0852, (q15_t)0x0089, (q15_t)0xF7BA, (q15_t)0x7F77, (q15_t)0x0846,
+    (q15_t)0x0088, (q15_t)0xF7C7, (q15_t)0x7F78, (q15_t)0x0839, (q15_t)0x0086, (q15_t)0xF7D3, (q15_t)0x7F7A, (q15_t)0x082D,
+    (q15_t)0x0085, (q15_t)0xF7E0, (q15_t)0x7F7B, (q15_t)0x0820, (q15_t)0x0083, (q15_t)0xF7EC, (q15_t)0x7F7D, (q15_t)0x0814,
+    (q15_t)0x0081, (q15_t)0xF7F9, (q15_t)0x7F7F, (q15_t)0x0807, (q15_t)0x0080, (q15_t)0xF805, (q15_t)0x7F80, (q15_t)0x07FB,
+    (q15_t)0x007E, (q15_t)0xF811, (q15_t)0x7F82, (q15_t)0x07EF, (q15_t)0x007D, (q15_t)0xF81E, (q15_t)0x7F83, (q15_t)0x07E2,
+    (q15_t)0x007B, (q15_t)0xF82A, (q15_t)0x7F85, (q15_t)0x07D6, (q15_t)0x007A, (q15_t)0xF837, (q15_t)0x7F86, (q15_t)0x07C9,
+    (q15_t)0x0078, (q15_t)0xF843, (q15_t)0x7F88, (q15_t)0x07BD, (q15_t)0x0077, (q15_t)0xF850, (q15_t)0x7F89, (q15_t)0x07B0,
+    (q15_t)0x0075, (q15_t)0xF85C, (q15_t)0x7F8B, (q15_t)0x07A4, (q15_t)0x0074, (q15_t)0xF869, (q15_t)0x7F8C, (q15_t)0x0797,
+    (q15_t)0x0072, (q15_t)0xF875, (q15_t)0x7F8E, (q15_t)0x078B, (q15_t)0x0071, (q15_t)0xF882, (q15_t)0x7F8F, (q15_t)0x077E,
+    (q15_t)0x006F, (q15_t)0xF88E, (q15_t)0x7F91, (q15_t)0x0772, (q15_t)0x006E, (q15_t)0xF89B, (q15_t)0x7F92, (q15_t)0x0765,
+    (q15_t)0x006C, (q15_t)0xF8A7, (q15_t)0x7F94, (q15_t)0x0759, (q15_t)0x006B, (q15_t)0xF8B4, (q15_t)0x7F95, (q15_t)0x074C,
+    (q15_t)0x0069, (q15_t)0xF8C0, (q15_t)0x7F97, (q15_t)0x0740, (q15_t)0x0068, (q15_t)0xF8CD, (q15_t)0x7F98, (q15_t)0x0733,
+    (q15_t)0x0067, (q15_t)0xF8D9, (q15_t)0x7F99, (q15_t)0x0727, (q15_t)0x0065, (q15_t)0xF8E6, (q15_t)0x7F9B, (q15_t)0x071A,
+    (q15_t)0x0064, (q15_t)0xF8F2, (q15_t)0x7F9C, (q15_t)0x070E, (q15_t)0x0062, (q15_t)0xF8FF, (q15_t)0x7F9E, (q15_t)0x0701,
+    (q15_t)0x0061, (q15_t)0xF90B, (q15_t)0x7F9F, (q15_t)0x06F5, (q15_t)0x0060, (q15_t)0xF918, (q15_t)0x7FA0, (q15_t)0x06E8,
+    (q15_t)0x005E, (q15_t)0xF924, (q15_t)0x7FA2, (q15_t)0x06DC, (q15_t)0x005D, (q15_t)0xF931, (q15_t)0x7FA3, (q15_t)0x06CF,
+    (q15_t)0x005C, (q15_t)0xF93D, (q15_t)0x7FA4, (q15_t)0x06C3, (q15_t)0x005A, (q15_t)0xF94A, (q15_t)0x7FA6, (q15_t)0x06B6,
+    (q15_t)0x0059, (q15_t)0xF956, (q15_t)0x7FA7, (q15_t)0x06AA, (q15_t)0x0058, (q15_t)0xF963, (q15_t)0x7FA8, (q15_t)0x069D,
+    (q15_t)0x0056, (q15_t)0xF96F, (q15_t)0x7FAA, (q15_t)0x0691, (q15_t)0x0055, (q15_t)0xF97C, (q15_t)0x7FAB, (q15_t)0x0684,
+    (q15_t)0x0054, (q15_t)0xF988, (q15_t)0x7FAC, (q15_t)0x0678, (q15_t)0x0053, (q15_t)0xF995, (q15_t)0x7FAD, (q15_t)0x066B,
+    (q15_t)0x0051, (q15_t)0xF9A1, (q15_t)0x7FAF, (q15_t)0x065F, (q15_t)0x0050, (q15_t)0xF9AE, (q15_t)0x7FB0, (q15_t)0x0652,
+    (q15_t)0x004F, (q15_t)0xF9BA, (q15_t)0x7FB1, (q15_t)0x0646, (q15_t)0x004E, (q15_t)0xF9C7, (q15_t)0x7FB2, (q15_t)0x0639,
+    (q15_t)0x004C, (q15_t)0xF9D3, (q15_t)0x7FB4, (q15_t)0x062D, (q15_t)0x004B, (q15_t)0xF9E0, (q15_t)0x7FB5, (q15_t)0x0620,
+    (q15_t)0x004A, (q15_t)0xF9EC, (q15_t)0x7FB6, (q15_t)0x0614, (q15_t)0x0049, (q15_t)0xF9F9, (q15_t)0x7FB7, (q15_t)0x0607,
+    (q15_t)0x0048, (q15_t)0xFA05, (q15_t)0x7FB8, (q15_t)0x05FB, (q15_t)0x0047, (q15_t)0xFA12, (q15_t)0x7FB9, (q15_t)0x05EE,
+    (q15_t)0x0045, (q15_t)0xFA1E, (q15_t)0x7FBB, (q15_t)0x05E2, (q15_t)0x0044, (q15_t)0xFA2B, (q15_t)0x7FBC, (q15_t)0x05D5,
+    (q15_t)0x0043, (q15_t)0xFA37, (q15_t)0x7FBD, (q15_t)0x05C9, (q15_t)0x0042, (q15_t)0xFA44, (q15_t)0x7FBE, (q15_t)0x05BC,
+    (q15_t)0x0041, (q15_t)0xFA50, (q15_t)0x7FBF, (q15_t)0x05B0, (q15_t)0x0040, (q15_t)0xFA5D, (q15_t)0x7FC0, (q15_t)0x05A3,
+    (q15_t)0x003F, (q15_t)0xFA69, (q15_t)0x7FC1, (q15_t)0x0597, (q15_t)0x003D, (q15_t)0xFA76, (q15_t)0x7FC3, (q15_t)0x058A,
+    (q15_t)0x003C, (q15_t)0xFA82, (q15_t)0x7FC4, (q15_t)0x057E, (q15_t)0x003B, (q15_t)0xFA8F, (q15_t)0x7FC5, (q15_t)0x0571,
+    (q15_t)0x003A, (q15_t)0xFA9B, (q15_t)0x7FC6, (q15_t)0x0565, (q15_t)0x0039, (q15_t)0xFAA8, (q15_t)0x7FC7, (q15_t)0x0558,
+    (q15_t)0x0038, (q15_t)0xFAB4, (q15_t)0x7FC8, (q15_t)0x054C, (q15_t)0x0037, (q15_t)0xFAC1, (q15_t)0x7FC9, (q15_t)0x053F,
+    (q15_t)0x0036, (q15_t)0xFACD, (q15_t)0x7FCA, (q15_t)0x0533, (q15_t)0x0035, (q15_t)0xFADA, (q15_t)0x7FCB, (q15_t)0x0526,
+    (q15_t)0x0034, (q15_t)0xFAE6, (q15_t)0x7FCC, (q15_t)0x051A, (q15_t)0x0033, (q15_t)0xFAF3, (q15_t)0x7FCD, (q15_t)0x050D,
+    (q15_t)0x0032, (q15_t)0xFB00, (q15_t)0x7FCE, (q15_t)0x0500, (q15_t)0x0031, (q15_t)0xFB0C, (q15_t)0x7FCF, (q15_t)0x04F4,
+    (q15_t)0x0030, (q15_t)0xFB19, (q15_t)0x7FD0, (q15_t)0x04E7, (q15_t)0x002F, (q15_t)0xFB25, (q15_t)0x7FD1, (q15_t)0x04DB,
+    (q15_t)0x002E, (q15_t)0xFB32, (q15_t)0x7FD2, (q15_t)0x04CE, (q15_t)0x002D, (q15_t)0xFB3E, (q15_t)0x7FD3, (q15_t)0x04C2,
+    (q15_t)0x002C, (q15_t)0xFB4B, (q15_t)0x7FD4, (q15_t)0x04B5, (q15_t)0x002B, (q15_t)0xFB57, (q15_t)0x7FD5, (q15_t)0x04A9,
+    (q15_t)0x002B, (q15_t)0xFB64, (q15_t)0x7FD5, (q15_t)0x049C, (q15_t)0x002A, (q15_t)0xFB70, (q15_t)0x7FD6, (q15_t)0x0490,
+    (q15_t)0x0029, (q15_t)0xFB7D, (q15_t)0x7FD7, (q15_t)0x0483, (q15_t)0x0028, (q15_t)0xFB89, (q15_t)0x7FD8, (q15_t)0x0477,
+    (q15_t)0x0027, (q15_t)0xFB96, (q15_t)0x7FD9, (q15_t)0x046A, (q15_t)0x0026, (q15_t)0xFBA2, (q15_t)0x7FDA, (q15_t)0x045E,
+    (q15_t)0x0025, (q15_t)0xFBAF, (q15_t)0x7FDB, (q15_t)0x0451, (q15_t)0x0024, (q15_t)0xFBBC, (q15_t)0x7FDC, (q15_t)0x0444,
+    (q15_t)0x0024, (q15_t)0xFBC8, (q15_t)0x7FDC, (q15_t)0x0438, (q15_t)0x0023, (q15_t)0xFBD5, (q15_t)0x7FDD, (q15_t)0x042B,
+    (q15_t)0x0022, (q15_t)0xFBE1, (q15_t)0x7FDE, (q15_t)0x041F, (q15_t)0x0021, (q15_t)0xFBEE, (q15_t)0x7FDF, (q15_t)0x0412,
+    (q15_t)0x0020, (q15_t)0xFBFA, (q15_t)0x7FE0, (q15_t)0x0406, (q15_t)0x0020, (q15_t)0xFC07, (q15_t)0x7FE0, (q15_t)0x03F9,
+    (q15_t)0x001F, (q15_t)0xFC13, (q15_t)0x7FE1, (q15_t)0x03ED, (q15_t)0x001E, (q15_t)0xFC20, (q15_t)0x7FE2, (q15_t)0x03E0,
+    (q15_t)0x001D, (q15_t)0xFC2C, (q15_t)0x7FE3, (q15_t)0x03D4, (q15_t)0x001D, (q15_t)0xFC39, (q15_t)0x7FE3, (q15_t)0x03C7,
+    (q15_t)0x001C, (q15_t)0xFC45, (q15_t)0x7FE4, (q15_t)0x03BB, (q15_t)0x001B, (q15_t)0xFC52, (q15_t)0x7FE5, (q15_t)0x03AE,
+    (q15_t)0x001A, (q15_t)0xFC5F, (q15_t)0x7FE6, (q15_t)0x03A1, (q15_t)0x001A, (q15_t)0xFC6B, (q15_t)0x7FE6, (q15_t)0x0395,
+    (q15_t)0x0019, (q15_t)0xFC78, (q15_t)0x7FE7, (q15_t)0x0388, (q15_t)0x0018, (q15_t)0xFC84, (q15_t)0x7FE8, (q15_t)0x037C,
+    (q15_t)0x0018, (q15_t)0xFC91, (q15_t)0x7FE8, (q15_t)0x036F, (q15_t)0x0017, (q15_t)0xFC9D, (q15_t)0x7FE9, (q15_t)0x0363,
+    (q15_t)0x0016, (q15_t)0xFCAA, (q15_t)0x7FEA, (q15_t)0x0356, (q15_t)0x0016, (q15_t)0xFCB6, (q15_t)0x7FEA, (q15_t)0x034A,
+    (q15_t)0x0015, (q15_t)0xFCC3, (q15_t)0x7FEB, (q15_t)0x033D, (q15_t)0x0014, (q15_t)0xFCD0, (q15_t)0x7FEC, (q15_t)0x0330,
+    (q15_t)0x0014, (q15_t)0xFCDC, (q15_t)0x7FEC, (q15_t)0x0324, (q15_t)0x0013, (q15_t)0xFCE9, (q15_t)0x7FED, (q15_t)0x0317,
+    (q15_t)0x0013, (q15_t)0xFCF5, (q15_t)0x7FED, (q15_t)0x030B, (q15_t)0x0012, (q15_t)0xFD02, (q15_t)0x7FEE, (q15_t)0x02FE,
+    (q15_t)0x0011, (q15_t)0xFD0E, (q15_t)0x7FEF, (q15_t)0x02F2, (q15_t)0x0011, (q15_t)0xFD1B, (q15_t)0x7FEF, (q15_t)0x02E5,
+    (q15_t)0x0010, (q15_t)0xFD27, (q15_t)0x7FF0, (q15_t)0x02D9, (q15_t)0x0010, (q15_t)0xFD34, (q15_t)0x7FF0, (q15_t)0x02CC,
+    (q15_t)0x000F, (q15_t)0xFD40, (q15_t)0x7FF1, (q15_t)0x02C0, (q15_t)0x000F, (q15_t)0xFD4D, (q15_t)0x7FF1, (q15_t)0x02B3,
+    (q15_t)0x000E, (q15_t)0xFD5A, (q15_t)0x7FF2, (q15_t)0x02A6, (q15_t)0x000E, (q15_t)0xFD66, (q15_t)0x7FF2, (q15_t)0x029A,
+    (q15_t)0x000D, (q15_t)0xFD73, (q15_t)0x7FF3, (q15_t)0x028D, (q15_t)0x000D, (q15_t)0xFD7F, (q15_t)0x7FF3, (q15_t)0x0281,
+    (q15_t)0x000C, (q15_t)0xFD8C, (q15_t)0x7FF4, (q15_t)0x0274, (q15_t)0x000C, (q15_t)0xFD98, (q15_t)0x7FF4, (q15_t)0x0268,
+    (q15_t)0x000B, (q15_t)0xFDA5, (q15_t)0x7FF5, (q15_t)0x025B, (q15_t)0x000B, (q15_t)0xFDB2, (q15_t)0x7FF5, (q15_t)0x024E,
+    (q15_t)0x000A, (q15_t)0xFDBE, (q15_t)0x7FF6, (q15_t)0x0242, (q15_t)0x000A, (q15_t)0xFDCB, (q15_t)0x7FF6, (q15_t)0x0235,
+    (q15_t)0x0009, (q15_t)0xFDD7, (q15_t)0x7FF7, (q15_t)0x0229, (q15_t)0x0009, (q15_t)0xFDE4, (q15_t)0x7FF7, (q15_t)0x021C,
+    (q15_t)0x0009, (q15_t)0xFDF0, (q15_t)0x7FF7, (q15_t)0x0210, (q15_t)0x0008, (q15_t)0xFDFD, (q15_t)0x7FF8, (q15_t)0x0203,
+    (q15_t)0x0008, (q15_t)0xFE09, (q15_t)0x7FF8, (q15_t)0x01F7, (q15_t)0x0007, (q15_t)0xFE16, (q15_t)0x7FF9, (q15_t)0x01EA,
+    (q15_t)0x0007, (q15_t)0xFE23, (q15_t)0x7FF9, (q15_t)0x01DD, (q15_t)0x0007, (q15_t)0xFE2F, (q15_t)0x7FF9, (q15_t)0x01D1,
+    (q15_t)0x0006, (q15_t)0xFE3C, (q15_t)0x7FFA, (q15_t)0x01C4, (q15_t)0x0006, (q15_t)0xFE48, (q15_t)0x7FFA, (q15_t)0x01B8,
+    (q15_t)0x0006, (q15_t)0xFE55, (q15_t)0x7FFA, (q15_t)0x01AB, (q15_t)0x0005, (q15_t)0xFE61, (q15_t)0x7FFB, (q15_t)0x019F,
+    (q15_t)0x0005, (q15_t)0xFE6E, (q15_t)0x7FFB, (q15_t)0x0192, (q15_t)0x0005, (q15_t)0xFE7A, (q15_t)0x7FFB, (q15_t)0x0186,
+    (q15_t)0x0004, (q15_t)0xFE87, (q15_t)0x7FFC, (q15_t)0x0179, (q15_t)0x0004, (q15_t)0xFE94, (q15_t)0x7FFC, (q15_t)0x016C,
+    (q15_t)0x0004, (q15_t)0xFEA0, (q15_t)0x7FFC, (q15_t)0x0160, (q15_t)0x0004, (q15_t)0xFEAD, (q15_t)0x7FFC, (q15_t)0x0153,
+    (q15_t)0x0003, (q15_t)0xFEB9, (q15_t)0x7FFD, (q15_t)0x0147, (q15_t)0x0003, (q15_t)0xFEC6, (q15_t)0x7FFD, (q15_t)0x013A,
+    (q15_t)0x0003, (q15_t)0xFED2, (q15_t)0x7FFD, (q15_t)0x012E, (q15_t)0x0003, (q15_t)0xFEDF, (q15_t)0x7FFD, (q15_t)0x0121,
+    (q15_t)0x0002, (q15_t)0xFEEC, (q15_t)0x7FFE, (q15_t)0x0114, (q15_t)0x0002, (q15_t)0xFEF8, (q15_t)0x7FFE, (q15_t)0x0108,
+    (q15_t)0x0002, (q15_t)0xFF05, (q15_t)0x7FFE, (q15_t)0x00FB, (q15_t)0x0002, (q15_t)0xFF11, (q15_t)0x7FFE, (q15_t)0x00EF,
+    (q15_t)0x0002, (q15_t)0xFF1E, (q15_t)0x7FFE, (q15_t)0x00E2, (q15_t)0x0001, (q15_t)0xFF2A, (q15_t)0x7FFF, (q15_t)0x00D6,
+    (q15_t)0x0001, (q15_t)0xFF37, (q15_t)0x7FFF, (q15_t)0x00C9, (q15_t)0x0001, (q15_t)0xFF44, (q15_t)0x7FFF, (q15_t)0x00BC,
+    (q15_t)0x0001, (q15_t)0xFF50, (q15_t)0x7FFF, (q15_t)0x00B0, (q15_t)0x0001, (q15_t)0xFF5D, (q15_t)0x7FFF, (q15_t)0x00A3,
+    (q15_t)0x0001, (q15_t)0xFF69, (q15_t)0x7FFF, (q15_t)0x0097, (q15_t)0x0001, (q15_t)0xFF76, (q15_t)0x7FFF, (q15_t)0x008A,
+    (q15_t)0x0000, (q15_t)0xFF82, (q15_t)0x7FFF, (q15_t)0x007E, (q15_t)0x0000, (q15_t)0xFF8F, (q15_t)0x7FFF, (q15_t)0x0071,
+    (q15_t)0x0000, (q15_t)0xFF9B, (q15_t)0x7FFF, (q15_t)0x0065, (q15_t)0x0000, (q15_t)0xFFA8, (q15_t)0x7FFF, (q15_t)0x0058,
+    (q15_t)0x0000, (q15_t)0xFFB5, (q15_t)0x7FFF, (q15_t)0x004B, (q15_t)0x0000, (q15_t)0xFFC1, (q15_t)0x7FFF, (q15_t)0x003F,
+    (q15_t)0x0000, (q15_t)0xFFCE, (q15_t)0x7FFF, (q15_t)0x0032, (q15_t)0x0000, (q15_t)0xFFDA, (q15_t)0x7FFF, (q15_t)0x0026,
+    (q15_t)0x0000, (q15_t)0xFFE7, (q15_t)0x7FFF, (q15_t)0x0019, (q15_t)0x0000, (q15_t)0xFFF3, (q15_t)0x7FFF, (q15_t)0x000D,
+    (q15_t)0x0000, (q15_t)0x0000, (q15_t)0x7FFF, (q15_t)0x0000
+};
+
+#endif /* RFFT_Q15_SPLIT_TABLES */
+
+#if defined(RFFT_Q15_CONST_WINDOWS)
+
+/* ========================================================================= */
+/* Window Tables                                                             */
+/* ========================================================================= */
+
+/*
+ * First halves, w[k] for k = 0..n/2, of the periodic windows of
+ * fft_context_set_window(), computed from the shared table as it does.
+ */
+
+/* Table of a window and length, NULL for those not generated */
+const q15_t *rfft_q15_window_table(uint32_t window, uint32_t fft_len)
+{
+    (void)window;
+    (void)fft_len;
+    return NULL;
+}
+
+#endif /* RFFT_Q15_CONST_WINDOWS */
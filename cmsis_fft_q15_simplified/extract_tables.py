@@ -1,12 +1,52 @@
 #!/usr/bin/env python3
 """
 Extract twiddle factor tables from CMSIS-DSP library
+
+Superseded by gen_tables.py: src/twiddle_tables.c now holds one shared
+table sized by RFFT_Q15_MAX_FFT_LEN and is generated, not extracted.
+
+--q31-reference writes the CMSIS-DSP Q31 CFFT and RFFT tables with a ref_
+prefix instead, for test/test_rfft_q31.c to check the generated Q31 tables
+and the Q31 RFFT against them:
+
+    python3 extract_tables.py --input ../cmsis_fft_q15/arm_common_tables.c \
+        --q31-reference build/q31/reference_tables_q31.c
+
+--q15-reference does the same for the per-length Q15 CFFT tables, which
+test/test_fft_sizes.c checks are strides of the one shared table.
 """
 
+import argparse
 import re
 import sys
 
-def extract_table(input_file, table_name, output_lines):
+Q31_REFERENCE_TABLES = [
+    'twiddleCoef_16_q31',
+    'twiddleCoef_32_q31',
+    'twiddleCoef_64_q31',
+    'twiddleCoef_128_q31',
+    'twiddleCoef_256_q31',
+    'twiddleCoef_512_q31',
+    'twiddleCoef_1024_q31',
+    'twiddleCoef_2048_q31',
+    'twiddleCoef_4096_q31',
+    'realCoefAQ31',
+    'realCoefBQ31'
+]
+
+Q15_REFERENCE_TABLES = [
+    'twiddleCoef_16_q15',
+    'twiddleCoef_32_q15',
+    'twiddleCoef_64_q15',
+    'twiddleCoef_128_q15',
+    'twiddleCoef_256_q15',
+    'twiddleCoef_512_q15',
+    'twiddleCoef_1024_q15',
+    'twiddleCoef_2048_q15',
+    'twiddleCoef_4096_q15'
+]
+
+def extract_table(input_file, table_name, output_lines, prefix=''):
     """Extract a specific table from the input file"""
     with open(input_file, 'r') as f:
         content = f.read()
@@ -27,6 +67,7 @@ def extract_table(input_file, table_name, output_lines):
         declaration = decl_match.group(1).strip()
         # Remove __ALIGNED attribute
         declaration = re.sub(r'__ALIGNED\(\d+\)\s+', '', declaration)
+        declaration = declaration.replace(table_name, prefix + table_name)
         output_lines.append(f"{declaration} =\n{{\n")
         
         # Get the table data
@@ -37,9 +78,53 @@ def extract_table(input_file, table_name, output_lines):
     
     return False
 
+def extract_reference(input_file, output_file, tables, option, kind, c_type):
+    """CMSIS-DSP tables renamed ref_<table>"""
+    output_lines = [f"""/*
+ * CMSIS-DSP {kind} tables, extracted by extract_tables.py
+ * {option}, do not edit
+ *
+ * Copyright (C) 2010-2021 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdint.h>
+
+typedef {c_type};
+
+"""]
+
+    for table in tables:
+        if not extract_table(input_file, table, output_lines, 'ref_'):
+            print(f"Failed to extract {table}", file=sys.stderr)
+            return 1
+
+    with open(output_file, 'w') as f:
+        f.writelines(output_lines)
+
+    return 0
+
 def main():
-    input_file = 'cmsis_fft_q15/arm_common_tables.c'
-    output_file = 'cmsis_fft_q15_simplified/src/twiddle_tables.c'
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument('--input', default='cmsis_fft_q15/arm_common_tables.c',
+                        help='CMSIS-DSP arm_common_tables.c')
+    parser.add_argument('--q31-reference', metavar='OUTPUT',
+                        help='write the ref_ prefixed Q31 tables to OUTPUT')
+    parser.add_argument('--q15-reference', metavar='OUTPUT',
+                        help='write the ref_ prefixed Q15 CFFT tables to OUTPUT')
+    args = parser.parse_args()
+
+    if args.q31_reference:
+        return extract_reference(args.input, args.q31_reference, Q31_REFERENCE_TABLES,
+                                 '--q31-reference', 'Q31 CFFT and RFFT', 'int32_t q31_t')
+
+    if args.q15_reference:
+        return extract_reference(args.input, args.q15_reference, Q15_REFERENCE_TABLES,
+                                 '--q15-reference', 'Q15 CFFT', 'int16_t q15_t')
+
+    input_file = args.input
+    output_file = 'cmsis_fft_q15_simplified/build/twiddle_tables.c'
     
     output_lines = []
     
@@ -0,0 +1,197 @@
+#!/usr/bin/env python3
+"""
+Generate cfft_fixed_q15.inc, the fixed-length packed CFFT kernels.
+
+arm_radix4_butterfly_q15_packed() and arm_cfft_radix4by2_q15_packed() in
+cfft_radix4_q15.c loop over their stages with the length, the butterfly
+spans and the twiddle modifiers in variables. With RFFT_Q15_FIXED_KERNELS
+they hand the CFFTs behind min_len to max_len point RFFTs to one kernel
+each from this file instead, which calls the inlined stages of
+cfft_radix4_q15.c with all of them as constants, so every loop bound,
+stride and twiddle offset is known to the compiler. The last stage of the
+short transforms is written out butterfly by butterfly, for both the
+in-place and the natural order output.
+
+    python3 gen_kernels.py --min-len 4096 --max-len 8192 -o cfft_fixed_q15.inc
+
+The file is included by cfft_radix4_q15.c and does not build on its own.
+"""
+
+import argparse
+import sys
+
+MIN_LEN = 32
+MAX_LEN = 8192
+
+# Longest CFFT whose last stage is unrolled completely, 16 butterflies
+UNROLL_LAST = 64
+
+
+def bitrev_next(r, top):
+    """rfft_bitrev_next() of rfft_q15_simplified.h"""
+    while r & top:
+        r ^= top
+        top >>= 1
+    return r | top
+
+
+def last_stage(n, shift):
+    """pk_stage_last() of n points, one butterfly per line"""
+    half, quarter = n // 2, n // 4
+    out = ['  if (pDst == NULL)\n  {\n']
+    for i in range(0, n, 4):
+        out.append(f'    pk_butterfly_last(pSrc[{i}], pSrc[{i + 1}], pSrc[{i + 2}], pSrc[{i + 3}],\n'
+                   f'                      &pSrc[{i}], &pSrc[{i + 1}], &pSrc[{i + 2}], &pSrc[{i + 3}], {shift}U);\n')
+    out.append('  }\n  else\n  {\n')
+    r = 0
+    for i in range(0, n, 4):
+        out.append(f'    pk_butterfly_last(pSrc[{i}], pSrc[{i + 1}], pSrc[{i + 2}], pSrc[{i + 3}],\n'
+                   f'                      &pDst[{r}], &pDst[{r + half}], &pDst[{r + quarter}], '
+                   f'&pDst[{r + half + quarter}], {shift}U);\n')
+        r = bitrev_next(r, n >> 3)
+    out.append('  }\n')
+    return ''.join(out)
+
+
+def middle_spans(n):
+    """n1 of the middle stages of an n point radix-4 transform"""
+    spans = []
+    n1 = n // 4
+    while n1 > 4:
+        spans.append(n1)
+        n1 //= 4
+    return spans
+
+
+def kernel(n):
+    """pk_fixed_<n>(), the stages of arm_radix4_butterfly_q15_packed() or
+    arm_cfft_radix4by2_q15_packed() for n points"""
+    by2 = (n.bit_length() - 1) % 2 == 1
+    out = []
+
+    if by2:
+        half = n // 2
+        out.append(f'''
+/* {n} points: radix-2 step, then two radix-4 transforms of {half} points */
+RFFT_Q15_HOT static void pk_fixed_{n}(q31_t * pSrc, const q15_t * pCoef16, q31_t * pDst)
+{{
+  pk_stage_first_by2(pSrc, {n}U, pCoef16);
+  RFFT_PROFILE_BUTTERFLY_FROM(0U);
+  RFFT_PROFILE_MARK_BUTTERFLY();
+''')
+        modifier = 8
+        for n1 in middle_spans(half):
+            out.append(f'''
+  pk_stage_middle(pSrc, {half}U, {n1}U, pCoef16, {modifier}U * RFFT_TWIDDLE_STRIDE({n}U));
+  pk_stage_middle(pSrc + {half}U, {half}U, {n1}U, pCoef16, {modifier}U * RFFT_TWIDDLE_STRIDE({n}U));
+  RFFT_PROFILE_MARK_BUTTERFLY();
+''')
+            modifier *= 4
+        shift = 1
+    else:
+        out.append(f'''
+/* {n} points: radix-4 */
+RFFT_Q15_HOT static void pk_fixed_{n}(q31_t * pSrc, const q15_t * pCoef16, q31_t * pDst)
+{{
+  pk_stage_first(pSrc, {n}U, pCoef16, RFFT_TWIDDLE_STRIDE({n}U));
+  RFFT_PROFILE_BUTTERFLY_FROM(0U);
+  RFFT_PROFILE_MARK_BUTTERFLY();
+''')
+        modifier = 4
+        for n1 in middle_spans(n):
+            out.append(f'''
+  pk_stage_middle(pSrc, {n}U, {n1}U, pCoef16, {modifier}U * RFFT_TWIDDLE_STRIDE({n}U));
+  RFFT_PROFILE_MARK_BUTTERFLY();
+''')
+            modifier *= 4
+        shift = 0
+
+    out.append('\n')
+    if n <= UNROLL_LAST:
+        out.append(last_stage(n, shift))
+    else:
+        out.append(f'  pk_stage_last(pSrc, pDst, {n}U, {shift}U);\n')
+    out.append('  RFFT_PROFILE_MARK_BUTTERFLY();\n}\n')
+    return ''.join(out)
+
+
+def generate(args):
+    lengths = []
+    n = args.min_len // 2
+    while n <= args.max_len // 2:
+        lengths.append(n)
+        n *= 2
+
+    if args.min_len == args.max_len:
+        sizes = '%d point RFFTs' % args.max_len
+    else:
+        sizes = '%d to %d point RFFTs' % (args.min_len, args.max_len)
+
+    out = [f'''/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library - Simplified Q15 FFT
+ * Title:        cfft_fixed_q15.inc
+ * Description:  Fixed-length packed CFFT kernels for {sizes}
+ *               Generated by gen_kernels.py, do not edit
+ *
+ * Target Processor: RISC-V RV32EMC
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2021 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#if RFFT_Q15_MIN_FFT_LEN != {args.min_len} || RFFT_Q15_MAX_FFT_LEN != {args.max_len}
+#error "cfft_fixed_q15.inc was generated for other RFFT lengths, see gen_kernels.py"
+#endif
+''']
+
+    for n in lengths:
+        out.append(kernel(n))
+
+    out.append('''
+static inline pk_fixed_fn pk_fixed_kernel(uint32_t fftLen)
+{
+  switch (fftLen)
+  {
+''')
+    for n in lengths:
+        out.append(f'  case {n}U:\n    return pk_fixed_{n};\n')
+    out.append('''  default:
+    return NULL;
+  }
+}
+''')
+    return ''.join(out)
+
+
+def power_of_two(value):
+    n = int(value, 0)
+    if n < MIN_LEN or n > MAX_LEN or n & (n - 1):
+        raise argparse.ArgumentTypeError(
+            f'{value} is not a power of two from {MIN_LEN} to {MAX_LEN}')
+    return n
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument('--min-len', type=power_of_two, default=4096,
+                        help='smallest RFFT length (default: 4096)')
+    parser.add_argument('--max-len', type=power_of_two, default=8192,
+                        help='largest RFFT length (default: 8192)')
+    parser.add_argument('-o', '--output', help='output file (default: stdout)')
+    args = parser.parse_args()
+
+    if args.min_len > args.max_len:
+        parser.error('--min-len is larger than --max-len')
+
+    text = generate(args)
+    if args.output:
+        with open(args.output, 'w') as f:
+            f.write(text)
+    else:
+        sys.stdout.write(text)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,473 @@
+#!/usr/bin/env python3
+"""
+Generate twiddle_tables.c for a range of RFFT lengths.
+
+All CFFT sizes and the RFFT split step share one twiddle table sampled at
+2*pi/max_len, see RFFT_TWIDDLE_TABLE in rfft_q15.h. The generated file holds
+that table, its quarter-wave RFFT_Q15_COMPACT_TWIDDLES variant, the
+bit reversal tables of the CFFTs behind min_len to max_len point RFFTs,
+the RFFT_Q15_STOCKHAM stage tables of those CFFTs and the
+RFFT_Q15_SPLIT_TABLES split coefficients of those RFFTs.
+Values are those of the CMSIS-DSP tables: floor(32768 * x), saturated.
+
+    python3 gen_tables.py --min-len 4096 --max-len 8192 -o src/twiddle_tables.c
+
+With --windows it also generates the RFFT_Q15_CONST_WINDOWS half tables of
+the listed windows for every length, bit-exact with the tables
+fft_context_set_window() computes from the shared twiddle table.
+
+    python3 gen_tables.py --windows hann,blackman -o src/twiddle_tables.c
+
+With --q31 it generates twiddle_tables_q31.c instead, the CFFT twiddles and
+the split step sine table of the Q31 RFFT, see RFFT_Q31_TWIDDLE_TABLE in
+rfft_q31.h.
+
+    python3 gen_tables.py --q31 --min-len 4096 --max-len 4096 -o twiddle_tables_q31.c
+"""
+
+import argparse
+import math
+import sys
+
+MIN_LEN = 32
+MAX_LEN = 8192
+
+
+def q15_floor(x):
+    """floor(32768 * x), saturated to Q15"""
+    return max(-32768, min(32767, math.floor(32768.0 * x)))
+
+
+def q31_floor(x, bias=0.0):
+    """floor(2^31 * x + bias), saturated to Q31"""
+    return max(-2**31, min(2**31 - 1, math.floor(2.0**31 * x + bias)))
+
+
+def twiddles(n):
+    """cos and sin of 2*pi*k/n for k < 3n/4, interleaved"""
+    values = []
+    for k in range(3 * n // 4):
+        phi = 2.0 * math.pi * k / n
+        values += [q15_floor(math.cos(phi)), q15_floor(math.sin(phi))]
+    return values
+
+
+def quarter_sine(n):
+    """sin(2*pi*k/n) for k = 0..n/4"""
+    return [q15_floor(math.sin(2.0 * math.pi * k / n)) for k in range(n // 4 + 1)]
+
+
+def twiddles_q31(n):
+    """cos and sin of 2*pi*k/n for k < 3n/4 as twiddleCoef_<n>_q31 rounds them"""
+    values = []
+    for k in range(3 * n // 4):
+        phi = 2.0 * math.pi * k / n
+        values += [q31_floor(math.cos(phi), 0.05), q31_floor(math.sin(phi), 0.05)]
+    return values
+
+
+def quarter_sine_q31(n):
+    """floor(2^31 * sin(2*pi*k/n)) for k = 0..n/4"""
+    return [q31_floor(math.sin(2.0 * math.pi * k / n)) for k in range(n // 4 + 1)]
+
+
+def bitrev_table(n):
+    """Swap pairs of arm_bitreversal_16() for an n-point CFFT, 8 * element index"""
+    bits = n.bit_length() - 1
+    values = []
+    for i in range(n):
+        r = int(format(i, f'0{bits}b')[::-1], 2)
+        if i < r:
+            values += [8 * i, 8 * r]
+    return values
+
+
+def stockham_radix4(table, n, sub_len):
+    """(w1, w2, w3) of each butterfly of a radix-4 stage of sub_len points"""
+    values = []
+    for p in range(sub_len // 4):
+        for k in (1, 2, 3):
+            i = k * p * n // sub_len
+            values += table[2 * i:2 * i + 2]
+    return values
+
+
+def stockham_radix2(table, n, cfft_len):
+    """Radix-2 twiddles of a cfft_len-point 4x2 CFFT, in the order of its first stage"""
+    values = []
+    eighth = cfft_len // 8
+    for p in range(eighth):
+        for k in range(4):
+            i = (p + k * eighth) * n // cfft_len
+            values += table[2 * i:2 * i + 2]
+    return values
+
+
+def split_coefs(table, max_len, n):
+    """A and B of bins 0..n/4 of an n-point RFFT, interleaved, as arm_rfft_coef_q15() derives them"""
+    values = []
+    for i in range(n // 4 + 1):
+        k = i * (max_len // n)
+        a0 = 16384 - ((table[2 * k + 1] + 1) >> 1)
+        a1 = (-table[2 * k]) >> 1
+        values += [a0, a1, (32768 - a0) if a0 > 0 else 32767, -a1]
+    return values
+
+
+# fft_window_type_t of each window --windows accepts
+WINDOWS = {'hann': 1, 'hamming': 2, 'blackman': 3}
+
+
+def window_half(table, max_len, n, window):
+    """w[k], k = 0..n/2, as fft_context_set_window() computes it from the shared table"""
+    def cos(k):
+        if k > n // 2:
+            k = n - k
+        return table[2 * k * (max_len // n)]
+
+    values = []
+    for k in range(n // 2 + 1):
+        c1 = cos(k)
+        if window == 'hann':
+            w = (32768 - c1) >> 1
+        elif window == 'hamming':
+            w = 17695 - ((15073 * c1) >> 15)
+        else:
+            w = 13763 - (c1 >> 1) + ((2621 * cos(2 * k)) >> 15)
+        values.append(max(0, min(32767, w)))
+    return values
+
+
+def format_q15(values):
+    lines = []
+    for i in range(0, len(values), 8):
+        lines.append('    ' + ', '.join('(q15_t)0x%04X' % (v & 0xFFFF) for v in values[i:i + 8]))
+    return ',\n'.join(lines) + '\n'
+
+
+def format_q31(values):
+    lines = []
+    for i in range(0, len(values), 4):
+        lines.append('    ' + ', '.join('(q31_t)0x%08X' % (v & 0xFFFFFFFF) for v in values[i:i + 4]))
+    return ',\n'.join(lines) + '\n'
+
+
+def format_bitrev(values):
+    lines = []
+    for i in range(0, len(values), 16):
+        pairs = values[i:i + 16]
+        lines.append('    ' + ', '.join('%d,%d' % (pairs[j], pairs[j + 1])
+                                        for j in range(0, len(pairs), 2)))
+    return ',\n'.join(lines) + '\n'
+
+
+def section(args, name):
+    if not args.section:
+        return ''
+    return ' __attribute__((section("%s.%s")))' % (args.section, name)
+
+
+def generate(args):
+    n = args.max_len
+    out = []
+
+    if args.min_len == args.max_len:
+        sizes = '%d point RFFTs' % n
+    else:
+        sizes = '%d to %d point RFFTs' % (args.min_len, n)
+
+    out.append(f'''/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library - Simplified Q15 FFT
+ * Title:        twiddle_tables.c
+ * Description:  Twiddle factor and bit reversal tables for {sizes}
+ *               Generated by gen_tables.py, do not edit
+ *
+ * Target Processor: ARM Cortex-M33
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2021 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "{args.header}"
+
+#if RFFT_Q15_MIN_FFT_LEN != {args.min_len} || RFFT_Q15_MAX_FFT_LEN != {n}
+#error "twiddle_tables.c was generated for other RFFT lengths, see gen_tables.py"
+#endif
+
+#if !defined(RFFT_Q15_COMPACT_TWIDDLES)
+
+/* ========================================================================= */
+/* Shared Twiddle Table                                                      */
+/* ========================================================================= */
+
+/*
+ * cos and sin of 2*pi*k/{n} for k < {3 * n // 4}, floor(32768 * x) saturated.
+ * Shared by all CFFT sizes and the RFFT split step, see
+ * RFFT_TWIDDLE_TABLE.
+ */
+''')
+    name = 'twiddleCoef_%d_q15' % n
+    out.append('const q15_t %s[%d] RFFT_Q15_ALIGN%s =\n{\n' % (name, 3 * n // 2, section(args, name)))
+    out.append(format_q15(twiddles(n)))
+    out.append(f'''}};
+
+#else /* RFFT_Q15_COMPACT_TWIDDLES */
+
+/* ========================================================================= */
+/* Quarter-Wave Sine Table                                                   */
+/* ========================================================================= */
+
+/*
+ * floor(32768 * sin(2*pi*k/{n})), saturated, for k = 0..{n // 4}. All CFFT
+ * twiddles and RFFT split coefficients are derived from it, see
+ * RFFT_TWIDDLE_COS() and RFFT_TWIDDLE_SIN().
+ */
+''')
+    name = 'twiddleSinQ15_%d' % n
+    out.append('const q15_t %s[%d] RFFT_Q15_ALIGN%s =\n{\n' % (name, n // 4 + 1, section(args, name)))
+    out.append(format_q15(quarter_sine(n)))
+    out.append('''};
+
+#endif /* RFFT_Q15_COMPACT_TWIDDLES */
+
+/* ========================================================================= */
+/* Bit Reversal Tables                                                       */
+/* ========================================================================= */
+
+#if !defined(RFFT_Q15_NO_BITREV_TABLES)
+''')
+
+    cfft_len = args.min_len // 2
+    while cfft_len <= n // 2:
+        table = bitrev_table(cfft_len)
+        kind = 'radix 4' if (cfft_len.bit_length() - 1) % 2 == 0 else '4x2'
+        name = 'armBitRevIndexTable_fixed_%d' % cfft_len
+        out.append('\nconst uint16_t %s[ARMBITREVINDEXTABLE_FIXED_%d_TABLE_LENGTH]%s =\n{\n'
+                   % (name, cfft_len, section(args, name)))
+        out.append('    /* %s, size %d */\n' % (kind, len(table)))
+        out.append(format_bitrev(table))
+        out.append('};\n')
+        cfft_len *= 2
+    out.append('\n#endif /* !RFFT_Q15_NO_BITREV_TABLES */\n')
+
+    out.append(f'''
+#if defined(RFFT_Q15_STOCKHAM)
+
+/* ========================================================================= */
+/* Stockham Stage Tables                                                     */
+/* ========================================================================= */
+
+/*
+ * The twiddles of RFFT_TWIDDLE_TABLE in the order arm_cfft_q15_stockham()
+ * reads them, so each stage reads its table front to back. Values are
+ * those of the shared table, whatever the twiddle build.
+ */
+''')
+    table = twiddles(n)
+    sub_len = 16
+    while sub_len <= n // 2:
+        values = stockham_radix4(table, n, sub_len)
+        name = 'rfftStockhamQ15_%d' % sub_len
+        out.append('\n/* (w1, w2, w3) per butterfly of the %d-point radix-4 stages */\n' % sub_len)
+        out.append('const q15_t %s[%d] RFFT_Q15_ALIGN%s =\n{\n'
+                   % (name, len(values), section(args, name)))
+        out.append(format_q15(values))
+        out.append('};\n')
+        sub_len *= 4
+
+    cfft_len = args.min_len // 2
+    while cfft_len <= n // 2:
+        if (cfft_len.bit_length() - 1) % 2 == 1:
+            values = stockham_radix2(table, n, cfft_len)
+            name = 'rfftStockhamR2Q15_%d' % cfft_len
+            out.append('\n/* Radix-2 step of the %d-point 4x2 CFFT */\n' % cfft_len)
+            out.append('const q15_t %s[%d] RFFT_Q15_ALIGN%s =\n{\n'
+                       % (name, len(values), section(args, name)))
+            out.append(format_q15(values))
+            out.append('};\n')
+        cfft_len *= 2
+
+    out.append('\n#endif /* RFFT_Q15_STOCKHAM */\n')
+
+    out.append('''
+#if defined(RFFT_Q15_SPLIT_TABLES)
+
+/* ========================================================================= */
+/* Split Coefficient Tables                                                  */
+/* ========================================================================= */
+
+/*
+ * A[0], A[1], B[0], B[1] of bins 0 to n/4 of each RFFT length, derived
+ * from the shared table as arm_rfft_coef_q15() does. The bins above are
+ * mirrored, see pTwiddleBReal.
+ */
+''')
+    size = args.min_len
+    while size <= n:
+        values = split_coefs(table, n, size)
+        name = 'rfftSplitQ15_%d' % size
+        out.append('\n/* %d-point RFFT */\n' % size)
+        out.append('const q15_t %s[%d] RFFT_Q15_ALIGN%s =\n{\n'
+                   % (name, len(values), section(args, name)))
+        out.append(format_q15(values))
+        out.append('};\n')
+        size *= 2
+
+    out.append('\n#endif /* RFFT_Q15_SPLIT_TABLES */\n')
+
+    out.append('''
+#if defined(RFFT_Q15_CONST_WINDOWS)
+
+/* ========================================================================= */
+/* Window Tables                                                             */
+/* ========================================================================= */
+
+/*
+ * First halves, w[k] for k = 0..n/2, of the periodic windows of
+ * fft_context_set_window(), computed from the shared table as it does.
+ */
+''')
+    lookup = []
+    for window in args.windows:
+        tag = window.capitalize()
+        size = args.min_len
+        while size <= n:
+            name = 'rfftWindow%sQ15_%d' % (tag, size)
+            out.append('\n/* %s, %d points */\n' % (tag, size))
+            out.append('const q15_t %s[%d]%s =\n{\n' % (name, size // 2 + 1, section(args, name)))
+            out.append(format_q15(window_half(table, n, size, window)))
+            out.append('};\n')
+            lookup.append('    if (window == %dU && fft_len == %dU) {\n        return %s;\n    }\n'
+                          % (WINDOWS[window], size, name))
+            size *= 2
+
+    out.append('''
+/* Table of a window and length, NULL for those not generated */
+const q15_t *rfft_q15_window_table(uint32_t window, uint32_t fft_len)
+{
+''')
+    if not lookup:
+        out.append('    (void)window;\n    (void)fft_len;\n')
+    out.append(''.join(lookup))
+    out.append('''    return NULL;
+}
+
+#endif /* RFFT_Q15_CONST_WINDOWS */
+''')
+
+    return ''.join(out)
+
+
+def generate_q31(args):
+    n = args.max_len
+    out = []
+
+    if args.min_len == args.max_len:
+        sizes = '%d point Q31 RFFTs' % n
+    else:
+        sizes = '%d to %d point Q31 RFFTs' % (args.min_len, n)
+
+    out.append(f'''/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library - Simplified Q31 FFT
+ * Title:        twiddle_tables_q31.c
+ * Description:  Twiddle factor tables for {sizes}
+ *               Generated by gen_tables.py --q31, do not edit
+ *
+ * Target Processor: nRF54L15 FLPR (RISC-V)
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2021 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "{args.header}"
+
+#if RFFT_Q31_MIN_FFT_LEN != {args.min_len} || RFFT_Q31_MAX_FFT_LEN != {n}
+#error "twiddle_tables_q31.c was generated for other RFFT lengths, see gen_tables.py"
+#endif
+
+/* ========================================================================= */
+/* CFFT Twiddle Table                                                        */
+/* ========================================================================= */
+
+/*
+ * cos and sin of 2*pi*k/{n // 2} for k < {3 * n // 8}, floor(2^31 * x + 0.05)
+ * saturated like twiddleCoef_{n // 2}_q31 of CMSIS-DSP. Shared by all CFFT
+ * sizes, see RFFT_Q31_TWIDDLE_TABLE.
+ */
+''')
+    name = 'twiddleCoef_%d_q31' % (n // 2)
+    out.append('const q31_t %s[%d]%s =\n{\n' % (name, 3 * n // 4, section(args, name)))
+    out.append(format_q31(twiddles_q31(n // 2)))
+    out.append(f'''}};
+
+/* ========================================================================= */
+/* Split Step Sine Table                                                     */
+/* ========================================================================= */
+
+/*
+ * floor(2^31 * sin(2*pi*k/{n})), saturated, for k = 0..{n // 4}. The RFFT
+ * split coefficients of realCoefAQ31 and realCoefBQ31 are derived from it.
+ */
+''')
+    name = 'twiddleSinQ31_%d' % n
+    out.append('const q31_t %s[%d]%s =\n{\n' % (name, n // 4 + 1, section(args, name)))
+    out.append(format_q31(quarter_sine_q31(n)))
+    out.append('};\n')
+
+    return ''.join(out)
+
+
+def power_of_two(value):
+    n = int(value, 0)
+    if n < MIN_LEN or n > MAX_LEN or n & (n - 1):
+        raise argparse.ArgumentTypeError(
+            f'{value} is not a power of two from {MIN_LEN} to {MAX_LEN}')
+    return n
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument('--min-len', type=power_of_two, default=4096,
+                        help='smallest RFFT length (default: 4096)')
+    parser.add_argument('--max-len', type=power_of_two, default=8192,
+                        help='largest RFFT length (default: 8192)')
+    parser.add_argument('--header',
+                        help='header that declares the tables '
+                             '(default: rfft_q15.h, rfft_q31.h with --q31)')
+    parser.add_argument('--q31', action='store_true',
+                        help='generate the tables of the Q31 RFFT')
+    parser.add_argument('--section',
+                        help='place every table in SECTION.<table name>')
+    parser.add_argument('--windows', default='',
+                        help='comma separated windows of RFFT_Q15_CONST_WINDOWS '
+                             '(%s)' % ', '.join(WINDOWS))
+    parser.add_argument('-o', '--output', help='output file (default: stdout)')
+    args = parser.parse_args()
+
+    if args.min_len > args.max_len:
+        parser.error('--min-len is larger than --max-len')
+
+    args.windows = [w for w in args.windows.lower().split(',') if w]
+    for window in args.windows:
+        if window not in WINDOWS:
+            parser.error(f'unknown window {window}')
+
+    if args.q31:
+        args.header = args.header or 'rfft_q31.h'
+        text = generate_q31(args)
+    else:
+        args.header = args.header or 'rfft_q15.h'
+        text = generate(args)
+    if args.output:
+        with open(args.output, 'w') as f:
+            f.write(text)
+    else:
+        sys.stdout.write(text)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,18 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library - Simplified Q31 RFFT
+ * Title:        rfft_q31.h
+ * Description:  Host name of the public header of the Q31 RFFT library
+ *
+ * Target Processor: PC (x86_64) for validation
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2021 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * The library is the one in ../remote/src that both cores build, the
+ * Makefile puts it on the include path. The tests include it by this name.
+ */
+#include "rfft_q31_simplified.h"
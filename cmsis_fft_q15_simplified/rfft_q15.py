@@ -0,0 +1,215 @@
+#!/usr/bin/env python3
+"""
+Python bindings of the Q15 RFFT library, for in-process NumPy testing
+
+The library is the one in ../remote/src, built by `make pylib` into
+build/pylib/librfft_q15.so with every RFFT length from 32 to 8192 and
+find_fft_top_bins(). RFFT_Q15_LIB names another build of it, e.g. that
+of `make pylib BACKEND=dsp-emulated`.
+
+The functions take NumPy int16 arrays, or any other C-contiguous buffer
+of native int16, and hand their memory to the C code without a copy:
+
+    import numpy as np
+    import rfft_q15
+
+    x = (np.random.randn(4096) * 4000).astype(np.int16)
+    out = rfft_q15.rfft(x)                  # 2 * 4096 int16, arm_rfft_q15() layout
+    spectrum = out[0:4098:2] + 1j * out[1:4098:2]
+    top = rfft_q15.top_bins(x, 20)          # find_fft_top_bins()
+
+arm_rfft_q15() scales its output by 1 / n and overwrites its input;
+rfft() keeps the input unless overwrite_input is set. find_fft_top_bins()
+keeps its top N storage in a static, so none of this is thread-safe.
+"""
+
+import array
+import ctypes
+import os
+import sys
+
+try:
+    import numpy as np
+except ImportError:  # The bindings also take array.array('h'), for hosts without NumPy
+    np = None
+
+# Largest num_top_bins of find_fft_top_bins(), FFT_TOP_BINS_MAX of fft_utils.h
+TOP_BINS_MAX = 64
+
+_DEFAULT_LIB = os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                            "build", "pylib", "librfft_q15.so")
+
+_lib = None
+_instances = {}
+
+
+def _load():
+    """Load the shared library once, on first use"""
+    global _lib
+
+    if _lib is not None:
+        return _lib
+
+    path = os.environ.get("RFFT_Q15_LIB", _DEFAULT_LIB)
+    if not os.path.exists(path):
+        raise OSError(f"{path} not found, build it with `make pylib`")
+
+    lib = ctypes.CDLL(path)
+
+    lib.rfft_q15_get_instance.argtypes = [ctypes.c_uint16]
+    lib.rfft_q15_get_instance.restype = ctypes.c_void_p
+    lib.arm_rfft_q15.argtypes = [ctypes.c_void_p, ctypes.c_void_p, ctypes.c_void_p]
+    lib.arm_rfft_q15.restype = None
+    lib.find_fft_top_bins.argtypes = [ctypes.c_void_p, ctypes.c_uint16, ctypes.c_uint16,
+                                      ctypes.c_void_p, ctypes.c_uint16]
+    lib.find_fft_top_bins.restype = ctypes.c_int
+
+    _lib = lib
+    return lib
+
+
+def _instance(n):
+    """Prebuilt arm_rfft_instance_q15 of length n"""
+    if n not in _instances:
+        ptr = _load().rfft_q15_get_instance(n) if 0 < n <= 0xFFFF else None
+        if not ptr:
+            raise ValueError(f"RFFT length {n} is not built in")
+        _instances[n] = ptr
+    return _instances[n]
+
+
+def _samples(buf, fmt="h"):
+    """Flat memoryview of buf, after checking it holds native 16-bit values"""
+    view = memoryview(buf)
+    native = {fmt, "=" + fmt, "@" + fmt, ("<" if sys.byteorder == "little" else ">") + fmt}
+
+    if view.format not in native:
+        raise TypeError(f"buffer of format {view.format!r}, expected {fmt!r}")
+    if not view.c_contiguous:
+        raise TypeError("buffer is not C-contiguous")
+
+    return view.cast("B").cast(fmt)
+
+
+def _address(view):
+    """
+    Address of the memory of a flat view, and what keeps it alive: the
+    memory itself if it is writable, else a copy
+    """
+    if view.readonly:
+        keep = (ctypes.c_char * view.nbytes).from_buffer_copy(view)
+    else:
+        keep = ctypes.c_char.from_buffer(view)
+    return ctypes.addressof(keep), keep
+
+
+def _empty(count, fmt="h"):
+    """Uninitialized array, NumPy if there is NumPy"""
+    if np is not None:
+        return np.empty(count, dtype=np.int16 if fmt == "h" else np.uint16)
+    return array.array(fmt, bytes(2 * count))
+
+
+def lengths():
+    """RFFT lengths the library is built for"""
+    result = []
+    n = 32
+    while n <= 8192:
+        if _load().rfft_q15_get_instance(n):
+            result.append(n)
+        n *= 2
+    return result
+
+
+def rfft(x, out=None, overwrite_input=False):
+    """
+    arm_rfft_q15() of one frame
+
+    Args:
+        x: n Q15 samples, n a built-in RFFT length
+        out: 2 * n int16 output, allocated if None
+        overwrite_input: let the RFFT work in x itself, as on the target,
+            instead of in a copy
+
+    Returns:
+        out: bins 0 to n - 1 as real, imaginary pairs, scaled by 1 / n,
+        bins above n / 2 the conjugates of those below
+    """
+    return rfft_batch(x, None, out, overwrite_input)
+
+
+def rfft_batch(frames, n=None, out=None, overwrite_input=False):
+    """
+    arm_rfft_q15() of consecutive frames of one buffer
+
+    Args:
+        frames: m * n Q15 samples, e.g. an (m, n) int16 array
+        n: frame length, the last dimension of frames if None
+        out: m * 2 * n int16 output, allocated if None, of shape (m, 2 * n)
+            for a NumPy frames
+        overwrite_input: as for rfft()
+
+    Returns:
+        out, the output of each frame after that of the one before
+    """
+    flat = _samples(frames)
+    if overwrite_input and flat.readonly:
+        raise TypeError("frames is read-only")
+    if n is None:
+        n = memoryview(frames).shape[-1]
+    if n == 0 or len(flat) % n != 0:
+        raise ValueError(f"{len(flat)} samples are not whole frames of {n}")
+    count = len(flat) // n
+    instance = _instance(n)
+
+    if out is None:
+        out = _empty(2 * n * count)
+        if np is not None and isinstance(frames, np.ndarray) and frames.ndim > 1:
+            out = out.reshape(frames.shape[:-1] + (2 * n,))
+    dst = _samples(out)
+    if dst.readonly or len(dst) != 2 * n * count:
+        raise ValueError(f"out must be {2 * n * count} writable values")
+
+    lib = _load()
+    src_addr, src_keep = _address(flat)
+    dst_addr, dst_keep = _address(dst)
+    # The RFFT works in the frame itself, or in one work frame refilled for each
+    work = None if overwrite_input else (ctypes.c_int16 * n)()
+    for i in range(count):
+        frame = src_addr + 2 * n * i
+        if work is not None:
+            ctypes.memmove(work, frame, 2 * n)
+            frame = ctypes.addressof(work)
+        lib.arm_rfft_q15(instance, frame, dst_addr + 4 * n * i)
+
+    del src_keep, dst_keep
+    return out
+
+
+def top_bins(x, num_top_bins):
+    """
+    find_fft_top_bins() of one frame, strongest bin first
+
+    Args:
+        x: n Q15 samples, n a built-in RFFT length
+        num_top_bins: 1 to TOP_BINS_MAX
+
+    Returns:
+        num_top_bins uint16 bin indices, a NumPy array if there is NumPy
+    """
+    flat = _samples(x)
+    _instance(len(flat))
+    if not 1 <= num_top_bins <= TOP_BINS_MAX:
+        raise ValueError(f"num_top_bins {num_top_bins} is not 1 to {TOP_BINS_MAX}")
+
+    result = _empty(num_top_bins, "H")
+    src_addr, src_keep = _address(flat)
+    dst_addr, dst_keep = _address(_samples(result, "H"))
+
+    # find_fft_top_bins() copies the frame, it never writes to x
+    status = _load().find_fft_top_bins(src_addr, len(flat), len(flat), dst_addr, num_top_bins)
+    del src_keep, dst_keep
+    if status != 0:
+        raise ValueError(f"find_fft_top_bins() failed with status {status}")
+
+    return result
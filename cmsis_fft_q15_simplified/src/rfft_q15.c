@@ -1,345 +0,0 @@
-/* ----------------------------------------------------------------------
- * Project:      CMSIS DSP Library - Simplified Q15 RFFT
- * Title:        rfft_q15.c
- * Description:  Simplified RFFT Q15 process function for ARM Cortex-M33
- *
- * Target Processor: ARM Cortex-M33
- * -------------------------------------------------------------------- */
-/*
- * Copyright (C) 2010-2021 ARM Limited or its affiliates. All rights reserved.
- *
- * SPDX-License-Identifier: Apache-2.0
- */
-
-#include "rfft_q15.h"
-#include <stddef.h>
-
-/* External CFFT function declaration */
-extern void arm_cfft_q15(
-    const arm_cfft_instance_q15 * S,
-    q15_t * p1,
-    uint8_t ifftFlag,
-    uint8_t bitReverseFlag);
-
-/* Internal split function for RFFT */
-static void arm_split_rfft_q15(
-        q15_t * pSrc,
-        uint32_t fftLen,
-  const q15_t * pATable,
-  const q15_t * pBTable,
-        q15_t * pDst,
-        uint32_t modifier);
-
-/* Internal split function for RIFFT */
-static void arm_split_rifft_q15(
-        q15_t * pSrc,
-        uint32_t fftLen,
-  const q15_t * pATable,
-  const q15_t * pBTable,
-        q15_t * pDst,
-        uint32_t modifier);
-
-/**
- * @brief Processing function for the Q15 RFFT.
- * @param[in]     S     points to an instance of the Q15 RFFT structure
- * @param[in]     pSrc  points to input buffer (modified by this function)
- * @param[out]    pDst  points to output buffer
- */
-void arm_rfft_q15(
-  const arm_rfft_instance_q15 * S,
-        q15_t * pSrc,
-        q15_t * pDst)
-{
-    const arm_cfft_instance_q15 *S_CFFT = S->pCfft;
-    uint32_t L2 = S->fftLenReal >> 1U;
-
-    /* Calculation of RIFFT of input */
-    if (S->ifftFlagR == 1U)
-    {
-        /* Real IFFT core process */
-        arm_split_rifft_q15(pSrc, L2, S->pTwiddleAReal, S->pTwiddleBReal, pDst, S->twidCoefRModifier);
-
-        /* Complex IFFT process */
-        arm_cfft_q15(S_CFFT, pDst, S->ifftFlagR, S->bitReverseFlagR);
-
-        /* Shift output by 1 for IFFT */
-        for (uint32_t i = 0; i < S->fftLenReal; i++)
-        {
-            pDst[i] = pDst[i] << 1;
-        }
-    }
-    else
-    {
-        /* Calculation of RFFT of input */
-
-        /* Complex FFT process */
-        arm_cfft_q15(S_CFFT, pSrc, S->ifftFlagR, S->bitReverseFlagR);
-
-        /* Real FFT core process */
-        arm_split_rfft_q15(pSrc, L2, S->pTwiddleAReal, S->pTwiddleBReal, pDst, S->twidCoefRModifier);
-    }
-}
-
-/**
- * @brief Core Real FFT process
- * @param[in]     pSrc      points to input buffer
- * @param[in]     fftLen    length of FFT
- * @param[in]     pATable   points to twiddle Coef A buffer
- * @param[in]     pBTable   points to twiddle Coef B buffer
- * @param[out]    pDst      points to output buffer
- * @param[in]     modifier  twiddle coefficient modifier
- */
-static void arm_split_rfft_q15(
-        q15_t * pSrc,
-        uint32_t fftLen,
-  const q15_t * pATable,
-  const q15_t * pBTable,
-        q15_t * pDst,
-        uint32_t modifier)
-{       
-    uint32_t i;
-    q31_t outR, outI;
-    const q15_t *pCoefA, *pCoefB;
-    q15_t *pSrc1, *pSrc2;
-
-#if defined (ARM_MATH_DSP)
-    q15_t *pD1, *pD2;
-#endif
-
-    /* Init coefficient pointers */
-    pCoefA = &pATable[modifier * 2];
-    pCoefB = &pBTable[modifier * 2];
-
-    pSrc1 = &pSrc[2];
-    pSrc2 = &pSrc[(2U * fftLen) - 2U];
-
-#if defined (ARM_MATH_DSP)
-
-    i = 1U;
-    pD1 = pDst + 2;
-    pD2 = pDst + (4U * fftLen) - 2;
-
-    for (i = fftLen - 1; i > 0; i--)
-    {
-        /*
-          outR = (  pSrc[2 * i]             * pATable[2 * i]
-                  - pSrc[2 * i + 1]         * pATable[2 * i + 1]
-                  + pSrc[2 * n - 2 * i]     * pBTable[2 * i]
-                  + pSrc[2 * n - 2 * i + 1] * pBTable[2 * i + 1]);
-
-          outI = (  pIn[2 * i + 1]         * pATable[2 * i]
-                  + pIn[2 * i]             * pATable[2 * i + 1]
-                  + pIn[2 * n - 2 * i]     * pBTable[2 * i + 1]
-                  - pIn[2 * n - 2 * i + 1] * pBTable[2 * i])
-         */
-
-#ifndef ARM_MATH_BIG_ENDIAN
-        /* pSrc[2 * i] * pATable[2 * i] - pSrc[2 * i + 1] * pATable[2 * i + 1] */
-        outR = __SMUSD(*((q31_t *)pSrc1), *((q31_t *)pCoefA));
-#else
-        /* -(pSrc[2 * i + 1] * pATable[2 * i + 1] - pSrc[2 * i] * pATable[2 * i]) */
-        outR = -(__SMUSD(*((q31_t *)pSrc1), *((q31_t *)pCoefA)));
-#endif
-
-        /* pSrc[2 * n - 2 * i] * pBTable[2 * i] + pSrc[2 * n - 2 * i + 1] * pBTable[2 * i + 1]) */
-        outR = __SMLAD(*((q31_t *)pSrc2), *((q31_t *)pCoefB), outR) >> 16U;
-
-        /* pIn[2 * n - 2 * i] * pBTable[2 * i + 1] - pIn[2 * n - 2 * i + 1] * pBTable[2 * i] */
-#ifndef ARM_MATH_BIG_ENDIAN
-        outI = __SMUSDX(*((q31_t *)pSrc2), *((q31_t *)pCoefB));
-        pSrc2 -= 2;
-#else
-        outI = __SMUSDX(*((q31_t *)pCoefB), *((q31_t *)pSrc2));
-        pSrc2 -= 2;
-#endif
-
-        /* (pIn[2 * i + 1] * pATable[2 * i] + pIn[2 * i] * pATable[2 * i + 1] */
-        outI = __SMLADX(*((q31_t *)pSrc1), *((q31_t *)pCoefA), outI);
-        pSrc1 += 2;
-
-        /* write output */
-        *pD1++ = (q15_t) outR;
-        *pD1++ = outI >> 16U;
-
-        /* write complex conjugate output */
-        pD2[0] = (q15_t) outR;
-        pD2[1] = -(outI >> 16U);
-        pD2 -= 2;
-
-        /* update coefficient pointer */
-        pCoefB = pCoefB + (2U * modifier);
-        pCoefA = pCoefA + (2U * modifier);
-    }
-
-    pDst[2U * fftLen]      = (pSrc[0] - pSrc[1]) >> 1U;
-    pDst[2U * fftLen + 1U] = 0;
-
-    pDst[0] = (pSrc[0] + pSrc[1]) >> 1U;
-    pDst[1] = 0;
-
-#else
-
-    i = 1U;
-
-    while (i < fftLen)
-    {
-        /*
-          outR = (  pSrc[2 * i]             * pATable[2 * i]
-                  - pSrc[2 * i + 1]         * pATable[2 * i + 1]
-                  + pSrc[2 * n - 2 * i]     * pBTable[2 * i]
-                  + pSrc[2 * n - 2 * i + 1] * pBTable[2 * i + 1]);
-        */
-
-        outR = *pSrc1 * *pCoefA;
-        outR = outR - (*(pSrc1 + 1) * *(pCoefA + 1));
-        outR = outR + (*pSrc2 * *pCoefB);
-        outR = (outR + (*(pSrc2 + 1) * *(pCoefB + 1))) >> 16;
-
-        /*
-          outI = (  pIn[2 * i + 1]         * pATable[2 * i]
-                  + pIn[2 * i]             * pATable[2 * i + 1]
-                  + pIn[2 * n - 2 * i]     * pBTable[2 * i + 1]
-                  - pIn[2 * n - 2 * i + 1] * pBTable[2 * i]);
-        */
-
-        outI = *pSrc2 * *(pCoefB + 1);
-        outI = outI - (*(pSrc2 + 1) * *pCoefB);
-        outI = outI + (*(pSrc1 + 1) * *pCoefA);
-        outI = outI + (*pSrc1 * *(pCoefA + 1));
-
-        /* update input pointers */
-        pSrc1 += 2U;
-        pSrc2 -= 2U;
-
-        /* write output */
-        pDst[2U * i] = (q15_t) outR;
-        pDst[2U * i + 1U] = outI >> 16U;
-
-        /* write complex conjugate output */
-        pDst[(4U * fftLen) - (2U * i)] = (q15_t) outR;
-        pDst[((4U * fftLen) - (2U * i)) + 1U] = -(outI >> 16U);
-
-        /* update coefficient pointer */
-        pCoefB = pCoefB + (2U * modifier);
-        pCoefA = pCoefA + (2U * modifier);
-
-        i++;
-    }
-
-    pDst[2U * fftLen] = (pSrc[0] - pSrc[1]) >> 1;
-    pDst[2U * fftLen + 1U] = 0;
-
-    pDst[0] = (pSrc[0] + pSrc[1]) >> 1;
-    pDst[1] = 0;
-
-#endif /* #if defined (ARM_MATH_DSP) */
-}
-
-/**
- * @brief Core Real IFFT process
- * @param[in]     pSrc      points to input buffer
- * @param[in]     fftLen    length of FFT
- * @param[in]     pATable   points to twiddle Coef A buffer
- * @param[in]     pBTable   points to twiddle Coef B buffer
- * @param[out]    pDst      points to output buffer
- * @param[in]     modifier  twiddle coefficient modifier
- */
-static void arm_split_rifft_q15(
-        q15_t * pSrc,
-        uint32_t fftLen,
-  const q15_t * pATable,
-  const q15_t * pBTable,
-        q15_t * pDst,
-        uint32_t modifier)
-{
-    uint32_t i;
-    q31_t outR, outI;
-    const q15_t *pCoefA, *pCoefB;
-    q15_t *pSrc1, *pSrc2;
-    q15_t *pDst1 = &pDst[0];
-
-    pCoefA = &pATable[0];
-    pCoefB = &pBTable[0];
-
-    pSrc1 = &pSrc[0];
-    pSrc2 = &pSrc[2 * fftLen];
-
-    i = fftLen;
-    while (i > 0U)
-    {
-        /*
-          outR = (  pIn[2 * i]             * pATable[2 * i]
-                  + pIn[2 * i + 1]         * pATable[2 * i + 1]
-                  + pIn[2 * n - 2 * i]     * pBTable[2 * i]
-                  - pIn[2 * n - 2 * i + 1] * pBTable[2 * i + 1]);
-
-          outI = (  pIn[2 * i + 1]         * pATable[2 * i]
-                  - pIn[2 * i]             * pATable[2 * i + 1]
-                  - pIn[2 * n - 2 * i]     * pBTable[2 * i + 1]
-                  - pIn[2 * n - 2 * i + 1] * pBTable[2 * i]);
-         */
-
-#if defined (ARM_MATH_DSP)
-
-#ifndef ARM_MATH_BIG_ENDIAN
-        /* pIn[2 * n - 2 * i] * pBTable[2 * i] - pIn[2 * n - 2 * i + 1] * pBTable[2 * i + 1]) */
-        outR = __SMUSD(*((q31_t *)pSrc2), *((q31_t *)pCoefB));
-#else
-        /* -(-pIn[2 * n - 2 * i] * pBTable[2 * i] + pIn[2 * n - 2 * i + 1] * pBTable[2 * i + 1])) */
-        outR = -(__SMUSD(*((q31_t *)pSrc2), *((q31_t *)pCoefB)));
-#endif
-
-        /* pIn[2 * i] * pATable[2 * i] + pIn[2 * i + 1] * pATable[2 * i + 1] + pIn[2 * n - 2 * i] * pBTable[2 * i] */
-        outR = __SMLAD(*((q31_t *)pSrc1), *((q31_t *)pCoefA), outR) >> 16U;
-
-        /* -pIn[2 * n - 2 * i] * pBTable[2 * i + 1] + pIn[2 * n - 2 * i + 1] * pBTable[2 * i] */
-        outI = __SMUADX(*((q31_t *)pSrc2), *((q31_t *)pCoefB));
-        pSrc2 -= 2;
-
-        /* pIn[2 * i + 1] * pATable[2 * i] - pIn[2 * i] * pATable[2 * i + 1] */
-#ifndef ARM_MATH_BIG_ENDIAN
-        outI = __SMLSDX(*((q31_t *)pCoefA), *((q31_t *)pSrc1), -outI);
-        pSrc1 += 2;
-#else
-        outI = __SMLSDX(*((q31_t *)pSrc1), *((q31_t *)pCoefA), -outI);
-        pSrc1 += 2;
-#endif
-
-        /* write output */
-#ifndef ARM_MATH_BIG_ENDIAN
-        *((q31_t *)pDst1) = __PKHBT(outR, (outI >> 16U), 16);
-        pDst1 += 2;
-#else
-        *((q31_t *)pDst1) = __PKHBT((outI >> 16U), outR, 16);
-        pDst1 += 2;
-#endif
-
-#else  /* #if defined (ARM_MATH_DSP) */
-
-        outR = *pSrc2 * *pCoefB;
-        outR = outR - (*(pSrc2 + 1) * *(pCoefB + 1));
-        outR = outR + (*pSrc1 * *pCoefA);
-        outR = (outR + (*(pSrc1 + 1) * *(pCoefA + 1))) >> 16;
-
-        outI = *(pSrc1 + 1) * *pCoefA;
-        outI = outI - (*pSrc1 * *(pCoefA + 1));
-        outI = outI - (*pSrc2 * *(pCoefB + 1));
-        outI = outI - (*(pSrc2 + 1) * *(pCoefB));
-
-        /* update input pointers */
-        pSrc1 += 2U;
-        pSrc2 -= 2U;
-
-        /* write output */
-        *pDst1++ = (q15_t) outR;
-        *pDst1++ = (q15_t) (outI >> 16);
-
-#endif /* #if defined (ARM_MATH_DSP) */
-
-        /* update coefficient pointer */
-        pCoefB = pCoefB + (2 * modifier);
-        pCoefA = pCoefA + (2 * modifier);
-
-        i--;
-    }
-}
@@ -0,0 +1,164 @@
+#!/usr/bin/env python3
+"""
+Merge and compare the JSON results of test/bench_accuracy.c
+
+The accuracy target of the Makefile runs bench_accuracy for every kernel
+variant of both backends and merges the results into one file, with the
+mean SNR of every variant and backend side by side:
+
+    python3 test/accuracy_compare.py merge -o build/accuracy.json \
+        build/accuracy/*.json build/dsp-emulated/accuracy/*.json
+
+Given an older file, every case that lost precision is listed and the exit
+status is 1: a lower minimum or mean SNR, by more than the SNR drop, a
+larger bin error, fewer top 20 bins found, or a CFFT overflow or wrap
+that was not there before:
+
+    python3 test/accuracy_compare.py compare baseline.json build/accuracy.json
+
+The corpus is seeded, so the same build gives the same results on every
+host and any change is the code's.
+"""
+
+import argparse
+import json
+import platform
+import sys
+
+
+def key(result):
+    return (result['variant'], result['backend'], result['kernel'], result['len'], result['input'])
+
+
+def case(result):
+    return (f"{result['kernel']:<18} {result['variant']:<9} {result['backend']:<12} "
+            f"{result['len']:>5} {result['input']:<8}")
+
+
+def side_by_side(results):
+    """Mean SNR, or mean top 20 bins found, of every variant per case"""
+    builds = []
+    table = {}
+    for r in results:
+        build = (r['variant'], r['backend'])
+        if build not in builds:
+            builds.append(build)
+        value = r['top_mean'] if 'top_mean' in r else r['snr_mean']
+        wrapped = r.get('wraps', 0) != 0
+        table.setdefault((r['kernel'], r['len'], r['input']), {})[build] = (value, wrapped)
+
+    print(f"{'':<18} {'':>5} {'':<8} " + ' '.join(f'{v:>12}' for v, _ in builds))
+    print(f"{'kernel':<18} {'len':>5} {'input':<8} " + ' '.join(f'{b:>12}' for _, b in builds))
+    for (kernel, length, input_type), values in table.items():
+        cells = []
+        for build in builds:
+            if build not in values:
+                cells.append(f"{'-':>12}")
+                continue
+            value, wrapped = values[build]
+            cells.append(f"{value:>11.2f}{'!' if wrapped else ' '}")
+        print(f'{kernel:<18} {length:>5} {input_type:<8} ' + ' '.join(cells))
+    print("SNR in dB, top 20 bins in bins found; ! marks a case with wrapped CFFT values")
+
+
+def merge(args):
+    results = []
+    for path in args.inputs:
+        with open(path) as f:
+            results.extend(json.load(f)['results'])
+
+    merged = {
+        'host': {
+            'machine': platform.machine(),
+            'processor': platform.processor(),
+            'system': platform.system(),
+        },
+        'results': results,
+    }
+
+    with open(args.output, 'w') as f:
+        json.dump(merged, f, indent=2)
+        f.write('\n')
+
+    side_by_side(results)
+    print(f'Wrote {len(results)} results to {args.output}')
+    return 0
+
+
+def losses(r, base, snr_drop):
+    """What r lost against base, as text"""
+    lost = []
+
+    if 'top_mean' in r:
+        if r['top_min'] < base['top_min'] or r['top_mean'] < base['top_mean'] - 0.05:
+            lost.append(f"top {base['top_min']}-{base['top_mean']:.2f} -> "
+                        f"{r['top_min']}-{r['top_mean']:.2f}/{r['top_n']}")
+        return lost
+
+    for field in ('snr_min', 'snr_mean'):
+        if r[field] < base[field] - snr_drop:
+            lost.append(f"{field} {base[field]:.2f} -> {r[field]:.2f} dB")
+    # Half an LSB of slack for the rounding of the file
+    if r['max_error'] > base['max_error'] + 0.5:
+        lost.append(f"max_error {base['max_error']:.2f} -> {r['max_error']:.2f} LSB")
+    for field in ('overflows', 'wraps'):
+        if r[field] > base[field]:
+            lost.append(f"{field} {base[field]} -> {r[field]}")
+
+    return lost
+
+
+def compare(args):
+    with open(args.baseline) as f:
+        old = {key(r): r for r in json.load(f)['results']}
+    with open(args.current) as f:
+        new = json.load(f)['results']
+
+    worse = []
+    missing = 0
+    for r in new:
+        base = old.get(key(r))
+        if base is None:
+            missing += 1
+            continue
+        lost = losses(r, base, args.snr_drop)
+        if lost:
+            worse.append((r, lost))
+
+    for r, lost in worse:
+        print(f"  {case(r)} {', '.join(lost)}")
+
+    if missing:
+        print(f'{missing} cases not in {args.baseline}')
+
+    if worse:
+        print(f'✗ {len(worse)} of {len(new)} cases less accurate than in {args.baseline}')
+        return 1
+
+    print(f'✓ No case less accurate than in {args.baseline}')
+    return 0
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    sub = parser.add_subparsers(dest='command', required=True)
+
+    p = sub.add_parser('merge', help='merge bench_accuracy results into one file')
+    p.add_argument('-o', '--output', required=True)
+    p.add_argument('inputs', nargs='+')
+    p.set_defaults(func=merge)
+
+    p = sub.add_parser('compare', help='list cases less accurate than in a baseline')
+    p.add_argument('baseline')
+    p.add_argument('current')
+    p.add_argument('--snr-drop', type=float, default=0.1,
+                   help='dB of SNR that counts as a loss (default 0.1)')
+    p.set_defaults(func=compare)
+
+    args = parser.parse_args()
+    return args.func(args)
+
+
+if __name__ == '__main__':
+    sys.exit(main())
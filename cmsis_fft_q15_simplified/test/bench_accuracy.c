@@ -0,0 +1,729 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library - Simplified Q15 RFFT
+ * Title:        bench_accuracy.c
+ * Description:  Fixed-point accuracy of the RFFT variants against double
+ *
+ * Usage:        ./bench_accuracy [-r frames] [-c frames] [-s seed]
+ *                                [-o results.json] [dir ...]
+ * Example:      ./bench_accuracy -r 64 -c 16 test_vectors_random
+ *
+ * Target Processor: nRF54L15 FLPR (PC validation)
+ * -------------------------------------------------------------------- */
+
+/*
+ * Built once per kernel variant by the accuracy target of the Makefile,
+ * for all lengths from 32 to 8192 and the BACKEND it selects, with
+ * BENCH_VARIANT naming the variant. Where bench_fft.c shows what a
+ * variant gains in time, this shows what it costs in precision. Every
+ * length runs three inputs:
+ *
+ * - vectors: the test_ref_<name>.npy of each dir, test_vectors_random by
+ *   default. Without a test_input_<name>.bin next to it, the input is
+ *   rebuilt from the reference as test_random_signals.py quantized it.
+ * - random: -r frames of 1 to 15 tones in noise, as test_fft_batch -r.
+ * - clipped: -c frames of full-scale square waves in quadrature on the
+ *   even and odd samples. The complex CFFT input of such a real frame is
+ *   as far outside the unit circle as Q15 allows, so its spectrum may not
+ *   fit the fixed format of arm_cfft_q15().
+ *
+ * The reference is the double precision DFT of the Q15 input itself, so
+ * only the error of the transform counts. arm_rfft_q15() and
+ * arm_rfft_q15_bfp() report the SNR of bins 0 to n / 2 and the largest bin
+ * error in output LSBs. find_fft_top_bins() reports how many of its top
+ * 20 bins are among the 20 strongest of the reference, ties included.
+ *
+ * Overflows are what the fixed format hides. The CFFT of each RFFT runs
+ * once more on its own, against the double CFFT of its input: a value
+ * more than 256 LSBs off, far beyond rounding, overflowed, saturated by a
+ * butterfly or wrapped. Wraps are the overflows more than 16384 LSBs, half
+ * the 2^16 of a wrap-around, off: the <<= 1 fixup of the radix-4-by-2
+ * CFFT, and the shifts folded into the last stage of the packed
+ * butterflies, wrap at full scale instead of saturating.
+ *
+ * Every frame has its own seed, so the results are the same on every
+ * host. -o writes them as JSON for test/accuracy_compare.py.
+ */
+
+#define _GNU_SOURCE
+#include "fft_utils.h"
+#include <dirent.h>
+#include <fcntl.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#if RFFT_Q15_MIN_FFT_LEN != 32 || RFFT_Q15_MAX_FFT_LEN != 8192
+#error "bench_accuracy.c needs all lengths from 32 to 8192"
+#endif
+
+#ifndef BENCH_VARIANT
+#define BENCH_VARIANT "generic"
+#endif
+
+#define MIN_FFT_LEN  32U
+#define MAX_FFT_LEN  8192U
+#define NUM_LENGTHS  9U
+
+/* Bins find_fft_top_bins() is asked for, at most n / 2 */
+#define TOP_N  20U
+
+/* Error of a CFFT value that only an overflow explains, and only a wrap-around */
+#define OVERFLOW_LSB  256.0
+#define WRAP_LSB      16384.0
+
+/* Tones of a random frame, at most */
+#define RANDOM_MAX_TONES  15U
+
+static const double pi = 3.14159265358979323846;
+
+typedef enum {
+    INPUT_VECTORS = 0,
+    INPUT_RANDOM,
+    INPUT_CLIPPED,
+    NUM_INPUTS
+} input_type_t;
+
+static const char *const input_names[NUM_INPUTS] = { "vectors", "random", "clipped" };
+
+typedef enum {
+    KERNEL_RFFT = 0,
+    KERNEL_RFFT_BFP,
+    KERNEL_TOP_BINS,
+    NUM_KERNELS
+} kernel_t;
+
+static const char *const kernel_names[NUM_KERNELS] = {
+    "arm_rfft_q15", "arm_rfft_q15_bfp", "find_fft_top_bins"
+};
+
+/* Results of one kernel, length and input over all its frames */
+typedef struct {
+    uint32_t frames;
+    double snr_min;         /* dB, RFFT kernels */
+    double snr_sum;
+    double max_error;       /* Output LSBs, RFFT kernels */
+    uint32_t overflows;     /* CFFT values overflowed, RFFT kernels */
+    uint32_t wraps;         /* Of those, wrapped around */
+    uint32_t top_min;       /* Of top_n, find_fft_top_bins() */
+    uint32_t top_sum;
+    uint32_t top_n;
+} accuracy_t;
+
+static accuracy_t results[NUM_KERNELS][NUM_LENGTHS][NUM_INPUTS];
+
+/* Frame buffers, malloc() aligns beyond RFFT_Q15_ALIGN */
+static int16_t *signal;     /* n, the input */
+static q15_t *work;         /* n, overwritten by the kernels */
+static q15_t *output;       /* 2 * n */
+static double *exact;       /* 2 * n, unscaled DFT of signal */
+static double *cfft_exact;  /* n, unscaled DFT of signal as n / 2 complex values */
+static q15_t *stockham;     /* n, second buffer of the Stockham CFFT */
+
+/* Small, fast, and the same sequence on every host */
+static uint32_t xorshift32(uint32_t *state)
+{
+    uint32_t x = *state;
+
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *state = x;
+
+    return x;
+}
+
+/* Uniform in [0, 1) */
+static double uniform(uint32_t *state)
+{
+    return (xorshift32(state) >> 8) * (1.0 / 16777216.0);
+}
+
+static uint32_t length_index(uint32_t n)
+{
+    uint32_t i = 0;
+
+    while ((MIN_FFT_LEN << i) < n) {
+        i++;
+    }
+    return i;
+}
+
+/* In-place radix-2 FFT of n complex values, interleaved */
+static void reference_fft(double *x, uint32_t n)
+{
+    for (uint32_t i = 1, j = 0; i < n; i++) {
+        uint32_t bit = n >> 1;
+
+        for (; j & bit; bit >>= 1) {
+            j ^= bit;
+        }
+        j |= bit;
+
+        if (i < j) {
+            double re = x[2U * i], im = x[2U * i + 1U];
+
+            x[2U * i] = x[2U * j];
+            x[2U * i + 1U] = x[2U * j + 1U];
+            x[2U * j] = re;
+            x[2U * j + 1U] = im;
+        }
+    }
+
+    for (uint32_t len = 2; len <= n; len <<= 1) {
+        for (uint32_t k = 0; k < len / 2U; k++) {
+            double wr = cos(2.0 * pi * k / len);
+            double wi = -sin(2.0 * pi * k / len);
+
+            for (uint32_t i = k; i < n; i += len) {
+                uint32_t a = 2U * i, b = 2U * (i + len / 2U);
+                double re = x[b] * wr - x[b + 1U] * wi;
+                double im = x[b] * wi + x[b + 1U] * wr;
+
+                x[b] = x[a] - re;
+                x[b + 1U] = x[a + 1U] - im;
+                x[a] += re;
+                x[a + 1U] += im;
+            }
+        }
+    }
+}
+
+/* Both references of signal: the real DFT and the DFT of its CFFT input */
+static void reference(uint32_t n)
+{
+    for (uint32_t i = 0; i < n; i++) {
+        exact[2U * i] = signal[i];
+        exact[2U * i + 1U] = 0.0;
+        cfft_exact[i] = signal[i];
+    }
+
+    reference_fft(exact, n);
+    reference_fft(cfft_exact, n / 2U);
+}
+
+/* Tones in noise, as random_frame() of test_fft_batch.c */
+static void random_signal(uint32_t n, uint32_t seed)
+{
+    uint32_t state = seed | 1U;
+    uint32_t tones = 1U + xorshift32(&state) % RANDOM_MAX_TONES;
+    double bins[RANDOM_MAX_TONES], amps[RANDOM_MAX_TONES], phases[RANDOM_MAX_TONES];
+    double total = 0.0, level, noise;
+
+    for (uint32_t t = 0; t < tones; t++) {
+        bins[t] = 1.0 + uniform(&state) * (n / 2U - 2U);
+        amps[t] = 0.05 + uniform(&state);
+        phases[t] = 2.0 * pi * uniform(&state);
+        total += amps[t];
+    }
+    level = (0.1 + 0.8 * uniform(&state)) * 32767.0 / total;
+    noise = level * total * pow(10.0, -(40.0 + 40.0 * uniform(&state)) / 20.0);
+
+    for (uint32_t i = 0; i < n; i++) {
+        double v = noise * (uniform(&state) - 0.5);
+
+        for (uint32_t t = 0; t < tones; t++) {
+            v += level * amps[t] * cos(2.0 * pi * bins[t] * i / n + phases[t]);
+        }
+        signal[i] = (int16_t) lrint(v);
+    }
+}
+
+/*
+ * Square waves of cycle k of the n / 2 pairs, in quadrature: the CFFT
+ * input x[2 m] + j x[2 m + 1] goes round the corners of the Q15 square,
+ * and its bin k reaches 4 / pi of full scale in each part.
+ */
+static void clipped_signal(uint32_t n, uint32_t seed)
+{
+    uint32_t state = seed | 1U;
+    uint32_t pairs = n / 2U;
+    uint32_t k = 1U + xorshift32(&state) % (pairs / 2U - 1U);
+    double phase = 2.0 * pi * uniform(&state);
+
+    for (uint32_t m = 0; m < pairs; m++) {
+        double t = 2.0 * pi * k * m / pairs + phase;
+
+        signal[2U * m] = (cos(t) >= 0.0) ? 32767 : -32768;
+        signal[2U * m + 1U] = (sin(t) >= 0.0) ? -32768 : 32767;
+    }
+}
+
+/*
+ * The input of a test_ref_<name>.npy without its test_input_<name>.bin:
+ * the inverse DFT of the reference in full scale 1.0, truncated to Q15 as
+ * float_to_q15() of test_random_signals.py does.
+ */
+static void vector_signal(const double *ref, uint32_t n)
+{
+    for (uint32_t k = 0; k <= n / 2U; k++) {
+        /* Conjugate of the Hermitian spectrum, so the forward FFT inverts */
+        exact[2U * k] = ref[2U * k];
+        exact[2U * k + 1U] = -ref[2U * k + 1U];
+        if (k != 0U && k != n / 2U) {
+            exact[2U * (n - k)] = ref[2U * k];
+            exact[2U * (n - k) + 1U] = ref[2U * k + 1U];
+        }
+    }
+
+    reference_fft(exact, n);
+
+    for (uint32_t i = 0; i < n; i++) {
+        double v = trunc(exact[2U * i] / n * 32768.0);
+
+        signal[i] = (int16_t) fmax(-32768.0, fmin(32767.0, v));
+    }
+}
+
+/* Add a frame's SNR and error to its results */
+static void add_error(accuracy_t *acc, double snr_db, double max_error)
+{
+    acc->snr_min = (acc->frames == 0U) ? snr_db : fmin(acc->snr_min, snr_db);
+    acc->snr_sum += isinf(snr_db) ? 0.0 : snr_db;
+    acc->max_error = fmax(acc->max_error, max_error);
+}
+
+/*
+ * Bins 0 to n / 2 of an RFFT output against the reference: the output
+ * times 2^exponent is the unscaled DFT.
+ */
+static void compare_rfft(accuracy_t *acc, uint32_t n, int32_t exponent)
+{
+    double scale = ldexp(1.0, -exponent);
+    double signal_power = 0.0, noise = 0.0, max_error = 0.0;
+
+    for (uint32_t k = 0; k <= n / 2U; k++) {
+        double re = exact[2U * k] * scale;
+        double im = exact[2U * k + 1U] * scale;
+        double er = output[2U * k] - re;
+        double ei = output[2U * k + 1U] - im;
+
+        signal_power += re * re + im * im;
+        noise += er * er + ei * ei;
+        max_error = fmax(max_error, sqrt(er * er + ei * ei));
+    }
+
+    add_error(acc, (noise > 0.0) ? 10.0 * log10(signal_power / noise) : INFINITY, max_error);
+}
+
+/*
+ * CFFT values overflowed: the n / 2-point CFFT of the RFFT on signal, the
+ * fixed-scale arm_cfft_q15() or arm_cfft_q15_bfp(), in natural order.
+ */
+static void count_overflows(accuracy_t *acc, const arm_rfft_instance_q15 *S, int bfp)
+{
+    uint32_t pairs = S->fftLenReal / 2U;
+    int32_t exponent;
+    double scale;
+
+    memcpy(work, signal, S->fftLenReal * sizeof(q15_t));
+    if (bfp) {
+        exponent = arm_cfft_q15_bfp(S->pCfft, work, 0U, 1U);
+    } else {
+        arm_cfft_q15(S->pCfft, work, 0U, 1U);
+        exponent = (int32_t) log2(pairs);
+    }
+    scale = ldexp(1.0, -exponent);
+
+    for (uint32_t i = 0; i < 2U * pairs; i++) {
+        double error = fabs(work[i] - cfft_exact[i] * scale);
+
+        acc->overflows += (error > OVERFLOW_LSB) ? 1U : 0U;
+        acc->wraps += (error > WRAP_LSB) ? 1U : 0U;
+    }
+}
+
+/*
+ * How many of the bins found are among the top_n strongest of the
+ * reference, bins 1 to n / 2 as find_fft_top_bins() searches. A bin
+ * within one output LSB of arm_rfft_q15(), n in the unscaled DFT, of the
+ * weakest of those counts as well: below that the bins are noise the Q15
+ * output cannot order.
+ */
+static uint32_t top_agreement(const uint16_t *found, uint32_t n, uint32_t top_n)
+{
+    static double mag[MAX_FFT_LEN / 2U + 1U];
+    static double sorted[MAX_FFT_LEN / 2U];
+    uint32_t count = n / 2U;
+    uint32_t agree = 0;
+    double weakest, t;
+
+    for (uint32_t k = 1; k <= count; k++) {
+        mag[k] = exact[2U * k] * exact[2U * k] + exact[2U * k + 1U] * exact[2U * k + 1U];
+        sorted[k - 1U] = mag[k];
+    }
+
+    /* Partial selection sort, top_n is small */
+    for (uint32_t i = 0; i < top_n; i++) {
+        uint32_t best = i;
+
+        for (uint32_t j = i + 1U; j < count; j++) {
+            if (sorted[j] > sorted[best]) {
+                best = j;
+            }
+        }
+        t = sorted[i];
+        sorted[i] = sorted[best];
+        sorted[best] = t;
+    }
+    weakest = sqrt(sorted[top_n - 1U]) - n;
+
+    for (uint32_t i = 0; i < top_n; i++) {
+        int repeated = 0;
+
+        for (uint32_t j = 0; j < i; j++) {
+            repeated |= (found[j] == found[i]);
+        }
+        if (!repeated && found[i] >= 1U && found[i] <= count && sqrt(mag[found[i]]) >= weakest) {
+            agree++;
+        }
+    }
+
+    return agree;
+}
+
+/* Run every kernel on signal and add the frame to its results */
+static void run_frame(uint32_t n, input_type_t input)
+{
+    const arm_rfft_instance_q15 *S = rfft_q15_get_instance((uint16_t) n);
+    uint32_t li = length_index(n);
+    uint32_t top_n = (n / 2U < TOP_N) ? n / 2U : TOP_N;
+    uint16_t found[TOP_N];
+    accuracy_t *acc;
+    int32_t exponent;
+    uint32_t agree;
+
+    reference(n);
+
+    /* arm_rfft_q15() scales by 1 / n */
+    acc = &results[KERNEL_RFFT][li][input];
+    memcpy(work, signal, n * sizeof(q15_t));
+    arm_rfft_q15(S, work, output);
+    compare_rfft(acc, n, (int32_t) log2(n));
+    count_overflows(acc, S, 0);
+    acc->frames++;
+
+    acc = &results[KERNEL_RFFT_BFP][li][input];
+    memcpy(work, signal, n * sizeof(q15_t));
+    exponent = arm_rfft_q15_bfp(S, work, output);
+    compare_rfft(acc, n, exponent);
+    count_overflows(acc, S, 1);
+    acc->frames++;
+
+    acc = &results[KERNEL_TOP_BINS][li][input];
+    if (find_fft_top_bins(signal, (uint16_t) n, (uint16_t) n, found, (uint16_t) top_n) != RFFT_SUCCESS) {
+        fprintf(stderr, "Error: find_fft_top_bins() failed at %u points\n", n);
+        exit(1);
+    }
+    agree = top_agreement(found, n, top_n);
+    acc->top_min = (acc->frames == 0U) ? agree : ((agree < acc->top_min) ? agree : acc->top_min);
+    acc->top_sum += agree;
+    acc->top_n = top_n;
+    acc->frames++;
+}
+
+/* Map a whole file read-only, NULL if it cannot be */
+static const void *map_file(const char *path, size_t *size)
+{
+    struct stat st;
+    void *data;
+    int fd = open(path, O_RDONLY);
+
+    if (fd < 0) {
+        return NULL;
+    }
+    if (fstat(fd, &st) != 0 || st.st_size == 0) {
+        close(fd);
+        return NULL;
+    }
+
+    data = mmap(NULL, (size_t) st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) {
+        return NULL;
+    }
+
+    *size = (size_t) st.st_size;
+    return data;
+}
+
+/*
+ * The bins of a version 1 or 2 .npy of a little-endian complex128 vector,
+ * and their number, NULL for any other file.
+ */
+static const double *npy_bins(const uint8_t *data, size_t size, uint32_t *count)
+{
+    const char *header;
+    const char *shape;
+    size_t header_len, offset;
+
+    if (size < 12U || memcmp(data, "\x93NUMPY", 6) != 0) {
+        return NULL;
+    }
+
+    if (data[6] == 1U) {
+        header_len = data[8] | ((size_t) data[9] << 8);
+        offset = 10U;
+    } else if (data[6] == 2U || data[6] == 3U) {
+        header_len = data[8] | ((size_t) data[9] << 8) |
+                     ((size_t) data[10] << 16) | ((size_t) data[11] << 24);
+        offset = 12U;
+    } else {
+        return NULL;
+    }
+
+    if (offset + header_len > size) {
+        return NULL;
+    }
+    header = (const char *) &data[offset];
+    offset += header_len;
+
+    /* The header is a Python dict padded to a 16 or 64 byte boundary */
+    if (memmem(header, header_len, "'<c16'", 6) == NULL ||
+        memmem(header, header_len, "'fortran_order': False", 22) == NULL) {
+        return NULL;
+    }
+    shape = memmem(header, header_len, "'shape': (", 10);
+    if (shape == NULL) {
+        return NULL;
+    }
+    *count = (uint32_t) strtoul(shape + 10, NULL, 10);
+
+    if (offset % sizeof(double) != 0 || offset + *count * 2U * sizeof(double) > size) {
+        return NULL;
+    }
+
+    return (const double *) &data[offset];
+}
+
+/* Names of the references of a dir, sorted */
+static int compare_strings(const void *a, const void *b)
+{
+    return strcmp(*(const char *const *) a, *(const char *const *) b);
+}
+
+/* Run every vector of dir, return the number run or -1 */
+static int run_dir(const char *dir)
+{
+    DIR *d = opendir(dir);
+    struct dirent *entry;
+    char **names = NULL;
+    uint32_t count = 0;
+    int run = 0;
+
+    if (d == NULL) {
+        fprintf(stderr, "Error: Cannot open directory '%s'\n", dir);
+        return -1;
+    }
+
+    while ((entry = readdir(d)) != NULL) {
+        size_t len = strlen(entry->d_name);
+
+        if (strncmp(entry->d_name, "test_ref_", 9) == 0 && len >= 13U &&
+            strcmp(&entry->d_name[len - 4U], ".npy") == 0) {
+            names = realloc(names, (count + 1U) * sizeof(*names));
+            if (names == NULL || (names[count] = strdup(entry->d_name)) == NULL) {
+                fprintf(stderr, "Error: Memory allocation failed\n");
+                exit(1);
+            }
+            count++;
+        }
+    }
+    closedir(d);
+    qsort(names, count, sizeof(*names), compare_strings);
+
+    for (uint32_t i = 0; i < count && run >= 0; i++) {
+        char path[4096];
+        size_t len = strlen(names[i]);
+        const void *ref_data, *input_data;
+        size_t ref_size, input_size;
+        const double *ref;
+        uint32_t bins, n;
+
+        snprintf(path, sizeof(path), "%s/%s", dir, names[i]);
+        ref_data = map_file(path, &ref_size);
+        ref = (ref_data != NULL) ? npy_bins(ref_data, ref_size, &bins) : NULL;
+        n = (ref != NULL && bins > 1U) ? 2U * (bins - 1U) : 0U;
+        if (n < MIN_FFT_LEN || n > MAX_FFT_LEN || (n & (n - 1U)) != 0) {
+            fprintf(stderr, "Error: '%s' is not the rfft of a supported length\n", path);
+            run = -1;
+            break;
+        }
+
+        snprintf(path, sizeof(path), "%s/test_input_%.*s.bin", dir, (int) (len - 13U), &names[i][9]);
+        input_data = map_file(path, &input_size);
+        if (input_data != NULL && input_size == n * sizeof(int16_t)) {
+            memcpy(signal, input_data, input_size);
+            munmap((void *) input_data, input_size);
+        } else {
+            vector_signal(ref, n);
+        }
+        munmap((void *) ref_data, ref_size);
+
+        run_frame(n, INPUT_VECTORS);
+        run++;
+    }
+
+    for (uint32_t i = 0; i < count; i++) {
+        free(names[i]);
+    }
+    free(names);
+
+    return run;
+}
+
+static void print_usage(const char *prog_name)
+{
+    printf("Usage: %s [-r frames] [-c frames] [-s seed] [-o results.json] [dir ...]\n", prog_name);
+    printf("\n");
+    printf("  -r frames        Random frames per RFFT length (default: 64)\n");
+    printf("  -c frames        Clipped full-scale frames per RFFT length (default: 16)\n");
+    printf("  -s seed          Seed of the generated frames (default: 1)\n");
+    printf("  -o results.json  Write the results for test/accuracy_compare.py\n");
+    printf("  dir              Directory of test_ref_*.npy (default: test_vectors_random)\n");
+}
+
+int main(int argc, char *argv[])
+{
+    uint32_t random_frames = 64;
+    uint32_t clipped_frames = 16;
+    uint32_t seed = 1;
+    const char *json_path = NULL;
+    FILE *json = NULL;
+    int first = 1;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "r:c:s:o:h")) != -1) {
+        switch (opt) {
+        case 'r':
+            random_frames = (uint32_t) strtoul(optarg, NULL, 0);
+            break;
+        case 'c':
+            clipped_frames = (uint32_t) strtoul(optarg, NULL, 0);
+            break;
+        case 's':
+            seed = (uint32_t) strtoul(optarg, NULL, 0);
+            break;
+        case 'o':
+            json_path = optarg;
+            break;
+        default:
+            print_usage(argv[0]);
+            return 1;
+        }
+    }
+
+    signal = malloc(MAX_FFT_LEN * sizeof(int16_t));
+    work = malloc(MAX_FFT_LEN * sizeof(q15_t));
+    output = malloc(2U * MAX_FFT_LEN * sizeof(q15_t));
+    exact = malloc(2U * MAX_FFT_LEN * sizeof(double));
+    cfft_exact = malloc(MAX_FFT_LEN * sizeof(double));
+    stockham = malloc(MAX_FFT_LEN * sizeof(q15_t));
+    if (signal == NULL || work == NULL || output == NULL || exact == NULL ||
+        cfft_exact == NULL || stockham == NULL) {
+        fprintf(stderr, "Error: Memory allocation failed\n");
+        return 1;
+    }
+
+#if defined(RFFT_Q15_STOCKHAM)
+    /* find_fft_top_bins() on the Stockham CFFT of this variant */
+    for (uint32_t n = MIN_FFT_LEN; n <= MAX_FFT_LEN; n <<= 1) {
+        fft_context_set_stockham_buffer(fft_context_get_default((uint16_t) n), stockham);
+    }
+#endif
+
+    if (optind == argc) {
+        if (run_dir("test_vectors_random") < 0) {
+            return 1;
+        }
+    }
+    for (int i = optind; i < argc; i++) {
+        if (run_dir(argv[i]) < 0) {
+            return 1;
+        }
+    }
+
+    for (uint32_t n = MIN_FFT_LEN; n <= MAX_FFT_LEN; n <<= 1) {
+        /* One seed per frame, as test_fft_batch */
+        for (uint32_t i = 0; i < random_frames; i++) {
+            random_signal(n, seed * 2654435761U + n * 40503U + i * 2246822519U);
+            run_frame(n, INPUT_RANDOM);
+        }
+        for (uint32_t i = 0; i < clipped_frames; i++) {
+            clipped_signal(n, seed * 2246822519U + n * 40503U + i * 2654435761U);
+            run_frame(n, INPUT_CLIPPED);
+        }
+    }
+
+    if (json_path != NULL) {
+        json = fopen(json_path, "w");
+        if (json == NULL) {
+            perror(json_path);
+            return 1;
+        }
+        fprintf(json, "{\n  \"results\": [");
+    }
+
+    printf("variant %s, backend %s\n", BENCH_VARIANT, RFFT_Q15_BACKEND);
+    printf("  %-18s %5s %-8s %6s %10s %10s %10s %9s %6s %9s\n", "kernel", "len", "input",
+           "frames", "min SNR", "mean SNR", "max error", "overflows", "wraps", "top N");
+
+    for (uint32_t k = 0; k < NUM_KERNELS; k++) {
+        for (uint32_t li = 0; li < NUM_LENGTHS; li++) {
+            for (uint32_t t = 0; t < NUM_INPUTS; t++) {
+                const accuracy_t *acc = &results[k][li][t];
+                uint32_t n = MIN_FFT_LEN << li;
+
+                if (acc->frames == 0U) {
+                    continue;
+                }
+
+                printf("%s %-18s %5u %-8s %6u", acc->wraps ? "✗" : " ",
+                       kernel_names[k], n, input_names[t], acc->frames);
+                if (k == KERNEL_TOP_BINS) {
+                    printf(" %10s %10s %10s %9s %6s %4u-%.1f/%u\n", "-", "-", "-", "-", "-",
+                           acc->top_min, (double) acc->top_sum / acc->frames, acc->top_n);
+                } else {
+                    printf(" %7.2f dB %7.2f dB %10.2f %9u %6u %9s\n", acc->snr_min,
+                           acc->snr_sum / acc->frames, acc->max_error, acc->overflows,
+                           acc->wraps, "-");
+                }
+
+                if (json == NULL) {
+                    continue;
+                }
+                fprintf(json, "%s\n    {\"variant\": \"%s\", \"backend\": \"%s\", "
+                        "\"kernel\": \"%s\", \"len\": %u, \"input\": \"%s\", \"frames\": %u, ",
+                        first ? "" : ",", BENCH_VARIANT, RFFT_Q15_BACKEND,
+                        kernel_names[k], n, input_names[t], acc->frames);
+                if (k == KERNEL_TOP_BINS) {
+                    fprintf(json, "\"top_n\": %u, \"top_min\": %u, \"top_mean\": %.3f}",
+                            acc->top_n, acc->top_min, (double) acc->top_sum / acc->frames);
+                } else {
+                    fprintf(json, "\"snr_min\": %.3f, \"snr_mean\": %.3f, \"max_error\": %.2f, "
+                            "\"overflows\": %u, \"wraps\": %u}",
+                            isinf(acc->snr_min) ? 999.0 : acc->snr_min,
+                            acc->snr_sum / acc->frames, acc->max_error, acc->overflows, acc->wraps);
+                }
+                first = 0;
+            }
+        }
+    }
+
+    if (json != NULL) {
+        fprintf(json, "\n  ]\n}\n");
+        fclose(json);
+    }
+
+    free(signal);
+    free(work);
+    free(output);
+    free(exact);
+    free(cfft_exact);
+    free(stockham);
+
+    return 0;
+}
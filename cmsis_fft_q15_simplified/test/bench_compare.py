@@ -0,0 +1,115 @@
+#!/usr/bin/env python3
+"""
+Merge and compare the JSON results of test/bench_fft.c
+
+The bench target of the Makefile runs bench_fft twice, for the kernels and
+for find_fft_top_bins(), and merges both into one baseline:
+
+    python3 test/bench_compare.py merge -o build/bench.json \
+        build/bench/kernels.json build/bench/top_bins.json
+
+Results carry the backend they were built for (BACKEND of the Makefile),
+so the baselines of several backends can be merged into one file as well.
+Given an older baseline, every case that got slower by more than the
+threshold is listed and the exit status is 1:
+
+    python3 test/bench_compare.py compare baseline.json build/bench.json
+
+ns/op is compared, the only value every host has; the time stamp counter
+and the perf cycles are kept in the file for a closer look.
+"""
+
+import argparse
+import json
+import platform
+import sys
+
+
+def key(result):
+    # Baselines from before the backends were recorded are all scalar
+    return (result['kernel'], result.get('backend', 'scalar'), result['len'], result['input'])
+
+
+def merge(args):
+    results = []
+    for path in args.inputs:
+        with open(path) as f:
+            results.extend(json.load(f)['results'])
+
+    baseline = {
+        'host': {
+            'machine': platform.machine(),
+            'processor': platform.processor(),
+            'system': platform.system(),
+        },
+        'results': results,
+    }
+
+    with open(args.output, 'w') as f:
+        json.dump(baseline, f, indent=2)
+        f.write('\n')
+
+    print(f'Wrote {len(results)} results to {args.output}')
+    return 0
+
+
+def compare(args):
+    with open(args.baseline) as f:
+        old = {key(r): r for r in json.load(f)['results']}
+    with open(args.current) as f:
+        new = json.load(f)['results']
+
+    slower = []
+    missing = 0
+    for r in new:
+        base = old.get(key(r))
+        if base is None:
+            missing += 1
+            continue
+        # Cases of a few ns are all noise
+        if base['ns'] < args.min_ns:
+            continue
+        ratio = r['ns'] / base['ns']
+        if ratio > 1.0 + args.threshold / 100.0:
+            slower.append((ratio, r, base))
+
+    for ratio, r, base in sorted(slower, key=lambda s: -s[0]):
+        print(f"  {r['kernel']:<20} {r['backend']:<12} {r['len']:>5} {r['input']:<11} "
+              f"{base['ns']:>12.1f} -> {r['ns']:>12.1f} ns/op ({100.0 * (ratio - 1.0):+.1f}%)")
+
+    if missing:
+        print(f'{missing} cases not in {args.baseline}')
+
+    if slower:
+        print(f'✗ {len(slower)} of {len(new)} cases more than {args.threshold}% slower')
+        return 1
+
+    print(f'✓ No case more than {args.threshold}% slower than {args.baseline}')
+    return 0
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    sub = parser.add_subparsers(dest='command', required=True)
+
+    p = sub.add_parser('merge', help='merge bench_fft results into one baseline')
+    p.add_argument('-o', '--output', required=True)
+    p.add_argument('inputs', nargs='+')
+    p.set_defaults(func=merge)
+
+    p = sub.add_parser('compare', help='list cases slower than in a baseline')
+    p.add_argument('baseline')
+    p.add_argument('current')
+    p.add_argument('--threshold', type=float, default=10.0,
+                   help='percent slower that counts as a regression (default 10)')
+    p.add_argument('--min-ns', type=float, default=100.0,
+                   help='ignore cases faster than this in the baseline (default 100)')
+    p.set_defaults(func=compare)
+
+    args = parser.parse_args()
+    return args.func(args)
+
+
+if __name__ == '__main__':
+    sys.exit(main())
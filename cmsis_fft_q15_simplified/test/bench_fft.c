@@ -0,0 +1,382 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library - Simplified Q15 RFFT
+ * Title:        bench_fft.c
+ * Description:  Host timing of the FFT kernels over every length and input
+ *
+ * Target Processor: nRF54L15 FLPR (PC validation)
+ * -------------------------------------------------------------------- */
+
+/*
+ * Built twice by the bench target of the Makefile, for all lengths from 32
+ * to 8192 and the BACKEND it selects. It times arm_rfft_q15(),
+ * arm_cfft_q15() and arm_bitreversal_16(), or with BENCH_TOP_BINS
+ * find_fft_top_bins() of the spectral code the FLPR runs on top of them.
+ *
+ * Every case is calibrated to at least BENCH_MIN_NS per run and the best
+ * of BENCH_RUNS runs is kept, which filters out preemption. The kernels
+ * that work in place get their input restored before every call; the
+ * cost of that copy is timed alone and taken off.
+ *
+ * Cycles are the time stamp counter, which ticks at a fixed rate, and
+ * the core clock cycles of perf_event_open() where the kernel allows it.
+ * -o writes the results as JSON for test/bench_compare.py.
+ */
+
+#if defined(BENCH_TOP_BINS)
+#include "fft_utils.h"
+#else
+#include "../include/rfft_q15.h"
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <unistd.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define BENCH_TSC() __rdtsc()
+#else
+#define BENCH_TSC() 0ULL
+#endif
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#endif
+
+#if RFFT_Q15_MIN_FFT_LEN != 32 || RFFT_Q15_MAX_FFT_LEN != 8192
+#error "bench_fft.c needs all lengths from 32 to 8192"
+#endif
+
+#define MAX_FFT_LEN 8192
+#define BENCH_RUNS 7
+#define BENCH_MIN_NS 2000000ULL
+#define BENCH_TOP_N 20
+
+static q15_t input[2 * MAX_FFT_LEN] RFFT_Q15_ALIGN;
+static q15_t work[2 * MAX_FFT_LEN] RFFT_Q15_ALIGN;
+
+/* Keeps the calls from being optimized away */
+static volatile uint32_t sink;
+
+/* ========================================================================= */
+/* Inputs                                                                    */
+/* ========================================================================= */
+
+typedef enum {
+    INPUT_ZERO,
+    INPUT_IMPULSE,
+    INPUT_TONE,
+    INPUT_NOISE,
+    INPUT_FULL_SCALE,
+    NUM_INPUTS
+} input_type_t;
+
+static const char *const input_names[NUM_INPUTS] = {
+    "zero", "impulse", "tone", "noise", "full-scale",
+};
+
+/* n samples of one input type; 2 n where a CFFT reads them as complex */
+static void fill_input(input_type_t type, uint32_t n)
+{
+    const double pi = 3.14159265358979323846;
+    uint32_t seed = 12345U;
+
+    for (uint32_t i = 0; i < n; i++) {
+        switch (type) {
+        case INPUT_ZERO:
+            input[i] = 0;
+            break;
+        case INPUT_IMPULSE:
+            input[i] = (i == 0) ? 32767 : 0;
+            break;
+        case INPUT_TONE:
+            input[i] = (q15_t) (16384.0 * sin(2.0 * pi * 37.0 * i / n) +
+                                4096.0 * cos(2.0 * pi * 5.0 * i / n));
+            break;
+        case INPUT_NOISE:
+            seed = seed * 1103515245U + 12345U;
+            input[i] = (q15_t) (seed >> 16);
+            break;
+        default:
+            /* Square wave at the rails, the worst case for saturation */
+            input[i] = ((i / 4U) & 1U) ? -32768 : 32767;
+            break;
+        }
+    }
+}
+
+/* ========================================================================= */
+/* Clocks                                                                    */
+/* ========================================================================= */
+
+static int perf_fd = -1;
+
+/* Core clock cycles of this thread, if the kernel lets us count them */
+static void perf_open(void)
+{
+#if defined(__linux__)
+    struct perf_event_attr attr;
+
+    memset(&attr, 0, sizeof(attr));
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.size = sizeof(attr);
+    attr.config = PERF_COUNT_HW_CPU_CYCLES;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+
+    perf_fd = (int) syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+    if (perf_fd >= 0) {
+        ioctl(perf_fd, PERF_EVENT_IOC_ENABLE, 0);
+    }
+#endif
+}
+
+static uint64_t perf_cycles(void)
+{
+    uint64_t count = 0;
+
+    if (perf_fd < 0 || read(perf_fd, &count, sizeof(count)) != sizeof(count)) {
+        return 0;
+    }
+
+    return count;
+}
+
+static uint64_t now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t) ts.tv_sec * 1000000000ULL + (uint64_t) ts.tv_nsec;
+}
+
+/* ========================================================================= */
+/* Kernels under test                                                        */
+/* ========================================================================= */
+
+typedef struct {
+    const char *name;
+    uint32_t len;        /* Points of the transform */
+    uint32_t restore;    /* Input samples restored before each call, 0 for none */
+    void (*run)(uint32_t fft_size);
+} bench_kernel_t;
+
+#if defined(BENCH_TOP_BINS)
+
+static void run_top_bins(uint32_t fft_size)
+{
+    uint16_t top_bins[BENCH_TOP_N];
+
+    (void) find_fft_top_bins(input, (uint16_t) fft_size, (uint16_t) fft_size,
+                             top_bins, BENCH_TOP_N);
+    sink += top_bins[0];
+}
+
+#else
+
+static q15_t output[2 * MAX_FFT_LEN] RFFT_Q15_ALIGN;
+
+static void run_rfft(uint32_t fft_size)
+{
+    arm_rfft_q15(rfft_q15_get_instance(fft_size), work, output);
+    sink += (uint16_t) output[2];
+}
+
+static void run_cfft(uint32_t fft_size)
+{
+    arm_cfft_q15(rfft_q15_get_instance(fft_size)->pCfft, work, 0, 1);
+    sink += (uint16_t) work[2];
+}
+
+/* A permutation, so it can run on the same data again and again */
+static void run_bitrev(uint32_t fft_size)
+{
+    const arm_cfft_instance_q15 *cfft = rfft_q15_get_instance(fft_size)->pCfft;
+
+    arm_bitreversal_16((uint16_t *) work, cfft->bitRevLength, cfft->pBitRevTable);
+    sink += (uint16_t) work[2];
+}
+
+#endif /* BENCH_TOP_BINS */
+
+static void run_copy(uint32_t samples)
+{
+    memcpy(work, input, samples * sizeof(q15_t));
+    sink += (uint16_t) work[1];
+}
+
+/* ========================================================================= */
+/* Measurement                                                               */
+/* ========================================================================= */
+
+typedef struct {
+    double ns;
+    double tsc;
+    double cycles;       /* 0 without perf counters */
+} bench_result_t;
+
+/* Best of BENCH_RUNS runs of iters calls, per call */
+static bench_result_t measure(const bench_kernel_t *k, uint32_t fft_size,
+                              uint32_t iters, int with_kernel)
+{
+    bench_result_t best = { 0.0, 0.0, 0.0 };
+
+    for (int run = 0; run < BENCH_RUNS; run++) {
+        uint64_t t0 = now_ns();
+        uint64_t c0 = BENCH_TSC();
+        uint64_t p0 = perf_cycles();
+
+        for (uint32_t i = 0; i < iters; i++) {
+            if (k->restore != 0) {
+                run_copy(k->restore);
+            }
+            if (with_kernel) {
+                k->run(fft_size);
+            }
+        }
+
+        uint64_t p1 = perf_cycles();
+        uint64_t c1 = BENCH_TSC();
+        uint64_t t1 = now_ns();
+        double ns = (double) (t1 - t0) / iters;
+
+        if (run == 0 || ns < best.ns) {
+            best.ns = ns;
+            best.tsc = (double) (c1 - c0) / iters;
+            best.cycles = (double) (p1 - p0) / iters;
+        }
+    }
+
+    return best;
+}
+
+static bench_result_t bench(const bench_kernel_t *k, uint32_t fft_size)
+{
+    uint32_t iters = 1;
+    bench_result_t result;
+
+    /* Start from the same data every time, see fill_input() */
+    run_copy(k->restore != 0 ? k->restore : 2U * fft_size);
+
+    /* Warm up, then double the calls until a run is long enough */
+    k->run(fft_size);
+    for (;;) {
+        uint64_t t0 = now_ns();
+
+        for (uint32_t i = 0; i < iters; i++) {
+            if (k->restore != 0) {
+                run_copy(k->restore);
+            }
+            k->run(fft_size);
+        }
+
+        if (now_ns() - t0 >= BENCH_MIN_NS || iters >= (1U << 24)) {
+            break;
+        }
+        iters *= 2U;
+    }
+
+    result = measure(k, fft_size, iters, 1);
+
+    if (k->restore != 0) {
+        bench_result_t copy = measure(k, fft_size, iters, 0);
+
+        result.ns = (result.ns > copy.ns) ? result.ns - copy.ns : 0.0;
+        result.tsc = (result.tsc > copy.tsc) ? result.tsc - copy.tsc : 0.0;
+        result.cycles = (result.cycles > copy.cycles) ? result.cycles - copy.cycles : 0.0;
+    }
+
+    return result;
+}
+
+/* ========================================================================= */
+/* Main                                                                      */
+/* ========================================================================= */
+
+int main(int argc, char **argv)
+{
+    const char *json_path = NULL;
+    FILE *json = NULL;
+    int first = 1;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-o") == 0 && i + 1 < argc) {
+            json_path = argv[++i];
+        } else {
+            fprintf(stderr, "usage: %s [-o results.json]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    if (json_path != NULL) {
+        json = fopen(json_path, "w");
+        if (json == NULL) {
+            perror(json_path);
+            return 1;
+        }
+        fprintf(json, "{\n  \"results\": [");
+    }
+
+    perf_open();
+
+    printf("backend %s\n", RFFT_Q15_BACKEND);
+    printf("%-20s %5s %-11s %12s %12s %12s\n",
+           "kernel", "len", "input", "ns/op", "tsc/op", "cycles/op");
+
+    for (uint32_t fft_size = RFFT_Q15_MIN_FFT_LEN; fft_size <= RFFT_Q15_MAX_FFT_LEN; fft_size *= 2U) {
+#if defined(BENCH_TOP_BINS)
+        const bench_kernel_t kernels[] = {
+            { "find_fft_top_bins", fft_size, 0, run_top_bins },
+        };
+#else
+        const bench_kernel_t kernels[] = {
+            { "arm_rfft_q15", fft_size, fft_size, run_rfft },
+            { "arm_cfft_q15", fft_size / 2U, fft_size, run_cfft },
+            { "arm_bitreversal_16", fft_size / 2U, 0, run_bitrev },
+        };
+#endif
+
+        for (uint32_t k = 0; k < sizeof(kernels) / sizeof(kernels[0]); k++) {
+            for (int type = 0; type < NUM_INPUTS; type++) {
+                bench_result_t r;
+
+                fill_input((input_type_t) type, 2U * fft_size);
+                r = bench(&kernels[k], fft_size);
+
+                printf("%-20s %5u %-11s %12.1f %12.1f", kernels[k].name,
+                       kernels[k].len, input_names[type], r.ns, r.tsc);
+                if (perf_fd >= 0) {
+                    printf(" %12.1f\n", r.cycles);
+                } else {
+                    printf(" %12s\n", "-");
+                }
+
+                if (json != NULL) {
+                    fprintf(json, "%s\n    {\"kernel\": \"%s\", \"backend\": \"%s\", "
+                            "\"len\": %u, \"input\": \"%s\", "
+                            "\"ns\": %.1f, \"tsc\": %.1f, \"cycles\": ",
+                            first ? "" : ",", kernels[k].name, RFFT_Q15_BACKEND,
+                            kernels[k].len, input_names[type], r.ns, r.tsc);
+                    if (perf_fd >= 0) {
+                        fprintf(json, "%.1f}", r.cycles);
+                    } else {
+                        fprintf(json, "null}");
+                    }
+                    first = 0;
+                }
+            }
+        }
+    }
+
+    if (json != NULL) {
+        fprintf(json, "\n  ]\n}\n");
+        fclose(json);
+    }
+
+    return 0;
+}
@@ -0,0 +1,11 @@
+/*
+ * Host stand-in for <zephyr/kernel.h>, for FLPR modules that include it
+ * only for the macros of <zephyr/sys/util.h>.
+ */
+
+#ifndef HOST_ZEPHYR_KERNEL_H
+#define HOST_ZEPHYR_KERNEL_H
+
+#include <zephyr/sys/util.h>
+
+#endif /* HOST_ZEPHYR_KERNEL_H */
@@ -0,0 +1,20 @@
+/*
+ * Host stand-in for <zephyr/sys/util.h>: the few macros of it the FLPR
+ * modules under test/test_*.c use, with the meaning Zephyr gives them.
+ */
+
+#ifndef HOST_ZEPHYR_SYS_UTIL_H
+#define HOST_ZEPHYR_SYS_UTIL_H
+
+#define BIT(n) (1UL << (n))
+
+#define MIN(a, b) (((a) < (b)) ? (a) : (b))
+#define MAX(a, b) (((a) > (b)) ? (a) : (b))
+
+#define ARRAY_SIZE(array) (sizeof(array) / sizeof((array)[0]))
+
+#define ARG_UNUSED(x) (void)(x)
+
+#define BUILD_ASSERT(cond, msg) _Static_assert(cond, msg)
+
+#endif /* HOST_ZEPHYR_SYS_UTIL_H */
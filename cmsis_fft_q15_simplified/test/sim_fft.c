@@ -0,0 +1,223 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library - Simplified Q15 RFFT
+ * Title:        sim_fft.c
+ * Description:  Bare-metal FLPR benchmark scenarios for instruction counting
+ *
+ * Target Processor: nRF54L15 FLPR (RV32EMC, simulated)
+ * -------------------------------------------------------------------- */
+
+/*
+ * Built by the sim target of the Makefile with the compiler and flags of
+ * the remote core, -march=rv32emc -O3 -flto, linked by test/sim_rv32.ld
+ * and run on the virt machine of qemu-system-riscv32 with every executed
+ * instruction logged. test/sim_profile.py counts the instructions, loads
+ * and stores of every function between sim_count_start() and
+ * sim_count_stop(), one scenario at a time.
+ *
+ * The scenarios are the kernels, arm_rfft_q15(), arm_cfft_q15() and
+ * arm_rfft_q15_bfp(), and the matrix of fft_bench.c on the target:
+ * fft_context_execute() of every top bins count with a rectangular
+ * window, and of 20 top bins with a Hann window, warm and cold. Warm
+ * scenarios run once before they are counted, so they start on set up
+ * state as the median of fft_bench.c does.
+ *
+ * Each scenario prints a line on the UART before it runs, its name, and
+ * one after, a checksum of its output, which the profile keeps to tell a
+ * change of the results from one of the code:
+ *
+ *     sim,<kernel>,<len>,<window>,<top_bins>,<warm|cold>
+ *     sim_done,<checksum>
+ *
+ * The sifive_test device ends the simulation; the exit status of QEMU is
+ * that of main(), the number of contexts that failed to set up.
+ */
+
+#include "fft_utils.h"
+
+#include <stdint.h>
+#include <string.h>
+
+/* Devices of the QEMU virt machine */
+#define SIM_UART_THR ((volatile uint8_t *)0x10000000U)
+#define SIM_TEST_DEV ((volatile uint32_t *)0x00100000U)
+#define SIM_TEST_PASS 0x5555U
+#define SIM_TEST_FAIL 0x3333U
+
+#define SIM_TOP_N 20
+
+/* noipa keeps the markers called, and apart, at -O3 with LTO */
+#define SIM_MARKER __attribute__((noipa, used))
+
+static const uint16_t sim_top_bins[] = { 1, SIM_TOP_N, FFT_TOP_BINS_MAX };
+
+static q15_t input[RFFT_Q15_MAX_FFT_LEN];
+static q15_t buffer[2 * RFFT_Q15_MAX_FFT_LEN] RFFT_Q15_ALIGN;
+static q15_t output[2 * RFFT_Q15_MAX_FFT_LEN] RFFT_Q15_ALIGN;
+static q15_t work[RFFT_Q15_MAX_FFT_LEN] RFFT_Q15_ALIGN;
+static q15_t window[FFT_WINDOW_TABLE_LEN(RFFT_Q15_MAX_FFT_LEN)];
+static spectral_peak_t peaks[FFT_TOP_BINS_MAX];
+static uint16_t top_bins[FFT_TOP_BINS_MAX];
+static fft_context_t ctx;
+static uint32_t failures;
+
+/* Counting starts when this is called... */
+SIM_MARKER void sim_count_start(void)
+{
+    __asm__ volatile ("" ::: "memory");
+}
+
+/* ...and stops when this is */
+SIM_MARKER void sim_count_stop(void)
+{
+    __asm__ volatile ("" ::: "memory");
+}
+
+static void uart_puts(const char *s)
+{
+    while (*s != '\0') {
+        *SIM_UART_THR = (uint8_t)*s++;
+    }
+}
+
+static void uart_putu(uint32_t v, uint32_t base)
+{
+    char digits[11];
+    uint32_t i = sizeof(digits);
+
+    digits[--i] = '\0';
+    do {
+        digits[--i] = "0123456789abcdef"[v % base];
+        v /= base;
+    } while (v != 0U);
+
+    uart_puts(&digits[i]);
+}
+
+/* FNV-1a of the output of a scenario */
+static uint32_t checksum(const void *data, uint32_t bytes)
+{
+    const uint8_t *p = (const uint8_t *)data;
+    uint32_t h = 2166136261U;
+
+    for (uint32_t i = 0; i < bytes; i++) {
+        h = (h ^ p[i]) * 16777619U;
+    }
+
+    return h;
+}
+
+/* The same pseudo-random frame as fft_bench.c, a tone on noise */
+static void fill_input(void)
+{
+    uint32_t seed = 12345U;
+
+    for (uint32_t i = 0; i < RFFT_Q15_MAX_FFT_LEN; i++) {
+        seed = seed * 1103515245U + 12345U;
+        input[i] = (q15_t)(((i & 16U) ? 8192 : -8192) + (int16_t)(seed >> 16) / 8);
+    }
+}
+
+static void begin(const char *kernel, uint32_t fft_size, const char *window_name,
+                  uint32_t num_top_bins, const char *run)
+{
+    uart_puts("sim,");
+    uart_puts(kernel);
+    uart_puts(",");
+    uart_putu(fft_size, 10U);
+    uart_puts(",");
+    uart_puts(window_name);
+    uart_puts(",");
+    uart_putu(num_top_bins, 10U);
+    uart_puts(",");
+    uart_puts(run);
+    uart_puts("\n");
+}
+
+static void end(const void *result, uint32_t bytes)
+{
+    uart_puts("sim_done,");
+    uart_putu(checksum(result, bytes), 16U);
+    uart_puts("\n");
+}
+
+static void run_kernels(uint32_t fft_size)
+{
+    const arm_rfft_instance_q15 *S = rfft_q15_get_instance(fft_size);
+
+    begin("rfft", fft_size, "-", 0U, "warm");
+    memcpy(buffer, input, fft_size * sizeof(q15_t));
+    sim_count_start();
+    arm_rfft_q15(S, buffer, output);
+    sim_count_stop();
+    end(output, 2U * fft_size * sizeof(q15_t));
+
+    begin("cfft", fft_size, "-", 0U, "warm");
+    memcpy(buffer, input, fft_size * sizeof(q15_t));
+    sim_count_start();
+    arm_cfft_q15(S->pCfft, buffer, 0U, 1U);
+    sim_count_stop();
+    end(buffer, fft_size * sizeof(q15_t));
+
+    begin("rfft_bfp", fft_size, "-", 0U, "warm");
+    memcpy(buffer, input, fft_size * sizeof(q15_t));
+    sim_count_start();
+    int32_t exponent = arm_rfft_q15_bfp(S, buffer, output);
+    sim_count_stop();
+    output[0] ^= (q15_t)exponent;
+    end(output, 2U * fft_size * sizeof(q15_t));
+}
+
+static void setup(uint32_t fft_size, fft_window_type_t type)
+{
+    if (fft_context_init(&ctx, (uint16_t)fft_size, work, peaks, FFT_TOP_BINS_MAX) != RFFT_SUCCESS ||
+        fft_context_set_window(&ctx, type, window) != RFFT_SUCCESS) {
+        failures++;
+    }
+}
+
+static void run_top_bins(uint32_t fft_size, fft_window_type_t type, const char *window_name,
+                         uint16_t num_top_bins, int cold)
+{
+    begin("top_bins", fft_size, window_name, num_top_bins, cold ? "cold" : "warm");
+
+    setup(fft_size, type);
+    if (!cold) {
+        fft_context_execute(&ctx, input, top_bins, num_top_bins);
+    }
+
+    sim_count_start();
+    if (cold) {
+        setup(fft_size, type);
+    }
+    fft_context_execute(&ctx, input, top_bins, num_top_bins);
+    sim_count_stop();
+
+    end(top_bins, num_top_bins * sizeof(uint16_t));
+}
+
+int main(void)
+{
+    fill_input();
+    rfft_q15_twiddles_init();
+
+    for (uint32_t n = RFFT_Q15_MIN_FFT_LEN; n <= RFFT_Q15_MAX_FFT_LEN; n *= 2U) {
+        run_kernels(n);
+
+        for (uint32_t k = 0; k < sizeof(sim_top_bins) / sizeof(sim_top_bins[0]); k++) {
+            run_top_bins(n, FFT_WINDOW_RECT, "rect", sim_top_bins[k], 0);
+        }
+        run_top_bins(n, FFT_WINDOW_HANN, "hann", SIM_TOP_N, 0);
+        run_top_bins(n, FFT_WINDOW_HANN, "hann", SIM_TOP_N, 1);
+    }
+
+    return (int)failures;
+}
+
+/* Called by the startup code of test/sim_crt0.S with the status of main() */
+void sim_exit(int status)
+{
+    *SIM_TEST_DEV = (status == 0) ? SIM_TEST_PASS : (((uint32_t)status << 16) | SIM_TEST_FAIL);
+
+    for (;;) {
+    }
+}
@@ -0,0 +1,240 @@
+#!/usr/bin/env python3
+"""
+Instruction counts of the FLPR build, per scenario and function, under QEMU
+
+The sim target of the Makefile builds test/sim_fft.c and the library for
+RV32EMC with the flags of the remote core and runs it here:
+
+    python3 test/sim_profile.py run -o build/sim.json build/sim/sim_fft.elf
+
+QEMU runs one instruction per translation block and logs each block it
+executes, so every line of the log is one instruction retired. Between
+the calls of sim_count_start() and sim_count_stop() every instruction is
+counted against the function of its address in the disassembly, and a
+load or a store is an instruction that is one. The scenario names and
+output checksums come over the UART, in the same order.
+
+The counts are those of the instruction set, not cycles: QEMU models no
+pipeline, no wait states of the RRAM and no cache, and they are the same
+on every host. Given an older file, every scenario with more
+instructions or memory accesses, by more than the threshold, is listed
+with the functions that grew and the exit status is 1:
+
+    python3 test/sim_profile.py compare baseline.json build/sim.json
+"""
+
+import argparse
+import json
+import os
+import re
+import shlex
+import subprocess
+import sys
+import tempfile
+
+LOADS = {'lb', 'lh', 'lw', 'lbu', 'lhu', 'c.lw', 'c.lwsp'}
+STORES = {'sb', 'sh', 'sw', 'c.sw', 'c.swsp'}
+
+FUNCTION = re.compile(r'^([0-9a-f]+) <(.+)>:$')
+INSTRUCTION = re.compile(r'^\s*([0-9a-f]+):\t[0-9a-f ]+\t(\S+)')
+
+
+def disassemble(objdump, elf):
+    """Function and kind, 'load', 'store' or None, of every instruction address"""
+    out = subprocess.run([objdump, '-d', '-M', 'no-aliases', elf], check=True,
+                         capture_output=True, text=True).stdout
+    code = {}
+    function = None
+    for line in out.splitlines():
+        m = FUNCTION.match(line)
+        if m:
+            function = m.group(2)
+            continue
+        m = INSTRUCTION.match(line)
+        if m and function is not None:
+            mnemonic = m.group(2)
+            kind = 'load' if mnemonic in LOADS else 'store' if mnemonic in STORES else None
+            code[int(m.group(1), 16)] = (function, kind)
+    return code
+
+
+def entry(code, name):
+    """Lowest address of a function"""
+    addresses = [a for a, (f, _) in code.items() if f == name]
+    if not addresses:
+        raise SystemExit(f'{name}() not in the disassembly')
+    return min(addresses)
+
+
+def trace(args, console):
+    """Executed instruction addresses, one per line of the QEMU log"""
+    cmd = [args.qemu, '-machine', 'virt', '-bios', 'none', '-nographic', '-monitor', 'none',
+           '-serial', f'file:{console}', '-d', 'exec,nochain', '-D', '/dev/stdout',
+           *shlex.split(args.qemu_flags), '-kernel', args.elf]
+    proc = subprocess.Popen(cmd, stdout=subprocess.PIPE, text=True, bufsize=1 << 20)
+    for line in proc.stdout:
+        # Trace 0: 0x7f83c4000100 [00000000/80000104/00000000/ff000000]
+        if line.startswith('Trace'):
+            yield int(line.split('/', 2)[1], 16)
+    if proc.wait() != 0:
+        raise SystemExit(f'{args.elf} failed with status {proc.returncode}')
+
+
+def totals(counts):
+    return {field: sum(c[field] for c in counts.values())
+            for field in ('instructions', 'loads', 'stores')}
+
+
+def run(args):
+    code = disassemble(args.objdump, args.elf)
+    start = entry(code, 'sim_count_start')
+    stop = entry(code, 'sim_count_stop')
+    markers = {'sim_count_start', 'sim_count_stop'}
+
+    scenarios = []
+    counting = False
+    with tempfile.TemporaryDirectory() as tmp:
+        console = os.path.join(tmp, 'console.txt')
+        hits = {}
+        for pc in trace(args, console):
+            if pc == start:
+                counting = True
+                hits = {}
+            elif pc == stop:
+                counting = False
+                scenarios.append(hits)
+            elif counting:
+                hits[pc] = hits.get(pc, 0) + 1
+        with open(console) as f:
+            lines = f.read().splitlines()
+
+    names = [line.split(',')[1:] for line in lines if line.startswith('sim,')]
+    checksums = [line.split(',')[1] for line in lines if line.startswith('sim_done,')]
+    if not len(names) == len(checksums) == len(scenarios):
+        raise SystemExit(f'{len(names)} scenarios named, {len(checksums)} finished, '
+                         f'{len(scenarios)} counted')
+
+    results = []
+    for (kernel, length, window, top_bins, run_type), checksum, hits in zip(names, checksums,
+                                                                           scenarios):
+        functions = {}
+        for pc, n in hits.items():
+            function, kind = code.get(pc, ('?', None))
+            if function in markers:
+                continue
+            c = functions.setdefault(function, {'instructions': 0, 'loads': 0, 'stores': 0})
+            c['instructions'] += n
+            if kind is not None:
+                c[kind + 's'] += n
+        results.append({
+            'kernel': kernel,
+            'len': int(length),
+            'window': window,
+            'top_bins': int(top_bins),
+            'run': run_type,
+            **totals(functions),
+            'checksum': checksum,
+            'functions': dict(sorted(functions.items(), key=lambda f: -f[1]['instructions'])),
+        })
+
+    with open(args.output, 'w') as f:
+        json.dump({'elf': os.path.basename(args.elf), 'qemu_flags': args.qemu_flags,
+                   'results': results}, f, indent=2)
+        f.write('\n')
+
+    print(f"{'kernel':<9} {'len':>5} {'window':<6} {'top':>3} {'run':<4} "
+          f"{'instructions':>12} {'loads':>10} {'stores':>10}  hottest function")
+    for r in results:
+        hottest = next(iter(r['functions']), '-')
+        print(f"{r['kernel']:<9} {r['len']:>5} {r['window']:<6} {r['top_bins']:>3} {r['run']:<4} "
+              f"{r['instructions']:>12} {r['loads']:>10} {r['stores']:>10}  {hottest}")
+    print(f'Wrote {len(results)} scenarios to {args.output}')
+    return 0
+
+
+def key(r):
+    return (r['kernel'], r['len'], r['window'], r['top_bins'], r['run'])
+
+
+def case(r):
+    return f"{r['kernel']:<9} {r['len']:>5} {r['window']:<6} {r['top_bins']:>3} {r['run']:<4}"
+
+
+def growth(new, old):
+    return 100.0 * (new - old) / old if old else (0.0 if new == 0 else float('inf'))
+
+
+def compare(args):
+    with open(args.baseline) as f:
+        old = {key(r): r for r in json.load(f)['results']}
+    with open(args.current) as f:
+        new = json.load(f)['results']
+
+    worse = []
+    changed = 0
+    missing = 0
+    for r in new:
+        base = old.get(key(r))
+        if base is None:
+            missing += 1
+            continue
+        if r['checksum'] != base['checksum']:
+            changed += 1
+        insns = growth(r['instructions'], base['instructions'])
+        accesses = growth(r['loads'] + r['stores'], base['loads'] + base['stores'])
+        if insns > args.threshold or accesses > args.threshold:
+            worse.append((r, base, insns, accesses))
+
+    for r, base, insns, accesses in worse:
+        print(f"  {case(r)} instructions {base['instructions']} -> {r['instructions']} "
+              f"({insns:+.1f}%), memory accesses {accesses:+.1f}%")
+        names = set(r['functions']) | set(base['functions'])
+        zero = {'instructions': 0}
+        deltas = sorted(((r['functions'].get(n, zero)['instructions'] -
+                          base['functions'].get(n, zero)['instructions'], n) for n in names),
+                        reverse=True)
+        for delta, name in deltas[:3]:
+            if delta > 0:
+                print(f'      {name}: +{delta}')
+
+    if missing:
+        print(f'{missing} scenarios not in {args.baseline}')
+    if changed:
+        print(f'{changed} scenarios with an output checksum other than in {args.baseline}')
+
+    if worse:
+        print(f'✗ {len(worse)} of {len(new)} scenarios more than {args.threshold}% '
+              f'above {args.baseline}')
+        return 1
+
+    print(f'✓ No scenario more than {args.threshold}% above {args.baseline}')
+    return 0
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    sub = parser.add_subparsers(dest='command', required=True)
+
+    p = sub.add_parser('run', help='run test/sim_fft.c under QEMU and count its instructions')
+    p.add_argument('elf')
+    p.add_argument('-o', '--output', required=True)
+    p.add_argument('--qemu', default='qemu-system-riscv32')
+    p.add_argument('--objdump', default='riscv64-zephyr-elf-objdump')
+    p.add_argument('--qemu-flags', default='-accel tcg,one-insn-per-tb=on',
+                   help='one instruction per block, -singlestep before QEMU 8.1')
+    p.set_defaults(func=run)
+
+    p = sub.add_parser('compare', help='list scenarios above a baseline')
+    p.add_argument('baseline')
+    p.add_argument('current')
+    p.add_argument('--threshold', type=float, default=1.0,
+                   help='percent of growth that counts (default 1)')
+    p.set_defaults(func=compare)
+
+    args = parser.parse_args()
+    return args.func(args)
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,161 @@
+#!/usr/bin/env python3
+"""
+Worst-case stack depth of the library's entry points
+
+The stack-usage target of the Makefile compiles every source of the FFT
+path with -fstack-usage -fcallgraph-info=su, which writes the frame size
+of each function and the calls it makes into a .ci file per object.
+This joins them into one call graph and walks it from every entry point,
+an externally visible function, down its deepest chain of calls:
+
+    python3 test/stack_usage.py --limit 1024 build/stack/*.ci
+
+The check fails, with exit status 1, when an entry point needs more than
+the limit, when a frame on its way is dynamic, a VLA or alloca(), whose
+size no build can bound, or when a chain recurses. Indirect calls, such
+as the CFFT callback of a context, and calls to functions of no .ci
+file, such as memcpy(), are not followed and are marked in the table;
+they come on top of the depth shown.
+
+The frames are those of the compiler and flags of the build, without
+LTO, which may merge frames across files: run it with the FLPR's
+toolchain for the FLPR's numbers.
+"""
+
+import argparse
+import json
+import re
+import sys
+
+NODE = re.compile(r'node: \{ title: "([^"]+)" label: "([^"]*)"')
+EDGE = re.compile(r'edge: \{ sourcename: "([^"]+)" targetname: "([^"]+)"')
+FRAME = re.compile(r'\\n(\d+) bytes \(([a-z,]+)\)')
+
+INDIRECT = '__indirect_call'
+
+
+def read_graph(paths):
+    """Frame size and qualifier of every function defined, and its callees"""
+    frames = {}
+    calls = {}
+
+    for path in paths:
+        with open(path) as f:
+            text = f.read()
+        for title, label in NODE.findall(text):
+            m = FRAME.search(label)
+            if m:
+                frames[title] = (int(m.group(1)), m.group(2))
+        for source, target in EDGE.findall(text):
+            calls.setdefault(source, set()).add(target)
+
+    return frames, calls
+
+
+def name(title):
+    """Function name of a node, static functions are titled file:name"""
+    return title.rsplit(':', 1)[-1]
+
+
+def analyze(frames, calls):
+    """Deepest chain of every function, with what the walk could not follow"""
+    memo = {}
+
+    def walk(title, active):
+        if title in memo:
+            return memo[title]
+        if title in active:
+            return {'depth': 0, 'path': [name(title)], 'recursive': [name(title)],
+                    'indirect': False, 'unknown': set(), 'dynamic': []}
+
+        size, qualifier = frames[title]
+        active.add(title)
+        result = {'depth': size, 'path': [name(title)], 'recursive': [], 'indirect': False,
+                  'unknown': set(), 'dynamic': [name(title)] if qualifier == 'dynamic' else []}
+        deepest = None
+        for callee in sorted(calls.get(title, ())):
+            if callee == INDIRECT:
+                result['indirect'] = True
+                continue
+            if callee not in frames:
+                result['unknown'].add(callee)
+                continue
+            sub = walk(callee, active)
+            result['recursive'] += sub['recursive']
+            result['indirect'] |= sub['indirect']
+            result['unknown'] |= sub['unknown']
+            result['dynamic'] += [d for d in sub['dynamic'] if d not in result['dynamic']]
+            if deepest is None or sub['depth'] > deepest['depth']:
+                deepest = sub
+        if deepest is not None:
+            result['depth'] += deepest['depth']
+            result['path'] += deepest['path']
+        active.discard(title)
+
+        # A result inside a cycle depends on where the walk entered it
+        if not result['recursive']:
+            memo[title] = result
+        return result
+
+    return {title: walk(title, set()) for title in frames}
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('ci', nargs='+', help='.ci files of -fcallgraph-info=su')
+    parser.add_argument('--limit', type=int, default=0,
+                        help='bytes an entry point may need, 0 for no limit')
+    parser.add_argument('--entry', action='append',
+                        help='entry points to check, all external functions if none')
+    parser.add_argument('--top', type=int, default=25, help='entry points listed')
+    parser.add_argument('-o', '--output', help='write the depth of every entry point as JSON')
+    args = parser.parse_args()
+
+    frames, calls = read_graph(args.ci)
+    results = analyze(frames, calls)
+    entries = {t: r for t, r in results.items() if ':' not in t}
+    if args.entry:
+        missing = [e for e in args.entry if e not in entries]
+        if missing:
+            raise SystemExit(f"no entry point {', '.join(missing)} in the call graph")
+        entries = {e: entries[e] for e in args.entry}
+
+    ranked = sorted(entries.items(), key=lambda e: (-e[1]['depth'], e[0]))
+    print(f"{'entry point':<40} {'bytes':>6}  deepest chain")
+    for title, r in ranked[:args.top]:
+        marks = ('*' if r['indirect'] else '') + ('+' if r['unknown'] else '')
+        print(f"{title:<40} {r['depth']:>6}{marks:<2} {' > '.join(r['path'])}")
+    print("* indirect calls not followed, + calls out of the library "
+          "(memcpy() and the like) not followed")
+
+    if args.output:
+        with open(args.output, 'w') as f:
+            json.dump({t: {'depth': r['depth'], 'path': r['path'], 'indirect': r['indirect'],
+                           'unknown': sorted(r['unknown'])} for t, r in ranked}, f, indent=2)
+            f.write('\n')
+
+    failed = 0
+    for title, r in ranked:
+        if r['dynamic']:
+            print(f"✗ {title}: dynamic stack frame in {', '.join(r['dynamic'])}")
+            failed += 1
+        if r['recursive']:
+            print(f"✗ {title}: recursion through {', '.join(sorted(set(r['recursive'])))}")
+            failed += 1
+        if args.limit and r['depth'] > args.limit:
+            print(f"✗ {title}: {r['depth']} bytes of stack, over the limit of {args.limit}")
+            failed += 1
+
+    if failed:
+        return 1
+
+    deepest = ranked[0] if ranked else ('-', {'depth': 0})
+    limit = f', within {args.limit} bytes' if args.limit else ''
+    print(f'✓ {len(ranked)} entry points, the deepest {deepest[0]} with '
+          f"{deepest[1]['depth']} bytes{limit}, no dynamic frames, no recursion")
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,295 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library - Simplified Q15 RFFT
+ * Title:        test_bfp.c
+ * Description:  Tests for the block floating point CFFT and RFFT
+ *
+ * Target Processor: nRF54L15 FLPR (PC validation)
+ * -------------------------------------------------------------------- */
+
+#include "../include/rfft_q15.h"
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#define FFT_LEN 4096
+
+static q15_t input[FFT_LEN] RFFT_Q15_ALIGN;
+static q15_t work[2 * FFT_LEN] RFFT_Q15_ALIGN;
+static q15_t output[2 * FFT_LEN] RFFT_Q15_ALIGN;
+static double exact[2 * FFT_LEN];
+
+/* Test result tracking */
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+/* Test assertion macro */
+#define TEST_ASSERT(condition, message) \
+    do { \
+        if (condition) { \
+            printf("  ✓ %s\n", message); \
+            tests_passed++; \
+        } else { \
+            printf("  ✗ %s\n", message); \
+            tests_failed++; \
+        } \
+    } while(0)
+
+/* Test section header */
+#define TEST_SECTION(name) \
+    printf("\n=== %s ===\n", name)
+
+static const double pi = 3.14159265358979323846;
+
+/* Two tones of amplitude level and level / 4 with a little pseudo-random noise */
+static void fill_signal(uint32_t n, double level)
+{
+    uint32_t seed = 12345U;
+
+    for (uint32_t i = 0; i < n; i++) {
+        seed = seed * 1103515245U + 12345U;
+        input[i] = (q15_t) floor(level * sin(2.0 * pi * 37.0 * i / n) +
+                                 level / 4.0 * cos(2.0 * pi * 301.0 * i / n) +
+                                 (double) ((seed >> 16) & 7U) - 3.5 + 0.5);
+    }
+}
+
+/* Double precision DFT of input, bins 0 to n / 2 */
+static void reference_dft(uint32_t n)
+{
+    for (uint32_t k = 0; k <= n / 2U; k++) {
+        double re = 0.0, im = 0.0;
+
+        for (uint32_t i = 0; i < n; i++) {
+            double phase = 2.0 * pi * (double) ((k * i) % n) / n;
+            re += input[i] * cos(phase);
+            im -= input[i] * sin(phase);
+        }
+        exact[2U * k] = re;
+        exact[2U * k + 1U] = im;
+    }
+}
+
+/* SNR in dB of output * 2^exponent against exact, bins 0 to n / 2 */
+static double snr_db(uint32_t n, int32_t exponent)
+{
+    double scale = ldexp(1.0, exponent);
+    double signal = 0.0, noise = 0.0;
+
+    for (uint32_t i = 0; i < n + 2U; i++) {
+        double e = output[i] * scale - exact[i];
+        signal += exact[i] * exact[i];
+        noise += e * e;
+    }
+
+    return 10.0 * log10(signal / noise);
+}
+
+/**
+ * @brief The returned exponent scales the output to the unscaled DFT
+ */
+static void test_exponent(void)
+{
+    const arm_rfft_instance_q15 *S = rfft_q15_get_instance(FFT_LEN);
+    int32_t e;
+
+    TEST_SECTION("Block Floating Point - Exponent");
+
+    /* DC of 8: X[0] = 8 * 4096 = 2^15, one bit over Q15 */
+    for (uint32_t i = 0; i < FFT_LEN; i++) {
+        work[i] = 8;
+    }
+    e = arm_rfft_q15_bfp(S, work, output);
+    TEST_ASSERT(fabs(ldexp(output[0], e) - 32768.0) <= ldexp(1.0, e),
+                "output[0] * 2^e is the DC sum of 8 * 4096");
+    TEST_ASSERT(e <= 2, "DC of 8 keeps all but a few bits");
+
+    /* Full scale DC ends up at the fixed format of arm_rfft_q15() */
+    for (uint32_t i = 0; i < FFT_LEN; i++) {
+        work[i] = 32767;
+    }
+    e = arm_rfft_q15_bfp(S, work, output);
+    TEST_ASSERT(fabs(ldexp(output[0], e) - 32767.0 * FFT_LEN) <= ldexp(4.0, e),
+                "output[0] * 2^e is the full scale DC sum");
+    TEST_ASSERT(e >= 12 && e <= 13, "Full scale DC needs 12 to 13 bits of scaling");
+
+    /* Zero input is not scaled at all */
+    memset(work, 0, sizeof(work));
+    e = arm_rfft_q15_bfp(S, work, output);
+    TEST_ASSERT(e == 1 && output[0] == 0 && output[FFT_LEN] == 0,
+                "Zero input returns the split step exponent only");
+
+    /* Worst case: alternating full scale, everything lands in one bin */
+    for (uint32_t i = 0; i < FFT_LEN; i++) {
+        work[i] = (i & 1U) ? -32768 : 32767;
+    }
+    e = arm_rfft_q15_bfp(S, work, output);
+    TEST_ASSERT(fabs(ldexp(output[FFT_LEN], e) - 32767.5 * FFT_LEN) <= ldexp(4.0, e),
+                "Nyquist bin of a full scale alternating input does not overflow");
+}
+
+/**
+ * @brief Low level inputs keep their resolution, full scale ones are no worse
+ */
+static void test_snr(void)
+{
+    static const double levels[] = { 64.0, 512.0, 4096.0, 20000.0 };
+    const arm_rfft_instance_q15 *S = rfft_q15_get_instance(FFT_LEN);
+    char message[96];
+
+    TEST_SECTION("Block Floating Point - SNR against a double DFT");
+
+    for (size_t l = 0; l < sizeof(levels) / sizeof(levels[0]); l++) {
+        double fixed, bfp;
+        int32_t e;
+
+        fill_signal(FFT_LEN, levels[l]);
+        reference_dft(FFT_LEN);
+
+        memcpy(work, input, sizeof(input));
+        arm_rfft_q15(S, work, output);
+        fixed = snr_db(FFT_LEN, 12);
+
+        memcpy(work, input, sizeof(input));
+        e = arm_rfft_q15_bfp(S, work, output);
+        bfp = snr_db(FFT_LEN, e);
+
+        printf("  level %5.0f: fixed %5.1f dB, block floating point %5.1f dB (e = %d)\n",
+               levels[l], fixed, bfp, (int) e);
+
+        snprintf(message, sizeof(message), "Level %.0f: block floating point SNR >= fixed",
+                 levels[l]);
+        TEST_ASSERT(bfp >= fixed - 0.5, message);
+
+        if (levels[l] <= 512.0) {
+            snprintf(message, sizeof(message), "Level %.0f: at least 20 dB better than fixed",
+                     levels[l]);
+            TEST_ASSERT(bfp >= fixed + 20.0, message);
+        }
+    }
+}
+
+/**
+ * @brief Every CFFT length matches a double DFT, forward and inverse
+ */
+static void test_cfft_lengths(void)
+{
+    char message[96];
+
+    TEST_SECTION("Block Floating Point - CFFT Lengths");
+
+    for (uint32_t n = RFFT_Q15_MIN_FFT_LEN / 2U; n <= RFFT_Q15_MAX_FFT_LEN / 2U; n *= 2U) {
+        const arm_cfft_instance_q15 *C = rfft_q15_get_instance(2U * n)->pCfft;
+
+        for (uint8_t inverse = 0; inverse <= 1U; inverse++) {
+            double worst = 0.0;
+            int32_t e;
+
+            for (uint32_t i = 0; i < 2U * n; i++) {
+                work[i] = (q15_t) (300.0 * sin(0.37 * i) + 200.0 * cos(2.0 * pi * 5.0 * i / n));
+            }
+            memcpy(output, work, 2U * n * sizeof(q15_t));
+            e = arm_cfft_q15_bfp(C, output, inverse, 1U);
+
+            for (uint32_t k = 0; k < n; k++) {
+                double re = 0.0, im = 0.0;
+                double sign = inverse ? 1.0 : -1.0;
+
+                for (uint32_t i = 0; i < n; i++) {
+                    double phase = 2.0 * pi * (double) ((k * i) % n) / n;
+                    re += work[2U * i] * cos(phase) - sign * work[2U * i + 1U] * sin(phase);
+                    im += work[2U * i + 1U] * cos(phase) + sign * work[2U * i] * sin(phase);
+                }
+                re = fabs(ldexp(output[2U * k], e) - re);
+                im = fabs(ldexp(output[2U * k + 1U], e) - im);
+                worst = fmax(worst, fmax(re, im));
+            }
+
+            /* A few output LSBs of rounding per stage */
+            snprintf(message, sizeof(message), "%u-point %s CFFT within %d LSBs of the DFT",
+                     (unsigned) n, inverse ? "inverse" : "forward", 8);
+            TEST_ASSERT(worst <= ldexp(8.0, e), message);
+        }
+    }
+}
+
+/**
+ * @brief Packed forward and inverse, the building blocks of FFT filtering
+ */
+static void test_packed(void)
+{
+    static const double levels[] = { 64.0, 20000.0 };
+    const arm_rfft_instance_q15 *S = rfft_q15_get_instance(FFT_LEN);
+    char message[96];
+    int32_t e, ep;
+    int same = 1;
+
+    TEST_SECTION("Block Floating Point - Packed Layout");
+
+    fill_signal(FFT_LEN, 4096.0);
+    memcpy(work, input, sizeof(input));
+    e = arm_rfft_q15_bfp(S, work, output);
+    memcpy(work, input, sizeof(input));
+    ep = arm_rfft_q15_packed_bfp(S, work);
+
+    for (uint32_t i = 2; i < FFT_LEN; i++) {
+        same &= (work[i] == output[i]);
+    }
+    TEST_ASSERT(ep == e && same && work[0] == output[0] && work[1] == output[FFT_LEN],
+                "Packed forward matches arm_rfft_q15_bfp()");
+
+    /* DC of 1000 and nothing else comes back as 1000 */
+    for (uint32_t i = 0; i < FFT_LEN; i++) {
+        work[i] = 1000;
+    }
+    e = arm_rfft_q15_packed_bfp(S, work);
+    e += arm_rifft_q15_packed_bfp(S, work);
+    TEST_ASSERT(fabs(ldexp(work[0], e) / FFT_LEN - 1000.0) <= 1.0 &&
+                fabs(ldexp(work[FFT_LEN - 1U], e) / FFT_LEN - 1000.0) <= 1.0,
+                "Round trip exponents add up to the input level");
+
+    for (size_t l = 0; l < sizeof(levels) / sizeof(levels[0]); l++) {
+        double signal = 0.0, noise = 0.0, snr;
+
+        fill_signal(FFT_LEN, levels[l]);
+        memcpy(work, input, sizeof(input));
+        e = arm_rfft_q15_packed_bfp(S, work);
+        e += arm_rifft_q15_packed_bfp(S, work);
+
+        for (uint32_t i = 0; i < FFT_LEN; i++) {
+            double d = ldexp(work[i], e) / FFT_LEN - input[i];
+            signal += (double) input[i] * input[i];
+            noise += d * d;
+        }
+        snr = 10.0 * log10(signal / noise);
+
+        printf("  level %5.0f: round trip %5.1f dB\n", levels[l], snr);
+        snprintf(message, sizeof(message), "Level %.0f: round trip SNR >= 35 dB", levels[l]);
+        TEST_ASSERT(snr >= 35.0, message);
+    }
+}
+
+/**
+ * @brief Main test runner
+ */
+int main(void) {
+    printf("=== Block Floating Point FFT Tests ===\n");
+
+    test_exponent();
+    test_snr();
+    test_cfft_lengths();
+    test_packed();
+
+    /* Print summary */
+    printf("\n=== Test Summary ===\n");
+    printf("Passed: %d\n", tests_passed);
+    printf("Failed: %d\n", tests_failed);
+    printf("Total:  %d\n", tests_passed + tests_failed);
+
+    if (tests_failed == 0) {
+        printf("\n✓ All block floating point tests pass!\n");
+        return 0;
+    } else {
+        printf("\n✗ Some tests failed!\n");
+        return 1;
+    }
+}
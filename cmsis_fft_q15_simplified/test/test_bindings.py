@@ -0,0 +1,128 @@
+#!/usr/bin/env python3
+"""
+In-process tests of the Python bindings in rfft_q15.py against NumPy
+
+Every RFFT length the library is built for runs random frames, tones in
+noise, straight from NumPy int16 arrays, with no files and no subprocess
+in between:
+
+- rfft() against np.fft.rfft() / n, by SNR, and the input left alone
+- rfft_batch() bit-exact against rfft() of each frame, in a copy and in place
+- top_bins() against the strongest bins of the rfft() output, bin 0 skipped
+
+Usage:
+    python3 test/test_bindings.py [--frames N] [--seed S] [--min-snr DB]
+
+Build the library first with `make pylib`, or run `make test-python`.
+"""
+
+import argparse
+import os
+import sys
+
+import numpy as np
+
+sys.path.insert(0, os.path.join(os.path.dirname(os.path.abspath(__file__)), ".."))
+import rfft_q15  # noqa: E402
+
+
+def random_frames(rng, count, n):
+    """count frames of 1 to 15 tones at 0.1 to 0.9 of full scale over noise"""
+    frames = np.empty((count, n), dtype=np.int16)
+    t = np.arange(n)
+
+    for i in range(count):
+        tones = rng.integers(1, 16)
+        bins = rng.uniform(1.0, n / 2 - 1, tones)
+        amps = rng.uniform(0.05, 1.05, tones)
+        phases = rng.uniform(0.0, 2 * np.pi, tones)
+        signal = (amps[:, None] * np.cos(2 * np.pi * bins[:, None] * t / n + phases[:, None])).sum(0)
+        signal *= rng.uniform(0.1, 0.9) * 32767.0 / amps.sum()
+        signal += rng.uniform(-0.5, 0.5, n) * np.abs(signal).max() * 10 ** (-rng.uniform(40, 80) / 20)
+        frames[i] = np.rint(signal)
+
+    return frames
+
+
+def spectrum(out, n):
+    """Bins 0 to n / 2 of an arm_rfft_q15() output"""
+    out = out.astype(np.float64)
+    return out[..., 0:n + 2:2] + 1j * out[..., 1:n + 2:2]
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--frames", type=int, default=200, help="random frames per length")
+    parser.add_argument("--seed", type=int, default=1)
+    parser.add_argument("--min-snr", type=float, default=12.0,
+                        help="SNR every frame must reach, as test_fft_batch -m")
+    args = parser.parse_args()
+
+    rng = np.random.default_rng(args.seed)
+    passed = 0
+    failed = 0
+
+    def check(condition, message):
+        nonlocal passed, failed
+        if condition:
+            print(f"  ✓ {message}")
+            passed += 1
+        else:
+            print(f"  ✗ {message}")
+            failed += 1
+
+    print("=== Python Bindings of the Q15 RFFT ===")
+
+    for n in rfft_q15.lengths():
+        print(f"\n=== {n}-point RFFT, {args.frames} frames ===")
+        frames = random_frames(rng, args.frames, n)
+        original = frames.copy()
+
+        out = np.stack([rfft_q15.rfft(x) for x in frames])
+        check(np.array_equal(frames, original), "rfft() leaves its input alone")
+
+        ref = np.fft.rfft(frames.astype(np.float64), axis=1) / n
+        err = spectrum(out, n) - ref
+        snr = 10 * np.log10((np.abs(ref) ** 2).sum(1) / np.maximum((np.abs(err) ** 2).sum(1), 1e-30))
+        check(snr.min() >= args.min_snr,
+              f"SNR against np.fft.rfft() / n: min {snr.min():.2f} dB, mean {snr.mean():.2f} dB")
+
+        check(np.array_equal(rfft_q15.rfft_batch(frames), out),
+              "rfft_batch() is bit-exact with rfft() of each frame")
+        in_place = frames.copy()
+        check(np.array_equal(rfft_q15.rfft_batch(in_place, overwrite_input=True), out),
+              "rfft_batch() in place is bit-exact as well")
+
+        k = min(20, n // 2)
+        mag_sq = (out[:, 0:n + 2:2].astype(np.int64) ** 2 + out[:, 1:n + 2:2].astype(np.int64) ** 2)
+        agree = 0
+        for i in range(args.frames):
+            top = rfft_q15.top_bins(frames[i], k)
+            # Ties may come in either order, their magnitudes may not
+            agree += np.array_equal(mag_sq[i, top], np.sort(mag_sq[i, 1:])[::-1][:k])
+        check(agree == args.frames, f"top_bins() are the {k} strongest bins: {agree}/{args.frames}")
+
+    print("\n=== Argument Checks ===")
+    for name, call, error in (
+        ("length not built in", lambda: rfft_q15.rfft(np.zeros(100, dtype=np.int16)), ValueError),
+        ("int32 buffer", lambda: rfft_q15.rfft(np.zeros(64, dtype=np.int32)), TypeError),
+        ("strided buffer", lambda: rfft_q15.rfft(np.zeros(128, dtype=np.int16)[::2]), TypeError),
+        ("too many top bins", lambda: rfft_q15.top_bins(np.zeros(256, dtype=np.int16), 65), ValueError),
+    ):
+        try:
+            call()
+            check(False, f"{name} raises {error.__name__}")
+        except error:
+            check(True, f"{name} raises {error.__name__}")
+
+    print("\n=== Test Summary ===")
+    print(f"Passed: {passed}")
+    print(f"Failed: {failed}")
+    print(f"Total:  {passed + failed}")
+
+    return 0 if failed == 0 else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())
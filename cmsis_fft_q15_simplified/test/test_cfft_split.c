@@ -0,0 +1,306 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library - Simplified Q15 RFFT
+ * Title:        test_cfft_split.c
+ * Description:  Tests for the CFFT split in two halves across the cores
+ *
+ * Target Processor: nRF54L15 FLPR (PC validation)
+ * -------------------------------------------------------------------- */
+
+#include "../include/rfft_q15.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#if RFFT_Q15_MIN_FFT_LEN != 32 || RFFT_Q15_MAX_FFT_LEN != 8192
+#error "test_cfft_split.c needs all lengths from 32 to 8192"
+#endif
+
+#define MAX_FFT_LEN 8192
+
+static q15_t input[MAX_FFT_LEN] RFFT_Q15_ALIGN;
+static q15_t split[2 * MAX_FFT_LEN] RFFT_Q15_ALIGN;
+static q15_t whole[2 * MAX_FFT_LEN] RFFT_Q15_ALIGN;
+static q15_t output[2 * MAX_FFT_LEN] RFFT_Q15_ALIGN;
+static uint32_t mag_split[MAX_FFT_LEN / 2 + 1];
+static uint32_t mag_whole[MAX_FFT_LEN / 2 + 1];
+static double exact[MAX_FFT_LEN + 2];
+
+/* Test result tracking */
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+/* Test assertion macro */
+#define TEST_ASSERT(condition, message) \
+    do { \
+        if (condition) { \
+            printf("  ✓ %s\n", message); \
+            tests_passed++; \
+        } else { \
+            printf("  ✗ %s\n", message); \
+            tests_failed++; \
+        } \
+    } while(0)
+
+/* Test section header */
+#define TEST_SECTION(name) \
+    printf("\n=== %s ===\n", name)
+
+static const double pi = 3.14159265358979323846;
+
+/* Three tones and pseudo-random noise, near full scale */
+static void fill_signal(uint32_t n, uint32_t seed)
+{
+    for (uint32_t i = 0; i < n; i++) {
+        seed = seed * 1103515245U + 12345U;
+        input[i] = (q15_t) floor(9000.0 * sin(2.0 * pi * 3.0 * i / n) +
+                                 6000.0 * cos(2.0 * pi * (n / 5.0 + 0.3) * i / n) +
+                                 3000.0 * sin(2.0 * pi * (n / 2.0 - 7.0) * i / n) +
+                                 (double) ((seed >> 16) & 0x3ffU) - 512.0);
+    }
+}
+
+static void store_mag_split(uint32_t bin, uint32_t mag_sq, void *user)
+{
+    (void) user;
+    mag_split[bin] = mag_sq;
+}
+
+static void store_mag_whole(uint32_t bin, uint32_t mag_sq, void *user)
+{
+    (void) user;
+    mag_whole[bin] = mag_sq;
+}
+
+/* The CFFT of S as coop_cfft() runs it: the first stage, then each half on its own */
+static void split_cfft(const arm_rfft_instance_q15 *S, q15_t *buffer)
+{
+    const arm_cfft_instance_q15 half = {
+        .fftLen = S->pCfft->fftLen >> 1,
+        .pTwiddle = S->pCfft->pTwiddle,
+    };
+
+    arm_cfft_q15_split(S->pCfft, buffer);
+    arm_cfft_q15_half(&half, buffer + S->pCfft->fftLen);
+    arm_cfft_q15_half(&half, buffer);
+}
+
+/* Largest difference of two q15 buffers */
+static int32_t max_diff(const q15_t *a, const q15_t *b, uint32_t n)
+{
+    int32_t worst = 0;
+
+    for (uint32_t i = 0; i < n; i++) {
+        int32_t d = abs((int32_t) a[i] - (int32_t) b[i]);
+        if (d > worst) {
+            worst = d;
+        }
+    }
+
+    return worst;
+}
+
+/* arm_cfft_q15() starts with the radix-2 stage of the split itself */
+static int starts_radix2(const arm_rfft_instance_q15 *S)
+{
+    return (__builtin_ctz(S->pCfft->fftLen) & 1) != 0;
+}
+
+/* Double precision DFT of input, bins 0 to n / 2 */
+static void reference_dft(uint32_t n)
+{
+    for (uint32_t k = 0; k <= n / 2U; k++) {
+        double re = 0.0, im = 0.0;
+
+        for (uint32_t i = 0; i < n; i++) {
+            double phase = 2.0 * pi * (double) ((k * i) % n) / n;
+            re += input[i] * cos(phase);
+            im -= input[i] * sin(phase);
+        }
+        exact[2U * k] = re;
+        exact[2U * k + 1U] = im;
+    }
+}
+
+/* SNR in dB of bins 0 to n / 2 against exact, at the scale that fits them best */
+static double snr_db(const q15_t *bins, uint32_t n)
+{
+    double xy = 0.0, xx = 0.0, signal = 0.0, noise = 0.0, gain;
+
+    for (uint32_t i = 0; i < n + 2U; i++) {
+        xy += exact[i] * bins[i];
+        xx += exact[i] * exact[i];
+    }
+    gain = xy / xx;
+
+    for (uint32_t i = 0; i < n + 2U; i++) {
+        double e = bins[i] - gain * exact[i];
+        signal += gain * gain * exact[i] * exact[i];
+        noise += e * e;
+    }
+
+    return 10.0 * log10(signal / noise);
+}
+
+/**
+ * @brief The halves leave the bit-reversed CFFT of arm_cfft_q15() bit-exact
+ *
+ * For the lengths that are not powers of four arm_cfft_q15() runs the
+ * same radix-2 stage and then the same half-length transforms.
+ */
+static void test_cfft(void)
+{
+    char message[96];
+
+    TEST_SECTION("Split CFFT - Against arm_cfft_q15()");
+
+    for (uint32_t n = 2U * RFFT_Q15_MIN_FFT_LEN; n <= MAX_FFT_LEN; n *= 2U) {
+        const arm_rfft_instance_q15 *S = rfft_q15_get_instance(n);
+        uint32_t cfft_len = S->pCfft->fftLen;
+        int32_t worst;
+
+        if (!starts_radix2(S)) {
+            continue;
+        }
+
+        fill_signal(n, n);
+        memcpy(split, input, n * sizeof(q15_t));
+        memcpy(whole, input, n * sizeof(q15_t));
+
+        split_cfft(S, split);
+        arm_cfft_q15(S->pCfft, whole, 0U, 0U);
+        worst = max_diff(split, whole, 2U * cfft_len);
+
+        snprintf(message, sizeof(message), "%4u points: CFFT of %u bit-exact (max diff %d)",
+                 n, cfft_len, (int) worst);
+        TEST_ASSERT(worst == 0, message);
+    }
+}
+
+/**
+ * @brief The bins of the split CFFT match arm_rfft_q15() and arm_rfft_q15_mag_sq()
+ *
+ * Each part of a bin within 1 LSB of arm_rfft_q15(), so its magnitude
+ * squared within 2 (|re| + |im|) + 2 of arm_rfft_q15_mag_sq().
+ */
+static void test_rfft(void)
+{
+    char message[96];
+
+    TEST_SECTION("Split CFFT - Bins against arm_rfft_q15()");
+
+    for (uint32_t n = 2U * RFFT_Q15_MIN_FFT_LEN; n <= MAX_FFT_LEN; n *= 2U) {
+        const arm_rfft_instance_q15 *S = rfft_q15_get_instance(n);
+        int32_t worst_part = 0;
+        uint32_t bad_mag = 0;
+
+        if (!starts_radix2(S)) {
+            continue;
+        }
+
+        for (uint32_t seed = 1; seed <= 3U; seed++) {
+            fill_signal(n, seed * 7919U + n);
+
+            memcpy(whole, input, n * sizeof(q15_t));
+            arm_rfft_q15(S, whole, output);
+
+            memcpy(whole, input, n * sizeof(q15_t));
+            arm_rfft_q15_mag_sq(S, whole, store_mag_whole, NULL);
+
+            memcpy(split, input, n * sizeof(q15_t));
+            split_cfft(S, split);
+            arm_rfft_q15_mag_sq_split(S, split, store_mag_split, NULL);
+
+            for (uint32_t k = 0; k <= n / 2U; k++) {
+                q15_t bin[2];
+                int32_t re = output[2U * k];
+                int32_t im = output[2U * k + 1U];
+                int64_t slack = 2 * ((int64_t) abs(re) + abs(im)) + 2;
+                int64_t d;
+
+                arm_rfft_q15_mag_sq_bin(S, split, k, bin);
+                worst_part = (abs(bin[0] - re) > worst_part) ? abs(bin[0] - re) : worst_part;
+                worst_part = (abs(bin[1] - im) > worst_part) ? abs(bin[1] - im) : worst_part;
+
+                d = (int64_t) mag_split[k] - (int64_t) mag_whole[k];
+                if (d < -slack || d > slack) {
+                    bad_mag++;
+                }
+            }
+        }
+
+        snprintf(message, sizeof(message), "%4u points: bins within 1 LSB (max diff %d)",
+                 n, (int) worst_part);
+        TEST_ASSERT(worst_part <= 1, message);
+
+        snprintf(message, sizeof(message), "%4u points: magnitude² within 1 LSB of a part",
+                 n);
+        TEST_ASSERT(bad_mag == 0, message);
+    }
+}
+
+/**
+ * @brief On the powers of four the split costs at most the bits of its radix-2 stages
+ *
+ * There arm_cfft_q15() is radix-4 from the first stage, so the split
+ * rounds differently; its first radix-2 stage and that of the half-length
+ * transform each keep one bit less, 12 dB at most, against a double DFT.
+ */
+static void test_radix4_lengths(void)
+{
+    char message[112];
+
+    TEST_SECTION("Split CFFT - Powers of four against a double DFT");
+
+    for (uint32_t n = 2U * RFFT_Q15_MIN_FFT_LEN; n <= MAX_FFT_LEN; n *= 2U) {
+        const arm_rfft_instance_q15 *S = rfft_q15_get_instance(n);
+        double split_snr, whole_snr;
+
+        if (starts_radix2(S)) {
+            continue;
+        }
+
+        fill_signal(n, n);
+        reference_dft(n);
+
+        memcpy(whole, input, n * sizeof(q15_t));
+        arm_rfft_q15(S, whole, output);
+        whole_snr = snr_db(output, n);
+
+        memcpy(split, input, n * sizeof(q15_t));
+        split_cfft(S, split);
+        for (uint32_t k = 0; k <= n / 2U; k++) {
+            arm_rfft_q15_mag_sq_bin(S, split, k, &output[2U * k]);
+        }
+        split_snr = snr_db(output, n);
+
+        snprintf(message, sizeof(message), "%4u points: split %4.1f dB, single core %4.1f dB, "
+                 "within 12 dB", n, split_snr, whole_snr);
+        TEST_ASSERT(split_snr >= whole_snr - 12.0, message);
+    }
+}
+
+/**
+ * @brief Main test runner
+ */
+int main(void) {
+    printf("=== Split CFFT Tests ===\n");
+
+    test_cfft();
+    test_rfft();
+    test_radix4_lengths();
+
+    /* Print summary */
+    printf("\n=== Test Summary ===\n");
+    printf("Passed: %d\n", tests_passed);
+    printf("Failed: %d\n", tests_failed);
+    printf("Total:  %d\n", tests_passed + tests_failed);
+
+    if (tests_failed == 0) {
+        printf("\n✓ The split CFFT matches the single-core transform!\n");
+        return 0;
+    } else {
+        printf("\n✗ Some tests failed!\n");
+        return 1;
+    }
+}
@@ -0,0 +1,147 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library - Simplified Q15 RFFT
+ * Title:        test_compact_twiddles.c
+ * Description:  Spectrum digests for comparing twiddle table builds
+ *
+ * Target Processor: nRF54L15 FLPR (PC validation)
+ * -------------------------------------------------------------------- */
+
+#include "../include/rfft_q15.h"
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+/*
+ * Built once against the full tables and once with
+ * RFFT_Q15_COMPACT_TWIDDLES, see the test-compact target of the Makefile,
+ * and for every length with and without RFFT_Q15_STOCKHAM, see
+ * test-stockham. The builds print one digest per transform; the outputs
+ * of a pair must be identical. Both builds also check the twiddles they read against the
+ * formula the full table was generated with.
+ */
+
+#define MAX_FFT_LEN 8192
+
+static q15_t input[MAX_FFT_LEN] RFFT_Q15_ALIGN;
+static q15_t work[MAX_FFT_LEN] RFFT_Q15_ALIGN;
+static q15_t output[2 * MAX_FFT_LEN] RFFT_Q15_ALIGN;
+static q15_t bins[MAX_FFT_LEN + 2];
+
+static uint32_t lcg_state;
+
+/* Input generator that does not depend on the C library's rand() */
+static q15_t next_sample(void)
+{
+    lcg_state = lcg_state * 1664525U + 1013904223U;
+    return (q15_t) (lcg_state >> 16);
+}
+
+/* FNV-1a over Q15 values */
+static uint32_t digest(const q15_t *p, uint32_t n)
+{
+    uint32_t h = 2166136261U;
+
+    for (uint32_t i = 0; i < n; i++) {
+        h = (h ^ (uint16_t) p[i]) * 16777619U;
+    }
+
+    return h;
+}
+
+static void fill_input(uint32_t n, uint32_t seed)
+{
+    lcg_state = seed;
+    for (uint32_t i = 0; i < n; i++) {
+        input[i] = next_sample();
+    }
+}
+
+static uint32_t mag_sq_digest;
+
+static void digest_bin(uint32_t bin, uint32_t mag_sq, void *user)
+{
+    (void) bin;
+    (void) user;
+    mag_sq_digest = (mag_sq_digest ^ mag_sq) * 16777619U;
+}
+
+static void print_digests(const arm_rfft_instance_q15 *instance, uint32_t seed)
+{
+    uint32_t n = instance->fftLenReal;
+    arm_rfft_instance_q15 inverse = *instance;
+
+    fill_input(n, seed);
+    memcpy(work, input, n * sizeof(q15_t));
+    arm_rfft_q15(instance, work, output);
+    printf("rfft %u:        %08x\n", (unsigned) n, (unsigned) digest(output, 2 * n));
+
+    /* The spectrum just computed is a valid RIFFT input */
+    inverse.ifftFlagR = 1U;
+    memcpy(work, output, 2 * n * sizeof(q15_t));
+    arm_rfft_q15(&inverse, work, output);
+    printf("rifft %u:       %08x\n", (unsigned) n, (unsigned) digest(output, n));
+
+    memcpy(work, input, n * sizeof(q15_t));
+    arm_rfft_q15_packed(instance, work);
+    printf("rfft packed %u: %08x\n", (unsigned) n, (unsigned) digest(work, n));
+
+    /* The Stockham build prints the digests of the ping-pong CFFT here */
+    mag_sq_digest = 2166136261U;
+    memcpy(work, input, n * sizeof(q15_t));
+#if defined(RFFT_Q15_STOCKHAM)
+    arm_rfft_q15_mag_sq_stockham(instance, work, output, digest_bin, NULL);
+#else
+    arm_rfft_q15_mag_sq(instance, work, digest_bin, NULL);
+#endif
+    printf("rfft mag_sq %u: %08x\n", (unsigned) n, (unsigned) mag_sq_digest);
+
+    for (uint32_t k = 0; k <= n / 2U; k++) {
+#if defined(RFFT_Q15_STOCKHAM)
+        arm_rfft_q15_mag_sq_stockham_bin(instance, work, output, k, &bins[2U * k]);
+#else
+        arm_rfft_q15_mag_sq_bin(instance, work, k, &bins[2U * k]);
+#endif
+    }
+    printf("rfft bins %u:   %08x\n", (unsigned) n, (unsigned) digest(bins, n + 2U));
+}
+
+/* The full twiddle tables hold floor(32768 * x), saturated */
+static q15_t twiddle_q15(double x)
+{
+    double v = floor(32768.0 * x);
+
+    return (q15_t) (v > 32767.0 ? 32767.0 : v);
+}
+
+static int check_twiddles(void)
+{
+    const double pi = 3.14159265358979323846;
+    int bad = 0;
+
+    for (uint32_t k = 0; k < 3U * RFFT_TWIDDLE_TABLE_LEN / 4U; k++) {
+        double phi = 2.0 * pi * k / RFFT_TWIDDLE_TABLE_LEN;
+
+        if (RFFT_TWIDDLE_COS(RFFT_TWIDDLE_TABLE, k) != twiddle_q15(cos(phi)) ||
+            RFFT_TWIDDLE_SIN(RFFT_TWIDDLE_TABLE, k) != twiddle_q15(sin(phi))) {
+            bad++;
+        }
+    }
+
+    printf("twiddles: %s\n", bad == 0 ? "ok" : "MISMATCH");
+    return bad == 0;
+}
+
+int main(void)
+{
+    int ok = check_twiddles();
+
+    print_digests(&arm_rfft_sR_q15_len4096, 1U);
+    print_digests(&arm_rfft_sR_q15_len8192, 2U);
+
+    /* The smaller lengths of a build for all of them, see test-stockham */
+    for (uint32_t n = RFFT_Q15_MIN_FFT_LEN; n < 4096U; n *= 2U) {
+        print_digests(rfft_q15_get_instance(n), n);
+    }
+
+    return ok ? 0 : 1;
+}
@@ -7,6 +7,7 @@
  * -------------------------------------------------------------------- */
 
 #include "../include/rfft_q15.h"
+#include "adc_q15.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -59,6 +60,94 @@ static void test_adc_conversion(void) {
     TEST_ASSERT(result == 16384, "ADC 49152 -> Q15 16384");
 }
 
+/**
+ * @brief Test the block conversion of raw SAADC results
+ */
+static void test_adc_block_conversion(void) {
+    TEST_SECTION("ADC Block Conversion Tests");
+
+    static int16_t raw[67] __attribute__((aligned(4)));
+    static q15_t out[67] __attribute__((aligned(4)));
+    static int8_t raw8[67] __attribute__((aligned(4)));
+    adc_q15_t adc;
+    int match;
+
+    /* Test 1: 12-bit single-ended defaults match the SAADC conversion */
+    for (int i = 0; i < 67; i++) {
+        raw[i] = (int16_t)(i * 71 - 200);   /* -200 to 4486, both clamps */
+    }
+    adc_q15_init(&adc, ADC_Q15_S16, 12, 2048, 16384, 0);
+    adc_q15_convert(&adc, raw, out, 67);
+    match = 1;
+    for (int i = 0; i < 67; i++) {
+        int32_t x = raw[i] < 0 ? 0 : (raw[i] > 4095 ? 4095 : raw[i]);
+        match &= out[i] == (q15_t)((x ^ 0x800) << 4);
+    }
+    TEST_ASSERT(match, "12-bit S16 -> Q15 as (clamp(raw, 0, 4095) ^ 0x800) << 4");
+
+    /* Test 2: In place, from a halfword, gives the same samples */
+    memcpy(out, raw, sizeof(raw));
+    adc_q15_init(&adc, ADC_Q15_S16, 12, 2048, 16384, 0);
+    adc_q15_convert(&adc, &out[1], &out[1], 66);
+    match = 1;
+    for (int i = 1; i < 67; i++) {
+        int32_t x = raw[i] < 0 ? 0 : (raw[i] > 4095 ? 4095 : raw[i]);
+        match &= out[i] == (q15_t)((x ^ 0x800) << 4);
+    }
+    TEST_ASSERT(match, "In-place conversion of an unaligned buffer matches");
+
+    /* Test 3: Differential 14-bit with gain and offset, saturated */
+    raw[0] = -8192; raw[1] = 8191; raw[2] = 0; raw[3] = 100;
+    adc_q15_init(&adc, ADC_Q15_S16, 14, -100, 32767, 0);
+    adc_q15_convert(&adc, raw, out, 4);
+    TEST_ASSERT(out[0] == -32768 && out[1] == 32767, "Gain saturates at full scale");
+    TEST_ASSERT(out[2] == (100 * 32767) >> 12 && out[3] == (200 * 32767) >> 12,
+                "Offset and Q14 gain applied before the shift to Q15");
+
+    /* Test 4: Packed 8-bit results, from an odd byte */
+    for (int i = 0; i < 67; i++) {
+        raw8[i] = (int8_t)(i * 7 - 128);
+    }
+    adc_q15_init(&adc, ADC_Q15_S8, 8, 0, 16384, 0);
+    adc_q15_convert(&adc, raw8, out, 67);
+    match = 1;
+    for (int i = 0; i < 67; i++) {
+        match &= out[i] == raw8[i] * 256;
+    }
+    adc_q15_convert(&adc, &raw8[3], &out[1], 64);
+    for (int i = 0; i < 64; i++) {
+        match &= out[i + 1] == raw8[i + 3] * 256;
+    }
+    TEST_ASSERT(match, "8-bit S8 -> Q15, word loop and unaligned path");
+
+    /* Test 5: DC removal takes out an offset and keeps a square wave */
+    adc_q15_init(&adc, ADC_Q15_S16, 12, 2048, 16384, 6);
+    match = 1;
+    for (int block = 0; block < 16; block++) {
+        for (int i = 0; i < 64; i++) {
+            raw[i] = (int16_t)(2048 + 400 + ((i & 8) ? 200 : -200));
+        }
+        adc_q15_convert(&adc, raw, out, 64);
+        if (block == 15) {
+            int32_t sum = 0;
+            for (int i = 0; i < 64; i++) {
+                sum += out[i];
+            }
+            match = abs(sum / 64) < 200 && out[8] > 2000 && out[0] < -2000;
+        }
+    }
+    TEST_ASSERT(match, "DC removal centres the signal across blocks");
+
+    /* Test 6: Invalid parameters */
+    TEST_ASSERT(adc_q15_init(NULL, ADC_Q15_S16, 12, 0, 16384, 0) == RFFT_ERROR_NULL_POINTER,
+                "NULL state rejected");
+    TEST_ASSERT(adc_q15_init(&adc, ADC_Q15_S16, 17, 0, 16384, 0) == RFFT_ERROR_INVALID_SIZE &&
+                adc_q15_init(&adc, ADC_Q15_S8, 12, 0, 16384, 0) == RFFT_ERROR_INVALID_SIZE &&
+                adc_q15_init(&adc, ADC_Q15_S16, 12, 0, 0, 0) == RFFT_ERROR_INVALID_SIZE &&
+                adc_q15_init(&adc, ADC_Q15_S16, 12, 0, 16384, 16) == RFFT_ERROR_INVALID_SIZE,
+                "Bits, format, gain and dc_shift out of range rejected");
+}
+
 /**
  * @brief Test Q15 to float conversion
  */
@@ -135,16 +224,45 @@ static void test_rfft_init_valid(void) {
     TEST_ASSERT(status == RFFT_SUCCESS, "Init 4096-point FFT returns SUCCESS");
     TEST_ASSERT(instance.fftLenReal == 4096, "FFT length is 4096");
     TEST_ASSERT(instance.pCfft != NULL, "CFFT instance pointer is not NULL");
-    TEST_ASSERT(instance.pTwiddleAReal != NULL, "Twiddle A pointer is not NULL");
-    TEST_ASSERT(instance.pTwiddleBReal != NULL, "Twiddle B pointer is not NULL");
+    TEST_ASSERT(instance.pTwiddleAReal == RFFT_TWIDDLE_TABLE, "Split uses the shared twiddle table");
+    TEST_ASSERT(instance.pCfft->pTwiddle == RFFT_TWIDDLE_TABLE, "CFFT uses the shared twiddle table");
     
     /* Test 2: Initialize 8192-point FFT */
     status = rfft_q15_init_8192(&instance);
     TEST_ASSERT(status == RFFT_SUCCESS, "Init 8192-point FFT returns SUCCESS");
     TEST_ASSERT(instance.fftLenReal == 8192, "FFT length is 8192");
     TEST_ASSERT(instance.pCfft != NULL, "CFFT instance pointer is not NULL");
-    TEST_ASSERT(instance.pTwiddleAReal != NULL, "Twiddle A pointer is not NULL");
-    TEST_ASSERT(instance.pTwiddleBReal != NULL, "Twiddle B pointer is not NULL");
+    TEST_ASSERT(instance.pTwiddleAReal == RFFT_TWIDDLE_TABLE, "Split uses the shared twiddle table");
+    TEST_ASSERT(instance.pCfft->pTwiddle == RFFT_TWIDDLE_TABLE, "CFFT uses the shared twiddle table");
+}
+
+/**
+ * @brief Test that the prebuilt instances match the init functions
+ */
+static void test_rfft_prebuilt_instances(void) {
+    TEST_SECTION("RFFT Initialization - Prebuilt Instances");
+    
+    arm_rfft_instance_q15 instance;
+    
+    /* Padding is compared too, the consts have it zeroed */
+    memset(&instance, 0, sizeof(instance));
+    rfft_q15_init_4096(&instance);
+    TEST_ASSERT(memcmp(&instance, &arm_rfft_sR_q15_len4096, sizeof(instance)) == 0,
+                "rfft_q15_init_4096 matches arm_rfft_sR_q15_len4096");
+    
+    rfft_q15_init_8192(&instance);
+    TEST_ASSERT(memcmp(&instance, &arm_rfft_sR_q15_len8192, sizeof(instance)) == 0,
+                "rfft_q15_init_8192 matches arm_rfft_sR_q15_len8192");
+    
+    /* The const instance runs directly, without a writable copy */
+    static q15_t input[4096];
+    static q15_t output[8192];
+    for (int i = 0; i < 4096; i++) {
+        input[i] = 1000;
+    }
+    arm_rfft_q15(&arm_rfft_sR_q15_len4096, input, output);
+    TEST_ASSERT(output[0] != 0 && abs(output[2]) <= 1,
+                "Constant signal through prebuilt instance has only a DC bin");
 }
 
 /**
@@ -299,6 +417,146 @@ static void test_rfft_impulse_signal(void) {
     free(output);
 }
 
+/* Collects the bins reported by arm_rfft_q15_mag_sq() */
+typedef struct {
+    uint32_t *mag_sq;
+    uint32_t next_bin;
+    int in_order;
+} mag_sq_capture_t;
+
+static void capture_bin(uint32_t bin, uint32_t mag_sq, void *user) {
+    mag_sq_capture_t *capture = (mag_sq_capture_t *)user;
+
+    if (bin != capture->next_bin) {
+        capture->in_order = 0;
+    }
+    capture->mag_sq[bin] = mag_sq;
+    capture->next_bin = bin + 1;
+}
+
+/**
+ * @brief Test that the streamed magnitudes match the full complex spectrum
+ */
+static void test_rfft_mag_sq_matches_spectrum(void) {
+    TEST_SECTION("RFFT Processing - Streamed Magnitude Squared");
+
+    static const uint32_t sizes[] = { 4096, 8192 };
+
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+        uint32_t n = sizes[s];
+        arm_rfft_instance_q15 instance;
+        char message[96];
+        int match = 1;
+
+        if (n == 4096) {
+            rfft_q15_init_4096(&instance);
+        } else {
+            rfft_q15_init_8192(&instance);
+        }
+
+        q15_t *input = (q15_t *)malloc(n * sizeof(q15_t));
+        q15_t *work = (q15_t *)malloc(n * sizeof(q15_t));
+        q15_t *output = (q15_t *)malloc(2 * n * sizeof(q15_t));
+        uint32_t *mag_sq = (uint32_t *)calloc(n / 2 + 1, sizeof(uint32_t));
+
+        if (!input || !work || !output || !mag_sq) {
+            printf("  ✗ Memory allocation failed\n");
+            tests_failed++;
+            free(input);
+            free(work);
+            free(output);
+            free(mag_sq);
+            return;
+        }
+
+        srand(42 + s);
+        for (uint32_t i = 0; i < n; i++) {
+            input[i] = (q15_t)((rand() & 0xFFFF) - 32768);
+        }
+
+        memcpy(work, input, n * sizeof(q15_t));
+        arm_rfft_q15(&instance, work, output);
+
+        mag_sq_capture_t capture = { mag_sq, 0, 1 };
+        memcpy(work, input, n * sizeof(q15_t));
+        arm_rfft_q15_mag_sq(&instance, work, capture_bin, &capture);
+
+        for (uint32_t bin = 0; bin <= n / 2; bin++) {
+            int32_t re = output[2 * bin];
+            int32_t im = output[2 * bin + 1];
+
+            if (mag_sq[bin] != (uint32_t)(re * re) + (uint32_t)(im * im)) {
+                match = 0;
+            }
+        }
+
+        snprintf(message, sizeof(message), "%u-point bins reported in order", (unsigned)n);
+        TEST_ASSERT(capture.in_order && capture.next_bin == n / 2 + 1, message);
+        snprintf(message, sizeof(message), "%u-point magnitudes match arm_rfft_q15 output",
+                 (unsigned)n);
+        TEST_ASSERT(match, message);
+
+        free(input);
+        free(work);
+        free(output);
+        free(mag_sq);
+    }
+}
+
+/**
+ * @brief Test that the in-place packed RFFT matches arm_rfft_q15()
+ */
+static void test_rfft_packed_matches_full(void) {
+    TEST_SECTION("RFFT Processing - In-Place Packed Output");
+
+    static const arm_rfft_instance_q15 *instances[] = {
+        &arm_rfft_sR_q15_len4096,
+        &arm_rfft_sR_q15_len8192,
+    };
+
+    for (size_t s = 0; s < sizeof(instances) / sizeof(instances[0]); s++) {
+        const arm_rfft_instance_q15 *instance = instances[s];
+        uint32_t n = instance->fftLenReal;
+        char message[96];
+        int match;
+
+        q15_t *input = (q15_t *)malloc(n * sizeof(q15_t));
+        q15_t *packed = (q15_t *)malloc(n * sizeof(q15_t));
+        q15_t *output = (q15_t *)malloc(2 * n * sizeof(q15_t));
+
+        if (!input || !packed || !output) {
+            printf("  ✗ Memory allocation failed\n");
+            tests_failed++;
+            free(input);
+            free(packed);
+            free(output);
+            return;
+        }
+
+        srand(7 + s);
+        for (uint32_t i = 0; i < n; i++) {
+            input[i] = (q15_t)((rand() & 0xFFFF) - 32768);
+        }
+
+        memcpy(packed, input, n * sizeof(q15_t));
+        arm_rfft_q15_packed(instance, packed);
+        arm_rfft_q15(instance, input, output);
+
+        snprintf(message, sizeof(message), "%u-point DC and Nyquist packed into bin 0",
+                 (unsigned)n);
+        TEST_ASSERT(packed[0] == output[0] && packed[1] == output[n], message);
+
+        match = memcmp(&packed[2], &output[2], (n - 2) * sizeof(q15_t)) == 0;
+        snprintf(message, sizeof(message), "%u-point bins 1..N/2-1 match arm_rfft_q15 output",
+                 (unsigned)n);
+        TEST_ASSERT(match, message);
+
+        free(input);
+        free(packed);
+        free(output);
+    }
+}
+
 /**
  * @brief Main test runner
  */
@@ -308,13 +566,17 @@ int main(void) {
     
     /* Run all test suites */
     test_adc_conversion();
+    test_adc_block_conversion();
     test_q15_to_float_conversion();
     test_float_to_q15_conversion();
     test_rfft_init_valid();
+    test_rfft_prebuilt_instances();
     test_rfft_init_invalid();
     test_rfft_dc_signal();
     test_rfft_constant_signal();
     test_rfft_impulse_signal();
+    test_rfft_mag_sq_matches_spectrum();
+    test_rfft_packed_matches_full();
     
     /* Print summary */
     printf("\n=== Test Summary ===\n");
@@ -0,0 +1,696 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library - Simplified Q15 RFFT
+ * Title:        test_fft_batch.c
+ * Description:  Batch validation of arm_rfft_q15() over whole vector corpora
+ *
+ * Usage:        ./test_fft_batch [-j threads] [-r frames] [-s seed]
+ *                                [-m min_snr_db] [-e max_bin_error] [dir ...]
+ * Example:      ./test_fft_batch -r 256 test_vectors test_vectors_8192
+ *
+ * Target Processor: nRF54L15 FLPR (PC validation)
+ * -------------------------------------------------------------------- */
+
+/*
+ * Each dir holds the vectors of verify_fft.py, test_random_signals.py or
+ * test_15_random_sines.py: test_ref_<name>.npy or test_<name>_ref.npy,
+ * the complex128 np.fft.rfft() of a signal in full scale 1.0, and
+ * test_input_<name>.bin or test_<name>_input.bin, fft_size Q15 samples of
+ * it. Both files are memory-mapped and every vector is compared
+ * in-process, instead of a run of test_fft_main and a Python run per
+ * vector. The inputs are not checked in: without one the input is
+ * rebuilt from the reference, its inverse DFT truncated to Q15 as
+ * float_to_q15() of the scripts does, and a reference whose input cannot
+ * be rebuilt, one that is not a real signal within full scale, fails.
+ * On top of the SNR floor every bin of a test_ref_<name>.npy vector above
+ * 1 % of its peak must be within -e (10 %) of the reference magnitude,
+ * the check verify_fft.py made of them. The vectors of
+ * test_15_random_sines.py, which only ranks their peaks, and the random
+ * frames, whose weakest tones are a few LSBs, are held to the SNR floor
+ * and the peak alone. -r adds
+ * a randomized corpus of that many frames per RFFT length, tones in
+ * noise, with a double precision FFT as the reference. The frames are
+ * spread over the host cores; every frame has its own seed, so the
+ * results do not depend on the number of threads.
+ */
+
+#define _GNU_SOURCE
+#include "../include/rfft_q15.h"
+#include <dirent.h>
+#include <fcntl.h>
+#include <math.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/*
+ * Built with RFFT_Q15_MIN_FFT_LEN=32 and tables generated for 32 to
+ * 8192 points, see the test-batch target of the Makefile.
+ */
+#if RFFT_Q15_MIN_FFT_LEN != 32 || RFFT_Q15_MAX_FFT_LEN != 8192
+#error "test_fft_batch.c needs all lengths from 32 to 8192"
+#endif
+
+#define MIN_FFT_LEN  32U
+#define MAX_FFT_LEN  8192U
+
+/*
+ * Default floor of the SNR of a frame against its reference. The 1 / n
+ * scaling of arm_rfft_q15() leaves a frame of a tenth of full scale at
+ * 4096 points less than 20 dB above the noise of its stages.
+ */
+#define DEFAULT_MIN_SNR_DB  12.0
+
+/* Default largest relative magnitude error of a significant bin of a vector */
+#define DEFAULT_MAX_BIN_ERROR  0.1
+
+/* Bins of a vector above this fraction of its peak are significant */
+#define SIGNIFICANT_BIN  0.01
+
+/* Tones of a random frame, at most */
+#define RANDOM_MAX_TONES  15U
+
+static const double pi = 3.14159265358979323846;
+
+/* One frame of the corpus and its result */
+typedef struct {
+    char name[64];          /* Vector name, empty for a random frame */
+    uint32_t n;             /* RFFT length */
+    const int16_t *input;   /* n samples, mapped, or NULL to generate */
+    const double *ref;      /* n / 2 + 1 complex bins, mapped, or NULL */
+    uint32_t seed;          /* Seed of a random frame */
+    double snr_db;          /* SNR of the bins against the reference */
+    double max_error;       /* Largest bin error in output LSBs */
+    double max_bin_error;   /* Largest relative magnitude error of a significant bin */
+    int check_bins;         /* Held to max_bin_error, a verify_fft.py vector */
+    int rebuilt;            /* Input rebuilt from the reference */
+    int no_input;           /* No input and none can be rebuilt */
+    uint32_t peak;          /* Strongest bin of the output */
+    uint32_t ref_peak;      /* Strongest bin of the reference */
+    int failed;             /* Missed the SNR floor or the peak */
+} batch_frame_t;
+
+/* Corpus and the index of the next frame to take */
+static batch_frame_t *frames;
+static uint32_t num_frames;
+static uint32_t next_frame;
+static double min_snr_db = DEFAULT_MIN_SNR_DB;
+static double max_bin_error = DEFAULT_MAX_BIN_ERROR;
+
+/* Buffers of one worker thread */
+typedef struct {
+    q15_t *work;            /* n, the input, overwritten */
+    q15_t *output;          /* 2 * n */
+    int16_t *signal;        /* n, a random frame */
+    double *exact;          /* 2 * n, the reference of a random frame */
+} batch_buffers_t;
+
+/* Small, fast, and the same sequence on every host */
+static uint32_t xorshift32(uint32_t *state)
+{
+    uint32_t x = *state;
+
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *state = x;
+
+    return x;
+}
+
+/* Uniform in [0, 1) */
+static double uniform(uint32_t *state)
+{
+    return (xorshift32(state) >> 8) * (1.0 / 16777216.0);
+}
+
+/* In-place radix-2 FFT of n complex values, interleaved */
+static void reference_fft(double *x, uint32_t n)
+{
+    for (uint32_t i = 1, j = 0; i < n; i++) {
+        uint32_t bit = n >> 1;
+
+        for (; j & bit; bit >>= 1) {
+            j ^= bit;
+        }
+        j |= bit;
+
+        if (i < j) {
+            double re = x[2U * i], im = x[2U * i + 1U];
+
+            x[2U * i] = x[2U * j];
+            x[2U * i + 1U] = x[2U * j + 1U];
+            x[2U * j] = re;
+            x[2U * j + 1U] = im;
+        }
+    }
+
+    for (uint32_t len = 2; len <= n; len <<= 1) {
+        for (uint32_t k = 0; k < len / 2U; k++) {
+            double wr = cos(2.0 * pi * k / len);
+            double wi = -sin(2.0 * pi * k / len);
+
+            for (uint32_t i = k; i < n; i += len) {
+                uint32_t a = 2U * i, b = 2U * (i + len / 2U);
+                double re = x[b] * wr - x[b + 1U] * wi;
+                double im = x[b] * wi + x[b + 1U] * wr;
+
+                x[b] = x[a] - re;
+                x[b + 1U] = x[a + 1U] - im;
+                x[a] += re;
+                x[a + 1U] += im;
+            }
+        }
+    }
+}
+
+/*
+ * 1 to RANDOM_MAX_TONES tones at random bins, phases and amplitudes, a
+ * peak sum of 0.1 to 0.9 of full scale, over noise 40 to 80 dB below
+ * it, and the unscaled DFT of the samples as they were rounded.
+ */
+static void random_frame(const batch_frame_t *frame, batch_buffers_t *buf)
+{
+    uint32_t state = frame->seed | 1U;
+    uint32_t n = frame->n;
+    uint32_t tones = 1U + xorshift32(&state) % RANDOM_MAX_TONES;
+    double bins[RANDOM_MAX_TONES], amps[RANDOM_MAX_TONES], phases[RANDOM_MAX_TONES];
+    double total = 0.0, level, noise;
+
+    for (uint32_t t = 0; t < tones; t++) {
+        bins[t] = 1.0 + uniform(&state) * (n / 2U - 2U);
+        amps[t] = 0.05 + uniform(&state);
+        phases[t] = 2.0 * pi * uniform(&state);
+        total += amps[t];
+    }
+    level = (0.1 + 0.8 * uniform(&state)) * 32767.0 / total;
+    noise = level * total * pow(10.0, -(40.0 + 40.0 * uniform(&state)) / 20.0);
+
+    for (uint32_t i = 0; i < n; i++) {
+        double v = noise * (uniform(&state) - 0.5);
+
+        for (uint32_t t = 0; t < tones; t++) {
+            v += level * amps[t] * cos(2.0 * pi * bins[t] * i / n + phases[t]);
+        }
+        buf->signal[i] = (int16_t) lrint(v);
+        buf->exact[2U * i] = buf->signal[i];
+        buf->exact[2U * i + 1U] = 0.0;
+    }
+
+    reference_fft(buf->exact, n);
+}
+
+/* Run one frame and compare its bins 0 to n / 2 with the reference */
+static void run_frame(batch_frame_t *frame, batch_buffers_t *buf)
+{
+    const arm_rfft_instance_q15 *S = rfft_q15_get_instance((uint16_t) frame->n);
+    uint32_t n = frame->n;
+    const int16_t *input = frame->input;
+    const double *exact = buf->exact;
+    double ref_scale = 1.0;
+    double signal = 0.0, noise = 0.0, max_error = 0.0;
+    double peak_mag = -1.0, ref_peak_mag = -1.0, ref_at_peak = 0.0;
+
+    if (frame->no_input) {
+        frame->snr_db = -INFINITY;
+        frame->failed = 1;
+        return;
+    }
+
+    if (input == NULL) {
+        random_frame(frame, buf);
+        input = buf->signal;
+    } else {
+        /* np.fft.rfft() of the signal in full scale 1.0 */
+        exact = frame->ref;
+        ref_scale = 32768.0;
+    }
+
+    /* arm_rfft_q15() overwrites its input */
+    memcpy(buf->work, input, n * sizeof(q15_t));
+    arm_rfft_q15(S, buf->work, buf->output);
+
+    /* The output is the DFT scaled by 1 / n */
+    for (uint32_t k = 0; k <= n / 2U; k++) {
+        double re = exact[2U * k] * ref_scale / n;
+        double im = exact[2U * k + 1U] * ref_scale / n;
+        double er = buf->output[2U * k] - re;
+        double ei = buf->output[2U * k + 1U] - im;
+        double out_mag = (double) buf->output[2U * k] * buf->output[2U * k] +
+                         (double) buf->output[2U * k + 1U] * buf->output[2U * k + 1U];
+        double ref_mag = re * re + im * im;
+
+        signal += ref_mag;
+        noise += er * er + ei * ei;
+        if (sqrt(er * er + ei * ei) > max_error) {
+            max_error = sqrt(er * er + ei * ei);
+        }
+        if (out_mag > peak_mag) {
+            peak_mag = out_mag;
+            ref_at_peak = ref_mag;
+            frame->peak = k;
+        }
+        if (ref_mag > ref_peak_mag) {
+            ref_peak_mag = ref_mag;
+            frame->ref_peak = k;
+        }
+    }
+
+    frame->snr_db = (noise > 0.0) ? 10.0 * log10(signal / noise) : INFINITY;
+    frame->max_error = max_error;
+
+    /* The magnitude of the significant bins of a vector, as verify_fft.py checks it */
+    frame->max_bin_error = 0.0;
+    for (uint32_t k = 0; frame->ref != NULL && k <= n / 2U; k++) {
+        double re = exact[2U * k] * ref_scale / n;
+        double im = exact[2U * k + 1U] * ref_scale / n;
+        double ref_abs = sqrt(re * re + im * im);
+        double out_abs = hypot(buf->output[2U * k], buf->output[2U * k + 1U]);
+
+        if (ref_abs > SIGNIFICANT_BIN * sqrt(ref_peak_mag)) {
+            frame->max_bin_error = fmax(frame->max_bin_error, fabs(out_abs - ref_abs) / ref_abs);
+        }
+    }
+    /*
+     * The peak may move to a neighbouring bin, or to another tone whose
+     * reference is within twice the largest bin error of the peak's.
+     */
+    frame->failed = (frame->snr_db < min_snr_db) || (frame->check_bins && frame->max_bin_error >= max_bin_error) ||
+                    ((frame->peak + 1U < frame->ref_peak || frame->peak > frame->ref_peak + 1U) &&
+                     (sqrt(ref_at_peak) < sqrt(ref_peak_mag) - 2.0 * max_error));
+}
+
+/* Worker: take frames until the corpus is done */
+static void *worker(void *arg)
+{
+    batch_buffers_t buf;
+
+    (void) arg;
+    /* malloc() aligns beyond RFFT_Q15_ALIGN */
+    buf.work = malloc(MAX_FFT_LEN * sizeof(q15_t));
+    buf.output = malloc(2U * MAX_FFT_LEN * sizeof(q15_t));
+    buf.signal = malloc(MAX_FFT_LEN * sizeof(int16_t));
+    buf.exact = malloc(2U * MAX_FFT_LEN * sizeof(double));
+    if (buf.work == NULL || buf.output == NULL || buf.signal == NULL || buf.exact == NULL) {
+        fprintf(stderr, "Error: Memory allocation failed\n");
+        exit(1);
+    }
+
+    for (;;) {
+        uint32_t i = __atomic_fetch_add(&next_frame, 1U, __ATOMIC_RELAXED);
+
+        if (i >= num_frames) {
+            break;
+        }
+        run_frame(&frames[i], &buf);
+    }
+
+    free(buf.work);
+    free(buf.output);
+    free(buf.signal);
+    free(buf.exact);
+
+    return NULL;
+}
+
+/* Map a whole file read-only, NULL if it cannot be */
+static const void *map_file(const char *path, size_t *size)
+{
+    struct stat st;
+    void *data;
+    int fd = open(path, O_RDONLY);
+
+    if (fd < 0) {
+        return NULL;
+    }
+    if (fstat(fd, &st) != 0 || st.st_size == 0) {
+        close(fd);
+        return NULL;
+    }
+
+    data = mmap(NULL, (size_t) st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) {
+        return NULL;
+    }
+
+    *size = (size_t) st.st_size;
+    return data;
+}
+
+/*
+ * The bins of a version 1 or 2 .npy of a little-endian complex128 vector,
+ * and their number, NULL for any other file.
+ */
+static const double *npy_bins(const uint8_t *data, size_t size, uint32_t *count)
+{
+    const char *header;
+    const char *shape;
+    size_t header_len, offset;
+
+    if (size < 12U || memcmp(data, "\x93NUMPY", 6) != 0) {
+        return NULL;
+    }
+
+    if (data[6] == 1U) {
+        header_len = data[8] | ((size_t) data[9] << 8);
+        offset = 10U;
+    } else if (data[6] == 2U || data[6] == 3U) {
+        header_len = data[8] | ((size_t) data[9] << 8) |
+                     ((size_t) data[10] << 16) | ((size_t) data[11] << 24);
+        offset = 12U;
+    } else {
+        return NULL;
+    }
+
+    if (offset + header_len > size) {
+        return NULL;
+    }
+    header = (const char *) &data[offset];
+    offset += header_len;
+
+    /* The header is a Python dict padded to a 16 or 64 byte boundary */
+    if (memmem(header, header_len, "'<c16'", 6) == NULL ||
+        memmem(header, header_len, "'fortran_order': False", 22) == NULL) {
+        return NULL;
+    }
+    shape = memmem(header, header_len, "'shape': (", 10);
+    if (shape == NULL) {
+        return NULL;
+    }
+    *count = (uint32_t) strtoul(shape + 10, NULL, 10);
+
+    if (offset % sizeof(double) != 0 || offset + *count * 2U * sizeof(double) > size) {
+        return NULL;
+    }
+
+    return (const double *) &data[offset];
+}
+
+/* Add a frame to the corpus */
+static batch_frame_t *add_frame(uint32_t *capacity)
+{
+    if (num_frames == *capacity) {
+        *capacity = (*capacity == 0) ? 256U : 2U * *capacity;
+        frames = realloc(frames, *capacity * sizeof(*frames));
+        if (frames == NULL) {
+            fprintf(stderr, "Error: Memory allocation failed\n");
+            exit(1);
+        }
+    }
+
+    memset(&frames[num_frames], 0, sizeof(*frames));
+    return &frames[num_frames++];
+}
+
+/* Named vectors in the order of their names */
+static int compare_names(const void *a, const void *b)
+{
+    return strcmp(((const batch_frame_t *) a)->name, ((const batch_frame_t *) b)->name);
+}
+
+/*
+ * The input of a reference: its inverse DFT, the conjugate of the forward
+ * one of the conjugate spectrum, as float_to_q15() stores it. NULL where
+ * the reference is not a real signal within full scale.
+ */
+static const int16_t *rebuild_input(const double *ref, uint32_t n)
+{
+    double *x = malloc(2U * n * sizeof(double));
+    int16_t *signal = malloc(n * sizeof(int16_t));
+    int ok = (x != NULL && signal != NULL) &&
+             fabs(ref[1]) < 1e-9 * n && fabs(ref[n + 1U]) < 1e-9 * n;
+
+    for (uint32_t k = 0; ok && k <= n / 2U; k++) {
+        x[2U * k] = ref[2U * k];
+        x[2U * k + 1U] = -ref[2U * k + 1U];
+        if (k != 0 && k != n / 2U) {
+            x[2U * (n - k)] = ref[2U * k];
+            x[2U * (n - k) + 1U] = ref[2U * k + 1U];
+        }
+    }
+
+    if (ok) {
+        reference_fft(x, n);
+        for (uint32_t i = 0; ok && i < n; i++) {
+            double v = x[2U * i] / n;
+
+            ok = fabs(v) <= 1.0 + 1e-9;
+            signal[i] = (int16_t) fmax(-32768.0, fmin(32767.0, trunc(v * 32768.0)));
+        }
+    }
+
+    free(x);
+    if (!ok) {
+        free(signal);
+        return NULL;
+    }
+    return signal;
+}
+
+/*
+ * Map every vector of dir, test_ref_<name>.npy with test_input_<name>.bin
+ * or test_<name>_ref.npy with test_<name>_input.bin
+ */
+static int add_dir(const char *dir, uint32_t *capacity)
+{
+    DIR *d = opendir(dir);
+    struct dirent *entry;
+    uint32_t first = num_frames;
+    int added = 0;
+
+    if (d == NULL) {
+        fprintf(stderr, "Error: Cannot open directory '%s'\n", dir);
+        return -1;
+    }
+
+    while ((entry = readdir(d)) != NULL) {
+        char path[4096];
+        const char *name = entry->d_name;
+        size_t len = strlen(name);
+        const void *ref_data, *input_data;
+        size_t ref_size, input_size;
+        const double *ref;
+        uint32_t bins, n;
+        batch_frame_t *frame;
+        char input_name[256];
+        int stem, check_bins;
+
+        if (strncmp(name, "test_", 5) != 0 || len < 13U ||
+            strcmp(&name[len - 4U], ".npy") != 0) {
+            continue;
+        }
+        if (strncmp(name, "test_ref_", 9) == 0) {
+            stem = (int) (len - 13U);
+            name += 9;
+            check_bins = 1;
+            snprintf(input_name, sizeof(input_name), "test_input_%.*s.bin", stem, name);
+        } else if (strcmp(&name[len - 8U], "_ref.npy") == 0) {
+            stem = (int) (len - 13U);
+            name += 5;
+            check_bins = 0;
+            snprintf(input_name, sizeof(input_name), "test_%.*s_input.bin", stem, name);
+        } else {
+            continue;
+        }
+
+        snprintf(path, sizeof(path), "%s/%s", dir, entry->d_name);
+        ref_data = map_file(path, &ref_size);
+        ref = (ref_data != NULL) ? npy_bins(ref_data, ref_size, &bins) : NULL;
+        n = (ref != NULL && bins > 1U) ? 2U * (bins - 1U) : 0U;
+        if (n < MIN_FFT_LEN || n > MAX_FFT_LEN || (n & (n - 1U)) != 0) {
+            fprintf(stderr, "Error: '%s' is not the rfft of a supported length\n", path);
+            closedir(d);
+            return -1;
+        }
+
+        frame = add_frame(capacity);
+        snprintf(frame->name, sizeof(frame->name), "%s/%.*s", dir, stem, name);
+        frame->n = n;
+        frame->ref = ref;
+        frame->check_bins = check_bins;
+        added++;
+
+        /* The inputs are generated next to the references, not kept */
+        snprintf(path, sizeof(path), "%s/%s", dir, input_name);
+        input_data = map_file(path, &input_size);
+        if (input_data != NULL && input_size != n * sizeof(int16_t)) {
+            fprintf(stderr, "Error: '%s' is not %u samples\n", path, n);
+            frame->no_input = 1;
+        } else if (input_data != NULL) {
+            frame->input = input_data;
+        } else {
+            frame->input = rebuild_input(ref, n);
+            frame->rebuilt = 1;
+            frame->no_input = (frame->input == NULL);
+        }
+    }
+
+    closedir(d);
+    qsort(&frames[first], num_frames - first, sizeof(*frames), compare_names);
+    return added;
+}
+
+static void print_usage(const char *prog_name)
+{
+    printf("Usage: %s [-j threads] [-r frames] [-s seed] [-m min_snr_db] [-e max_bin_error] "
+           "[dir ...]\n", prog_name);
+    printf("\n");
+    printf("  -j threads     Worker threads (default: host cores)\n");
+    printf("  -r frames      Random frames per RFFT length, 32 to 8192 (default: 0)\n");
+    printf("  -s seed        Seed of the random frames (default: 1)\n");
+    printf("  -m min_snr_db  SNR every frame must reach (default: %.0f)\n", DEFAULT_MIN_SNR_DB);
+    printf("  -e max_bin_error\n");
+    printf("                 Relative magnitude error of a bin of a vector above 1 %% of its\n");
+    printf("                 peak (default: %.2f)\n", DEFAULT_MAX_BIN_ERROR);
+    printf("  dir            Directory of test_ref_*.npy or test_*_ref.npy, with their inputs\n");
+    printf("                 or without, rebuilt from the reference\n");
+}
+
+int main(int argc, char *argv[])
+{
+    uint32_t threads = (uint32_t) sysconf(_SC_NPROCESSORS_ONLN);
+    uint32_t random_frames = 0;
+    uint32_t seed = 1;
+    uint32_t capacity = 0;
+    uint32_t rebuilt = 0;
+    uint32_t failed = 0;
+    pthread_t *ids;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "j:r:s:m:e:h")) != -1) {
+        switch (opt) {
+        case 'j':
+            threads = (uint32_t) strtoul(optarg, NULL, 0);
+            break;
+        case 'r':
+            random_frames = (uint32_t) strtoul(optarg, NULL, 0);
+            break;
+        case 's':
+            seed = (uint32_t) strtoul(optarg, NULL, 0);
+            break;
+        case 'm':
+            min_snr_db = strtod(optarg, NULL);
+            break;
+        case 'e':
+            max_bin_error = strtod(optarg, NULL);
+            break;
+        default:
+            print_usage(argv[0]);
+            return 1;
+        }
+    }
+    if (threads == 0) {
+        threads = 1;
+    }
+
+    printf("=== Batch Validation of arm_rfft_q15() ===\n\n");
+
+    for (int i = optind; i < argc; i++) {
+        if (add_dir(argv[i], &capacity) < 0) {
+            return 1;
+        }
+    }
+
+    for (uint32_t n = MIN_FFT_LEN; n <= MAX_FFT_LEN; n <<= 1) {
+        for (uint32_t i = 0; i < random_frames; i++) {
+            batch_frame_t *frame = add_frame(&capacity);
+
+            frame->n = n;
+            /* One seed per frame, whatever thread runs it */
+            frame->seed = seed * 2654435761U + n * 40503U + i * 2246822519U;
+        }
+    }
+
+    if (num_frames == 0) {
+        fprintf(stderr, "Error: No frames, give a vector directory or -r\n");
+        return 1;
+    }
+
+    for (uint32_t i = 0; i < num_frames; i++) {
+        rebuilt += (frames[i].rebuilt && !frames[i].no_input) ? 1U : 0U;
+    }
+    printf("Corpus: %u frames on %u threads", num_frames, threads);
+    if (rebuilt != 0) {
+        printf(", %u inputs rebuilt from their references", rebuilt);
+    }
+    printf("\n");
+
+    ids = malloc(threads * sizeof(*ids));
+    if (ids == NULL) {
+        fprintf(stderr, "Error: Memory allocation failed\n");
+        return 1;
+    }
+    for (uint32_t t = 0; t < threads; t++) {
+        if (pthread_create(&ids[t], NULL, worker, NULL) != 0) {
+            fprintf(stderr, "Error: Cannot start thread %u\n", t);
+            return 1;
+        }
+    }
+    for (uint32_t t = 0; t < threads; t++) {
+        pthread_join(ids[t], NULL);
+    }
+    free(ids);
+
+    /* The named vectors one by one */
+    for (uint32_t i = 0; i < num_frames; i++) {
+        const batch_frame_t *frame = &frames[i];
+
+        if (frame->name[0] == '\0') {
+            continue;
+        }
+        if (frame->no_input) {
+            printf("  ✗ %-32s n=%4u no input, and none rebuilt from the reference\n",
+                   frame->name, frame->n);
+            continue;
+        }
+        printf("  %s %-32s n=%4u SNR %6.2f dB, max error %7.2f LSB, bin error %5.1f %%%s, "
+               "peak %4u/%4u\n", frame->failed ? "✗" : "✓", frame->name, frame->n,
+               frame->snr_db, frame->max_error, 100.0 * frame->max_bin_error,
+               frame->check_bins ? "" : " (unchecked)", frame->peak, frame->ref_peak);
+    }
+
+    /* Summary per length, of every frame */
+    printf("\n  %6s %7s %12s %12s %14s %7s\n",
+           "length", "frames", "min SNR dB", "mean SNR dB", "max error LSB", "failed");
+    for (uint32_t n = MIN_FFT_LEN; n <= MAX_FFT_LEN; n <<= 1) {
+        uint32_t count = 0, length_failed = 0;
+        double snr_min = INFINITY, snr_sum = 0.0, error_max = 0.0;
+
+        for (uint32_t i = 0; i < num_frames; i++) {
+            const batch_frame_t *frame = &frames[i];
+
+            if (frame->n != n) {
+                continue;
+            }
+            count++;
+            length_failed += (uint32_t) frame->failed;
+            snr_min = fmin(snr_min, frame->snr_db);
+            snr_sum += isinf(frame->snr_db) ? 0.0 : frame->snr_db;
+            error_max = fmax(error_max, frame->max_error);
+        }
+
+        if (count != 0) {
+            printf("  %s %4u %7u %12.2f %12.2f %14.2f %7u\n", length_failed ? "✗" : "✓",
+                   n, count, snr_min, snr_sum / count, error_max, length_failed);
+        }
+        failed += length_failed;
+    }
+
+    printf("\n=== Test Summary ===\n");
+    printf("Passed: %u\n", num_frames - failed);
+    printf("Failed: %u\n", failed);
+    printf("Total:  %u\n", num_frames);
+
+    if (failed == 0) {
+        printf("\n✓ Every frame reaches %.0f dB SNR and its peak, every vector bin %.0f %%\n",
+               min_snr_db, 100.0 * max_bin_error);
+        return 0;
+    }
+
+    printf("\n✗ Some frames failed\n");
+    return 1;
+}
@@ -0,0 +1,248 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library - Simplified Q15 RFFT
+ * Title:        test_fft_conv.c
+ * Description:  Tests for the overlap-save FIR filter against a direct convolution
+ *
+ * Target Processor: nRF54L15 FLPR (PC validation)
+ * -------------------------------------------------------------------- */
+
+#include "../include/rfft_q15.h"
+#include "fft_conv.h"
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#if RFFT_Q15_MIN_FFT_LEN > 256 || RFFT_Q15_MAX_FFT_LEN < 4096
+#error "test_fft_conv.c needs the lengths from 256 to 4096"
+#endif
+
+#define MAX_FFT_LEN 4096
+#define NUM_BLOCKS  6
+#define MAX_SAMPLES (NUM_BLOCKS * MAX_FFT_LEN)
+
+static q15_t ring[MAX_FFT_LEN];
+static q15_t spectrum[MAX_FFT_LEN] RFFT_Q15_ALIGN;
+static q15_t work[MAX_FFT_LEN] RFFT_Q15_ALIGN;
+static q15_t taps[MAX_FFT_LEN / 2];
+static q15_t input[MAX_SAMPLES];
+static q15_t output[MAX_SAMPLES];
+
+/* Test result tracking */
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+/* Test assertion macro */
+#define TEST_ASSERT(condition, message) \
+    do { \
+        if (condition) { \
+            printf("  ✓ %s\n", message); \
+            tests_passed++; \
+        } else { \
+            printf("  ✗ %s\n", message); \
+            tests_failed++; \
+        } \
+    } while(0)
+
+/* Test section header */
+#define TEST_SECTION(name) \
+    printf("\n=== %s ===\n", name)
+
+static const double pi = 3.14159265358979323846;
+
+/* Windowed-sinc low pass at a quarter of the sample rate, DC gain 0.9 */
+static void fill_taps(uint32_t num_taps)
+{
+    double centre = (num_taps - 1U) / 2.0;
+    double h[MAX_FFT_LEN / 2];
+    double sum = 0.0;
+
+    for (uint32_t i = 0; i < num_taps; i++) {
+        double t = i - centre;
+        double sinc = (t == 0.0) ? 0.5 : sin(0.5 * pi * t) / (pi * t);
+        double window = (num_taps > 1U) ? 0.54 - 0.46 * cos(2.0 * pi * i / (num_taps - 1U)) : 1.0;
+
+        h[i] = sinc * window;
+        sum += h[i];
+    }
+    for (uint32_t i = 0; i < num_taps; i++) {
+        taps[i] = (q15_t) lrint(0.9 * 32768.0 * h[i] / sum);
+    }
+}
+
+/* Tones on both sides of the cutoff and pseudo-random noise, peak about level */
+static void fill_input(uint32_t count, double level)
+{
+    uint32_t seed = 2463534242U;
+
+    for (uint32_t i = 0; i < count; i++) {
+        seed ^= seed << 13;
+        seed ^= seed >> 17;
+        seed ^= seed << 5;
+        input[i] = (q15_t) lrint(level * (0.45 * sin(2.0 * pi * 0.031 * i) +
+                                          0.3 * cos(2.0 * pi * 0.17 * i + 1.0) +
+                                          0.15 * sin(2.0 * pi * 0.41 * i) +
+                                          0.1 * (((seed >> 8) * (1.0 / 8388608.0)) - 1.0)));
+    }
+}
+
+/* Push count samples through the filter in pieces of piece, outputs in order */
+static uint32_t run_filter(fft_conv_t *conv, uint32_t count, uint32_t piece)
+{
+    uint32_t produced = 0;
+
+    for (uint32_t pos = 0; pos < count; ) {
+        uint32_t n = (count - pos < piece) ? count - pos : piece;
+
+        pos += fft_conv_push(conv, &input[pos], n);
+        if (fft_conv_block_ready(conv)) {
+            if (fft_conv_process(conv, &output[produced]) != RFFT_SUCCESS) {
+                return 0;
+            }
+            produced += conv->block_size;
+        }
+    }
+
+    return produced;
+}
+
+/* SNR in dB of the outputs against the direct convolution of the Q15 input and taps */
+static double snr_db(uint32_t produced, uint32_t num_taps)
+{
+    double signal = 0.0, noise = 0.0;
+
+    for (uint32_t i = 0; i < produced; i++) {
+        double y = 0.0;
+
+        for (uint32_t k = 0; k < num_taps && k <= i; k++) {
+            y += (double) taps[k] * input[i - k];
+        }
+        y /= 32768.0;
+
+        signal += y * y;
+        noise += (output[i] - y) * (output[i] - y);
+    }
+
+    return (noise > 0.0) ? 10.0 * log10(signal / noise) : INFINITY;
+}
+
+/**
+ * @brief The filter output against a double precision direct convolution
+ *
+ * Six blocks from a cold start, so the zeros before the first sample
+ * and the history between blocks are both checked. A single tone is the
+ * worst input measured, 48.8 dB at 256 points, 44.5 dB at 1024 and
+ * 40.5 dB at 4096; the bounds are those less 3 dB.
+ */
+static void test_against_direct(void)
+{
+    static const struct {
+        uint16_t fft_size;
+        uint16_t num_taps;
+        double min_snr_db;
+    } cases[] = {
+        { 256, 1, 45.0 },
+        { 256, 64, 45.0 },
+        { 1024, 255, 41.0 },
+        { 4096, 1024, 37.0 },
+        { 4096, 2048, 37.0 },
+    };
+    static const double levels[] = { 30000.0, 3000.0, 300.0 };
+    char message[128];
+
+    TEST_SECTION("fft_conv - Against a direct convolution");
+
+    for (uint32_t c = 0; c < sizeof(cases) / sizeof(cases[0]); c++) {
+        for (uint32_t l = 0; l < sizeof(levels) / sizeof(levels[0]); l++) {
+            fft_conv_t conv;
+            uint32_t count = NUM_BLOCKS * (cases[c].fft_size - cases[c].num_taps + 1U);
+            uint32_t produced;
+            double snr;
+
+            fill_taps(cases[c].num_taps);
+            fill_input(count, levels[l]);
+            fft_conv_init(&conv, taps, cases[c].num_taps, cases[c].fft_size, ring, spectrum,
+                          work);
+            produced = run_filter(&conv, count, 97U);
+            snr = snr_db(produced, cases[c].num_taps);
+
+            snprintf(message, sizeof(message), "%4u points, %4u taps, peak %5.0f: %u outputs, "
+                     "SNR %5.1f dB >= %.0f dB", cases[c].fft_size, cases[c].num_taps,
+                     levels[l], produced, snr, cases[c].min_snr_db);
+            TEST_ASSERT(produced == count && snr >= cases[c].min_snr_db, message);
+        }
+    }
+}
+
+/**
+ * @brief A reset restarts from silence, the same outputs as a new filter
+ */
+static void test_reset(void)
+{
+    fft_conv_t conv;
+    uint32_t count = 3U * (1024U - 255U + 1U);
+    static q15_t first[MAX_SAMPLES];
+
+    TEST_SECTION("fft_conv - Reset");
+
+    fill_taps(255U);
+    fill_input(count, 20000.0);
+    fft_conv_init(&conv, taps, 255U, 1024U, ring, spectrum, work);
+    run_filter(&conv, count, 1024U);
+    memcpy(first, output, count * sizeof(q15_t));
+
+    run_filter(&conv, 500U, 500U);
+    fft_conv_reset(&conv);
+    memset(output, 0, sizeof(output));
+    TEST_ASSERT(run_filter(&conv, count, 333U) == count &&
+                memcmp(first, output, count * sizeof(q15_t)) == 0,
+                "Outputs after fft_conv_reset() equal those of a new filter");
+}
+
+/**
+ * @brief Argument checks
+ */
+static void test_errors(void)
+{
+    fft_conv_t conv;
+
+    TEST_SECTION("fft_conv - Errors");
+
+    fill_taps(64U);
+    TEST_ASSERT(fft_conv_init(NULL, taps, 64U, 256U, ring, spectrum, work) ==
+                RFFT_ERROR_NULL_POINTER, "NULL filter rejected");
+    TEST_ASSERT(fft_conv_init(&conv, taps, 0U, 256U, ring, spectrum, work) ==
+                RFFT_ERROR_INVALID_SIZE, "No taps rejected");
+    TEST_ASSERT(fft_conv_init(&conv, taps, 129U, 256U, ring, spectrum, work) ==
+                RFFT_ERROR_INVALID_SIZE, "More taps than half the length rejected");
+    TEST_ASSERT(fft_conv_init(&conv, taps, 64U, 300U, ring, spectrum, work) ==
+                RFFT_ERROR_INVALID_SIZE, "Length without an RFFT rejected");
+    TEST_ASSERT(fft_conv_init(&conv, taps, 64U, 256U, ring, spectrum, work) == RFFT_SUCCESS &&
+                conv.block_size == 256U - 64U + 1U, "Block of fft_size - num_taps + 1 samples");
+    TEST_ASSERT(fft_conv_process(&conv, output) == RFFT_ERROR_INVALID_SIZE,
+                "No block due rejected");
+}
+
+/**
+ * @brief Main test runner
+ */
+int main(void) {
+    printf("=== Overlap-Save FIR Filter Tests ===\n");
+
+    test_against_direct();
+    test_reset();
+    test_errors();
+
+    /* Print summary */
+    printf("\n=== Test Summary ===\n");
+    printf("Passed: %d\n", tests_passed);
+    printf("Failed: %d\n", tests_failed);
+    printf("Total:  %d\n", tests_passed + tests_failed);
+
+    if (tests_failed == 0) {
+        printf("\n✓ The overlap-save filter matches the direct convolution!\n");
+        return 0;
+    } else {
+        printf("\n✗ Some tests failed!\n");
+        return 1;
+    }
+}
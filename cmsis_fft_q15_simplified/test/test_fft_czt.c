@@ -0,0 +1,349 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library - Simplified Q15 RFFT
+ * Title:        test_fft_czt.c
+ * Description:  Tests for the chirp-Z transform against a double precision CZT
+ *
+ * Target Processor: nRF54L15 FLPR (PC validation)
+ * -------------------------------------------------------------------- */
+
+#include "../include/rfft_q15.h"
+#include "fft_czt.h"
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#if RFFT_Q15_MIN_FFT_LEN > 512 || RFFT_Q15_MAX_FFT_LEN < 8192
+#error "test_fft_czt.c needs the lengths from 512 to 8192"
+#endif
+
+#define SAMPLE_RATE  16000U
+#define MAX_FRAME    2048
+#define MAX_BINS     2048
+#define MAX_POINTS   4096
+
+static q15_t pre[2 * MAX_FRAME];
+static q15_t post[2 * MAX_BINS];
+static q15_t filter[2 * MAX_POINTS] RFFT_Q15_ALIGN;
+static q15_t buffer[2 * MAX_POINTS] RFFT_Q15_ALIGN;
+static q15_t frame[MAX_FRAME];
+static uint32_t mag_sq[MAX_BINS];
+static double exact_re[MAX_BINS];
+static double exact_im[MAX_BINS];
+
+/* Test result tracking */
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+/* Test assertion macro */
+#define TEST_ASSERT(condition, message) \
+    do { \
+        if (condition) { \
+            printf("  ✓ %s\n", message); \
+            tests_passed++; \
+        } else { \
+            printf("  ✗ %s\n", message); \
+            tests_failed++; \
+        } \
+    } while(0)
+
+/* Test section header */
+#define TEST_SECTION(name) \
+    printf("\n=== %s ===\n", name)
+
+static const double pi = 3.14159265358979323846;
+
+/* Bins in the order they were reported, and whether that was ascending */
+static uint32_t next_bin;
+static int in_order;
+
+static void store_mag(uint32_t bin, uint32_t value, void *user)
+{
+    (void) user;
+    in_order &= (bin == next_bin);
+    next_bin = bin + 1U;
+    mag_sq[bin] = value;
+}
+
+/* A tone of amplitude level at freq Hz, over frame_len samples */
+static void fill_tone(uint32_t frame_len, double freq, double level)
+{
+    for (uint32_t n = 0; n < frame_len; n++) {
+        frame[n] = (q15_t) lrint(level * sin(2.0 * pi * freq * n / SAMPLE_RATE + 0.3));
+    }
+}
+
+/**
+ * @brief Double precision CZT of frame
+ *
+ * The phase of every term, (start + k step) n in 2^-32 of a turn, is
+ * taken modulo 2^32 in integers, so the wrap of start + k step past the
+ * sample rate is exact and the transform is that of the frequencies
+ * fft_czt_init() was given.
+ */
+static void reference_czt(uint32_t frame_len, uint32_t num_bins, uint32_t start, uint32_t step)
+{
+    for (uint32_t k = 0; k < num_bins; k++) {
+        uint32_t freq = start + k * step;
+        double re = 0.0, im = 0.0;
+
+        for (uint32_t n = 0; n < frame_len; n++) {
+            double phase = 2.0 * pi * (double) (uint32_t) (freq * n) / 4294967296.0;
+
+            re += frame[n] * cos(phase);
+            im -= frame[n] * sin(phase);
+        }
+        exact_re[k] = re;
+        exact_im[k] = im;
+    }
+}
+
+/*
+ * Worst distance of the bins of the module, scaled by 2^exponent, from
+ * the reference, relative to the peak of the tone, level * frame_len / 2
+ * in a bin at its frequency; the bins of a band that misses the tone
+ * peak lower, but not their error. Also checks that mag_sq[] holds the
+ * magnitude² of the bins.
+ */
+static double worst_error(const fft_czt_t *czt, double level, int *mag_ok)
+{
+    double peak = level * czt->frame_len / 2.0, worst = 0.0;
+    double scale = ldexp(1.0, czt->exponent);
+
+    *mag_ok = 1;
+    for (uint32_t k = 0; k < czt->num_bins; k++) {
+        q31_t re = czt->buffer[2U * k];
+        q31_t im = czt->buffer[2U * k + 1U];
+        double e = hypot(re * scale - exact_re[k], im * scale - exact_im[k]);
+
+        worst = (e > worst) ? e : worst;
+        *mag_ok &= (mag_sq[k] == (uint32_t) (re * re) + (uint32_t) (im * im));
+    }
+
+    return worst / peak;
+}
+
+/**
+ * @brief A tone anywhere in the band against the double CZT
+ *
+ * Bins over a band of the frame, at start and step that are not
+ * multiples of fs / frame_len, for a tone near full scale and one 40 dB
+ * below it: block floating point keeps the weak tone as accurate. The
+ * first two are the example of fft_czt.h and the README, 256 bins of
+ * 0.25 Hz of 1024 samples with fft_size 2048, within the 0.2% of the
+ * peak it gives (0.12% to 0.19% measured). Steps far from fs / frame_len
+ * lose more: a chirp of 0.05 Hz a bin barely turns over the frame, so
+ * its spectrum is a narrow peak in the Q15 filter, and one of 400 Hz
+ * wraps 12 times over the bins; these measure up to 0.43%, and are
+ * asserted within 0.6%.
+ */
+static void test_tone(void)
+{
+    static const struct {
+        uint16_t frame_len;
+        uint16_t num_bins;
+        uint16_t fft_size;
+        double start_hz;
+        double step_hz;
+        double tone_hz;
+        double bound;           /* Of the peak */
+    } cases[] = {
+        { 1024, 256, 2048, 2950.0, 0.25, 2987.3, 0.002 },
+        { 1024, 256, 2048, 2950.0, 0.25, 3000.05, 0.002 },
+        { 512, 512, 1024, 100.0, 3.7, 1036.2, 0.006 },
+        { 2048, 1000, 4096, 7000.0, 0.9, 7700.0, 0.006 },
+        { 256, 64, 512, 10.0, 123.4, 4000.0, 0.006 },
+        { 1024, 512, 2048, 2990.0, 0.05, 2997.3, 0.006 },
+        { 1024, 512, 2048, 2000.0, 400.0, 6700.3, 0.006 },
+    };
+    static const double levels[] = { 30000.0, 300.0 };
+    char message[160];
+
+    TEST_SECTION("fft_czt - Tone against a double precision CZT");
+
+    for (uint32_t c = 0; c < sizeof(cases) / sizeof(cases[0]); c++) {
+        for (uint32_t l = 0; l < sizeof(levels) / sizeof(levels[0]); l++) {
+            uint32_t start = (uint32_t) llrint(cases[c].start_hz / SAMPLE_RATE * 4294967296.0);
+            uint32_t step = (uint32_t) llrint(cases[c].step_hz / SAMPLE_RATE * 4294967296.0);
+            fft_czt_t czt;
+            rfft_status_t status;
+            double worst;
+            int mag_ok;
+
+            fill_tone(cases[c].frame_len, cases[c].tone_hz, levels[l]);
+            status = fft_czt_init(&czt, cases[c].frame_len, cases[c].num_bins, start, step,
+                                  cases[c].fft_size, pre, post, filter, buffer);
+            next_bin = 0;
+            in_order = 1;
+            if (status == RFFT_SUCCESS) {
+                status = fft_czt_mag_sq(&czt, frame, store_mag, NULL);
+            }
+            reference_czt(cases[c].frame_len, cases[c].num_bins, start, step);
+            worst = worst_error(&czt, levels[l], &mag_ok);
+
+            snprintf(message, sizeof(message), "%4u samples, %4u bins of %6.2f Hz from %6.1f Hz, "
+                     "tone %5.0f at %8.2f Hz: within %.3f%% of the peak",
+                     cases[c].frame_len, cases[c].num_bins, cases[c].step_hz, cases[c].start_hz,
+                     levels[l], cases[c].tone_hz, 100.0 * worst);
+            TEST_ASSERT(status == RFFT_SUCCESS && in_order && next_bin == cases[c].num_bins &&
+                        mag_ok && worst <= cases[c].bound, message);
+        }
+    }
+}
+
+/**
+ * @brief Bins whose frequency wraps past the sample rate
+ *
+ * start + k * step, start * n and the chirp phases overflow 2^32 and
+ * wrap modulo a turn: bins starting just below fs and continuing past
+ * it, a step of more than half the sample rate, i.e. descending
+ * frequencies, a band across 0 Hz and a step of fs / 40 around the
+ * circle. The double CZT of the same wrapped frequencies is matched
+ * within the 0.6% of the tones.
+ */
+static void test_phase_wrap(void)
+{
+    static const struct {
+        uint32_t start;
+        uint32_t step;
+        double tone_hz;
+        const char *name;
+    } cases[] = {
+        { FFT_CZT_FREQ(15990U, SAMPLE_RATE), FFT_CZT_FREQ(1U, 320000U), 15997.3,
+          "Bins of 0.05 Hz from 15990 Hz, past fs" },
+        { FFT_CZT_FREQ(3000U, SAMPLE_RATE), 0U - FFT_CZT_FREQ(1U, 64000U), 2950.6,
+          "Bins of -0.25 Hz from 3000 Hz" },
+        { 0U - FFT_CZT_FREQ(100U, SAMPLE_RATE), FFT_CZT_FREQ(1U, 32000U), 61.8,
+          "Bins of 0.5 Hz from -100 Hz, across 0 Hz" },
+        { FFT_CZT_FREQ(7900U, SAMPLE_RATE), FFT_CZT_FREQ(1U, 40U), 6703.3,
+          "Bins of 400 Hz from 7900 Hz, around the circle" },
+    };
+    char message[128];
+
+    TEST_SECTION("fft_czt - Phase wrap");
+
+    for (uint32_t c = 0; c < sizeof(cases) / sizeof(cases[0]); c++) {
+        fft_czt_t czt;
+        rfft_status_t status;
+        double worst;
+        int mag_ok;
+
+        fill_tone(1024U, cases[c].tone_hz, 20000.0);
+        status = fft_czt_init(&czt, 1024U, 512U, cases[c].start, cases[c].step, 2048U, pre,
+                              post, filter, buffer);
+        next_bin = 0;
+        in_order = 1;
+        if (status == RFFT_SUCCESS) {
+            status = fft_czt_mag_sq(&czt, frame, store_mag, NULL);
+        }
+        reference_czt(1024U, 512U, cases[c].start, cases[c].step);
+        worst = worst_error(&czt, 20000.0, &mag_ok);
+
+        snprintf(message, sizeof(message), "%s: within %.3f%% of the peak", cases[c].name,
+                 100.0 * worst);
+        TEST_ASSERT(status == RFFT_SUCCESS && in_order && mag_ok && worst <= 0.006, message);
+    }
+}
+
+/**
+ * @brief frame_len + num_bins - 1 == fft_size, the most the CFFT holds
+ *
+ * The positive lags of the chirp then end just before its negative ones
+ * begin, so an off-by-one there would alias the first or the last bin.
+ * Every bin matches the double CZT within the 0.6% of the tones, and one
+ * bin more is rejected.
+ */
+static void test_boundary(void)
+{
+    static const struct {
+        uint16_t frame_len;
+        uint16_t num_bins;
+    } cases[] = {
+        { 1024, 1025 },
+        { 1537, 512 },
+        { 256, 1793 },
+        { 2048, 1 },
+    };
+    char message[128];
+
+    TEST_SECTION("fft_czt - Frame and bins filling fft_size");
+
+    for (uint32_t c = 0; c < sizeof(cases) / sizeof(cases[0]); c++) {
+        uint32_t start = FFT_CZT_FREQ(2900U, SAMPLE_RATE);
+        uint32_t step = FFT_CZT_FREQ(1U, 8000U);
+        fft_czt_t czt;
+        rfft_status_t status, over;
+        double worst;
+        int mag_ok;
+
+        fill_tone(cases[c].frame_len, 3011.7, 20000.0);
+        over = fft_czt_init(&czt, cases[c].frame_len, (uint16_t) (cases[c].num_bins + 1U), start,
+                            step, 2048U, pre, post, filter, buffer);
+        status = fft_czt_init(&czt, cases[c].frame_len, cases[c].num_bins, start, step, 2048U,
+                              pre, post, filter, buffer);
+        next_bin = 0;
+        in_order = 1;
+        if (status == RFFT_SUCCESS) {
+            status = fft_czt_mag_sq(&czt, frame, store_mag, NULL);
+        }
+        reference_czt(cases[c].frame_len, cases[c].num_bins, start, step);
+        worst = worst_error(&czt, 20000.0, &mag_ok);
+
+        snprintf(message, sizeof(message), "%4u samples, %4u bins in 2048 points: within %.3f%% "
+                 "of the peak, one bin more rejected", cases[c].frame_len, cases[c].num_bins,
+                 100.0 * worst);
+        TEST_ASSERT(status == RFFT_SUCCESS && over == RFFT_ERROR_INVALID_SIZE && in_order &&
+                    next_bin == cases[c].num_bins && mag_ok && worst <= 0.006, message);
+    }
+}
+
+/**
+ * @brief Argument checks
+ */
+static void test_errors(void)
+{
+    fft_czt_t czt;
+
+    TEST_SECTION("fft_czt - Errors");
+
+    TEST_ASSERT(fft_czt_init(NULL, 1024U, 256U, 0U, 1U, 2048U, pre, post, filter, buffer) ==
+                RFFT_ERROR_NULL_POINTER, "NULL transform rejected");
+    TEST_ASSERT(fft_czt_init(&czt, 1024U, 256U, 0U, 1U, 2048U, pre, post, NULL, buffer) ==
+                RFFT_ERROR_NULL_POINTER, "NULL filter rejected");
+    TEST_ASSERT(fft_czt_init(&czt, 0U, 256U, 0U, 1U, 2048U, pre, post, filter, buffer) ==
+                RFFT_ERROR_INVALID_SIZE, "Empty frame rejected");
+    TEST_ASSERT(fft_czt_init(&czt, 1024U, 0U, 0U, 1U, 2048U, pre, post, filter, buffer) ==
+                RFFT_ERROR_INVALID_SIZE, "No bins rejected");
+    TEST_ASSERT(fft_czt_init(&czt, 1000U, 256U, 0U, 1U, 1536U, pre, post, filter, buffer) ==
+                RFFT_ERROR_INVALID_SIZE, "fft_size without a CFFT rejected");
+    TEST_ASSERT(fft_czt_init(&czt, 1024U, 256U, 0U, 1U, 8192U, pre, post, filter, buffer) ==
+                RFFT_ERROR_INVALID_SIZE, "fft_size above half the largest RFFT rejected");
+    TEST_ASSERT(fft_czt_init(&czt, 1024U, 256U, 0U, 1U, 2048U, pre, post, filter, buffer) ==
+                RFFT_SUCCESS && fft_czt_mag_sq(&czt, frame, NULL, NULL) ==
+                RFFT_ERROR_NULL_POINTER, "NULL callback rejected");
+}
+
+/**
+ * @brief Main test runner
+ */
+int main(void) {
+    printf("=== Chirp-Z Transform Tests ===\n");
+
+    test_tone();
+    test_phase_wrap();
+    test_boundary();
+    test_errors();
+
+    /* Print summary */
+    printf("\n=== Test Summary ===\n");
+    printf("Passed: %d\n", tests_passed);
+    printf("Failed: %d\n", tests_failed);
+    printf("Total:  %d\n", tests_passed + tests_failed);
+
+    if (tests_failed == 0) {
+        printf("\n✓ The chirp-Z transform matches the double precision CZT!\n");
+        return 0;
+    } else {
+        printf("\n✗ Some tests failed!\n");
+        return 1;
+    }
+}
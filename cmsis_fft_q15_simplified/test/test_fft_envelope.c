@@ -0,0 +1,233 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library - Simplified Q15 RFFT
+ * Title:        test_fft_envelope.c
+ * Description:  Tests for the envelope spectrum of amplitude modulated carriers
+ *
+ * Target Processor: nRF54L15 FLPR (PC validation)
+ * -------------------------------------------------------------------- */
+
+#include "../include/rfft_q15.h"
+#include "fft_envelope.h"
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#if RFFT_Q15_MIN_FFT_LEN > 256 || RFFT_Q15_MAX_FFT_LEN < 4096
+#error "test_fft_envelope.c needs the lengths from 256 to 4096"
+#endif
+
+#define MAX_FFT_LEN  4096
+
+static q15_t frame[MAX_FFT_LEN] RFFT_Q15_ALIGN;
+static uint32_t envelope[MAX_FFT_LEN / 2 + 1];
+
+/* Test result tracking */
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+/* Test assertion macro */
+#define TEST_ASSERT(condition, message) \
+    do { \
+        if (condition) { \
+            printf("  ✓ %s\n", message); \
+            tests_passed++; \
+        } else { \
+            printf("  ✗ %s\n", message); \
+            tests_failed++; \
+        } \
+    } while(0)
+
+/* Test section header */
+#define TEST_SECTION(name) \
+    printf("\n=== %s ===\n", name)
+
+static const double pi = 3.14159265358979323846;
+
+static void store_bin(uint32_t bin, uint32_t mag_sq, void *user)
+{
+    ((uint32_t *) user)[bin] = mag_sq;
+}
+
+/* amplitude * (1 + depth * cos(modulation)) * cos(carrier), both in Hz */
+static void fill_am(uint32_t frame_len, double fs, double carrier_hz, double modulation_hz,
+                    double amplitude, double depth)
+{
+    for (uint32_t i = 0; i < frame_len; i++) {
+        double a = amplitude * (1.0 + depth * cos(2.0 * pi * modulation_hz * i / fs));
+
+        frame[i] = (q15_t) lrint(a * cos(2.0 * pi * carrier_hz * i / fs + 0.4));
+    }
+}
+
+static double db(double ratio)
+{
+    return 10.0 * log10(ratio);
+}
+
+/**
+ * @brief The modulation frequency of an AM carrier is the line of the envelope
+ *
+ * A carrier of amplitude A modulated to a depth m has the envelope
+ * A (1 + m cos), so the envelope spectrum holds one line, in bin k at
+ * k * fs / frame_len nearest the modulation frequency. The line must be
+ * the strongest bin above DC, at most half a bin from the modulation
+ * frequency. Of a modulation on a bin of the frame, its level times
+ * 2^exponent is the unscaled DFT of the envelope the header describes,
+ * A m frame_len fft_size / 4, within 0.5 dB (0.01 dB measured), and the
+ * second harmonic at least 40 dB below it (51 dB measured). Between two
+ * bins only the position is checked.
+ */
+static void test_modulation_line(void)
+{
+    static const struct {
+        uint16_t frame_len;
+        uint16_t decimation;
+        double fs;
+        double carrier_hz;
+        double modulation_hz;
+        double depth;
+    } cases[] = {
+        { 4096,  4, 16000.0, 4687.5,  144.53125, 0.5 },
+        { 4096, 16, 16000.0, 2343.75,  19.53125, 0.3 },
+        { 2048,  2, 48000.0, 7031.25, 3515.625,  0.8 },
+        { 1024,  8,  8000.0, 1562.5,   156.25,   0.5 },
+        {  256,  2, 16000.0, 3000.0,   500.0,    0.5 },
+        { 4096,  4, 16000.0, 5861.3,   241.2,    0.5 },
+        { 2048,  8, 25600.0, 6400.7,    87.3,    0.4 },
+    };
+    char message[192];
+
+    TEST_SECTION("fft_envelope - Line of the modulation");
+
+    for (uint32_t c = 0; c < sizeof(cases) / sizeof(cases[0]); c++) {
+        uint32_t n = cases[c].frame_len;
+        double fs = cases[c].fs;
+        double spacing = fs / n;
+        double mod_bins = cases[c].modulation_hz / spacing;
+        uint32_t expected = (uint32_t) lrint(mod_bins);
+        uint32_t reach = (uint32_t) lrint(cases[c].modulation_hz / spacing) + 20U;
+        uint32_t carrier = FFT_ENVELOPE_BIN(lrint(cases[c].carrier_hz), n, lrint(fs));
+        uint32_t peak = 1, half;
+        int on_bin = fabs(mod_bins - expected) < 1e-9;
+        fft_envelope_t env;
+        rfft_status_t status;
+
+        status = fft_envelope_init(&env, (uint16_t) n, cases[c].decimation,
+                                   (uint16_t) (carrier - reach), (uint16_t) (carrier + reach));
+        half = env.fft_size / 2U;
+        fill_am(n, fs, cases[c].carrier_hz, cases[c].modulation_hz, 12000.0, cases[c].depth);
+        fft_envelope_mag_sq(&env, frame, store_bin, envelope);
+
+        for (uint32_t k = 2; k <= half; k++) {
+            peak = (envelope[k] > envelope[peak]) ? k : peak;
+        }
+
+        snprintf(message, sizeof(message), "%4u / %2u, %7.1f Hz modulated at %8.3f Hz: "
+                 "line in bin %3u = %8.3f Hz (expected %3u)", n, cases[c].decimation,
+                 cases[c].carrier_hz, cases[c].modulation_hz, peak, peak * spacing, expected);
+        TEST_ASSERT(status == RFFT_SUCCESS && peak == expected &&
+                    fabs(peak * spacing - cases[c].modulation_hz) <= spacing / 2.0, message);
+
+        if (on_bin) {
+            double line = sqrt((double) envelope[peak]) * ldexp(1.0, env.exponent);
+            double model = 12000.0 * cases[c].depth * n * env.fft_size / 4.0;
+            double error = fabs(db(line * line / (model * model)));
+            double harmonic = (2U * peak <= half && envelope[2U * peak] > 0U) ?
+                              db((double) envelope[peak] / envelope[2U * peak]) : 99.0;
+
+            snprintf(message, sizeof(message), "%4u / %2u: level within 0.5 dB of "
+                     "A m frame_len fft_size / 4 (%.2f dB), harmonic %.1f dB below",
+                     n, cases[c].decimation, error, harmonic);
+            TEST_ASSERT(error <= 0.5 && harmonic >= 40.0, message);
+        }
+    }
+}
+
+/**
+ * @brief An unmodulated carrier leaves no line above the noise of the envelope
+ *
+ * A constant envelope has nothing left once its mean is removed; every
+ * bin above DC stays at least 40 dB below the line a modulation of
+ * depth 0.5 gives in the same setup (62 dB measured).
+ */
+static void test_no_modulation(void)
+{
+    fft_envelope_t env;
+    uint32_t carrier = FFT_ENVELOPE_BIN(4688U, 4096U, 16000U);
+    uint32_t strongest = 0;
+    double line, ratio;
+    char message[128];
+
+    TEST_SECTION("fft_envelope - Carrier without modulation");
+
+    fft_envelope_init(&env, 4096U, 4U, (uint16_t) (carrier - 57U), (uint16_t) (carrier + 57U));
+    fill_am(4096U, 16000.0, 4687.5, 144.53125, 12000.0, 0.5);
+    fft_envelope_mag_sq(&env, frame, store_bin, envelope);
+    /* Frames compare after scaling by 2^exponent */
+    line = ldexp((double) envelope[37], 2 * env.exponent);
+
+    fill_am(4096U, 16000.0, 4687.5, 144.53125, 12000.0, 0.0);
+    fft_envelope_mag_sq(&env, frame, store_bin, envelope);
+    for (uint32_t k = 1; k <= env.fft_size / 2U; k++) {
+        strongest = (envelope[k] > strongest) ? envelope[k] : strongest;
+    }
+
+    ratio = (strongest != 0U) ? db(line / ldexp((double) strongest, 2 * env.exponent)) : 99.0;
+
+    snprintf(message, sizeof(message), "Strongest bin %.1f dB below the modulated line", ratio);
+    TEST_ASSERT(ratio >= 40.0, message);
+}
+
+/**
+ * @brief Argument checks
+ */
+static void test_errors(void)
+{
+    fft_envelope_t env;
+
+    TEST_SECTION("fft_envelope - Errors");
+
+    TEST_ASSERT(fft_envelope_init(NULL, 4096U, 4U, 100U, 200U) == RFFT_ERROR_NULL_POINTER,
+                "NULL envelope rejected");
+    TEST_ASSERT(fft_envelope_init(&env, 3000U, 4U, 100U, 200U) == RFFT_ERROR_INVALID_SIZE,
+                "Frame length without an RFFT rejected");
+    TEST_ASSERT(fft_envelope_init(&env, 4096U, 1U, 100U, 200U) == RFFT_ERROR_INVALID_SIZE,
+                "Decimation of 1 rejected");
+    TEST_ASSERT(fft_envelope_init(&env, 4096U, 6U, 100U, 200U) == RFFT_ERROR_INVALID_SIZE,
+                "Decimation other than a power of two rejected");
+    TEST_ASSERT(fft_envelope_init(&env, 4096U, 4U, 0U, 200U) == RFFT_ERROR_INVALID_SIZE,
+                "Band with DC rejected");
+    TEST_ASSERT(fft_envelope_init(&env, 4096U, 4U, 100U, 2048U) == RFFT_ERROR_INVALID_SIZE,
+                "Band with Nyquist rejected");
+    TEST_ASSERT(fft_envelope_init(&env, 4096U, 4U, 300U, 200U) == RFFT_ERROR_INVALID_SIZE,
+                "Band ending below its start rejected");
+    TEST_ASSERT(fft_envelope_init(&env, 4096U, 4U, 100U, 1124U) == RFFT_ERROR_INVALID_SIZE,
+                "Band wider than fft_size rejected");
+    TEST_ASSERT(fft_envelope_init(&env, 4096U, 4U, 100U, 1123U) == RFFT_SUCCESS,
+                "Band of fft_size bins accepted");
+}
+
+/**
+ * @brief Main test runner
+ */
+int main(void) {
+    printf("=== Envelope Spectrum Tests ===\n");
+
+    test_modulation_line();
+    test_no_modulation();
+    test_errors();
+
+    /* Print summary */
+    printf("\n=== Test Summary ===\n");
+    printf("Passed: %d\n", tests_passed);
+    printf("Failed: %d\n", tests_failed);
+    printf("Total:  %d\n", tests_passed + tests_failed);
+
+    if (tests_failed == 0) {
+        printf("\n✓ The envelope spectrum finds the modulation frequency!\n");
+        return 0;
+    } else {
+        printf("\n✗ Some tests failed!\n");
+        return 1;
+    }
+}
@@ -0,0 +1,401 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library - Simplified Q15 RFFT
+ * Title:        test_fft_order.c
+ * Description:  Tests for the order tracking resampler against a swept shaft
+ *
+ * Target Processor: nRF54L15 FLPR (PC validation)
+ * -------------------------------------------------------------------- */
+
+#include "../include/rfft_q15.h"
+#include "fft_order.h"
+#include "fft_zoom.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#if RFFT_Q15_MIN_FFT_LEN > 256 || RFFT_Q15_MAX_FFT_LEN < 4096
+#error "test_fft_order.c needs the lengths from 256 to 4096"
+#endif
+
+#define SAMPLE_RATE      16000.0
+#define NUM_PHASES       32
+#define TAPS_PER_PHASE   8
+#define SAMPLES_PER_REV  64
+#define REVS_PER_FRAME   64
+#define FRAME_LEN        (SAMPLES_PER_REV * REVS_PER_FRAME)
+#define HISTORY_LEN      1024
+#define NUM_FRAMES       2
+#define BLOCK            160
+#define MAX_SAMPLES      65536
+#define MAX_REVS         (NUM_FRAMES * REVS_PER_FRAME + 3)
+
+static q15_t taps[NUM_PHASES * TAPS_PER_PHASE];
+static q15_t history[2 * HISTORY_LEN];
+static q15_t frame[FRAME_LEN] RFFT_Q15_ALIGN;
+static q15_t input[MAX_SAMPLES];
+static q15_t frames[NUM_FRAMES][FRAME_LEN];
+static uint32_t pulses[MAX_REVS];
+static double power[FRAME_LEN / 2 + 1];
+
+/* Test result tracking */
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+/* Test assertion macro */
+#define TEST_ASSERT(condition, message) \
+    do { \
+        if (condition) { \
+            printf("  ✓ %s\n", message); \
+            tests_passed++; \
+        } else { \
+            printf("  ✗ %s\n", message); \
+            tests_failed++; \
+        } \
+    } while(0)
+
+/* Test section header */
+#define TEST_SECTION(name) \
+    printf("\n=== %s ===\n", name)
+
+static const double pi = 3.14159265358979323846;
+
+/* Shaft speed swept linearly from 20 to 60 revolutions per second */
+static const double speed_start = 20.0;
+static double sweep_rate;
+
+/* Two orders locked to the shaft, one of them half way between orders */
+static const double orders[] = { 5.0, 11.5 };
+static const double order_level = 9000.0;
+
+/* Shaft angle in revolutions at t seconds */
+static double shaft_angle(double t)
+{
+    return speed_start * t + 0.5 * sweep_rate * t * t;
+}
+
+/* Time in seconds at which the shaft has turned rev revolutions */
+static double rev_time(double rev)
+{
+    return (sqrt(speed_start * speed_start + 2.0 * sweep_rate * rev) - speed_start) /
+           sweep_rate;
+}
+
+/* The orders at t seconds */
+static double locked_signal(double t)
+{
+    double angle = shaft_angle(t);
+    double x = 0.0;
+
+    for (uint32_t k = 0; k < sizeof(orders) / sizeof(orders[0]); k++) {
+        x += order_level * sin(2.0 * pi * orders[k] * angle);
+    }
+
+    return x;
+}
+
+/*
+ * Input sweeping from 20 to 60 rev/s over revs revolutions, two more to
+ * let the last ones through, and its revs + 3 pulses in Q8 samples
+ */
+static uint32_t fill_sweep(uint32_t revs)
+{
+    uint32_t count;
+
+    sweep_rate = 40.0 / (revs / 40.0);
+    count = (uint32_t) (rev_time(revs + 2U) * SAMPLE_RATE);
+
+    for (uint32_t n = 0; n < count; n++) {
+        input[n] = (q15_t) lrint(locked_signal(n / SAMPLE_RATE));
+    }
+    for (uint32_t r = 0; r <= revs + 2U; r++) {
+        pulses[r] = (uint32_t) lrint(rev_time(r) * SAMPLE_RATE * 256.0);
+    }
+
+    return count;
+}
+
+/* Double precision power spectrum of len samples, bins 0 to last */
+static void power_spectrum(const q15_t *x, uint32_t len, uint32_t last)
+{
+    for (uint32_t k = 0; k <= last; k++) {
+        double re = 0.0, im = 0.0;
+
+        for (uint32_t i = 0; i < len; i++) {
+            double phase = 2.0 * pi * (double) ((k * i) % len) / len;
+            re += x[i] * cos(phase);
+            im -= x[i] * sin(phase);
+        }
+        power[k] = re * re + im * im;
+    }
+}
+
+/* Share of the power of bins lo to hi in bins centre - 1 to centre + 1 */
+static double share_around(uint32_t centre, uint32_t lo, uint32_t hi)
+{
+    double total = 0.0, near = 0.0;
+
+    for (uint32_t k = lo; k <= hi; k++) {
+        total += power[k];
+        if (k + 1U >= centre && k <= centre + 1U) {
+            near += power[k];
+        }
+    }
+
+    return near / total;
+}
+
+/* Largest power of bins lo to hi */
+static uint32_t peak_between(uint32_t lo, uint32_t hi)
+{
+    uint32_t peak = lo;
+
+    for (uint32_t k = lo + 1U; k <= hi; k++) {
+        if (power[k] > power[peak]) {
+            peak = k;
+        }
+    }
+
+    return peak;
+}
+
+/*
+ * Resample the sweep in blocks of BLOCK samples, each pulse added before
+ * the block it falls into; the frames in frames, their number returned
+ */
+static uint32_t run_order(fft_order_t *order, uint32_t count, uint32_t num_pulses)
+{
+    uint32_t next_pulse = 0, done = 0;
+
+    for (uint32_t pos = 0; pos < count; ) {
+        uint32_t n = (count - pos < BLOCK) ? count - pos : BLOCK;
+
+        while (next_pulse < num_pulses && pulses[next_pulse] < ((pos + n) << 8)) {
+            fft_order_pulse(order, pulses[next_pulse++]);
+        }
+
+        for (uint32_t used = 0; used < n; ) {
+            used += fft_order_push(order, &input[pos + used], n - used);
+            if (fft_order_frame_ready(order)) {
+                if (done < NUM_FRAMES) {
+                    memcpy(frames[done], order->frame, sizeof(frames[0]));
+                }
+                done++;
+                fft_order_release(order);
+            }
+        }
+        pos += n;
+    }
+
+    return done;
+}
+
+/**
+ * @brief The interpolator is the zoom FFT low-pass with num_phases the gain
+ */
+static void test_design(void)
+{
+    static q15_t lowpass[NUM_PHASES * TAPS_PER_PHASE];
+    int32_t gain = 32768;
+    uint32_t same = 1;
+
+    TEST_SECTION("fft_order - Interpolator design");
+
+    fft_order_design(taps, NUM_PHASES, TAPS_PER_PHASE);
+    fft_zoom_design_lowpass(lowpass, NUM_PHASES * TAPS_PER_PHASE, NUM_PHASES);
+
+    for (uint32_t j = 0; j < NUM_PHASES * TAPS_PER_PHASE; j++) {
+        same &= taps[j] == lowpass[j] * NUM_PHASES;
+    }
+    TEST_ASSERT(same, "Taps are those of fft_zoom_design_lowpass() times num_phases");
+
+    /* Every phase on its own a DC gain near unity */
+    for (uint32_t p = 0; p < NUM_PHASES; p++) {
+        int32_t sum = 0;
+
+        for (uint32_t j = 0; j < TAPS_PER_PHASE; j++) {
+            sum += taps[p + j * NUM_PHASES];
+        }
+        gain = (abs(sum - 32768) > abs(gain - 32768)) ? sum : gain;
+    }
+
+    {
+        char message[96];
+
+        snprintf(message, sizeof(message), "DC gain of every phase within 1 %% of unity "
+                 "(worst %.4f)", gain / 32768.0);
+        TEST_ASSERT(fabs(gain / 32768.0 - 1.0) <= 0.01, message);
+    }
+}
+
+/**
+ * @brief A swept tone locked to the shaft stays in its order bin
+ *
+ * The shaft speeds up from 20 to 60 revolutions per second over two
+ * frames of 64 revolutions. Orders 5 and 11.5 land in bins 320 and 736
+ * of each frame with 99 % of their power within one bin; at the fixed
+ * rate over about the second frame order 5 keeps under 10 % there. The
+ * resampled samples match the orders at their instants, in double
+ * precision, at an SNR of 40 dB or more (49 dB measured).
+ */
+static void test_swept_order(void)
+{
+    fft_order_t order;
+    uint32_t revs = NUM_FRAMES * REVS_PER_FRAME;
+    uint32_t count = fill_sweep(revs);
+    uint32_t done;
+    char message[128];
+
+    TEST_SECTION("fft_order - Swept tone locked to the shaft");
+
+    fft_order_design(taps, NUM_PHASES, TAPS_PER_PHASE);
+    fft_order_init(&order, taps, NUM_PHASES, TAPS_PER_PHASE, SAMPLES_PER_REV, FRAME_LEN,
+                   history, HISTORY_LEN, frame, 0U);
+    done = run_order(&order, count, revs + 3U);
+
+    /* The first revolution starts before the history of the interpolator */
+    snprintf(message, sizeof(message), "%u frames of %u revolutions, %u revolution dropped",
+             done, REVS_PER_FRAME, order.dropped);
+    TEST_ASSERT(done == NUM_FRAMES && order.dropped == 1U, message);
+
+    for (uint32_t f = 0; f < NUM_FRAMES && f < done; f++) {
+        double signal = 0.0, noise = 0.0;
+
+        power_spectrum(frames[f], FRAME_LEN, FRAME_LEN / 2U);
+        for (uint32_t k = 0; k < sizeof(orders) / sizeof(orders[0]); k++) {
+            /* Order k in bin k * frame_len / samples_per_rev, up to half way to the next */
+            uint32_t bin = (uint32_t) lrint(orders[k] * REVS_PER_FRAME);
+            uint32_t lo = (k == 0U) ? 1U : (bin + (uint32_t) lrint(orders[k - 1U] * REVS_PER_FRAME)) / 2U;
+            uint32_t hi = (k + 1U == sizeof(orders) / sizeof(orders[0])) ? FRAME_LEN / 2U :
+                          (bin + (uint32_t) lrint(orders[k + 1U] * REVS_PER_FRAME)) / 2U;
+            uint32_t peak = peak_between(lo, hi);
+            double share = share_around(bin, lo, hi);
+
+            snprintf(message, sizeof(message), "Frame %u, order %4.1f: peak in bin %u "
+                     "(expected %u), %.2f %% within one bin", f, orders[k], peak, bin,
+                     100.0 * share);
+            TEST_ASSERT(peak == bin && share >= 0.99, message);
+        }
+
+        /* Revolution 1 + 64 f onwards, between the pulses as passed in */
+        for (uint32_t i = 0; i < FRAME_LEN; i++) {
+            uint32_t r = 1U + f * REVS_PER_FRAME + i / SAMPLES_PER_REV;
+            double len = (double) (pulses[r + 1U] - pulses[r]);
+            double t = (pulses[r] + (i % SAMPLES_PER_REV) * len / SAMPLES_PER_REV) /
+                       (256.0 * SAMPLE_RATE);
+            double x = locked_signal(t);
+
+            signal += x * x;
+            noise += (frames[f][i] - x) * (frames[f][i] - x);
+        }
+
+        snprintf(message, sizeof(message), "Frame %u: samples at their shaft angles, "
+                 "SNR %.1f dB >= 40 dB", f, 10.0 * log10(signal / noise));
+        TEST_ASSERT(10.0 * log10(signal / noise) >= 40.0, message);
+    }
+
+    /*
+     * The 16384 input samples up to the end of the second frame, at the
+     * fixed rate about as many revolutions, 1 Hz bins: order 5 sweeps
+     * from 225 to 300 Hz, below bin 384 and order 11.5
+     */
+    power_spectrum(&input[(pulses[revs + 1U] >> 8) - 16384U], 16384U, 384U);
+    {
+        double share = share_around(peak_between(1U, 384U), 1U, 384U);
+
+        snprintf(message, sizeof(message), "At the fixed rate order %.1f spreads, %.1f %% of "
+                 "the power within one bin", orders[0], 100.0 * share);
+        TEST_ASSERT(share < 0.1, message);
+    }
+}
+
+/**
+ * @brief Revolutions that do not fit the history, or pulses that overflow, are dropped
+ */
+static void test_dropped(void)
+{
+    fft_order_t order;
+    uint32_t dropped;
+    char message[96];
+
+    TEST_SECTION("fft_order - Dropped revolutions");
+
+    fft_order_design(taps, NUM_PHASES, TAPS_PER_PHASE);
+    fft_order_init(&order, taps, NUM_PHASES, TAPS_PER_PHASE, SAMPLES_PER_REV, FRAME_LEN,
+                   history, HISTORY_LEN, frame, 0U);
+    memset(input, 0, 4U * HISTORY_LEN * sizeof(q15_t));
+
+    /* A revolution as long as the history, then a normal one */
+    fft_order_pulse(&order, 100U << 8);
+    fft_order_pulse(&order, (100U + HISTORY_LEN) << 8);
+    fft_order_pulse(&order, (400U + HISTORY_LEN) << 8);
+    fft_order_push(&order, input, 4U * HISTORY_LEN);
+    snprintf(message, sizeof(message), "Revolution longer than the history dropped (%u), "
+             "the next resampled (%u)", order.dropped, order.collected);
+    TEST_ASSERT(order.dropped == 1U && order.collected == SAMPLES_PER_REV, message);
+
+    /* The last pulse is still pending, so one more than FFT_ORDER_MAX_PULSES drops two */
+    dropped = order.dropped;
+    for (uint32_t i = 0; i <= FFT_ORDER_MAX_PULSES; i++) {
+        fft_order_pulse(&order, (5U * HISTORY_LEN + 300U * i) << 8);
+    }
+    snprintf(message, sizeof(message), "Pulses beyond FFT_ORDER_MAX_PULSES drop the oldest (%u)",
+             order.dropped - dropped);
+    TEST_ASSERT(order.dropped == dropped + 2U && order.num_pulses == FFT_ORDER_MAX_PULSES &&
+                order.pulse[0] == (5U * HISTORY_LEN + 300U) << 8, message);
+
+    /* Pulses 1 to 3 lie before the position, 4 to 8 are kept */
+    fft_order_reset(&order, 5U * HISTORY_LEN + 1000U);
+    snprintf(message, sizeof(message), "Reset forgets the pulses before its position (%u kept)",
+             order.num_pulses);
+    TEST_ASSERT(order.num_pulses == 5U && order.collected == 0U, message);
+}
+
+/**
+ * @brief Argument checks
+ */
+static void test_errors(void)
+{
+    fft_order_t order;
+
+    TEST_SECTION("fft_order - Errors");
+
+    TEST_ASSERT(fft_order_design(taps, 512U, 8U) == RFFT_ERROR_INVALID_SIZE,
+                "More than 256 phases rejected");
+    TEST_ASSERT(fft_order_design(taps, 32U, 0U) == RFFT_ERROR_INVALID_SIZE,
+                "No taps per phase rejected");
+    TEST_ASSERT(fft_order_init(NULL, taps, 32U, 8U, 64U, 4096U, history, 1024U, frame, 0U) ==
+                RFFT_ERROR_NULL_POINTER, "NULL resampler rejected");
+    TEST_ASSERT(fft_order_init(&order, taps, 24U, 8U, 64U, 4096U, history, 1024U, frame, 0U) ==
+                RFFT_ERROR_INVALID_SIZE, "Phases not a power of two rejected");
+    TEST_ASSERT(fft_order_init(&order, taps, 32U, 8U, 64U, 4096U, history, 1000U, frame, 0U) ==
+                RFFT_ERROR_INVALID_SIZE, "History not a power of two rejected");
+    TEST_ASSERT(fft_order_init(&order, taps, 32U, 8U, 64U, 4000U, history, 1024U, frame, 0U) ==
+                RFFT_ERROR_INVALID_SIZE, "Frame not whole revolutions rejected");
+}
+
+/**
+ * @brief Main test runner
+ */
+int main(void) {
+    printf("=== Order Tracking Tests ===\n");
+
+    test_design();
+    test_swept_order();
+    test_dropped();
+    test_errors();
+
+    /* Print summary */
+    printf("\n=== Test Summary ===\n");
+    printf("Passed: %d\n", tests_passed);
+    printf("Failed: %d\n", tests_failed);
+    printf("Total:  %d\n", tests_passed + tests_failed);
+
+    if (tests_failed == 0) {
+        printf("\n✓ The resampled orders stay in their bins!\n");
+        return 0;
+    } else {
+        printf("\n✗ Some tests failed!\n");
+        return 1;
+    }
+}
@@ -0,0 +1,383 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library - Simplified Q15 RFFT
+ * Title:        test_fft_pipeline.c
+ * Description:  Tests for the chains of analysis stages of the stream
+ *
+ * Target Processor: nRF54L15 FLPR (PC validation)
+ * -------------------------------------------------------------------- */
+
+#include "../include/rfft_q15.h"
+#include "fft_pipeline.h"
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#if RFFT_Q15_MIN_FFT_LEN > 1024 || RFFT_Q15_MAX_FFT_LEN < 1024
+#error "test_fft_pipeline.c needs the length 1024"
+#endif
+
+#define FFT_LEN   1024
+#define NUM_BINS  (FFT_LEN / 2 + 1)
+#define MAX_TOP   20
+
+/* Bytes of the window table of FFT_LEN as the arena hands them out */
+#define WINDOW_BYTES  FFT_ARENA_SIZE(FFT_WINDOW_TABLE_LEN(FFT_LEN) * sizeof(q15_t))
+
+static q15_t work[FFT_LEN] RFFT_Q15_ALIGN;
+static spectral_peak_t peaks[MAX_TOP];
+static uint32_t psd_acc[SPECTRAL_PSD_STORAGE_LEN(NUM_BINS)];
+static uint32_t arena_buf[4096];
+
+/* Unfused reference of test_fused_equals_stages() */
+static q15_t ref_work[FFT_LEN] RFFT_Q15_ALIGN;
+static spectral_peak_t ref_peaks[MAX_TOP];
+static uint32_t ref_acc[SPECTRAL_PSD_STORAGE_LEN(NUM_BINS)];
+static q15_t ref_window[FFT_WINDOW_TABLE_LEN(FFT_LEN)];
+static q15_t frame[FFT_LEN] RFFT_Q15_ALIGN;
+static q15_t ref_frame[FFT_LEN] RFFT_Q15_ALIGN;
+
+/* Test result tracking */
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+/* Test assertion macro */
+#define TEST_ASSERT(condition, message) \
+    do { \
+        if (condition) { \
+            printf("  ✓ %s\n", message); \
+            tests_passed++; \
+        } else { \
+            printf("  ✗ %s\n", message); \
+            tests_failed++; \
+        } \
+    } while(0)
+
+/* Test section header */
+#define TEST_SECTION(name) \
+    printf("\n=== %s ===\n", name)
+
+#define S(id, param) { (id), 0, (param) }
+
+/*
+ * Build a chain on a fresh context of FFT_LEN points, with arena_size
+ * bytes of arena and the average given to FFT_STAGE_PSD if with_psd.
+ */
+static int build(struct fft_pipeline *pipe, fft_context_t *ctx, size_t arena_size, int with_psd,
+                 const struct fft_stage *stages, uint32_t num_stages)
+{
+    static spectral_psd_t psd;
+    struct fft_arena arena;
+
+    fft_context_init(ctx, FFT_LEN, work, peaks, MAX_TOP);
+    spectral_psd_init(&psd, psd_acc, NUM_BINS, SPECTRAL_PSD_LINEAR, 2);
+    fft_arena_init(&arena, arena_buf, arena_size);
+    memset(pipe, 0, sizeof(*pipe));
+    pipe->psd = with_psd ? &psd : NULL;
+
+    return fft_pipeline_build(pipe, ctx, &arena, stages, num_stages);
+}
+
+/**
+ * @brief Chains out of order, repeated, without their FFT or out of range
+ *
+ * Every chain is one change from a valid one, so the return value is that
+ * of the rule it breaks: -EINVAL for the order of the kinds, a stage given
+ * twice, no FFT or two, a spectrum or send stage before the FFT, a send
+ * stage without what it sends and a parameter out of range, -ENOTSUP for
+ * an unknown stage or FFT_STAGE_PSD without an average, -ENOMEM for an
+ * arena too small for the window table or the bands.
+ */
+static void test_build_rejections(void)
+{
+    static const struct {
+        const char *what;
+        struct fft_stage stages[FFT_PIPELINE_MAX_STAGES + 1];
+        uint32_t num_stages;
+        size_t arena_size;
+        int with_psd;
+        int expected;
+    } cases[] = {
+        { "Empty chain, without an FFT",
+          { { 0 } }, 0, sizeof(arena_buf), 1, -EINVAL },
+        { "Sample stages only, without an FFT",
+          { S(FFT_STAGE_DC_BLOCK, 0), S(FFT_STAGE_WINDOW, FFT_STREAM_WINDOW_HANN) },
+          2, sizeof(arena_buf), 1, -EINVAL },
+        { "Two FFTs",
+          { S(FFT_STAGE_FFT, 0), S(FFT_STAGE_FFT, 0) }, 2, sizeof(arena_buf), 1, -EINVAL },
+        { "Window after the FFT",
+          { S(FFT_STAGE_FFT, 0), S(FFT_STAGE_WINDOW, FFT_STREAM_WINDOW_HANN) },
+          2, sizeof(arena_buf), 1, -EINVAL },
+        { "Pre-emphasis after the window, the same kind, accepted",
+          { S(FFT_STAGE_WINDOW, FFT_STREAM_WINDOW_HANN), S(FFT_STAGE_PREEMPHASIS, 0),
+            S(FFT_STAGE_FFT, 0) }, 3, sizeof(arena_buf), 1, 0 },
+        { "FFT after the top bins",
+          { S(FFT_STAGE_TOP_K, 0), S(FFT_STAGE_FFT, 0) }, 2, sizeof(arena_buf), 1, -EINVAL },
+        { "Send stage before the spectrum stage it sends",
+          { S(FFT_STAGE_FFT, 0), S(FFT_STAGE_SEND_RESULT, 0), S(FFT_STAGE_TOP_K, 0) },
+          3, sizeof(arena_buf), 1, -EINVAL },
+        { "DC blocker given twice",
+          { S(FFT_STAGE_DC_BLOCK, 0), S(FFT_STAGE_DC_BLOCK, 0), S(FFT_STAGE_FFT, 0) },
+          3, sizeof(arena_buf), 1, -EINVAL },
+        { "Bands given twice",
+          { S(FFT_STAGE_FFT, 0), S(FFT_STAGE_BANDS, 4), S(FFT_STAGE_BANDS, 4) },
+          3, sizeof(arena_buf), 1, -EINVAL },
+        { "Result sent without the top bins",
+          { S(FFT_STAGE_FFT, 0), S(FFT_STAGE_BANDS, 4), S(FFT_STAGE_SEND_RESULT, 0) },
+          3, sizeof(arena_buf), 1, -EINVAL },
+        { "Bands sent without the bands",
+          { S(FFT_STAGE_FFT, 0), S(FFT_STAGE_TOP_K, 0), S(FFT_STAGE_SEND_BANDS, 0) },
+          3, sizeof(arena_buf), 1, -EINVAL },
+        { "Unknown stage",
+          { S(FFT_STAGE_FFT, 0), S(0x33, 0) }, 2, sizeof(arena_buf), 1, -ENOTSUP },
+        { "Power spectrum average without an average",
+          { S(FFT_STAGE_FFT, 0), S(FFT_STAGE_PSD, 0) }, 2, sizeof(arena_buf), 0, -ENOTSUP },
+        { "More than FFT_PIPELINE_MAX_STAGES stages",
+          { S(FFT_STAGE_DC_BLOCK, 0), S(FFT_STAGE_PREEMPHASIS, 0),
+            S(FFT_STAGE_WINDOW, FFT_STREAM_WINDOW_HANN), S(FFT_STAGE_FFT, 0),
+            S(FFT_STAGE_BANDS, 4), S(FFT_STAGE_PSD, 0), S(FFT_STAGE_TOP_K, 0),
+            S(FFT_STAGE_SEND_RESULT, 0), S(FFT_STAGE_SEND_BANDS, 0),
+            S(FFT_STAGE_SEND_BANDS, 0), S(FFT_STAGE_SEND_BANDS, 0) },
+          FFT_PIPELINE_MAX_STAGES + 1, sizeof(arena_buf), 1, -EINVAL },
+        { "DC blocker pole above 1.0",
+          { S(FFT_STAGE_DC_BLOCK, 0x8000), S(FFT_STAGE_FFT, 0) },
+          2, sizeof(arena_buf), 1, -EINVAL },
+        { "Pre-emphasis above 1.0",
+          { S(FFT_STAGE_PREEMPHASIS, 0x8000), S(FFT_STAGE_FFT, 0) },
+          2, sizeof(arena_buf), 1, -EINVAL },
+        { "Unknown window",
+          { S(FFT_STAGE_WINDOW, FFT_STREAM_WINDOW_BLACKMAN + 1), S(FFT_STAGE_FFT, 0) },
+          2, sizeof(arena_buf), 1, -EINVAL },
+        { "No bands",
+          { S(FFT_STAGE_FFT, 0), S(FFT_STAGE_BANDS, 0) }, 2, sizeof(arena_buf), 1, -EINVAL },
+        { "More bands than CONFIG_APP_FFT_BANDS_MAX",
+          { S(FFT_STAGE_FFT, 0), S(FFT_STAGE_BANDS, CONFIG_APP_FFT_BANDS_MAX + 1) },
+          2, sizeof(arena_buf), 1, -EINVAL },
+        { "More top bins than the context finds",
+          { S(FFT_STAGE_FFT, 0), S(FFT_STAGE_TOP_K, MAX_TOP + 1) },
+          2, sizeof(arena_buf), 1, -EINVAL },
+        { "Arena too small for the window table",
+          { S(FFT_STAGE_WINDOW, FFT_STREAM_WINDOW_HANN), S(FFT_STAGE_FFT, 0) },
+          2, WINDOW_BYTES - FFT_ARENA_ALIGN, 1, -ENOMEM },
+        { "Arena too small for the bands after the window table",
+          { S(FFT_STAGE_WINDOW, FFT_STREAM_WINDOW_HANN), S(FFT_STAGE_FFT, 0),
+            S(FFT_STAGE_BANDS, 12) },
+          3, WINDOW_BYTES + 11 * sizeof(spectral_band_t), 1, -ENOMEM },
+        { "Arena of the window table and the bands",
+          { S(FFT_STAGE_WINDOW, FFT_STREAM_WINDOW_HANN), S(FFT_STAGE_FFT, 0),
+            S(FFT_STAGE_BANDS, 12) },
+          3, WINDOW_BYTES + 12 * sizeof(spectral_band_t), 1, 0 },
+    };
+    struct fft_pipeline pipe;
+    fft_context_t ctx;
+    char message[128];
+
+    TEST_SECTION("fft_pipeline - Chains refused");
+
+    for (uint32_t c = 0; c < sizeof(cases) / sizeof(cases[0]); c++) {
+        int ret = build(&pipe, &ctx, cases[c].arena_size, cases[c].with_psd,
+                        cases[c].stages, cases[c].num_stages);
+
+        snprintf(message, sizeof(message), "%s: %d (expected %d)", cases[c].what, ret,
+                 cases[c].expected);
+        TEST_ASSERT(ret == cases[c].expected, message);
+    }
+}
+
+/**
+ * @brief A full chain builds into what it asks for
+ *
+ * Every stage once, in order: the sample loop runs the three passes with
+ * the window moved out of the context, the bands split bins 1 to
+ * fft_size / 2 evenly, TOP_K given 0 finds CONFIG_APP_FFT_TOP_BINS, both
+ * results are sent, and building the FFT alone afterwards leaves the
+ * context without the window, bands and average of the chain before.
+ */
+static void test_build_full_chain(void)
+{
+    static const struct fft_stage chain[] = {
+        S(FFT_STAGE_DC_BLOCK, 0), S(FFT_STAGE_PREEMPHASIS, 30000),
+        S(FFT_STAGE_WINDOW, FFT_STREAM_WINDOW_HAMMING), S(FFT_STAGE_FFT, 0),
+        S(FFT_STAGE_BANDS, 5), S(FFT_STAGE_PSD, 0), S(FFT_STAGE_TOP_K, 0),
+        S(FFT_STAGE_SEND_RESULT, 0), S(FFT_STAGE_SEND_BANDS, 0),
+    };
+    static const struct fft_stage fft_only[] = { S(FFT_STAGE_FFT, 0) };
+    struct fft_pipeline pipe;
+    fft_context_t ctx;
+    struct fft_arena arena;
+    int ret;
+    int even = 1;
+
+    TEST_SECTION("fft_pipeline - Full chain");
+
+    ret = build(&pipe, &ctx, sizeof(arena_buf), 1, chain, sizeof(chain) / sizeof(chain[0]));
+    TEST_ASSERT(ret == 0 && pipe.num_stages == sizeof(chain) / sizeof(chain[0]) &&
+                memcmp(pipe.stages, chain, sizeof(chain)) == 0, "Built, every stage kept");
+    TEST_ASSERT(pipe.ops == (FFT_PIPELINE_OP_DC_BLOCK | FFT_PIPELINE_OP_PREEMPHASIS |
+                             FFT_PIPELINE_OP_WINDOW) &&
+                pipe.prefilter.pole == 32604 && pipe.prefilter.emphasis == 30000,
+                "Sample loop of the three passes, default pole for 0");
+    TEST_ASSERT(pipe.window != NULL && ctx.window == NULL && ctx.window_type == FFT_WINDOW_HAMMING,
+                "Window applied by the chain, its type kept by the context");
+
+    for (uint32_t i = 0; i < pipe.num_bands; i++) {
+        uint32_t width = pipe.bands[i].last_bin - pipe.bands[i].first_bin + 1U;
+
+        even &= (width == (FFT_LEN / 2) / 5 || width == (FFT_LEN / 2) / 5 + 1);
+        even &= (i == 0) ? (pipe.bands[i].first_bin == 1) :
+                (pipe.bands[i].first_bin == pipe.bands[i - 1].last_bin + 1U);
+    }
+    TEST_ASSERT(pipe.num_bands == 5 && ctx.bands == pipe.bands && even &&
+                pipe.bands[4].last_bin == FFT_LEN / 2, "Five even bands over bins 1 to 512");
+    TEST_ASSERT(ctx.psd == pipe.psd && pipe.top_k == CONFIG_APP_FFT_TOP_BINS &&
+                pipe.outputs == (FFT_PIPELINE_OUT_RESULT | FFT_PIPELINE_OUT_BANDS) &&
+                fft_pipeline_top_k(&pipe, 50) == CONFIG_APP_FFT_TOP_BINS &&
+                fft_pipeline_top_k(&pipe, 7) == 7, "Average, default top bins, both results sent");
+
+    fft_arena_init(&arena, arena_buf, sizeof(arena_buf));
+    ret = fft_pipeline_build(&pipe, &ctx, &arena, fft_only, 1);
+    TEST_ASSERT(ret == 0 && pipe.ops == 0 && pipe.outputs == 0 && pipe.top_k == 0 &&
+                pipe.psd != NULL && ctx.window == NULL && ctx.window_type == FFT_WINDOW_RECT &&
+                ctx.bands == NULL && ctx.psd == NULL && fft_pipeline_top_k(&pipe, 7) == 0,
+                "FFT alone clears the chain before, the average kept for later");
+}
+
+/*
+ * Frame f of a stream: a DC offset, tones on and between bins and uniform
+ * noise from a linear congruential generator.
+ */
+static void fill_frame(q15_t *x, uint32_t f)
+{
+    static const double pi = 3.14159265358979323846;
+    static uint32_t seed = 12345U;
+
+    for (uint32_t i = 0; i < FFT_LEN; i++) {
+        double t = (double) (f * FFT_LEN + i) / FFT_LEN;
+        double v = 3000.0 + 9000.0 * sin(2.0 * pi * 141.0 * t) +
+                   4000.0 * sin(2.0 * pi * 37.3 * t + 0.7) + 1500.0 * sin(2.0 * pi * 402.6 * t);
+
+        seed = seed * 1103515245U + 12345U;
+        x[i] = (q15_t) lrint(v + (double) ((int32_t) (seed >> 16) % 401 - 200));
+    }
+}
+
+/**
+ * @brief The fused executor gives what the stages give one after the other
+ *
+ * For every combination of the sample stages, with each window in turn,
+ * a chain of bands, average and top bins runs four frames. The reference
+ * runs the same frames unfused: the DC blocker and the pre-emphasis as
+ * passes of fft_prefilter_apply() of their own, each filter started at
+ * the frame, and the window, bands and average on a second context of its
+ * own through fft_context_top_bins_inplace(). Top bins, band energies and
+ * the average must be bit exact.
+ */
+static void test_fused_equals_stages(void)
+{
+    static const uint8_t windows[] = {
+        FFT_STREAM_WINDOW_HANN, FFT_STREAM_WINDOW_HAMMING, FFT_STREAM_WINDOW_BLACKMAN,
+    };
+    static const char *const window_names[] = { "rect", "hann", "hamming", "blackman" };
+    struct fft_pipeline pipe;
+    fft_context_t ctx, ref;
+    spectral_psd_t ref_psd;
+    spectral_band_t ref_bands[8];
+    char message[160];
+
+    TEST_SECTION("fft_pipeline - Fused against the stages one by one");
+
+    for (uint32_t ops = 0; ops < 8U; ops++) {
+        for (uint32_t w = 0; w < ((ops & FFT_PIPELINE_OP_WINDOW) ? 3U : 1U); w++) {
+            uint8_t window = (ops & FFT_PIPELINE_OP_WINDOW) ? windows[w] : FFT_STREAM_WINDOW_RECT;
+            struct fft_stage chain[FFT_PIPELINE_MAX_STAGES];
+            uint32_t n = 0;
+            uint16_t bins[10], ref_bins[10];
+            int same_bins = 1, same_bands = 1, ret;
+
+            /* The DC blocker takes its default pole, the pre-emphasis a given coefficient */
+            if (ops & FFT_PIPELINE_OP_DC_BLOCK) {
+                chain[n++] = (struct fft_stage) S(FFT_STAGE_DC_BLOCK, 0);
+            }
+            if (ops & FFT_PIPELINE_OP_PREEMPHASIS) {
+                chain[n++] = (struct fft_stage) S(FFT_STAGE_PREEMPHASIS, 30000);
+            }
+            if (ops & FFT_PIPELINE_OP_WINDOW) {
+                chain[n++] = (struct fft_stage) S(FFT_STAGE_WINDOW, window);
+            }
+            chain[n++] = (struct fft_stage) S(FFT_STAGE_FFT, 0);
+            chain[n++] = (struct fft_stage) S(FFT_STAGE_BANDS, 8);
+            chain[n++] = (struct fft_stage) S(FFT_STAGE_PSD, 0);
+            chain[n++] = (struct fft_stage) S(FFT_STAGE_TOP_K, 10);
+            ret = build(&pipe, &ctx, sizeof(arena_buf), 1, chain, n);
+
+            fft_context_init(&ref, FFT_LEN, ref_work, ref_peaks, MAX_TOP);
+            fft_context_set_window(&ref, (fft_window_type_t) window, ref_window);
+            spectral_psd_init(&ref_psd, ref_acc, NUM_BINS, SPECTRAL_PSD_LINEAR, 2);
+            fft_context_set_psd(&ref, &ref_psd);
+            for (uint32_t i = 0; i < 8U; i++) {
+                ref_bands[i].first_bin = (uint16_t) (1U + (i * (FFT_LEN / 2)) / 8U);
+                ref_bands[i].last_bin = (uint16_t) (((i + 1U) * (FFT_LEN / 2)) / 8U);
+            }
+            fft_context_set_bands(&ref, ref_bands, 8);
+
+            for (uint32_t f = 0; f < 4U; f++) {
+                fft_prefilter_t dc, emph;
+
+                fill_frame(frame, f);
+                memcpy(ref_frame, frame, sizeof(frame));
+
+                fft_pipeline_run(&pipe, frame, bins, 10);
+
+                if (ops & FFT_PIPELINE_OP_DC_BLOCK) {
+                    fft_prefilter_init(&dc, 32604, 0);
+                    fft_prefilter_apply(&dc, ref_frame, ref_frame, FFT_LEN);
+                }
+                if (ops & FFT_PIPELINE_OP_PREEMPHASIS) {
+                    fft_prefilter_init(&emph, 0, 30000);
+                    fft_prefilter_apply(&emph, ref_frame, ref_frame, FFT_LEN);
+                }
+                fft_context_top_bins_inplace(&ref, ref_frame, ref_bins, 10);
+
+                same_bins &= (memcmp(bins, ref_bins, sizeof(bins)) == 0);
+                for (uint32_t i = 0; i < 8U; i++) {
+                    same_bands &= (pipe.bands[i].energy == ref_bands[i].energy);
+                }
+            }
+
+            snprintf(message, sizeof(message), "%s%s%s%s: top bins %s, bands %s, average %s",
+                     (ops & FFT_PIPELINE_OP_DC_BLOCK) ? "dc " : "",
+                     (ops & FFT_PIPELINE_OP_PREEMPHASIS) ? "emphasis " : "",
+                     (ops & FFT_PIPELINE_OP_WINDOW) ? "window " : "", window_names[window],
+                     same_bins ? "equal" : "differ", same_bands ? "equal" : "differ",
+                     (memcmp(psd_acc, ref_acc, sizeof(ref_acc)) == 0) ? "equal" : "differs");
+            TEST_ASSERT(ret == 0 && pipe.ops == ops && same_bins && same_bands &&
+                        pipe.psd->frames == ref_psd.frames &&
+                        memcmp(psd_acc, ref_acc, sizeof(ref_acc)) == 0, message);
+        }
+    }
+}
+
+/**
+ * @brief Main test runner
+ */
+int main(void) {
+    printf("=== Analysis Pipeline Tests ===\n");
+
+    test_build_rejections();
+    test_build_full_chain();
+    test_fused_equals_stages();
+
+    /* Print summary */
+    printf("\n=== Test Summary ===\n");
+    printf("Passed: %d\n", tests_passed);
+    printf("Failed: %d\n", tests_failed);
+    printf("Total:  %d\n", tests_passed + tests_failed);
+
+    if (tests_failed == 0) {
+        printf("\n✓ The pipeline builds only the chains it can run, fused as the stages!\n");
+        return 0;
+    } else {
+        printf("\n✗ Some tests failed!\n");
+        return 1;
+    }
+}
@@ -0,0 +1,306 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library - Simplified Q15 RFFT
+ * Title:        test_fft_shed.c
+ * Description:  Tests for the shed level decisions and the half length bins
+ *
+ * Target Processor: nRF54L15 FLPR (PC validation)
+ * -------------------------------------------------------------------- */
+
+#include "../include/rfft_q15.h"
+#include "fft_shed.h"
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#if RFFT_Q15_MIN_FFT_LEN > 256 || RFFT_Q15_MAX_FFT_LEN < 4096
+#error "test_fft_shed.c needs the lengths from 256 to 4096"
+#endif
+
+#define FRAME_LEN    1024
+#define SHIFT        2      /* Decisions of 4 frames */
+#define CYCLES       1000U  /* Per frame, a budget of 4000 per decision */
+#define NUM_TOP_BINS 4
+#define ALL_LEVELS   ((1U << FFT_SHED_LEVELS) - 1U)
+
+static q15_t frame[FRAME_LEN] RFFT_Q15_ALIGN;
+static q15_t hann[FFT_WINDOW_TABLE_LEN(FRAME_LEN)];
+static q15_t hann_half[FFT_WINDOW_TABLE_LEN(FRAME_LEN / 2)];
+static spectral_peak_t peaks[NUM_TOP_BINS];
+static spectral_peak_t half_peaks[NUM_TOP_BINS];
+
+/* Test result tracking */
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+/* Test assertion macro */
+#define TEST_ASSERT(condition, message) \
+    do { \
+        if (condition) { \
+            printf("  ✓ %s\n", message); \
+            tests_passed++; \
+        } else { \
+            printf("  ✗ %s\n", message); \
+            tests_failed++; \
+        } \
+    } while(0)
+
+/* Test section header */
+#define TEST_SECTION(name) \
+    printf("\n=== %s ===\n", name)
+
+static const double pi = 3.14159265358979323846;
+
+/*
+ * One decision of 4 frames of busy cycles in all, with missed frames
+ * late or dropped so far, moved to the level picked as the stream does.
+ */
+static uint8_t run_decision(struct fft_shed *shed, uint32_t busy, uint32_t missed)
+{
+    uint8_t level;
+    int early = 0;
+
+    for (uint32_t f = 0; f < 3U; f++) {
+        early |= fft_shed_add(shed, busy / 4U);
+    }
+    if (early || !fft_shed_add(shed, busy - 3U * (busy / 4U))) {
+        return 0xFF;
+    }
+
+    level = fft_shed_decide(shed, missed);
+    fft_shed_commit(shed, level);
+
+    return level;
+}
+
+/**
+ * @brief Steps pass over the levels the setup cannot use
+ */
+static void test_steps(void)
+{
+    struct fft_shed shed;
+
+    TEST_SECTION("fft_shed - Steps between usable levels");
+
+    shed.usable = ALL_LEVELS;
+    fft_shed_reset(&shed, CYCLES, SHIFT, 0U);
+    TEST_ASSERT(fft_shed_step(&shed, 1) == FFT_SHED_HALF &&
+                fft_shed_step(&shed, -1) == FFT_SHED_NONE,
+                "Every level usable: up is FFT_SHED_HALF, nothing below FFT_SHED_NONE");
+
+    shed.usable = ALL_LEVELS & ~(1U << FFT_SHED_HALF);
+    TEST_ASSERT(fft_shed_step(&shed, 1) == FFT_SHED_RECT,
+                "Without a half length: up from FFT_SHED_NONE is FFT_SHED_RECT");
+
+    shed.usable = ALL_LEVELS & ~(1U << FFT_SHED_HALF) & ~(1U << FFT_SHED_RECT);
+    TEST_ASSERT(fft_shed_step(&shed, 1) == FFT_SHED_TOP_K,
+                "Without a half length or a window: up from FFT_SHED_NONE is FFT_SHED_TOP_K");
+    shed.level = FFT_SHED_TOP_K;
+    TEST_ASSERT(fft_shed_step(&shed, -1) == FFT_SHED_NONE,
+                "... and down from FFT_SHED_TOP_K is FFT_SHED_NONE");
+
+    shed.level = FFT_SHED_DECIMATE;
+    TEST_ASSERT(fft_shed_step(&shed, 1) == FFT_SHED_DECIMATE,
+                "Nothing above FFT_SHED_DECIMATE");
+}
+
+/**
+ * @brief Up above 7/8 of the budget or when late, down at 3/4 with the saving
+ *
+ * Budget 4000 cycles per decision of 4 frames, every level usable.
+ */
+static void test_decisions(void)
+{
+    struct fft_shed shed;
+    char message[128];
+    uint8_t level;
+
+    TEST_SECTION("fft_shed - Level up and down");
+
+    shed.usable = ALL_LEVELS;
+    fft_shed_reset(&shed, CYCLES, SHIFT, 7U);
+    TEST_ASSERT(shed.budget == 4000U && shed.level == FFT_SHED_NONE,
+                "Reset: budget of 4 frames, full analysis");
+
+    level = run_decision(&shed, 3500U, 7U);
+    TEST_ASSERT(level == FFT_SHED_NONE, "3500 of 4000, 7/8 exactly: stays");
+
+    level = run_decision(&shed, 3501U, 7U);
+    TEST_ASSERT(level == FFT_SHED_HALF && shed.measuring && shed.busy == 0U && shed.frames == 0U,
+                "3501, above 7/8: one up, to FFT_SHED_HALF, measuring its saving");
+
+    /* The level before left a frame late: not counted while measuring */
+    level = run_decision(&shed, 2200U, 8U);
+    snprintf(message, sizeof(message), "First decision at the level: saving %llu measured, "
+             "a late frame of the level before ignored",
+             (unsigned long long) shed.saving[FFT_SHED_HALF]);
+    TEST_ASSERT(level == FFT_SHED_HALF && shed.saving[FFT_SHED_HALF] == 1301U &&
+                !shed.measuring, message);
+
+    level = run_decision(&shed, 1700U, 8U);
+    TEST_ASSERT(level == FFT_SHED_HALF, "1700 + saving 1301 = 3001, above 3/4: stays");
+
+    level = run_decision(&shed, 1699U, 8U);
+    TEST_ASSERT(level == FFT_SHED_NONE && !shed.measuring,
+                "1699 + saving 1301 = 3000, 3/4 exactly: one down, nothing measured");
+
+    level = run_decision(&shed, 1000U, 9U);
+    TEST_ASSERT(level == FFT_SHED_HALF, "A late frame at 1000 of 4000: one up");
+
+    /* Saving of 0: the level costs as much as the one below */
+    level = run_decision(&shed, 1200U, 9U);
+    TEST_ASSERT(level == FFT_SHED_NONE && shed.saving[FFT_SHED_HALF] == 0U,
+                "A level that saved nothing: saving 0, and back down at 1200");
+
+    for (uint32_t i = 0; i < 8U; i++) {
+        level = run_decision(&shed, 4000U, 9U);
+    }
+    TEST_ASSERT(level == FFT_SHED_DECIMATE, "Over budget every decision: up to FFT_SHED_DECIMATE");
+    level = run_decision(&shed, 5000U, 10U);
+    TEST_ASSERT(level == FFT_SHED_DECIMATE, "Late and over budget at the top: stays");
+
+    fft_shed_reset(&shed, CYCLES, SHIFT, 10U);
+    TEST_ASSERT(shed.level == FFT_SHED_NONE && !shed.measuring &&
+                shed.saving[FFT_SHED_HALF] == 0U && shed.saving[FFT_SHED_DECIMATE] == 0U &&
+                run_decision(&shed, 1000U, 10U) == FFT_SHED_NONE,
+                "Reset: full analysis, savings forgotten, the missed count taken as is");
+}
+
+/**
+ * @brief Top bins per result and decimated frames at each level
+ */
+static void test_top_k(void)
+{
+    struct fft_shed shed;
+
+    TEST_SECTION("fft_shed - Top bins per frame");
+
+    shed.usable = ALL_LEVELS;
+    fft_shed_reset(&shed, CYCLES, SHIFT, 0U);
+    TEST_ASSERT(fft_shed_top_k(&shed, 1U, 20U) == 20U, "FFT_SHED_NONE: every bin asked for");
+    shed.level = FFT_SHED_RECT;
+    TEST_ASSERT(fft_shed_top_k(&shed, 1U, 20U) == 20U, "FFT_SHED_RECT: every bin asked for");
+    shed.level = FFT_SHED_TOP_K;
+    TEST_ASSERT(fft_shed_top_k(&shed, 1U, 20U) == 10U && fft_shed_top_k(&shed, 1U, 1U) == 1U,
+                "FFT_SHED_TOP_K: half, at least 1");
+    shed.level = FFT_SHED_DECIMATE;
+    TEST_ASSERT(fft_shed_top_k(&shed, 4U, 20U) == 10U && fft_shed_top_k(&shed, 5U, 20U) == 0U,
+                "FFT_SHED_DECIMATE: odd frames none, even ones half");
+    shed.usable = ALL_LEVELS & ~(1U << FFT_SHED_TOP_K);
+    TEST_ASSERT(fft_shed_top_k(&shed, 4U, 20U) == 20U,
+                "A level passed over drops nothing of its own");
+}
+
+/* bins holds exactly the count expected bins, in any order */
+static int same_bins(const uint16_t *bins, const uint16_t *expected, uint32_t count)
+{
+    uint32_t found = 0;
+
+    for (uint32_t e = 0; e < count; e++) {
+        for (uint32_t i = 0; i < count; i++) {
+            if (bins[i] == expected[e]) {
+                found++;
+                break;
+            }
+        }
+    }
+
+    return found == count;
+}
+
+/*
+ * Tones on bins of the full length: the older half of the frame holds
+ * one at bin 400, the newer half those at bins 100 and 262 and, between
+ * two bins of the half length, 181.
+ */
+static void fill_frame(void)
+{
+    for (uint32_t i = 0; i < FRAME_LEN; i++) {
+        double v = (i < FRAME_LEN / 2U) ?
+                   12000.0 * sin(2.0 * pi * 400.0 * i / FRAME_LEN) :
+                   8000.0 * sin(2.0 * pi * 100.0 * i / FRAME_LEN) +
+                   6000.0 * sin(2.0 * pi * 262.0 * i / FRAME_LEN + 1.0) +
+                   4000.0 * sin(2.0 * pi * 181.0 * i / FRAME_LEN + 2.0);
+
+        frame[i] = (q15_t) lrint(v);
+    }
+}
+
+/**
+ * @brief The half length analyses the newest half, its bins numbered for the full one
+ *
+ * Bin k of the frame_len / 2 context is bin 2k of the frame: the tones
+ * of the newer half on bins 100 and 262 come back as those bins, the
+ * one on bin 181 as 180 or 182, and the older half is not seen.
+ */
+static void test_half_bins(void)
+{
+    struct fft_shed shed;
+    fft_context_t full, half;
+    uint16_t bins[NUM_TOP_BINS];
+    rfft_status_t status;
+    char message[128];
+
+    TEST_SECTION("fft_shed - Bins of the half length");
+
+    fft_context_init(&full, FRAME_LEN, NULL, peaks, NUM_TOP_BINS);
+    fft_context_set_window(&full, FFT_WINDOW_HANN, hann);
+    fft_context_init(&half, FRAME_LEN / 2, NULL, half_peaks, NUM_TOP_BINS);
+    fft_context_set_window(&half, FFT_WINDOW_HANN, hann_half);
+    /* Distinct tones, the same spacing in Hz for both, as the stream sets them */
+    fft_context_set_peaks(&full, 4U, 0U);
+    fft_context_set_peaks(&half, 2U, 0U);
+    shed.usable = ALL_LEVELS;
+    fft_shed_reset(&shed, CYCLES, SHIFT, 0U);
+
+    fill_frame();
+    status = fft_shed_top_bins(&shed, &full, &half, frame, bins, 4U);
+    TEST_ASSERT(status == RFFT_SUCCESS &&
+                same_bins(bins, (const uint16_t[]) { 400, 100, 262, 181 }, 4U),
+                "FFT_SHED_NONE: the full frame, bins 400, 100, 262 and 181");
+
+    shed.level = FFT_SHED_HALF;
+    fill_frame();
+    status = fft_shed_top_bins(&shed, &full, &half, frame, bins, 3U);
+    snprintf(message, sizeof(message), "FFT_SHED_HALF: bins %u, %u and %u of the newer half",
+             bins[0], bins[1], bins[2]);
+    TEST_ASSERT(status == RFFT_SUCCESS &&
+                (same_bins(bins, (const uint16_t[]) { 100, 262, 180 }, 3U) ||
+                 same_bins(bins, (const uint16_t[]) { 100, 262, 182 }, 3U)), message);
+
+    fill_frame();
+    status = fft_shed_top_bins(&shed, &full, NULL, frame, bins, 4U);
+    TEST_ASSERT(status == RFFT_SUCCESS &&
+                same_bins(bins, (const uint16_t[]) { 400, 100, 262, 181 }, 4U),
+                "No half length context: the full frame at any level");
+
+    memset(bins, 0xA5, sizeof(bins));
+    status = fft_shed_top_bins(&shed, &full, &half, frame, bins, 0U);
+    TEST_ASSERT(status == RFFT_SUCCESS && bins[0] == 0xA5A5U,
+                "A frame decimated away is not transformed");
+}
+
+/**
+ * @brief Main test runner
+ */
+int main(void) {
+    printf("=== Load Shedding Tests ===\n");
+
+    test_steps();
+    test_decisions();
+    test_top_k();
+    test_half_bins();
+
+    /* Print summary */
+    printf("\n=== Test Summary ===\n");
+    printf("Passed: %d\n", tests_passed);
+    printf("Failed: %d\n", tests_failed);
+    printf("Total:  %d\n", tests_passed + tests_failed);
+
+    if (tests_failed == 0) {
+        printf("\n✓ The shed levels follow the load!\n");
+        return 0;
+    } else {
+        printf("\n✗ Some tests failed!\n");
+        return 1;
+    }
+}
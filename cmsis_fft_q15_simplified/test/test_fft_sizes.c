@@ -0,0 +1,506 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library - Simplified Q15 RFFT
+ * Title:        test_fft_sizes.c
+ * Description:  Tests for every RFFT length gen_tables.py can generate
+ *
+ * Target Processor: nRF54L15 FLPR (PC validation)
+ * -------------------------------------------------------------------- */
+
+#include "../include/rfft_q15.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+/*
+ * Built with RFFT_Q15_MIN_FFT_LEN=32 and tables generated for 32 to
+ * 8192 points, see the test-sizes target of the Makefile.
+ */
+#if RFFT_Q15_MIN_FFT_LEN != 32 || RFFT_Q15_MAX_FFT_LEN != 8192
+#error "test_fft_sizes.c needs all lengths from 32 to 8192"
+#endif
+
+#define MAX_FFT_LEN 8192
+
+/* CMSIS-DSP per-length CFFT tables, see extract_tables.py --q15-reference */
+extern const q15_t ref_twiddleCoef_16_q15[24];
+extern const q15_t ref_twiddleCoef_32_q15[48];
+extern const q15_t ref_twiddleCoef_64_q15[96];
+extern const q15_t ref_twiddleCoef_128_q15[192];
+extern const q15_t ref_twiddleCoef_256_q15[384];
+extern const q15_t ref_twiddleCoef_512_q15[768];
+extern const q15_t ref_twiddleCoef_1024_q15[1536];
+extern const q15_t ref_twiddleCoef_2048_q15[3072];
+extern const q15_t ref_twiddleCoef_4096_q15[6144];
+
+static q15_t input[MAX_FFT_LEN] RFFT_Q15_ALIGN;
+static q15_t work[2 * MAX_FFT_LEN] RFFT_Q15_ALIGN;
+static q15_t output[2 * MAX_FFT_LEN] RFFT_Q15_ALIGN;
+static q15_t reference[2 * MAX_FFT_LEN] RFFT_Q15_ALIGN;
+
+/* Test result tracking */
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+/* Test assertion macro */
+#define TEST_ASSERT(condition, message) \
+    do { \
+        if (condition) { \
+            printf("  ✓ %s\n", message); \
+            tests_passed++; \
+        } else { \
+            printf("  ✗ %s\n", message); \
+            tests_failed++; \
+        } \
+    } while(0)
+
+/* Test section header */
+#define TEST_SECTION(name) \
+    printf("\n=== %s ===\n", name)
+
+/* Full-scale-half cosine at bin tone plus a smaller one at bin 3 */
+static void fill_tones(uint32_t n, uint32_t tone)
+{
+    const double pi = 3.14159265358979323846;
+
+    for (uint32_t i = 0; i < n; i++) {
+        input[i] = (q15_t) (16384.0 * cos(2.0 * pi * tone * i / n) +
+                            4096.0 * cos(2.0 * pi * 3.0 * i / n));
+    }
+}
+
+static uint32_t mag_sq(q15_t re, q15_t im)
+{
+    return (uint32_t) ((q31_t) re * re) + (uint32_t) ((q31_t) im * im);
+}
+
+/* Magnitudes reported by arm_rfft_q15_mag_sq(), checked against reference */
+static int mag_sq_mismatches;
+
+static void check_bin(uint32_t bin, uint32_t value, void *user)
+{
+    (void) user;
+
+    if (value != mag_sq(reference[2U * bin], reference[2U * bin + 1U])) {
+        mag_sq_mismatches++;
+    }
+}
+
+/**
+ * @brief Every length has a prebuilt instance, other lengths have none
+ */
+static void test_instances(void)
+{
+    char message[96];
+
+    TEST_SECTION("RFFT Lengths - Prebuilt Instances");
+
+    for (uint32_t n = 32; n <= MAX_FFT_LEN; n *= 2) {
+        const arm_rfft_instance_q15 *instance = rfft_q15_get_instance(n);
+
+        snprintf(message, sizeof(message), "%u-point instance is built in", (unsigned)n);
+        TEST_ASSERT(instance != NULL && instance->fftLenReal == n &&
+                    instance->pCfft->fftLen == n / 2, message);
+    }
+
+    TEST_ASSERT(rfft_q15_get_instance(16) == NULL, "16-point instance is not built in");
+    TEST_ASSERT(rfft_q15_get_instance(16384) == NULL, "16384-point instance is not built in");
+    TEST_ASSERT(rfft_q15_get_instance(3000) == NULL, "3000-point instance does not exist");
+    TEST_ASSERT(rfft_q15_get_instance(4096) == &arm_rfft_sR_q15_len4096,
+                "4096 selects arm_rfft_sR_q15_len4096");
+}
+
+/**
+ * @brief rfft_q15_init() copies the prebuilt instance of any built-in length
+ */
+static void test_init(void)
+{
+    arm_rfft_instance_q15 S;
+
+    TEST_SECTION("RFFT Lengths - rfft_q15_init()");
+
+    TEST_ASSERT(rfft_q15_init(&S, 512) == RFFT_SUCCESS &&
+                memcmp(&S, &arm_rfft_sR_q15_len512, sizeof(S)) == 0,
+                "512-point init copies arm_rfft_sR_q15_len512");
+    TEST_ASSERT(rfft_q15_init(&S, 32) == RFFT_SUCCESS && S.fftLenReal == 32,
+                "32-point init succeeds");
+    TEST_ASSERT(rfft_q15_init(&S, 3000) == RFFT_ERROR_INVALID_SIZE,
+                "3000-point init returns RFFT_ERROR_INVALID_SIZE");
+    TEST_ASSERT(rfft_q15_init(NULL, 512) == RFFT_ERROR_NULL_POINTER,
+                "NULL instance returns RFFT_ERROR_NULL_POINTER");
+}
+
+/**
+ * @brief The spectrum of each length peaks at the tone, all outputs agree
+ */
+static void test_spectra(void)
+{
+    char message[96];
+
+    TEST_SECTION("RFFT Lengths - Spectra");
+
+    for (uint32_t n = 32; n <= MAX_FFT_LEN; n *= 2) {
+        const arm_rfft_instance_q15 *instance = rfft_q15_get_instance(n);
+        uint32_t tone = n / 16U + 5U;
+        uint32_t peak = 1;
+
+        fill_tones(n, tone);
+        memcpy(work, input, n * sizeof(q15_t));
+        arm_rfft_q15(instance, work, reference);
+
+        for (uint32_t k = 2; k < n / 2; k++) {
+            if (mag_sq(reference[2U * k], reference[2U * k + 1U]) >
+                mag_sq(reference[2U * peak], reference[2U * peak + 1U])) {
+                peak = k;
+            }
+        }
+        snprintf(message, sizeof(message), "%u-point spectrum peaks at bin %u",
+                 (unsigned)n, (unsigned)tone);
+        TEST_ASSERT(peak == tone, message);
+
+        memcpy(work, input, n * sizeof(q15_t));
+        arm_rfft_q15_packed(instance, work);
+        snprintf(message, sizeof(message), "%u-point packed output matches arm_rfft_q15",
+                 (unsigned)n);
+        TEST_ASSERT(memcmp(&work[2], &reference[2], (n - 2U) * sizeof(q15_t)) == 0 &&
+                    work[0] == reference[0] && work[1] == reference[n], message);
+
+        mag_sq_mismatches = 0;
+        memcpy(work, input, n * sizeof(q15_t));
+        arm_rfft_q15_mag_sq(instance, work, check_bin, NULL);
+        snprintf(message, sizeof(message), "%u-point magnitudes match arm_rfft_q15",
+                 (unsigned)n);
+        TEST_ASSERT(mag_sq_mismatches == 0, message);
+
+        /* The CFFT result it leaves behind gives back any complex bin */
+        mag_sq_mismatches = 0;
+        for (uint32_t k = 0; k <= n / 2U; k++) {
+            q15_t bin[2];
+
+            arm_rfft_q15_mag_sq_bin(instance, work, k, bin);
+            if (bin[0] != reference[2U * k] || bin[1] != reference[2U * k + 1U]) {
+                mag_sq_mismatches++;
+            }
+        }
+        snprintf(message, sizeof(message), "%u-point bins formed after the magnitudes match",
+                 (unsigned)n);
+        TEST_ASSERT(mag_sq_mismatches == 0, message);
+    }
+}
+
+/**
+ * @brief The whole-spectrum kernels match the bins of each length
+ */
+static void test_magnitudes(void)
+{
+    static uint32_t mags[MAX_FFT_LEN / 2 + 1];
+    static int16_t logs[MAX_FFT_LEN / 2 + 1];
+    static int16_t dbs[MAX_FFT_LEN / 2 + 1];
+    char message[96];
+
+    TEST_SECTION("RFFT Lengths - Magnitude Kernels");
+
+    for (uint32_t n = 32; n <= MAX_FFT_LEN; n *= 2) {
+        const arm_rfft_instance_q15 *instance = rfft_q15_get_instance(n);
+        int32_t exponent = (int32_t) log2((double) n);
+        uint32_t bins = n / 2U + 1U;
+        uint32_t mismatches = 0;
+        double worst_log2 = 0.0;
+        double worst_db = 0.0;
+
+        fill_tones(n, n / 16U + 5U);
+        memcpy(work, input, n * sizeof(q15_t));
+        arm_rfft_q15(instance, work, reference);
+
+        /* An odd count of bins, the last one takes the tail */
+        cmplx_mag_squared_q15(reference, mags, bins);
+        cmplx_mag_log2_q15(reference, logs, bins, exponent);
+        cmplx_mag_db_q15(reference, dbs, bins, exponent);
+
+        for (uint32_t k = 0; k < bins; k++) {
+            uint32_t m = mag_sq(reference[2U * k], reference[2U * k + 1U]);
+            double l2;
+
+            if (mags[k] != m) {
+                mismatches++;
+            }
+            if (m == 0U) {
+                if (logs[k] != CMPLX_MAG_LOG_ZERO || dbs[k] != CMPLX_MAG_LOG_ZERO) {
+                    mismatches++;
+                }
+                continue;
+            }
+            l2 = log2((double) m) + 2.0 * exponent - 30.0;
+            worst_log2 = fmax(worst_log2, fabs(logs[k] / 256.0 - l2));
+            worst_db = fmax(worst_db, fabs(dbs[k] / 256.0 - 10.0 * log10(2.0) * l2));
+        }
+
+        snprintf(message, sizeof(message), "%u-point magnitudes² match the bins",
+                 (unsigned)n);
+        TEST_ASSERT(mismatches == 0, message);
+        snprintf(message, sizeof(message), "%u-point log2 within 0.003 (%.4f)",
+                 (unsigned)n, worst_log2);
+        TEST_ASSERT(worst_log2 <= 0.003, message);
+        snprintf(message, sizeof(message), "%u-point dB within 0.01 (%.4f)",
+                 (unsigned)n, worst_db);
+        TEST_ASSERT(worst_db <= 0.01, message);
+    }
+
+    /* A full-scale cosine at bin 1 of 1024 points: |X|² = (1024 / 2)² */
+    for (uint32_t i = 0; i < 1024U; i++) {
+        input[i] = (q15_t) (32767.0 * cos(2.0 * 3.14159265358979323846 * i / 1024.0));
+    }
+    arm_rfft_q15(rfft_q15_get_instance(1024U), input, reference);
+    cmplx_mag_log2_q15(reference, logs, 2U, 10);
+    TEST_ASSERT(abs(logs[1] - 18 * 256) <= 2, "full-scale 1024-point tone at log2 18");
+
+    /* Zero bins, and the odd tail alone */
+    memset(reference, 0, 2U * sizeof(q15_t));
+    cmplx_mag_db_q15(reference, dbs, 1U, 0);
+    TEST_ASSERT(dbs[0] == CMPLX_MAG_LOG_ZERO, "bin of 0 gives CMPLX_MAG_LOG_ZERO");
+
+    /* Block exponents far outside a spectrum saturate, in 32-bit arithmetic */
+    reference[0] = 32767;
+    reference[1] = 32767;
+    cmplx_mag_db_q15(reference, dbs, 1U, 40);
+    cmplx_mag_log2_q15(reference, logs, 1U, -80);
+    TEST_ASSERT(dbs[0] / 256 == 127 && logs[0] == INT16_MIN + 1,
+                "large exponents saturate above CMPLX_MAG_LOG_ZERO");
+}
+
+/**
+ * @brief The shift of arm_cfft_q15_inverse_shl() matches a separate pass
+ */
+static void test_inverse_shift(void)
+{
+    char message[96];
+    uint32_t seed = 12345U;
+
+    TEST_SECTION("RFFT Lengths - Inverse CFFT Output Shift");
+
+    for (uint32_t n = 32; n <= MAX_FFT_LEN; n *= 2) {
+        const arm_cfft_instance_q15 *cfft = rfft_q15_get_instance(n)->pCfft;
+        uint32_t len = cfft->fftLen;
+        int same = 1;
+
+        for (uint32_t shift = 1U; shift <= 2U; shift++) {
+            /* Full-scale noise, so some outputs wrap around */
+            for (uint32_t i = 0; i < 2U * len; i++) {
+                seed = seed * 1664525U + 1013904223U;
+                work[i] = (q15_t) (seed >> 16);
+            }
+            memcpy(output, work, 2U * len * sizeof(q15_t));
+
+            arm_cfft_q15(cfft, work, 1U, 1U);
+            for (uint32_t i = 0; i < 2U * len; i++) {
+                work[i] = (q15_t) (work[i] << shift);
+            }
+            arm_cfft_q15_inverse_shl(cfft, output, 1U, shift);
+
+            same = same && memcmp(output, work, 2U * len * sizeof(q15_t)) == 0;
+        }
+
+        snprintf(message, sizeof(message), "%u-point inverse CFFT output shift is bit-exact",
+                 (unsigned)len);
+        TEST_ASSERT(same, message);
+    }
+}
+
+/**
+ * @brief Every CMSIS-DSP CFFT table is a stride of the one shared table
+ */
+static void test_shared_twiddles(void)
+{
+    static const q15_t *const refs[] = {
+        ref_twiddleCoef_16_q15, ref_twiddleCoef_32_q15, ref_twiddleCoef_64_q15,
+        ref_twiddleCoef_128_q15, ref_twiddleCoef_256_q15, ref_twiddleCoef_512_q15,
+        ref_twiddleCoef_1024_q15, ref_twiddleCoef_2048_q15, ref_twiddleCoef_4096_q15
+    };
+    char message[96];
+
+    TEST_SECTION("RFFT Lengths - Shared Twiddle Table");
+
+    for (size_t s = 0; s < sizeof(refs) / sizeof(refs[0]); s++) {
+        uint32_t n = 16U << s;
+        uint32_t stride = RFFT_TWIDDLE_STRIDE(n);
+        uint32_t mismatches = 0U;
+
+        for (uint32_t k = 0; k < 3U * n / 4U; k++) {
+            mismatches += RFFT_TWIDDLE_COS(RFFT_TWIDDLE_TABLE, k * stride) != refs[s][2U * k];
+            mismatches += RFFT_TWIDDLE_SIN(RFFT_TWIDDLE_TABLE, k * stride) != refs[s][2U * k + 1U];
+        }
+
+        snprintf(message, sizeof(message), "twiddleCoef_%u_q15 is a stride of RFFT_TWIDDLE_TABLE",
+                 (unsigned)n);
+        TEST_ASSERT(mismatches == 0U, message);
+    }
+}
+
+#if !defined(RFFT_Q15_NO_BITREV_TABLES)
+/**
+ * @brief Generated bit reversal tables match the computed reversal
+ */
+static void test_bitrev_tables(void)
+{
+    static const uint16_t *const tables[] = {
+        armBitRevIndexTable_fixed_16, armBitRevIndexTable_fixed_32,
+        armBitRevIndexTable_fixed_64, armBitRevIndexTable_fixed_128,
+        armBitRevIndexTable_fixed_256, armBitRevIndexTable_fixed_512,
+        armBitRevIndexTable_fixed_1024, armBitRevIndexTable_fixed_2048,
+        armBitRevIndexTable_fixed_4096
+    };
+    static const uint16_t lengths[] = {
+        ARMBITREVINDEXTABLE_FIXED_16_TABLE_LENGTH, ARMBITREVINDEXTABLE_FIXED_32_TABLE_LENGTH,
+        ARMBITREVINDEXTABLE_FIXED_64_TABLE_LENGTH, ARMBITREVINDEXTABLE_FIXED_128_TABLE_LENGTH,
+        ARMBITREVINDEXTABLE_FIXED_256_TABLE_LENGTH, ARMBITREVINDEXTABLE_FIXED_512_TABLE_LENGTH,
+        ARMBITREVINDEXTABLE_FIXED_1024_TABLE_LENGTH, ARMBITREVINDEXTABLE_FIXED_2048_TABLE_LENGTH,
+        ARMBITREVINDEXTABLE_FIXED_4096_TABLE_LENGTH
+    };
+    char message[96];
+
+    TEST_SECTION("RFFT Lengths - Bit Reversal Tables");
+
+    for (size_t s = 0; s < sizeof(tables) / sizeof(tables[0]); s++) {
+        uint32_t n = 16U << s;
+
+        for (uint32_t i = 0; i < 2U * n; i++) {
+            output[i] = (q15_t) i;
+        }
+        memcpy(work, output, 2U * n * sizeof(q15_t));
+        arm_bitreversal_16((uint16_t *)output, lengths[s], tables[s]);
+        arm_bitreversal_q15_notable(work, n);
+
+        snprintf(message, sizeof(message), "%u-point table matches the computed reversal",
+                 (unsigned)n);
+        TEST_ASSERT(memcmp(output, work, 2U * n * sizeof(q15_t)) == 0, message);
+    }
+}
+#endif
+
+/**
+ * @brief Lengths with factors 3 and 5 match a double DFT, and their outputs agree
+ */
+static void test_mixed_lengths(void)
+{
+    static const uint32_t lengths[] = { 96, 160, 480, 1500, 3000, 4096, 6000, 7680 };
+    static q15_t arena[RFFT_MIXED_ARENA_LEN(MAX_FFT_LEN)];
+    const double pi = 3.14159265358979323846;
+    rfft_mixed_q15_t plan;
+    int32_t worst_sin = 0;
+    char message[96];
+
+    TEST_SECTION("RFFT Lengths - Mixed Radix");
+
+    TEST_ASSERT(rfft_mixed_plan_create(&plan, 3002, arena, sizeof(arena) / sizeof(arena[0])) ==
+                RFFT_ERROR_INVALID_SIZE, "3002 points (factor 1501) are rejected");
+    TEST_ASSERT(rfft_mixed_plan_create(&plan, 2250, arena, sizeof(arena) / sizeof(arena[0])) ==
+                RFFT_ERROR_INVALID_SIZE, "2250 points (not a multiple of 4) are rejected");
+    TEST_ASSERT(rfft_mixed_plan_create(&plan, 12000, arena, sizeof(arena) / sizeof(arena[0])) ==
+                RFFT_ERROR_INVALID_SIZE, "12000 points are rejected");
+    TEST_ASSERT(rfft_mixed_plan_create(&plan, 3000, arena, RFFT_MIXED_ARENA_LEN(3000) - 1U) ==
+                RFFT_ERROR_INVALID_SIZE, "an arena one value short is rejected");
+    TEST_ASSERT(rfft_mixed_plan_create(NULL, 3000, arena, sizeof(arena) / sizeof(arena[0])) ==
+                RFFT_ERROR_NULL_POINTER, "NULL plan returns RFFT_ERROR_NULL_POINTER");
+
+    /* The sine of a power of two is that of the shared table */
+    (void) rfft_mixed_plan_create(&plan, 4096, arena, RFFT_MIXED_ARENA_LEN(4096));
+    for (uint32_t k = 0; k <= 1024U; k++) {
+        int32_t d = arena[k] - RFFT_TWIDDLE_SIN(RFFT_TWIDDLE_TABLE, k * RFFT_TWIDDLE_STRIDE(4096));
+
+        worst_sin = (abs(d) > worst_sin) ? abs(d) : worst_sin;
+    }
+    snprintf(message, sizeof(message), "4096-point sine matches the shared table (%d LSB)",
+             (int)worst_sin);
+    TEST_ASSERT(worst_sin == 0, message);
+
+    for (uint32_t l = 0; l < sizeof(lengths) / sizeof(lengths[0]); l++) {
+        uint32_t n = lengths[l];
+        uint32_t tone = n / 16U + 5U;
+        uint32_t peak = 1;
+        double worst = 0.0;
+        int mismatches = 0;
+
+        snprintf(message, sizeof(message), "%u-point plan is created", (unsigned)n);
+        TEST_ASSERT(rfft_mixed_plan_create(&plan, n, arena, RFFT_MIXED_ARENA_LEN(n)) ==
+                    RFFT_SUCCESS, message);
+
+        fill_tones(n, tone);
+        memcpy(work, input, n * sizeof(q15_t));
+        arm_rfft_q15_mixed(&plan, work, &work[MAX_FFT_LEN], reference);
+
+        /* The DFT scaled by 1/N, as arm_rfft_q15() outputs it */
+        for (uint32_t k = 0; k <= n / 2U; k++) {
+            double re = 0.0, im = 0.0;
+
+            for (uint32_t i = 0; i < n; i++) {
+                uint32_t a = (uint32_t) (((uint64_t) k * i) % n);
+
+                re += input[i] * cos(2.0 * pi * a / n);
+                im -= input[i] * sin(2.0 * pi * a / n);
+            }
+            worst = fmax(worst, fabs(reference[2U * k] - re / n));
+            worst = fmax(worst, fabs(reference[2U * k + 1U] - im / n));
+
+            if (k >= 2U && k < n / 2U &&
+                mag_sq(reference[2U * k], reference[2U * k + 1U]) >
+                mag_sq(reference[2U * peak], reference[2U * peak + 1U])) {
+                peak = k;
+            }
+        }
+
+        snprintf(message, sizeof(message), "%u-point bins within 4 LSB of the DFT (%.2f)",
+                 (unsigned)n, worst);
+        TEST_ASSERT(worst <= 4.0, message);
+        snprintf(message, sizeof(message), "%u-point spectrum peaks at bin %u",
+                 (unsigned)n, (unsigned)tone);
+        TEST_ASSERT(peak == tone, message);
+
+        mag_sq_mismatches = 0;
+        memcpy(work, input, n * sizeof(q15_t));
+        arm_rfft_q15_mag_sq_mixed(&plan, work, &work[MAX_FFT_LEN], check_bin, NULL);
+        for (uint32_t k = 0; k <= n / 2U; k++) {
+            q15_t bin[2];
+
+            arm_rfft_q15_mag_sq_mixed_bin(&plan, work, &work[MAX_FFT_LEN], k, bin);
+            if (bin[0] != reference[2U * k] || bin[1] != reference[2U * k + 1U]) {
+                mismatches++;
+            }
+        }
+        snprintf(message, sizeof(message), "%u-point magnitudes and bins match arm_rfft_q15_mixed",
+                 (unsigned)n);
+        TEST_ASSERT(mag_sq_mismatches == 0 && mismatches == 0, message);
+    }
+}
+
+/**
+ * @brief Main test runner
+ */
+int main(void) {
+    printf("=== RFFT Length Tests ===\n");
+    printf("Tables generated for 32 to 8192 points\n");
+
+    test_instances();
+    test_init();
+    test_spectra();
+    test_magnitudes();
+    test_inverse_shift();
+    test_shared_twiddles();
+#if !defined(RFFT_Q15_NO_BITREV_TABLES)
+    test_bitrev_tables();
+#endif
+    test_mixed_lengths();
+
+    /* Print summary */
+    printf("\n=== Test Summary ===\n");
+    printf("Passed: %d\n", tests_passed);
+    printf("Failed: %d\n", tests_failed);
+    printf("Total:  %d\n", tests_passed + tests_failed);
+
+    if (tests_failed == 0) {
+        printf("\n✓ All RFFT lengths pass!\n");
+        return 0;
+    } else {
+        printf("\n✗ Some tests failed!\n");
+        return 1;
+    }
+}
@@ -0,0 +1,285 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library - Simplified Q15 RFFT
+ * Title:        test_fft_stft.c
+ * Description:  Tests for the overlapping STFT frames against slices of the input
+ *
+ * Target Processor: nRF54L15 FLPR (PC validation)
+ * -------------------------------------------------------------------- */
+
+#include "../include/rfft_q15.h"
+#include "fft_stft.h"
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#if RFFT_Q15_MIN_FFT_LEN > 256 || RFFT_Q15_MAX_FFT_LEN < 4096
+#error "test_fft_stft.c needs the lengths from 256 to 4096"
+#endif
+
+#define MAX_FFT_LEN  4096
+#define MAX_SAMPLES  (8 * MAX_FFT_LEN)
+#define NUM_TOP_BINS 8
+
+static q15_t ring[MAX_FFT_LEN];
+static q15_t work[MAX_FFT_LEN] RFFT_Q15_ALIGN;
+static q15_t slice[MAX_FFT_LEN] RFFT_Q15_ALIGN;
+static q15_t frame[MAX_FFT_LEN];
+static q15_t hann[FFT_WINDOW_TABLE_LEN(MAX_FFT_LEN)];
+static q15_t input[MAX_SAMPLES];
+static spectral_peak_t peaks[NUM_TOP_BINS];
+static spectral_peak_t slice_peaks[NUM_TOP_BINS];
+
+/* Test result tracking */
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+/* Test assertion macro */
+#define TEST_ASSERT(condition, message) \
+    do { \
+        if (condition) { \
+            printf("  ✓ %s\n", message); \
+            tests_passed++; \
+        } else { \
+            printf("  ✗ %s\n", message); \
+            tests_failed++; \
+        } \
+    } while(0)
+
+/* Test section header */
+#define TEST_SECTION(name) \
+    printf("\n=== %s ===\n", name)
+
+static const double pi = 3.14159265358979323846;
+
+/* Tones and pseudo-random noise, a different frame at every offset */
+static void fill_input(uint32_t count)
+{
+    uint32_t seed = 2463534242U;
+
+    for (uint32_t i = 0; i < count; i++) {
+        seed ^= seed << 13;
+        seed ^= seed >> 17;
+        seed ^= seed << 5;
+        input[i] = (q15_t) lrint(12000.0 * sin(2.0 * pi * 0.0371 * i) +
+                                 8000.0 * sin(2.0 * pi * (0.11 + 0.00001 * i) * i) +
+                                 (double) ((int32_t) (seed >> 20) - 2048));
+    }
+}
+
+/* Both searches found the same bins of the same magnitudes² */
+static int same_peaks(const uint16_t *bins, const uint16_t *slice_bins)
+{
+    for (uint32_t i = 0; i < NUM_TOP_BINS; i++) {
+        if (bins[i] != slice_bins[i] || peaks[i].bin_index != slice_peaks[i].bin_index ||
+            peaks[i].magnitude_squared != slice_peaks[i].magnitude_squared) {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+/* The half window table of a context applied to input[start..], as fft_context_load() documents it */
+static void window_slice(const q15_t *window, uint32_t start, uint32_t fft_size)
+{
+    for (uint32_t i = 0; i < fft_size; i++) {
+        q15_t w = window[(i < fft_size / 2U) ? i : fft_size - i];
+        slice[i] = (q15_t) (((q31_t) input[start + i] * w) >> 15);
+    }
+}
+
+/**
+ * @brief Every frame equals the input slice it covers, however the input arrives
+ *
+ * Frame k of a hop h is input[k h] to input[k h + fft_size - 1]. Even
+ * frames are taken with fft_stft_take_frame() and compared sample by
+ * sample. Odd frames go through fft_stft_top_bins() with a Hann window;
+ * their top bins and magnitudes² equal those of the slice windowed
+ * independently and transformed by a context without a window. Pieces
+ * of 1 to 1000 samples put the ring wrap and the frame ends anywhere.
+ */
+static void test_frames(void)
+{
+    static const struct {
+        uint16_t fft_size;
+        uint16_t hop_size;
+    } cases[] = {
+        { 256, 64 },
+        { 256, 256 },
+        { 512, 384 },
+        { 1024, 512 },
+        { 1024, 1 },
+        { 4096, 1024 },
+    };
+    static const uint32_t pieces[] = { 1, 7, 97, 1000, 255, 3 };
+    char message[128];
+
+    TEST_SECTION("fft_stft - Frames against slices of the input");
+
+    fill_input(MAX_SAMPLES);
+
+    for (uint32_t c = 0; c < sizeof(cases) / sizeof(cases[0]); c++) {
+        uint32_t n = cases[c].fft_size;
+        uint32_t hop = cases[c].hop_size;
+        /* At most 64 frames, 8 for hops of a few samples */
+        uint32_t count = n + ((hop < 64U) ? 8U : 64U) * hop;
+        uint32_t frames = 0, bad_taken = 0, bad_bins = 0, consumed = 0, p = 0;
+        fft_context_t ctx, plain;
+        fft_stft_t stft;
+        uint16_t bins[NUM_TOP_BINS];
+        uint16_t slice_bins[NUM_TOP_BINS];
+
+        if (count > MAX_SAMPLES) {
+            count = MAX_SAMPLES - (MAX_SAMPLES - n) % hop;
+        }
+
+        fft_stft_init(&stft, ring, (uint16_t) n, (uint16_t) hop);
+        fft_context_init(&ctx, (uint16_t) n, work, peaks, NUM_TOP_BINS);
+        fft_context_set_window(&ctx, FFT_WINDOW_HANN, hann);
+        fft_context_init(&plain, (uint16_t) n, NULL, slice_peaks, NUM_TOP_BINS);
+
+        while (consumed < count) {
+            uint32_t piece = pieces[p++ % (sizeof(pieces) / sizeof(pieces[0]))];
+
+            if (piece > count - consumed) {
+                piece = count - consumed;
+            }
+            for (uint32_t used = 0; used < piece; ) {
+                used += fft_stft_push(&stft, &input[consumed + used], piece - used);
+                if (!fft_stft_frame_ready(&stft)) {
+                    continue;
+                }
+
+                if ((frames & 1U) == 0U) {
+                    fft_stft_take_frame(&stft, frame);
+                    bad_taken += memcmp(frame, &input[frames * hop], n * sizeof(q15_t)) != 0;
+                } else {
+                    fft_stft_top_bins(&stft, &ctx, bins, NUM_TOP_BINS);
+                    window_slice(ctx.window, frames * hop, n);
+                    fft_context_top_bins_inplace(&plain, slice, slice_bins, NUM_TOP_BINS);
+                    bad_bins += !same_peaks(bins, slice_bins);
+                }
+                frames++;
+            }
+            consumed += piece;
+        }
+
+        snprintf(message, sizeof(message), "%4u points, hop %4u: %2u frames, %u taken differ, "
+                 "%u windowed differ", n, hop, frames, bad_taken, bad_bins);
+        TEST_ASSERT(frames == 1U + (count - n) / hop && bad_taken == 0U && bad_bins == 0U,
+                    message);
+    }
+}
+
+/**
+ * @brief The window table against a double precision periodic Hann window
+ */
+static void test_window(void)
+{
+    fft_context_t ctx;
+    double worst = 0.0;
+    char message[96];
+
+    TEST_SECTION("fft_stft - Window of the frames");
+
+    fft_context_init(&ctx, 1024U, work, peaks, NUM_TOP_BINS);
+    fft_context_set_window(&ctx, FFT_WINDOW_HANN, hann);
+    for (uint32_t i = 0; i < FFT_WINDOW_TABLE_LEN(1024U); i++) {
+        double w = 32768.0 * (0.5 - 0.5 * cos(2.0 * pi * i / 1024.0));
+        double e = fabs(ctx.window[i] - ((w > 32767.0) ? 32767.0 : w));
+
+        worst = (e > worst) ? e : worst;
+    }
+
+    snprintf(message, sizeof(message), "Hann table within 1 LSB of double precision (max %.2f)",
+             worst);
+    TEST_ASSERT(worst <= 1.0, message);
+}
+
+/**
+ * @brief Skipping keeps the history, a reset forgets it
+ */
+static void test_skip_and_reset(void)
+{
+    fft_stft_t stft;
+    uint32_t pos;
+
+    TEST_SECTION("fft_stft - Skip and reset");
+
+    fill_input(MAX_SAMPLES);
+    fft_stft_init(&stft, ring, 512U, 128U);
+
+    pos = fft_stft_push(&stft, input, 2000U);
+    fft_stft_skip_frame(&stft);
+    pos += fft_stft_push(&stft, &input[pos], 2000U);
+    TEST_ASSERT(pos == 512U + 128U && fft_stft_frame_ready(&stft),
+                "A skipped frame leaves the next one due after hop_size samples");
+    fft_stft_take_frame(&stft, frame);
+    TEST_ASSERT(memcmp(frame, &input[128], 512U * sizeof(q15_t)) == 0,
+                "The frame after a skip is the slice one hop on");
+
+    pos += fft_stft_push(&stft, &input[pos], 100U);
+    fft_stft_reset(&stft);
+    TEST_ASSERT(fft_stft_push(&stft, &input[pos], 2000U) == 512U &&
+                fft_stft_frame_ready(&stft),
+                "After a reset the next frame is due once fft_size samples arrived");
+    fft_stft_take_frame(&stft, frame);
+    TEST_ASSERT(memcmp(frame, &input[pos], 512U * sizeof(q15_t)) == 0,
+                "The frame after a reset holds only samples pushed since");
+}
+
+/**
+ * @brief Argument checks
+ */
+static void test_errors(void)
+{
+    fft_stft_t stft;
+    fft_context_t ctx;
+    uint16_t bins[NUM_TOP_BINS];
+
+    TEST_SECTION("fft_stft - Errors");
+
+    TEST_ASSERT(fft_stft_init(NULL, ring, 256U, 64U) == RFFT_ERROR_NULL_POINTER,
+                "NULL STFT rejected");
+    TEST_ASSERT(fft_stft_init(&stft, ring, 300U, 64U) == RFFT_ERROR_INVALID_SIZE,
+                "Length without an RFFT rejected");
+    TEST_ASSERT(fft_stft_init(&stft, ring, 256U, 0U) == RFFT_ERROR_INVALID_SIZE,
+                "Hop of 0 rejected");
+    TEST_ASSERT(fft_stft_init(&stft, ring, 256U, 257U) == RFFT_ERROR_INVALID_SIZE,
+                "Hop above fft_size rejected");
+
+    fft_stft_init(&stft, ring, 256U, 64U);
+    fft_context_init(&ctx, 256U, work, peaks, NUM_TOP_BINS);
+    TEST_ASSERT(fft_stft_top_bins(&stft, &ctx, bins, NUM_TOP_BINS) == RFFT_ERROR_INVALID_SIZE,
+                "No frame due rejected");
+    fft_stft_push(&stft, input, 256U);
+    fft_context_init(&ctx, 512U, work, peaks, NUM_TOP_BINS);
+    TEST_ASSERT(fft_stft_top_bins(&stft, &ctx, bins, NUM_TOP_BINS) == RFFT_ERROR_INVALID_SIZE,
+                "Context of another length rejected");
+}
+
+/**
+ * @brief Main test runner
+ */
+int main(void) {
+    printf("=== STFT Tests ===\n");
+
+    test_window();
+    test_frames();
+    test_skip_and_reset();
+    test_errors();
+
+    /* Print summary */
+    printf("\n=== Test Summary ===\n");
+    printf("Passed: %d\n", tests_passed);
+    printf("Failed: %d\n", tests_failed);
+    printf("Total:  %d\n", tests_passed + tests_failed);
+
+    if (tests_failed == 0) {
+        printf("\n✓ The STFT frames match the slices of the input!\n");
+        return 0;
+    } else {
+        printf("\n✗ Some tests failed!\n");
+        return 1;
+    }
+}
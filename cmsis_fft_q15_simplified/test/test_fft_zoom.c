@@ -0,0 +1,353 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library - Simplified Q15 RFFT
+ * Title:        test_fft_zoom.c
+ * Description:  Tests for the zoom FFT against a double precision model
+ *
+ * Target Processor: nRF54L15 FLPR (PC validation)
+ * -------------------------------------------------------------------- */
+
+#include "../include/rfft_q15.h"
+#include "fft_zoom.h"
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#if RFFT_Q15_MIN_FFT_LEN > 256 || RFFT_Q15_MAX_FFT_LEN < 4096
+#error "test_fft_zoom.c needs the lengths from 256 to 4096"
+#endif
+
+#define SAMPLE_RATE  16000.0
+#define MAX_POINTS   2048
+#define MAX_TAPS     (8 * 64 + 1)
+#define MAX_SAMPLES  (2 * 64 * 512 + 64)
+
+static q15_t taps[MAX_TAPS];
+static q15_t history[4 * MAX_TAPS];
+static q15_t buffer[2 * MAX_POINTS] RFFT_Q15_ALIGN;
+static q15_t input[MAX_SAMPLES];
+static uint32_t mag_sq[MAX_POINTS];
+static double exact[MAX_POINTS];
+static double z_re[MAX_POINTS];
+static double z_im[MAX_POINTS];
+
+/* Test result tracking */
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+/* Test assertion macro */
+#define TEST_ASSERT(condition, message) \
+    do { \
+        if (condition) { \
+            printf("  ✓ %s\n", message); \
+            tests_passed++; \
+        } else { \
+            printf("  ✗ %s\n", message); \
+            tests_failed++; \
+        } \
+    } while(0)
+
+/* Test section header */
+#define TEST_SECTION(name) \
+    printf("\n=== %s ===\n", name)
+
+static const double pi = 3.14159265358979323846;
+
+static void store_mag(uint32_t bin, uint32_t value, void *user)
+{
+    (void) user;
+    mag_sq[bin] = value;
+}
+
+/* A tone of amplitude level at freq Hz */
+static void fill_tone(uint32_t count, double freq, double level)
+{
+    for (uint32_t i = 0; i < count; i++) {
+        input[i] = (q15_t) lrint(level * sin(2.0 * pi * freq * i / SAMPLE_RATE + 0.7));
+    }
+}
+
+/* Index of the largest of n values */
+static uint32_t peak_of(const uint32_t *values, uint32_t n)
+{
+    uint32_t peak = 0;
+
+    for (uint32_t i = 1; i < n; i++) {
+        if (values[i] > values[peak]) {
+            peak = i;
+        }
+    }
+
+    return peak;
+}
+
+/**
+ * @brief Double precision zoom FFT of frame number frame of input
+ *
+ * The same mixer phase, Q15 taps and decimation instants as the module,
+ * from silence; bins in the same order and scaled by 1/points like
+ * fft_zoom_mag_sq().
+ */
+static void reference_zoom(uint32_t points, uint32_t decimation, uint32_t step,
+                           uint32_t num_taps, uint32_t frame)
+{
+    for (uint32_t m = 0; m < points; m++) {
+        uint32_t n = (frame * points + m + 1U) * decimation - 1U;
+
+        z_re[m] = 0.0;
+        z_im[m] = 0.0;
+        for (uint32_t j = 0; j < num_taps && j <= n; j++) {
+            double phase = 2.0 * pi * (double) (((uint64_t) (n - j) * step) %
+                                                RFFT_TWIDDLE_TABLE_LEN) / RFFT_TWIDDLE_TABLE_LEN;
+            double x = input[n - j] * taps[j] / 32768.0;
+
+            z_re[m] += x * cos(phase);
+            z_im[m] -= x * sin(phase);
+        }
+    }
+
+    for (uint32_t i = 0; i < points; i++) {
+        uint32_t k = (i + points / 2U) % points;
+        double re = 0.0, im = 0.0;
+
+        for (uint32_t m = 0; m < points; m++) {
+            double phase = 2.0 * pi * (double) ((k * m) % points) / points;
+            re += z_re[m] * cos(phase) + z_im[m] * sin(phase);
+            im += z_im[m] * cos(phase) - z_re[m] * sin(phase);
+        }
+        exact[i] = (re * re + im * im) / ((double) points * points);
+    }
+}
+
+/**
+ * @brief The low-pass against a double precision Hann-windowed sinc
+ */
+static void test_lowpass(void)
+{
+    static const uint16_t decimations[] = { 1, 4, 16, 64 };
+    char message[112];
+
+    TEST_SECTION("fft_zoom - Low-pass design");
+
+    for (uint32_t d = 0; d < sizeof(decimations) / sizeof(decimations[0]); d++) {
+        uint32_t dec = decimations[d];
+        uint32_t num_taps = 8U * dec + 1U;
+        double h[MAX_TAPS];
+        double sum = 0.0, worst = 0.0;
+        int32_t dc = 0;
+
+        fft_zoom_design_lowpass(taps, (uint16_t) num_taps, (uint16_t) dec);
+
+        for (uint32_t j = 0; j < num_taps; j++) {
+            double t = j - (num_taps - 1U) / 2.0;
+            double sinc = (t == 0.0) ? 1.0 : sin(pi * t / dec) / (pi * t / dec);
+
+            h[j] = sinc * 0.5 * (1.0 - cos(2.0 * pi * (j + 1U) / (num_taps + 1U)));
+            sum += h[j];
+        }
+        for (uint32_t j = 0; j < num_taps; j++) {
+            double e = fabs(taps[j] - 32768.0 * h[j] / sum);
+            worst = (e > worst) ? e : worst;
+            dc += taps[j];
+        }
+
+        snprintf(message, sizeof(message), "Decimation %2u, %3u taps: within 2 LSB (max %.2f), "
+                 "DC gain %d / 32768", dec, num_taps, worst, (int) dc);
+        TEST_ASSERT(worst <= 2.0 && dc >= 32768 - (int32_t) num_taps / 2 &&
+                    dc <= 32768 + (int32_t) num_taps / 2, message);
+    }
+}
+
+/**
+ * @brief A tone between two bins peaks in the nearest zoomed bin
+ *
+ * The second frame, past the settling of the low-pass, against the double
+ * model: the peak in bin points / 2 + round(offset), and the magnitude²
+ * of the bins within a hundredth of the peak within 0.5 dB of the model.
+ */
+static void test_tone(void)
+{
+    static const struct {
+        uint16_t points;
+        uint16_t decimation;
+        double offset;          /* Bins from the center */
+    } cases[] = {
+        { 256, 16, 37.3 },
+        { 256, 16, -100.45 },
+        { 512, 8, 3.7 },
+        { 1024, 4, -0.2 },
+        { 2048, 2, 611.35 },
+        { 128, 64, 20.6 },
+    };
+    static const double center_hz = 3000.0;
+    char message[144];
+
+    TEST_SECTION("fft_zoom - Tone between bins against a double model");
+
+    for (uint32_t c = 0; c < sizeof(cases) / sizeof(cases[0]); c++) {
+        fft_zoom_t zoom;
+        uint32_t points = cases[c].points;
+        uint32_t dec = cases[c].decimation;
+        uint32_t num_taps = 8U * dec + 1U;
+        uint32_t step = FFT_ZOOM_STEP(3000U, 16000U);
+        uint32_t count = 2U * points * dec;
+        double freq = center_hz + cases[c].offset * SAMPLE_RATE / (dec * points);
+        uint32_t expected = (uint32_t) ((int32_t) (points / 2U) + (int32_t) lrint(cases[c].offset));
+        uint32_t consumed = 0, frames = 0, peak, exact_peak = 0;
+        double worst_db = 0.0;
+        rfft_status_t status = RFFT_SUCCESS;
+
+        fill_tone(count, freq, 20000.0);
+        fft_zoom_design_lowpass(taps, (uint16_t) num_taps, (uint16_t) dec);
+        fft_zoom_init(&zoom, (uint16_t) points, (uint16_t) dec, step, taps,
+                      (uint16_t) num_taps, history, buffer);
+
+        while (consumed < count && status == RFFT_SUCCESS) {
+            consumed += fft_zoom_push(&zoom, &input[consumed], count - consumed);
+            if (fft_zoom_frame_ready(&zoom)) {
+                status = fft_zoom_mag_sq(&zoom, store_mag, NULL);
+                frames++;
+            }
+        }
+
+        reference_zoom(points, dec, step, num_taps, 1U);
+        peak = peak_of(mag_sq, points);
+        for (uint32_t i = 1; i < points; i++) {
+            exact_peak = (exact[i] > exact[exact_peak]) ? i : exact_peak;
+        }
+        for (uint32_t i = 0; i < points; i++) {
+            if (exact[i] >= 0.01 * exact[exact_peak]) {
+                double db = fabs(10.0 * log10((mag_sq[i] + 0.5) / exact[i]));
+                worst_db = (db > worst_db) ? db : worst_db;
+            }
+        }
+
+        snprintf(message, sizeof(message), "%4u points / %2u at %+8.2f bins: peak in bin %4u "
+                 "(expected %4u, model %4u), within %.2f dB", points, dec, cases[c].offset,
+                 peak, expected, exact_peak, worst_db);
+        TEST_ASSERT(status == RFFT_SUCCESS && frames == 2U && peak == expected &&
+                    exact_peak == expected && worst_db <= 0.5, message);
+    }
+}
+
+/**
+ * @brief A tone outside the band is suppressed by the low-pass
+ */
+static void test_out_of_band(void)
+{
+    fft_zoom_t zoom;
+    uint32_t consumed = 0, count = 2U * 256U * 16U;
+    uint32_t in_band = 0, out_band = 0;
+    char message[112];
+
+    TEST_SECTION("fft_zoom - Out-of-band tone");
+
+    fft_zoom_design_lowpass(taps, 129U, 16U);
+
+    /* Tone 30 bins into the band, then one 120 bins next to it */
+    for (uint32_t pass = 0; pass < 2U; pass++) {
+        double freq = 3000.0 + (pass == 0U ? 30.0 : 256.0 / 2.0 + 120.0) * SAMPLE_RATE / (16.0 * 256.0);
+
+        fill_tone(count, freq, 20000.0);
+        fft_zoom_init(&zoom, 256U, 16U, FFT_ZOOM_STEP(3000U, 16000U), taps, 129U, history,
+                      buffer);
+        consumed = 0;
+        while (consumed < count) {
+            consumed += fft_zoom_push(&zoom, &input[consumed], count - consumed);
+            if (fft_zoom_frame_ready(&zoom)) {
+                fft_zoom_mag_sq(&zoom, store_mag, NULL);
+            }
+        }
+        if (pass == 0U) {
+            in_band = mag_sq[peak_of(mag_sq, 256U)];
+        } else {
+            out_band = mag_sq[peak_of(mag_sq, 256U)];
+        }
+    }
+
+    snprintf(message, sizeof(message), "Tone outside the band %.1f dB below one inside",
+             10.0 * log10((double) in_band / (out_band + 0.5)));
+    TEST_ASSERT(in_band > 1000U * (out_band + 1U), message);
+}
+
+/**
+ * @brief A reset restarts from silence, the same spectrum as a new zoom FFT
+ */
+static void test_reset(void)
+{
+    static uint32_t first[256];
+    fft_zoom_t zoom;
+    uint32_t count = 256U * 16U;
+    uint32_t consumed;
+
+    TEST_SECTION("fft_zoom - Reset");
+
+    fill_tone(count, 3100.0, 15000.0);
+    fft_zoom_design_lowpass(taps, 129U, 16U);
+    fft_zoom_init(&zoom, 256U, 16U, FFT_ZOOM_STEP(3000U, 16000U), taps, 129U, history, buffer);
+    consumed = fft_zoom_push(&zoom, input, count);
+    fft_zoom_mag_sq(&zoom, store_mag, NULL);
+    memcpy(first, mag_sq, sizeof(first));
+
+    fft_zoom_push(&zoom, input, 1000U);
+    fft_zoom_reset(&zoom);
+    consumed = 0;
+    for (uint32_t piece = 1; consumed < count; piece = piece * 3U + 1U) {
+        uint32_t n = (count - consumed < piece) ? count - consumed : piece;
+        consumed += fft_zoom_push(&zoom, &input[consumed], n);
+    }
+    TEST_ASSERT(fft_zoom_frame_ready(&zoom) &&
+                fft_zoom_mag_sq(&zoom, store_mag, NULL) == RFFT_SUCCESS &&
+                memcmp(first, mag_sq, sizeof(first)) == 0,
+                "Bins after fft_zoom_reset() equal those of a new zoom FFT");
+}
+
+/**
+ * @brief Argument checks
+ */
+static void test_errors(void)
+{
+    fft_zoom_t zoom;
+
+    TEST_SECTION("fft_zoom - Errors");
+
+    TEST_ASSERT(fft_zoom_design_lowpass(NULL, 129U, 16U) == RFFT_ERROR_NULL_POINTER,
+                "NULL taps rejected");
+    TEST_ASSERT(fft_zoom_design_lowpass(taps, 129U, 12U) == RFFT_ERROR_INVALID_SIZE,
+                "Decimation not a power of two rejected");
+    TEST_ASSERT(fft_zoom_design_lowpass(taps, 0U, 16U) == RFFT_ERROR_INVALID_SIZE,
+                "No taps rejected");
+    TEST_ASSERT(fft_zoom_init(&zoom, 300U, 16U, 0U, taps, 129U, history, buffer) ==
+                RFFT_ERROR_INVALID_SIZE, "Length without a CFFT rejected");
+    TEST_ASSERT(fft_zoom_init(&zoom, 256U, 16U, RFFT_TWIDDLE_TABLE_LEN, taps, 129U, history,
+                              buffer) == RFFT_ERROR_INVALID_SIZE, "Step of a full turn rejected");
+    TEST_ASSERT(fft_zoom_init(&zoom, 256U, 16U, 0U, taps, 129U, history, buffer) ==
+                RFFT_SUCCESS && fft_zoom_mag_sq(&zoom, store_mag, NULL) ==
+                RFFT_ERROR_INVALID_SIZE, "No frame due rejected");
+}
+
+/**
+ * @brief Main test runner
+ */
+int main(void) {
+    printf("=== Zoom FFT Tests ===\n");
+
+    test_lowpass();
+    test_tone();
+    test_out_of_band();
+    test_reset();
+    test_errors();
+
+    /* Print summary */
+    printf("\n=== Test Summary ===\n");
+    printf("Passed: %d\n", tests_passed);
+    printf("Failed: %d\n", tests_failed);
+    printf("Total:  %d\n", tests_passed + tests_failed);
+
+    if (tests_failed == 0) {
+        printf("\n✓ The zoom FFT matches the double precision model!\n");
+        return 0;
+    } else {
+        printf("\n✗ Some tests failed!\n");
+        return 1;
+    }
+}
@@ -0,0 +1,319 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library - Simplified Q15 RFFT
+ * Title:        test_packed_butterfly.c
+ * Description:  Bit-exactness tests for the packed radix-4 butterfly
+ *
+ * Target Processor: nRF54L15 FLPR (PC validation)
+ * -------------------------------------------------------------------- */
+
+#include "../include/rfft_q15.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * The library objects use the generic scalar butterfly. The packed
+ * butterfly is built from the same source with RFFT_Q15_PACKED_BUTTERFLY
+ * and its entry point renamed, see the Makefile.
+ */
+extern void arm_radix4_butterfly_q15(
+        q15_t * pSrc16,
+        uint32_t fftLen,
+  const q15_t * pCoef16,
+        uint32_t twidCoefModifier,
+        uint32_t shift);
+
+extern void packed_radix4_butterfly_q15(
+        q15_t * pSrc16,
+        uint32_t fftLen,
+  const q15_t * pCoef16,
+        uint32_t twidCoefModifier,
+        uint32_t shift);
+
+extern void arm_cfft_radix4by2_q15(
+        q15_t * pSrc,
+        uint32_t fftLen,
+  const q15_t * pCoef);
+
+extern void arm_cfft_radix4by2_q15_packed(
+        q15_t * pSrc16,
+        uint32_t fftLen,
+  const q15_t * pCoef16,
+        q15_t * pDst16);
+
+extern void arm_radix4_butterfly_q15_packed(
+        q15_t * pSrc16,
+        uint32_t fftLen,
+  const q15_t * pCoef16,
+        uint32_t twidCoefModifier,
+        q15_t * pDst16);
+
+/* Test result tracking */
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+/* Test assertion macro */
+#define TEST_ASSERT(condition, message) \
+    do { \
+        if (condition) { \
+            printf("  ✓ %s\n", message); \
+            tests_passed++; \
+        } else { \
+            printf("  ✗ %s\n", message); \
+            tests_failed++; \
+        } \
+    } while(0)
+
+/* Test section header */
+#define TEST_SECTION(name) \
+    printf("\n=== %s ===\n", name)
+
+#define MAX_CFFT_LEN 4096
+
+static q15_t ref_buf[2 * MAX_CFFT_LEN] RFFT_Q15_ALIGN;
+static q15_t packed_buf[2 * MAX_CFFT_LEN] RFFT_Q15_ALIGN;
+static q15_t out_buf[2 * MAX_CFFT_LEN] RFFT_Q15_ALIGN;
+
+typedef enum {
+    PATTERN_RANDOM,
+    PATTERN_FULL_SCALE,
+    PATTERN_ALTERNATING,
+} pattern_t;
+
+static void fill_pattern(q15_t *buf, uint32_t n, pattern_t pattern, unsigned int seed)
+{
+    srand(seed);
+
+    for (uint32_t i = 0; i < 2 * n; i++) {
+        switch (pattern) {
+        case PATTERN_RANDOM:
+            buf[i] = (q15_t)((rand() & 0xFFFF) - 32768);
+            break;
+        case PATTERN_FULL_SCALE:
+            /* Worst case for saturation in the middle stages */
+            buf[i] = (rand() & 1) ? 32767 : -32768;
+            break;
+        case PATTERN_ALTERNATING:
+            buf[i] = (i & 2) ? -32768 : 32767;
+            break;
+        }
+    }
+}
+
+/* Run both butterflies on the same input, return 1 when outputs match. */
+static int compare_butterflies(uint32_t n, const q15_t *coef, uint32_t modifier,
+                               pattern_t pattern, unsigned int seed)
+{
+    fill_pattern(ref_buf, n, pattern, seed);
+    memcpy(packed_buf, ref_buf, 2 * n * sizeof(q15_t));
+
+    arm_radix4_butterfly_q15(ref_buf, n, coef, modifier, 0U);
+    packed_radix4_butterfly_q15(packed_buf, n, coef, modifier, 0U);
+
+    return memcmp(ref_buf, packed_buf, 2 * n * sizeof(q15_t)) == 0;
+}
+
+/**
+ * @brief Packed and generic butterflies agree for every radix-4 size
+ */
+static void test_all_sizes(void)
+{
+    static const uint32_t sizes[] = { 16, 64, 256, 1024, 4096 };
+    char message[96];
+
+    TEST_SECTION("Packed Butterfly - All Radix-4 Sizes");
+
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+        uint32_t n = sizes[s];
+        int ok = 1;
+
+        for (unsigned int seed = 1; seed <= 8; seed++) {
+            ok &= compare_butterflies(n, RFFT_TWIDDLE_TABLE, RFFT_TWIDDLE_STRIDE(n),
+                                      PATTERN_RANDOM, seed);
+        }
+
+        snprintf(message, sizeof(message), "%u-point random input is bit-exact", (unsigned)n);
+        TEST_ASSERT(ok, message);
+    }
+}
+
+/**
+ * @brief Saturating inputs take the same path through both butterflies
+ */
+static void test_saturation(void)
+{
+    TEST_SECTION("Packed Butterfly - Saturation");
+
+    TEST_ASSERT(compare_butterflies(4096, RFFT_TWIDDLE_TABLE, RFFT_TWIDDLE_STRIDE(4096U), PATTERN_FULL_SCALE, 3),
+                "4096-point full-scale input is bit-exact");
+    TEST_ASSERT(compare_butterflies(256, RFFT_TWIDDLE_TABLE, RFFT_TWIDDLE_STRIDE(256U), PATTERN_FULL_SCALE, 5),
+                "256-point full-scale input is bit-exact");
+    TEST_ASSERT(compare_butterflies(1024, RFFT_TWIDDLE_TABLE, RFFT_TWIDDLE_STRIDE(1024U), PATTERN_ALTERNATING, 0),
+                "1024-point alternating input is bit-exact");
+}
+
+/**
+ * @brief The 1024-point halves used by the 2048-point radix-4-by-2 path
+ */
+static void test_radix4by2_halves(void)
+{
+    TEST_SECTION("Packed Butterfly - Radix-4-by-2 Halves");
+
+    TEST_ASSERT(compare_butterflies(1024, RFFT_TWIDDLE_TABLE, 2U * RFFT_TWIDDLE_STRIDE(2048U),
+                                    PATTERN_RANDOM, 11),
+                "1024-point with the 2048-point stride is bit-exact");
+}
+
+/**
+ * @brief The output shift of both butterflies matches a separate pass
+ */
+static void test_output_shift(void)
+{
+    int ok = 1;
+
+    TEST_SECTION("Packed Butterfly - Output Shift");
+
+    for (uint32_t shift = 1U; shift <= 2U; shift++) {
+        fill_pattern(ref_buf, 1024, PATTERN_RANDOM, 40 + shift);
+        memcpy(packed_buf, ref_buf, 2 * 1024 * sizeof(q15_t));
+        memcpy(out_buf, ref_buf, 2 * 1024 * sizeof(q15_t));
+
+        arm_radix4_butterfly_q15(ref_buf, 1024, RFFT_TWIDDLE_TABLE,
+                                 2U * RFFT_TWIDDLE_STRIDE(2048U), 0U);
+        for (uint32_t i = 0; i < 2 * 1024; i++) {
+            ref_buf[i] = (q15_t) (ref_buf[i] << shift);
+        }
+        arm_radix4_butterfly_q15(out_buf, 1024, RFFT_TWIDDLE_TABLE,
+                                 2U * RFFT_TWIDDLE_STRIDE(2048U), shift);
+        packed_radix4_butterfly_q15(packed_buf, 1024, RFFT_TWIDDLE_TABLE,
+                                    2U * RFFT_TWIDDLE_STRIDE(2048U), shift);
+
+        ok &= memcmp(ref_buf, out_buf, 2 * 1024 * sizeof(q15_t)) == 0;
+        ok &= memcmp(ref_buf, packed_buf, 2 * 1024 * sizeof(q15_t)) == 0;
+    }
+    TEST_ASSERT(ok, "1024-point output shift matches a separate pass");
+}
+
+/* Run both radix-4-by-2 transforms on the same input, return 1 when outputs match. */
+static int compare_radix4by2(uint32_t n, const q15_t *coef, pattern_t pattern, unsigned int seed)
+{
+    fill_pattern(ref_buf, n, pattern, seed);
+    memcpy(packed_buf, ref_buf, 2 * n * sizeof(q15_t));
+
+    arm_cfft_radix4by2_q15(ref_buf, n, coef);
+    arm_cfft_radix4by2_q15_packed(packed_buf, n, coef, NULL);
+
+    return memcmp(ref_buf, packed_buf, 2 * n * sizeof(q15_t)) == 0;
+}
+
+/**
+ * @brief The fused 2048-point transform matches the staged radix-4-by-2 path
+ */
+static void test_fused_radix4by2(void)
+{
+    int ok = 1;
+
+    TEST_SECTION("Packed Radix-4-by-2 - 2048 Points");
+
+    for (unsigned int seed = 1; seed <= 8; seed++) {
+        ok &= compare_radix4by2(2048, RFFT_TWIDDLE_TABLE, PATTERN_RANDOM, seed);
+    }
+    TEST_ASSERT(ok, "2048-point random input is bit-exact");
+    TEST_ASSERT(compare_radix4by2(2048, RFFT_TWIDDLE_TABLE, PATTERN_FULL_SCALE, 7),
+                "2048-point full-scale input is bit-exact");
+    TEST_ASSERT(compare_radix4by2(2048, RFFT_TWIDDLE_TABLE, PATTERN_ALTERNATING, 0),
+                "2048-point alternating input is bit-exact");
+}
+
+/**
+ * @brief Out-of-place transforms match in-place ones followed by the table bit reversal
+ */
+static void test_natural_order_output(void)
+{
+    int ok;
+
+    TEST_SECTION("Packed CFFT - Natural Order Output");
+
+    fill_pattern(ref_buf, 4096, PATTERN_RANDOM, 21);
+    memcpy(packed_buf, ref_buf, 2 * 4096 * sizeof(q15_t));
+    arm_radix4_butterfly_q15(ref_buf, 4096, RFFT_TWIDDLE_TABLE, RFFT_TWIDDLE_STRIDE(4096U), 0U);
+    arm_bitreversal_16((uint16_t *)ref_buf, ARMBITREVINDEXTABLE_FIXED_4096_TABLE_LENGTH,
+                       armBitRevIndexTable_fixed_4096);
+    arm_radix4_butterfly_q15_packed(packed_buf, 4096, RFFT_TWIDDLE_TABLE, RFFT_TWIDDLE_STRIDE(4096U),
+                                    out_buf);
+    ok = memcmp(ref_buf, out_buf, 2 * 4096 * sizeof(q15_t)) == 0;
+    TEST_ASSERT(ok, "4096-point output matches the bit reversal table");
+
+    fill_pattern(ref_buf, 2048, PATTERN_RANDOM, 22);
+    memcpy(packed_buf, ref_buf, 2 * 2048 * sizeof(q15_t));
+    arm_cfft_radix4by2_q15(ref_buf, 2048, RFFT_TWIDDLE_TABLE);
+    arm_bitreversal_16((uint16_t *)ref_buf, ARMBITREVINDEXTABLE_FIXED_2048_TABLE_LENGTH,
+                       armBitRevIndexTable_fixed_2048);
+    arm_cfft_radix4by2_q15_packed(packed_buf, 2048, RFFT_TWIDDLE_TABLE, out_buf);
+    ok = memcmp(ref_buf, out_buf, 2 * 2048 * sizeof(q15_t)) == 0;
+    TEST_ASSERT(ok, "2048-point output matches the bit reversal table");
+}
+
+/**
+ * @brief Table-free bit reversal matches the index tables
+ */
+static void test_bitreversal_notable(void)
+{
+    static const uint32_t sizes[] = { 2048, 4096 };
+    static const uint16_t *const tables[] = {
+        armBitRevIndexTable_fixed_2048, armBitRevIndexTable_fixed_4096
+    };
+    static const uint16_t lengths[] = {
+        ARMBITREVINDEXTABLE_FIXED_2048_TABLE_LENGTH, ARMBITREVINDEXTABLE_FIXED_4096_TABLE_LENGTH
+    };
+    char message[96];
+
+    TEST_SECTION("Bit Reversal - No Index Table");
+
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+        uint32_t n = sizes[s];
+        int ok;
+
+        fill_pattern(ref_buf, n, PATTERN_RANDOM, 30 + s);
+        memcpy(packed_buf, ref_buf, 2 * n * sizeof(q15_t));
+        arm_bitreversal_q15_copy(ref_buf, out_buf, n);
+        arm_bitreversal_16((uint16_t *)ref_buf, lengths[s], tables[s]);
+        arm_bitreversal_q15_notable(packed_buf, n);
+
+        ok = memcmp(ref_buf, packed_buf, 2 * n * sizeof(q15_t)) == 0 &&
+             memcmp(ref_buf, out_buf, 2 * n * sizeof(q15_t)) == 0;
+        snprintf(message, sizeof(message), "%u-point in-place and copy match the table",
+                 (unsigned)n);
+        TEST_ASSERT(ok, message);
+    }
+}
+
+/**
+ * @brief Main test runner
+ */
+int main(void) {
+    printf("=== Packed Radix-4 Butterfly Tests ===\n");
+    printf("Comparing RFFT_Q15_PACKED_BUTTERFLY against the generic scalar butterfly\n");
+
+    test_all_sizes();
+    test_saturation();
+    test_radix4by2_halves();
+    test_output_shift();
+    test_fused_radix4by2();
+    test_natural_order_output();
+    test_bitreversal_notable();
+
+    /* Print summary */
+    printf("\n=== Test Summary ===\n");
+    printf("Passed: %d\n", tests_passed);
+    printf("Failed: %d\n", tests_failed);
+    printf("Total:  %d\n", tests_passed + tests_failed);
+
+    if (tests_failed == 0) {
+        printf("\n✓ Packed butterfly is bit-exact!\n");
+        return 0;
+    } else {
+        printf("\n✗ Some tests failed!\n");
+        return 1;
+    }
+}
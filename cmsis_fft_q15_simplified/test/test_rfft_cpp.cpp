@@ -0,0 +1,179 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library - Simplified Q15 RFFT
+ * Title:        test_rfft_cpp.cpp
+ * Description:  Tests for the C++ RfftQ15<N> of rfft_q15_simplified.hpp
+ *
+ * Target Processor: nRF54L15 FLPR (PC validation)
+ * -------------------------------------------------------------------- */
+
+#include "rfft_q15_simplified.hpp"
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+
+/*
+ * Built with tables generated for 32 to 8192 points, see the test-cpp
+ * target of the Makefile, so every RfftQ15<N> has a prebuilt instance to
+ * compare with.
+ */
+#if RFFT_Q15_MIN_FFT_LEN != 32 || RFFT_Q15_MAX_FFT_LEN != 8192
+#error "test_rfft_cpp.cpp needs all lengths from 32 to 8192"
+#endif
+
+#define MAX_FFT_LEN 8192
+
+/* The instances are constant expressions */
+static_assert(RfftQ15<32>::instance()->fftLenReal == 32U, "32-point instance");
+static_assert(RfftQ15<8192>::instance()->pCfft->fftLen == 4096U, "8192-point CFFT");
+static_assert(RfftQ15<1024>::instance()->twidCoefRModifier == RFFT_TWIDDLE_STRIDE(1024U),
+              "1024-point twiddle stride");
+static_assert(alignof(RfftQ15<256>::Samples) >= 4U, "Samples are word aligned");
+static_assert(sizeof(RfftQ15<256>::Spectrum) == 2U * 256U * sizeof(q15_t),
+              "Spectrum holds 2 * N values");
+
+static q15_t input[MAX_FFT_LEN] RFFT_Q15_ALIGN;
+static q15_t work[2 * MAX_FFT_LEN] RFFT_Q15_ALIGN;
+static q15_t reference[2 * MAX_FFT_LEN] RFFT_Q15_ALIGN;
+
+/* Test result tracking */
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+/* Test assertion macro */
+#define TEST_ASSERT(condition, message) \
+    do { \
+        if (condition) { \
+            printf("  ✓ %s\n", message); \
+            tests_passed++; \
+        } else { \
+            printf("  ✗ %s\n", message); \
+            tests_failed++; \
+        } \
+    } while(0)
+
+/* Test section header */
+#define TEST_SECTION(name) \
+    printf("\n=== %s ===\n", name)
+
+/* Full-scale-half cosine at bin tone plus a smaller one at bin 3 */
+static void fill_tones(uint32_t n, uint32_t tone)
+{
+    const double pi = 3.14159265358979323846;
+
+    for (uint32_t i = 0; i < n; i++) {
+        input[i] = (q15_t) (16384.0 * cos(2.0 * pi * tone * i / n) +
+                            4096.0 * cos(2.0 * pi * 3.0 * i / n));
+    }
+}
+
+/* Magnitudes reported by RfftQ15<N>::mag_sq(), checked against reference */
+static int mag_sq_mismatches;
+
+static void check_bin(uint32_t bin, uint32_t value, void *user)
+{
+    (void) user;
+
+    q31_t re = reference[2U * bin];
+    q31_t im = reference[2U * bin + 1U];
+
+    if (value != (uint32_t) (re * re) + (uint32_t) (im * im)) {
+        mag_sq_mismatches++;
+    }
+}
+
+/**
+ * @brief The compile-time twiddle table is the generated one
+ */
+static void test_twiddles(void)
+{
+    const auto &table = rfft_q15_detail::twiddles<RFFT_TWIDDLE_TABLE_LEN>;
+
+    TEST_SECTION("C++ RFFT - Twiddle Table");
+
+    TEST_ASSERT(memcmp(table.data(), RFFT_TWIDDLE_TABLE, sizeof(table)) == 0,
+                "constexpr table matches RFFT_TWIDDLE_TABLE");
+    TEST_ASSERT(((uintptr_t) table.data() & 3U) == 0U, "constexpr table is word aligned");
+}
+
+/**
+ * @brief RfftQ15<N> computes what the prebuilt instance of N does
+ */
+template <std::size_t N>
+static void test_length(void)
+{
+    static typename RfftQ15<N>::Samples samples;
+    static typename RfftQ15<N>::Spectrum spectrum;
+    const arm_rfft_instance_q15 *prebuilt = rfft_q15_get_instance(N);
+    const arm_rfft_instance_q15 *S = RfftQ15<N>::instance();
+    char message[96];
+
+    TEST_SECTION("C++ RFFT - Length");
+
+    snprintf(message, sizeof(message), "%u-point instance matches the prebuilt one",
+             (unsigned) N);
+    TEST_ASSERT(S->fftLenReal == prebuilt->fftLenReal && S->ifftFlagR == prebuilt->ifftFlagR &&
+                S->bitReverseFlagR == prebuilt->bitReverseFlagR &&
+                S->twidCoefRModifier == prebuilt->twidCoefRModifier &&
+                S->pCfft->fftLen == prebuilt->pCfft->fftLen &&
+                S->pCfft->bitRevLength == prebuilt->pCfft->bitRevLength, message);
+
+#if defined(ARM_MATH_DSP)
+    snprintf(message, sizeof(message), "%u-point bit reversal table matches the generated one",
+             (unsigned) N);
+    TEST_ASSERT(memcmp(S->pCfft->pBitRevTable, prebuilt->pCfft->pBitRevTable,
+                       S->pCfft->bitRevLength * sizeof(uint16_t)) == 0, message);
+#endif
+
+    fill_tones(N, N / 16U + 5U);
+    memcpy(work, input, N * sizeof(q15_t));
+    arm_rfft_q15(prebuilt, work, reference);
+
+    memcpy(samples.data(), input, N * sizeof(q15_t));
+    RfftQ15<N>::forward(samples, spectrum);
+    snprintf(message, sizeof(message), "%u-point forward() is bit-exact", (unsigned) N);
+    TEST_ASSERT(memcmp(spectrum.data(), reference, 2U * N * sizeof(q15_t)) == 0, message);
+
+    memcpy(samples.data(), input, N * sizeof(q15_t));
+    RfftQ15<N>::forward_packed(samples);
+    snprintf(message, sizeof(message), "%u-point forward_packed() is bit-exact", (unsigned) N);
+    TEST_ASSERT(samples[0] == reference[0] && samples[1] == reference[N] &&
+                memcmp(&samples[2], &reference[2], (N - 2U) * sizeof(q15_t)) == 0, message);
+
+    mag_sq_mismatches = 0;
+    memcpy(samples.data(), input, N * sizeof(q15_t));
+    RfftQ15<N>::mag_sq(samples, check_bin, NULL);
+    snprintf(message, sizeof(message), "%u-point mag_sq() is bit-exact", (unsigned) N);
+    TEST_ASSERT(mag_sq_mismatches == 0, message);
+}
+
+template <std::size_t... N>
+static void test_lengths(void)
+{
+    (test_length<N>(), ...);
+}
+
+/**
+ * @brief Main test runner
+ */
+int main(void) {
+    printf("=== C++ RFFT Tests ===\n");
+    printf("Tables computed by the compiler for RFFT_Q15_MAX_FFT_LEN %u\n",
+           (unsigned) RFFT_Q15_MAX_FFT_LEN);
+
+    test_twiddles();
+    test_lengths<32, 64, 128, 256, 512, 1024, 2048, 4096, 8192>();
+
+    /* Print summary */
+    printf("\n=== Test Summary ===\n");
+    printf("Passed: %d\n", tests_passed);
+    printf("Failed: %d\n", tests_failed);
+    printf("Total:  %d\n", tests_passed + tests_failed);
+
+    if (tests_failed == 0) {
+        printf("\n✓ All C++ RFFT tests pass!\n");
+        return 0;
+    } else {
+        printf("\n✗ Some tests failed!\n");
+        return 1;
+    }
+}
@@ -0,0 +1,420 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library - Simplified Q31 RFFT
+ * Title:        test_rfft_q31.c
+ * Description:  Tests of the Q31 RFFT against the CMSIS-DSP Q31 tables
+ *
+ * Target Processor: nRF54L15 FLPR (PC validation)
+ * -------------------------------------------------------------------- */
+
+#include "../include/rfft_q31.h"
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+/*
+ * Built with RFFT_Q31_MIN_FFT_LEN=32, tables generated for 32 to 8192
+ * points and the CMSIS-DSP tables extracted by extract_tables.py
+ * --q31-reference, see the test-q31 target of the Makefile.
+ */
+#if RFFT_Q31_MIN_FFT_LEN != 32 || RFFT_Q31_MAX_FFT_LEN != 8192
+#error "test_rfft_q31.c needs all lengths from 32 to 8192"
+#endif
+
+#define MAX_FFT_LEN 8192
+
+/* CMSIS-DSP tables of reference_tables_q31.c */
+extern const q31_t ref_twiddleCoef_16_q31[24];
+extern const q31_t ref_twiddleCoef_32_q31[48];
+extern const q31_t ref_twiddleCoef_64_q31[96];
+extern const q31_t ref_twiddleCoef_128_q31[192];
+extern const q31_t ref_twiddleCoef_256_q31[384];
+extern const q31_t ref_twiddleCoef_512_q31[768];
+extern const q31_t ref_twiddleCoef_1024_q31[1536];
+extern const q31_t ref_twiddleCoef_2048_q31[3072];
+extern const q31_t ref_twiddleCoef_4096_q31[6144];
+extern const q31_t ref_realCoefAQ31[8192];
+extern const q31_t ref_realCoefBQ31[8192];
+
+static q31_t input[MAX_FFT_LEN];
+static q31_t work[2 * MAX_FFT_LEN];
+static q31_t output[2 * MAX_FFT_LEN];
+static q31_t reference[2 * MAX_FFT_LEN];
+static double exact[MAX_FFT_LEN + 2];
+
+/* Test result tracking */
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+/* Test assertion macro */
+#define TEST_ASSERT(condition, message) \
+    do { \
+        if (condition) { \
+            printf("  ✓ %s\n", message); \
+            tests_passed++; \
+        } else { \
+            printf("  ✗ %s\n", message); \
+            tests_failed++; \
+        } \
+    } while(0)
+
+/* Test section header */
+#define TEST_SECTION(name) \
+    printf("\n=== %s ===\n", name)
+
+static const double pi = 3.14159265358979323846;
+
+/* Two tones of amplitude level and level / 4 with a little pseudo-random noise */
+static void fill_signal(uint32_t n, double level)
+{
+    uint32_t seed = 12345U;
+
+    for (uint32_t i = 0; i < n; i++) {
+        seed = seed * 1103515245U + 12345U;
+        input[i] = (q31_t) floor(level * sin(2.0 * pi * 37.0 * i / n) +
+                                 level / 4.0 * cos(2.0 * pi * 301.0 * i / n) +
+                                 (double) ((seed >> 8) & 0xFFU) - 127.5 + 0.5);
+    }
+}
+
+/* Double precision DFT of input, bins 0 to n / 2 */
+static void reference_dft(uint32_t n)
+{
+    for (uint32_t k = 0; k <= n / 2U; k++) {
+        double re = 0.0, im = 0.0;
+
+        for (uint32_t i = 0; i < n; i++) {
+            double phase = 2.0 * pi * (double) ((k * i) % n) / n;
+            re += input[i] * cos(phase);
+            im -= input[i] * sin(phase);
+        }
+        exact[2U * k] = re;
+        exact[2U * k + 1U] = im;
+    }
+}
+
+/* SNR in dB of bins 0 to n / 2 of out * scale against exact */
+static double snr_db(const void *out, int q31, uint32_t n, double scale)
+{
+    double signal = 0.0, noise = 0.0;
+
+    for (uint32_t i = 0; i < n + 2U; i++) {
+        double v = q31 ? ((const q31_t *) out)[i] : ((const q15_t *) out)[i];
+        double e = v * scale - exact[i];
+        signal += exact[i] * exact[i];
+        noise += e * e;
+    }
+
+    return 10.0 * log10(signal / noise);
+}
+
+/*
+ * The split steps of the CMSIS-DSP arm_rfft_q31(), reading the
+ * realCoefAQ31 and realCoefBQ31 tables.
+ */
+static void ref_split_rfft_q31(q31_t *pSrc, uint32_t fftLen, q31_t *pDst, uint32_t modifier)
+{
+    const q31_t *pCoefA = &ref_realCoefAQ31[modifier * 2U];
+    const q31_t *pCoefB = &ref_realCoefBQ31[modifier * 2U];
+    q31_t *pOut1 = &pDst[2], *pOut2 = &pDst[4U * fftLen - 1U];
+    q31_t *pIn1 = &pSrc[2], *pIn2 = &pSrc[2U * fftLen - 1U];
+    q31_t outR, outI, CoefA1, CoefA2, CoefB1;
+
+    for (uint32_t i = fftLen - 1U; i > 0U; i--) {
+        CoefA1 = *pCoefA++;
+        CoefA2 = *pCoefA;
+
+        mult_32x32_keep32_R(outR, *pIn1, CoefA1);
+        mult_32x32_keep32_R(outI, *pIn1++, CoefA2);
+        multSub_32x32_keep32_R(outR, *pIn1, CoefA2);
+        multAcc_32x32_keep32_R(outI, *pIn1++, CoefA1);
+        multSub_32x32_keep32_R(outR, *pIn2, CoefA2);
+        CoefB1 = *pCoefB;
+        multSub_32x32_keep32_R(outI, *pIn2--, CoefB1);
+        multAcc_32x32_keep32_R(outR, *pIn2, CoefB1);
+        multSub_32x32_keep32_R(outI, *pIn2--, CoefA2);
+
+        *pOut1++ = outR;
+        *pOut1++ = outI;
+        *pOut2-- = -outI;
+        *pOut2-- = outR;
+
+        pCoefB = pCoefB + (2U * modifier);
+        pCoefA = pCoefA + (2U * modifier - 1U);
+    }
+
+    pDst[2U * fftLen] = (pSrc[0] - pSrc[1]) >> 1U;
+    pDst[2U * fftLen + 1U] = 0;
+    pDst[0] = (pSrc[0] + pSrc[1]) >> 1U;
+    pDst[1] = 0;
+}
+
+static void ref_split_rifft_q31(q31_t *pSrc, uint32_t fftLen, q31_t *pDst, uint32_t modifier)
+{
+    const q31_t *pCoefA = &ref_realCoefAQ31[0];
+    const q31_t *pCoefB = &ref_realCoefBQ31[0];
+    q31_t *pIn1 = &pSrc[0], *pIn2 = &pSrc[2U * fftLen + 1U];
+    q31_t outR, outI, CoefA1, CoefA2, CoefB1;
+
+    for (uint32_t i = fftLen; i > 0U; i--) {
+        CoefA1 = *pCoefA++;
+        CoefA2 = *pCoefA;
+
+        mult_32x32_keep32_R(outR, *pIn1, CoefA1);
+        mult_32x32_keep32_R(outI, *pIn1++, -CoefA2);
+        multAcc_32x32_keep32_R(outR, *pIn1, CoefA2);
+        multAcc_32x32_keep32_R(outI, *pIn1++, CoefA1);
+        multAcc_32x32_keep32_R(outR, *pIn2, CoefA2);
+        CoefB1 = *pCoefB;
+        multSub_32x32_keep32_R(outI, *pIn2--, CoefB1);
+        multAcc_32x32_keep32_R(outR, *pIn2, CoefB1);
+        multAcc_32x32_keep32_R(outI, *pIn2--, CoefA2);
+
+        *pDst++ = outR;
+        *pDst++ = outI;
+
+        pCoefB = pCoefB + (modifier * 2U);
+        pCoefA = pCoefA + (modifier * 2U - 1U);
+    }
+}
+
+/*
+ * The CMSIS-DSP arm_rfft_q31() with its own tables: the CFFT reads
+ * twiddleCoef_4096_q31, which every smaller twiddleCoef_<n>_q31 is a
+ * stride of, the split step realCoefAQ31 and realCoefBQ31.
+ */
+static void ref_rfft_q31(uint32_t n, uint8_t ifftFlag, q31_t *pSrc, q31_t *pDst)
+{
+    const arm_cfft_instance_q31 cfft = { (uint16_t) (n / 2U), ref_twiddleCoef_4096_q31 };
+
+    if (ifftFlag) {
+        ref_split_rifft_q31(pSrc, n / 2U, pDst, 8192U / n);
+        arm_cfft_q31(&cfft, pDst, 1U, 1U);
+        for (uint32_t i = 0; i < n; i++) {
+            pDst[i] = pDst[i] << 1;
+        }
+    } else {
+        arm_cfft_q31(&cfft, pSrc, 0U, 1U);
+        ref_split_rfft_q31(pSrc, n / 2U, pDst, 8192U / n);
+    }
+}
+
+/**
+ * @brief The generated tables are the CMSIS-DSP ones
+ */
+static void test_tables(void)
+{
+    static const struct {
+        uint32_t n;
+        const q31_t *table;
+    } refs[] = {
+        { 16, ref_twiddleCoef_16_q31 },     { 32, ref_twiddleCoef_32_q31 },
+        { 64, ref_twiddleCoef_64_q31 },     { 128, ref_twiddleCoef_128_q31 },
+        { 256, ref_twiddleCoef_256_q31 },   { 512, ref_twiddleCoef_512_q31 },
+        { 1024, ref_twiddleCoef_1024_q31 }, { 2048, ref_twiddleCoef_2048_q31 },
+        { 4096, ref_twiddleCoef_4096_q31 },
+    };
+    char message[96];
+
+    TEST_SECTION("Q31 Tables");
+
+    for (size_t t = 0; t < sizeof(refs) / sizeof(refs[0]); t++) {
+        uint32_t stride = RFFT_Q31_TWIDDLE_STRIDE(refs[t].n);
+        uint32_t mismatches = 0U;
+
+        for (uint32_t k = 0; k < 3U * refs[t].n / 4U; k++) {
+            mismatches += RFFT_Q31_TWIDDLE_TABLE[2U * k * stride] != refs[t].table[2U * k];
+            mismatches += RFFT_Q31_TWIDDLE_TABLE[2U * k * stride + 1U] != refs[t].table[2U * k + 1U];
+        }
+
+        snprintf(message, sizeof(message), "twiddleCoef_%u_q31 is a stride of RFFT_Q31_TWIDDLE_TABLE",
+                 (unsigned) refs[t].n);
+        TEST_ASSERT(mismatches == 0U, message);
+    }
+
+    TEST_ASSERT(RFFT_Q31_SPLIT_TABLE[0] == 0 &&
+                RFFT_Q31_SPLIT_TABLE[RFFT_Q31_MAX_FFT_LEN / 4] == 0x7FFFFFFF,
+                "Split sine table runs from 0 to full scale");
+}
+
+/**
+ * @brief Every length is bit-exact with the CMSIS-DSP tables, both directions
+ */
+static void test_bit_exact(void)
+{
+    char message[96];
+
+    TEST_SECTION("Q31 RFFT - Bit-Exact With CMSIS-DSP");
+
+    for (uint32_t n = RFFT_Q31_MIN_FFT_LEN; n <= RFFT_Q31_MAX_FFT_LEN; n *= 2U) {
+        arm_rfft_instance_q31 S;
+        uint32_t seed = n;
+
+        TEST_ASSERT(rfft_q31_init(&S, n) == RFFT_SUCCESS, "rfft_q31_init succeeds");
+
+        for (uint32_t i = 0; i < n; i++) {
+            seed = seed * 1103515245U + 12345U;
+            input[i] = (q31_t) seed;
+        }
+
+        memcpy(work, input, n * sizeof(q31_t));
+        arm_rfft_q31(&S, work, output);
+        memcpy(work, input, n * sizeof(q31_t));
+        ref_rfft_q31(n, 0U, work, reference);
+
+        snprintf(message, sizeof(message), "%u-point RFFT matches", (unsigned) n);
+        TEST_ASSERT(memcmp(output, reference, 2U * n * sizeof(q31_t)) == 0, message);
+
+        /* Inverse of the spectrum just computed */
+        S.ifftFlagR = 1U;
+        memcpy(work, reference, (n + 2U) * sizeof(q31_t));
+        arm_rfft_q31(&S, work, output);
+        ref_rfft_q31(n, 1U, reference, work);
+
+        snprintf(message, sizeof(message), "%u-point RIFFT matches", (unsigned) n);
+        TEST_ASSERT(memcmp(output, work, n * sizeof(q31_t)) == 0, message);
+    }
+}
+
+/**
+ * @brief Low level inputs keep their resolution where Q15 loses them
+ */
+static void test_accuracy(void)
+{
+    static const double levels[] = { 1 << 16, 1 << 24, 1 << 29 };
+    const arm_rfft_instance_q31 *S = rfft_q31_get_instance(4096U);
+    const arm_rfft_instance_q15 *S15 = rfft_q15_get_instance(4096U);
+    q15_t *work15 = (q15_t *) work;
+    q15_t *output15 = (q15_t *) reference;
+    char message[96];
+
+    TEST_SECTION("Q31 RFFT - SNR against a double DFT");
+
+    for (size_t l = 0; l < sizeof(levels) / sizeof(levels[0]); l++) {
+        double q31, q15;
+
+        fill_signal(4096U, levels[l]);
+        reference_dft(4096U);
+
+        memcpy(work, input, 4096U * sizeof(q31_t));
+        arm_rfft_q31(S, work, output);
+        q31 = snr_db(output, 1, 4096U, 4096.0);
+
+        /* Same signal in Q15, with 16 bits less */
+        for (uint32_t i = 0; i < 4096U; i++) {
+            work15[i] = (q15_t) (input[i] >> 16);
+        }
+        arm_rfft_q15(S15, work15, output15);
+        q15 = snr_db(output15, 0, 4096U, 4096.0 * 65536.0);
+
+        printf("  level 2^%2.0f: Q31 %5.1f dB, Q15 %5.1f dB\n", log2(levels[l]), q31, q15);
+
+        snprintf(message, sizeof(message), "Level 2^%.0f: Q31 SNR >= 45 dB", log2(levels[l]));
+        TEST_ASSERT(q31 >= 45.0, message);
+        snprintf(message, sizeof(message), "Level 2^%.0f: at least 40 dB better than Q15",
+                 log2(levels[l]));
+        TEST_ASSERT(q31 >= q15 + 40.0, message);
+    }
+
+    /* Round trip: the inverse returns the input scaled by 1 / fftLenReal */
+    {
+        arm_rfft_instance_q31 inverse = *S;
+        double worst = 0.0;
+
+        fill_signal(4096U, 1 << 29);
+        memcpy(work, input, 4096U * sizeof(q31_t));
+        arm_rfft_q31(S, work, output);
+        inverse.ifftFlagR = 1U;
+        arm_rfft_q31(&inverse, output, reference);
+
+        for (uint32_t i = 0; i < 4096U; i++) {
+            worst = fmax(worst, fabs(reference[i] * 4096.0 - input[i]));
+        }
+        /* The inverse keeps 19 bits of the input, the output is off by tens of LSBs */
+        printf("  round trip: worst error %.0f output LSBs (input 2^29)\n", worst / 4096.0);
+        TEST_ASSERT(worst <= 128.0 * 4096.0, "RFFT then RIFFT returns the input within 128 output LSBs");
+    }
+}
+
+/* Collects the bins of arm_rfft_q31_mag_sq() */
+static void collect_bin(uint32_t bin, uint64_t mag_sq, void *user)
+{
+    uint64_t *bins = user;
+
+    bins[bin] = mag_sq;
+}
+
+/**
+ * @brief arm_rfft_q31_mag_sq() reports the bins of arm_rfft_q31()
+ */
+static void test_mag_sq(void)
+{
+    static uint64_t bins[MAX_FFT_LEN / 2 + 1];
+    char message[96];
+
+    TEST_SECTION("Q31 RFFT - Magnitude Squared");
+
+    for (uint32_t n = RFFT_Q31_MIN_FFT_LEN; n <= RFFT_Q31_MAX_FFT_LEN; n *= 4U) {
+        const arm_rfft_instance_q31 *S = rfft_q31_get_instance(n);
+        uint32_t mismatches = 0U;
+
+        fill_signal(n, 1 << 30);
+
+        memcpy(work, input, n * sizeof(q31_t));
+        arm_rfft_q31(S, work, output);
+        memcpy(work, input, n * sizeof(q31_t));
+        arm_rfft_q31_mag_sq(S, work, collect_bin, bins);
+
+        for (uint32_t k = 0; k <= n / 2U; k++) {
+            uint64_t expected = (uint64_t) ((q63_t) output[2U * k] * output[2U * k]) +
+                                (uint64_t) ((q63_t) output[2U * k + 1U] * output[2U * k + 1U]);
+            mismatches += bins[k] != expected;
+        }
+
+        snprintf(message, sizeof(message), "%u-point bins match arm_rfft_q31()", (unsigned) n);
+        TEST_ASSERT(mismatches == 0U, message);
+    }
+}
+
+/**
+ * @brief Instances of the built-in lengths only
+ */
+static void test_instances(void)
+{
+    arm_rfft_instance_q31 S;
+
+    TEST_SECTION("Q31 RFFT - Instances");
+
+    TEST_ASSERT(rfft_q31_get_instance(16U) == NULL, "No 16-point instance");
+    TEST_ASSERT(rfft_q31_get_instance(16384U) == NULL, "No 16384-point instance");
+    TEST_ASSERT(rfft_q31_get_instance(4096U) == &arm_rfft_sR_q31_len4096,
+                "4096-point instance is the prebuilt one");
+    TEST_ASSERT(rfft_q31_init(NULL, 4096U) == RFFT_ERROR_NULL_POINTER, "NULL instance rejected");
+    TEST_ASSERT(rfft_q31_init(&S, 1000U) == RFFT_ERROR_INVALID_SIZE, "1000 points rejected");
+}
+
+/**
+ * @brief Main test runner
+ */
+int main(void) {
+    printf("=== Q31 RFFT Tests ===\n");
+
+    test_tables();
+    test_bit_exact();
+    test_accuracy();
+    test_mag_sq();
+    test_instances();
+
+    /* Print summary */
+    printf("\n=== Test Summary ===\n");
+    printf("Passed: %d\n", tests_passed);
+    printf("Failed: %d\n", tests_failed);
+    printf("Total:  %d\n", tests_passed + tests_failed);
+
+    if (tests_failed == 0) {
+        printf("\n✓ All Q31 RFFT tests pass!\n");
+        return 0;
+    } else {
+        printf("\n✗ Some tests failed!\n");
+        return 1;
+    }
+}
@@ -0,0 +1,342 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library - Simplified Q15 RFFT
+ * Title:        test_spectral_cross.c
+ * Description:  Tests for the coherence of two channels against double precision
+ *
+ * Target Processor: nRF54L15 FLPR (PC validation)
+ * -------------------------------------------------------------------- */
+
+#include "../include/rfft_q15.h"
+#include "fft_utils.h"
+#include "spectral_cross.h"
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#if RFFT_Q15_MIN_FFT_LEN > 256 || RFFT_Q15_MAX_FFT_LEN < 4096
+#error "test_spectral_cross.c needs the lengths from 256 to 4096"
+#endif
+
+#define MAX_FFT_LEN  1024
+#define MAX_BINS     (MAX_FFT_LEN / 2 + 1)
+#define NUM_TOP_BINS 4
+
+static q15_t work[MAX_FFT_LEN] RFFT_Q15_ALIGN;
+static q15_t pair[2 * MAX_FFT_LEN] RFFT_Q15_ALIGN;
+static q15_t xy[2 * MAX_FFT_LEN];
+static spectral_peak_t peaks[NUM_TOP_BINS];
+static int32_t sxy[2 * MAX_BINS];
+static uint32_t sxx[SPECTRAL_PSD_STORAGE_LEN(MAX_BINS)];
+static uint32_t syy[SPECTRAL_PSD_STORAGE_LEN(MAX_BINS)];
+static q15_t coherence[MAX_BINS];
+
+/* Double precision averages of the same frames */
+static double ref_sxy[2 * MAX_BINS];
+static double ref_sxx[MAX_BINS];
+static double ref_syy[MAX_BINS];
+static double cos_table[MAX_FFT_LEN];
+
+/* Test result tracking */
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+/* Test assertion macro */
+#define TEST_ASSERT(condition, message) \
+    do { \
+        if (condition) { \
+            printf("  ✓ %s\n", message); \
+            tests_passed++; \
+        } else { \
+            printf("  ✗ %s\n", message); \
+            tests_failed++; \
+        } \
+    } while(0)
+
+/* Test section header */
+#define TEST_SECTION(name) \
+    printf("\n=== %s ===\n", name)
+
+static const double pi = 3.14159265358979323846;
+
+/* How both channels of a frame pair are made */
+typedef enum {
+    PAIR_IDENTICAL,   /* The same noise on both */
+    PAIR_INDEPENDENT, /* Noise of two generators */
+    PAIR_SHARED_TONE  /* One tone on both, independent noise on top */
+} pair_kind_t;
+
+static int32_t next_noise(uint32_t *seed)
+{
+    *seed ^= *seed << 13;
+    *seed ^= *seed >> 17;
+    *seed ^= *seed << 5;
+    return (int32_t) (*seed >> 19) - 4096;
+}
+
+/* Interleave frame f of both channels into xy, x0 y0 x1 y1 ... */
+static void fill_pair(pair_kind_t kind, uint32_t n, uint32_t f, uint32_t *seed_x, uint32_t *seed_y)
+{
+    for (uint32_t i = 0; i < n; i++) {
+        int32_t x = next_noise(seed_x);
+        int32_t y = (kind == PAIR_IDENTICAL) ? x : next_noise(seed_y);
+
+        if (kind == PAIR_SHARED_TONE) {
+            double t = 10000.0 * sin(2.0 * pi * (37.0 * (f * n + i) / n + 0.3));
+            x = (int32_t) lrint(t) + x / 4;
+            y = (int32_t) lrint(t) + y / 4;
+        }
+        xy[2U * i] = (q15_t) x;
+        xy[2U * i + 1U] = (q15_t) y;
+    }
+}
+
+/* Add the DFT of both channels of xy to the double precision averages */
+static void reference_push(uint32_t n)
+{
+    for (uint32_t k = 0; k <= n / 2U; k++) {
+        double xr = 0.0, xi = 0.0, yr = 0.0, yi = 0.0;
+
+        for (uint32_t i = 0; i < n; i++) {
+            uint32_t p = (uint32_t) (((uint64_t) k * i) % n);
+            double c = cos_table[p];
+            double s = -cos_table[(p + 3U * n / 4U) % n];
+
+            xr += xy[2U * i] * c;
+            xi -= xy[2U * i] * s;
+            yr += xy[2U * i + 1U] * c;
+            yi -= xy[2U * i + 1U] * s;
+        }
+        ref_sxx[k] += xr * xr + xi * xi;
+        ref_syy[k] += yr * yr + yi * yi;
+        ref_sxy[2U * k] += xr * yr + xi * yi;
+        ref_sxy[2U * k + 1U] += xi * yr - xr * yi;
+    }
+}
+
+static double reference_coherence(uint32_t k)
+{
+    double den = ref_sxx[k] * ref_syy[k];
+
+    return (den > 0.0) ? (ref_sxy[2U * k] * ref_sxy[2U * k] +
+                          ref_sxy[2U * k + 1U] * ref_sxy[2U * k + 1U]) / den : 0.0;
+}
+
+/*
+ * Average 2^shift frame pairs of kind through fft_context_top_bins_interleaved()
+ * with a pair buffer and a cross spectrum, as the remote core does, and
+ * the same frames in double precision.
+ */
+static void run_average(pair_kind_t kind, uint32_t n, uint8_t shift, uint32_t *frames)
+{
+    fft_context_t ctx;
+    spectral_cross_t cross;
+    uint16_t bins[2 * NUM_TOP_BINS];
+    uint32_t seed_x = 2463534242U, seed_y = 88675123U;
+
+    for (uint32_t i = 0; i < n; i++) {
+        cos_table[i] = cos(2.0 * pi * i / n);
+    }
+    memset(ref_sxy, 0, sizeof(ref_sxy));
+    memset(ref_sxx, 0, sizeof(ref_sxx));
+    memset(ref_syy, 0, sizeof(ref_syy));
+
+    fft_context_init(&ctx, (uint16_t) n, work, peaks, NUM_TOP_BINS);
+    fft_context_set_pair_buffer(&ctx, pair);
+    spectral_cross_init(&cross, sxy, sxx, syy, (uint16_t) (n / 2U + 1U),
+                        SPECTRAL_PSD_LINEAR, shift);
+    fft_context_set_cross(&ctx, &cross);
+
+    *frames = 0;
+    while (!spectral_psd_complete(&cross.x)) {
+        fill_pair(kind, n, *frames, &seed_x, &seed_y);
+        fft_context_top_bins_interleaved(&ctx, xy, 2, bins, NUM_TOP_BINS);
+        reference_push(n);
+        (*frames)++;
+    }
+
+    spectral_cross_coherence(&cross, coherence);
+}
+
+/**
+ * @brief Identical channels are fully coherent in every bin
+ *
+ * X * conj(X) is |X|², but both channels are separated from their
+ * shared CFFT with a rounding of their own, so the weakest bins read
+ * 0.994 at 1024 points and 0.999 at 256; at least 0.99 is asserted.
+ */
+static void test_identical(void)
+{
+    static const uint16_t sizes[] = { 256, 1024 };
+    char message[128];
+
+    TEST_SECTION("spectral_cross - Identical channels");
+
+    for (uint32_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+        uint32_t n = sizes[s], frames, lowest = 32767U;
+
+        run_average(PAIR_IDENTICAL, n, 4U, &frames);
+        for (uint32_t k = 0; k <= n / 2U; k++) {
+            lowest = ((uint32_t) coherence[k] < lowest) ? (uint32_t) coherence[k] : lowest;
+        }
+
+        snprintf(message, sizeof(message), "%4u points, %u frames: lowest coherence %.4f",
+                 n, frames, lowest / 32768.0);
+        TEST_ASSERT(frames == 16U && lowest >= 32440U, message);
+    }
+}
+
+/**
+ * @brief Independent noise averages to a coherence near 0
+ *
+ * The coherence of two independent channels over F frames has a mean of
+ * 1/F; 64 frames of 256 and 1024 points give a mean of 0.017
+ * over all bins, below 0.03 is asserted. Every bin is within 0.01 of
+ * the double precision coherence of the same frames (0.005 measured).
+ */
+static void test_independent(void)
+{
+    static const uint16_t sizes[] = { 256, 1024 };
+    char message[128];
+
+    TEST_SECTION("spectral_cross - Independent channels");
+
+    for (uint32_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+        uint32_t n = sizes[s], frames;
+        double mean = 0.0, worst = 0.0;
+
+        run_average(PAIR_INDEPENDENT, n, 6U, &frames);
+        for (uint32_t k = 0; k <= n / 2U; k++) {
+            double e = fabs(coherence[k] / 32768.0 - reference_coherence(k));
+
+            mean += coherence[k] / 32768.0;
+            worst = (e > worst) ? e : worst;
+        }
+        mean /= n / 2U + 1U;
+
+        snprintf(message, sizeof(message), "%4u points, %u frames: mean coherence %.4f "
+                 "(1/frames %.4f)", n, frames, mean, 1.0 / frames);
+        TEST_ASSERT(frames == 64U && mean < 0.03, message);
+        snprintf(message, sizeof(message), "%4u points: within 0.01 of double precision "
+                 "(max %.4f)", n, worst);
+        TEST_ASSERT(worst <= 0.01, message);
+    }
+}
+
+/**
+ * @brief A tone common to both channels stands out of independent noise
+ *
+ * Bin 37 carries the same tone on both channels, 32 dB above the noise
+ * of each bin. Its coherence is 0.99 or more; the other bins keep the
+ * mean of independent noise, below 0.03.
+ */
+static void test_shared_tone(void)
+{
+    uint32_t frames;
+    double rest = 0.0;
+    char message[128];
+
+    TEST_SECTION("spectral_cross - Tone shared by both channels");
+
+    run_average(PAIR_SHARED_TONE, 1024U, 6U, &frames);
+    for (uint32_t k = 0; k <= 512U; k++) {
+        rest += (k == 37U) ? 0.0 : coherence[k] / 32768.0;
+    }
+    rest /= 512U;
+
+    snprintf(message, sizeof(message), "Tone bin coherence %.4f (double %.4f)",
+             coherence[37] / 32768.0, reference_coherence(37U));
+    TEST_ASSERT(coherence[37] >= 32440, message);
+    snprintf(message, sizeof(message), "Other bins mean %.4f", rest);
+    TEST_ASSERT(rest < 0.03, message);
+}
+
+/**
+ * @brief Bins without power, completion and reset
+ */
+static void test_empty_and_reset(void)
+{
+    spectral_cross_t cross;
+    q31_t x = (q31_t) (uint16_t) 100 | (q31_t) ((uint32_t) (uint16_t) -50 << 16);
+    uint32_t zero = 1;
+
+    TEST_SECTION("spectral_cross - Empty bins and reset");
+
+    spectral_cross_init(&cross, sxy, sxx, syy, 4U, SPECTRAL_PSD_LINEAR, 1U);
+    for (uint32_t f = 0; f < 2U; f++) {
+        TEST_ASSERT(spectral_cross_accepts(&cross), "Frame pair accepted before 2^shift");
+        spectral_cross_push(&cross, 0U, x, x);
+        spectral_cross_push(&cross, 1U, x, 0);
+        spectral_cross_push(&cross, 2U, 0, x);
+        spectral_cross_push(&cross, 3U, 0, 0);
+        spectral_cross_end_frame(&cross);
+    }
+    TEST_ASSERT(!spectral_cross_accepts(&cross), "Full linear average accepts no more pairs");
+
+    spectral_cross_coherence(&cross, coherence);
+    TEST_ASSERT(coherence[0] == 0x7FFF, "Equal bins are fully coherent");
+    TEST_ASSERT(coherence[1] == 0 && coherence[2] == 0 && coherence[3] == 0,
+                "Bins where a channel has no power read 0");
+
+    spectral_cross_reset(&cross);
+    for (uint32_t k = 0; k < 4U; k++) {
+        zero &= sxx[k] == 0U && syy[k] == 0U && sxy[2U * k] == 0 && sxy[2U * k + 1U] == 0;
+    }
+    TEST_ASSERT(zero && spectral_cross_accepts(&cross), "Reset clears the averages");
+}
+
+/**
+ * @brief Argument checks
+ */
+static void test_errors(void)
+{
+    spectral_cross_t cross;
+    fft_context_t ctx;
+
+    TEST_SECTION("spectral_cross - Errors");
+
+    TEST_ASSERT(spectral_cross_init(NULL, sxy, sxx, syy, 129U, SPECTRAL_PSD_LINEAR, 4U) ==
+                RFFT_ERROR_NULL_POINTER, "NULL average rejected");
+    TEST_ASSERT(spectral_cross_init(&cross, NULL, sxx, syy, 129U, SPECTRAL_PSD_LINEAR, 4U) ==
+                RFFT_ERROR_NULL_POINTER, "NULL cross accumulator rejected");
+    TEST_ASSERT(spectral_cross_init(&cross, sxy, sxx, NULL, 129U, SPECTRAL_PSD_LINEAR, 4U) ==
+                RFFT_ERROR_NULL_POINTER, "NULL channel accumulator rejected");
+
+    spectral_cross_init(&cross, sxy, sxx, syy, 129U, SPECTRAL_PSD_LINEAR, 4U);
+    fft_context_init(&ctx, 256U, work, peaks, NUM_TOP_BINS);
+    TEST_ASSERT(fft_context_set_cross(&ctx, &cross) == RFFT_ERROR_NULL_POINTER,
+                "Cross spectrum without a pair buffer rejected");
+    fft_context_set_pair_buffer(&ctx, pair);
+    TEST_ASSERT(fft_context_set_cross(&ctx, &cross) == RFFT_SUCCESS,
+                "Cross spectrum with a pair buffer accepted");
+    fft_context_init(&ctx, 512U, work, peaks, NUM_TOP_BINS);
+    fft_context_set_pair_buffer(&ctx, pair);
+    TEST_ASSERT(fft_context_set_cross(&ctx, &cross) == RFFT_ERROR_INVALID_SIZE,
+                "Cross spectrum of another length rejected");
+}
+
+/**
+ * @brief Main test runner
+ */
+int main(void) {
+    printf("=== Cross Spectrum Tests ===\n");
+
+    test_identical();
+    test_independent();
+    test_shared_tone();
+    test_empty_and_reset();
+    test_errors();
+
+    /* Print summary */
+    printf("\n=== Test Summary ===\n");
+    printf("Passed: %d\n", tests_passed);
+    printf("Failed: %d\n", tests_failed);
+    printf("Total:  %d\n", tests_passed + tests_failed);
+
+    if (tests_failed == 0) {
+        printf("\n✓ The coherence matches double precision!\n");
+        return 0;
+    } else {
+        printf("\n✗ Some tests failed!\n");
+        return 1;
+    }
+}
@@ -0,0 +1,367 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library - Simplified Q15 RFFT
+ * Title:        test_spectral_dft.c
+ * Description:  Tests for the bin-set and sliding DFT against arm_rfft_q15_mag_sq()
+ *
+ * Target Processor: nRF54L15 FLPR (PC validation)
+ * -------------------------------------------------------------------- */
+
+#include "../include/rfft_q15.h"
+#include "spectral_dft.h"
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#if RFFT_Q15_MIN_FFT_LEN > 256 || RFFT_Q15_MAX_FFT_LEN < 4096
+#error "test_spectral_dft.c needs the lengths from 256 to 4096"
+#endif
+
+#define MAX_FFT_LEN   4096
+#define MAX_BINS      6
+#define STREAM_LEN    (4 * MAX_FFT_LEN)
+#define LONG_RUN      (1UL << 23)
+
+static q15_t input[STREAM_LEN];
+static q15_t frame[MAX_FFT_LEN] RFFT_Q15_ALIGN;
+static q15_t ring[MAX_FFT_LEN];
+static int64_t acc[2 * MAX_BINS];
+static uint32_t rfft_mag[MAX_FFT_LEN / 2 + 1];
+static uint32_t dft_mag[MAX_BINS];
+static uint32_t num_dft_mag;
+
+/* Test result tracking */
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+/* Test assertion macro */
+#define TEST_ASSERT(condition, message) \
+    do { \
+        if (condition) { \
+            printf("  ✓ %s\n", message); \
+            tests_passed++; \
+        } else { \
+            printf("  ✗ %s\n", message); \
+            tests_failed++; \
+        } \
+    } while(0)
+
+/* Test section header */
+#define TEST_SECTION(name) \
+    printf("\n=== %s ===\n", name)
+
+static const double pi = 3.14159265358979323846;
+
+static void store_rfft(uint32_t bin, uint32_t mag_sq, void *user)
+{
+    (void) user;
+    rfft_mag[bin] = mag_sq;
+}
+
+static void store_dft(uint32_t bin, uint32_t mag_sq, void *user)
+{
+    (void) bin;
+    (void) user;
+    dft_mag[num_dft_mag++] = mag_sq;
+}
+
+/* Tones on some of the watched bins and between them, and pseudo-random noise */
+static void fill_input(q15_t *x, uint32_t count, uint32_t n, uint32_t seed, double level)
+{
+    for (uint32_t i = 0; i < count; i++) {
+        seed ^= seed << 13;
+        seed ^= seed >> 17;
+        seed ^= seed << 5;
+        x[i] = (q15_t) lrint(level * (0.4 * sin(2.0 * pi * (n / 8U) * i / n) +
+                                      0.3 * cos(2.0 * pi * (n / 5.0 + 0.4) * i / n) +
+                                      0.15 * sin(2.0 * pi * 3.0 * i / n + 1.0) +
+                                      0.15 * (((seed >> 8) * (1.0 / 8388608.0)) - 1.0)));
+    }
+}
+
+/* Magnitude of bin k of x, the DFT scaled by 1/n like arm_rfft_q15() */
+static double exact_mag(const q15_t *x, uint32_t n, uint32_t k)
+{
+    double re = 0.0, im = 0.0;
+
+    for (uint32_t i = 0; i < n; i++) {
+        double phase = 2.0 * pi * (double) ((k * i) % n) / n;
+        re += x[i] * cos(phase);
+        im -= x[i] * sin(phase);
+    }
+
+    return sqrt(re * re + im * im) / n;
+}
+
+/* The sums of the sliding DFT recomputed from scratch, magnitude² as it reports them */
+static uint32_t sliding_mag_sq(uint32_t n, uint32_t k, uint32_t newest)
+{
+    const uint32_t mask = RFFT_TWIDDLE_TABLE_LEN - 1U;
+    const uint32_t step = k * RFFT_TWIDDLE_STRIDE(n);
+    const uint32_t shift = 15U + (uint32_t) __builtin_ctz(n);
+    int64_t re = 0, im = 0;
+    int64_t parts[2];
+
+    /* Sample i of the stream at phase k i, the history before it zeros */
+    for (uint32_t j = 0; j < n && j <= newest; j++) {
+        uint32_t i = newest - j;
+        uint32_t m = (uint32_t) (((uint64_t) step * (i % n)) & mask);
+        int32_t c, s;
+
+        if (m <= RFFT_TWIDDLE_TABLE_LEN / 2U) {
+            c = RFFT_TWIDDLE_COS(RFFT_TWIDDLE_TABLE, m);
+            s = RFFT_TWIDDLE_SIN(RFFT_TWIDDLE_TABLE, m);
+        } else {
+            c = RFFT_TWIDDLE_COS(RFFT_TWIDDLE_TABLE, RFFT_TWIDDLE_TABLE_LEN - m);
+            s = -RFFT_TWIDDLE_SIN(RFFT_TWIDDLE_TABLE, RFFT_TWIDDLE_TABLE_LEN - m);
+        }
+        re += (int64_t) input[i % STREAM_LEN] * c;
+        im -= (int64_t) input[i % STREAM_LEN] * s;
+    }
+
+    parts[0] = (re + ((int64_t) 1 << (shift - 1U))) >> shift;
+    parts[1] = (im + ((int64_t) 1 << (shift - 1U))) >> shift;
+    for (uint32_t p = 0; p < 2U; p++) {
+        parts[p] = (parts[p] > 32767) ? 32767 : ((parts[p] < -32768) ? -32768 : parts[p]);
+    }
+
+    return (uint32_t) (parts[0] * parts[0] + parts[1] * parts[1]);
+}
+
+/* Bins watched at a length: DC, tones, between them and Nyquist */
+static uint32_t bins_of(uint32_t n, uint16_t *bins)
+{
+    bins[0] = 0U;
+    bins[1] = 3U;
+    bins[2] = (uint16_t) (n / 8U);
+    bins[3] = (uint16_t) (n / 5U);
+    bins[4] = (uint16_t) (n / 5U + 1U);
+    bins[5] = (uint16_t) (n / 2U);
+
+    return MAX_BINS;
+}
+
+/**
+ * @brief Bins of spectral_dft_mag_sq() against arm_rfft_q15_mag_sq() and double precision
+ *
+ * With the same frame, the magnitude of each bin within 1 LSB of the
+ * double precision DFT scaled by 1/fft_size, and within 1 LSB plus the
+ * error of arm_rfft_q15_mag_sq() of that bin: the direct sum only rounds
+ * once, the RFFT rounds at every stage.
+ */
+static void test_dft(void)
+{
+    static const double levels[] = { 30000.0, 300.0 };
+    char message[144];
+
+    TEST_SECTION("spectral_dft - Bins against arm_rfft_q15_mag_sq()");
+
+    for (uint32_t n = 256; n <= MAX_FFT_LEN; n *= 2U) {
+        for (uint32_t l = 0; l < sizeof(levels) / sizeof(levels[0]); l++) {
+            const arm_rfft_instance_q15 *S = rfft_q15_get_instance(n);
+            uint16_t bins[MAX_BINS];
+            uint32_t num_bins = bins_of(n, bins);
+            double worst_dft = 0.0, worst_rfft = 0.0, worst_pair = 0.0;
+            spectral_dft_t dft;
+
+            fill_input(input, n, n, n + l, levels[l]);
+            spectral_dft_init(&dft, (uint16_t) n, bins, (uint16_t) num_bins);
+            num_dft_mag = 0;
+            spectral_dft_mag_sq(&dft, input, store_dft, NULL);
+
+            memcpy(frame, input, n * sizeof(q15_t));
+            arm_rfft_q15_mag_sq(S, frame, store_rfft, NULL);
+
+            for (uint32_t b = 0; b < num_bins; b++) {
+                double exact = exact_mag(input, n, bins[b]);
+                double e_dft = fabs(sqrt((double) dft_mag[b]) - exact);
+                double e_rfft = fabs(sqrt((double) rfft_mag[bins[b]]) - exact);
+                double e_pair = fabs(sqrt((double) dft_mag[b]) - sqrt((double) rfft_mag[bins[b]]));
+
+                worst_dft = (e_dft > worst_dft) ? e_dft : worst_dft;
+                worst_rfft = (e_rfft > worst_rfft) ? e_rfft : worst_rfft;
+                worst_pair = (e_pair - e_rfft > worst_pair) ? e_pair - e_rfft : worst_pair;
+            }
+
+            snprintf(message, sizeof(message), "%4u points, peak %5.0f: %u bins within %.2f LSB "
+                     "of double, RFFT within %.2f, apart by 1 LSB + its error", n, levels[l],
+                     num_dft_mag, worst_dft, worst_rfft);
+            TEST_ASSERT(num_dft_mag == num_bins && worst_dft <= 1.0 && worst_pair <= 1.0,
+                        message);
+        }
+    }
+}
+
+/**
+ * @brief The sliding sums after every piece of a stream
+ *
+ * Pushed in pieces of 1 to 1500 samples, after each the magnitudes²
+ * equal, bit for bit, the sums recomputed from scratch over the last
+ * fft_size samples, zeros before the first; and once the frame is full,
+ * each magnitude is within 1 LSB of double precision and of
+ * arm_rfft_q15_mag_sq() of that frame within 1 LSB plus its error.
+ */
+static void test_sliding(void)
+{
+    static const uint32_t pieces[] = { 1, 1500, 37, 256, 2, 999 };
+    char message[144];
+
+    TEST_SECTION("spectral_dft - Sliding DFT against recomputed frames");
+
+    for (uint32_t n = 256; n <= MAX_FFT_LEN; n *= 4U) {
+        const arm_rfft_instance_q15 *S = rfft_q15_get_instance(n);
+        uint16_t bins[MAX_BINS];
+        uint32_t num_bins = bins_of(n, bins);
+        uint32_t checks = 0, bad_exact = 0, p = 0;
+        double worst_dft = 0.0, worst_pair = 0.0;
+        spectral_sdft_t sdft;
+
+        fill_input(input, STREAM_LEN, n, 88172645U + n, 30000.0);
+        spectral_sdft_init(&sdft, ring, acc, (uint16_t) n, bins, (uint16_t) num_bins);
+
+        for (uint32_t pos = 0; pos < STREAM_LEN; checks++) {
+            uint32_t piece = pieces[p++ % (sizeof(pieces) / sizeof(pieces[0]))];
+
+            if (piece > STREAM_LEN - pos) {
+                piece = STREAM_LEN - pos;
+            }
+            spectral_sdft_push(&sdft, &input[pos], piece);
+            pos += piece;
+
+            num_dft_mag = 0;
+            spectral_sdft_mag_sq(&sdft, store_dft, NULL);
+            for (uint32_t b = 0; b < num_bins; b++) {
+                bad_exact += dft_mag[b] != sliding_mag_sq(n, bins[b], pos - 1U);
+            }
+
+            if (pos < n) {
+                continue;
+            }
+            memcpy(frame, &input[pos - n], n * sizeof(q15_t));
+            arm_rfft_q15_mag_sq(S, frame, store_rfft, NULL);
+            for (uint32_t b = 0; b < num_bins; b++) {
+                double exact = exact_mag(&input[pos - n], n, bins[b]);
+                double e_dft = fabs(sqrt((double) dft_mag[b]) - exact);
+                double e_rfft = fabs(sqrt((double) rfft_mag[bins[b]]) - exact);
+                double e_pair = fabs(sqrt((double) dft_mag[b]) - sqrt((double) rfft_mag[bins[b]]));
+
+                worst_dft = (e_dft > worst_dft) ? e_dft : worst_dft;
+                worst_pair = (e_pair - e_rfft > worst_pair) ? e_pair - e_rfft : worst_pair;
+            }
+        }
+
+        snprintf(message, sizeof(message), "%4u points: %u pieces, %u bins differ from the "
+                 "recomputed sums, within %.2f LSB of double", n, checks, bad_exact, worst_dft);
+        TEST_ASSERT(bad_exact == 0U && worst_dft <= 1.0 && worst_pair <= 1.0, message);
+    }
+}
+
+/**
+ * @brief No drift over a long run
+ *
+ * After 2^23 full-scale samples, nine minutes of a 16 kHz stream, the
+ * bins still equal, bit for bit, the sums recomputed over the last frame.
+ */
+static void test_long_run(void)
+{
+    char message[128];
+
+    TEST_SECTION("spectral_dft - Long run");
+
+    for (uint32_t n = 256; n <= MAX_FFT_LEN; n *= 16U) {
+        uint16_t bins[MAX_BINS];
+        uint32_t num_bins = bins_of(n, bins);
+        uint32_t bad = 0;
+        uint32_t seed = 2463534242U;
+        spectral_sdft_t sdft;
+
+        /* Full-scale noise, the largest differences the sums can see */
+        for (uint32_t i = 0; i < STREAM_LEN; i++) {
+            seed ^= seed << 13;
+            seed ^= seed >> 17;
+            seed ^= seed << 5;
+            input[i] = (q15_t) (seed >> 16);
+        }
+
+        spectral_sdft_init(&sdft, ring, acc, (uint16_t) n, bins, (uint16_t) num_bins);
+        for (uint32_t pos = 0; pos < LONG_RUN; pos += STREAM_LEN) {
+            spectral_sdft_push(&sdft, input, STREAM_LEN);
+        }
+
+        num_dft_mag = 0;
+        spectral_sdft_mag_sq(&sdft, store_dft, NULL);
+        for (uint32_t b = 0; b < num_bins; b++) {
+            bad += dft_mag[b] != sliding_mag_sq(n, bins[b], LONG_RUN - 1U);
+        }
+
+        snprintf(message, sizeof(message), "%4u points after %lu samples: %u of %u bins drifted",
+                 n, (unsigned long) LONG_RUN, bad, num_bins);
+        TEST_ASSERT(bad == 0U, message);
+    }
+}
+
+/**
+ * @brief Top bins, reset and argument checks
+ */
+static void test_top_bins_and_errors(void)
+{
+    uint16_t bins[MAX_BINS];
+    uint32_t num_bins = bins_of(1024U, bins);
+    uint16_t top[3];
+    spectral_peak_t storage[3];
+    spectral_sdft_t sdft;
+    spectral_dft_t dft;
+    static const uint16_t unordered[] = { 5, 3 };
+    static const uint16_t beyond[] = { 513 };
+
+    TEST_SECTION("spectral_dft - Top bins, reset and errors");
+
+    fill_input(input, 1024U, 1024U, 7U, 30000.0);
+    spectral_sdft_init(&sdft, ring, acc, 1024U, bins, (uint16_t) num_bins);
+    spectral_sdft_push(&sdft, input, 1024U);
+    TEST_ASSERT(spectral_sdft_top_bins(&sdft, storage, top, 3U) == RFFT_SUCCESS &&
+                top[0] == 128U && top[1] == 205U && top[2] == 3U,
+                "Top bins: the tones of bins 128, 204.8 and 3 by level, DC skipped");
+
+    spectral_sdft_reset(&sdft);
+    num_dft_mag = 0;
+    spectral_sdft_mag_sq(&sdft, store_dft, NULL);
+    TEST_ASSERT(dft_mag[0] == 0U && dft_mag[2] == 0U && dft_mag[5] == 0U,
+                "A reset clears the sums");
+
+    TEST_ASSERT(spectral_dft_init(NULL, 1024U, bins, 1U) == RFFT_ERROR_NULL_POINTER,
+                "NULL bin set rejected");
+    TEST_ASSERT(spectral_dft_init(&dft, 1000U, bins, 1U) == RFFT_ERROR_INVALID_SIZE,
+                "Length without an RFFT rejected");
+    TEST_ASSERT(spectral_dft_init(&dft, 1024U, unordered, 2U) == RFFT_ERROR_INVALID_SIZE,
+                "Bins out of order rejected");
+    TEST_ASSERT(spectral_dft_init(&dft, 1024U, beyond, 1U) == RFFT_ERROR_INVALID_SIZE,
+                "Bin above fft_size / 2 rejected");
+    TEST_ASSERT(spectral_sdft_top_bins(&sdft, storage, top, (uint16_t) (num_bins + 1U)) ==
+                RFFT_ERROR_INVALID_SIZE, "More top bins than tracked rejected");
+}
+
+/**
+ * @brief Main test runner
+ */
+int main(void) {
+    printf("=== Bin-Set and Sliding DFT Tests ===\n");
+
+    test_dft();
+    test_sliding();
+    test_long_run();
+    test_top_bins_and_errors();
+
+    /* Print summary */
+    printf("\n=== Test Summary ===\n");
+    printf("Passed: %d\n", tests_passed);
+    printf("Failed: %d\n", tests_failed);
+    printf("Total:  %d\n", tests_passed + tests_failed);
+
+    if (tests_failed == 0) {
+        printf("\n✓ The bin-set and sliding DFT match the RFFT!\n");
+        return 0;
+    } else {
+        printf("\n✗ Some tests failed!\n");
+        return 1;
+    }
+}
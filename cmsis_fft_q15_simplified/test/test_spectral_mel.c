@@ -0,0 +1,384 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library - Simplified Q15 RFFT
+ * Title:        test_spectral_mel.c
+ * Description:  Tests for the mel filterbank and MFCC against double precision
+ *
+ * Target Processor: nRF54L15 FLPR (PC validation)
+ * -------------------------------------------------------------------- */
+
+#include "../include/rfft_q15.h"
+#include "spectral_mel.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#if RFFT_Q15_MIN_FFT_LEN > 256 || RFFT_Q15_MAX_FFT_LEN < 4096
+#error "test_spectral_mel.c needs the lengths from 256 to 4096"
+#endif
+
+#define MAX_FFT_LEN  4096
+#define MAX_FILTERS  64
+#define MAX_BINS     (MAX_FFT_LEN / 2 + 1)
+
+static uint64_t energy[MAX_FILTERS];
+static q15_t weight[SPECTRAL_MEL_WEIGHTS(MAX_FFT_LEN)];
+static uint16_t edge[SPECTRAL_MEL_EDGES(MAX_FILTERS)];
+static q15_t dct[MAX_FILTERS * MAX_FILTERS];
+static uint32_t mag_sq[MAX_BINS];
+static double centre[MAX_FILTERS + 2];
+static double exact[MAX_FILTERS];
+
+/* Test result tracking */
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+/* Test assertion macro */
+#define TEST_ASSERT(condition, message) \
+    do { \
+        if (condition) { \
+            printf("  ✓ %s\n", message); \
+            tests_passed++; \
+        } else { \
+            printf("  ✗ %s\n", message); \
+            tests_failed++; \
+        } \
+    } while(0)
+
+/* Test section header */
+#define TEST_SECTION(name) \
+    printf("\n=== %s ===\n", name)
+
+static const double pi = 3.14159265358979323846;
+
+/* Layouts covered, mel and log spaced */
+static const spectral_mel_config_t configs[] = {
+    { 256, 20, 8000, 0, 0, SPECTRAL_MEL_SCALE_MEL },
+    { 512, 26, 16000, 20, 0, SPECTRAL_MEL_SCALE_MEL },
+    { 1024, 40, 16000, 20, 7600, SPECTRAL_MEL_SCALE_MEL },
+    { 4096, 64, 48000, 30, 20000, SPECTRAL_MEL_SCALE_MEL },
+    { 1024, 24, 16000, 50, 8000, SPECTRAL_MEL_SCALE_LOG },
+    { 2048, 32, 32000, 100, 12000, SPECTRAL_MEL_SCALE_LOG },
+};
+
+#define NUM_CONFIGS  (sizeof(configs) / sizeof(configs[0]))
+
+/* Position of f Hz on the scale of config */
+static double warp(const spectral_mel_config_t *config, double hz)
+{
+    return (config->scale == SPECTRAL_MEL_SCALE_MEL) ? 2595.0 * log10(1.0 + hz / 700.0) :
+                                                       log(hz);
+}
+
+/* Double precision centres 0 to num_filters + 1 of config */
+static void reference_centres(const spectral_mel_config_t *config)
+{
+    double high_hz = (config->high_hz != 0U) ? config->high_hz : config->sample_rate / 2.0;
+    double low = warp(config, config->low_hz);
+    double high = warp(config, high_hz);
+
+    for (uint32_t j = 0; j <= config->num_filters + 1U; j++) {
+        centre[j] = low + j * (high - low) / (config->num_filters + 1U);
+    }
+}
+
+/* Weight of bin in filter i, a triangle from centre i over i + 1 to i + 2 */
+static double reference_weight(const spectral_mel_config_t *config, uint32_t bin, uint32_t i)
+{
+    double w;
+
+    if (bin == 0U && config->scale == SPECTRAL_MEL_SCALE_LOG) {
+        return 0.0;
+    }
+    w = warp(config, (double) bin * config->sample_rate / config->fft_size);
+    if (w < centre[i] || w >= centre[i + 2U]) {
+        return 0.0;
+    }
+
+    return (w < centre[i + 1U]) ? (w - centre[i]) / (centre[i + 1U] - centre[i]) :
+                                  (centre[i + 2U] - w) / (centre[i + 2U] - centre[i + 1U]);
+}
+
+/* Pseudo-random magnitudes² up to 2^24, spectra of any shape */
+static void fill_mag_sq(uint32_t num_bins, uint32_t seed)
+{
+    for (uint32_t b = 0; b < num_bins; b++) {
+        seed ^= seed << 13;
+        seed ^= seed >> 17;
+        seed ^= seed << 5;
+        mag_sq[b] = seed >> 8;
+    }
+}
+
+/* Push the bins and the double precision energies of the filters */
+static void run_frame(spectral_mel_t *mel, const spectral_mel_config_t *config)
+{
+    uint32_t num_bins = config->fft_size / 2U + 1U;
+
+    spectral_mel_begin_frame(mel);
+    for (uint32_t b = 0; b < num_bins; b++) {
+        spectral_mel_push(mel, b, mag_sq[b]);
+    }
+
+    for (uint32_t i = 0; i < config->num_filters; i++) {
+        exact[i] = 0.0;
+        for (uint32_t b = 0; b < num_bins; b++) {
+            exact[i] += mag_sq[b] * reference_weight(config, b, i);
+        }
+    }
+}
+
+/**
+ * @brief Edges and weights against double precision centres
+ *
+ * Each edge is the first bin at or past its centre, except where a bin
+ * lies within 1e-6 of the range from it; each weight within 2 LSB of
+ * the rising share in double precision.
+ */
+static void test_layout(void)
+{
+    char message[128];
+
+    TEST_SECTION("spectral_mel - Layout against double precision centres");
+
+    for (uint32_t c = 0; c < NUM_CONFIGS; c++) {
+        const spectral_mel_config_t *config = &configs[c];
+        uint32_t num_bins = config->fft_size / 2U + 1U;
+        uint32_t first = (config->scale == SPECTRAL_MEL_SCALE_LOG) ? 1U : 0U;
+        uint32_t bad_edges = 0;
+        double worst = 0.0;
+        spectral_mel_t mel;
+        rfft_status_t status;
+
+        status = spectral_mel_init(&mel, config, energy, weight, edge);
+        reference_centres(config);
+
+        for (uint32_t j = 0; j <= config->num_filters + 1U; j++) {
+            uint32_t expected = first;
+            double slack = 1e-6 * (centre[config->num_filters + 1U] - centre[0]);
+
+            while (expected < num_bins &&
+                   warp(config, (double) expected * config->sample_rate / config->fft_size) <
+                   centre[j]) {
+                expected++;
+            }
+            if (edge[j] != expected &&
+                !(edge[j] + 1U == expected &&
+                  fabs(warp(config, (double) edge[j] * config->sample_rate / config->fft_size) -
+                       centre[j]) < slack) &&
+                !(edge[j] == expected + 1U &&
+                  fabs(warp(config, (double) expected * config->sample_rate / config->fft_size) -
+                       centre[j]) < slack)) {
+                bad_edges++;
+            }
+        }
+
+        for (uint32_t b = edge[0]; b < edge[config->num_filters + 1U]; b++) {
+            uint32_t seg = 0;
+            double w = warp(config, (double) b * config->sample_rate / config->fft_size);
+            double e;
+
+            while (edge[seg + 1U] <= b) {
+                seg++;
+            }
+            e = fabs(weight[b - edge[0]] / 32768.0 -
+                     (w - centre[seg]) / (centre[seg + 1U] - centre[seg]));
+            worst = (e > worst) ? e : worst;
+        }
+
+        snprintf(message, sizeof(message), "%s %4u points, %2u filters, %5u to %5u Hz: edges %s, "
+                 "weights within %.1f LSB",
+                 (config->scale == SPECTRAL_MEL_SCALE_MEL) ? "mel" : "log", config->fft_size,
+                 config->num_filters, config->low_hz,
+                 (config->high_hz != 0U) ? config->high_hz : config->sample_rate / 2U,
+                 (bad_edges == 0U) ? "exact" : "off", worst * 32768.0);
+        TEST_ASSERT(status == RFFT_SUCCESS && bad_edges == 0U && worst * 32768.0 <= 2.0,
+                    message);
+    }
+}
+
+/**
+ * @brief Filter energies against double precision triangles
+ *
+ * Every filter within 0.01 % of the weighted sum in double precision.
+ */
+static void test_energies(void)
+{
+    static uint32_t out[MAX_FILTERS];
+    char message[112];
+
+    TEST_SECTION("spectral_mel - Energies against double precision triangles");
+
+    for (uint32_t c = 0; c < NUM_CONFIGS; c++) {
+        const spectral_mel_config_t *config = &configs[c];
+        spectral_mel_t mel;
+        double worst = 0.0;
+
+        spectral_mel_init(&mel, config, energy, weight, edge);
+        reference_centres(config);
+        fill_mag_sq(config->fft_size / 2U + 1U, 2463534242U + c);
+        run_frame(&mel, config);
+        spectral_mel_energies(&mel, out);
+
+        for (uint32_t i = 0; i < config->num_filters; i++) {
+            double e = fabs(out[i] - exact[i]) / exact[i];
+            worst = (e > worst) ? e : worst;
+        }
+
+        snprintf(message, sizeof(message), "%s %4u points, %2u filters: within %.4f %%",
+                 (config->scale == SPECTRAL_MEL_SCALE_MEL) ? "mel" : "log", config->fft_size,
+                 config->num_filters, 100.0 * worst);
+        TEST_ASSERT(worst <= 1e-4, message);
+    }
+}
+
+/**
+ * @brief spectral_mel_log2() against log2 in double precision
+ *
+ * 256 * (log2(energy) + 2 * exponent - 30) within 2 Q8 LSB, energies
+ * above 2^32 included.
+ */
+static void test_log2(void)
+{
+    static const uint32_t scales[] = { 0, 8, 20 };
+    const spectral_mel_config_t *config = &configs[2];
+    int16_t logs[MAX_FILTERS];
+    spectral_mel_t mel;
+    char message[112];
+
+    TEST_SECTION("spectral_mel - spectral_mel_log2() against double precision");
+
+    spectral_mel_init(&mel, config, energy, weight, edge);
+    fill_mag_sq(config->fft_size / 2U + 1U, 88172645U);
+
+    for (uint32_t s = 0; s < sizeof(scales) / sizeof(scales[0]); s++) {
+        double worst = 0.0;
+        uint64_t largest = 0;
+
+        run_frame(&mel, config);
+        for (uint32_t i = 0; i < config->num_filters; i++) {
+            energy[i] <<= scales[s];
+            largest = (energy[i] > largest) ? energy[i] : largest;
+        }
+        spectral_mel_log2(&mel, logs, 10);
+
+        for (uint32_t i = 0; i < config->num_filters; i++) {
+            double e = fabs(logs[i] - 256.0 * (log2((double) energy[i]) + 2.0 * 10 - 30.0));
+            worst = (e > worst) ? e : worst;
+        }
+
+        snprintf(message, sizeof(message), "Energies up to 2^%.1f: within %.2f Q8 LSB",
+                 log2((double) largest), worst);
+        TEST_ASSERT(worst <= 2.0, message);
+    }
+
+    spectral_mel_begin_frame(&mel);
+    spectral_mel_log2(&mel, logs, 10);
+    TEST_ASSERT(logs[0] == 256 * (2 * 10 - 30) && logs[config->num_filters - 1U] == logs[0],
+                "A filter of no energy counts as one");
+}
+
+/**
+ * @brief spectral_mel_dct() against a double precision DCT-II
+ *
+ * Of the logs of spectral_mel_log2(), as the header defines it, every
+ * coefficient within 2 Q8 LSB.
+ */
+static void test_dct(void)
+{
+    static const uint16_t num_coeffs[] = { 13, 13, 20, 1, 24, 32 };
+    int16_t logs[MAX_FILTERS];
+    int16_t out[MAX_FILTERS];
+    char message[112];
+
+    TEST_SECTION("spectral_mel - spectral_mel_dct() against a double DCT-II");
+
+    for (uint32_t c = 0; c < NUM_CONFIGS; c++) {
+        const spectral_mel_config_t *config = &configs[c];
+        uint32_t m_len = config->num_filters;
+        spectral_mel_t mel;
+        double worst = 0.0;
+        rfft_status_t status;
+
+        spectral_mel_init(&mel, config, energy, weight, edge);
+        status = spectral_mel_set_dct(&mel, dct, num_coeffs[c]);
+        fill_mag_sq(config->fft_size / 2U + 1U, 3141592653U + c);
+        run_frame(&mel, config);
+        spectral_mel_log2(&mel, logs, 0);
+        spectral_mel_dct(&mel, logs, out);
+
+        for (uint32_t n = 0; n < num_coeffs[c]; n++) {
+            double y = 0.0;
+
+            for (uint32_t m = 0; m < m_len; m++) {
+                y += logs[m] * cos(pi * n * (m + 0.5) / m_len);
+            }
+            y /= m_len;
+            worst = (fabs(out[n] - y) > worst) ? fabs(out[n] - y) : worst;
+        }
+
+        snprintf(message, sizeof(message), "%2u filters, %2u coefficients: within %.2f Q8 LSB",
+                 m_len, num_coeffs[c], worst);
+        TEST_ASSERT(status == RFFT_SUCCESS && worst <= 2.0, message);
+    }
+}
+
+/**
+ * @brief Argument checks
+ */
+static void test_errors(void)
+{
+    spectral_mel_config_t config = configs[1];
+    spectral_mel_t mel;
+
+    TEST_SECTION("spectral_mel - Errors");
+
+    TEST_ASSERT(spectral_mel_init(NULL, &config, energy, weight, edge) ==
+                RFFT_ERROR_NULL_POINTER, "NULL filterbank rejected");
+    config.fft_size = 300U;
+    TEST_ASSERT(spectral_mel_init(&mel, &config, energy, weight, edge) ==
+                RFFT_ERROR_INVALID_SIZE, "Length without an RFFT rejected");
+    config = configs[1];
+    config.num_filters = 1U;
+    TEST_ASSERT(spectral_mel_init(&mel, &config, energy, weight, edge) ==
+                RFFT_ERROR_INVALID_SIZE, "One filter rejected");
+    config = configs[1];
+    config.high_hz = config.sample_rate;
+    TEST_ASSERT(spectral_mel_init(&mel, &config, energy, weight, edge) ==
+                RFFT_ERROR_INVALID_SIZE, "Upper edge above sample_rate / 2 rejected");
+    config = configs[4];
+    config.low_hz = 0U;
+    TEST_ASSERT(spectral_mel_init(&mel, &config, energy, weight, edge) ==
+                RFFT_ERROR_INVALID_SIZE, "Log scale from 0 Hz rejected");
+    config = configs[1];
+    TEST_ASSERT(spectral_mel_init(&mel, &config, energy, weight, edge) == RFFT_SUCCESS &&
+                spectral_mel_set_dct(&mel, dct, config.num_filters + 1U) ==
+                RFFT_ERROR_INVALID_SIZE, "More coefficients than filters rejected");
+}
+
+/**
+ * @brief Main test runner
+ */
+int main(void) {
+    printf("=== Mel Filterbank Tests ===\n");
+
+    test_layout();
+    test_energies();
+    test_log2();
+    test_dct();
+    test_errors();
+
+    /* Print summary */
+    printf("\n=== Test Summary ===\n");
+    printf("Passed: %d\n", tests_passed);
+    printf("Failed: %d\n", tests_failed);
+    printf("Total:  %d\n", tests_passed + tests_failed);
+
+    if (tests_failed == 0) {
+        printf("\n✓ The filterbank matches double precision!\n");
+        return 0;
+    } else {
+        printf("\n✗ Some tests failed!\n");
+        return 1;
+    }
+}
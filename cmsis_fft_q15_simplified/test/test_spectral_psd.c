@@ -0,0 +1,236 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library - Simplified Q15 RFFT
+ * Title:        test_spectral_psd.c
+ * Description:  Tests for the averaged power spectrum against exact sums
+ *
+ * Target Processor: nRF54L15 FLPR (PC validation)
+ * -------------------------------------------------------------------- */
+
+#include "../include/rfft_q15.h"
+#include "spectral_psd.h"
+#include <stdio.h>
+#include <string.h>
+
+#define NUM_BINS  64
+
+static uint32_t storage[SPECTRAL_PSD_STORAGE_LEN(NUM_BINS)];
+static uint64_t sums[NUM_BINS];
+
+/* Test result tracking */
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+/* Test assertion macro */
+#define TEST_ASSERT(condition, message) \
+    do { \
+        if (condition) { \
+            printf("  ✓ %s\n", message); \
+            tests_passed++; \
+        } else { \
+            printf("  ✗ %s\n", message); \
+            tests_failed++; \
+        } \
+    } while(0)
+
+/* Test section header */
+#define TEST_SECTION(name) \
+    printf("\n=== %s ===\n", name)
+
+static uint32_t seed = 12345U;
+
+/* Magnitude² below 2^bits, from a linear congruential generator */
+static uint32_t random_mag_sq(uint32_t bits)
+{
+    seed = seed * 1103515245U + 12345U;
+    return (bits >= 31U) ? (seed >> 1) : ((seed >> 1) >> (31U - bits));
+}
+
+/**
+ * @brief A linear average is the mean of the exact sums, rounded once
+ *
+ * For each shift, 2^shift frames of magnitudes² below 2^bits, the small
+ * ones far below 2^shift, are pushed next to their sums in 64 bits.
+ * Before the last frame acc must be every sum divided by 2^shift rounded
+ * down, and after it the mean rounded to the nearest, exactly.
+ */
+static void test_linear_exact(void)
+{
+    static const struct {
+        uint8_t shift;
+        uint8_t bits;
+    } cases[] = {
+        { 0, 31 }, { 1, 2 }, { 4, 31 }, { 6, 3 }, { 6, 20 }, { 10, 8 }, { 15, 5 }, { 15, 31 },
+    };
+    char message[128];
+
+    TEST_SECTION("spectral_psd - Linear average of the exact sums");
+
+    for (uint32_t c = 0; c < sizeof(cases) / sizeof(cases[0]); c++) {
+        uint32_t frames = 1U << cases[c].shift;
+        uint32_t floor_errors = 0, mean_errors = 0;
+        spectral_psd_t psd;
+
+        spectral_psd_init(&psd, storage, NUM_BINS, SPECTRAL_PSD_LINEAR, cases[c].shift);
+        memset(sums, 0, sizeof(sums));
+
+        for (uint32_t f = 0; f < frames; f++) {
+            for (uint32_t bin = 0; bin < NUM_BINS; bin++) {
+                uint32_t x = random_mag_sq(cases[c].bits);
+
+                spectral_psd_push(&psd, bin, x);
+                sums[bin] += x;
+            }
+
+            if (f == frames - 2U) {
+                for (uint32_t bin = 0; bin < NUM_BINS; bin++) {
+                    floor_errors += (psd.acc[bin] != (uint32_t) (sums[bin] >> cases[c].shift));
+                }
+            }
+            spectral_psd_end_frame(&psd);
+        }
+
+        for (uint32_t bin = 0; bin < NUM_BINS; bin++) {
+            uint64_t half = ((uint64_t) frames) >> 1;
+
+            mean_errors += (psd.acc[bin] != (uint32_t) ((sums[bin] + half) >> cases[c].shift));
+        }
+
+        snprintf(message, sizeof(message), "2^%-2u frames below 2^%-2u: %u bins off the sum "
+                 "before the last frame, %u off the mean", cases[c].shift, cases[c].bits,
+                 floor_errors, mean_errors);
+        TEST_ASSERT(spectral_psd_complete(&psd) && !spectral_psd_accepts(&psd) &&
+                    floor_errors == 0 && mean_errors == 0, message);
+    }
+}
+
+/**
+ * @brief Bins below 1 LSB a frame keep their mean
+ *
+ * 64 frames of the same magnitude² v in bin v average to exactly v, the
+ * bins below 32 included, which a shift of every frame would lose.
+ */
+static void test_linear_small_bins(void)
+{
+    spectral_psd_t psd;
+    uint32_t wrong = 0;
+
+    TEST_SECTION("spectral_psd - Bins below 1 LSB a frame");
+
+    spectral_psd_init(&psd, storage, NUM_BINS, SPECTRAL_PSD_LINEAR, 6);
+    while (spectral_psd_accepts(&psd)) {
+        for (uint32_t bin = 0; bin < NUM_BINS; bin++) {
+            spectral_psd_push(&psd, bin, bin);
+        }
+        spectral_psd_end_frame(&psd);
+    }
+
+    for (uint32_t bin = 0; bin < NUM_BINS; bin++) {
+        wrong += (psd.acc[bin] != bin);
+    }
+    TEST_ASSERT(psd.frames == 64U && wrong == 0, "Constant bins 0 to 63 average to themselves");
+
+    spectral_psd_reset(&psd);
+    TEST_ASSERT(psd.frames == 0U && psd.acc[63] == 0U && psd.rem[63] == 0U &&
+                spectral_psd_accepts(&psd), "Reset clears the sums and their low bits");
+}
+
+/**
+ * @brief The largest magnitudes² neither wrap nor exceed Q31
+ *
+ * 2^15 frames of 0xFFFFFFFF, clamped to 0x7FFFFFFF, average to
+ * 0x7FFFFFFF, the sum taking its 46 bits.
+ */
+static void test_linear_full_scale(void)
+{
+    spectral_psd_t psd;
+
+    TEST_SECTION("spectral_psd - Full scale");
+
+    spectral_psd_init(&psd, storage, 2U, SPECTRAL_PSD_LINEAR, 15);
+    while (spectral_psd_accepts(&psd)) {
+        spectral_psd_push(&psd, 0, 0xFFFFFFFFU);
+        spectral_psd_push(&psd, 1, 0x7FFFFFFEU);
+        spectral_psd_end_frame(&psd);
+    }
+
+    TEST_ASSERT(psd.frames == 32768U && psd.acc[0] == 0x7FFFFFFFU && psd.acc[1] == 0x7FFFFFFEU,
+                "2^15 frames of full scale average to full scale");
+}
+
+/**
+ * @brief The running average starts at the first frame and settles on a constant
+ *
+ * The rounded step of 1/8 of the distance stops within 4 of the constant.
+ */
+static void test_exponential(void)
+{
+    spectral_psd_t psd;
+    uint32_t earlier;
+
+    TEST_SECTION("spectral_psd - Exponential average");
+
+    spectral_psd_init(&psd, storage, 1U, SPECTRAL_PSD_EXPONENTIAL, 3);
+    spectral_psd_push(&psd, 0, 80000U);
+    spectral_psd_end_frame(&psd);
+    TEST_ASSERT(psd.acc[0] == 80000U, "First frame taken as it is");
+
+    spectral_psd_push(&psd, 0, 0U);
+    spectral_psd_end_frame(&psd);
+    TEST_ASSERT(psd.acc[0] == 70000U, "Moved by 1/8 of the distance to the next frame");
+
+    for (uint32_t f = 0; f < 200U; f++) {
+        earlier = psd.acc[0];
+        spectral_psd_push(&psd, 0, 1000U);
+        spectral_psd_end_frame(&psd);
+    }
+    TEST_ASSERT(psd.acc[0] >= 996U && psd.acc[0] <= 1004U && psd.acc[0] == earlier &&
+                spectral_psd_accepts(&psd), "Settled on a constant and still running");
+}
+
+/**
+ * @brief Argument checks
+ */
+static void test_errors(void)
+{
+    spectral_psd_t psd;
+
+    TEST_SECTION("spectral_psd - Errors");
+
+    TEST_ASSERT(spectral_psd_init(NULL, storage, NUM_BINS, SPECTRAL_PSD_LINEAR, 4) ==
+                RFFT_ERROR_NULL_POINTER, "NULL average rejected");
+    TEST_ASSERT(spectral_psd_init(&psd, NULL, NUM_BINS, SPECTRAL_PSD_LINEAR, 4) ==
+                RFFT_ERROR_NULL_POINTER, "NULL storage rejected");
+    TEST_ASSERT(spectral_psd_init(&psd, storage, 0, SPECTRAL_PSD_LINEAR, 4) ==
+                RFFT_ERROR_INVALID_SIZE, "No bins rejected");
+    TEST_ASSERT(spectral_psd_init(&psd, storage, NUM_BINS, SPECTRAL_PSD_LINEAR, 16) ==
+                RFFT_ERROR_INVALID_SIZE, "Shift above 15 rejected");
+    TEST_ASSERT(spectral_psd_init(&psd, storage, NUM_BINS, (spectral_psd_mode_t) 2, 4) ==
+                RFFT_ERROR_INVALID_SIZE, "Unknown mode rejected");
+}
+
+/**
+ * @brief Main test runner
+ */
+int main(void) {
+    printf("=== Power Spectrum Average Tests ===\n");
+
+    test_linear_exact();
+    test_linear_small_bins();
+    test_linear_full_scale();
+    test_exponential();
+    test_errors();
+
+    /* Print summary */
+    printf("\n=== Test Summary ===\n");
+    printf("Passed: %d\n", tests_passed);
+    printf("Failed: %d\n", tests_failed);
+    printf("Total:  %d\n", tests_passed + tests_failed);
+
+    if (tests_failed == 0) {
+        printf("\n✓ The average keeps every bit of its frames!\n");
+        return 0;
+    } else {
+        printf("\n✗ Some tests failed!\n");
+        return 1;
+    }
+}
@@ -0,0 +1,337 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library - Simplified Q15 RFFT
+ * Title:        test_spectral_track.c
+ * Description:  Tests for the changes of tracked top bins over scripted frames
+ *
+ * Target Processor: nRF54L15 FLPR (PC validation)
+ * -------------------------------------------------------------------- */
+
+#include "../include/rfft_q15.h"
+#include "spectral_track.h"
+#include <stdio.h>
+
+#if RFFT_Q15_MIN_FFT_LEN > 256 || RFFT_Q15_MAX_FFT_LEN < 4096
+#error "test_spectral_track.c needs the lengths from 256 to 4096"
+#endif
+
+#define NUM_BINS     513
+#define NUM_PLACES   3
+#define MOVE_BINS    2
+#define HYST_SHIFT   2     /* Replace above 1.25 times the weakest */
+#define FLOOR_MAG    100U
+#define BACKGROUND   10U
+#define MAX_PEAKS    4
+
+static spectral_track_place_t places[NUM_PLACES];
+static spectral_track_change_t changes[NUM_PLACES];
+static uint32_t spectrum[NUM_BINS];
+
+/* Test result tracking */
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+/* Test assertion macro */
+#define TEST_ASSERT(condition, message) \
+    do { \
+        if (condition) { \
+            printf("  ✓ %s\n", message); \
+            tests_passed++; \
+        } else { \
+            printf("  ✗ %s\n", message); \
+            tests_failed++; \
+        } \
+    } while(0)
+
+/* Test section header */
+#define TEST_SECTION(name) \
+    printf("\n=== %s ===\n", name)
+
+/* One line of a scripted frame, bin 0 ends the list */
+typedef struct {
+    uint16_t bin;
+    uint32_t mag_sq;
+} script_peak_t;
+
+/*
+ * Run one frame of the given peaks over a flat background: every bin
+ * through spectral_track_push() in order, then the NUM_PLACES strongest
+ * bins, strongest first, as the selection of spectral_track_end_frame().
+ */
+static uint16_t run_frame(spectral_track_t *track, const script_peak_t *peaks)
+{
+    spectral_peak_t top[NUM_PLACES];
+
+    for (uint32_t k = 0; k < NUM_BINS; k++) {
+        spectrum[k] = BACKGROUND;
+    }
+    for (uint32_t p = 0; p < MAX_PEAKS && peaks[p].bin != 0; p++) {
+        spectrum[peaks[p].bin] = peaks[p].mag_sq;
+    }
+
+    spectral_track_begin_frame(track);
+    for (uint32_t k = 0; k < NUM_BINS; k++) {
+        spectral_track_push(track, k, spectrum[k]);
+    }
+
+    /* Strongest first, the lower bin first of equal ones */
+    for (uint32_t c = 0; c < NUM_PLACES; c++) {
+        top[c].bin_index = 0;
+        top[c].magnitude_squared = 0;
+        for (uint32_t k = 1; k < NUM_BINS; k++) {
+            int taken = 0;
+
+            for (uint32_t t = 0; t < c; t++) {
+                taken |= top[t].bin_index == k;
+            }
+            if (!taken && spectrum[k] > top[c].magnitude_squared) {
+                top[c].bin_index = (uint16_t) k;
+                top[c].magnitude_squared = spectrum[k];
+            }
+        }
+    }
+
+    return spectral_track_end_frame(track, top, NUM_PLACES, FLOOR_MAG);
+}
+
+/* The changes of the frame are exactly the expected ones, in any order */
+static int same_changes(const spectral_track_t *track, uint16_t n,
+                        const spectral_track_change_t *expected, uint16_t count)
+{
+    uint32_t matched = 0;
+
+    if (n != count || track->num_changes != count) {
+        return 0;
+    }
+    for (uint32_t e = 0; e < count; e++) {
+        for (uint32_t i = 0; i < n; i++) {
+            if (track->changes[i].op == expected[e].op && track->changes[i].id == expected[e].id &&
+                track->changes[i].bin_index == expected[e].bin_index) {
+                matched++;
+                break;
+            }
+        }
+    }
+
+    return matched == count;
+}
+
+/* Id a change of the last frame gave bin, NUM_PLACES if none */
+static uint8_t id_of(const spectral_track_t *track, uint16_t bin)
+{
+    for (uint32_t i = 0; i < track->num_changes; i++) {
+        if (track->changes[i].bin_index == bin) {
+            return track->changes[i].id;
+        }
+    }
+
+    return NUM_PLACES;
+}
+
+/* The active places hold bins, sorted, with the magnitudes² of the frame */
+static int holds(const spectral_track_t *track, const uint16_t *bins, uint16_t count)
+{
+    if (track->active != count) {
+        return 0;
+    }
+    for (uint32_t i = 0; i < count; i++) {
+        if (track->place[i].bin_index != bins[i] ||
+            track->place[i].magnitude_squared != spectrum[bins[i]]) {
+            return 0;
+        }
+    }
+    for (uint32_t i = count; i < track->k; i++) {
+        if (track->place[i].bin_index != 0) {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+/**
+ * @brief A scripted sequence of frames through every rule of the tracker
+ *
+ * Three places, peaks move up to 2 bins, a new peak needs 1.25 times the
+ * weakest tracked one, and a peak at or below 100 is removed. Each frame
+ * checks the exact changes, the places they refer to and the set after.
+ */
+static void test_script(void)
+{
+    static const script_peak_t frames[][MAX_PEAKS] = {
+        /* 0: three new peaks */
+        { { 100, 1000 }, { 200, 2000 }, { 300, 3000 }, { 0, 0 } },
+        /* 1: two move within reach, one stays */
+        { { 101, 1000 }, { 200, 2000 }, { 302, 3000 }, { 0, 0 } },
+        /* 2: one jumps 3 bins, out of reach */
+        { { 104, 1000 }, { 200, 2000 }, { 302, 3000 }, { 0, 0 } },
+        /* 3: a new one 1.2 times the weakest */
+        { { 104, 1000 }, { 200, 2000 }, { 302, 3000 }, { 400, 1200 } },
+        /* 4: the new one at 1.3 times the weakest */
+        { { 104, 1000 }, { 200, 2000 }, { 302, 3000 }, { 400, 1300 } },
+        /* 5: the replaced one back, 1.08 times the weakest */
+        { { 104, 1400 }, { 200, 2000 }, { 302, 3000 }, { 400, 1300 } },
+        /* 6: one drops below the floor, another leaves */
+        { { 200, 50 }, { 302, 3000 }, { 400, 1300 }, { 0, 0 } },
+        /* 7: two move, one comes back into the free place */
+        { { 200, 2000 }, { 303, 3000 }, { 398, 1300 }, { 0, 0 } },
+    };
+    spectral_track_t track;
+    spectral_track_change_t expected[NUM_PLACES];
+    uint8_t id_a, id_b, id_c;
+    uint16_t n;
+
+    TEST_SECTION("spectral_track - Scripted frames");
+
+    spectral_track_init(&track, places, changes, NUM_PLACES, MOVE_BINS, HYST_SHIFT);
+    TEST_ASSERT(spectral_track_threshold(&track) == 0U, "Any bin enters while places are free");
+
+    n = run_frame(&track, frames[0]);
+    id_a = id_of(&track, 100);
+    id_b = id_of(&track, 200);
+    id_c = id_of(&track, 300);
+    expected[0] = (spectral_track_change_t) { SPECTRAL_TRACK_ADDED, id_a, 100 };
+    expected[1] = (spectral_track_change_t) { SPECTRAL_TRACK_ADDED, id_b, 200 };
+    expected[2] = (spectral_track_change_t) { SPECTRAL_TRACK_ADDED, id_c, 300 };
+    TEST_ASSERT(same_changes(&track, n, expected, 3) && id_a != id_b && id_b != id_c &&
+                id_a != id_c && id_c < NUM_PLACES &&
+                holds(&track, (const uint16_t[]) { 100, 200, 300 }, 3),
+                "Frame 0: three peaks ADDED in three places, sorted by bin");
+    TEST_ASSERT(spectral_track_threshold(&track) == 1250U,
+                "Full set: a new bin needs 1.25 times the weakest, 1250");
+
+    n = run_frame(&track, frames[1]);
+    expected[0] = (spectral_track_change_t) { SPECTRAL_TRACK_MOVED, id_a, 101 };
+    expected[1] = (spectral_track_change_t) { SPECTRAL_TRACK_MOVED, id_c, 302 };
+    TEST_ASSERT(same_changes(&track, n, expected, 2) &&
+                holds(&track, (const uint16_t[]) { 101, 200, 302 }, 3),
+                "Frame 1: peaks 1 and 2 bins on MOVED in their places, the steady one unreported");
+
+    n = run_frame(&track, frames[2]);
+    expected[0] = (spectral_track_change_t) { SPECTRAL_TRACK_ADDED, id_a, 104 };
+    TEST_ASSERT(same_changes(&track, n, expected, 1) &&
+                holds(&track, (const uint16_t[]) { 104, 200, 302 }, 3),
+                "Frame 2: a peak 3 bins on is a new one, ADDED to the place it left (one change)");
+
+    n = run_frame(&track, frames[3]);
+    TEST_ASSERT(n == 0U && holds(&track, (const uint16_t[]) { 104, 200, 302 }, 3),
+                "Frame 3: 1.2 times the weakest does not replace it");
+
+    n = run_frame(&track, frames[4]);
+    expected[0] = (spectral_track_change_t) { SPECTRAL_TRACK_ADDED, id_a, 400 };
+    TEST_ASSERT(same_changes(&track, n, expected, 1) &&
+                holds(&track, (const uint16_t[]) { 200, 302, 400 }, 3),
+                "Frame 4: 1.3 times the weakest replaces it in its place");
+    TEST_ASSERT(spectral_track_threshold(&track) == 1625U,
+                "The threshold follows the new weakest, 1625");
+
+    n = run_frame(&track, frames[5]);
+    TEST_ASSERT(n == 0U && holds(&track, (const uint16_t[]) { 200, 302, 400 }, 3),
+                "Frame 5: the replaced peak at 1.08 times the new one does not swap back");
+
+    n = run_frame(&track, frames[6]);
+    expected[0] = (spectral_track_change_t) { SPECTRAL_TRACK_REMOVED, id_b, 200 };
+    TEST_ASSERT(same_changes(&track, n, expected, 1) &&
+                holds(&track, (const uint16_t[]) { 302, 400 }, 2),
+                "Frame 6: a peak at or below the floor REMOVED with the bin it held");
+    TEST_ASSERT(spectral_track_threshold(&track) == 0U, "A free place takes any bin again");
+
+    n = run_frame(&track, frames[7]);
+    expected[0] = (spectral_track_change_t) { SPECTRAL_TRACK_ADDED, id_b, 200 };
+    expected[1] = (spectral_track_change_t) { SPECTRAL_TRACK_MOVED, id_c, 303 };
+    expected[2] = (spectral_track_change_t) { SPECTRAL_TRACK_MOVED, id_a, 398 };
+    TEST_ASSERT(same_changes(&track, n, expected, 3) &&
+                holds(&track, (const uint16_t[]) { 200, 303, 398 }, 3),
+                "Frame 7: moves both ways and a new peak in the free place");
+
+    spectral_track_reset(&track);
+    TEST_ASSERT(track.active == 0U && spectral_track_threshold(&track) == 0U,
+                "Reset frees every place");
+    n = run_frame(&track, frames[7]);
+    TEST_ASSERT(n == 3U && track.changes[0].op == SPECTRAL_TRACK_ADDED &&
+                track.changes[1].op == SPECTRAL_TRACK_ADDED &&
+                track.changes[2].op == SPECTRAL_TRACK_ADDED,
+                "After a reset every peak is ADDED again");
+}
+
+/**
+ * @brief Two peaks that meet at one bin keep one place
+ *
+ * Both windows see the same strongest bin; the second place follows the
+ * first there and is removed with the bin it held, so no two places
+ * hold one bin.
+ */
+static void test_merge(void)
+{
+    static const script_peak_t start[MAX_PEAKS] = {
+        { 200, 2000 }, { 203, 1500 }, { 0, 0 },
+    };
+    static const script_peak_t met[MAX_PEAKS] = {
+        { 201, 2500 }, { 0, 0 },
+    };
+    spectral_track_t track;
+    spectral_track_change_t expected[2];
+    uint8_t id_low, id_high;
+    uint16_t n;
+
+    TEST_SECTION("spectral_track - Peaks that meet");
+
+    spectral_track_init(&track, places, changes, NUM_PLACES, MOVE_BINS, HYST_SHIFT);
+    run_frame(&track, start);
+    id_low = id_of(&track, 200);
+    id_high = id_of(&track, 203);
+
+    n = run_frame(&track, met);
+    expected[0] = (spectral_track_change_t) { SPECTRAL_TRACK_MOVED, id_low, 201 };
+    expected[1] = (spectral_track_change_t) { SPECTRAL_TRACK_REMOVED, id_high, 203 };
+    TEST_ASSERT(same_changes(&track, n, expected, 2) &&
+                holds(&track, (const uint16_t[]) { 201 }, 1),
+                "The lower place MOVED to the shared bin, the upper one REMOVED from 203");
+}
+
+/**
+ * @brief Argument checks
+ */
+static void test_errors(void)
+{
+    spectral_track_t track;
+
+    TEST_SECTION("spectral_track - Errors");
+
+    TEST_ASSERT(spectral_track_init(NULL, places, changes, 3U, 2U, 2U) == RFFT_ERROR_NULL_POINTER,
+                "NULL tracker rejected");
+    TEST_ASSERT(spectral_track_init(&track, NULL, changes, 3U, 2U, 2U) == RFFT_ERROR_NULL_POINTER,
+                "NULL places rejected");
+    TEST_ASSERT(spectral_track_init(&track, places, NULL, 3U, 2U, 2U) == RFFT_ERROR_NULL_POINTER,
+                "NULL changes rejected");
+    TEST_ASSERT(spectral_track_init(&track, places, changes, 0U, 2U, 2U) == RFFT_ERROR_INVALID_SIZE,
+                "No places rejected");
+    TEST_ASSERT(spectral_track_init(&track, places, changes, 256U, 2U, 2U) ==
+                RFFT_ERROR_INVALID_SIZE, "More than 255 places rejected");
+    TEST_ASSERT(spectral_track_init(&track, places, changes, 3U, 2U, 32U) ==
+                RFFT_ERROR_INVALID_SIZE, "hyst_shift above 31 rejected");
+}
+
+/**
+ * @brief Main test runner
+ */
+int main(void) {
+    printf("=== Peak Tracker Tests ===\n");
+
+    test_script();
+    test_merge();
+    test_errors();
+
+    /* Print summary */
+    printf("\n=== Test Summary ===\n");
+    printf("Passed: %d\n", tests_passed);
+    printf("Failed: %d\n", tests_failed);
+    printf("Total:  %d\n", tests_passed + tests_failed);
+
+    if (tests_failed == 0) {
+        printf("\n✓ The tracker reports exactly the changes of the script!\n");
+        return 0;
+    } else {
+        printf("\n✗ Some tests failed!\n");
+        return 1;
+    }
+}
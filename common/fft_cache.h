@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/*
+ * Data cache maintenance of the buffers one core writes and the other
+ * reads: the slots of the frame pool, the halves of a cooperative FFT and
+ * the DMA buffers of the SAADC. The cores of the nRF54L series have no
+ * data cache and the calls compile to nothing; the application core of
+ * the nRF54H20 has one, and a line that holds a shared buffer and a
+ * private variable at once loses one of them when it is invalidated. The
+ * shared buffers are therefore aligned to FFT_CACHE_LINE and cover whole
+ * lines.
+ */
+
+#ifndef FFT_CACHE_H
+#define FFT_CACHE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <zephyr/cache.h>
+#include <zephyr/devicetree.h>
+#include <zephyr/sys/__assert.h>
+#include <zephyr/sys/util.h>
+
+#if defined(CONFIG_DCACHE_LINE_SIZE) && (CONFIG_DCACHE_LINE_SIZE > 0)
+#define FFT_DCACHE_LINE CONFIG_DCACHE_LINE_SIZE
+#else
+#define FFT_DCACHE_LINE 0
+#endif
+
+/**
+ * Bytes the shared buffers are aligned to and maintained in: the
+ * dcache-alignment of ipc0, 32 without it, or the data cache line of this
+ * core if it is longer.
+ */
+#define FFT_CACHE_LINE MAX(DT_PROP_OR(DT_NODELABEL(ipc0), dcache_alignment, 32), FFT_DCACHE_LINE)
+
+BUILD_ASSERT((FFT_CACHE_LINE & (FFT_CACHE_LINE - 1)) == 0, "FFT_CACHE_LINE must be a power of two");
+
+/** Aligns a buffer to its own cache lines. */
+#define FFT_CACHE_ALIGNED __aligned(FFT_CACHE_LINE)
+
+/** Nonzero when x, an address or a size, falls on a line boundary. */
+#define FFT_CACHE_IS_ALIGNED(x) ((((uintptr_t)(x)) & (FFT_CACHE_LINE - 1)) == 0)
+
+/**
+ * @brief Write a buffer back to memory before the other core reads it.
+ *
+ * Any line the buffer touches is written, which is harmless for the data
+ * that shares its first or last line.
+ */
+static inline void fft_cache_flush(const void *buf, size_t len)
+{
+	uintptr_t start = (uintptr_t)buf & ~(uintptr_t)(FFT_CACHE_LINE - 1);
+	uintptr_t end = ((uintptr_t)buf + len + FFT_CACHE_LINE - 1) &
+			~(uintptr_t)(FFT_CACHE_LINE - 1);
+
+	(void)sys_cache_data_flush_range((void *)start, end - start);
+}
+
+/**
+ * @brief Drop the cached copy of a buffer the other core or a DMA wrote.
+ *
+ * @param buf  FFT_CACHE_LINE aligned.
+ * @param len  A multiple of FFT_CACHE_LINE, so that no other data shares a line.
+ */
+static inline void fft_cache_invd(void *buf, size_t len)
+{
+	__ASSERT(FFT_CACHE_IS_ALIGNED(buf) && FFT_CACHE_IS_ALIGNED(len),
+		 "%p + %u does not cover whole cache lines", buf, (unsigned int)len);
+
+	(void)sys_cache_data_invd_range(buf, len);
+}
+
+#endif /* FFT_CACHE_H */
@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/*
+ * Layout of the shared frame pool. The pool is the fft_pool reserved-memory
+ * region, split into slots of one frame each. The application core writes
+ * samples straight into a slot and passes only the slot index to the remote
+ * core, which runs the FFT on the slot in place. A slot belongs to the
+ * remote core from the FFT_STREAM_MSG_FRAME descriptor until the matching
+ * FFT_STREAM_MSG_RESULT.
+ *
+ * With CONFIG_APP_FFT_SHM_RING the region holds a shm_ring of sample
+ * blocks instead, a block per slot.
+ */
+
+#ifndef FFT_FRAME_POOL_H
+#define FFT_FRAME_POOL_H
+
+#include <stdint.h>
+#include <zephyr/devicetree.h>
+#include <zephyr/sys/util.h>
+
+#include "fft_cache.h"
+
+#define FFT_POOL_NODE      DT_NODELABEL(fft_pool)
+#define FFT_POOL_ADDR      DT_REG_ADDR(FFT_POOL_NODE)
+#define FFT_POOL_SIZE      DT_REG_SIZE(FFT_POOL_NODE)
+
+#define FFT_POOL_SLOT_SIZE (CONFIG_APP_FFT_FRAME_LEN * sizeof(int16_t))
+#define FFT_POOL_NUM_SLOTS MIN(FFT_POOL_SIZE / FFT_POOL_SLOT_SIZE, UINT8_MAX)
+
+/* A slot is written back and invalidated alone, it must not share a line with the next. */
+#if DT_NODE_EXISTS(FFT_POOL_NODE)
+BUILD_ASSERT(FFT_CACHE_IS_ALIGNED(FFT_POOL_ADDR) && FFT_CACHE_IS_ALIGNED(FFT_POOL_SLOT_SIZE),
+	     "fft_pool slots must be FFT_CACHE_LINE aligned");
+#endif
+
+#if defined(CONFIG_APP_FFT_SHM_RING)
+#include "fft_stream_msg.h"
+#include "shm_ring.h"
+
+#define FFT_RING_SLOT_SIZE SHM_RING_SLOT_SIZE(FFT_SAMPLE_BLOCK_SIZE(CONFIG_APP_FFT_BLOCK_SAMPLES))
+#define FFT_RING_NUM_SLOTS \
+	SHM_RING_NUM_SLOTS(FFT_POOL_SIZE, FFT_SAMPLE_BLOCK_SIZE(CONFIG_APP_FFT_BLOCK_SAMPLES))
+#endif
+
+static inline int16_t *fft_pool_slot(uint8_t slot)
+{
+	return (int16_t *)(FFT_POOL_ADDR + (uintptr_t)slot * FFT_POOL_SLOT_SIZE);
+}
+
+#endif /* FFT_FRAME_POOL_H */
@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/*
+ * Layout of the state store. The store is the fft_store partition at the
+ * top of the application core RRAM, below the remote core flash, that the
+ * flpr-128k snippet and SB_CONFIG_FLPR_MEMORY_SPLIT define; the RRAM flash
+ * driver only writes cpuapp_rram. The remote core has it as a
+ * reserved-memory region at the same address. It holds one image: a
+ * struct fft_store_hdr, then hdr.len bytes of state the remote core alone
+ * interprets, padded to FFT_STORE_ALIGN.
+ *
+ * The remote core reads the region in place. Only the application core
+ * writes it, from the FFT_STREAM_MSG_STORE chunks of the remote core; the
+ * chunk with the header comes last, so an image cut short by a reset fails
+ * the CRC of the header left in place.
+ */
+
+#ifndef FFT_STORE_H
+#define FFT_STORE_H
+
+#include <stdint.h>
+#include <zephyr/devicetree.h>
+#include <zephyr/sys/util.h>
+
+#define FFT_STORE_NODE  DT_NODELABEL(fft_store)
+/* The partition offset on the application core, cpuapp_rram starts at 0. */
+#define FFT_STORE_ADDR  DT_REG_ADDR(FFT_STORE_NODE)
+#define FFT_STORE_SIZE  DT_REG_SIZE(FFT_STORE_NODE)
+
+/* Write block of the RRAM controller, every chunk starts and ends on one. */
+#define FFT_STORE_ALIGN 16
+
+/* "FST1", a region never written holds 0xff. */
+#define FFT_STORE_MAGIC 0x31545346U
+
+struct fft_store_hdr {
+	uint32_t magic;  /**< FFT_STORE_MAGIC. */
+	uint32_t key;    /**< Build of the remote core the state is valid for. */
+	uint32_t len;    /**< Bytes of state after the header. */
+	uint32_t crc;    /**< crc32_ieee() of those bytes. */
+};
+
+BUILD_ASSERT(sizeof(struct fft_store_hdr) % FFT_STORE_ALIGN == 0);
+
+static inline const struct fft_store_hdr *fft_store_image(void)
+{
+	return (const struct fft_store_hdr *)FFT_STORE_ADDR;
+}
+
+#endif /* FFT_STORE_H */
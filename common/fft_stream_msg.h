@@ -0,0 +1,644 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/*
+ * Wire format of the FFT sample stream exchanged between the application
+ * core and the remote core. Both images include this header, so it must not
+ * depend on anything but the standard integer types and Kconfig.
+ */
+
+#ifndef FFT_STREAM_MSG_H
+#define FFT_STREAM_MSG_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Application core -> remote core: block of Q15 samples. */
+#define FFT_STREAM_MSG_SAMPLES 0x01
+/** Remote core -> application core: top bins of one frame. */
+#define FFT_STREAM_MSG_RESULT  0x02
+/** Application core -> remote core: frame placed in the shared frame pool. */
+#define FFT_STREAM_MSG_FRAME   0x03
+/** Application core -> remote core: request for the averaged power spectrum. */
+#define FFT_STREAM_MSG_PSD_REQUEST 0x04
+/** Remote core -> application core: chunk of the averaged power spectrum. */
+#define FFT_STREAM_MSG_PSD     0x05
+/** Both directions: clock offset sync, CONFIG_APP_FFT_LATENCY only. */
+#define FFT_STREAM_MSG_SYNC    0x06
+/** Remote core -> application core: row of the FFT stage profile. */
+#define FFT_STREAM_MSG_PROFILE 0x07
+/**
+ * Remote core -> application core: frame queue back-pressure. A count of 1
+ * asks to pause the sample blocks, 0 to resume them.
+ */
+#define FFT_STREAM_MSG_FLOW    0x08
+/**
+ * Both directions, CONFIG_APP_FFT_RECONFIG only: the application core asks
+ * for another frame length and window, the remote core answers with the
+ * ones in effect.
+ */
+#define FFT_STREAM_MSG_CONFIG  0x09
+/**
+ * Both directions, CONFIG_APP_FFT_CTRL only: command of the application
+ * core and the response of the remote core, struct fft_ctrl_msg.
+ */
+#define FFT_STREAM_MSG_CTRL    0x0a
+/**
+ * Remote core -> application core, CONFIG_APP_FFT_PSD_COMPACT only: chunk
+ * of the averaged power spectrum coded by psd_pack_encode().
+ */
+#define FFT_STREAM_MSG_PSD_PACKED 0x0b
+/**
+ * Remote core -> application core, CONFIG_APP_FFT_EVENTS only: a frame
+ * crossed an anomaly threshold, or is back under all of them.
+ */
+#define FFT_STREAM_MSG_EVENT   0x0c
+/**
+ * Remote core -> application core, CONFIG_APP_FFT_DUTY_CYCLE only: run
+ * the clock at hdr.count MHz, struct fft_clock_msg.
+ */
+#define FFT_STREAM_MSG_CLOCK   0x0d
+/**
+ * Both directions, CONFIG_APP_FFT_COOP only: the remote core hands the
+ * application core one half of a split CFFT in the frame pool, which
+ * answers with the same message once the half is transformed.
+ */
+#define FFT_STREAM_MSG_COOP    0x0e
+/**
+ * Remote core -> application core, CONFIG_APP_FFT_BANDS or
+ * CONFIG_APP_FFT_PIPELINE only: the band energies of one frame, struct
+ * fft_bands_msg, instead of or besides its result.
+ */
+#define FFT_STREAM_MSG_BANDS   0x0f
+/**
+ * Remote core -> application core, CONFIG_APP_FFT_MEL only: the filterbank
+ * features of one frame, struct fft_features_msg, instead of its result.
+ */
+#define FFT_STREAM_MSG_FEATURES 0x10
+/**
+ * Both directions, CONFIG_APP_FFT_SPECTROGRAM only: the application core
+ * subscribes to a row every hdr.count frames, 0 to unsubscribe, and the
+ * remote core sends the rows, struct fft_spectrogram_msg.
+ */
+#define FFT_STREAM_MSG_SPECTROGRAM 0x11
+/**
+ * Application core -> remote core, CONFIG_APP_FFT_ORDER only: tachometer
+ * pulses of the sample stream, struct fft_tacho_msg.
+ */
+#define FFT_STREAM_MSG_TACHO   0x12
+/**
+ * Remote core -> application core, CONFIG_APP_FFT_RETRANSMIT only: send the
+ * hdr.count sample blocks from block hdr.seq on again, a bare header.
+ */
+#define FFT_STREAM_MSG_NACK    0x13
+/**
+ * Remote core -> application core, CONFIG_APP_FFT_STORE only: hdr.count
+ * bytes of the state image to write into the fft_store region, struct
+ * fft_store_msg; the chunk at offset 0 ends the image.
+ */
+#define FFT_STREAM_MSG_STORE   0x14
+/**
+ * Remote core -> application core, CONFIG_APP_FFT_TRACK only: the places
+ * of the tracked top bins that changed in a frame, struct fft_track_msg,
+ * instead of its result.
+ */
+#define FFT_STREAM_MSG_TRACK   0x15
+/**
+ * Remote core -> application core, CONFIG_APP_FFT_SHED only: the analysis
+ * moved to shed level hdr.count, struct fft_shed_msg.
+ */
+#define FFT_STREAM_MSG_SHED    0x16
+/**
+ * Both directions, CONFIG_APP_FFT_PIPELINE only: the application core sets
+ * the chain of stages every frame goes through, struct fft_pipeline_msg,
+ * and the remote core answers with the chain in effect.
+ */
+#define FFT_STREAM_MSG_PIPELINE 0x17
+/**
+ * Application core -> remote core, CONFIG_APP_FFT_INPUT_Q7 only: block of
+ * 8-bit samples, struct fft_sample_block_q7, in place of FFT_STREAM_MSG_SAMPLES.
+ */
+#define FFT_STREAM_MSG_SAMPLES_Q7 0x18
+
+/**
+ * Priority classes of the messages of the remote core, CONFIG_APP_FFT_PRIO:
+ * a class is never held up by the messages of a lower one.
+ */
+enum fft_stream_class {
+	FFT_STREAM_CLASS_ALARM,   /**< Events, answers to commands, flow and clock. */
+	FFT_STREAM_CLASS_RESULT,  /**< Results, band energies and features of a frame. */
+	FFT_STREAM_CLASS_BULK,    /**< Power spectrum chunks, spectrogram rows, profiles. */
+	FFT_STREAM_NUM_CLASSES,
+};
+
+/** Priority class of a message of type FFT_STREAM_MSG_*. */
+static inline enum fft_stream_class fft_stream_msg_class(uint8_t type)
+{
+	switch (type) {
+	case FFT_STREAM_MSG_SYNC:
+	case FFT_STREAM_MSG_FLOW:
+	case FFT_STREAM_MSG_CONFIG:
+	case FFT_STREAM_MSG_PIPELINE:
+	case FFT_STREAM_MSG_CTRL:
+	case FFT_STREAM_MSG_EVENT:
+	case FFT_STREAM_MSG_CLOCK:
+	case FFT_STREAM_MSG_SHED:
+	case FFT_STREAM_MSG_COOP:
+	case FFT_STREAM_MSG_NACK:
+		return FFT_STREAM_CLASS_ALARM;
+	case FFT_STREAM_MSG_PSD:
+	case FFT_STREAM_MSG_PROFILE:
+	case FFT_STREAM_MSG_PSD_PACKED:
+	case FFT_STREAM_MSG_SPECTROGRAM:
+	case FFT_STREAM_MSG_STORE:
+		return FFT_STREAM_CLASS_BULK;
+	default:
+		return FFT_STREAM_CLASS_RESULT;
+	}
+}
+
+/** Common header of every stream message. */
+struct fft_stream_hdr {
+	uint8_t type;     /**< One of FFT_STREAM_MSG_*. */
+	uint8_t slot;     /**< Frame pool slot of a frame and of its result. */
+	uint16_t count;   /**< Samples in a block or frame, bins in a result. */
+	uint32_t seq;     /**< Block sequence number, or frame sequence number. */
+};
+
+/** Block of consecutive samples. */
+struct fft_sample_block {
+	struct fft_stream_hdr hdr;
+	int16_t samples[];
+};
+
+/** Block of consecutive samples of 8 bits, the Q15 ones divided by 256. */
+struct fft_sample_block_q7 {
+	struct fft_stream_hdr hdr;
+	int8_t samples[];
+};
+
+/**
+ * Remote core times of one result, in microseconds of the remote core's
+ * clock, low 32 bits. The capture time stays on the application core,
+ * found again by last_seq.
+ */
+struct fft_result_times {
+	uint32_t last_seq;   /**< Block, or pool frame, that completed the frame. */
+	uint32_t recv;       /**< Frame complete on the remote core. */
+	uint32_t fft_start;  /**< FFT of the frame started. */
+	uint32_t fft_end;    /**< FFT and top bin search done. */
+	uint32_t send;       /**< Result handed to IPC. */
+};
+
+/** Time-domain statistics of the samples of one result's frame, before the window. */
+struct fft_result_stats {
+	int16_t mean;        /**< Mean (Q15). */
+	uint16_t rms;        /**< RMS, the mean included (Q15). */
+	uint16_t peak;       /**< Largest magnitude, 32768 for -32768. */
+	uint16_t crest;      /**< Peak / RMS (Q8). */
+	uint32_t kurtosis;   /**< Kurtosis (Q8), 768 for Gaussian noise. */
+};
+
+/**
+ * Result of one analysed frame, strongest bin first. A count of zero means
+ * the frame could not be analysed. With the shared frame pool the result
+ * also hands the slot back to the application core.
+ */
+struct fft_result_msg {
+	struct fft_stream_hdr hdr;
+#if defined(CONFIG_APP_FFT_LATENCY)
+	struct fft_result_times times;
+#endif
+#if defined(CONFIG_APP_FFT_STATS)
+	struct fft_result_stats stats;
+#endif
+	uint16_t bins[CONFIG_APP_FFT_TOP_BINS];
+};
+
+/**
+ * Clock offset sync. The application core sends app_tx, the remote core
+ * answers with the same message and adds when it received and answered
+ * it. Each time is in microseconds of the clock of the core that took it,
+ * low 32 bits, so the reply may wait for a frame without skewing the
+ * offset.
+ */
+struct fft_sync_msg {
+	struct fft_stream_hdr hdr;
+	uint32_t app_tx;     /**< Request sent, application core clock. */
+	uint32_t remote_rx;  /**< Request received, remote core clock. */
+	uint32_t remote_tx;  /**< Reply sent, remote core clock. */
+};
+
+/** Characters of a stage name in a profile row, with the terminating NUL. */
+#define FFT_PROFILE_NAME_LEN 16
+
+/**
+ * Row of the FFT stage profile, sent once a second by a remote core built
+ * with CONFIG_APP_FFT_PROFILE. The hdr.seq of all rows of one report is
+ * the same and hdr.count is the number of rows; the report is complete
+ * with row hdr.count - 1.
+ */
+struct fft_profile_msg {
+	struct fft_stream_hdr hdr;
+	uint16_t row;        /**< Row of the report, from 0. */
+	uint16_t frames;     /**< Frames the cycles are averaged over. */
+	uint32_t cycles;     /**< Remote core cycles of the stage per frame. */
+	char name[FFT_PROFILE_NAME_LEN];  /**< Stage name, NUL terminated. */
+};
+
+/** Windows of a configuration, numbered as fft_window_type_t of the remote core. */
+#define FFT_STREAM_WINDOW_RECT     0
+#define FFT_STREAM_WINDOW_HANN     1
+#define FFT_STREAM_WINDOW_HAMMING  2
+#define FFT_STREAM_WINDOW_BLACKMAN 3
+/** Request only: keep the window in effect. */
+#define FFT_STREAM_WINDOW_KEEP     0xff
+
+/**
+ * Analysis configuration, hdr.count is the frame length. The reply carries
+ * the hdr.seq of its request and the frame length and window in effect,
+ * those of the request, or the previous ones if it failed. Results sent
+ * before the reply are of frames of the previous length.
+ */
+struct fft_config_msg {
+	struct fft_stream_hdr hdr;
+	uint8_t window;   /**< One of FFT_STREAM_WINDOW_*. */
+	int8_t status;    /**< Reply only: 0, or the negative errno of the failure. */
+	uint16_t reserved;
+};
+
+/*
+ * Stages of a pipeline, the kind in the high nibble. A chain runs the
+ * kinds in this order: the frame samples, its FFT, the spectrum, and the
+ * messages sent of it. Each stage takes a parameter of its own.
+ */
+#define FFT_STAGE_KIND(id)        ((id) >> 4)
+#define FFT_STAGE_KIND_SAMPLES    1
+#define FFT_STAGE_KIND_FFT        2
+#define FFT_STAGE_KIND_SPECTRUM   3
+#define FFT_STAGE_KIND_SEND       4
+/** One-pole DC blocker, param the pole (Q15), 0 for 0.995. */
+#define FFT_STAGE_DC_BLOCK        0x10
+/** First-order pre-emphasis, param the coefficient (Q15), 0 for 0.97. */
+#define FFT_STAGE_PREEMPHASIS     0x11
+/** Window, param one of FFT_STREAM_WINDOW_*. */
+#define FFT_STAGE_WINDOW          0x12
+/** Real FFT and magnitude² of the frame, required, param unused. */
+#define FFT_STAGE_FFT             0x20
+/** Energies of param bands of equal width from bin 1 up to frame length / 2. */
+#define FFT_STAGE_BANDS           0x30
+/** Average fed to the power spectrum readout, CONFIG_APP_FFT_PSD, param unused. */
+#define FFT_STAGE_PSD             0x31
+/** The param strongest bins, 0 for CONFIG_APP_FFT_TOP_BINS. */
+#define FFT_STAGE_TOP_K           0x32
+/** Send the top bins in an FFT_STREAM_MSG_RESULT, needs FFT_STAGE_TOP_K. */
+#define FFT_STAGE_SEND_RESULT     0x40
+/** Send the band energies in an FFT_STREAM_MSG_BANDS, needs FFT_STAGE_BANDS. */
+#define FFT_STAGE_SEND_BANDS      0x41
+
+/** Largest number of stages of a pipeline. */
+#define FFT_PIPELINE_MAX_STAGES   10
+
+/** One stage of a pipeline. */
+struct fft_stage {
+	uint8_t id;       /**< One of FFT_STAGE_*. */
+	uint8_t reserved;
+	uint16_t param;   /**< Parameter of the stage. */
+};
+
+/**
+ * Chain of stages, hdr.count of them in the order they run. The reply
+ * carries the hdr.seq of its request and the chain in effect, that of the
+ * request, or the previous one if it failed. Results sent before the
+ * reply are of the previous chain.
+ */
+struct fft_pipeline_msg {
+	struct fft_stream_hdr hdr;
+	int8_t status;    /**< Reply only: 0, or the negative errno of the failure. */
+	uint8_t reserved[3];
+	struct fft_stage stages[FFT_PIPELINE_MAX_STAGES];
+};
+
+/** Version of struct fft_ctrl_msg, commands of another version are refused. */
+#define FFT_CTRL_VERSION 1
+/** Commands that may await their response at once, further ones go unanswered. */
+#define FFT_CTRL_MAX_PENDING 4
+
+/** Commands, arguments in arg[] and, for FFT_CTRL_GET_STATS, the reply. */
+#define FFT_CTRL_START       0x01  /**< Analyse the sample blocks again. */
+#define FFT_CTRL_STOP        0x02  /**< Drop the sample blocks from now on. */
+#define FFT_CTRL_GET_STATS   0x03  /**< Answered with struct fft_ctrl_stats_msg. */
+#define FFT_CTRL_REQUEST_PSD 0x04  /**< Power spectrum chunks follow the next result. */
+#define FFT_CTRL_SET_TOP_K   0x05  /**< arg[0] bins per result, 1 to APP_FFT_TOP_BINS. */
+#define FFT_CTRL_CONFIGURE   0x06  /**< arg[0] frame length, arg[1] FFT_STREAM_WINDOW_*. */
+/**
+ * CONFIG_APP_FFT_BANDS only: band arg[0] of the table, up to the number of
+ * bands so far, is bins arg[1] & 0xffff to arg[1] >> 16 from the next frame
+ * on. A first bin above the last ends the table at arg[0] instead. The
+ * response carries the number of bands.
+ */
+#define FFT_CTRL_SET_BAND    0x07
+/**
+ * CONFIG_APP_FFT_PERF only: answered with struct fft_ctrl_perf_msg. With
+ * arg[0] 1 the counters start over after the reply.
+ */
+#define FFT_CTRL_GET_PERF    0x08
+/**
+ * CONFIG_APP_FFT_BENCH only: run the benchmark matrix between two frames,
+ * its CSV rows on the console of the remote core. Answered once done,
+ * seconds later; the sample blocks that arrive meanwhile are dropped.
+ */
+#define FFT_CTRL_RUN_BENCH   0x09
+/** Set in the cmd of a response. */
+#define FFT_CTRL_RESPONSE    0x80
+
+/**
+ * Command of the application core, or with FFT_CTRL_RESPONSE the response
+ * of the remote core, which echoes the version, command and id and sets
+ * status. Each command is answered once, in the order they were sent,
+ * except that FFT_CTRL_CONFIGURE is answered when its frame length is in
+ * effect. The response of FFT_CTRL_CONFIGURE carries the frame length and
+ * window in effect, that of FFT_CTRL_SET_TOP_K the bins per result.
+ */
+struct fft_ctrl_msg {
+	uint8_t type;      /**< FFT_STREAM_MSG_CTRL. */
+	uint8_t version;   /**< FFT_CTRL_VERSION. */
+	uint8_t cmd;       /**< One of FFT_CTRL_*. */
+	int8_t status;     /**< Response only: 0, or the negative errno of the failure. */
+	uint32_t id;       /**< Chosen by the application core, echoed by the response. */
+	uint32_t arg[2];
+};
+
+/** Response to FFT_CTRL_GET_STATS, the counters since the stream was set up. */
+struct fft_ctrl_stats_msg {
+	struct fft_ctrl_msg ctrl;
+	uint32_t blocks;          /**< Sample blocks accepted. */
+	uint32_t frames;          /**< Frames completed. */
+	uint32_t lost_blocks;     /**< Blocks missing from the sequence, or sent while stopped. */
+	uint32_t dropped_blocks;  /**< Blocks discarded for want of a frame buffer. */
+	uint32_t dropped_frames;  /**< Overlapping frames skipped for want of a frame buffer. */
+	uint32_t bad_blocks;      /**< Malformed messages. */
+	uint32_t overruns;        /**< Runs of drops, from no free frame buffer to the next one. */
+	uint32_t late_frames;     /**< Frames completed while the one before was queued or in the FFT. */
+};
+
+/** Stages of a frame timed for FFT_CTRL_GET_PERF. */
+#define FFT_PERF_STAGE_ANALYSIS 0  /**< Window, FFT and spectrum of the frame. */
+#define FFT_PERF_STAGE_SEND     1  /**< Messages sent of the frame. */
+#define FFT_PERF_NUM_STAGES     2
+
+/** Cycles of the remote core one stage took per frame. */
+struct fft_perf_stage {
+	uint32_t avg_cycles;
+	uint32_t max_cycles;
+};
+
+/**
+ * Response to FFT_CTRL_GET_PERF, the counters since boot or since they
+ * were last started over. overruns and queue_high_water are those of the
+ * assembler, since the stream was set up as for FFT_CTRL_GET_STATS.
+ */
+struct fft_ctrl_perf_msg {
+	struct fft_ctrl_msg ctrl;
+	uint32_t frames;            /**< Frames analysed. */
+	uint32_t overruns;          /**< Runs of drops for want of a frame buffer. */
+	uint32_t ipc_retries;       /**< Sends retried for want of an IPC buffer. */
+	uint16_t queue_high_water;  /**< Most frames queued or in the FFT at once. */
+	uint16_t reserved;
+	uint32_t arena_high_water;  /**< Most bytes of the buffer arena in use at once. */
+	uint32_t arena_size;        /**< Bytes of the buffer arena. */
+	struct fft_perf_stage stage[FFT_PERF_NUM_STAGES];
+};
+
+/** Causes of an event, or 0 once the frame is back under every threshold. */
+#define FFT_EVENT_PEAK 0x01  /**< A top bin above its baseline. */
+#define FFT_EVENT_BAND 0x02  /**< The band energy above its baseline. */
+
+/**
+ * Change of the anomaly state, sent instead of the results for the frame
+ * hdr.seq whose causes differ from those of the frame before. hdr.count
+ * is the number of top bins, strongest first, fewer above the noise floor
+ * with CONFIG_APP_FFT_FLOOR. The message ends with the last of them.
+ */
+struct fft_event_msg {
+	struct fft_stream_hdr hdr;
+	uint8_t cause;            /**< FFT_EVENT_* of the frame. */
+	uint8_t reserved;
+	uint16_t peak_bin;        /**< Strongest top bin above its baseline, or 0. */
+	uint32_t peak;            /**< Its magnitude², Q31. */
+	uint32_t peak_baseline;   /**< Its average magnitude², Q31. */
+	uint32_t band_energy;     /**< Magnitude² summed over the band, saturated. */
+	uint32_t band_baseline;   /**< Average of that sum, saturated. */
+	uint16_t bins[CONFIG_APP_FFT_TOP_BINS];
+};
+
+#define FFT_EVENT_MSG_SIZE(n) \
+	(sizeof(struct fft_event_msg) - (CONFIG_APP_FFT_TOP_BINS - (n)) * sizeof(uint16_t))
+
+#if defined(CONFIG_APP_FFT_BANDS) || defined(CONFIG_APP_FFT_PIPELINE)
+/**
+ * Band energies of frame hdr.seq, in the order of the band table. hdr.count
+ * is the number of bands, 0 for a frame that could not be analysed. The
+ * message ends with the last band.
+ */
+struct fft_bands_msg {
+	struct fft_stream_hdr hdr;
+	uint32_t energy[CONFIG_APP_FFT_BANDS_MAX];  /**< Magnitude² summed over the band, saturated. */
+};
+
+#define FFT_BANDS_MSG_SIZE(n) (sizeof(struct fft_stream_hdr) + (n) * sizeof(uint32_t))
+#endif
+
+#if defined(CONFIG_APP_FFT_MEL)
+/**
+ * Filterbank features of frame hdr.seq, lowest filter or coefficient
+ * first. hdr.count is the number of features, 0 for a frame that could
+ * not be analysed. The message ends with the last feature.
+ */
+struct fft_features_msg {
+	struct fft_stream_hdr hdr;
+	/** Energies, or log2 energies or cepstral coefficients in Q8. */
+	int32_t features[CONFIG_APP_FFT_MEL_FILTERS];
+};
+
+#define FFT_FEATURES_MSG_SIZE(n) (sizeof(struct fft_stream_hdr) + (n) * sizeof(int32_t))
+#endif
+
+#if defined(CONFIG_APP_FFT_SPECTROGRAM)
+/**
+ * Spectrogram row of frame hdr.seq, lowest column first. Column c is the
+ * largest magnitude² of bins c * num_bins / hdr.count up to the first bin
+ * of column c + 1, as the 8-bit log code of psd_pack_log8(). Rows the
+ * link had no room for are dropped instead of waited for. The message
+ * ends with the last column.
+ */
+struct fft_spectrogram_msg {
+	struct fft_stream_hdr hdr;
+	uint16_t num_bins;  /**< Bins pooled into the columns, frame length / 2 + 1. */
+	uint16_t dropped;   /**< Rows dropped since the one before, saturated. */
+	uint8_t column[CONFIG_APP_FFT_SPECTROGRAM_COLUMNS];
+};
+
+#define FFT_SPECTROGRAM_MSG_SIZE(n) \
+	(sizeof(struct fft_stream_hdr) + 2 * sizeof(uint16_t) + (n))
+#endif
+
+#if defined(CONFIG_APP_FFT_TRACK)
+/** Changes of a place, numbered as SPECTRAL_TRACK_* of the remote core. */
+#define FFT_TRACK_ADDED   1  /**< The place holds a new peak, whatever it held before. */
+#define FFT_TRACK_REMOVED 2  /**< The place is free, bin is the peak it held. */
+#define FFT_TRACK_MOVED   3  /**< The peak of the place is at another bin. */
+
+/** In the hdr.slot of a track message: every place is free before the changes. */
+#define FFT_TRACK_RESTART 0x01
+
+/** Change of one place of the tracked top bins. */
+struct fft_track_change {
+	uint8_t op;     /**< FFT_TRACK_*. */
+	uint8_t place;  /**< Place, 0 to CONFIG_APP_FFT_TOP_BINS - 1. */
+	uint16_t bin;   /**< Bin the place holds now, or held for FFT_TRACK_REMOVED. */
+};
+
+/**
+ * Changes of the tracked top bins in frame hdr.seq, hdr.count of them and
+ * at most one per place. A frame that changed no place sends nothing, and
+ * neither does a frame that could not be analysed. With FFT_TRACK_RESTART
+ * in hdr.slot the set started over, for a new frame length or number of
+ * top bins. The message ends with the last change.
+ */
+struct fft_track_msg {
+	struct fft_stream_hdr hdr;
+	struct fft_track_change change[CONFIG_APP_FFT_TOP_BINS];
+};
+
+#define FFT_TRACK_MSG_SIZE(n) \
+	(sizeof(struct fft_stream_hdr) + (n) * sizeof(struct fft_track_change))
+#endif
+
+/** Pulses per tachometer message, at most. */
+#define FFT_TACHO_MSG_PULSES 8
+
+/**
+ * Tachometer pulses, one per revolution, oldest first. hdr.count is the
+ * number of pulses and hdr.seq the sample block they fall into, or the
+ * last of the blocks. A pulse is at a stream position in 1/256 samples,
+ * modulo 2^32: sample i of block seq is at (seq * CONFIG_APP_FFT_BLOCK_SAMPLES
+ * + i) * 256. The message ends with the last pulse.
+ */
+struct fft_tacho_msg {
+	struct fft_stream_hdr hdr;
+	uint32_t pos[FFT_TACHO_MSG_PULSES];
+};
+
+#define FFT_TACHO_MSG_SIZE(n) (sizeof(struct fft_stream_hdr) + (n) * sizeof(uint32_t))
+
+#define FFT_SAMPLE_BLOCK_SIZE(n) (sizeof(struct fft_stream_hdr) + (n) * sizeof(int16_t))
+#define FFT_SAMPLE_BLOCK_Q7_SIZE(n) (sizeof(struct fft_stream_hdr) + (n) * sizeof(int8_t))
+
+/** Bins per power spectrum chunk, so a chunk is no larger than a sample block. */
+#define FFT_PSD_MSG_BINS ((CONFIG_APP_FFT_BLOCK_SAMPLES - 2) / 2)
+
+/**
+ * Chunk of the averaged power spectrum, bins first_bin to
+ * first_bin + hdr.count - 1. The hdr.seq of all chunks of one readout is
+ * the same; the readout is complete with bin APP_FFT_FRAME_LEN / 2.
+ */
+struct fft_psd_msg {
+	struct fft_stream_hdr hdr;
+	uint16_t first_bin;  /**< Bin of bins[0]. */
+	uint16_t frames;     /**< Frames in the average. */
+	uint32_t bins[FFT_PSD_MSG_BINS];  /**< Averaged magnitude², Q31. */
+};
+
+#define FFT_PSD_MSG_SIZE(n) (sizeof(struct fft_stream_hdr) + 2 * sizeof(uint16_t) + \
+			     (n) * sizeof(uint32_t))
+
+/** Bytes of coded bins per chunk, a chunk is no larger than a plain one. */
+#define FFT_PSD_PACKED_MAX (FFT_PSD_MSG_BINS * sizeof(uint32_t))
+
+/**
+ * Chunk of the averaged power spectrum, bins first_bin to
+ * first_bin + hdr.count - 1 as the psd_pack.h byte stream in data, with
+ * a floor of CONFIG_APP_FFT_PSD_COMPACT_FLOOR. The bytes end with the
+ * message.
+ */
+struct fft_psd_packed_msg {
+	struct fft_stream_hdr hdr;
+	uint16_t first_bin;  /**< Bin the stream starts at. */
+	uint16_t frames;     /**< Frames in the average. */
+	uint8_t data[FFT_PSD_PACKED_MAX];
+};
+
+#define FFT_PSD_PACKED_MSG_SIZE(n) (sizeof(struct fft_stream_hdr) + 2 * sizeof(uint16_t) + (n))
+
+/**
+ * Clock the remote core asks for, in hdr.count MHz, with the load it
+ * decided on: the average per frame over the last decision, in cycles.
+ */
+struct fft_clock_msg {
+	struct fft_stream_hdr hdr;
+	uint32_t busy;    /**< Cycles of analysis per frame. */
+	uint32_t budget;  /**< Cycles of the full clock between two frames. */
+};
+
+/*
+ * Shed levels, each dropping the work of the ones below it as well. A
+ * level the build or frame length cannot use is passed over.
+ */
+#define FFT_SHED_NONE     0  /**< Every frame analysed in full. */
+#define FFT_SHED_HALF     1  /**< FFT of the newest half of each frame, bins still of the full length. */
+#define FFT_SHED_RECT     2  /**< No window. */
+#define FFT_SHED_TOP_K    3  /**< Half the top bins per result. */
+#define FFT_SHED_DECIMATE 4  /**< Every other frame only, the others answered with no bins. */
+#define FFT_SHED_LEVELS   5
+
+/**
+ * Shed level the remote core moved to, in hdr.count, with the load it
+ * decided on: the average per frame over the last decision, in cycles,
+ * before the move.
+ */
+struct fft_shed_msg {
+	struct fft_stream_hdr hdr;
+	uint32_t busy;    /**< Cycles of analysis per frame. */
+	uint32_t budget;  /**< Cycles between two frames. */
+};
+
+/**
+ * Half of a CFFT split by arm_cfft_q15_split(), hdr.count complex points at
+ * offset bytes into the shared frame pool, and hdr.seq to match the answer.
+ * An answer with a count of 0 left the half untouched. A request with a
+ * count of 0 withdraws the one of the same hdr.seq; the application core
+ * answers it, as the request itself, once it no longer touches the half.
+ */
+struct fft_coop_msg {
+	struct fft_stream_hdr hdr;
+	uint32_t offset;  /**< Bytes from the start of the pool to the half. */
+};
+
+/** Bytes of the image per chunk, whole RRAM write blocks no larger than a plain PSD chunk. */
+#define FFT_STORE_MSG_MAX ((FFT_PSD_MSG_BINS * sizeof(uint32_t)) & ~15U)
+
+/**
+ * Chunk of the state image, hdr.count bytes at offset bytes into the
+ * fft_store region, both multiples of its 16-byte write block; hdr.seq
+ * numbers the image.
+ */
+struct fft_store_msg {
+	struct fft_stream_hdr hdr;
+	uint32_t offset;  /**< Bytes from the start of the region to data. */
+	uint8_t data[FFT_STORE_MSG_MAX];
+};
+
+#define FFT_STORE_MSG_SIZE(n) (sizeof(struct fft_stream_hdr) + sizeof(uint32_t) + (n))
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* FFT_STREAM_MSG_H */
@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <errno.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/util.h>
+
+#include "ipc_batch.h"
+
+static inline struct ipc_batch_hdr *batch_hdr(struct ipc_batch *batch)
+{
+	return (struct ipc_batch_hdr *)batch->buf;
+}
+
+/* Called with batch->lock held. */
+static int batch_send(struct ipc_batch *batch)
+{
+	struct ipc_batch_hdr *hdr = batch_hdr(batch);
+	int ret;
+
+	if (hdr->records == 0) {
+		return 0;
+	}
+
+	hdr->len = batch->used - sizeof(*hdr);
+
+	ret = ipc_service_send(batch->ep, batch->buf, batch->used);
+	if (ret < 0) {
+		return ret;
+	}
+
+	hdr->records = 0;
+	batch->used = sizeof(*hdr);
+	batch->transfers++;
+
+	(void)k_work_cancel_delayable(&batch->flush_work);
+
+	return 0;
+}
+
+static void flush_work_handler(struct k_work *work)
+{
+	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+	struct ipc_batch *batch = CONTAINER_OF(dwork, struct ipc_batch, flush_work);
+
+	k_mutex_lock(&batch->lock, K_FOREVER);
+
+	if (batch_send(batch) == -ENOMEM) {
+		/* Try again once the receiver has had time to drain. */
+		(void)k_work_reschedule(&batch->flush_work, K_TICKS(1));
+	}
+
+	k_mutex_unlock(&batch->lock);
+}
+
+int ipc_batch_init(struct ipc_batch *batch, struct ipc_ept *ep, void *buf,
+		   size_t size, size_t threshold, k_timeout_t timeout)
+{
+	if (size < sizeof(struct ipc_batch_hdr) + IPC_BATCH_RECORD_SIZE(1)) {
+		return -EINVAL;
+	}
+
+	batch->ep = ep;
+	batch->buf = buf;
+	batch->size = ROUND_DOWN(size, IPC_BATCH_ALIGN);
+	batch->used = sizeof(struct ipc_batch_hdr);
+	batch->threshold = MIN(threshold, batch->size);
+	batch->timeout = timeout;
+	batch->transfers = 0;
+	batch_hdr(batch)->records = 0;
+
+	k_mutex_init(&batch->lock);
+	k_work_init_delayable(&batch->flush_work, flush_work_handler);
+
+	return 0;
+}
+
+int ipc_batch_add(struct ipc_batch *batch, const void *data, uint16_t len)
+{
+	size_t rec_size = IPC_BATCH_RECORD_SIZE(len);
+	uint16_t rec_len = len;
+	int ret = 0;
+
+	if (sizeof(struct ipc_batch_hdr) + rec_size > batch->size) {
+		return -EMSGSIZE;
+	}
+
+	k_mutex_lock(&batch->lock, K_FOREVER);
+
+	if (batch->used + rec_size > batch->size) {
+		ret = batch_send(batch);
+		if (ret < 0) {
+			goto out;
+		}
+	}
+
+	memcpy(&batch->buf[batch->used], &rec_len, sizeof(rec_len));
+	memcpy(&batch->buf[batch->used + sizeof(rec_len)], data, len);
+	batch->used += rec_size;
+	batch_hdr(batch)->records++;
+
+	if (batch->used >= batch->threshold) {
+		if (batch_send(batch) == -ENOMEM) {
+			/* The record is queued, the timeout will push it out. */
+			(void)k_work_schedule(&batch->flush_work, batch->timeout);
+		}
+	} else if (batch_hdr(batch)->records == 1) {
+		(void)k_work_schedule(&batch->flush_work, batch->timeout);
+	}
+
+out:
+	k_mutex_unlock(&batch->lock);
+
+	return ret;
+}
+
+int ipc_batch_flush(struct ipc_batch *batch)
+{
+	int ret;
+
+	k_mutex_lock(&batch->lock, K_FOREVER);
+	ret = batch_send(batch);
+	k_mutex_unlock(&batch->lock);
+
+	return ret;
+}
+
+int ipc_batch_unpack(const void *msg, size_t len, ipc_batch_record_cb_t cb, void *user_data)
+{
+	const uint8_t *p = msg;
+	struct ipc_batch_hdr hdr;
+	size_t pos = sizeof(hdr);
+	uint16_t rec_len;
+	int i;
+
+	if (len < sizeof(hdr)) {
+		return -EBADMSG;
+	}
+
+	memcpy(&hdr, p, sizeof(hdr));
+
+	if (sizeof(hdr) + hdr.len > len) {
+		return -EBADMSG;
+	}
+
+	len = sizeof(hdr) + hdr.len;
+
+	for (i = 0; i < hdr.records; i++) {
+		if (pos + sizeof(rec_len) > len) {
+			return -EBADMSG;
+		}
+
+		memcpy(&rec_len, &p[pos], sizeof(rec_len));
+
+		if (pos + sizeof(rec_len) + rec_len > len) {
+			return -EBADMSG;
+		}
+
+		cb(&p[pos + sizeof(rec_len)], rec_len, user_data);
+		pos += IPC_BATCH_RECORD_SIZE(rec_len);
+	}
+
+	return i;
+}
@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/*
+ * Batching of small IPC records. Records added to a batch are packed into
+ * one buffer and sent as a single IPC service transfer, either when the
+ * flush threshold is reached or when the oldest record has waited for the
+ * flush timeout. The receiver splits a transfer back into records with
+ * ipc_batch_unpack().
+ *
+ * Transfer layout, all fields little endian as on both cores:
+ *
+ *   struct ipc_batch_hdr | len | record | pad | len | record | pad | ...
+ *
+ * where len is a uint16_t and every length/record pair is padded to
+ * IPC_BATCH_ALIGN bytes.
+ */
+
+#ifndef IPC_BATCH_H
+#define IPC_BATCH_H
+
+#include <stdint.h>
+#include <zephyr/kernel.h>
+#include <zephyr/ipc/ipc_service.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define IPC_BATCH_ALIGN 4
+
+/** Space taken in a batch by a record of len bytes. */
+#define IPC_BATCH_RECORD_SIZE(len) ROUND_UP(sizeof(uint16_t) + (len), IPC_BATCH_ALIGN)
+
+/** Header of a batched transfer. */
+struct ipc_batch_hdr {
+	uint16_t records; /**< Number of records that follow. */
+	uint16_t len;     /**< Bytes following the header. */
+};
+
+struct ipc_batch {
+	struct ipc_ept *ep;
+	uint8_t *buf;
+	size_t size;
+	size_t used;
+	size_t threshold;
+	k_timeout_t timeout;
+	struct k_mutex lock;
+	struct k_work_delayable flush_work;
+	uint32_t transfers;   /**< Transfers sent so far. */
+};
+
+/**
+ * @brief Set up a batch sending to an endpoint.
+ *
+ * @param batch     Batch to initialise.
+ * @param ep        Bound endpoint the transfers are sent to.
+ * @param buf       Buffer the records are packed into. Its size bounds the
+ *                  size of a single transfer.
+ * @param size      Size of buf in bytes.
+ * @param threshold Send as soon as this many bytes are queued.
+ * @param timeout   Longest time a record waits in the batch.
+ *
+ * @retval 0 on success, -EINVAL if the buffer cannot hold a single record.
+ */
+int ipc_batch_init(struct ipc_batch *batch, struct ipc_ept *ep, void *buf,
+		   size_t size, size_t threshold, k_timeout_t timeout);
+
+/**
+ * @brief Queue a record.
+ *
+ * Sends the batch first when the record does not fit anymore, and after
+ * queuing it when the threshold is reached. Never blocks on the transport.
+ *
+ * @retval 0 when the record was queued.
+ * @retval -ENOMEM when the batch is full and the transport has no room,
+ *         the record was not queued.
+ * @retval -EMSGSIZE when the record is larger than the batch buffer.
+ * @retval other negative errno code returned by ipc_service_send().
+ */
+int ipc_batch_add(struct ipc_batch *batch, const void *data, uint16_t len);
+
+/**
+ * @brief Send all queued records now.
+ *
+ * @retval 0 on success or if nothing was queued.
+ * @retval -ENOMEM when the transport has no room, the records stay queued.
+ * @retval other negative errno code returned by ipc_service_send().
+ */
+int ipc_batch_flush(struct ipc_batch *batch);
+
+typedef void (*ipc_batch_record_cb_t)(const void *data, size_t len, void *user_data);
+
+/**
+ * @brief Split a received transfer into records.
+ *
+ * Calls cb for every record, in order. Safe to call from the IPC receive
+ * callback.
+ *
+ * @retval Number of records delivered, or -EBADMSG if the transfer is
+ *         malformed. Records before the malformed one are still delivered.
+ */
+int ipc_batch_unpack(const void *msg, size_t len, ipc_batch_record_cb_t cb, void *user_data);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* IPC_BATCH_H */
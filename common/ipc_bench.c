@@ -0,0 +1,547 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/sys/util.h>
+
+#include "ipc_bench.h"
+#include "fft_cache.h"
+#include "cycle_counter.h"
+
+BUILD_ASSERT(IPC_BENCH_MIN_LEN >= sizeof(struct ipc_bench_hdr));
+BUILD_ASSERT(CONFIG_APP_IPC_BENCH_MAX_LEN >= IPC_BENCH_MIN_LEN);
+
+#define ROUNDS CONFIG_APP_IPC_BENCH_ROUNDS
+
+/* Longest wait for a pong, the round is lost after it. */
+#define PONG_TIMEOUT K_MSEC(100)
+
+/* Rounds of the clock offset sync before each size. */
+#define SYNC_ROUNDS 8
+
+static const char *const transport_names[IPC_BENCH_NUM_TRANSPORTS] = {
+	[IPC_BENCH_IPC] = "ipc",
+	[IPC_BENCH_FRAME] = "frame",
+	[IPC_BENCH_RING] = "ring",
+	[IPC_BENCH_MBOX] = "mbox",
+};
+
+#if IPC_BENCH_SHM
+/*
+ * fft_pool in quarters: the ring towards the remote core, the ring back,
+ * then the frame area, in which the pong overwrites the ping.
+ */
+#define POOL_ADDR     DT_REG_ADDR(DT_NODELABEL(fft_pool))
+#define POOL_QUARTER  ROUND_DOWN(DT_REG_SIZE(DT_NODELABEL(fft_pool)) / 4, SHM_RING_ALIGN)
+#define RING_OUT_ADDR POOL_ADDR
+#define RING_BACK_ADDR (POOL_ADDR + POOL_QUARTER)
+#define FRAME_ADDR    (POOL_ADDR + 2 * POOL_QUARTER)
+#define FRAME_MAX_LEN MIN(2 * POOL_QUARTER, CONFIG_APP_IPC_BENCH_MAX_LEN)
+
+/* Two slots a ring, one ping in flight and the one a full ring keeps empty. */
+#define RING_MAX_LEN \
+	MIN(ROUND_DOWN((POOL_QUARTER - 2 * SHM_RING_ALIGN) / 2, SHM_RING_ALIGN), \
+	    CONFIG_APP_IPC_BENCH_MAX_LEN)
+#define RING_SLOT_SIZE SHM_RING_SLOT_SIZE(RING_MAX_LEN)
+#define RING_NUM_SLOTS SHM_RING_NUM_SLOTS(POOL_QUARTER, RING_MAX_LEN)
+
+BUILD_ASSERT(RING_MAX_LEN >= IPC_BENCH_MIN_LEN, "fft_pool too small for the benchmark rings");
+BUILD_ASSERT(FFT_CACHE_IS_ALIGNED(FRAME_ADDR), "frame area of fft_pool not cache aligned");
+
+static const struct mbox_dt_spec ring_mbox = MBOX_DT_SPEC_GET(DT_PATH(zephyr_user), fft_ring);
+static const struct mbox_dt_spec ack_mbox = MBOX_DT_SPEC_GET(DT_PATH(zephyr_user), bench_ack);
+
+/* bench_ack takes a VPR event of its own, enabled in the events mask of its mailbox. */
+#define ACK_CTLR    DT_MBOX_CTLR_BY_NAME(DT_PATH(zephyr_user), bench_ack)
+#define ACK_CHANNEL DT_MBOX_CHANNEL_BY_NAME(DT_PATH(zephyr_user), bench_ack)
+
+BUILD_ASSERT(DT_PROP_OR(ACK_CTLR, nordic_events_mask, BIT(ACK_CHANNEL)) & BIT(ACK_CHANNEL),
+	     "bench_ack event not in the nordic,events-mask of its mailbox");
+
+#if DT_NODE_HAS_STATUS(DT_NODELABEL(ipc1), okay)
+/*
+ * A channel number only names a channel of its controller: the events of
+ * the application core and the tasks of the FLPR core number apart. Of
+ * ipc1, only the direction on the controller of bench_ack can clash, rx
+ * on the application core and tx on the FLPR core.
+ */
+#define ACK_SHARES(name)                                                                          \
+	(DT_SAME_NODE(ACK_CTLR, DT_MBOX_CTLR_BY_NAME(DT_NODELABEL(ipc1), name)) &&                \
+	 (ACK_CHANNEL == DT_MBOX_CHANNEL_BY_NAME(DT_NODELABEL(ipc1), name)))
+
+BUILD_ASSERT(!ACK_SHARES(rx) && !ACK_SHARES(tx),
+	     "bench_ack shares its mailbox channel with ipc1, leave out the planes overlays");
+#endif
+#endif /* IPC_BENCH_SHM */
+
+/* Samples of a size, every round of it. */
+static uint32_t rtt_ns[ROUNDS];
+static int32_t out_us[ROUNDS];
+static int32_t back_us[ROUNDS];
+
+static uint32_t cycles_to_ns(uint32_t cycles)
+{
+	return (uint32_t)((uint64_t)cycles * 1000000000U / CYCLE_COUNTER_HZ);
+}
+
+/* Stretch from a to b, on one clock or with the offset taken out. */
+static int32_t elapsed(uint32_t a, uint32_t b)
+{
+	return (int32_t)(b - a);
+}
+
+static int cmp_u32(const void *a, const void *b)
+{
+	uint32_t x = *(const uint32_t *)a;
+	uint32_t y = *(const uint32_t *)b;
+
+	return (x > y) - (x < y);
+}
+
+/* Sorted samples in nanoseconds, printed in microseconds. */
+static void print_row(const char *backend, const char *transport, const char *stat,
+		      uint32_t len, uint32_t *ns, uint32_t n, uint32_t lost)
+{
+	uint32_t p50;
+	uint32_t p99;
+
+	if (n == 0) {
+		printk("bench,%s,%s,%s,%u,0,%u,,,,\n", backend, transport, stat, len, lost);
+		return;
+	}
+
+	qsort(ns, n, sizeof(ns[0]), cmp_u32);
+	p50 = ns[(n - 1) / 2];
+	p99 = ns[MIN(n - 1, n * 99U / 100U)];
+
+	printk("bench,%s,%s,%s,%u,%u,%u,%u.%03u,%u.%03u,%u.%03u,%u.%03u\n", backend, transport,
+	       stat, len, n, lost, ns[0] / 1000U, ns[0] % 1000U, p50 / 1000U, p50 % 1000U,
+	       p99 / 1000U, p99 % 1000U, ns[n - 1] / 1000U, ns[n - 1] % 1000U);
+}
+
+/* One-way microseconds, clamped to 0 where the offset overshoots, as nanoseconds. */
+static void us_to_ns(const int32_t *us, uint32_t *ns, uint32_t n)
+{
+	for (uint32_t i = 0; i < n; i++) {
+		ns[i] = (us[i] > 0) ? (uint32_t)us[i] * 1000U : 0;
+	}
+}
+
+static int send_retry(struct ipc_bench *bench, const void *data, size_t len)
+{
+	int ret;
+
+	do {
+		ret = ipc_service_send(bench->ep, data, len);
+	} while (ret == -ENOMEM);
+
+	return (ret < 0) ? ret : 0;
+}
+
+/* Note the pong of the round waited for, late ones of a lost round are dropped. */
+static void pong_recv(struct ipc_bench *bench, const struct ipc_bench_hdr *hdr, uint32_t cycles,
+		      uint32_t us)
+{
+	if (hdr->seq != bench->seq) {
+		return;
+	}
+
+	bench->pong = *hdr;
+	bench->pong_cycles = cycles;
+	bench->pong_us = us;
+	k_sem_give(&bench->pong_sem);
+}
+
+#if IPC_BENCH_SHM
+/* The message of buf handed over in the frame area, the header tells where. */
+static int frame_send(struct ipc_bench *bench, uint8_t type, size_t len)
+{
+	struct ipc_bench_hdr *hdr = bench->buf;
+
+	hdr->type = type;
+	memcpy((void *)FRAME_ADDR, bench->buf, len);
+	fft_cache_flush((void *)FRAME_ADDR, len);
+
+	return send_retry(bench, hdr, sizeof(*hdr));
+}
+
+/* The header of the message in the frame area, as the other core wrote it. */
+static const struct ipc_bench_hdr *frame_recv(size_t len)
+{
+	fft_cache_invd((void *)FRAME_ADDR, ROUND_UP(len, FFT_CACHE_LINE));
+
+	return (const struct ipc_bench_hdr *)FRAME_ADDR;
+}
+
+/* The message of buf as the next record of the ring, rung if the reader is idle. */
+static int ring_send(struct ipc_bench *bench, size_t len)
+{
+	void *slot = shm_ring_reserve(&bench->tx_ring);
+
+	if (slot == NULL) {
+		return -EBUSY;
+	}
+
+	memcpy(slot, bench->buf, len);
+
+	return shm_ring_commit(&bench->tx_ring);
+}
+
+/*
+ * A doorbell of the other core, on either side: with a record in the ring
+ * a ring ping or pong, without one a bare mbox round.
+ */
+static void doorbell_cb(const struct device *dev, mbox_channel_id_t channel_id, void *user_data,
+			struct mbox_msg *data)
+{
+	struct ipc_bench *bench = user_data;
+	uint32_t cycles = read_cycle();
+	uint32_t us = read_cycle_us();
+	const struct ipc_bench_hdr *rec;
+	struct ipc_bench_hdr hdr;
+	struct ipc_bench_hdr *pong = bench->buf;
+
+	ARG_UNUSED(dev);
+	ARG_UNUSED(channel_id);
+	ARG_UNUSED(data);
+
+	rec = shm_ring_peek(&bench->rx_ring);
+	if (rec == NULL) {
+		if (bench->pinger) {
+			hdr = (struct ipc_bench_hdr){
+				.transport = IPC_BENCH_MBOX,
+				.seq = bench->seq,
+			};
+			pong_recv(bench, &hdr, cycles, us);
+		} else {
+			(void)mbox_send_dt(bench->tx_mbox, NULL);
+		}
+		return;
+	}
+
+	hdr = *rec;
+	shm_ring_release(&bench->rx_ring);
+
+	if (bench->pinger) {
+		pong_recv(bench, &hdr, cycles, us);
+		return;
+	}
+
+	if (hdr.len > CONFIG_APP_IPC_BENCH_MAX_LEN) {
+		return;
+	}
+
+	*pong = hdr;
+	pong->type = IPC_BENCH_MSG_PONG;
+	pong->remote_rx = us;
+	pong->remote_tx = read_cycle_us();
+	(void)ring_send(bench, hdr.len);
+}
+#endif /* IPC_BENCH_SHM */
+
+int ipc_bench_init(struct ipc_bench *bench, struct ipc_ept *ep, void *buf, bool pinger)
+{
+	memset(bench, 0, sizeof(*bench));
+	bench->ep = ep;
+	bench->buf = buf;
+	bench->pinger = pinger;
+	k_sem_init(&bench->pong_sem, 0, 1);
+
+	memset(buf, 0xA5, CONFIG_APP_IPC_BENCH_MAX_LEN);
+	cycle_counter_init();
+
+#if IPC_BENCH_SHM
+	bench->tx_mbox = pinger ? &ring_mbox : &ack_mbox;
+	bench->rx_mbox = pinger ? &ack_mbox : &ring_mbox;
+
+	return shm_ring_init_writer(&bench->tx_ring,
+				    (void *)(pinger ? RING_OUT_ADDR : RING_BACK_ADDR),
+				    RING_NUM_SLOTS, RING_SLOT_SIZE, bench->tx_mbox);
+#else
+	return 0;
+#endif
+}
+
+int ipc_bench_start(struct ipc_bench *bench)
+{
+#if IPC_BENCH_SHM
+	int ret;
+
+	ret = shm_ring_init_reader(&bench->rx_ring,
+				   (void *)(bench->pinger ? RING_BACK_ADDR : RING_OUT_ADDR),
+				   RING_NUM_SLOTS, RING_SLOT_SIZE);
+	if (ret < 0) {
+		return ret;
+	}
+
+	ret = mbox_register_callback_dt(bench->rx_mbox, doorbell_cb, bench);
+	if (ret < 0) {
+		return ret;
+	}
+
+	return mbox_set_enabled_dt(bench->rx_mbox, true);
+#else
+	ARG_UNUSED(bench);
+
+	return 0;
+#endif
+}
+
+/* Send the ping of a round over the transport. */
+static int ping(struct ipc_bench *bench, enum ipc_bench_transport transport, size_t len)
+{
+	switch (transport) {
+	case IPC_BENCH_IPC:
+		return send_retry(bench, bench->buf, len);
+#if IPC_BENCH_SHM
+	case IPC_BENCH_FRAME:
+		return frame_send(bench, IPC_BENCH_MSG_FRAME, len);
+	case IPC_BENCH_RING:
+		return ring_send(bench, len);
+	case IPC_BENCH_MBOX:
+		return mbox_send_dt(bench->tx_mbox, NULL);
+#endif
+	default:
+		return -ENOTSUP;
+	}
+}
+
+/* A timed round, the stamps of the pong in bench->pong. */
+static int round_trip(struct ipc_bench *bench, enum ipc_bench_transport transport, size_t len,
+		      uint32_t *cycles, uint32_t *app_tx)
+{
+	struct ipc_bench_hdr *hdr = bench->buf;
+	uint32_t start;
+	int ret;
+
+	*hdr = (struct ipc_bench_hdr){
+		.type = IPC_BENCH_MSG_PING,
+		.transport = transport,
+		.len = len,
+		.seq = ++bench->seq,
+	};
+	k_sem_reset(&bench->pong_sem);
+
+	*app_tx = read_cycle_us();
+	start = read_cycle();
+	ret = ping(bench, transport, len);
+	if (ret < 0) {
+		return ret;
+	}
+
+	ret = k_sem_take(&bench->pong_sem, PONG_TIMEOUT);
+	if (ret < 0) {
+		return ret;
+	}
+
+	*cycles = bench->pong_cycles - start;
+
+	return 0;
+}
+
+/*
+ * Remote clock minus application clock, NTP style from the fastest of a
+ * few of the smallest ipc rounds, the most symmetric path there is. Taken
+ * again before each size, the clocks of the cores drift apart.
+ */
+static int32_t sync_offset(struct ipc_bench *bench)
+{
+	uint32_t best = UINT32_MAX;
+	int32_t offset = 0;
+	uint32_t cycles;
+	uint32_t app_tx;
+
+	for (int i = 0; i < SYNC_ROUNDS; i++) {
+		if ((round_trip(bench, IPC_BENCH_IPC, IPC_BENCH_MIN_LEN, &cycles, &app_tx) == 0) &&
+		    (cycles < best)) {
+			best = cycles;
+			offset = (elapsed(app_tx, bench->pong.remote_rx) +
+				  elapsed(bench->pong_us, bench->pong.remote_tx)) / 2;
+		}
+	}
+
+	return offset;
+}
+
+/*
+ * Every round of one size, and its rows. Returns the rounds that got their
+ * pong, or the error of the first ping.
+ */
+static int run_size(struct ipc_bench *bench, const char *backend,
+		    enum ipc_bench_transport transport, size_t len)
+{
+	const char *name = transport_names[transport];
+	int32_t offset = 0;
+	uint32_t lost = 0;
+	uint32_t n = 0;
+	uint32_t cycles;
+	uint32_t app_tx;
+	int ret;
+
+	if (transport != IPC_BENCH_MBOX) {
+		offset = sync_offset(bench);
+	}
+
+	/* Round 0 warms the caches and the code path up, it is not counted. */
+	for (uint32_t round = 0; round <= ROUNDS; round++) {
+		ret = round_trip(bench, transport, len, &cycles, &app_tx);
+		if ((ret < 0) && (ret != -EAGAIN) && (n == 0)) {
+			return ret;
+		} else if (ret < 0) {
+			lost++;
+			continue;
+		}
+
+		if (round == 0) {
+			continue;
+		}
+
+		rtt_ns[n] = cycles_to_ns(cycles);
+		out_us[n] = elapsed(app_tx, bench->pong.remote_rx - offset);
+		back_us[n] = elapsed(bench->pong.remote_tx - offset, bench->pong_us);
+		n++;
+	}
+
+	if (transport == IPC_BENCH_MBOX) {
+		print_row(backend, name, "rtt", 0, rtt_ns, n, lost);
+		/* Doorbell to callback, half of a round trip that has nothing else in it. */
+		for (uint32_t i = 0; i < n; i++) {
+			rtt_ns[i] /= 2U;
+		}
+		print_row(backend, name, "irq", 0, rtt_ns, n, lost);
+		return n;
+	}
+
+	print_row(backend, name, "rtt", len, rtt_ns, n, lost);
+	/* Sorted in place, the one-way samples reuse it. */
+	us_to_ns(out_us, rtt_ns, n);
+	print_row(backend, name, "out", len, rtt_ns, n, lost);
+	us_to_ns(back_us, rtt_ns, n);
+	print_row(backend, name, "back", len, rtt_ns, n, lost);
+
+	return n;
+}
+
+int ipc_bench_run(struct ipc_bench *bench, size_t max_len, const char *backend)
+{
+	size_t limit[IPC_BENCH_NUM_TRANSPORTS] = {
+		[IPC_BENCH_IPC] = MIN(max_len, CONFIG_APP_IPC_BENCH_MAX_LEN),
+#if IPC_BENCH_SHM
+		[IPC_BENCH_FRAME] = FRAME_MAX_LEN,
+		[IPC_BENCH_RING] = RING_MAX_LEN,
+		[IPC_BENCH_MBOX] = IPC_BENCH_MIN_LEN,
+#endif
+	};
+	size_t len;
+	int ret;
+
+	printk("Bench %s: %u rounds a size, %u to %u B, %u Hz cycle counter%s\n", backend, ROUNDS,
+	       IPC_BENCH_MIN_LEN, (uint32_t)limit[IPC_BENCH_IPC], CYCLE_COUNTER_HZ,
+	       IPC_BENCH_SHM ? "" : ", no fft_pool or bench_ack channel: ipc only");
+	printk("bench,backend,transport,stat,len,rounds,lost,min_us,p50_us,p99_us,max_us\n");
+
+	for (int transport = 0; transport < IPC_BENCH_NUM_TRANSPORTS; transport++) {
+		len = IPC_BENCH_MIN_LEN;
+
+		while ((limit[transport] != 0) && (len <= limit[transport])) {
+			ret = run_size(bench, backend, transport, len);
+			if ((ret == -EMSGSIZE) || (ret == -EINVAL) || (ret == 0)) {
+				printk("Bench %s %s stopped, %u B messages do not get through\n",
+				       backend, transport_names[transport], (uint32_t)len);
+				break;
+			} else if (ret < 0) {
+				printk("Bench %s %s %u B failed with ret %d\n", backend,
+				       transport_names[transport], (uint32_t)len, ret);
+				return ret;
+			}
+
+			/* The largest size always gets a step of its own. */
+			len = (len < limit[transport]) ? MIN(len * 2U, limit[transport])
+						       : limit[transport] + 1U;
+		}
+	}
+
+	printk("Bench %s done\n", backend);
+
+	return 0;
+}
+
+/* The remote core's pong of an ipc or frame ping. */
+static void answer(struct ipc_bench *bench, const struct ipc_bench_hdr *ping, uint32_t rx_us)
+{
+	struct ipc_bench_hdr *pong = bench->buf;
+	int ret;
+
+	if (ping->len > CONFIG_APP_IPC_BENCH_MAX_LEN) {
+		printk("Bench ping of %u B over CONFIG_APP_IPC_BENCH_MAX_LEN\n", ping->len);
+		return;
+	}
+
+	*pong = *ping;
+	pong->remote_rx = rx_us;
+	pong->remote_tx = read_cycle_us();
+
+	if (ping->type == IPC_BENCH_MSG_PING) {
+		pong->type = IPC_BENCH_MSG_PONG;
+		ret = send_retry(bench, pong, ping->len);
+	} else {
+#if IPC_BENCH_SHM
+		ret = frame_send(bench, IPC_BENCH_MSG_FRAME_PONG, ping->len);
+#else
+		ret = -ENOTSUP;
+#endif
+	}
+
+	if (ret < 0) {
+		printk("send_message(bench pong %u) failed with ret %d\n", ping->seq, ret);
+	}
+}
+
+void ipc_bench_recv(struct ipc_bench *bench, const void *data, size_t len)
+{
+	const struct ipc_bench_hdr *hdr = data;
+	uint32_t cycles = read_cycle();
+	uint32_t us = read_cycle_us();
+
+	if (len < sizeof(*hdr)) {
+		printk("Malformed bench message, len: %d\n", len);
+		return;
+	}
+
+	switch (hdr->type) {
+	case IPC_BENCH_MSG_PING:
+		answer(bench, hdr, us);
+		break;
+
+	case IPC_BENCH_MSG_PONG:
+		pong_recv(bench, hdr, cycles, us);
+		break;
+
+#if IPC_BENCH_SHM
+	case IPC_BENCH_MSG_FRAME:
+	case IPC_BENCH_MSG_FRAME_PONG:
+		if (hdr->len > FRAME_MAX_LEN) {
+			printk("Malformed bench frame, len: %u\n", hdr->len);
+			return;
+		}
+
+		if (hdr->type == IPC_BENCH_MSG_FRAME) {
+			answer(bench, frame_recv(hdr->len), us);
+		} else {
+			pong_recv(bench, frame_recv(hdr->len), cycles, us);
+		}
+		break;
+#endif
+
+	default:
+		printk("Unexpected bench message type: %d\n", hdr->type);
+		break;
+	}
+}
@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/*
+ * Latency microbenchmark of the transports between the cores. The
+ * application core pings, the remote core answers each ping at once with
+ * a pong of the same size, and only one ping is in flight, so every round
+ * is the latency of an idle transport. Message sizes go from
+ * IPC_BENCH_MIN_LEN by powers of two up to the largest the transport
+ * takes, CONFIG_APP_IPC_BENCH_ROUNDS rounds each, and the application
+ * core prints the minimum, p50, p99 and maximum of each size as a CSV row.
+ *
+ * The transports:
+ *  - ipc: the message through ipc_service_send(), both ways.
+ *  - frame: the message written into the fft_pool region, with the cache
+ *    written back, and a bare header through ipc_service_send() that
+ *    points the other core at it, as the shared frame pool does.
+ *  - ring: the message as a record of a struct shm_ring in the fft_pool
+ *    region, one ring each way, woken by its doorbell.
+ *  - mbox: a bare doorbell each way, no data, whose half round trip is
+ *    the interrupt latency of a mailbox channel.
+ * Frame, ring and mbox need the fft_pool region and the fft_ring and
+ * bench_ack mailbox channels of the zephyr,user node on both cores.
+ *
+ * Round trips are timed on the cycle counter of the application core.
+ * Each pong carries when the remote core took the ping and sent the pong,
+ * on its microsecond clock, so a transport that carries data also gets
+ * its one-way latency in each direction: the clock offset between the
+ * cores is taken, NTP style, from the fastest round of the size, and
+ * subtracted from the stamps of every round.
+ *
+ * Every message on the endpoint starts with struct ipc_bench_hdr, so both
+ * cores must run the benchmark.
+ */
+
+#ifndef IPC_BENCH_H
+#define IPC_BENCH_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <zephyr/kernel.h>
+#include <zephyr/devicetree.h>
+#include <zephyr/ipc/ipc_service.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Frame, ring and mbox run where both cores have the region and the channels. */
+#define IPC_BENCH_SHM                                                                             \
+	(DT_NODE_EXISTS(DT_NODELABEL(fft_pool)) &&                                                \
+	 DT_PROP_HAS_NAME(DT_PATH(zephyr_user), mboxes, fft_ring) &&                              \
+	 DT_PROP_HAS_NAME(DT_PATH(zephyr_user), mboxes, bench_ack))
+
+#if IPC_BENCH_SHM
+#include <zephyr/drivers/mbox.h>
+#include "shm_ring.h"
+#endif
+
+/** Application -> remote: ping of a round, the whole message through IPC. */
+#define IPC_BENCH_MSG_PING       0x28
+/** Remote -> application: pong of the same size. */
+#define IPC_BENCH_MSG_PONG       0x29
+/** Application -> remote: the message is in the frame area of fft_pool. */
+#define IPC_BENCH_MSG_FRAME      0x2a
+/** Remote -> application: the pong is in the frame area. */
+#define IPC_BENCH_MSG_FRAME_PONG 0x2b
+
+/** Smallest message of the benchmark, the header alone. */
+#define IPC_BENCH_MIN_LEN 16
+
+enum ipc_bench_transport {
+	IPC_BENCH_IPC,
+	IPC_BENCH_FRAME,
+	IPC_BENCH_RING,
+	IPC_BENCH_MBOX,
+	IPC_BENCH_NUM_TRANSPORTS,
+};
+
+struct ipc_bench_hdr {
+	uint8_t type;        /**< One of IPC_BENCH_MSG_*. */
+	uint8_t transport;   /**< enum ipc_bench_transport. */
+	uint16_t len;        /**< Message size of the round in bytes. */
+	uint32_t seq;        /**< Round, the pong keeps that of its ping. */
+	uint32_t remote_rx;  /**< Pong: ping taken, remote core microseconds. */
+	uint32_t remote_tx;  /**< Pong: pong sent, remote core microseconds. */
+};
+
+struct ipc_bench {
+	struct ipc_ept *ep;
+	void *buf;                  /**< CONFIG_APP_IPC_BENCH_MAX_LEN, word aligned. */
+	bool pinger;                /**< The application core's side. */
+	/* Application core: the pong of the round it waits for. */
+	struct k_sem pong_sem;
+	uint32_t seq;
+	struct ipc_bench_hdr pong;
+	uint32_t pong_cycles;       /**< Cycle counter when it arrived. */
+	uint32_t pong_us;
+#if IPC_BENCH_SHM
+	struct shm_ring tx_ring;
+	struct shm_ring rx_ring;
+	const struct mbox_dt_spec *tx_mbox;
+	const struct mbox_dt_spec *rx_mbox;
+#endif
+};
+
+/**
+ * @brief Set up either side of the benchmark on an endpoint.
+ *
+ * Empties the ring this core writes, so call it before the endpoint is
+ * registered.
+ *
+ * @param bench  Benchmark state to initialise.
+ * @param ep     Endpoint of the benchmark, registered or about to be.
+ * @param buf    Buffer for the messages, word aligned, of
+ *               CONFIG_APP_IPC_BENCH_MAX_LEN bytes.
+ * @param pinger True on the application core, which runs the benchmark,
+ *               false on the remote core, which answers.
+ *
+ * @retval 0 on success, or the error of the ring.
+ */
+int ipc_bench_init(struct ipc_bench *bench, struct ipc_ept *ep, void *buf, bool pinger);
+
+/**
+ * @brief Start taking the rings and doorbells of the other core.
+ *
+ * Call on both cores once the endpoint is bound, the other core has
+ * emptied its ring by then. Does nothing without IPC_BENCH_SHM.
+ *
+ * @retval 0 on success, or the error of the ring or the mailbox.
+ */
+int ipc_bench_start(struct ipc_bench *bench);
+
+/**
+ * @brief Run every transport and size as the application core.
+ *
+ * A size that does not go out ends its transport there, the transport
+ * cannot take it.
+ *
+ * @param bench   Benchmark state, started.
+ * @param max_len Largest message size of ipc, IPC_BENCH_MIN_LEN to
+ *                CONFIG_APP_IPC_BENCH_MAX_LEN.
+ * @param backend Name of the backend, for the output.
+ *
+ * @retval 0 on success, or a negative errno code of a transport.
+ */
+int ipc_bench_run(struct ipc_bench *bench, size_t max_len, const char *backend);
+
+/**
+ * @brief Handle a message of the benchmark, on either side.
+ *
+ * Call from the endpoint receive callback. The remote core answers each
+ * ping from here.
+ *
+ * @param bench Benchmark state.
+ * @param data  Received message.
+ * @param len   Length of the received message.
+ */
+void ipc_bench_recv(struct ipc_bench *bench, const void *data, size_t len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* IPC_BENCH_H */
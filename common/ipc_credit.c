@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <errno.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/atomic.h>
+
+#include "ipc_credit.h"
+
+static void grant_work_handler(struct k_work *work)
+{
+	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+	struct ipc_credit *fc = CONTAINER_OF(dwork, struct ipc_credit, grant_work);
+	struct ipc_credit_hdr grant = {
+		.type = IPC_CREDIT_MSG_GRANT,
+	};
+	atomic_val_t n;
+	int ret;
+
+	n = atomic_clear(&fc->pending);
+	if (n == 0) {
+		/* A data message took the credits along. */
+		return;
+	}
+
+	grant.credits = n;
+
+	ret = ipc_service_send(fc->ep, &grant, sizeof(grant));
+	if (ret < 0) {
+		/* Keep the credits owed and try again shortly. */
+		(void)atomic_add(&fc->pending, n);
+		(void)k_work_reschedule(&fc->grant_work, K_TICKS(1));
+	}
+}
+
+int ipc_credit_init(struct ipc_credit *fc, struct ipc_ept *ep, uint16_t window)
+{
+	if (window == 0) {
+		return -EINVAL;
+	}
+
+	fc->ep = ep;
+	fc->grant_threshold = MAX(window / 2, 1);
+	fc->stalls = 0;
+	atomic_clear(&fc->pending);
+
+	k_sem_init(&fc->credits, window, window);
+	k_work_init_delayable(&fc->grant_work, grant_work_handler);
+
+	return 0;
+}
+
+int ipc_credit_send(struct ipc_credit *fc, void *msg, size_t len, k_timeout_t timeout)
+{
+	struct ipc_credit_hdr *hdr = msg;
+	atomic_val_t n;
+	int ret;
+
+	if (k_sem_take(&fc->credits, K_NO_WAIT) != 0) {
+		fc->stalls++;
+
+		ret = k_sem_take(&fc->credits, timeout);
+		if (ret != 0) {
+			return -EAGAIN;
+		}
+	}
+
+	n = atomic_clear(&fc->pending);
+
+	hdr->type = IPC_CREDIT_MSG_DATA;
+	hdr->reserved = 0;
+	hdr->credits = n;
+
+	ret = ipc_service_send(fc->ep, msg, len);
+	if (ret < 0) {
+		(void)atomic_add(&fc->pending, n);
+		k_sem_give(&fc->credits);
+	}
+
+	return ret;
+}
+
+int ipc_credit_recv(struct ipc_credit *fc, const void *data, size_t len,
+		    const void **payload, size_t *payload_len)
+{
+	struct ipc_credit_hdr hdr;
+
+	if (len < sizeof(hdr)) {
+		return -EBADMSG;
+	}
+
+	memcpy(&hdr, data, sizeof(hdr));
+
+	for (uint16_t i = 0; i < hdr.credits; i++) {
+		k_sem_give(&fc->credits);
+	}
+
+	switch (hdr.type) {
+	case IPC_CREDIT_MSG_DATA:
+		*payload = (const uint8_t *)data + sizeof(hdr);
+		*payload_len = len - sizeof(hdr);
+		return 1;
+	case IPC_CREDIT_MSG_GRANT:
+		return 0;
+	default:
+		return -EBADMSG;
+	}
+}
+
+void ipc_credit_release(struct ipc_credit *fc)
+{
+	if (atomic_inc(&fc->pending) + 1 >= fc->grant_threshold) {
+		(void)k_work_schedule(&fc->grant_work, K_NO_WAIT);
+	}
+}
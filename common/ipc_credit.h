@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/*
+ * Credit based flow control for an IPC endpoint. The sender starts with a
+ * window of credits and spends one per message. The receiver gives credits
+ * back as it drains messages, piggybacked on its own data messages or in a
+ * standalone grant message when it has nothing to send. A sender out of
+ * credits blocks on a semaphore instead of retrying on -ENOMEM.
+ *
+ * Every message on the endpoint starts with struct ipc_credit_hdr, so both
+ * cores must use the flow control.
+ */
+
+#ifndef IPC_CREDIT_H
+#define IPC_CREDIT_H
+
+#include <stdint.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/ipc/ipc_service.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Message carrying data, and possibly credits. */
+#define IPC_CREDIT_MSG_DATA  0x10
+/** Message carrying only credits. Does not consume a credit. */
+#define IPC_CREDIT_MSG_GRANT 0x11
+
+struct ipc_credit_hdr {
+	uint8_t type;     /**< One of IPC_CREDIT_MSG_*. */
+	uint8_t reserved;
+	uint16_t credits; /**< Credits returned to the peer. */
+};
+
+struct ipc_credit {
+	struct ipc_ept *ep;
+	struct k_sem credits;          /**< Credits we may spend. */
+	atomic_t pending;              /**< Credits owed to the peer. */
+	uint16_t grant_threshold;
+	struct k_work_delayable grant_work;
+	uint32_t stalls;               /**< Sends that had to wait for a credit. */
+};
+
+/**
+ * @brief Set up flow control on a bound endpoint.
+ *
+ * @param fc     Flow control state to initialise.
+ * @param ep     Endpoint used for data and grants.
+ * @param window Credits each side starts with, the number of messages the
+ *               transport must be able to hold at once.
+ *
+ * @retval 0 on success, -EINVAL for an empty window.
+ */
+int ipc_credit_init(struct ipc_credit *fc, struct ipc_ept *ep, uint16_t window);
+
+/**
+ * @brief Send a data message, waiting for a credit if needed.
+ *
+ * @param fc      Flow control state.
+ * @param msg     Message to send. Must start with a struct ipc_credit_hdr,
+ *                which this function fills in.
+ * @param len     Length of the whole message, header included.
+ * @param timeout Longest time to wait for a credit.
+ *
+ * @retval Number of bytes sent, -EAGAIN if no credit arrived in time, or a
+ *         negative errno code returned by ipc_service_send().
+ */
+int ipc_credit_send(struct ipc_credit *fc, void *msg, size_t len, k_timeout_t timeout);
+
+/**
+ * @brief Process the header of a received message.
+ *
+ * Takes over the credits granted by the peer. Call from the endpoint
+ * receive callback before handling the payload.
+ *
+ * @param fc   Flow control state.
+ * @param data Received message.
+ * @param len  Length of the received message.
+ * @param[out] payload     Set to the data following the header.
+ * @param[out] payload_len Set to the length of the payload.
+ *
+ * @retval 1 if the message carries a payload, which must be returned with
+ *         ipc_credit_release() once drained.
+ * @retval 0 for a pure grant.
+ * @retval -EBADMSG for a malformed message.
+ */
+int ipc_credit_recv(struct ipc_credit *fc, const void *data, size_t len,
+		    const void **payload, size_t *payload_len);
+
+/**
+ * @brief Return the credit of a drained message to the peer.
+ *
+ * Safe to call from the receive callback, the grant is sent from the system
+ * work queue unless a data message takes it along first.
+ */
+void ipc_credit_release(struct ipc_credit *fc);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* IPC_CREDIT_H */
@@ -0,0 +1,247 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <errno.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+
+#include "ipc_sweep.h"
+
+BUILD_ASSERT(IPC_SWEEP_MIN_LEN >= sizeof(struct ipc_sweep_hdr));
+
+static const char *const pacing_names[IPC_SWEEP_NUM_PACINGS] = {
+	[IPC_SWEEP_SPIN] = "spin",
+	[IPC_SWEEP_INTERVAL] = "interval",
+	[IPC_SWEEP_YIELD] = "yield",
+};
+
+static uint32_t bit_rate(uint32_t bytes, uint32_t us)
+{
+	return (us == 0) ? 0 : (uint32_t)((uint64_t)bytes * 8U * 1000000U / us);
+}
+
+void ipc_sweep_init(struct ipc_sweep *sweep, struct ipc_ept *ep)
+{
+	memset(sweep, 0, sizeof(*sweep));
+	sweep->ep = ep;
+	k_sem_init(&sweep->report_sem, 0, 1);
+}
+
+/* Send messages of the step's size for a step, paced as asked. */
+static int send_step(struct ipc_sweep *sweep, void *buf, struct ipc_sweep_report *tx,
+		     enum ipc_sweep_pacing pacing, uint32_t *retries)
+{
+	struct ipc_sweep_hdr *hdr = buf;
+	int64_t start = k_uptime_ticks();
+	int64_t end = start + k_ms_to_ticks_ceil64(CONFIG_APP_IPC_SWEEP_STEP_MS);
+	int ret;
+
+	*hdr = tx->hdr;
+	hdr->type = IPC_SWEEP_MSG_DATA;
+
+	while (k_uptime_ticks() < end) {
+		hdr->seq = tx->msgs;
+
+		ret = ipc_service_send(sweep->ep, buf, tx->hdr.len);
+		if (ret == -ENOMEM) {
+			(*retries)++;
+			if (pacing == IPC_SWEEP_YIELD) {
+				k_sleep(K_TICKS(1));
+			}
+			continue;
+		} else if (ret < 0) {
+			return ret;
+		}
+
+		tx->msgs++;
+		tx->bytes += tx->hdr.len;
+
+		if (pacing != IPC_SWEEP_INTERVAL) {
+			continue;
+		}
+
+		if (CONFIG_APP_IPC_SERVICE_SEND_INTERVAL < 1000) {
+			k_busy_wait(CONFIG_APP_IPC_SERVICE_SEND_INTERVAL);
+		} else {
+			k_msleep(CONFIG_APP_IPC_SERVICE_SEND_INTERVAL / 1000);
+		}
+	}
+
+	tx->us = k_ticks_to_us_floor32(k_uptime_ticks() - start);
+
+	return 0;
+}
+
+/* Tell the receiver the step is over and wait for its report. */
+static int end_step(struct ipc_sweep *sweep, const struct ipc_sweep_report *tx)
+{
+	struct ipc_sweep_hdr end = tx->hdr;
+	int64_t timeout = k_uptime_get() + CONFIG_APP_IPC_SWEEP_STEP_MS;
+	int ret;
+
+	/* Carries how many were sent, for the ones lost at the tail. */
+	end.type = IPC_SWEEP_MSG_END;
+	end.seq = tx->msgs;
+
+	do {
+		ret = ipc_service_send(sweep->ep, &end, sizeof(end));
+		if (ret == -ENOMEM) {
+			k_sleep(K_TICKS(1));
+		}
+	} while ((ret == -ENOMEM) && (k_uptime_get() < timeout));
+
+	if (ret < 0) {
+		return ret;
+	}
+
+	return k_sem_take(&sweep->report_sem, K_MSEC(CONFIG_APP_IPC_SWEEP_STEP_MS));
+}
+
+int ipc_sweep_run(struct ipc_sweep *sweep, void *buf, size_t max_len, const char *backend)
+{
+	struct {
+		uint32_t len;
+		uint32_t bps;
+	} best[IPC_SWEEP_NUM_PACINGS] = { 0 };
+	struct ipc_sweep_report tx;
+	uint32_t retries;
+	uint8_t step = 0;
+	size_t len = IPC_SWEEP_MIN_LEN;
+	int ret;
+
+	memset(buf, 0xA5, max_len);
+
+	printk("Sweep %s: %u to %u B, %u ms per step\n", backend, IPC_SWEEP_MIN_LEN,
+	       (uint32_t)max_len, CONFIG_APP_IPC_SWEEP_STEP_MS);
+
+	while (len <= max_len) {
+		for (int pacing = 0; pacing < IPC_SWEEP_NUM_PACINGS; pacing++, step++) {
+			memset(&tx, 0, sizeof(tx));
+			tx.hdr.step = step;
+			tx.hdr.len = len;
+			retries = 0;
+			k_sem_reset(&sweep->report_sem);
+
+			ret = send_step(sweep, buf, &tx, pacing, &retries);
+			if ((ret == -EMSGSIZE) || (ret == -EINVAL) || ((ret == 0) && (tx.msgs == 0))) {
+				printk("Sweep %s stopped, %u B messages do not fit\n", backend,
+				       (uint32_t)len);
+				goto done;
+			} else if (ret < 0) {
+				printk("send_message(sweep %u B) failed with ret %d\n", (uint32_t)len,
+				       ret);
+				return ret;
+			}
+
+			ret = end_step(sweep, &tx);
+			if ((ret < 0) || (sweep->report.hdr.step != step)) {
+				/* The receiver's side of the step stays unknown. */
+				memset(&sweep->report, 0, sizeof(sweep->report));
+			}
+
+			printk("Sweep %s %4u B %-8s TX %6u msg %9u bit/s retries %6u | "
+			       "RX %6u msg %9u bit/s lost %u\n", backend, (uint32_t)len,
+			       pacing_names[pacing], tx.msgs, bit_rate(tx.bytes, tx.us), retries,
+			       sweep->report.msgs, bit_rate(sweep->report.bytes, sweep->report.us),
+			       sweep->report.lost);
+
+			if (bit_rate(sweep->report.bytes, sweep->report.us) > best[pacing].bps) {
+				best[pacing].len = len;
+				best[pacing].bps = bit_rate(sweep->report.bytes, sweep->report.us);
+			}
+		}
+
+		/* The largest size always gets a step of its own. */
+		len = (len < max_len) ? MIN(len * 2U, max_len) : max_len + 1U;
+	}
+
+done:
+	for (int pacing = 0; pacing < IPC_SWEEP_NUM_PACINGS; pacing++) {
+		printk("Sweep %s best %-8s %4u B at %u bit/s\n", backend, pacing_names[pacing],
+		       best[pacing].len, best[pacing].bps);
+	}
+
+	return 0;
+}
+
+void ipc_sweep_recv(struct ipc_sweep *sweep, const void *data, size_t len)
+{
+	const struct ipc_sweep_hdr *hdr = data;
+	struct ipc_sweep_report *rx = &sweep->rx;
+	int64_t now = k_uptime_ticks();
+	int ret;
+
+	if (len < sizeof(*hdr)) {
+		printk("Malformed sweep message, len: %d\n", len);
+		return;
+	}
+
+	switch (hdr->type) {
+	case IPC_SWEEP_MSG_DATA:
+		if ((rx->msgs == 0) || (hdr->step != rx->hdr.step)) {
+			/* First message of a step. */
+			memset(rx, 0, sizeof(*rx));
+			rx->hdr.step = hdr->step;
+			rx->hdr.len = hdr->len;
+			sweep->next_seq = 0;
+			sweep->first_ticks = now;
+		}
+
+		if ((int32_t)(hdr->seq - sweep->next_seq) > 0) {
+			rx->lost += hdr->seq - sweep->next_seq;
+		}
+		sweep->next_seq = hdr->seq + 1;
+		sweep->last_ticks = now;
+		rx->msgs++;
+		rx->bytes += len;
+		break;
+
+	case IPC_SWEEP_MSG_END:
+		if ((rx->msgs == 0) || (hdr->step != rx->hdr.step)) {
+			/* Nothing of the step arrived. */
+			memset(rx, 0, sizeof(*rx));
+			rx->hdr.step = hdr->step;
+			rx->hdr.len = hdr->len;
+			sweep->next_seq = 0;
+			sweep->first_ticks = sweep->last_ticks = now;
+		}
+
+		if ((int32_t)(hdr->seq - sweep->next_seq) > 0) {
+			rx->lost += hdr->seq - sweep->next_seq;
+		}
+		rx->hdr.type = IPC_SWEEP_MSG_REPORT;
+		rx->hdr.seq = hdr->seq;
+		rx->us = k_ticks_to_us_floor32(sweep->last_ticks - sweep->first_ticks);
+
+		ret = ipc_service_send(sweep->ep, rx, sizeof(*rx));
+		if (ret < 0) {
+			printk("send_message(sweep report %u) failed with ret %d\n", rx->hdr.step,
+			       ret);
+		}
+
+		printk("Sweep RX %4u B: %6u msg %9u bit/s lost %u\n", rx->hdr.len, rx->msgs,
+		       bit_rate(rx->bytes, rx->us), rx->lost);
+
+		/* The next step starts afresh. */
+		rx->msgs = 0;
+		break;
+
+	case IPC_SWEEP_MSG_REPORT:
+		if (len != sizeof(sweep->report)) {
+			printk("Malformed sweep report, len: %d\n", len);
+			return;
+		}
+
+		memcpy(&sweep->report, data, sizeof(sweep->report));
+		k_sem_give(&sweep->report_sem);
+		break;
+
+	default:
+		printk("Unexpected sweep message type: %d\n", hdr->type);
+		break;
+	}
+}
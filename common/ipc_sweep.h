@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/*
+ * Throughput sweep of an IPC endpoint at run time. The sender steps through
+ * message sizes, from IPC_SWEEP_MIN_LEN by powers of two up to the largest
+ * the backend takes, and through the pacing strategies of enum
+ * ipc_sweep_pacing, each step for CONFIG_APP_IPC_SWEEP_STEP_MS. At the end
+ * of a step the receiver reports what arrived: messages, bytes, messages
+ * missing from the sequence and the time from the first to the last. The
+ * sender prints both sides of every step and, once done, the best step of
+ * each pacing strategy.
+ *
+ * Every message on the endpoint starts with struct ipc_sweep_hdr, so both
+ * cores must run the sweep.
+ */
+
+#ifndef IPC_SWEEP_H
+#define IPC_SWEEP_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <zephyr/kernel.h>
+#include <zephyr/ipc/ipc_service.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Sender -> receiver: filler of the message size of the step. */
+#define IPC_SWEEP_MSG_DATA   0x20
+/** Sender -> receiver: end of the step, a bare header. */
+#define IPC_SWEEP_MSG_END    0x21
+/** Receiver -> sender: struct ipc_sweep_report of the step that ended. */
+#define IPC_SWEEP_MSG_REPORT 0x22
+
+/** Smallest message of the sweep, the header and a little filler. */
+#define IPC_SWEEP_MIN_LEN 16
+
+enum ipc_sweep_pacing {
+	IPC_SWEEP_SPIN,      /**< Retry -ENOMEM at once, no pause between messages. */
+	IPC_SWEEP_INTERVAL,  /**< Busy wait CONFIG_APP_IPC_SERVICE_SEND_INTERVAL after each. */
+	IPC_SWEEP_YIELD,     /**< Sleep a tick on -ENOMEM, no pause otherwise. */
+	IPC_SWEEP_NUM_PACINGS,
+};
+
+struct ipc_sweep_hdr {
+	uint8_t type;     /**< One of IPC_SWEEP_MSG_*. */
+	uint8_t step;     /**< Step of the sweep, from 0. */
+	uint16_t len;     /**< Message size of the step in bytes. */
+	uint32_t seq;     /**< Message of the step, from 0. */
+};
+
+/** What the receiver got of a step. */
+struct ipc_sweep_report {
+	struct ipc_sweep_hdr hdr;
+	uint32_t msgs;
+	uint32_t bytes;
+	uint32_t lost;    /**< Messages missing from the sequence. */
+	uint32_t us;      /**< From the first message to the last. */
+};
+
+struct ipc_sweep {
+	struct ipc_ept *ep;
+	/* Sender: the report of the step it waits for. */
+	struct k_sem report_sem;
+	struct ipc_sweep_report report;
+	/* Receiver: the step being received. */
+	struct ipc_sweep_report rx;
+	uint32_t next_seq;
+	int64_t first_ticks;
+	int64_t last_ticks;
+};
+
+/**
+ * @brief Set up either side of the sweep on an endpoint.
+ *
+ * @param sweep Sweep state to initialise.
+ * @param ep    Endpoint of the sweep, registered or about to be.
+ */
+void ipc_sweep_init(struct ipc_sweep *sweep, struct ipc_ept *ep);
+
+/**
+ * @brief Run the whole sweep as the sender, once the endpoint is bound.
+ *
+ * A step in which not a single message of its size goes out ends the
+ * sweep there, the backend cannot take the size.
+ *
+ * @param sweep   Sweep state.
+ * @param buf     Buffer for the messages, word aligned, of max_len bytes.
+ * @param max_len Largest message size, at least IPC_SWEEP_MIN_LEN.
+ * @param backend Name of the backend, for the output.
+ *
+ * @retval 0 on success, or a negative errno code returned by
+ *         ipc_service_send().
+ */
+int ipc_sweep_run(struct ipc_sweep *sweep, void *buf, size_t max_len, const char *backend);
+
+/**
+ * @brief Handle a message of the sweep, on either side.
+ *
+ * Call from the endpoint receive callback. The receiver answers the end of
+ * a step with its report from here.
+ *
+ * @param sweep Sweep state.
+ * @param data  Received message.
+ * @param len   Length of the received message.
+ */
+void ipc_sweep_recv(struct ipc_sweep *sweep, const void *data, size_t len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* IPC_SWEEP_H */
@@ -0,0 +1,306 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/devicetree.h>
+#include <zephyr/sys/util.h>
+
+#if !defined(__riscv) && defined(CONFIG_CPU_CORTEX_M_HAS_DWT)
+#include <cmsis_core.h>
+#endif
+
+#include "ipc_trace.h"
+
+#define RING_LEN CONFIG_APP_IPC_TRACE_RING_LEN
+
+BUILD_ASSERT((RING_LEN & (RING_LEN - 1)) == 0, "APP_IPC_TRACE_RING_LEN must be a power of two");
+BUILD_ASSERT(RING_LEN >= IPC_TRACE_STALL_EVENTS, "APP_IPC_TRACE_RING_LEN below the stall dump");
+
+#if defined(__riscv)
+/* The FLPR core clock, which the cycle CSR counts. */
+#define TRACE_HZ DT_PROP_OR(DT_NODELABEL(cpuflpr), clock_frequency, 128000000)
+
+static inline uint32_t trace_now(void)
+{
+	uint32_t cycle;
+
+	__asm__ volatile ("rdcycle %0" : "=r"(cycle));
+	return cycle;
+}
+#elif defined(CONFIG_CPU_CORTEX_M_HAS_DWT)
+#define TRACE_HZ SystemCoreClock
+
+static inline uint32_t trace_now(void)
+{
+	return DWT->CYCCNT;
+}
+#else
+#define TRACE_HZ sys_clock_hw_cycles_per_sec()
+
+static inline uint32_t trace_now(void)
+{
+	return k_cycle_get_32();
+}
+#endif
+
+static const char *const dir_names[IPC_TRACE_NUM_DIRS] = { "TX", "RX" };
+
+static struct k_spinlock lock;
+
+/* Last events, kept for the stall dump and for a debugger. */
+static struct ipc_trace_event ring[RING_LEN];
+static uint32_t ring_head;
+
+static struct ipc_trace_stats stats[IPC_TRACE_NUM_DIRS];
+static uint32_t last_cycles[IPC_TRACE_NUM_DIRS];
+static bool have_last[IPC_TRACE_NUM_DIRS];
+static uint32_t stall_cycles;
+
+/* Events up to the first stall since the last report. */
+static struct ipc_trace_event stall_events[IPC_TRACE_STALL_EVENTS];
+static uint32_t stall_num_events;
+static uint32_t stall_gap;
+
+static struct ipc_trace_summary peer;
+static bool peer_new;
+
+static struct ipc_trace_summary local;
+
+static uint32_t cycles_to_us(uint32_t cycles)
+{
+	return (uint32_t)(((uint64_t)cycles * 1000000U) / TRACE_HZ);
+}
+
+/* Bucket of a gap, its bit length. */
+static uint32_t gap_bucket(uint32_t gap)
+{
+	return (gap == 0) ? 0 : 32 - __builtin_clz(gap);
+}
+
+static uint32_t gap_count(const struct ipc_trace_stats *st)
+{
+	uint32_t count = 0;
+
+	for (uint32_t b = 0; b < IPC_TRACE_GAP_BUCKETS; b++) {
+		count += st->gaps[b];
+	}
+
+	return count;
+}
+
+/* Gap below which permille of the gaps lie, in us, capped to the longest. */
+static uint32_t gap_percentile(const struct ipc_trace_stats *st, uint32_t permille)
+{
+	uint32_t count = gap_count(st);
+	uint64_t rank = ((uint64_t)count * permille + 999) / 1000;
+	uint64_t seen = 0;
+
+	if (count == 0) {
+		return 0;
+	}
+
+	rank = MAX(rank, 1);
+
+	for (uint32_t b = 0; b < IPC_TRACE_GAP_BUCKETS; b++) {
+		seen += st->gaps[b];
+		if (seen >= rank) {
+			uint32_t upper = (b == 32) ? UINT32_MAX : (1U << b) - 1;
+
+			return cycles_to_us(MIN(upper, st->max_gap));
+		}
+	}
+
+	return cycles_to_us(st->max_gap);
+}
+
+void ipc_trace_init(void)
+{
+#if !defined(__riscv) && defined(CONFIG_CPU_CORTEX_M_HAS_DWT)
+#if defined(CONFIG_ARMV8_M_MAINLINE)
+	DCB->DEMCR |= DCB_DEMCR_TRCENA_Msk;
+#else
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+#endif
+	DWT->CYCCNT = 0;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+
+	stall_cycles = (uint32_t)(((uint64_t)CONFIG_APP_IPC_TRACE_STALL_US * TRACE_HZ) / 1000000U);
+
+	printk("IPC trace: %u Hz cycle counter, stall above %u us\n",
+	       (uint32_t)TRACE_HZ, CONFIG_APP_IPC_TRACE_STALL_US);
+}
+
+void ipc_trace_record(enum ipc_trace_dir dir, size_t len, uint32_t retries,
+		      uint32_t occupancy)
+{
+	uint32_t now = trace_now();
+	struct ipc_trace_stats *st = &stats[dir];
+	struct ipc_trace_event *ev;
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&lock);
+
+	ev = &ring[ring_head & (RING_LEN - 1)];
+	ev->cycles = now;
+	ev->len = (uint16_t)MIN(len, UINT16_MAX);
+	ev->retries = (uint16_t)MIN(retries, UINT16_MAX);
+	ev->dir = dir;
+	ev->occupancy = (uint8_t)MIN(occupancy, UINT8_MAX);
+	ring_head++;
+
+	st->msgs++;
+	st->bytes += len;
+	st->retries += retries;
+	st->max_occupancy = MAX(st->max_occupancy, (uint16_t)MIN(occupancy, UINT16_MAX));
+
+	if (have_last[dir]) {
+		uint32_t gap = now - last_cycles[dir];
+
+		st->gaps[gap_bucket(gap)]++;
+		st->max_gap = MAX(st->max_gap, gap);
+
+		if (gap > stall_cycles) {
+			st->stalls++;
+
+			/* Freeze the first stall only, until it is reported. */
+			if (stall_num_events == 0) {
+				stall_num_events = MIN(ring_head, IPC_TRACE_STALL_EVENTS);
+				stall_gap = gap;
+				for (uint32_t i = 0; i < stall_num_events; i++) {
+					stall_events[i] = ring[(ring_head - stall_num_events + i) &
+							       (RING_LEN - 1)];
+				}
+			}
+		}
+	}
+
+	last_cycles[dir] = now;
+	have_last[dir] = true;
+
+	k_spin_unlock(&lock, key);
+}
+
+void ipc_trace_peer_recv(const void *data, size_t len)
+{
+	const uint8_t *p = data;
+	struct ipc_trace_summary s;
+	k_spinlock_key_t key;
+	uint32_t seq;
+
+	if (len < sizeof(s)) {
+		return;
+	}
+
+	/* Most payloads still carry the summary already taken. */
+	memcpy(&seq, p + offsetof(struct ipc_trace_summary, seq), sizeof(seq));
+	if (seq == peer.seq) {
+		return;
+	}
+
+	memcpy(&s, p, sizeof(s));
+	if (s.seq_end != ~s.seq) {
+		/* Torn by the check task of the other core, or no summary yet. */
+		return;
+	}
+
+	key = k_spin_lock(&lock);
+	peer = s;
+	peer_new = true;
+	k_spin_unlock(&lock, key);
+}
+
+static void print_stats(const char *who, enum ipc_trace_dir dir, const struct ipc_trace_stats *st)
+{
+	printk("%s %s: %u msg, %u bit/s | retries: %u | max queue: %u | "
+	       "gap p50/p99/max: %u/%u/%u us | stalls: %u\n",
+	       who, dir_names[dir], st->msgs, st->bytes * 8, st->retries, st->max_occupancy,
+	       gap_percentile(st, 500), gap_percentile(st, 990), cycles_to_us(st->max_gap),
+	       st->stalls);
+
+	if (gap_count(st) == 0) {
+		return;
+	}
+
+	/* Nonzero buckets by their upper bound, in us with three decimals. */
+	printk("%s %s gaps [us]:", who, dir_names[dir]);
+	for (uint32_t b = 0; b < IPC_TRACE_GAP_BUCKETS; b++) {
+		uint64_t ns;
+
+		if (st->gaps[b] == 0) {
+			continue;
+		}
+
+		ns = ((uint64_t)1 << b) * 1000000000U / TRACE_HZ;
+		printk(" <%u.%03u:%u", (uint32_t)(ns / 1000U), (uint32_t)(ns % 1000U), st->gaps[b]);
+	}
+	printk("\n");
+}
+
+void ipc_trace_report(const char *who, void *summary)
+{
+	/* Off the stack of the check task, there is only one caller. */
+	static struct ipc_trace_stats st[IPC_TRACE_NUM_DIRS];
+	static struct ipc_trace_event ev[IPC_TRACE_STALL_EVENTS];
+	struct ipc_trace_summary p;
+	uint32_t num_events;
+	uint32_t gap;
+	bool have_peer;
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&lock);
+	memcpy(st, stats, sizeof(st));
+	memset(stats, 0, sizeof(stats));
+	num_events = stall_num_events;
+	gap = stall_gap;
+	memcpy(ev, stall_events, sizeof(ev));
+	stall_num_events = 0;
+	p = peer;
+	have_peer = peer_new;
+	peer_new = false;
+	k_spin_unlock(&lock, key);
+
+	for (int dir = 0; dir < IPC_TRACE_NUM_DIRS; dir++) {
+		print_stats(who, dir, &st[dir]);
+	}
+
+	if (have_peer) {
+		printk("Peer TX: %u msg, %u bit/s | retries: %u | max queue: %u | "
+		       "gap p50/p99/max: %u/%u/%u us | stalls: %u | RX: %u msg\n",
+		       p.tx_msgs, p.tx_bytes * 8, p.tx_retries, p.max_occupancy,
+		       p.gap_p50_us, p.gap_p99_us, p.gap_max_us, p.stalls, p.rx_msgs);
+	}
+
+	if (num_events > 0) {
+		printk("%s stall of %u us, last events [dir len retries queue +us]:\n",
+		       who, cycles_to_us(gap));
+		for (uint32_t i = 0; i < num_events; i++) {
+			printk("  %s %u %u %u +%u\n", dir_names[ev[i].dir], ev[i].len,
+			       ev[i].retries, ev[i].occupancy,
+			       cycles_to_us(ev[i].cycles - ev[0].cycles));
+		}
+	}
+
+	/*
+	 * The caller is cooperative, so this is never interrupted by the sender.
+	 * A sender preempted while copying the payload takes seq from the last
+	 * summary and seq_end from this one, which the peer discards.
+	 */
+	local.seq++;
+	local.tx_msgs = st[IPC_TRACE_TX].msgs;
+	local.tx_bytes = st[IPC_TRACE_TX].bytes;
+	local.tx_retries = st[IPC_TRACE_TX].retries;
+	local.rx_msgs = st[IPC_TRACE_RX].msgs;
+	local.gap_p50_us = gap_percentile(&st[IPC_TRACE_TX], 500);
+	local.gap_p99_us = gap_percentile(&st[IPC_TRACE_TX], 990);
+	local.gap_max_us = cycles_to_us(st[IPC_TRACE_TX].max_gap);
+	local.max_occupancy = st[IPC_TRACE_TX].max_occupancy;
+	local.stalls = st[IPC_TRACE_TX].stalls;
+	local.seq_end = ~local.seq;
+
+	memcpy(summary, &local, sizeof(local));
+}
@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/*
+ * Tracer of the IPC throughput test. Every message sent or received is
+ * stamped with the cycle counter of the core, the RISC-V cycle CSR on the
+ * FLPR core and the DWT cycle counter on a Cortex-M core, and goes into a
+ * ring of the last CONFIG_APP_IPC_TRACE_RING_LEN events together with the
+ * -ENOMEM retries it took and the occupancy of the transmit queue.
+ *
+ * Per direction, the tracer also counts messages, bytes and retries and
+ * keeps a histogram of the gaps between consecutive messages, so bursts and
+ * stalls show up instead of being averaged over a second. A gap longer than
+ * CONFIG_APP_IPC_TRACE_STALL_US freezes the events that led up to it.
+ *
+ * Once a second ipc_trace_report() prints and clears all of that, and
+ * writes a summary into the test payload, which the other core prints next
+ * to its own receive side.
+ */
+
+#ifndef IPC_TRACE_H
+#define IPC_TRACE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <zephyr/kernel.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Gaps by bit length: bucket b counts gaps of 2^(b-1) to 2^b - 1 cycles. */
+#define IPC_TRACE_GAP_BUCKETS 33
+
+/** Events kept from before a stall. */
+#define IPC_TRACE_STALL_EVENTS 8
+
+enum ipc_trace_dir {
+	IPC_TRACE_TX,
+	IPC_TRACE_RX,
+	IPC_TRACE_NUM_DIRS,
+};
+
+struct ipc_trace_event {
+	uint32_t cycles;    /**< Cycle counter when the message was sent or received. */
+	uint16_t len;       /**< Message length in bytes. */
+	uint16_t retries;   /**< -ENOMEM retries before it went out. */
+	uint8_t dir;        /**< One of enum ipc_trace_dir. */
+	uint8_t occupancy;  /**< Messages queued for the peer, 0 if unknown. */
+	uint16_t reserved;
+};
+
+/** Traffic in one direction since the last report. */
+struct ipc_trace_stats {
+	uint32_t msgs;
+	uint32_t bytes;
+	uint32_t retries;
+	uint32_t max_gap;         /**< Longest gap in cycles. */
+	uint16_t max_occupancy;
+	uint16_t stalls;          /**< Gaps over CONFIG_APP_IPC_TRACE_STALL_US. */
+	uint32_t gaps[IPC_TRACE_GAP_BUCKETS];
+};
+
+/**
+ * Transmit side of one core over the last second, as written into the test
+ * payload. It is only valid if seq_end is ~seq: the sender may copy the
+ * payload while the check task rewrites it, and the 0xA5 filler of a payload
+ * sent before the first report must not pass for a summary.
+ */
+struct ipc_trace_summary {
+	uint32_t seq;
+	uint32_t tx_msgs;
+	uint32_t tx_bytes;
+	uint32_t tx_retries;
+	uint32_t rx_msgs;         /**< Messages the core received in the same second. */
+	uint32_t gap_p50_us;
+	uint32_t gap_p99_us;
+	uint32_t gap_max_us;
+	uint16_t max_occupancy;
+	uint16_t stalls;
+	uint32_t seq_end;         /**< ~seq, written last. */
+};
+
+/**
+ * @brief Start the cycle counter. Call once before the first message.
+ */
+void ipc_trace_init(void);
+
+/**
+ * @brief Record a message sent or received.
+ *
+ * Safe to call from the receive callback, in interrupt context included.
+ *
+ * @param dir       Direction of the message.
+ * @param len       Length of the message in bytes.
+ * @param retries   -ENOMEM retries it took, 0 when received.
+ * @param occupancy Messages queued for the peer after it, 0 if unknown.
+ */
+void ipc_trace_record(enum ipc_trace_dir dir, size_t len, uint32_t retries,
+		      uint32_t occupancy);
+
+/**
+ * @brief Take the summary the other core wrote into a received payload.
+ *
+ * @param data Payload data following the counters, as written by
+ *             ipc_trace_report() on the other core.
+ * @param len  Bytes of data.
+ */
+void ipc_trace_peer_recv(const void *data, size_t len);
+
+/**
+ * @brief Print the traffic since the last report and clear it.
+ *
+ * Prints both directions with their gap histograms, the summary last
+ * received from the other core and the events before a stall, if any.
+ * Call about every second from a cooperative thread, so that it cannot be
+ * preempted by the sender while it writes the summary.
+ *
+ * @param who     Name of this core in the output.
+ * @param summary Payload data the local summary is written to, at least
+ *                sizeof(struct ipc_trace_summary) bytes.
+ */
+void ipc_trace_report(const char *who, void *summary);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* IPC_TRACE_H */
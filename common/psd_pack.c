@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <errno.h>
+
+#include "psd_pack.h"
+
+/* Escape and run length, a readout has fewer bins than PSD_PACK_TOKEN_MAX codes. */
+static size_t put_run(uint8_t *out, uint32_t run)
+{
+	size_t n = 0;
+
+	out[n++] = PSD_PACK_RUN;
+
+	while (run >= 0x80) {
+		out[n++] = (uint8_t)(run | 0x80);
+		run >>= 7;
+	}
+	out[n++] = (uint8_t)run;
+
+	return n;
+}
+
+size_t psd_pack_encode(uint8_t *out, size_t size, const uint32_t *bins, uint32_t num_bins,
+		       uint8_t floor, uint32_t *coded)
+{
+	/* Leaves room for the run that may still be open. */
+	const size_t limit = size - PSD_PACK_TOKEN_MAX;
+	uint32_t run = 0;
+	uint32_t i;
+	size_t n = 0;
+
+	for (i = 0; i < num_bins; i++) {
+		uint8_t code = psd_pack_log8(bins[i]);
+
+		if (code < floor) {
+			run++;
+			continue;
+		}
+
+		if (run > 0) {
+			if (n + PSD_PACK_TOKEN_MAX > limit) {
+				break;
+			}
+			n += put_run(&out[n], run);
+			run = 0;
+		}
+
+		if (n >= limit) {
+			break;
+		}
+		out[n++] = code;
+	}
+
+	if (run > 0) {
+		/* Bins below the floor up to i, which are never left out. */
+		n += put_run(&out[n], run);
+	}
+
+	*coded = i;
+
+	return n;
+}
+
+int psd_pack_decode(const uint8_t *in, size_t len, psd_pack_bin_cb cb, void *user_data)
+{
+	uint32_t bin = 0;
+	size_t pos = 0;
+
+	while (pos < len) {
+		uint32_t run = 0;
+		uint32_t shift = 0;
+
+		if (in[pos] != PSD_PACK_RUN) {
+			cb(bin++, in[pos++], user_data);
+			continue;
+		}
+
+		pos++;
+		do {
+			if ((pos == len) || (shift > 14)) {
+				return -EBADMSG;
+			}
+			run |= (uint32_t)(in[pos] & 0x7f) << shift;
+			shift += 7;
+		} while (in[pos++] & 0x80);
+
+		bin += run;
+	}
+
+	return (int)bin;
+}
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/*
+ * Compact coding of a power spectrum, for readouts of thousands of bins.
+ * Each Q31 magnitude² becomes an 8-bit logarithm in 1/8 octave steps,
+ * about 0.4 dB, and runs of bins below a floor collapse into the distance
+ * to the next bin above it, so the bins that stand out cost a byte and
+ * the noise between them a few.
+ *
+ * Byte stream, bin after bin:
+ *
+ *   code                  one bin, a log code of at least the floor
+ *   0x00 | run as LEB128  run bins below the floor, run >= 1
+ *
+ * The floor is at least 1, so a code is never 0. The logarithm is the
+ * position of the leading one and the three bits after it, which takes no
+ * divider or table on either core.
+ */
+
+#ifndef PSD_PACK_H
+#define PSD_PACK_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Escape of a run of bins below the floor. */
+#define PSD_PACK_RUN 0x00
+
+/** Largest token: the escape and a run of up to 2^21 - 1 bins, more than a readout has. */
+#define PSD_PACK_TOKEN_MAX 4
+
+/** 8-bit log code of a Q31 magnitude², 8 * log2(p) rounded down, 0 for 0 and 1. */
+static inline uint8_t psd_pack_log8(uint32_t p)
+{
+	uint32_t msb;
+
+	if (p < 2) {
+		return 0;
+	}
+
+	msb = 31 - __builtin_clz(p);
+
+	if (msb >= 3) {
+		return (uint8_t)((msb << 3) | ((p >> (msb - 3)) & 7));
+	}
+
+	return (uint8_t)((msb << 3) | ((p << (3 - msb)) & 7));
+}
+
+/** Smallest magnitude² of a log code, the inverse of psd_pack_log8(). */
+static inline uint32_t psd_pack_exp8(uint8_t code)
+{
+	uint32_t msb = code >> 3;
+	uint32_t mant = 8 | (code & 7);
+
+	return (msb >= 3) ? (mant << (msb - 3)) : (mant >> (3 - msb));
+}
+
+/**
+ * @brief Code bins into a buffer, as many as fit.
+ *
+ * @param out      Buffer for the byte stream.
+ * @param size     Bytes of out, more than PSD_PACK_TOKEN_MAX.
+ * @param bins     Magnitudes², Q31.
+ * @param num_bins Bins to code.
+ * @param floor    Smallest log code sent as is, from 1.
+ * @param coded    Set to the bins coded, all of them or those that fit.
+ *
+ * @return Bytes written to out.
+ */
+size_t psd_pack_encode(uint8_t *out, size_t size, const uint32_t *bins, uint32_t num_bins,
+		       uint8_t floor, uint32_t *coded);
+
+/** Called by psd_pack_decode() for each bin of the stream at or above the floor. */
+typedef void (*psd_pack_bin_cb)(uint32_t bin, uint8_t code, void *user_data);
+
+/**
+ * @brief Decode a byte stream of psd_pack_encode().
+ *
+ * @param in        Byte stream.
+ * @param len       Bytes of in.
+ * @param cb        Called with the bins at or above the floor, the others are below it.
+ * @param user_data Passed to cb.
+ *
+ * @return Bins the stream covers, or -EBADMSG if it ends inside a run.
+ */
+int psd_pack_decode(const uint8_t *in, size_t len, psd_pack_bin_cb cb, void *user_data);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PSD_PACK_H */
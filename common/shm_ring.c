@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <errno.h>
+#include <zephyr/kernel.h>
+#include <zephyr/cache.h>
+#include <zephyr/sys/util.h>
+
+#include "shm_ring.h"
+
+static inline uint32_t ring_next(const struct shm_ring *ring, uint32_t i)
+{
+	return (i + 1 == ring->num_slots) ? 0 : i + 1;
+}
+
+static inline uint8_t *ring_slot(const struct shm_ring *ring, uint32_t i)
+{
+	return ring->slots + i * ring->slot_size;
+}
+
+/* The index of the other side, as it last wrote it back. */
+static inline uint32_t ring_load(volatile uint32_t *index)
+{
+	sys_cache_data_invd_range((void *)index, SHM_RING_ALIGN);
+	return __atomic_load_n(index, __ATOMIC_ACQUIRE);
+}
+
+/* Publish this side's index, after everything written before it. */
+static inline void ring_store(volatile uint32_t *index, uint32_t value)
+{
+	__atomic_store_n(index, value, __ATOMIC_RELEASE);
+	sys_cache_data_flush_range((void *)index, SHM_RING_ALIGN);
+	/* Orders the store before the load of the other index that follows. */
+	__atomic_thread_fence(__ATOMIC_SEQ_CST);
+}
+
+static int ring_notify(struct shm_ring *ring)
+{
+	/* Whoever disarms it rings, the timer or the writer. */
+	if (!atomic_cas(&ring->notify_armed, 1, 0)) {
+		return 0;
+	}
+
+	return mbox_send_dt(ring->doorbell, NULL);
+}
+
+static void notify_timer_expired(struct k_timer *timer)
+{
+	struct shm_ring *ring = CONTAINER_OF(timer, struct shm_ring, notify_timer);
+
+	(void)ring_notify(ring);
+}
+
+static int ring_setup(struct shm_ring *ring, void *base, uint32_t num_slots,
+		      uint32_t slot_size)
+{
+	if ((((uintptr_t)base % SHM_RING_ALIGN) != 0) || (num_slots < 2) ||
+	    (slot_size == 0) || ((slot_size % SHM_RING_ALIGN) != 0)) {
+		return -EINVAL;
+	}
+
+	ring->head = (volatile uint32_t *)base;
+	ring->tail = (volatile uint32_t *)((uint8_t *)base + SHM_RING_ALIGN);
+	ring->slots = (uint8_t *)base + 2 * SHM_RING_ALIGN;
+	ring->slot_size = slot_size;
+	ring->num_slots = num_slots;
+	ring->pos = 0;
+	ring->doorbell = NULL;
+	ring->max_pending = 0;
+	ring->pending = 0;
+	atomic_clear(&ring->notify_armed);
+
+	return 0;
+}
+
+int shm_ring_init_writer(struct shm_ring *ring, void *base, uint32_t num_slots,
+			 uint32_t slot_size, const struct mbox_dt_spec *doorbell)
+{
+	int ret = ring_setup(ring, base, num_slots, slot_size);
+
+	if (ret < 0) {
+		return ret;
+	}
+
+	ring->doorbell = doorbell;
+	ring_store(ring->tail, 0);
+	ring_store(ring->head, 0);
+
+	return 0;
+}
+
+void shm_ring_set_coalescing(struct shm_ring *ring, uint32_t max_pending,
+			     k_timeout_t max_latency)
+{
+	k_timer_init(&ring->notify_timer, notify_timer_expired, NULL);
+	ring->max_latency = max_latency;
+	ring->max_pending = max_pending;
+}
+
+int shm_ring_init_reader(struct shm_ring *ring, void *base, uint32_t num_slots,
+			 uint32_t slot_size)
+{
+	return ring_setup(ring, base, num_slots, slot_size);
+}
+
+void *shm_ring_reserve(struct shm_ring *ring)
+{
+	if (ring_next(ring, ring->pos) == ring_load(ring->tail)) {
+		return NULL;
+	}
+
+	return ring_slot(ring, ring->pos);
+}
+
+int shm_ring_commit(struct shm_ring *ring)
+{
+	uint32_t slot = ring->pos;
+
+	sys_cache_data_flush_range(ring_slot(ring, slot), ring->slot_size);
+
+	ring->pos = ring_next(ring, slot);
+	ring_store(ring->head, ring->pos);
+
+	if (ring_load(ring->tail) == slot) {
+		/* The reader had caught up and may be asleep, wake it. */
+		if (ring->max_pending <= 1) {
+			return mbox_send_dt(ring->doorbell, NULL);
+		}
+
+		/* Unless more records follow before the latency is up. */
+		ring->pending = 1;
+		atomic_set(&ring->notify_armed, 1);
+		k_timer_start(&ring->notify_timer, ring->max_latency, K_NO_WAIT);
+		return 0;
+	}
+
+	if (atomic_get(&ring->notify_armed) && (++ring->pending >= ring->max_pending)) {
+		k_timer_stop(&ring->notify_timer);
+		return ring_notify(ring);
+	}
+
+	return 0;
+}
+
+const void *shm_ring_peek(struct shm_ring *ring)
+{
+	uint8_t *slot;
+
+	if (ring->pos == ring_load(ring->head)) {
+		return NULL;
+	}
+
+	slot = ring_slot(ring, ring->pos);
+	sys_cache_data_invd_range(slot, ring->slot_size);
+
+	return slot;
+}
+
+void shm_ring_release(struct shm_ring *ring)
+{
+	ring->pos = ring_next(ring, ring->pos);
+	ring_store(ring->tail, ring->pos);
+}
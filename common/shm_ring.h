@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/*
+ * Ring of fixed size records in shared memory, written by one core and read
+ * by the other. The region starts with the write index and the read index,
+ * each alone in a cache line so that neither core's write back clobbers
+ * the other's, followed by the record slots. Each index is written by one
+ * side only, with a barrier before it, no lock and no per-record header.
+ *
+ * The writer rings the doorbell of the reader, a mailbox channel, only
+ * when a record lands in an empty ring. The reader drains the ring on the
+ * doorbell; a full barrier between publishing an index and reading the
+ * other one on both sides makes sure one of them sees the other, so no
+ * doorbell is missed while the reader stops.
+ *
+ * With coalescing, the doorbell for an empty ring is held back until
+ * max_pending records are waiting or max_latency has passed, whichever
+ * comes first, so a burst costs the reader one interrupt. Records that
+ * land while the reader drains ring nothing either way.
+ *
+ * Slot indices wrap by comparison and one slot stays empty to tell a full
+ * ring from an empty one, so neither side divides.
+ */
+
+#ifndef SHM_RING_H
+#define SHM_RING_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <zephyr/kernel.h>
+#include <zephyr/drivers/mbox.h>
+#include <zephyr/sys/util.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Alignment of the indices and slots, the dcache-alignment of the IPC regions. */
+#define SHM_RING_ALIGN 32
+
+/** Size of a slot holding records of n bytes. */
+#define SHM_RING_SLOT_SIZE(n) ROUND_UP(n, SHM_RING_ALIGN)
+
+/** Slots of a ring of records of n bytes in a region of size bytes. */
+#define SHM_RING_NUM_SLOTS(size, n) \
+	(((size) - 2 * SHM_RING_ALIGN) / SHM_RING_SLOT_SIZE(n))
+
+/** Local handle of a ring, one on each core. */
+struct shm_ring {
+	volatile uint32_t *head;  /**< Next slot to write, in shared memory. */
+	volatile uint32_t *tail;  /**< Next slot to read, in shared memory. */
+	uint8_t *slots;
+	uint32_t slot_size;
+	uint32_t num_slots;
+	uint32_t pos;             /**< This side's copy of its own index. */
+	const struct mbox_dt_spec *doorbell;  /**< Writer only. */
+	/* Doorbell coalescing, writer only. */
+	struct k_timer notify_timer;
+	k_timeout_t max_latency;
+	uint32_t max_pending;     /**< 0 if the doorbell rings at once. */
+	uint32_t pending;         /**< Records since the reader was idle. */
+	atomic_t notify_armed;    /**< A held back doorbell is due. */
+};
+
+/**
+ * @brief Set up the writing side and empty the ring.
+ *
+ * Call before the reader may look at the ring, for instance before the
+ * IPC endpoint that announces it is bound.
+ *
+ * @param ring      Handle to set up.
+ * @param base      Start of the region, SHM_RING_ALIGN aligned.
+ * @param num_slots Slots, SHM_RING_NUM_SLOTS() of the region, at least 2.
+ * @param slot_size Bytes per slot, SHM_RING_SLOT_SIZE() of the record.
+ * @param doorbell  Mailbox channel to the reader.
+ *
+ * @retval 0 on success, -EINVAL if the geometry is unusable.
+ */
+int shm_ring_init_writer(struct shm_ring *ring, void *base, uint32_t num_slots,
+			 uint32_t slot_size, const struct mbox_dt_spec *doorbell);
+
+/**
+ * @brief Hold back the doorbell of an empty ring.
+ *
+ * Call on the writer after shm_ring_init_writer(), before the first
+ * record.
+ *
+ * @param ring        Writer to coalesce the doorbell of.
+ * @param max_pending Records that ring the doorbell at once, 0 to turn
+ *                    coalescing off.
+ * @param max_latency Longest the first record waits for the doorbell.
+ */
+void shm_ring_set_coalescing(struct shm_ring *ring, uint32_t max_pending,
+			     k_timeout_t max_latency);
+
+/**
+ * @brief Set up the reading side, with the same geometry as the writer.
+ *
+ * Does not touch the region, the writer empties it.
+ *
+ * @retval 0 on success, -EINVAL if the geometry is unusable.
+ */
+int shm_ring_init_reader(struct shm_ring *ring, void *base, uint32_t num_slots,
+			 uint32_t slot_size);
+
+/**
+ * @brief Get the next free slot to write a record into in place.
+ *
+ * @return The slot, or NULL if the ring is full.
+ */
+void *shm_ring_reserve(struct shm_ring *ring);
+
+/**
+ * @brief Hand the slot from shm_ring_reserve() to the reader.
+ *
+ * Rings the doorbell if the reader had emptied the ring, or with
+ * coalescing once enough records are waiting for it.
+ *
+ * @retval 0 on success, or the error of the doorbell.
+ */
+int shm_ring_commit(struct shm_ring *ring);
+
+/**
+ * @brief Get the oldest record, to read in place.
+ *
+ * @return The record, or NULL if the ring is empty.
+ */
+const void *shm_ring_peek(struct shm_ring *ring);
+
+/**
+ * @brief Return the slot from shm_ring_peek() to the writer.
+ */
+void shm_ring_release(struct shm_ring *ring);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SHM_RING_H */
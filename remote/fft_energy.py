@@ -0,0 +1,164 @@
+#!/usr/bin/env python3
+"""
+Energy per FFT frame from a power analyzer capture and the benchmark log
+
+With CONFIG_APP_FFT_BENCH_ENERGY the benchmark runs a burst of frames for
+every scenario with its trigger pin high, sleeps with it low, and prints an
+energy row per burst. Record the current of the core with the pin on a
+digital input of the PPK2, export the capture as CSV from the Power
+Profiler and give both files to this script:
+
+    python3 fft_energy.py --voltage 1.8 --channel 0 ppk.csv console.log
+
+The n-th burst of the capture is the n-th energy row of the log. The idle
+current, taken from the second half of the gap after each burst, where
+the core sleeps, is subtracted for the energy the FFT adds; both are
+printed per frame, in µJ, with the cycles of a frame, in pJ per cycle:
+
+    board,backend,ipc,fft_size,window,top_bins,run,frames,cpu_mhz,mean_cycles,
+    burst_ms,mean_ua,idle_ua,uj_per_frame,uj_per_frame_net,pj_per_cycle
+
+The export has a Timestamp(ms) and a Current(uA) column and the digital
+inputs either as one D0-D7 column of 0 and 1, D0 first, or as D0 to D7.
+"""
+
+import argparse
+import csv
+import statistics
+import sys
+
+FIELDS = ('board', 'backend', 'ipc', 'fft_size', 'window', 'top_bins', 'run', 'frames',
+          'mean_cycles', 'burst_us', 'cpu_mhz')
+
+OUTPUT = ('board', 'backend', 'ipc', 'fft_size', 'window', 'top_bins', 'run', 'frames',
+          'cpu_mhz', 'mean_cycles', 'burst_ms', 'mean_ua', 'idle_ua', 'uj_per_frame',
+          'uj_per_frame_net', 'pj_per_cycle')
+
+# Burst lengths of the capture and the log further apart are reported
+LENGTH_TOLERANCE = 0.1
+
+
+def read_rows(path):
+    """Energy rows of a console log, in order, without the header"""
+    rows = []
+    with open(path, errors='replace') as f:
+        for line in f:
+            # The console may prefix the lines, with a timestamp for instance
+            start = line.find('energy,')
+            if start < 0:
+                continue
+            values = line[start:].strip().split(',')[1:]
+            if len(values) != len(FIELDS) or values[0] == 'board':
+                continue
+            rows.append(dict(zip(FIELDS, values)))
+    return rows
+
+
+def read_capture(path, channel):
+    """Time in s, current in µA and the trigger input of every sample"""
+    times, currents, levels = [], [], []
+    with open(path, newline='') as f:
+        reader = csv.DictReader(f)
+        digital = f'D{channel}'
+        for sample in reader:
+            if 'D0-D7' in sample:
+                level = sample['D0-D7'].strip()[channel] == '1'
+            elif digital in sample:
+                level = sample[digital].strip() == '1'
+            else:
+                raise SystemExit(f'{path} has no digital input {digital}')
+            times.append(float(sample['Timestamp(ms)']) / 1000.0)
+            currents.append(float(sample['Current(uA)']))
+            levels.append(level)
+    if len(times) < 2:
+        raise SystemExit(f'{path} holds no samples')
+    return times, currents, levels
+
+
+def segments(levels):
+    """(first, end) sample indices of each run of an input high"""
+    runs = []
+    start = None
+    for i, level in enumerate(levels):
+        if level and start is None:
+            start = i
+        elif not level and start is not None:
+            runs.append((start, i))
+            start = None
+    # A burst cut off by the end of the capture has no idle time after it
+    return runs
+
+
+def charge(times, currents, first, end):
+    """∫ I dt over samples first to end, in µA s, and their length in s"""
+    total = 0.0
+    seconds = 0.0
+    for i in range(first, end):
+        dt = times[i + 1] - times[i] if i + 1 < len(times) else times[i] - times[i - 1]
+        total += currents[i] * dt
+        seconds += dt
+    return total, seconds
+
+
+def energy(times, currents, levels, rows, voltage):
+    bursts = segments(levels)
+    if len(bursts) != len(rows):
+        print(f'warning: {len(bursts)} bursts in the capture, {len(rows)} energy rows in the '
+              f'log; matching the first {min(len(bursts), len(rows))}', file=sys.stderr)
+
+    results = []
+    for n, ((first, end), row) in enumerate(zip(bursts, rows)):
+        # The second half of the gap after the burst, once the row is printed
+        gap_end = bursts[n + 1][0] if n + 1 < len(bursts) else len(times)
+        idle = currents[(end + gap_end) // 2:gap_end] or currents[end:gap_end]
+        idle_ua = statistics.median(idle) if idle else 0.0
+
+        frames = int(row['frames'])
+        cycles = int(row['mean_cycles']) * frames
+        microcoulombs, seconds = charge(times, currents, first, end)
+        gross = voltage * microcoulombs
+        net = gross - voltage * idle_ua * seconds
+
+        logged = int(row['burst_us']) / 1e6
+        if logged and abs(seconds - logged) > LENGTH_TOLERANCE * logged:
+            print(f"warning: burst {n} of {row['fft_size']} points takes {seconds * 1e3:.2f} ms "
+                  f'in the capture, {logged * 1e3:.2f} ms by the cycle counter', file=sys.stderr)
+
+        results.append(dict(row, burst_ms=f'{seconds * 1e3:.3f}',
+                            mean_ua=f'{microcoulombs / seconds if seconds else 0.0:.1f}',
+                            idle_ua=f'{idle_ua:.1f}', uj_per_frame=f'{gross / frames:.3f}',
+                            uj_per_frame_net=f'{net / frames:.3f}',
+                            pj_per_cycle=f'{1e6 * net / cycles if cycles else 0.0:.2f}'))
+    return results
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('capture', help='CSV export of the power analyzer')
+    parser.add_argument('log', help='console output of the benchmark')
+    parser.add_argument('--voltage', type=float, default=1.8,
+                        help='supply voltage of the capture, in V')
+    parser.add_argument('--channel', type=int, default=0, choices=range(8),
+                        help='digital input of the trigger pin')
+    parser.add_argument('-o', '--output', help='write the table to this file')
+    args = parser.parse_args()
+
+    rows = read_rows(args.log)
+    if not rows:
+        raise SystemExit(f'{args.log} holds no energy rows, is CONFIG_APP_FFT_BENCH_ENERGY set?')
+    times, currents, levels = read_capture(args.capture, args.channel)
+    results = energy(times, currents, levels, rows, args.voltage)
+
+    out = open(args.output, 'w', newline='') if args.output else sys.stdout
+    writer = csv.DictWriter(out, OUTPUT, extrasaction='ignore', lineterminator='\n')
+    writer.writeheader()
+    writer.writerows(results)
+    if args.output:
+        out.close()
+
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,101 @@
+#!/usr/bin/env python3
+"""
+Record image of CONFIG_APP_FFT_RECORD from a WAV file
+
+The remote core analyses the record kept in the fft_record devicetree
+node: a 16-byte header, the magic "FRC1", the number of samples and the
+sample rate, then the 16-bit samples. This script writes that image from a
+16-bit PCM WAV file, its first channel, as Intel HEX at the address of an
+RRAM region to be programmed as it is:
+
+    python3 fft_record.py capture.wav -o record.hex
+    nrfutil device program --firmware record.hex \\
+        --options chip_erase_mode=ERASE_RANGES_TOUCHED_BY_FIRMWARE
+
+The default address and size are those of
+boards/nrf54l15dk_nrf54l15_cpuflpr_record.overlay. With --bin the image is
+written as it is instead, for a fixed partition of a flash device with
+CONFIG_APP_FFT_RECORD_FLASH. A record longer than the region is cut down
+to what fits.
+"""
+
+import argparse
+import struct
+import sys
+import wave
+
+MAGIC = 0x31435246
+HEADER = struct.Struct('<IIII')
+
+
+def read_wav(path):
+    """Samples of the first channel, as 16-bit little-endian bytes, and the rate"""
+    with wave.open(path, 'rb') as w:
+        if w.getsampwidth() != 2:
+            raise SystemExit(f'{path}: {8 * w.getsampwidth()}-bit samples, only 16-bit PCM is read')
+        channels = w.getnchannels()
+        rate = w.getframerate()
+        frames = w.readframes(w.getnframes())
+    if channels > 1:
+        width = 2 * channels
+        frames = b''.join(frames[i:i + 2] for i in range(0, len(frames), width))
+    return frames, rate
+
+
+def image(samples, rate, size):
+    """Header and samples, cut down to size bytes"""
+    count = min(len(samples) // 2, (size - HEADER.size) // 2)
+    if count < len(samples) // 2:
+        print(f'warning: {len(samples) // 2} samples, only the first {count} fit in '
+              f'{size} bytes', file=sys.stderr)
+    return HEADER.pack(MAGIC, count, rate, 0) + samples[:2 * count]
+
+
+def hex_record(kind, address, data):
+    body = bytes([len(data), (address >> 8) & 0xff, address & 0xff, kind]) + data
+    return ':' + (body + bytes([-sum(body) & 0xff])).hex().upper() + '\n'
+
+
+def intel_hex(data, base):
+    lines = []
+    upper = None
+    for offset in range(0, len(data), 16):
+        address = base + offset
+        if address >> 16 != upper:
+            upper = address >> 16
+            lines.append(hex_record(4, 0, struct.pack('>H', upper)))
+        lines.append(hex_record(0, address & 0xffff, data[offset:offset + 16]))
+    lines.append(hex_record(1, 0, b''))
+    return ''.join(lines)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('wav', help='16-bit PCM WAV file')
+    parser.add_argument('-o', '--output', required=True, help='image to write')
+    parser.add_argument('--address', type=lambda x: int(x, 0), default=0x165000,
+                        help='address of the fft_record region, for the HEX file')
+    parser.add_argument('--size', type=lambda x: int(x, 0), default=64 * 1024,
+                        help='bytes of the fft_record region or partition')
+    parser.add_argument('--bin', action='store_true', help='write a raw image instead of HEX')
+    args = parser.parse_args()
+
+    samples, rate = read_wav(args.wav)
+    data = image(samples, rate, args.size)
+
+    if args.bin:
+        with open(args.output, 'wb') as f:
+            f.write(data)
+    else:
+        with open(args.output, 'w') as f:
+            f.write(intel_hex(data, args.address))
+
+    count = (len(data) - HEADER.size) // 2
+    print(f'{count} samples at {rate} Hz, {count / rate:.2f} s', file=sys.stderr)
+
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,185 @@
+#!/usr/bin/env python3
+"""
+SRAM footprint of the remote image, by component, against a budget
+
+The FLPR core runs everything from SRAM, code and constants included,
+which the VPR launcher copies there from RRAM. After every link of the
+remote image the build runs this on zephyr.elf with the SRAM region it
+was linked for, and fails when the image is larger than the budget:
+
+    python3 flpr_footprint.py --region 0x2000c800 210944 --budget 210944 \\
+        -o fft_footprint.json build/remote/zephyr/zephyr.elf
+
+Every allocated section in the region counts. Its symbols are split into:
+
+  code                 functions
+  twiddle tables       twiddle factors, in flash or the SRAM copy
+  bit-reversal tables  bit reversal index tables
+  stacks               thread, interrupt and idle stacks
+  buffers              frame, work and arena buffers, data of 256 bytes and more
+  constants            other read-only data
+  other data           smaller variables, padding and what has no symbol
+
+The buffers and stacks are listed by name, largest first, as they are
+what a new feature usually adds.
+"""
+
+import argparse
+import json
+import re
+import struct
+import sys
+
+SHF_WRITE = 0x1
+SHF_ALLOC = 0x2
+SHF_EXECINSTR = 0x4
+SHT_SYMTAB = 2
+SHT_NOBITS = 8
+STT_OBJECT = 1
+STT_FUNC = 2
+
+BUFFER_MIN = 256
+
+COMPONENTS = ('code', 'twiddle tables', 'bit-reversal tables', 'stacks', 'buffers',
+              'constants', 'other data')
+
+TWIDDLES = re.compile(r'twiddle', re.IGNORECASE)
+BITREV = re.compile(r'bitrev', re.IGNORECASE)
+STACKS = re.compile(r'(^z_interrupt_stacks|^z_main_stack|^z_idle_stacks|_stack$|_stacks$)')
+
+
+def read_elf(path):
+    """Allocated sections and sized symbols of an ELF file, 32 or 64 bit"""
+    with open(path, 'rb') as f:
+        data = f.read()
+
+    if data[:4] != b'\x7fELF':
+        raise SystemExit(f'{path} is not an ELF file')
+    is64 = data[4] == 2
+    order = '<' if data[5] == 1 else '>'
+
+    if is64:
+        shoff, = struct.unpack_from(order + 'Q', data, 0x28)
+        shentsize, shnum = struct.unpack_from(order + 'HH', data, 0x3a)
+        section_fmt, symbol_fmt = order + 'IIQQQQIIQQ', order + 'IBBHQQ'
+    else:
+        shoff, = struct.unpack_from(order + 'I', data, 0x20)
+        shentsize, shnum = struct.unpack_from(order + 'HH', data, 0x2e)
+        section_fmt, symbol_fmt = order + 'IIIIIIIIII', order + 'IIIBBH'
+
+    sections = []
+    for i in range(shnum):
+        name, kind, flags, addr, offset, size, link, _, _, entsize = \
+            struct.unpack_from(section_fmt, data, shoff + i * shentsize)
+        sections.append({'kind': kind, 'flags': flags, 'addr': addr, 'offset': offset,
+                         'size': size, 'link': link, 'entsize': entsize})
+
+    symbols = []
+    for s in sections:
+        if s['kind'] != SHT_SYMTAB:
+            continue
+        strtab = sections[s['link']]
+        for i in range(s['size'] // s['entsize']):
+            fields = struct.unpack_from(symbol_fmt, data, s['offset'] + i * s['entsize'])
+            if is64:
+                name, info, _, shndx, value, size = fields
+            else:
+                name, value, size, info, _, shndx = fields
+            if size == 0 or not 0 < shndx < len(sections):
+                continue
+            start = strtab['offset'] + name
+            symbols.append({'name': data[start:data.index(b'\0', start)].decode(),
+                            'type': info & 0xf, 'addr': value, 'size': size,
+                            'section': sections[shndx]})
+
+    return [s for s in sections if s['flags'] & SHF_ALLOC], symbols
+
+
+def component(symbol):
+    name = symbol['name']
+    flags = symbol['section']['flags']
+
+    if symbol['type'] == STT_FUNC or flags & SHF_EXECINSTR:
+        return 'code'
+    if TWIDDLES.search(name):
+        return 'twiddle tables'
+    if BITREV.search(name):
+        return 'bit-reversal tables'
+    if not flags & SHF_WRITE:
+        return 'constants'
+    if STACKS.search(name):
+        return 'stacks'
+    if symbol['size'] >= BUFFER_MIN:
+        return 'buffers'
+    return 'other data'
+
+
+def footprint(path, region_addr, region_size):
+    sections, symbols = read_elf(path)
+    region_end = region_addr + region_size
+
+    def in_region(addr, size):
+        return region_addr <= addr and addr + size <= region_end
+
+    total = sum(s['size'] for s in sections if s['size'] and in_region(s['addr'], s['size']))
+
+    sizes = dict.fromkeys(COMPONENTS, 0)
+    largest = {'buffers': [], 'stacks': []}
+    seen = set()
+    for sym in symbols:
+        # Aliases share their address and size, count them once
+        if (sym['addr'], sym['size']) in seen or not in_region(sym['addr'], sym['size']):
+            continue
+        seen.add((sym['addr'], sym['size']))
+        which = component(sym)
+        sizes[which] += sym['size']
+        if which in largest:
+            largest[which].append((sym['size'], sym['name']))
+
+    sizes['other data'] += total - sum(sizes.values())
+
+    return total, sizes, {k: sorted(v, reverse=True) for k, v in largest.items()}
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('elf')
+    parser.add_argument('--region', nargs=2, required=True, metavar=('ADDR', 'SIZE'),
+                        type=lambda v: int(v, 0), help='SRAM region the image is linked for')
+    parser.add_argument('--budget', type=lambda v: int(v, 0), default=0,
+                        help='bytes the image may take, 0 for the whole region')
+    parser.add_argument('--top', type=int, default=5, help='buffers and stacks listed')
+    parser.add_argument('-o', '--output', help='write the report as JSON')
+    args = parser.parse_args()
+
+    region_addr, region_size = args.region
+    budget = args.budget or region_size
+    total, sizes, largest = footprint(args.elf, region_addr, region_size)
+
+    print(f'FLPR SRAM footprint, {region_size // 1024} KB region at {region_addr:#x}:')
+    for name in COMPONENTS:
+        print(f'  {name:<20} {sizes[name]:>8} B  {100.0 * sizes[name] / region_size:5.1f}%')
+        for size, symbol in largest.get(name, [])[:args.top]:
+            print(f'      {symbol:<30} {size:>8} B')
+    print(f"  {'total':<20} {total:>8} B  {100.0 * total / region_size:5.1f}%, "
+          f'budget {budget} B, {budget - total} B left')
+
+    if args.output:
+        with open(args.output, 'w') as f:
+            json.dump({'region_addr': region_addr, 'region_size': region_size,
+                       'budget': budget, 'total': total, 'components': sizes,
+                       'buffers': dict((n, s) for s, n in largest['buffers']),
+                       'stacks': dict((n, s) for s, n in largest['stacks'])}, f, indent=2)
+            f.write('\n')
+
+    if total > budget:
+        print(f'error: the FLPR image takes {total} B of SRAM, {total - budget} B over its '
+              f'budget of {budget} B (CONFIG_APP_FFT_RAM_BUDGET)', file=sys.stderr)
+        return 1
+
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,166 @@
+/* ----------------------------------------------------------------------
+ * Project:      FFT Utility Functions
+ * Title:        adc_q15.c
+ * Description:  Block conversion of raw SAADC results into Q15 FFT input
+ *
+ * Target Processor: nRF54L15 FLPR (RISC-V), ARM Cortex-M33
+ * -------------------------------------------------------------------- */
+
+#include "adc_q15.h"
+#include <stdint.h>
+
+/**
+ * @brief Prepare the conversion of one channel
+ */
+rfft_status_t adc_q15_init(
+    adc_q15_t *adc,
+    adc_q15_format_t format,
+    uint8_t bits,
+    int32_t offset,
+    int16_t gain,
+    uint8_t dc_shift
+)
+{
+    if (adc == NULL) {
+        return RFFT_ERROR_NULL_POINTER;
+    }
+
+    /* A clamped result times the gain fits 31 bits up to 16 bits */
+    if ((format != ADC_Q15_S16 && format != ADC_Q15_S8) ||
+        bits < 8 || bits > 16 || (format == ADC_Q15_S8 && bits > 8) ||
+        gain <= 0 || dc_shift > 15) {
+        return RFFT_ERROR_INVALID_SIZE;
+    }
+
+    adc->offset = offset;
+    adc->min = -((q31_t) 1 << (bits - 1));
+    adc->max = ((q31_t) 1 << (bits - 1)) - 1;
+    adc->gain = gain;
+    adc->shift = (uint8_t) (bits - 2);
+    adc->dc_shift = dc_shift;
+    adc->format = (uint8_t) format;
+    adc_q15_reset(adc);
+
+    return RFFT_SUCCESS;
+}
+
+/* Offset, clamp and gain of one raw result, before the DC removal */
+static inline q31_t adc_q15_scale(const adc_q15_t *adc, q31_t raw)
+{
+    q31_t d = rfft_q15_max(rfft_q15_min(raw - adc->offset, adc->max), adc->min);
+
+    return __SSAT((d * adc->gain) >> adc->shift, 16);
+}
+
+/*
+ * One sample. remove_dc is a constant at every call, so each loop below
+ * is compiled once with and once without the DC removal.
+ */
+static inline q31_t adc_q15_sample(const adc_q15_t *adc, q31_t raw, int32_t *dc,
+                                   const int remove_dc)
+{
+    q31_t y = adc_q15_scale(adc, raw);
+
+    if (remove_dc) {
+        *dc += ((y << 8) - *dc) >> adc->dc_shift;
+        y = __SSAT(y - (*dc >> 8), 16);
+    }
+
+    return y;
+}
+
+static inline void adc_q15_convert_s16(const adc_q15_t *adc, const int16_t *src, q15_t *dst,
+                                       uint32_t count, int32_t *dc, const int remove_dc)
+{
+    /* A buffer at a halfword: one sample brings both to a word */
+    if (count > 0 && ((uintptr_t) src & 3U) != 0 && ((uintptr_t) dst & 3U) != 0) {
+        *dst++ = (q15_t) adc_q15_sample(adc, *src++, dc, remove_dc);
+        count--;
+    }
+
+    if ((((uintptr_t) src | (uintptr_t) dst) & 3U) == 0) {
+        for (; count >= 2; count -= 2) {
+            q31_t in = read_q15x2(src);
+            q31_t lo = adc_q15_sample(adc, RFFT_Q15_LO(in), dc, remove_dc);
+            q31_t hi = adc_q15_sample(adc, RFFT_Q15_HI(in), dc, remove_dc);
+
+            src += 2;
+            write_q15x2_ia(&dst, rfft_q15_pack16(lo, hi));
+        }
+    }
+
+    while (count-- > 0) {
+        *dst++ = (q15_t) adc_q15_sample(adc, *src++, dc, remove_dc);
+    }
+}
+
+static inline void adc_q15_convert_s8(const adc_q15_t *adc, const int8_t *src, q15_t *dst,
+                                      uint32_t count, int32_t *dc, const int remove_dc)
+{
+    while (count > 0 && ((uintptr_t) src & 3U) != 0) {
+        *dst++ = (q15_t) adc_q15_sample(adc, *src++, dc, remove_dc);
+        count--;
+    }
+
+    if (((uintptr_t) dst & 3U) == 0) {
+        for (; count >= 4; count -= 4) {
+            uint32_t in;
+            q31_t s0;
+            q31_t s1;
+            q31_t s2;
+            q31_t s3;
+
+            memcpy(&in, src, sizeof(in));
+            src += 4;
+
+            /* Sign-extend each byte of the little-endian word */
+            s0 = adc_q15_sample(adc, (q31_t) (in << 24) >> 24, dc, remove_dc);
+            s1 = adc_q15_sample(adc, (q31_t) (in << 16) >> 24, dc, remove_dc);
+            s2 = adc_q15_sample(adc, (q31_t) (in << 8) >> 24, dc, remove_dc);
+            s3 = adc_q15_sample(adc, (q31_t) in >> 24, dc, remove_dc);
+            write_q15x2_ia(&dst, rfft_q15_pack16(s0, s1));
+            write_q15x2_ia(&dst, rfft_q15_pack16(s2, s3));
+        }
+    }
+
+    while (count-- > 0) {
+        *dst++ = (q15_t) adc_q15_sample(adc, *src++, dc, remove_dc);
+    }
+}
+
+/**
+ * @brief Convert a buffer of raw results into Q15
+ */
+void adc_q15_convert(adc_q15_t *adc, const void *src, q15_t *dst, uint32_t count)
+{
+    int32_t dc = adc->dc;
+
+    if (count == 0) {
+        return;
+    }
+
+    /* Seeded with the first sample, the output starts without a step */
+    if (adc->dc_shift != 0 && !adc->dc_primed) {
+        q31_t first = (adc->format == ADC_Q15_S8) ? *(const int8_t *) src
+                                                   : *(const int16_t *) src;
+
+        dc = adc_q15_scale(adc, first) << 8;
+        adc->dc_primed = 1;
+    }
+
+    if (adc->format == ADC_Q15_S8) {
+        if (adc->dc_shift != 0) {
+            adc_q15_convert_s8(adc, src, dst, count, &dc, 1);
+        } else {
+            adc_q15_convert_s8(adc, src, dst, count, &dc, 0);
+        }
+    } else {
+        if (adc->dc_shift != 0) {
+            adc_q15_convert_s16(adc, src, dst, count, &dc, 1);
+        } else {
+            adc_q15_convert_s16(adc, src, dst, count, &dc, 0);
+        }
+    }
+
+    adc->dc = dc;
+}
@@ -0,0 +1,135 @@
+/* ----------------------------------------------------------------------
+ * Project:      FFT Utility Functions
+ * Title:        adc_q15.h
+ * Description:  Block conversion of raw SAADC results into Q15 FFT input
+ *
+ * Target Processor: nRF54L15 FLPR (RISC-V), ARM Cortex-M33
+ * -------------------------------------------------------------------- */
+
+#ifndef ADC_Q15_H
+#define ADC_Q15_H
+
+#include "rfft_q15_simplified.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief How the raw results are laid out in the buffer
+ */
+typedef enum {
+    ADC_Q15_S16 = 0,        /**< One signed result per halfword, as the SAADC writes them */
+    ADC_Q15_S8              /**< One signed 8-bit result per byte, packed */
+} adc_q15_format_t;
+
+/**
+ * @brief Calibrated conversion of one ADC channel
+ *
+ * adc_to_q15() takes one offset-binary 16-bit sample at a time. This
+ * converts a whole DMA buffer of SAADC results in one pass, straight
+ * into the buffer the RFFT transforms:
+ *
+ *   d   = clamp(raw - offset) to the bits-bit signed range
+ *   y   = sat16(d * gain >> (bits - 2))      gain in Q14
+ *   out = sat16(y - dc)                      with DC removal
+ *
+ * offset is the raw value that becomes 0: mid-scale, 1 << (bits - 1),
+ * for single-ended inputs, 0 for differential ones, plus the offset
+ * error of the calibration. The estimate dc follows y as an exponential
+ * average over about 2^dc_shift samples, seeded with the first sample
+ * after adc_q15_reset(), and is carried from buffer to buffer.
+ *
+ * bits is the resolution of the results, 8 to 16: 10, 12 or 14 for the
+ * SAADC on its own, up to 16 for oversampled results that keep the extra
+ * bits. With 12 bits, an offset of 2048, a gain of 16384 and no DC
+ * removal the result is that of the SAADC conversion of the application,
+ * (clamp(raw, 0, 4095) ^ 0x800) << 4.
+ *
+ * Pairs of samples are read and written as 32-bit words (four samples
+ * per word read for ADC_Q15_S8), so every product stays within 32 bits
+ * and nothing needs 64-bit arithmetic on the FLPR.
+ */
+typedef struct {
+    int32_t offset;         /**< Raw value of 0, in raw LSB */
+    q31_t min;              /**< Clamp of raw - offset, -2^(bits-1) */
+    q31_t max;              /**< Clamp of raw - offset, 2^(bits-1) - 1 */
+    int32_t dc;             /**< DC estimate (Q23), 8 bits below a sample */
+    int16_t gain;           /**< Gain (Q14), 16384 for 1.0 */
+    uint8_t shift;          /**< bits - 2 */
+    uint8_t dc_shift;       /**< Averaging of the DC estimate, 0 without DC removal */
+    uint8_t format;         /**< adc_q15_format_t */
+    uint8_t dc_primed;      /**< The DC estimate has seen a sample since the reset */
+} adc_q15_t;
+
+/**
+ * @brief Prepare the conversion of one channel
+ *
+ * @param[out] adc       Conversion state to initialize
+ * @param[in]  format    Layout of the raw results
+ * @param[in]  bits      Resolution, 8 to 16, at most 8 for ADC_Q15_S8
+ * @param[in]  offset    Raw value converted to 0, in raw LSB
+ * @param[in]  gain      Gain (Q14), 1 to 32767, 16384 for 1.0
+ * @param[in]  dc_shift  DC removal over about 2^dc_shift samples, 1 to 15,
+ *                       0 to keep the DC
+ *
+ * @return rfft_status_t
+ *         - RFFT_SUCCESS: Operation successful
+ *         - RFFT_ERROR_NULL_POINTER: NULL pointer provided
+ *         - RFFT_ERROR_INVALID_SIZE: Invalid format, bits, gain or dc_shift
+ *
+ * @example
+ *   static adc_q15_t adc;
+ *   static q15_t frame[1024] RFFT_Q15_ALIGN;
+ *
+ *   // 12-bit single-ended, 3 LSB of offset error, 0.5 % high, DC removed
+ *   adc_q15_init(&adc, ADC_Q15_S16, 12, 2048 + 3, 16302, 10);
+ *
+ *   while (saadc_wait(&raw)) {
+ *       adc_q15_convert(&adc, raw, frame, 1024);
+ *       find_fft_top_bins_inplace(frame, 1024, top_bins, 5);
+ *   }
+ */
+rfft_status_t adc_q15_init(
+    adc_q15_t *adc,
+    adc_q15_format_t format,
+    uint8_t bits,
+    int32_t offset,
+    int16_t gain,
+    uint8_t dc_shift
+);
+
+/**
+ * @brief Forget the DC estimate, e.g. after a gap in the samples
+ *
+ * The next sample converted seeds the estimate again.
+ *
+ * @param[in,out] adc  Initialized conversion state
+ */
+static inline void adc_q15_reset(adc_q15_t *adc)
+{
+    adc->dc = 0;
+    adc->dc_primed = 0;
+}
+
+/**
+ * @brief Convert a buffer of raw results into Q15
+ *
+ * The word loop needs src and dst 4-byte aligned, as RFFT buffers are,
+ * apart from a leading odd sample of ADC_Q15_S16 buffers that both start
+ * at a halfword; other buffers take the sample-by-sample path. For
+ * ADC_Q15_S16, dst may be src, converting the results where DMA wrote
+ * them; otherwise the buffers must not overlap.
+ *
+ * @param[in,out] adc    Initialized conversion state, its DC estimate updated
+ * @param[in]     src    count raw results in the layout of the format
+ * @param[out]    dst    count samples (Q15)
+ * @param[in]     count  Number of samples
+ */
+void adc_q15_convert(adc_q15_t *adc, const void *src, q15_t *dst, uint32_t count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ADC_Q15_H */
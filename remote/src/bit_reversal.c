@@ -19,7 +19,7 @@
  * @param[in]     bitRevLen   bit reversal table length
  * @param[in]     pBitRevTable points to bit reversal table
  */
-void arm_bitreversal_16(
+RFFT_Q15_HOT void arm_bitreversal_16(
         uint16_t * pSrc,
   const uint16_t bitRevLen,
   const uint16_t * pBitRevTable)
@@ -45,3 +45,56 @@ void arm_bitreversal_16(
         i += 2;
     }
 }
+
+/**
+ * @brief In-place Q15 bit reversal computed without an index table.
+ * @param[in,out] pSrc    points to in-place complex Q15 data buffer
+ * @param[in]     fftLen  length of the complex FFT, a power of two
+ */
+RFFT_Q15_HOT void arm_bitreversal_q15_notable(
+        q15_t * pSrc,
+        uint32_t fftLen)
+{
+    q15_t tmp;
+    uint32_t i, r = 0U;
+
+    for (i = 0U; i < fftLen; i++)
+    {
+        if (i < r)
+        {
+            /* Swap real parts */
+            tmp = pSrc[2U * i];
+            pSrc[2U * i] = pSrc[2U * r];
+            pSrc[2U * r] = tmp;
+
+            /* Swap imaginary parts */
+            tmp = pSrc[2U * i + 1U];
+            pSrc[2U * i + 1U] = pSrc[2U * r + 1U];
+            pSrc[2U * r + 1U] = tmp;
+        }
+
+        r = rfft_bitrev_next(r, fftLen >> 1U);
+    }
+}
+
+/**
+ * @brief Out-of-place Q15 bit reversal computed without an index table.
+ * @param[in]     pSrc    points to complex Q15 data in bit-reversed order
+ * @param[out]    pDst    points to output buffer, natural order
+ * @param[in]     fftLen  length of the complex FFT, a power of two
+ */
+void arm_bitreversal_q15_copy(
+  const q15_t * pSrc,
+        q15_t * pDst,
+        uint32_t fftLen)
+{
+    uint32_t i, r = 0U;
+
+    for (i = 0U; i < fftLen; i++)
+    {
+        pDst[2U * r]      = pSrc[2U * i];
+        pDst[2U * r + 1U] = pSrc[2U * i + 1U];
+
+        r = rfft_bitrev_next(r, fftLen >> 1U);
+    }
+}
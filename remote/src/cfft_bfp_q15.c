@@ -0,0 +1,243 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library - Simplified Q15 CFFT
+ * Title:        cfft_bfp_q15.c
+ * Description:  Block floating point Q15 CFFT with per-stage scaling
+ *
+ * Target Processor: nRF54L15 FLPR (RISC-V)
+ * -------------------------------------------------------------------- */
+
+#include "rfft_q15_simplified.h"
+#include <stddef.h>
+
+/*
+ * The fixed-scaling butterflies shift every stage by 2 bits, so a 4096-point
+ * CFFT always loses 12 bits whatever the level of the input. Here a stage
+ * only shifts as far as its input needs to keep its output in range.
+ *
+ * A radix-4 stage grows a component by at most 4 * sqrt(2) < 2^3, a radix-2
+ * stage by at most 2 * sqrt(2) < 2^2. While writing a stage the magnitudes
+ * of its outputs are OR-ed together; the bit count of the result bounds all
+ * of them, and the next stage shifts its inputs right until 3 (2) bits of
+ * headroom are left below the Q15 limit. The shifts add up to the block
+ * exponent.
+ */
+
+/* Bits needed for the magnitudes OR-ed into m, 0 for m = 0 */
+static uint32_t bfp_bits(uint32_t m)
+{
+    uint32_t bits = 0U;
+
+    while (m != 0U) {
+        m >>= 1U;
+        bits++;
+    }
+
+    return bits;
+}
+
+/* Right shift that leaves bits + growth <= 15 */
+static uint32_t bfp_shift(uint32_t bits, uint32_t growth)
+{
+    return (bits + growth > 15U) ? bits + growth - 15U : 0U;
+}
+
+/* |v| rounded down to one less for negative v, enough for the bit count */
+#define BFP_MAG(v)  ((uint32_t) ((v) ^ ((v) >> 31)))
+
+/* Bit count of the largest component of the fftLen complex values in p */
+static uint32_t bfp_scan(const q15_t * p, uint32_t fftLen)
+{
+    uint32_t m = 0U;
+
+    for (uint32_t i = 0U; i < 2U * fftLen; i++) {
+        q31_t v = p[i];
+        m |= BFP_MAG(v);
+    }
+
+    return bfp_bits(m);
+}
+
+/*
+ * (re + j im) * (cos -/+ j sin), forward / inverse. The Q15 product is
+ * rounded: truncated, it biases every stage by half an LSB, which the
+ * fixed-scaling butterflies shift away but stages without a shift keep.
+ */
+static inline void bfp_twiddle(q31_t re, q31_t im, q31_t c, q31_t s,
+                               uint8_t ifftFlag, q15_t * pOut)
+{
+    if (ifftFlag == 0U) {
+        pOut[0] = (q15_t) ((re * c + im * s + 0x4000) >> 15);
+        pOut[1] = (q15_t) ((im * c - re * s + 0x4000) >> 15);
+    } else {
+        pOut[0] = (q15_t) ((re * c - im * s + 0x4000) >> 15);
+        pOut[1] = (q15_t) ((im * c + re * s + 0x4000) >> 15);
+    }
+}
+
+/*
+ * Radix-2 decimation in frequency, first stage of lengths 4^n * 2.
+ * Inputs are shifted right by shift. Returns the OR of the output
+ * magnitudes.
+ */
+static uint32_t bfp_radix2_stage(q15_t * p, uint32_t fftLen, const q15_t * pCoef,
+                                 uint32_t shift, uint8_t ifftFlag)
+{
+    uint32_t half = fftLen >> 1U;
+    uint32_t stride = RFFT_TWIDDLE_STRIDE(fftLen);
+    uint32_t m = 0U;
+
+    for (uint32_t n = 0U; n < half; n++) {
+        q15_t *pA = &p[2U * n];
+        q15_t *pB = &p[2U * (n + half)];
+        q31_t ar = pA[0] >> shift, ai = pA[1] >> shift;
+        q31_t br = pB[0] >> shift, bi = pB[1] >> shift;
+
+        pA[0] = (q15_t) (ar + br);
+        pA[1] = (q15_t) (ai + bi);
+
+        if (n == 0U) {
+            pB[0] = (q15_t) (ar - br);
+            pB[1] = (q15_t) (ai - bi);
+        } else {
+            bfp_twiddle(ar - br, ai - bi,
+                        RFFT_TWIDDLE_COS(pCoef, n * stride),
+                        RFFT_TWIDDLE_SIN(pCoef, n * stride), ifftFlag, pB);
+        }
+
+        m |= BFP_MAG((q31_t) pA[0]) | BFP_MAG((q31_t) pA[1]) |
+             BFP_MAG((q31_t) pB[0]) | BFP_MAG((q31_t) pB[1]);
+    }
+
+    return m;
+}
+
+/*
+ * One radix-4 decimation in frequency stage over groups of span points.
+ * Inputs are shifted right by shift. The outputs for the second and third
+ * quarters are swapped, like the CMSIS radix-4 butterfly does, so the
+ * final order is the base-2 bit reversal. Returns the OR of the output
+ * magnitudes.
+ */
+static uint32_t bfp_radix4_stage(q15_t * p, uint32_t fftLen, uint32_t span,
+                                 const q15_t * pCoef, uint32_t shift,
+                                 uint8_t ifftFlag)
+{
+    uint32_t n2 = span >> 2U;
+    uint32_t stride = RFFT_TWIDDLE_STRIDE(span);
+    uint32_t m = 0U;
+
+    for (uint32_t g = 0U; g < fftLen; g += span) {
+        for (uint32_t n = 0U; n < n2; n++) {
+            q15_t *pA = &p[2U * (g + n)];
+            q15_t *pB = pA + 2U * n2;
+            q15_t *pC = pB + 2U * n2;
+            q15_t *pD = pC + 2U * n2;
+            q31_t ar = pA[0] >> shift, ai = pA[1] >> shift;
+            q31_t br = pB[0] >> shift, bi = pB[1] >> shift;
+            q31_t cr = pC[0] >> shift, ci = pC[1] >> shift;
+            q31_t dr = pD[0] >> shift, di = pD[1] >> shift;
+            q31_t t0r = ar + cr, t0i = ai + ci;
+            q31_t t1r = ar - cr, t1i = ai - ci;
+            q31_t t2r = br + dr, t2i = bi + di;
+            q31_t t3r = br - dr, t3i = bi - di;
+            q31_t y1r, y1i, y3r, y3i;
+
+            /* y1 = t1 -/+ j t3, y3 = t1 +/- j t3 */
+            if (ifftFlag == 0U) {
+                y1r = t1r + t3i;
+                y1i = t1i - t3r;
+                y3r = t1r - t3i;
+                y3i = t1i + t3r;
+            } else {
+                y1r = t1r - t3i;
+                y1i = t1i + t3r;
+                y3r = t1r + t3i;
+                y3i = t1i - t3r;
+            }
+
+            pA[0] = (q15_t) (t0r + t2r);
+            pA[1] = (q15_t) (t0i + t2i);
+
+            if (n == 0U) {
+                pB[0] = (q15_t) (t0r - t2r);
+                pB[1] = (q15_t) (t0i - t2i);
+                pC[0] = (q15_t) y1r;
+                pC[1] = (q15_t) y1i;
+                pD[0] = (q15_t) y3r;
+                pD[1] = (q15_t) y3i;
+            } else {
+                uint32_t k = n * stride;
+
+                bfp_twiddle(t0r - t2r, t0i - t2i,
+                            RFFT_TWIDDLE_COS(pCoef, 2U * k),
+                            RFFT_TWIDDLE_SIN(pCoef, 2U * k), ifftFlag, pB);
+                bfp_twiddle(y1r, y1i,
+                            RFFT_TWIDDLE_COS(pCoef, k),
+                            RFFT_TWIDDLE_SIN(pCoef, k), ifftFlag, pC);
+                bfp_twiddle(y3r, y3i,
+                            RFFT_TWIDDLE_COS(pCoef, 3U * k),
+                            RFFT_TWIDDLE_SIN(pCoef, 3U * k), ifftFlag, pD);
+            }
+
+            m |= BFP_MAG((q31_t) pA[0]) | BFP_MAG((q31_t) pA[1]) |
+                 BFP_MAG((q31_t) pB[0]) | BFP_MAG((q31_t) pB[1]) |
+                 BFP_MAG((q31_t) pC[0]) | BFP_MAG((q31_t) pC[1]) |
+                 BFP_MAG((q31_t) pD[0]) | BFP_MAG((q31_t) pD[1]);
+        }
+    }
+
+    return m;
+}
+
+/**
+  @brief         Block floating point Q15 complex FFT.
+  @param[in]     S               points to an instance of Q15 CFFT structure
+  @param[in,out] p1              points to the complex data buffer. Processing occurs in-place
+  @param[in]     ifftFlag        flag that selects transform direction
+                   - value = 0: forward transform
+                   - value = 1: inverse transform
+  @param[in]     bitReverseFlag  flag that enables / disables bit reversal of output
+                   - value = 0: disables bit reversal of output
+                   - value = 1: enables bit reversal of output
+  @return        block exponent e, the unscaled transform is p1 * 2^e
+
+  None of the stages needs a wider buffer: butterflies are formed in q31_t
+  registers and stored back as Q15. Besides the stages, one pass over the
+  input finds its headroom.
+ */
+int32_t arm_cfft_q15_bfp(
+  const arm_cfft_instance_q15 * S,
+        q15_t * p1,
+        uint8_t ifftFlag,
+        uint8_t bitReverseFlag)
+{
+    uint32_t L = S->fftLen;
+    uint32_t bits = bfp_scan(p1, L);
+    uint32_t span = L;
+    int32_t exponent = 0;
+
+    /* log2(L) odd: one radix-2 stage, then radix-4 on both halves */
+    if ((L & 0x55555555U) == 0U) {
+        uint32_t shift = bfp_shift(bits, 2U);
+
+        bits = bfp_bits(bfp_radix2_stage(p1, L, S->pTwiddle, shift, ifftFlag));
+        exponent += (int32_t) shift;
+        span >>= 1U;
+    }
+
+    for (; span >= 4U; span >>= 2U) {
+        uint32_t shift = bfp_shift(bits, 3U);
+
+        bits = bfp_bits(bfp_radix4_stage(p1, L, span, S->pTwiddle, shift, ifftFlag));
+        exponent += (int32_t) shift;
+    }
+
+    if (bitReverseFlag) {
+        if (S->pBitRevTable != NULL)
+            arm_bitreversal_16((uint16_t *) p1, S->bitRevLength, S->pBitRevTable);
+        else
+            arm_bitreversal_q15_notable(p1, L);
+    }
+
+    return exponent;
+}
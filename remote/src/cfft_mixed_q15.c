@@ -0,0 +1,309 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library - Simplified Q15 RFFT
+ * Title:        cfft_mixed_q15.c
+ * Description:  Mixed radix 2, 3, 4 and 5 CFFT, and the RFFT on it, for
+ *               lengths that are not a power of two
+ *
+ * Target Processor: nRF54L15 FLPR (RISC-V)
+ * -------------------------------------------------------------------- */
+
+#include "rfft_q15_simplified.h"
+
+/*
+ * Constants of the radix-3 and radix-5 butterflies in Q15, divided by the
+ * radix so the 1/radix scaling of the stage costs no extra multiply:
+ * 1/3, 1/6 and sqrt(3)/6; 1/5, cos(2*pi/5)/5, cos(4*pi/5)/5,
+ * sin(2*pi/5)/5 and sin(4*pi/5)/5. Every sum of products stays below
+ * 2^31 for Q15 inputs turned by a twiddle, up to sqrt(2) * 32768.
+ */
+#define MIXED_R3_C0    10923
+#define MIXED_R3_C1     5461
+#define MIXED_R3_S1     9459
+#define MIXED_R5_C0     6554
+#define MIXED_R5_C1     2025
+#define MIXED_R5_C2    (-5302)
+#define MIXED_R5_S1     6233
+#define MIXED_R5_S2     3852
+
+#define MIXED_ROUND    (1 << 14)
+
+/* x * (c - j s), x = re + j im, rounded to Q15 */
+static inline void mixed_rotate(q31_t *re, q31_t *im, q15_t c, q15_t s)
+{
+    q31_t r = *re * c + *im * s;
+    q31_t i = *im * c - *re * s;
+
+    *re = (r + MIXED_ROUND) >> 15;
+    *im = (i + MIXED_ROUND) >> 15;
+}
+
+static inline void mixed_store(q15_t *y, q31_t re, q31_t im)
+{
+    y[0] = (q15_t) __SSAT(re, 16);
+    y[1] = (q15_t) __SSAT(im, 16);
+}
+
+/*
+ * One Stockham stage of radix p over the ns-point DFTs done so far.
+ * Butterfly j = g * ns + k takes x[j + r * m / p] of the m = N/2 points,
+ * turns input r by the twiddle of angle 2*pi * r * k / (ns * p), and
+ * writes output r to y[g * ns * p + k + r * ns], so the result of the
+ * last stage is in natural order. radix is a constant at every call,
+ * the stage is compiled once per radix.
+ */
+static inline void mixed_stage(const rfft_mixed_q15_t *S, const q15_t *pIn, q15_t *pOut,
+                               uint32_t ns, const uint32_t radix)
+{
+    const uint32_t stride = S->fftLenReal / (2U * radix);
+    const uint32_t step = S->fftLenReal / (ns * radix);
+
+    for (uint32_t k = 0; k < ns; k++) {
+        q15_t w[2U * 4U];
+
+        for (uint32_t r = 1U; r < radix; r++) {
+            rfft_mixed_twiddle(S, r * k * step, &w[2U * (r - 1U)], &w[2U * (r - 1U) + 1U]);
+        }
+
+        for (uint32_t j = k; j < stride; j += ns) {
+            const q15_t *x = &pIn[2U * j];
+            q15_t *y = &pOut[2U * ((j - k) * radix + k)];
+            q31_t a[2U * 5U];
+
+            for (uint32_t r = 0; r < radix; r++) {
+                a[2U * r] = x[2U * r * stride];
+                a[2U * r + 1U] = x[2U * r * stride + 1U];
+                if (r != 0U && k != 0U) {
+                    mixed_rotate(&a[2U * r], &a[2U * r + 1U], w[2U * (r - 1U)], w[2U * (r - 1U) + 1U]);
+                }
+            }
+
+            if (radix == 2U) {
+                mixed_store(&y[0], (a[0] + a[2]) >> 1, (a[1] + a[3]) >> 1);
+                mixed_store(&y[2U * ns], (a[0] - a[2]) >> 1, (a[1] - a[3]) >> 1);
+            } else if (radix == 4U) {
+                q31_t t0r = a[0] + a[4], t0i = a[1] + a[5];
+                q31_t t1r = a[0] - a[4], t1i = a[1] - a[5];
+                q31_t t2r = a[2] + a[6], t2i = a[3] + a[7];
+                q31_t t3r = a[2] - a[6], t3i = a[3] - a[7];
+
+                mixed_store(&y[0], (t0r + t2r) >> 2, (t0i + t2i) >> 2);
+                mixed_store(&y[2U * ns], (t1r + t3i) >> 2, (t1i - t3r) >> 2);
+                mixed_store(&y[4U * ns], (t0r - t2r) >> 2, (t0i - t2i) >> 2);
+                mixed_store(&y[6U * ns], (t1r - t3i) >> 2, (t1i + t3r) >> 2);
+            } else if (radix == 3U) {
+                q31_t t1r = a[2] + a[4], t1i = a[3] + a[5];
+                q31_t t2r = a[2] - a[4], t2i = a[3] - a[5];
+                q31_t br = a[0] * MIXED_R3_C0 - t1r * MIXED_R3_C1 + MIXED_ROUND;
+                q31_t bi = a[1] * MIXED_R3_C0 - t1i * MIXED_R3_C1 + MIXED_ROUND;
+
+                mixed_store(&y[0], ((a[0] + t1r) * MIXED_R3_C0 + MIXED_ROUND) >> 15,
+                            ((a[1] + t1i) * MIXED_R3_C0 + MIXED_ROUND) >> 15);
+                mixed_store(&y[2U * ns], (br + t2i * MIXED_R3_S1) >> 15,
+                            (bi - t2r * MIXED_R3_S1) >> 15);
+                mixed_store(&y[4U * ns], (br - t2i * MIXED_R3_S1) >> 15,
+                            (bi + t2r * MIXED_R3_S1) >> 15);
+            } else {
+                q31_t t1r = a[2] + a[8], t1i = a[3] + a[9];
+                q31_t t2r = a[4] + a[6], t2i = a[5] + a[7];
+                q31_t t3r = a[2] - a[8], t3i = a[3] - a[9];
+                q31_t t4r = a[4] - a[6], t4i = a[5] - a[7];
+                q31_t b1r = a[0] * MIXED_R5_C0 + t1r * MIXED_R5_C1 + t2r * MIXED_R5_C2 + MIXED_ROUND;
+                q31_t b1i = a[1] * MIXED_R5_C0 + t1i * MIXED_R5_C1 + t2i * MIXED_R5_C2 + MIXED_ROUND;
+                q31_t b2r = a[0] * MIXED_R5_C0 + t1r * MIXED_R5_C2 + t2r * MIXED_R5_C1 + MIXED_ROUND;
+                q31_t b2i = a[1] * MIXED_R5_C0 + t1i * MIXED_R5_C2 + t2i * MIXED_R5_C1 + MIXED_ROUND;
+                q31_t u1r = t3r * MIXED_R5_S1 + t4r * MIXED_R5_S2;
+                q31_t u1i = t3i * MIXED_R5_S1 + t4i * MIXED_R5_S2;
+                q31_t u2r = t3r * MIXED_R5_S2 - t4r * MIXED_R5_S1;
+                q31_t u2i = t3i * MIXED_R5_S2 - t4i * MIXED_R5_S1;
+
+                /* y1 = b1 - j u1, y4 = b1 + j u1, y2 = b2 - j u2, y3 = b2 + j u2 */
+                mixed_store(&y[0], ((a[0] + t1r + t2r) * MIXED_R5_C0 + MIXED_ROUND) >> 15,
+                            ((a[1] + t1i + t2i) * MIXED_R5_C0 + MIXED_ROUND) >> 15);
+                mixed_store(&y[2U * ns], (b1r + u1i) >> 15, (b1i - u1r) >> 15);
+                mixed_store(&y[4U * ns], (b2r + u2i) >> 15, (b2i - u2r) >> 15);
+                mixed_store(&y[6U * ns], (b2r - u2i) >> 15, (b2i + u2r) >> 15);
+                mixed_store(&y[8U * ns], (b1r - u1i) >> 15, (b1i + u1r) >> 15);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Forward CFFT of a mixed radix plan, S->fftLenReal / 2 points.
+ * @param[in]     S     points to a plan set up by rfft_mixed_plan_create()
+ * @param[in,out] pSrc  points to the complex input, used as work buffer
+ * @param[in,out] pBuf  points to a second work buffer of S->fftLenReal values
+ * @return pSrc or pBuf, whichever holds the natural order result
+ */
+RFFT_Q15_HOT const q15_t *arm_cfft_q15_mixed(
+  const rfft_mixed_q15_t * S,
+        q15_t * pSrc,
+        q15_t * pBuf)
+{
+    q15_t *pIn = pSrc;
+    q15_t *pOut = pBuf;
+    uint32_t ns = 1U;
+
+    RFFT_PROFILE_BUTTERFLY_FROM(0U);
+
+    for (uint32_t i = 0; i < S->numStages; i++)
+    {
+        q15_t *pTmp;
+
+        switch (S->radix[i])
+        {
+        case 4U: mixed_stage(S, pIn, pOut, ns, 4U); break;
+        case 2U: mixed_stage(S, pIn, pOut, ns, 2U); break;
+        case 3U: mixed_stage(S, pIn, pOut, ns, 3U); break;
+        default: mixed_stage(S, pIn, pOut, ns, 5U); break;
+        }
+        RFFT_PROFILE_MARK_BUTTERFLY();
+
+        ns *= S->radix[i];
+        pTmp = pIn;
+        pIn = pOut;
+        pOut = pTmp;
+    }
+
+    return pIn;
+}
+
+/*
+ * Bin i of the RFFT from X[i] and X[N/2 - i] of the CFFT, with the split
+ * coefficients A = (1 - sin, -cos) / 2 and B = (1 + sin, cos) / 2 of
+ * 2*pi*i/N rounded as arm_rfft_coef_q15() does, and the arithmetic of
+ * arm_split_rfft_bin_q15().
+ */
+static inline void mixed_split_bin(const rfft_mixed_q15_t *S, const q15_t *pA,
+                                   const q15_t *pB, uint32_t i, q31_t *pOutR, q31_t *pOutI)
+{
+    q15_t c, s;
+    q31_t a0, a1, b0, outR, outI;
+
+    rfft_mixed_twiddle(S, i, &c, &s);
+    a0 = 16384 - ((s + 1) >> 1);
+    a1 = (-c) >> 1;
+    b0 = (a0 > 0) ? (32768 - a0) : 32767;
+
+    outR = pA[0] * a0 - pA[1] * a1 + pB[0] * b0 + pB[1] * (-a1);
+    outI = pB[0] * (-a1) - pB[1] * b0 + pA[1] * a0 + pA[0] * a1;
+
+    *pOutR = outR >> 16;
+    *pOutI = outI >> 16;
+}
+
+/**
+ * @brief Real FFT of a mixed radix plan.
+ * @param[in]     S     points to a plan set up by rfft_mixed_plan_create()
+ * @param[in,out] pSrc  points to the real input, used as work buffer
+ * @param[in,out] pBuf  points to a second work buffer of S->fftLenReal values
+ * @param[out]    pDst  points to S->fftLenReal + 2 values for bins 0 to N/2
+ */
+RFFT_Q15_HOT void arm_rfft_q15_mixed(
+  const rfft_mixed_q15_t * S,
+        q15_t * pSrc,
+        q15_t * pBuf,
+        q15_t * pDst)
+{
+    uint32_t L2 = S->fftLenReal >> 1U;
+    const q15_t *pX = arm_cfft_q15_mixed(S, pSrc, pBuf);
+    q31_t outR, outI;
+
+    pDst[0] = (q15_t) ((pX[0] + pX[1]) >> 1);
+    pDst[1] = 0;
+
+    for (uint32_t i = 1U; i < L2; i++)
+    {
+        mixed_split_bin(S, &pX[2U * i], &pX[2U * (L2 - i)], i, &outR, &outI);
+        pDst[2U * i] = (q15_t) outR;
+        pDst[2U * i + 1U] = (q15_t) outI;
+    }
+    RFFT_PROFILE_MARK(RFFT_PROFILE_SPLIT);
+
+    pDst[2U * L2] = (q15_t) ((pX[0] - pX[1]) >> 1);
+    pDst[2U * L2 + 1U] = 0;
+}
+
+/**
+ * @brief Real FFT of a mixed radix plan reporting the magnitude squared of each bin.
+ * @param[in]     S     points to a plan set up by rfft_mixed_plan_create()
+ * @param[in,out] pSrc  points to the real input, used as work buffer
+ * @param[in,out] pBuf  points to a second work buffer of S->fftLenReal values
+ * @param[in]     fn    called once per bin, bins 0 to fftLenReal / 2
+ * @param[in]     user  passed through to fn
+ *
+ * The split step of arm_rfft_q15_mag_sq_stockham() on the natural order
+ * result: X[i] is read front to back and X[N/2 - i] back to front.
+ */
+RFFT_Q15_HOT void arm_rfft_q15_mag_sq_mixed(
+  const rfft_mixed_q15_t * S,
+        q15_t * pSrc,
+        q15_t * pBuf,
+        rfft_q15_bin_fn fn,
+        void * user)
+{
+    uint32_t L2 = S->fftLenReal >> 1U;
+    const q15_t *pA = arm_cfft_q15_mixed(S, pSrc, pBuf);
+    const q15_t *pB;
+    q31_t outR, outI;
+    q31_t dc = (pA[0] + pA[1]) >> 1;
+
+    fn(0U, (uint32_t) (dc * dc), user);
+
+    pB = &pA[2U * (L2 - 1U)];
+    pA += 2U;
+
+    for (uint32_t i = 1U; i < L2; i++)
+    {
+        q15_t re, im;
+
+        mixed_split_bin(S, pA, pB, i, &outR, &outI);
+        RFFT_PROFILE_MARK(RFFT_PROFILE_SPLIT);
+
+        re = (q15_t) outR;
+        im = (q15_t) outI;
+        RFFT_PROFILE_MARK(RFFT_PROFILE_MAG);
+
+        fn(i, (uint32_t) ((q31_t) re * re) + (uint32_t) ((q31_t) im * im), user);
+        RFFT_PROFILE_MARK(RFFT_PROFILE_TOPK);
+
+        pA += 2U;
+        pB -= 2U;
+    }
+
+    /* pB is back at X[0] */
+    dc = (pB[0] - pB[1]) >> 1;
+    fn(L2, (uint32_t) (dc * dc), user);
+}
+
+/**
+ * @brief One bin of the spectrum behind the last arm_rfft_q15_mag_sq_mixed().
+ * @param[in]     S     points to the plan passed to arm_rfft_q15_mag_sq_mixed()
+ * @param[in]     pSrc  points to the input buffer it was given
+ * @param[in]     pBuf  points to the work buffer it was given
+ * @param[in]     bin   bin index, 0 to fftLenReal / 2
+ * @param[out]    pOut  real and imaginary part, as arm_rfft_q15_mixed() outputs them
+ */
+RFFT_Q15_HOT void arm_rfft_q15_mag_sq_mixed_bin(
+  const rfft_mixed_q15_t * S,
+  const q15_t * pSrc,
+  const q15_t * pBuf,
+        uint32_t bin,
+        q15_t * pOut)
+{
+    uint32_t L2 = S->fftLenReal >> 1U;
+    const q15_t *pX = ((S->numStages & 1U) != 0U) ? pBuf : pSrc;
+    q31_t outR, outI;
+
+    if (bin == 0U || bin == L2)
+    {
+        pOut[0] = (q15_t) ((bin == 0U) ? ((pX[0] + pX[1]) >> 1) : ((pX[0] - pX[1]) >> 1));
+        pOut[1] = 0;
+        return;
+    }
+
+    mixed_split_bin(S, &pX[2U * bin], &pX[2U * (L2 - bin)], bin, &outR, &outI);
+
+    pOut[0] = (q15_t) outR;
+    pOut[1] = (q15_t) outI;
+}
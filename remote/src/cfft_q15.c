@@ -12,6 +12,7 @@
  */
 
 #include "rfft_q15_simplified.h"
+#include <stddef.h>
 
 /* Define ARM_DSP_ATTRIBUTE as empty for PC compilation */
 #ifndef ARM_DSP_ATTRIBUTE
@@ -24,557 +25,19 @@ extern void arm_bitreversal_16(
   const uint16_t bitRevLen,
   const uint16_t * pBitRevTable);
 
-#if defined(ARM_MATH_MVEI) && !defined(ARM_MATH_AUTOVECTORIZE)
-
-#include "arm_vec_fft.h"
-
-
-static void _arm_radix4_butterfly_q15_mve(
-    const arm_cfft_instance_q15 * S,
-    q15_t   *pSrc,
-    uint32_t fftLen)
-{
-    q15x8_t vecTmp0, vecTmp1;
-    q15x8_t vecSum0, vecDiff0, vecSum1, vecDiff1;
-    q15x8_t vecA, vecB, vecC, vecD;
-    uint32_t  blkCnt;
-    uint32_t  n1, n2;
-    uint32_t  stage = 0;
-    int32_t  iter = 1;
-    static const int32_t strides[4] = {
-        (0 - 16) * (int32_t)sizeof(q15_t *), (4 - 16) * (int32_t)sizeof(q15_t *),
-        (8 - 16) * (int32_t)sizeof(q15_t *), (12 - 16) * (int32_t)sizeof(q15_t *)
-    };
-
-    /*
-     * Process first stages
-     * Each stage in middle stages provides two down scaling of the input
-     */
-    n2 = fftLen;
-    n1 = n2;
-    n2 >>= 2u;
-
-    for (int k = fftLen / 4u; k > 1; k >>= 2u)
-    {
-        q15_t const *p_rearranged_twiddle_tab_stride2 =
-            &S->rearranged_twiddle_stride2[
-            S->rearranged_twiddle_tab_stride2_arr[stage]];
-        q15_t const *p_rearranged_twiddle_tab_stride3 = &S->rearranged_twiddle_stride3[
-            S->rearranged_twiddle_tab_stride3_arr[stage]];
-        q15_t const *p_rearranged_twiddle_tab_stride1 =
-            &S->rearranged_twiddle_stride1[
-            S->rearranged_twiddle_tab_stride1_arr[stage]];
-
-        q15_t * pBase = pSrc;
-        for (int i = 0; i < iter; i++)
-        {
-            q15_t    *inA = pBase;
-            q15_t    *inB = inA + n2 * CMPLX_DIM;
-            q15_t    *inC = inB + n2 * CMPLX_DIM;
-            q15_t    *inD = inC + n2 * CMPLX_DIM;
-            q15_t const *pW1 = p_rearranged_twiddle_tab_stride1;
-            q15_t const *pW2 = p_rearranged_twiddle_tab_stride2;
-            q15_t const *pW3 = p_rearranged_twiddle_tab_stride3;
-            q15x8_t    vecW;
-
-            blkCnt = n2 / 4;
-            /*
-             * load 4 x q15 complex pair
-             */
-            vecA = vldrhq_s16(inA);
-            vecC = vldrhq_s16(inC);
-            while (blkCnt > 0U)
-            {
-                vecB = vldrhq_s16(inB);
-                vecD = vldrhq_s16(inD);
-
-                vecSum0 = vhaddq(vecA, vecC);
-                vecDiff0 = vhsubq(vecA, vecC);
-
-                vecSum1 = vhaddq(vecB, vecD);
-                vecDiff1 = vhsubq(vecB, vecD);
-                /*
-                 * [ 1 1 1 1 ] * [ A B C D ]' .* 1
-                 */
-                vecTmp0 = vhaddq(vecSum0, vecSum1);
-                vst1q(inA, vecTmp0);
-                inA += 8;
-                /*
-                 * [ 1 -1 1 -1 ] * [ A B C D ]'
-                 */
-                vecTmp0 = vhsubq(vecSum0, vecSum1);
-                /*
-                 * [ 1 -1 1 -1 ] * [ A B C D ]'.* W2
-                 */
-                vecW = vld1q(pW2);
-                pW2 += 8;
-                vecTmp1 = MVE_CMPLX_MULT_FX_AxB(vecW, vecTmp0, q15x8_t);
-
-                vst1q(inB, vecTmp1);
-                inB += 8;
-                /*
-                 * [ 1 -i -1 +i ] * [ A B C D ]'
-                 */
-                vecTmp0 = MVE_CMPLX_SUB_FX_A_ixB(vecDiff0, vecDiff1);
-                /*
-                 * [ 1 -i -1 +i ] * [ A B C D ]'.* W1
-                 */
-                vecW = vld1q(pW1);
-                pW1 += 8;
-                vecTmp1 = MVE_CMPLX_MULT_FX_AxB(vecW, vecTmp0, q15x8_t);
-                vst1q(inC, vecTmp1);
-                inC += 8;
-
-                /*
-                 * [ 1 +i -1 -i ] * [ A B C D ]'
-                 */
-                vecTmp0 = MVE_CMPLX_ADD_FX_A_ixB(vecDiff0, vecDiff1);
-                /*
-                 * [ 1 +i -1 -i ] * [ A B C D ]'.* W3
-                 */
-                vecW = vld1q(pW3);
-                pW3 += 8;
-                vecTmp1 = MVE_CMPLX_MULT_FX_AxB(vecW, vecTmp0, q15x8_t);
-                vst1q(inD, vecTmp1);
-                inD += 8;
-
-                vecA = vldrhq_s16(inA);
-                vecC = vldrhq_s16(inC);
-
-                blkCnt--;
-            }
-            pBase +=  CMPLX_DIM * n1;
-        }
-        n1 = n2;
-        n2 >>= 2u;
-        iter = iter << 2;
-        stage++;
-    }
-
-    /*
-     * start of Last stage process
-     */
-    uint32x4_t vecScGathAddr = vld1q_u32 ((uint32_t*)strides);
-    vecScGathAddr = vecScGathAddr + (uint32_t) pSrc;
-
-    /*
-     * load scheduling
-     */
-    vecA = (q15x8_t) vldrwq_gather_base_wb_s32(&vecScGathAddr, 64);
-    vecC = (q15x8_t) vldrwq_gather_base_s32(vecScGathAddr, 8);
-
-    blkCnt = (fftLen >> 4);
-    while (blkCnt > 0U)
-    {
-        vecSum0 = vhaddq(vecA, vecC);
-        vecDiff0 = vhsubq(vecA, vecC);
-
-        vecB = (q15x8_t) vldrwq_gather_base_s32(vecScGathAddr, 4);
-        vecD = (q15x8_t) vldrwq_gather_base_s32(vecScGathAddr, 12);
-
-        vecSum1 = vhaddq(vecB, vecD);
-        vecDiff1 = vhsubq(vecB, vecD);
-        /*
-         * pre-load for next iteration
-         */
-        vecA = (q15x8_t) vldrwq_gather_base_wb_s32(&vecScGathAddr, 64);
-        vecC = (q15x8_t) vldrwq_gather_base_s32(vecScGathAddr, 8);
-
-        vecTmp0 = vhaddq(vecSum0, vecSum1);
-        vstrwq_scatter_base_s32(vecScGathAddr, -64, (int32x4_t) vecTmp0);
-
-        vecTmp0 = vhsubq(vecSum0, vecSum1);
-        vstrwq_scatter_base_s32(vecScGathAddr, -64 + 4, (int32x4_t) vecTmp0);
-
-        vecTmp0 = MVE_CMPLX_SUB_FX_A_ixB(vecDiff0, vecDiff1);
-        vstrwq_scatter_base_s32(vecScGathAddr, -64 + 8, (int32x4_t) vecTmp0);
-
-        vecTmp0 = MVE_CMPLX_ADD_FX_A_ixB(vecDiff0, vecDiff1);
-        vstrwq_scatter_base_s32(vecScGathAddr, -64 + 12, (int32x4_t) vecTmp0);
-
-        blkCnt--;
-    }
-
-}
-
-static void arm_cfft_radix4by2_q15_mve(const arm_cfft_instance_q15 *S, q15_t *pSrc, uint32_t fftLen)
-{
-    uint32_t n2;
-    q15_t *pIn0;
-    q15_t *pIn1;
-    const q15_t *pCoef = S->pTwiddle;
-    uint32_t     blkCnt;
-    q15x8_t    vecIn0, vecIn1, vecSum, vecDiff;
-    q15x8_t    vecCmplxTmp, vecTw;
-    q15_t  const *pCoefVec;
-
-    n2 = fftLen >> 1;
-
-    pIn0 = pSrc;
-    pIn1 = pSrc + fftLen;
-    pCoefVec = pCoef;
-
-    blkCnt = n2 / 4;
-
-    while (blkCnt > 0U)
-    {
-        vecIn0 = *(q15x8_t *) pIn0;
-        vecIn1 = *(q15x8_t *) pIn1;
-
-        vecIn0 = vecIn0 >> 1;
-        vecIn1 = vecIn1 >> 1;
-        vecSum = vhaddq(vecIn0, vecIn1);
-        vst1q(pIn0, vecSum);
-        pIn0 += 8;
-
-        vecTw = vld1q(pCoefVec);
-        pCoefVec += 8;
-
-        vecDiff = vhsubq(vecIn0, vecIn1);
-        vecCmplxTmp = MVE_CMPLX_MULT_FX_AxConjB(vecDiff, vecTw, q15x8_t);
-        vst1q(pIn1, vecCmplxTmp);
-        pIn1 += 8;
-
-        blkCnt--;
-    }
-
-    _arm_radix4_butterfly_q15_mve(S, pSrc, n2);
-
-    _arm_radix4_butterfly_q15_mve(S, pSrc + fftLen, n2);
-
-
-    pIn0 = pSrc;
-    blkCnt = (fftLen << 1) >> 3;
-    while (blkCnt > 0U)
-    {
-        vecIn0 = *(q15x8_t *) pIn0;
-        vecIn0 = vecIn0 << 1;
-        vst1q(pIn0, vecIn0);
-        pIn0 += 8;
-        blkCnt--;
-    }
-    /*
-     * tail
-     * (will be merged thru tail predication)
-     */
-    blkCnt = (fftLen << 1) & 7;
-    if (blkCnt > 0U)
-    {
-        mve_pred16_t p0 = vctp16q(blkCnt);
-
-        vecIn0 = *(q15x8_t *) pIn0;
-        vecIn0 = vecIn0 << 1;
-        vstrhq_p(pIn0, vecIn0, p0);
-    }
-}
-
-static void _arm_radix4_butterfly_inverse_q15_mve(const arm_cfft_instance_q15 *S,q15_t *pSrc, uint32_t fftLen)
-{
-    q15x8_t vecTmp0, vecTmp1;
-    q15x8_t vecSum0, vecDiff0, vecSum1, vecDiff1;
-    q15x8_t vecA, vecB, vecC, vecD;
-    uint32_t  blkCnt;
-    uint32_t  n1, n2;
-    uint32_t  stage = 0;
-    int32_t  iter = 1;
-    static const int32_t strides[4] = {
-        (0 - 16) * (int32_t)sizeof(q15_t *), (4 - 16) * (int32_t)sizeof(q15_t *),
-        (8 - 16) * (int32_t)sizeof(q15_t *), (12 - 16) * (int32_t)sizeof(q15_t *)
-    };
-
-
-    /*
-     * Process first stages
-     * Each stage in middle stages provides two down scaling of the input
-     */
-    n2 = fftLen;
-    n1 = n2;
-    n2 >>= 2u;
-
-    for (int k = fftLen / 4u; k > 1; k >>= 2u)
-    {
-        q15_t const *p_rearranged_twiddle_tab_stride2 =
-            &S->rearranged_twiddle_stride2[
-            S->rearranged_twiddle_tab_stride2_arr[stage]];
-        q15_t const *p_rearranged_twiddle_tab_stride3 = &S->rearranged_twiddle_stride3[
-            S->rearranged_twiddle_tab_stride3_arr[stage]];
-        q15_t const *p_rearranged_twiddle_tab_stride1 =
-            &S->rearranged_twiddle_stride1[
-            S->rearranged_twiddle_tab_stride1_arr[stage]];
-
-        q15_t * pBase = pSrc;
-        for (int i = 0; i < iter; i++)
-        {
-            q15_t    *inA = pBase;
-            q15_t    *inB = inA + n2 * CMPLX_DIM;
-            q15_t    *inC = inB + n2 * CMPLX_DIM;
-            q15_t    *inD = inC + n2 * CMPLX_DIM;
-            q15_t const *pW1 = p_rearranged_twiddle_tab_stride1;
-            q15_t const *pW2 = p_rearranged_twiddle_tab_stride2;
-            q15_t const *pW3 = p_rearranged_twiddle_tab_stride3;
-            q15x8_t    vecW;
-
-
-            blkCnt = n2 / 4;
-            /*
-             * load 4 x q15 complex pair
-             */
-            vecA = vldrhq_s16(inA);
-            vecC = vldrhq_s16(inC);
-            while (blkCnt > 0U)
-            {
-                vecB = vldrhq_s16(inB);
-                vecD = vldrhq_s16(inD);
-
-                vecSum0 = vhaddq(vecA, vecC);
-                vecDiff0 = vhsubq(vecA, vecC);
-
-                vecSum1 = vhaddq(vecB, vecD);
-                vecDiff1 = vhsubq(vecB, vecD);
-                /*
-                 * [ 1 1 1 1 ] * [ A B C D ]' .* 1
-                 */
-                vecTmp0 = vhaddq(vecSum0, vecSum1);
-                vst1q(inA, vecTmp0);
-                inA += 8;
-                /*
-                 * [ 1 -1 1 -1 ] * [ A B C D ]'
-                 */
-                vecTmp0 = vhsubq(vecSum0, vecSum1);
-                /*
-                 * [ 1 -1 1 -1 ] * [ A B C D ]'.* W2
-                 */
-                vecW = vld1q(pW2);
-                pW2 += 8;
-                vecTmp1 = MVE_CMPLX_MULT_FX_AxConjB(vecTmp0, vecW, q15x8_t);
-
-                vst1q(inB, vecTmp1);
-                inB += 8;
-                /*
-                 * [ 1 -i -1 +i ] * [ A B C D ]'
-                 */
-                vecTmp0 = MVE_CMPLX_ADD_FX_A_ixB(vecDiff0, vecDiff1);
-                /*
-                 * [ 1 -i -1 +i ] * [ A B C D ]'.* W1
-                 */
-                vecW = vld1q(pW1);
-                pW1 += 8;
-                vecTmp1 = MVE_CMPLX_MULT_FX_AxConjB(vecTmp0, vecW, q15x8_t);
-                vst1q(inC, vecTmp1);
-                inC += 8;
-                /*
-                 * [ 1 +i -1 -i ] * [ A B C D ]'
-                 */
-                vecTmp0 = MVE_CMPLX_SUB_FX_A_ixB(vecDiff0, vecDiff1);
-                /*
-                 * [ 1 +i -1 -i ] * [ A B C D ]'.* W3
-                 */
-                vecW = vld1q(pW3);
-                pW3 += 8;
-                vecTmp1 = MVE_CMPLX_MULT_FX_AxConjB(vecTmp0, vecW, q15x8_t);
-                vst1q(inD, vecTmp1);
-                inD += 8;
-
-                vecA = vldrhq_s16(inA);
-                vecC = vldrhq_s16(inC);
-
-                blkCnt--;
-            }
-            pBase +=  CMPLX_DIM * n1;
-        }
-        n1 = n2;
-        n2 >>= 2u;
-        iter = iter << 2;
-        stage++;
-    }
-
-    /*
-     * start of Last stage process
-     */
-    uint32x4_t vecScGathAddr = vld1q_u32((uint32_t*)strides);
-    vecScGathAddr = vecScGathAddr + (uint32_t) pSrc;
-
-    /*
-     * load scheduling
-     */
-    vecA = (q15x8_t) vldrwq_gather_base_wb_s32(&vecScGathAddr, 64);
-    vecC = (q15x8_t) vldrwq_gather_base_s32(vecScGathAddr, 8);
-
-    blkCnt = (fftLen >> 4);
-    while (blkCnt > 0U)
-    {
-        vecSum0 = vhaddq(vecA, vecC);
-        vecDiff0 = vhsubq(vecA, vecC);
-
-        vecB = (q15x8_t) vldrwq_gather_base_s32(vecScGathAddr, 4);
-        vecD = (q15x8_t) vldrwq_gather_base_s32(vecScGathAddr, 12);
-
-        vecSum1 = vhaddq(vecB, vecD);
-        vecDiff1 = vhsubq(vecB, vecD);
-        /*
-         * pre-load for next iteration
-         */
-        vecA = (q15x8_t) vldrwq_gather_base_wb_s32(&vecScGathAddr, 64);
-        vecC = (q15x8_t) vldrwq_gather_base_s32(vecScGathAddr, 8);
-
-        vecTmp0 = vhaddq(vecSum0, vecSum1);
-        vstrwq_scatter_base_s32(vecScGathAddr, -64, (int32x4_t) vecTmp0);
-
-        vecTmp0 = vhsubq(vecSum0, vecSum1);
-        vstrwq_scatter_base_s32(vecScGathAddr, -64 + 4, (int32x4_t) vecTmp0);
-
-        vecTmp0 = MVE_CMPLX_ADD_FX_A_ixB(vecDiff0, vecDiff1);
-        vstrwq_scatter_base_s32(vecScGathAddr, -64 + 8, (int32x4_t) vecTmp0);
-
-        vecTmp0 = MVE_CMPLX_SUB_FX_A_ixB(vecDiff0, vecDiff1);
-        vstrwq_scatter_base_s32(vecScGathAddr, -64 + 12, (int32x4_t) vecTmp0);
-
-        blkCnt--;
-    }
-}
-
-static void arm_cfft_radix4by2_inverse_q15_mve(const arm_cfft_instance_q15 *S, q15_t *pSrc, uint32_t fftLen)
-{
-    uint32_t n2;
-    q15_t *pIn0;
-    q15_t *pIn1;
-    const q15_t *pCoef = S->pTwiddle;
-
-    uint32_t     blkCnt;
-    q15x8_t    vecIn0, vecIn1, vecSum, vecDiff;
-    q15x8_t    vecCmplxTmp, vecTw;
-    q15_t  const *pCoefVec;
-
-    n2 = fftLen >> 1;
-
-    pIn0 = pSrc;
-    pIn1 = pSrc + fftLen;
-    pCoefVec = pCoef;
-
-    blkCnt = n2 / 4;
-
-    while (blkCnt > 0U)
-    {
-        vecIn0 = *(q15x8_t *) pIn0;
-        vecIn1 = *(q15x8_t *) pIn1;
-
-        vecIn0 = vecIn0 >> 1;
-        vecIn1 = vecIn1 >> 1;
-        vecSum = vhaddq(vecIn0, vecIn1);
-        vst1q(pIn0, vecSum);
-        pIn0 += 8;
-
-        vecTw = vld1q(pCoefVec);
-        pCoefVec += 8;
-
-        vecDiff = vhsubq(vecIn0, vecIn1);
-        vecCmplxTmp = vqrdmlsdhq(vuninitializedq_s16() , vecDiff, vecTw);
-        vecCmplxTmp = vqrdmladhxq(vecCmplxTmp, vecDiff, vecTw);
-        vst1q(pIn1, vecCmplxTmp);
-        pIn1 += 8;
-
-        blkCnt--;
-    }
-
-
-    _arm_radix4_butterfly_inverse_q15_mve(S, pSrc, n2);
-
-    _arm_radix4_butterfly_inverse_q15_mve(S, pSrc + fftLen, n2);
-
-    pIn0 = pSrc;
-    blkCnt = (fftLen << 1) >> 3;
-    while (blkCnt > 0U)
-    {
-        vecIn0 = *(q15x8_t *) pIn0;
-        vecIn0 = vecIn0 << 1;
-        vst1q(pIn0, vecIn0);
-        pIn0 += 8;
-        blkCnt--;
-    }
-    /*
-     * tail
-     * (will be merged thru tail predication)
-     */
-    blkCnt = (fftLen << 1) & 7;
-    while (blkCnt > 0U)
-    {
-        mve_pred16_t p0 = vctp16q(blkCnt);
-
-        vecIn0 = *(q15x8_t *) pIn0;
-        vecIn0 = vecIn0 << 1;
-        vstrhq_p(pIn0, vecIn0, p0);
-    }
-}
-
-ARM_DSP_ATTRIBUTE void arm_cfft_q15(
-  const arm_cfft_instance_q15 * S,
-        q15_t * pSrc,
-        uint8_t ifftFlag,
-        uint8_t bitReverseFlag)
-{
-        uint32_t fftLen = S->fftLen;
-
-        if (ifftFlag == 1U) {
-
-            switch (fftLen) {
-            case 16:
-            case 64:
-            case 256:
-            case 1024:
-            case 4096:
-                _arm_radix4_butterfly_inverse_q15_mve(S, pSrc, fftLen);
-                break;
-
-            case 32:
-            case 128:
-            case 512:
-            case 2048:
-                arm_cfft_radix4by2_inverse_q15_mve(S, pSrc, fftLen);
-                break;
-            }
-        } else {
-            switch (fftLen) {
-            case 16:
-            case 64:
-            case 256:
-            case 1024:
-            case 4096:
-                _arm_radix4_butterfly_q15_mve(S, pSrc, fftLen);
-                break;
-
-            case 32:
-            case 128:
-            case 512:
-            case 2048:
-                arm_cfft_radix4by2_q15_mve(S, pSrc, fftLen);
-                break;
-            }
-        }
-
-
-        if (bitReverseFlag)
-        {
-
-            arm_bitreversal_16_inpl_mve((uint16_t*)pSrc, S->bitRevLength, S->pBitRevTable);
-
-        }
-}
-
-#else
-
-#if !defined(ARM_MATH_NEON)
-
 extern void arm_radix4_butterfly_q15(
         q15_t * pSrc,
         uint32_t fftLen,
   const q15_t * pCoef,
-        uint32_t twidCoefModifier);
+        uint32_t twidCoefModifier,
+        uint32_t shift);
 
 extern void arm_radix4_butterfly_inverse_q15(
         q15_t * pSrc,
         uint32_t fftLen,
   const q15_t * pCoef,
-        uint32_t twidCoefModifier);
+        uint32_t twidCoefModifier,
+        uint32_t shift);
 
 extern void arm_bitreversal_16(
         uint16_t * pSrc,
@@ -589,8 +52,30 @@ ARM_DSP_ATTRIBUTE void arm_cfft_radix4by2_q15(
 ARM_DSP_ATTRIBUTE void arm_cfft_radix4by2_inverse_q15(
         q15_t * pSrc,
         uint32_t fftLen,
-  const q15_t * pCoef);
+  const q15_t * pCoef,
+        uint32_t shift);
+
+#if !defined (ARM_MATH_DSP) && defined (RFFT_Q15_PACKED_BUTTERFLY)
+extern void arm_radix4_butterfly_q15_packed(
+        q15_t * pSrc,
+        uint32_t fftLen,
+  const q15_t * pCoef,
+        uint32_t twidCoefModifier,
+        q15_t * pDst);
 
+extern void arm_cfft_radix4by2_q15_packed(
+        q15_t * pSrc,
+        uint32_t fftLen,
+  const q15_t * pCoef,
+        q15_t * pDst);
+
+#if defined (RFFT_Q15_STOCKHAM)
+extern q15_t * arm_radix4_butterfly_q15_stockham(
+  const q15_t * pSrc,
+        q15_t * pA,
+        q15_t * pB,
+        uint32_t fftLen);
+#endif
 #endif
 
 /**
@@ -627,44 +112,12 @@ ARM_DSP_ATTRIBUTE void arm_cfft_radix4by2_inverse_q15(
 | 256         | 1.15          | 9.7            | 0     
 | 1024        | 1.15          | 11.5           | 0     
 
-  @par Neon version
-                     The neon version has a different API.
-                     The input and output buffers must be
-                     different.
-                     There is a temporary buffer.
-                     The bit reverse flag is not more 
-                     available in Neon version.
-
-  @code
-        void arm_cfft_q15(
-  const arm_cfft_instance_q15 * S,
-        const q15_t * src,
-        q15_t * dst,
-        q15_t *buffer,
-        uint8_t ifftFlag)
-  @endcode
-
   @par Size of buffers according to the target architecture and datatype:
        They are described on the page \ref transformbuffers "transform buffers".
 
  */
 
-#if defined(ARM_MATH_NEON)
-#include "CMSIS_NE10_types.h"
-#include "CMSIS_NE10_fft.h"
-
-ARM_DSP_ATTRIBUTE void arm_cfft_q15(
-  const arm_cfft_instance_q15 * S,
-        const q15_t * src,
-        q15_t * dst,
-        q15_t *buffer,
-        uint8_t ifftFlag)
-{
-   arm_ne10_fft_c2c_1d_int16_neon (dst,src,S,ifftFlag,1,buffer);
-}
-
-#else
-ARM_DSP_ATTRIBUTE void arm_cfft_q15(
+ARM_DSP_ATTRIBUTE RFFT_Q15_HOT void arm_cfft_q15(
   const arm_cfft_instance_q15 * S,
         q15_t * p1,
         uint8_t ifftFlag,
@@ -673,6 +126,11 @@ ARM_DSP_ATTRIBUTE void arm_cfft_q15(
   uint32_t L = S->fftLen;
 
   if (ifftFlag == 1U)
+  {
+     /* bit reversal below */
+     arm_cfft_q15_inverse_shl (S, p1, 0U, 0U);
+  }
+  else
   {
      switch (L)
      {
@@ -681,19 +139,113 @@ ARM_DSP_ATTRIBUTE void arm_cfft_q15(
      case 256:
      case 1024:
      case 4096:
-       arm_radix4_butterfly_inverse_q15 ( p1, L, (q15_t*)S->pTwiddle, 1 );
+       arm_radix4_butterfly_q15  ( p1, L, (q15_t*)S->pTwiddle, RFFT_TWIDDLE_STRIDE(L), 0U );
        break;
 
      case 32:
      case 128:
      case 512:
      case 2048:
-       arm_cfft_radix4by2_inverse_q15 ( p1, L, S->pTwiddle );
+#if !defined (ARM_MATH_DSP) && defined (RFFT_Q15_PACKED_BUTTERFLY)
+       arm_cfft_radix4by2_q15_packed  ( p1, L, S->pTwiddle, NULL );
+#else
+       arm_cfft_radix4by2_q15  ( p1, L, S->pTwiddle );
+#endif
        break;
      }
   }
-  else
+
+  if ( bitReverseFlag )
+  {
+    if ( S->pBitRevTable != NULL )
+      arm_bitreversal_16 ((uint16_t*) p1, S->bitRevLength, S->pBitRevTable);
+    else
+      arm_bitreversal_q15_notable (p1, L);
+
+    RFFT_PROFILE_MARK(RFFT_PROFILE_BITREV);
+  }
+}
+
+/**
+  @brief         Q15 complex inverse FFT with an output shift.
+  @param[in]     S               points to an instance of Q15 CFFT structure
+  @param[in,out] p1              points to the complex data buffer. Processing occurs in-place
+  @param[in]     bitReverseFlag  flag that enables / disables bit reversal of output
+  @param[in]     shift           left shift applied to every output value
+
+  Same result as arm_cfft_q15(S, p1, 1, bitReverseFlag) followed by
+  p1[i] <<= shift over the buffer, Q15 wrap-around included. The shift is
+  done by the last radix-4 stage, so it costs no pass of its own.
+ */
+ARM_DSP_ATTRIBUTE void arm_cfft_q15_inverse_shl(
+  const arm_cfft_instance_q15 * S,
+        q15_t * p1,
+        uint8_t bitReverseFlag,
+        uint32_t shift)
+{
+  uint32_t L = S->fftLen;
+
+  switch (L)
   {
+  case 16:
+  case 64:
+  case 256:
+  case 1024:
+  case 4096:
+    arm_radix4_butterfly_inverse_q15 ( p1, L, (q15_t*)S->pTwiddle, RFFT_TWIDDLE_STRIDE(L), shift );
+    break;
+
+  case 32:
+  case 128:
+  case 512:
+  case 2048:
+    arm_cfft_radix4by2_inverse_q15 ( p1, L, S->pTwiddle, shift );
+    break;
+  }
+
+  if ( bitReverseFlag )
+  {
+    if ( S->pBitRevTable != NULL )
+      arm_bitreversal_16 ((uint16_t*) p1, S->bitRevLength, S->pBitRevTable);
+    else
+      arm_bitreversal_q15_notable (p1, L);
+  }
+}
+
+/**
+  @brief         Out-of-place processing function for Q15 complex FFT.
+  @param[in]     S        points to an instance of Q15 CFFT structure
+  @param[in,out] pSrc     points to the complex input buffer, used as work buffer
+  @param[out]    pDst     points to the complex output buffer, natural order
+  @param[in]     ifftFlag flag that selects transform direction
+                   - value = 0: forward transform
+                   - value = 1: inverse transform
+
+  The bit reversal table of S is not used. In the packed forward transform
+  the last butterfly stage stores its outputs at their bit-reversed
+  positions in pDst, so no separate reordering pass is made. Other builds
+  run the in-place transform and reorder while copying to pDst.
+
+  With RFFT_Q15_STOCKHAM the forward transform runs in Stockham order
+  from pSrc, which it does not modify, through both halves of pDst, which
+  must hold 2 * fftLen complex values.
+ */
+ARM_DSP_ATTRIBUTE void arm_cfft_q15_out(
+  const arm_cfft_instance_q15 * S,
+        q15_t * pSrc,
+        q15_t * pDst,
+        uint8_t ifftFlag)
+{
+  uint32_t L = S->fftLen;
+
+#if !defined (ARM_MATH_DSP) && defined (RFFT_Q15_PACKED_BUTTERFLY)
+  if (ifftFlag == 0U)
+  {
+#if defined (RFFT_Q15_STOCKHAM)
+     (void) arm_radix4_butterfly_q15_stockham ( pSrc, pDst, pDst + 2U * L, L );
+     return;
+#endif
+
      switch (L)
      {
      case 16:
@@ -701,38 +253,61 @@ ARM_DSP_ATTRIBUTE void arm_cfft_q15(
      case 256:
      case 1024:
      case 4096:
-       arm_radix4_butterfly_q15  ( p1, L, (q15_t*)S->pTwiddle, 1 );
-       break;
+       arm_radix4_butterfly_q15_packed ( pSrc, L, S->pTwiddle, RFFT_TWIDDLE_STRIDE(L), pDst );
+       return;
 
      case 32:
      case 128:
      case 512:
      case 2048:
-       arm_cfft_radix4by2_q15  ( p1, L, S->pTwiddle );
-       break;
+       arm_cfft_radix4by2_q15_packed ( pSrc, L, S->pTwiddle, pDst );
+       return;
      }
   }
+#endif
 
-  if ( bitReverseFlag )
-    arm_bitreversal_16 ((uint16_t*) p1, S->bitRevLength, S->pBitRevTable);
+  arm_cfft_q15 (S, pSrc, ifftFlag, 0U);
+  arm_bitreversal_q15_copy (pSrc, pDst, L);
+  RFFT_PROFILE_MARK(RFFT_PROFILE_BITREV);
 }
 
-#endif 
+#if defined (RFFT_Q15_STOCKHAM)
+/**
+  @brief         Forward Q15 complex FFT in Stockham order, ping-ponging between two buffers.
+  @param[in]     S     points to an instance of Q15 CFFT structure
+  @param[in,out] pSrc  points to the complex input buffer, used as work buffer
+  @param[in,out] pBuf  points to a second work buffer of fftLen complex values
+  @return        pSrc or pBuf, whichever holds the result in natural order
+
+  No bit reversal pass and no bit reversal table: every stage reads and
+  writes both buffers in sequential runs. Which buffer the result ends up
+  in only depends on the length, see RFFT_Q15_STOCKHAM_IN_BUF().
+ */
+q15_t * arm_cfft_q15_stockham(
+  const arm_cfft_instance_q15 * S,
+        q15_t * pSrc,
+        q15_t * pBuf)
+{
+  return arm_radix4_butterfly_q15_stockham ( pSrc, pSrc, pBuf, S->fftLen );
+}
+#endif
 
 /**
   @} end of ComplexFFTQ15 group
  */
 
-#if !defined(ARM_MATH_NEON)
-
-ARM_DSP_ATTRIBUTE void arm_cfft_radix4by2_q15(
+/*
+  First radix-2 stage of a forward CFFT of fftLen points: leaves the inputs
+  of the even bins, halved twice, in the first fftLen / 2 points of pSrc
+  and those of the odd bins, times the twiddles, in the last.
+ */
+static void arm_cfft_radix4by2_pre_q15(
         q15_t * pSrc,
         uint32_t fftLen,
   const q15_t * pCoef)
 {
         uint32_t i;
         uint32_t n2;
-        q15_t p0, p1, p2, p3;
 #if defined (ARM_MATH_DSP)
         q31_t T, S, R;
         q31_t coeff, out1, out2;
@@ -750,7 +325,8 @@ ARM_DSP_ATTRIBUTE void arm_cfft_radix4by2_q15(
 
   for (i = n2; i > 0; i--)
   {
-      coeff = read_q15x2_ia (&pC);
+      coeff = read_q15x2 (pC);
+      pC += 2U * RFFT_TWIDDLE_STRIDE(fftLen);
 
       T = read_q15x2 (pSi);
       T = __SHADD16(T, 0); /* this is just a SIMD arithmetic shift right by 1 */
@@ -777,8 +353,8 @@ ARM_DSP_ATTRIBUTE void arm_cfft_radix4by2_q15(
 
   for (i = 0; i < n2; i++)
   {
-     cosVal = pCoef[2 * i];
-     sinVal = pCoef[2 * i + 1];
+     cosVal = RFFT_TWIDDLE_COS(pCoef, i * RFFT_TWIDDLE_STRIDE(fftLen));
+     sinVal = RFFT_TWIDDLE_SIN(pCoef, i * RFFT_TWIDDLE_STRIDE(fftLen));
 
      l = i + n2;
 
@@ -797,11 +373,17 @@ ARM_DSP_ATTRIBUTE void arm_cfft_radix4by2_q15(
 
 #endif /* #if defined (ARM_MATH_DSP) */
 
-  /* first col */
-  arm_radix4_butterfly_q15( pSrc,          n2, (q15_t*)pCoef, 2U);
+  RFFT_PROFILE_MARK(RFFT_PROFILE_PREPASS);
+}
 
-  /* second col */
-  arm_radix4_butterfly_q15( pSrc + fftLen, n2, (q15_t*)pCoef, 2U);
+/* Shift fftLen complex points left by one, undoing a halving of the pre-pass. */
+static void arm_cfft_radix4by2_fixup_q15(
+        q15_t * pSrc,
+        uint32_t fftLen)
+{
+        uint32_t i;
+        uint32_t n2;
+        q15_t p0, p1, p2, p3;
 
   n2 = fftLen >> 1U;
   for (i = 0; i < n2; i++)
@@ -822,16 +404,67 @@ ARM_DSP_ATTRIBUTE void arm_cfft_radix4by2_q15(
      pSrc[4 * i + 3] = p3;
   }
 
+  RFFT_PROFILE_MARK(RFFT_PROFILE_FIXUP);
 }
 
-ARM_DSP_ATTRIBUTE void arm_cfft_radix4by2_inverse_q15(
+ARM_DSP_ATTRIBUTE void arm_cfft_radix4by2_q15(
         q15_t * pSrc,
         uint32_t fftLen,
   const q15_t * pCoef)
+{
+  uint32_t n2 = fftLen >> 1U;
+
+  arm_cfft_radix4by2_pre_q15 (pSrc, fftLen, pCoef);
+
+  /* first col, the last stages do the final shift by one */
+  arm_radix4_butterfly_q15( pSrc,          n2, (q15_t*)pCoef, 2U * RFFT_TWIDDLE_STRIDE(fftLen), 1U);
+
+  /* second col */
+  arm_radix4_butterfly_q15( pSrc + fftLen, n2, (q15_t*)pCoef, 2U * RFFT_TWIDDLE_STRIDE(fftLen), 1U);
+}
+
+/**
+  @brief         First stage of a Q15 forward CFFT split in two halves.
+  @param[in]     S   points to an instance of Q15 CFFT structure
+  @param[in,out] p1  points to the complex data buffer, processed in place
+
+  Leaves two independent CFFTs of S->fftLen / 2 points in p1, the first
+  half of the buffer for the even bins and the second for the odd ones,
+  which arm_cfft_q15_half() completes, each on a core of its own if need
+  be. Together they leave the spectrum of arm_cfft_q15(S, p1, 0, 0): in
+  bit-reversed order and scaled by 1 / S->fftLen, bit-exact for the
+  lengths that are not powers of four. For the powers of four the radix-2
+  stage here and the one of the half-length transforms each keep one bit
+  less than the radix-4 stages of arm_cfft_q15().
+ */
+ARM_DSP_ATTRIBUTE void arm_cfft_q15_split(
+  const arm_cfft_instance_q15 * S,
+        q15_t * p1)
+{
+  arm_cfft_radix4by2_pre_q15 (p1, S->fftLen, S->pTwiddle);
+}
+
+/**
+  @brief         Complete one half of arm_cfft_q15_split().
+  @param[in]     H      points to a Q15 CFFT instance of half the length
+  @param[in,out] pHalf  points to either half of the buffer, processed in place
+ */
+ARM_DSP_ATTRIBUTE void arm_cfft_q15_half(
+  const arm_cfft_instance_q15 * H,
+        q15_t * pHalf)
+{
+  arm_cfft_q15 (H, pHalf, 0U, 0U);
+  arm_cfft_radix4by2_fixup_q15 (pHalf, H->fftLen);
+}
+
+ARM_DSP_ATTRIBUTE void arm_cfft_radix4by2_inverse_q15(
+        q15_t * pSrc,
+        uint32_t fftLen,
+  const q15_t * pCoef,
+        uint32_t shift)
 {
         uint32_t i;
         uint32_t n2;
-        q15_t p0, p1, p2, p3;
 #if defined (ARM_MATH_DSP)
         q31_t T, S, R;
         q31_t coeff, out1, out2;
@@ -849,7 +482,8 @@ ARM_DSP_ATTRIBUTE void arm_cfft_radix4by2_inverse_q15(
 
   for (i = n2; i > 0; i--)
   {
-     coeff = read_q15x2_ia (&pC);
+     coeff = read_q15x2 (pC);
+     pC += 2U * RFFT_TWIDDLE_STRIDE(fftLen);
 
      T = read_q15x2 (pSi);
      T = __SHADD16(T, 0); /* this is just a SIMD arithmetic shift right by 1 */
@@ -876,8 +510,8 @@ ARM_DSP_ATTRIBUTE void arm_cfft_radix4by2_inverse_q15(
 
   for (i = 0; i < n2; i++)
   {
-     cosVal = pCoef[2 * i];
-     sinVal = pCoef[2 * i + 1];
+     cosVal = RFFT_TWIDDLE_COS(pCoef, i * RFFT_TWIDDLE_STRIDE(fftLen));
+     sinVal = RFFT_TWIDDLE_SIN(pCoef, i * RFFT_TWIDDLE_STRIDE(fftLen));
 
      l = i + n2;
 
@@ -896,30 +530,9 @@ ARM_DSP_ATTRIBUTE void arm_cfft_radix4by2_inverse_q15(
 
 #endif /* #if defined (ARM_MATH_DSP) */
 
-  /* first col */
-  arm_radix4_butterfly_inverse_q15( pSrc,          n2, (q15_t*)pCoef, 2U);
+  /* first col, the last stages do the final shift by one */
+  arm_radix4_butterfly_inverse_q15( pSrc,          n2, (q15_t*)pCoef, 2U * RFFT_TWIDDLE_STRIDE(fftLen), 1U + shift);
 
   /* second col */
-  arm_radix4_butterfly_inverse_q15( pSrc + fftLen, n2, (q15_t*)pCoef, 2U);
-
-  n2 = fftLen >> 1U;
-  for (i = 0; i < n2; i++)
-  {
-     p0 = pSrc[4 * i + 0];
-     p1 = pSrc[4 * i + 1];
-     p2 = pSrc[4 * i + 2];
-     p3 = pSrc[4 * i + 3];
-
-     p0 <<= 1U;
-     p1 <<= 1U;
-     p2 <<= 1U;
-     p3 <<= 1U;
-
-     pSrc[4 * i + 0] = p0;
-     pSrc[4 * i + 1] = p1;
-     pSrc[4 * i + 2] = p2;
-     pSrc[4 * i + 3] = p3;
-  }
+  arm_radix4_butterfly_inverse_q15( pSrc + fftLen, n2, (q15_t*)pCoef, 2U * RFFT_TWIDDLE_STRIDE(fftLen), 1U + shift);
 }
-#endif /* defined NEON */
-#endif /* defined(ARM_MATH_MVEI) */
@@ -0,0 +1,743 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library - Simplified Q31 CFFT
+ * Title:        cfft_q31.c
+ * Description:  Combined Radix Decimation in Frequency Q31 CFFT processing function
+ *
+ * Target Processor: nRF54L15 FLPR (RISC-V)
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2021 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "rfft_q31_simplified.h"
+
+/*
+ * Scalar code of the CMSIS-DSP arm_cfft_q31(), arm_cfft_radix4by2_q31() and
+ * arm_radix4_butterfly_q31(), reading the twiddles of the shared table with
+ * the stride of each length.
+ */
+
+/**
+ * @brief  Core function for the Q31 CFFT butterfly process.
+ * @param[in,out] pSrc             points to the in-place buffer of Q31 data type.
+ * @param[in]     fftLen           length of the FFT.
+ * @param[in]     pCoef            points to twiddle coefficient buffer.
+ * @param[in]     twidCoefModifier twiddle coefficient modifier that supports different size FFTs with the same twiddle factor table.
+ */
+static void arm_radix4_butterfly_q31(
+        q31_t * pSrc,
+        uint32_t fftLen,
+  const q31_t * pCoef,
+        uint32_t twidCoefModifier)
+{
+    uint32_t n1, n2, ia1, ia2, ia3, i0, i1, i2, i3, j, k;
+    q31_t t1, t2, r1, r2, s1, s2, co1, co2, co3, si1, si2, si3;
+    q31_t xa, xb, xc, xd;
+    q31_t ya, yb, yc, yd;
+    q31_t *ptr1;
+
+    /* Total process is divided into three stages */
+
+    /* start of first stage process */
+    n2 = fftLen;
+    n1 = n2;
+    /* n2 = fftLen/4 */
+    n2 >>= 2U;
+    i0 = 0U;
+    ia1 = 0U;
+
+    j = n2;
+
+    /* Calculation of first stage */
+    do
+    {
+        /* index calculation for the input as, */
+        /* pSrc[i0 + 0], pSrc[i0 + fftLen/4], pSrc[i0 + fftLen/2U], pSrc[i0 + 3fftLen/4] */
+        i1 = i0 + n2;
+        i2 = i1 + n2;
+        i3 = i2 + n2;
+
+        /* input is in 1.31(q31) format and provide 4 guard bits for the input */
+
+        /* xa + xc */
+        r1 = (pSrc[(2U * i0)] >> 4U) + (pSrc[(2U * i2)] >> 4U);
+        /* xa - xc */
+        r2 = (pSrc[(2U * i0)] >> 4U) - (pSrc[(2U * i2)] >> 4U);
+
+        /* xb + xd */
+        t1 = (pSrc[(2U * i1)] >> 4U) + (pSrc[(2U * i3)] >> 4U);
+
+        /* ya + yc */
+        s1 = (pSrc[(2U * i0) + 1U] >> 4U) + (pSrc[(2U * i2) + 1U] >> 4U);
+        /* ya - yc */
+        s2 = (pSrc[(2U * i0) + 1U] >> 4U) - (pSrc[(2U * i2) + 1U] >> 4U);
+
+        /* xa' = xa + xb + xc + xd */
+        pSrc[2U * i0] = (r1 + t1);
+        /* (xa + xc) - (xb + xd) */
+        r1 = r1 - t1;
+        /* yb + yd */
+        t2 = (pSrc[(2U * i1) + 1U] >> 4U) + (pSrc[(2U * i3) + 1U] >> 4U);
+
+        /* ya' = ya + yb + yc + yd */
+        pSrc[(2U * i0) + 1U] = (s1 + t2);
+
+        /* (ya + yc) - (yb + yd) */
+        s1 = s1 - t2;
+
+        /* yb - yd */
+        t1 = (pSrc[(2U * i1) + 1U] >> 4U) - (pSrc[(2U * i3) + 1U] >> 4U);
+        /* xb - xd */
+        t2 = (pSrc[2U * i1] >> 4U) - (pSrc[2U * i3] >> 4U);
+
+        /*  index calculation for the coefficients */
+        ia2 = 2U * ia1;
+        co2 = pCoef[(ia2 * 2U)];
+        si2 = pCoef[(ia2 * 2U) + 1U];
+
+        /* xc' = (xa-xb+xc-xd)co2 + (ya-yb+yc-yd)(si2) */
+        pSrc[2U * i1] = (((int32_t) (((q63_t) r1 * co2) >> 32)) +
+                         ((int32_t) (((q63_t) s1 * si2) >> 32))) << 1U;
+
+        /* yc' = (ya-yb+yc-yd)co2 - (xa-xb+xc-xd)(si2) */
+        pSrc[(2U * i1) + 1U] = (((int32_t) (((q63_t) s1 * co2) >> 32)) -
+                                ((int32_t) (((q63_t) r1 * si2) >> 32))) << 1U;
+
+        /* (xa - xc) + (yb - yd) */
+        r1 = r2 + t1;
+        /* (xa - xc) - (yb - yd) */
+        r2 = r2 - t1;
+
+        /* (ya - yc) - (xb - xd) */
+        s1 = s2 - t2;
+        /* (ya - yc) + (xb - xd) */
+        s2 = s2 + t2;
+
+        co1 = pCoef[(ia1 * 2U)];
+        si1 = pCoef[(ia1 * 2U) + 1U];
+
+        /* xb' = (xa+yb-xc-yd)co1 + (ya-xb-yc+xd)(si1) */
+        pSrc[2U * i2] = (((int32_t) (((q63_t) r1 * co1) >> 32)) +
+                         ((int32_t) (((q63_t) s1 * si1) >> 32))) << 1U;
+
+        /* yb' = (ya-xb-yc+xd)co1 - (xa+yb-xc-yd)(si1) */
+        pSrc[(2U * i2) + 1U] = (((int32_t) (((q63_t) s1 * co1) >> 32)) -
+                                ((int32_t) (((q63_t) r1 * si1) >> 32))) << 1U;
+
+        /*  index calculation for the coefficients */
+        ia3 = 3U * ia1;
+        co3 = pCoef[(ia3 * 2U)];
+        si3 = pCoef[(ia3 * 2U) + 1U];
+
+        /* xd' = (xa-yb-xc+yd)co3 + (ya+xb-yc-xd)(si3) */
+        pSrc[2U * i3] = (((int32_t) (((q63_t) r2 * co3) >> 32)) +
+                         ((int32_t) (((q63_t) s2 * si3) >> 32))) << 1U;
+
+        /* yd' = (ya+xb-yc-xd)co3 - (xa-yb-xc+yd)(si3) */
+        pSrc[(2U * i3) + 1U] = (((int32_t) (((q63_t) s2 * co3) >> 32)) -
+                                ((int32_t) (((q63_t) r2 * si3) >> 32))) << 1U;
+
+        /*  Twiddle coefficients index modifier */
+        ia1 = ia1 + twidCoefModifier;
+
+        /*  Updating input index */
+        i0 = i0 + 1U;
+
+    } while (--j);
+
+    /* end of first stage process */
+
+    /* data is in 5.27(q27) format */
+
+    /* start of Middle stages process */
+
+    /* each stage in middle stages provides two down scaling of the input */
+
+    twidCoefModifier <<= 2U;
+
+    for (k = fftLen / 4U; k > 4U; k >>= 2U)
+    {
+        /*  Initializations for the first stage */
+        n1 = n2;
+        n2 >>= 2U;
+        ia1 = 0U;
+
+        /*  Calculation of first stage */
+        for (j = 0U; j <= (n2 - 1U); j++)
+        {
+            /*  index calculation for the coefficients */
+            ia2 = ia1 + ia1;
+            ia3 = ia2 + ia1;
+            co1 = pCoef[(ia1 * 2U)];
+            si1 = pCoef[(ia1 * 2U) + 1U];
+            co2 = pCoef[(ia2 * 2U)];
+            si2 = pCoef[(ia2 * 2U) + 1U];
+            co3 = pCoef[(ia3 * 2U)];
+            si3 = pCoef[(ia3 * 2U) + 1U];
+            /*  Twiddle coefficients index modifier */
+            ia1 = ia1 + twidCoefModifier;
+
+            for (i0 = j; i0 < fftLen; i0 += n1)
+            {
+                /*  index calculation for the input as, */
+                /*  pSrc[i0 + 0], pSrc[i0 + fftLen/4], pSrc[i0 + fftLen/2U], pSrc[i0 + 3fftLen/4] */
+                i1 = i0 + n2;
+                i2 = i1 + n2;
+                i3 = i2 + n2;
+
+                /* xa + xc */
+                r1 = pSrc[2U * i0] + pSrc[2U * i2];
+                /* xa - xc */
+                r2 = pSrc[2U * i0] - pSrc[2U * i2];
+
+                /* ya + yc */
+                s1 = pSrc[(2U * i0) + 1U] + pSrc[(2U * i2) + 1U];
+                /* ya - yc */
+                s2 = pSrc[(2U * i0) + 1U] - pSrc[(2U * i2) + 1U];
+
+                /* xb + xd */
+                t1 = pSrc[2U * i1] + pSrc[2U * i3];
+
+                /* xa' = xa + xb + xc + xd */
+                pSrc[2U * i0] = (r1 + t1) >> 2U;
+                /* xa + xc -(xb + xd) */
+                r1 = r1 - t1;
+
+                /* yb + yd */
+                t2 = pSrc[(2U * i1) + 1U] + pSrc[(2U * i3) + 1U];
+                /* ya' = ya + yb + yc + yd */
+                pSrc[(2U * i0) + 1U] = (s1 + t2) >> 2U;
+
+                /* (ya + yc) - (yb + yd) */
+                s1 = s1 - t2;
+
+                /* (yb - yd) */
+                t1 = pSrc[(2U * i1) + 1U] - pSrc[(2U * i3) + 1U];
+                /* (xb - xd) */
+                t2 = pSrc[2U * i1] - pSrc[2U * i3];
+
+                /* xc' = (xa-xb+xc-xd)co2 + (ya-yb+yc-yd)(si2) */
+                pSrc[2U * i1] = (((int32_t) (((q63_t) r1 * co2) >> 32)) +
+                                 ((int32_t) (((q63_t) s1 * si2) >> 32))) >> 1U;
+
+                /* yc' = (ya-yb+yc-yd)co2 - (xa-xb+xc-xd)(si2) */
+                pSrc[(2U * i1) + 1U] = (((int32_t) (((q63_t) s1 * co2) >> 32)) -
+                                        ((int32_t) (((q63_t) r1 * si2) >> 32))) >> 1U;
+
+                /* (xa - xc) + (yb - yd) */
+                r1 = r2 + t1;
+                /* (xa - xc) - (yb - yd) */
+                r2 = r2 - t1;
+
+                /* (ya - yc) -  (xb - xd) */
+                s1 = s2 - t2;
+                /* (ya - yc) +  (xb - xd) */
+                s2 = s2 + t2;
+
+                /* xb' = (xa+yb-xc-yd)co1 + (ya-xb-yc+xd)(si1) */
+                pSrc[2U * i2] = (((int32_t) (((q63_t) r1 * co1) >> 32)) +
+                                 ((int32_t) (((q63_t) s1 * si1) >> 32))) >> 1U;
+
+                /* yb' = (ya-xb-yc+xd)co1 - (xa+yb-xc-yd)(si1) */
+                pSrc[(2U * i2) + 1U] = (((int32_t) (((q63_t) s1 * co1) >> 32)) -
+                                        ((int32_t) (((q63_t) r1 * si1) >> 32))) >> 1U;
+
+                /* xd' = (xa-yb-xc+yd)co3 + (ya+xb-yc-xd)(si3) */
+                pSrc[2U * i3] = (((int32_t) (((q63_t) r2 * co3) >> 32)) +
+                                 ((int32_t) (((q63_t) s2 * si3) >> 32))) >> 1U;
+
+                /* yd' = (ya+xb-yc-xd)co3 - (xa-yb-xc+yd)(si3) */
+                pSrc[(2U * i3) + 1U] = (((int32_t) (((q63_t) s2 * co3) >> 32)) -
+                                        ((int32_t) (((q63_t) r2 * si3) >> 32))) >> 1U;
+            }
+        }
+        twidCoefModifier <<= 2U;
+    }
+
+    /* End of Middle stages process */
+
+    /* data is in 11.21(q21) format for the 1024 point as there are 3 middle stages */
+    /* data is in 9.23(q23) format for the 256 point as there are 2 middle stages */
+    /* data is in 7.25(q25) format for the 64 point as there are 1 middle stage */
+    /* data is in 5.27(q27) format for the 16 point as there are no middle stages */
+
+    /* start of Last stage process */
+    /*  Initializations for the last stage */
+    j = fftLen >> 2;
+    ptr1 = &pSrc[0];
+
+    /*  Calculations of last stage */
+    do
+    {
+        /* Read xa (real), ya(imag) input */
+        xa = *ptr1++;
+        ya = *ptr1++;
+
+        /* Read xb (real), yb(imag) input */
+        xb = *ptr1++;
+        yb = *ptr1++;
+
+        /* Read xc (real), yc(imag) input */
+        xc = *ptr1++;
+        yc = *ptr1++;
+
+        /* Read xd (real), yd(imag) input */
+        xd = *ptr1++;
+        yd = *ptr1++;
+
+        /* pointer updation for writing */
+        ptr1 = ptr1 - 8U;
+
+        /* xa' = xa + xb + xc + xd, ya' = ya + yb + yc + yd */
+        *ptr1++ = xa + xb + xc + xd;
+        *ptr1++ = ya + yb + yc + yd;
+
+        /* xc' = xa - xb + xc - xd, yc' = ya - yb + yc - yd */
+        *ptr1++ = xa - xb + xc - xd;
+        *ptr1++ = ya - yb + yc - yd;
+
+        /* xb' = xa + yb - xc - yd, yb' = ya - xb - yc + xd */
+        *ptr1++ = xa + yb - xc - yd;
+        *ptr1++ = ya - xb - yc + xd;
+
+        /* xd' = xa - yb - xc + yd, yd' = ya + xb - yc - xd */
+        *ptr1++ = xa - yb - xc + yd;
+        *ptr1++ = ya + xb - yc - xd;
+
+    } while (--j);
+
+    /* output is in 11.21(q21) format for the 1024 point */
+    /* output is in 9.23(q23) format for the 256 point */
+    /* output is in 7.25(q25) format for the 64 point */
+    /* output is in 5.27(q27) format for the 16 point */
+}
+
+/**
+ * @brief  Core function for the Q31 CIFFT butterfly process.
+ * @param[in,out] pSrc             points to the in-place buffer of Q31 data type.
+ * @param[in]     fftLen           length of the FFT.
+ * @param[in]     pCoef            points to twiddle coefficient buffer.
+ * @param[in]     twidCoefModifier twiddle coefficient modifier that supports different size FFTs with the same twiddle factor table.
+ */
+static void arm_radix4_butterfly_inverse_q31(
+        q31_t * pSrc,
+        uint32_t fftLen,
+  const q31_t * pCoef,
+        uint32_t twidCoefModifier)
+{
+    uint32_t n1, n2, ia1, ia2, ia3, i0, i1, i2, i3, j, k;
+    q31_t t1, t2, r1, r2, s1, s2, co1, co2, co3, si1, si2, si3;
+    q31_t xa, xb, xc, xd;
+    q31_t ya, yb, yc, yd;
+    q31_t *ptr1;
+
+    /* start of first stage process */
+    n2 = fftLen;
+    n1 = n2;
+    /* n2 = fftLen/4 */
+    n2 >>= 2U;
+    i0 = 0U;
+    ia1 = 0U;
+
+    j = n2;
+
+    do
+    {
+        /* index calculation for the input as, */
+        /* pSrc[i0 + 0], pSrc[i0 + fftLen/4], pSrc[i0 + fftLen/2U], pSrc[i0 + 3fftLen/4] */
+        i1 = i0 + n2;
+        i2 = i1 + n2;
+        i3 = i2 + n2;
+
+        /* input is in 1.31(q31) format and provide 4 guard bits for the input */
+
+        /* xa + xc */
+        r1 = (pSrc[2U * i0] >> 4U) + (pSrc[2U * i2] >> 4U);
+        /* xa - xc */
+        r2 = (pSrc[2U * i0] >> 4U) - (pSrc[2U * i2] >> 4U);
+
+        /* xb + xd */
+        t1 = (pSrc[2U * i1] >> 4U) + (pSrc[2U * i3] >> 4U);
+
+        /* ya + yc */
+        s1 = (pSrc[(2U * i0) + 1U] >> 4U) + (pSrc[(2U * i2) + 1U] >> 4U);
+        /* ya - yc */
+        s2 = (pSrc[(2U * i0) + 1U] >> 4U) - (pSrc[(2U * i2) + 1U] >> 4U);
+
+        /* xa' = xa + xb + xc + xd */
+        pSrc[2U * i0] = (r1 + t1);
+        /* (xa + xc) - (xb + xd) */
+        r1 = r1 - t1;
+        /* yb + yd */
+        t2 = (pSrc[(2U * i1) + 1U] >> 4U) + (pSrc[(2U * i3) + 1U] >> 4U);
+        /* ya' = ya + yb + yc + yd */
+        pSrc[2U * i0 + 1U] = (s1 + t2);
+
+        /* (ya + yc) - (yb + yd) */
+        s1 = s1 - t2;
+
+        /* yb - yd */
+        t1 = (pSrc[(2U * i1) + 1U] >> 4U) - (pSrc[(2U * i3) + 1U] >> 4U);
+        /* xb - xd */
+        t2 = (pSrc[2U * i1] >> 4U) - (pSrc[2U * i3] >> 4U);
+
+        /*  index calculation for the coefficients */
+        ia2 = 2U * ia1;
+        co2 = pCoef[ia2 * 2U];
+        si2 = pCoef[(ia2 * 2U) + 1U];
+
+        /* xc' = (xa-xb+xc-xd)co2 - (ya-yb+yc-yd)(si2) */
+        pSrc[2U * i1] = (((int32_t) (((q63_t) r1 * co2) >> 32)) -
+                         ((int32_t) (((q63_t) s1 * si2) >> 32))) << 1U;
+
+        /* yc' = (ya-yb+yc-yd)co2 + (xa-xb+xc-xd)(si2) */
+        pSrc[2U * i1 + 1U] = (((int32_t) (((q63_t) s1 * co2) >> 32)) +
+                              ((int32_t) (((q63_t) r1 * si2) >> 32))) << 1U;
+
+        /* (xa - xc) - (yb - yd) */
+        r1 = r2 - t1;
+        /* (xa - xc) + (yb - yd) */
+        r2 = r2 + t1;
+
+        /* (ya - yc) + (xb - xd) */
+        s1 = s2 + t2;
+        /* (ya - yc) - (xb - xd) */
+        s2 = s2 - t2;
+
+        co1 = pCoef[ia1 * 2U];
+        si1 = pCoef[(ia1 * 2U) + 1U];
+
+        /* xb' = (xa+yb-xc-yd)co1 - (ya-xb-yc+xd)(si1) */
+        pSrc[2U * i2] = (((int32_t) (((q63_t) r1 * co1) >> 32)) -
+                         ((int32_t) (((q63_t) s1 * si1) >> 32))) << 1U;
+
+        /* yb' = (ya-xb-yc+xd)co1 + (xa+yb-xc-yd)(si1) */
+        pSrc[2U * i2 + 1U] = (((int32_t) (((q63_t) s1 * co1) >> 32)) +
+                              ((int32_t) (((q63_t) r1 * si1) >> 32))) << 1U;
+
+        /*  index calculation for the coefficients */
+        ia3 = 3U * ia1;
+        co3 = pCoef[ia3 * 2U];
+        si3 = pCoef[(ia3 * 2U) + 1U];
+
+        /* xd' = (xa-yb-xc+yd)co3 - (ya+xb-yc-xd)(si3) */
+        pSrc[2U * i3] = (((int32_t) (((q63_t) r2 * co3) >> 32)) -
+                         ((int32_t) (((q63_t) s2 * si3) >> 32))) << 1U;
+
+        /* yd' = (ya+xb-yc-xd)co3 + (xa-yb-xc+yd)(si3) */
+        pSrc[2U * i3 + 1U] = (((int32_t) (((q63_t) s2 * co3) >> 32)) +
+                              ((int32_t) (((q63_t) r2 * si3) >> 32))) << 1U;
+
+        /*  Twiddle coefficients index modifier */
+        ia1 = ia1 + twidCoefModifier;
+
+        /*  Updating input index */
+        i0 = i0 + 1U;
+
+    } while (--j);
+
+    /* data is in 5.27(q27) format */
+    /* each stage provides two down scaling of the input */
+
+    /* Start of Middle stages process */
+
+    twidCoefModifier <<= 2U;
+
+    /*  Calculation of second stage to excluding last stage */
+    for (k = fftLen / 4U; k > 4U; k >>= 2U)
+    {
+        /*  Initializations for the first stage */
+        n1 = n2;
+        n2 >>= 2U;
+        ia1 = 0U;
+
+        for (j = 0; j <= (n2 - 1U); j++)
+        {
+            /*  index calculation for the coefficients */
+            ia2 = ia1 + ia1;
+            ia3 = ia2 + ia1;
+            co1 = pCoef[(ia1 * 2U)];
+            si1 = pCoef[(ia1 * 2U) + 1U];
+            co2 = pCoef[(ia2 * 2U)];
+            si2 = pCoef[(ia2 * 2U) + 1U];
+            co3 = pCoef[(ia3 * 2U)];
+            si3 = pCoef[(ia3 * 2U) + 1U];
+            /*  Twiddle coefficients index modifier */
+            ia1 = ia1 + twidCoefModifier;
+
+            for (i0 = j; i0 < fftLen; i0 += n1)
+            {
+                /*  index calculation for the input as, */
+                /*  pSrc[i0 + 0], pSrc[i0 + fftLen/4], pSrc[i0 + fftLen/2U], pSrc[i0 + 3fftLen/4] */
+                i1 = i0 + n2;
+                i2 = i1 + n2;
+                i3 = i2 + n2;
+
+                /* xa + xc */
+                r1 = pSrc[2U * i0] + pSrc[2U * i2];
+                /* xa - xc */
+                r2 = pSrc[2U * i0] - pSrc[2U * i2];
+
+                /* ya + yc */
+                s1 = pSrc[(2U * i0) + 1U] + pSrc[(2U * i2) + 1U];
+                /* ya - yc */
+                s2 = pSrc[(2U * i0) + 1U] - pSrc[(2U * i2) + 1U];
+
+                /* xb + xd */
+                t1 = pSrc[2U * i1] + pSrc[2U * i3];
+
+                /* xa' = xa + xb + xc + xd */
+                pSrc[2U * i0] = (r1 + t1) >> 2U;
+                /* xa + xc -(xb + xd) */
+                r1 = r1 - t1;
+                /* yb + yd */
+                t2 = pSrc[(2U * i1) + 1U] + pSrc[(2U * i3) + 1U];
+                /* ya' = ya + yb + yc + yd */
+                pSrc[(2U * i0) + 1U] = (s1 + t2) >> 2U;
+
+                /* (ya + yc) - (yb + yd) */
+                s1 = s1 - t2;
+
+                /* (yb - yd) */
+                t1 = pSrc[(2U * i1) + 1U] - pSrc[(2U * i3) + 1U];
+                /* (xb - xd) */
+                t2 = pSrc[2U * i1] - pSrc[2U * i3];
+
+                /* xc' = (xa-xb+xc-xd)co2 - (ya-yb+yc-yd)(si2) */
+                pSrc[2U * i1] = (((int32_t) (((q63_t) r1 * co2) >> 32)) -
+                                 ((int32_t) (((q63_t) s1 * si2) >> 32))) >> 1U;
+
+                /* yc' = (ya-yb+yc-yd)co2 + (xa-xb+xc-xd)(si2) */
+                pSrc[(2U * i1) + 1U] = (((int32_t) (((q63_t) s1 * co2) >> 32)) +
+                                        ((int32_t) (((q63_t) r1 * si2) >> 32))) >> 1U;
+
+                /* (xa - xc) - (yb - yd) */
+                r1 = r2 - t1;
+                /* (xa - xc) + (yb - yd) */
+                r2 = r2 + t1;
+
+                /* (ya - yc) +  (xb - xd) */
+                s1 = s2 + t2;
+                /* (ya - yc) -  (xb - xd) */
+                s2 = s2 - t2;
+
+                /* xb' = (xa+yb-xc-yd)co1 - (ya-xb-yc+xd)(si1) */
+                pSrc[2U * i2] = (((int32_t) (((q63_t) r1 * co1) >> 32)) -
+                                 ((int32_t) (((q63_t) s1 * si1) >> 32))) >> 1U;
+
+                /* yb' = (ya-xb-yc+xd)co1 + (xa+yb-xc-yd)(si1) */
+                pSrc[(2U * i2) + 1U] = (((int32_t) (((q63_t) s1 * co1) >> 32)) +
+                                        ((int32_t) (((q63_t) r1 * si1) >> 32))) >> 1U;
+
+                /* xd' = (xa-yb-xc+yd)co3 - (ya+xb-yc-xd)(si3) */
+                pSrc[(2U * i3)] = (((int32_t) (((q63_t) r2 * co3) >> 32)) -
+                                   ((int32_t) (((q63_t) s2 * si3) >> 32))) >> 1U;
+
+                /* yd' = (ya+xb-yc-xd)co3 + (xa-yb-xc+yd)(si3) */
+                pSrc[(2U * i3) + 1U] = (((int32_t) (((q63_t) s2 * co3) >> 32)) +
+                                        ((int32_t) (((q63_t) r2 * si3) >> 32))) >> 1U;
+            }
+        }
+        twidCoefModifier <<= 2U;
+    }
+
+    /* End of Middle stages process */
+
+    /* data is in 11.21(q21) format for the 1024 point as there are 3 middle stages */
+    /* data is in 9.23(q23) format for the 256 point as there are 2 middle stages */
+    /* data is in 7.25(q25) format for the 64 point as there are 1 middle stage */
+    /* data is in 5.27(q27) format for the 16 point as there are no middle stages */
+
+    /* Start of last stage process */
+
+    /*  Initializations for the last stage */
+    j = fftLen >> 2;
+    ptr1 = &pSrc[0];
+
+    /*  Calculations of last stage */
+    do
+    {
+        /* Read xa (real), ya(imag) input */
+        xa = *ptr1++;
+        ya = *ptr1++;
+
+        /* Read xb (real), yb(imag) input */
+        xb = *ptr1++;
+        yb = *ptr1++;
+
+        /* Read xc (real), yc(imag) input */
+        xc = *ptr1++;
+        yc = *ptr1++;
+
+        /* Read xd (real), yd(imag) input */
+        xd = *ptr1++;
+        yd = *ptr1++;
+
+        /* pointer updation for writing */
+        ptr1 = ptr1 - 8U;
+
+        /* xa' = xa + xb + xc + xd, ya' = ya + yb + yc + yd */
+        *ptr1++ = xa + xb + xc + xd;
+        *ptr1++ = ya + yb + yc + yd;
+
+        /* xc' = xa - xb + xc - xd, yc' = ya - yb + yc - yd */
+        *ptr1++ = xa - xb + xc - xd;
+        *ptr1++ = ya - yb + yc - yd;
+
+        /* xb' = xa - yb - xc + yd, yb' = ya + xb - yc - xd */
+        *ptr1++ = xa - yb - xc + yd;
+        *ptr1++ = ya + xb - yc - xd;
+
+        /* xd' = xa + yb - xc - yd, yd' = ya - xb - yc + xd */
+        *ptr1++ = xa + yb - xc - yd;
+        *ptr1++ = ya - xb - yc + xd;
+
+    } while (--j);
+
+    /* output is in 11.21(q21) format for the 1024 point */
+    /* output is in 9.23(q23) format for the 256 point */
+    /* output is in 7.25(q25) format for the 64 point */
+    /* output is in 5.27(q27) format for the 16 point */
+}
+
+/* Radix-2 first stage with 2 guard bits, then radix-4 on both halves */
+static void arm_cfft_radix4by2_q31(
+        q31_t * pSrc,
+        uint32_t fftLen,
+  const q31_t * pCoef,
+        uint8_t ifftFlag)
+{
+    uint32_t i, l;
+    uint32_t n2 = fftLen >> 1U;
+    uint32_t stride = RFFT_Q31_TWIDDLE_STRIDE(fftLen);
+    q31_t xt, yt, cosVal, sinVal;
+    q31_t p0, p1;
+
+    for (i = 0; i < n2; i++)
+    {
+        cosVal = pCoef[2U * i * stride];
+        sinVal = pCoef[2U * i * stride + 1U];
+
+        l = i + n2;
+
+        xt =          (pSrc[2 * i] >> 2U) - (pSrc[2 * l] >> 2U);
+        pSrc[2 * i] = (pSrc[2 * i] >> 2U) + (pSrc[2 * l] >> 2U);
+
+        yt =              (pSrc[2 * i + 1] >> 2U) - (pSrc[2 * l + 1] >> 2U);
+        pSrc[2 * i + 1] = (pSrc[2 * l + 1] >> 2U) + (pSrc[2 * i + 1] >> 2U);
+
+        mult_32x32_keep32_R(p0, xt, cosVal);
+        mult_32x32_keep32_R(p1, yt, cosVal);
+        if (ifftFlag == 0U)
+        {
+            multAcc_32x32_keep32_R(p0, yt, sinVal);
+            multSub_32x32_keep32_R(p1, xt, sinVal);
+        }
+        else
+        {
+            multSub_32x32_keep32_R(p0, yt, sinVal);
+            multAcc_32x32_keep32_R(p1, xt, sinVal);
+        }
+
+        pSrc[2 * l]     = p0 << 1;
+        pSrc[2 * l + 1] = p1 << 1;
+    }
+
+    /* first col */
+    /* second col */
+    if (ifftFlag == 0U)
+    {
+        arm_radix4_butterfly_q31(pSrc,          n2, pCoef, 2U * stride);
+        arm_radix4_butterfly_q31(pSrc + fftLen, n2, pCoef, 2U * stride);
+    }
+    else
+    {
+        arm_radix4_butterfly_inverse_q31(pSrc,          n2, pCoef, 2U * stride);
+        arm_radix4_butterfly_inverse_q31(pSrc + fftLen, n2, pCoef, 2U * stride);
+    }
+
+    for (i = 0; i < fftLen >> 1U; i++)
+    {
+        pSrc[4 * i + 0] <<= 1U;
+        pSrc[4 * i + 1] <<= 1U;
+        pSrc[4 * i + 2] <<= 1U;
+        pSrc[4 * i + 3] <<= 1U;
+    }
+}
+
+/**
+  @brief         Processing function for the Q31 complex FFT.
+  @param[in]     S               points to an instance of the fixed-point CFFT structure
+  @param[in,out] p1              points to the complex data buffer of size <code>2*fftLen</code>. Processing occurs in-place
+  @param[in]     ifftFlag       flag that selects transform direction
+                   - value = 0: forward transform
+                   - value = 1: inverse transform
+  @param[in]     bitReverseFlag flag that enables / disables bit reversal of output
+                   - value = 0: disables bit reversal of output
+                   - value = 1: enables bit reversal of output
+ */
+void arm_cfft_q31(
+  const arm_cfft_instance_q31 * S,
+        q31_t * p1,
+        uint8_t ifftFlag,
+        uint8_t bitReverseFlag)
+{
+    uint32_t L = S->fftLen;
+
+    switch (L)
+    {
+    case 16:
+    case 64:
+    case 256:
+    case 1024:
+    case 4096:
+        if (ifftFlag == 1U)
+            arm_radix4_butterfly_inverse_q31(p1, L, S->pTwiddle, RFFT_Q31_TWIDDLE_STRIDE(L));
+        else
+            arm_radix4_butterfly_q31(p1, L, S->pTwiddle, RFFT_Q31_TWIDDLE_STRIDE(L));
+        break;
+
+    case 32:
+    case 128:
+    case 512:
+    case 2048:
+        arm_cfft_radix4by2_q31(p1, L, S->pTwiddle, ifftFlag);
+        break;
+    }
+
+    if (bitReverseFlag)
+        arm_bitreversal_q31_notable(p1, L);
+}
+
+/**
+ * @brief In-place Q31 bit reversal computed without an index table.
+ * @param[in,out] pSrc    points to complex Q31 data
+ * @param[in]     fftLen  length of the complex FFT, a power of two
+ */
+void arm_bitreversal_q31_notable(
+        q31_t * pSrc,
+        uint32_t fftLen)
+{
+    q31_t tmp;
+    uint32_t i, r = 0U;
+
+    for (i = 0U; i < fftLen; i++)
+    {
+        if (i < r)
+        {
+            /* Swap real parts */
+            tmp = pSrc[2U * i];
+            pSrc[2U * i] = pSrc[2U * r];
+            pSrc[2U * r] = tmp;
+
+            /* Swap imaginary parts */
+            tmp = pSrc[2U * i + 1U];
+            pSrc[2U * i + 1U] = pSrc[2U * r + 1U];
+            pSrc[2U * r + 1U] = tmp;
+        }
+
+        r = rfft_bitrev_next(r, fftLen >> 1U);
+    }
+}
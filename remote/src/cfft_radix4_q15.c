@@ -12,6 +12,7 @@
  */
 
 #include "rfft_q15_simplified.h"
+#include <stddef.h>
 
 /* Define ARM_DSP_ATTRIBUTE as empty for PC compilation */
 #ifndef ARM_DSP_ATTRIBUTE
@@ -22,13 +23,15 @@ ARM_DSP_ATTRIBUTE void arm_radix4_butterfly_q15(
         q15_t * pSrc16,
         uint32_t fftLen,
   const q15_t * pCoef16,
-        uint32_t twidCoefModifier);
+        uint32_t twidCoefModifier,
+        uint32_t shift);
 
 ARM_DSP_ATTRIBUTE void arm_radix4_butterfly_inverse_q15(
         q15_t * pSrc16,
         uint32_t fftLen,
   const q15_t * pCoef16,
-        uint32_t twidCoefModifier);
+        uint32_t twidCoefModifier,
+        uint32_t shift);
 
 ARM_DSP_ATTRIBUTE void arm_bitreversal_q15(
         q15_t * pSrc,
@@ -77,11 +80,11 @@ ARM_DSP_ATTRIBUTE void arm_cfft_radix4_q15(
 {
   if (S->ifftFlag == 1U)
   {
-    arm_radix4_butterfly_inverse_q15(pSrc, S->fftLen, S->pTwiddle, S->twidCoefModifier);
+    arm_radix4_butterfly_inverse_q15(pSrc, S->fftLen, S->pTwiddle, S->twidCoefModifier, 0U);
   }
   else
   {
-    arm_radix4_butterfly_q15(pSrc, S->fftLen, S->pTwiddle, S->twidCoefModifier);
+    arm_radix4_butterfly_q15(pSrc, S->fftLen, S->pTwiddle, S->twidCoefModifier, 0U);
   }
 
   if (S->bitReverseFlag == 1U)
@@ -130,19 +133,710 @@ ARM_DSP_ATTRIBUTE void arm_cfft_radix4_q15(
  *
  */
 
+#if !defined (ARM_MATH_DSP) && defined (RFFT_Q15_PACKED_BUTTERFLY)
+
+/*
+ * Packed scalar radix-4 butterfly.
+ *
+ * Performs exactly the arithmetic of the generic scalar butterfly below,
+ * including its saturation and truncation, so the results are bit-exact.
+ * The differences are in memory traffic only:
+ *  - a complex sample (real in the low half, imaginary in the high half) is
+ *    read and written as one 32-bit word,
+ *  - every input is read once per butterfly, where the generic code reads
+ *    the second and fourth input twice,
+ *  - twiddle pairs are read as one word and hoisted out of the inner loops,
+ *  - the middle stages process two butterflies per iteration.
+ */
+
+/* Stage loops, inlined so that a caller with a constant length specializes them */
+#define PK_INLINE   static inline __attribute__((always_inline))
+
+#define PK_RE(x)    ((q31_t)(q15_t)(x))
+#define PK_IM(x)    ((q31_t)(x) >> 16)
+
+static inline q31_t pk_pack(q31_t re, q31_t im)
+{
+  return (q31_t)(((uint32_t)im << 16) | ((uint32_t)re & 0xFFFFU));
+}
+
+static inline q31_t pk_sat(q31_t x)
+{
+  return rfft_q15_ssat(x, 16U);
+}
+
+/* Complex multiply by the conjugate twiddle, as in the generic code. */
+static inline q31_t pk_twiddle(q31_t x, q31_t y, q31_t w)
+{
+  q31_t co = PK_RE(w);
+  q31_t si = PK_IM(w);
+
+  return pk_pack((q15_t) ((co * x + si * y) >> 16),
+                 (q15_t) ((-si * x + co * y) >> 16));
+}
+
+/* First stage: inputs are scaled down by 4, no intermediate can saturate. */
+static inline void pk_butterfly_first(
+        q31_t a, q31_t b, q31_t c, q31_t d,
+        q31_t * pA, q31_t * pB, q31_t * pC, q31_t * pD,
+        q31_t w1, q31_t w2, q31_t w3)
+{
+  q31_t xa = (q15_t) (PK_RE(a) >> 2), ya = (q15_t) (PK_IM(a) >> 2);
+  q31_t xb = (q15_t) (PK_RE(b) >> 2), yb = (q15_t) (PK_IM(b) >> 2);
+  q31_t xc = (q15_t) (PK_RE(c) >> 2), yc = (q15_t) (PK_IM(c) >> 2);
+  q31_t xd = (q15_t) (PK_RE(d) >> 2), yd = (q15_t) (PK_IM(d) >> 2);
+  q31_t r0, r1, s0, s1, t0, t1, u0, u1;
+
+  r0 = xa + xc;
+  r1 = ya + yc;
+  s0 = xa - xc;
+  s1 = ya - yc;
+  t0 = xb + xd;
+  t1 = yb + yd;
+
+  *pA = pk_pack((r0 >> 1) + (t0 >> 1), (r1 >> 1) + (t1 >> 1));
+  *pB = pk_twiddle(r0 - t0, r1 - t1, w2);
+
+  t0 = xb - xd;
+  t1 = yb - yd;
+  u0 = s0 - t1;
+  u1 = s1 + t0;
+  s0 = s0 + t1;
+  s1 = s1 - t0;
+
+  *pC = pk_twiddle(s0, s1, w1);
+  *pD = pk_twiddle(u0, u1, w3);
+}
+
+static inline void pk_butterfly_middle(
+        q31_t a, q31_t b, q31_t c, q31_t d,
+        q31_t * pA, q31_t * pB, q31_t * pC, q31_t * pD,
+        q31_t w1, q31_t w2, q31_t w3)
+{
+  q31_t r0, r1, s0, s1, t0, t1, u0, u1;
+
+  r0 = pk_sat(PK_RE(a) + PK_RE(c));
+  r1 = pk_sat(PK_IM(a) + PK_IM(c));
+  s0 = pk_sat(PK_RE(a) - PK_RE(c));
+  s1 = pk_sat(PK_IM(a) - PK_IM(c));
+  t0 = pk_sat(PK_RE(b) + PK_RE(d));
+  t1 = pk_sat(PK_IM(b) + PK_IM(d));
+
+  *pA = pk_pack(((r0 >> 1) + (t0 >> 1)) >> 1, ((r1 >> 1) + (t1 >> 1)) >> 1);
+  *pB = pk_twiddle((q15_t) ((r0 >> 1) - (t0 >> 1)), (q15_t) ((r1 >> 1) - (t1 >> 1)), w2);
+
+  t0 = pk_sat(PK_RE(b) - PK_RE(d));
+  t1 = pk_sat(PK_IM(b) - PK_IM(d));
+  u0 = (q15_t) ((s0 >> 1) - (t1 >> 1));
+  u1 = (q15_t) ((s1 >> 1) + (t0 >> 1));
+  s0 = (q15_t) ((s0 >> 1) + (t1 >> 1));
+  s1 = (q15_t) ((s1 >> 1) - (t0 >> 1));
+
+  *pC = pk_twiddle(s0, s1, w1);
+  *pD = pk_twiddle(u0, u1, w3);
+}
+
+/*
+ * Last stage: trivial twiddles. Outputs are shifted left by 'shift' with
+ * Q15 wrap-around, which folds the output fix-up of the radix-4-by-2
+ * transform into this stage. The outputs may go elsewhere than the
+ * inputs, see pk_last_stage().
+ */
+static inline q31_t pk_scale(q31_t x, uint32_t shift)
+{
+  return (q15_t) (((q15_t) x) << shift);
+}
+
+static inline void pk_butterfly_last(
+        q31_t a, q31_t b, q31_t c, q31_t d,
+        q31_t * pA, q31_t * pB, q31_t * pC, q31_t * pD,
+        uint32_t shift)
+{
+  q31_t r0, r1, s0, s1, t0, t1;
+
+  r0 = pk_sat(PK_RE(a) + PK_RE(c));
+  r1 = pk_sat(PK_IM(a) + PK_IM(c));
+  s0 = pk_sat(PK_RE(a) - PK_RE(c));
+  s1 = pk_sat(PK_IM(a) - PK_IM(c));
+  t0 = pk_sat(PK_RE(b) + PK_RE(d));
+  t1 = pk_sat(PK_IM(b) + PK_IM(d));
+
+  *pA = pk_pack(pk_scale((r0 >> 1) + (t0 >> 1), shift), pk_scale((r1 >> 1) + (t1 >> 1), shift));
+  *pB = pk_pack(pk_scale((r0 >> 1) - (t0 >> 1), shift), pk_scale((r1 >> 1) - (t1 >> 1), shift));
+
+  t0 = pk_sat(PK_RE(b) - PK_RE(d));
+  t1 = pk_sat(PK_IM(b) - PK_IM(d));
+
+  *pC = pk_pack(pk_scale((s0 >> 1) + (t1 >> 1), shift), pk_scale((s1 >> 1) - (t0 >> 1), shift));
+  *pD = pk_pack(pk_scale((s0 >> 1) - (t1 >> 1), shift), pk_scale((s1 >> 1) + (t0 >> 1), shift));
+}
+
+/*
+ * Last stage over the whole buffer. With pDst == NULL the outputs go back
+ * in place, in bit-reversed order. Otherwise they are written to pDst in
+ * natural order: output m of the butterfly at 4 * g lands at
+ * bitrev(m) * fftLen / 4 + bitrev(g), so no bit reversal pass or index
+ * table is needed afterwards.
+ */
+PK_INLINE void pk_stage_last(
+        q31_t * pSrc,
+        q31_t * pDst,
+        uint32_t fftLen,
+        uint32_t shift)
+{
+  uint32_t i0;
+
+  if (pDst == NULL)
+  {
+    for (i0 = 0U; i0 < fftLen; i0 += 4U)
+    {
+      q31_t *p = &pSrc[i0];
+
+      pk_butterfly_last(p[0], p[1], p[2], p[3], p, p + 1, p + 2, p + 3, shift);
+    }
+  }
+  else
+  {
+    uint32_t half = fftLen >> 1U;
+    uint32_t quarter = fftLen >> 2U;
+    uint32_t r = 0U;
+
+    for (i0 = 0U; i0 < fftLen; i0 += 4U)
+    {
+      q31_t *o = &pDst[r];
+      q31_t *p = &pSrc[i0];
+
+      pk_butterfly_last(p[0], p[1], p[2], p[3], o, o + half, o + quarter, o + half + quarter, shift);
+      r = rfft_bitrev_next(r, fftLen >> 3U);
+    }
+  }
+}
+
+RFFT_Q15_HOT static void pk_last_stage(
+        q31_t * pSrc,
+        q31_t * pDst,
+        uint32_t fftLen,
+        uint32_t shift)
+{
+  pk_stage_last(pSrc, pDst, fftLen, shift);
+}
+
+/* Twiddle k of pCoef16 as a packed (cos, sin) word. */
+static inline q31_t pk_coef(const q15_t * pCoef16, uint32_t k)
+{
+#if defined (RFFT_Q15_COMPACT_TWIDDLES)
+  return pk_pack(RFFT_TWIDDLE_COS(pCoef16, k), RFFT_TWIDDLE_SIN(pCoef16, k));
+#else
+  return ((const q31_t *) pCoef16)[k];
+#endif
+}
+
+/* First stage of a radix-4 transform: one butterfly per twiddle set. */
+PK_INLINE void pk_stage_first(
+        q31_t * pSrc,
+        uint32_t fftLen,
+  const q15_t * pCoef16,
+        uint32_t twidCoefModifier)
+{
+  uint32_t n2 = fftLen >> 2U;
+  uint32_t ic = 0U;
+  uint32_t j;
+
+  for (j = 0U; j < n2; j++)
+  {
+    q31_t *p = &pSrc[j];
+
+    pk_butterfly_first(p[0], p[n2], p[2U * n2], p[3U * n2],
+                       p, p + n2, p + 2U * n2, p + 3U * n2,
+                       pk_coef(pCoef16, ic), pk_coef(pCoef16, 2U * ic),
+                       pk_coef(pCoef16, 3U * ic));
+
+    ic += twidCoefModifier;
+  }
+}
+
+/*
+ * Middle stage of a radix-4 transform of fftLen points, with butterflies
+ * of n1 points whose inputs are n1 / 4 apart, and twiddles
+ * twidCoefModifier apart.
+ */
+PK_INLINE void pk_stage_middle(
+        q31_t * pSrc,
+        uint32_t fftLen,
+        uint32_t n1,
+  const q15_t * pCoef16,
+        uint32_t twidCoefModifier)
+{
+  uint32_t n2 = n1 >> 2U;
+  uint32_t ic = 0U;
+  uint32_t i0, j;
+  q31_t w1, w2, w3;
+
+  for (j = 0U; j < n2; j++)
+  {
+    w1 = pk_coef(pCoef16, ic);
+    w2 = pk_coef(pCoef16, 2U * ic);
+    w3 = pk_coef(pCoef16, 3U * ic);
+    ic += twidCoefModifier;
+
+    /* fftLen / n1 is a power of four, so the count is even */
+    for (i0 = j; i0 < fftLen; i0 += 2U * n1)
+    {
+      q31_t *p = &pSrc[i0];
+      q31_t *q = &pSrc[i0 + n1];
+
+      pk_butterfly_middle(p[0], p[n2], p[2U * n2], p[3U * n2],
+                          p, p + n2, p + 2U * n2, p + 3U * n2, w1, w2, w3);
+      pk_butterfly_middle(q[0], q[n2], q[2U * n2], q[3U * n2],
+                          q, q + n2, q + 2U * n2, q + 3U * n2, w1, w2, w3);
+    }
+  }
+}
+
+/*
+ * Middle stages of a radix-4 transform of fftLen points whose first stage
+ * is done. twidCoefModifier is the modifier the first stage used.
+ */
+RFFT_Q15_HOT static void pk_middle_stages(
+        q31_t * pSrc,
+        uint32_t fftLen,
+  const q15_t * pCoef16,
+        uint32_t twidCoefModifier)
+{
+  uint32_t n1;
+
+  twidCoefModifier <<= 2U;
+  RFFT_PROFILE_BUTTERFLY_FROM(1U);
+
+  for (n1 = fftLen >> 2U; n1 > 4U; n1 >>= 2U)
+  {
+    pk_stage_middle(pSrc, fftLen, n1, pCoef16, twidCoefModifier);
+    twidCoefModifier <<= 2U;
+    RFFT_PROFILE_MARK_BUTTERFLY();
+  }
+}
+
+/* Radix-2 decimation in frequency step of arm_cfft_radix4by2_q15(). */
+static inline void pk_radix2(q31_t a, q31_t b, q31_t w, q31_t * pSum, q31_t * pDiff)
+{
+  q31_t co = PK_RE(w);
+  q31_t si = PK_IM(w);
+  q31_t xt = (q15_t) ((PK_RE(a) >> 1) - (PK_RE(b) >> 1));
+  q31_t yt = (q15_t) ((PK_IM(a) >> 1) - (PK_IM(b) >> 1));
+
+  *pSum = pk_pack(((PK_RE(a) >> 1) + (PK_RE(b) >> 1)) >> 1,
+                  ((PK_IM(b) >> 1) + (PK_IM(a) >> 1)) >> 1);
+  *pDiff = pk_pack((q15_t) ((q15_t) ((xt * co) >> 16) + (q15_t) ((yt * si) >> 16)),
+                   (q15_t) ((q15_t) ((yt * co) >> 16) - (q15_t) ((xt * si) >> 16)));
+}
+
+/* Radix-2 step and first radix-4 stage of both halves of fftLen points. */
+PK_INLINE void pk_stage_first_by2(
+        q31_t * pSrc,
+        uint32_t fftLen,
+  const q15_t * pCoef16)
+{
+  uint32_t half = fftLen >> 1U;
+  uint32_t n2 = half >> 2U;
+  uint32_t stride = RFFT_TWIDDLE_STRIDE(fftLen);
+  uint32_t j, m;
+
+  for (j = 0U; j < n2; j++)
+  {
+    q31_t lo[4], hi[4];
+    q31_t *p = &pSrc[j];
+    q31_t *q = &pSrc[half + j];
+    uint32_t ic = 2U * j * stride;
+    q31_t w1 = pk_coef(pCoef16, ic);
+    q31_t w2 = pk_coef(pCoef16, 2U * ic);
+    q31_t w3 = pk_coef(pCoef16, 3U * ic);
+
+    for (m = 0U; m < 4U; m++)
+    {
+      pk_radix2(p[m * n2], q[m * n2], pk_coef(pCoef16, (j + m * n2) * stride),
+                &lo[m], &hi[m]);
+    }
+
+    pk_butterfly_first(lo[0], lo[1], lo[2], lo[3],
+                       p, p + n2, p + 2U * n2, p + 3U * n2,
+                       w1, w2, w3);
+    pk_butterfly_first(hi[0], hi[1], hi[2], hi[3],
+                       q, q + n2, q + 2U * n2, q + 3U * n2,
+                       w1, w2, w3);
+  }
+}
+
+#if defined (RFFT_Q15_FIXED_KERNELS)
+
+/*
+ * Transforms of one length each, generated by gen_kernels.py from the
+ * stages above with the length, the strides and the twiddle modifiers as
+ * constants. pk_fixed_kernel() returns the one of fftLen points, or NULL.
+ */
+typedef void (*pk_fixed_fn)(q31_t * pSrc, const q15_t * pCoef16, q31_t * pDst);
+
+#include "cfft_fixed_q15.inc"
+
+#endif /* RFFT_Q15_FIXED_KERNELS */
+
+/**
+  @brief         Packed radix-4 CFFT.
+  @param[in,out] pSrc16  points to the Q15 data, used as work buffer
+  @param[in]     fftLen  length of the FFT
+  @param[in]     pCoef16 points to the twiddle coefficient buffer
+  @param[in]     twidCoefModifier twiddle coefficient modifier
+  @param[out]    pDst16  NULL to leave the result in pSrc16 in bit-reversed
+                         order, or an output buffer of fftLen complex values
+                         that receives the result in natural order
+ */
+RFFT_Q15_HOT void arm_radix4_butterfly_q15_packed(
+        q15_t * pSrc16,
+        uint32_t fftLen,
+  const q15_t * pCoef16,
+        uint32_t twidCoefModifier,
+        q15_t * pDst16)
+{
+  q31_t *pSrc = (q31_t *) pSrc16;
+
+#if defined (RFFT_Q15_FIXED_KERNELS)
+  pk_fixed_fn fixed = pk_fixed_kernel(fftLen);
+
+  if ((fixed != NULL) && (twidCoefModifier == RFFT_TWIDDLE_STRIDE(fftLen)))
+  {
+    fixed(pSrc, pCoef16, (q31_t *) pDst16);
+    return;
+  }
+#endif
+
+  pk_stage_first(pSrc, fftLen, pCoef16, twidCoefModifier);
+  RFFT_PROFILE_BUTTERFLY_FROM(0U);
+  RFFT_PROFILE_MARK_BUTTERFLY();
+
+  pk_middle_stages(pSrc, fftLen, pCoef16, twidCoefModifier);
+
+  pk_last_stage(pSrc, (q31_t *) pDst16, fftLen, 0U);
+  RFFT_PROFILE_MARK_BUTTERFLY();
+}
+
+/**
+  @brief         Packed radix-4-by-2 CFFT with fused passes.
+  @param[in,out] pSrc16  points to the Q15 data, used as work buffer
+  @param[in]     fftLen  length of the FFT (32, 128, 512 or 2048)
+  @param[in]     pCoef16 points to the twiddle coefficient buffer of fftLen
+  @param[out]    pDst16  NULL or output buffer, see
+                         arm_radix4_butterfly_q15_packed()
+
+  Bit-exact with arm_cfft_radix4by2_q15(), with two passes over the buffer
+  less: the radix-2 step is done together with the first radix-4 stage of
+  both halves, and the final shift by one is done by the last radix-4 stage.
+ */
+RFFT_Q15_HOT void arm_cfft_radix4by2_q15_packed(
+        q15_t * pSrc16,
+        uint32_t fftLen,
+  const q15_t * pCoef16,
+        q15_t * pDst16)
+{
+  q31_t *pSrc = (q31_t *) pSrc16;
+  uint32_t half = fftLen >> 1U;
+
+#if defined (RFFT_Q15_FIXED_KERNELS)
+  pk_fixed_fn fixed = pk_fixed_kernel(fftLen);
+
+  if (fixed != NULL)
+  {
+    fixed(pSrc, pCoef16, (q31_t *) pDst16);
+    return;
+  }
+#endif
+
+  pk_stage_first_by2(pSrc, fftLen, pCoef16);
+
+  /* The pre-pass is in the first stage, the fixup in the last */
+  RFFT_PROFILE_BUTTERFLY_FROM(0U);
+  RFFT_PROFILE_MARK_BUTTERFLY();
+
+  pk_middle_stages(pSrc, half, pCoef16, 2U * RFFT_TWIDDLE_STRIDE(fftLen));
+  pk_middle_stages(pSrc + half, half, pCoef16, 2U * RFFT_TWIDDLE_STRIDE(fftLen));
+
+  /* Last radix-4 stage of both halves, with the output shift */
+  pk_last_stage(pSrc, (q31_t *) pDst16, fftLen, 1U);
+  RFFT_PROFILE_MARK_BUTTERFLY();
+}
+
+#if defined (RFFT_Q15_STOCKHAM)
+
+/*
+ * Stockham CFFT on the packed butterflies above.
+ *
+ * The butterflies are those of the in-place transform, on the same
+ * values, so the results are bit-exact with it. Only the places differ:
+ * a stage of sub-length n sees the data as fftLen / n interleaved
+ * sequences, x[q + s * i] with s = fftLen / n, and writes output r of the
+ * butterfly at i = p to y[q + s * (4 * p + r)]. Inputs and outputs walk
+ * the buffers in sequential runs of s, the outputs come out in natural
+ * order, and the twiddles of p come from a stage table one after the
+ * other instead of from the shared table with a stride.
+ */
+
+/* Stage table of the radix-4 stages of sub-length n, one (w1, w2, w3) per p */
+static const q31_t * pk_stockham_coef(uint32_t n)
+{
+  switch (n)
+  {
+  case 16:
+    return (const q31_t *) rfftStockhamQ15_16;
+#if RFFT_Q15_MAX_FFT_LEN >= 128
+  case 64:
+    return (const q31_t *) rfftStockhamQ15_64;
+#endif
+#if RFFT_Q15_MAX_FFT_LEN >= 512
+  case 256:
+    return (const q31_t *) rfftStockhamQ15_256;
+#endif
+#if RFFT_Q15_MAX_FFT_LEN >= 2048
+  case 1024:
+    return (const q31_t *) rfftStockhamQ15_1024;
+#endif
+#if RFFT_Q15_MAX_FFT_LEN >= 8192
+  case 4096:
+    return (const q31_t *) rfftStockhamQ15_4096;
+#endif
+  default:
+    return NULL;
+  }
+}
+
+/* Radix-2 step table of a fftLen-point 4x2 CFFT, four twiddles per p */
+static const q31_t * pk_stockham_coef_r2(uint32_t fftLen)
+{
+  switch (fftLen)
+  {
+#if RFFT_Q15_HAS_LEN(64)
+  case 32:
+    return (const q31_t *) rfftStockhamR2Q15_32;
+#endif
+#if RFFT_Q15_HAS_LEN(256)
+  case 128:
+    return (const q31_t *) rfftStockhamR2Q15_128;
+#endif
+#if RFFT_Q15_HAS_LEN(1024)
+  case 512:
+    return (const q31_t *) rfftStockhamR2Q15_512;
+#endif
+#if RFFT_Q15_HAS_LEN(4096)
+  case 2048:
+    return (const q31_t *) rfftStockhamR2Q15_2048;
+#endif
+  default:
+    return NULL;
+  }
+}
+
+/* First stage of a power of four length, n = fftLen and s = 1 */
+RFFT_Q15_HOT static void pk_stockham_first(
+  const q31_t * x,
+        q31_t * y,
+        uint32_t fftLen)
+{
+  const q31_t *w = pk_stockham_coef(fftLen);
+  uint32_t m = fftLen >> 2U;
+  uint32_t p;
+
+  for (p = 0U; p < m; p++)
+  {
+    q31_t *o = &y[4U * p];
+
+    pk_butterfly_first(x[p], x[p + m], x[p + 2U * m], x[p + 3U * m],
+                       o, o + 2U, o + 1U, o + 3U,
+                       w[0], w[1], w[2]);
+    w += 3;
+  }
+}
+
+/*
+ * Radix-2 step and first radix-4 stage of a 4x2 length, fused as in
+ * arm_cfft_radix4by2_q15_packed(). The radix-2 step leaves the two halves
+ * interleaved, s = 2, so the eight outputs of p are adjacent.
+ */
+RFFT_Q15_HOT static void pk_stockham_first_by2(
+  const q31_t * x,
+        q31_t * y,
+        uint32_t fftLen)
+{
+  const q31_t *v = pk_stockham_coef_r2(fftLen);
+  const q31_t *w = pk_stockham_coef(fftLen >> 1U);
+  uint32_t half = fftLen >> 1U;
+  uint32_t m = fftLen >> 3U;
+  uint32_t p, k;
+
+  for (p = 0U; p < m; p++)
+  {
+    q31_t lo[4], hi[4];
+    q31_t *o = &y[8U * p];
+
+    for (k = 0U; k < 4U; k++)
+    {
+      pk_radix2(x[p + k * m], x[half + p + k * m], v[k], &lo[k], &hi[k]);
+    }
+
+    pk_butterfly_first(lo[0], lo[1], lo[2], lo[3],
+                       o, o + 4U, o + 2U, o + 6U,
+                       w[0], w[1], w[2]);
+    pk_butterfly_first(hi[0], hi[1], hi[2], hi[3],
+                       o + 1U, o + 5U, o + 3U, o + 7U,
+                       w[0], w[1], w[2]);
+    v += 4;
+    w += 3;
+  }
+}
+
+/* Middle stage of sub-length n: the four inputs are always fftLen / 4 apart */
+RFFT_Q15_HOT static void pk_stockham_middle(
+  const q31_t * x,
+        q31_t * y,
+        uint32_t fftLen,
+        uint32_t n)
+{
+  const q31_t *w = pk_stockham_coef(n);
+  uint32_t s = fftLen / n;
+  uint32_t quarter = fftLen >> 2U;
+  uint32_t m = n >> 2U;
+  uint32_t p, q;
+
+  for (p = 0U; p < m; p++)
+  {
+    const q31_t *i = &x[s * p];
+    q31_t *o = &y[4U * s * p];
+    q31_t w1 = w[0], w2 = w[1], w3 = w[2];
+
+    w += 3;
+
+    /* s is at least 4 */
+    for (q = 0U; q < s; q += 2U)
+    {
+      pk_butterfly_middle(i[q], i[q + quarter], i[q + 2U * quarter], i[q + 3U * quarter],
+                          &o[q], &o[q + 2U * s], &o[q + s], &o[q + 3U * s],
+                          w1, w2, w3);
+      pk_butterfly_middle(i[q + 1U], i[q + 1U + quarter], i[q + 1U + 2U * quarter],
+                          i[q + 1U + 3U * quarter],
+                          &o[q + 1U], &o[q + 1U + 2U * s], &o[q + 1U + s], &o[q + 1U + 3U * s],
+                          w1, w2, w3);
+    }
+  }
+}
+
+/* Last stage, n = 4 and s = fftLen / 4: may run in place */
+RFFT_Q15_HOT static void pk_stockham_last(
+  const q31_t * x,
+        q31_t * y,
+        uint32_t fftLen,
+        uint32_t shift)
+{
+  uint32_t s = fftLen >> 2U;
+  uint32_t q;
+
+  for (q = 0U; q < s; q++)
+  {
+    pk_butterfly_last(x[q], x[q + s], x[q + 2U * s], x[q + 3U * s],
+                      &y[q], &y[q + 2U * s], &y[q + s], &y[q + 3U * s],
+                      shift);
+  }
+}
+
+/**
+  @brief         Forward Stockham CFFT, natural order output.
+  @param[in]     pSrc16  points to the Q15 input, fftLen complex values
+  @param[in,out] pA16    points to a work buffer of fftLen complex values, may be pSrc16
+  @param[in,out] pB16    points to a work buffer of fftLen complex values, not pA16
+  @return        pA16 or pB16, whichever holds the result
+
+  Bit-exact with arm_radix4_butterfly_q15_packed() and
+  arm_cfft_radix4by2_q15_packed() followed by bit reversal. The stages
+  but the last ping-pong between pA16 and pB16, the last one runs in
+  place. The result is in pA16 unless pA16 is pSrc16 and the transform
+  has an even number of stages, see RFFT_Q15_STOCKHAM_IN_BUF(); pSrc16
+  is only read when it is neither buffer.
+ */
+RFFT_Q15_HOT q15_t * arm_radix4_butterfly_q15_stockham(
+  const q15_t * pSrc16,
+        q15_t * pA16,
+        q15_t * pB16,
+        uint32_t fftLen)
+{
+  const q31_t *x = (const q31_t *) pSrc16;
+  q31_t *a = (q31_t *) pA16;
+  q31_t *b = (q31_t *) pB16;
+  uint32_t by2 = (fftLen & 0xAAAAAAAAU) != 0U;
+  uint32_t k;
+  q31_t *y;
+
+  /* So that the last stage but one writes a, the first writes a when the
+     number of stages is even, RFFT_Q15_STOCKHAM_IN_BUF(). If that is its
+     input, b and a swap roles. */
+  y = RFFT_Q15_STOCKHAM_IN_BUF(fftLen) ? a : b;
+  if ((const q31_t *) y == x)
+  {
+    y = (y == a) ? b : a;
+  }
+
+  if (by2)
+  {
+    pk_stockham_first_by2(x, y, fftLen);
+  }
+  else
+  {
+    pk_stockham_first(x, y, fftLen);
+  }
+
+  RFFT_PROFILE_BUTTERFLY_FROM(0U);
+  RFFT_PROFILE_MARK_BUTTERFLY();
+
+  for (k = fftLen >> (by2 ? 3U : 2U); k > 4U; k >>= 2U)
+  {
+    x = y;
+    y = (y == a) ? b : a;
+    pk_stockham_middle(x, y, fftLen, k);
+    RFFT_PROFILE_MARK_BUTTERFLY();
+  }
+
+  pk_stockham_last(y, y, fftLen, by2);
+  RFFT_PROFILE_MARK_BUTTERFLY();
+
+  return (q15_t *) y;
+}
+
+#endif /* RFFT_Q15_STOCKHAM */
+
+#endif /* !ARM_MATH_DSP && RFFT_Q15_PACKED_BUTTERFLY */
+
+#if defined (ARM_MATH_DSP)
+/* Both halves of a packed pair shifted left by shift, with Q15 wrap-around */
+static inline q31_t q15x2_shl(q31_t x, uint32_t shift)
+{
+  return (q31_t) (((uint32_t) x << shift) & ~((0xFFFFU >> (16U - shift)) << 16U));
+}
+#endif
+
 /**
   @brief         Core function for the Q15 CFFT butterfly process.
   @param[in,out] pSrc16          points to the in-place buffer of Q15 data type
   @param[in]     fftLen           length of the FFT
   @param[in]     pCoef16         points to twiddle coefficient buffer
   @param[in]     twidCoefModifier twiddle coefficient modifier that supports different size FFTs with the same twiddle factor table
+  @param[in]     shift            left shift of every output value
+
+  The outputs of the last stage are shifted left by 'shift' with Q15
+  wrap-around, the same as shifting every value of the result afterwards.
+  This folds the output fix-up of the radix-4-by-2 transform into this
+  stage.
  */
 
-ARM_DSP_ATTRIBUTE void arm_radix4_butterfly_q15(
+ARM_DSP_ATTRIBUTE RFFT_Q15_HOT void arm_radix4_butterfly_q15(
         q15_t * pSrc16,
         uint32_t fftLen,
   const q15_t * pCoef16,
-        uint32_t twidCoefModifier)
+        uint32_t twidCoefModifier,
+        uint32_t shift)
 {
 
 #if defined (ARM_MATH_DSP)
@@ -512,14 +1206,14 @@ ARM_DSP_ATTRIBUTE void arm_radix4_butterfly_q15(
 
     /* xa' = xa + xb + xc + xd */
     /* ya' = ya + yb + yc + yd */
-    write_q15x2_ia (&ptr1, __SHADD16(R, T));
+    write_q15x2_ia (&ptr1, q15x2_shl(__SHADD16(R, T), shift));
 
     /* T = packed((yb + yd), (xb + xd)) */
     T = __QADD16(xbyb, xdyd);
 
     /* xc' = (xa-xb+xc-xd) */
     /* yc' = (ya-yb+yc-yd) */
-    write_q15x2_ia (&ptr1, __SHSUB16(R, T));
+    write_q15x2_ia (&ptr1, q15x2_shl(__SHSUB16(R, T), shift));
 
     /* S = packed((ya - yc), (xa - xc)) */
     S = __QSUB16(xaya, xcyc);
@@ -531,19 +1225,19 @@ ARM_DSP_ATTRIBUTE void arm_radix4_butterfly_q15(
 #ifndef ARM_MATH_BIG_ENDIAN
     /* xb' = (xa+yb-xc-yd) */
     /* yb' = (ya-xb-yc+xd) */
-    write_q15x2_ia (&ptr1, __SHSAX(S, U));
+    write_q15x2_ia (&ptr1, q15x2_shl(__SHSAX(S, U), shift));
 
     /* xd' = (xa-yb-xc+yd) */
     /* yd' = (ya+xb-yc-xd) */
-    write_q15x2_ia (&ptr1, __SHASX(S, U));
+    write_q15x2_ia (&ptr1, q15x2_shl(__SHASX(S, U), shift));
 #else
     /* xb' = (xa+yb-xc-yd) */
     /* yb' = (ya-xb-yc+xd) */
-    write_q15x2_ia (&ptr1, __SHASX(S, U));
+    write_q15x2_ia (&ptr1, q15x2_shl(__SHASX(S, U), shift));
 
     /* xd' = (xa-yb-xc+yd) */
     /* yd' = (ya+xb-yc-xd) */
-    write_q15x2_ia (&ptr1, __SHSAX(S, U));
+    write_q15x2_ia (&ptr1, q15x2_shl(__SHSAX(S, U), shift));
 #endif /* #ifndef ARM_MATH_BIG_ENDIAN */
 
   } while (--j);
@@ -556,6 +1250,27 @@ ARM_DSP_ATTRIBUTE void arm_radix4_butterfly_q15(
   /* output is in 5.11(q11) format for the 16 point  */
 
 
+#elif defined (RFFT_Q15_PACKED_BUTTERFLY)
+
+  if (shift == 0U)
+  {
+    arm_radix4_butterfly_q15_packed(pSrc16, fftLen, pCoef16, twidCoefModifier, NULL);
+  }
+  else
+  {
+    /* The fixed-length kernels have no output shift */
+    q31_t *pSrc = (q31_t *) pSrc16;
+
+    pk_stage_first(pSrc, fftLen, pCoef16, twidCoefModifier);
+    RFFT_PROFILE_BUTTERFLY_FROM(0U);
+    RFFT_PROFILE_MARK_BUTTERFLY();
+
+    pk_middle_stages(pSrc, fftLen, pCoef16, twidCoefModifier);
+
+    pk_last_stage(pSrc, NULL, fftLen, shift);
+    RFFT_PROFILE_MARK_BUTTERFLY();
+  }
+
 #else /* #if defined (ARM_MATH_DSP) */
 
         q15_t R0, R1, S0, S1, T0, T1, U0, U1;
@@ -643,8 +1358,8 @@ ARM_DSP_ATTRIBUTE void arm_radix4_butterfly_q15(
     R1 = __SSAT(R1 - T1, 16U);
 
     /* co2 & si2 are read from Coefficient pointer */
-    Co2 = pCoef16[2U * ic * 2U];
-    Si2 = pCoef16[(2U * ic * 2U) + 1];
+    Co2 = RFFT_TWIDDLE_COS(pCoef16, 2U * ic);
+    Si2 = RFFT_TWIDDLE_SIN(pCoef16, 2U * ic);
 
     /* xc' = (xa-xb+xc-xd)* co2 + (ya-yb+yc-yd)* (si2) */
     out1 = (q15_t) ((Co2 * R0 + Si2 * R1) >> 16U);
@@ -681,8 +1396,8 @@ ARM_DSP_ATTRIBUTE void arm_radix4_butterfly_q15(
     S1 = (q15_t) __SSAT(((q31_t) S1 - T0), 16U);
 
     /* co1 & si1 are read from Coefficient pointer */
-    Co1 = pCoef16[ic * 2U];
-    Si1 = pCoef16[(ic * 2U) + 1];
+    Co1 = RFFT_TWIDDLE_COS(pCoef16, ic);
+    Si1 = RFFT_TWIDDLE_SIN(pCoef16, ic);
     /*  Butterfly process for the i0+fftLen/2 sample */
     /* xb' = (xa+yb-xc-yd)* co1 + (ya-xb-yc+xd)* (si1) */
     out1 = (q15_t) ((Si1 * S1 + Co1 * S0) >> 16);
@@ -694,8 +1409,8 @@ ARM_DSP_ATTRIBUTE void arm_radix4_butterfly_q15(
     pSrc16[(i2 * 2U) + 1] = out2;
 
     /* Co3 & si3 are read from Coefficient pointer */
-    Co3 = pCoef16[3U * (ic * 2U)];
-    Si3 = pCoef16[(3U * (ic * 2U)) + 1];
+    Co3 = RFFT_TWIDDLE_COS(pCoef16, 3U * ic);
+    Si3 = RFFT_TWIDDLE_SIN(pCoef16, 3U * ic);
     /*  Butterfly process for the i0+3fftLen/4 sample */
     /* xd' = (xa-yb-xc+yd)* Co3 + (ya+xb-yc-xd)* (si3) */
     out1 = (q15_t) ((Si3 * R1 + Co3 * R0) >> 16U);
@@ -715,6 +1430,8 @@ ARM_DSP_ATTRIBUTE void arm_radix4_butterfly_q15(
   /* data is in 4.11(q11) format */
 
   /* end of first stage process */
+  RFFT_PROFILE_BUTTERFLY_FROM(0U);
+  RFFT_PROFILE_MARK_BUTTERFLY();
 
 
   /* start of middle stage process */
@@ -733,12 +1450,12 @@ ARM_DSP_ATTRIBUTE void arm_radix4_butterfly_q15(
     for (j = 0U; j <= (n2 - 1U); j++)
     {
       /*  index calculation for the coefficients */
-      Co1 = pCoef16[ic * 2U];
-      Si1 = pCoef16[(ic * 2U) + 1U];
-      Co2 = pCoef16[2U * (ic * 2U)];
-      Si2 = pCoef16[(2U * (ic * 2U)) + 1U];
-      Co3 = pCoef16[3U * (ic * 2U)];
-      Si3 = pCoef16[(3U * (ic * 2U)) + 1U];
+      Co1 = RFFT_TWIDDLE_COS(pCoef16, ic);
+      Si1 = RFFT_TWIDDLE_SIN(pCoef16, ic);
+      Co2 = RFFT_TWIDDLE_COS(pCoef16, 2U * ic);
+      Si2 = RFFT_TWIDDLE_SIN(pCoef16, 2U * ic);
+      Co3 = RFFT_TWIDDLE_COS(pCoef16, 3U * ic);
+      Si3 = RFFT_TWIDDLE_SIN(pCoef16, 3U * ic);
 
       /*  Twiddle coefficients index modifier */
       ic = ic + twidCoefModifier;
@@ -854,6 +1571,7 @@ ARM_DSP_ATTRIBUTE void arm_radix4_butterfly_q15(
     }
     /*  Twiddle coefficients index modifier */
     twidCoefModifier <<= 2U;
+    RFFT_PROFILE_MARK_BUTTERFLY();
   }
   /* end of middle stage process */
 
@@ -910,8 +1628,8 @@ ARM_DSP_ATTRIBUTE void arm_radix4_butterfly_q15(
     /*  writing the butterfly processed i0 sample */
     /* xa' = xa + xb + xc + xd */
     /* ya' = ya + yb + yc + yd */
-    pSrc16[i0 * 2U] = (R0 >> 1U) + (T0 >> 1U);
-    pSrc16[(i0 * 2U) + 1U] = (R1 >> 1U) + (T1 >> 1U);
+    pSrc16[i0 * 2U] = (q15_t) (((R0 >> 1U) + (T0 >> 1U)) << shift);
+    pSrc16[(i0 * 2U) + 1U] = (q15_t) (((R1 >> 1U) + (T1 >> 1U)) << shift);
 
     /* R0 = (ya + yc) - (yb + yd), R1 = (xa + xc) - (xb + xd) */
     R0 = (R0 >> 1U) - (T0 >> 1U);
@@ -923,8 +1641,8 @@ ARM_DSP_ATTRIBUTE void arm_radix4_butterfly_q15(
     /*  writing the butterfly processed i0 + fftLen/4 sample */
     /* xc' = (xa-xb+xc-xd) */
     /* yc' = (ya-yb+yc-yd) */
-    pSrc16[i1 * 2U] = R0;
-    pSrc16[(i1 * 2U) + 1U] = R1;
+    pSrc16[i1 * 2U] = (q15_t) (R0 << shift);
+    pSrc16[(i1 * 2U) + 1U] = (q15_t) (R1 << shift);
 
     /* Read yd (real), xd(imag) input */
     U0 = pSrc16[i3 * 2U];
@@ -936,18 +1654,19 @@ ARM_DSP_ATTRIBUTE void arm_radix4_butterfly_q15(
     /*  writing the butterfly processed i0 + fftLen/2 sample */
     /* xb' = (xa+yb-xc-yd) */
     /* yb' = (ya-xb-yc+xd) */
-    pSrc16[i2 * 2U] = (S0 >> 1U) + (T1 >> 1U);
-    pSrc16[(i2 * 2U) + 1U] = (S1 >> 1U) - (T0 >> 1U);
+    pSrc16[i2 * 2U] = (q15_t) (((S0 >> 1U) + (T1 >> 1U)) << shift);
+    pSrc16[(i2 * 2U) + 1U] = (q15_t) (((S1 >> 1U) - (T0 >> 1U)) << shift);
 
     /*  writing the butterfly processed i0 + 3fftLen/4 sample */
     /* xd' = (xa-yb-xc+yd) */
     /* yd' = (ya+xb-yc-xd) */
-    pSrc16[i3 * 2U] = (S0 >> 1U) - (T1 >> 1U);
-    pSrc16[(i3 * 2U) + 1U] = (S1 >> 1U) + (T0 >> 1U);
+    pSrc16[i3 * 2U] = (q15_t) (((S0 >> 1U) - (T1 >> 1U)) << shift);
+    pSrc16[(i3 * 2U) + 1U] = (q15_t) (((S1 >> 1U) + (T0 >> 1U)) << shift);
 
   }
 
   /* end of last stage process */
+  RFFT_PROFILE_MARK_BUTTERFLY();
 
   /* output is in 11.5(q5) format for the 1024 point */
   /* output is in 9.7(q7) format for the 256 point   */
@@ -1007,11 +1726,18 @@ ARM_DSP_ATTRIBUTE void arm_radix4_butterfly_q15(
  *
  */
 
+/*
+ * The outputs of the last stage are shifted left by 'shift' with Q15
+ * wrap-around, the same as shifting every value of the result afterwards.
+ * This folds the output fix-up of the radix-4-by-2 transform and of the
+ * real IFFT into this stage.
+ */
 ARM_DSP_ATTRIBUTE void arm_radix4_butterfly_inverse_q15(
         q15_t * pSrc16,
         uint32_t fftLen,
   const q15_t * pCoef16,
-        uint32_t twidCoefModifier)
+        uint32_t twidCoefModifier,
+        uint32_t shift)
 {
 
 #if defined (ARM_MATH_DSP)
@@ -1374,14 +2100,14 @@ ARM_DSP_ATTRIBUTE void arm_radix4_butterfly_inverse_q15(
 
     /* xa' = xa + xb + xc + xd */
     /* ya' = ya + yb + yc + yd */
-    write_q15x2_ia (&ptr1, __SHADD16(R, T));
+    write_q15x2_ia (&ptr1, q15x2_shl(__SHADD16(R, T), shift));
 
     /* T = packed((yb + yd), (xb + xd)) */
     T = __QADD16(xbyb, xdyd);
 
     /* xc' = (xa-xb+xc-xd) */
     /* yc' = (ya-yb+yc-yd) */
-    write_q15x2_ia (&ptr1, __SHSUB16(R, T));
+    write_q15x2_ia (&ptr1, q15x2_shl(__SHSUB16(R, T), shift));
 
     /* S = packed((ya - yc), (xa - xc)) */
     S = __QSUB16(xaya, xcyc);
@@ -1393,19 +2119,19 @@ ARM_DSP_ATTRIBUTE void arm_radix4_butterfly_inverse_q15(
 #ifndef ARM_MATH_BIG_ENDIAN
     /* xb' = (xa+yb-xc-yd) */
     /* yb' = (ya-xb-yc+xd) */
-    write_q15x2_ia (&ptr1, __SHASX(S, U));
+    write_q15x2_ia (&ptr1, q15x2_shl(__SHASX(S, U), shift));
 
     /* xd' = (xa-yb-xc+yd) */
     /* yd' = (ya+xb-yc-xd) */
-    write_q15x2_ia (&ptr1, __SHSAX(S, U));
+    write_q15x2_ia (&ptr1, q15x2_shl(__SHSAX(S, U), shift));
 #else
     /* xb' = (xa+yb-xc-yd) */
     /* yb' = (ya-xb-yc+xd) */
-    write_q15x2_ia (&ptr1, __SHSAX(S, U));
+    write_q15x2_ia (&ptr1, q15x2_shl(__SHSAX(S, U), shift));
 
     /* xd' = (xa-yb-xc+yd) */
     /* yd' = (ya+xb-yc-xd) */
-    write_q15x2_ia (&ptr1, __SHASX(S, U));
+    write_q15x2_ia (&ptr1, q15x2_shl(__SHASX(S, U), shift));
 #endif /* #ifndef ARM_MATH_BIG_ENDIAN */
 
   } while (--j);
@@ -1497,8 +2223,8 @@ ARM_DSP_ATTRIBUTE void arm_radix4_butterfly_inverse_q15(
     R0 = __SSAT(R0 - T0, 16U);
     R1 = __SSAT(R1 - T1, 16U);
     /* co2 & si2 are read from Coefficient pointer */
-    Co2 = pCoef16[2U * ic * 2U];
-    Si2 = pCoef16[(2U * ic * 2U) + 1U];
+    Co2 = RFFT_TWIDDLE_COS(pCoef16, 2U * ic);
+    Si2 = RFFT_TWIDDLE_SIN(pCoef16, 2U * ic);
     /* xc' = (xa-xb+xc-xd)* co2 - (ya-yb+yc-yd)* (si2) */
     out1 = (q15_t) ((Co2 * R0 - Si2 * R1) >> 16U);
     /* yc' = (ya-yb+yc-yd)* co2 + (xa-xb+xc-xd)* (si2) */
@@ -1532,8 +2258,8 @@ ARM_DSP_ATTRIBUTE void arm_radix4_butterfly_inverse_q15(
     S1 = (q15_t) __SSAT((q31_t) (S1 + T0), 16);
 
     /* co1 & si1 are read from Coefficient pointer */
-    Co1 = pCoef16[ic * 2U];
-    Si1 = pCoef16[(ic * 2U) + 1U];
+    Co1 = RFFT_TWIDDLE_COS(pCoef16, ic);
+    Si1 = RFFT_TWIDDLE_SIN(pCoef16, ic);
     /*  Butterfly process for the i0+fftLen/2 sample */
     /* xb' = (xa-yb-xc+yd)* co1 - (ya+xb-yc-xd)* (si1) */
     out1 = (q15_t) ((Co1 * S0 - Si1 * S1) >> 16U);
@@ -1544,8 +2270,8 @@ ARM_DSP_ATTRIBUTE void arm_radix4_butterfly_inverse_q15(
     pSrc16[(i2 * 2U) + 1U] = out2;
 
     /* Co3 & si3 are read from Coefficient pointer */
-    Co3 = pCoef16[3U * ic * 2U];
-    Si3 = pCoef16[(3U * ic * 2U) + 1U];
+    Co3 = RFFT_TWIDDLE_COS(pCoef16, 3U * ic);
+    Si3 = RFFT_TWIDDLE_SIN(pCoef16, 3U * ic);
     /*  Butterfly process for the i0+3fftLen/4 sample */
     /* xd' = (xa+yb-xc-yd)* Co3 - (ya-xb-yc+xd)* (si3) */
     out1 = (q15_t) ((Co3 * R0 - Si3 * R1) >> 16U);
@@ -1584,12 +2310,12 @@ ARM_DSP_ATTRIBUTE void arm_radix4_butterfly_inverse_q15(
     for (j = 0U; j <= (n2 - 1U); j++)
     {
       /*  index calculation for the coefficients */
-      Co1 = pCoef16[ic * 2U];
-      Si1 = pCoef16[(ic * 2U) + 1U];
-      Co2 = pCoef16[2U * ic * 2U];
-      Si2 = pCoef16[2U * ic * 2U + 1U];
-      Co3 = pCoef16[3U * ic * 2U];
-      Si3 = pCoef16[(3U * ic * 2U) + 1U];
+      Co1 = RFFT_TWIDDLE_COS(pCoef16, ic);
+      Si1 = RFFT_TWIDDLE_SIN(pCoef16, ic);
+      Co2 = RFFT_TWIDDLE_COS(pCoef16, 2U * ic);
+      Si2 = RFFT_TWIDDLE_SIN(pCoef16, 2U * ic);
+      Co3 = RFFT_TWIDDLE_COS(pCoef16, 3U * ic);
+      Si3 = RFFT_TWIDDLE_SIN(pCoef16, 3U * ic);
 
       /*  Twiddle coefficients index modifier */
       ic = ic + twidCoefModifier;
@@ -1753,8 +2479,8 @@ ARM_DSP_ATTRIBUTE void arm_radix4_butterfly_inverse_q15(
     /*  writing the butterfly processed i0 sample */
     /* xa' = xa + xb + xc + xd */
     /* ya' = ya + yb + yc + yd */
-    pSrc16[i0 * 2U] = (R0 >> 1U) + (T0 >> 1U);
-    pSrc16[(i0 * 2U) + 1U] = (R1 >> 1U) + (T1 >> 1U);
+    pSrc16[i0 * 2U] = (q15_t) (((R0 >> 1U) + (T0 >> 1U)) << shift);
+    pSrc16[(i0 * 2U) + 1U] = (q15_t) (((R1 >> 1U) + (T1 >> 1U)) << shift);
 
     /* R0 = (ya + yc) - (yb + yd), R1 = (xa + xc) - (xb + xd) */
     R0 = (R0 >> 1U) - (T0 >> 1U);
@@ -1767,8 +2493,8 @@ ARM_DSP_ATTRIBUTE void arm_radix4_butterfly_inverse_q15(
     /*  writing the butterfly processed i0 + fftLen/4 sample */
     /* xc' = (xa-xb+xc-xd) */
     /* yc' = (ya-yb+yc-yd) */
-    pSrc16[i1 * 2U] = R0;
-    pSrc16[(i1 * 2U) + 1U] = R1;
+    pSrc16[i1 * 2U] = (q15_t) (R0 << shift);
+    pSrc16[(i1 * 2U) + 1U] = (q15_t) (R1 << shift);
 
     /* Read yd (real), xd(imag) input */
     U0 = pSrc16[i3 * 2U];
@@ -1780,15 +2506,15 @@ ARM_DSP_ATTRIBUTE void arm_radix4_butterfly_inverse_q15(
     /*  writing the butterfly processed i0 + fftLen/2 sample */
     /* xb' = (xa-yb-xc+yd) */
     /* yb' = (ya+xb-yc-xd) */
-    pSrc16[i2 * 2U] = (S0 >> 1U) - (T1 >> 1U);
-    pSrc16[(i2 * 2U) + 1U] = (S1 >> 1U) + (T0 >> 1U);
+    pSrc16[i2 * 2U] = (q15_t) (((S0 >> 1U) - (T1 >> 1U)) << shift);
+    pSrc16[(i2 * 2U) + 1U] = (q15_t) (((S1 >> 1U) + (T0 >> 1U)) << shift);
 
 
     /*  writing the butterfly processed i0 + 3fftLen/4 sample */
     /* xd' = (xa+yb-xc-yd) */
     /* yd' = (ya-xb-yc+xd) */
-    pSrc16[i3 * 2U] = (S0 >> 1U) + (T1 >> 1U);
-    pSrc16[(i3 * 2U) + 1U] = (S1 >> 1U) - (T0 >> 1U);
+    pSrc16[i3 * 2U] = (q15_t) (((S0 >> 1U) + (T1 >> 1U)) << shift);
+    pSrc16[(i3 * 2U) + 1U] = (q15_t) (((S1 >> 1U) - (T0 >> 1U)) << shift);
   }
   /* end of last stage  process */
 
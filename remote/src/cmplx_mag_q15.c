@@ -0,0 +1,140 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library - Simplified Q15 RFFT
+ * Title:        cmplx_mag_q15.c
+ * Description:  Magnitude² and log-magnitude of whole Q15 spectra
+ *
+ * Target Processor: ARM Cortex-M33, nRF54L15 FLPR (RISC-V)
+ * -------------------------------------------------------------------- */
+
+#include "rfft_q15_simplified.h"
+
+/* re² + im² of a bin read as one word, wrapping to 2^31 for two -32768 as the instruction does */
+static inline uint32_t cmplx_mag_sq_x2(q31_t w)
+{
+#if defined (ARM_MATH_DSP)
+    return (uint32_t) __SMUAD(w, w);
+#else
+    return (uint32_t) rfft_q15_smuad(w, w);
+#endif
+}
+
+/* 10 * log10(2) in Q16, and 42.5 octaves in Q8 */
+#define CMPLX_DB_PER_OCTAVE_Q16  197283
+#define CMPLX_DB_OCTAVES_MAX     10880
+
+/*
+ * One bin of the log kernels. offset is (2 * exponent - 30) * 256: the
+ * bins are the DFT over 2^exponent, and a Q15 square is Q30.
+ */
+static inline int16_t cmplx_mag_log_q8(uint32_t mag, int32_t offset, int db)
+{
+    int32_t v;
+
+    if (mag == 0U) {
+        return CMPLX_MAG_LOG_ZERO;
+    }
+
+    v = rfft_q15_log2_q8(mag) + offset;
+    if (db) {
+        /* 42.5 octaves are the 128 dB that fit, the product stays in 32 bits */
+        v = rfft_q15_max(rfft_q15_min(v, CMPLX_DB_OCTAVES_MAX), -CMPLX_DB_OCTAVES_MAX);
+        v = (v * CMPLX_DB_PER_OCTAVE_Q16 + 0x8000) >> 16;
+    }
+
+    /* Above CMPLX_MAG_LOG_ZERO, however large a block exponent */
+    return (int16_t) rfft_q15_max(rfft_q15_ssat(v, 16U), INT16_MIN + 1);
+}
+
+static inline void cmplx_mag_log_q15(
+    const q15_t * pSrc,
+          int16_t * pDst,
+          uint32_t numBins,
+          int32_t exponent,
+          int db)
+{
+    int32_t offset = (2 * exponent - 30) * 256;
+    uint32_t blkCnt = numBins >> 1U;
+
+    while (blkCnt > 0U)
+    {
+        q31_t a = read_q15x2(pSrc);
+        q31_t b = read_q15x2(pSrc + 2);
+
+        pDst[0] = cmplx_mag_log_q8(cmplx_mag_sq_x2(a), offset, db);
+        pDst[1] = cmplx_mag_log_q8(cmplx_mag_sq_x2(b), offset, db);
+        pSrc += 4;
+        pDst += 2;
+        blkCnt--;
+    }
+
+    if ((numBins & 1U) != 0U)
+    {
+        pDst[0] = cmplx_mag_log_q8(cmplx_mag_sq_x2(read_q15x2(pSrc)), offset, db);
+    }
+}
+
+/**
+ * @brief Magnitude squared of complex Q15 bins.
+ * @param[in]  pSrc     points to numBins complex values
+ * @param[out] pDst     points to numBins magnitudes²
+ * @param[in]  numBins  number of bins
+ *
+ * Two bins per iteration, each read as one word. The values are those of
+ * arm_rfft_q15_mag_sq(), (uint32_t) (re * re) + (uint32_t) (im * im).
+ */
+RFFT_Q15_HOT void cmplx_mag_squared_q15(
+    const q15_t * pSrc,
+          uint32_t * pDst,
+          uint32_t numBins)
+{
+    uint32_t blkCnt = numBins >> 1U;
+
+    while (blkCnt > 0U)
+    {
+        q31_t a = read_q15x2(pSrc);
+        q31_t b = read_q15x2(pSrc + 2);
+
+        pDst[0] = cmplx_mag_sq_x2(a);
+        pDst[1] = cmplx_mag_sq_x2(b);
+        pSrc += 4;
+        pDst += 2;
+        blkCnt--;
+    }
+
+    if ((numBins & 1U) != 0U)
+    {
+        pDst[0] = cmplx_mag_sq_x2(read_q15x2(pSrc));
+    }
+}
+
+/**
+ * @brief log2 of the power of complex Q15 bins, in Q8.
+ * @param[in]  pSrc      points to numBins complex values
+ * @param[out] pDst      points to numBins log2 powers
+ * @param[in]  numBins   number of bins
+ * @param[in]  exponent  log2 of the scaling of pSrc
+ */
+RFFT_Q15_HOT void cmplx_mag_log2_q15(
+    const q15_t * pSrc,
+          int16_t * pDst,
+          uint32_t numBins,
+          int32_t exponent)
+{
+    cmplx_mag_log_q15(pSrc, pDst, numBins, exponent, 0);
+}
+
+/**
+ * @brief Power of complex Q15 bins in dB, in Q8.
+ * @param[in]  pSrc      points to numBins complex values
+ * @param[out] pDst      points to numBins powers in dB
+ * @param[in]  numBins   number of bins
+ * @param[in]  exponent  log2 of the scaling of pSrc
+ */
+RFFT_Q15_HOT void cmplx_mag_db_q15(
+    const q15_t * pSrc,
+          int16_t * pDst,
+          uint32_t numBins,
+          int32_t exponent)
+{
+    cmplx_mag_log_q15(pSrc, pDst, numBins, exponent, 1);
+}
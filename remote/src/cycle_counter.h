@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef CYCLE_COUNTER_H
+#define CYCLE_COUNTER_H
+
+#include <stdint.h>
+#include <zephyr/devicetree.h>
+
+/*
+ * Clock of this core, which its cycle counter counts, from the CPU node of
+ * the devicetree. The nRF5340 network core has none with a clock and always
+ * runs at 64 MHz.
+ */
+#if defined(CONFIG_SOC_NRF54H20_CPUPPR)
+#define CYCLE_COUNTER_HZ DT_PROP_OR(DT_NODELABEL(cpuppr), clock_frequency, 16000000)
+#elif defined(CONFIG_SOC_NRF54H20_CPURAD)
+#define CYCLE_COUNTER_HZ DT_PROP_OR(DT_NODELABEL(cpurad), clock_frequency, 256000000)
+#elif defined(CONFIG_SOC_NRF5340_CPUNET)
+#define CYCLE_COUNTER_HZ 64000000
+#elif defined(__riscv)
+#define CYCLE_COUNTER_HZ DT_PROP_OR(DT_NODELABEL(cpuflpr), clock_frequency, 128000000)
+#else
+#define CYCLE_COUNTER_HZ DT_PROP_OR(DT_NODELABEL(cpuapp), clock_frequency, 128000000)
+#endif
+
+#if defined(__riscv)
+
+// 讀取 RISC-V cycle counter
+static inline uint32_t read_cycle(void) {
+	uint32_t cycle;
+	__asm__ volatile ("rdcycle %0" : "=r"(cycle));
+	return cycle;
+}
+
+/* All 64 bits of the cycle counter, read again if the low half wrapped in between. */
+static inline uint64_t read_cycle64(void)
+{
+	uint32_t hi;
+	uint32_t lo;
+	uint32_t hi2;
+
+	do {
+		__asm__ volatile ("rdcycleh %0" : "=r"(hi));
+		__asm__ volatile ("rdcycle %0" : "=r"(lo));
+		__asm__ volatile ("rdcycleh %0" : "=r"(hi2));
+	} while (hi != hi2);
+
+	return ((uint64_t)hi << 32) | lo;
+}
+
+/*
+ * Microseconds since boot, low 32 bits. At the 128 MHz of the nRF54L15
+ * FLPR and the 16 MHz of the PPR the 64-bit division is a shift rather
+ * than a libgcc call.
+ */
+static inline uint32_t read_cycle_us(void)
+{
+	return (uint32_t)(read_cycle64() / (CYCLE_COUNTER_HZ / 1000000));
+}
+
+/* The cycle counter of the VPR cores always runs. */
+static inline void cycle_counter_init(void)
+{
+}
+#else
+#include <cmsis_core.h>
+#include <zephyr/kernel.h>
+
+/* Start the DWT cycle counter, which is off out of reset. */
+static inline void cycle_counter_init(void)
+{
+#if defined(CONFIG_ARMV8_M_MAINLINE)
+	DCB->DEMCR |= DCB_DEMCR_TRCENA_Msk;
+#else
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+#endif
+	DWT->CYCCNT = 0;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+static inline uint32_t read_cycle(void)
+{
+	return DWT->CYCCNT;
+}
+
+/*
+ * Microseconds since boot, low 32 bits, from the system timer: the DWT
+ * counter wraps within a minute on these cores.
+ */
+static inline uint32_t read_cycle_us(void)
+{
+	return (uint32_t)k_cyc_to_us_floor64(k_cycle_get_64());
+}
+#endif /* __riscv */
+
+#endif /* CYCLE_COUNTER_H */
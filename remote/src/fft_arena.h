@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/*
+ * Bump allocator over one static region, for buffers that are set up once
+ * and live as long as the mode that uses them. The remote core has no
+ * heap: each buffer is carved off the front of the region at startup, and
+ * the whole region is handed back at once by fft_arena_reset() before it
+ * is partitioned again, so nothing fragments and nothing is freed alone.
+ *
+ * Alignments are powers of two and rounded with masks.
+ */
+
+#ifndef FFT_ARENA_H
+#define FFT_ARENA_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/** Alignment of the region and of every allocation. */
+#define FFT_ARENA_ALIGN 4
+
+/** Bytes an allocation of n bytes takes from the arena. */
+#define FFT_ARENA_SIZE(n) (((n) + FFT_ARENA_ALIGN - 1) & ~(size_t)(FFT_ARENA_ALIGN - 1))
+
+struct fft_arena {
+	uint8_t *base;
+	size_t size;
+	size_t used;  /**< Bytes handed out since the last reset. */
+	size_t peak;  /**< Most bytes handed out at once, kept across resets. */
+};
+
+/**
+ * @brief Set up an empty arena on a region.
+ *
+ * @param base Start of the region, FFT_ARENA_ALIGN aligned.
+ * @param size Bytes of the region.
+ */
+static inline void fft_arena_init(struct fft_arena *arena, void *base, size_t size)
+{
+	arena->base = base;
+	arena->size = size;
+	arena->used = 0;
+	arena->peak = 0;
+}
+
+/**
+ * @brief Hand back every allocation, which must no longer be in use.
+ */
+static inline void fft_arena_reset(struct fft_arena *arena)
+{
+	arena->used = 0;
+}
+
+/** Bytes left for allocations. */
+static inline size_t fft_arena_left(const struct fft_arena *arena)
+{
+	return arena->size - arena->used;
+}
+
+/**
+ * @brief Take n bytes off the front of the arena.
+ *
+ * The buffer is not cleared.
+ *
+ * @return The buffer, FFT_ARENA_ALIGN aligned, or NULL if it does not fit.
+ */
+static inline void *fft_arena_alloc(struct fft_arena *arena, size_t n)
+{
+	size_t len = FFT_ARENA_SIZE(n);
+	void *buf;
+
+	if ((len < n) || (len > fft_arena_left(arena))) {
+		return NULL;
+	}
+
+	buf = arena->base + arena->used;
+	arena->used += len;
+	if (arena->used > arena->peak) {
+		arena->peak = arena->used;
+	}
+
+	return buf;
+}
+
+/** Array of count elements of type, or NULL if it does not fit. */
+#define FFT_ARENA_ALLOC_ARRAY(arena, type, count) \
+	((type *)fft_arena_alloc(arena, (size_t)(count) * sizeof(type)))
+
+#endif /* FFT_ARENA_H */
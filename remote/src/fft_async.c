@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <errno.h>
+#include <zephyr/kernel.h>
+
+#include "fft_async.h"
+
+/* Any context may submit, the message queue is safe from interrupts. */
+K_MSGQ_DEFINE(fft_async_queue, sizeof(struct fft_async_job *), CONFIG_APP_FFT_ASYNC_QUEUE_LEN,
+	      4);
+
+/* Counted with the kernel's atomics, the FLPR core has no A extension. */
+static atomic_t jobs_submitted;
+static atomic_t jobs_completed;
+
+int fft_async_submit(struct fft_async_job *job)
+{
+	int ret;
+
+	if ((job == NULL) || (job->samples == NULL) || (job->bins == NULL)) {
+		return -EINVAL;
+	}
+
+	/* Counted first, the FFT thread may complete the job before the put returns. */
+	(void)atomic_inc(&jobs_submitted);
+	ret = k_msgq_put(&fft_async_queue, &job, K_NO_WAIT);
+	if (ret < 0) {
+		(void)atomic_dec(&jobs_submitted);
+	}
+
+	return ret;
+}
+
+uint32_t fft_async_pending(void)
+{
+	return (uint32_t)atomic_get(&jobs_submitted) - (uint32_t)atomic_get(&jobs_completed);
+}
+
+static void fft_async_thread(void *arg1, void *arg2, void *arg3)
+{
+	ARG_UNUSED(arg1);
+	ARG_UNUSED(arg2);
+	ARG_UNUSED(arg3);
+
+	struct fft_async_job *job;
+	struct k_poll_signal *signal;
+	rfft_status_t status;
+
+	while (true) {
+		(void)k_msgq_get(&fft_async_queue, &job, K_FOREVER);
+
+		if (job->ctx != NULL) {
+			status = fft_context_top_bins_inplace(job->ctx, job->samples, job->bins,
+							      job->num_top_bins);
+		} else {
+			status = find_fft_top_bins_inplace(job->samples, job->fft_size, job->bins,
+							   job->num_top_bins);
+		}
+
+		/* The callback may submit the job again, it is the submitter's from here. */
+		signal = job->signal;
+		job->status = status;
+		(void)atomic_inc(&jobs_completed);
+
+		if (job->cb != NULL) {
+			job->cb(job);
+		}
+		if (signal != NULL) {
+			(void)k_poll_signal_raise(signal, (int)status);
+		}
+	}
+}
+
+/* Below the submitting threads, which are never held up by the FFT. */
+K_THREAD_DEFINE(fft_async_id, CONFIG_APP_FFT_ASYNC_STACK_SIZE, fft_async_thread, NULL, NULL, NULL,
+		CONFIG_APP_FFT_ASYNC_PRIORITY, 0, 0);
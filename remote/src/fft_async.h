@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/*
+ * Top bins of frames submitted to an FFT thread of its own. The submitter
+ * only queues a job and returns, from a thread or from an interrupt such
+ * as an IPC receive callback, and learns of its completion by a callback
+ * on the FFT thread, a k_poll signal, or both. With two frame buffers the
+ * next frame is received while the FFT runs on the one before.
+ *
+ * The jobs are run one at a time in the order submitted, so they may share
+ * the context of find_fft_top_bins(), which is not thread-safe; no other
+ * thread may use it meanwhile.
+ */
+
+#ifndef FFT_ASYNC_H
+#define FFT_ASYNC_H
+
+#include <zephyr/kernel.h>
+#include "fft_utils.h"
+
+struct fft_async_job;
+
+/**
+ * @brief Completion of a job, called on the FFT thread.
+ *
+ * job->status is set. The job and its buffers belong to the submitter
+ * again, the callback may submit it anew.
+ */
+typedef void (*fft_async_cb_t)(struct fft_async_job *job);
+
+/**
+ * Frame and results of one submission. Owned by the FFT thread from
+ * fft_async_submit() to the completion, the submitter must neither change
+ * it nor touch the samples or bins meanwhile.
+ */
+struct fft_async_job {
+	fft_context_t *ctx;            /**< Context, NULL for that of find_fft_top_bins(). */
+	q15_t *samples;                /**< Frame, overwritten by the FFT in place; RFFT_Q15_ALIGN. */
+	uint16_t fft_size;             /**< Samples of the frame, unused with ctx. */
+	uint16_t num_top_bins;         /**< Bins to find. */
+	uint16_t *bins;                /**< num_top_bins bins, strongest first. */
+	fft_async_cb_t cb;             /**< Called on completion, NULL for none. */
+	struct k_poll_signal *signal;  /**< Raised with the status on completion, NULL for none. */
+	void *user;                    /**< For the callback. */
+	rfft_status_t status;          /**< Result, set before the completion. */
+};
+
+/**
+ * @brief Queue a job for the FFT thread.
+ *
+ * Never blocks, so it is safe from an interrupt.
+ *
+ * @retval 0 when queued, -EINVAL for a NULL job, frame or bins, -ENOMSG
+ *         when CONFIG_APP_FFT_ASYNC_QUEUE_LEN jobs are queued already.
+ */
+int fft_async_submit(struct fft_async_job *job);
+
+/**
+ * @brief Jobs submitted and not completed yet, the one in the FFT included.
+ */
+uint32_t fft_async_pending(void);
+
+#endif /* FFT_ASYNC_H */
@@ -0,0 +1,212 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <string.h>
+
+#include "fft_bench.h"
+#include "fft_utils.h"
+#include "cycle_counter.h"
+
+#if defined(CONFIG_APP_FFT_BENCH_ENERGY)
+#include <zephyr/drivers/gpio.h>
+
+#if !DT_NODE_HAS_PROP(DT_PATH(zephyr_user), fft_trigger_gpios)
+#error "APP_FFT_BENCH_ENERGY needs fft-trigger-gpios in the /zephyr,user node"
+#endif
+#endif
+
+#define BENCH_ITERATIONS CONFIG_APP_FFT_BENCH_ITERATIONS
+
+static const uint16_t bench_top_bins[] = { 1, 20, FFT_TOP_BINS_MAX };
+
+static const struct {
+	fft_window_type_t type;
+	const char *name;
+} bench_windows[] = {
+	{ FFT_WINDOW_RECT, "rect" },
+#if defined(CONFIG_APP_FFT_BENCH_WINDOWS)
+	{ FFT_WINDOW_HANN, "hann" },
+	{ FFT_WINDOW_HAMMING, "hamming" },
+	{ FFT_WINDOW_BLACKMAN, "blackman" },
+#endif
+};
+
+static q15_t input[RFFT_Q15_MAX_FFT_LEN];
+static q15_t work[RFFT_Q15_MAX_FFT_LEN] RFFT_Q15_ALIGN;
+static q15_t window[FFT_WINDOW_TABLE_LEN(RFFT_Q15_MAX_FFT_LEN)];
+static spectral_peak_t peaks[FFT_TOP_BINS_MAX];
+static uint16_t top_bins[FFT_TOP_BINS_MAX];
+static uint32_t samples[BENCH_ITERATIONS];
+static fft_context_t ctx;
+
+#if defined(CONFIG_APP_FFT_BENCH_ENERGY)
+/* High during a burst, on a digital input of the power analyzer. */
+static const struct gpio_dt_spec trigger =
+	GPIO_DT_SPEC_GET(DT_PATH(zephyr_user), fft_trigger_gpios);
+static bool trigger_ready;
+#endif
+
+/* The same pseudo-random frame for every scenario, a tone on noise. */
+static void fill_input(void)
+{
+	uint32_t seed = 12345U;
+
+	for (uint32_t i = 0; i < RFFT_Q15_MAX_FFT_LEN; i++) {
+		seed = seed * 1103515245U + 12345U;
+		input[i] = (q15_t)(((i & 16U) ? 8192 : -8192) + (int16_t)(seed >> 16) / 8);
+	}
+}
+
+static void setup(uint16_t fft_size, fft_window_type_t type)
+{
+	(void)fft_context_init(&ctx, fft_size, work, peaks, ARRAY_SIZE(peaks));
+	(void)fft_context_set_window(&ctx, type, window);
+}
+
+/* Cycles of one frame; a cold one also sets the context and its window up. */
+static uint32_t run_once(uint16_t fft_size, fft_window_type_t type, uint16_t num_top_bins,
+			 bool cold)
+{
+	uint32_t start = read_cycle();
+
+	if (cold) {
+		setup(fft_size, type);
+	}
+
+	fft_context_execute(&ctx, input, top_bins, num_top_bins);
+
+	return read_cycle() - start;
+}
+
+/* Few samples, insertion sort does. */
+static void sort(uint32_t *v, uint32_t n)
+{
+	for (uint32_t i = 1; i < n; i++) {
+		uint32_t x = v[i];
+		uint32_t j = i;
+
+		while (j > 0 && v[j - 1] > x) {
+			v[j] = v[j - 1];
+			j--;
+		}
+		v[j] = x;
+	}
+}
+
+static uint32_t cycles_to_us(uint32_t cycles)
+{
+	return (uint32_t)(((uint64_t)cycles * 1000000U) / CYCLE_COUNTER_HZ);
+}
+
+#if defined(CONFIG_APP_FFT_BENCH_ENERGY)
+/*
+ * A burst of frames with the trigger pin high, then the idle time with it
+ * low. Only the cycles of the frames are counted, the power analyzer sees
+ * the whole burst, so the energy of a frame includes its share of the loop.
+ */
+static void run_energy(const char *ipc, uint16_t fft_size, uint32_t w,
+		       uint16_t num_top_bins, bool cold)
+{
+	fft_window_type_t type = bench_windows[w].type;
+	uint64_t cycles = 0;
+	uint32_t start_us;
+	uint32_t burst_us;
+
+	if (!trigger_ready) {
+		return;
+	}
+
+	setup(fft_size, type);
+
+	(void)gpio_pin_set_dt(&trigger, 1);
+	start_us = read_cycle_us();
+
+	for (uint32_t i = 0; i < CONFIG_APP_FFT_BENCH_ENERGY_FRAMES; i++) {
+		cycles += run_once(fft_size, type, num_top_bins, cold);
+	}
+
+	burst_us = read_cycle_us() - start_us;
+	(void)gpio_pin_set_dt(&trigger, 0);
+
+	printk("energy,%s,%s,%s,%u,%s,%u,%s,%u,%u,%u,%u\n",
+	       CONFIG_BOARD_TARGET, RFFT_Q15_BACKEND, ipc, fft_size, bench_windows[w].name,
+	       num_top_bins, cold ? "cold" : "warm", CONFIG_APP_FFT_BENCH_ENERGY_FRAMES,
+	       (uint32_t)(cycles / CONFIG_APP_FFT_BENCH_ENERGY_FRAMES), burst_us,
+	       CYCLE_COUNTER_HZ / 1000000U);
+
+	k_msleep(CONFIG_APP_FFT_BENCH_ENERGY_IDLE_MS);
+}
+#endif /* CONFIG_APP_FFT_BENCH_ENERGY */
+
+static void run_scenario(const char *ipc, uint16_t fft_size, uint32_t w,
+			 uint16_t num_top_bins, bool cold)
+{
+	fft_window_type_t type = bench_windows[w].type;
+	uint32_t median;
+
+	setup(fft_size, type);
+
+	for (uint32_t i = 0; i < CONFIG_APP_FFT_BENCH_WARMUP; i++) {
+		(void)run_once(fft_size, type, num_top_bins, cold);
+	}
+
+	for (uint32_t i = 0; i < BENCH_ITERATIONS; i++) {
+		samples[i] = run_once(fft_size, type, num_top_bins, cold);
+	}
+
+	sort(samples, BENCH_ITERATIONS);
+	median = samples[BENCH_ITERATIONS / 2];
+
+	/* The clock and frames per second, to compare cores at their power draw. */
+	printk("bench,%s,%s,%s,%u,%s,%u,%s,%u,%u,%u,%u,%u,%u,%u,%u,%u\n",
+	       CONFIG_BOARD_TARGET, RFFT_Q15_BACKEND, ipc, fft_size, bench_windows[w].name,
+	       num_top_bins, cold ? "cold" : "warm", BENCH_ITERATIONS,
+	       samples[0], median, samples[BENCH_ITERATIONS - 1],
+	       cycles_to_us(samples[0]), cycles_to_us(median),
+	       cycles_to_us(samples[BENCH_ITERATIONS - 1]), CYCLE_COUNTER_HZ / 1000000U,
+	       (median != 0U) ? CYCLE_COUNTER_HZ / median : 0U);
+
+#if defined(CONFIG_APP_FFT_BENCH_ENERGY)
+	run_energy(ipc, fft_size, w, num_top_bins, cold);
+#endif
+}
+
+void fft_bench_run(const char *ipc, bool header)
+{
+	cycle_counter_init();
+	fill_input();
+
+#if defined(CONFIG_APP_FFT_BENCH_ENERGY)
+	trigger_ready = gpio_is_ready_dt(&trigger) &&
+			(gpio_pin_configure_dt(&trigger, GPIO_OUTPUT_INACTIVE) == 0);
+	if (!trigger_ready) {
+		printk("FFT energy trigger %s.%u not ready, no bursts\n", trigger.port->name,
+		       trigger.pin);
+	}
+#endif
+
+	if (header) {
+		printk("bench,board,backend,ipc,fft_size,window,top_bins,run,iterations,"
+		       "min_cycles,median_cycles,max_cycles,min_us,median_us,max_us,cpu_mhz,"
+		       "frames_per_s\n");
+#if defined(CONFIG_APP_FFT_BENCH_ENERGY)
+		printk("energy,board,backend,ipc,fft_size,window,top_bins,run,frames,"
+		       "mean_cycles,burst_us,cpu_mhz\n");
+#endif
+	}
+
+	for (uint32_t n = RFFT_Q15_MIN_FFT_LEN; n <= RFFT_Q15_MAX_FFT_LEN; n *= 2U) {
+		for (uint32_t w = 0; w < ARRAY_SIZE(bench_windows); w++) {
+			for (uint32_t k = 0; k < ARRAY_SIZE(bench_top_bins); k++) {
+				run_scenario(ipc, (uint16_t)n, w, bench_top_bins[k], false);
+#if defined(CONFIG_APP_FFT_BENCH_COLD)
+				run_scenario(ipc, (uint16_t)n, w, bench_top_bins[k], true);
+#endif
+			}
+		}
+	}
+}
@@ -0,0 +1,26 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef FFT_BENCH_H
+#define FFT_BENCH_H
+
+#include <stdbool.h>
+
+/**
+ * Run the benchmark matrix of CONFIG_APP_FFT_BENCH and print one CSV row
+ * per scenario: every built-in RFFT length, window, top N count and warm
+ * or cold run. Each row gives the min, median and max of
+ * CONFIG_APP_FFT_BENCH_ITERATIONS runs on the cycle counter, after
+ * CONFIG_APP_FFT_BENCH_WARMUP discarded ones. With
+ * CONFIG_APP_FFT_BENCH_ENERGY every scenario is followed by a burst with
+ * the trigger pin high and an energy row, for remote/fft_energy.py.
+ *
+ * @param ipc     IPC state during the run, printed in the ipc column.
+ * @param header  Print the CSV header first.
+ */
+void fft_bench_run(const char *ipc, bool header);
+
+#endif /* FFT_BENCH_H */
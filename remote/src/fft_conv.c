@@ -0,0 +1,192 @@
+/* ----------------------------------------------------------------------
+ * Project:      FFT Utility Functions
+ * Title:        fft_conv.c
+ * Description:  Overlap-save FIR filtering with the Q15 RFFT
+ *
+ * Target Processor: nRF54L15 FLPR (RISC-V)
+ * -------------------------------------------------------------------- */
+
+#include "fft_conv.h"
+#include <string.h>
+
+/*
+ * Shift the fft_size values of p left until the largest has one bit of
+ * headroom left. The BFP transform leaves a few bits unused, the spectral
+ * multiplication would lose them. Returns the shift.
+ */
+static int32_t fft_conv_normalize(q15_t *p, uint32_t fft_size)
+{
+    uint32_t m = 0;
+    int32_t shift = 0;
+
+    for (uint32_t i = 0; i < fft_size; i++) {
+        q31_t v = p[i];
+        m |= (uint32_t) (v ^ (v >> 31));
+    }
+
+    if (m == 0) {
+        return 0;
+    }
+
+    while ((m << shift) < 0x2000U) {
+        shift++;
+    }
+
+    for (uint32_t i = 0; i < fft_size; i++) {
+        p[i] = (q15_t) (p[i] << shift);
+    }
+
+    return shift;
+}
+
+/**
+ * @brief Prepare a filter and compute the spectrum of its taps
+ */
+rfft_status_t fft_conv_init(
+    fft_conv_t *conv,
+    const q15_t *taps,
+    uint16_t num_taps,
+    uint16_t fft_size,
+    q15_t *ring,
+    q15_t *filter_spectrum,
+    q15_t *work
+)
+{
+    rfft_status_t status;
+
+    if (conv == NULL || taps == NULL || ring == NULL ||
+        filter_spectrum == NULL || work == NULL) {
+        return RFFT_ERROR_NULL_POINTER;
+    }
+
+    if (num_taps == 0 || num_taps > fft_size / 2) {
+        return RFFT_ERROR_INVALID_SIZE;
+    }
+
+    /* Checks fft_size; the block is the hop of the history */
+    status = fft_stft_init(&conv->stft, ring, fft_size,
+                           (uint16_t) (fft_size - num_taps + 1));
+    if (status != RFFT_SUCCESS) {
+        return status;
+    }
+
+    conv->rfft = rfft_q15_get_instance(fft_size);
+    conv->filter_spectrum = filter_spectrum;
+    conv->work = work;
+    conv->fft_size = fft_size;
+    conv->num_taps = num_taps;
+    conv->block_size = conv->stft.hop_size;
+
+    conv->log2_size = 0;
+    while ((1U << conv->log2_size) < fft_size) {
+        conv->log2_size++;
+    }
+
+    /* Zero-padded taps, transformed with as many bits as they have */
+    memcpy(filter_spectrum, taps, num_taps * sizeof(q15_t));
+    memset(&filter_spectrum[num_taps], 0, (fft_size - num_taps) * sizeof(q15_t));
+    conv->filter_exponent = arm_rfft_q15_packed_bfp(conv->rfft, filter_spectrum);
+    conv->filter_exponent -= fft_conv_normalize(filter_spectrum, fft_size);
+
+    fft_conv_reset(conv);
+
+    return RFFT_SUCCESS;
+}
+
+/**
+ * @brief Clear the history, e.g. after a gap in the stream
+ */
+void fft_conv_reset(fft_conv_t *conv)
+{
+    /* Zeros stand in for the samples before the first block */
+    fft_stft_reset(&conv->stft);
+    memset(conv->stft.ring, 0, conv->fft_size * sizeof(q15_t));
+    conv->stft.until_frame = conv->block_size;
+}
+
+/**
+ * @brief Multiply two packed spectra bin by bin
+ */
+void fft_conv_spectrum_mult_q15(
+    const q15_t *pSrcA,
+    const q15_t *pSrcB,
+    q15_t *pDst,
+    uint32_t fft_size
+)
+{
+    /* Bins 0 and fft_size / 2 are real and share the first pair */
+    q31_t dc = ((q31_t) pSrcA[0] * pSrcB[0] + 0x4000) >> 15;
+    q31_t nyquist = ((q31_t) pSrcA[1] * pSrcB[1] + 0x4000) >> 15;
+
+    pDst[0] = (q15_t) __SSAT(dc, 16);
+    pDst[1] = (q15_t) __SSAT(nyquist, 16);
+
+    for (uint32_t i = 2; i < fft_size; i += 2) {
+        q31_t ar = pSrcA[i], ai = pSrcA[i + 1];
+        q31_t br = pSrcB[i], bi = pSrcB[i + 1];
+
+        /* Halved products, so the sums stay within q31_t */
+        q31_t re = ((ar * br) >> 1) - ((ai * bi) >> 1);
+        q31_t im = ((ar * bi) >> 1) + ((ai * br) >> 1);
+
+        pDst[i] = (q15_t) __SSAT((re + 0x2000) >> 14, 16);
+        pDst[i + 1] = (q15_t) __SSAT((im + 0x2000) >> 14, 16);
+    }
+}
+
+/* v * 2^shift, rounded and saturated to Q15 */
+static inline q15_t fft_conv_scale(q31_t v, int32_t shift)
+{
+    if (shift >= 0) {
+        /* |v| < 2^15, anything past 16 saturates anyway */
+        if (shift > 16) {
+            shift = 16;
+        }
+        v <<= shift;
+    } else if (shift > -16) {
+        v = (v + (1 << (-shift - 1))) >> -shift;
+    } else {
+        v = 0;
+    }
+
+    return (q15_t) __SSAT(v, 16);
+}
+
+/**
+ * @brief Filter the due block
+ */
+rfft_status_t fft_conv_process(fft_conv_t *conv, q15_t *output)
+{
+    q15_t *work;
+    int32_t exponent;
+
+    if (conv == NULL || output == NULL) {
+        return RFFT_ERROR_NULL_POINTER;
+    }
+
+    if (!fft_conv_block_ready(conv)) {
+        return RFFT_ERROR_INVALID_SIZE;
+    }
+
+    work = conv->work;
+    fft_stft_take_frame(&conv->stft, work);
+
+    exponent = arm_rfft_q15_packed_bfp(conv->rfft, work);
+    exponent -= fft_conv_normalize(work, conv->fft_size);
+    fft_conv_spectrum_mult_q15(work, conv->filter_spectrum, work, conv->fft_size);
+    exponent += arm_rifft_q15_packed_bfp(conv->rfft, work);
+
+    /*
+     * The taps are Q15, so the product spectrum is scaled by
+     * 2^(exponent + filter_exponent), and the inverse lacks 1/fft_size
+     */
+    exponent += conv->filter_exponent - (int32_t) conv->log2_size;
+
+    /* The first num_taps - 1 outputs wrapped around */
+    work += conv->num_taps - 1U;
+    for (uint32_t i = 0; i < conv->block_size; i++) {
+        output[i] = fft_conv_scale(work[i], exponent);
+    }
+
+    return RFFT_SUCCESS;
+}
@@ -0,0 +1,179 @@
+/* ----------------------------------------------------------------------
+ * Project:      FFT Utility Functions
+ * Title:        fft_conv.h
+ * Description:  Overlap-save FIR filtering with the Q15 RFFT
+ *
+ * Target Processor: nRF54L15 FLPR (RISC-V)
+ * -------------------------------------------------------------------- */
+
+#ifndef FFT_CONV_H
+#define FFT_CONV_H
+
+#include <stdbool.h>
+#include "fft_stft.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Long FIR filter run as an overlap-save fast convolution
+ *
+ * A direct-form FIR costs num_taps multiplications per sample, which the
+ * FLPR does in software. Here every block of fft_size - num_taps + 1 new
+ * samples costs one forward and one inverse RFFT of fft_size points and
+ * one spectral multiplication, whatever the number of taps.
+ *
+ * The last fft_size samples are kept in the ring buffer of an fft_stft_t
+ * whose hop is the block size. A block transforms the whole frame,
+ * multiplies it by the spectrum of the taps, computed once by
+ * fft_conv_init(), and transforms back. The first num_taps - 1 outputs
+ * of the circular convolution wrap around and are dropped, the others
+ * are the filter output for the newest block_size samples.
+ *
+ * Both transforms use block floating point scaling, so the filter output
+ * keeps the Q15 range at any input level: with the fixed scaling of
+ * arm_rfft_q15() a 4096-point round trip alone loses 12 bits. Against a
+ * direct convolution the host test measures an SNR of at least 48 dB at
+ * 256 points, 44 dB at 1024 and 40 dB at 4096, from full scale down to
+ * 1 % of it, and asserts 45, 41 and 37 dB.
+ */
+typedef struct {
+    fft_stft_t stft;            /**< History, a block is due every block_size samples */
+    const arm_rfft_instance_q15 *rfft; /**< Prebuilt RFFT instance for fft_size */
+    q15_t *filter_spectrum;     /**< Packed spectrum of the taps, fft_size values */
+    q15_t *work;                /**< fft_size values of work buffer */
+    int32_t filter_exponent;    /**< Block exponent of filter_spectrum */
+    uint16_t fft_size;          /**< Transform length, a built-in RFFT length */
+    uint16_t num_taps;          /**< Filter length */
+    uint16_t block_size;        /**< New samples and outputs per block */
+    uint16_t log2_size;         /**< log2(fft_size) */
+} fft_conv_t;
+
+/**
+ * @brief Prepare a filter and compute the spectrum of its taps
+ *
+ * @param[out] conv             Filter state to initialize
+ * @param[in]  taps             Impulse response (Q15), num_taps values
+ * @param[in]  num_taps         Filter length, 1 to fft_size / 2
+ * @param[in]  fft_size         Transform length (RFFT_Q15_MIN_FFT_LEN to RFFT_Q15_MAX_FFT_LEN)
+ * @param[in]  ring             fft_size samples of history, owned by the caller
+ * @param[out] filter_spectrum  fft_size values for the filter spectrum,
+ *                              RFFT_Q15_ALIGN, kept until the filter is no
+ *                              longer used
+ * @param[in]  work             fft_size values of work buffer, RFFT_Q15_ALIGN
+ *
+ * @return rfft_status_t
+ *         - RFFT_SUCCESS: Operation successful
+ *         - RFFT_ERROR_NULL_POINTER: NULL pointer provided
+ *         - RFFT_ERROR_INVALID_SIZE: Invalid fft_size or num_taps
+ *
+ * @note Taps sum up to the DC gain times 32768, the output saturates
+ *       where the gain of the filter exceeds 1.
+ *
+ * @example
+ *   static q15_t ring[4096];
+ *   static q15_t spectrum[4096] RFFT_Q15_ALIGN;
+ *   static q15_t work[4096] RFFT_Q15_ALIGN;
+ *   static q15_t filtered[4096 - 1024 + 1];
+ *   static fft_conv_t conv;
+ *
+ *   fft_conv_init(&conv, taps, 1024, 4096, ring, spectrum, work);
+ *
+ *   while (read_block(block, &count)) {
+ *       for (uint32_t pos = 0; pos < count; ) {
+ *           pos += fft_conv_push(&conv, &block[pos], count - pos);
+ *           if (fft_conv_block_ready(&conv)) {
+ *               fft_conv_process(&conv, filtered);
+ *               write_block(filtered, conv.block_size);
+ *           }
+ *       }
+ *   }
+ */
+rfft_status_t fft_conv_init(
+    fft_conv_t *conv,
+    const q15_t *taps,
+    uint16_t num_taps,
+    uint16_t fft_size,
+    q15_t *ring,
+    q15_t *filter_spectrum,
+    q15_t *work
+);
+
+/**
+ * @brief Clear the history, e.g. after a gap in the stream
+ *
+ * The filter restarts from silence: the next block is due after
+ * block_size new samples.
+ *
+ * @param[in,out] conv  Initialized filter state
+ */
+void fft_conv_reset(fft_conv_t *conv);
+
+/**
+ * @brief Append input samples
+ *
+ * Stops at the sample that completes a block, see fft_stft_push().
+ *
+ * @param[in,out] conv     Initialized filter state
+ * @param[in]     samples  New samples (Q15)
+ * @param[in]     count    Number of new samples
+ *
+ * @return Number of samples consumed, less than count when a block is due
+ */
+static inline uint32_t fft_conv_push(fft_conv_t *conv, const q15_t *samples,
+                                     uint32_t count)
+{
+    return fft_stft_push(&conv->stft, samples, count);
+}
+
+/**
+ * @brief Check whether a block is due
+ *
+ * @param[in] conv  Initialized filter state
+ *
+ * @return true when fft_conv_push() consumes no more samples until
+ *         fft_conv_process() ran
+ */
+static inline bool fft_conv_block_ready(const fft_conv_t *conv)
+{
+    return fft_stft_frame_ready(&conv->stft);
+}
+
+/**
+ * @brief Filter the due block
+ *
+ * @param[in,out] conv    Filter state with a block due
+ * @param[out]    output  block_size filter outputs (Q15), oldest first
+ *
+ * @return rfft_status_t
+ *         - RFFT_SUCCESS: Operation successful
+ *         - RFFT_ERROR_NULL_POINTER: NULL pointer provided
+ *         - RFFT_ERROR_INVALID_SIZE: No block due
+ */
+rfft_status_t fft_conv_process(fft_conv_t *conv, q15_t *output);
+
+/**
+ * @brief Multiply two packed spectra bin by bin
+ *
+ * pDst[k] = pSrcA[k] * pSrcB[k] / 32768 for bins 0 to fft_size / 2, in
+ * the packed layout of arm_rfft_q15_packed(), saturated to Q15. pDst may
+ * be pSrcA or pSrcB.
+ *
+ * @param[in]  pSrcA     First packed spectrum, fft_size values
+ * @param[in]  pSrcB     Second packed spectrum, fft_size values
+ * @param[out] pDst      Product, fft_size values
+ * @param[in]  fft_size  Real transform length
+ */
+void fft_conv_spectrum_mult_q15(
+    const q15_t *pSrcA,
+    const q15_t *pSrcB,
+    q15_t *pDst,
+    uint32_t fft_size
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* FFT_CONV_H */
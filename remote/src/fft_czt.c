@@ -0,0 +1,220 @@
+/* ----------------------------------------------------------------------
+ * Project:      FFT Utility Functions
+ * Title:        fft_czt.c
+ * Description:  Chirp-Z transform: bins over any frequency range of a frame
+ *
+ * Target Processor: nRF54L15 FLPR (RISC-V)
+ * -------------------------------------------------------------------- */
+
+#include "fft_czt.h"
+#include <string.h>
+
+/* cos and sin of phase m in steps of the twiddle table, m below its length */
+static inline void czt_twiddle(uint32_t m, q31_t *c, q31_t *s)
+{
+    if (m <= RFFT_TWIDDLE_TABLE_LEN / 2U) {
+        *c = RFFT_TWIDDLE_COS(RFFT_TWIDDLE_TABLE, m);
+        *s = RFFT_TWIDDLE_SIN(RFFT_TWIDDLE_TABLE, m);
+    } else {
+        *c = RFFT_TWIDDLE_COS(RFFT_TWIDDLE_TABLE, RFFT_TWIDDLE_TABLE_LEN - m);
+        *s = -RFFT_TWIDDLE_SIN(RFFT_TWIDDLE_TABLE, RFFT_TWIDDLE_TABLE_LEN - m);
+    }
+}
+
+static q15_t czt_sat(q31_t v)
+{
+    return (q15_t) ((v > 32767) ? 32767 : ((v < -32768) ? -32768 : v));
+}
+
+static uint32_t czt_log2(uint32_t n)
+{
+    uint32_t bits = 0;
+
+    while ((1UL << bits) < n) {
+        bits++;
+    }
+
+    return bits;
+}
+
+/*
+ * cos and sin of a phase in 2^-32 of a turn, linear between the table
+ * entries. At the table lengths of the build the error of the line stays
+ * well below an LSB.
+ */
+static void czt_cis(uint32_t phase, q31_t *c, q31_t *s)
+{
+    const uint32_t bits = czt_log2(RFFT_TWIDDLE_TABLE_LEN);
+    const uint32_t m = phase >> (32U - bits);
+    const q31_t frac = (q31_t) ((phase << bits) >> 17);
+    q31_t c0;
+    q31_t s0;
+    q31_t c1;
+    q31_t s1;
+
+    czt_twiddle(m, &c0, &s0);
+    czt_twiddle((m + 1U) & (RFFT_TWIDDLE_TABLE_LEN - 1U), &c1, &s1);
+    *c = c0 + (((c1 - c0) * frac + (1 << 14)) >> 15);
+    *s = s0 + (((s1 - s0) * frac + (1 << 14)) >> 15);
+}
+
+/* Phase of the chirp at m, step m² / 2 wrapped to a turn */
+static uint32_t czt_chirp(uint32_t step, uint32_t m)
+{
+    return (uint32_t) (((uint64_t) step * m * m) >> 1);
+}
+
+/**
+ * @brief Prepare a chirp-Z transform and compute the spectrum of its chirp
+ */
+rfft_status_t fft_czt_init(
+    fft_czt_t *czt,
+    uint16_t frame_len,
+    uint16_t num_bins,
+    uint32_t start,
+    uint32_t step,
+    uint16_t fft_size,
+    q15_t *pre,
+    q15_t *post,
+    q15_t *filter,
+    q15_t *buffer
+)
+{
+    const arm_rfft_instance_q15 *rfft;
+    q31_t c;
+    q31_t s;
+
+    if (czt == NULL || pre == NULL || post == NULL || filter == NULL || buffer == NULL) {
+        return RFFT_ERROR_NULL_POINTER;
+    }
+
+    /* The CFFTs of the build are those inside its RFFTs */
+    rfft = rfft_q15_get_instance(2U * (uint32_t) fft_size);
+    if (rfft == NULL || frame_len == 0 || num_bins == 0 ||
+        (uint32_t) frame_len + num_bins - 1U > fft_size) {
+        return RFFT_ERROR_INVALID_SIZE;
+    }
+
+    /* May come before any RFFT instance, which fills the table otherwise */
+    rfft_q15_twiddles_init();
+
+    czt->cfft = rfft->pCfft;
+    czt->pre = pre;
+    czt->post = post;
+    czt->filter = filter;
+    czt->buffer = buffer;
+    czt->exponent = 0;
+    czt->frame_len = frame_len;
+    czt->num_bins = num_bins;
+    czt->fft_size = fft_size;
+    czt->log2_size = (uint16_t) czt_log2(fft_size);
+
+    /* e^-j(start n + step n² / 2) */
+    for (uint32_t n = 0; n < frame_len; n++) {
+        czt_cis(start * n + czt_chirp(step, n), &c, &s);
+        pre[2U * n] = czt_sat(c);
+        pre[2U * n + 1U] = czt_sat(-s);
+    }
+
+    /* e^-j step k² / 2 */
+    for (uint32_t k = 0; k < num_bins; k++) {
+        czt_cis(czt_chirp(step, k), &c, &s);
+        post[2U * k] = czt_sat(c);
+        post[2U * k + 1U] = czt_sat(-s);
+    }
+
+    /*
+     * e^j step m² / 2 at lags 0 to num_bins - 1, and at the negative
+     * lags down to 1 - frame_len wrapped to the end. They never meet as
+     * fft_size >= frame_len + num_bins - 1, so the circular convolution
+     * is the linear one at the bins.
+     */
+    memset(filter, 0, 4U * (uint32_t) fft_size);
+    for (uint32_t m = 0; m < num_bins; m++) {
+        czt_cis(czt_chirp(step, m), &c, &s);
+        filter[2U * m] = czt_sat(c);
+        filter[2U * m + 1U] = czt_sat(s);
+    }
+    for (uint32_t m = 1; m < frame_len; m++) {
+        czt_cis(czt_chirp(step, m), &c, &s);
+        filter[2U * (fft_size - m)] = czt_sat(c);
+        filter[2U * (fft_size - m) + 1U] = czt_sat(s);
+    }
+    czt->filter_exponent = arm_cfft_q15_bfp(czt->cfft, filter, 0, 1);
+
+    return RFFT_SUCCESS;
+}
+
+/**
+ * @brief Transform a frame into its bins
+ */
+int32_t fft_czt_transform(fft_czt_t *czt, const q15_t *frame)
+{
+    q15_t *buf = czt->buffer;
+    int32_t exponent;
+
+    /* Pre-chirp, zero padded to fft_size */
+    for (uint32_t n = 0; n < czt->frame_len; n++) {
+        q31_t x = frame[n];
+
+        buf[2U * n] = czt_sat((x * czt->pre[2U * n] + (1 << 14)) >> 15);
+        buf[2U * n + 1U] = czt_sat((x * czt->pre[2U * n + 1U] + (1 << 14)) >> 15);
+    }
+    memset(&buf[2U * czt->frame_len], 0,
+           4U * ((uint32_t) czt->fft_size - czt->frame_len));
+
+    exponent = arm_cfft_q15_bfp(czt->cfft, buf, 0, 1);
+
+    /*
+     * Convolve with the chirp; halving both products keeps the sums in
+     * 32 bits. Rounded, as a bias of every point would sum to a spike at
+     * bin 0 in the inverse.
+     */
+    for (uint32_t i = 0; i < czt->fft_size; i++) {
+        q31_t ar = buf[2U * i];
+        q31_t ai = buf[2U * i + 1U];
+        q31_t br = czt->filter[2U * i];
+        q31_t bi = czt->filter[2U * i + 1U];
+
+        buf[2U * i] = czt_sat((((ar * br) >> 1) - ((ai * bi) >> 1) + (1 << 14)) >> 15);
+        buf[2U * i + 1U] = czt_sat((((ar * bi) >> 1) + ((ai * br) >> 1) + (1 << 14)) >> 15);
+    }
+
+    exponent += arm_cfft_q15_bfp(czt->cfft, buf, 1, 1);
+
+    /* Post-chirp, in place at the first num_bins points */
+    for (uint32_t k = 0; k < czt->num_bins; k++) {
+        q31_t yr = buf[2U * k];
+        q31_t yi = buf[2U * k + 1U];
+        q31_t pr = czt->post[2U * k];
+        q31_t pi = czt->post[2U * k + 1U];
+
+        buf[2U * k] = czt_sat((yr * pr - yi * pi + (1 << 14)) >> 15);
+        buf[2U * k + 1U] = czt_sat((yr * pi + yi * pr + (1 << 14)) >> 15);
+    }
+
+    /* The product dropped one bit, the inverse misses its 1 / fft_size */
+    czt->exponent = exponent + czt->filter_exponent + 1 - (int32_t) czt->log2_size;
+
+    return czt->exponent;
+}
+
+/**
+ * @brief Transform a frame and report the magnitude² of its bins
+ */
+rfft_status_t fft_czt_mag_sq(fft_czt_t *czt, const q15_t *frame, rfft_q15_bin_fn fn, void *user)
+{
+    if (czt == NULL || frame == NULL || fn == NULL) {
+        return RFFT_ERROR_NULL_POINTER;
+    }
+
+    fft_czt_transform(czt, frame);
+
+    for (uint32_t k = 0; k < czt->num_bins; k++) {
+        const q15_t *bin = &czt->buffer[2U * k];
+
+        fn(k, (uint32_t) ((q31_t) bin[0] * bin[0]) + (uint32_t) ((q31_t) bin[1] * bin[1]), user);
+    }
+
+    return RFFT_SUCCESS;
+}
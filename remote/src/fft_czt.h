@@ -0,0 +1,148 @@
+/* ----------------------------------------------------------------------
+ * Project:      FFT Utility Functions
+ * Title:        fft_czt.h
+ * Description:  Chirp-Z transform: bins over any frequency range of a frame
+ *
+ * Target Processor: nRF54L15 FLPR (RISC-V)
+ * -------------------------------------------------------------------- */
+
+#ifndef FFT_CZT_H
+#define FFT_CZT_H
+
+#include "rfft_q15_simplified.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief num_bins bins from start in steps of step, of one frame
+ *
+ * Bin k is the DFT of the frame at the frequency start + k * step,
+ *
+ *   X[k] = sum over n of x[n] e^(-j 2 pi (start + k step) n),
+ *
+ * for any start and step, not only multiples of fs / frame_len: a band
+ * of interest at a resolution finer than the frame gives on its own.
+ * With nk = (n² + k² - (k - n)²) / 2 (Bluestein) the sum is a
+ * convolution of the frame, turned by the pre-chirp
+ * e^(-j 2 pi (start n + step n² / 2)), with the chirp
+ * e^(j 2 pi step m² / 2), followed by the post-chirp
+ * e^(-j 2 pi step k² / 2). The convolution takes a forward and an
+ * inverse fft_size-point arm_cfft_q15_bfp(), fft_size at least
+ * frame_len + num_bins - 1; the spectrum of the chirp is computed once
+ * by fft_czt_init().
+ *
+ * Unlike the zoom FFT, no decimation filter is needed, and the band can
+ * be anywhere, at any width. Both transforms use block floating point
+ * scaling, so weak bins keep their bits.
+ *
+ * The cos and sin of every chirp phase are interpolated in the shared
+ * twiddle table; the frequencies are fractions of the sample rate in
+ * 2^-32, see FFT_CZT_FREQ().
+ */
+typedef struct {
+    const arm_cfft_instance_q15 *cfft; /**< fft_size-point CFFT */
+    q15_t *pre;             /**< 2 * frame_len: pre-chirp of every sample, complex */
+    q15_t *post;            /**< 2 * num_bins: post-chirp of every bin, complex */
+    q15_t *filter;          /**< 2 * fft_size: spectrum of the chirp */
+    q15_t *buffer;          /**< 2 * fft_size: work buffer, then the bins */
+    int32_t filter_exponent; /**< Block exponent of filter */
+    int32_t exponent;       /**< Block exponent of the bins of the last frame */
+    uint16_t frame_len;     /**< Samples per frame */
+    uint16_t num_bins;      /**< Bins per frame */
+    uint16_t fft_size;      /**< Points of the CFFT */
+    uint16_t log2_size;     /**< log2(fft_size) */
+} fft_czt_t;
+
+/** Frequency as a fraction of the sample rate in 2^-32, from Hz and the sample rate in Hz */
+#define FFT_CZT_FREQ(hz, sample_rate_hz) \
+    ((uint32_t) ((((uint64_t) (hz) << 32) + (sample_rate_hz) / 2U) / (sample_rate_hz)))
+
+/**
+ * @brief Prepare a chirp-Z transform and compute the spectrum of its chirp
+ *
+ * @param[out] czt        Transform state
+ * @param[in]  frame_len  Samples per frame (>= 1)
+ * @param[in]  num_bins   Bins per frame (>= 1)
+ * @param[in]  start      Frequency of bin 0, FFT_CZT_FREQ()
+ * @param[in]  step       Frequency from one bin to the next, FFT_CZT_FREQ()
+ * @param[in]  fft_size   Points of the CFFT, half an RFFT size of the build
+ *                        and at least frame_len + num_bins - 1
+ * @param[out] pre        2 * frame_len values, owned by the caller
+ * @param[out] post       2 * num_bins values, owned by the caller
+ * @param[out] filter     2 * fft_size values aligned to RFFT_Q15_ALIGN,
+ *                        owned by the caller
+ * @param[in]  buffer     2 * fft_size values aligned to RFFT_Q15_ALIGN,
+ *                        owned by the caller
+ *
+ * @return rfft_status_t
+ *         - RFFT_SUCCESS: Operation successful
+ *         - RFFT_ERROR_NULL_POINTER: NULL pointer provided
+ *         - RFFT_ERROR_INVALID_SIZE: Invalid frame_len, num_bins or fft_size
+ *
+ * @example
+ *   // 256 bins of 0.25 Hz from 2950 Hz, of 1024 samples at 16 kHz
+ *   static q15_t pre[2 * 1024], post[2 * 256];
+ *   static q15_t filter[2 * 2048] RFFT_Q15_ALIGN;
+ *   static q15_t buffer[2 * 2048] RFFT_Q15_ALIGN;
+ *   static fft_czt_t czt;
+ *
+ *   fft_czt_init(&czt, 1024, 256, FFT_CZT_FREQ(2950, 16000),
+ *                FFT_CZT_FREQ(1, 64000), 2048, pre, post, filter, buffer);
+ *
+ *   while (read_frame(frame)) {
+ *       fft_czt_mag_sq(&czt, frame, on_bin, NULL);
+ *   }
+ */
+rfft_status_t fft_czt_init(
+    fft_czt_t *czt,
+    uint16_t frame_len,
+    uint16_t num_bins,
+    uint32_t start,
+    uint32_t step,
+    uint16_t fft_size,
+    q15_t *pre,
+    q15_t *post,
+    q15_t *filter,
+    q15_t *buffer
+);
+
+/**
+ * @brief Transform a frame into its bins
+ *
+ * Leaves bin k, real and imaginary part, in czt->buffer[2 * k] and
+ * czt->buffer[2 * k + 1].
+ *
+ * @param[in,out] czt    Initialized transform state
+ * @param[in]     frame  frame_len samples (Q15), windowed by the caller if needed
+ *
+ * @return Block exponent e, also kept in czt->exponent: X[k] is the bin
+ *         times 2^e. An n-point arm_rfft_q15() outputs X[k] / n.
+ */
+int32_t fft_czt_transform(fft_czt_t *czt, const q15_t *frame);
+
+/**
+ * @brief Transform a frame and report the magnitude² of its bins
+ *
+ * Bins come in ascending k, so in ascending frequency for a step below
+ * half the sample rate, and can feed spectral_topk directly. The
+ * magnitude² is of the bins of fft_czt_transform(), whose exponent is
+ * left in czt->exponent; compare frames by it.
+ *
+ * @param[in,out] czt    Initialized transform state
+ * @param[in]     frame  frame_len samples (Q15)
+ * @param[in]     fn     Called once per bin, bins 0 to num_bins - 1
+ * @param[in]     user   Passed through to fn
+ *
+ * @return rfft_status_t
+ *         - RFFT_SUCCESS: Operation successful
+ *         - RFFT_ERROR_NULL_POINTER: NULL pointer provided
+ */
+rfft_status_t fft_czt_mag_sq(fft_czt_t *czt, const q15_t *frame, rfft_q15_bin_fn fn, void *user);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* FFT_CZT_H */
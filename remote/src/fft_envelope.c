@@ -0,0 +1,142 @@
+/* ----------------------------------------------------------------------
+ * Project:      FFT Utility Functions
+ * Title:        fft_envelope.c
+ * Description:  Envelope spectrum of a band, for bearing diagnostics
+ *
+ * Target Processor: nRF54L15 FLPR (RISC-V)
+ * -------------------------------------------------------------------- */
+
+#include "fft_envelope.h"
+#include <string.h>
+
+/* floor(sqrt(v)), one result bit per step as isqrt64() of fft_utils.c */
+static uint32_t envelope_isqrt(uint32_t v)
+{
+    uint32_t root = 0;
+    uint32_t bit = 1UL << 30;
+
+    while (bit > v) {
+        bit >>= 2;
+    }
+
+    while (bit != 0) {
+        if (v >= root + bit) {
+            v -= root + bit;
+            root = (root >> 1) + bit;
+        } else {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+
+    return root;
+}
+
+/**
+ * @brief Set up the whole chain for one frame length, band and decimation
+ */
+rfft_status_t fft_envelope_init(
+    fft_envelope_t *env,
+    uint16_t frame_len,
+    uint16_t decimation,
+    uint16_t first_bin,
+    uint16_t last_bin
+)
+{
+    const arm_rfft_instance_q15 *half;
+    uint32_t fft_size;
+
+    if (env == NULL) {
+        return RFFT_ERROR_NULL_POINTER;
+    }
+
+    if (decimation < 2U || (decimation & (decimation - 1U)) != 0) {
+        return RFFT_ERROR_INVALID_SIZE;
+    }
+
+    env->rfft = rfft_q15_get_instance(frame_len);
+    if (env->rfft == NULL) {
+        return RFFT_ERROR_INVALID_SIZE;
+    }
+
+    /* The CFFTs of the build are those inside its RFFTs */
+    fft_size = (uint32_t) frame_len / decimation;
+    half = rfft_q15_get_instance(2U * fft_size);
+    if (half == NULL) {
+        return RFFT_ERROR_INVALID_SIZE;
+    }
+
+    /* DC and Nyquist share a word of the packed spectrum, the band has neither */
+    if (first_bin == 0 || first_bin > last_bin || last_bin >= frame_len / 2U ||
+        (uint32_t) (last_bin - first_bin) >= fft_size) {
+        return RFFT_ERROR_INVALID_SIZE;
+    }
+
+    env->cfft = half->pCfft;
+    env->frame_len = frame_len;
+    env->fft_size = (uint16_t) fft_size;
+    env->first_bin = first_bin;
+    env->last_bin = last_bin;
+    env->exponent = 0;
+
+    return RFFT_SUCCESS;
+}
+
+/**
+ * @brief Run the chain on a frame and report the envelope spectrum
+ */
+void fft_envelope_mag_sq(
+    fft_envelope_t *env,
+    q15_t *buffer,
+    rfft_q15_bin_fn fn,
+    void *user
+)
+{
+    uint32_t n = env->fft_size;
+    uint32_t width = (uint32_t) env->last_bin - env->first_bin + 1U;
+    const q15_t *band = &buffer[2U * env->first_bin];
+    uint32_t sum = 0;
+    q15_t mean;
+    int32_t exponent;
+
+    exponent = arm_rfft_q15_packed_bfp(env->rfft, buffer);
+
+    /*
+     * Shifted down to bin 0, the band bins only move towards the start,
+     * so ascending order reads each before it is overwritten.
+     */
+    for (uint32_t k = 0; k < width; k++) {
+        buffer[2U * k] = band[2U * k];
+        buffer[2U * k + 1U] = band[2U * k + 1U];
+    }
+    memset(&buffer[2U * width], 0, 2U * (n - width) * sizeof(q15_t));
+
+    exponent += arm_cfft_q15_bfp(env->cfft, buffer, 1, 1);
+
+    /* |z| up to sqrt(2) of full scale, halved into Q15 */
+    for (uint32_t i = 0; i < n; i++) {
+        q31_t re = buffer[2U * i];
+        q31_t im = buffer[2U * i + 1U];
+        uint32_t mag = envelope_isqrt((uint32_t) (re * re) + (uint32_t) (im * im)) >> 1;
+
+        buffer[2U * i] = (q15_t) mag;
+        sum += mag;
+    }
+
+    /* Without its mean the envelope keeps the bits of the CFFT for its lines */
+    mean = (q15_t) ((sum + n / 2U) >> __builtin_ctz(n));
+    for (uint32_t i = 0; i < n; i++) {
+        buffer[2U * i] = (q15_t) (buffer[2U * i] - mean);
+        buffer[2U * i + 1U] = 0;
+    }
+
+    exponent += arm_cfft_q15_bfp(env->cfft, buffer, 0, 1);
+    env->exponent = exponent + 1;
+
+    for (uint32_t k = 0; k <= n / 2U; k++) {
+        q31_t re = buffer[2U * k];
+        q31_t im = buffer[2U * k + 1U];
+
+        fn(k, (uint32_t) (re * re) + (uint32_t) (im * im), user);
+    }
+}
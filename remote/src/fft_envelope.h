@@ -0,0 +1,121 @@
+/* ----------------------------------------------------------------------
+ * Project:      FFT Utility Functions
+ * Title:        fft_envelope.h
+ * Description:  Envelope spectrum of a band, for bearing diagnostics
+ *
+ * Target Processor: nRF54L15 FLPR (RISC-V)
+ * -------------------------------------------------------------------- */
+
+#ifndef FFT_ENVELOPE_H
+#define FFT_ENVELOPE_H
+
+#include "rfft_q15_simplified.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Envelope (demodulation) spectrum of one band of a frame
+ *
+ * A bearing fault strikes a structural resonance at its fault rate; the
+ * rate shows up as the spacing of sidebands around the resonance, and as
+ * lines of its own in the spectrum of the envelope of that band. Each
+ * frame goes through the whole chain in its own buffer:
+ *
+ * 1. arm_rfft_q15_packed_bfp() of the frame_len samples.
+ * 2. Band-pass and Hilbert transform in one: bins first_bin to last_bin
+ *    are moved down to the start of an fft_size-point complex buffer,
+ *    every other bin, the negative frequencies included, is zero.
+ * 3. arm_cfft_q15_bfp() inverse of fft_size points gives the analytic
+ *    signal of the band, already decimated by frame_len / fft_size: the
+ *    shift down by first_bin only turns its phase, and the inverse of
+ *    fewer points samples it at every decimation-th sample.
+ * 4. Magnitude of each sample, the envelope, less its mean.
+ * 5. arm_cfft_q15_bfp() forward of fft_size points of the envelope.
+ *
+ * Bin k of the envelope spectrum is at k * fs / frame_len, the spacing
+ * of the frame spectrum, up to fs / (2 * decimation). Envelope lines
+ * above that alias. Every stage works in place on the values of the
+ * stage before, so the chain needs no buffer beyond the frame and copies
+ * nothing between stages. The fft_size-point CFFT is the one inside the
+ * RFFT of 2 * fft_size points, which must be built in.
+ */
+typedef struct {
+    const arm_rfft_instance_q15 *rfft; /**< Prebuilt RFFT instance for frame_len */
+    const arm_cfft_instance_q15 *cfft; /**< fft_size-point CFFT of the envelope */
+    uint16_t frame_len;     /**< Samples per frame */
+    uint16_t fft_size;      /**< frame_len / decimation, points of the envelope */
+    uint16_t first_bin;     /**< Lowest frame bin of the band */
+    uint16_t last_bin;      /**< Highest frame bin of the band */
+    int32_t exponent;       /**< Block exponent of the last envelope spectrum */
+} fft_envelope_t;
+
+/** Frame bin of a frequency, from Hz, the frame length and the sample rate in Hz */
+#define FFT_ENVELOPE_BIN(hz, frame_len, sample_rate_hz) \
+    ((uint16_t) (((uint64_t) (hz) * (frame_len) + (sample_rate_hz) / 2U) / (sample_rate_hz)))
+
+/**
+ * @brief Set up the whole chain for one frame length, band and decimation
+ *
+ * @param[out] env         Envelope state
+ * @param[in]  frame_len   Samples per frame, a built-in RFFT length
+ * @param[in]  decimation  Power of two, at least 2, that leaves an
+ *                         fft_size = frame_len / decimation of at least 16
+ * @param[in]  first_bin   Lowest frame bin of the band, at least 1
+ * @param[in]  last_bin    Highest frame bin of the band, below
+ *                         frame_len / 2, at most fft_size - 1 above first_bin
+ *
+ * @return rfft_status_t
+ *         - RFFT_SUCCESS: Operation successful
+ *         - RFFT_ERROR_NULL_POINTER: NULL pointer provided
+ *         - RFFT_ERROR_INVALID_SIZE: frame_len or fft_size not built in,
+ *           invalid decimation, or a band that does not fit
+ *
+ * @example
+ *   static q15_t frame[4096] RFFT_Q15_ALIGN;
+ *   static fft_envelope_t env;
+ *
+ *   // 2 to 4 kHz at 16 kHz, envelope up to 2 kHz in 3.9 Hz bins
+ *   fft_envelope_init(&env, 4096, 4, FFT_ENVELOPE_BIN(2000, 4096, 16000),
+ *                     FFT_ENVELOPE_BIN(4000, 4096, 16000));
+ *
+ *   while (read_frame(frame)) {
+ *       fft_envelope_mag_sq(&env, frame, on_bin, NULL);
+ *   }
+ */
+rfft_status_t fft_envelope_init(
+    fft_envelope_t *env,
+    uint16_t frame_len,
+    uint16_t decimation,
+    uint16_t first_bin,
+    uint16_t last_bin
+);
+
+/**
+ * @brief Run the chain on a frame and report the envelope spectrum
+ *
+ * The magnitude² is of the last CFFT output, in block floating point:
+ * the unscaled fft_size-point DFT of the envelope is the output times
+ * 2^exponent, with the envelope that of the unscaled inverse DFT of the
+ * unscaled band bins. Bins of one frame compare directly, those of
+ * different frames after scaling by 2^exponent.
+ *
+ * @param[in,out] env     Initialized envelope state
+ * @param[in,out] buffer  frame_len samples aligned to RFFT_Q15_ALIGN,
+ *                        windowed if at all, overwritten
+ * @param[in]     fn      Called once per bin, bins 0 to fft_size / 2
+ * @param[in]     user    Passed through to fn
+ */
+void fft_envelope_mag_sq(
+    fft_envelope_t *env,
+    q15_t *buffer,
+    rfft_q15_bin_fn fn,
+    void *user
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* FFT_ENVELOPE_H */
@@ -0,0 +1,231 @@
+/* ----------------------------------------------------------------------
+ * Project:      FFT Utility Functions
+ * Title:        fft_order.c
+ * Description:  Order tracking: angle-domain resampling from tachometer pulses
+ *
+ * Target Processor: nRF54L15 FLPR (RISC-V)
+ * -------------------------------------------------------------------- */
+
+#include "fft_order.h"
+#include "fft_zoom.h"
+#include <string.h>
+
+static q15_t order_sat(q31_t v)
+{
+    return (q15_t) ((v > 32767) ? 32767 : ((v < -32768) ? -32768 : v));
+}
+
+/**
+ * @brief Polyphase interpolator taps
+ */
+rfft_status_t fft_order_design(
+    q15_t *taps,
+    uint16_t num_phases,
+    uint16_t taps_per_phase
+)
+{
+    uint32_t num_taps = (uint32_t) num_phases * taps_per_phase;
+    rfft_status_t status;
+
+    if (taps_per_phase == 0 || num_phases > 256U || num_taps > UINT16_MAX) {
+        return RFFT_ERROR_INVALID_SIZE;
+    }
+
+    /* Cut off at 1 / (2 num_phases) of the upsampled rate, the input Nyquist */
+    status = fft_zoom_design_lowpass(taps, (uint16_t) num_taps, num_phases);
+    if (status != RFFT_SUCCESS) {
+        return status;
+    }
+
+    /* Each phase sees one input sample in num_phases, so gets num_phases the gain */
+    for (uint32_t j = 0; j < num_taps; j++) {
+        taps[j] = order_sat((q31_t) taps[j] * num_phases);
+    }
+
+    return RFFT_SUCCESS;
+}
+
+/**
+ * @brief Prepare a resampler
+ */
+rfft_status_t fft_order_init(
+    fft_order_t *order,
+    const q15_t *taps,
+    uint16_t num_phases,
+    uint16_t taps_per_phase,
+    uint16_t samples_per_rev,
+    uint16_t frame_len,
+    q15_t *history,
+    uint16_t history_len,
+    q15_t *frame,
+    uint32_t position
+)
+{
+    uint32_t num_taps = (uint32_t) num_phases * taps_per_phase;
+
+    if (order == NULL || taps == NULL || history == NULL || frame == NULL) {
+        return RFFT_ERROR_NULL_POINTER;
+    }
+
+    if (num_phases == 0 || num_phases > 256U || (num_phases & (num_phases - 1U)) != 0 ||
+        taps_per_phase == 0) {
+        return RFFT_ERROR_INVALID_SIZE;
+    }
+
+    if (history_len <= taps_per_phase || (history_len & (history_len - 1U)) != 0) {
+        return RFFT_ERROR_INVALID_SIZE;
+    }
+
+    if (samples_per_rev == 0 || frame_len == 0 || frame_len % samples_per_rev != 0) {
+        return RFFT_ERROR_INVALID_SIZE;
+    }
+
+    order->taps = taps;
+    order->history = history;
+    order->frame = frame;
+    order->history_len = history_len;
+    order->num_phases = num_phases;
+    order->taps_per_phase = taps_per_phase;
+    order->samples_per_rev = samples_per_rev;
+    order->frame_len = frame_len;
+    order->phase_shift = (uint8_t) (8U - (uint32_t) __builtin_ctz(num_phases));
+
+    /*
+     * Phase p after input n is the low-pass output at n + p / num_phases
+     * less its delay of (num_taps - 1) / 2 upsampled steps. Half a phase
+     * step more rounds each output to the nearest phase.
+     */
+    order->delay = (((num_taps - 1U) << 7) / num_phases) + ((1UL << order->phase_shift) >> 1);
+    order->dropped = 0;
+    order->num_pulses = 0;
+
+    fft_order_reset(order, position);
+
+    return RFFT_SUCCESS;
+}
+
+/**
+ * @brief Start over at an input position, e.g. after a gap in the stream
+ */
+void fft_order_reset(fft_order_t *order, uint32_t position)
+{
+    uint8_t kept = 0;
+
+    memset(order->history, 0, 2U * order->history_len * sizeof(q15_t));
+    order->written = position;
+    order->filled = 0;
+    order->collected = 0;
+
+    for (uint8_t i = 0; i < order->num_pulses; i++) {
+        if ((int32_t) (order->pulse[i] - (position << 8)) >= 0) {
+            order->pulse[kept++] = order->pulse[i];
+        }
+    }
+    order->num_pulses = kept;
+}
+
+/* Forget the oldest pulse, the start of the oldest revolution */
+static void order_pop(fft_order_t *order)
+{
+    order->num_pulses--;
+    memmove(&order->pulse[0], &order->pulse[1], order->num_pulses * sizeof(uint32_t));
+}
+
+/**
+ * @brief Add a tachometer pulse, one per revolution
+ */
+void fft_order_pulse(fft_order_t *order, uint32_t position)
+{
+    if (order->num_pulses == FFT_ORDER_MAX_PULSES) {
+        order_pop(order);
+        order->dropped++;
+    }
+
+    order->pulse[order->num_pulses++] = position;
+}
+
+/* Interpolate the revolution between the two oldest pulses into the frame */
+static void order_resample(fft_order_t *order, uint32_t start, uint32_t len)
+{
+    const uint32_t mask = order->history_len - 1U;
+    const uint32_t phases = order->num_phases;
+    const uint32_t taps = order->taps_per_phase;
+    /* One division per revolution, the step between outputs in Q16 samples */
+    uint32_t step = (len << 8) / order->samples_per_rev;
+    uint32_t acc = 0;
+    q15_t *out = &order->frame[order->collected];
+
+    start += order->delay;
+
+    for (uint32_t i = 0; i < order->samples_per_rev; i++, acc += step) {
+        uint32_t pos = start + (acc >> 8);
+        uint32_t p = (pos & 0xFFU) >> order->phase_shift;
+        const q15_t *x = &order->history[((pos >> 8) - taps + 1U) & mask];
+        const q15_t *h = &order->taps[p + (taps - 1U) * phases];
+        q31_t sum = 0;
+
+        /* x[n - j] * h[p + j phases], the window oldest first */
+        for (uint32_t j = 0; j < taps; j++, h -= phases) {
+            sum += (q31_t) x[j] * *h;
+        }
+
+        out[i] = order_sat((sum + (1L << 14)) >> 15);
+    }
+
+    order->collected = (uint16_t) (order->collected + order->samples_per_rev);
+}
+
+/* Resample or drop every revolution the input has passed, until a frame is due */
+static void order_advance(fft_order_t *order)
+{
+    const uint32_t taps = order->taps_per_phase;
+
+    while (order->num_pulses >= 2U && !fft_order_frame_ready(order)) {
+        uint32_t a = order->pulse[0];
+        uint32_t b = order->pulse[1];
+        int32_t len = (int32_t) (b - a);
+        /* How far the newest sample is past each pulse, delays included */
+        int32_t past_end = (int32_t) ((order->written << 8) - (b + order->delay));
+        int32_t past_start = (int32_t) ((order->written << 8) - (a + order->delay));
+
+        if (len > 0 && past_end < 0) {
+            return;
+        }
+
+        if (len > 0 && past_start >= 0 &&
+            (uint32_t) past_start + ((taps - 1U) << 8) <= ((uint32_t) order->filled << 8)) {
+            order_resample(order, a, (uint32_t) len);
+        } else {
+            order->dropped++;
+        }
+
+        order_pop(order);
+    }
+}
+
+/**
+ * @brief Take new input samples and resample the revolutions they complete
+ */
+uint32_t fft_order_push(fft_order_t *order, const q15_t *samples, uint32_t count)
+{
+    const uint32_t mask = order->history_len - 1U;
+    uint32_t n = 0;
+
+    order_advance(order);
+
+    while (n < count && !fft_order_frame_ready(order)) {
+        uint32_t i = order->written & mask;
+        q15_t x = samples[n++];
+
+        order->history[i] = x;
+        order->history[i + order->history_len] = x;
+        order->written++;
+        if (order->filled < order->history_len) {
+            order->filled++;
+        }
+
+        order_advance(order);
+    }
+
+    return n;
+}
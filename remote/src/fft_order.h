@@ -0,0 +1,198 @@
+/* ----------------------------------------------------------------------
+ * Project:      FFT Utility Functions
+ * Title:        fft_order.h
+ * Description:  Order tracking: angle-domain resampling from tachometer pulses
+ *
+ * Target Processor: nRF54L15 FLPR (RISC-V)
+ * -------------------------------------------------------------------- */
+
+#ifndef FFT_ORDER_H
+#define FFT_ORDER_H
+
+#include <stdbool.h>
+#include "rfft_q15_simplified.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Tachometer pulses an fft_order_t holds before the revolutions they end are resampled */
+#define FFT_ORDER_MAX_PULSES  8U
+
+/**
+ * @brief Resampler from a fixed sample rate to a fixed number of samples per revolution
+ *
+ * At a varying shaft speed a tone locked to the shaft, a gear mesh or a
+ * bearing order, sweeps across the bins of a fixed-rate FFT. Resampled at
+ * samples_per_rev samples per revolution, between one tachometer pulse
+ * per revolution and the next, it stays in one bin: bin k of an RFFT of
+ * frame_len resampled samples is order k * samples_per_rev / frame_len.
+ *
+ * Pulses are positions in the input stream in Q8 samples, modulo 2^32,
+ * counted from the same origin as fft_order_reset(). Once both pulses of
+ * a revolution are known and the input has reached the later one, the
+ * samples_per_rev outputs spread evenly between them are interpolated
+ * from the history, so a revolution must fit into it with the filter.
+ *
+ * The interpolator is polyphase: num_phases sets of taps_per_phase taps
+ * of one low-pass, each for a delay of a 1 / num_phases sample step. An
+ * output costs one dot product of taps_per_phase Q15 taps, the phase
+ * nearest to its position, at a timing error of at most half a step.
+ * The low-pass stops at the input Nyquist frequency; it does not limit
+ * the orders to the Nyquist order samples_per_rev / 2, which the input
+ * must not exceed at the highest speed.
+ */
+typedef struct {
+    const q15_t *taps;      /**< num_phases * taps_per_phase (Q15), owned by the caller */
+    q15_t *history;         /**< 2 * history_len: the newest input samples twice */
+    q15_t *frame;           /**< frame_len resampled samples */
+    uint32_t pulse[FFT_ORDER_MAX_PULSES]; /**< Pending pulses, Q8 positions, oldest first */
+    uint32_t written;       /**< Input position of the next sample */
+    uint32_t delay;         /**< Delay of the low-pass in Q8 samples */
+    uint32_t dropped;       /**< Revolutions lost, too long, out of order or overwritten */
+    uint16_t history_len;   /**< Input samples kept, a power of two */
+    uint16_t num_phases;    /**< Phases of the interpolator, a power of two up to 256 */
+    uint16_t taps_per_phase; /**< Taps of one phase */
+    uint16_t samples_per_rev; /**< Outputs per revolution */
+    uint16_t frame_len;     /**< Outputs per frame, whole revolutions */
+    uint16_t collected;     /**< Outputs in frame */
+    uint16_t filled;        /**< Samples of history since the last reset, up to history_len */
+    uint8_t num_pulses;     /**< Entries in pulse */
+    uint8_t phase_shift;    /**< 8 - log2(num_phases), Q8 fraction to phase */
+} fft_order_t;
+
+/**
+ * @brief Polyphase interpolator taps
+ *
+ * The windowed-sinc low-pass of fft_zoom_design_lowpass() for an
+ * upsampling by num_phases, with a gain of num_phases, in the order its
+ * taps are designed in: tap j of phase p is taps[p + j * num_phases].
+ * Runs once at setup. 8 taps per phase leave about the outer 1/8 of the
+ * input band in the transition.
+ *
+ * @param[out] taps            num_phases * taps_per_phase coefficients (Q15)
+ * @param[in]  num_phases      Power of two, 1 to 256
+ * @param[in]  taps_per_phase  Taps of each phase (>= 1)
+ *
+ * @return rfft_status_t, as for fft_zoom_design_lowpass()
+ */
+rfft_status_t fft_order_design(
+    q15_t *taps,
+    uint16_t num_phases,
+    uint16_t taps_per_phase
+);
+
+/**
+ * @brief Prepare a resampler
+ *
+ * @param[out] order            Resampler state
+ * @param[in]  taps             Interpolator from fft_order_design(), owned by the caller
+ * @param[in]  num_phases       Power of two, 1 to 256, as designed
+ * @param[in]  taps_per_phase   Taps of each phase, as designed
+ * @param[in]  samples_per_rev  Outputs per revolution (>= 1)
+ * @param[in]  frame_len        Outputs per frame, a multiple of samples_per_rev
+ * @param[in]  history          2 * history_len samples, owned by the caller
+ * @param[in]  history_len      Power of two above taps_per_phase, the
+ *                              longest revolution plus taps_per_phase
+ * @param[in]  frame            frame_len samples aligned to RFFT_Q15_ALIGN,
+ *                              owned by the caller
+ * @param[in]  position         Input position of the first sample, in samples
+ *
+ * @return rfft_status_t
+ *         - RFFT_SUCCESS: Operation successful
+ *         - RFFT_ERROR_NULL_POINTER: NULL pointer provided
+ *         - RFFT_ERROR_INVALID_SIZE: Invalid phases, taps, lengths or revolution
+ *
+ * @example
+ *   static q15_t taps[32 * 8];
+ *   static q15_t history[2 * 4096];
+ *   static q15_t frame[4096] RFFT_Q15_ALIGN;
+ *   static fft_order_t order;
+ *
+ *   // 64 samples per revolution, 64 revolutions per frame: 1/64 order bins
+ *   fft_order_design(taps, 32, 8);
+ *   fft_order_init(&order, taps, 32, 8, 64, 4096, history, 4096, frame, 0);
+ *
+ *   while (read_block(block, &count, &pulse)) {
+ *       fft_order_pulse(&order, pulse);
+ *       for (uint32_t pos = 0; pos < count; ) {
+ *           pos += fft_order_push(&order, &block[pos], count - pos);
+ *           if (fft_order_frame_ready(&order)) {
+ *               fft_context_top_bins_inplace(&ctx, frame, top_bins, 5);
+ *               fft_order_release(&order);
+ *           }
+ *       }
+ *   }
+ */
+rfft_status_t fft_order_init(
+    fft_order_t *order,
+    const q15_t *taps,
+    uint16_t num_phases,
+    uint16_t taps_per_phase,
+    uint16_t samples_per_rev,
+    uint16_t frame_len,
+    q15_t *history,
+    uint16_t history_len,
+    q15_t *frame,
+    uint32_t position
+);
+
+/**
+ * @brief Start over at an input position, e.g. after a gap in the stream
+ *
+ * Forgets the history, the partial frame and the pulses before position.
+ *
+ * @param[in,out] order     Initialized resampler
+ * @param[in]     position  Input position of the next sample, in samples
+ */
+void fft_order_reset(fft_order_t *order, uint32_t position);
+
+/**
+ * @brief Add a tachometer pulse, one per revolution
+ *
+ * Pulses come in the order of their positions. With FFT_ORDER_MAX_PULSES
+ * pending, the oldest is dropped with its revolution.
+ *
+ * @param[in,out] order     Initialized resampler
+ * @param[in]     position  Input position of the pulse in Q8 samples
+ */
+void fft_order_pulse(fft_order_t *order, uint32_t position);
+
+/**
+ * @brief Take new input samples and resample the revolutions they complete
+ *
+ * Stops at the sample that completes a frame, so no frame is overwritten
+ * before it was read. Call again with the rest of the samples after
+ * fft_order_release().
+ *
+ * @param[in,out] order    Initialized resampler
+ * @param[in]     samples  New samples (Q15)
+ * @param[in]     count    Number of new samples
+ *
+ * @return Number of samples consumed, less than count when a frame is due
+ */
+uint32_t fft_order_push(fft_order_t *order, const q15_t *samples, uint32_t count);
+
+/**
+ * @brief Check whether a frame is due
+ */
+static inline bool fft_order_frame_ready(const fft_order_t *order)
+{
+    return order->collected == order->frame_len;
+}
+
+/**
+ * @brief Hand the frame back once it was read or transformed in place
+ *
+ * @param[in,out] order  Initialized resampler
+ */
+static inline void fft_order_release(fft_order_t *order)
+{
+    order->collected = 0;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* FFT_ORDER_H */
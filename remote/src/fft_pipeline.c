@@ -0,0 +1,333 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <errno.h>
+#include <zephyr/kernel.h>
+
+#include "fft_pipeline.h"
+
+/* Coefficients of a stage given 0, those of fft_prefilter.h. */
+#define DEFAULT_POLE     32604
+#define DEFAULT_EMPHASIS 31785
+
+/* A stage the chain may hold, set up from its parameter on the built pipeline. */
+struct fft_pipeline_node {
+	uint8_t id;
+	int (*setup)(struct fft_pipeline *pipe, struct fft_arena *arena, uint16_t param);
+};
+
+static int dc_block_setup(struct fft_pipeline *pipe, struct fft_arena *arena, uint16_t param)
+{
+	ARG_UNUSED(arena);
+
+	if (param > INT16_MAX) {
+		return -EINVAL;
+	}
+
+	pipe->prefilter.pole = (param != 0) ? (q15_t)param : DEFAULT_POLE;
+	pipe->ops |= FFT_PIPELINE_OP_DC_BLOCK;
+
+	return 0;
+}
+
+static int preemphasis_setup(struct fft_pipeline *pipe, struct fft_arena *arena, uint16_t param)
+{
+	ARG_UNUSED(arena);
+
+	if (param > INT16_MAX) {
+		return -EINVAL;
+	}
+
+	pipe->prefilter.emphasis = (param != 0) ? (q15_t)param : DEFAULT_EMPHASIS;
+	pipe->ops |= FFT_PIPELINE_OP_PREEMPHASIS;
+
+	return 0;
+}
+
+static int window_setup(struct fft_pipeline *pipe, struct fft_arena *arena, uint16_t param)
+{
+	fft_context_t *ctx = pipe->ctx;
+	fft_window_type_t type = (fft_window_type_t)param;
+	q15_t *table = NULL;
+
+	if (param > FFT_STREAM_WINDOW_BLACKMAN) {
+		return -EINVAL;
+	}
+
+	if (type == FFT_WINDOW_RECT) {
+		return 0;
+	}
+
+	if (fft_window_table(type, ctx->fft_size) == NULL) {
+		table = FFT_ARENA_ALLOC_ARRAY(arena, q15_t, FFT_WINDOW_TABLE_LEN(ctx->fft_size));
+		if (table == NULL) {
+			return -ENOMEM;
+		}
+	}
+
+	if (fft_context_set_window(ctx, type, table) != RFFT_SUCCESS) {
+		return -EINVAL;
+	}
+
+	/* Applied in the sample loop, the context keeps the type for its interpolation. */
+	pipe->window = ctx->window;
+	ctx->window = NULL;
+	pipe->ops |= FFT_PIPELINE_OP_WINDOW;
+
+	return 0;
+}
+
+static int fft_setup(struct fft_pipeline *pipe, struct fft_arena *arena, uint16_t param)
+{
+	ARG_UNUSED(pipe);
+	ARG_UNUSED(arena);
+	ARG_UNUSED(param);
+
+	return 0;
+}
+
+/* param bands of equal width over bins 1 to fft_size / 2, the last one takes the rest. */
+static int bands_setup(struct fft_pipeline *pipe, struct fft_arena *arena, uint16_t param)
+{
+	uint32_t last_bin = pipe->ctx->fft_size / 2;
+	spectral_band_t *bands;
+
+	if ((param == 0) || (param > CONFIG_APP_FFT_BANDS_MAX) || (param > last_bin)) {
+		return -EINVAL;
+	}
+
+	bands = FFT_ARENA_ALLOC_ARRAY(arena, spectral_band_t, param);
+	if (bands == NULL) {
+		return -ENOMEM;
+	}
+
+	for (uint32_t i = 0; i < param; i++) {
+		bands[i].first_bin = 1 + (i * last_bin) / param;
+		bands[i].last_bin = ((i + 1) * last_bin) / param;
+		bands[i].energy = 0;
+	}
+
+	if (fft_context_set_bands(pipe->ctx, bands, param) != RFFT_SUCCESS) {
+		return -EINVAL;
+	}
+
+	pipe->bands = bands;
+	pipe->num_bands = param;
+
+	return 0;
+}
+
+static int psd_setup(struct fft_pipeline *pipe, struct fft_arena *arena, uint16_t param)
+{
+	ARG_UNUSED(arena);
+	ARG_UNUSED(param);
+
+	if (pipe->psd == NULL) {
+		return -ENOTSUP;
+	}
+
+	return (fft_context_set_psd(pipe->ctx, pipe->psd) == RFFT_SUCCESS) ? 0 : -EINVAL;
+}
+
+static int top_k_setup(struct fft_pipeline *pipe, struct fft_arena *arena, uint16_t param)
+{
+	uint16_t top_k = (param != 0) ? param : CONFIG_APP_FFT_TOP_BINS;
+
+	ARG_UNUSED(arena);
+
+	if ((top_k > pipe->ctx->max_top_bins) || (top_k > pipe->ctx->fft_size / 2)) {
+		return -EINVAL;
+	}
+
+	pipe->top_k = top_k;
+
+	return 0;
+}
+
+static int send_result_setup(struct fft_pipeline *pipe, struct fft_arena *arena, uint16_t param)
+{
+	ARG_UNUSED(arena);
+	ARG_UNUSED(param);
+
+	if (pipe->top_k == 0) {
+		return -EINVAL;
+	}
+
+	pipe->outputs |= FFT_PIPELINE_OUT_RESULT;
+
+	return 0;
+}
+
+static int send_bands_setup(struct fft_pipeline *pipe, struct fft_arena *arena, uint16_t param)
+{
+	ARG_UNUSED(arena);
+	ARG_UNUSED(param);
+
+	if (pipe->num_bands == 0) {
+		return -EINVAL;
+	}
+
+	pipe->outputs |= FFT_PIPELINE_OUT_BANDS;
+
+	return 0;
+}
+
+/* Every stage there is, at most 32 so that a chain's are one word of flags. */
+static const struct fft_pipeline_node nodes[] = {
+	{ FFT_STAGE_DC_BLOCK, dc_block_setup },
+	{ FFT_STAGE_PREEMPHASIS, preemphasis_setup },
+	{ FFT_STAGE_WINDOW, window_setup },
+	{ FFT_STAGE_FFT, fft_setup },
+	{ FFT_STAGE_BANDS, bands_setup },
+	{ FFT_STAGE_PSD, psd_setup },
+	{ FFT_STAGE_TOP_K, top_k_setup },
+	{ FFT_STAGE_SEND_RESULT, send_result_setup },
+	{ FFT_STAGE_SEND_BANDS, send_bands_setup },
+};
+
+BUILD_ASSERT(ARRAY_SIZE(nodes) <= 32, "stage flags do not fit in a word");
+
+static int node_index(uint8_t id)
+{
+	for (uint32_t i = 0; i < ARRAY_SIZE(nodes); i++) {
+		if (nodes[i].id == id) {
+			return (int)i;
+		}
+	}
+
+	return -1;
+}
+
+int fft_pipeline_build(struct fft_pipeline *pipe, fft_context_t *ctx, struct fft_arena *arena,
+		       const struct fft_stage *stages, uint32_t num_stages)
+{
+	spectral_psd_t *psd = pipe->psd;
+	uint32_t seen = 0;
+	uint8_t kind = FFT_STAGE_KIND_SAMPLES;
+	bool has_fft = false;
+	int ret;
+
+	if (num_stages > FFT_PIPELINE_MAX_STAGES) {
+		return -EINVAL;
+	}
+
+	*pipe = (struct fft_pipeline){ .ctx = ctx, .psd = psd };
+	fft_prefilter_init(&pipe->prefilter, 0, 0);
+
+	/* The stages add what they use, nothing else is fed. */
+	(void)fft_context_set_window(ctx, FFT_WINDOW_RECT, NULL);
+	(void)fft_context_set_psd(ctx, NULL);
+	(void)fft_context_set_bands(ctx, NULL, 0);
+
+	for (uint32_t i = 0; i < num_stages; i++) {
+		int node = node_index(stages[i].id);
+
+		if (node < 0) {
+			return -ENOTSUP;
+		}
+
+		if ((FFT_STAGE_KIND(stages[i].id) < kind) || (seen & BIT(node))) {
+			return -EINVAL;
+		}
+
+		kind = FFT_STAGE_KIND(stages[i].id);
+		if ((kind > FFT_STAGE_KIND_FFT) && !has_fft) {
+			return -EINVAL;
+		}
+		has_fft |= (kind == FFT_STAGE_KIND_FFT);
+		seen |= BIT(node);
+
+		ret = nodes[node].setup(pipe, arena, stages[i].param);
+		if (ret < 0) {
+			return ret;
+		}
+
+		pipe->stages[i] = stages[i];
+	}
+
+	if (!has_fft) {
+		return -EINVAL;
+	}
+
+	pipe->num_stages = num_stages;
+
+	return 0;
+}
+
+/*
+ * The sample stages of a frame in one pass. dc, emph and win are constants
+ * at every call, so the loop is compiled once per combination. The filter
+ * starts over at every frame, the frames of a stream may overlap.
+ */
+static inline void samples_run(const struct fft_pipeline *pipe, q15_t *x, uint32_t n,
+			       const int dc, const int emph, const int win)
+{
+	fft_prefilter_t f = pipe->prefilter;
+	const q15_t *w = pipe->window;
+	uint32_t half = FFT_WINDOW_TABLE_LEN(n);
+	q31_t y;
+
+	fft_prefilter_prime(&f, x[0]);
+
+	/* Sample i is weighted by w[i] for the first half and by w[n - i] for the second. */
+	for (uint32_t i = 0; i < half; i++) {
+		y = (dc || emph) ? fft_prefilter_sample(&f, x[i], dc, emph) : x[i];
+		x[i] = win ? (q15_t)((y * w[i]) >> 15) : (q15_t)y;
+	}
+
+	for (uint32_t i = half; i < n; i++) {
+		y = (dc || emph) ? fft_prefilter_sample(&f, x[i], dc, emph) : x[i];
+		x[i] = win ? (q15_t)((y * w[n - i]) >> 15) : (q15_t)y;
+	}
+}
+
+rfft_status_t fft_pipeline_run(struct fft_pipeline *pipe, q15_t *samples, uint16_t *bins,
+			       uint16_t top_k)
+{
+	fft_context_t *ctx = pipe->ctx;
+	uint32_t n = ctx->fft_size;
+	uint16_t bin;
+
+	if ((samples == NULL) || (bins == NULL)) {
+		return RFFT_ERROR_NULL_POINTER;
+	}
+
+	switch (pipe->ops) {
+	case FFT_PIPELINE_OP_DC_BLOCK:
+		samples_run(pipe, samples, n, 1, 0, 0);
+		break;
+	case FFT_PIPELINE_OP_PREEMPHASIS:
+		samples_run(pipe, samples, n, 0, 1, 0);
+		break;
+	case FFT_PIPELINE_OP_DC_BLOCK | FFT_PIPELINE_OP_PREEMPHASIS:
+		samples_run(pipe, samples, n, 1, 1, 0);
+		break;
+	case FFT_PIPELINE_OP_WINDOW:
+		samples_run(pipe, samples, n, 0, 0, 1);
+		break;
+	case FFT_PIPELINE_OP_DC_BLOCK | FFT_PIPELINE_OP_WINDOW:
+		samples_run(pipe, samples, n, 1, 0, 1);
+		break;
+	case FFT_PIPELINE_OP_PREEMPHASIS | FFT_PIPELINE_OP_WINDOW:
+		samples_run(pipe, samples, n, 0, 1, 1);
+		break;
+	case FFT_PIPELINE_OP_DC_BLOCK | FFT_PIPELINE_OP_PREEMPHASIS | FFT_PIPELINE_OP_WINDOW:
+		samples_run(pipe, samples, n, 1, 1, 1);
+		break;
+	default:
+		break;
+	}
+
+	/* The spectrum stages are fed by the magnitude pass of the top bins. */
+	if (MIN(top_k, pipe->top_k) == 0) {
+		/* Even without a result, the bands and the average need the pass. */
+		fft_context_execute_loaded(ctx, samples, &bin, 1);
+	} else {
+		fft_context_execute_loaded(ctx, samples, bins, MIN(top_k, pipe->top_k));
+	}
+
+	return RFFT_SUCCESS;
+}
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/*
+ * Chain of analysis stages built at run time from a list of FFT_STAGE_*
+ * entries. Every stage is a node of a static table, with the kind it runs
+ * as and a setup that takes its buffers from the stream arena. A frame
+ * arrives from the stream, goes through the chain, and the results of the
+ * send stages are left to the caller.
+ *
+ * The executor fuses the stages of a kind instead of running them one
+ * after the other: the DC blocker, the pre-emphasis and the window are a
+ * single pass over the frame, with one loop compiled per combination, and
+ * the bands, the power spectrum average and the top bins are all fed by
+ * the magnitude pass of the FFT context.
+ */
+
+#ifndef FFT_PIPELINE_H
+#define FFT_PIPELINE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <zephyr/sys/util.h>
+
+#include "fft_arena.h"
+#include "fft_prefilter.h"
+#include "fft_stream_msg.h"
+#include "fft_utils.h"
+
+/* Passes of the fused sample loop. */
+#define FFT_PIPELINE_OP_DC_BLOCK     BIT(0)
+#define FFT_PIPELINE_OP_PREEMPHASIS  BIT(1)
+#define FFT_PIPELINE_OP_WINDOW       BIT(2)
+
+/* Messages the caller sends of each frame. */
+#define FFT_PIPELINE_OUT_RESULT      BIT(0)
+#define FFT_PIPELINE_OUT_BANDS       BIT(1)
+
+/**
+ * A chain built by fft_pipeline_build(), its buffers in the arena it was
+ * given. Only valid until that arena is reset.
+ */
+struct fft_pipeline {
+	fft_context_t *ctx;            /**< Context of the FFT, its window applied here. */
+	fft_prefilter_t prefilter;     /**< DC blocker and pre-emphasis, primed per frame. */
+	const q15_t *window;           /**< Half window table, NULL for none. */
+	uint8_t ops;                   /**< FFT_PIPELINE_OP_* of the sample loop. */
+	uint8_t outputs;               /**< FFT_PIPELINE_OUT_* of every frame. */
+	uint16_t top_k;                /**< Bins of a result, 0 without FFT_STAGE_TOP_K. */
+	spectral_band_t *bands;        /**< Bands of FFT_STAGE_BANDS, in the arena. */
+	uint16_t num_bands;            /**< Entries in bands. */
+	spectral_psd_t *psd;           /**< Average of FFT_STAGE_PSD, NULL to refuse the stage. */
+	uint16_t num_stages;           /**< Entries in stages. */
+	struct fft_stage stages[FFT_PIPELINE_MAX_STAGES];  /**< The chain as built. */
+};
+
+/**
+ * @brief Check a chain and set it up on a context
+ *
+ * The stage kinds must come in the order FFT_STAGE_KIND_SAMPLES to
+ * FFT_STAGE_KIND_SEND, each stage at most once, with exactly one
+ * FFT_STAGE_FFT and every send stage after the stage it sends. The
+ * context is set to no window, bands or average first, then each stage
+ * adds its own.
+ *
+ * @param pipe        Pipeline to build; its psd is the average given to
+ *                    FFT_STAGE_PSD and is kept
+ * @param ctx         Context freshly initialized for the frame length
+ * @param arena       Arena the buffers of the stages are taken from
+ * @param stages      Chain, in the order it runs
+ * @param num_stages  Entries in stages
+ *
+ * @retval 0 when built, -EINVAL for a chain out of order or a parameter out
+ *         of range, -ENOTSUP for an unknown stage or FFT_STAGE_PSD without
+ *         an average, -ENOMEM when the arena is too small.
+ */
+int fft_pipeline_build(struct fft_pipeline *pipe, fft_context_t *ctx, struct fft_arena *arena,
+		       const struct fft_stage *stages, uint32_t num_stages);
+
+/**
+ * @brief Run a frame through the chain, in place
+ *
+ * @param pipe     Built pipeline
+ * @param samples  Frame of the context's length, RFFT_Q15_ALIGN, overwritten
+ * @param bins     At least pipe->top_k entries, strongest first
+ * @param top_k    Largest number of bins wanted, at most pipe->top_k are found
+ *
+ * @return rfft_status_t of the FFT
+ */
+rfft_status_t fft_pipeline_run(struct fft_pipeline *pipe, q15_t *samples, uint16_t *bins,
+			       uint16_t top_k);
+
+/**
+ * @brief Bins of a result of the chain, 0 if it sends none
+ */
+static inline uint16_t fft_pipeline_top_k(const struct fft_pipeline *pipe, uint16_t top_k)
+{
+	return (pipe->outputs & FFT_PIPELINE_OUT_RESULT) ? MIN(top_k, pipe->top_k) : 0;
+}
+
+#endif /* FFT_PIPELINE_H */
@@ -0,0 +1,174 @@
+/* ----------------------------------------------------------------------
+ * Project:      FFT Utility Functions
+ * Title:        fft_prefilter.h
+ * Description:  Streaming DC blocker and pre-emphasis applied while a
+ *               stream is copied into frames
+ *
+ * Target Processor: nRF54L15 FLPR (RISC-V)
+ * -------------------------------------------------------------------- */
+
+#ifndef FFT_PREFILTER_H
+#define FFT_PREFILTER_H
+
+#include "rfft_q15_simplified.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief One-pole DC blocker and first-order pre-emphasis of a stream
+ *
+ * find_fft_top_bins() skips bin 0 but the DC still takes its share of
+ * the Q15 range, and of the headroom the radix-4 stages scale down for.
+ * The DC blocker
+ *
+ *   y[n] = x[n] - x[n-1] + pole * y[n-1]
+ *
+ * has a zero at DC and its -3 dB corner near (1 - pole) * fs / 2π, about
+ * 13 Hz at 16 kHz for a pole of 0.995. The pre-emphasis
+ *
+ *   z[n] = y[n] - emphasis * y[n-1]
+ *
+ * lifts the high end, 0.97 being the classic choice. Either is off with
+ * a coefficient of 0.
+ *
+ * The state carries over from call to call, so the filter runs across
+ * frame boundaries as one stream; fft_prefilter_apply() replaces the
+ * copy of the samples into the frame, no pass of its own. The fraction
+ * pole * y[n-1] loses to the shift is fed back into the next sample, so
+ * the DC blocker settles to exactly 0 on a constant input instead of a
+ * rounding offset. The first sample after fft_prefilter_reset() starts
+ * the state, without a step.
+ */
+typedef struct {
+    q15_t pole;             /**< DC blocker pole (Q15), 0 without the DC blocker */
+    q15_t emphasis;         /**< Pre-emphasis coefficient (Q15), 0 without it */
+    q15_t x1;               /**< Previous input */
+    q15_t y1;               /**< Previous output of the DC blocker */
+    q15_t e1;               /**< Previous input of the pre-emphasis */
+    uint16_t frac;          /**< Low 15 bits of the last pole * y1 + frac */
+    uint8_t primed;         /**< A sample went through since the reset */
+} fft_prefilter_t;
+
+/**
+ * @brief Forget the history, e.g. after a gap in the stream
+ *
+ * @param[in,out] filter  Filter state
+ */
+static inline void fft_prefilter_reset(fft_prefilter_t *filter)
+{
+    filter->x1 = 0;
+    filter->y1 = 0;
+    filter->e1 = 0;
+    filter->frac = 0;
+    filter->primed = 0;
+}
+
+/**
+ * @brief Set the coefficients and start without history
+ *
+ * @param[out] filter    Filter state to initialize
+ * @param[in]  pole      DC blocker pole (Q15), e.g. 32604 for 0.995, 0 for none
+ * @param[in]  emphasis  Pre-emphasis coefficient (Q15), e.g. 31785 for 0.97, 0 for none
+ */
+static inline void fft_prefilter_init(fft_prefilter_t *filter, q15_t pole, q15_t emphasis)
+{
+    filter->pole = (pole > 0) ? pole : 0;
+    filter->emphasis = (emphasis > 0) ? emphasis : 0;
+    fft_prefilter_reset(filter);
+}
+
+/**
+ * @brief Start the history at the first sample of the stream
+ *
+ * The stream starts as if it had been at that sample all along, so it
+ * begins without a step. fft_prefilter_apply() does it by itself after
+ * a reset.
+ *
+ * @param[in,out] filter  Filter state
+ * @param[in]     first   First sample that goes through
+ */
+static inline void fft_prefilter_prime(fft_prefilter_t *filter, q15_t first)
+{
+    filter->x1 = first;
+    filter->y1 = 0;
+    filter->e1 = (filter->pole != 0) ? 0 : first;
+    filter->primed = 1;
+}
+
+/*
+ * One sample. dc and emph are constants at every call, so the loop of
+ * fft_prefilter_apply() is compiled once per combination.
+ */
+static inline q15_t fft_prefilter_sample(fft_prefilter_t *f, q31_t x,
+                                         const int dc, const int emph)
+{
+    q31_t y = x;
+
+    if (dc) {
+        q31_t acc = (q31_t) f->pole * f->y1 + f->frac;
+
+        y = __SSAT(x - f->x1 + (acc >> 15), 16);
+        f->frac = (uint16_t) (acc & 0x7FFF);
+        f->x1 = (q15_t) x;
+        f->y1 = (q15_t) y;
+    }
+
+    if (emph) {
+        q31_t z = __SSAT(y - (((q31_t) f->emphasis * f->e1 + (1 << 14)) >> 15), 16);
+
+        f->e1 = (q15_t) y;
+        y = z;
+    }
+
+    return (q15_t) y;
+}
+
+static inline void fft_prefilter_run(fft_prefilter_t *filter, const q15_t *src, q15_t *dst,
+                                     uint32_t count, const int dc, const int emph)
+{
+    fft_prefilter_t f = *filter;
+
+    for (uint32_t i = 0; i < count; i++) {
+        dst[i] = fft_prefilter_sample(&f, src[i], dc, emph);
+    }
+
+    *filter = f;
+}
+
+/**
+ * @brief Copy samples through the filter
+ *
+ * @param[in,out] filter  Filter state, carried to the next call
+ * @param[in]     src     Samples (Q15)
+ * @param[out]    dst     Filtered samples (Q15), may be src
+ * @param[in]     count   Number of samples
+ */
+static inline void fft_prefilter_apply(fft_prefilter_t *filter, const q15_t *src, q15_t *dst,
+                                       uint32_t count)
+{
+    if (count == 0) {
+        return;
+    }
+
+    if (!filter->primed) {
+        fft_prefilter_prime(filter, src[0]);
+    }
+
+    if (filter->pole != 0 && filter->emphasis != 0) {
+        fft_prefilter_run(filter, src, dst, count, 1, 1);
+    } else if (filter->pole != 0) {
+        fft_prefilter_run(filter, src, dst, count, 1, 0);
+    } else if (filter->emphasis != 0) {
+        fft_prefilter_run(filter, src, dst, count, 0, 1);
+    } else if (dst != src) {
+        memcpy(dst, src, count * sizeof(q15_t));
+    }
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* FFT_PREFILTER_H */
@@ -0,0 +1,286 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <errno.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/devicetree.h>
+
+#include "fft_record.h"
+#include "cycle_counter.h"
+
+#define RECORD_NODE DT_NODELABEL(fft_record)
+#define RECORD_LEN  CONFIG_APP_FFT_RECORD_LEN
+#define RECORD_HOP  CONFIG_APP_FFT_RECORD_HOP
+
+BUILD_ASSERT(RFFT_Q15_HAS_LEN(RECORD_LEN), "APP_FFT_RECORD_LEN is not a built RFFT length");
+BUILD_ASSERT(RECORD_HOP <= RECORD_LEN, "APP_FFT_RECORD_HOP exceeds APP_FFT_RECORD_LEN");
+
+int fft_record_init(struct fft_record *rec, fft_context_t *ctx,
+		    const struct fft_record_reader *reader, q15_t *buf0, q15_t *buf1,
+		    uint32_t length, uint32_t hop)
+{
+	if ((rec == NULL) || (ctx == NULL) || (reader == NULL) || (buf0 == NULL) ||
+	    (buf1 == NULL)) {
+		return -EINVAL;
+	}
+
+	if ((length < ctx->fft_size) || (hop == 0) || (hop > ctx->fft_size)) {
+		return -EINVAL;
+	}
+
+	*rec = (struct fft_record){
+		.ctx = ctx,
+		.reader = reader,
+		.frames = { buf0, buf1 },
+		.hop = hop,
+		.num_frames = 1 + (length - ctx->fft_size) / hop,
+	};
+
+	return reader->start(reader->user, 0, buf0, ctx->fft_size);
+}
+
+int fft_record_step(struct fft_record *rec)
+{
+	const struct fft_record_reader *reader = rec->reader;
+	uint32_t n = rec->ctx->fft_size;
+	q15_t *frame = rec->frames[rec->frame & 1U];
+	uint32_t next = rec->frame + 1;
+	uint16_t bin;
+	int ret;
+
+	if (fft_record_done(rec)) {
+		return -ENODATA;
+	}
+
+	ret = reader->wait(reader->user);
+	if (ret < 0) {
+		return ret;
+	}
+
+	/* Into the buffer transformed last, while this one is. */
+	if (next < rec->num_frames) {
+		ret = reader->start(reader->user, next * rec->hop, rec->frames[next & 1U], n);
+		if (ret < 0) {
+			return ret;
+		}
+	}
+
+	/* One bin, the hooks of the context take their spectrum from the pass. */
+	if (fft_context_top_bins_inplace(rec->ctx, frame, &bin, 1) != RFFT_SUCCESS) {
+		return -EINVAL;
+	}
+
+	rec->frame = next;
+
+	return 0;
+}
+
+static int mem_start(void *user, uint32_t offset, q15_t *dst, uint32_t count)
+{
+	const struct fft_record_mem *mem = user;
+
+	memcpy(dst, mem->samples + offset, count * sizeof(q15_t));
+
+	return 0;
+}
+
+static int mem_wait(void *user)
+{
+	ARG_UNUSED(user);
+
+	return 0;
+}
+
+void fft_record_mem_init(struct fft_record_mem *mem, const q15_t *samples)
+{
+	mem->reader = (struct fft_record_reader){
+		.start = mem_start,
+		.wait = mem_wait,
+		.user = mem,
+	};
+	mem->samples = samples;
+}
+
+#if defined(CONFIG_FLASH_MAP)
+static void flash_work(struct k_work *work)
+{
+	struct fft_record_flash *flash = CONTAINER_OF(work, struct fft_record_flash, work);
+
+	flash->ret = flash_area_read(flash->fa, flash->base + flash->offset * sizeof(q15_t),
+				     flash->dst, flash->count * sizeof(q15_t));
+	k_sem_give(&flash->done);
+}
+
+static int flash_start(void *user, uint32_t offset, q15_t *dst, uint32_t count)
+{
+	struct fft_record_flash *flash = user;
+	int ret;
+
+	flash->dst = dst;
+	flash->offset = offset;
+	flash->count = count;
+
+	ret = k_work_submit(&flash->work);
+
+	return (ret < 0) ? ret : 0;
+}
+
+static int flash_wait(void *user)
+{
+	struct fft_record_flash *flash = user;
+
+	(void)k_sem_take(&flash->done, K_FOREVER);
+
+	return flash->ret;
+}
+
+void fft_record_flash_init(struct fft_record_flash *flash, const struct flash_area *fa,
+			   uint32_t base)
+{
+	flash->reader = (struct fft_record_reader){
+		.start = flash_start,
+		.wait = flash_wait,
+		.user = flash,
+	};
+	flash->fa = fa;
+	flash->base = base;
+	k_work_init(&flash->work, flash_work);
+	k_sem_init(&flash->done, 0, 1);
+}
+#endif /* CONFIG_FLASH_MAP */
+
+static q15_t frames[2][RECORD_LEN] RFFT_Q15_FRAME;
+static q15_t window[FFT_WINDOW_TABLE_LEN(RECORD_LEN)];
+static uint32_t psd_bins[SPECTRAL_PSD_STORAGE_LEN(RECORD_LEN / 2 + 1)];
+static spectral_peak_t peak;
+static spectral_psd_t psd;
+static fft_context_t ctx;
+static struct fft_record rec;
+
+#if defined(CONFIG_APP_FFT_RECORD_FLASH)
+static struct fft_record_flash source;
+
+/* The header from the start of the fixed partition, the samples after it. */
+static int record_open(struct fft_record_hdr *hdr, const struct fft_record_reader **reader,
+		       uint32_t *size)
+{
+	const struct flash_area *fa;
+	int ret;
+
+	ret = flash_area_open(FIXED_PARTITION_ID(fft_record), &fa);
+	if (ret < 0) {
+		return ret;
+	}
+
+	ret = flash_area_read(fa, 0, hdr, sizeof(*hdr));
+	if (ret < 0) {
+		flash_area_close(fa);
+		return ret;
+	}
+
+	fft_record_flash_init(&source, fa, sizeof(*hdr));
+	*reader = &source.reader;
+	*size = fa->fa_size;
+
+	return 0;
+}
+#else
+static struct fft_record_mem source;
+
+/* The reserved-memory region, read in place. */
+static int record_open(struct fft_record_hdr *hdr, const struct fft_record_reader **reader,
+		       uint32_t *size)
+{
+	const struct fft_record_hdr *image = (const struct fft_record_hdr *)DT_REG_ADDR(RECORD_NODE);
+
+	*hdr = *image;
+	fft_record_mem_init(&source, (const q15_t *)(image + 1));
+	*reader = &source.reader;
+	*size = DT_REG_SIZE(RECORD_NODE);
+
+	return 0;
+}
+#endif /* CONFIG_APP_FFT_RECORD_FLASH */
+
+/* The bins of an average, with the time of its first frame. */
+static void print_average(uint32_t index, uint32_t first_frame, uint32_t rate)
+{
+	uint32_t start_ms = (uint32_t)(((uint64_t)first_frame * RECORD_HOP * 1000U) / rate);
+
+	printk("psd,%u,%u,%u", index, start_ms, psd.frames);
+	for (uint32_t bin = 0; bin < psd.num_bins; bin++) {
+		printk(",%u", psd.acc[bin]);
+	}
+	printk("\n");
+}
+
+int fft_record_run(void)
+{
+	const struct fft_record_reader *reader;
+	struct fft_record_hdr hdr;
+	uint32_t first_frame = 0;
+	uint32_t averages = 0;
+	uint64_t cycles = 0;
+	uint32_t start;
+	uint32_t size;
+	int ret;
+
+	ret = record_open(&hdr, &reader, &size);
+	if (ret < 0) {
+		printk("FFT record: not opened (%d)\n", ret);
+		return ret;
+	}
+
+	if ((hdr.magic != FFT_RECORD_MAGIC) || (hdr.rate == 0) ||
+	    (hdr.samples > (size - sizeof(hdr)) / sizeof(q15_t)) || (hdr.samples < RECORD_LEN)) {
+		printk("FFT record: no record of %u samples or more\n", RECORD_LEN);
+		return -ENODATA;
+	}
+
+	(void)fft_context_init(&ctx, RECORD_LEN, NULL, &peak, 1);
+	(void)fft_context_set_window(&ctx, FFT_WINDOW_HANN, window);
+	(void)spectral_psd_init(&psd, psd_bins, RECORD_LEN / 2 + 1, SPECTRAL_PSD_LINEAR,
+				CONFIG_APP_FFT_RECORD_AVG_SHIFT);
+	(void)fft_context_set_psd(&ctx, &psd);
+
+	ret = fft_record_init(&rec, &ctx, reader, frames[0], frames[1], hdr.samples, RECORD_HOP);
+	if (ret < 0) {
+		printk("FFT record: first read failed (%d)\n", ret);
+		return ret;
+	}
+
+	printk("record,%u,%u,%u,%u,%u\n", hdr.samples, hdr.rate, RECORD_LEN, RECORD_HOP,
+	       rec.num_frames);
+	printk("psd,average,start_ms,frames,bins\n");
+
+	while (!fft_record_done(&rec)) {
+		start = read_cycle();
+		ret = fft_record_step(&rec);
+		cycles += read_cycle() - start;
+		if (ret < 0) {
+			printk("FFT record: frame %u failed (%d)\n", rec.frame, ret);
+			return ret;
+		}
+
+		if (spectral_psd_complete(&psd)) {
+			print_average(averages++, first_frame, hdr.rate);
+			spectral_psd_reset(&psd);
+			first_frame = rec.frame;
+		}
+	}
+
+	/* The frames after the last complete average, scaled by frames / 2^shift. */
+	if (psd.frames != 0) {
+		print_average(averages++, first_frame, hdr.rate);
+	}
+
+	/* With the wait for each read, what is left of it after the transform before. */
+	printk("FFT record: %u frames in %u averages, %u cycles per frame\n", rec.num_frames,
+	       averages, (uint32_t)(cycles / rec.num_frames));
+
+	return 0;
+}
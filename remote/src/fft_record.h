@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/*
+ * Spectral analysis of a record too long for SRAM, read frame by frame
+ * from where it is kept. Frame k starts at sample k * hop of the record and
+ * is read whole into one of two frame buffers, so the record may be of any
+ * length and the frames may overlap by any amount without a ring of
+ * samples: while the context transforms one buffer in place, the reader
+ * fills the other with the next frame. The transforms feed the average and
+ * the other spectrum hooks set on the context, a power spectrum average
+ * makes it a Welch estimate of the record.
+ *
+ * Overlapping frames read their common samples twice, the price of the
+ * two buffers; the reads overlap the transforms, which take longer.
+ */
+
+#ifndef FFT_RECORD_H
+#define FFT_RECORD_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "fft_utils.h"
+
+/* "FRC1", a region never written holds 0xff. */
+#define FFT_RECORD_MAGIC 0x31435246U
+
+/**
+ * Layout of a stored record, as remote/fft_record.py writes it: this
+ * header, then samples Q15 samples.
+ */
+struct fft_record_hdr {
+	uint32_t magic;     /**< FFT_RECORD_MAGIC. */
+	uint32_t samples;   /**< Samples after the header. */
+	uint32_t rate;      /**< Sample rate in Hz. */
+	uint32_t reserved;  /**< 0. */
+};
+
+/**
+ * Source of the samples of a record. At most one read is in flight: start
+ * is called again only once wait has returned.
+ */
+struct fft_record_reader {
+	/** Start reading count samples from sample offset on into dst. */
+	int (*start)(void *user, uint32_t offset, q15_t *dst, uint32_t count);
+	/** Wait until the read started last is in its buffer. */
+	int (*wait)(void *user);
+	void *user;  /**< Passed to start and wait. */
+};
+
+/** A record being analysed, set up by fft_record_init(). */
+struct fft_record {
+	fft_context_t *ctx;                      /**< Context the frames run through. */
+	const struct fft_record_reader *reader;  /**< Where the samples come from. */
+	q15_t *frames[2];                        /**< The two frame buffers. */
+	uint32_t hop;                            /**< Samples from a frame to the next. */
+	uint32_t frame;                          /**< Next frame to transform. */
+	uint32_t num_frames;                     /**< Frames of the record. */
+};
+
+/**
+ * @brief Set a record up and start reading its first frame
+ *
+ * Only the frames that fit whole are analysed, the samples after the last
+ * are left out.
+ *
+ * @param rec     Record to set up
+ * @param ctx     Context of the frame length, with its window and the
+ *                average its frames feed; no work buffer is needed
+ * @param reader  Source of the samples, kept
+ * @param buf0    ctx->fft_size samples, RFFT_Q15_ALIGN
+ * @param buf1    As buf0
+ * @param length  Samples of the record, at least ctx->fft_size
+ * @param hop     Samples from a frame to the next, 1 to ctx->fft_size
+ *
+ * @retval 0 when the first read is started, -EINVAL for a parameter out of
+ *         range, or the error of the reader.
+ */
+int fft_record_init(struct fft_record *rec, fft_context_t *ctx,
+		    const struct fft_record_reader *reader, q15_t *buf0, q15_t *buf1,
+		    uint32_t length, uint32_t hop);
+
+/**
+ * @brief Transform the next frame
+ *
+ * Waits for its read, starts that of the frame after it into the other
+ * buffer and transforms it in place. After an error the record is given up.
+ *
+ * @param rec  Record set up by fft_record_init()
+ *
+ * @retval 0 when transformed, -ENODATA after the last frame, or the error
+ *         of the reader.
+ */
+int fft_record_step(struct fft_record *rec);
+
+/**
+ * @brief Check whether every frame has been transformed
+ */
+static inline bool fft_record_done(const struct fft_record *rec)
+{
+	return rec->frame >= rec->num_frames;
+}
+
+/**
+ * Reader of a record in memory, RRAM read in place for instance. Each read
+ * is a copy done when it starts, wait returns at once.
+ */
+struct fft_record_mem {
+	struct fft_record_reader reader;  /**< Set up by fft_record_mem_init(). */
+	const q15_t *samples;             /**< Sample 0 of the record. */
+};
+
+/**
+ * @brief Set a reader of a record in memory up
+ *
+ * @param mem      Reader to set up, mem->reader is given to fft_record_init()
+ * @param samples  Sample 0 of the record
+ */
+void fft_record_mem_init(struct fft_record_mem *mem, const q15_t *samples);
+
+#if defined(CONFIG_FLASH_MAP)
+#include <zephyr/kernel.h>
+#include <zephyr/storage/flash_map.h>
+
+/**
+ * Reader of a record in a flash area, external flash for instance. Each
+ * read runs on the system work queue, whose thread sleeps while the flash
+ * driver moves the data, so the caller transforms a frame meanwhile.
+ */
+struct fft_record_flash {
+	struct fft_record_reader reader;  /**< Set up by fft_record_flash_init(). */
+	const struct flash_area *fa;      /**< Area of the record. */
+	uint32_t base;                    /**< Bytes in the area before sample 0. */
+	struct k_work work;               /**< The read in flight. */
+	struct k_sem done;                /**< Given when it is over. */
+	q15_t *dst;                       /**< Arguments of the read. */
+	uint32_t offset;
+	uint32_t count;
+	int ret;                          /**< Its result. */
+};
+
+/**
+ * @brief Set a reader of a record in a flash area up
+ *
+ * @param flash  Reader to set up, flash->reader is given to fft_record_init()
+ * @param fa     Open flash area, kept
+ * @param base   Bytes in the area before sample 0
+ */
+void fft_record_flash_init(struct fft_record_flash *flash, const struct flash_area *fa,
+			   uint32_t base);
+#endif /* CONFIG_FLASH_MAP */
+
+/**
+ * Analyse the record of the fft_record devicetree node with
+ * CONFIG_APP_FFT_RECORD: every CONFIG_APP_FFT_RECORD_LEN-point frame,
+ * CONFIG_APP_FFT_RECORD_HOP samples apart and Hann windowed, into
+ * averages of 2^CONFIG_APP_FFT_RECORD_AVG_SHIFT frames, each printed as a
+ * CSV row of its bins.
+ *
+ * @retval 0 when analysed, a negative errno when the record is missing or
+ *         a read failed.
+ */
+int fft_record_run(void);
+
+#endif /* FFT_RECORD_H */
@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <errno.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/crc.h>
+
+#include "fft_selftest.h"
+#include "rfft_q15_simplified.h"
+#include "cycle_counter.h"
+
+/* Largest RFFT of the test, within the twiddle table of every build. */
+#define SELFTEST_MAX_LEN MIN(256, RFFT_Q15_MAX_FFT_LEN)
+
+/*
+ * crc32_ieee() of bins 0 to fft_size / 2 of each spectrum, those of the
+ * host build of the library. The scalar kernels, packed, Stockham, fixed
+ * or not, are bit-exact with each other, and so are the builds with the
+ * DSP extension, so one value per backend holds for any build.
+ */
+#if defined(ARM_MATH_DSP)
+#define SELFTEST_CRC(scalar, dsp) (dsp)
+#else
+#define SELFTEST_CRC(scalar, dsp) (scalar)
+#endif
+
+static const struct {
+	uint16_t fft_size;
+	uint32_t crc;
+} selftest_cases[] = {
+	/* 16-point CFFT, radix-4 */
+	{ 32, SELFTEST_CRC(0x93979263U, 0x6768264AU) },
+#if RFFT_Q15_MAX_FFT_LEN >= 128
+	/* 64-point CFFT, the first, a middle and the last radix-4 stage */
+	{ 128, SELFTEST_CRC(0x3550EAE5U, 0x05B6BB4DU) },
+#endif
+#if RFFT_Q15_MAX_FFT_LEN >= 256 && (!defined(RFFT_Q15_STOCKHAM) || RFFT_Q15_HAS_LEN(256))
+	/* 128-point CFFT, radix-4-by-2, whose Stockham step tables are built-in only */
+	{ 256, SELFTEST_CRC(0x31A15A01U, 0x9C2DCB68U) },
+#endif
+};
+
+static q15_t selftest_input[SELFTEST_MAX_LEN] RFFT_Q15_ALIGN;
+static q15_t selftest_output[2 * SELFTEST_MAX_LEN] RFFT_Q15_ALIGN;
+
+/* A square wave of 8 samples on noise, as the frame of fft_bench.c. */
+static void selftest_fill(uint32_t fft_size)
+{
+	uint32_t seed = 12345U;
+
+	for (uint32_t i = 0; i < fft_size; i++) {
+		seed = seed * 1103515245U + 12345U;
+		selftest_input[i] = (q15_t)(((i & 4U) ? 8192 : -8192) + (int16_t)(seed >> 16) / 8);
+	}
+}
+
+/* An instance of any length on the table of the prebuilt ones, as rfft_plan_create() sets. */
+static void selftest_instance(arm_rfft_instance_q15 *rfft, arm_cfft_instance_q15 *cfft,
+			      uint32_t fft_size)
+{
+	*cfft = (arm_cfft_instance_q15){
+		.fftLen = fft_size / 2U,
+		.pTwiddle = RFFT_TWIDDLE_DATA,
+		.pBitRevTable = NULL,
+		.bitRevLength = 0U,
+	};
+
+	*rfft = (arm_rfft_instance_q15){
+		.fftLenReal = fft_size,
+		.ifftFlagR = 0U,
+		.bitReverseFlagR = 1U,
+		.twidCoefRModifier = RFFT_TWIDDLE_STRIDE(fft_size),
+		.pTwiddleAReal = RFFT_TWIDDLE_DATA,
+		.pTwiddleBReal = NULL,
+		.pCfft = cfft,
+	};
+}
+
+int fft_selftest_run(uint32_t *cycles)
+{
+	arm_rfft_instance_q15 rfft;
+	arm_cfft_instance_q15 cfft;
+	uint32_t start;
+	uint32_t crc;
+	int ret = 0;
+
+	/* Fills the SRAM table of the lazy and run-time twiddle builds. */
+	rfft_q15_twiddles_init();
+
+	start = read_cycle();
+
+	for (uint32_t i = 0; i < ARRAY_SIZE(selftest_cases); i++) {
+		uint32_t fft_size = selftest_cases[i].fft_size;
+
+		selftest_instance(&rfft, &cfft, fft_size);
+		selftest_fill(fft_size);
+		arm_rfft_q15(&rfft, selftest_input, selftest_output);
+
+		crc = crc32_ieee((const uint8_t *)selftest_output,
+				 (fft_size + 2U) * sizeof(q15_t));
+		if (crc != selftest_cases[i].crc) {
+			ret = -EIO;
+			break;
+		}
+	}
+
+	if (cycles != NULL) {
+		*cycles = read_cycle() - start;
+	}
+
+	return ret;
+}
@@ -0,0 +1,26 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef FFT_SELFTEST_H
+#define FFT_SELFTEST_H
+
+#include <stdint.h>
+
+/**
+ * Known-answer test of the FFT kernels: a few small RFFTs of a fixed
+ * frame, on the shared twiddle table of the built-in lengths, each
+ * checked against the CRC-32 of its spectrum. Between them they run the
+ * radix-4 CFFT, the radix-4-by-2 one where its tables are built in, the
+ * bit reversal and the split step, in well under a millisecond, where
+ * the benchmark of CONFIG_APP_FFT_BENCH takes seconds.
+ *
+ * @param cycles  Set to the cycles the test took, may be NULL.
+ *
+ * @retval 0 when every spectrum matches, -EIO at the first that does not.
+ */
+int fft_selftest_run(uint32_t *cycles);
+
+#endif /* FFT_SELFTEST_H */
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+
+#include "fft_shed.h"
+
+void fft_shed_reset(struct fft_shed *shed, uint64_t cycles, uint8_t shift, uint32_t missed)
+{
+	shed->budget = cycles << shift;
+	shed->busy = 0;
+	shed->frames = 0;
+	shed->missed = missed;
+	shed->measuring = false;
+	memset(shed->saving, 0, sizeof(shed->saving));
+	shed->shift = shift;
+	shed->level = FFT_SHED_NONE;
+}
+
+uint8_t fft_shed_step(const struct fft_shed *shed, int dir)
+{
+	int level = shed->level + dir;
+
+	while ((level >= FFT_SHED_NONE) && (level < FFT_SHED_LEVELS)) {
+		if ((shed->usable & (1U << level)) != 0) {
+			return (uint8_t)level;
+		}
+		level += dir;
+	}
+
+	return shed->level;
+}
+
+uint8_t fft_shed_decide(struct fft_shed *shed, uint32_t missed)
+{
+	bool late = (missed != shed->missed) && !shed->measuring;
+
+	shed->missed = missed;
+
+	if (shed->measuring) {
+		shed->saving[shed->level] = (shed->entry > shed->busy) ? (shed->entry - shed->busy) : 0;
+		shed->measuring = false;
+	}
+
+	if (late || (shed->busy > shed->budget - (shed->budget >> 3))) {
+		return fft_shed_step(shed, 1);
+	}
+
+	if ((shed->level != FFT_SHED_NONE) &&
+	    (shed->busy + shed->saving[shed->level] <= shed->budget - (shed->budget >> 2))) {
+		return fft_shed_step(shed, -1);
+	}
+
+	return shed->level;
+}
+
+void fft_shed_commit(struct fft_shed *shed, uint8_t level)
+{
+	if (level > shed->level) {
+		shed->entry = shed->busy;
+		shed->measuring = true;
+	}
+	shed->level = level;
+
+	shed->busy = 0;
+	shed->frames = 0;
+}
+
+rfft_status_t fft_shed_top_bins(const struct fft_shed *shed, fft_context_t *full,
+				fft_context_t *half, q15_t *samples, uint16_t *bins,
+				uint16_t top_k)
+{
+	rfft_status_t status;
+
+	if (top_k == 0) {
+		return RFFT_SUCCESS;
+	}
+
+	if ((half == NULL) || !fft_shed_has(shed, FFT_SHED_HALF)) {
+		return fft_context_top_bins_inplace(full, samples, bins, top_k);
+	}
+
+	status = fft_context_top_bins_inplace(half, &samples[full->fft_size / 2], bins, top_k);
+	/* A bin of the half length is two of the full one. */
+	for (uint32_t i = 0; i < top_k; i++) {
+		bins[i] <<= 1;
+	}
+
+	return status;
+}
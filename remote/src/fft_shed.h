@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/*
+ * Load shedding of the stream analysis. The cycles of every frame are
+ * added up, and every 2^shift frames the shed level is picked from the
+ * sum against the budget, the cycles between the starts of those frames:
+ * one up above 7/8 of the budget or when a frame was late or dropped, one
+ * down once the frames plus what the level saved take at most 3/4 of it.
+ * The first decision at a new level only measures what it saved; a frame
+ * left late by the level before does not count then. Shifts only, as for
+ * the clock of APP_FFT_DUTY_CYCLE.
+ *
+ * The levels are the FFT_SHED_* of fft_stream_msg.h. The caller reports
+ * a move and switches the window of its contexts; the state here is free
+ * of both, so the decisions run on the host as well.
+ */
+
+#ifndef FFT_SHED_H
+#define FFT_SHED_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "fft_stream_msg.h"
+#include "fft_utils.h"
+
+struct fft_shed {
+	uint64_t budget;   /**< Cycles between the starts of the frames of a decision. */
+	uint64_t busy;     /**< Cycles of analysis over the frames of the decision so far. */
+	uint32_t frames;   /**< Frames of the decision so far. */
+	uint32_t missed;   /**< Frames late and blocks and frames dropped up to the last decision. */
+	/** Cycles per decision each level saved, measured at the first decision after entering it. */
+	uint64_t saving[FFT_SHED_LEVELS];
+	/** Cycles of the decision that entered the level, until its saving is known. */
+	uint64_t entry;
+	bool measuring;
+	uint8_t shift;     /**< log2 of the frames of a decision. */
+	uint8_t level;     /**< FFT_SHED_* of the frames now. */
+	uint8_t usable;    /**< BIT(FFT_SHED_*) of the levels the setup can use. */
+};
+
+/**
+ * @brief Start the decisions over at the full analysis
+ *
+ * @param shed    State; usable is kept
+ * @param cycles  Cycles between the starts of two frames, the hop in samples
+ *                times the cycles per sample
+ * @param shift   log2 of the frames of a decision
+ * @param missed  Frames late and blocks and frames dropped so far
+ */
+void fft_shed_reset(struct fft_shed *shed, uint64_t cycles, uint8_t shift, uint32_t missed);
+
+/** Whether the current level drops the work of rung, one of FFT_SHED_*. */
+static inline bool fft_shed_has(const struct fft_shed *shed, uint8_t rung)
+{
+	return (shed->level >= rung) && ((shed->usable & (1U << rung)) != 0);
+}
+
+/** Next level from the current one in direction dir the setup can use, the current if none. */
+uint8_t fft_shed_step(const struct fft_shed *shed, int dir);
+
+/**
+ * @brief Add the cycles of one frame
+ *
+ * @return true once the frames of a decision are in, for fft_shed_decide().
+ */
+static inline bool fft_shed_add(struct fft_shed *shed, uint32_t busy)
+{
+	shed->busy += busy;
+
+	return ++shed->frames >= (1U << shed->shift);
+}
+
+/**
+ * @brief Pick the level of the next frames
+ *
+ * The level is not moved yet, the caller reports the busy cycles and the
+ * budget of the decision first and then calls fft_shed_commit().
+ *
+ * @param missed  Frames late and blocks and frames dropped so far
+ *
+ * @return FFT_SHED_* to move to, the current level to stay.
+ */
+uint8_t fft_shed_decide(struct fft_shed *shed, uint32_t missed);
+
+/**
+ * @brief Move to the level fft_shed_decide() picked and start the next decision
+ */
+void fft_shed_commit(struct fft_shed *shed, uint8_t level);
+
+/** Top bins of the frame numbered seq at the current level, 0 for a frame decimated away. */
+static inline uint16_t fft_shed_top_k(const struct fft_shed *shed, uint32_t seq, uint16_t top_k)
+{
+	if (fft_shed_has(shed, FFT_SHED_DECIMATE) && ((seq & 1) != 0)) {
+		return 0;
+	}
+
+	if (fft_shed_has(shed, FFT_SHED_TOP_K)) {
+		return (top_k > 1) ? (top_k >> 1) : 1;
+	}
+
+	return top_k;
+}
+
+/**
+ * @brief Top bins of a frame at the current level
+ *
+ * At FFT_SHED_HALF and above the newest half of the frame goes through
+ * half, a context of frame_len / 2, and its bins are numbered for the
+ * full length: bin k of the half length is bin 2k of the full one.
+ *
+ * @param shed     State
+ * @param full     Context of the frame length
+ * @param half     Context of half the frame length, NULL if the setup has
+ *                 none and FFT_SHED_HALF is not usable
+ * @param samples  Frame of full->fft_size samples, transformed in place
+ * @param bins     top_k bins of the frame
+ * @param top_k    Bins to find, 0 for none
+ */
+rfft_status_t fft_shed_top_bins(const struct fft_shed *shed, fft_context_t *full,
+				fft_context_t *half, q15_t *samples, uint16_t *bins,
+				uint16_t top_k);
+
+#endif /* FFT_SHED_H */
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/*
+ * Lock-free queue of pointers between one producer and one consumer,
+ * either of which may run in interrupt context. The producer only writes
+ * head and the consumer only writes tail, so neither takes a lock or needs
+ * an atomic read-modify-write, which the FLPR core, without the A
+ * extension, could only emulate with interrupts locked. Loads and stores
+ * with acquire and release order are plain word accesses and fences.
+ *
+ * One of the len slots stays empty to tell a full queue from an empty one,
+ * and the indices wrap by a comparison, cheaper than a remainder by len,
+ * which need not be a power of two.
+ */
+
+#ifndef FFT_SPSC_H
+#define FFT_SPSC_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+struct fft_spsc {
+	void **slots;
+	uint32_t len;   /**< Slots, one more than the queue holds. */
+	uint32_t head;  /**< Next slot to write, producer only. */
+	uint32_t tail;  /**< Next slot to read, consumer only. */
+};
+
+/** Slots of a queue holding up to n items. */
+#define FFT_SPSC_SLOTS(n) ((n) + 1)
+
+static inline uint32_t fft_spsc_next(const struct fft_spsc *q, uint32_t i)
+{
+	return (i + 1 == q->len) ? 0 : i + 1;
+}
+
+/**
+ * @brief Set up an empty queue. Neither side may be using it.
+ *
+ * @param slots Array of FFT_SPSC_SLOTS(n) pointers for a queue of n items.
+ * @param len   Entries of @p slots.
+ */
+static inline void fft_spsc_init(struct fft_spsc *q, void **slots, uint32_t len)
+{
+	q->slots = slots;
+	q->len = len;
+	q->head = 0;
+	q->tail = 0;
+}
+
+/**
+ * @brief Append an item, producer side.
+ *
+ * @return false if the queue is full.
+ */
+static inline bool fft_spsc_put(struct fft_spsc *q, void *item)
+{
+	uint32_t head = q->head;
+	uint32_t next = fft_spsc_next(q, head);
+
+	if (next == __atomic_load_n(&q->tail, __ATOMIC_ACQUIRE)) {
+		return false;
+	}
+
+	q->slots[head] = item;
+	/* Publishes the slot before the index that hands it over. */
+	__atomic_store_n(&q->head, next, __ATOMIC_RELEASE);
+
+	return true;
+}
+
+/**
+ * @brief Take the oldest item, consumer side.
+ *
+ * @return false if the queue is empty.
+ */
+static inline bool fft_spsc_get(struct fft_spsc *q, void **item)
+{
+	uint32_t tail = q->tail;
+
+	if (tail == __atomic_load_n(&q->head, __ATOMIC_ACQUIRE)) {
+		return false;
+	}
+
+	*item = q->slots[tail];
+	/* The slot is read before the producer may reuse it. */
+	__atomic_store_n(&q->tail, fft_spsc_next(q, tail), __ATOMIC_RELEASE);
+
+	return true;
+}
+
+#endif /* FFT_SPSC_H */
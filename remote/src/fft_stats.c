@@ -0,0 +1,106 @@
+/* ----------------------------------------------------------------------
+ * Project:      FFT Utility Functions
+ * Title:        fft_stats.c
+ * Description:  Time-domain statistics of a frame: RMS, peak, crest, kurtosis
+ *
+ * Target Processor: nRF54L15 FLPR (RISC-V)
+ * -------------------------------------------------------------------- */
+
+#include "fft_stats.h"
+
+/* floor(sqrt(v)), one result bit per step as isqrt64() of fft_utils.c */
+static uint32_t stats_isqrt(uint32_t v)
+{
+    uint32_t root = 0;
+    uint32_t bit = 1UL << 30;
+
+    while (bit > v) {
+        bit >>= 2;
+    }
+
+    while (bit != 0) {
+        if (v >= root + bit) {
+            v -= root + bit;
+            root = (root >> 1) + bit;
+        } else {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+
+    return root;
+}
+
+/**
+ * @brief Add a run of samples
+ */
+void fft_stats_add(fft_stats_t *stats, const q15_t *samples, uint32_t count)
+{
+    fft_stats_t acc = *stats;
+
+    for (uint32_t i = 0; i < count; i++) {
+        fft_stats_sample(&acc, samples[i]);
+    }
+
+    *stats = acc;
+}
+
+/**
+ * @brief Turn the sums of a frame into its statistics
+ */
+void fft_stats_read(const fft_stats_t *stats, fft_stats_result_t *out)
+{
+    int64_t n = stats->count;
+    int64_t half = n / 2;
+    int64_t mean;
+    int64_t e2;
+    int64_t e3;
+    int64_t e4;
+    int64_t m2;
+    int64_t var;
+    int64_t m4;
+    uint32_t crest;
+
+    memset(out, 0, sizeof(*out));
+    if (n == 0) {
+        return;
+    }
+
+    /*
+     * The mean in Q23, 8 bits below a sample: with an offset the central
+     * moments are small differences of large raw ones, and a mean
+     * rounded to Q15 would be off by up to one part in 2 * |mean|.
+     */
+    mean = (int64_t) stats->sum * 256;
+    mean = (mean + ((mean < 0) ? -half : half)) / n;
+    e2 = (int64_t) ((stats->sum_sq + (uint64_t) half) / (uint64_t) n);
+    e3 = stats->sum_cube / n;
+    e4 = (int64_t) ((stats->sum_quad + (uint64_t) half) / (uint64_t) n);
+
+    out->mean = (q15_t) ((mean + ((mean < 0) ? -128 : 128)) / 256);
+    out->rms = (uint16_t) stats_isqrt((uint32_t) e2);
+    out->peak = stats->peak;
+
+    if (out->rms != 0) {
+        crest = ((uint32_t) stats->peak << 8) / out->rms;
+        out->crest = (uint16_t) ((crest > UINT16_MAX) ? UINT16_MAX : crest);
+    }
+
+    /*
+     * E[(x - m)^4] = E[x^4] - 4 m E[x^3] + 6 m^2 E[x^2] - 3 m^4 in Q45,
+     * with m^2 in Q30 so each product stays within 2^60.
+     */
+    m2 = (mean * mean + (1LL << 15)) >> 16;
+    var = e2 - m2;
+    m4 = e4 - 4 * ((mean * e3) >> 8) + 6 * ((m2 * e2) >> 15) - 3 * ((m2 * m2) >> 15);
+
+    if (var <= 0 || m4 <= 0) {
+        return;
+    }
+
+    /*
+     * m4 / var^2 in Q8, one division at a time: the kurtosis is at most
+     * the number of samples, so the first quotient stays below 2^39.
+     */
+    out->kurtosis = (uint32_t) (((((m4 << 8) / var) << 15) / var));
+}
@@ -0,0 +1,116 @@
+/* ----------------------------------------------------------------------
+ * Project:      FFT Utility Functions
+ * Title:        fft_stats.h
+ * Description:  Time-domain statistics of a frame: RMS, peak, crest, kurtosis
+ *
+ * Target Processor: nRF54L15 FLPR (RISC-V)
+ * -------------------------------------------------------------------- */
+
+#ifndef FFT_STATS_H
+#define FFT_STATS_H
+
+#include <string.h>
+#include "rfft_q15_simplified.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Power sums of the samples of a frame
+ *
+ * The raw moments of up to 65535 samples, each sum exact or within a
+ * rounding per sample: x in Q15, x² in Q30 and x³ and x⁴ shifted down by
+ * 15 bits into Q30 and Q45, rounded, so every sum fits its word. A
+ * sample costs one 32-bit and two 32x32 -> 64-bit multiplies.
+ * fft_stats_read() turns the sums into the statistics of the frame once
+ * per frame. Below an RMS of about 64, -54 dBFS, x⁴ keeps too few bits
+ * for the kurtosis.
+ */
+typedef struct {
+    int32_t sum;            /**< Σ x (Q15) */
+    uint32_t count;         /**< Samples added */
+    uint64_t sum_sq;        /**< Σ x² (Q30) */
+    int64_t sum_cube;       /**< Σ x³ >> 15 (Q30) */
+    uint64_t sum_quad;      /**< Σ x⁴ >> 15 (Q45) */
+    uint16_t peak;          /**< Largest |x|, 32768 for -32768 */
+} fft_stats_t;
+
+/**
+ * @brief Statistics of a frame, for condition monitoring
+ */
+typedef struct {
+    q15_t mean;             /**< Mean of the samples (Q15) */
+    uint16_t rms;           /**< Root of the mean of x², the mean included (Q15) */
+    uint16_t peak;          /**< Largest |x|, 32768 for -32768 */
+    uint16_t crest;         /**< peak / rms (Q8), saturated, 0 for a frame of zeros */
+    uint32_t kurtosis;      /**< Fourth central moment / variance² (Q8), 768 for Gaussian noise */
+} fft_stats_result_t;
+
+/**
+ * @brief Start the sums of a new frame
+ */
+static inline void fft_stats_reset(fft_stats_t *stats)
+{
+    memset(stats, 0, sizeof(*stats));
+}
+
+/**
+ * @brief Add one sample
+ *
+ * Inline for the loops that copy or window a frame, so the samples are
+ * read once for both. Keep stats in a local copy across such a loop.
+ */
+static inline void fft_stats_sample(fft_stats_t *stats, q15_t x)
+{
+    uint32_t sq = (uint32_t) ((q31_t) x * x);
+    uint16_t mag = (uint16_t) ((x < 0) ? -(q31_t) x : x);
+
+    stats->sum += x;
+    stats->count++;
+    stats->sum_sq += sq;
+    stats->sum_cube += ((int64_t) (q31_t) sq * x + (1 << 14)) >> 15;
+    stats->sum_quad += ((uint64_t) sq * sq + (1U << 14)) >> 15;
+    if (mag > stats->peak) {
+        stats->peak = mag;
+    }
+}
+
+/**
+ * @brief Add a run of samples
+ *
+ * For frames that are transformed where they are, unwindowed, so no
+ * copy reads them.
+ *
+ * @param[in,out] stats    Sums of the frame so far
+ * @param[in]     samples  Samples (Q15)
+ * @param[in]     count    Number of samples
+ */
+void fft_stats_add(fft_stats_t *stats, const q15_t *samples, uint32_t count);
+
+/**
+ * @brief Turn the sums of a frame into its statistics
+ *
+ * Central moments about the mean rounded to Q15, in 64-bit integers
+ * with two divisions for the kurtosis, so nothing needs an FPU. A frame
+ * whose variance rounds to 0 has a kurtosis of 0.
+ *
+ * @param[in]  stats  Sums of the frame
+ * @param[out] out    Statistics, all 0 for a frame without samples
+ *
+ * @example
+ *   static fft_stats_t stats;
+ *   fft_stats_result_t frame_stats;
+ *
+ *   fft_context_set_stats(&ctx, &stats);
+ *   fft_context_top_bins_inplace(&ctx, frame, top_bins, 5);
+ *   fft_stats_read(&stats, &frame_stats);
+ *   // frame_stats.kurtosis well above 768 hints at impacts
+ */
+void fft_stats_read(const fft_stats_t *stats, fft_stats_result_t *out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* FFT_STATS_H */
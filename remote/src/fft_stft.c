@@ -0,0 +1,132 @@
+/* ----------------------------------------------------------------------
+ * Project:      FFT Utility Functions
+ * Title:        fft_stft.c
+ * Description:  Sliding-window STFT over a ring buffer of samples
+ *
+ * Target Processor: nRF54L15 FLPR (RISC-V)
+ * -------------------------------------------------------------------- */
+
+#include "fft_stft.h"
+#include <string.h>
+
+/**
+ * @brief Prepare an STFT over a ring buffer
+ */
+rfft_status_t fft_stft_init(
+    fft_stft_t *stft,
+    q15_t *ring,
+    uint16_t fft_size,
+    uint16_t hop_size
+)
+{
+    if (stft == NULL || ring == NULL) {
+        return RFFT_ERROR_NULL_POINTER;
+    }
+
+    /* Built-in lengths are powers of two, the ring index is masked */
+    if (rfft_q15_get_instance(fft_size) == NULL ||
+        hop_size == 0 || hop_size > fft_size) {
+        return RFFT_ERROR_INVALID_SIZE;
+    }
+
+    stft->ring = ring;
+    stft->fft_size = fft_size;
+    stft->hop_size = hop_size;
+    stft->prefilter = NULL;
+    fft_stft_reset(stft);
+
+    return RFFT_SUCCESS;
+}
+
+/**
+ * @brief Forget the history, e.g. after a gap in the stream
+ */
+void fft_stft_reset(fft_stft_t *stft)
+{
+    stft->write_pos = 0;
+    stft->until_frame = stft->fft_size;
+}
+
+/**
+ * @brief Append samples to the history
+ */
+uint32_t fft_stft_push(fft_stft_t *stft, const q15_t *samples, uint32_t count)
+{
+    uint32_t total = (count < stft->until_frame) ? count : stft->until_frame;
+    uint32_t done = 0;
+
+    /* At most two runs: up to the end of the ring, then from its start */
+    while (done < total) {
+        uint32_t n = stft->fft_size - stft->write_pos;
+
+        if (n > total - done) {
+            n = total - done;
+        }
+
+        if (stft->prefilter != NULL) {
+            fft_prefilter_apply(stft->prefilter, &samples[done], &stft->ring[stft->write_pos], n);
+        } else {
+            memcpy(&stft->ring[stft->write_pos], &samples[done], n * sizeof(q15_t));
+        }
+        stft->write_pos = (stft->write_pos + n) & (stft->fft_size - 1U);
+        done += n;
+    }
+
+    stft->until_frame -= total;
+
+    return total;
+}
+
+/**
+ * @brief Copy the due frame out and start the next hop
+ */
+void fft_stft_take_frame(fft_stft_t *stft, q15_t *frame)
+{
+    /* write_pos is the oldest sample, the ring ends with the newest */
+    uint32_t head = stft->fft_size - stft->write_pos;
+
+    memcpy(frame, &stft->ring[stft->write_pos], head * sizeof(q15_t));
+    memcpy(&frame[head], stft->ring, stft->write_pos * sizeof(q15_t));
+
+    fft_stft_skip_frame(stft);
+}
+
+/**
+ * @brief Drop the due frame and start the next hop
+ */
+void fft_stft_skip_frame(fft_stft_t *stft)
+{
+    stft->until_frame = stft->hop_size;
+}
+
+/**
+ * @brief Find the top N frequency bins of the due frame
+ */
+rfft_status_t fft_stft_top_bins(
+    fft_stft_t *stft,
+    fft_context_t *ctx,
+    uint16_t *output_bin_indices,
+    uint16_t num_top_bins
+)
+{
+    if (stft == NULL || ctx == NULL || output_bin_indices == NULL ||
+        ctx->work_buffer == NULL) {
+        return RFFT_ERROR_NULL_POINTER;
+    }
+
+    if (!fft_stft_frame_ready(stft) || ctx->fft_size != stft->fft_size ||
+        num_top_bins == 0 || num_top_bins > (ctx->fft_size / 2) ||
+        num_top_bins > ctx->max_top_bins) {
+        return RFFT_ERROR_INVALID_SIZE;
+    }
+
+    /* Unwrap the ring and apply the window of ctx in one pass */
+    fft_context_load(ctx, ctx->work_buffer, &stft->ring[stft->write_pos],
+                     stft->fft_size - stft->write_pos, stft->ring);
+    fft_stft_skip_frame(stft);
+
+    fft_context_execute_loaded(ctx, ctx->work_buffer,
+                               output_bin_indices, num_top_bins);
+
+    return RFFT_SUCCESS;
+}
@@ -0,0 +1,182 @@
+/* ----------------------------------------------------------------------
+ * Project:      FFT Utility Functions
+ * Title:        fft_stft.h
+ * Description:  Sliding-window STFT over a ring buffer of samples
+ *
+ * Target Processor: nRF54L15 FLPR (RISC-V)
+ * -------------------------------------------------------------------- */
+
+#ifndef FFT_STFT_H
+#define FFT_STFT_H
+
+#include <stdbool.h>
+#include "fft_utils.h"
+#include "fft_prefilter.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Overlapping analysis frames of a sample stream
+ *
+ * The last fft_size samples are kept in a ring buffer. Incoming samples
+ * are written once, at the ring position of the oldest one; once hop_size
+ * new samples arrived, a frame of the latest fft_size samples is due. A
+ * hop of fft_size / 2 gives 50 % overlap, fft_size / 4 gives 75 %.
+ *
+ * Taking a frame unwraps the ring, oldest sample first, straight into the
+ * buffer the RFFT then transforms in place; fft_stft_top_bins() applies
+ * the window in that same copy. It is the only pass over the frame
+ * besides the RFFT itself: the history is never shifted and frames are
+ * never assembled separately.
+ */
+typedef struct {
+    q15_t *ring;            /**< fft_size samples of history */
+    uint16_t fft_size;      /**< Frame length, a built-in RFFT length */
+    uint16_t hop_size;      /**< New samples between consecutive frames */
+    uint16_t write_pos;     /**< Ring index of the oldest sample */
+    uint16_t until_frame;   /**< Samples still missing for the next frame */
+    fft_prefilter_t *prefilter; /**< Applied as samples enter the ring, or NULL */
+} fft_stft_t;
+
+/**
+ * @brief Prepare an STFT over a ring buffer
+ *
+ * @param[out] stft      STFT state to initialize
+ * @param[in]  ring      fft_size samples of history, owned by the caller
+ * @param[in]  fft_size  Frame length (RFFT_Q15_MIN_FFT_LEN to RFFT_Q15_MAX_FFT_LEN)
+ * @param[in]  hop_size  New samples per frame, 1 to fft_size
+ *
+ * @return rfft_status_t
+ *         - RFFT_SUCCESS: Operation successful
+ *         - RFFT_ERROR_NULL_POINTER: NULL pointer provided
+ *         - RFFT_ERROR_INVALID_SIZE: Invalid fft_size or hop_size
+ *
+ * @example
+ *   static q15_t ring[4096];
+ *   static q15_t work[4096] RFFT_Q15_ALIGN;
+ *   static spectral_peak_t peaks[20];
+ *   static fft_context_t ctx;
+ *   static fft_stft_t stft;
+ *   uint16_t top_bins[20];
+ *
+ *   fft_context_init(&ctx, 4096, work, peaks, 20);
+ *   fft_stft_init(&stft, ring, 4096, 1024);      // 75 % overlap
+ *
+ *   while (read_block(block, &count)) {
+ *       for (uint32_t pos = 0; pos < count; ) {
+ *           pos += fft_stft_push(&stft, &block[pos], count - pos);
+ *           if (fft_stft_frame_ready(&stft)) {
+ *               fft_stft_top_bins(&stft, &ctx, top_bins, 20);
+ *           }
+ *       }
+ *   }
+ */
+rfft_status_t fft_stft_init(
+    fft_stft_t *stft,
+    q15_t *ring,
+    uint16_t fft_size,
+    uint16_t hop_size
+);
+
+/**
+ * @brief Forget the history, e.g. after a gap in the stream
+ *
+ * The next frame is due once fft_size new samples arrived.
+ *
+ * @param[in,out] stft  Initialized STFT state
+ */
+void fft_stft_reset(fft_stft_t *stft);
+
+/**
+ * @brief Filter the samples as they are written into the ring
+ *
+ * The filter runs in the one copy of fft_stft_push(), over the stream as
+ * it arrives, each sample once however many frames it ends up in. It is
+ * not reset with the history; reset it along with fft_stft_reset() after
+ * a gap.
+ *
+ * @param[in,out] stft       Initialized STFT state
+ * @param[in]     prefilter  Initialized filter owned by the caller, NULL for none
+ */
+static inline void fft_stft_set_prefilter(fft_stft_t *stft, fft_prefilter_t *prefilter)
+{
+    stft->prefilter = prefilter;
+}
+
+/**
+ * @brief Append samples to the history
+ *
+ * Stops at the sample that completes a frame, so no frame is ever
+ * overwritten before it was taken. Call again with the rest of the
+ * samples after taking or skipping the frame.
+ *
+ * @param[in,out] stft     Initialized STFT state
+ * @param[in]     samples  New samples (Q15)
+ * @param[in]     count    Number of new samples
+ *
+ * @return Number of samples consumed, less than count when a frame is due
+ */
+uint32_t fft_stft_push(fft_stft_t *stft, const q15_t *samples, uint32_t count);
+
+/**
+ * @brief Check whether a frame is due
+ *
+ * @param[in] stft  Initialized STFT state
+ *
+ * @return true when fft_stft_push() consumes no more samples until the
+ *         frame is taken or skipped
+ */
+static inline bool fft_stft_frame_ready(const fft_stft_t *stft)
+{
+    return stft->until_frame == 0;
+}
+
+/**
+ * @brief Copy the due frame out and start the next hop
+ *
+ * @param[in,out] stft   STFT state with a frame due
+ * @param[out]    frame  fft_size samples, oldest first
+ */
+void fft_stft_take_frame(fft_stft_t *stft, q15_t *frame);
+
+/**
+ * @brief Drop the due frame and start the next hop
+ *
+ * The history is kept, so the following frame is due after hop_size
+ * samples as usual.
+ *
+ * @param[in,out] stft  STFT state with a frame due
+ */
+void fft_stft_skip_frame(fft_stft_t *stft);
+
+/**
+ * @brief Find the top N frequency bins of the due frame
+ *
+ * Takes the frame into the work buffer of ctx, applying the window of
+ * ctx in the same pass, and transforms it there.
+ *
+ * @param[in,out] stft                STFT state
+ * @param[in,out] ctx                 Context of the same fft_size, with a work buffer
+ * @param[out]    output_bin_indices  Array to store sorted bin indices (size >= num_top_bins)
+ * @param[in]     num_top_bins        Number of top bins to find, at most max_top_bins
+ *
+ * @return rfft_status_t
+ *         - RFFT_SUCCESS: Operation successful
+ *         - RFFT_ERROR_NULL_POINTER: NULL pointer or no work buffer
+ *         - RFFT_ERROR_INVALID_SIZE: No frame due, fft_size mismatch or
+ *           invalid num_top_bins
+ */
+rfft_status_t fft_stft_top_bins(
+    fft_stft_t *stft,
+    fft_context_t *ctx,
+    uint16_t *output_bin_indices,
+    uint16_t num_top_bins
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* FFT_STFT_H */
@@ -0,0 +1,868 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <errno.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+
+#include "fft_stream.h"
+#include "fft_stream_msg.h"
+
+#if defined(CONFIG_APP_FFT_LATENCY)
+#include "cycle_counter.h"
+
+/* Note when and by which message a frame was completed. */
+static inline void stamp_frame(struct fft_frame *frame, uint32_t seq)
+{
+	frame->last_seq = seq;
+	frame->recv_us = read_cycle_us();
+}
+#else
+static inline void stamp_frame(struct fft_frame *frame, uint32_t seq)
+{
+	ARG_UNUSED(frame);
+	ARG_UNUSED(seq);
+}
+#endif
+
+#if defined(CONFIG_APP_FFT_HOP_LEN) && (CONFIG_APP_FFT_HOP_LEN < CONFIG_APP_FFT_FRAME_LEN)
+/* Frames overlap, consecutive frames start APP_FFT_HOP_LEN samples apart */
+#define FFT_STREAM_STFT 1
+#include "fft_stft.h"
+#endif
+
+#if defined(CONFIG_APP_FFT_PREFILTER)
+#include "fft_prefilter.h"
+#endif
+
+#if defined(CONFIG_APP_FFT_INPUT_Q7)
+#if defined(FFT_STREAM_STFT)
+#error "APP_FFT_INPUT_Q7 cannot overlap frames"
+#endif
+#define SAMPLES_MSG FFT_STREAM_MSG_SAMPLES_Q7
+#define SAMPLES_MSG_SIZE(n) FFT_SAMPLE_BLOCK_Q7_SIZE(n)
+#else
+#define SAMPLES_MSG FFT_STREAM_MSG_SAMPLES
+#define SAMPLES_MSG_SIZE(n) FFT_SAMPLE_BLOCK_SIZE(n)
+#endif
+
+BUILD_ASSERT(RFFT_Q15_HAS_LEN(CONFIG_APP_FFT_FRAME_LEN) &&
+	     (CONFIG_APP_FFT_FRAME_LEN & (CONFIG_APP_FFT_FRAME_LEN - 1)) == 0,
+	     "APP_FFT_FRAME_LEN must be a power of two from APP_FFT_MIN_LEN to APP_FFT_MAX_LEN");
+
+#if defined(CONFIG_APP_FFT_SHM_POOL)
+#include "fft_frame_pool.h"
+
+BUILD_ASSERT(FFT_POOL_NUM_SLOTS > 0, "fft_pool cannot hold a single frame");
+
+/* The samples live in the pool, the application core owns the free list. */
+static struct fft_frame frames[FFT_POOL_NUM_SLOTS];
+
+#define FFT_STREAM_QUEUE_LEN FFT_POOL_NUM_SLOTS
+#elif defined(CONFIG_APP_FFT_HOLD_RX)
+BUILD_ASSERT(CONFIG_APP_FFT_BLOCK_SAMPLES == CONFIG_APP_FFT_FRAME_LEN,
+	     "APP_FFT_HOLD_RX needs sample blocks of a whole frame");
+#if defined(FFT_STREAM_STFT)
+#error "APP_FFT_HOLD_RX cannot overlap frames"
+#endif
+#if defined(CONFIG_APP_FFT_RETRANSMIT)
+#error "APP_FFT_RETRANSMIT needs the frames assembled from the blocks"
+#endif
+
+/* The samples stay in the receive buffers, only the descriptors are ours. */
+static struct fft_frame frames[CONFIG_APP_FFT_HOLD_RX_FRAMES];
+
+K_MSGQ_DEFINE(free_frames, sizeof(struct fft_frame *), CONFIG_APP_FFT_HOLD_RX_FRAMES, 4);
+#define FFT_STREAM_QUEUE_LEN CONFIG_APP_FFT_HOLD_RX_FRAMES
+
+static struct ipc_ept *rx_ep;
+static uint32_t next_block_seq;
+static bool synced;
+#else
+/* The samples are carved out of the arena, as many frames as fit. */
+static struct fft_frame frames[FFT_STREAM_NUM_FRAMES];
+
+K_MSGQ_DEFINE(free_frames, sizeof(struct fft_frame *), FFT_STREAM_NUM_FRAMES, 4);
+#define FFT_STREAM_QUEUE_LEN FFT_STREAM_NUM_FRAMES
+
+/* Assembly state, only touched from the IPC receive context. */
+#if defined(FFT_STREAM_STFT)
+#if defined(CONFIG_APP_FFT_RETRANSMIT)
+#error "APP_FFT_RETRANSMIT cannot overlap frames"
+#endif
+static fft_stft_t stft;
+#elif defined(CONFIG_APP_FFT_RETRANSMIT)
+/*
+ * Frame being assembled from the blocks first_seq on, with a bit set for
+ * each of them still missing. A block sent again lands in its place.
+ */
+struct open_frame {
+	struct fft_frame *frame;
+	uint32_t first_seq;
+	uint64_t missing;
+};
+
+static struct open_frame open_frames[FFT_STREAM_NUM_FRAMES];
+static uint32_t num_open;
+static uint32_t blocks_per_frame;
+/* First block of the stream, frames start every blocks_per_frame blocks from it. */
+static uint32_t origin_seq;
+/* First block of the newest frame opened, older frames are done or given up. */
+static uint32_t newest_seq;
+static bool opened;
+static fft_stream_gap_cb_t gap_cb;
+#else
+static struct fft_frame *fill_frame;
+static uint32_t fill_pos;
+#endif
+#if defined(CONFIG_APP_FFT_PREFILTER)
+#if defined(CONFIG_APP_FFT_RETRANSMIT)
+#error "APP_FFT_PREFILTER needs the blocks in stream order"
+#endif
+/* DC blocker and pre-emphasis, run over the stream as it is copied in. */
+static fft_prefilter_t prefilter;
+#endif
+/* Samples per frame of the current setup. */
+static uint32_t cur_frame_len;
+static uint32_t next_block_seq;
+static uint32_t next_frame_seq;
+static bool synced;
+#if defined(CONFIG_APP_FFT_RECONFIG)
+/* Set by the receive path, cleared once the stream is set up again. */
+static bool suspended;
+#endif
+#endif
+
+static struct fft_stream_stats stats;
+
+/*
+ * Frames queued or in the FFT, the difference of two counters written by
+ * one side each, so the receive path takes no lock for it.
+ */
+static uint32_t frames_queued;
+static uint32_t frames_released;
+
+/* Count a frame handed to the consumer, late if it still has the one before. */
+static void frame_queued(void)
+{
+	uint32_t in_use = frames_queued + 1 - __atomic_load_n(&frames_released, __ATOMIC_ACQUIRE);
+
+	if (in_use > 1) {
+		stats.late_frames++;
+	}
+	if (in_use > stats.queue_high_water) {
+		stats.queue_high_water = in_use;
+	}
+	__atomic_store_n(&frames_queued, frames_queued + 1, __ATOMIC_RELEASE);
+}
+
+static void frame_released(void)
+{
+	__atomic_store_n(&frames_released, frames_released + 1, __ATOMIC_RELEASE);
+}
+
+#if !defined(CONFIG_APP_FFT_SHM_POOL)
+/* Set from the first drop for want of a frame buffer to the next buffer found free. */
+static bool overrun;
+
+/* Take a free frame buffer, false if there is none, which starts an overrun. */
+static bool free_frame_get(struct fft_frame **frame)
+{
+	if (k_msgq_get(&free_frames, frame, K_NO_WAIT) != 0) {
+		if (!overrun) {
+			overrun = true;
+			stats.overruns++;
+		}
+		return false;
+	}
+	overrun = false;
+
+	return true;
+}
+#endif
+
+#if defined(CONFIG_APP_FFT_WORKER)
+#include "fft_spsc.h"
+
+/*
+ * The receive path hands frames to the worker without a lock, and wakes it
+ * with a semaphore, which is safe to give from an interrupt.
+ */
+static void *ready_slots[FFT_SPSC_SLOTS(FFT_STREAM_QUEUE_LEN)];
+static struct fft_spsc ready_frames;
+static K_SEM_DEFINE(ready_sem, 0, K_SEM_MAX_LIMIT);
+
+/* Frames the stream was set up with, fewer than the queue holds if the arena is short. */
+static uint32_t frames_total;
+static K_SEM_DEFINE(flow_sem, 0, 1);
+static bool flow_paused;
+
+/*
+ * Only while the receive path is stopped, at startup or suspended. The flow
+ * thread may be running, so the counters are not cleared under it; nothing
+ * is in use from here and it is woken to resume blocks it paused.
+ */
+static void ready_reset(uint32_t num_frames)
+{
+	fft_spsc_init(&ready_frames, ready_slots, ARRAY_SIZE(ready_slots));
+	frames_total = num_frames;
+	k_sem_reset(&ready_sem);
+	__atomic_store_n(&frames_released, frames_queued, __ATOMIC_RELEASE);
+	k_sem_give(&flow_sem);
+}
+
+#if defined(CONFIG_APP_FFT_RECONFIG) || defined(CONFIG_APP_FFT_CTRL)
+/* Wake the consumer without a frame. */
+static void ready_cancel(void)
+{
+	k_sem_give(&ready_sem);
+}
+#endif
+
+static int ready_put(struct fft_frame *frame)
+{
+	if (!fft_spsc_put(&ready_frames, frame)) {
+		return -ENOMSG;
+	}
+
+	frame_queued();
+	k_sem_give(&ready_sem);
+	k_sem_give(&flow_sem);
+
+	return 0;
+}
+
+static void ready_done(void)
+{
+	frame_released();
+	k_sem_give(&flow_sem);
+}
+
+int fft_stream_get_frame(struct fft_frame **frame, k_timeout_t timeout)
+{
+	void *item;
+	int ret;
+
+	ret = k_sem_take(&ready_sem, timeout);
+	if (ret < 0) {
+		return ret;
+	}
+
+	/* Every other count of the semaphore is a queued frame. */
+	if (!fft_spsc_get(&ready_frames, &item)) {
+		return -ECANCELED;
+	}
+	*frame = item;
+
+	return 0;
+}
+
+int fft_stream_wait_flow(bool *paused, k_timeout_t timeout)
+{
+	uint32_t in_use;
+	bool full;
+	int ret;
+
+	do {
+		ret = k_sem_take(&flow_sem, timeout);
+		if (ret < 0) {
+			return ret;
+		}
+
+		in_use = __atomic_load_n(&frames_queued, __ATOMIC_ACQUIRE) -
+			 __atomic_load_n(&frames_released, __ATOMIC_ACQUIRE);
+		/* No frame left to fill, every further block would be dropped. */
+		full = (in_use >= frames_total);
+	} while (full == flow_paused);
+
+	flow_paused = full;
+	*paused = full;
+
+	return 0;
+}
+#else
+K_MSGQ_DEFINE(ready_frames, sizeof(struct fft_frame *), FFT_STREAM_QUEUE_LEN, 4);
+
+static void ready_reset(uint32_t num_frames)
+{
+	ARG_UNUSED(num_frames);
+
+	k_msgq_purge(&ready_frames);
+	__atomic_store_n(&frames_released, frames_queued, __ATOMIC_RELEASE);
+}
+
+#if defined(CONFIG_APP_FFT_RECONFIG) || defined(CONFIG_APP_FFT_CTRL)
+/* Wake the consumer without a frame, a full queue wakes it anyway. */
+static void ready_cancel(void)
+{
+	struct fft_frame *none = NULL;
+
+	(void)k_msgq_put(&ready_frames, &none, K_NO_WAIT);
+}
+#endif
+
+static int ready_put(struct fft_frame *frame)
+{
+	int ret = k_msgq_put(&ready_frames, &frame, K_NO_WAIT);
+
+	if (ret == 0) {
+		frame_queued();
+	}
+
+	return ret;
+}
+
+static void ready_done(void)
+{
+	frame_released();
+}
+
+int fft_stream_get_frame(struct fft_frame **frame, k_timeout_t timeout)
+{
+	int ret = k_msgq_get(&ready_frames, frame, timeout);
+
+	if ((ret == 0) && (*frame == NULL)) {
+		return -ECANCELED;
+	}
+
+	return ret;
+}
+#endif /* CONFIG_APP_FFT_WORKER */
+
+#if defined(CONFIG_APP_FFT_SHM_POOL)
+int fft_stream_init(struct ipc_ept *ep, struct fft_arena *arena, uint32_t frame_len)
+{
+	ARG_UNUSED(ep);
+	ARG_UNUSED(arena);
+
+	/* The application core lays out the pool slots. */
+	if (frame_len != CONFIG_APP_FFT_FRAME_LEN) {
+		return -EINVAL;
+	}
+
+	ready_reset(ARRAY_SIZE(frames));
+
+	for (size_t i = 0; i < ARRAY_SIZE(frames); i++) {
+		frames[i].slot = i;
+		frames[i].samples = fft_pool_slot(i);
+	}
+
+	memset(&stats, 0, sizeof(stats));
+
+	return 0;
+}
+
+void fft_stream_push_block(const void *data, size_t len)
+{
+	const struct fft_stream_hdr *desc = data;
+	struct fft_frame *frame;
+
+	if ((len < sizeof(*desc)) ||
+	    (desc->type != FFT_STREAM_MSG_FRAME) ||
+	    (desc->slot >= ARRAY_SIZE(frames)) ||
+	    (desc->count != CONFIG_APP_FFT_FRAME_LEN)) {
+		stats.bad_blocks++;
+		return;
+	}
+
+	frame = &frames[desc->slot];
+	frame->seq = desc->seq;
+	stamp_frame(frame, desc->seq);
+
+	/* The application core wrote the slot behind any cache we may have. */
+	fft_cache_invd(frame->samples, FFT_POOL_SLOT_SIZE);
+
+	if (ready_put(frame) != 0) {
+		/* Only possible if a slot was sent twice. */
+		stats.bad_blocks++;
+		return;
+	}
+
+	stats.blocks++;
+	stats.frames++;
+}
+
+void fft_stream_release_frame(struct fft_frame *frame)
+{
+	/* The slot goes back to the application core with the result. */
+	ARG_UNUSED(frame);
+	ready_done();
+}
+#elif defined(CONFIG_APP_FFT_HOLD_RX)
+int fft_stream_init(struct ipc_ept *ep, struct fft_arena *arena, uint32_t frame_len)
+{
+	struct fft_frame *frame;
+
+	ARG_UNUSED(arena);
+
+	/* Each frame is a block, as long as the application core sends them. */
+	if (frame_len != CONFIG_APP_FFT_FRAME_LEN) {
+		return -EINVAL;
+	}
+
+	rx_ep = ep;
+
+	k_msgq_purge(&free_frames);
+	ready_reset(CONFIG_APP_FFT_HOLD_RX_FRAMES);
+
+	for (int i = 0; i < CONFIG_APP_FFT_HOLD_RX_FRAMES; i++) {
+		frame = &frames[i];
+		k_msgq_put(&free_frames, &frame, K_NO_WAIT);
+	}
+
+	next_block_seq = 0;
+	synced = false;
+	overrun = false;
+	memset(&stats, 0, sizeof(stats));
+
+	return 0;
+}
+
+void fft_stream_push_block(const void *data, size_t len)
+{
+	const struct fft_sample_block *blk = data;
+	struct fft_frame *frame;
+
+	if ((len < sizeof(struct fft_stream_hdr)) ||
+	    (blk->hdr.type != FFT_STREAM_MSG_SAMPLES) ||
+	    (blk->hdr.count != CONFIG_APP_FFT_FRAME_LEN) ||
+	    (len < FFT_SAMPLE_BLOCK_SIZE(CONFIG_APP_FFT_FRAME_LEN)) ||
+	    (((uintptr_t)blk->samples & 3) != 0)) {
+		stats.bad_blocks++;
+		return;
+	}
+
+	if (synced && (blk->hdr.seq != next_block_seq)) {
+		/* Every block is a frame of its own, nothing to discard. */
+		stats.lost_blocks += blk->hdr.seq - next_block_seq;
+	}
+	synced = true;
+	next_block_seq = blk->hdr.seq + 1;
+
+	if (!free_frame_get(&frame)) {
+		/* Consumer is behind, the buffer is released on return. */
+		stats.dropped_blocks++;
+		return;
+	}
+
+	if (ipc_service_hold_rx_buffer(rx_ep, (void *)data) < 0) {
+		(void)k_msgq_put(&free_frames, &frame, K_NO_WAIT);
+		stats.dropped_blocks++;
+		return;
+	}
+
+	/* Held, the buffer is ours to run the FFT on in place. */
+	frame->rx_buf = data;
+	frame->samples = (q15_t *)blk->samples;
+	frame->seq = blk->hdr.seq;
+	stamp_frame(frame, blk->hdr.seq);
+	/* Cannot fail, the queue holds every frame there is. */
+	(void)ready_put(frame);
+
+	stats.blocks++;
+	stats.frames++;
+}
+
+void fft_stream_release_frame(struct fft_frame *frame)
+{
+	/* Hands the blocks back to the application core. */
+	(void)ipc_service_release_rx_buffer(rx_ep, (void *)frame->rx_buf);
+	frame->rx_buf = NULL;
+	frame->samples = NULL;
+	(void)k_msgq_put(&free_frames, &frame, K_NO_WAIT);
+	ready_done();
+}
+#else
+int fft_stream_init(struct ipc_ept *ep, struct fft_arena *arena, uint32_t frame_len)
+{
+	struct fft_frame *frame;
+#if defined(FFT_STREAM_STFT)
+	q15_t *ring;
+#endif
+	int num_frames = 0;
+
+	ARG_UNUSED(ep);
+
+	if (!RFFT_Q15_HAS_LEN(frame_len) || ((frame_len & (frame_len - 1)) != 0)) {
+		return -EINVAL;
+	}
+
+#if defined(FFT_STREAM_STFT)
+	if (frame_len < CONFIG_APP_FFT_HOP_LEN) {
+		return -EINVAL;
+	}
+#elif defined(CONFIG_APP_FFT_RETRANSMIT)
+	/* A block belongs to one frame, and a frame has a bit per block. */
+	if (((frame_len % CONFIG_APP_FFT_BLOCK_SAMPLES) != 0) ||
+	    (frame_len / CONFIG_APP_FFT_BLOCK_SAMPLES > 64)) {
+		return -EINVAL;
+	}
+#endif
+
+	k_msgq_purge(&free_frames);
+
+#if defined(FFT_STREAM_STFT)
+	/* The history goes first, without it no frame can be assembled. */
+	ring = FFT_ARENA_ALLOC_ARRAY(arena, q15_t, frame_len);
+	if (ring == NULL) {
+		return -ENOMEM;
+	}
+#endif
+
+	while (num_frames < FFT_STREAM_NUM_FRAMES) {
+		frame = &frames[num_frames];
+		frame->samples = FFT_ARENA_ALLOC_ARRAY(arena, fft_sample_t, frame_len);
+		if (frame->samples == NULL) {
+			break;
+		}
+		k_msgq_put(&free_frames, &frame, K_NO_WAIT);
+		num_frames++;
+	}
+
+	if (num_frames == 0) {
+		return -ENOMEM;
+	}
+
+	ready_reset(num_frames);
+
+#if defined(CONFIG_APP_FFT_PREFILTER)
+	fft_prefilter_init(&prefilter, CONFIG_APP_FFT_DC_BLOCK_POLE, CONFIG_APP_FFT_PREEMPHASIS);
+#endif
+#if defined(FFT_STREAM_STFT)
+	(void)fft_stft_init(&stft, ring, frame_len, CONFIG_APP_FFT_HOP_LEN);
+#if defined(CONFIG_APP_FFT_PREFILTER)
+	fft_stft_set_prefilter(&stft, &prefilter);
+#endif
+#elif defined(CONFIG_APP_FFT_RETRANSMIT)
+	blocks_per_frame = frame_len / CONFIG_APP_FFT_BLOCK_SAMPLES;
+	num_open = 0;
+	opened = false;
+#else
+	fill_frame = NULL;
+	fill_pos = 0;
+#endif
+	cur_frame_len = frame_len;
+	next_frame_seq = 0;
+	synced = false;
+	overrun = false;
+	memset(&stats, 0, sizeof(stats));
+
+#if defined(CONFIG_APP_FFT_RECONFIG)
+	/* Publishes the new frames before the receive path may fill them. */
+	__atomic_store_n(&suspended, false, __ATOMIC_RELEASE);
+#endif
+
+	return 0;
+}
+
+#if defined(CONFIG_APP_FFT_RECONFIG)
+void fft_stream_suspend(void)
+{
+	__atomic_store_n(&suspended, true, __ATOMIC_RELEASE);
+	ready_cancel();
+}
+
+bool fft_stream_suspended(void)
+{
+	return __atomic_load_n(&suspended, __ATOMIC_ACQUIRE);
+}
+#else
+static inline bool fft_stream_suspended(void)
+{
+	return false;
+}
+#endif
+
+#if defined(CONFIG_APP_FFT_CTRL)
+void fft_stream_wake(void)
+{
+	ready_cancel();
+}
+#endif
+
+#if defined(CONFIG_APP_FFT_RETRANSMIT)
+void fft_stream_set_gap_cb(fft_stream_gap_cb_t cb)
+{
+	gap_cb = cb;
+}
+#endif
+
+/* Check a sample block and its place in the sequence, false if it is unusable. */
+static bool accept_block(const struct fft_sample_block *blk, size_t len)
+{
+	if (fft_stream_suspended()) {
+		/* Frames of the next setup start from a fresh sequence. */
+		return false;
+	}
+
+	if ((len < sizeof(struct fft_stream_hdr)) ||
+	    (blk->hdr.type != SAMPLES_MSG) ||
+	    (len < SAMPLES_MSG_SIZE(blk->hdr.count))) {
+		stats.bad_blocks++;
+		return false;
+	}
+
+	if (synced && (blk->hdr.seq != next_block_seq)) {
+#if defined(CONFIG_APP_FFT_RETRANSMIT)
+		if ((int32_t)(blk->hdr.seq - next_block_seq) < 0) {
+			/* Sent again, its frame may still be waiting for it. */
+			return true;
+		}
+		/* The frames wait for the missing blocks to be sent again. */
+		if (gap_cb != NULL) {
+			gap_cb(next_block_seq, blk->hdr.seq - next_block_seq);
+		}
+#else
+		/* A block went missing, the partial frame is unusable. */
+		stats.lost_blocks += blk->hdr.seq - next_block_seq;
+#if defined(FFT_STREAM_STFT)
+		fft_stft_reset(&stft);
+#else
+		fill_pos = 0;
+#endif
+#if defined(CONFIG_APP_FFT_PREFILTER)
+		fft_prefilter_reset(&prefilter);
+#endif
+#endif
+	}
+#if defined(CONFIG_APP_FFT_RETRANSMIT)
+	if (!synced) {
+		origin_seq = blk->hdr.seq;
+	}
+#endif
+	synced = true;
+	next_block_seq = blk->hdr.seq + 1;
+
+	return true;
+}
+
+#if defined(FFT_STREAM_STFT)
+void fft_stream_push_block(const void *data, size_t len)
+{
+	const struct fft_sample_block *blk = data;
+	uint32_t count;
+	uint32_t pos = 0;
+	struct fft_frame *frame;
+
+	if (!accept_block(blk, len)) {
+		return;
+	}
+
+	count = blk->hdr.count;
+
+	while (pos < count) {
+		pos += fft_stft_push(&stft, &blk->samples[pos], count - pos);
+
+		if (!fft_stft_frame_ready(&stft)) {
+			break;
+		}
+
+		if (!free_frame_get(&frame)) {
+			/* Consumer is behind, skip this hop but keep the history. */
+			fft_stft_skip_frame(&stft);
+			stats.dropped_frames++;
+			continue;
+		}
+
+		/* The one copy of the frame, into the buffer the FFT runs in. */
+		fft_stft_take_frame(&stft, frame->samples);
+		frame->seq = next_frame_seq++;
+		stamp_frame(frame, blk->hdr.seq);
+		/* Cannot fail, the queue holds every frame there is. */
+		(void)ready_put(frame);
+		stats.frames++;
+	}
+
+	stats.blocks++;
+}
+#elif defined(CONFIG_APP_FFT_RETRANSMIT)
+/* Take an open frame off the list, oldest first. */
+static void open_frame_remove(uint32_t i)
+{
+	num_open--;
+	memmove(&open_frames[i], &open_frames[i + 1], (num_open - i) * sizeof(open_frames[0]));
+}
+
+/*
+ * Give up on frames whose missing blocks have left the window of the
+ * application core by now, they cannot be sent again.
+ */
+static void open_frames_expire(uint32_t seq)
+{
+	while ((num_open > 0) &&
+	       (seq - open_frames[0].first_seq >= blocks_per_frame +
+						   CONFIG_APP_FFT_RETRANSMIT_WINDOW)) {
+		stats.lost_blocks += __builtin_popcountll(open_frames[0].missing);
+		(void)k_msgq_put(&free_frames, &open_frames[0].frame, K_NO_WAIT);
+		open_frame_remove(0);
+	}
+}
+
+/* Open frame the block of first_seq on belongs to, NULL if it is done or has no buffer. */
+static struct open_frame *open_frame_get(uint32_t first_seq)
+{
+	struct open_frame *of;
+	struct fft_frame *frame;
+
+	for (uint32_t i = 0; i < num_open; i++) {
+		if (open_frames[i].first_seq == first_seq) {
+			return &open_frames[i];
+		}
+	}
+
+	if (opened && ((int32_t)(first_seq - newest_seq) <= 0)) {
+		/* Completed, or given up and counted as lost. */
+		return NULL;
+	}
+
+	if (!free_frame_get(&frame)) {
+		/*
+		 * Consumer is behind, give up on the whole frame: opened later
+		 * by another of its blocks, it would wait for this one, which
+		 * is never asked for again. Its blocks are all dropped.
+		 */
+		stats.dropped_blocks += blocks_per_frame;
+		newest_seq = first_seq;
+		opened = true;
+		return NULL;
+	}
+
+	of = &open_frames[num_open++];
+	of->frame = frame;
+	of->first_seq = first_seq;
+	of->missing = (blocks_per_frame == 64) ? UINT64_MAX : (BIT64(blocks_per_frame) - 1);
+	newest_seq = first_seq;
+	opened = true;
+
+	return of;
+}
+
+void fft_stream_push_block(const void *data, size_t len)
+{
+	const struct fft_sample_block *blk = data;
+	struct open_frame *of;
+	struct fft_frame *frame;
+	uint32_t offset;
+	uint32_t bit;
+
+	if (!accept_block(blk, len)) {
+		return;
+	}
+
+	/* Fixed block size, the sequence number is the place in the stream. */
+	if (blk->hdr.count != CONFIG_APP_FFT_BLOCK_SAMPLES) {
+		stats.bad_blocks++;
+		return;
+	}
+
+	offset = blk->hdr.seq - origin_seq;
+	if ((int32_t)offset < 0) {
+		/* Sent again from before the stream synced. */
+		return;
+	}
+
+	open_frames_expire(next_block_seq - 1);
+
+	bit = offset % blocks_per_frame;
+	of = open_frame_get(blk->hdr.seq - bit);
+	if ((of == NULL) || ((of->missing & BIT64(bit)) == 0)) {
+		return;
+	}
+
+	memcpy(&of->frame->samples[bit * CONFIG_APP_FFT_BLOCK_SAMPLES], blk->samples,
+	       CONFIG_APP_FFT_BLOCK_SAMPLES * sizeof(q15_t));
+	of->missing &= ~BIT64(bit);
+	if (blk->hdr.seq != next_block_seq - 1) {
+		stats.resent_blocks++;
+	}
+	stats.blocks++;
+
+	if (of->missing != 0) {
+		return;
+	}
+
+	frame = of->frame;
+	frame->seq = next_frame_seq++;
+	stamp_frame(frame, blk->hdr.seq);
+#if defined(CONFIG_APP_FFT_ORDER)
+	/* Frames given up on leave a gap in the stream positions. */
+	frame->end_pos = (of->first_seq + blocks_per_frame) * CONFIG_APP_FFT_BLOCK_SAMPLES;
+#endif
+	open_frame_remove(of - open_frames);
+	/* Cannot fail, the queue holds every frame there is. */
+	(void)ready_put(frame);
+	stats.frames++;
+}
+#else
+void fft_stream_push_block(const void *data, size_t len)
+{
+	const struct fft_sample_block *blk = data;
+#if defined(CONFIG_APP_FFT_INPUT_Q7)
+	const fft_sample_t *in = ((const struct fft_sample_block_q7 *)data)->samples;
+#else
+	const fft_sample_t *in = blk->samples;
+#endif
+	uint32_t count;
+	uint32_t pos = 0;
+
+	if (!accept_block(blk, len)) {
+		return;
+	}
+
+	count = blk->hdr.count;
+
+	while (pos < count) {
+		uint32_t n;
+
+		if ((fill_frame == NULL) && !free_frame_get(&fill_frame)) {
+			/* Consumer is behind, drop the rest of the block. */
+			fill_frame = NULL;
+			stats.dropped_blocks++;
+#if defined(CONFIG_APP_FFT_PREFILTER)
+			fft_prefilter_reset(&prefilter);
+#endif
+			return;
+		}
+
+		n = MIN(count - pos, cur_frame_len - fill_pos);
+#if defined(CONFIG_APP_FFT_PREFILTER)
+		fft_prefilter_apply(&prefilter, &in[pos], &fill_frame->samples[fill_pos], n);
+#else
+		memcpy(&fill_frame->samples[fill_pos], &in[pos], n * sizeof(fft_sample_t));
+#endif
+		fill_pos += n;
+		pos += n;
+
+		if (fill_pos == cur_frame_len) {
+			fill_frame->seq = next_frame_seq++;
+			stamp_frame(fill_frame, blk->hdr.seq);
+#if defined(CONFIG_APP_FFT_ORDER)
+			/* Tells the resampler whether the frame continues the one before. */
+			fill_frame->end_pos = blk->hdr.seq * CONFIG_APP_FFT_BLOCK_SAMPLES + pos;
+#endif
+			/* Cannot fail, the queue holds every frame there is. */
+			(void)ready_put(fill_frame);
+			fill_frame = NULL;
+			fill_pos = 0;
+			stats.frames++;
+		}
+	}
+
+	stats.blocks++;
+}
+#endif /* FFT_STREAM_STFT */
+
+void fft_stream_release_frame(struct fft_frame *frame)
+{
+	(void)k_msgq_put(&free_frames, &frame, K_NO_WAIT);
+	ready_done();
+}
+#endif /* CONFIG_APP_FFT_SHM_POOL */
+
+void fft_stream_get_stats(struct fft_stream_stats *out)
+{
+	*out = stats;
+}
@@ -0,0 +1,209 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef FFT_STREAM_H
+#define FFT_STREAM_H
+
+#include <zephyr/kernel.h>
+#include <zephyr/ipc/ipc_service.h>
+#include "rfft_q15_simplified.h"
+#include "fft_arena.h"
+
+/** Frame buffers of the assembler, at most; none of its own with the pool or held buffers. */
+#if defined(CONFIG_APP_FFT_STREAM_FRAMES)
+#define FFT_STREAM_NUM_FRAMES CONFIG_APP_FFT_STREAM_FRAMES
+#else
+#define FFT_STREAM_NUM_FRAMES 1
+#endif
+
+/** Sample of a frame, 8 bits with CONFIG_APP_FFT_INPUT_Q7, widened for the FFT. */
+#if defined(CONFIG_APP_FFT_INPUT_Q7)
+typedef int8_t fft_sample_t;
+#else
+typedef q15_t fft_sample_t;
+#endif
+
+/**
+ * Bytes fft_stream_init() takes from the arena for @p n frame buffers of
+ * @p len samples, and the history of the sliding window with
+ * CONFIG_APP_FFT_HOP_LEN. Nothing with the shared frame pool or
+ * CONFIG_APP_FFT_HOLD_RX.
+ */
+#if defined(CONFIG_APP_FFT_SHM_POOL) || defined(CONFIG_APP_FFT_HOLD_RX)
+#define FFT_STREAM_ARENA_SIZE(n, len) 0
+#elif defined(CONFIG_APP_FFT_HOP_LEN) && (CONFIG_APP_FFT_HOP_LEN < CONFIG_APP_FFT_FRAME_LEN)
+#define FFT_STREAM_ARENA_SIZE(n, len) (((n) + 1) * FFT_ARENA_SIZE((len) * sizeof(q15_t)))
+#else
+#define FFT_STREAM_ARENA_SIZE(n, len) ((n) * FFT_ARENA_SIZE((len) * sizeof(fft_sample_t)))
+#endif
+
+/**
+ * Frame of CONFIG_APP_FFT_FRAME_LEN samples, or of the length the stream
+ * was last set up with under CONFIG_APP_FFT_RECONFIG, assembled from consecutive
+ * sample blocks, handed over in the shared frame pool, or with
+ * CONFIG_APP_FFT_HOLD_RX left in the IPC receive buffer it arrived in. With
+ * CONFIG_APP_FFT_HOP_LEN below the frame length, a frame is taken from the
+ * sliding window every CONFIG_APP_FFT_HOP_LEN samples. The
+ * consumer owns the samples until it releases the frame and may overwrite
+ * them, e.g. by running the FFT in place.
+ */
+struct fft_frame {
+	uint32_t seq;
+	uint8_t slot;     /**< Shared frame pool slot, CONFIG_APP_FFT_SHM_POOL only. */
+	fft_sample_t *samples;
+#if defined(CONFIG_APP_FFT_HOLD_RX)
+	const void *rx_buf;  /**< Held receive buffer the samples lie in. */
+#endif
+#if defined(CONFIG_APP_FFT_LATENCY)
+	uint32_t last_seq;  /**< Sequence number of the message that completed the frame. */
+	uint32_t recv_us;   /**< read_cycle_us() when the frame completed. */
+#endif
+#if defined(CONFIG_APP_FFT_ORDER)
+	uint32_t end_pos;   /**< Stream position after the last sample, as of the blocks. */
+#endif
+};
+
+struct fft_stream_stats {
+	uint32_t blocks;          /**< Sample blocks accepted. */
+	uint32_t frames;          /**< Frames completed. */
+	uint32_t lost_blocks;     /**< Blocks missing from the sequence. */
+	uint32_t dropped_blocks;  /**< Blocks discarded, no free frame buffer or held buffer. */
+	uint32_t dropped_frames;  /**< Overlapping frames skipped, no free frame buffer. */
+	uint32_t bad_blocks;      /**< Malformed messages. */
+	uint32_t resent_blocks;   /**< Blocks of a gap sent again in time, CONFIG_APP_FFT_RETRANSMIT. */
+	uint32_t overruns;        /**< Runs of drops, from no free frame buffer to the next one. */
+	uint32_t late_frames;     /**< Frames completed while the one before was queued or in the FFT. */
+	uint32_t queue_high_water; /**< Most frames queued or in the FFT at once. */
+};
+
+/**
+ * @brief Reset the assembler and return all frames to the free list.
+ *
+ * The frame buffers are taken from @p arena, as many as fit up to
+ * FFT_STREAM_NUM_FRAMES, so call it once per reset of the arena. Under
+ * CONFIG_APP_FFT_RECONFIG it is called again, after fft_stream_suspend(),
+ * to assemble frames of another length.
+ *
+ * @param ep        Endpoint the blocks arrive on. With CONFIG_APP_FFT_HOLD_RX
+ *                  its receive buffers are held and released, otherwise unused.
+ * @param arena     Arena for the frame buffers, unused with the shared frame
+ *                  pool or CONFIG_APP_FFT_HOLD_RX.
+ * @param frame_len Samples per frame, CONFIG_APP_FFT_FRAME_LEN unless the
+ *                  assembler is in use.
+ *
+ * @retval 0 on success, -ENOMEM if not even one frame buffer fits, -EINVAL
+ *         if the frame length is not supported.
+ */
+int fft_stream_init(struct ipc_ept *ep, struct fft_arena *arena, uint32_t frame_len);
+
+#if defined(CONFIG_APP_FFT_RECONFIG)
+/**
+ * @brief Stop assembling frames until fft_stream_init() is called again.
+ *
+ * Call from the context the sample blocks arrive in, so that none is
+ * being assembled, after anything the consumer is to find with
+ * fft_stream_suspended(). Blocks that follow are dropped, and a waiting
+ * fft_stream_get_frame() returns -ECANCELED, so the consumer may
+ * release its frame and set up the stream again.
+ */
+void fft_stream_suspend(void);
+
+/**
+ * @brief Check on the consumer side whether the stream was suspended.
+ *
+ * @return true from fft_stream_suspend() to the next fft_stream_init().
+ */
+bool fft_stream_suspended(void);
+#endif
+
+#if defined(CONFIG_APP_FFT_CTRL)
+/**
+ * @brief Make a waiting fft_stream_get_frame() return -ECANCELED.
+ *
+ * For the consumer to handle something other than a frame. With frames
+ * queued it may get a frame first, so it checks for the work after every
+ * frame as well.
+ */
+void fft_stream_wake(void);
+#endif
+
+#if defined(CONFIG_APP_FFT_RETRANSMIT)
+/**
+ * @brief Called from fft_stream_push_block() on a gap in the block sequence.
+ *
+ * @param first_seq Sequence number of the first block missing.
+ * @param count     Blocks missing from it on.
+ */
+typedef void (*fft_stream_gap_cb_t)(uint32_t first_seq, uint32_t count);
+
+/**
+ * @brief Set the callback that asks for the blocks of a gap again.
+ *
+ * The frames with blocks missing wait for them until the application core
+ * has sent CONFIG_APP_FFT_RETRANSMIT_WINDOW blocks past the frame, and are
+ * given up then. Frames may complete out of order.
+ *
+ * @param cb Callback, NULL for none.
+ */
+void fft_stream_set_gap_cb(fft_stream_gap_cb_t cb);
+#endif
+
+/**
+ * @brief Append a sample block message to the frame being assembled.
+ *
+ * Safe to call from the IPC receive callback, it never blocks. A gap in the
+ * block sequence discards the partially assembled frame, or the sliding
+ * window history with CONFIG_APP_FFT_HOP_LEN, unless with
+ * CONFIG_APP_FFT_RETRANSMIT the blocks are sent again. With
+ * CONFIG_APP_FFT_SHM_POOL the message is a frame descriptor instead, and
+ * the frame it points to is queued as is. With CONFIG_APP_FFT_HOLD_RX the
+ * message is a whole frame, queued without a copy; the call must then come
+ * from the receive callback of the endpoint, so that the buffer can be
+ * held.
+ *
+ * @param data Received message, starting with struct fft_stream_hdr.
+ * @param len  Length of the message in bytes.
+ */
+void fft_stream_push_block(const void *data, size_t len);
+
+/**
+ * @brief Wait for the next complete frame.
+ *
+ * @param frame   Set to the completed frame.
+ * @param timeout Time to wait for a frame.
+ *
+ * @retval 0 on success, -EAGAIN on timeout, -ECANCELED after
+ *         fft_stream_suspend() or fft_stream_wake().
+ */
+int fft_stream_get_frame(struct fft_frame **frame, k_timeout_t timeout);
+
+/**
+ * @brief Return a frame obtained from fft_stream_get_frame() to the free list.
+ *
+ * With CONFIG_APP_FFT_HOLD_RX this also releases its receive buffer, the
+ * samples must not be touched afterwards.
+ */
+void fft_stream_release_frame(struct fft_frame *frame);
+
+#if defined(CONFIG_APP_FFT_WORKER)
+/**
+ * @brief Wait for the frame queue to fill up or to drain again.
+ *
+ * The queue is full when every frame is queued or in the FFT, so the
+ * blocks that follow would be dropped until one is released. Call from one
+ * thread only, which tells the application core to pause and resume.
+ *
+ * @param paused  Set to true when the queue filled up, false when it drained.
+ * @param timeout Time to wait for a change.
+ *
+ * @retval 0 on a change, -EAGAIN on timeout.
+ */
+int fft_stream_wait_flow(bool *paused, k_timeout_t timeout);
+#endif
+
+void fft_stream_get_stats(struct fft_stream_stats *stats);
+
+#endif /* FFT_STREAM_H */
@@ -9,121 +9,1666 @@
 #include "fft_utils.h"
 #include <string.h>
 
-/* Static buffers for FFT processing */
-#ifdef ENABLE_FFT_8K
-static q15_t fft_input_buffer[8192];   /* Max FFT size: 8192 */
-static q15_t fft_output_buffer[16384]; /* 2 * max FFT size for complex output */
+/* Buffers of the context behind find_fft_top_bins() */
+static q15_t fft_input_buffer[RFFT_Q15_MAX_FFT_LEN] RFFT_Q15_FRAME;
+
+#if defined(FFT_DEFAULT_WINDOW)
+#if defined(RFFT_Q15_CONST_WINDOWS)
+/* fft_context_set_window() takes the generated table */
+#define default_window NULL
+#else
+static q15_t default_window[FFT_WINDOW_TABLE_LEN(RFFT_Q15_MAX_FFT_LEN)];
+#endif
+#endif
+
+/* Storage for the top N selection */
+static spectral_peak_t top_bins_storage[FFT_TOP_BINS_MAX];
+
+static fft_context_t default_context;
+
+/* rfft_q15_bin_fn: offer one bin to the top N selection, which skips DC (bin 0) */
+static void top_bins_add(uint32_t bin, uint32_t mag_sq, void *user)
+{
+    spectral_peaks_push(user, (uint16_t)bin, mag_sq);
+}
+
+/* Destinations of one RFFT pass with an average, bands, a filterbank, floor, row or tracker attached */
+typedef struct {
+    spectral_peaks_t *peaks;
+    spectral_psd_t *psd;
+    spectral_mel_t *mel;
+    spectral_floor_t *floor;
+    spectral_gram_t *gram;
+    spectral_track_t *track;
+    spectral_band_t *band;      /* Band of the next bins, band_end past the last */
+    spectral_band_t *band_end;
+    const spectral_band_edge_t *edge;     /* Edge of the next bins, edge_end past the last */
+    const spectral_band_edge_t *edge_end;
+    uint64_t sum;               /* Magnitude² of the bins so far, for a band table */
+} top_bins_psd_t;
+
+/* rfft_q15_bin_fn: add one bin to the average and offer it to the top N selection */
+static void top_bins_psd_add(uint32_t bin, uint32_t mag_sq, void *user)
+{
+    top_bins_psd_t *dst = user;
+
+    spectral_psd_push(dst->psd, bin, mag_sq);
+    top_bins_add(bin, mag_sq, dst->peaks);
+}
+
+/* rfft_q15_bin_fn: add one bin to its band, the other extras if any, and offer it */
+static void top_bins_bands_add(uint32_t bin, uint32_t mag_sq, void *user)
+{
+    top_bins_psd_t *dst = user;
+    spectral_band_t *band = dst->band;
+
+    if (dst->psd != NULL) {
+        spectral_psd_push(dst->psd, bin, mag_sq);
+    }
+    if (dst->mel != NULL) {
+        spectral_mel_push(dst->mel, bin, mag_sq);
+    }
+    if (dst->floor != NULL) {
+        spectral_floor_push(dst->floor, bin, mag_sq);
+    }
+    if (dst->gram != NULL) {
+        spectral_gram_push(dst->gram, bin, mag_sq);
+    }
+    if (dst->track != NULL) {
+        spectral_track_push(dst->track, bin, mag_sq);
+    }
+
+    /* Bins arrive in ascending order, so only the current band is checked */
+    if (band != dst->band_end && bin >= band->first_bin) {
+        band->energy += mag_sq;
+        if (bin == band->last_bin) {
+            dst->band = band + 1;
+        }
+    }
+
+    top_bins_add(bin, mag_sq, dst->peaks);
+}
+
+/* Apply the edges of a band table at bin to the bands, with the bins below it in sum */
+static const spectral_band_edge_t *band_edges_apply(
+    const spectral_band_edge_t *edge,
+    const spectral_band_edge_t *edge_end,
+    spectral_band_t *bands,
+    uint32_t bin,
+    uint64_t sum
+)
+{
+    for (; edge != edge_end && edge->bin == bin; edge++) {
+        spectral_band_t *band = &bands[edge->band & ~SPECTRAL_BAND_EDGE_END];
+
+        /* Modulo 2^64, the energy ends up as the difference of two sums */
+        if ((edge->band & SPECTRAL_BAND_EDGE_END) != 0U) {
+            band->energy += sum;
+        } else {
+            band->energy -= sum;
+        }
+    }
+
+    return edge;
+}
+
+/* rfft_q15_bin_fn: add one bin to the prefix sum of a band table, the extras and offer it */
+static void top_bins_band_table_add(uint32_t bin, uint32_t mag_sq, void *user)
+{
+    top_bins_psd_t *dst = user;
+
+    if (dst->psd != NULL) {
+        spectral_psd_push(dst->psd, bin, mag_sq);
+    }
+    if (dst->mel != NULL) {
+        spectral_mel_push(dst->mel, bin, mag_sq);
+    }
+    if (dst->floor != NULL) {
+        spectral_floor_push(dst->floor, bin, mag_sq);
+    }
+    if (dst->gram != NULL) {
+        spectral_gram_push(dst->gram, bin, mag_sq);
+    }
+    if (dst->track != NULL) {
+        spectral_track_push(dst->track, bin, mag_sq);
+    }
+
+    /* One compare per bin, the edges are sorted */
+    if (dst->edge != dst->edge_end && dst->edge->bin == bin) {
+        dst->edge = band_edges_apply(dst->edge, dst->edge_end, dst->band, bin, dst->sum);
+    }
+    dst->sum += mag_sq;
+
+    top_bins_add(bin, mag_sq, dst->peaks);
+}
+
+/* Validate the arguments shared by all entry points. */
+static rfft_status_t check_top_bins_args(
+    const fft_context_t *ctx,
+    const q15_t *input_signal,
+    const uint16_t *output_bin_indices,
+    uint16_t num_top_bins
+)
+{
+    if (ctx == NULL || input_signal == NULL || output_bin_indices == NULL) {
+        return RFFT_ERROR_NULL_POINTER;
+    }
+    
+    if (num_top_bins == 0 || num_top_bins > (ctx->fft_size / 2) ||
+        num_top_bins > ctx->max_top_bins) {
+        return RFFT_ERROR_INVALID_SIZE;
+    }
+    
+    return RFFT_SUCCESS;
+}
+
+/*
+ * Spectrum behind a top N search: calls fn with the magnitude² of bins 0
+ * to fft_size / 2 of one channel of buffer, in ascending order.
+ */
+typedef void (*top_bins_source_fn)(const fft_context_t *ctx, q15_t *buffer,
+                                   uint32_t channel, rfft_q15_bin_fn fn, void *user);
+
+/* top_bins_source_fn: the RFFT of buffer (destroyed), a single channel */
+static void rfft_source(const fft_context_t *ctx, q15_t *buffer,
+                        uint32_t channel, rfft_q15_bin_fn fn, void *user)
+{
+    (void)channel;
+
+    if (ctx->mixed != NULL) {
+        arm_rfft_q15_mag_sq_mixed(ctx->mixed, buffer, ctx->mixed_buffer, fn, user);
+        return;
+    }
+
+    if (ctx->cfft_fn != NULL) {
+        ctx->cfft_fn(ctx->rfft->pCfft, buffer, ctx->cfft_user);
+        arm_rfft_q15_mag_sq_split(ctx->rfft, buffer, fn, user);
+        return;
+    }
+
+#if defined(RFFT_Q15_STOCKHAM)
+    if (ctx->stockham_buffer != NULL) {
+        arm_rfft_q15_mag_sq_stockham(ctx->rfft, buffer, ctx->stockham_buffer, fn, user);
+        return;
+    }
+#endif
+
+    arm_rfft_q15_mag_sq(ctx->rfft, buffer, fn, user);
+}
+
+/* top_bins_source_fn: the envelope spectrum of a band of buffer (destroyed), a single channel */
+static void envelope_source(const fft_context_t *ctx, q15_t *buffer,
+                            uint32_t channel, rfft_q15_bin_fn fn, void *user)
+{
+    (void)channel;
+
+    fft_envelope_mag_sq(ctx->envelope, buffer, fn, user);
+}
+
+/* Pick the top bins of a spectrum, feeding the average on the way. */
+static void top_bins_from_source(
+    fft_context_t *ctx,
+    top_bins_source_fn source,
+    q15_t *buffer,
+    uint32_t channel,
+    uint16_t *output_bin_indices,
+    uint16_t num_top_bins
+)
+{
+    spectral_peaks_t peaks;
+    const spectral_peak_t *top_bins;
+    uint32_t floor_mag = 0;
+    
+    /* Grouping harmonics takes places, it picks from all of them */
+    spectral_peaks_init(&peaks, ctx->top_bins,
+                        (ctx->peak_harmonics >= 2U) ? ctx->max_top_bins : num_top_bins,
+                        ctx->peak_spacing);
+    if (ctx->floor != NULL) {
+        /* The floor of the frames before, the bins below never enter */
+        floor_mag = ctx->floor->threshold;
+        spectral_topk_set_floor(&peaks.topk, floor_mag);
+    }
+    if (ctx->track != NULL) {
+        /* Only a bin that would replace a tracked peak is worth selecting */
+        uint32_t enter = spectral_track_threshold(ctx->track);
+
+        spectral_topk_set_floor(&peaks.topk, (enter > floor_mag) ? enter : floor_mag);
+        spectral_track_begin_frame(ctx->track);
+    }
+    
+    /*
+     * Each bin's magnitude² (raw values of the downscaled transform
+     * output, to avoid overflow) goes straight into the top N selection,
+     * so the complex spectrum is never stored.
+     */
+    if (ctx->num_bands != 0 || ctx->mel != NULL || ctx->floor != NULL || ctx->gram != NULL ||
+        ctx->track != NULL) {
+        top_bins_psd_t dst = { &peaks, NULL, ctx->mel, ctx->floor, ctx->gram, ctx->track,
+                               ctx->bands, ctx->bands + ctx->num_bands, NULL, NULL, 0 };
+
+        if (ctx->psd != NULL && spectral_psd_accepts(ctx->psd)) {
+            dst.psd = ctx->psd;
+        }
+        if (dst.mel != NULL) {
+            spectral_mel_begin_frame(dst.mel);
+        }
+        if (dst.floor != NULL) {
+            spectral_floor_begin_frame(dst.floor);
+        }
+        if (dst.gram != NULL) {
+            spectral_gram_begin_frame(dst.gram);
+        }
+
+        for (uint16_t i = 0; i < ctx->num_bands; i++) {
+            ctx->bands[i].energy = 0;
+        }
+
+        if (ctx->band_edges != NULL) {
+            dst.edge = ctx->band_edges;
+            dst.edge_end = ctx->band_edges + 2U * ctx->num_bands;
+            source(ctx, buffer, channel, top_bins_band_table_add, &dst);
+
+            /* The bands up to the last bin end past it */
+            (void)band_edges_apply(dst.edge, dst.edge_end, ctx->bands,
+                                   ctx->fft_size / 2U + 1U, dst.sum);
+        } else {
+            source(ctx, buffer, channel, top_bins_bands_add, &dst);
+        }
+
+        if (dst.psd != NULL) {
+            spectral_psd_end_frame(dst.psd);
+        }
+        if (dst.floor != NULL) {
+            spectral_floor_end_frame(dst.floor);
+        }
+    } else if (ctx->psd != NULL && spectral_psd_accepts(ctx->psd)) {
+        top_bins_psd_t dst = { &peaks, ctx->psd, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 0 };
+
+        source(ctx, buffer, channel, top_bins_psd_add, &dst);
+        spectral_psd_end_frame(ctx->psd);
+    } else {
+        source(ctx, buffer, channel, top_bins_add, &peaks);
+    }
+    
+    top_bins = spectral_peaks_finish(&peaks);
+    if (ctx->peak_harmonics >= 2U) {
+        (void)spectral_peaks_group_harmonics(ctx->top_bins, ctx->max_top_bins,
+                                             ctx->peak_harmonics);
+    }
+    if (ctx->track != NULL) {
+        (void)spectral_track_end_frame(ctx->track, top_bins, num_top_bins, floor_mag);
+    }
+    
+    /* Copy bin indices to output array */
+    for (uint16_t i = 0; i < num_top_bins; i++) {
+        output_bin_indices[i] = top_bins[i].bin_index;
+    }
+    RFFT_PROFILE_MARK(RFFT_PROFILE_TOPK);
+}
+
+/* Run the RFFT on work_buffer (destroyed) and pick the top bins. */
+static void top_bins_from_buffer(
+    fft_context_t *ctx,
+    q15_t *work_buffer,
+    uint16_t *output_bin_indices,
+    uint16_t num_top_bins
+)
+{
+    top_bins_from_source(ctx, (ctx->envelope != NULL) ? envelope_source : rfft_source,
+                         work_buffer, 0, output_bin_indices, num_top_bins);
+}
+
+/*
+ * top_bins_source_fn: channel 0 or 1 of a pair transformed together by
+ * fft_context_top_bins_interleaved(), the real and imaginary part of one
+ * CFFT input. With Z = X0 + j X1 and W[k] = conj(Z[N - k]), the real
+ * inputs give X0 = (Z + W) / 2 and X1 = (Z - W) / 2j: adds only.
+ */
+static void pair_source(const fft_context_t *ctx, q15_t *buffer,
+                        uint32_t channel, rfft_q15_bin_fn fn, void *user)
+{
+    uint32_t n = ctx->fft_size;
+
+    for (uint32_t k = 0; k <= n / 2U; k++) {
+        const q15_t *z = &buffer[2U * k];
+        const q15_t *w = &buffer[2U * ((n - k) & (n - 1U))];
+        q31_t re, im;
+
+        if (channel == 0) {
+            re = ((q31_t) z[0] + w[0]) >> 1;
+            im = ((q31_t) z[1] - w[1]) >> 1;
+        } else {
+            re = ((q31_t) z[1] + w[1]) >> 1;
+            im = ((q31_t) w[0] - z[0]) >> 1;
+        }
+
+        fn(k, (uint32_t) (re * re) + (uint32_t) (im * im), user);
+    }
+}
+
+/*
+ * Separate both channels of a pair as pair_source() does and feed the
+ * cross spectrum with them, channel 0 times the conjugate of channel 1.
+ */
+static void pair_cross(const fft_context_t *ctx, const q15_t *buffer, spectral_cross_t *cross)
+{
+    uint32_t n = ctx->fft_size;
+
+    for (uint32_t k = 0; k <= n / 2U; k++) {
+        const q15_t *z = &buffer[2U * k];
+        const q15_t *w = &buffer[2U * ((n - k) & (n - 1U))];
+        q31_t x = rfft_q15_pack16(((q31_t) z[0] + w[0]) >> 1, ((q31_t) z[1] - w[1]) >> 1);
+        q31_t y = rfft_q15_pack16(((q31_t) z[1] + w[1]) >> 1, ((q31_t) w[0] - z[0]) >> 1);
+
+        spectral_cross_push(cross, k, x, y);
+    }
+
+    spectral_cross_end_frame(cross);
+}
+
+/* cos(2*pi*k/n) for k <= n, from the shared twiddle table or the plan of n */
+static q31_t window_cos(const rfft_mixed_q15_t *mixed, uint32_t k, uint32_t n)
+{
+    if (k > n / 2U) {
+        k = n - k;
+    }
+
+    if (mixed != NULL) {
+        q15_t c, s;
+
+        rfft_mixed_twiddle(mixed, k, &c, &s);
+        return c;
+    }
+
+    return RFFT_TWIDDLE_COS(RFFT_TWIDDLE_TABLE, k * RFFT_TWIDDLE_STRIDE(n));
+}
+
+/* dst[i * dst_step] = src[i * src_step] * w[i * w_step], w_step +1 or -1 */
+static void window_run(
+    q15_t *dst,
+    uint32_t dst_step,
+    const q15_t *src,
+    uint32_t src_step,
+    const q15_t *w,
+    int32_t w_step,
+    uint32_t count
+)
+{
+    for (uint32_t i = 0; i < count; i++) {
+        *dst = (q15_t) (((q31_t) *src * *w) >> 15);
+        dst += dst_step;
+        src += src_step;
+        w += w_step;
+    }
+}
+
+/* window_run() of a frame, with every sample of src added to stats on the way */
+static void window_run_stats(
+    fft_stats_t *stats,
+    q15_t *dst,
+    const q15_t *src,
+    const q15_t *w,
+    int32_t w_step,
+    uint32_t count
+)
+{
+    fft_stats_t acc = *stats;
+
+    for (uint32_t i = 0; i < count; i++) {
+        q15_t x = *src++;
+
+        fft_stats_sample(&acc, x);
+        *dst++ = (q15_t) (((q31_t) x * *w) >> 15);
+        w += w_step;
+    }
+
+    *stats = acc;
+}
+
+/*
+ * Window a whole frame, dst[i * dst_step] = src[i * src_step] * w[i] for
+ * the first half and * w[n - i] for the second: each coefficient is read
+ * once, for sample i and its mirror n - i. Every sample is read before
+ * its own place is written, so dst may be src.
+ */
+static void window_mirror(
+    q15_t *dst,
+    uint32_t dst_step,
+    const q15_t *src,
+    uint32_t src_step,
+    const q15_t *w,
+    uint32_t n
+)
+{
+    uint32_t half = n / 2U;
+
+    dst[0] = (q15_t) (((q31_t) src[0] * w[0]) >> 15);
+    dst[half * dst_step] = (q15_t) (((q31_t) src[half * src_step] * w[half]) >> 15);
+
+    for (uint32_t i = 1; i < half; i++) {
+        q31_t c = w[i];
+
+        dst[i * dst_step] = (q15_t) ((src[i * src_step] * c) >> 15);
+        dst[(n - i) * dst_step] = (q15_t) ((src[(n - i) * src_step] * c) >> 15);
+    }
+}
+
+/* window_mirror() of a contiguous frame, with every sample added to stats on the way */
+static void window_mirror_stats(fft_stats_t *stats, q15_t *dst, const q15_t *src, const q15_t *w, uint32_t n)
+{
+    fft_stats_t acc = *stats;
+    uint32_t half = n / 2U;
+
+    fft_stats_sample(&acc, src[0]);
+    fft_stats_sample(&acc, src[half]);
+    dst[0] = (q15_t) (((q31_t) src[0] * w[0]) >> 15);
+    dst[half] = (q15_t) (((q31_t) src[half] * w[half]) >> 15);
+
+    for (uint32_t i = 1; i < half; i++) {
+        q31_t c = w[i];
+        q15_t lo = src[i];
+        q15_t hi = src[n - i];
+
+        fft_stats_sample(&acc, lo);
+        fft_stats_sample(&acc, hi);
+        dst[i] = (q15_t) ((lo * c) >> 15);
+        dst[n - i] = (q15_t) ((hi * c) >> 15);
+    }
+
+    *stats = acc;
+}
+
+/* Copy of a run of a frame, with every sample added to stats on the way */
+static void copy_run_stats(fft_stats_t *stats, q15_t *dst, const q15_t *src, uint32_t count)
+{
+    fft_stats_t acc = *stats;
+
+    for (uint32_t i = 0; i < count; i++) {
+        q15_t x = src[i];
+
+        fft_stats_sample(&acc, x);
+        dst[i] = x;
+    }
+
+    *stats = acc;
+}
+
+/* One channel of an interleaved frame into every dst_step-th place of dst, windowed */
+static void load_channel(
+    const fft_context_t *ctx,
+    q15_t *dst,
+    uint32_t dst_step,
+    const q15_t *src,
+    uint32_t src_step
+)
+{
+    uint32_t n = ctx->fft_size;
+
+    if (ctx->window == NULL) {
+        for (uint32_t i = 0; i < n; i++) {
+            dst[i * dst_step] = src[i * src_step];
+        }
+        return;
+    }
+
+    window_mirror(dst, dst_step, src, src_step, ctx->window, n);
+}
+
+/* Every field of a context but the transform, to its defaults */
+static void context_reset(
+    fft_context_t *ctx,
+    uint16_t fft_size,
+    q15_t *work_buffer,
+    spectral_peak_t *top_bins_storage,
+    uint16_t max_top_bins
+)
+{
+    ctx->fft_size = fft_size;
+    ctx->work_buffer = work_buffer;
+    ctx->top_bins = top_bins_storage;
+    ctx->max_top_bins = max_top_bins;
+    ctx->window = NULL;
+    ctx->window_type = FFT_WINDOW_RECT;
+    ctx->psd = NULL;
+    ctx->bands = NULL;
+    ctx->num_bands = 0;
+    ctx->band_edges = NULL;
+    ctx->mel = NULL;
+    ctx->floor = NULL;
+    ctx->gram = NULL;
+    ctx->track = NULL;
+    ctx->peak_spacing = 0;
+    ctx->peak_harmonics = 0;
+    ctx->pair_cfft = NULL;
+    ctx->pair_buffer = NULL;
+    ctx->cross = NULL;
+    ctx->envelope = NULL;
+    ctx->stats = NULL;
+    ctx->cfft_fn = NULL;
+    ctx->cfft_user = NULL;
+    ctx->stockham_buffer = NULL;
+    ctx->mixed = NULL;
+    ctx->mixed_buffer = NULL;
+}
+
+/**
+ * @brief Prepare a context for repeated transforms of one size
+ */
+rfft_status_t fft_context_init(
+    fft_context_t *ctx,
+    uint16_t fft_size,
+    q15_t *work_buffer,
+    spectral_peak_t *top_bins_storage,
+    uint16_t max_top_bins
+)
+{
+    if (ctx == NULL || top_bins_storage == NULL) {
+        return RFFT_ERROR_NULL_POINTER;
+    }
+    
+    if (max_top_bins == 0) {
+        return RFFT_ERROR_INVALID_SIZE;
+    }
+    
+    /* Select the prebuilt RFFT instance */
+    ctx->rfft = rfft_q15_get_instance(fft_size);
+    if (ctx->rfft == NULL) {
+        return RFFT_ERROR_INVALID_SIZE;
+    }
+    
+    context_reset(ctx, fft_size, work_buffer, top_bins_storage, max_top_bins);
+    
+    return RFFT_SUCCESS;
+}
+
+/**
+ * @brief Prepare a context for a length that is not a power of two
+ */
+rfft_status_t fft_context_init_mixed(
+    fft_context_t *ctx,
+    const rfft_mixed_q15_t *plan,
+    q15_t *work_buffer,
+    q15_t *mixed_buffer,
+    spectral_peak_t *top_bins_storage,
+    uint16_t max_top_bins
+)
+{
+    if (ctx == NULL || plan == NULL || mixed_buffer == NULL || top_bins_storage == NULL) {
+        return RFFT_ERROR_NULL_POINTER;
+    }
+    
+    if (max_top_bins == 0) {
+        return RFFT_ERROR_INVALID_SIZE;
+    }
+    
+    ctx->rfft = NULL;
+    context_reset(ctx, plan->fftLenReal, work_buffer, top_bins_storage, max_top_bins);
+    ctx->mixed = plan;
+    ctx->mixed_buffer = mixed_buffer;
+    
+    return RFFT_SUCCESS;
+}
+
+
+/**
+ * @brief Select the window applied before every transform of a context
+ */
+rfft_status_t fft_context_set_window(
+    fft_context_t *ctx,
+    fft_window_type_t type,
+    q15_t *table
+)
+{
+    const q15_t *generated;
+    uint32_t n;
+
+    if (ctx == NULL) {
+        return RFFT_ERROR_NULL_POINTER;
+    }
+
+    if (type == FFT_WINDOW_RECT) {
+        ctx->window = NULL;
+        ctx->window_type = FFT_WINDOW_RECT;
+        return RFFT_SUCCESS;
+    }
+
+    if (type != FFT_WINDOW_HANN && type != FFT_WINDOW_HAMMING &&
+        type != FFT_WINDOW_BLACKMAN) {
+        return RFFT_ERROR_INVALID_SIZE;
+    }
+
+    n = ctx->fft_size;
+
+    /* The generated tables are those of the shared twiddle table, not of a mixed plan */
+    generated = (ctx->mixed == NULL) ? fft_window_table(type, (uint16_t) n) : NULL;
+    if (generated != NULL) {
+        ctx->window = generated;
+        ctx->window_type = type;
+        return RFFT_SUCCESS;
+    }
+
+    if (table == NULL) {
+        return RFFT_ERROR_NULL_POINTER;
+    }
+
+    /* Coefficients in Q15, rounded: 0.54 = 17695, 0.46 = 15073, 0.42 = 13763, 0.08 = 2621 */
+    for (uint32_t k = 0; k < FFT_WINDOW_TABLE_LEN(n); k++) {
+        q31_t c1 = window_cos(ctx->mixed, k, n);
+        q31_t w;
+
+        if (type == FFT_WINDOW_HANN) {
+            w = (32768 - c1) >> 1;
+        } else if (type == FFT_WINDOW_HAMMING) {
+            w = 17695 - ((15073 * c1) >> 15);
+        } else {
+            w = 13763 - (c1 >> 1) + ((2621 * window_cos(ctx->mixed, 2U * k, n)) >> 15);
+        }
+
+        /* The peak is exactly 1.0 */
+        table[k] = (q15_t) ((w < 0) ? 0 : ((w > 32767) ? 32767 : w));
+    }
+
+    ctx->window = table;
+    ctx->window_type = type;
+
+    return RFFT_SUCCESS;
+}
+
+/**
+ * @brief Generated half table of a window
+ */
+const q15_t *fft_window_table(fft_window_type_t type, uint16_t fft_size)
+{
+#if defined(RFFT_Q15_CONST_WINDOWS)
+    return rfft_q15_window_table((uint32_t) type, fft_size);
 #else
-static q15_t fft_input_buffer[4096];   /* Max FFT size: 4096 */
-static q15_t fft_output_buffer[8192];  /* 2 * max FFT size for complex output */
+    (void)type;
+    (void)fft_size;
+    return NULL;
+#endif
+}
+
+/**
+ * @brief Average the power spectrum of every frame a context transforms
+ */
+rfft_status_t fft_context_set_psd(
+    fft_context_t *ctx,
+    spectral_psd_t *psd
+)
+{
+    if (ctx == NULL) {
+        return RFFT_ERROR_NULL_POINTER;
+    }
+
+    if (psd != NULL && psd->num_bins != ctx->fft_size / 2U + 1U) {
+        return RFFT_ERROR_INVALID_SIZE;
+    }
+
+    ctx->psd = psd;
+
+    return RFFT_SUCCESS;
+}
+
+/**
+ * @brief Sum the energy of bands of every frame a context transforms
+ */
+rfft_status_t fft_context_set_bands(
+    fft_context_t *ctx,
+    spectral_band_t *bands,
+    uint16_t num_bands
+)
+{
+    if (ctx == NULL || (bands == NULL && num_bands != 0)) {
+        return RFFT_ERROR_NULL_POINTER;
+    }
+
+    for (uint16_t i = 0; i < num_bands; i++) {
+        if (bands[i].first_bin > bands[i].last_bin ||
+            bands[i].last_bin > ctx->fft_size / 2U ||
+            (i > 0 && bands[i].first_bin <= bands[i - 1].last_bin)) {
+            return RFFT_ERROR_INVALID_SIZE;
+        }
+        bands[i].energy = 0;
+    }
+
+    ctx->bands = bands;
+    ctx->num_bands = num_bands;
+    ctx->band_edges = NULL;
+
+    return RFFT_SUCCESS;
+}
+
+/**
+ * @brief Sum the energy of a table of bands, which may overlap
+ */
+rfft_status_t fft_context_set_band_table(
+    fft_context_t *ctx,
+    spectral_band_t *bands,
+    uint16_t num_bands,
+    spectral_band_edge_t *edges
+)
+{
+    uint32_t num_edges = 2U * num_bands;
+
+    if (ctx == NULL || ((bands == NULL || edges == NULL) && num_bands != 0)) {
+        return RFFT_ERROR_NULL_POINTER;
+    }
+
+    if (num_bands > SPECTRAL_BAND_EDGE_END - 1U) {
+        return RFFT_ERROR_INVALID_SIZE;
+    }
+
+    for (uint16_t i = 0; i < num_bands; i++) {
+        if (bands[i].first_bin > bands[i].last_bin ||
+            bands[i].last_bin > ctx->fft_size / 2U) {
+            return RFFT_ERROR_INVALID_SIZE;
+        }
+        bands[i].energy = 0;
+    }
+
+    /* Insertion sort by bin, the tables are short and set up once */
+    for (uint32_t i = 0; i < num_edges; i++) {
+        const spectral_band_t *band = &bands[i / 2U];
+        spectral_band_edge_t edge = {
+            .bin = (i & 1U) ? (uint16_t) (band->last_bin + 1U) : band->first_bin,
+            .band = (uint16_t) ((i / 2U) | ((i & 1U) ? SPECTRAL_BAND_EDGE_END : 0U)),
+        };
+        uint32_t j = i;
+
+        for (; j > 0 && edges[j - 1U].bin > edge.bin; j--) {
+            edges[j] = edges[j - 1U];
+        }
+        edges[j] = edge;
+    }
+
+    ctx->bands = bands;
+    ctx->num_bands = num_bands;
+    ctx->band_edges = (num_bands != 0) ? edges : NULL;
+
+    return RFFT_SUCCESS;
+}
+
+/**
+ * @brief Drop the bins below the noise floor from the top bins
+ */
+rfft_status_t fft_context_set_floor(
+    fft_context_t *ctx,
+    spectral_floor_t *est
+)
+{
+    if (ctx == NULL) {
+        return RFFT_ERROR_NULL_POINTER;
+    }
+
+    if (est != NULL && est->num_bins != ctx->fft_size / 2U + 1U) {
+        return RFFT_ERROR_INVALID_SIZE;
+    }
+
+    ctx->floor = est;
+
+    return RFFT_SUCCESS;
+}
+
+/**
+ * @brief Track the top bins from frame to frame
+ */
+rfft_status_t fft_context_set_track(
+    fft_context_t *ctx,
+    spectral_track_t *track
+)
+{
+    if (ctx == NULL) {
+        return RFFT_ERROR_NULL_POINTER;
+    }
+
+    ctx->track = track;
+
+    return RFFT_SUCCESS;
+}
+
+/**
+ * @brief Report distinct peaks instead of the strongest bins
+ */
+rfft_status_t fft_context_set_peaks(
+    fft_context_t *ctx,
+    uint16_t min_spacing,
+    uint16_t max_harmonic
+)
+{
+    if (ctx == NULL) {
+        return RFFT_ERROR_NULL_POINTER;
+    }
+
+    if (max_harmonic >= 2U && min_spacing == 0U) {
+        return RFFT_ERROR_INVALID_SIZE;
+    }
+
+    ctx->peak_spacing = min_spacing;
+    ctx->peak_harmonics = max_harmonic;
+
+    return RFFT_SUCCESS;
+}
+
+/**
+ * @brief Run a filterbank over every frame a context transforms
+ */
+rfft_status_t fft_context_set_mel(
+    fft_context_t *ctx,
+    spectral_mel_t *mel
+)
+{
+    if (ctx == NULL) {
+        return RFFT_ERROR_NULL_POINTER;
+    }
+
+    if (mel != NULL && mel->fft_size != ctx->fft_size) {
+        return RFFT_ERROR_INVALID_SIZE;
+    }
+
+    ctx->mel = mel;
+
+    return RFFT_SUCCESS;
+}
+
+/**
+ * @brief Pool every frame a context transforms into a spectrogram row
+ */
+rfft_status_t fft_context_set_gram(
+    fft_context_t *ctx,
+    spectral_gram_t *gram
+)
+{
+    if (ctx == NULL) {
+        return RFFT_ERROR_NULL_POINTER;
+    }
+
+    if (gram != NULL && gram->num_bins != ctx->fft_size / 2U + 1U) {
+        return RFFT_ERROR_INVALID_SIZE;
+    }
+
+    ctx->gram = gram;
+
+    return RFFT_SUCCESS;
+}
+
+/**
+ * @brief Run the CFFT inside the RFFT of a context with a function of the caller
+ */
+rfft_status_t fft_context_set_cfft(
+    fft_context_t *ctx,
+    fft_cfft_fn fn,
+    void *user
+)
+{
+    if (ctx == NULL) {
+        return RFFT_ERROR_NULL_POINTER;
+    }
+
+    if (ctx->mixed != NULL && fn != NULL) {
+        return RFFT_ERROR_INVALID_SIZE;
+    }
+
+    ctx->cfft_fn = fn;
+    ctx->cfft_user = user;
+
+    return RFFT_SUCCESS;
+}
+
+#if defined(RFFT_Q15_STOCKHAM)
+/**
+ * @brief Run the CFFT of a context in Stockham order, on a second buffer
+ */
+rfft_status_t fft_context_set_stockham_buffer(
+    fft_context_t *ctx,
+    q15_t *stockham_buffer
+)
+{
+    if (ctx == NULL) {
+        return RFFT_ERROR_NULL_POINTER;
+    }
+
+    if (ctx->mixed != NULL && stockham_buffer != NULL) {
+        return RFFT_ERROR_INVALID_SIZE;
+    }
+
+    ctx->stockham_buffer = stockham_buffer;
+
+    return RFFT_SUCCESS;
+}
 #endif
 
-/* Structure for bin sorting */
-typedef struct {
-    uint16_t bin_index;
-    uint32_t magnitude_squared;
-} bin_magnitude_t;
+/**
+ * @brief Transform channels of interleaved frames in pairs
+ */
+rfft_status_t fft_context_set_pair_buffer(
+    fft_context_t *ctx,
+    q15_t *pair_buffer
+)
+{
+    const arm_rfft_instance_q15 *rfft;
+
+    if (ctx == NULL) {
+        return RFFT_ERROR_NULL_POINTER;
+    }
+
+    if (pair_buffer == NULL) {
+        ctx->pair_cfft = NULL;
+        ctx->pair_buffer = NULL;
+        return RFFT_SUCCESS;
+    }
+
+    /* The CFFTs of the build are those inside its RFFTs */
+    rfft = rfft_q15_get_instance(2U * (uint32_t)ctx->fft_size);
+    if (rfft == NULL) {
+        return RFFT_ERROR_INVALID_SIZE;
+    }
+
+    ctx->pair_cfft = rfft->pCfft;
+    ctx->pair_buffer = pair_buffer;
+
+    return RFFT_SUCCESS;
+}
+
+/**
+ * @brief Average the cross spectrum of channels 0 and 1 of interleaved frames
+ */
+rfft_status_t fft_context_set_cross(
+    fft_context_t *ctx,
+    spectral_cross_t *cross
+)
+{
+    if (ctx == NULL || (cross != NULL && ctx->pair_buffer == NULL)) {
+        return RFFT_ERROR_NULL_POINTER;
+    }
+
+    if (cross != NULL && cross->x.num_bins != ctx->fft_size / 2U + 1U) {
+        return RFFT_ERROR_INVALID_SIZE;
+    }
+
+    ctx->cross = cross;
+
+    return RFFT_SUCCESS;
+}
+
+/**
+ * @brief Pick the top bins of the envelope spectrum of a band instead
+ */
+rfft_status_t fft_context_set_envelope(
+    fft_context_t *ctx,
+    fft_envelope_t *envelope
+)
+{
+    if (ctx == NULL) {
+        return RFFT_ERROR_NULL_POINTER;
+    }
+
+    if (envelope != NULL && (envelope->frame_len != ctx->fft_size ||
+                             ctx->max_top_bins > envelope->fft_size / 2U)) {
+        return RFFT_ERROR_INVALID_SIZE;
+    }
+
+    ctx->envelope = envelope;
+
+    return RFFT_SUCCESS;
+}
+
+/**
+ * @brief Gather the time-domain statistics of every frame
+ */
+rfft_status_t fft_context_set_stats(
+    fft_context_t *ctx,
+    fft_stats_t *stats
+)
+{
+    if (ctx == NULL) {
+        return RFFT_ERROR_NULL_POINTER;
+    }
+
+    ctx->stats = stats;
+
+    return RFFT_SUCCESS;
+}
+
+/**
+ * @brief Copy a frame into a transform buffer, applying the window
+ */
+void fft_context_load(
+    const fft_context_t *ctx,
+    q15_t *dst,
+    const q15_t *src,
+    uint32_t src_len,
+    const q15_t *wrap
+)
+{
+    uint32_t n = ctx->fft_size;
+    uint32_t half = FFT_WINDOW_TABLE_LEN(n);
+    uint32_t i = 0;
+
+    if (ctx->stats != NULL) {
+        fft_stats_reset(ctx->stats);
+
+        if (ctx->window == NULL) {
+            copy_run_stats(ctx->stats, dst, src, src_len);
+            copy_run_stats(ctx->stats, &dst[src_len], wrap, n - src_len);
+            return;
+        }
+    }
+
+    if (ctx->window == NULL) {
+        if (dst != src) {
+            memcpy(dst, src, src_len * sizeof(q15_t));
+        }
+        if (src_len < n) {
+            memcpy(&dst[src_len], wrap, (n - src_len) * sizeof(q15_t));
+        }
+        return;
+    }
+
+    /* One read of each coefficient for both samples it weights */
+    if (src_len == n) {
+        if (ctx->stats != NULL) {
+            window_mirror_stats(ctx->stats, dst, src, ctx->window, n);
+        } else {
+            window_mirror(dst, 1, src, 1, ctx->window, n);
+        }
+        return;
+    }
+
+    /*
+     * Sample i is weighted by window[i] for the first half and by
+     * window[n - i] for the second, split further where src ends.
+     */
+    while (i < n) {
+        const q15_t *in = (i < src_len) ? &src[i] : &wrap[i - src_len];
+        uint32_t end = (i < src_len) ? src_len : n;
+
+        if (i < half) {
+            if (end > half) {
+                end = half;
+            }
+            if (ctx->stats != NULL) {
+                window_run_stats(ctx->stats, &dst[i], in, &ctx->window[i], 1, end - i);
+            } else {
+                window_run(&dst[i], 1, in, 1, &ctx->window[i], 1, end - i);
+            }
+        } else if (ctx->stats != NULL) {
+            window_run_stats(ctx->stats, &dst[i], in, &ctx->window[n - i], -1, end - i);
+        } else {
+            window_run(&dst[i], 1, in, 1, &ctx->window[n - i], -1, end - i);
+        }
+
+        i = end;
+    }
+}
 
 /**
- * @brief Find the top N frequency bins with highest magnitude from FFT
+ * @brief Widen an 8-bit frame into a transform buffer, applying the window
  */
-rfft_status_t find_fft_top_bins(
+void fft_context_load_q7(
+    const fft_context_t *ctx,
+    q15_t *dst,
+    const int8_t *src
+)
+{
+    const q15_t *w = ctx->window;
+    uint32_t n = ctx->fft_size;
+    uint32_t half = n / 2U;
+
+    if (w == NULL) {
+        for (uint32_t i = 0; i < n; i++) {
+            dst[i] = (q15_t) (src[i] * 256);
+        }
+    } else {
+        /* (x * 256 * w) >> 15 in one shift, each coefficient read once for both samples */
+        dst[0] = (q15_t) (((q31_t) src[0] * w[0]) >> 7);
+        dst[half] = (q15_t) (((q31_t) src[half] * w[half]) >> 7);
+
+        for (uint32_t i = 1; i < half; i++) {
+            q31_t c = w[i];
+
+            dst[i] = (q15_t) ((src[i] * c) >> 7);
+            dst[n - i] = (q15_t) ((src[n - i] * c) >> 7);
+        }
+    }
+
+    if (ctx->stats != NULL) {
+        /* A second read of the 8-bit frame, half the bytes of the buffer */
+        fft_stats_t acc;
+
+        fft_stats_reset(ctx->stats);
+        acc = *ctx->stats;
+        for (uint32_t i = 0; i < n; i++) {
+            fft_stats_sample(&acc, (q15_t) (src[i] * 256));
+        }
+        *ctx->stats = acc;
+    }
+}
+
+/**
+ * @brief Find the top N frequency bins of a buffer filled by fft_context_load()
+ */
+void fft_context_execute_loaded(
+    fft_context_t *ctx,
+    q15_t *buffer,
+    uint16_t *output_bin_indices,
+    uint16_t num_top_bins
+)
+{
+    /* The copy was spread over the blocks of the frame */
+    RFFT_PROFILE_START();
+    top_bins_from_buffer(ctx, buffer, output_bin_indices, num_top_bins);
+}
+
+/**
+ * @brief Find the top N frequency bins of a copy of the input
+ */
+rfft_status_t fft_context_top_bins(
+    fft_context_t *ctx,
     const q15_t *input_signal,
     uint16_t input_length,
-    uint16_t fft_size,
     uint16_t *output_bin_indices,
     uint16_t num_top_bins
 )
 {
+    rfft_status_t status;
+    
     /* Input validation */
-    if (input_signal == NULL || output_bin_indices == NULL) {
+    status = check_top_bins_args(ctx, input_signal,
+                                 output_bin_indices, num_top_bins);
+    if (status != RFFT_SUCCESS) {
+        return status;
+    }
+    
+    if (ctx->work_buffer == NULL) {
         return RFFT_ERROR_NULL_POINTER;
     }
     
-    if (input_length != fft_size) {
+    if (input_length != ctx->fft_size) {
         return RFFT_ERROR_INVALID_SIZE;
     }
     
-    if (fft_size != 4096 && fft_size != 8192) {
+    fft_context_execute(ctx, input_signal, output_bin_indices, num_top_bins);
+    
+    return RFFT_SUCCESS;
+}
+
+/**
+ * @brief Find the top N frequency bins, using the input as work buffer
+ */
+rfft_status_t fft_context_top_bins_inplace(
+    fft_context_t *ctx,
+    q15_t *input_signal,
+    uint16_t *output_bin_indices,
+    uint16_t num_top_bins
+)
+{
+    rfft_status_t status;
+    
+    status = check_top_bins_args(ctx, input_signal,
+                                 output_bin_indices, num_top_bins);
+    if (status != RFFT_SUCCESS) {
+        return status;
+    }
+    
+    fft_context_execute_inplace(ctx, input_signal,
+                                output_bin_indices, num_top_bins);
+    
+    return RFFT_SUCCESS;
+}
+
+/**
+ * @brief Find the top N frequency bins of every channel of an interleaved frame
+ */
+rfft_status_t fft_context_top_bins_interleaved(
+    fft_context_t *ctx,
+    const q15_t *input_signal,
+    uint16_t num_channels,
+    uint16_t *output_bin_indices,
+    uint16_t num_top_bins
+)
+{
+    rfft_status_t status;
+
+    status = check_top_bins_args(ctx, input_signal,
+                                 output_bin_indices, num_top_bins);
+    if (status != RFFT_SUCCESS) {
+        return status;
+    }
+
+    if (ctx->work_buffer == NULL) {
+        return RFFT_ERROR_NULL_POINTER;
+    }
+
+    if (num_channels == 0) {
         return RFFT_ERROR_INVALID_SIZE;
     }
+
+    /*
+     * Channels go through the same transform instance, so its twiddles
+     * stay warm. Picking a channel out of the frame is the copy into the
+     * transform buffer, windowed in the same pass. With a pair buffer,
+     * two channels share one CFFT as its real and imaginary part.
+     */
+    for (uint16_t ch = 0; ch < num_channels; ) {
+        RFFT_PROFILE_START();
+
+        if (ctx->pair_buffer != NULL && num_channels - ch >= 2) {
+            load_channel(ctx, ctx->pair_buffer, 2, &input_signal[ch], num_channels);
+            load_channel(ctx, &ctx->pair_buffer[1], 2, &input_signal[ch + 1], num_channels);
+            RFFT_PROFILE_MARK(RFFT_PROFILE_COPY);
+            arm_cfft_q15(ctx->pair_cfft, ctx->pair_buffer, 0, 1);
+
+            if (ch == 0 && ctx->cross != NULL && spectral_cross_accepts(ctx->cross)) {
+                pair_cross(ctx, ctx->pair_buffer, ctx->cross);
+            }
+
+            for (uint32_t c = 0; c < 2U; c++, ch++) {
+                top_bins_from_source(ctx, pair_source, ctx->pair_buffer, c,
+                                     &output_bin_indices[ch * num_top_bins],
+                                     num_top_bins);
+            }
+        } else {
+            load_channel(ctx, ctx->work_buffer, 1, &input_signal[ch], num_channels);
+            RFFT_PROFILE_MARK(RFFT_PROFILE_COPY);
+            top_bins_from_buffer(ctx, ctx->work_buffer,
+                                 &output_bin_indices[ch * num_top_bins],
+                                 num_top_bins);
+            ch++;
+        }
+    }
+
+    return RFFT_SUCCESS;
+}
+
+/**
+ * @brief Fast path of fft_context_top_bins(), without argument checks
+ */
+void fft_context_execute(
+    fft_context_t *ctx,
+    const q15_t *input_signal,
+    uint16_t *output_bin_indices,
+    uint16_t num_top_bins
+)
+{
+    RFFT_PROFILE_START();
+
+    /* Copy input to working buffer, windowed in the same pass */
+    fft_context_load(ctx, ctx->work_buffer, input_signal, ctx->fft_size, NULL);
+    RFFT_PROFILE_MARK(RFFT_PROFILE_COPY);
     
-#ifndef ENABLE_FFT_8K
-    if (fft_size == 8192) {
-        return RFFT_ERROR_INVALID_SIZE;  /* 8192 not enabled */
+    top_bins_from_buffer(ctx, ctx->work_buffer,
+                         output_bin_indices, num_top_bins);
+}
+
+/**
+ * @brief Fast path of fft_context_top_bins_inplace(), without argument checks
+ */
+void fft_context_execute_inplace(
+    fft_context_t *ctx,
+    q15_t *input_signal,
+    uint16_t *output_bin_indices,
+    uint16_t num_top_bins
+)
+{
+    RFFT_PROFILE_START();
+
+    if (ctx->window != NULL) {
+        fft_context_load(ctx, input_signal, input_signal, ctx->fft_size, NULL);
+        RFFT_PROFILE_MARK(RFFT_PROFILE_COPY);
+    } else if (ctx->stats != NULL) {
+        /* Nothing to copy, the statistics need a pass of their own */
+        fft_stats_reset(ctx->stats);
+        fft_stats_add(ctx->stats, input_signal, ctx->fft_size);
+        RFFT_PROFILE_MARK(RFFT_PROFILE_COPY);
     }
-#endif
     
-    if (num_top_bins == 0 || num_top_bins > (fft_size / 2)) {
+    top_bins_from_buffer(ctx, input_signal,
+                         output_bin_indices, num_top_bins);
+}
+
+/*
+ * Gain of Jacobsen's estimator per window, Q12: the main lobe of a window
+ * is wider than that of the rectangle the plain estimator assumes.
+ */
+static const uint16_t interp_gain_q12[] = {
+    [FFT_WINDOW_RECT] = 4096,       /* 1.0 */
+    [FFT_WINDOW_HANN] = 8192,       /* 2.0 */
+    [FFT_WINDOW_HAMMING] = 7455,    /* 1.82 */
+    [FFT_WINDOW_BLACKMAN] = 10240,  /* 2.5 */
+};
+
+/* Bin k of the last top N search, bins -1 and fft_size / 2 + 1 mirrored */
+static void refine_bin(const fft_context_t *ctx, const q15_t *buffer,
+                       int32_t k, q31_t *re, q31_t *im)
+{
+    int32_t half = ctx->fft_size / 2;
+    int32_t mirror = (k < 0) ? -k : ((k > half) ? 2 * half - k : k);
+    q15_t bin[2];
+
+    if (ctx->mixed != NULL) {
+        arm_rfft_q15_mag_sq_mixed_bin(ctx->mixed, buffer, ctx->mixed_buffer,
+                                      (uint32_t)mirror, bin);
+#if defined(RFFT_Q15_STOCKHAM)
+    } else if (ctx->cfft_fn == NULL && ctx->stockham_buffer != NULL) {
+        arm_rfft_q15_mag_sq_stockham_bin(ctx->rfft, buffer, ctx->stockham_buffer,
+                                         (uint32_t)mirror, bin);
+#endif
+    } else {
+        arm_rfft_q15_mag_sq_bin(ctx->rfft, buffer, (uint32_t)mirror, bin);
+    }
+
+    /* X[-k] is the complex conjugate of X[k] for a real input */
+    *re = bin[0];
+    *im = (mirror != k) ? -bin[1] : bin[1];
+}
+
+/*
+ * num * 2^FFT_BIN_FRAC_BITS / (den * 2^12), rounded and limited to half
+ * a bin, one quotient bit per step: the 7 bits below the limit take 7
+ * steps, where a 64-bit division is a libgcc call on RV32.
+ */
+static int32_t refine_ratio(int64_t num, uint64_t den)
+{
+    const uint32_t limit = 1U << (FFT_BIN_FRAC_BITS - 1U);
+    uint64_t a = (num < 0) ? (uint64_t)-num : (uint64_t)num;
+    uint64_t b = den << (12U - FFT_BIN_FRAC_BITS);
+    uint32_t q = 0;
+
+    if (den == 0) {
+        return 0;
+    }
+
+    if (a >= b * limit) {
+        q = limit;
+    } else {
+        for (int32_t bit = FFT_BIN_FRAC_BITS - 2; bit >= 0; bit--) {
+            if (a >= (b << bit)) {
+                a -= b << bit;
+                q |= 1U << bit;
+            }
+        }
+        if (2U * a >= b && q < limit) {
+            q++;
+        }
+    }
+
+    return (num < 0) ? -(int32_t)q : (int32_t)q;
+}
+
+/**
+ * @brief Interpolate the peak position of bins found by a top N search
+ */
+void fft_context_refine_bins(
+    const fft_context_t *ctx,
+    const q15_t *buffer,
+    const uint16_t *bin_indices,
+    uint32_t *peaks,
+    uint16_t num_bins
+)
+{
+    int64_t gain = interp_gain_q12[ctx->window_type];
+
+    for (uint16_t i = 0; i < num_bins; i++) {
+        int32_t k = bin_indices[i];
+        q31_t ar, ai, br, bi, cr, ci;
+        int32_t peak;
+
+        refine_bin(ctx, buffer, k - 1, &ar, &ai);
+        refine_bin(ctx, buffer, k, &br, &bi);
+        refine_bin(ctx, buffer, k + 1, &cr, &ci);
+
+        /* delta = gain * Re((X[k-1] - X[k+1]) / (2 X[k] - X[k-1] - X[k+1])) */
+        q31_t nr = ar - cr, ni = ai - ci;
+        q31_t dr = 2 * br - ar - cr, di = 2 * bi - ai - ci;
+        int64_t num = ((int64_t)nr * dr + (int64_t)ni * di) * gain;
+        uint64_t den = (uint64_t)((int64_t)dr * dr + (int64_t)di * di);
+
+        peak = (k << FFT_BIN_FRAC_BITS) + refine_ratio(num, den);
+        peaks[i] = (peak < 0) ? 0U : (uint32_t)peak;
+    }
+}
+
+/* Destination of the watched bins, whichever path forms them */
+typedef struct {
+    const uint16_t *bins;
+    uint16_t num_bins;
+    uint16_t next;
+    uint32_t *mag_sq;
+} watch_bins_t;
+
+/* rfft_q15_bin_fn: keep the bin if it is the next one watched */
+static void watch_bins_add(uint32_t bin, uint32_t mag_sq, void *user)
+{
+    watch_bins_t *dst = user;
+
+    if (dst->next < dst->num_bins && dst->bins[dst->next] == bin) {
+        dst->mag_sq[dst->next++] = mag_sq;
+    }
+}
+
+/**
+ * @brief Magnitude² of a fixed set of bins, by whichever path is cheaper
+ */
+rfft_status_t fft_context_watch_bins(
+    fft_context_t *ctx,
+    const q15_t *input_signal,
+    const spectral_dft_t *dft,
+    uint32_t *output_mag_sq
+)
+{
+    watch_bins_t dst;
+
+    if (ctx == NULL || input_signal == NULL || dft == NULL ||
+        output_mag_sq == NULL || ctx->work_buffer == NULL) {
+        return RFFT_ERROR_NULL_POINTER;
+    }
+
+    if (dft->fft_size != ctx->fft_size) {
         return RFFT_ERROR_INVALID_SIZE;
     }
+
+    dst.bins = dft->bins;
+    dst.num_bins = dft->num_bins;
+    dst.next = 0;
+    dst.mag_sq = output_mag_sq;
+
+    fft_context_load(ctx, ctx->work_buffer, input_signal, ctx->fft_size, NULL);
+
+    /* Both paths report the bins in ascending order */
+    if (spectral_dft_preferred(dft->fft_size, dft->num_bins)) {
+        spectral_dft_mag_sq(dft, ctx->work_buffer, watch_bins_add, &dst);
+    } else if (ctx->mixed != NULL) {
+        arm_rfft_q15_mag_sq_mixed(ctx->mixed, ctx->work_buffer, ctx->mixed_buffer,
+                                  watch_bins_add, &dst);
+    } else {
+        arm_rfft_q15_mag_sq(ctx->rfft, ctx->work_buffer, watch_bins_add, &dst);
+    }
+
+    return RFFT_SUCCESS;
+}
+
+/**
+ * @brief Get the context behind find_fft_top_bins()
+ */
+fft_context_t *fft_context_get_default(uint16_t fft_size)
+{
+    /* The instances are prebuilt, only a size change touches the context */
+    if (default_context.rfft == NULL ||
+        default_context.fft_size != fft_size) {
+        if (fft_context_init(&default_context, fft_size, fft_input_buffer,
+                             top_bins_storage, FFT_TOP_BINS_MAX) != RFFT_SUCCESS) {
+            return NULL;
+        }
+#if defined(FFT_DEFAULT_WINDOW)
+        (void)fft_context_set_window(&default_context, FFT_DEFAULT_WINDOW,
+                                     default_window);
+#endif
+#if defined(FFT_DEFAULT_PEAK_SPACING)
+        (void)fft_context_set_peaks(&default_context, FFT_DEFAULT_PEAK_SPACING,
+                                    FFT_DEFAULT_PEAK_HARMONICS);
+#endif
+    }
     
-    /* Initialize RFFT instance */
-    arm_rfft_instance_q15 rfft_instance;
-    rfft_status_t status;
+    return &default_context;
+}
+
+/**
+ * @brief Find the top N frequency bins with highest magnitude from FFT
+ */
+rfft_status_t find_fft_top_bins(
+    const q15_t *input_signal,
+    uint16_t input_length,
+    uint16_t fft_size,
+    uint16_t *output_bin_indices,
+    uint16_t num_top_bins
+)
+{
+    fft_context_t *ctx;
     
-    if (fft_size == 4096) {
-        status = rfft_q15_init_4096(&rfft_instance);
-    } 
-#ifdef ENABLE_FFT_8K
-    else {
-        status = rfft_q15_init_8192(&rfft_instance);
+    if (input_signal == NULL || output_bin_indices == NULL) {
+        return RFFT_ERROR_NULL_POINTER;
     }
-#else
-    else {
+    
+    ctx = fft_context_get_default(fft_size);
+    if (ctx == NULL) {
         return RFFT_ERROR_INVALID_SIZE;
     }
-#endif
     
+    return fft_context_top_bins(ctx, input_signal, input_length,
+                                output_bin_indices, num_top_bins);
+}
+
+/**
+ * @brief Find the top N frequency bins and their sub-bin peak positions
+ */
+rfft_status_t find_fft_top_bins_refined(
+    const q15_t *input_signal,
+    uint16_t input_length,
+    uint16_t fft_size,
+    uint16_t *output_bin_indices,
+    uint32_t *output_peaks,
+    uint16_t num_top_bins
+)
+{
+    fft_context_t *ctx;
+    rfft_status_t status;
+    
+    if (output_peaks == NULL) {
+        return RFFT_ERROR_NULL_POINTER;
+    }
+    
+    status = find_fft_top_bins(input_signal, input_length, fft_size,
+                               output_bin_indices, num_top_bins);
     if (status != RFFT_SUCCESS) {
         return status;
     }
     
-    /* Copy input to working buffer */
-    memcpy(fft_input_buffer, input_signal, fft_size * sizeof(q15_t));
+    /* find_fft_top_bins() left the CFFT result in the default work buffer */
+    ctx = fft_context_get_default(fft_size);
+    fft_context_refine_bins(ctx, ctx->work_buffer, output_bin_indices,
+                            output_peaks, num_top_bins);
     
-    /* Perform RFFT */
-    arm_rfft_q15(&rfft_instance, fft_input_buffer, fft_output_buffer);
+    return RFFT_SUCCESS;
+}
+
+/**
+ * @brief Find the top N frequency bins, using the input as work buffer
+ */
+rfft_status_t find_fft_top_bins_inplace(
+    q15_t *input_signal,
+    uint16_t fft_size,
+    uint16_t *output_bin_indices,
+    uint16_t num_top_bins
+)
+{
+    fft_context_t *ctx;
     
-    /* Allocate array for top bins (on stack) */
-    bin_magnitude_t top_bins[num_top_bins];
+    if (input_signal == NULL || output_bin_indices == NULL) {
+        return RFFT_ERROR_NULL_POINTER;
+    }
     
-    /* Initialize top_bins array */
-    for (uint16_t i = 0; i < num_top_bins; i++) {
-        top_bins[i].bin_index = 0;
-        top_bins[i].magnitude_squared = 0;
+    ctx = fft_context_get_default(fft_size);
+    if (ctx == NULL) {
+        return RFFT_ERROR_INVALID_SIZE;
     }
     
-    /* Calculate magnitude² for all bins and find top N */
-    /* Note: Skip DC bin (bin 0) */
-    uint16_t num_bins = fft_size / 2 + 1;
-    
-    for (uint16_t bin = 1; bin < num_bins; bin++) {
-        /* Get real and imaginary parts (13.3 format for 4096, 14.2 for 8192) */
-        int16_t real = fft_output_buffer[bin * 2];
-        int16_t imag = fft_output_buffer[bin * 2 + 1];
-        
-        /* Calculate magnitude² (using raw values to avoid overflow) */
-        uint32_t mag_sq = (uint32_t)((int32_t)real * real + (int32_t)imag * imag);
-        
-        /* Check if this bin should be in top N */
-        for (uint16_t i = 0; i < num_top_bins; i++) {
-            if (mag_sq > top_bins[i].magnitude_squared) {
-                /* Insert at position i, shift others down */
-                for (uint16_t j = num_top_bins - 1; j > i; j--) {
-                    top_bins[j] = top_bins[j - 1];
-                }
-                top_bins[i].bin_index = bin;
-                top_bins[i].magnitude_squared = mag_sq;
-                break;
-            }
+    return fft_context_top_bins_inplace(ctx, input_signal,
+                                        output_bin_indices, num_top_bins);
+}
+
+#if defined(FFT_UTILS_Q31)
+/*
+ * floor(sqrt(v)), one result bit per step of shifts and subtractions:
+ * Newton steps would each take a 64-bit division, a libgcc call on RV32.
+ */
+static uint32_t isqrt64(uint64_t v)
+{
+    uint64_t root = 0;
+    uint64_t bit = 1ULL << 62;
+
+    while (bit > v) {
+        bit >>= 2;
+    }
+
+    while (bit != 0) {
+        if (v >= root + bit) {
+            v -= root + bit;
+            root = (root >> 1) + bit;
+        } else {
+            root >>= 1;
         }
+        bit >>= 2;
+    }
+
+    return (uint32_t)root;
+}
+
+/* rfft_q31_bin_fn: offer the magnitude of one bin to the top N selection */
+static void top_bins_add_q31(uint32_t bin, uint64_t mag_sq, void *user)
+{
+    spectral_topk_t *topk = user;
+    uint64_t threshold = spectral_topk_threshold(topk);
+
+    /* Note: Skip DC bin (bin 0) */
+    if (bin == 0 || mag_sq <= threshold * threshold) {
+        return;
+    }
+
+    spectral_topk_push(topk, (uint16_t)bin, isqrt64(mag_sq));
+}
+
+/**
+ * @brief Find the top N frequency bins of a Q31 frame, running the FFT in place
+ */
+rfft_status_t find_fft_top_bins_q31_inplace(
+    q31_t *input_signal,
+    uint16_t fft_size,
+    uint16_t *output_bin_indices,
+    uint16_t num_top_bins
+)
+{
+    const arm_rfft_instance_q31 *rfft;
+    spectral_topk_t topk;
+    
+    if (input_signal == NULL || output_bin_indices == NULL) {
+        return RFFT_ERROR_NULL_POINTER;
     }
     
-    /* Copy bin indices to output array */
+    rfft = rfft_q31_get_instance(fft_size);
+    if (rfft == NULL || num_top_bins == 0 || num_top_bins > (fft_size / 2) ||
+        num_top_bins > FFT_TOP_BINS_MAX) {
+        return RFFT_ERROR_INVALID_SIZE;
+    }
+    
+    spectral_topk_init(&topk, top_bins_storage, num_top_bins);
+    arm_rfft_q31_mag_sq(rfft, input_signal, top_bins_add_q31, &topk);
+    
+    const spectral_peak_t *top_bins = spectral_topk_finish(&topk);
+    
     for (uint16_t i = 0; i < num_top_bins; i++) {
         output_bin_indices[i] = top_bins[i].bin_index;
     }
     
     return RFFT_SUCCESS;
 }
+#endif /* FFT_UTILS_Q31 */
@@ -10,19 +10,67 @@
 #define FFT_UTILS_H
 
 #include "rfft_q15_simplified.h"
+#include "spectral_topk.h"
+#include "spectral_psd.h"
+#include "spectral_dft.h"
+#include "spectral_mel.h"
+#include "spectral_floor.h"
+#include "spectral_track.h"
+#include "spectral_gram.h"
+#include "spectral_cross.h"
+#include "fft_envelope.h"
+#include "fft_stats.h"
+
+/* FFT_UTILS_Q31 adds find_fft_top_bins_q31_inplace(), on the Q31 RFFT */
+#if defined(FFT_UTILS_Q31)
+#include "rfft_q31_simplified.h"
+#endif
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/** Largest num_top_bins accepted by find_fft_top_bins() */
+#ifndef FFT_TOP_BINS_MAX
+#define FFT_TOP_BINS_MAX 64
+#endif
+
+/**
+ * @brief Window applied to the frame before the RFFT
+ *
+ * Periodic (DFT-even) windows, w[n] = w[fft_size - n], so half a table of
+ * FFT_WINDOW_TABLE_LEN(fft_size) entries describes the whole window.
+ */
+typedef enum {
+    FFT_WINDOW_RECT = 0,    /**< No window, the frame is used as is */
+    FFT_WINDOW_HANN,        /**< 0.5 - 0.5 cos */
+    FFT_WINDOW_HAMMING,     /**< 0.54 - 0.46 cos */
+    FFT_WINDOW_BLACKMAN,    /**< 0.42 - 0.5 cos + 0.08 cos(2x) */
+} fft_window_type_t;
+
+/** Entries of the half window table of an fft_size-point window */
+#define FFT_WINDOW_TABLE_LEN(fft_size)  ((fft_size) / 2U + 1U)
+
+/*
+ * FFT_DEFAULT_WINDOW selects the window of the context behind
+ * find_fft_top_bins(), e.g. -DFFT_DEFAULT_WINDOW=FFT_WINDOW_HANN. Defining
+ * it reserves a half window table for RFFT_Q15_MAX_FFT_LEN points, or
+ * with RFFT_Q15_CONST_WINDOWS uses the generated ones, which must include
+ * it; left undefined, no window is applied.
+ *
+ * FFT_DEFAULT_PEAK_SPACING, with FFT_DEFAULT_PEAK_HARMONICS, has that
+ * context report distinct peaks as fft_context_set_peaks() describes.
+ */
+
 /**
  * @brief Find the top N frequency bins with highest magnitude from FFT
  * 
  * @param[in]  input_signal      Pointer to input signal buffer (Q15 format)
  * @param[in]  input_length      Length of input signal (must equal fft_size)
- * @param[in]  fft_size          FFT size (4096 or 8192)
+ * @param[in]  fft_size          FFT size (RFFT_Q15_MIN_FFT_LEN to RFFT_Q15_MAX_FFT_LEN)
  * @param[out] output_bin_indices Array to store sorted bin indices (size >= num_top_bins)
- * @param[in]  num_top_bins      Number of top bins to find (e.g., 20)
+ * @param[in]  num_top_bins      Number of top bins to find (e.g., 20),
+ *                               at most FFT_TOP_BINS_MAX
  * 
  * @return rfft_status_t
  *         - RFFT_SUCCESS: Operation successful
@@ -32,9 +80,11 @@ extern "C" {
  * @note This function:
  *       - Performs RFFT on the input signal
  *       - Calculates magnitude² for all frequency bins
- *       - Sorts bins by magnitude and returns top N bin indices
+ *       - Selects the top N bins with spectral_topk, O(bins * log N)
+ *         worst case, and returns their indices sorted by magnitude
  *       - Skips DC bin (bin 0) in the results
- *       - Uses static buffers internally (not thread-safe)
+ *       - Uses static buffers internally (not thread-safe), use an
+ *         fft_context_t to run transforms concurrently
  * 
  * @example
  *   q15_t signal[4096];
@@ -64,6 +114,969 @@ rfft_status_t find_fft_top_bins(
     uint16_t num_top_bins
 );
 
+/**
+ * @brief Find the top N frequency bins, running the FFT in place
+ * 
+ * Same as find_fft_top_bins() but the RFFT works directly on input_signal
+ * instead of on a private copy, which saves copying the whole frame. Use it
+ * when the caller owns a buffer it no longer needs, e.g. a frame in the
+ * shared frame pool.
+ * 
+ * @param[in,out] input_signal    Input signal (Q15), fft_size samples.
+ *                                Overwritten by the FFT. Must be
+ *                                aligned to RFFT_Q15_ALIGN.
+ * @param[in]  fft_size           FFT size (RFFT_Q15_MIN_FFT_LEN to RFFT_Q15_MAX_FFT_LEN)
+ * @param[out] output_bin_indices Array to store sorted bin indices (size >= num_top_bins)
+ * @param[in]  num_top_bins       Number of top bins to find
+ * 
+ * @return rfft_status_t, as for find_fft_top_bins()
+ */
+rfft_status_t find_fft_top_bins_inplace(
+    q15_t *input_signal,
+    uint16_t fft_size,
+    uint16_t *output_bin_indices,
+    uint16_t num_top_bins
+);
+
+/** Fraction bits of the sub-bin peak positions, 1/256 of a bin */
+#define FFT_BIN_FRAC_BITS 8
+
+/**
+ * @brief Find the top N frequency bins and their sub-bin peak positions
+ * 
+ * find_fft_top_bins(), then fft_context_refine_bins() on the bins found.
+ * 
+ * @param[in]  input_signal       Pointer to input signal buffer (Q15 format)
+ * @param[in]  input_length       Length of input signal (must equal fft_size)
+ * @param[in]  fft_size           FFT size (RFFT_Q15_MIN_FFT_LEN to RFFT_Q15_MAX_FFT_LEN)
+ * @param[out] output_bin_indices Array to store sorted bin indices (size >= num_top_bins)
+ * @param[out] output_peaks       Peak position of each bin in 1/2^FFT_BIN_FRAC_BITS
+ *                                bins, in the same order (size >= num_top_bins)
+ * @param[in]  num_top_bins       Number of top bins to find, at most FFT_TOP_BINS_MAX
+ * 
+ * @return rfft_status_t, as for find_fft_top_bins()
+ * 
+ * @example
+ *   // Tone frequency in Hz
+ *   uint32_t hz = (uint32_t) (((uint64_t) peaks[0] * sample_rate) /
+ *                             ((uint32_t) fft_size << FFT_BIN_FRAC_BITS));
+ */
+rfft_status_t find_fft_top_bins_refined(
+    const q15_t *input_signal,
+    uint16_t input_length,
+    uint16_t fft_size,
+    uint16_t *output_bin_indices,
+    uint32_t *output_peaks,
+    uint16_t num_top_bins
+);
+
+/**
+ * @brief Forward CFFT of a context run by the caller
+ *
+ * Must leave the result of arm_cfft_q15(cfft, buffer, 0, 0) in buffer, in
+ * bit-reversed order, for instance with arm_cfft_q15_split() and the two
+ * halves on different cores.
+ *
+ * @param[in]     cfft    CFFT instance of the context's RFFT
+ * @param[in,out] buffer  Packed real input, fft_size samples
+ * @param[in]     user    Pointer given to fft_context_set_cfft()
+ */
+typedef void (*fft_cfft_fn)(const arm_cfft_instance_q15 *cfft, q15_t *buffer, void *user);
+
+/**
+ * @brief State for repeated transforms of one size
+ *
+ * The context holds the RFFT instance and points to buffers owned by the
+ * caller; it has no hidden shared state. Transforms on different contexts
+ * may run concurrently, e.g. one per channel or one per half of a double
+ * buffer. A single context must not be used by two threads at once.
+ *
+ * The RFFT instance is one of the const arm_rfft_sR_q15_len* tables in
+ * flash, so initializing a context does no table setup at all. A context
+ * set up by fft_context_init_mixed() has none, it runs a mixed radix
+ * plan instead.
+ *
+ * A window set with fft_context_set_window() is applied while the frame
+ * is copied into the work buffer, or in place by the in-place variants;
+ * either way it costs no extra pass over the frame.
+ */
+typedef struct {
+    const arm_rfft_instance_q15 *rfft; /**< Prebuilt RFFT instance for fft_size */
+    uint16_t fft_size;               /**< FFT size (RFFT_Q15_MIN_FFT_LEN to RFFT_Q15_MAX_FFT_LEN) */
+    q15_t *work_buffer;              /**< fft_size samples, or NULL for in-place use only */
+    spectral_peak_t *top_bins;       /**< Top N selection storage */
+    uint16_t max_top_bins;           /**< Entries in top_bins */
+    const q15_t *window;             /**< Half window table, or NULL for none */
+    fft_window_type_t window_type;   /**< Type of window, for the peak interpolation */
+    spectral_psd_t *psd;             /**< Average fed by every transform, or NULL */
+    spectral_band_t *bands;          /**< Bands summed from every transform, or NULL */
+    uint16_t num_bands;              /**< Entries in bands */
+    spectral_band_edge_t *band_edges; /**< 2 * num_bands edges of a band table, or NULL */
+    spectral_mel_t *mel;             /**< Filterbank fed by every transform, or NULL */
+    spectral_floor_t *floor;         /**< Noise floor fed by every transform, or NULL */
+    spectral_gram_t *gram;           /**< Spectrogram row fed by every transform, or NULL */
+    spectral_track_t *track;         /**< Top bins tracked from transform to transform, or NULL */
+    uint16_t peak_spacing;           /**< Bins between two peaks reported, 0 for every bin */
+    uint16_t peak_harmonics;         /**< Highest harmonic folded into its fundamental */
+    const arm_cfft_instance_q15 *pair_cfft; /**< fft_size-point CFFT for channel pairs */
+    q15_t *pair_buffer;              /**< 2 * fft_size samples for channel pairs, or NULL */
+    spectral_cross_t *cross;         /**< Cross spectrum of channels 0 and 1, or NULL */
+    fft_envelope_t *envelope;        /**< Envelope chain run instead of the RFFT, or NULL */
+    fft_stats_t *stats;              /**< Time-domain sums of every frame loaded, or NULL */
+    fft_cfft_fn cfft_fn;             /**< CFFT of the RFFT run by the caller, or NULL */
+    void *cfft_user;                 /**< Passed to cfft_fn */
+    q15_t *stockham_buffer;          /**< fft_size samples for the Stockham CFFT, or NULL */
+    const rfft_mixed_q15_t *mixed;   /**< Mixed radix plan run instead of rfft, or NULL */
+    q15_t *mixed_buffer;             /**< fft_size samples the mixed radix CFFT ping-pongs with */
+} fft_context_t;
+
+/**
+ * @brief Prepare a context for repeated transforms of one size
+ * 
+ * @param[out] ctx               Context to initialize
+ * @param[in]  fft_size          FFT size (RFFT_Q15_MIN_FFT_LEN to RFFT_Q15_MAX_FFT_LEN)
+ * @param[in]  work_buffer       fft_size samples aligned to RFFT_Q15_ALIGN,
+ *                               used by fft_context_top_bins() for its copy
+ *                               of the input. May be NULL when only
+ *                               fft_context_top_bins_inplace() is used.
+ * @param[in]  top_bins_storage  max_top_bins entries for the top N selection
+ * @param[in]  max_top_bins      Largest num_top_bins the context accepts
+ * 
+ * @return rfft_status_t
+ *         - RFFT_SUCCESS: Operation successful
+ *         - RFFT_ERROR_NULL_POINTER: NULL pointer provided
+ *         - RFFT_ERROR_INVALID_SIZE: Invalid FFT size or max_top_bins
+ * 
+ * @example
+ *   static q15_t work[4096] RFFT_Q15_ALIGN;
+ *   static spectral_peak_t peaks[20];
+ *   static fft_context_t ctx;
+ *   uint16_t top_bins[20];
+ *   
+ *   fft_context_init(&ctx, 4096, work, peaks, 20);
+ *   
+ *   while (read_frame(signal)) {
+ *       fft_context_top_bins(&ctx, signal, 4096, top_bins, 20);
+ *   }
+ */
+rfft_status_t fft_context_init(
+    fft_context_t *ctx,
+    uint16_t fft_size,
+    q15_t *work_buffer,
+    spectral_peak_t *top_bins_storage,
+    uint16_t max_top_bins
+);
+
+/**
+ * @brief Prepare a context for a length that is not a power of two
+ * 
+ * Like fft_context_init(), for the length of a plan set up by
+ * rfft_mixed_plan_create(), e.g. 3000 or 6000 points instead of a frame
+ * padded to 4096 or 8192. Every transform of the context runs
+ * arm_rfft_q15_mag_sq_mixed(), with the same bins, window, PSD, bands and
+ * the other options. fft_context_set_cfft() and the Stockham buffer do
+ * not apply and are rejected; channel pairs still need a power of two.
+ * 
+ * @param[out] ctx               Context to initialize
+ * @param[in]  plan              Mixed radix plan, used for as long as the context is
+ * @param[in]  work_buffer       plan->fftLenReal samples aligned to
+ *                               RFFT_Q15_ALIGN, or NULL as for fft_context_init()
+ * @param[in]  mixed_buffer      plan->fftLenReal samples aligned to
+ *                               RFFT_Q15_ALIGN, the second buffer of the CFFT
+ * @param[in]  top_bins_storage  max_top_bins entries for the top N selection
+ * @param[in]  max_top_bins      Largest num_top_bins the context accepts
+ * 
+ * @return rfft_status_t
+ *         - RFFT_SUCCESS: Operation successful
+ *         - RFFT_ERROR_NULL_POINTER: NULL pointer provided
+ *         - RFFT_ERROR_INVALID_SIZE: Invalid max_top_bins
+ * 
+ * @example
+ *   static q15_t sine[RFFT_MIXED_ARENA_LEN(3000)];
+ *   static q15_t work[3000] RFFT_Q15_ALIGN, buf[3000] RFFT_Q15_ALIGN;
+ *   static rfft_mixed_q15_t plan;
+ *   
+ *   rfft_mixed_plan_create(&plan, 3000, sine, RFFT_MIXED_ARENA_LEN(3000));
+ *   fft_context_init_mixed(&ctx, &plan, work, buf, peaks, 20);
+ *   fft_context_top_bins(&ctx, signal, 3000, top_bins, 20);
+ */
+rfft_status_t fft_context_init_mixed(
+    fft_context_t *ctx,
+    const rfft_mixed_q15_t *plan,
+    q15_t *work_buffer,
+    q15_t *mixed_buffer,
+    spectral_peak_t *top_bins_storage,
+    uint16_t max_top_bins
+);
+
+/**
+ * @brief Select the window applied before every transform of a context
+ * 
+ * Fills table with the first half of the window, from the shared twiddle
+ * table, so no floating point is needed. A window of fft_window_table()
+ * is used as it is instead, and table is left alone. fft_context_init()
+ * resets the context to no window.
+ * 
+ * @param[in,out] ctx    Initialized context
+ * @param[in]     type   Window type
+ * @param[out]    table  FFT_WINDOW_TABLE_LEN(fft_size) entries owned by
+ *                       the caller, may be NULL for FFT_WINDOW_RECT and
+ *                       a window of fft_window_table()
+ * 
+ * @return rfft_status_t
+ *         - RFFT_SUCCESS: Operation successful
+ *         - RFFT_ERROR_NULL_POINTER: NULL pointer provided
+ *         - RFFT_ERROR_INVALID_SIZE: Unknown window type
+ * 
+ * @example
+ *   static q15_t hann[FFT_WINDOW_TABLE_LEN(4096)];
+ *   
+ *   fft_context_init(&ctx, 4096, work, peaks, 20);
+ *   fft_context_set_window(&ctx, FFT_WINDOW_HANN, hann);
+ */
+rfft_status_t fft_context_set_window(
+    fft_context_t *ctx,
+    fft_window_type_t type,
+    q15_t *table
+);
+
+/**
+ * @brief Generated half table of a window
+ *
+ * With RFFT_Q15_CONST_WINDOWS the windows of gen_tables.py --windows are
+ * constants of every power of two length, bit-exact with the tables
+ * fft_context_set_window() computes.
+ *
+ * @param[in] type      Window type
+ * @param[in] fft_size  Points of the window
+ *
+ * @return FFT_WINDOW_TABLE_LEN(fft_size) entries, or NULL for a window
+ *         that was not generated
+ */
+const q15_t *fft_window_table(fft_window_type_t type, uint16_t fft_size);
+
+/**
+ * @brief Average the power spectrum of every frame a context transforms
+ * 
+ * Once set, every top N search of the context also adds the magnitude²
+ * of bins 0 to fft_size / 2 to psd, from the same RFFT pass, until
+ * spectral_psd_accepts() stops it. fft_context_init() resets the context
+ * to no average.
+ * 
+ * @param[in,out] ctx  Initialized context
+ * @param[in]     psd  Average with fft_size / 2 + 1 bins, or NULL for none
+ * 
+ * @return rfft_status_t
+ *         - RFFT_SUCCESS: Operation successful
+ *         - RFFT_ERROR_NULL_POINTER: NULL context provided
+ *         - RFFT_ERROR_INVALID_SIZE: psd has the wrong number of bins
+ * 
+ * @example
+ *   static uint32_t psd_bins[SPECTRAL_PSD_STORAGE_LEN(4096 / 2 + 1)];
+ *   static spectral_psd_t psd;
+ *   
+ *   spectral_psd_init(&psd, psd_bins, 4096 / 2 + 1, SPECTRAL_PSD_EXPONENTIAL, 4);
+ *   fft_context_set_psd(&ctx, &psd);
+ */
+rfft_status_t fft_context_set_psd(
+    fft_context_t *ctx,
+    spectral_psd_t *psd
+);
+
+/**
+ * @brief Sum the energy of bands of every frame a context transforms
+ * 
+ * Once set, every top N search of the context also sets the energy of
+ * each band to the sum of the magnitude² of its bins, from the same RFFT
+ * pass, with one compare per bin. With channels, the bands hold the last
+ * channel transformed. fft_context_init() resets the context to no bands.
+ * 
+ * @param[in,out] ctx        Initialized context
+ * @param[in,out] bands      num_bands bands in ascending order that do not
+ *                           overlap, up to bin fft_size / 2, or NULL
+ * @param[in]     num_bands  Entries in bands, 0 for none
+ * 
+ * @return rfft_status_t
+ *         - RFFT_SUCCESS: Operation successful
+ *         - RFFT_ERROR_NULL_POINTER: NULL context, or NULL bands of a
+ *           num_bands above 0
+ *         - RFFT_ERROR_INVALID_SIZE: A band out of order, overlapping or
+ *           beyond bin fft_size / 2
+ * 
+ * @example
+ *   static spectral_band_t hum = { .first_bin = 10, .last_bin = 14 };
+ *   
+ *   fft_context_set_bands(&ctx, &hum, 1);
+ */
+rfft_status_t fft_context_set_bands(
+    fft_context_t *ctx,
+    spectral_band_t *bands,
+    uint16_t num_bands
+);
+
+/**
+ * @brief Sum the energy of a table of bands, which may overlap
+ * 
+ * As fft_context_set_bands(), but the bands may come in any order and
+ * overlap, as octaves and their thirds do. The bins are summed once, into
+ * a running prefix sum that is read at the edges of the bands, so a band
+ * costs two updates instead of one compare per bin, whatever its width.
+ * Replaces the bands of fft_context_set_bands().
+ * 
+ * @param[in,out] ctx        Initialized context
+ * @param[in,out] bands      num_bands bands up to bin fft_size / 2, or NULL
+ * @param[in]     num_bands  Entries in bands, 0 for none
+ * @param[out]    edges      2 * num_bands entries owned by the caller,
+ *                           sorted here and read by every transform
+ * 
+ * @return rfft_status_t
+ *         - RFFT_SUCCESS: Operation successful
+ *         - RFFT_ERROR_NULL_POINTER: NULL context, or NULL bands or edges
+ *           of a num_bands above 0
+ *         - RFFT_ERROR_INVALID_SIZE: A band ending before it starts or
+ *           beyond bin fft_size / 2, or more than 32767 bands
+ * 
+ * @example
+ *   static spectral_band_t octaves[3] = {
+ *       { .first_bin = 16, .last_bin = 31 },
+ *       { .first_bin = 32, .last_bin = 63 },
+ *       { .first_bin = 20, .last_bin = 25 },
+ *   };
+ *   static spectral_band_edge_t edges[2 * 3];
+ *   
+ *   fft_context_set_band_table(&ctx, octaves, 3, edges);
+ */
+rfft_status_t fft_context_set_band_table(
+    fft_context_t *ctx,
+    spectral_band_t *bands,
+    uint16_t num_bands,
+    spectral_band_edge_t *edges
+);
+
+/**
+ * @brief Drop the bins below the noise floor from the top bins
+ * 
+ * Every transform feeds the magnitude² of bins 0 to fft_size / 2 to
+ * est, from the same RFFT pass, and only bins above the threshold of
+ * the frames before it enter the top bins. The places left read as bin
+ * 0, so the top bins of a frame of noise are all 0. fft_context_init()
+ * resets the context to no floor.
+ * 
+ * @param[in,out] ctx  Initialized context
+ * @param[in,out] est  Estimator with fft_size / 2 + 1 bins, or NULL for none
+ * 
+ * @return rfft_status_t
+ *         - RFFT_SUCCESS: Operation successful
+ *         - RFFT_ERROR_NULL_POINTER: NULL context
+ *         - RFFT_ERROR_INVALID_SIZE: floor has the wrong number of bins
+ * 
+ * @example
+ *   static uint32_t blocks[SPECTRAL_FLOOR_BLOCKS(4096 / 2 + 1, 4)];
+ *   static spectral_floor_t noise;
+ *   
+ *   spectral_floor_init(&noise, blocks, 4096 / 2 + 1, 4, 2);
+ *   fft_context_set_floor(&ctx, &noise);
+ */
+rfft_status_t fft_context_set_floor(
+    fft_context_t *ctx,
+    spectral_floor_t *est
+);
+
+/**
+ * @brief Track the top bins from frame to frame
+ * 
+ * Every transform compares the bins near the peaks of track with them,
+ * from the same RFFT pass, and only bins that would take the place of a
+ * tracked peak enter the top bins, see spectral_track_t; most bins then
+ * cost a single compare in the selection. After the transform,
+ * track->changes lists the places that changed, while the top bins are
+ * those of the selection: once the set is full only the bins above
+ * spectral_track_threshold(), bin 0 for the rest. The bins below the noise floor of
+ * fft_context_set_floor() are removed from the set. For one channel
+ * only. fft_context_init() resets the context to no tracking.
+ * 
+ * @param[in,out] ctx    Initialized context
+ * @param[in,out] track  Tracker filled from the top bins of every
+ *                       transform, or NULL for none
+ * 
+ * @return rfft_status_t
+ *         - RFFT_SUCCESS: Operation successful
+ *         - RFFT_ERROR_NULL_POINTER: NULL context
+ * 
+ * @example
+ *   spectral_track_init(&track, places, changes, 20, 2, 2);
+ *   fft_context_set_track(&ctx, &track);
+ *   fft_context_top_bins(&ctx, samples, 4096, top_bins, 20);
+ *   for (uint16_t i = 0; i < track.num_changes; i++) {
+ *       report(&track.changes[i]);
+ *   }
+ */
+rfft_status_t fft_context_set_track(
+    fft_context_t *ctx,
+    spectral_track_t *track
+);
+
+/**
+ * @brief Report distinct peaks instead of the strongest bins
+ * 
+ * With a min_spacing above 0, the top bins of every transform are local
+ * maxima of the magnitude² at least min_spacing bins apart, see
+ * spectral_peaks_t, so a leaky tone takes one place instead of several.
+ * With a max_harmonic of 2 or more as well, the peaks near 2 to
+ * max_harmonic times a lower one are folded into it, see
+ * spectral_peaks_group_harmonics(), and the top bins are the fundamentals
+ * ranked by the magnitude² of their group; the selection then runs over
+ * all max_top_bins places of the context. Places left without a peak read
+ * as bin 0. fft_context_init() resets the context to plain top bins.
+ * 
+ * @param[in,out] ctx           Initialized context
+ * @param[in]     min_spacing   Bins between two peaks, 0 for plain top bins
+ * @param[in]     max_harmonic  Highest harmonic grouped, below 2 for none
+ * 
+ * @return rfft_status_t
+ *         - RFFT_SUCCESS: Operation successful
+ *         - RFFT_ERROR_NULL_POINTER: NULL context
+ *         - RFFT_ERROR_INVALID_SIZE: Harmonics grouped without peak picking
+ * 
+ * @example
+ *   // Tones at least 3 bins apart, each with up to its 5th harmonic
+ *   fft_context_set_peaks(&ctx, 3, 5);
+ */
+rfft_status_t fft_context_set_peaks(
+    fft_context_t *ctx,
+    uint16_t min_spacing,
+    uint16_t max_harmonic
+);
+
+/**
+ * @brief Run a filterbank over every frame a context transforms
+ * 
+ * Every transform restarts the filter energies of mel and feeds it the
+ * magnitude² of bins 0 to fft_size / 2, from the same RFFT pass, next to
+ * the bands and average if any. The features are read after the
+ * transform with spectral_mel_log2() and spectral_mel_dct(). With
+ * channels, mel holds the last channel transformed. fft_context_init()
+ * resets the context to no filterbank.
+ * 
+ * @param[in,out] ctx  Initialized context
+ * @param[in]     mel  Filterbank of ctx->fft_size set up by
+ *                     spectral_mel_init(), or NULL for none
+ * 
+ * @return rfft_status_t
+ *         - RFFT_SUCCESS: Operation successful
+ *         - RFFT_ERROR_NULL_POINTER: NULL context
+ *         - RFFT_ERROR_INVALID_SIZE: mel laid out for another fft_size
+ * 
+ * @example
+ *   spectral_mel_init(&mel, &config, energy, weight, edge);
+ *   fft_context_set_mel(&ctx, &mel);
+ *   fft_context_top_bins(&ctx, samples, peaks, 1);
+ *   spectral_mel_log2(&mel, features, 10);
+ */
+rfft_status_t fft_context_set_mel(
+    fft_context_t *ctx,
+    spectral_mel_t *mel
+);
+
+/**
+ * @brief Pool every frame a context transforms into a spectrogram row
+ * 
+ * Every transform restarts the columns of gram and feeds it the
+ * magnitude² of bins 0 to fft_size / 2, from the same RFFT pass, next to
+ * the other extras if any. The row is read after the transform from
+ * gram->column. A caller that wants a row of only some frames sets gram
+ * before those and NULL before the others, which then cost nothing.
+ * fft_context_init() resets the context to no row.
+ * 
+ * @param[in,out] ctx   Initialized context
+ * @param[in,out] gram  Row over fft_size / 2 + 1 bins, or NULL for none
+ * 
+ * @return rfft_status_t
+ *         - RFFT_SUCCESS: Operation successful
+ *         - RFFT_ERROR_NULL_POINTER: NULL context
+ *         - RFFT_ERROR_INVALID_SIZE: gram has the wrong number of bins
+ * 
+ * @example
+ *   spectral_gram_init(&row, columns, 4096 / 2 + 1, 64);
+ *   fft_context_set_gram(&ctx, &row);
+ *   fft_context_top_bins(&ctx, samples, peaks, 1);
+ *   // row.column[0] to row.column[63] hold the frame
+ */
+rfft_status_t fft_context_set_gram(
+    fft_context_t *ctx,
+    spectral_gram_t *gram
+);
+
+/**
+ * @brief Run the CFFT inside the RFFT of a context with a function of the caller
+ * 
+ * Once set, the single-channel transforms of the context hand the CFFT
+ * of their RFFT to fn, which may share it out, e.g. with another core
+ * over shared memory, and form the bins from its result as usual.
+ * fft_context_init() resets the context to its own CFFT.
+ * 
+ * @param[in,out] ctx   Initialized context
+ * @param[in]     fn    CFFT to run, or NULL for arm_cfft_q15()
+ * @param[in]     user  Passed to fn
+ * 
+ * @return rfft_status_t
+ *         - RFFT_SUCCESS: Operation successful
+ *         - RFFT_ERROR_NULL_POINTER: NULL context provided
+ *         - RFFT_ERROR_INVALID_SIZE: fn for a context of fft_context_init_mixed()
+ * 
+ * @example
+ *   fft_context_init(&ctx, 8192, NULL, peaks, 20);
+ *   fft_context_set_cfft(&ctx, split_cfft, &peer);
+ */
+rfft_status_t fft_context_set_cfft(
+    fft_context_t *ctx,
+    fft_cfft_fn fn,
+    void *user
+);
+
+#if defined(RFFT_Q15_STOCKHAM)
+/**
+ * @brief Run the CFFT of a context in Stockham order, on a second buffer
+ * 
+ * Once set, the single-channel transforms of the context ping-pong their
+ * CFFT between the frame and stockham_buffer with
+ * arm_rfft_q15_mag_sq_stockham(), which needs no bit reversal and reads
+ * and writes both in sequential runs. The bins are the same.
+ * Depending on fft_size the spectrum ends up in either buffer;
+ * fft_context_refine_bins() finds it in both, given the frame. A CFFT
+ * set with fft_context_set_cfft() takes precedence.
+ * fft_context_init() resets the context to no Stockham buffer.
+ * 
+ * @param[in,out] ctx              Initialized context
+ * @param[in]     stockham_buffer  fft_size samples aligned to RFFT_Q15_ALIGN,
+ *                                 or NULL for the in-place CFFT
+ * 
+ * @return rfft_status_t
+ *         - RFFT_SUCCESS: Operation successful
+ *         - RFFT_ERROR_NULL_POINTER: NULL context provided
+ *         - RFFT_ERROR_INVALID_SIZE: A buffer for a context of fft_context_init_mixed()
+ */
+rfft_status_t fft_context_set_stockham_buffer(
+    fft_context_t *ctx,
+    q15_t *stockham_buffer
+);
+#endif
+
+/**
+ * @brief Transform channels of interleaved frames in pairs
+ * 
+ * Once set, fft_context_top_bins_interleaved() loads two channels as the
+ * real and imaginary part of one fft_size-point arm_cfft_q15() and
+ * separates their spectra by conjugate symmetry, with adds only. That
+ * replaces the two split steps of two RFFTs, and their multiplies, by one
+ * more CFFT stage. The saving is in multiplies, which the FLPR does in
+ * software; it is not half of the transform time, since each RFFT already
+ * packs its frame into a half-length CFFT. An odd last channel still
+ * takes the RFFT. Needs the CFFT of the next larger RFFT size, so a
+ * context of RFFT_Q15_MAX_FFT_LEN points cannot use it.
+ * fft_context_init() resets the context to no pair buffer.
+ * 
+ * The results equal those of the RFFT up to rounding: both are scaled by
+ * 1/fft_size, but the last bit of a bin may differ.
+ * 
+ * @param[in,out] ctx          Initialized context
+ * @param[in]     pair_buffer  2 * fft_size samples aligned to RFFT_Q15_ALIGN,
+ *                             or NULL to transform every channel alone
+ * 
+ * @return rfft_status_t
+ *         - RFFT_SUCCESS: Operation successful
+ *         - RFFT_ERROR_NULL_POINTER: NULL context provided
+ *         - RFFT_ERROR_INVALID_SIZE: No fft_size-point CFFT in the build
+ */
+rfft_status_t fft_context_set_pair_buffer(
+    fft_context_t *ctx,
+    q15_t *pair_buffer
+);
+
+/**
+ * @brief Average the cross spectrum of channels 0 and 1 of interleaved frames
+ * 
+ * Once set, fft_context_top_bins_interleaved() separates channels 0 and
+ * 1 from their shared CFFT once more and feeds cross with both spectra,
+ * bin by bin, before it picks their top bins. The averages and the
+ * coherence stay on the core that runs the transforms, only the
+ * spectral_cross_coherence() or the averages need to leave it. Channels
+ * 0 and 1 share a CFFT only with a pair buffer, so one must be set first.
+ * fft_context_init() resets the context to no cross spectrum.
+ * 
+ * @param[in,out] ctx    Initialized context with a pair buffer
+ * @param[in,out] cross  Average with fft_size / 2 + 1 bins, or NULL for none
+ * 
+ * @return rfft_status_t
+ *         - RFFT_SUCCESS: Operation successful
+ *         - RFFT_ERROR_NULL_POINTER: NULL context, or no pair buffer
+ *         - RFFT_ERROR_INVALID_SIZE: cross has the wrong number of bins
+ * 
+ * @example
+ *   fft_context_set_pair_buffer(&ctx, pair);
+ *   spectral_cross_init(&cross, sxy, sxx, syy, 1024 / 2 + 1, SPECTRAL_PSD_LINEAR, 4);
+ *   fft_context_set_cross(&ctx, &cross);
+ *   while (!spectral_psd_complete(&cross.x)) {
+ *       next_frame(xy);            // x0 y0 x1 y1 ...
+ *       fft_context_top_bins_interleaved(&ctx, xy, 2, top_bins, 4);
+ *   }
+ *   spectral_cross_coherence(&cross, coherence);
+ */
+rfft_status_t fft_context_set_cross(
+    fft_context_t *ctx,
+    spectral_cross_t *cross
+);
+
+/**
+ * @brief Pick the top bins of the envelope spectrum of a band instead
+ * 
+ * Once set, every frame the context would transform with its RFFT, in
+ * place or on the work buffer, goes through the chain of
+ * fft_envelope_mag_sq() instead, windowed, and the top bins, peaks and
+ * extras of the context are those of the envelope->fft_size / 2 + 1
+ * envelope bins. Bin k keeps its frequency, k * fs / fft_size of the
+ * context. Extras laid out
+ * for the frame spectrum only see its lowest bins, and
+ * fft_context_refine_bins() and fft_context_watch_bins() still read the
+ * frame spectrum. The envelope chain uses neither a caller CFFT nor the
+ * Stockham buffer. fft_context_init() resets the context to no envelope.
+ * 
+ * @param[in,out] ctx       Initialized context
+ * @param[in]     envelope  Chain set up for frames of fft_size, or NULL
+ *                          for the spectrum of the frame
+ * 
+ * @return rfft_status_t
+ *         - RFFT_SUCCESS: Operation successful
+ *         - RFFT_ERROR_NULL_POINTER: NULL context provided
+ *         - RFFT_ERROR_INVALID_SIZE: envelope is for another frame length,
+ *           or has fewer bins than max_top_bins
+ * 
+ * @example
+ *   fft_envelope_init(&env, 4096, 4, FFT_ENVELOPE_BIN(2000, 4096, 16000),
+ *                     FFT_ENVELOPE_BIN(4000, 4096, 16000));
+ *   fft_context_set_envelope(&ctx, &env);
+ *   fft_context_top_bins_inplace(&ctx, frame, top_bins, 5);
+ *   // top_bins[0] * 16000 / 4096 Hz is the strongest envelope line
+ */
+rfft_status_t fft_context_set_envelope(
+    fft_context_t *ctx,
+    fft_envelope_t *envelope
+);
+
+/**
+ * @brief Gather the time-domain statistics of every frame
+ * 
+ * Once set, the pass that copies and windows a frame into its transform
+ * buffer, fft_context_load(), adds every sample to stats as it reads it,
+ * before the window, so the frame is read once for both. A frame
+ * transformed in place without a window has no such pass and gets one
+ * of fft_stats_add() instead. stats holds the sums of the last frame of
+ * fft_context_top_bins(), fft_context_top_bins_inplace() or
+ * fft_context_load() until the next; fft_context_top_bins_interleaved()
+ * leaves it alone. fft_context_init() resets the context to no statistics.
+ * 
+ * @param[in,out] ctx    Initialized context
+ * @param[out]    stats  Sums, or NULL for none
+ * 
+ * @return rfft_status_t
+ *         - RFFT_SUCCESS: Operation successful
+ *         - RFFT_ERROR_NULL_POINTER: NULL context provided
+ * 
+ * @example
+ *   fft_context_set_stats(&ctx, &stats);
+ *   fft_context_top_bins_inplace(&ctx, frame, top_bins, 5);
+ *   fft_stats_read(&stats, &frame_stats);
+ */
+rfft_status_t fft_context_set_stats(
+    fft_context_t *ctx,
+    fft_stats_t *stats
+);
+
+/**
+ * @brief Copy a frame into a transform buffer, applying the window
+ * 
+ * The frame is src[0 .. src_len) followed by wrap[0 .. fft_size - src_len),
+ * so a ring buffer is unwrapped in the same pass. dst may equal src when
+ * src_len is fft_size. With statistics set by fft_context_set_stats(),
+ * they start over with the frame.
+ * 
+ * @param[in]  ctx      Initialized context
+ * @param[out] dst      fft_size samples aligned to RFFT_Q15_ALIGN
+ * @param[in]  src      First part of the frame
+ * @param[in]  src_len  Samples in src, at most fft_size
+ * @param[in]  wrap     Rest of the frame, unused when src_len is fft_size
+ */
+void fft_context_load(
+    const fft_context_t *ctx,
+    q15_t *dst,
+    const q15_t *src,
+    uint32_t src_len,
+    const q15_t *wrap
+);
+
+/**
+ * @brief Widen an 8-bit frame into a transform buffer, applying the window
+ * 
+ * Sample x of src is taken as the Q15 sample x * 256, in the pass that
+ * windows it, so a frame kept in 8 bits needs no Q15 copy of its own. With
+ * statistics set by fft_context_set_stats(), they start over with the frame
+ * and are summed of the widened samples, before the window.
+ * 
+ * @param[in]  ctx  Initialized context
+ * @param[out] dst  fft_size samples aligned to RFFT_Q15_ALIGN
+ * @param[in]  src  fft_size 8-bit samples, not overlapping dst
+ */
+void fft_context_load_q7(
+    const fft_context_t *ctx,
+    q15_t *dst,
+    const int8_t *src
+);
+
+/**
+ * @brief Find the top N frequency bins of a buffer filled by fft_context_load()
+ * 
+ * Runs the RFFT in place, without applying the window again. No
+ * argument checks, as fft_context_execute().
+ * 
+ * @param[in,out] ctx               Initialized context
+ * @param[in,out] buffer            fft_size windowed samples, overwritten
+ * @param[out] output_bin_indices   Array to store sorted bin indices (size >= num_top_bins)
+ * @param[in]  num_top_bins         Number of top bins to find
+ */
+void fft_context_execute_loaded(
+    fft_context_t *ctx,
+    q15_t *buffer,
+    uint16_t *output_bin_indices,
+    uint16_t num_top_bins
+);
+
+/**
+ * @brief Find the top N frequency bins of a copy of the input
+ * 
+ * As find_fft_top_bins(), using the size and buffers of ctx.
+ * 
+ * @param[in,out] ctx               Initialized context with a work buffer
+ * @param[in]  input_signal         Input signal (Q15)
+ * @param[in]  input_length         Length of input signal (must equal the context's fft_size)
+ * @param[out] output_bin_indices   Array to store sorted bin indices (size >= num_top_bins)
+ * @param[in]  num_top_bins         Number of top bins to find, at most max_top_bins
+ * 
+ * @return rfft_status_t, as for find_fft_top_bins()
+ */
+rfft_status_t fft_context_top_bins(
+    fft_context_t *ctx,
+    const q15_t *input_signal,
+    uint16_t input_length,
+    uint16_t *output_bin_indices,
+    uint16_t num_top_bins
+);
+
+/**
+ * @brief Find the top N frequency bins, using the input as work buffer
+ * 
+ * As find_fft_top_bins_inplace(), using the size and buffers of ctx.
+ * 
+ * @param[in,out] ctx               Initialized context
+ * @param[in,out] input_signal      Input signal (Q15), fft_size samples.
+ *                                  Overwritten by the FFT. Must be
+ *                                  aligned to RFFT_Q15_ALIGN.
+ * @param[out] output_bin_indices   Array to store sorted bin indices (size >= num_top_bins)
+ * @param[in]  num_top_bins         Number of top bins to find, at most max_top_bins
+ * 
+ * @return rfft_status_t, as for find_fft_top_bins()
+ */
+rfft_status_t fft_context_top_bins_inplace(
+    fft_context_t *ctx,
+    q15_t *input_signal,
+    uint16_t *output_bin_indices,
+    uint16_t num_top_bins
+);
+
+/**
+ * @brief Find the top N frequency bins of every channel of an interleaved frame
+ * 
+ * For sensors sampled together, e.g. the axes of an accelerometer:
+ * sample i of channel c is input_signal[i * num_channels + c]. The
+ * channels are transformed one after the other with the RFFT instance,
+ * work buffer and window of ctx, each de-interleaved while it is copied
+ * into the work buffer, so a single context serves all of them. With a
+ * buffer set by fft_context_set_pair_buffer(), channels are transformed
+ * two at a time. With an average set by fft_context_set_psd(), every
+ * channel adds to it, and with one set by fft_context_set_cross(), the
+ * cross spectrum of channels 0 and 1.
+ * 
+ * @param[in,out] ctx                Initialized context with a work buffer
+ * @param[in]     input_signal       fft_size * num_channels samples (Q15)
+ * @param[in]     num_channels       Number of interleaved channels (>= 1)
+ * @param[out]    output_bin_indices num_channels * num_top_bins entries, the
+ *                                   sorted bins of channel c from
+ *                                   c * num_top_bins
+ * @param[in]     num_top_bins       Number of top bins to find per channel
+ * 
+ * @return rfft_status_t
+ *         - RFFT_SUCCESS: Operation successful
+ *         - RFFT_ERROR_NULL_POINTER: NULL pointer or no work buffer
+ *         - RFFT_ERROR_INVALID_SIZE: No channels or invalid num_top_bins
+ * 
+ * @example
+ *   static q15_t xyz[3 * 4096];     // x0 y0 z0 x1 y1 z1 ...
+ *   uint16_t top_bins[3 * 20];
+ *   
+ *   fft_context_top_bins_interleaved(&ctx, xyz, 3, top_bins, 20);
+ *   // top_bins[20] is the strongest bin of the y axis
+ */
+rfft_status_t fft_context_top_bins_interleaved(
+    fft_context_t *ctx,
+    const q15_t *input_signal,
+    uint16_t num_channels,
+    uint16_t *output_bin_indices,
+    uint16_t num_top_bins
+);
+
+/**
+ * @brief Interpolate the peak position of bins found by a top N search
+ * 
+ * Jacobsen's estimator on the complex bins k - 1, k and k + 1, formed
+ * again from the CFFT result the search left in its buffer with
+ * arm_rfft_q15_mag_sq_bin(). The gain is matched to the window of ctx,
+ * which keeps the bias of a clean tone below 0.001 bins. Only the num_bins
+ * bins are evaluated, the rest of the spectrum is never formed again.
+ * 
+ * @param[in]  ctx          Context of the search
+ * @param[in]  buffer       Buffer the search transformed, unchanged since:
+ *                          the work buffer for fft_context_top_bins(), the
+ *                          input for the in-place variants. The Stockham
+ *                          or mixed radix buffer of ctx, if set, must be
+ *                          unchanged as well.
+ * @param[in]  bin_indices  Bins found by the search
+ * @param[out] peaks        Peak position of each bin in 1/2^FFT_BIN_FRAC_BITS
+ *                          bins, within half a bin of it
+ * @param[in]  num_bins     Number of bins
+ */
+void fft_context_refine_bins(
+    const fft_context_t *ctx,
+    const q15_t *buffer,
+    const uint16_t *bin_indices,
+    uint32_t *peaks,
+    uint16_t num_bins
+);
+
+/**
+ * @brief Magnitude² of a fixed set of bins, by whichever path is cheaper
+ * 
+ * Loads the frame into the work buffer with the window of ctx, then
+ * either correlates the bins of dft one by one or runs the full
+ * arm_rfft_q15_mag_sq() and keeps only those bins, as
+ * spectral_dft_preferred() decides for their number. Both report the same
+ * magnitude², so callers watching a few known tones need not care which
+ * one ran. The average of fft_context_set_psd() is not fed.
+ * 
+ * @param[in,out] ctx            Initialized context with a work buffer
+ * @param[in]     input_signal   Input signal (Q15), fft_size samples
+ * @param[in]     dft            Bins to watch, set up for the fft_size of ctx
+ * @param[out]    output_mag_sq  Magnitude² of each bin of dft, in its order
+ * 
+ * @return rfft_status_t
+ *         - RFFT_SUCCESS: Operation successful
+ *         - RFFT_ERROR_NULL_POINTER: NULL pointer or no work buffer
+ *         - RFFT_ERROR_INVALID_SIZE: dft is for another fft_size
+ * 
+ * @example
+ *   static const uint16_t tones[] = { 256, 512, 1024 };
+ *   static spectral_dft_t dft;
+ *   uint32_t levels[3];
+ *   
+ *   spectral_dft_init(&dft, 4096, tones, 3);
+ *   fft_context_watch_bins(&ctx, signal, &dft, levels);
+ */
+rfft_status_t fft_context_watch_bins(
+    fft_context_t *ctx,
+    const q15_t *input_signal,
+    const spectral_dft_t *dft,
+    uint32_t *output_mag_sq
+);
+
+/**
+ * @brief Get the context behind find_fft_top_bins()
+ * 
+ * The context uses the internal static buffers, with room for
+ * FFT_TOP_BINS_MAX bins. It is shared with find_fft_top_bins() and
+ * find_fft_top_bins_inplace(), so it is not thread-safe either.
+ * 
+ * @param[in] fft_size  FFT size (RFFT_Q15_MIN_FFT_LEN to RFFT_Q15_MAX_FFT_LEN)
+ * 
+ * @return The initialized context, or NULL for an invalid fft_size
+ */
+fft_context_t *fft_context_get_default(uint16_t fft_size);
+
+/**
+ * @brief Fast path of fft_context_top_bins(), without argument checks
+ * 
+ * For hot loops that validated their arguments once: ctx must be
+ * initialized with a work buffer, input_signal must hold the context's
+ * fft_size samples and num_top_bins must lie in 1..max_top_bins.
+ * 
+ * @param[in,out] ctx               Initialized context with a work buffer
+ * @param[in]  input_signal         Input signal (Q15), fft_size samples
+ * @param[out] output_bin_indices   Array to store sorted bin indices (size >= num_top_bins)
+ * @param[in]  num_top_bins         Number of top bins to find
+ */
+void fft_context_execute(
+    fft_context_t *ctx,
+    const q15_t *input_signal,
+    uint16_t *output_bin_indices,
+    uint16_t num_top_bins
+);
+
+/**
+ * @brief Fast path of fft_context_top_bins_inplace(), without argument checks
+ * 
+ * Same requirements as fft_context_execute(); input_signal is overwritten
+ * and must be aligned to RFFT_Q15_ALIGN.
+ * 
+ * @param[in,out] ctx               Initialized context
+ * @param[in,out] input_signal      Input signal (Q15), fft_size samples
+ * @param[out] output_bin_indices   Array to store sorted bin indices (size >= num_top_bins)
+ * @param[in]  num_top_bins         Number of top bins to find
+ */
+void fft_context_execute_inplace(
+    fft_context_t *ctx,
+    q15_t *input_signal,
+    uint16_t *output_bin_indices,
+    uint16_t num_top_bins
+);
+
+#if defined(FFT_UTILS_Q31)
+/**
+ * @brief Find the top N frequency bins of a Q31 frame, running the FFT in place
+ * 
+ * find_fft_top_bins_inplace() on the Q31 RFFT, for channels whose dynamic
+ * range the 16-bit path cannot hold: a 4096-point Q15 RFFT keeps 4 of the
+ * 16 input bits, the Q31 one 19 of 32. No window is applied.
+ * 
+ * The bins are ranked by the integer square root of their 64-bit
+ * magnitude², which spectral_topk keeps in its 32-bit magnitude field;
+ * the square root is only taken for bins that beat the weakest kept one.
+ * 
+ * @param[in,out] input_signal    Input signal (Q31), fft_size samples.
+ *                                Overwritten by the FFT.
+ * @param[in]  fft_size           FFT size (RFFT_Q31_MIN_FFT_LEN to RFFT_Q31_MAX_FFT_LEN)
+ * @param[out] output_bin_indices Array to store sorted bin indices (size >= num_top_bins)
+ * @param[in]  num_top_bins       Number of top bins to find, at most FFT_TOP_BINS_MAX
+ * 
+ * @return rfft_status_t, as for find_fft_top_bins()
+ * 
+ * @note Shares the top N storage of find_fft_top_bins(), so it is not
+ *       thread-safe either.
+ */
+rfft_status_t find_fft_top_bins_q31_inplace(
+    q31_t *input_signal,
+    uint16_t fft_size,
+    uint16_t *output_bin_indices,
+    uint16_t num_top_bins
+);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
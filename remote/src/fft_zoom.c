@@ -0,0 +1,234 @@
+/* ----------------------------------------------------------------------
+ * Project:      FFT Utility Functions
+ * Title:        fft_zoom.c
+ * Description:  Zoom FFT: narrowband spectra of a sample stream
+ *
+ * Target Processor: nRF54L15 FLPR (RISC-V)
+ * -------------------------------------------------------------------- */
+
+#include "fft_zoom.h"
+#include <string.h>
+
+/* cos and sin of phase m in steps of the twiddle table, m below its length */
+static inline void zoom_twiddle(uint32_t m, q31_t *c, q31_t *s)
+{
+    if (m <= RFFT_TWIDDLE_TABLE_LEN / 2U) {
+        *c = RFFT_TWIDDLE_COS(RFFT_TWIDDLE_TABLE, m);
+        *s = RFFT_TWIDDLE_SIN(RFFT_TWIDDLE_TABLE, m);
+    } else {
+        *c = RFFT_TWIDDLE_COS(RFFT_TWIDDLE_TABLE, RFFT_TWIDDLE_TABLE_LEN - m);
+        *s = -RFFT_TWIDDLE_SIN(RFFT_TWIDDLE_TABLE, RFFT_TWIDDLE_TABLE_LEN - m);
+    }
+}
+
+static q15_t zoom_sat(q31_t v)
+{
+    return (q15_t) ((v > 32767) ? 32767 : ((v < -32768) ? -32768 : v));
+}
+
+/* Decimations the twiddle table has the sinc phases of */
+static bool zoom_decimation_valid(uint16_t decimation)
+{
+    return decimation != 0 && (decimation & (decimation - 1U)) == 0 &&
+           decimation <= RFFT_TWIDDLE_TABLE_LEN / 4U;
+}
+
+/**
+ * @brief Windowed-sinc low-pass for a decimation
+ */
+rfft_status_t fft_zoom_design_lowpass(
+    q15_t *taps,
+    uint16_t num_taps,
+    uint16_t decimation
+)
+{
+    const uint32_t mask = RFFT_TWIDDLE_TABLE_LEN - 1U;
+    int64_t sum = 0;
+
+    if (taps == NULL) {
+        return RFFT_ERROR_NULL_POINTER;
+    }
+
+    if (num_taps == 0 || !zoom_decimation_valid(decimation)) {
+        return RFFT_ERROR_INVALID_SIZE;
+    }
+
+    /* May come before any RFFT instance, which fills the table otherwise */
+    rfft_q15_twiddles_init();
+
+    /*
+     * Tap j sits t = j - (num_taps - 1) / 2 samples from the center,
+     * counted in half samples as t2 = 2 t so even lengths work too.
+     * sinc(t / D) = sin(pi t2 / 2D) / (pi t2 / 2D), the sine read at
+     * t2 * table / 4D, with pi as 355 / 113. Q31 in taps until scaled.
+     */
+    for (uint32_t j = 0; j < num_taps; j++) {
+        int32_t t2 = 2 * (int32_t) j - (int32_t) (num_taps - 1U);
+        uint32_t a = (uint32_t) ((t2 < 0) ? -t2 : t2);
+        uint32_t m = ((j + 1U) * RFFT_TWIDDLE_TABLE_LEN + (num_taps + 1U) / 2U) / (num_taps + 1U);
+        q31_t sinc;
+        q31_t c;
+        q31_t s;
+
+        if (a == 0) {
+            sinc = 32768;
+        } else {
+            zoom_twiddle((a * (RFFT_TWIDDLE_TABLE_LEN / (4U * decimation))) & mask, &c, &s);
+            sinc = (q31_t) (((int64_t) s * 2 * decimation * 113) / (355 * (int64_t) a));
+        }
+
+        /* Hann over num_taps + 2 points, its zero ends outside the filter */
+        zoom_twiddle(m & mask, &c, &s);
+        taps[j] = zoom_sat((sinc * ((32768 - c) >> 1)) >> 15);
+        sum += taps[j];
+    }
+
+    /* DC gain of 1 */
+    for (uint32_t j = 0; j < num_taps; j++) {
+        taps[j] = zoom_sat((q31_t) (((int64_t) taps[j] * 32768 + sum / 2) / sum));
+    }
+
+    return RFFT_SUCCESS;
+}
+
+/**
+ * @brief Prepare a zoom FFT
+ */
+rfft_status_t fft_zoom_init(
+    fft_zoom_t *zoom,
+    uint16_t fft_size,
+    uint16_t decimation,
+    uint32_t step,
+    const q15_t *taps,
+    uint16_t num_taps,
+    q15_t *history,
+    q15_t *buffer
+)
+{
+    const arm_rfft_instance_q15 *rfft;
+
+    if (zoom == NULL || taps == NULL || history == NULL || buffer == NULL) {
+        return RFFT_ERROR_NULL_POINTER;
+    }
+
+    /* The CFFTs of the build are those inside its RFFTs */
+    rfft = rfft_q15_get_instance(2U * (uint32_t) fft_size);
+    if (rfft == NULL || !zoom_decimation_valid(decimation) ||
+        step >= RFFT_TWIDDLE_TABLE_LEN || num_taps == 0) {
+        return RFFT_ERROR_INVALID_SIZE;
+    }
+
+    zoom->cfft = rfft->pCfft;
+    zoom->taps = taps;
+    zoom->history = history;
+    zoom->buffer = buffer;
+    zoom->step = step;
+    zoom->fft_size = fft_size;
+    zoom->decimation = decimation;
+    zoom->num_taps = num_taps;
+    fft_zoom_reset(zoom);
+
+    return RFFT_SUCCESS;
+}
+
+/**
+ * @brief Forget the history and the partial frame, e.g. after a gap in the stream
+ */
+void fft_zoom_reset(fft_zoom_t *zoom)
+{
+    memset(zoom->history, 0, 4U * zoom->num_taps * sizeof(q15_t));
+    zoom->phase = 0;
+    zoom->hist_pos = 0;
+    zoom->until_output = zoom->decimation;
+    zoom->collected = 0;
+}
+
+/* One decimated sample from the num_taps newest mixed samples */
+static void zoom_output(fft_zoom_t *zoom)
+{
+    /* The window starts at hist_pos, doubled so it never wraps */
+    const q15_t *z = &zoom->history[2U * (zoom->hist_pos + zoom->num_taps - 1U)];
+    q31_t re = 0;
+    q31_t im = 0;
+
+    /* Absolute taps below 2.0 keep both sums below 2^31 */
+    for (uint32_t j = 0; j < zoom->num_taps; j++) {
+        re += (q31_t) zoom->taps[j] * z[0];
+        im += (q31_t) zoom->taps[j] * z[1];
+        z -= 2;
+    }
+
+    zoom->buffer[2U * zoom->collected] = zoom_sat((re + (1 << 14)) >> 15);
+    zoom->buffer[2U * zoom->collected + 1U] = zoom_sat((im + (1 << 14)) >> 15);
+    zoom->collected++;
+}
+
+/**
+ * @brief Mix, filter and decimate new samples into the frame
+ */
+uint32_t fft_zoom_push(fft_zoom_t *zoom, const q15_t *samples, uint32_t count)
+{
+    const uint32_t mask = RFFT_TWIDDLE_TABLE_LEN - 1U;
+    uint32_t n = 0;
+
+    while (n < count && !fft_zoom_frame_ready(zoom)) {
+        q31_t x = samples[n++];
+        q31_t c;
+        q31_t s;
+        q15_t re;
+        q15_t im;
+
+        /* x e^-jwn */
+        zoom_twiddle(zoom->phase, &c, &s);
+        zoom->phase = (zoom->phase + zoom->step) & mask;
+        re = (q15_t) ((x * c) >> 15);
+        im = zoom_sat(-((x * s) >> 15));
+
+        zoom->history[2U * zoom->hist_pos] = re;
+        zoom->history[2U * zoom->hist_pos + 1U] = im;
+        zoom->history[2U * (zoom->hist_pos + zoom->num_taps)] = re;
+        zoom->history[2U * (zoom->hist_pos + zoom->num_taps) + 1U] = im;
+
+        if (++zoom->hist_pos == zoom->num_taps) {
+            zoom->hist_pos = 0;
+        }
+
+        if (--zoom->until_output == 0) {
+            zoom->until_output = zoom->decimation;
+            zoom_output(zoom);
+        }
+    }
+
+    return n;
+}
+
+/**
+ * @brief Transform the due frame and report its bins
+ */
+rfft_status_t fft_zoom_mag_sq(fft_zoom_t *zoom, rfft_q15_bin_fn fn, void *user)
+{
+    uint32_t mask;
+
+    if (zoom == NULL || fn == NULL) {
+        return RFFT_ERROR_NULL_POINTER;
+    }
+
+    if (!fft_zoom_frame_ready(zoom)) {
+        return RFFT_ERROR_INVALID_SIZE;
+    }
+
+    mask = zoom->fft_size - 1U;
+    arm_cfft_q15(zoom->cfft, zoom->buffer, 0, 1);
+
+    /* Negative frequencies, the upper half of the CFFT output, first */
+    for (uint32_t i = 0; i < zoom->fft_size; i++) {
+        const q15_t *bin = &zoom->buffer[2U * ((i + zoom->fft_size / 2U) & mask)];
+
+        fn(i, (uint32_t) ((q31_t) bin[0] * bin[0]) + (uint32_t) ((q31_t) bin[1] * bin[1]),
+           user);
+    }
+
+    zoom->collected = 0;
+
+    return RFFT_SUCCESS;
+}
@@ -0,0 +1,184 @@
+/* ----------------------------------------------------------------------
+ * Project:      FFT Utility Functions
+ * Title:        fft_zoom.h
+ * Description:  Zoom FFT: narrowband spectra of a sample stream
+ *
+ * Target Processor: nRF54L15 FLPR (RISC-V)
+ * -------------------------------------------------------------------- */
+
+#ifndef FFT_ZOOM_H
+#define FFT_ZOOM_H
+
+#include <stdbool.h>
+#include "rfft_q15_simplified.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Narrowband spectrum around a center frequency
+ *
+ * Each sample is mixed down by the center frequency, with cos and sin
+ * from the shared twiddle table, into a ring of complex samples. A
+ * low-pass FIR is evaluated on that ring only every decimation-th sample,
+ * which costs num_taps / decimation taps per input sample like a
+ * polyphase decimator. Once fft_size decimated samples are collected,
+ * an fft_size-point arm_cfft_q15() turns them into fft_size bins of
+ * fs / (decimation * fft_size) across a band of fs / decimation.
+ *
+ * At 16 kHz, decimation 16 and 2048 points give 0.49 Hz bins over
+ * 1000 Hz, from 8 KiB of frame buffer where a real FFT of the same
+ * resolution would need 32768 points.
+ *
+ * Frames do not overlap; the next one is collected after the spectrum of
+ * the last one was read.
+ */
+typedef struct {
+    const arm_cfft_instance_q15 *cfft; /**< fft_size-point CFFT */
+    const q15_t *taps;      /**< num_taps low-pass coefficients (Q15), owned by the caller */
+    q15_t *history;         /**< 4 * num_taps: the mixed samples twice, real and imaginary */
+    q15_t *buffer;          /**< 2 * fft_size: decimated samples, then the spectrum */
+    uint32_t step;          /**< Mixer phase step per sample, in twiddle table steps */
+    uint32_t phase;         /**< Mixer phase of the next sample */
+    uint16_t fft_size;      /**< Points of the CFFT */
+    uint16_t decimation;    /**< Input samples per decimated sample */
+    uint16_t num_taps;      /**< Length of the low-pass */
+    uint16_t hist_pos;      /**< History index of the oldest mixed sample */
+    uint16_t until_output;  /**< Input samples still missing for the next decimated one */
+    uint16_t collected;     /**< Decimated samples in buffer */
+} fft_zoom_t;
+
+/** Mixer step of a center frequency, from Hz and the sample rate in Hz */
+#define FFT_ZOOM_STEP(center_hz, sample_rate_hz) \
+    ((uint32_t) (((uint64_t) (center_hz) * RFFT_TWIDDLE_TABLE_LEN + (sample_rate_hz) / 2U) / \
+                 (sample_rate_hz)))
+
+/**
+ * @brief Windowed-sinc low-pass for a decimation
+ *
+ * Hann-windowed sinc with its cutoff at half the decimated rate and a DC
+ * gain of 1, from the shared twiddle table. Runs once at setup; it is the
+ * only place of the zoom FFT that divides. 8 * decimation + 1 taps leave
+ * about the outer 1/8 of the band in the transition.
+ *
+ * @param[out] taps        num_taps coefficients (Q15)
+ * @param[in]  num_taps    Length of the low-pass (>= 1)
+ * @param[in]  decimation  Power of two, 1 to RFFT_TWIDDLE_TABLE_LEN / 4
+ *
+ * @return rfft_status_t
+ *         - RFFT_SUCCESS: Operation successful
+ *         - RFFT_ERROR_NULL_POINTER: NULL pointer provided
+ *         - RFFT_ERROR_INVALID_SIZE: Invalid num_taps or decimation
+ */
+rfft_status_t fft_zoom_design_lowpass(
+    q15_t *taps,
+    uint16_t num_taps,
+    uint16_t decimation
+);
+
+/**
+ * @brief Prepare a zoom FFT
+ *
+ * @param[out] zoom        Zoom state
+ * @param[in]  fft_size    Points of the CFFT, half an RFFT size of the build
+ * @param[in]  decimation  Power of two, 1 to RFFT_TWIDDLE_TABLE_LEN / 4
+ * @param[in]  step        Center frequency as mixer step, FFT_ZOOM_STEP()
+ * @param[in]  taps        num_taps low-pass coefficients whose absolute
+ *                         values add up to less than 2.0, owned by the caller
+ * @param[in]  num_taps    Length of the low-pass (>= 1)
+ * @param[in]  history     4 * num_taps samples, owned by the caller
+ * @param[in]  buffer      2 * fft_size samples aligned to RFFT_Q15_ALIGN,
+ *                         owned by the caller
+ *
+ * @return rfft_status_t
+ *         - RFFT_SUCCESS: Operation successful
+ *         - RFFT_ERROR_NULL_POINTER: NULL pointer provided
+ *         - RFFT_ERROR_INVALID_SIZE: Invalid fft_size, decimation, step or num_taps
+ *
+ * @example
+ *   static q15_t taps[8 * 16 + 1];
+ *   static q15_t history[4 * 129];
+ *   static q15_t buffer[2 * 2048] RFFT_Q15_ALIGN;
+ *   static fft_zoom_t zoom;
+ *
+ *   fft_zoom_design_lowpass(taps, 129, 16);
+ *   fft_zoom_init(&zoom, 2048, 16, FFT_ZOOM_STEP(3000, 16000),
+ *                 taps, 129, history, buffer);
+ *
+ *   while (read_block(block, &count)) {
+ *       for (uint32_t pos = 0; pos < count; ) {
+ *           pos += fft_zoom_push(&zoom, &block[pos], count - pos);
+ *           if (fft_zoom_frame_ready(&zoom)) {
+ *               fft_zoom_mag_sq(&zoom, on_bin, NULL);
+ *           }
+ *       }
+ *   }
+ */
+rfft_status_t fft_zoom_init(
+    fft_zoom_t *zoom,
+    uint16_t fft_size,
+    uint16_t decimation,
+    uint32_t step,
+    const q15_t *taps,
+    uint16_t num_taps,
+    q15_t *history,
+    q15_t *buffer
+);
+
+/**
+ * @brief Forget the history and the partial frame, e.g. after a gap in the stream
+ *
+ * @param[in,out] zoom  Initialized zoom state
+ */
+void fft_zoom_reset(fft_zoom_t *zoom);
+
+/**
+ * @brief Mix, filter and decimate new samples into the frame
+ *
+ * Stops at the sample that completes a frame, so no frame is overwritten
+ * before its spectrum was read. Call again with the rest of the samples
+ * after fft_zoom_mag_sq().
+ *
+ * @param[in,out] zoom     Initialized zoom state
+ * @param[in]     samples  New samples (Q15)
+ * @param[in]     count    Number of new samples
+ *
+ * @return Number of samples consumed, less than count when a frame is due
+ */
+uint32_t fft_zoom_push(fft_zoom_t *zoom, const q15_t *samples, uint32_t count);
+
+/**
+ * @brief Check whether a frame is due
+ */
+static inline bool fft_zoom_frame_ready(const fft_zoom_t *zoom)
+{
+    return zoom->collected == zoom->fft_size;
+}
+
+/**
+ * @brief Transform the due frame and report its bins
+ *
+ * Runs the CFFT in place on the frame buffer and starts the next frame.
+ * Bin i, from 0 to fft_size - 1, lies at
+ * center + (i - fft_size / 2) * fs / (decimation * fft_size), so bins
+ * come in ascending frequency and can feed spectral_topk directly. The
+ * magnitude² is of the CFFT output, scaled by 1/fft_size like
+ * arm_rfft_q15_mag_sq().
+ *
+ * @param[in,out] zoom  Zoom state with a frame due
+ * @param[in]     fn    Called once per bin, bins 0 to fft_size - 1
+ * @param[in]     user  Passed through to fn
+ *
+ * @return rfft_status_t
+ *         - RFFT_SUCCESS: Operation successful
+ *         - RFFT_ERROR_NULL_POINTER: NULL pointer provided
+ *         - RFFT_ERROR_INVALID_SIZE: No frame due
+ */
+rfft_status_t fft_zoom_mag_sq(fft_zoom_t *zoom, rfft_q15_bin_fn fn, void *user);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* FFT_ZOOM_H */
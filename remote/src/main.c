@@ -12,9 +12,73 @@
 
 #include <zephyr/ipc/ipc_service.h>
 
-/* FFT utilities - uncomment when needed */
-/* #include "rfft_q15_simplified.h" */
-/* #include "fft_utils.h" */
+#if defined(CONFIG_APP_IPC_BATCH)
+#include "ipc_batch.h"
+#endif
+
+#if defined(CONFIG_APP_IPC_CREDIT)
+#include "ipc_credit.h"
+#endif
+
+#if defined(CONFIG_APP_IPC_TRACE)
+#include "ipc_trace.h"
+#endif
+
+#if defined(CONFIG_APP_IPC_SWEEP)
+#include "ipc_sweep.h"
+#endif
+
+#if defined(CONFIG_APP_IPC_BENCH)
+#include "ipc_bench.h"
+#endif
+
+#include "rfft_q15_simplified.h"
+#include "fft_utils.h"
+#include "cycle_counter.h"
+
+#if defined(CONFIG_APP_FFT_BENCH)
+#include "fft_bench.h"
+#endif
+#if defined(CONFIG_APP_FFT_SELFTEST)
+#include "fft_selftest.h"
+#endif
+#if defined(CONFIG_APP_FFT_RECORD)
+#include "fft_record.h"
+#endif
+
+#if defined(CONFIG_APP_FFT_STREAM)
+#include "fft_stream.h"
+#include "fft_stream_msg.h"
+#if defined(CONFIG_APP_FFT_SHM_RING) || defined(CONFIG_APP_FFT_COOP)
+#include "fft_frame_pool.h"
+#endif
+#if defined(CONFIG_APP_FFT_PSD_COMPACT) || defined(CONFIG_APP_FFT_SPECTROGRAM)
+#include "psd_pack.h"
+#endif
+#if defined(CONFIG_APP_FFT_ORDER)
+#include "fft_order.h"
+#endif
+#if defined(CONFIG_APP_FFT_STORE)
+#include <zephyr/sys/crc.h>
+#include "fft_store.h"
+#endif
+#if defined(CONFIG_APP_FFT_PIPELINE)
+#include "fft_pipeline.h"
+#endif
+#if defined(CONFIG_APP_FFT_SHED)
+#include "fft_shed.h"
+#endif
+#elif defined(CONFIG_APP_FFT_BOOT_PERF)
+#if RFFT_Q15_HAS_LEN(4096)
+#include "test_signal_data.h"
+#endif
+#if defined(CONFIG_APP_FFT_ASYNC)
+#include "fft_async.h"
+#endif
+#if RFFT_Q15_HAS_LEN(8192)
+#include "test_signal_8192_data.h"
+#endif
+#endif
 
 #ifdef CONFIG_TEST_EXTRA_STACK_SIZE
 #define STACKSIZE	(1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
@@ -32,21 +96,399 @@ struct payload {
 	uint8_t data[CONFIG_APP_IPC_SERVICE_MESSAGE_LEN - sizeof(unsigned long) * 2];
 };
 
-static struct payload payload_buffer;
+#if defined(CONFIG_APP_IPC_TRACE)
+/* The summary for the other core rides in the filler of the test payload. */
+BUILD_ASSERT(CONFIG_APP_IPC_SERVICE_MESSAGE_LEN >=
+	     offsetof(struct payload, data) + sizeof(struct ipc_trace_summary),
+	     "APP_IPC_SERVICE_MESSAGE_LEN too short for the IPC trace summary");
+#endif
+
+/* Sent by the throughput test, a frame buffer like the FFT input. */
+static struct payload payload_buffer RFFT_Q15_FRAME;
 static struct payload *p_payload = &payload_buffer;
 
-static K_SEM_DEFINE(bound_sem, 0, 1);
+/* ep0, and the control plane endpoint with APP_FFT_CTRL_PLANE. */
+#define NUM_ENDPOINTS (1 + IS_ENABLED(CONFIG_APP_FFT_CTRL_PLANE))
+
+static K_SEM_DEFINE(bound_sem, 0, NUM_ENDPOINTS);
 
 static void ep_bound(void *priv)
 {
 	k_sem_give(&bound_sem);
 }
 
+#if defined(CONFIG_APP_FFT_CTRL_PLANE)
+/*
+ * Endpoint of the control plane, on the ipc1 instance with buffers of its
+ * own: commands, their answers, flow control and events never queue behind
+ * the sample blocks and results of ep0, the data plane.
+ */
+static struct ipc_ept ctrl_ep;
+
+static inline struct ipc_ept *ctrl_plane(struct ipc_ept *ep)
+{
+	ARG_UNUSED(ep);
+
+	return &ctrl_ep;
+}
+#else
+static inline struct ipc_ept *ctrl_plane(struct ipc_ept *ep)
+{
+	return ep;
+}
+#endif
+
+#if defined(CONFIG_APP_FFT_STREAM)
+#if defined(CONFIG_APP_FFT_PERF)
+/*
+ * Counters of FFT_CTRL_GET_PERF. Only the analysis thread times the stages
+ * and reads them out, between two frames; retries may count on any thread.
+ */
+static struct {
+	uint32_t frames;
+	uint64_t cycles[FFT_PERF_NUM_STAGES];
+	uint32_t max_cycles[FFT_PERF_NUM_STAGES];
+	atomic_t ipc_retries;
+} perf;
+
+/* Account a stage of the frame that started at cycle start. */
+static inline void perf_stage(uint32_t stage, uint32_t start)
+{
+	uint32_t cycles = read_cycle() - start;
+
+	perf.cycles[stage] += cycles;
+	perf.max_cycles[stage] = MAX(perf.max_cycles[stage], cycles);
+}
+
+static inline void perf_retry(void)
+{
+	(void)atomic_inc(&perf.ipc_retries);
+}
+#else
+static inline void perf_retry(void)
+{
+}
+#endif
+
+/* The backend is out of buffers: count the retry and let the receiver drain them. */
+static inline void send_backoff(void)
+{
+	perf_retry();
+	k_yield();
+}
+
+/* ipc_service_send(), retried until the backend has a buffer for the message. */
+static int send_wait(struct ipc_ept *ep, const void *msg, size_t len)
+{
+	int ret;
+
+	while ((ret = ipc_service_send(ep, msg, len)) == -ENOMEM) {
+		send_backoff();
+	}
+
+	return ret;
+}
+
+#if defined(CONFIG_APP_FFT_PSD)
+/* Set by a request from the application core, cleared when the average is sent. */
+static atomic_t psd_requested;
+#endif
+
+#if defined(CONFIG_APP_FFT_SPECTROGRAM)
+/* Frames per spectrogram row the application core subscribed to, 0 for none. */
+static atomic_t gram_decimation;
+#endif
+
+#if defined(CONFIG_APP_FFT_LATENCY)
+/* Sync request waiting for its reply, stamped when it arrived. */
+static struct fft_sync_msg sync_reply;
+static atomic_t sync_requested;
+#endif
+
+#if defined(CONFIG_APP_FFT_ORDER)
+/* Tachometer pulses from the receive callback the resampler has no room for yet. */
+#define ORDER_PULSES_QUEUED 32
+K_MSGQ_DEFINE(order_pulses, sizeof(uint32_t), ORDER_PULSES_QUEUED, 4);
+#endif
+
+#if defined(CONFIG_APP_FFT_RECONFIG)
+/* Configuration request being applied, set until its reply is sent. */
+static struct fft_config_msg config_request;
+static atomic_t config_busy;
+#if defined(CONFIG_APP_FFT_PIPELINE)
+/* Chain request being applied instead, behind config_busy as well. */
+static struct fft_pipeline_msg pipeline_request;
+static bool pipeline_pending;
+#endif
+#endif
+
+#if defined(CONFIG_APP_FFT_COOP)
+/* Answer of the application core to the half of a split CFFT it was sent. */
+static K_SEM_DEFINE(coop_sem, 0, 1);
+static atomic_t coop_seq;
+/* COOP_NONE until the first answer of coop_seq, which it keeps. */
+static atomic_t coop_done;
+
+enum {
+	COOP_NONE,
+	COOP_DONE,
+	COOP_LEFT,
+};
+#endif
+
+#if defined(CONFIG_APP_FFT_CTRL)
+/* Commands left to the analysis thread, answered in the order they arrived. */
+K_MSGQ_DEFINE(ctrl_queue, sizeof(struct fft_ctrl_msg), FFT_CTRL_MAX_PENDING, 4);
+/* Set from FFT_CTRL_STOP to FFT_CTRL_START, the sample blocks are dropped. */
+static atomic_t stream_stopped;
+#if defined(CONFIG_APP_FFT_RECONFIG)
+/* FFT_CTRL_CONFIGURE behind config_request, type 0 for an FFT_STREAM_MSG_CONFIG. */
+static struct fft_ctrl_msg config_ctrl;
+#endif
+
+/*
+ * Take a command in, in the context the sample blocks arrive in. Start and
+ * stop take effect here, between two blocks, and a configuration suspends
+ * the stream as its own message would; the analysis thread answers.
+ */
+static void ctrl_recv(const void *data)
+{
+	struct fft_ctrl_msg cmd;
+
+	memcpy(&cmd, data, sizeof(cmd));
+	cmd.status = 0;
+
+	if (cmd.version != FFT_CTRL_VERSION) {
+		cmd.status = -ENOTSUP;
+	} else if (cmd.cmd == FFT_CTRL_START) {
+		atomic_clear(&stream_stopped);
+	} else if (cmd.cmd == FFT_CTRL_STOP) {
+		atomic_set(&stream_stopped, 1);
+	} else if (cmd.cmd == FFT_CTRL_CONFIGURE) {
+#if defined(CONFIG_APP_FFT_RECONFIG)
+		if ((cmd.arg[0] > UINT16_MAX) || (cmd.arg[1] > UINT8_MAX)) {
+			cmd.status = -EINVAL;
+		} else if (atomic_cas(&config_busy, 0, 1)) {
+			config_ctrl = cmd;
+			config_request.hdr.type = FFT_STREAM_MSG_CONFIG;
+			config_request.hdr.count = cmd.arg[0];
+			config_request.hdr.seq = cmd.id;
+			config_request.window = cmd.arg[1];
+			/* Answered by stream_reconfig() once the length is in effect. */
+			fft_stream_suspend();
+			return;
+		} else {
+			cmd.status = -EBUSY;
+		}
+#else
+		cmd.status = -ENOTSUP;
+#endif
+	}
+
+	if (k_msgq_put(&ctrl_queue, &cmd, K_NO_WAIT) != 0) {
+		/* More than FFT_CTRL_MAX_PENDING in flight, left unanswered. */
+		return;
+	}
+
+	fft_stream_wake();
+}
+#endif /* CONFIG_APP_FFT_CTRL */
+
+static void ep_recv(const void *data, size_t len, void *priv)
+{
+	const struct fft_stream_hdr *hdr = data;
+
+#if defined(CONFIG_APP_FFT_PSD)
+	if ((len >= sizeof(*hdr)) && (hdr->type == FFT_STREAM_MSG_PSD_REQUEST)) {
+		atomic_set(&psd_requested, 1);
+		return;
+	}
+#endif
+
+#if defined(CONFIG_APP_FFT_SPECTROGRAM)
+	if ((len == sizeof(*hdr)) && (hdr->type == FFT_STREAM_MSG_SPECTROGRAM)) {
+		/* Takes effect from the next frame on. */
+		atomic_set(&gram_decimation, hdr->count);
+		return;
+	}
+#endif
+
+#if defined(CONFIG_APP_FFT_ORDER)
+	if ((len >= sizeof(*hdr)) && (hdr->type == FFT_STREAM_MSG_TACHO)) {
+		const struct fft_tacho_msg *tacho = data;
+
+		/* A pulse that finds the queue full loses its two revolutions only. */
+		for (uint32_t i = 0; (i < hdr->count) && (len >= FFT_TACHO_MSG_SIZE(i + 1)); i++) {
+			(void)k_msgq_put(&order_pulses, &tacho->pos[i], K_NO_WAIT);
+		}
+		return;
+	}
+#endif
+
+#if defined(CONFIG_APP_FFT_LATENCY)
+	if ((len == sizeof(sync_reply)) && (hdr->type == FFT_STREAM_MSG_SYNC)) {
+		uint32_t now = read_cycle_us();
+
+		/* A request still unanswered is superseded. */
+		memcpy(&sync_reply, data, sizeof(sync_reply));
+		sync_reply.remote_rx = now;
+		atomic_set(&sync_requested, 1);
+		return;
+	}
+#endif
+
+#if defined(CONFIG_APP_FFT_RECONFIG)
+	if ((len == sizeof(config_request)) && (hdr->type == FFT_STREAM_MSG_CONFIG)) {
+		/* One at a time, the application core waits for the reply. */
+		if (atomic_cas(&config_busy, 0, 1)) {
+			memcpy(&config_request, data, sizeof(config_request));
+#if defined(CONFIG_APP_FFT_CTRL)
+			config_ctrl.type = 0;
+#endif
+			/* Here, between two sample blocks, and after the request. */
+			fft_stream_suspend();
+		}
+		return;
+	}
+#endif
+
+#if defined(CONFIG_APP_FFT_PIPELINE)
+	if ((len == sizeof(pipeline_request)) && (hdr->type == FFT_STREAM_MSG_PIPELINE)) {
+		/* One request of either kind at a time. */
+		if (atomic_cas(&config_busy, 0, 1)) {
+			memcpy(&pipeline_request, data, sizeof(pipeline_request));
+			pipeline_pending = true;
+			fft_stream_suspend();
+		}
+		return;
+	}
+#endif
+
+#if defined(CONFIG_APP_FFT_COOP)
+	if ((len == sizeof(struct fft_coop_msg)) && (hdr->type == FFT_STREAM_MSG_COOP)) {
+		/*
+		 * An answer to an earlier half is stale, and after a withdrawal
+		 * the one to the request, which comes first, decides.
+		 */
+		if ((hdr->seq == (uint32_t)atomic_get(&coop_seq)) &&
+		    atomic_cas(&coop_done, COOP_NONE, (hdr->count != 0) ? COOP_DONE : COOP_LEFT)) {
+			k_sem_give(&coop_sem);
+		}
+		return;
+	}
+#endif
+
+#if defined(CONFIG_APP_FFT_CTRL)
+	if ((len == sizeof(struct fft_ctrl_msg)) && (hdr->type == FFT_STREAM_MSG_CTRL)) {
+		ctrl_recv(data);
+		return;
+	}
+
+	if (atomic_get(&stream_stopped)) {
+		return;
+	}
+#endif
+
+	ARG_UNUSED(hdr);
+	fft_stream_push_block(data, len);
+}
+
+#if defined(CONFIG_APP_FFT_SHM_RING)
+static const struct mbox_dt_spec ring_doorbell = MBOX_DT_SPEC_GET(DT_PATH(zephyr_user), fft_ring);
+static struct shm_ring sample_ring;
+
+/* Take every sample block in the ring, the writer rings only once it was empty. */
+static void ring_drain(void)
+{
+	const void *blk;
+
+	while ((blk = shm_ring_peek(&sample_ring)) != NULL) {
+#if defined(CONFIG_APP_FFT_CTRL)
+		if (atomic_get(&stream_stopped)) {
+			shm_ring_release(&sample_ring);
+			continue;
+		}
+#endif
+		fft_stream_push_block(blk, FFT_RING_SLOT_SIZE);
+		shm_ring_release(&sample_ring);
+	}
+}
+
+static void ring_doorbell_cb(const struct device *dev, mbox_channel_id_t channel_id,
+			     void *user_data, struct mbox_msg *data)
+{
+	ARG_UNUSED(dev);
+	ARG_UNUSED(channel_id);
+	ARG_UNUSED(user_data);
+	ARG_UNUSED(data);
+
+	ring_drain();
+}
+
+/* Call once bound, the application core has emptied the ring by then. */
+static int ring_start(void)
+{
+	int ret;
+
+	ret = shm_ring_init_reader(&sample_ring, (void *)FFT_POOL_ADDR, FFT_RING_NUM_SLOTS,
+				   FFT_RING_SLOT_SIZE);
+	if (ret < 0) {
+		return ret;
+	}
+
+	ret = mbox_register_callback_dt(&ring_doorbell, ring_doorbell_cb, NULL);
+	if (ret < 0) {
+		return ret;
+	}
+
+	ret = mbox_set_enabled_dt(&ring_doorbell, true);
+	if (ret < 0) {
+		return ret;
+	}
+
+	/* Blocks written before the doorbell was enabled rang for nothing. */
+	ring_drain();
+
+	return 0;
+}
+#endif /* CONFIG_APP_FFT_SHM_RING */
+#else
+#if defined(CONFIG_APP_IPC_SWEEP)
+static struct ipc_sweep sweep;
+
+static void ep_recv(const void *data, size_t len, void *priv)
+{
+	ARG_UNUSED(priv);
+
+	ipc_sweep_recv(&sweep, data, len);
+}
+#elif defined(CONFIG_APP_IPC_BENCH)
+static struct ipc_bench bench;
+static uint8_t bench_buf[CONFIG_APP_IPC_BENCH_MAX_LEN] __aligned(4);
+
+static void ep_recv(const void *data, size_t len, void *priv)
+{
+	ARG_UNUSED(priv);
+
+	ipc_bench_recv(&bench, data, len);
+}
+#else
+#if defined(CONFIG_APP_IPC_CREDIT)
+static struct ipc_credit credit_fc;
+#endif
+
+#if defined(CONFIG_APP_IPC_BATCH) || defined(CONFIG_APP_IPC_CREDIT)
+static void payload_recv(const void *data, size_t len, void *priv)
+#else
 static void ep_recv(const void *data, size_t len, void *priv)
+#endif
 {
 	uint8_t received_val = *((uint8_t *)data);
 	static uint8_t expected_val;
 
+#if defined(CONFIG_APP_IPC_TRACE)
+	ipc_trace_record(IPC_TRACE_RX, len, 0, 0);
+#endif
 
 	if ((received_val != expected_val) || (len != CONFIG_APP_IPC_SERVICE_MESSAGE_LEN)) {
 		printk("Unexpected message received_val: %d , expected_val: %d\n",
@@ -55,7 +497,43 @@ static void ep_recv(const void *data, size_t len, void *priv)
 	}
 
 	expected_val++;
+
+#if defined(CONFIG_APP_IPC_TRACE)
+	if (len > offsetof(struct payload, data)) {
+		ipc_trace_peer_recv((const uint8_t *)data + offsetof(struct payload, data),
+				    len - offsetof(struct payload, data));
+	}
+#endif
+}
+
+#if defined(CONFIG_APP_IPC_BATCH)
+static void ep_recv(const void *data, size_t len, void *priv)
+{
+	if (ipc_batch_unpack(data, len, payload_recv, priv) < 0) {
+		printk("Malformed batch received, len: %d\n", len);
+	}
+}
+#elif defined(CONFIG_APP_IPC_CREDIT)
+static void ep_recv(const void *data, size_t len, void *priv)
+{
+	const void *payload;
+	size_t payload_len;
+	int ret;
+
+	ret = ipc_credit_recv(&credit_fc, data, len, &payload, &payload_len);
+	if (ret < 0) {
+		printk("Malformed message received, len: %d\n", len);
+		return;
+	}
+
+	if (ret > 0) {
+		payload_recv(payload, payload_len, priv);
+		ipc_credit_release(&credit_fc);
+	}
 }
+#endif
+#endif /* CONFIG_APP_IPC_SWEEP */
+#endif /* CONFIG_APP_FFT_STREAM */
 
 static struct ipc_ept_cfg ep_cfg = {
 	.name = "ep0",
@@ -65,6 +543,64 @@ static struct ipc_ept_cfg ep_cfg = {
 	},
 };
 
+#if defined(CONFIG_APP_FFT_CTRL_PLANE)
+/* Both endpoints share ep_recv(), every message carries its type. */
+static struct ipc_ept_cfg ctrl_ep_cfg = {
+	.name = "ctrl",
+	.cb = {
+		.bound    = ep_bound,
+		.received = ep_recv,
+	},
+};
+
+static int ctrl_plane_open(void)
+{
+	const struct device *ipc1_instance = DEVICE_DT_GET(DT_NODELABEL(ipc1));
+	int ret;
+
+	ret = ipc_service_open_instance(ipc1_instance);
+	if ((ret < 0) && (ret != -EALREADY)) {
+		LOG_INF("ipc_service_open_instance(ipc1) failure (%d)", ret);
+		return ret;
+	}
+
+	ret = ipc_service_register_endpoint(ipc1_instance, &ctrl_ep, &ctrl_ep_cfg);
+	if (ret < 0) {
+		printk("ipc_service_register_endpoint(ctrl) failure (%d)\n", ret);
+		return ret;
+	}
+
+	return 0;
+}
+#endif
+
+#if defined(CONFIG_APP_FFT_STREAM)
+static void check_task(void *arg1, void *arg2, void *arg3)
+{
+	ARG_UNUSED(arg1);
+	ARG_UNUSED(arg2);
+	ARG_UNUSED(arg3);
+
+	struct fft_stream_stats st;
+	uint32_t last_frames = 0;
+
+	while (1) {
+		k_sleep(K_MSEC(1000));
+
+		fft_stream_get_stats(&st);
+
+		printk("Remote frames: %u/s | blocks: %u lost: %u dropped: %u skipped: %u bad: %u\n",
+			st.frames - last_frames, st.blocks, st.lost_blocks,
+			st.dropped_blocks, st.dropped_frames, st.bad_blocks);
+		printk("Remote overruns: %u late: %u\n", st.overruns, st.late_frames);
+#if defined(CONFIG_APP_FFT_RETRANSMIT)
+		printk("Remote blocks resent in time: %u\n", st.resent_blocks);
+#endif
+
+		last_frames = st.frames;
+	}
+}
+#else
 static void check_task(void *arg1, void *arg2, void *arg3)
 {
 	ARG_UNUSED(arg1);
@@ -81,33 +617,61 @@ static void check_task(void *arg1, void *arg2, void *arg3)
 
 		printk("Remote Δpkt: %ld (%ld B/pkt) | throughput: %ld bit/s\n",
 			delta, p_payload->size, delta * CONFIG_APP_IPC_SERVICE_MESSAGE_LEN * 8);
+#if defined(CONFIG_APP_IPC_TRACE)
+		ipc_trace_report("Remote", p_payload->data);
+#endif
 
 		last_cnt = p_payload->cnt;
 	}
 }
+#endif /* CONFIG_APP_FFT_STREAM */
 
 K_THREAD_DEFINE(thread_check_id, STACKSIZE, check_task, NULL, NULL, NULL,
 		K_PRIO_COOP(1), 0, -1);
 
-// 讀取 RISC-V cycle counter
-static inline uint32_t read_cycle(void) {
-	uint32_t cycle;
-	__asm__ volatile ("rdcycle %0" : "=r"(cycle));
-	return cycle;
-}
+#if defined(CONFIG_APP_FFT_BOOT_PERF)
 
-// 使用新 API 測試 FFT
-static void test_fft_with_api(void)
+#if defined(RFFT_Q15_PROFILE)
+/* Average cycles per frame of each stage since the last rfft_profile_reset(). */
+static void print_profile(void)
 {
-	printk("\n=== FFT API Test: 4096-point ===\n");
-	
-	static uint16_t top_bins[20];
-	
-	rfft_status_t status = find_fft_top_bins(
+	uint32_t frames = rfft_profile.frames;
+	uint32_t total = 0;
+
+	if (frames == 0) {
+		return;
+	}
+
+	printk("\nCycles per stage over %u frames:\n", frames);
+
+	for (uint32_t stage = 0; stage < RFFT_PROFILE_NUM_STAGES; stage++) {
+		uint32_t cycles = rfft_profile.cycles[stage] / frames;
+
+		if (rfft_profile.cycles[stage] != 0) {
+			printk("  %-16s %8u\n", rfft_profile_stage_name(stage), cycles);
+			total += cycles;
+		}
+	}
+
+	printk("  %-16s %8u\n", "total", total);
+}
+#endif /* RFFT_Q15_PROFILE */
+
+#if RFFT_Q15_HAS_LEN(4096)
+// 使用新 API 測試 FFT
+static void test_fft_with_api(void)
+{
+	printk("\n=== FFT API Test: 4096-point ===\n");
+	
+	static uint16_t top_bins[20];
+	static uint32_t peaks[20];
+	
+	rfft_status_t status = find_fft_top_bins_refined(
 		test_signal_15_sines,
 		4096,
 		4096,
 		top_bins,
+		peaks,
 		20
 	);
 	
@@ -122,9 +686,11 @@ static void test_fft_with_api(void)
 	printk("========================\n");
 	
 	for (int i = 0; i < 20; i++) {
-		float freq = (float)top_bins[i] * 16000.0f / 4096.0f;
-		printk("%2d    %4d   %8.2f\n", 
-		       i+1, top_bins[i], (double)freq);
+		/* Interpolated peak in 1/100 Hz, no floating point */
+		uint32_t centi_hz = (uint32_t)(((uint64_t)peaks[i] * 16000U * 100U) >>
+					       (12 + FFT_BIN_FRAC_BITS));
+		printk("%2d    %4d   %5u.%02u\n", 
+		       i+1, top_bins[i], centi_hz / 100U, centi_hz % 100U);
 	}
 	
 	printk("\n=== 4096-point Test Complete ===\n");
@@ -139,21 +705,26 @@ static void test_fft_performance(void)
 	const int iterations = 1000;
 	volatile uint32_t checksum = 0;  // 防止編譯器優化
 	
+	// 只取得一次 context，迴圈內走不檢查參數的 fast path
+	fft_context_t *ctx = fft_context_get_default(4096);
+	if (ctx == NULL) {
+		printk("✗ fft_context_get_default() failed\n");
+		return;
+	}
+	
 	printk("Running %d iterations...\n", iterations);
 	
+#if defined(RFFT_Q15_PROFILE)
+	rfft_profile_reset();
+#endif
+
 	// 使用 Zephyr 的高精度計時器
 	uint64_t start_time = k_cyc_to_ns_floor64(k_cycle_get_64());
 	uint64_t start_cycles = k_cycle_get_64();
 	
 	// 執行 100 次 FFT
 	for (int i = 0; i < iterations; i++) {
-		find_fft_top_bins(
-			test_signal_15_sines,
-			4096,
-			4096,
-			top_bins,
-			20
-		);
+		fft_context_execute(ctx, test_signal_15_sines, top_bins, 20);
 		// 累加結果防止優化
 		checksum += top_bins[0];
 	}
@@ -189,10 +760,97 @@ static void test_fft_performance(void)
 	}
 	
 	printk("  Checksum: %lu (防止優化)\n", (unsigned long)checksum);
+
+#if defined(RFFT_Q15_PROFILE)
+	print_profile();
+#endif
 	printk("\n=== Performance Test Complete ===\n");
 }
 
-#ifdef ENABLE_FFT_8K
+#if defined(CONFIG_APP_FFT_ASYNC)
+#define ASYNC_FRAMES 2
+
+/* Completion on the FFT thread, counts the frames done. */
+static void async_done(struct fft_async_job *job)
+{
+	(void)atomic_inc((atomic_t *)job->user);
+}
+
+/*
+ * Two frames submitted back to back, the second queued while the first is
+ * in the FFT, and checked against find_fft_top_bins().
+ */
+static void test_fft_async(void)
+{
+	static q15_t frames[ASYNC_FRAMES][4096] RFFT_Q15_ALIGN;
+	static uint16_t bins[ASYNC_FRAMES][20];
+	static uint16_t expected[20];
+	static struct fft_async_job jobs[ASYNC_FRAMES];
+	static struct k_poll_signal signals[ASYNC_FRAMES];
+	struct k_poll_event events[ASYNC_FRAMES];
+	atomic_t done = ATOMIC_INIT(0);
+	rfft_status_t status;
+	unsigned int signaled;
+	int result;
+	int ret;
+
+	printk("\n=== FFT Async Test: %d frames of 4096 points ===\n", ASYNC_FRAMES);
+
+	/* Before the submissions, the jobs share this context. */
+	status = find_fft_top_bins(test_signal_15_sines, 4096, 4096, expected, 20);
+	if (status != RFFT_SUCCESS) {
+		printk("✗ find_fft_top_bins() failed with status: %d\n", status);
+		return;
+	}
+
+	for (int i = 0; i < ASYNC_FRAMES; i++) {
+		memcpy(frames[i], test_signal_15_sines, sizeof(frames[i]));
+		k_poll_signal_init(&signals[i]);
+		k_poll_event_init(&events[i], K_POLL_TYPE_SIGNAL, K_POLL_MODE_NOTIFY_ONLY,
+				  &signals[i]);
+
+		jobs[i] = (struct fft_async_job){
+			.samples = frames[i],
+			.fft_size = 4096,
+			.num_top_bins = 20,
+			.bins = bins[i],
+			.cb = async_done,
+			.signal = &signals[i],
+			.user = &done,
+		};
+
+		ret = fft_async_submit(&jobs[i]);
+		if (ret < 0) {
+			printk("✗ fft_async_submit() failed with ret %d\n", ret);
+			return;
+		}
+	}
+
+	printk("Submitted, %u pending\n", fft_async_pending());
+
+	for (int i = 0; i < ASYNC_FRAMES; i++) {
+		ret = k_poll(&events[i], 1, K_SECONDS(1));
+		k_poll_signal_check(&signals[i], &signaled, &result);
+		if ((ret < 0) || !signaled) {
+			printk("✗ Frame %d not completed (%d)\n", i, ret);
+			return;
+		}
+		if ((result != RFFT_SUCCESS) ||
+		    (memcmp(bins[i], expected, sizeof(expected)) != 0)) {
+			printk("✗ Frame %d: status %d, top bins differ from find_fft_top_bins()\n",
+			       i, result);
+			return;
+		}
+	}
+
+	printk("✓ %ld frames completed, top bins match find_fft_top_bins()\n",
+	       (long)atomic_get(&done));
+	printk("\n=== Async Test Complete ===\n");
+}
+#endif /* CONFIG_APP_FFT_ASYNC */
+#endif /* RFFT_Q15_HAS_LEN(4096) */
+
+#if RFFT_Q15_HAS_LEN(8192)
 // 性能測試：8192 點 FFT
 static void test_fft_8192_performance(void)
 {
@@ -201,18 +859,23 @@ static void test_fft_8192_performance(void)
 	static uint16_t top_bins[20];
 	const int iterations = 100;
 	
+	fft_context_t *ctx = fft_context_get_default(8192);
+	if (ctx == NULL) {
+		printk("✗ fft_context_get_default() failed\n");
+		return;
+	}
+	
 	printk("Running %d iterations...\n", iterations);
 	
+#if defined(RFFT_Q15_PROFILE)
+	rfft_profile_reset();
+#endif
+
 	uint32_t start_cycle = read_cycle();
 	
 	for (int i = 0; i < iterations; i++) {
-		find_fft_top_bins(
-			test_signal_15_sines_8192,
-			8192,
-			8192,
-			top_bins,
-			20
-		);
+		fft_context_execute(ctx, test_signal_15_sines_8192,
+				    top_bins, 20);
 	}
 	
 	uint32_t end_cycle = read_cycle();
@@ -223,11 +886,11 @@ static void test_fft_8192_performance(void)
 	printk("  總 cycles: %lu\n", (unsigned long)total_cycles);
 	printk("  平均 cycles/FFT: %lu\n", (unsigned long)avg_cycles);
 	
-	uint32_t cpu_freq_mhz = 64;
+	uint32_t cpu_freq_mhz = CYCLE_COUNTER_HZ / 1000000;
 	uint32_t avg_us = avg_cycles / cpu_freq_mhz;
 	float avg_ms = (float)avg_cycles / (cpu_freq_mhz * 1000.0f);
 	
-	printk("  平均時間 (假設 64 MHz): %lu us (%.2f ms)\n", 
+	printk("  平均時間 (%lu MHz): %lu us (%.2f ms)\n", (unsigned long)cpu_freq_mhz,
 	       (unsigned long)avg_us, (double)avg_ms);
 	
 	if (avg_cycles > 0) {
@@ -235,11 +898,15 @@ static void test_fft_8192_performance(void)
 		printk("  FFT 吞吐量: %lu FFTs/秒\n", (unsigned long)ffts_per_sec);
 	}
 	
+#if defined(RFFT_Q15_PROFILE)
+	print_profile();
+#endif
+
 	printk("\n=== Performance Test Complete ===\n");
 }
-#endif /* ENABLE_FFT_8K */
+#endif /* RFFT_Q15_HAS_LEN(8192) */
 
-#ifdef ENABLE_FFT_8K
+#if RFFT_Q15_HAS_LEN(8192)
 // 測試 8192 點 FFT
 static void test_fft_8192(void)
 {
@@ -273,61 +940,2665 @@ static void test_fft_8192(void)
 	
 	printk("\n=== 8192-point Test Complete ===\n");
 }
-#endif /* ENABLE_FFT_8K */
+#endif /* RFFT_Q15_HAS_LEN(8192) */
+#endif /* CONFIG_APP_FFT_BOOT_PERF */
 
-int main(void)
+#if defined(CONFIG_APP_FFT_STREAM)
+#if defined(CONFIG_APP_FFT_FLOOR)
+/* Noise floor of the stream frames, also the floor of the compact average. */
+static spectral_floor_t stream_floor;
+#endif
+
+#if defined(CONFIG_APP_FFT_PSD)
+#define PSD_NUM_BINS(len) ((len) / 2 + 1)
+
+#if defined(CONFIG_APP_FFT_PSD_EXPONENTIAL)
+#define PSD_MODE SPECTRAL_PSD_EXPONENTIAL
+#else
+#define PSD_MODE SPECTRAL_PSD_LINEAR
+#endif
+
+#if defined(CONFIG_APP_FFT_PSD_COMPACT)
+/*
+ * Send the chunk of the average from bin first on, coded in up to
+ * FFT_PSD_PACKED_MAX bytes in place in the transmit buffer with icbmsg.
+ * Returns the bins it holds, or -ENOMEM without room for it unless wait.
+ */
+static int send_psd_chunk(struct ipc_ept *ep, spectral_psd_t *psd, uint32_t seq, uint32_t first,
+			  bool wait)
 {
-	const struct device *ipc0_instance;
-	struct ipc_ept ep;
+	struct fft_psd_packed_msg *msg;
+	uint8_t floor_code = CONFIG_APP_FFT_PSD_COMPACT_FLOOR;
+	uint32_t coded;
+	size_t len;
 	int ret;
 
-	memset(p_payload->data, 0xA5, sizeof(p_payload->data));
+#if defined(CONFIG_APP_FFT_FLOOR)
+	/* The noise below the floor of the last frame becomes runs. */
+	floor_code = MAX(floor_code, psd_pack_log8(stream_floor.threshold));
+#endif
 
-	p_payload->size = CONFIG_APP_IPC_SERVICE_MESSAGE_LEN;
-	p_payload->cnt = 0;
+#if defined(CONFIG_IPC_SERVICE_BACKEND_ICBMSG)
+	uint32_t size = sizeof(*msg);
 
-	printk("Remote IPC-service %s demo started\n", CONFIG_BOARD_TARGET);
-	
-	// 性能測試 4096 點 FFT
-	test_fft_performance();
-	
-#ifdef ENABLE_FFT_8K
-	// 性能測試 8192 點 FFT
-	test_fft_8192_performance();
+	ret = ipc_service_get_tx_buffer(ep, (void **)&msg, &size, wait ? K_FOREVER : K_NO_WAIT);
+	if (ret == -ENOBUFS) {
+		return -ENOMEM;
+	} else if (ret < 0) {
+		printk("ipc_service_get_tx_buffer(psd %u) failed with ret %d\n", seq, ret);
+		return ret;
+	}
+#else
+	static struct fft_psd_packed_msg buf;
+
+	msg = &buf;
 #endif
 
-	ipc0_instance = DEVICE_DT_GET(DT_NODELABEL(ipc0));
+	len = psd_pack_encode(msg->data, sizeof(msg->data), &psd->acc[first],
+			      psd->num_bins - first, floor_code, &coded);
+
+	msg->hdr.type = FFT_STREAM_MSG_PSD_PACKED;
+	msg->hdr.count = coded;
+	msg->hdr.seq = seq;
+	msg->first_bin = first;
+	msg->frames = psd->frames;
 
 #if defined(CONFIG_IPC_SERVICE_BACKEND_ICBMSG)
-	/* Wait a bit for the remote core to boot. */
-	k_msleep(100);
+	ret = ipc_service_send_nocopy(ep, msg, FFT_PSD_PACKED_MSG_SIZE(len));
+	if (ret < 0) {
+		(void)ipc_service_drop_tx_buffer(ep, msg);
+	}
+#else
+	if (wait) {
+		ret = send_wait(ep, msg, FFT_PSD_PACKED_MSG_SIZE(len));
+	} else {
+		ret = ipc_service_send(ep, msg, FFT_PSD_PACKED_MSG_SIZE(len));
+	}
 #endif
 
-	ret = ipc_service_open_instance(ipc0_instance);
-	if ((ret < 0) && (ret != -EALREADY)) {
-		LOG_INF("ipc_service_open_instance() failure (%d)", ret);
+	if (ret == -ENOMEM) {
+		/* Only without wait, the caller tries again later. */
+		return ret;
+	} else if (ret < 0) {
+		printk("send_message(psd %u) failed with ret %d\n", seq, ret);
 		return ret;
 	}
 
-	ret = ipc_service_register_endpoint(ipc0_instance, &ep, &ep_cfg);
-	if (ret < 0) {
-		printf("ipc_service_register_endpoint() failure (%d)", ret);
+	return coded;
+}
+#else
+/*
+ * Send the chunk of the average from bin first on, up to FFT_PSD_MSG_BINS.
+ * Returns the bins it holds, or -ENOMEM without room for it unless wait.
+ */
+static int send_psd_chunk(struct ipc_ept *ep, spectral_psd_t *psd, uint32_t seq, uint32_t first,
+			  bool wait)
+{
+	static struct fft_psd_msg msg;
+	uint32_t n = MIN(psd->num_bins - first, FFT_PSD_MSG_BINS);
+	int ret;
+
+	msg.hdr.type = FFT_STREAM_MSG_PSD;
+	msg.hdr.count = n;
+	msg.hdr.seq = seq;
+	msg.first_bin = first;
+	msg.frames = psd->frames;
+	memcpy(msg.bins, &psd->acc[first], n * sizeof(uint32_t));
+
+	if (wait) {
+		ret = send_wait(ep, &msg, FFT_PSD_MSG_SIZE(n));
+	} else {
+		ret = ipc_service_send(ep, &msg, FFT_PSD_MSG_SIZE(n));
+	}
+
+	if (ret == -ENOMEM) {
+		/* Only without wait, the caller tries again later. */
+		return ret;
+	} else if (ret < 0) {
+		printk("send_message(psd %u) failed with ret %d\n", seq, ret);
 		return ret;
 	}
 
-	k_sem_take(&bound_sem, K_FOREVER);
-	k_thread_start(thread_check_id);
+	return n;
+}
+#endif /* CONFIG_APP_FFT_PSD_COMPACT */
 
-	while (true) {
-		ret = ipc_service_send(&ep, p_payload, CONFIG_APP_IPC_SERVICE_MESSAGE_LEN);
+#if !defined(CONFIG_APP_FFT_PRIO)
+/* Send the whole average, chunk by chunk, a linear one then starts over. */
+static int send_psd(struct ipc_ept *ep, spectral_psd_t *psd, uint32_t seq)
+{
+	int ret;
+
+	for (uint32_t first = 0; first < psd->num_bins; first += ret) {
+		ret = send_psd_chunk(ep, psd, seq, first, true);
+		if (ret < 0) {
+			return ret;
+		}
+	}
+
+	if (psd->mode == SPECTRAL_PSD_LINEAR) {
+		spectral_psd_reset(psd);
+	}
+
+	return 0;
+}
+#endif /* !CONFIG_APP_FFT_PRIO */
+#endif /* CONFIG_APP_FFT_PSD */
+
+#if defined(CONFIG_APP_FFT_LATENCY)
+/* Answer the last clock sync request, the reply carries when it was sent. */
+static int send_sync(struct ipc_ept *ep)
+{
+	struct fft_sync_msg msg = sync_reply;
+	int ret;
+
+	do {
+		msg.remote_tx = read_cycle_us();
+		ret = ipc_service_send(ctrl_plane(ep), &msg, sizeof(msg));
 		if (ret == -ENOMEM) {
-			/* No space in the buffer. Retry. */
+			send_backoff();
+		}
+	} while (ret == -ENOMEM);
+
+	if (ret < 0) {
+		printk("send_message(sync %u) failed with ret %d\n", msg.hdr.seq, ret);
+		return ret;
+	}
+
+	return 0;
+}
+#endif /* CONFIG_APP_FFT_LATENCY */
+
+#if defined(RFFT_Q15_PROFILE)
+/* Send the stages that took cycles since the last report, then start over. */
+static int send_profile(struct ipc_ept *ep, uint32_t seq)
+{
+	struct fft_profile_msg msg = {
+		.hdr = { .type = FFT_STREAM_MSG_PROFILE, .seq = seq },
+	};
+	uint32_t frames = rfft_profile.frames;
+	int ret;
+
+	if (frames == 0) {
+		return 0;
+	}
+
+	for (uint32_t stage = 0; stage < RFFT_PROFILE_NUM_STAGES; stage++) {
+		if (rfft_profile.cycles[stage] != 0) {
+			msg.hdr.count++;
+		}
+	}
+
+	msg.frames = MIN(frames, UINT16_MAX);
+
+	for (uint32_t stage = 0; stage < RFFT_PROFILE_NUM_STAGES; stage++) {
+		if (rfft_profile.cycles[stage] == 0) {
 			continue;
-		} else if (ret < 0) {
-			printk("send_message(%ld) failed with ret %d\n", p_payload->cnt, ret);
-			break;
 		}
 
+		msg.cycles = rfft_profile.cycles[stage] / frames;
+		strncpy(msg.name, rfft_profile_stage_name(stage), sizeof(msg.name) - 1);
+
+		ret = send_wait(ctrl_plane(ep), &msg, sizeof(msg));
+
+		if (ret < 0) {
+			printk("send_message(profile %u) failed with ret %d\n", seq, ret);
+			return ret;
+		}
+
+		msg.row++;
+	}
+
+	rfft_profile_reset();
+
+	return 0;
+}
+#endif /* RFFT_Q15_PROFILE */
+
+#if defined(FFT_DEFAULT_WINDOW)
+#define STREAM_WINDOW FFT_DEFAULT_WINDOW
+#else
+#define STREAM_WINDOW FFT_WINDOW_RECT
+#endif
+
+/* Bytes of the analysis buffers in the arena, the frame buffers follow them. */
+#if defined(CONFIG_APP_FFT_PSD)
+#define STREAM_PSD_SIZE(len) \
+	FFT_ARENA_SIZE(SPECTRAL_PSD_STORAGE_LEN(PSD_NUM_BINS(len)) * sizeof(uint32_t))
+#else
+#define STREAM_PSD_SIZE(len) 0
+#endif
+#if defined(CONFIG_APP_FFT_STOCKHAM)
+#define STREAM_STOCKHAM_SIZE(len) FFT_ARENA_SIZE((len) * sizeof(q15_t))
+#else
+#define STREAM_STOCKHAM_SIZE(len) 0
+#endif
+#if defined(CONFIG_APP_FFT_INPUT_Q7)
+#define STREAM_INPUT_SIZE(len) FFT_ARENA_SIZE((len) * sizeof(q15_t))
+#else
+#define STREAM_INPUT_SIZE(len) 0
+#endif
+#if defined(CONFIG_APP_FFT_MEL)
+#define STREAM_MEL_SIZE(len) FFT_ARENA_SIZE(SPECTRAL_MEL_WEIGHTS(len) * sizeof(q15_t))
+#else
+#define STREAM_MEL_SIZE(len) 0
+#endif
+#if defined(CONFIG_APP_FFT_FLOOR)
+#define STREAM_FLOOR_BLOCKS(len) \
+	SPECTRAL_FLOOR_BLOCKS((len) / 2 + 1, CONFIG_APP_FFT_FLOOR_BLOCK_SHIFT)
+#define STREAM_FLOOR_SIZE(len) FFT_ARENA_SIZE(STREAM_FLOOR_BLOCKS(len) * sizeof(uint32_t))
+#else
+#define STREAM_FLOOR_SIZE(len) 0
+#endif
+#if defined(CONFIG_APP_FFT_ORDER)
+#define ORDER_HISTORY_LEN BIT(CONFIG_APP_FFT_ORDER_HISTORY_SHIFT)
+#define STREAM_ORDER_SIZE(len) \
+	(FFT_ARENA_SIZE(2 * ORDER_HISTORY_LEN * sizeof(q15_t)) + FFT_ARENA_SIZE((len) * sizeof(q15_t)))
+#else
+#define STREAM_ORDER_SIZE(len) 0
+#endif
+#if defined(CONFIG_APP_FFT_PIPELINE)
+/* The window is counted with the others, the bands are the chain's own. */
+#define STREAM_PIPELINE_SIZE FFT_ARENA_SIZE(CONFIG_APP_FFT_BANDS_MAX * sizeof(spectral_band_t))
+#else
+#define STREAM_PIPELINE_SIZE 0
+#endif
+
+/* With APP_FFT_CONST_WINDOWS every window table is generated, none takes arena. */
+#if defined(CONFIG_APP_FFT_CONST_WINDOWS)
+#define STREAM_WINDOW_SIZE(len, window) 0
+#else
+#define STREAM_WINDOW_SIZE(len, window) \
+	(((window) != FFT_WINDOW_RECT) ? FFT_ARENA_SIZE(FFT_WINDOW_TABLE_LEN(len) * sizeof(q15_t)) : 0)
+#endif
+
+#if defined(CONFIG_APP_FFT_SHED) && !defined(CONFIG_APP_FFT_PSD) && \
+	!defined(CONFIG_APP_FFT_FLOOR) && !defined(CONFIG_APP_FFT_SPECTROGRAM) && \
+	!defined(CONFIG_APP_FFT_ENVELOPE) && !defined(CONFIG_APP_FFT_EVENTS) && \
+	!defined(CONFIG_APP_FFT_BANDS) && !defined(CONFIG_APP_FFT_MEL) && \
+	!defined(CONFIG_APP_FFT_TRACK)
+/* Only the plain top bins may come from half the frame, nothing else misses its frames. */
+#define SHED_HALF 1
+#define STREAM_SHED_SIZE(len, window) \
+	(FFT_ARENA_SIZE(CONFIG_APP_FFT_TOP_BINS * sizeof(spectral_peak_t)) + \
+	 STREAM_WINDOW_SIZE((len) / 2, window))
+#else
+#define STREAM_SHED_SIZE(len, window) 0
+#endif
+#define STREAM_ANALYSIS_SIZE(len, window) \
+	(FFT_ARENA_SIZE(CONFIG_APP_FFT_TOP_BINS * sizeof(spectral_peak_t)) + \
+	 STREAM_WINDOW_SIZE(len, window) + STREAM_PSD_SIZE(len) + STREAM_STOCKHAM_SIZE(len) + \
+	 STREAM_INPUT_SIZE(len) + \
+	 STREAM_MEL_SIZE(len) + STREAM_FLOOR_SIZE(len) + STREAM_ORDER_SIZE(len) + \
+	 STREAM_SHED_SIZE(len, window) + STREAM_PIPELINE_SIZE)
+
+/* Any window may be asked for at run time, leave room for its table. */
+#if defined(CONFIG_APP_FFT_RECONFIG)
+#define STREAM_ARENA_WINDOW FFT_WINDOW_HANN
+#else
+#define STREAM_ARENA_WINDOW STREAM_WINDOW
+#endif
+
+#if CONFIG_APP_FFT_ARENA_SIZE > 0
+#define STREAM_ARENA_SIZE CONFIG_APP_FFT_ARENA_SIZE
+#else
+#define STREAM_ARENA_SIZE \
+	(STREAM_ANALYSIS_SIZE(CONFIG_APP_FFT_FRAME_LEN, STREAM_ARENA_WINDOW) + \
+	 FFT_STREAM_ARENA_SIZE(FFT_STREAM_NUM_FRAMES, CONFIG_APP_FFT_FRAME_LEN))
+#endif
+
+/* So the analysis buffers never fail at startup and the stream gets at least one frame. */
+BUILD_ASSERT(STREAM_ARENA_SIZE >= STREAM_ANALYSIS_SIZE(CONFIG_APP_FFT_FRAME_LEN, STREAM_WINDOW) +
+				  FFT_STREAM_ARENA_SIZE(1, CONFIG_APP_FFT_FRAME_LEN),
+	     "APP_FFT_ARENA_SIZE does not hold the analysis buffers and one frame");
+
+#if defined(FFT_ARENA_SECTION)
+#define STREAM_ARENA_ATTR __attribute__((section(FFT_ARENA_SECTION)))
+#else
+#define STREAM_ARENA_ATTR __noinit
+#endif
+
+static uint8_t stream_arena_mem[STREAM_ARENA_SIZE] __aligned(FFT_ARENA_ALIGN) STREAM_ARENA_ATTR;
+static struct fft_arena stream_arena = {
+	.base = stream_arena_mem,
+	.size = sizeof(stream_arena_mem),
+};
+static fft_context_t stream_ctx;
+#if defined(CONFIG_APP_FFT_PSD)
+static spectral_psd_t stream_psd;
+#if defined(CONFIG_APP_FFT_PRIO)
+/* Readout of the average under way, resumed after every frame. */
+static struct {
+	uint32_t seq;
+	uint32_t next_bin;
+	/* The average is fed again after it, unless a chain left it out. */
+	spectral_psd_t *fed;
+	bool active;
+} psd_xfer;
+#endif
+#endif
+#if defined(CONFIG_APP_FFT_STATS)
+static fft_stats_t stream_stats;
+#endif
+#if defined(CONFIG_APP_FFT_INPUT_Q7)
+/* The 8-bit frames widened, the buffer every FFT runs in. */
+static q15_t *stream_input;
+#endif
+static uint32_t stream_frame_len;
+static fft_window_type_t stream_window;
+/* Bins per result, up to the CONFIG_APP_FFT_TOP_BINS the arena holds. */
+static uint16_t stream_top_k = CONFIG_APP_FFT_TOP_BINS;
+
+#if defined(CONFIG_APP_FFT_PIPELINE)
+/* Chain of every frame, the plain top bins until the application core sets another. */
+static struct fft_pipeline stream_pipe;
+static struct fft_stage stream_stages[FFT_PIPELINE_MAX_STAGES] = {
+	{ .id = FFT_STAGE_WINDOW, .param = STREAM_WINDOW },
+	{ .id = FFT_STAGE_FFT },
+#if defined(CONFIG_APP_FFT_PSD)
+	{ .id = FFT_STAGE_PSD },
+#endif
+	{ .id = FFT_STAGE_TOP_K },
+	{ .id = FFT_STAGE_SEND_RESULT },
+};
+static uint16_t stream_num_stages = IS_ENABLED(CONFIG_APP_FFT_PSD) ? 5 : 4;
+#endif
+
+#if defined(CONFIG_APP_FFT_TRACK)
+/* Places of the tracked top bins, and whether the next message starts them over. */
+static spectral_track_place_t stream_track_places[CONFIG_APP_FFT_TOP_BINS];
+static spectral_track_change_t stream_track_changes[CONFIG_APP_FFT_TOP_BINS];
+static spectral_track_t stream_track;
+static bool track_restart;
+
+/* Start the set over with stream_top_k places, the application core with it. */
+static void track_setup(void)
+{
+	(void)spectral_track_init(&stream_track, stream_track_places, stream_track_changes,
+				  stream_top_k, CONFIG_APP_FFT_TRACK_MOVE_BINS,
+				  CONFIG_APP_FFT_TRACK_HYST_SHIFT);
+	(void)fft_context_set_track(&stream_ctx, &stream_track);
+	track_restart = true;
+}
+#endif
+
+#if defined(CONFIG_APP_FFT_EVENTS)
+/* Band whose energy is watched, and the running average of that energy. */
+static spectral_band_t event_band;
+static uint64_t event_band_baseline;
+/* Causes of the last event sent, 0 while the frames are under the thresholds. */
+static uint8_t event_cause;
+#endif
+
+#if defined(CONFIG_APP_FFT_BANDS)
+/* Bands whose energies replace the results, and their edges sorted by bin. */
+static spectral_band_t stream_bands[CONFIG_APP_FFT_BANDS_MAX];
+static spectral_band_edge_t stream_band_edges[2 * CONFIG_APP_FFT_BANDS_MAX];
+static uint16_t stream_num_bands;
+
+/* Octaves from APP_FFT_BANDS_FIRST_BIN up to bin frame_len / 2. */
+static void bands_reset(uint32_t frame_len)
+{
+	uint32_t first = CONFIG_APP_FFT_BANDS_FIRST_BIN;
+
+	stream_num_bands = 0;
+	while ((first <= frame_len / 2) && (stream_num_bands < CONFIG_APP_FFT_BANDS_MAX)) {
+		stream_bands[stream_num_bands].first_bin = first;
+		stream_bands[stream_num_bands].last_bin = MIN(2 * first - 1, frame_len / 2);
+		stream_num_bands++;
+		first *= 2;
+	}
+
+	(void)fft_context_set_band_table(&stream_ctx, stream_bands, stream_num_bands,
+					 stream_band_edges);
+}
+#endif
+
+#if defined(CONFIG_APP_FFT_MEL)
+/* Filterbank whose features replace the results, its weights are in the arena. */
+static spectral_mel_t stream_mel;
+static uint64_t stream_mel_energy[CONFIG_APP_FFT_MEL_FILTERS];
+static uint16_t stream_mel_edge[SPECTRAL_MEL_EDGES(CONFIG_APP_FFT_MEL_FILTERS)];
+#if defined(CONFIG_APP_FFT_MEL_OUTPUT_MFCC)
+static q15_t stream_mel_dct[CONFIG_APP_FFT_MEL_MFCC_COEFFS * CONFIG_APP_FFT_MEL_FILTERS];
+#endif
+
+/* Lay the filters out over the bins of frame_len. */
+static int mel_setup(uint32_t frame_len)
+{
+	const spectral_mel_config_t config = {
+		.fft_size = frame_len,
+		.num_filters = CONFIG_APP_FFT_MEL_FILTERS,
+		.sample_rate = CONFIG_APP_FFT_SAMPLE_RATE,
+		.low_hz = CONFIG_APP_FFT_MEL_LOW_HZ,
+		.high_hz = CONFIG_APP_FFT_MEL_HIGH_HZ,
+		.scale = IS_ENABLED(CONFIG_APP_FFT_MEL_LOG_SPACED) ? SPECTRAL_MEL_SCALE_LOG :
+								     SPECTRAL_MEL_SCALE_MEL,
+	};
+	q15_t *weight;
+	rfft_status_t status;
+
+	weight = FFT_ARENA_ALLOC_ARRAY(&stream_arena, q15_t, SPECTRAL_MEL_WEIGHTS(frame_len));
+	if (weight == NULL) {
+		return -ENOMEM;
+	}
+
+	status = spectral_mel_init(&stream_mel, &config, stream_mel_energy, weight,
+				   stream_mel_edge);
+	if (status != RFFT_SUCCESS) {
+		printk("spectral_mel_init(%u) failed with status: %d\n", frame_len, status);
+		return -EINVAL;
+	}
+
+#if defined(CONFIG_APP_FFT_MEL_OUTPUT_MFCC)
+	/* The cosines come from the twiddle table of the context just set up. */
+	(void)spectral_mel_set_dct(&stream_mel, stream_mel_dct, CONFIG_APP_FFT_MEL_MFCC_COEFFS);
+#endif
+
+	(void)fft_context_set_mel(&stream_ctx, &stream_mel);
+
+	return 0;
+}
+#endif
+
+#if defined(CONFIG_APP_FFT_SPECTROGRAM)
+/* Row pooled from the frames due, frames left until the next one, rows dropped since the last. */
+static spectral_gram_t stream_gram;
+static uint32_t stream_gram_column[CONFIG_APP_FFT_SPECTROGRAM_COLUMNS];
+static uint32_t gram_countdown;
+static uint32_t gram_dropped;
+
+/* Lay the columns out over the bins of frame_len, the next row is due at once. */
+static int gram_setup(uint32_t frame_len)
+{
+	uint32_t num_bins = frame_len / 2 + 1;
+
+	if (spectral_gram_init(&stream_gram, stream_gram_column, num_bins,
+			       MIN(CONFIG_APP_FFT_SPECTROGRAM_COLUMNS, num_bins)) != RFFT_SUCCESS) {
+		return -EINVAL;
+	}
+
+	gram_countdown = 0;
+	gram_dropped = 0;
+
+	return 0;
+}
+
+/* Whether the next frame is pooled into a row; only then does the context pool it. */
+static bool gram_next_frame(void)
+{
+	uint32_t decimation = (uint32_t)atomic_get(&gram_decimation);
+	bool due = (decimation != 0) && (gram_countdown == 0);
+
+	if (decimation == 0) {
+		gram_countdown = 0;
+	} else if (due) {
+		gram_countdown = decimation - 1;
+	} else {
+		/* A lower decimation subscribed to shortens the wait. */
+		gram_countdown = MIN(gram_countdown - 1, decimation - 1);
+	}
+
+	(void)fft_context_set_gram(&stream_ctx, due ? &stream_gram : NULL);
+
+	return due;
+}
+
+/*
+ * Send the row of the frame just analysed, or drop it if the link has no
+ * room: the next row shows the same display as well, and the results and
+ * sample blocks never wait for one.
+ */
+static int send_spectrogram(struct ipc_ept *ep, uint32_t seq)
+{
+	static struct fft_spectrogram_msg msg;
+	int ret;
+
+	msg.hdr.type = FFT_STREAM_MSG_SPECTROGRAM;
+	msg.hdr.count = stream_gram.num_columns;
+	msg.hdr.seq = seq;
+	msg.num_bins = stream_gram.num_bins;
+	msg.dropped = MIN(gram_dropped, UINT16_MAX);
+
+	for (uint32_t i = 0; i < msg.hdr.count; i++) {
+		msg.column[i] = psd_pack_log8(stream_gram.column[i]);
+	}
+
+	ret = ipc_service_send(ep, &msg, FFT_SPECTROGRAM_MSG_SIZE(msg.hdr.count));
+	if (ret == -ENOMEM) {
+		gram_dropped++;
+		return 0;
+	}
+
+	if (ret < 0) {
+		printk("send_message(spectrogram %u) failed with ret %d\n", seq, ret);
+		return ret;
+	}
+
+	gram_dropped = 0;
+
+	return 0;
+}
+#endif /* CONFIG_APP_FFT_SPECTROGRAM */
+
+#if defined(CONFIG_APP_FFT_ENVELOPE)
+/* Chain whose envelope spectrum replaces the spectrum of every frame. */
+static fft_envelope_t stream_envelope;
+
+/* Place the band on the bins of frame_len, only the decimation is fixed. */
+static int envelope_setup(uint32_t frame_len)
+{
+	rfft_status_t status;
+
+	status = fft_envelope_init(&stream_envelope, frame_len,
+				   BIT(CONFIG_APP_FFT_ENVELOPE_DECIMATION_SHIFT),
+				   FFT_ENVELOPE_BIN(CONFIG_APP_FFT_ENVELOPE_LOW_HZ, frame_len,
+						    CONFIG_APP_FFT_SAMPLE_RATE),
+				   FFT_ENVELOPE_BIN(CONFIG_APP_FFT_ENVELOPE_HIGH_HZ, frame_len,
+						    CONFIG_APP_FFT_SAMPLE_RATE));
+	if (status == RFFT_SUCCESS) {
+		status = fft_context_set_envelope(&stream_ctx, &stream_envelope);
+	}
+
+	if (status != RFFT_SUCCESS) {
+		printk("fft_envelope_init(%u) failed with status: %d\n", frame_len, status);
+		return -EINVAL;
+	}
+
+	return 0;
+}
+#endif
+
+#if defined(CONFIG_APP_FFT_STATS)
+/* Statistics of the frame the context analysed last, into its result. */
+static void stats_read(struct fft_result_stats *out)
+{
+	fft_stats_result_t stats;
+
+	fft_stats_read(&stream_stats, &stats);
+	out->mean = stats.mean;
+	out->rms = stats.rms;
+	out->peak = stats.peak;
+	out->crest = stats.crest;
+	out->kurtosis = stats.kurtosis;
+}
+#endif
+
+#if defined(CONFIG_APP_FFT_ORDER)
+/* Interpolator phases and taps per phase, about the top 1/8 of the band in the transition */
+#define ORDER_PHASES 32
+#define ORDER_TAPS   8
+
+BUILD_ASSERT(CONFIG_APP_FFT_FRAME_LEN % CONFIG_APP_FFT_ORDER_SAMPLES_PER_REV == 0,
+	     "APP_FFT_FRAME_LEN must be whole revolutions of APP_FFT_ORDER_SAMPLES_PER_REV");
+
+/* Resampler whose frames of whole revolutions are analysed instead of the stream frames. */
+static fft_order_t stream_order;
+static q15_t order_taps[ORDER_PHASES * ORDER_TAPS];
+/* Hands the resampled frame to the analysis like a frame of the stream. */
+static struct fft_frame order_frame;
+/* Stream frame being resampled, and the samples of it pushed so far. */
+static struct fft_frame *order_input;
+static uint32_t order_used;
+
+/* Take the history and the resampled frame from the arena. */
+static int order_setup(uint32_t frame_len)
+{
+	q15_t *history = FFT_ARENA_ALLOC_ARRAY(&stream_arena, q15_t, 2 * ORDER_HISTORY_LEN);
+	q15_t *frame = FFT_ARENA_ALLOC_ARRAY(&stream_arena, q15_t, frame_len);
+	rfft_status_t status;
+
+	if ((history == NULL) || (frame == NULL)) {
+		return -ENOMEM;
+	}
+
+	status = fft_order_design(order_taps, ORDER_PHASES, ORDER_TAPS);
+	if (status == RFFT_SUCCESS) {
+		status = fft_order_init(&stream_order, order_taps, ORDER_PHASES, ORDER_TAPS,
+					CONFIG_APP_FFT_ORDER_SAMPLES_PER_REV, frame_len, history,
+					ORDER_HISTORY_LEN, frame, 0);
+	}
+
+	if (status != RFFT_SUCCESS) {
+		printk("fft_order_init(%u) failed with status: %d\n", frame_len, status);
+		return -EINVAL;
+	}
+
+	order_frame.samples = frame;
+	order_frame.seq = 0;
+	order_input = NULL;
+
+	return 0;
+}
+
+/*
+ * Resample frames of the stream until a frame of whole revolutions is
+ * due. A stream frame that does not start where the one before ended
+ * starts the resampler over. The frame due may end part way into a
+ * stream frame, the rest of which is kept for the next call.
+ */
+static int order_get_frame(struct fft_frame **frame, k_timeout_t timeout)
+{
+	uint32_t pos;
+	int ret;
+
+	while (!fft_order_frame_ready(&stream_order)) {
+		if (order_input == NULL) {
+			ret = fft_stream_get_frame(&order_input, timeout);
+			if (ret < 0) {
+				order_input = NULL;
+				return ret;
+			}
+			order_used = 0;
+
+			pos = order_input->end_pos - stream_frame_len;
+			if (pos != stream_order.written) {
+				/* Blocks went missing, no revolution across them is usable. */
+				fft_order_reset(&stream_order, pos);
+			}
+		}
+
+		/* The rest of the pulses wait in the queue for room. */
+		while ((stream_order.num_pulses < FFT_ORDER_MAX_PULSES) &&
+		       (k_msgq_get(&order_pulses, &pos, K_NO_WAIT) == 0)) {
+			fft_order_pulse(&stream_order, pos);
+		}
+
+		/* A block at a time, a frame may complete more revolutions than the resampler holds. */
+		order_used += fft_order_push(&stream_order, &order_input->samples[order_used],
+					     MIN(stream_frame_len - order_used,
+						 CONFIG_APP_FFT_BLOCK_SAMPLES));
+		if (order_used == stream_frame_len) {
+			fft_stream_release_frame(order_input);
+			order_input = NULL;
+		}
+	}
+
+	*frame = &order_frame;
+
+	return 0;
+}
+
+/* Give the resampled frame back, its samples are overwritten from here on. */
+static void order_release_frame(struct fft_frame *frame)
+{
+	fft_order_release(&stream_order);
+	frame->seq++;
+}
+#endif
+
+#if defined(CONFIG_APP_FFT_DUTY_CYCLE)
+/* Frames of one clock decision. */
+#define DUTY_FRAMES BIT(CONFIG_APP_FFT_DUTY_CYCLE_SHIFT)
+
+#define DUTY_MHZ_FULL (CYCLE_COUNTER_HZ / 1000000)
+#define DUTY_MHZ_HALF (DUTY_MHZ_FULL / 2)
+
+BUILD_ASSERT(CYCLE_COUNTER_HZ % CONFIG_APP_FFT_SAMPLE_RATE == 0,
+	     "APP_FFT_SAMPLE_RATE must divide the FLPR clock");
+
+/* Cycles of the full clock between the starts of DUTY_FRAMES frames. */
+static uint64_t duty_budget;
+/* Cycles of analysis over the frames of the decision so far. */
+static uint64_t duty_busy;
+static uint32_t duty_frames;
+/* Blocks and frames the assembler dropped up to the last decision. */
+static uint32_t duty_dropped;
+/* Clock last asked of the application core. */
+static uint16_t duty_mhz = DUTY_MHZ_FULL;
+static uint32_t duty_seq;
+
+static int duty_request(struct ipc_ept *ep, uint16_t mhz)
+{
+	struct fft_clock_msg msg = {
+		.hdr = { .type = FFT_STREAM_MSG_CLOCK, .count = mhz, .seq = duty_seq++ },
+		.busy = (uint32_t)(duty_busy >> CONFIG_APP_FFT_DUTY_CYCLE_SHIFT),
+		.budget = (uint32_t)(duty_budget >> CONFIG_APP_FFT_DUTY_CYCLE_SHIFT),
+	};
+	int ret;
+
+	ret = send_wait(ctrl_plane(ep), &msg, sizeof(msg));
+
+	if (ret < 0) {
+		printk("send_message(clock %u) failed with ret %d\n", mhz, ret);
+		return ret;
+	}
+
+	duty_mhz = mhz;
+
+	return 0;
+}
+
+static uint32_t duty_dropped_get(void)
+{
+	struct fft_stream_stats st;
+
+	fft_stream_get_stats(&st);
+
+	return st.dropped_blocks + st.dropped_frames;
+}
+
+/*
+ * Start the decisions over for frames of frame_len samples, at the full
+ * clock until the first one: a longer frame may not fit at half of it.
+ */
+static int duty_reset(struct ipc_ept *ep, uint32_t frame_len)
+{
+#if defined(CONFIG_APP_FFT_HOP_LEN) && (CONFIG_APP_FFT_HOP_LEN < CONFIG_APP_FFT_FRAME_LEN)
+	uint32_t hop = CONFIG_APP_FFT_HOP_LEN;
+#else
+	uint32_t hop = frame_len;
+#endif
+
+	/* Once per setup, the only multiplication on this path. */
+	duty_budget = ((uint64_t)hop * (CYCLE_COUNTER_HZ / CONFIG_APP_FFT_SAMPLE_RATE))
+		      << CONFIG_APP_FFT_DUTY_CYCLE_SHIFT;
+	duty_busy = 0;
+	duty_frames = 0;
+	duty_dropped = duty_dropped_get();
+
+	return (duty_mhz != DUTY_MHZ_FULL) ? duty_request(ep, DUTY_MHZ_FULL) : 0;
+}
+
+/*
+ * Add the cycles of one frame and, every DUTY_FRAMES frames, pick the
+ * clock. The cycles of a frame hardly change with the clock, but half the
+ * clock leaves half of them between two frames: down when the frames would
+ * take at most 3/4 of that, up again above 7/8 or when anything was
+ * dropped, in between the clock stays. The thresholds are fractions of
+ * a budget in 64 bits, taken by shifts.
+ */
+static int duty_account(struct ipc_ept *ep, uint32_t busy)
+{
+	uint16_t mhz = duty_mhz;
+	uint64_t busy_half;
+	uint32_t dropped;
+
+	duty_busy += busy;
+	if (++duty_frames < DUTY_FRAMES) {
+		return 0;
+	}
+
+	busy_half = duty_busy << 1;
+	dropped = duty_dropped_get();
+
+	if (dropped != duty_dropped) {
+		mhz = DUTY_MHZ_FULL;
+	} else if (busy_half <= duty_budget - (duty_budget >> 2)) {
+		mhz = DUTY_MHZ_HALF;
+	} else if (busy_half > duty_budget - (duty_budget >> 3)) {
+		mhz = DUTY_MHZ_FULL;
+	}
+
+	duty_dropped = dropped;
+
+	if (mhz != duty_mhz) {
+		int ret = duty_request(ep, mhz);
+
+		if (ret < 0) {
+			return ret;
+		}
+	}
+
+	duty_busy = 0;
+	duty_frames = 0;
+
+	return 0;
+}
+#endif /* CONFIG_APP_FFT_DUTY_CYCLE */
+
+#if defined(CONFIG_APP_FFT_SHED)
+BUILD_ASSERT(CYCLE_COUNTER_HZ % CONFIG_APP_FFT_SAMPLE_RATE == 0,
+	     "APP_FFT_SAMPLE_RATE must divide the FLPR clock");
+
+/* Decisions of the level, the analysis is switched here. */
+static struct fft_shed shed;
+static uint32_t shed_seq;
+/* Window of the setup, put back below FFT_SHED_RECT. */
+static fft_window_type_t shed_window;
+static q15_t *shed_table;
+#if defined(SHED_HALF)
+/* Context of the newest half of a frame, with the window and peaks of the full one. */
+static fft_context_t shed_ctx;
+static q15_t *shed_half_table;
+#endif
+
+/*
+ * Find the levels frames of frame_len can use, and set up the context of
+ * the half length if there is one. Part of stream_setup(), the buffers
+ * come from the arena before the frames.
+ */
+static int shed_setup(uint32_t frame_len, fft_window_type_t window, q15_t *table)
+{
+	shed_window = window;
+	shed_table = table;
+	shed.usable = BIT(FFT_SHED_NONE) | BIT(FFT_SHED_TOP_K) | BIT(FFT_SHED_DECIMATE);
+
+	if (window != FFT_WINDOW_RECT) {
+		shed.usable |= BIT(FFT_SHED_RECT);
+	}
+
+#if defined(SHED_HALF)
+	if (RFFT_Q15_HAS_LEN(frame_len / 2)) {
+		spectral_peak_t *peaks;
+
+		peaks = FFT_ARENA_ALLOC_ARRAY(&stream_arena, spectral_peak_t,
+					      CONFIG_APP_FFT_TOP_BINS);
+		if (fft_context_init(&shed_ctx, frame_len / 2, NULL, peaks,
+				     CONFIG_APP_FFT_TOP_BINS) != RFFT_SUCCESS) {
+			return -ENOMEM;
+		}
+
+		shed_half_table = NULL;
+		if (window != FFT_WINDOW_RECT && fft_window_table(window, frame_len / 2) == NULL) {
+			shed_half_table = FFT_ARENA_ALLOC_ARRAY(&stream_arena, q15_t,
+								FFT_WINDOW_TABLE_LEN(frame_len / 2));
+			if (shed_half_table == NULL) {
+				return -ENOMEM;
+			}
+		}
+
+		if (fft_context_set_window(&shed_ctx, window, shed_half_table) != RFFT_SUCCESS) {
+			return -EINVAL;
+		}
+
+#if CONFIG_APP_FFT_PEAK_SPACING > 0
+		/* The same spacing in Hz, in bins of twice the width. */
+		(void)fft_context_set_peaks(&shed_ctx, (CONFIG_APP_FFT_PEAK_SPACING + 1) / 2,
+					    CONFIG_APP_FFT_PEAK_HARMONICS);
+#endif
+#if defined(CONFIG_APP_FFT_STATS)
+		(void)fft_context_set_stats(&shed_ctx, &stream_stats);
+#endif
+
+		shed.usable |= BIT(FFT_SHED_HALF);
+	}
+#else
+	ARG_UNUSED(frame_len);
+#endif
+
+	return 0;
+}
+
+static int shed_report(struct ipc_ept *ep, uint8_t level)
+{
+	struct fft_shed_msg msg = {
+		.hdr = { .type = FFT_STREAM_MSG_SHED, .count = level, .seq = shed_seq++ },
+		.busy = (uint32_t)(shed.busy >> CONFIG_APP_FFT_SHED_SHIFT),
+		.budget = (uint32_t)(shed.budget >> CONFIG_APP_FFT_SHED_SHIFT),
+	};
+	int ret;
+
+	ret = send_wait(ctrl_plane(ep), &msg, sizeof(msg));
+
+	if (ret < 0) {
+		printk("send_message(shed %u) failed with ret %d\n", level, ret);
+		return ret;
+	}
+
+	return 0;
+}
+
+/*
+ * Switch the window of the contexts where level crosses FFT_SHED_RECT,
+ * then move to level and start the next decision.
+ */
+static void shed_set_level(uint8_t level)
+{
+	bool rect = (level >= FFT_SHED_RECT) && ((shed.usable & BIT(FFT_SHED_RECT)) != 0);
+
+	if (rect != fft_shed_has(&shed, FFT_SHED_RECT)) {
+		/* Once per move, a table not generated is computed again on the way back. */
+		(void)fft_context_set_window(&stream_ctx, rect ? FFT_WINDOW_RECT : shed_window,
+					     shed_table);
+#if defined(SHED_HALF)
+		if ((shed.usable & BIT(FFT_SHED_HALF)) != 0) {
+			(void)fft_context_set_window(&shed_ctx,
+						     rect ? FFT_WINDOW_RECT : shed_window,
+						     shed_half_table);
+		}
+#endif
+	}
+
+	fft_shed_commit(&shed, level);
+}
+
+static uint32_t shed_missed_get(void)
+{
+	struct fft_stream_stats st;
+
+	fft_stream_get_stats(&st);
+
+	return st.late_frames + st.dropped_blocks + st.dropped_frames;
+}
+
+/*
+ * Start the decisions over for frames of frame_len samples, at the full
+ * analysis: a new setup has the window and top bins it asked for.
+ */
+static int shed_reset(struct ipc_ept *ep, uint32_t frame_len)
+{
+#if defined(CONFIG_APP_FFT_HOP_LEN) && (CONFIG_APP_FFT_HOP_LEN < CONFIG_APP_FFT_FRAME_LEN)
+	uint32_t hop = CONFIG_APP_FFT_HOP_LEN;
+#else
+	uint32_t hop = frame_len;
+#endif
+	uint8_t level = shed.level;
+
+	/* The contexts were set up afresh, nothing to undo. */
+	fft_shed_reset(&shed, (uint64_t)hop * (CYCLE_COUNTER_HZ / CONFIG_APP_FFT_SAMPLE_RATE),
+		       CONFIG_APP_FFT_SHED_SHIFT, shed_missed_get());
+
+	return (level != FFT_SHED_NONE) ? shed_report(ep, FFT_SHED_NONE) : 0;
+}
+
+/* Add the cycles of one frame and, once per decision, move as fft_shed_decide() picks. */
+static int shed_account(struct ipc_ept *ep, uint32_t busy)
+{
+	uint8_t level;
+	int ret;
+
+	if (!fft_shed_add(&shed, busy)) {
+		return 0;
+	}
+
+	level = fft_shed_decide(&shed, shed_missed_get());
+	if (level != shed.level) {
+		ret = shed_report(ep, level);
+		if (ret < 0) {
+			return ret;
+		}
+	}
+	shed_set_level(level);
+
+	return 0;
+}
+
+/* Top bins of a frame at the current level, bins numbered for the full length. */
+static rfft_status_t shed_top_bins(struct fft_frame *frame, uint16_t *bins, uint16_t top_k)
+{
+#if defined(SHED_HALF)
+	fft_context_t *half = &shed_ctx;
+#else
+	fft_context_t *half = NULL;
+#endif
+
+	return fft_shed_top_bins(&shed, &stream_ctx, half, frame->samples, bins, top_k);
+}
+#endif /* CONFIG_APP_FFT_SHED */
+
+#if defined(CONFIG_APP_FFT_COOP)
+/* Longest wait for the application core's half, a frame period is longer. */
+#define COOP_TIMEOUT K_MSEC(100)
+
+static int coop_send(void *ep, const struct fft_coop_msg *msg)
+{
+	return send_wait(ep, msg, sizeof(*msg));
+}
+
+/*
+ * fft_cfft_fn of the stream context: split the CFFT of a frame in the pool,
+ * send the second half to the application core and run the first here in
+ * the meantime. If the application core does not take its half in time,
+ * the request is withdrawn, and once the application core has answered,
+ * so no longer touches the half, it is done here if it was not done there.
+ */
+static void coop_cfft(const arm_cfft_instance_q15 *cfft, q15_t *buffer, void *user)
+{
+	const arm_cfft_instance_q15 half = {
+		.fftLen = cfft->fftLen >> 1,
+		.pTwiddle = cfft->pTwiddle,
+	};
+	/* fftLen / 2 complex points, fftLen values. */
+	q15_t *upper = buffer + cfft->fftLen;
+	struct fft_coop_msg msg = {
+		.hdr = {
+			.type = FFT_STREAM_MSG_COOP,
+			.count = half.fftLen,
+		},
+		.offset = (uint32_t)((uintptr_t)upper - FFT_POOL_ADDR),
+	};
+	size_t len = cfft->fftLen * sizeof(q15_t);
+	int ret;
+
+	/* The halves of the shortest lengths are no CFFT of the library. */
+	if (half.fftLen < RFFT_Q15_MIN_FFT_LEN / 2) {
+		arm_cfft_q15(cfft, buffer, 0, 0);
+		return;
+	}
+
+	arm_cfft_q15_split(cfft, buffer);
+
+	fft_cache_flush(upper, len);
+	/* First, so a late answer to an earlier half no longer matches. */
+	msg.hdr.seq = (uint32_t)atomic_inc(&coop_seq) + 1;
+	k_sem_reset(&coop_sem);
+	atomic_set(&coop_done, COOP_NONE);
+
+	ret = coop_send(user, &msg);
+
+	arm_cfft_q15_half(&half, buffer);
+
+	if (ret < 0) {
+		/* Never handed over, the half is this core's alone. */
+		arm_cfft_q15_half(&half, upper);
+		return;
+	}
+
+	if (k_sem_take(&coop_sem, COOP_TIMEOUT) != 0) {
+		/*
+		 * The application core may be transforming the half right now.
+		 * Withdraw it and wait for the answer, which comes once it is
+		 * done or was never started; the application core feeds the
+		 * frames, so it answers as long as there are any.
+		 */
+		msg.hdr.count = 0;
+		(void)coop_send(user, &msg);
+		(void)k_sem_take(&coop_sem, K_FOREVER);
+	}
+
+	/* The other answer after a withdrawal is stale from here on. */
+	atomic_inc(&coop_seq);
+
+	if (atomic_get(&coop_done) == COOP_DONE) {
+		fft_cache_invd(upper, len);
+		return;
+	}
+
+	arm_cfft_q15_half(&half, upper);
+}
+#endif /* CONFIG_APP_FFT_COOP */
+
+#if defined(CONFIG_APP_FFT_RETRANSMIT)
+/* Endpoint of the stream, for the requests of the receive path. */
+static struct ipc_ept *gap_ep;
+
+/*
+ * Ask the application core once for the blocks of a gap, at most the
+ * window it keeps. Without room the request is lost, and the frames wait
+ * for nothing until the window has passed.
+ */
+static void stream_gap(uint32_t first_seq, uint32_t count)
+{
+	struct fft_stream_hdr req = {
+		.type = FFT_STREAM_MSG_NACK,
+		.count = MIN(count, CONFIG_APP_FFT_RETRANSMIT_WINDOW),
+		.seq = first_seq + count - MIN(count, CONFIG_APP_FFT_RETRANSMIT_WINDOW),
+	};
+
+	(void)ipc_service_send(ctrl_plane(gap_ep), &req, sizeof(req));
+}
+#endif
+
+/*
+ * Partition the arena, the analysis buffers first and the frame buffers of
+ * the assembler in what is left, and set up the analysis and the assembler
+ * for frames of frame_len samples. Nothing may be using the old partition.
+ */
+static int stream_setup(struct ipc_ept *ep, uint32_t frame_len, fft_window_type_t window)
+{
+	spectral_peak_t *peaks;
+#if !defined(CONFIG_APP_FFT_PIPELINE)
+	q15_t *table = NULL;
+#endif
+#if defined(CONFIG_APP_FFT_STOCKHAM)
+	q15_t *stockham;
+#endif
+	rfft_status_t status;
+	int ret;
+
+	fft_arena_reset(&stream_arena);
+
+	/* Frames are analysed in place, the context needs no work buffer. */
+	peaks = FFT_ARENA_ALLOC_ARRAY(&stream_arena, spectral_peak_t, CONFIG_APP_FFT_TOP_BINS);
+	status = fft_context_init(&stream_ctx, frame_len, NULL, peaks, CONFIG_APP_FFT_TOP_BINS);
+	if (status != RFFT_SUCCESS) {
+		printk("fft_context_init(%u) failed with status: %d\n", frame_len, status);
+		return -EINVAL;
+	}
+
+#if !defined(CONFIG_APP_FFT_PIPELINE)
+	/* Applied to each frame in place, right before its FFT. */
+	if (window != FFT_WINDOW_RECT && fft_window_table(window, frame_len) == NULL) {
+		table = FFT_ARENA_ALLOC_ARRAY(&stream_arena, q15_t, FFT_WINDOW_TABLE_LEN(frame_len));
+		if (table == NULL) {
+			return -ENOMEM;
+		}
+	}
+
+	if (fft_context_set_window(&stream_ctx, window, table) != RFFT_SUCCESS) {
+		return -EINVAL;
+	}
+#endif
+
+#if CONFIG_APP_FFT_PEAK_SPACING > 0
+	/* Distinct tones in the results, as for find_fft_top_bins(). */
+	(void)fft_context_set_peaks(&stream_ctx, CONFIG_APP_FFT_PEAK_SPACING,
+				    CONFIG_APP_FFT_PEAK_HARMONICS);
+#endif
+
+#if defined(CONFIG_APP_FFT_SHED)
+	/* The context of the half length, with the analysis buffers. */
+	ret = shed_setup(frame_len, window, table);
+	if (ret < 0) {
+		return ret;
+	}
+#endif
+
+#if defined(CONFIG_APP_FFT_PSD)
+	/* Averaged from the RFFT pass of the top bins, no extra transform. */
+	if (spectral_psd_init(&stream_psd,
+			      FFT_ARENA_ALLOC_ARRAY(&stream_arena, uint32_t,
+						    SPECTRAL_PSD_STORAGE_LEN(PSD_NUM_BINS(frame_len))),
+			      PSD_NUM_BINS(frame_len), PSD_MODE,
+			      CONFIG_APP_FFT_PSD_AVG_SHIFT) != RFFT_SUCCESS) {
+		return -ENOMEM;
+	}
+	(void)fft_context_set_psd(&stream_ctx, &stream_psd);
+#if defined(CONFIG_APP_FFT_PRIO)
+	/* A readout under way was of the old length, it is given up. */
+	psd_xfer.active = false;
+#endif
+#endif
+
+#if defined(CONFIG_APP_FFT_FLOOR)
+	/* Estimated in the RFFT pass of the top bins, a new length starts over. */
+	if (spectral_floor_init(&stream_floor,
+				FFT_ARENA_ALLOC_ARRAY(&stream_arena, uint32_t,
+						      STREAM_FLOOR_BLOCKS(frame_len)),
+				frame_len / 2 + 1, CONFIG_APP_FFT_FLOOR_BLOCK_SHIFT,
+				CONFIG_APP_FFT_FLOOR_MARGIN_SHIFT) != RFFT_SUCCESS) {
+		return -ENOMEM;
+	}
+	(void)fft_context_set_floor(&stream_ctx, &stream_floor);
+#endif
+
+#if defined(CONFIG_APP_FFT_STOCKHAM)
+	/* The CFFT ping-pongs between the frame and this buffer. */
+	stockham = FFT_ARENA_ALLOC_ARRAY(&stream_arena, q15_t, frame_len);
+	if (stockham == NULL) {
+		return -ENOMEM;
+	}
+	(void)fft_context_set_stockham_buffer(&stream_ctx, stockham);
+#endif
+
+#if defined(CONFIG_APP_FFT_INPUT_Q7)
+	/* Before the frame buffers, which get whatever is left. */
+	stream_input = FFT_ARENA_ALLOC_ARRAY(&stream_arena, q15_t, frame_len);
+	if (stream_input == NULL) {
+		return -ENOMEM;
+	}
+#endif
+
+#if defined(CONFIG_APP_FFT_COOP)
+	/* Half of each transform on the application core. */
+	(void)fft_context_set_cfft(&stream_ctx, coop_cfft, ep);
+#endif
+
+#if defined(CONFIG_APP_FFT_EVENTS)
+	/* The baselines start over with the average. */
+	event_band.first_bin = CONFIG_APP_FFT_EVENT_BAND_FIRST_BIN;
+	event_band.last_bin = MIN(CONFIG_APP_FFT_EVENT_BAND_LAST_BIN, frame_len / 2);
+	event_band_baseline = 0;
+	event_cause = 0;
+	(void)fft_context_set_bands(&stream_ctx, &event_band,
+				    ((event_band.last_bin != 0) &&
+				     (event_band.first_bin <= event_band.last_bin)) ? 1 : 0);
+#endif
+
+#if defined(CONFIG_APP_FFT_BANDS)
+	/* Summed in the RFFT pass of the top bins, a new length starts over. */
+	bands_reset(frame_len);
+#endif
+
+#if defined(CONFIG_APP_FFT_MEL)
+	/* Fed from the RFFT pass of the top bins, laid out again for a new length. */
+	ret = mel_setup(frame_len);
+	if (ret < 0) {
+		return ret;
+	}
+#endif
+
+#if defined(CONFIG_APP_FFT_SPECTROGRAM)
+	/* Pooled in the RFFT pass of the top bins, of the frames due only. */
+	ret = gram_setup(frame_len);
+	if (ret < 0) {
+		return ret;
+	}
+#endif
+
+#if defined(CONFIG_APP_FFT_ENVELOPE)
+	/* Every stage in place in the frame, the arena holds nothing for it. */
+	ret = envelope_setup(frame_len);
+	if (ret < 0) {
+		return ret;
+	}
+#endif
+
+#if defined(CONFIG_APP_FFT_ORDER)
+	/* The analysis sees only the resampled frames. */
+	ret = order_setup(frame_len);
+	if (ret < 0) {
+		return ret;
+	}
+#endif
+
+#if defined(CONFIG_APP_FFT_STATS)
+	/* Summed in the pass that windows each frame, before the window. */
+	(void)fft_context_set_stats(&stream_ctx, &stream_stats);
+#endif
+
+#if defined(CONFIG_APP_FFT_TRACK)
+	/* The bins of another length are not those of the set. */
+	track_setup();
+#endif
+
+#if defined(CONFIG_APP_FFT_PIPELINE)
+	/* In place of the window, bands and average set above, the chain's own. */
+#if defined(CONFIG_APP_FFT_PSD)
+	stream_pipe.psd = &stream_psd;
+#endif
+	ret = fft_pipeline_build(&stream_pipe, &stream_ctx, &stream_arena, stream_stages,
+				 stream_num_stages);
+	if (ret < 0) {
+		printk("fft_pipeline_build(%u stages) failed (%d)\n", stream_num_stages, ret);
+		return ret;
+	}
+	window = stream_ctx.window_type;
+#endif
+
+	ret = fft_stream_init(ep, &stream_arena, frame_len);
+	if (ret < 0) {
+		printk("fft_stream_init(%u) failure (%d)\n", frame_len, ret);
+		return ret;
+	}
+
+#if defined(CONFIG_APP_FFT_RETRANSMIT)
+	gap_ep = ep;
+	fft_stream_set_gap_cb(stream_gap);
+#endif
+
+	stream_frame_len = frame_len;
+	stream_window = window;
+
+#if defined(CONFIG_APP_FFT_DUTY_CYCLE)
+	ret = duty_reset(ep, frame_len);
+	if (ret < 0) {
+		return ret;
+	}
+#endif
+
+#if defined(CONFIG_APP_FFT_SHED)
+	ret = shed_reset(ep, frame_len);
+	if (ret < 0) {
+		return ret;
+	}
+#endif
+
+	printk("FFT arena: %u of %u bytes used\n", (unsigned int)stream_arena.used,
+	       (unsigned int)stream_arena.size);
+
+	return 0;
+}
+
+#if defined(CONFIG_APP_FFT_STORE)
+/*
+ * State of the analysis after the header of the store image, followed by
+ * psd_bins bins of the average. The plans are constant tables and
+ * stream_setup() computes the window table from the frame length, so only
+ * the configuration they follow from is kept.
+ */
+struct store_state {
+	uint16_t frame_len;
+	uint16_t window;
+	uint16_t top_k;
+	uint16_t psd_frames;
+	uint32_t psd_bins;
+	uint32_t floor;
+	uint32_t threshold;
+	uint64_t band_baseline;
+};
+
+#define STORE_INTERVAL_MS ((int64_t)CONFIG_APP_FFT_STORE_INTERVAL_S * MSEC_PER_SEC)
+
+/* Options the layout and meaning of the state depend on, hashed into the key. */
+static const uint32_t store_build[] = {
+	sizeof(struct store_state),
+	CONFIG_APP_FFT_FRAME_LEN,
+	CONFIG_APP_FFT_TOP_BINS,
+#if defined(CONFIG_APP_FFT_PSD)
+	PSD_MODE,
+	CONFIG_APP_FFT_PSD_AVG_SHIFT,
+#endif
+#if defined(CONFIG_APP_FFT_FLOOR)
+	CONFIG_APP_FFT_FLOOR_BLOCK_SHIFT,
+	CONFIG_APP_FFT_FLOOR_MARGIN_SHIFT,
+#endif
+#if defined(CONFIG_APP_FFT_EVENTS)
+	CONFIG_APP_FFT_EVENT_BAND_FIRST_BIN,
+	CONFIG_APP_FFT_EVENT_BAND_LAST_BIN,
+#endif
+	IS_ENABLED(CONFIG_APP_FFT_PSD) | (IS_ENABLED(CONFIG_APP_FFT_FLOOR) << 1) |
+	(IS_ENABLED(CONFIG_APP_FFT_EVENTS) << 2) | (IS_ENABLED(CONFIG_APP_FFT_RECONFIG) << 3),
+};
+
+static uint32_t store_key(void)
+{
+	return crc32_ieee((const uint8_t *)store_build, sizeof(store_build));
+}
+
+static bool store_valid(const struct fft_store_hdr *hdr)
+{
+	if ((hdr->magic != FFT_STORE_MAGIC) || (hdr->key != store_key()) ||
+	    (hdr->len < sizeof(struct store_state)) ||
+	    (hdr->len > FFT_STORE_SIZE - sizeof(*hdr))) {
+		return false;
+	}
+
+	return crc32_ieee((const uint8_t *)(hdr + 1), hdr->len) == hdr->crc;
+}
+
+/*
+ * Set the stream up as the image in the fft_store region left it, with
+ * the learned state copied back, or as built without a valid image.
+ */
+static int store_load(struct ipc_ept *ep)
+{
+	const struct fft_store_hdr *hdr = fft_store_image();
+	struct store_state state;
+	int ret;
+
+	if (!store_valid(hdr)) {
+		printk("FFT store: no state, learning from scratch\n");
+		return stream_setup(ep, CONFIG_APP_FFT_FRAME_LEN, STREAM_WINDOW);
+	}
+
+	memcpy(&state, hdr + 1, sizeof(state));
+
+	ret = stream_setup(ep, state.frame_len, (fft_window_type_t)state.window);
+	if (ret < 0) {
+		printk("FFT store: %u-point frames not set up, learning from scratch\n",
+		       state.frame_len);
+		return stream_setup(ep, CONFIG_APP_FFT_FRAME_LEN, STREAM_WINDOW);
+	}
+
+	if ((state.top_k != 0) && (state.top_k <= CONFIG_APP_FFT_TOP_BINS)) {
+		stream_top_k = state.top_k;
+#if defined(CONFIG_APP_FFT_TRACK)
+		track_setup();
+#endif
+	}
+
+#if defined(CONFIG_APP_FFT_PSD)
+	/* The average in one copy, complete from the first frame on. */
+	if ((state.psd_bins == stream_psd.num_bins) &&
+	    (hdr->len == sizeof(state) + state.psd_bins * sizeof(uint32_t))) {
+		memcpy(stream_psd.acc, (const uint8_t *)(hdr + 1) + sizeof(state),
+		       state.psd_bins * sizeof(uint32_t));
+		stream_psd.frames = state.psd_frames;
+	}
+#endif
+
+#if defined(CONFIG_APP_FFT_FLOOR)
+	stream_floor.floor = state.floor;
+	stream_floor.threshold = state.threshold;
+#endif
+
+#if defined(CONFIG_APP_FFT_EVENTS)
+	event_band_baseline = state.band_baseline;
+#endif
+
+	printk("FFT store: %u bytes of state restored %u us after reset\n", hdr->len,
+	       read_cycle_us());
+
+	return 0;
+}
+
+/* Only a complete average is worth the next start. */
+static bool store_warm(void)
+{
+#if defined(CONFIG_APP_FFT_PSD)
+	return spectral_psd_complete(&stream_psd);
+#else
+	return true;
+#endif
+}
+
+/*
+ * Copy n bytes of the image from offset on: the header, the state and the
+ * bins of the average, read where they are. Past the end, the write block
+ * is padded as erased RRAM.
+ */
+static void store_copy(uint8_t *dst, uint32_t offset, uint32_t n, const struct fft_store_hdr *hdr,
+		       const struct store_state *state)
+{
+	const struct {
+		const void *data;
+		uint32_t len;
+	} parts[] = {
+		{ hdr, sizeof(*hdr) },
+		{ state, sizeof(*state) },
+#if defined(CONFIG_APP_FFT_PSD)
+		{ stream_psd.acc, state->psd_bins * sizeof(uint32_t) },
+#endif
+	};
+
+	for (size_t i = 0; (i < ARRAY_SIZE(parts)) && (n > 0); i++) {
+		uint32_t m;
+
+		if (offset >= parts[i].len) {
+			offset -= parts[i].len;
+			continue;
+		}
+
+		m = MIN(n, parts[i].len - offset);
+		memcpy(dst, (const uint8_t *)parts[i].data + offset, m);
+		dst += m;
+		n -= m;
+		offset = 0;
+	}
+
+	memset(dst, 0xff, n);
+}
+
+static int store_send(struct ipc_ept *ep, uint32_t seq, uint32_t offset, uint32_t n,
+		      const struct fft_store_hdr *hdr, const struct store_state *state)
+{
+	static struct fft_store_msg msg;
+	int ret;
+
+	msg.hdr.type = FFT_STREAM_MSG_STORE;
+	msg.hdr.count = n;
+	msg.hdr.seq = seq;
+	msg.offset = offset;
+	store_copy(msg.data, offset, n, hdr, state);
+
+	ret = send_wait(ep, &msg, FFT_STORE_MSG_SIZE(n));
+
+	if (ret < 0) {
+		printk("send_message(store %u) failed with ret %d\n", seq, ret);
+		return ret;
+	}
+
+	return 0;
+}
+
+/*
+ * Send the image of the state for the application core to write into the
+ * region, in chunks of whole write blocks, the one with the header last.
+ * Nothing changes the state in between, the frames wait for the loop.
+ */
+static int store_save(struct ipc_ept *ep, uint32_t seq)
+{
+	struct store_state state = {
+		.frame_len = stream_frame_len,
+		.window = stream_window,
+		.top_k = stream_top_k,
+	};
+	struct fft_store_hdr hdr = {
+		.magic = FFT_STORE_MAGIC,
+		.key = store_key(),
+	};
+	uint32_t total;
+	int ret;
+
+#if defined(CONFIG_APP_FFT_PSD)
+	state.psd_frames = stream_psd.frames;
+	state.psd_bins = stream_psd.num_bins;
+#endif
+#if defined(CONFIG_APP_FFT_FLOOR)
+	state.floor = stream_floor.floor;
+	state.threshold = stream_floor.threshold;
+#endif
+#if defined(CONFIG_APP_FFT_EVENTS)
+	state.band_baseline = event_band_baseline;
+#endif
+
+	hdr.len = sizeof(state) + state.psd_bins * sizeof(uint32_t);
+	total = ROUND_UP(sizeof(hdr) + hdr.len, FFT_STORE_ALIGN);
+	if (total > FFT_STORE_SIZE) {
+		printk("FFT store: %u bytes of state do not fit the region\n", hdr.len);
+		return 0;
+	}
+
+	hdr.crc = crc32_ieee((const uint8_t *)&state, sizeof(state));
+#if defined(CONFIG_APP_FFT_PSD)
+	hdr.crc = crc32_ieee_update(hdr.crc, (const uint8_t *)stream_psd.acc,
+				    state.psd_bins * sizeof(uint32_t));
+#endif
+
+	for (uint32_t offset = FFT_STORE_MSG_MAX; offset < total; offset += FFT_STORE_MSG_MAX) {
+		ret = store_send(ep, seq, offset, MIN(total - offset, FFT_STORE_MSG_MAX), &hdr,
+				 &state);
+		if (ret < 0) {
+			return ret;
+		}
+	}
+
+	return store_send(ep, seq, 0, MIN(total, FFT_STORE_MSG_MAX), &hdr, &state);
+}
+#endif /* CONFIG_APP_FFT_STORE */
+
+#if defined(CONFIG_APP_FFT_CTRL)
+static int ctrl_send(struct ipc_ept *ep, const void *msg, size_t len)
+{
+	const struct fft_ctrl_msg *ctrl = msg;
+	int ret;
+
+	ret = send_wait(ctrl_plane(ep), msg, len);
+
+	if (ret < 0) {
+		printk("send_message(ctrl %u) failed with ret %d\n", ctrl->id, ret);
+		return ret;
+	}
+
+	return 0;
+}
+
+/* Response to any command, the largest one that carries more than the command. */
+union ctrl_reply {
+	struct fft_ctrl_msg ctrl;
+	struct fft_ctrl_stats_msg stats;
+#if defined(CONFIG_APP_FFT_PERF)
+	struct fft_ctrl_perf_msg perf;
+#endif
+};
+
+#if defined(CONFIG_APP_FFT_PERF)
+/* Read the counters out, and start them over if asked to. */
+static void perf_read(struct fft_ctrl_perf_msg *msg, bool restart)
+{
+	struct fft_stream_stats st;
+
+	fft_stream_get_stats(&st);
+	msg->frames = perf.frames;
+	msg->overruns = st.overruns;
+	msg->ipc_retries = atomic_get(&perf.ipc_retries);
+	msg->queue_high_water = MIN(st.queue_high_water, UINT16_MAX);
+	msg->reserved = 0;
+	msg->arena_high_water = stream_arena.peak;
+	msg->arena_size = stream_arena.size;
+
+	for (uint32_t i = 0; i < FFT_PERF_NUM_STAGES; i++) {
+		/* The only 64-bit division, once per query. */
+		msg->stage[i].avg_cycles = (perf.frames != 0) ? perf.cycles[i] / perf.frames : 0;
+		msg->stage[i].max_cycles = perf.max_cycles[i];
+	}
+
+	if (restart) {
+		perf.frames = 0;
+		memset(perf.cycles, 0, sizeof(perf.cycles));
+		memset(perf.max_cycles, 0, sizeof(perf.max_cycles));
+		atomic_clear(&perf.ipc_retries);
+		stream_arena.peak = stream_arena.used;
+	}
+}
+#endif
+
+/* Carry out a command accepted on arrival, return the size of its response. */
+static size_t ctrl_apply(union ctrl_reply *reply)
+{
+	struct fft_ctrl_msg *cmd = &reply->ctrl;
+	struct fft_stream_stats st;
+
+	switch (cmd->cmd) {
+	case FFT_CTRL_START:
+	case FFT_CTRL_STOP:
+		/* Applied in the receive path. */
+		break;
+	case FFT_CTRL_GET_STATS:
+		fft_stream_get_stats(&st);
+		reply->stats.blocks = st.blocks;
+		reply->stats.frames = st.frames;
+		reply->stats.lost_blocks = st.lost_blocks;
+		reply->stats.dropped_blocks = st.dropped_blocks;
+		reply->stats.dropped_frames = st.dropped_frames;
+		reply->stats.bad_blocks = st.bad_blocks;
+		reply->stats.overruns = st.overruns;
+		reply->stats.late_frames = st.late_frames;
+		return sizeof(reply->stats);
+#if defined(CONFIG_APP_FFT_PERF)
+	case FFT_CTRL_GET_PERF:
+		perf_read(&reply->perf, cmd->arg[0] == 1);
+		return sizeof(reply->perf);
+#else
+	case FFT_CTRL_GET_PERF:
+		cmd->status = -ENOTSUP;
+		break;
+#endif
+	case FFT_CTRL_RUN_BENCH:
+#if defined(CONFIG_APP_FFT_BENCH)
+		/* On the analysis thread, the frames wait and the blocks find no buffer. */
+		fft_bench_run("on", true);
+#else
+		cmd->status = -ENOTSUP;
+#endif
+		break;
+	case FFT_CTRL_REQUEST_PSD:
+#if defined(CONFIG_APP_FFT_PSD)
+		/* Sent after the next result, as for FFT_STREAM_MSG_PSD_REQUEST. */
+		atomic_set(&psd_requested, 1);
+#else
+		cmd->status = -ENOTSUP;
+#endif
+		break;
+	case FFT_CTRL_SET_TOP_K:
+		if ((cmd->arg[0] == 0) || (cmd->arg[0] > CONFIG_APP_FFT_TOP_BINS)) {
+			cmd->status = -EINVAL;
+		} else {
+			stream_top_k = cmd->arg[0];
+#if defined(CONFIG_APP_FFT_TRACK)
+			track_setup();
+#endif
+		}
+		cmd->arg[0] = stream_top_k;
+		break;
+#if defined(CONFIG_APP_FFT_BANDS)
+	case FFT_CTRL_SET_BAND: {
+		uint32_t first = cmd->arg[1] & 0xffff;
+		uint32_t last = cmd->arg[1] >> 16;
+
+		if ((cmd->arg[0] > stream_num_bands) || (cmd->arg[0] >= CONFIG_APP_FFT_BANDS_MAX) ||
+		    ((first <= last) && (last > stream_frame_len / 2))) {
+			cmd->status = -EINVAL;
+		} else if (first > last) {
+			stream_num_bands = cmd->arg[0];
+		} else {
+			stream_bands[cmd->arg[0]].first_bin = first;
+			stream_bands[cmd->arg[0]].last_bin = last;
+			stream_num_bands = MAX(stream_num_bands, cmd->arg[0] + 1);
+		}
+
+		/* Between two frames, the next one already uses it. */
+		(void)fft_context_set_band_table(&stream_ctx, stream_bands, stream_num_bands,
+						 stream_band_edges);
+		cmd->arg[0] = stream_num_bands;
+		break;
+	}
+#else
+	case FFT_CTRL_SET_BAND:
+		cmd->status = -ENOTSUP;
+		break;
+#endif
+	default:
+		cmd->status = -EINVAL;
+		break;
+	}
+
+	return sizeof(*cmd);
+}
+
+/* Answer the commands that arrived, between two frames. */
+static int ctrl_process(struct ipc_ept *ep)
+{
+	union ctrl_reply reply;
+	size_t len;
+	int ret;
+
+	while (k_msgq_get(&ctrl_queue, &reply.ctrl, K_NO_WAIT) == 0) {
+		len = sizeof(reply.ctrl);
+		if (reply.ctrl.status == 0) {
+			len = ctrl_apply(&reply);
+		}
+
+		reply.ctrl.cmd |= FFT_CTRL_RESPONSE;
+
+		ret = ctrl_send(ep, &reply, len);
+		if (ret < 0) {
+			return ret;
+		}
+	}
+
+	return 0;
+}
+#endif /* CONFIG_APP_FFT_CTRL */
+
+#if defined(CONFIG_APP_FFT_RECONFIG)
+BUILD_ASSERT((FFT_STREAM_WINDOW_RECT == FFT_WINDOW_RECT) &&
+	     (FFT_STREAM_WINDOW_HANN == FFT_WINDOW_HANN) &&
+	     (FFT_STREAM_WINDOW_HAMMING == FFT_WINDOW_HAMMING) &&
+	     (FFT_STREAM_WINDOW_BLACKMAN == FFT_WINDOW_BLACKMAN),
+	     "FFT_STREAM_WINDOW_* must match fft_window_type_t");
+
+/*
+ * Set the stream up again as requested, once it is suspended and this
+ * thread holds no frame, or as before if the request does not fit, and
+ * confirm the frame length and window in effect.
+ */
+static int stream_reconfig(struct ipc_ept *ep)
+{
+	struct fft_config_msg reply = config_request;
+	fft_window_type_t window = stream_window;
+	int ret;
+
+	if (reply.window != FFT_STREAM_WINDOW_KEEP) {
+		window = (fft_window_type_t)reply.window;
+	}
+
+	reply.status = stream_setup(ep, reply.hdr.count, window);
+	if (reply.status < 0) {
+		/* It fit before, only the request can fail. */
+		ret = stream_setup(ep, stream_frame_len, stream_window);
+		if (ret < 0) {
+			return ret;
+		}
+	}
+
+	reply.hdr.count = stream_frame_len;
+	reply.window = stream_window;
+
+#if defined(CONFIG_APP_FFT_CTRL)
+	if (config_ctrl.type == FFT_STREAM_MSG_CTRL) {
+		struct fft_ctrl_msg ctrl = config_ctrl;
+
+		ctrl.cmd |= FFT_CTRL_RESPONSE;
+		ctrl.status = reply.status;
+		ctrl.arg[0] = stream_frame_len;
+		ctrl.arg[1] = stream_window;
+		atomic_clear(&config_busy);
+
+		return ctrl_send(ep, &ctrl, sizeof(ctrl));
+	}
+#endif
+
+	atomic_clear(&config_busy);
+
+	ret = send_wait(ctrl_plane(ep), &reply, sizeof(reply));
+
+	if (ret < 0) {
+		printk("send_message(config %u) failed with ret %d\n", reply.hdr.seq, ret);
+		return ret;
+	}
+
+	return 0;
+}
+
+#if defined(CONFIG_APP_FFT_PIPELINE)
+/*
+ * Build the chain of the request the same way, or the previous one again
+ * if the request does not fit, and confirm the chain in effect.
+ */
+static int pipeline_reconfig(struct ipc_ept *ep)
+{
+	struct fft_pipeline_msg reply = pipeline_request;
+	struct fft_stage stages[FFT_PIPELINE_MAX_STAGES];
+	uint16_t num_stages = stream_num_stages;
+	int ret;
+
+	pipeline_pending = false;
+	memcpy(stages, stream_stages, sizeof(stages));
+
+	if (reply.hdr.count <= FFT_PIPELINE_MAX_STAGES) {
+		memcpy(stream_stages, reply.stages, sizeof(stream_stages));
+		stream_num_stages = reply.hdr.count;
+	}
+
+	reply.status = (reply.hdr.count <= FFT_PIPELINE_MAX_STAGES) ?
+		       stream_setup(ep, stream_frame_len, stream_window) : -EINVAL;
+	if (reply.status < 0) {
+		memcpy(stream_stages, stages, sizeof(stream_stages));
+		stream_num_stages = num_stages;
+		ret = stream_setup(ep, stream_frame_len, stream_window);
+		if (ret < 0) {
+			return ret;
+		}
+	}
+
+	reply.hdr.count = stream_pipe.num_stages;
+	memcpy(reply.stages, stream_pipe.stages, sizeof(reply.stages));
+	atomic_clear(&config_busy);
+
+	ret = send_wait(ctrl_plane(ep), &reply, sizeof(reply));
+
+	if (ret < 0) {
+		printk("send_message(pipeline %u) failed with ret %d\n", reply.hdr.seq, ret);
+		return ret;
+	}
+
+	return 0;
+}
+#endif
+#endif /* CONFIG_APP_FFT_RECONFIG */
+
+#if defined(CONFIG_APP_FFT_EVENTS)
+/*
+ * Compare the frame just analysed with its baselines, and send an event if
+ * it crossed a threshold the frame before did not, or the other way round.
+ * Until the average holds 2^APP_FFT_PSD_AVG_SHIFT frames it is only learnt.
+ */
+static int send_event(struct ipc_ept *ep, const struct fft_result_msg *result)
+{
+	static struct fft_event_msg msg;
+	const spectral_peak_t *peaks = stream_ctx.top_bins;
+	bool warm = spectral_psd_complete(&stream_psd);
+	uint64_t energy = event_band.energy;
+	uint32_t count = result->hdr.count;
+	uint8_t cause = 0;
+	int ret;
+
+	if (count == 0) {
+		/* Not analysed, neither an event nor a baseline. */
+		return 0;
+	}
+
+	/* Places of bin 0 hold no peak, below the noise floor, and come last. */
+	while ((count > 0) && (result->bins[count - 1] == 0)) {
+		count--;
+	}
+
+	msg.peak_bin = 0;
+	msg.peak = 0;
+	msg.peak_baseline = 0;
+
+	/* Strongest first, the first one above its baseline is reported. */
+	for (uint32_t i = 0; warm && (i < count); i++) {
+		uint32_t level = MIN(peaks[i].magnitude_squared, 0x7fffffffU);
+		uint32_t base = MAX(stream_psd.acc[peaks[i].bin_index], 1);
+
+		if (level > ((uint64_t)base << CONFIG_APP_FFT_EVENT_PEAK_SHIFT)) {
+			cause |= FFT_EVENT_PEAK;
+			msg.peak_bin = peaks[i].bin_index;
+			msg.peak = level;
+			msg.peak_baseline = base;
+			break;
+		}
+	}
+
+	if (stream_ctx.num_bands != 0) {
+		if (warm &&
+		    (energy > (MAX(event_band_baseline, 1) << CONFIG_APP_FFT_EVENT_BAND_SHIFT))) {
+			cause |= FFT_EVENT_BAND;
+		}
+
+		/* The time constant of the average, set by the first frame. */
+		if (stream_psd.frames <= 1) {
+			event_band_baseline = energy;
+		} else {
+			event_band_baseline += (int64_t)(energy - event_band_baseline) >>
+					       CONFIG_APP_FFT_PSD_AVG_SHIFT;
+		}
+	}
+
+	if (cause == event_cause) {
+		return 0;
+	}
+	event_cause = cause;
+
+	msg.hdr.type = FFT_STREAM_MSG_EVENT;
+	msg.hdr.count = count;
+	msg.hdr.seq = result->hdr.seq;
+	msg.cause = cause;
+	msg.band_energy = MIN(energy, UINT32_MAX);
+	msg.band_baseline = MIN(event_band_baseline, UINT32_MAX);
+	memcpy(msg.bins, result->bins, count * sizeof(msg.bins[0]));
+
+	ret = send_wait(ctrl_plane(ep), &msg, FFT_EVENT_MSG_SIZE(count));
+
+	if (ret < 0) {
+		printk("send_message(event %u) failed with ret %d\n", msg.hdr.seq, ret);
+		return ret;
+	}
+
+	return 0;
+}
+#endif /* CONFIG_APP_FFT_EVENTS */
+
+#if defined(CONFIG_APP_FFT_BANDS) || defined(CONFIG_APP_FFT_PIPELINE)
+/* Send the band energies of the frame just analysed, in place of its result or before it. */
+static int send_bands(struct ipc_ept *ep, const struct fft_result_msg *result,
+		      rfft_status_t status)
+{
+	static struct fft_bands_msg msg;
+	int ret;
+
+	msg.hdr = result->hdr;
+	msg.hdr.type = FFT_STREAM_MSG_BANDS;
+	msg.hdr.count = (status == RFFT_SUCCESS) ? stream_ctx.num_bands : 0;
+
+	for (uint32_t i = 0; i < msg.hdr.count; i++) {
+		msg.energy[i] = MIN(stream_ctx.bands[i].energy, UINT32_MAX);
+	}
+
+	ret = send_wait(ep, &msg, FFT_BANDS_MSG_SIZE(msg.hdr.count));
+
+	if (ret < 0) {
+		printk("send_message(bands %u) failed with ret %d\n", msg.hdr.seq, ret);
+		return ret;
+	}
+
+	return 0;
+}
+#endif /* CONFIG_APP_FFT_BANDS || CONFIG_APP_FFT_PIPELINE */
+
+#if defined(CONFIG_APP_FFT_MEL)
+/* Send the filterbank features of the frame just analysed, in place of its result. */
+static int send_features(struct ipc_ept *ep, const struct fft_result_msg *result)
+{
+	static struct fft_features_msg msg;
+#if !defined(CONFIG_APP_FFT_MEL_OUTPUT_LINEAR)
+	static int16_t logs[CONFIG_APP_FFT_MEL_FILTERS];
+#endif
+#if defined(CONFIG_APP_FFT_MEL_OUTPUT_MFCC)
+	static int16_t coeffs[CONFIG_APP_FFT_MEL_MFCC_COEFFS];
+#endif
+	int ret;
+
+	msg.hdr = result->hdr;
+	msg.hdr.type = FFT_STREAM_MSG_FEATURES;
+	msg.hdr.count = 0;
+
+	if (result->hdr.count != 0) {
+#if defined(CONFIG_APP_FFT_MEL_OUTPUT_LINEAR)
+		for (uint32_t i = 0; i < CONFIG_APP_FFT_MEL_FILTERS; i++) {
+			msg.features[i] = MIN(stream_mel.energy[i], INT32_MAX);
+		}
+		msg.hdr.count = CONFIG_APP_FFT_MEL_FILTERS;
+#else
+		/* The frames are transformed at a scaling of 1 / stream_frame_len. */
+		spectral_mel_log2(&stream_mel, logs, __builtin_ctz(stream_frame_len));
+#if defined(CONFIG_APP_FFT_MEL_OUTPUT_MFCC)
+		spectral_mel_dct(&stream_mel, logs, coeffs);
+		for (uint32_t i = 0; i < CONFIG_APP_FFT_MEL_MFCC_COEFFS; i++) {
+			msg.features[i] = coeffs[i];
+		}
+		msg.hdr.count = CONFIG_APP_FFT_MEL_MFCC_COEFFS;
+#else
+		for (uint32_t i = 0; i < CONFIG_APP_FFT_MEL_FILTERS; i++) {
+			msg.features[i] = logs[i];
+		}
+		msg.hdr.count = CONFIG_APP_FFT_MEL_FILTERS;
+#endif
+#endif
+	}
+
+	ret = send_wait(ep, &msg, FFT_FEATURES_MSG_SIZE(msg.hdr.count));
+
+	if (ret < 0) {
+		printk("send_message(features %u) failed with ret %d\n", msg.hdr.seq, ret);
+		return ret;
+	}
+
+	return 0;
+}
+#endif /* CONFIG_APP_FFT_MEL */
+
+#if defined(CONFIG_APP_FFT_TRACK)
+/* Send what the frame just analysed changed of the tracked top bins, instead of its result. */
+static int send_track(struct ipc_ept *ep, const struct fft_result_msg *result)
+{
+	static struct fft_track_msg msg;
+	int ret;
+
+	if ((result->hdr.count == 0) ||
+	    ((stream_track.num_changes == 0) && !track_restart)) {
+		/* Not analysed, or nothing to tell. */
+		return 0;
+	}
+
+	msg.hdr = result->hdr;
+	msg.hdr.type = FFT_STREAM_MSG_TRACK;
+	msg.hdr.slot = track_restart ? FFT_TRACK_RESTART : 0;
+	msg.hdr.count = stream_track.num_changes;
+
+	for (uint32_t i = 0; i < msg.hdr.count; i++) {
+		msg.change[i].op = stream_track.changes[i].op;
+		msg.change[i].place = stream_track.changes[i].id;
+		msg.change[i].bin = stream_track.changes[i].bin_index;
+	}
+
+	ret = send_wait(ep, &msg, FFT_TRACK_MSG_SIZE(msg.hdr.count));
+
+	if (ret < 0) {
+		printk("send_message(track %u) failed with ret %d\n", msg.hdr.seq, ret);
+		return ret;
+	}
+
+	track_restart = false;
+
+	return 0;
+}
+#endif /* CONFIG_APP_FFT_TRACK */
+
+#if defined(CONFIG_APP_FFT_PSD) && defined(CONFIG_APP_FFT_PRIO)
+/*
+ * Send the next APP_FFT_PRIO_BULK_CHUNKS chunks of the readout, starting
+ * one if asked to. A chunk without room waits for the next frame, so the
+ * messages of that frame go first. The average is detached from the
+ * context until the last chunk is out, so every chunk of a readout holds
+ * the same frames; a linear one then starts over.
+ */
+static int psd_resume(struct ipc_ept *ep)
+{
+	int ret;
+
+	if (!psd_xfer.active) {
+		if (!atomic_cas(&psd_requested, 1, 0)) {
+			return 0;
+		}
+		psd_xfer.next_bin = 0;
+		psd_xfer.active = true;
+		psd_xfer.fed = stream_ctx.psd;
+		(void)fft_context_set_psd(&stream_ctx, NULL);
+	}
+
+	for (uint32_t i = 0; i < CONFIG_APP_FFT_PRIO_BULK_CHUNKS; i++) {
+		ret = send_psd_chunk(ep, &stream_psd, psd_xfer.seq, psd_xfer.next_bin, false);
+		if (ret == -ENOMEM) {
+			return 0;
+		} else if (ret < 0) {
+			return ret;
+		}
+
+		psd_xfer.next_bin += ret;
+		if (psd_xfer.next_bin >= stream_psd.num_bins) {
+			psd_xfer.active = false;
+			psd_xfer.seq++;
+			if (stream_psd.mode == SPECTRAL_PSD_LINEAR) {
+				spectral_psd_reset(&stream_psd);
+			}
+			(void)fft_context_set_psd(&stream_ctx, psd_xfer.fed);
+			break;
+		}
+	}
+
+	return 0;
+}
+#endif
+
+#if !defined(CONFIG_APP_FFT_EVENTS) && !defined(CONFIG_APP_FFT_BANDS) && \
+	!defined(CONFIG_APP_FFT_MEL) && !defined(CONFIG_APP_FFT_TRACK)
+/* Send the top bins of the frame just analysed. */
+static int send_result(struct ipc_ept *ep, struct fft_result_msg *result)
+{
+	int ret;
+
+#if defined(CONFIG_APP_FFT_LATENCY)
+	result->times.send = read_cycle_us();
+#endif
+
+	ret = send_wait(ep, result, sizeof(*result));
+
+	if (ret < 0) {
+		printk("send_message(%u) failed with ret %d\n", result->hdr.seq, ret);
+		return ret;
+	}
+
+	return 0;
+}
+#endif
+
+/* Analyse every frame assembled from the sample stream and send back its top bins. */
+static int stream_loop(struct ipc_ept *ep)
+{
+	static struct fft_result_msg result;
+#if defined(CONFIG_APP_FFT_PSD) && !defined(CONFIG_APP_FFT_PRIO)
+	uint32_t psd_seq = 0;
+#endif
+#if defined(RFFT_Q15_PROFILE)
+	int64_t profile_due = k_uptime_get() + MSEC_PER_SEC;
+	uint32_t profile_seq = 0;
+#endif
+#if defined(CONFIG_APP_FFT_DUTY_CYCLE) || defined(CONFIG_APP_FFT_SHED)
+	uint32_t frame_start;
+#endif
+#if defined(CONFIG_APP_FFT_PERF)
+	uint32_t perf_start;
+#endif
+#if defined(CONFIG_APP_FFT_SPECTROGRAM)
+	bool gram_row;
+#endif
+	uint16_t top_k;
+#if defined(CONFIG_APP_FFT_STORE)
+	int64_t store_due = k_uptime_get() + STORE_INTERVAL_MS;
+	uint32_t store_seq = 0;
+#endif
+	struct fft_frame *frame;
+	rfft_status_t status;
+	int ret;
+
+	while (true) {
+#if defined(CONFIG_APP_FFT_RECONFIG)
+		if (fft_stream_suspended()) {
+#if defined(CONFIG_APP_FFT_PIPELINE)
+			ret = pipeline_pending ? pipeline_reconfig(ep) : stream_reconfig(ep);
+#else
+			ret = stream_reconfig(ep);
+#endif
+			if (ret < 0) {
+				return ret;
+			}
+		}
+#endif
+
+#if defined(CONFIG_APP_FFT_CTRL)
+		ret = ctrl_process(ep);
+		if (ret < 0) {
+			return ret;
+		}
+#endif
+
+#if defined(CONFIG_APP_FFT_ORDER)
+		ret = order_get_frame(&frame, K_FOREVER);
+#else
+		ret = fft_stream_get_frame(&frame, K_FOREVER);
+#endif
+		if (ret < 0) {
+			/* Woken by fft_stream_suspend() or fft_stream_wake(). */
+			continue;
+		}
+
+#if defined(CONFIG_APP_FFT_DUTY_CYCLE) || defined(CONFIG_APP_FFT_SHED)
+		frame_start = read_cycle();
+#endif
+
+#if defined(CONFIG_APP_FFT_LATENCY)
+		result.times.last_seq = frame->last_seq;
+		result.times.recv = frame->recv_us;
+		result.times.fft_start = read_cycle_us();
+#endif
+
+#if defined(CONFIG_APP_FFT_SHED)
+		top_k = fft_shed_top_k(&shed, frame->seq, stream_top_k);
+#elif defined(CONFIG_APP_FFT_PIPELINE)
+		top_k = fft_pipeline_top_k(&stream_pipe, stream_top_k);
+#else
+		top_k = stream_top_k;
+#endif
+
+#if defined(CONFIG_APP_FFT_SPECTROGRAM)
+		/* A frame shed altogether pools no row. */
+		gram_row = (top_k != 0) && gram_next_frame();
+#endif
+
+#if defined(CONFIG_APP_FFT_PERF)
+		perf_start = read_cycle();
+#endif
+
+#if defined(CONFIG_APP_FFT_SHED)
+		status = shed_top_bins(frame, result.bins, top_k);
+#elif defined(CONFIG_APP_FFT_PIPELINE)
+		status = fft_pipeline_run(&stream_pipe, frame->samples, result.bins, top_k);
+#elif defined(CONFIG_APP_FFT_INPUT_Q7)
+		/* Widened as it is windowed, the window is not applied again. */
+		fft_context_load_q7(&stream_ctx, stream_input, frame->samples);
+		fft_context_execute_loaded(&stream_ctx, stream_input, result.bins, top_k);
+		status = RFFT_SUCCESS;
+#else
+		status = fft_context_top_bins_inplace(&stream_ctx, frame->samples,
+						      result.bins, top_k);
+#endif
+
+#if defined(CONFIG_APP_FFT_PERF)
+		perf_stage(FFT_PERF_STAGE_ANALYSIS, perf_start);
+#endif
+
+#if defined(CONFIG_APP_FFT_LATENCY)
+		result.times.fft_end = read_cycle_us();
+#endif
+
+#if defined(CONFIG_APP_FFT_STATS)
+		stats_read(&result.stats);
+#endif
+
+		result.hdr.type = FFT_STREAM_MSG_RESULT;
+		result.hdr.slot = frame->slot;
+		result.hdr.count = top_k;
+		result.hdr.seq = frame->seq;
+
+#if defined(CONFIG_APP_FFT_ORDER)
+		order_release_frame(frame);
+#else
+		fft_stream_release_frame(frame);
+#endif
+
+		if (status != RFFT_SUCCESS) {
+			printk("fft_context_top_bins_inplace() failed with status: %d\n",
+			       status);
+			/* Still reply, the result returns the frame pool slot. */
+			result.hdr.count = 0;
+		}
+
+#if defined(CONFIG_APP_FFT_PERF)
+		perf_start = read_cycle();
+#endif
+
+#if defined(CONFIG_APP_FFT_EVENTS)
+		/* The application core only hears of changes. */
+		ret = send_event(ep, &result);
+		if (ret < 0) {
+			return ret;
+		}
+#elif defined(CONFIG_APP_FFT_BANDS)
+		/* Only the band vector crosses IPC. */
+		ret = send_bands(ep, &result, status);
+		if (ret < 0) {
+			return ret;
+		}
+#elif defined(CONFIG_APP_FFT_MEL)
+		/* Only the feature vector crosses IPC. */
+		ret = send_features(ep, &result);
+		if (ret < 0) {
+			return ret;
+		}
+#elif defined(CONFIG_APP_FFT_TRACK)
+		/* Only the places that changed cross IPC. */
+		ret = send_track(ep, &result);
+		if (ret < 0) {
+			return ret;
+		}
+#elif defined(CONFIG_APP_FFT_PIPELINE)
+		/* Only what the chain sends crosses IPC, the band energies first. */
+		if (stream_pipe.outputs & FFT_PIPELINE_OUT_BANDS) {
+			ret = send_bands(ep, &result, status);
+			if (ret < 0) {
+				return ret;
+			}
+		}
+		if (stream_pipe.outputs & FFT_PIPELINE_OUT_RESULT) {
+			ret = send_result(ep, &result);
+			if (ret < 0) {
+				return ret;
+			}
+		}
+#else
+		ret = send_result(ep, &result);
+		if (ret < 0) {
+			return ret;
+		}
+#endif /* Events, bands, features or track changes instead of the result */
+
+#if defined(CONFIG_APP_FFT_PERF)
+		perf_stage(FFT_PERF_STAGE_SEND, perf_start);
+		perf.frames++;
+#endif
+
+#if defined(CONFIG_APP_FFT_PSD) && defined(CONFIG_APP_FFT_PRIO)
+		/* Bulk after the messages of the frame, a few chunks at a time. */
+		ret = psd_resume(ep);
+		if (ret < 0) {
+			return ret;
+		}
+#elif defined(CONFIG_APP_FFT_PSD)
+		if (atomic_cas(&psd_requested, 1, 0)) {
+			ret = send_psd(ep, &stream_psd, psd_seq++);
+			if (ret < 0) {
+				return ret;
+			}
+		}
+#endif
+
+#if defined(CONFIG_APP_FFT_SPECTROGRAM)
+		if (gram_row && (status == RFFT_SUCCESS)) {
+			ret = send_spectrogram(ep, result.hdr.seq);
+			if (ret < 0) {
+				return ret;
+			}
+		}
+#endif
+
+#if defined(CONFIG_APP_FFT_LATENCY)
+		if (atomic_cas(&sync_requested, 1, 0)) {
+			ret = send_sync(ep);
+			if (ret < 0) {
+				return ret;
+			}
+		}
+#endif
+
+#if defined(CONFIG_APP_FFT_STORE)
+		if ((k_uptime_get() >= store_due) && store_warm()) {
+			store_due = k_uptime_get() + STORE_INTERVAL_MS;
+			ret = store_save(ep, store_seq++);
+			if (ret < 0) {
+				return ret;
+			}
+		}
+#endif
+
+#if defined(RFFT_Q15_PROFILE)
+		if (k_uptime_get() >= profile_due) {
+			profile_due += MSEC_PER_SEC;
+			ret = send_profile(ep, profile_seq++);
+			if (ret < 0) {
+				return ret;
+			}
+		}
+#endif
+
+#if defined(CONFIG_APP_FFT_DUTY_CYCLE)
+		/* Up to the wait for the next frame, in the idle thread. */
+		ret = duty_account(ep, read_cycle() - frame_start);
+		if (ret < 0) {
+			return ret;
+		}
+#elif defined(CONFIG_APP_FFT_SHED)
+		/* Up to the wait for the next frame, as for the clock. */
+		ret = shed_account(ep, read_cycle() - frame_start);
+		if (ret < 0) {
+			return ret;
+		}
+#endif
+	}
+
+	return 0;
+}
+
+#if defined(CONFIG_APP_FFT_WORKER)
+/* Control messages must get through while a frame is in the FFT. */
+BUILD_ASSERT(CONFIG_APP_FFT_WORKER_PRIORITY > CONFIG_MAIN_THREAD_PRIORITY,
+	     "APP_FFT_WORKER_PRIORITY must be below the main thread");
+
+K_THREAD_STACK_DEFINE(fft_worker_stack, CONFIG_APP_FFT_WORKER_STACK_SIZE);
+static struct k_thread fft_worker_thread;
+
+static void fft_worker(void *arg1, void *arg2, void *arg3)
+{
+	ARG_UNUSED(arg2);
+	ARG_UNUSED(arg3);
+
+	int ret = stream_loop(arg1);
+
+	printk("FFT worker stopped with ret %d\n", ret);
+}
+
+/*
+ * Leave the FFT to the worker and tell the application core to pause its
+ * sample blocks while the frame queue is full, and to resume once a frame
+ * is released. The main thread outranks the worker, so the notice goes out
+ * while the FFT that holds the frames is still running.
+ */
+static int flow_loop(struct ipc_ept *ep)
+{
+	struct fft_stream_hdr msg = {
+		.type = FFT_STREAM_MSG_FLOW,
+	};
+	bool paused;
+	int ret;
+
+	(void)k_thread_create(&fft_worker_thread, fft_worker_stack,
+			      K_THREAD_STACK_SIZEOF(fft_worker_stack), fft_worker, ep,
+			      NULL, NULL, CONFIG_APP_FFT_WORKER_PRIORITY, 0, K_NO_WAIT);
+	k_thread_name_set(&fft_worker_thread, "fft_worker");
+
+	while (true) {
+		(void)fft_stream_wait_flow(&paused, K_FOREVER);
+
+		msg.count = paused ? 1 : 0;
+
+		ret = send_wait(ctrl_plane(ep), &msg, sizeof(msg));
+
+		if (ret < 0) {
+			printk("send_message(flow %u) failed with ret %d\n", msg.seq, ret);
+			return ret;
+		}
+
+		msg.seq++;
+	}
+
+	return 0;
+}
+#endif /* CONFIG_APP_FFT_WORKER */
+#endif /* CONFIG_APP_FFT_STREAM */
+
+#if defined(CONFIG_APP_IPC_BATCH)
+/* Send the test payload as records packed into batched transfers. */
+static int batch_loop(struct ipc_ept *ep)
+{
+	static uint8_t batch_buf[CONFIG_APP_IPC_BATCH_SIZE] __aligned(IPC_BATCH_ALIGN);
+	static struct ipc_batch batch;
+	uint32_t retries = 0;
+	int ret;
+
+	ret = ipc_batch_init(&batch, ep, batch_buf, sizeof(batch_buf),
+			     CONFIG_APP_IPC_BATCH_FLUSH_THRESHOLD,
+			     K_USEC(CONFIG_APP_IPC_BATCH_TIMEOUT_US));
+	if (ret < 0) {
+		printk("ipc_batch_init() failure (%d)\n", ret);
+		return ret;
+	}
+
+	while (true) {
+		ret = ipc_batch_add(&batch, p_payload, CONFIG_APP_IPC_SERVICE_MESSAGE_LEN);
+		if (ret == -ENOMEM) {
+			/* Transport full. Sleep instead of spinning until it drains. */
+			retries++;
+			k_sleep(K_TICKS(1));
+			continue;
+		} else if (ret < 0) {
+			printk("send_message(%ld) failed with ret %d\n", p_payload->cnt, ret);
+			return ret;
+		}
+
+#if defined(CONFIG_APP_IPC_TRACE)
+		/* Records waiting in the batch. */
+		ipc_trace_record(IPC_TRACE_TX, CONFIG_APP_IPC_SERVICE_MESSAGE_LEN, retries,
+				 (batch.used - sizeof(struct ipc_batch_hdr)) /
+				 IPC_BATCH_RECORD_SIZE(CONFIG_APP_IPC_SERVICE_MESSAGE_LEN));
+#endif
+		retries = 0;
+
+		p_payload->cnt++;
+	}
+
+	return 0;
+}
+#endif /* CONFIG_APP_IPC_BATCH */
+
+#if defined(CONFIG_APP_IPC_CREDIT)
+/* Send the test payload as fast as the receiver hands back credits. */
+static int credit_loop(void)
+{
+	static uint8_t msg[sizeof(struct ipc_credit_hdr) + CONFIG_APP_IPC_SERVICE_MESSAGE_LEN]
+		__aligned(4);
+	uint32_t retries = 0;
+	int ret;
+
+	while (true) {
+		memcpy(&msg[sizeof(struct ipc_credit_hdr)], p_payload,
+		       CONFIG_APP_IPC_SERVICE_MESSAGE_LEN);
+
+		ret = ipc_credit_send(&credit_fc, msg, sizeof(msg), K_FOREVER);
+		if (ret == -ENOMEM) {
+			/* Window larger than the backend buffers. */
+			retries++;
+			k_sleep(K_TICKS(1));
+			continue;
+		} else if (ret < 0) {
+			printk("send_message(%ld) failed with ret %d\n", p_payload->cnt, ret);
+			return ret;
+		}
+
+#if defined(CONFIG_APP_IPC_TRACE)
+		/* Messages in flight, the credits spent. */
+		ipc_trace_record(IPC_TRACE_TX, CONFIG_APP_IPC_SERVICE_MESSAGE_LEN, retries,
+				 CONFIG_APP_IPC_CREDIT_WINDOW - k_sem_count_get(&credit_fc.credits));
+#endif
+		retries = 0;
+
+		p_payload->cnt++;
+	}
+
+	return 0;
+}
+#endif /* CONFIG_APP_IPC_CREDIT */
+
+int main(void)
+{
+	const struct device *ipc0_instance;
+	struct ipc_ept ep;
+	int ret;
+#if defined(CONFIG_APP_FFT_SELFTEST)
+	uint32_t cycles;
+#endif
+
+	memset(p_payload->data, 0xA5, sizeof(p_payload->data));
+
+	p_payload->size = CONFIG_APP_IPC_SERVICE_MESSAGE_LEN;
+	p_payload->cnt = 0;
+
+	printk("Remote IPC-service %s demo started\n", CONFIG_BOARD_TARGET);
+
+	/* Off out of reset on the Cortex-M cores, every FFT is timed on it. */
+	cycle_counter_init();
+
+#if defined(CONFIG_APP_FFT_SELFTEST)
+	/* Before any frame reaches the kernels. */
+	ret = fft_selftest_run(&cycles);
+	if (ret < 0) {
+		printk("✗ FFT self-test failed (%d)\n", ret);
+		return ret;
+	}
+	printk("FFT self-test passed in %u cycles\n", cycles);
+#endif
+
+#if defined(CONFIG_APP_IPC_TRACE)
+	ipc_trace_init();
+#endif
+
+#if defined(CONFIG_APP_FFT_STORE)
+	/* Warm from the image of the last run, before the first block arrives. */
+	ret = store_load(&ep);
+	if (ret < 0) {
+		return ret;
+	}
+#elif defined(CONFIG_APP_FFT_STREAM)
+	ret = stream_setup(&ep, CONFIG_APP_FFT_FRAME_LEN, STREAM_WINDOW);
+	if (ret < 0) {
+		return ret;
+	}
+#elif defined(CONFIG_APP_FFT_BENCH)
+	/* Before IPC is up, nothing interrupts the FFT. */
+	fft_bench_run("off", true);
+#elif defined(CONFIG_APP_FFT_RECORD)
+	/* Before IPC is up, the averages go out on the console. */
+	(void)fft_record_run();
+#elif defined(CONFIG_APP_FFT_BOOT_PERF)
+#if RFFT_Q15_HAS_LEN(4096)
+	// 性能測試 4096 點 FFT
+	test_fft_performance();
+#if defined(CONFIG_APP_FFT_ASYNC)
+	test_fft_async();
+#endif
+#endif
+
+#if RFFT_Q15_HAS_LEN(8192)
+	// 性能測試 8192 點 FFT
+	test_fft_8192_performance();
+#endif
+#endif /* CONFIG_APP_FFT_STREAM */
+
+	ipc0_instance = DEVICE_DT_GET(DT_NODELABEL(ipc0));
+
+#if defined(CONFIG_IPC_SERVICE_BACKEND_ICBMSG)
+	/* Wait a bit for the remote core to boot. */
+	k_msleep(100);
+#endif
+
+	ret = ipc_service_open_instance(ipc0_instance);
+	if ((ret < 0) && (ret != -EALREADY)) {
+		LOG_INF("ipc_service_open_instance() failure (%d)", ret);
+		return ret;
+	}
+
+#if defined(CONFIG_APP_IPC_SWEEP)
+	/* Messages of the sweep may arrive as soon as the endpoint is registered. */
+	ipc_sweep_init(&sweep, &ep);
+#endif
+
+#if defined(CONFIG_APP_IPC_BENCH)
+	/* Pings may arrive as soon as the endpoint is registered. */
+	ret = ipc_bench_init(&bench, &ep, bench_buf, false);
+	if (ret < 0) {
+		printk("ipc_bench_init() failure (%d)\n", ret);
+		return ret;
+	}
+#endif
+
+#if defined(CONFIG_APP_IPC_CREDIT)
+	/* Credits may arrive as soon as the endpoint is registered. */
+	ret = ipc_credit_init(&credit_fc, &ep, CONFIG_APP_IPC_CREDIT_WINDOW);
+	if (ret < 0) {
+		printk("ipc_credit_init() failure (%d)\n", ret);
+		return ret;
+	}
+#endif
+
+	ret = ipc_service_register_endpoint(ipc0_instance, &ep, &ep_cfg);
+	if (ret < 0) {
+		printf("ipc_service_register_endpoint() failure (%d)", ret);
+		return ret;
+	}
+
+#if defined(CONFIG_APP_FFT_CTRL_PLANE)
+	ret = ctrl_plane_open();
+	if (ret < 0) {
+		return ret;
+	}
+#endif
+
+	for (int i = 0; i < NUM_ENDPOINTS; i++) {
+		k_sem_take(&bound_sem, K_FOREVER);
+	}
+
+#if defined(CONFIG_APP_FFT_SHM_RING)
+	ret = ring_start();
+	if (ret < 0) {
+		printk("Sample ring setup failure (%d)\n", ret);
+		return ret;
+	}
+#endif
+
+#if defined(CONFIG_APP_IPC_BENCH)
+	ret = ipc_bench_start(&bench);
+	if (ret < 0) {
+		printk("ipc_bench_start() failure (%d)\n", ret);
+		return ret;
+	}
+#endif
+
+#if defined(CONFIG_APP_FFT_BENCH_IPC)
+	/* Again while the application core's messages arrive. */
+	fft_bench_run("on", false);
+#endif
+
+#if !defined(CONFIG_APP_IPC_SWEEP) && !defined(CONFIG_APP_IPC_BENCH)
+	/* The sweep and the benchmark print their own steps. */
+	k_thread_start(thread_check_id);
+#endif
+
+#if defined(CONFIG_APP_FFT_WORKER)
+	return flow_loop(&ep);
+#elif defined(CONFIG_APP_FFT_STREAM)
+	return stream_loop(&ep);
+#elif defined(CONFIG_APP_IPC_BATCH)
+	return batch_loop(&ep);
+#elif defined(CONFIG_APP_IPC_CREDIT)
+	return credit_loop();
+#elif defined(CONFIG_APP_IPC_SWEEP)
+	/* Only receives and reports, the application core runs the sweep. */
+	return 0;
+#elif defined(CONFIG_APP_IPC_BENCH)
+	/* Only answers, from the receive callback and the doorbell. */
+	return 0;
+#else
+	uint32_t retries = 0;
+
+	while (true) {
+		ret = ipc_service_send(&ep, p_payload, CONFIG_APP_IPC_SERVICE_MESSAGE_LEN);
+		if (ret == -ENOMEM) {
+			/* No space in the buffer. Retry. */
+			retries++;
+			continue;
+		} else if (ret < 0) {
+			printk("send_message(%ld) failed with ret %d\n", p_payload->cnt, ret);
+			break;
+		}
+
+#if defined(CONFIG_APP_IPC_TRACE)
+		ipc_trace_record(IPC_TRACE_TX, CONFIG_APP_IPC_SERVICE_MESSAGE_LEN, retries, 0);
+#endif
+		retries = 0;
+
 		p_payload->cnt++;
 
 
@@ -343,4 +3614,5 @@ int main(void)
 	}
 
 	return 0;
+#endif /* CONFIG_APP_FFT_STREAM */
 }
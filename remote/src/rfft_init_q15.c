@@ -13,92 +13,253 @@
 
 #include "rfft_q15_simplified.h"
 #include <stddef.h>
+#include <string.h>
 
-/* Static CFFT instances for internal use */
-static const arm_cfft_instance_q15 arm_cfft_sR_q15_len2048 = {
-    2048,
-    twiddleCoef_2048_q15,
-    armBitRevIndexTable_fixed_2048,
-    ARMBITREVINDEXTABLE_FIXED_2048_TABLE_LENGTH
-};
+/*
+ * CFFT instance of an fftLen-point complex FFT. Without the DSP extension
+ * or with RFFT_Q15_NO_BITREV_TABLES the bit reversal is computed, see
+ * arm_cfft_q15_out() and arm_bitreversal_q15_notable().
+ */
+#if defined (ARM_MATH_DSP) && !defined(RFFT_Q15_NO_BITREV_TABLES)
+#define RFFT_Q15_CFFT_INSTANCE(fftLen)                      \
+    {                                                       \
+        fftLen,                                             \
+        RFFT_TWIDDLE_DATA,                                  \
+        armBitRevIndexTable_fixed_##fftLen,                 \
+        ARMBITREVINDEXTABLE_FIXED_##fftLen##_TABLE_LENGTH   \
+    }
+#else
+#define RFFT_Q15_CFFT_INSTANCE(fftLen)                      \
+    {                                                       \
+        fftLen,                                             \
+        RFFT_TWIDDLE_DATA,                                  \
+        NULL,                                               \
+        0                                                   \
+    }
+#endif
 
-#ifdef ENABLE_FFT_8K
-static const arm_cfft_instance_q15 arm_cfft_sR_q15_len4096 = {
-    4096,
-    twiddleCoef_4096_q15,
-    armBitRevIndexTable_fixed_4096,
-    ARMBITREVINDEXTABLE_FIXED_4096_TABLE_LENGTH
-};
+/* Split coefficients of a length, RFFT_Q15_SPLIT_TABLES */
+#if defined(RFFT_Q15_SPLIT_TABLES)
+#define RFFT_Q15_SPLIT(len)  rfftSplitQ15_##len
+#else
+#define RFFT_Q15_SPLIT(len)  NULL
+#endif
+
+/* Forward RFFT instance of an fftLenReal-point real FFT */
+#define RFFT_Q15_INSTANCE(len, cfft, split)                              \
+    {                                                                    \
+        .fftLenReal = (len),               /* Real FFT length */         \
+        .ifftFlagR = 0U,                   /* Forward transform */       \
+        .bitReverseFlagR = 1U,             /* Natural order output */    \
+        .twidCoefRModifier = RFFT_TWIDDLE_STRIDE(len),                   \
+        .pTwiddleAReal = RFFT_TWIDDLE_DATA, /* A and B derived from it */ \
+        .pTwiddleBReal = (split),                                        \
+        .pCfft = &(cfft),                                                \
+    }
+
+#if defined(RFFT_Q15_LAZY_TWIDDLES) || defined(RFFT_Q15_RUNTIME_TWIDDLES)
+q15_t rfft_q15_twiddle_ram[RFFT_TWIDDLE_TABLE_ENTRIES] RFFT_Q15_ALIGN;
+static uint8_t rfft_q15_twiddles_loaded;
 #endif
 
 /**
- * @brief Initialize RFFT instance for 4096-point FFT.
- * @param[out] S  Pointer to RFFT instance structure
- * @return Status code
+ * @brief Fill the SRAM twiddle table of the prebuilt instances on first use.
  */
-rfft_status_t rfft_q15_init_4096(arm_rfft_instance_q15 *S)
+void rfft_q15_twiddles_init(void)
 {
-    if (S == NULL) {
-        return RFFT_ERROR_NULL_POINTER;
+#if defined(RFFT_Q15_LAZY_TWIDDLES) || defined(RFFT_Q15_RUNTIME_TWIDDLES)
+    if (rfft_q15_twiddles_loaded == 0U) {
+#if defined(RFFT_Q15_RUNTIME_TWIDDLES)
+        rfft_q15_twiddles_generate(rfft_q15_twiddle_ram);
+#else
+        memcpy(rfft_q15_twiddle_ram, RFFT_TWIDDLE_TABLE, sizeof(rfft_q15_twiddle_ram));
+#endif
+        rfft_q15_twiddles_loaded = 1U;
     }
+#endif
+}
 
-    /* Initialize the Real FFT length */
-    S->fftLenReal = 4096U;
+#if RFFT_Q15_HAS_LEN(32)
+static const arm_cfft_instance_q15 arm_cfft_sR_q15_len16 = RFFT_Q15_CFFT_INSTANCE(16);
 
-    /* Initialize the Twiddle coefficient modifier */
-    S->twidCoefRModifier = 2U;
+/** @brief Forward RFFT instance for 32-point FFT. */
+const arm_rfft_instance_q15 arm_rfft_sR_q15_len32 =
+    RFFT_Q15_INSTANCE(32U, arm_cfft_sR_q15_len16, RFFT_Q15_SPLIT(32));
+#endif
 
-    /* Initialize the Flag for selection of RFFT or RIFFT */
-    S->ifftFlagR = 0U;
+#if RFFT_Q15_HAS_LEN(64)
+static const arm_cfft_instance_q15 arm_cfft_sR_q15_len32 = RFFT_Q15_CFFT_INSTANCE(32);
 
-    /* Initialize the Flag for calculation Bit reversal or not */
-    S->bitReverseFlagR = 1U;
+/** @brief Forward RFFT instance for 64-point FFT. */
+const arm_rfft_instance_q15 arm_rfft_sR_q15_len64 =
+    RFFT_Q15_INSTANCE(64U, arm_cfft_sR_q15_len32, RFFT_Q15_SPLIT(64));
+#endif
 
-    /* Initialize the Twiddle coefficient A pointer */
-    S->pTwiddleAReal = (q15_t *) realCoefAQ15;
+#if RFFT_Q15_HAS_LEN(128)
+static const arm_cfft_instance_q15 arm_cfft_sR_q15_len64 = RFFT_Q15_CFFT_INSTANCE(64);
 
-    /* Initialize the Twiddle coefficient B pointer */
-    S->pTwiddleBReal = (q15_t *) realCoefBQ15;
+/** @brief Forward RFFT instance for 128-point FFT. */
+const arm_rfft_instance_q15 arm_rfft_sR_q15_len128 =
+    RFFT_Q15_INSTANCE(128U, arm_cfft_sR_q15_len64, RFFT_Q15_SPLIT(128));
+#endif
 
-    /* Initialize the CFFT/CIFFT instance pointer */
-    S->pCfft = &arm_cfft_sR_q15_len2048;
+#if RFFT_Q15_HAS_LEN(256)
+static const arm_cfft_instance_q15 arm_cfft_sR_q15_len128 = RFFT_Q15_CFFT_INSTANCE(128);
 
-    return RFFT_SUCCESS;
+/** @brief Forward RFFT instance for 256-point FFT. */
+const arm_rfft_instance_q15 arm_rfft_sR_q15_len256 =
+    RFFT_Q15_INSTANCE(256U, arm_cfft_sR_q15_len128, RFFT_Q15_SPLIT(256));
+#endif
+
+#if RFFT_Q15_HAS_LEN(512)
+static const arm_cfft_instance_q15 arm_cfft_sR_q15_len256 = RFFT_Q15_CFFT_INSTANCE(256);
+
+/** @brief Forward RFFT instance for 512-point FFT. */
+const arm_rfft_instance_q15 arm_rfft_sR_q15_len512 =
+    RFFT_Q15_INSTANCE(512U, arm_cfft_sR_q15_len256, RFFT_Q15_SPLIT(512));
+#endif
+
+#if RFFT_Q15_HAS_LEN(1024)
+static const arm_cfft_instance_q15 arm_cfft_sR_q15_len512 = RFFT_Q15_CFFT_INSTANCE(512);
+
+/** @brief Forward RFFT instance for 1024-point FFT. */
+const arm_rfft_instance_q15 arm_rfft_sR_q15_len1024 =
+    RFFT_Q15_INSTANCE(1024U, arm_cfft_sR_q15_len512, RFFT_Q15_SPLIT(1024));
+#endif
+
+#if RFFT_Q15_HAS_LEN(2048)
+static const arm_cfft_instance_q15 arm_cfft_sR_q15_len1024 = RFFT_Q15_CFFT_INSTANCE(1024);
+
+/** @brief Forward RFFT instance for 2048-point FFT. */
+const arm_rfft_instance_q15 arm_rfft_sR_q15_len2048 =
+    RFFT_Q15_INSTANCE(2048U, arm_cfft_sR_q15_len1024, RFFT_Q15_SPLIT(2048));
+#endif
+
+#if RFFT_Q15_HAS_LEN(4096)
+static const arm_cfft_instance_q15 arm_cfft_sR_q15_len2048 = RFFT_Q15_CFFT_INSTANCE(2048);
+
+/** @brief Forward RFFT instance for 4096-point FFT. */
+const arm_rfft_instance_q15 arm_rfft_sR_q15_len4096 =
+    RFFT_Q15_INSTANCE(4096U, arm_cfft_sR_q15_len2048, RFFT_Q15_SPLIT(4096));
+#endif
+
+#if RFFT_Q15_HAS_LEN(8192)
+static const arm_cfft_instance_q15 arm_cfft_sR_q15_len4096 = RFFT_Q15_CFFT_INSTANCE(4096);
+
+/** @brief Forward RFFT instance for 8192-point FFT. */
+const arm_rfft_instance_q15 arm_rfft_sR_q15_len8192 =
+    RFFT_Q15_INSTANCE(8192U, arm_cfft_sR_q15_len4096, RFFT_Q15_SPLIT(8192));
+#endif
+
+/**
+ * @brief Prebuilt forward RFFT instance of a given length.
+ * @param[in] fftLenReal  RFFT length
+ * @return Instance, or NULL when fftLenReal is not built in
+ */
+const arm_rfft_instance_q15 *rfft_q15_get_instance(uint32_t fftLenReal)
+{
+    rfft_q15_twiddles_init();
+
+    switch (fftLenReal) {
+#if RFFT_Q15_HAS_LEN(32)
+    case 32U:
+        return &arm_rfft_sR_q15_len32;
+#endif
+#if RFFT_Q15_HAS_LEN(64)
+    case 64U:
+        return &arm_rfft_sR_q15_len64;
+#endif
+#if RFFT_Q15_HAS_LEN(128)
+    case 128U:
+        return &arm_rfft_sR_q15_len128;
+#endif
+#if RFFT_Q15_HAS_LEN(256)
+    case 256U:
+        return &arm_rfft_sR_q15_len256;
+#endif
+#if RFFT_Q15_HAS_LEN(512)
+    case 512U:
+        return &arm_rfft_sR_q15_len512;
+#endif
+#if RFFT_Q15_HAS_LEN(1024)
+    case 1024U:
+        return &arm_rfft_sR_q15_len1024;
+#endif
+#if RFFT_Q15_HAS_LEN(2048)
+    case 2048U:
+        return &arm_rfft_sR_q15_len2048;
+#endif
+#if RFFT_Q15_HAS_LEN(4096)
+    case 4096U:
+        return &arm_rfft_sR_q15_len4096;
+#endif
+#if RFFT_Q15_HAS_LEN(8192)
+    case 8192U:
+        return &arm_rfft_sR_q15_len8192;
+#endif
+    default:
+        return NULL;
+    }
 }
 
-#ifdef ENABLE_FFT_8K
 /**
- * @brief Initialize RFFT instance for 8192-point FFT.
- * @param[out] S  Pointer to RFFT instance structure
+ * @brief Initialize RFFT instance of a given length.
+ * @param[out] S           Pointer to RFFT instance structure
+ * @param[in]  fftLenReal  RFFT length
  * @return Status code
  */
-rfft_status_t rfft_q15_init_8192(arm_rfft_instance_q15 *S)
+rfft_status_t rfft_q15_init(arm_rfft_instance_q15 *S, uint32_t fftLenReal)
 {
+    const arm_rfft_instance_q15 *instance;
+
     if (S == NULL) {
         return RFFT_ERROR_NULL_POINTER;
     }
 
-    /* Initialize the Real FFT length */
-    S->fftLenReal = 8192U;
+    instance = rfft_q15_get_instance(fftLenReal);
+    if (instance == NULL) {
+        return RFFT_ERROR_INVALID_SIZE;
+    }
+
+    *S = *instance;
 
-    /* Initialize the Twiddle coefficient modifier */
-    S->twidCoefRModifier = 1U;
+    return RFFT_SUCCESS;
+}
 
-    /* Initialize the Flag for selection of RFFT or RIFFT */
-    S->ifftFlagR = 0U;
+#if RFFT_Q15_HAS_LEN(4096)
+/**
+ * @brief Initialize RFFT instance for 4096-point FFT.
+ * @param[out] S  Pointer to RFFT instance structure
+ * @return Status code
+ */
+rfft_status_t rfft_q15_init_4096(arm_rfft_instance_q15 *S)
+{
+    if (S == NULL) {
+        return RFFT_ERROR_NULL_POINTER;
+    }
 
-    /* Initialize the Flag for calculation Bit reversal or not */
-    S->bitReverseFlagR = 1U;
+    rfft_q15_twiddles_init();
+    *S = arm_rfft_sR_q15_len4096;
 
-    /* Initialize the Twiddle coefficient A pointer */
-    S->pTwiddleAReal = (q15_t *) realCoefAQ15;
+    return RFFT_SUCCESS;
+}
+#endif
 
-    /* Initialize the Twiddle coefficient B pointer */
-    S->pTwiddleBReal = (q15_t *) realCoefBQ15;
+#if RFFT_Q15_HAS_LEN(8192)
+/**
+ * @brief Initialize RFFT instance for 8192-point FFT.
+ * @param[out] S  Pointer to RFFT instance structure
+ * @return Status code
+ */
+rfft_status_t rfft_q15_init_8192(arm_rfft_instance_q15 *S)
+{
+    if (S == NULL) {
+        return RFFT_ERROR_NULL_POINTER;
+    }
 
-    /* Initialize the CFFT/CIFFT instance pointer */
-    S->pCfft = &arm_cfft_sR_q15_len4096;
+    rfft_q15_twiddles_init();
+    *S = arm_rfft_sR_q15_len8192;
 
     return RFFT_SUCCESS;
 }
-#endif /* ENABLE_FFT_8K */
+#endif
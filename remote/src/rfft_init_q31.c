@@ -0,0 +1,179 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library - Simplified Q31 RFFT
+ * Title:        rfft_init_q31.c
+ * Description:  Initialization functions for Q31 RFFT
+ *
+ * Target Processor: nRF54L15 FLPR (RISC-V)
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2021 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "rfft_q31_simplified.h"
+#include <stddef.h>
+
+/* CFFT instance of an fftLen-point complex FFT */
+#define RFFT_Q31_CFFT_INSTANCE(fftLen)                      \
+    {                                                       \
+        fftLen,                                             \
+        RFFT_Q31_TWIDDLE_TABLE,                             \
+    }
+
+/* Forward RFFT instance of an fftLenReal-point real FFT */
+#define RFFT_Q31_INSTANCE(len, cfft)                                     \
+    {                                                                    \
+        .fftLenReal = (len),               /* Real FFT length */         \
+        .ifftFlagR = 0U,                   /* Forward transform */       \
+        .bitReverseFlagR = 1U,             /* Natural order output */    \
+        .twidCoefRModifier = RFFT_Q31_MAX_FFT_LEN / (len),               \
+        .pTwiddleAReal = RFFT_Q31_SPLIT_TABLE, /* A and B derived from it */ \
+        .pTwiddleBReal = NULL,                                           \
+        .pCfft = &(cfft),                                                \
+    }
+
+#if RFFT_Q31_HAS_LEN(32)
+static const arm_cfft_instance_q31 arm_cfft_sR_q31_len16 = RFFT_Q31_CFFT_INSTANCE(16);
+
+/** @brief Forward Q31 RFFT instance for 32-point FFT. */
+const arm_rfft_instance_q31 arm_rfft_sR_q31_len32 =
+    RFFT_Q31_INSTANCE(32U, arm_cfft_sR_q31_len16);
+#endif
+
+#if RFFT_Q31_HAS_LEN(64)
+static const arm_cfft_instance_q31 arm_cfft_sR_q31_len32 = RFFT_Q31_CFFT_INSTANCE(32);
+
+/** @brief Forward Q31 RFFT instance for 64-point FFT. */
+const arm_rfft_instance_q31 arm_rfft_sR_q31_len64 =
+    RFFT_Q31_INSTANCE(64U, arm_cfft_sR_q31_len32);
+#endif
+
+#if RFFT_Q31_HAS_LEN(128)
+static const arm_cfft_instance_q31 arm_cfft_sR_q31_len64 = RFFT_Q31_CFFT_INSTANCE(64);
+
+/** @brief Forward Q31 RFFT instance for 128-point FFT. */
+const arm_rfft_instance_q31 arm_rfft_sR_q31_len128 =
+    RFFT_Q31_INSTANCE(128U, arm_cfft_sR_q31_len64);
+#endif
+
+#if RFFT_Q31_HAS_LEN(256)
+static const arm_cfft_instance_q31 arm_cfft_sR_q31_len128 = RFFT_Q31_CFFT_INSTANCE(128);
+
+/** @brief Forward Q31 RFFT instance for 256-point FFT. */
+const arm_rfft_instance_q31 arm_rfft_sR_q31_len256 =
+    RFFT_Q31_INSTANCE(256U, arm_cfft_sR_q31_len128);
+#endif
+
+#if RFFT_Q31_HAS_LEN(512)
+static const arm_cfft_instance_q31 arm_cfft_sR_q31_len256 = RFFT_Q31_CFFT_INSTANCE(256);
+
+/** @brief Forward Q31 RFFT instance for 512-point FFT. */
+const arm_rfft_instance_q31 arm_rfft_sR_q31_len512 =
+    RFFT_Q31_INSTANCE(512U, arm_cfft_sR_q31_len256);
+#endif
+
+#if RFFT_Q31_HAS_LEN(1024)
+static const arm_cfft_instance_q31 arm_cfft_sR_q31_len512 = RFFT_Q31_CFFT_INSTANCE(512);
+
+/** @brief Forward Q31 RFFT instance for 1024-point FFT. */
+const arm_rfft_instance_q31 arm_rfft_sR_q31_len1024 =
+    RFFT_Q31_INSTANCE(1024U, arm_cfft_sR_q31_len512);
+#endif
+
+#if RFFT_Q31_HAS_LEN(2048)
+static const arm_cfft_instance_q31 arm_cfft_sR_q31_len1024 = RFFT_Q31_CFFT_INSTANCE(1024);
+
+/** @brief Forward Q31 RFFT instance for 2048-point FFT. */
+const arm_rfft_instance_q31 arm_rfft_sR_q31_len2048 =
+    RFFT_Q31_INSTANCE(2048U, arm_cfft_sR_q31_len1024);
+#endif
+
+#if RFFT_Q31_HAS_LEN(4096)
+static const arm_cfft_instance_q31 arm_cfft_sR_q31_len2048 = RFFT_Q31_CFFT_INSTANCE(2048);
+
+/** @brief Forward Q31 RFFT instance for 4096-point FFT. */
+const arm_rfft_instance_q31 arm_rfft_sR_q31_len4096 =
+    RFFT_Q31_INSTANCE(4096U, arm_cfft_sR_q31_len2048);
+#endif
+
+#if RFFT_Q31_HAS_LEN(8192)
+static const arm_cfft_instance_q31 arm_cfft_sR_q31_len4096 = RFFT_Q31_CFFT_INSTANCE(4096);
+
+/** @brief Forward Q31 RFFT instance for 8192-point FFT. */
+const arm_rfft_instance_q31 arm_rfft_sR_q31_len8192 =
+    RFFT_Q31_INSTANCE(8192U, arm_cfft_sR_q31_len4096);
+#endif
+
+/**
+ * @brief Prebuilt forward Q31 RFFT instance of a given length.
+ * @param[in] fftLenReal  RFFT length
+ * @return Instance, or NULL when fftLenReal is not built in
+ */
+const arm_rfft_instance_q31 *rfft_q31_get_instance(uint32_t fftLenReal)
+{
+    switch (fftLenReal) {
+#if RFFT_Q31_HAS_LEN(32)
+    case 32U:
+        return &arm_rfft_sR_q31_len32;
+#endif
+#if RFFT_Q31_HAS_LEN(64)
+    case 64U:
+        return &arm_rfft_sR_q31_len64;
+#endif
+#if RFFT_Q31_HAS_LEN(128)
+    case 128U:
+        return &arm_rfft_sR_q31_len128;
+#endif
+#if RFFT_Q31_HAS_LEN(256)
+    case 256U:
+        return &arm_rfft_sR_q31_len256;
+#endif
+#if RFFT_Q31_HAS_LEN(512)
+    case 512U:
+        return &arm_rfft_sR_q31_len512;
+#endif
+#if RFFT_Q31_HAS_LEN(1024)
+    case 1024U:
+        return &arm_rfft_sR_q31_len1024;
+#endif
+#if RFFT_Q31_HAS_LEN(2048)
+    case 2048U:
+        return &arm_rfft_sR_q31_len2048;
+#endif
+#if RFFT_Q31_HAS_LEN(4096)
+    case 4096U:
+        return &arm_rfft_sR_q31_len4096;
+#endif
+#if RFFT_Q31_HAS_LEN(8192)
+    case 8192U:
+        return &arm_rfft_sR_q31_len8192;
+#endif
+    default:
+        return NULL;
+    }
+}
+
+/**
+ * @brief Initialize Q31 RFFT instance of a given length.
+ * @param[out] S           Pointer to RFFT instance structure
+ * @param[in]  fftLenReal  RFFT length
+ * @return Status code
+ */
+rfft_status_t rfft_q31_init(arm_rfft_instance_q31 *S, uint32_t fftLenReal)
+{
+    const arm_rfft_instance_q31 *instance;
+
+    if (S == NULL) {
+        return RFFT_ERROR_NULL_POINTER;
+    }
+
+    instance = rfft_q31_get_instance(fftLenReal);
+    if (instance == NULL) {
+        return RFFT_ERROR_INVALID_SIZE;
+    }
+
+    *S = *instance;
+
+    return RFFT_SUCCESS;
+}
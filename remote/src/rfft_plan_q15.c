@@ -0,0 +1,256 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library - Simplified Q15 RFFT
+ * Title:        rfft_plan_q15.c
+ * Description:  Twiddle factors computed at run time, and RFFT plans on them
+ *
+ * Target Processor: nRF54L15 FLPR (RISC-V)
+ * -------------------------------------------------------------------- */
+
+#include "rfft_q15_simplified.h"
+#include <stddef.h>
+
+/*
+ * cos and sin of 2*pi/n in Q62 for n = 32 to 8192, rounded. The table is
+ * grown from the step of RFFT_TWIDDLE_TABLE_LEN by rotation, which is all
+ * that replaces the generated constants.
+ */
+static const uint64_t rfft_twiddle_step_q62[][2] = {
+    { 0x3EC52F9FEEB96056ULL, 0x0C7C5C1E34D3055BULL },  /* 32 */
+    { 0x3FB11B47A24A4B3CULL, 0x0645E9AF0A6D0AF8ULL },  /* 64 */
+    { 0x3FEC43C6F2DAFBC7ULL, 0x0323ECBE21BB027DULL },  /* 128 */
+    { 0x3FFB10C1099A1976ULL, 0x0192155F7A3667E0ULL },  /* 256 */
+    { 0x3FFEC42D3725B6AFULL, 0x00C90E8FE6F63C23ULL },  /* 512 */
+    { 0x3FFFB10B1D15249BULL, 0x006487C3F99C01C4ULL },  /* 1024 */
+    { 0x3FFFEC42C43A03A5ULL, 0x003243F17D994975ULL },  /* 2048 */
+    { 0x3FFFFB10B0DDCC8DULL, 0x001921FAAEE6472EULL },  /* 4096 */
+    { 0x3FFFFEC42C3467DEULL, 0x000C90FD957659B0ULL },  /* 8192 */
+};
+
+#define RFFT_Q62_ONE  (1ULL << 62)
+
+/* floor(a * b / 2^62) for a, b up to 2^62, in 32-bit multiplies */
+static uint64_t rfft_mul_q62(uint64_t a, uint64_t b)
+{
+    uint32_t a0 = (uint32_t) a, a1 = (uint32_t) (a >> 32);
+    uint32_t b0 = (uint32_t) b, b1 = (uint32_t) (b >> 32);
+    uint64_t p00 = (uint64_t) a0 * b0;
+    uint64_t p01 = (uint64_t) a0 * b1;
+    uint64_t p10 = (uint64_t) a1 * b0;
+    uint64_t mid = (p00 >> 32) + (uint32_t) p01 + (uint32_t) p10;
+    uint64_t hi = (uint64_t) a1 * b1 + (p01 >> 32) + (p10 >> 32) + (mid >> 32);
+
+    return (hi << 2) | ((uint32_t) mid >> 30);
+}
+
+/* floor(32768 * x) of x = sign * v / 2^62 saturated to Q15, as gen_tables.py rounds */
+static q15_t rfft_q62_to_q15(uint64_t v, int negative)
+{
+    uint32_t q = (uint32_t) (v >> 47);
+
+    if (negative) {
+        return (q15_t) -(int32_t) (q + ((v & ((1ULL << 47) - 1U)) != 0U));
+    }
+
+    return (q15_t) ((q > 32767U) ? 32767U : q);
+}
+
+#if !defined(RFFT_Q15_COMPACT_TWIDDLES)
+static void rfft_twiddle_put(q15_t *table, uint32_t k, uint64_t c, int c_neg,
+                             uint64_t s, int s_neg)
+{
+    if (k < 3U * RFFT_TWIDDLE_TABLE_LEN / 4U) {
+        table[2U * k] = rfft_q62_to_q15(c, c_neg);
+        table[2U * k + 1U] = rfft_q62_to_q15(s, s_neg);
+    }
+}
+#endif
+
+/**
+ * @brief Compute the shared twiddle table, bit-exact with the generated one.
+ * @param[out] table  RFFT_TWIDDLE_TABLE_ENTRIES values
+ *
+ * The first octant is rotated out in Q62, where some thousand steps stay
+ * far below the rounding of Q15, and the other octants follow from it by
+ * symmetry.
+ */
+void rfft_q15_twiddles_generate(q15_t *table)
+{
+    const uint32_t n = RFFT_TWIDDLE_TABLE_LEN;
+    const uint64_t *step = rfft_twiddle_step_q62[__builtin_ctz(n) - 5];
+    uint64_t c = RFFT_Q62_ONE;
+    uint64_t s = 0U;
+
+    for (uint32_t j = 0; j <= n / 8U; j++) {
+        uint64_t c_next, s_next;
+
+#if defined(RFFT_Q15_COMPACT_TWIDDLES)
+        table[j] = rfft_q62_to_q15(s, 0);
+        table[n / 4U - j] = rfft_q62_to_q15(c, 0);
+#else
+        rfft_twiddle_put(table, j, c, 0, s, 0);
+        rfft_twiddle_put(table, n / 4U - j, s, 0, c, 0);
+        rfft_twiddle_put(table, n / 4U + j, s, 1, c, 0);
+        rfft_twiddle_put(table, n / 2U - j, c, 1, s, 0);
+        rfft_twiddle_put(table, n / 2U + j, c, 1, s, 1);
+        rfft_twiddle_put(table, 3U * n / 4U - j, s, 1, c, 1);
+#endif
+
+        c_next = rfft_mul_q62(c, step[0]) - rfft_mul_q62(s, step[1]);
+        s_next = rfft_mul_q62(s, step[0]) + rfft_mul_q62(c, step[1]);
+        c = c_next;
+        s = s_next;
+    }
+}
+
+/**
+ * @brief Set up an RFFT of any power of two length on a computed table.
+ * @param[out] plan        Plan to set up, pass &plan->rfft to the transforms
+ * @param[in]  fftLenReal  RFFT length, a power of two from 32 to RFFT_Q15_MAX_FFT_LEN
+ * @param[out] arena       RFFT_Q15_PLAN_ARENA_LEN values for the tables
+ * @param[in]  arena_len   Values in arena
+ * @return Status code
+ *
+ * Fills the arena with the twiddle table and, with the DSP extension, the
+ * bit reversal table of the CFFT. The plan points into the arena, which
+ * must stay valid and unchanged while the plan is used.
+ */
+rfft_status_t rfft_plan_create(rfft_q15_plan_t *plan, uint32_t fftLenReal,
+                               q15_t *arena, uint32_t arena_len)
+{
+    if (plan == NULL || arena == NULL) {
+        return RFFT_ERROR_NULL_POINTER;
+    }
+
+    if (fftLenReal < 32U || fftLenReal > RFFT_Q15_MAX_FFT_LEN ||
+        (fftLenReal & (fftLenReal - 1U)) != 0U || arena_len < RFFT_Q15_PLAN_ARENA_LEN) {
+        return RFFT_ERROR_INVALID_SIZE;
+    }
+
+    rfft_q15_twiddles_generate(arena);
+
+    plan->cfft.fftLen = (uint16_t) (fftLenReal / 2U);
+    plan->cfft.pTwiddle = arena;
+    plan->cfft.pBitRevTable = NULL;
+    plan->cfft.bitRevLength = 0U;
+
+#if defined(ARM_MATH_DSP) && !defined(RFFT_Q15_NO_BITREV_TABLES)
+    {
+        /* Swap pairs in gen_tables.py order, 8 * element index */
+        uint16_t *bitrev = (uint16_t *) &arena[RFFT_TWIDDLE_TABLE_ENTRIES];
+        uint32_t len = fftLenReal / 2U;
+        uint32_t top = len >> 1;
+        uint32_t count = 0U;
+
+        for (uint32_t i = 0, r = 0; i < len; i++) {
+            if (i < r) {
+                bitrev[count++] = (uint16_t) (8U * i);
+                bitrev[count++] = (uint16_t) (8U * r);
+            }
+            r = rfft_bitrev_next(r, top);
+        }
+
+        plan->cfft.pBitRevTable = bitrev;
+        plan->cfft.bitRevLength = (uint16_t) count;
+    }
+#endif
+
+    plan->rfft.fftLenReal = fftLenReal;
+    plan->rfft.ifftFlagR = 0U;
+    plan->rfft.bitReverseFlagR = 1U;
+    plan->rfft.twidCoefRModifier = RFFT_TWIDDLE_STRIDE(fftLenReal);
+    plan->rfft.pTwiddleAReal = arena;
+    plan->rfft.pTwiddleBReal = NULL;
+    plan->rfft.pCfft = &plan->cfft;
+
+    return RFFT_SUCCESS;
+}
+
+/* 2*pi in Q60, rounded */
+#define RFFT_TWO_PI_Q60  0x6487ED5110B4611AULL
+
+/* cos and sin of 2*pi/n in Q62 for n >= 32, by the Taylor series */
+static void rfft_step_q62(uint32_t n, uint64_t *c, uint64_t *s)
+{
+    uint64_t theta = ((RFFT_TWO_PI_Q60 / n) << 2) + ((RFFT_TWO_PI_Q60 % n) << 2) / n;
+    uint64_t term = RFFT_Q62_ONE;
+
+    *c = RFFT_Q62_ONE;
+    *s = 0U;
+
+    /* theta is below 0.2, the terms are gone below Q62 after some fifteen */
+    for (uint32_t i = 1U; term != 0U; i++) {
+        term = rfft_mul_q62(term, theta) / i;
+
+        switch (i & 3U) {
+        case 1U: *s += term; break;
+        case 2U: *c -= term; break;
+        case 3U: *s -= term; break;
+        default: *c += term; break;
+        }
+    }
+}
+
+/**
+ * @brief Set up an RFFT of a length that is not a power of two.
+ * @param[out] plan        Plan to set up
+ * @param[in]  fftLenReal  RFFT length from 32 to 8192, 2^a * 3^b * 5^c with a >= 2
+ * @param[out] arena       RFFT_MIXED_ARENA_LEN(fftLenReal) values for the sine table
+ * @param[in]  arena_len   Values in arena
+ * @return Status code
+ *
+ * The first octant is rotated out from the step as in
+ * rfft_q15_twiddles_generate(), the second follows by symmetry. The
+ * plan points into the arena, which must stay valid and unchanged while
+ * the plan is used.
+ */
+rfft_status_t rfft_mixed_plan_create(rfft_mixed_q15_t *plan, uint32_t fftLenReal,
+                                     q15_t *arena, uint32_t arena_len)
+{
+    uint32_t q = fftLenReal / 4U;
+    uint64_t step_c, step_s;
+    uint64_t c = RFFT_Q62_ONE;
+    uint64_t s = 0U;
+    uint32_t m;
+
+    if (plan == NULL || arena == NULL) {
+        return RFFT_ERROR_NULL_POINTER;
+    }
+
+    if (fftLenReal < 32U || fftLenReal > 8192U || (fftLenReal % 4U) != 0U ||
+        arena_len < RFFT_MIXED_ARENA_LEN(fftLenReal)) {
+        return RFFT_ERROR_INVALID_SIZE;
+    }
+
+    /* Radix 4 while it divides, then 2, 3 and 5 */
+    plan->numStages = 0U;
+    for (m = fftLenReal / 2U; m > 1U; ) {
+        uint32_t radix = ((m % 4U) == 0U) ? 4U : ((m % 2U) == 0U) ? 2U :
+                         ((m % 3U) == 0U) ? 3U : ((m % 5U) == 0U) ? 5U : 0U;
+
+        if (radix == 0U || plan->numStages == RFFT_MIXED_MAX_STAGES) {
+            return RFFT_ERROR_INVALID_SIZE;
+        }
+
+        plan->radix[plan->numStages++] = (uint8_t) radix;
+        m /= radix;
+    }
+
+    rfft_step_q62(fftLenReal, &step_c, &step_s);
+
+    for (uint32_t j = 0; j <= q / 2U; j++) {
+        uint64_t c_next, s_next;
+
+        arena[j] = rfft_q62_to_q15(s, 0);
+        arena[q - j] = rfft_q62_to_q15(c, 0);
+
+        c_next = rfft_mul_q62(c, step_c) - rfft_mul_q62(s, step_s);
+        s_next = rfft_mul_q62(s, step_c) + rfft_mul_q62(c, step_s);
+        c = c_next;
+        s = s_next;
+    }
+
+    plan->fftLenReal = (uint16_t) fftLenReal;
+    plan->pSin = arena;
+
+    return RFFT_SUCCESS;
+}
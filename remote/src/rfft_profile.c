@@ -0,0 +1,53 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library - Simplified Q15 RFFT
+ * Title:        rfft_profile.c
+ * Description:  Optional cycle profiler for the stages of the RFFT pipeline
+ *
+ * Target Processor: nRF54L15 FLPR (RISC-V)
+ * -------------------------------------------------------------------- */
+
+#include "rfft_profile.h"
+#include <string.h>
+
+#if defined(RFFT_Q15_PROFILE)
+
+rfft_profile_t rfft_profile;
+uint32_t rfft_profile_last;
+uint32_t rfft_profile_butterfly;
+
+static const char *const stage_names[RFFT_PROFILE_NUM_STAGES] = {
+    [RFFT_PROFILE_COPY] = "copy",
+    [RFFT_PROFILE_PREPASS] = "radix-2 pre-pass",
+    [RFFT_PROFILE_BUTTERFLY + 0] = "radix-4 #0",
+    [RFFT_PROFILE_BUTTERFLY + 1] = "radix-4 #1",
+    [RFFT_PROFILE_BUTTERFLY + 2] = "radix-4 #2",
+    [RFFT_PROFILE_BUTTERFLY + 3] = "radix-4 #3",
+    [RFFT_PROFILE_BUTTERFLY + 4] = "radix-4 #4",
+    [RFFT_PROFILE_BUTTERFLY + 5] = "radix-4 #5",
+    [RFFT_PROFILE_FIXUP] = "<<= 1 fixup",
+    [RFFT_PROFILE_BITREV] = "bit reversal",
+    [RFFT_PROFILE_SPLIT] = "split",
+    [RFFT_PROFILE_MAG] = "magnitude",
+    [RFFT_PROFILE_TOPK] = "top-K",
+};
+
+_Static_assert(RFFT_PROFILE_MAX_BUTTERFLIES == 6,
+               "stage_names lists 6 radix-4 stages");
+
+/**
+ * @brief Clear the cycles and the frame count
+ */
+void rfft_profile_reset(void)
+{
+    memset(&rfft_profile, 0, sizeof(rfft_profile));
+}
+
+/**
+ * @brief Short name of a stage for reports, e.g. "radix-4 #2"
+ */
+const char *rfft_profile_stage_name(uint32_t stage)
+{
+    return (stage < RFFT_PROFILE_NUM_STAGES) ? stage_names[stage] : "?";
+}
+
+#endif /* RFFT_Q15_PROFILE */
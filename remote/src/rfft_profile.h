@@ -0,0 +1,127 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library - Simplified Q15 RFFT
+ * Title:        rfft_profile.h
+ * Description:  Optional cycle profiler for the stages of the RFFT pipeline
+ *
+ * Target Processor: nRF54L15 FLPR (RISC-V)
+ * -------------------------------------------------------------------- */
+
+#ifndef RFFT_PROFILE_H
+#define RFFT_PROFILE_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * RFFT_Q15_PROFILE charges the cycles of the top N pipeline to its
+ * stages. Every stage ends with RFFT_PROFILE_MARK(), which reads the cycle
+ * counter once and adds the cycles since the previous mark to the stage,
+ * so nothing between two marks goes uncounted. Without RFFT_Q15_PROFILE
+ * the marks compile to nothing.
+ *
+ * The fft_context_execute*() entry points start a frame. Kernels called
+ * directly, without such an entry, charge their first stage from the last
+ * mark; call RFFT_PROFILE_START() first.
+ *
+ * Stages that a build fuses into others read 0: the packed butterfly of
+ * the FLPR does the radix-2 pre-pass in its first radix-4 stage and the
+ * <<= 1 fixup in its last one, and arm_rfft_q15_mag_sq() reads the CFFT
+ * output in bit-reversed order instead of reordering it. There the split,
+ * magnitude and top N of each bin are marked one by one, three counter
+ * reads per bin.
+ */
+
+/** Radix-4 stages of the largest CFFT, 4096 points behind RFFT 8192. */
+#define RFFT_PROFILE_MAX_BUTTERFLIES 6
+
+typedef enum {
+    RFFT_PROFILE_COPY = 0,      /**< Input copy into the FFT buffer, windowed */
+    RFFT_PROFILE_PREPASS,       /**< Radix-2 step of the radix-4-by-2 CFFT */
+    RFFT_PROFILE_BUTTERFLY,     /**< First radix-4 stage, the next ones follow */
+    RFFT_PROFILE_FIXUP = RFFT_PROFILE_BUTTERFLY + RFFT_PROFILE_MAX_BUTTERFLIES,
+                                /**< <<= 1 of the radix-4-by-2 output */
+    RFFT_PROFILE_BITREV,        /**< Bit reversal of the CFFT output */
+    RFFT_PROFILE_SPLIT,         /**< Split step from the CFFT to the RFFT bins */
+    RFFT_PROFILE_MAG,           /**< Magnitude² of the bins */
+    RFFT_PROFILE_TOPK,          /**< Top N selection, with the PSD if enabled */
+    RFFT_PROFILE_NUM_STAGES
+} rfft_profile_stage_t;
+
+/** Cycles per stage, summed over frames since the last rfft_profile_reset() */
+typedef struct {
+    uint32_t cycles[RFFT_PROFILE_NUM_STAGES];
+    uint32_t frames;
+} rfft_profile_t;
+
+#if defined(RFFT_Q15_PROFILE)
+
+#if !defined(RFFT_PROFILE_CLOCK)
+#if defined(__riscv)
+static inline uint32_t rfft_profile_clock(void)
+{
+    uint32_t cycle;
+    __asm__ volatile ("rdcycle %0" : "=r"(cycle));
+    return cycle;
+}
+#define RFFT_PROFILE_CLOCK() rfft_profile_clock()
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define RFFT_PROFILE_CLOCK() ((uint32_t) __rdtsc())
+#else
+#error "RFFT_Q15_PROFILE needs RFFT_PROFILE_CLOCK() for this target"
+#endif
+#endif
+
+extern rfft_profile_t rfft_profile;
+extern uint32_t rfft_profile_last;
+extern uint32_t rfft_profile_butterfly;
+
+/** Start a frame: the cycles from here on go to its first stage */
+#define RFFT_PROFILE_START() do {                 \
+        rfft_profile.frames++;                      \
+        rfft_profile_last = RFFT_PROFILE_CLOCK();   \
+    } while (0)
+
+/** End a stage: charge it the cycles since the previous mark */
+#define RFFT_PROFILE_MARK(stage) do {                       \
+        uint32_t rfft_profile_now_ = RFFT_PROFILE_CLOCK();  \
+        rfft_profile.cycles[(stage)] += rfft_profile_now_ - rfft_profile_last; \
+        rfft_profile_last = rfft_profile_now_;              \
+    } while (0)
+
+/** Number the radix-4 stages from n on, e.g. per half of a radix-4-by-2 CFFT */
+#define RFFT_PROFILE_BUTTERFLY_FROM(n) (rfft_profile_butterfly = (n))
+
+/** End a radix-4 stage, the next one gets the next number */
+#define RFFT_PROFILE_MARK_BUTTERFLY()                                       \
+    RFFT_PROFILE_MARK(RFFT_PROFILE_BUTTERFLY +                              \
+                      ((rfft_profile_butterfly < RFFT_PROFILE_MAX_BUTTERFLIES) ? \
+                       rfft_profile_butterfly++ : RFFT_PROFILE_MAX_BUTTERFLIES - 1U))
+
+/**
+ * @brief Clear the cycles and the frame count
+ */
+void rfft_profile_reset(void);
+
+/**
+ * @brief Short name of a stage for reports, e.g. "radix-4 #2"
+ */
+const char *rfft_profile_stage_name(uint32_t stage);
+
+#else
+
+#define RFFT_PROFILE_START()            do { } while (0)
+#define RFFT_PROFILE_MARK(stage)        do { } while (0)
+#define RFFT_PROFILE_BUTTERFLY_FROM(n)  do { } while (0)
+#define RFFT_PROFILE_MARK_BUTTERFLY()   do { } while (0)
+
+#endif /* RFFT_Q15_PROFILE */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RFFT_PROFILE_H */
@@ -21,12 +21,24 @@ extern void arm_cfft_q15(
     uint8_t ifftFlag,
     uint8_t bitReverseFlag);
 
+extern void arm_cfft_q15_out(
+    const arm_cfft_instance_q15 * S,
+    q15_t * pSrc,
+    q15_t * pDst,
+    uint8_t ifftFlag);
+
+extern void arm_cfft_q15_inverse_shl(
+    const arm_cfft_instance_q15 * S,
+    q15_t * p1,
+    uint8_t bitReverseFlag,
+    uint32_t shift);
+
 /* Internal split function for RFFT */
 static void arm_split_rfft_q15(
         q15_t * pSrc,
         uint32_t fftLen,
-  const q15_t * pATable,
-  const q15_t * pBTable,
+  const q15_t * pTwiddle,
+  const q15_t * pSplit,
         q15_t * pDst,
         uint32_t modifier);
 
@@ -34,18 +46,70 @@ static void arm_split_rfft_q15(
 static void arm_split_rifft_q15(
         q15_t * pSrc,
         uint32_t fftLen,
-  const q15_t * pATable,
-  const q15_t * pBTable,
+  const q15_t * pTwiddle,
         q15_t * pDst,
         uint32_t modifier);
 
+/*
+ * Split coefficients k of the shared twiddle table, k < half the table:
+ * pCoef[0..1] = A = (1 - sin, -cos) / 2 and pCoef[2..3] = B =
+ * (1 + sin, cos) / 2 of 2*pi*k/RFFT_TWIDDLE_TABLE_LEN. Rounded and
+ * saturated as the CMSIS realCoefAQ15 and realCoefBQ15 tables, which
+ * round(16384 * x) = (floor(32768 * x) + 1) >> 1 gives from the twiddles.
+ */
+static inline void arm_rfft_coef_q15(
+  const q15_t * pTwiddle,
+        uint32_t k,
+        q15_t * pCoef)
+{
+    q31_t a0 = 16384 - ((RFFT_TWIDDLE_SIN(pTwiddle, k) + 1) >> 1);
+    q31_t a1 = (-RFFT_TWIDDLE_COS(pTwiddle, k)) >> 1;
+
+    pCoef[0] = (q15_t) a0;
+    pCoef[1] = (q15_t) a1;
+    pCoef[2] = (q15_t) ((a0 > 0) ? (32768 - a0) : 32767);
+    pCoef[3] = (q15_t) -a1;
+}
+
+/*
+ * Split coefficients of bin i, 0 < i < fftLen, of the fftLen-point split
+ * step: from pSplit, the pTwiddleBReal of the instance, where bin
+ * fftLen - i is bin i mirrored, or derived from the twiddles without it.
+ */
+static inline void arm_rfft_split_coef_q15(
+  const q15_t * pTwiddle,
+  const q15_t * pSplit,
+        uint32_t fftLen,
+        uint32_t modifier,
+        uint32_t i,
+        q15_t * pCoef)
+{
+    if (pSplit == NULL)
+    {
+        arm_rfft_coef_q15(pTwiddle, modifier * i, pCoef);
+    }
+    else if (i <= (fftLen >> 1U))
+    {
+        memcpy(pCoef, &pSplit[4U * i], 4U * sizeof(q15_t));
+    }
+    else
+    {
+        const q15_t *pMirror = &pSplit[4U * (fftLen - i)];
+
+        pCoef[0] = pMirror[0];
+        pCoef[1] = (q15_t) -pMirror[1];
+        pCoef[2] = pMirror[2];
+        pCoef[3] = (q15_t) -pMirror[3];
+    }
+}
+
 /**
  * @brief Processing function for the Q15 RFFT.
  * @param[in]     S     points to an instance of the Q15 RFFT structure
  * @param[in]     pSrc  points to input buffer (modified by this function)
  * @param[out]    pDst  points to output buffer
  */
-void arm_rfft_q15(
+RFFT_Q15_HOT void arm_rfft_q15(
   const arm_rfft_instance_q15 * S,
         q15_t * pSrc,
         q15_t * pDst)
@@ -57,70 +121,127 @@ void arm_rfft_q15(
     if (S->ifftFlagR == 1U)
     {
         /* Real IFFT core process */
-        arm_split_rifft_q15(pSrc, L2, S->pTwiddleAReal, S->pTwiddleBReal, pDst, S->twidCoefRModifier);
+        arm_split_rifft_q15(pSrc, L2, S->pTwiddleAReal, pDst, S->twidCoefRModifier);
 
-        /* Complex IFFT process */
-        arm_cfft_q15(S_CFFT, pDst, S->ifftFlagR, S->bitReverseFlagR);
-
-        /* Shift output by 1 for IFFT */
-        for (uint32_t i = 0; i < S->fftLenReal; i++)
-        {
-            pDst[i] = pDst[i] << 1;
-        }
+        /* Complex IFFT process, the last stage shifts the output by 1 */
+        arm_cfft_q15_inverse_shl(S_CFFT, pDst, S->bitReverseFlagR, 1U);
     }
     else
     {
         /* Calculation of RFFT of input */
 
+#if !defined (ARM_MATH_DSP)
+        if (S->bitReverseFlagR == 1U)
+        {
+            /* Complex FFT process, natural order result in the low half of pDst */
+            arm_cfft_q15_out(S_CFFT, pSrc, pDst, S->ifftFlagR);
+
+            /* Real FFT core process, in place */
+            arm_split_rfft_q15(pDst, L2, S->pTwiddleAReal, S->pTwiddleBReal, pDst,
+                               S->twidCoefRModifier);
+            RFFT_PROFILE_MARK(RFFT_PROFILE_SPLIT);
+            return;
+        }
+#endif
+
         /* Complex FFT process */
         arm_cfft_q15(S_CFFT, pSrc, S->ifftFlagR, S->bitReverseFlagR);
 
         /* Real FFT core process */
-        arm_split_rfft_q15(pSrc, L2, S->pTwiddleAReal, S->pTwiddleBReal, pDst, S->twidCoefRModifier);
+        arm_split_rfft_q15(pSrc, L2, S->pTwiddleAReal, S->pTwiddleBReal, pDst,
+                           S->twidCoefRModifier);
+        RFFT_PROFILE_MARK(RFFT_PROFILE_SPLIT);
     }
 }
 
+/*
+ * One output bin of arm_split_rfft_q15(): a = X[i], b = X[fftLen - i].
+ * Returns the real part in *pOutR and the imaginary part in *pOutI, both
+ * before the conversion to q15_t.
+ */
+static inline void arm_split_rfft_bin_q15(
+        q31_t ar,
+        q31_t ai,
+        q31_t br,
+        q31_t bi,
+  const q15_t * pCoefA,
+  const q15_t * pCoefB,
+        q31_t * pOutR,
+        q31_t * pOutI)
+{
+    q31_t outR, outI;
+
+    outR = ar * pCoefA[0];
+    outR = outR - (ai * pCoefA[1]);
+    outR = outR + (br * pCoefB[0]);
+    outR = (outR + (bi * pCoefB[1])) >> 16;
+
+    outI = br * pCoefB[1];
+    outI = outI - (bi * pCoefB[0]);
+    outI = outI + (ai * pCoefA[0]);
+    outI = outI + (ar * pCoefA[1]);
+
+    *pOutR = outR;
+    *pOutI = outI >> 16U;
+}
+
+/* Write bin i and its complex conjugate to the RFFT output. */
+static inline void arm_split_rfft_store_q15(
+        q15_t * pDst,
+        uint32_t fftLen,
+        uint32_t i,
+        q31_t outR,
+        q31_t outI)
+{
+    /* write output */
+    pDst[2U * i] = (q15_t) outR;
+    pDst[2U * i + 1U] = outI;
+
+    /* write complex conjugate output */
+    pDst[(4U * fftLen) - (2U * i)] = (q15_t) outR;
+    pDst[((4U * fftLen) - (2U * i)) + 1U] = -outI;
+}
+
 /**
  * @brief Core Real FFT process
- * @param[in]     pSrc      points to input buffer
+ * @param[in]     pSrc      points to the CFFT result
  * @param[in]     fftLen    length of FFT
- * @param[in]     pATable   points to twiddle Coef A buffer
- * @param[in]     pBTable   points to twiddle Coef B buffer
- * @param[out]    pDst      points to output buffer
+ * @param[in]     pTwiddle  points to the shared twiddle table
+ * @param[in]     pSplit    split coefficients of the length, or NULL
+ * @param[out]    pDst      points to output buffer, may be pSrc
  * @param[in]     modifier  twiddle coefficient modifier
+ *
+ * Bins i and fftLen - i are computed together from X[i] and X[fftLen - i]
+ * and one set of coefficients, whose mirror gives the second bin, so the
+ * coefficients are read once and in order. Each iteration only overwrites
+ * the two inputs it has just read, so the split can run in place, the
+ * CFFT result in the low half of pDst.
  */
-static void arm_split_rfft_q15(
+RFFT_Q15_HOT static void arm_split_rfft_q15(
         q15_t * pSrc,
         uint32_t fftLen,
-  const q15_t * pATable,
-  const q15_t * pBTable,
+  const q15_t * pTwiddle,
+  const q15_t * pSplit,
         q15_t * pDst,
         uint32_t modifier)
-{       
-    uint32_t i;
-    q31_t outR, outI;
-    const q15_t *pCoefA, *pCoefB;
-    q15_t *pSrc1, *pSrc2;
-
-#if defined (ARM_MATH_DSP)
-    q15_t *pD1, *pD2;
-#endif
-
-    /* Init coefficient pointers */
-    pCoefA = &pATable[modifier * 2];
-    pCoefB = &pBTable[modifier * 2];
-
-    pSrc1 = &pSrc[2];
-    pSrc2 = &pSrc[(2U * fftLen) - 2U];
+{
+    uint32_t i, k;
+    q31_t x0r = pSrc[0];
+    q31_t x0i = pSrc[1];
+    q15_t coef[4] RFFT_Q15_ALIGN;
 
-#if defined (ARM_MATH_DSP)
+    for (i = 1U; i <= (fftLen >> 1U); i++)
+    {
+        k = fftLen - i;
+        arm_rfft_split_coef_q15(pTwiddle, pSplit, fftLen, modifier, i, coef);
 
-    i = 1U;
-    pD1 = pDst + 2;
-    pD2 = pDst + (4U * fftLen) - 2;
+#if defined (ARM_MATH_DSP) && !defined (ARM_MATH_BIG_ENDIAN)
+        q31_t a = read_q15x2(&pSrc[2U * i]);
+        q31_t b = read_q15x2(&pSrc[2U * k]);
+        q31_t cA = read_q15x2(&coef[0]);
+        q31_t cB = read_q15x2(&coef[2]);
+        q31_t outR, outI;
 
-    for (i = fftLen - 1; i > 0; i--)
-    {
         /*
           outR = (  pSrc[2 * i]             * pATable[2 * i]
                   - pSrc[2 * i + 1]         * pATable[2 * i + 1]
@@ -132,135 +253,536 @@ static void arm_split_rfft_q15(
                   + pIn[2 * n - 2 * i]     * pBTable[2 * i + 1]
                   - pIn[2 * n - 2 * i + 1] * pBTable[2 * i])
          */
+        outR = __SMLAD(b, cB, __SMUSD(a, cA)) >> 16U;
+        outI = __SMLADX(a, cA, __SMUSDX(b, cB)) >> 16U;
 
-#ifndef ARM_MATH_BIG_ENDIAN
-        /* pSrc[2 * i] * pATable[2 * i] - pSrc[2 * i + 1] * pATable[2 * i + 1] */
-        outR = __SMUSD(*((q31_t *)pSrc1), *((q31_t *)pCoefA));
+        /* output and its complex conjugate, one pair per store */
+        write_q15x2(&pDst[2U * i], __PKHBT(outR, outI, 16));
+        write_q15x2(&pDst[(4U * fftLen) - (2U * i)], __PKHBT(outR, -outI, 16));
+
+        if (k != i)
+        {
+            /*
+             * Bin k has the inputs swapped and A[1], B[1] negated, which
+             * the products absorb: the sum and difference swap places.
+             */
+            outR = __SMLAD(b, cA, __SMUSD(a, cB)) >> 16U;
+            outI = -__SMLADX(a, cB, __SMUSDX(b, cA)) >> 16U;
+
+            write_q15x2(&pDst[2U * k], __PKHBT(outR, outI, 16));
+            write_q15x2(&pDst[(4U * fftLen) - (2U * k)], __PKHBT(outR, -outI, 16));
+        }
 #else
-        /* -(pSrc[2 * i + 1] * pATable[2 * i + 1] - pSrc[2 * i] * pATable[2 * i]) */
-        outR = -(__SMUSD(*((q31_t *)pSrc1), *((q31_t *)pCoefA)));
-#endif
+        q31_t ar = pSrc[2U * i];
+        q31_t ai = pSrc[2U * i + 1U];
+        q31_t br = pSrc[2U * k];
+        q31_t bi = pSrc[2U * k + 1U];
+        q31_t outR, outI;
 
-        /* pSrc[2 * n - 2 * i] * pBTable[2 * i] + pSrc[2 * n - 2 * i + 1] * pBTable[2 * i + 1]) */
-        outR = __SMLAD(*((q31_t *)pSrc2), *((q31_t *)pCoefB), outR) >> 16U;
+        arm_split_rfft_bin_q15(ar, ai, br, bi, &coef[0], &coef[2], &outR, &outI);
+        arm_split_rfft_store_q15(pDst, fftLen, i, outR, outI);
 
-        /* pIn[2 * n - 2 * i] * pBTable[2 * i + 1] - pIn[2 * n - 2 * i + 1] * pBTable[2 * i] */
-#ifndef ARM_MATH_BIG_ENDIAN
-        outI = __SMUSDX(*((q31_t *)pSrc2), *((q31_t *)pCoefB));
-        pSrc2 -= 2;
-#else
-        outI = __SMUSDX(*((q31_t *)pCoefB), *((q31_t *)pSrc2));
-        pSrc2 -= 2;
+        if (k != i)
+        {
+            /* modifier * k is half the table minus modifier * i: A and B are mirrored */
+            coef[1] = -coef[1];
+            coef[3] = -coef[3];
+            arm_split_rfft_bin_q15(br, bi, ar, ai, &coef[0], &coef[2], &outR, &outI);
+            arm_split_rfft_store_q15(pDst, fftLen, k, outR, outI);
+        }
 #endif
+    }
 
-        /* (pIn[2 * i + 1] * pATable[2 * i] + pIn[2 * i] * pATable[2 * i + 1] */
-        outI = __SMLADX(*((q31_t *)pSrc1), *((q31_t *)pCoefA), outI);
-        pSrc1 += 2;
+    pDst[2U * fftLen] = (x0r - x0i) >> 1;
+    pDst[2U * fftLen + 1U] = 0;
 
-        /* write output */
-        *pD1++ = (q15_t) outR;
-        *pD1++ = outI >> 16U;
+    pDst[0] = (x0r + x0i) >> 1;
+    pDst[1] = 0;
+}
 
-        /* write complex conjugate output */
-        pD2[0] = (q15_t) outR;
-        pD2[1] = -(outI >> 16U);
-        pD2 -= 2;
+/**
+ * @brief Core Real FFT process producing the packed layout, in place
+ * @param[in,out] pBuf      CFFT output in natural order, packed RFFT output on return
+ * @param[in]     fftLen    length of FFT
+ * @param[in]     pTwiddle  points to the shared twiddle table
+ * @param[in]     pSplit    split coefficients of the length, or NULL
+ * @param[in]     modifier  twiddle coefficient modifier
+ *
+ * As arm_split_rfft_q15() in place, but only bins 0 to fftLen - 1 are
+ * written, and the real Nyquist bin takes the place of the (zero)
+ * imaginary part of bin 0.
+ */
+RFFT_Q15_HOT static void arm_split_rfft_q15_packed(
+        q15_t * pBuf,
+        uint32_t fftLen,
+  const q15_t * pTwiddle,
+  const q15_t * pSplit,
+        uint32_t modifier)
+{
+    uint32_t i, k;
+    q31_t x0r = pBuf[0];
+    q31_t x0i = pBuf[1];
+
+    for (i = 1U; i <= (fftLen >> 1U); i++)
+    {
+        q31_t ar = pBuf[2U * i];
+        q31_t ai = pBuf[2U * i + 1U];
+
+        k = fftLen - i;
 
-        /* update coefficient pointer */
-        pCoefB = pCoefB + (2U * modifier);
-        pCoefA = pCoefA + (2U * modifier);
+        q31_t br = pBuf[2U * k];
+        q31_t bi = pBuf[2U * k + 1U];
+        q31_t outR, outI;
+        q15_t coef[4];
+
+        arm_rfft_split_coef_q15(pTwiddle, pSplit, fftLen, modifier, i, coef);
+        arm_split_rfft_bin_q15(ar, ai, br, bi, &coef[0], &coef[2], &outR, &outI);
+        pBuf[2U * i] = (q15_t) outR;
+        pBuf[2U * i + 1U] = outI;
+
+        if (k != i)
+        {
+            /* modifier * k is half the table minus modifier * i: A and B are mirrored */
+            coef[1] = -coef[1];
+            coef[3] = -coef[3];
+            arm_split_rfft_bin_q15(br, bi, ar, ai, &coef[0], &coef[2], &outR, &outI);
+            pBuf[2U * k] = (q15_t) outR;
+            pBuf[2U * k + 1U] = outI;
+        }
     }
 
-    pDst[2U * fftLen]      = (pSrc[0] - pSrc[1]) >> 1U;
-    pDst[2U * fftLen + 1U] = 0;
+    pBuf[0] = (x0r + x0i) >> 1;
+    pBuf[1] = (x0r - x0i) >> 1;
+}
 
-    pDst[0] = (pSrc[0] + pSrc[1]) >> 1U;
-    pDst[1] = 0;
+/**
+ * @brief Real FFT with packed output, in place.
+ * @param[in]     S     points to a forward instance of the Q15 RFFT structure
+ * @param[in,out] pBuf  fftLenReal real input samples, packed spectrum on return
+ *
+ * The CFFT and the split step both run in pBuf, so no output buffer is
+ * needed. The bitReverseFlagR of S is ignored, the CFFT result is always
+ * reordered so the split step can pair X[i] with X[fftLen - i].
+ */
+RFFT_Q15_HOT void arm_rfft_q15_packed(
+  const arm_rfft_instance_q15 * S,
+        q15_t * pBuf)
+{
+    uint32_t L2 = S->fftLenReal >> 1U;
 
-#else
+    /* Complex FFT process, natural order result */
+    arm_cfft_q15(S->pCfft, pBuf, 0U, 1U);
+
+    /* Real FFT core process */
+    arm_split_rfft_q15_packed(pBuf, L2, S->pTwiddleAReal, S->pTwiddleBReal,
+                              S->twidCoefRModifier);
+    RFFT_PROFILE_MARK(RFFT_PROFILE_SPLIT);
+}
 
-    i = 1U;
+/**
+ * @brief Real FFT with a block floating point CFFT.
+ * @param[in]     S     points to a forward instance of the Q15 RFFT structure
+ * @param[in,out] pSrc  points to input buffer (modified by this function)
+ * @param[out]    pDst  points to output buffer
+ * @return block exponent e, the unscaled spectrum is pDst * 2^e
+ *
+ * Same output layout as arm_rfft_q15(). The CFFT only scales where the
+ * data needs it, see arm_cfft_q15_bfp(); the split step halves once more,
+ * which the returned exponent includes. The bitReverseFlagR of S is
+ * ignored, the split step needs the natural order.
+ */
+int32_t arm_rfft_q15_bfp(
+  const arm_rfft_instance_q15 * S,
+        q15_t * pSrc,
+        q15_t * pDst)
+{
+    uint32_t L2 = S->fftLenReal >> 1U;
+    int32_t exponent;
 
-    while (i < fftLen)
+    /* Complex FFT process, natural order result */
+    exponent = arm_cfft_q15_bfp(S->pCfft, pSrc, 0U, 1U);
+
+    /* Real FFT core process */
+    arm_split_rfft_q15(pSrc, L2, S->pTwiddleAReal, S->pTwiddleBReal, pDst,
+                       S->twidCoefRModifier);
+
+    return exponent + 1;
+}
+
+/**
+ * @brief Real FFT with packed output and a block floating point CFFT.
+ * @param[in]     S     points to a forward instance of the Q15 RFFT structure
+ * @param[in,out] pBuf  fftLenReal real input samples, packed spectrum on return
+ * @return block exponent e, the unscaled spectrum is pBuf * 2^e
+ *
+ * arm_rfft_q15_packed() with the CFFT of arm_rfft_q15_bfp().
+ */
+int32_t arm_rfft_q15_packed_bfp(
+  const arm_rfft_instance_q15 * S,
+        q15_t * pBuf)
+{
+    uint32_t L2 = S->fftLenReal >> 1U;
+    int32_t exponent;
+
+    /* Complex FFT process, natural order result */
+    exponent = arm_cfft_q15_bfp(S->pCfft, pBuf, 0U, 1U);
+
+    /* Real FFT core process */
+    arm_split_rfft_q15_packed(pBuf, L2, S->pTwiddleAReal, S->pTwiddleBReal,
+                              S->twidCoefRModifier);
+
+    return exponent + 1;
+}
+
+/*
+ * One output of arm_split_rifft_q15(): a = Y[i], b = Y[fftLen - i], with
+ * the split coefficients of i. Rounded: the truncation bias of every bin
+ * adds up in the first and last few output samples.
+ */
+static inline void arm_split_rifft_bin_q15(
+        q31_t ar,
+        q31_t ai,
+        q31_t br,
+        q31_t bi,
+  const q15_t * pCoef,
+        q15_t * pOut)
+{
+    q31_t outR, outI;
+
+    outR = br * pCoef[2];
+    outR = outR - (bi * pCoef[3]);
+    outR = outR + (ar * pCoef[0]);
+    outR = (outR + (ai * pCoef[1]) + 0x8000) >> 16;
+
+    outI = ai * pCoef[0];
+    outI = outI - (ar * pCoef[1]);
+    outI = outI - (br * pCoef[3]);
+    outI = outI - (bi * pCoef[2]);
+
+    pOut[0] = (q15_t) outR;
+    pOut[1] = (q15_t) ((outI + 0x8000) >> 16);
+}
+
+/**
+ * @brief Core Real IFFT process on a packed spectrum, in place
+ * @param[in,out] pBuf      packed spectrum, CFFT input on return
+ * @param[in]     fftLen    length of FFT
+ * @param[in]     pTwiddle  points to the shared twiddle table
+ * @param[in]     modifier  twiddle coefficient modifier
+ *
+ * Outputs i and fftLen - i are formed together from Y[i] and
+ * Y[fftLen - i], so each iteration only overwrites the two inputs it has
+ * just read. Y[0] and the Nyquist bin come from the first two values of
+ * the packed layout. Results are those of arm_split_rifft_q15() on the
+ * unpacked spectrum, rounded instead of truncated.
+ */
+static void arm_split_rifft_q15_packed(
+        q15_t * pBuf,
+        uint32_t fftLen,
+  const q15_t * pTwiddle,
+        uint32_t modifier)
+{
+    uint32_t i, k;
+    q15_t coef[4];
+
+    arm_rfft_coef_q15(pTwiddle, 0U, coef);
+    arm_split_rifft_bin_q15(pBuf[0], 0, pBuf[1], 0, coef, pBuf);
+
+    for (i = 1U; i <= (fftLen >> 1U); i++)
     {
-        /*
-          outR = (  pSrc[2 * i]             * pATable[2 * i]
-                  - pSrc[2 * i + 1]         * pATable[2 * i + 1]
-                  + pSrc[2 * n - 2 * i]     * pBTable[2 * i]
-                  + pSrc[2 * n - 2 * i + 1] * pBTable[2 * i + 1]);
-        */
+        q31_t ar = pBuf[2U * i];
+        q31_t ai = pBuf[2U * i + 1U];
 
-        outR = *pSrc1 * *pCoefA;
-        outR = outR - (*(pSrc1 + 1) * *(pCoefA + 1));
-        outR = outR + (*pSrc2 * *pCoefB);
-        outR = (outR + (*(pSrc2 + 1) * *(pCoefB + 1))) >> 16;
+        k = fftLen - i;
 
-        /*
-          outI = (  pIn[2 * i + 1]         * pATable[2 * i]
-                  + pIn[2 * i]             * pATable[2 * i + 1]
-                  + pIn[2 * n - 2 * i]     * pBTable[2 * i + 1]
-                  - pIn[2 * n - 2 * i + 1] * pBTable[2 * i]);
-        */
+        q31_t br = pBuf[2U * k];
+        q31_t bi = pBuf[2U * k + 1U];
 
-        outI = *pSrc2 * *(pCoefB + 1);
-        outI = outI - (*(pSrc2 + 1) * *pCoefB);
-        outI = outI + (*(pSrc1 + 1) * *pCoefA);
-        outI = outI + (*pSrc1 * *(pCoefA + 1));
+        arm_rfft_coef_q15(pTwiddle, modifier * i, coef);
+        arm_split_rifft_bin_q15(ar, ai, br, bi, coef, &pBuf[2U * i]);
 
-        /* update input pointers */
-        pSrc1 += 2U;
-        pSrc2 -= 2U;
+        if (k != i)
+        {
+            arm_rfft_coef_q15(pTwiddle, modifier * k, coef);
+            arm_split_rifft_bin_q15(br, bi, ar, ai, coef, &pBuf[2U * k]);
+        }
+    }
+}
 
-        /* write output */
-        pDst[2U * i] = (q15_t) outR;
-        pDst[2U * i + 1U] = outI >> 16U;
+/**
+ * @brief Real IFFT of a packed spectrum with a block floating point CFFT.
+ * @param[in]     S     points to an instance of the Q15 RFFT structure, the
+ *                      ifftFlagR of S is ignored
+ * @param[in,out] pBuf  packed spectrum, fftLenReal real samples on return
+ * @return block exponent e, the unscaled inverse transform, without
+ *         1/fftLenReal, is pBuf * 2^e
+ *
+ * The input layout is that of arm_rfft_q15_packed(). The split step and
+ * the CFFT both run in pBuf. arm_rfft_q15() scales its inverse by
+ * 1/fftLenReal whatever the level of the spectrum; here a spectrum that
+ * is much smaller than full scale keeps its bits, see arm_cfft_q15_bfp().
+ */
+int32_t arm_rifft_q15_packed_bfp(
+  const arm_rfft_instance_q15 * S,
+        q15_t * pBuf)
+{
+    uint32_t L2 = S->fftLenReal >> 1U;
 
-        /* write complex conjugate output */
-        pDst[(4U * fftLen) - (2U * i)] = (q15_t) outR;
-        pDst[((4U * fftLen) - (2U * i)) + 1U] = -(outI >> 16U);
+    /* Real IFFT core process */
+    arm_split_rifft_q15_packed(pBuf, L2, S->pTwiddleAReal, S->twidCoefRModifier);
+
+    /* Complex IFFT process, natural order result. The split step leaves a
+       quarter of the unscaled transform, arm_rfft_q15() shifts that back
+       together with the 1/fftLen of its CFFT. */
+    return arm_cfft_q15_bfp(S->pCfft, pBuf, 1U, 1U) + 2;
+}
+
+/* Magnitude squared of a bin as stored by arm_rfft_q15(). */
+static inline uint32_t arm_rfft_bin_mag_sq_q15(q15_t re, q15_t im)
+{
+    return (uint32_t) ((q31_t) re * re) + (uint32_t) ((q31_t) im * im);
+}
+
+/**
+ * @brief Real FFT reporting the magnitude squared of each bin.
+ * @param[in]     S     points to an instance of the Q15 RFFT structure
+ * @param[in,out] pSrc  points to input buffer (modified by this function)
+ * @param[in]     fn    called once per bin, bins 0 to fftLenReal / 2
+ * @param[in]     user  passed through to fn
+ *
+ * The CFFT runs in place without bit reversal. The split step then reads
+ * X[i] and X[fftLen - i] from their bit-reversed positions and hands each
+ * bin to fn as soon as it is formed, so neither a reordering pass nor the
+ * 2 * fftLenReal output buffer of arm_rfft_q15() is needed.
+ */
+RFFT_Q15_HOT void arm_rfft_q15_mag_sq(
+  const arm_rfft_instance_q15 * S,
+        q15_t * pSrc,
+        rfft_q15_bin_fn fn,
+        void * user)
+{
+    /* Complex FFT process, output left in bit-reversed order */
+    arm_cfft_q15(S->pCfft, pSrc, 0U, 0U);
+
+    arm_rfft_q15_mag_sq_split(S, pSrc, fn, user);
+}
+
+/**
+ * @brief Split step of arm_rfft_q15_mag_sq() on a bit-reversed CFFT result.
+ * @param[in]     S     points to an instance of the Q15 RFFT structure
+ * @param[in,out] pSrc  points to the result of the CFFT of S, not reordered
+ * @param[in]     fn    called once per bin, bins 0 to fftLenReal / 2
+ * @param[in]     user  passed through to fn
+ */
+RFFT_Q15_HOT void arm_rfft_q15_mag_sq_split(
+  const arm_rfft_instance_q15 * S,
+        q15_t * pSrc,
+        rfft_q15_bin_fn fn,
+        void * user)
+{
+    uint32_t L2 = S->fftLenReal >> 1U;
+    uint32_t modifier = S->twidCoefRModifier;
+    uint32_t i, r, rPrev;
+    q31_t outR, outI;
 
-        /* update coefficient pointer */
-        pCoefB = pCoefB + (2U * modifier);
-        pCoefA = pCoefA + (2U * modifier);
+    /* X[0] is at position 0 */
+    fn(0U, arm_rfft_bin_mag_sq_q15((q15_t) ((pSrc[0] + pSrc[1]) >> 1), 0), user);
 
-        i++;
+    /* r = bitrev(i); bitrev(L2 - i) = (L2 - 1) ^ bitrev(i - 1) */
+    rPrev = 0U;
+    r = rfft_bitrev_next(0U, L2 >> 1U);
+
+    for (i = 1U; i < L2; i++)
+    {
+        uint32_t k = (L2 - 1U) ^ rPrev;
+        q15_t coef[4];
+
+        uint32_t mag_sq;
+
+        arm_rfft_split_coef_q15(S->pTwiddleAReal, S->pTwiddleBReal, L2, modifier, i, coef);
+        arm_split_rfft_bin_q15(pSrc[2U * r], pSrc[2U * r + 1U],
+                               pSrc[2U * k], pSrc[2U * k + 1U],
+                               &coef[0], &coef[2], &outR, &outI);
+        RFFT_PROFILE_MARK(RFFT_PROFILE_SPLIT);
+
+        /* Marked per bin, the three steps are fused into this loop */
+        mag_sq = arm_rfft_bin_mag_sq_q15((q15_t) outR, (q15_t) outI);
+        RFFT_PROFILE_MARK(RFFT_PROFILE_MAG);
+
+        fn(i, mag_sq, user);
+        RFFT_PROFILE_MARK(RFFT_PROFILE_TOPK);
+
+        rPrev = r;
+        r = rfft_bitrev_next(r, L2 >> 1U);
     }
 
-    pDst[2U * fftLen] = (pSrc[0] - pSrc[1]) >> 1;
-    pDst[2U * fftLen + 1U] = 0;
+    fn(L2, arm_rfft_bin_mag_sq_q15((q15_t) ((pSrc[0] - pSrc[1]) >> 1), 0), user);
+}
 
-    pDst[0] = (pSrc[0] + pSrc[1]) >> 1;
-    pDst[1] = 0;
+/**
+ * @brief One bin of the spectrum behind the last arm_rfft_q15_mag_sq().
+ * @param[in]     S     points to the instance passed to arm_rfft_q15_mag_sq()
+ * @param[in]     pSrc  points to the buffer it transformed, still holding the CFFT result
+ * @param[in]     bin   bin index, 0 to fftLenReal / 2
+ * @param[out]    pOut  real and imaginary part, both as arm_rfft_q15() outputs them
+ *
+ * Forms the bin with the split step of arm_rfft_q15_mag_sq(), so the
+ * value matches the magnitude squared it reported. Costs a bit reversal
+ * and one split butterfly, for the few bins worth a closer look.
+ */
+RFFT_Q15_HOT void arm_rfft_q15_mag_sq_bin(
+  const arm_rfft_instance_q15 * S,
+  const q15_t * pSrc,
+        uint32_t bin,
+        q15_t * pOut)
+{
+    uint32_t L2 = S->fftLenReal >> 1U;
+    uint32_t r = 0U, k = 0U, b;
+    q31_t outR, outI;
+    q15_t coef[4];
 
-#endif /* #if defined (ARM_MATH_DSP) */
+    if (bin == 0U || bin == L2)
+    {
+        pOut[0] = (q15_t) ((bin == 0U) ? ((pSrc[0] + pSrc[1]) >> 1) : ((pSrc[0] - pSrc[1]) >> 1));
+        pOut[1] = 0;
+        return;
+    }
+
+    /* r = bitrev(bin), k = bitrev(L2 - bin) = (L2 - 1) ^ bitrev(bin - 1) */
+    for (b = 1U; b < L2; b <<= 1U)
+    {
+        r = (r << 1U) | ((bin & b) ? 1U : 0U);
+        k = (k << 1U) | (((bin - 1U) & b) ? 1U : 0U);
+    }
+    k ^= L2 - 1U;
+
+    arm_rfft_split_coef_q15(S->pTwiddleAReal, S->pTwiddleBReal, L2, S->twidCoefRModifier,
+                            bin, coef);
+    arm_split_rfft_bin_q15(pSrc[2U * r], pSrc[2U * r + 1U],
+                           pSrc[2U * k], pSrc[2U * k + 1U],
+                           &coef[0], &coef[2], &outR, &outI);
+
+    pOut[0] = (q15_t) outR;
+    pOut[1] = (q15_t) outI;
 }
 
+#if defined (RFFT_Q15_STOCKHAM)
+/**
+ * @brief Real FFT reporting the magnitude squared of each bin, Stockham CFFT.
+ * @param[in]     S     points to an instance of the Q15 RFFT structure
+ * @param[in,out] pSrc  points to input buffer (modified by this function)
+ * @param[in,out] pBuf  points to a second buffer of fftLenReal values
+ * @param[in]     fn    called once per bin, bins 0 to fftLenReal / 2
+ * @param[in]     user  passed through to fn
+ *
+ * The split step of arm_rfft_q15_mag_sq_split() on the natural order
+ * result: X[i] is read front to back and X[fftLen - i] back to front.
+ */
+RFFT_Q15_HOT void arm_rfft_q15_mag_sq_stockham(
+  const arm_rfft_instance_q15 * S,
+        q15_t * pSrc,
+        q15_t * pBuf,
+        rfft_q15_bin_fn fn,
+        void * user)
+{
+    uint32_t L2 = S->fftLenReal >> 1U;
+    uint32_t modifier = S->twidCoefRModifier;
+    const q15_t *pA, *pB;
+    uint32_t i;
+    q31_t outR, outI;
+
+    pA = arm_cfft_q15_stockham(S->pCfft, pSrc, pBuf);
+
+    fn(0U, arm_rfft_bin_mag_sq_q15((q15_t) ((pA[0] + pA[1]) >> 1), 0), user);
+
+    pB = &pA[2U * (L2 - 1U)];
+    pA += 2U;
+
+    for (i = 1U; i < L2; i++)
+    {
+        q15_t coef[4];
+        uint32_t mag_sq;
+
+        arm_rfft_split_coef_q15(S->pTwiddleAReal, S->pTwiddleBReal, L2, modifier, i, coef);
+        arm_split_rfft_bin_q15(pA[0], pA[1], pB[0], pB[1],
+                               &coef[0], &coef[2], &outR, &outI);
+        RFFT_PROFILE_MARK(RFFT_PROFILE_SPLIT);
+
+        mag_sq = arm_rfft_bin_mag_sq_q15((q15_t) outR, (q15_t) outI);
+        RFFT_PROFILE_MARK(RFFT_PROFILE_MAG);
+
+        fn(i, mag_sq, user);
+        RFFT_PROFILE_MARK(RFFT_PROFILE_TOPK);
+
+        pA += 2U;
+        pB -= 2U;
+    }
+
+    /* pB is back at X[0] */
+    fn(L2, arm_rfft_bin_mag_sq_q15((q15_t) ((pB[0] - pB[1]) >> 1), 0), user);
+}
+
+/**
+ * @brief One bin of the spectrum behind the last arm_rfft_q15_mag_sq_stockham().
+ * @param[in]     S     points to the instance passed to arm_rfft_q15_mag_sq_stockham()
+ * @param[in]     pSrc  points to the input buffer it was given
+ * @param[in]     pBuf  points to the work buffer it was given
+ * @param[in]     bin   bin index, 0 to fftLenReal / 2
+ * @param[out]    pOut  real and imaginary part, both as arm_rfft_q15() outputs them
+ */
+RFFT_Q15_HOT void arm_rfft_q15_mag_sq_stockham_bin(
+  const arm_rfft_instance_q15 * S,
+  const q15_t * pSrc,
+  const q15_t * pBuf,
+        uint32_t bin,
+        q15_t * pOut)
+{
+    uint32_t L2 = S->fftLenReal >> 1U;
+    const q15_t *pX = RFFT_Q15_STOCKHAM_IN_BUF(L2) ? pBuf : pSrc;
+    q31_t outR, outI;
+    q15_t coef[4];
+
+    if (bin == 0U || bin == L2)
+    {
+        pOut[0] = (q15_t) ((bin == 0U) ? ((pX[0] + pX[1]) >> 1) : ((pX[0] - pX[1]) >> 1));
+        pOut[1] = 0;
+        return;
+    }
+
+    arm_rfft_split_coef_q15(S->pTwiddleAReal, S->pTwiddleBReal, L2, S->twidCoefRModifier,
+                            bin, coef);
+    arm_split_rfft_bin_q15(pX[2U * bin], pX[2U * bin + 1U],
+                           pX[2U * (L2 - bin)], pX[2U * (L2 - bin) + 1U],
+                           &coef[0], &coef[2], &outR, &outI);
+
+    pOut[0] = (q15_t) outR;
+    pOut[1] = (q15_t) outI;
+}
+#endif
+
 /**
  * @brief Core Real IFFT process
  * @param[in]     pSrc      points to input buffer
  * @param[in]     fftLen    length of FFT
- * @param[in]     pATable   points to twiddle Coef A buffer
- * @param[in]     pBTable   points to twiddle Coef B buffer
+ * @param[in]     pTwiddle  points to the shared twiddle table
  * @param[out]    pDst      points to output buffer
  * @param[in]     modifier  twiddle coefficient modifier
  */
 static void arm_split_rifft_q15(
         q15_t * pSrc,
         uint32_t fftLen,
-  const q15_t * pATable,
-  const q15_t * pBTable,
+  const q15_t * pTwiddle,
         q15_t * pDst,
         uint32_t modifier)
 {
     uint32_t i;
     q31_t outR, outI;
-    const q15_t *pCoefA, *pCoefB;
+    q15_t coef[4] RFFT_Q15_ALIGN;
+    const q15_t *pCoefA = &coef[0];
+    const q15_t *pCoefB = &coef[2];
     q15_t *pSrc1, *pSrc2;
     q15_t *pDst1 = &pDst[0];
 
-    pCoefA = &pATable[0];
-    pCoefB = &pBTable[0];
-
     pSrc1 = &pSrc[0];
     pSrc2 = &pSrc[2 * fftLen];
 
@@ -279,6 +801,8 @@ static void arm_split_rifft_q15(
                   - pIn[2 * n - 2 * i + 1] * pBTable[2 * i]);
          */
 
+        arm_rfft_coef_q15(pTwiddle, modifier * (fftLen - i), coef);
+
 #if defined (ARM_MATH_DSP)
 
 #ifndef ARM_MATH_BIG_ENDIAN
@@ -336,10 +860,6 @@ static void arm_split_rifft_q15(
 
 #endif /* #if defined (ARM_MATH_DSP) */
 
-        /* update coefficient pointer */
-        pCoefB = pCoefB + (2 * modifier);
-        pCoefA = pCoefA + (2 * modifier);
-
         i--;
     }
 }
@@ -0,0 +1,339 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library - Simplified Q15 RFFT
+ * Title:        rfft_q15_backend.h
+ * Description:  Intrinsic backend of the Q15 FFT library for each target
+ *
+ * Target Processor: ARM Cortex-M33, nRF54L15 FLPR (RISC-V), host
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2021 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * The FFT sources have two code paths, ARM_MATH_DSP and scalar, and leave
+ * everything that depends on the instruction set to this header. The
+ * targets they are built and benchmarked for:
+ *
+ *   RFFT_Q15_BACKEND  Selected by                Intrinsics
+ *   "dsp"             ARM_MATH_DSP (Cortex-M33)  CMSIS-Core, cmsis_compiler.h
+ *   "dsp-emulated"    RFFT_Q15_DSP_EMULATION     rfft_q15_qadd16() and the rest
+ *   "zbb"             __riscv_zbb (FLPR)         min, max and minu instructions
+ *   "scalar"          otherwise (FLPR, host)     portable branchless C
+ *
+ * "dsp-emulated" runs the ARM_MATH_DSP code paths on any core, the host
+ * tests check them against the scalar ones. Included by
+ * rfft_q15_simplified.h once q15_t and q31_t are defined, not on its own.
+ */
+
+#ifndef RFFT_Q15_BACKEND_H
+#define RFFT_Q15_BACKEND_H
+
+/*
+ * RFFT_Q15_DSP_EMULATION builds the ARM_MATH_DSP code paths on a core
+ * without the DSP extension, on the portable intrinsics of the DSP
+ * Intrinsic Emulation section below.
+ */
+#if defined(RFFT_Q15_DSP_EMULATION) && !defined(ARM_MATH_DSP)
+#define ARM_MATH_DSP
+#endif
+
+#if defined(ARM_MATH_MVEI) || defined(ARM_MATH_NEON)
+#error "The Helium and Neon code paths of CMSIS-DSP are not part of this library"
+#endif
+
+/* ========================================================================= */
+/* DSP Intrinsics Compatibility                                              */
+/* ========================================================================= */
+
+#if defined (ARM_MATH_DSP) && !defined (RFFT_Q15_DSP_EMULATION)
+/* DSP intrinsics are available - use CMSIS-Core definitions */
+#include "cmsis_compiler.h"
+#endif /* ARM_MATH_DSP */
+
+/* ========================================================================= */
+/* Scalar Kernel Layer                                                       */
+/* ========================================================================= */
+
+/*
+ * Saturation, min and max for cores without the DSP extension. With the
+ * Zbb extension (the compiler defines __riscv_zbb, on Zephyr from
+ * CONFIG_RISCV_ISA_EXT_ZBB) they are the min, max, minu and maxu
+ * instructions, a saturation two of them. Otherwise they are portable and
+ * branchless: a compare into 0 or 1 and a mask, so a butterfly has no
+ * data-dependent branch. Define RFFT_Q15_PORTABLE_KERNELS to use the
+ * portable code on a Zbb core as well.
+ */
+#if defined(__riscv_zbb) && !defined(RFFT_Q15_PORTABLE_KERNELS)
+#define RFFT_Q15_ZBB_KERNELS
+#endif
+
+/* x where mask is 0, y where it is all ones. */
+static inline q31_t rfft_q15_select(q31_t x, q31_t y, q31_t mask)
+{
+    return x ^ ((x ^ y) & mask);
+}
+
+static inline q31_t rfft_q15_min(q31_t a, q31_t b)
+{
+#if defined(RFFT_Q15_ZBB_KERNELS)
+    q31_t r;
+
+    __asm__ ("min %0, %1, %2" : "=r" (r) : "r" (a), "r" (b));
+    return r;
+#else
+    return rfft_q15_select(a, b, -(q31_t) (b < a));
+#endif
+}
+
+static inline q31_t rfft_q15_max(q31_t a, q31_t b)
+{
+#if defined(RFFT_Q15_ZBB_KERNELS)
+    q31_t r;
+
+    __asm__ ("max %0, %1, %2" : "=r" (r) : "r" (a), "r" (b));
+    return r;
+#else
+    return rfft_q15_select(a, b, -(q31_t) (b > a));
+#endif
+}
+
+static inline uint32_t rfft_q15_minu(uint32_t a, uint32_t b)
+{
+#if defined(RFFT_Q15_ZBB_KERNELS)
+    uint32_t r;
+
+    __asm__ ("minu %0, %1, %2" : "=r" (r) : "r" (a), "r" (b));
+    return r;
+#else
+    return (uint32_t) rfft_q15_select((q31_t) a, (q31_t) b, -(q31_t) (b < a));
+#endif
+}
+
+/**
+ * @brief Saturate x to a signed bits-bit range, as __SSAT of CMSIS-Core
+ * @param[in] x     value to saturate
+ * @param[in] bits  width of the result, 1 to 31, a constant in practice
+ */
+static inline q31_t rfft_q15_ssat(q31_t x, uint32_t bits)
+{
+    const q31_t hi = (q31_t) ((1U << (bits - 1U)) - 1U);
+
+#if defined(RFFT_Q15_ZBB_KERNELS)
+    return rfft_q15_min(rfft_q15_max(x, -hi - 1), hi);
+#else
+    /* Out of range unless x + 2^(bits-1) fits bits unsigned bits. */
+    q31_t over = -(q31_t) ((uint32_t) x + (uint32_t) hi + 1U > 2U * (uint32_t) hi + 1U);
+
+    return rfft_q15_select(x, hi ^ (x >> 31), over);
+#endif
+}
+
+/* ========================================================================= */
+/* DSP Intrinsic Emulation                                                   */
+/* ========================================================================= */
+
+/*
+ * Packed halfword arithmetic on 32-bit words, with the semantics of the
+ * Cortex-M DSP instructions: the low half of a word is one Q15 value, the
+ * high half another. Saturation goes through rfft_q15_ssat(), so these are
+ * branchless as well. With RFFT_Q15_DSP_EMULATION they stand in for the
+ * CMSIS-Core intrinsics, as CMSIS-DSP does for hosts.
+ */
+#define RFFT_Q15_LO(x)          ((q31_t) (q15_t) (x))
+#define RFFT_Q15_HI(x)          ((q31_t) (x) >> 16)
+
+static inline q31_t rfft_q15_pack16(q31_t lo, q31_t hi)
+{
+    return (q31_t) (((uint32_t) hi << 16) | ((uint32_t) lo & 0xFFFFU));
+}
+
+/* Of each half: a + b, saturated. */
+static inline q31_t rfft_q15_qadd16(q31_t a, q31_t b)
+{
+    return rfft_q15_pack16(rfft_q15_ssat(RFFT_Q15_LO(a) + RFFT_Q15_LO(b), 16U),
+                           rfft_q15_ssat(RFFT_Q15_HI(a) + RFFT_Q15_HI(b), 16U));
+}
+
+/* Of each half: a - b, saturated. */
+static inline q31_t rfft_q15_qsub16(q31_t a, q31_t b)
+{
+    return rfft_q15_pack16(rfft_q15_ssat(RFFT_Q15_LO(a) - RFFT_Q15_LO(b), 16U),
+                           rfft_q15_ssat(RFFT_Q15_HI(a) - RFFT_Q15_HI(b), 16U));
+}
+
+/* Of each half: (a + b) / 2, which cannot overflow. */
+static inline q31_t rfft_q15_shadd16(q31_t a, q31_t b)
+{
+    return rfft_q15_pack16((RFFT_Q15_LO(a) + RFFT_Q15_LO(b)) >> 1,
+                           (RFFT_Q15_HI(a) + RFFT_Q15_HI(b)) >> 1);
+}
+
+/* Of each half: (a - b) / 2. */
+static inline q31_t rfft_q15_shsub16(q31_t a, q31_t b)
+{
+    return rfft_q15_pack16((RFFT_Q15_LO(a) - RFFT_Q15_LO(b)) >> 1,
+                           (RFFT_Q15_HI(a) - RFFT_Q15_HI(b)) >> 1);
+}
+
+/* Low a.lo - b.hi, high a.hi + b.lo, saturated. */
+static inline q31_t rfft_q15_qasx(q31_t a, q31_t b)
+{
+    return rfft_q15_pack16(rfft_q15_ssat(RFFT_Q15_LO(a) - RFFT_Q15_HI(b), 16U),
+                           rfft_q15_ssat(RFFT_Q15_HI(a) + RFFT_Q15_LO(b), 16U));
+}
+
+/* Low a.lo + b.hi, high a.hi - b.lo, saturated. */
+static inline q31_t rfft_q15_qsax(q31_t a, q31_t b)
+{
+    return rfft_q15_pack16(rfft_q15_ssat(RFFT_Q15_LO(a) + RFFT_Q15_HI(b), 16U),
+                           rfft_q15_ssat(RFFT_Q15_HI(a) - RFFT_Q15_LO(b), 16U));
+}
+
+/* rfft_q15_qasx() halved instead of saturated. */
+static inline q31_t rfft_q15_shasx(q31_t a, q31_t b)
+{
+    return rfft_q15_pack16((RFFT_Q15_LO(a) - RFFT_Q15_HI(b)) >> 1,
+                           (RFFT_Q15_HI(a) + RFFT_Q15_LO(b)) >> 1);
+}
+
+/* rfft_q15_qsax() halved instead of saturated. */
+static inline q31_t rfft_q15_shsax(q31_t a, q31_t b)
+{
+    return rfft_q15_pack16((RFFT_Q15_LO(a) + RFFT_Q15_HI(b)) >> 1,
+                           (RFFT_Q15_HI(a) - RFFT_Q15_LO(b)) >> 1);
+}
+
+/* Dual multiplies, added or subtracted in 32 bits with wrap-around. */
+static inline q31_t rfft_q15_smuad(q31_t a, q31_t b)
+{
+    return (q31_t) ((uint32_t) (RFFT_Q15_LO(a) * RFFT_Q15_LO(b)) +
+                    (uint32_t) (RFFT_Q15_HI(a) * RFFT_Q15_HI(b)));
+}
+
+static inline q31_t rfft_q15_smuadx(q31_t a, q31_t b)
+{
+    return (q31_t) ((uint32_t) (RFFT_Q15_LO(a) * RFFT_Q15_HI(b)) +
+                    (uint32_t) (RFFT_Q15_HI(a) * RFFT_Q15_LO(b)));
+}
+
+static inline q31_t rfft_q15_smusd(q31_t a, q31_t b)
+{
+    return (q31_t) ((uint32_t) (RFFT_Q15_LO(a) * RFFT_Q15_LO(b)) -
+                    (uint32_t) (RFFT_Q15_HI(a) * RFFT_Q15_HI(b)));
+}
+
+static inline q31_t rfft_q15_smusdx(q31_t a, q31_t b)
+{
+    return (q31_t) ((uint32_t) (RFFT_Q15_LO(a) * RFFT_Q15_HI(b)) -
+                    (uint32_t) (RFFT_Q15_HI(a) * RFFT_Q15_LO(b)));
+}
+
+/* a - b in 32 bits, saturated. */
+static inline q31_t rfft_q15_qsub(q31_t a, q31_t b)
+{
+    q31_t r = (q31_t) ((uint32_t) a - (uint32_t) b);
+
+    /* Overflow when the operands differ in sign and the sign of the result is not a's. */
+    return rfft_q15_select(r, INT32_MAX ^ (a >> 31), ((a ^ b) & (a ^ r)) >> 31);
+}
+
+#if defined (RFFT_Q15_DSP_EMULATION)
+#define __QADD16(a, b)          rfft_q15_qadd16((a), (b))
+#define __QSUB16(a, b)          rfft_q15_qsub16((a), (b))
+#define __SHADD16(a, b)         rfft_q15_shadd16((a), (b))
+#define __SHSUB16(a, b)         rfft_q15_shsub16((a), (b))
+#define __QASX(a, b)            rfft_q15_qasx((a), (b))
+#define __QSAX(a, b)            rfft_q15_qsax((a), (b))
+#define __SHASX(a, b)           rfft_q15_shasx((a), (b))
+#define __SHSAX(a, b)           rfft_q15_shsax((a), (b))
+#define __SMUAD(a, b)           rfft_q15_smuad((a), (b))
+#define __SMUADX(a, b)          rfft_q15_smuadx((a), (b))
+#define __SMUSD(a, b)           rfft_q15_smusd((a), (b))
+#define __SMUSDX(a, b)          rfft_q15_smusdx((a), (b))
+#define __SMLAD(a, b, c)        ((q31_t) ((uint32_t) rfft_q15_smuad((a), (b)) + (uint32_t) (c)))
+#define __SMLADX(a, b, c)       ((q31_t) ((uint32_t) rfft_q15_smuadx((a), (b)) + (uint32_t) (c)))
+#define __SMLSDX(a, b, c)       ((q31_t) ((uint32_t) rfft_q15_smusdx((a), (b)) + (uint32_t) (c)))
+#define __QSUB(a, b)            rfft_q15_qsub((a), (b))
+#define __PKHBT(a, b, s)        ((q31_t) (((uint32_t) (a) & 0xFFFFU) | \
+                                          (((uint32_t) (b) << (s)) & 0xFFFF0000U)))
+#endif
+
+#if defined (RFFT_Q15_DSP_EMULATION) || !defined (ARM_MATH_DSP)
+#define __SSAT(val, bits)       rfft_q15_ssat((q31_t) (val), (bits))
+#endif
+
+/*
+ * Reading/writing Q15 pairs as one 32-bit word, as arm_math_memory.h of
+ * CMSIS-DSP: the _ia and _da forms take the address of the pointer and
+ * step it by one pair. memcpy() compiles to a single load or store.
+ */
+static inline q31_t read_q15x2(const q15_t *pQ15)
+{
+    q31_t val;
+
+    memcpy(&val, pQ15, sizeof(val));
+    return val;
+}
+
+static inline q31_t read_q15x2_ia(q15_t **pQ15)
+{
+    q31_t val;
+
+    memcpy(&val, *pQ15, sizeof(val));
+    *pQ15 += 2;
+    return val;
+}
+
+static inline q31_t read_q15x2_da(q15_t **pQ15)
+{
+    q31_t val;
+
+    memcpy(&val, *pQ15, sizeof(val));
+    *pQ15 -= 2;
+    return val;
+}
+
+static inline void write_q15x2(q15_t *pQ15, q31_t value)
+{
+    memcpy(pQ15, &value, sizeof(value));
+}
+
+static inline void write_q15x2_ia(q15_t **pQ15, q31_t value)
+{
+    memcpy(*pQ15, &value, sizeof(value));
+    *pQ15 += 2;
+}
+
+/* ========================================================================= */
+/* Butterfly Selection                                                       */
+/* ========================================================================= */
+
+/*
+ * RFFT_Q15_PACKED_BUTTERFLY selects a forward radix-4 butterfly for cores
+ * without the DSP extension that moves every complex sample as one 32-bit
+ * word and loads each input once. Its output is bit-exact with the generic
+ * scalar butterfly. It is the default on RISC-V (nRF54L15 FLPR); define
+ * RFFT_Q15_GENERIC_BUTTERFLY to keep the generic code.
+ *
+ * The CFFT buffer must be 4-byte aligned when it is enabled, see
+ * RFFT_Q15_ALIGN.
+ */
+#if !defined(ARM_MATH_DSP) && defined(__riscv) && \
+    !defined(RFFT_Q15_GENERIC_BUTTERFLY) && !defined(RFFT_Q15_PACKED_BUTTERFLY)
+#define RFFT_Q15_PACKED_BUTTERFLY
+#endif
+
+/* Name of the backend, which the benchmarks report with their results. */
+#if defined(RFFT_Q15_DSP_EMULATION)
+#define RFFT_Q15_BACKEND  "dsp-emulated"
+#elif defined(ARM_MATH_DSP)
+#define RFFT_Q15_BACKEND  "dsp"
+#elif defined(RFFT_Q15_ZBB_KERNELS)
+#define RFFT_Q15_BACKEND  "zbb"
+#else
+#define RFFT_Q15_BACKEND  "scalar"
+#endif
+
+#endif /* RFFT_Q15_BACKEND_H */
@@ -15,6 +15,8 @@
 #define RFFT_Q15_H
 
 #include <stdint.h>
+#include <string.h>
+#include "rfft_profile.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -69,23 +71,80 @@ typedef struct {
     uint8_t ifftFlagR;                        /**< flag that selects forward (ifftFlagR=0) or inverse (ifftFlagR=1) transform. */
     uint8_t bitReverseFlagR;                  /**< flag that enables (bitReverseFlagR=1) or disables (bitReverseFlagR=0) bit reversal of output. */
     uint32_t twidCoefRModifier;               /**< twiddle coefficient modifier that supports different size FFTs with the same twiddle factor table. */
-    const q15_t *pTwiddleAReal;               /**< points to the real twiddle factor table. */
-    const q15_t *pTwiddleBReal;               /**< points to the imag twiddle factor table. */
+    const q15_t *pTwiddleAReal;               /**< points to the twiddle table the split coefficients are derived from. */
+    const q15_t *pTwiddleBReal;               /**< split coefficients of this length (RFFT_Q15_SPLIT_TABLES), or NULL: B is derived together with A. */
     const arm_cfft_instance_q15 *pCfft;       /**< points to the complex FFT instance. */
 } arm_rfft_instance_q15;
 
+/* ========================================================================= */
+/* Intrinsic Backend                                                         */
+/* ========================================================================= */
+
+#include "rfft_q15_backend.h"
+
+/* ========================================================================= */
+/* Supported Lengths                                                         */
+/* ========================================================================= */
+
+/*
+ * RFFT lengths that are built in: the powers of two from
+ * RFFT_Q15_MIN_FFT_LEN to RFFT_Q15_MAX_FFT_LEN, within 32 to 8192.
+ * twiddle_tables.c must be generated for the same range by gen_tables.py.
+ * Both values must be plain decimal literals, the table names are pasted
+ * from them.
+ */
+#ifndef RFFT_Q15_MIN_FFT_LEN
+#define RFFT_Q15_MIN_FFT_LEN  4096
+#endif
+
+/* ENABLE_FFT_8K predates RFFT_Q15_MAX_FFT_LEN and selects 8192 */
+#ifndef RFFT_Q15_MAX_FFT_LEN
+#ifdef ENABLE_FFT_8K
+#define RFFT_Q15_MAX_FFT_LEN  8192
+#else
+#define RFFT_Q15_MAX_FFT_LEN  4096
+#endif
+#endif
+
+#if (RFFT_Q15_MIN_FFT_LEN & (RFFT_Q15_MIN_FFT_LEN - 1)) != 0 || \
+    (RFFT_Q15_MAX_FFT_LEN & (RFFT_Q15_MAX_FFT_LEN - 1)) != 0 || \
+    RFFT_Q15_MIN_FFT_LEN < 32 || RFFT_Q15_MAX_FFT_LEN > 8192 || \
+    RFFT_Q15_MIN_FFT_LEN > RFFT_Q15_MAX_FFT_LEN
+#error "RFFT_Q15_MIN_FFT_LEN and RFFT_Q15_MAX_FFT_LEN must be powers of two from 32 to 8192"
+#endif
+
+/** Nonzero when n-point RFFTs are built in, usable in #if */
+#define RFFT_Q15_HAS_LEN(n)  ((n) >= RFFT_Q15_MIN_FFT_LEN && (n) <= RFFT_Q15_MAX_FFT_LEN)
+
 /* ========================================================================= */
 /* Public API Functions                                                      */
 /* ========================================================================= */
 
+/**
+ * @brief Prebuilt forward RFFT instance of a given length.
+ * @param[in] fftLenReal  RFFT length
+ * @return Instance, or NULL when fftLenReal is not built in
+ */
+const arm_rfft_instance_q15 *rfft_q15_get_instance(uint32_t fftLenReal);
+
+/**
+ * @brief Initialize RFFT instance of a given length.
+ * @param[out] S           Pointer to RFFT instance structure
+ * @param[in]  fftLenReal  RFFT length, a built-in power of two
+ * @return Status code, RFFT_ERROR_INVALID_SIZE when fftLenReal is not built in
+ */
+rfft_status_t rfft_q15_init(arm_rfft_instance_q15 *S, uint32_t fftLenReal);
+
+#if RFFT_Q15_HAS_LEN(4096)
 /**
  * @brief Initialize RFFT instance for 4096-point FFT.
  * @param[out] S  Pointer to RFFT instance structure
  * @return Status code
  */
 rfft_status_t rfft_q15_init_4096(arm_rfft_instance_q15 *S);
+#endif
 
-#ifdef ENABLE_FFT_8K
+#if RFFT_Q15_HAS_LEN(8192)
 /**
  * @brief Initialize RFFT instance for 8192-point FFT.
  * @param[out] S  Pointer to RFFT instance structure
@@ -94,6 +153,122 @@ rfft_status_t rfft_q15_init_4096(arm_rfft_instance_q15 *S);
 rfft_status_t rfft_q15_init_8192(arm_rfft_instance_q15 *S);
 #endif
 
+/**
+ * @brief Fill the SRAM twiddle table of the prebuilt instances.
+ *
+ * Copies or computes the table of RFFT_Q15_LAZY_TWIDDLES or
+ * RFFT_Q15_RUNTIME_TWIDDLES on the first call, which
+ * rfft_q15_get_instance() and the init functions make. Code that reads
+ * RFFT_TWIDDLE_TABLE before any of them has to call it first. Does
+ * nothing in other builds. The first call must not race another.
+ */
+void rfft_q15_twiddles_init(void);
+
+/**
+ * @brief Compute the shared twiddle table, bit-exact with the generated one.
+ * @param[out] table  RFFT_TWIDDLE_TABLE_ENTRIES values
+ */
+void rfft_q15_twiddles_generate(q15_t *table);
+
+/** RFFT instance with the CFFT instance it points to, see rfft_plan_create(). */
+typedef struct {
+    arm_rfft_instance_q15 rfft;  /**< Instance to pass to the transforms */
+    arm_cfft_instance_q15 cfft;
+} rfft_q15_plan_t;
+
+/** Arena of rfft_plan_create(), in q15_t: the twiddles, and the bit reversal with DSP. */
+#if defined(ARM_MATH_DSP) && !defined(RFFT_Q15_NO_BITREV_TABLES)
+#define RFFT_Q15_PLAN_ARENA_LEN  (RFFT_TWIDDLE_TABLE_ENTRIES + RFFT_Q15_MAX_FFT_LEN / 2)
+#else
+#define RFFT_Q15_PLAN_ARENA_LEN  RFFT_TWIDDLE_TABLE_ENTRIES
+#endif
+
+/**
+ * @brief Set up an RFFT on tables computed into a caller-provided arena.
+ * @param[out] plan        Plan to set up, pass &plan->rfft to the transforms
+ * @param[in]  fftLenReal  RFFT length, a power of two from 32 to
+ *                         RFFT_Q15_MAX_FFT_LEN, built in or not
+ * @param[out] arena       Tables, at least RFFT_Q15_PLAN_ARENA_LEN values,
+ *                         used by the plan for as long as it is
+ * @param[in]  arena_len   Values in arena
+ * @return Status code
+ *
+ * Takes no generated constants, the alternative to the prebuilt
+ * instances to call at startup or when the FFT size changes.
+ */
+rfft_status_t rfft_plan_create(rfft_q15_plan_t *plan, uint32_t fftLenReal,
+                               q15_t *arena, uint32_t arena_len);
+
+/** Stages of a mixed radix CFFT at most, 7 for lengths up to 8192. */
+#define RFFT_MIXED_MAX_STAGES  8
+
+/**
+ * @brief RFFT of a length with factors 3 and 5, see rfft_mixed_plan_create().
+ *
+ * The CFFT of fftLenReal / 2 points runs one Stockham stage per factor,
+ * radix 4 while it divides, then 2, 3 and 5, each scaled by 1/radix as
+ * the power of two CFFT is.
+ */
+typedef struct {
+    uint16_t fftLenReal;                    /**< N = 2^a * 3^b * 5^c, a >= 2 */
+    uint8_t numStages;                      /**< Stages of the N / 2 point CFFT */
+    uint8_t radix[RFFT_MIXED_MAX_STAGES];   /**< Radix of each stage, in order */
+    const q15_t *pSin;                      /**< sin(2*pi*k/N) for k = 0 to N / 4 */
+} rfft_mixed_q15_t;
+
+/** Arena of rfft_mixed_plan_create(), in q15_t: the quarter-wave sine table. */
+#define RFFT_MIXED_ARENA_LEN(fftLenReal)  ((fftLenReal) / 4U + 1U)
+
+/**
+ * @brief Set up an RFFT of a length that is not a power of two.
+ * @param[out] plan        Plan to set up
+ * @param[in]  fftLenReal  RFFT length from 32 to 8192, 2^a * 3^b * 5^c
+ *                         with a >= 2, e.g. 480, 3000 or 6000
+ * @param[out] arena       Sine table, at least RFFT_MIXED_ARENA_LEN(fftLenReal)
+ *                         values, used by the plan for as long as it is
+ * @param[in]  arena_len   Values in arena
+ * @return Status code
+ *
+ * Frames of 3000 samples no longer have to be padded to 4096. The sine
+ * is computed as rfft_q15_twiddles_generate() does, from a step that a
+ * Taylor series gives in Q62, so no length needs a generated table.
+ * Powers of two are accepted as well, but their prebuilt instances are
+ * faster.
+ */
+rfft_status_t rfft_mixed_plan_create(rfft_mixed_q15_t *plan, uint32_t fftLenReal,
+                                     q15_t *arena, uint32_t arena_len);
+
+/**
+ * @brief cos and sin of 2*pi*k/N from the quarter wave of a mixed plan.
+ * @param[in]  S     Mixed radix plan
+ * @param[in]  k     Index, below S->fftLenReal
+ * @param[out] pCos  cos(2*pi*k/N) in Q15
+ * @param[out] pSin  sin(2*pi*k/N) in Q15
+ */
+static inline void rfft_mixed_twiddle(const rfft_mixed_q15_t *S, uint32_t k,
+                                      q15_t *pCos, q15_t *pSin)
+{
+    uint32_t q = S->fftLenReal / 4U;
+    const q15_t *t = S->pSin;
+
+    if (k <= q) {
+        *pCos = t[q - k];
+        *pSin = t[k];
+    } else if (k <= 2U * q) {
+        k -= q;
+        *pCos = (q15_t) -t[k];
+        *pSin = t[q - k];
+    } else if (k <= 3U * q) {
+        k -= 2U * q;
+        *pCos = (q15_t) -t[q - k];
+        *pSin = (q15_t) -t[k];
+    } else {
+        k -= 3U * q;
+        *pCos = t[k];
+        *pSin = (q15_t) -t[q - k];
+    }
+}
+
 /**
  * @brief Process real FFT on Q15 data.
  * @param[in]  S     Pointer to RFFT instance structure
@@ -105,6 +280,65 @@ void arm_rfft_q15(
     q15_t * pSrc,
     q15_t * pDst);
 
+/**
+ * @brief Process real FFT on Q15 data in place, with packed output.
+ * @param[in]     S     Pointer to a forward RFFT instance structure
+ * @param[in,out] pBuf  fftLenReal input samples, overwritten by the spectrum
+ *
+ * @note Output uses the CMSIS packed layout of fftLenReal Q15 values:
+ *       [real0, realN/2, real1, imag1, ..., realN/2-1, imagN/2-1].
+ *       Bins 0 and N/2 are purely real, so the Nyquist real part is stored
+ *       in place of the imaginary part of bin 0. The values are the same
+ *       as those arm_rfft_q15() writes to the low half of pDst.
+ */
+void arm_rfft_q15_packed(
+    const arm_rfft_instance_q15 * S,
+    q15_t * pBuf);
+
+/**
+ * @brief Process real FFT on Q15 data with block floating point scaling.
+ * @param[in]  S     Pointer to a forward RFFT instance structure
+ * @param[in]  pSrc  Pointer to input buffer (modified in-place)
+ * @param[out] pDst  Pointer to output buffer, laid out as by arm_rfft_q15()
+ * @return Block exponent e: the unscaled spectrum is pDst * 2^e, where
+ *         arm_rfft_q15() always returns it scaled by 1/fftLenReal
+ */
+int32_t arm_rfft_q15_bfp(
+    const arm_rfft_instance_q15 * S,
+    q15_t * pSrc,
+    q15_t * pDst);
+
+/**
+ * @brief Process real FFT on Q15 data in place, with packed output and
+ *        block floating point scaling.
+ * @param[in]     S     Pointer to a forward RFFT instance structure
+ * @param[in,out] pBuf  fftLenReal input samples, overwritten by the spectrum
+ * @return Block exponent e: the unscaled spectrum is pBuf * 2^e
+ *
+ * @note Layout as arm_rfft_q15_packed(), scaling as arm_rfft_q15_bfp().
+ */
+int32_t arm_rfft_q15_packed_bfp(
+    const arm_rfft_instance_q15 * S,
+    q15_t * pBuf);
+
+/**
+ * @brief Process real IFFT on a packed Q15 spectrum in place, with block
+ *        floating point scaling.
+ * @param[in]     S     Pointer to an RFFT instance structure, its ifftFlagR
+ *                      is ignored
+ * @param[in,out] pBuf  Packed spectrum as written by arm_rfft_q15_packed(),
+ *                      overwritten by fftLenReal output samples
+ * @return Block exponent e: the unscaled inverse, sum over the bins without
+ *         the 1/fftLenReal factor, is pBuf * 2^e
+ *
+ * @note Forward and inverse BFP transforms give FFT-domain filtering the
+ *       whole Q15 range at both ends, where arm_rfft_q15() loses
+ *       log2(fftLenReal) bits in each direction.
+ */
+int32_t arm_rifft_q15_packed_bfp(
+    const arm_rfft_instance_q15 * S,
+    q15_t * pBuf);
+
 /**
  * @brief Process complex FFT on Q15 data.
  * @param[in]     S               Pointer to CFFT instance structure
@@ -118,6 +352,73 @@ void arm_cfft_q15(
     uint8_t ifftFlag,
     uint8_t bitReverseFlag);
 
+/**
+ * @brief Inverse complex FFT on Q15 data with the outputs shifted left.
+ * @param[in]     S               Pointer to CFFT instance structure
+ * @param[in,out] p1              Pointer to complex data buffer (in-place)
+ * @param[in]     bitReverseFlag  0=disable bit reversal, 1=enable bit reversal
+ * @param[in]     shift           Left shift of every output value
+ *
+ * @note Equal to arm_cfft_q15(S, p1, 1, bitReverseFlag) followed by
+ *       p1[i] <<= shift, with the same Q15 wrap-around, but the shift is
+ *       done by the last butterfly stage instead of a pass of its own.
+ *       arm_rfft_q15() uses it for the IFFT output scaling.
+ */
+void arm_cfft_q15_inverse_shl(
+    const arm_cfft_instance_q15 * S,
+    q15_t * p1,
+    uint8_t bitReverseFlag,
+    uint32_t shift);
+
+/**
+ * @brief First stage of a forward complex FFT split into two halves.
+ * @param[in]     S   Pointer to CFFT instance structure
+ * @param[in,out] p1  Pointer to complex data buffer (in-place)
+ *
+ * @note Leaves two independent CFFTs of S->fftLen / 2 points, the first
+ *       and the second half of p1, for arm_cfft_q15_half() to complete,
+ *       for instance one on each core. The result is that of
+ *       arm_cfft_q15(S, p1, 0, 0), bit-reversed and with the same output
+ *       format: bit-exact where S->fftLen is not a power of four, where
+ *       arm_cfft_q15() starts with the same radix-2 stage. For a power of
+ *       four arm_cfft_q15() is radix-4 throughout, and the radix-2 stages
+ *       of the split and of its halves each keep one bit less. S->fftLen
+ *       must be at least 32, twice the shortest CFFT of the library.
+ */
+void arm_cfft_q15_split(
+    const arm_cfft_instance_q15 * S,
+    q15_t * p1);
+
+/**
+ * @brief Complete one half of arm_cfft_q15_split().
+ * @param[in]     H      Pointer to a CFFT instance of S->fftLen / 2 points
+ * @param[in,out] pHalf  Pointer to the first or second half of p1 (in-place)
+ */
+void arm_cfft_q15_half(
+    const arm_cfft_instance_q15 * H,
+    q15_t * pHalf);
+
+/**
+ * @brief Process complex FFT on Q15 data with block floating point scaling.
+ * @param[in]     S               Pointer to CFFT instance structure
+ * @param[in,out] p1              Pointer to complex data buffer (in-place)
+ * @param[in]     ifftFlag        0=forward FFT, 1=inverse FFT
+ * @param[in]     bitReverseFlag  0=disable bit reversal, 1=enable bit reversal
+ * @return Block exponent e: the unscaled transform, without 1/fftLen, is
+ *         p1 * 2^e
+ *
+ * @note arm_cfft_q15() halves every radix-2 level for a fixed output
+ *       format. Here each stage measures the headroom left by the previous
+ *       one and shifts only as far as needed, so low-level inputs keep up
+ *       to all of their bits. Full-scale inputs end up close to the fixed
+ *       format, e.g. e = 11 or 12 at 2048 points.
+ */
+int32_t arm_cfft_q15_bfp(
+    const arm_cfft_instance_q15 * S,
+    q15_t * p1,
+    uint8_t ifftFlag,
+    uint8_t bitReverseFlag);
+
 /**
  * @brief Bit reversal function for Q15 data.
  * @param[in,out] pSrc         Pointer to data buffer
@@ -129,6 +430,296 @@ void arm_bitreversal_16(
     const uint16_t bitRevLen,
     const uint16_t * pBitRevTable);
 
+/**
+ * @brief Process complex FFT on Q15 data, out-of-place.
+ * @param[in]     S         Pointer to CFFT instance structure
+ * @param[in,out] pSrc      Pointer to complex input buffer (used as work buffer)
+ * @param[out]    pDst      Pointer to complex output buffer, natural order
+ * @param[in]     ifftFlag  0=forward FFT, 1=inverse FFT
+ *
+ * @note Does not use the bit reversal table of S. With
+ *       RFFT_Q15_PACKED_BUTTERFLY the forward transform writes its last
+ *       stage straight to the bit-reversed positions in pDst; otherwise the
+ *       result is copied there after the in-place transform. With
+ *       RFFT_Q15_STOCKHAM the forward transform only reads pSrc and uses
+ *       pDst as its work buffer, which must then hold 2 * fftLen complex
+ *       values, as the output of arm_rfft_q15() does.
+ */
+void arm_cfft_q15_out(
+    const arm_cfft_instance_q15 * S,
+    q15_t * pSrc,
+    q15_t * pDst,
+    uint8_t ifftFlag);
+
+#if defined(RFFT_Q15_STOCKHAM)
+/**
+ * @brief Forward complex FFT on Q15 data, ping-ponging between two buffers.
+ * @param[in]     S     Pointer to CFFT instance structure
+ * @param[in,out] pSrc  Pointer to complex input buffer (used as work buffer)
+ * @param[in,out] pBuf  Pointer to a second work buffer of fftLen complex values
+ * @return        pSrc or pBuf, whichever holds the result in natural order
+ *
+ * @note Stockham order: no bit reversal, sequential access in every stage.
+ *       Bit-exact with arm_cfft_q15(S, pSrc, 0, 1).
+ */
+q15_t * arm_cfft_q15_stockham(
+    const arm_cfft_instance_q15 * S,
+    q15_t * pSrc,
+    q15_t * pBuf);
+
+/**
+ * Nonzero when arm_cfft_q15_stockham() of fftLen points leaves its result
+ * in pBuf, zero when in pSrc: the transform has log2(fftLen) / 2 stages,
+ * rounded down, and ends in pBuf when that number is even.
+ */
+#define RFFT_Q15_STOCKHAM_IN_BUF(fftLen)  (((fftLen) & 0x33333333U) != 0U)
+#endif
+
+/**
+ * @brief In-place bit reversal for Q15 data, without an index table.
+ * @param[in,out] pSrc    Pointer to complex data buffer
+ * @param[in]     fftLen  Complex FFT length (power of two)
+ */
+void arm_bitreversal_q15_notable(
+    q15_t * pSrc,
+    uint32_t fftLen);
+
+/**
+ * @brief Out-of-place bit reversal for Q15 data, without an index table.
+ * @param[in]  pSrc    Pointer to complex data in bit-reversed order
+ * @param[out] pDst    Pointer to output buffer
+ * @param[in]  fftLen  Complex FFT length (power of two)
+ */
+void arm_bitreversal_q15_copy(
+    const q15_t * pSrc,
+    q15_t * pDst,
+    uint32_t fftLen);
+
+/**
+ * @brief Callback receiving one bin of arm_rfft_q15_mag_sq().
+ * @param[in] bin     bin index, 0 (DC) to fftLenReal / 2 (Nyquist)
+ * @param[in] mag_sq  real² + imag² of the bin, as arm_rfft_q15() outputs it
+ * @param[in] user    user pointer passed to arm_rfft_q15_mag_sq()
+ */
+typedef void (*rfft_q15_bin_fn)(uint32_t bin, uint32_t mag_sq, void *user);
+
+/**
+ * @brief Real FFT reporting the magnitude squared of each bin.
+ * @param[in]     S     Pointer to a forward RFFT instance structure
+ * @param[in,out] pSrc  Pointer to input buffer (modified in-place)
+ * @param[in]     fn    Called once per bin, in ascending bin order
+ * @param[in]     user  Passed through to fn
+ *
+ * @note Computes the same bins as arm_rfft_q15() followed by real² + imag²
+ *       on its output, but needs no output buffer: each bin is formed and
+ *       handed to fn directly from the CFFT result in pSrc.
+ */
+void arm_rfft_q15_mag_sq(
+    const arm_rfft_instance_q15 * S,
+    q15_t * pSrc,
+    rfft_q15_bin_fn fn,
+    void * user);
+
+/**
+ * @brief Split step of arm_rfft_q15_mag_sq() on a CFFT done by the caller.
+ * @param[in]     S     Pointer to a forward RFFT instance structure
+ * @param[in,out] pSrc  Result of arm_cfft_q15(S->pCfft, pSrc, 0, 0), or
+ *                      of an equivalent such as arm_cfft_q15_split()
+ * @param[in]     fn    Called once per bin, in ascending bin order
+ * @param[in]     user  Passed through to fn
+ */
+void arm_rfft_q15_mag_sq_split(
+    const arm_rfft_instance_q15 * S,
+    q15_t * pSrc,
+    rfft_q15_bin_fn fn,
+    void * user);
+
+/**
+ * @brief One complex bin of the spectrum behind the last arm_rfft_q15_mag_sq().
+ * @param[in]  S     RFFT instance passed to arm_rfft_q15_mag_sq()
+ * @param[in]  pSrc  Buffer it transformed, not modified since
+ * @param[in]  bin   Bin index, 0 to fftLenReal / 2
+ * @param[out] pOut  Real and imaginary part of the bin
+ *
+ * @note arm_rfft_q15_mag_sq() leaves the CFFT result in pSrc. This forms
+ *       any bin from it again, e.g. the neighbours of a peak for sub-bin
+ *       interpolation, bit-exact with arm_rfft_q15().
+ */
+void arm_rfft_q15_mag_sq_bin(
+    const arm_rfft_instance_q15 * S,
+    const q15_t * pSrc,
+    uint32_t bin,
+    q15_t * pOut);
+
+#if defined(RFFT_Q15_STOCKHAM)
+/**
+ * @brief arm_rfft_q15_mag_sq() with its CFFT in Stockham order.
+ * @param[in]     S     Pointer to a forward RFFT instance structure
+ * @param[in,out] pSrc  Pointer to input buffer (used as work buffer)
+ * @param[in,out] pBuf  Second work buffer, fftLenReal Q15 values
+ * @param[in]     fn    Called once per bin, in ascending bin order
+ * @param[in]     user  Passed through to fn
+ *
+ * @note Same bins as arm_rfft_q15_mag_sq(). The CFFT ping-pongs between
+ *       pSrc and pBuf, see arm_cfft_q15_stockham(), and the split step
+ *       reads its natural order result front to back and back to front.
+ */
+void arm_rfft_q15_mag_sq_stockham(
+    const arm_rfft_instance_q15 * S,
+    q15_t * pSrc,
+    q15_t * pBuf,
+    rfft_q15_bin_fn fn,
+    void * user);
+
+/**
+ * @brief One complex bin of the spectrum behind the last arm_rfft_q15_mag_sq_stockham().
+ * @param[in]  S     RFFT instance passed to arm_rfft_q15_mag_sq_stockham()
+ * @param[in]  pSrc  Input buffer passed to it, not modified since
+ * @param[in]  pBuf  Work buffer passed to it, not modified since
+ * @param[in]  bin   Bin index, 0 to fftLenReal / 2
+ * @param[out] pOut  Real and imaginary part of the bin
+ */
+void arm_rfft_q15_mag_sq_stockham_bin(
+    const arm_rfft_instance_q15 * S,
+    const q15_t * pSrc,
+    const q15_t * pBuf,
+    uint32_t bin,
+    q15_t * pOut);
+#endif
+
+/**
+ * @brief Forward CFFT of a mixed radix plan, S->fftLenReal / 2 points.
+ * @param[in]     S     Plan set up by rfft_mixed_plan_create()
+ * @param[in,out] pSrc  Complex input, S->fftLenReal values (used as work buffer)
+ * @param[in,out] pBuf  Second work buffer, S->fftLenReal values
+ * @return pSrc or pBuf, whichever holds the result, in natural order
+ *
+ * @note The stages ping-pong between pSrc and pBuf, the result ends up
+ *       in pBuf after an odd number of them. The output is the DFT
+ *       scaled by 2 / S->fftLenReal, like that of arm_cfft_q15().
+ */
+const q15_t *arm_cfft_q15_mixed(
+    const rfft_mixed_q15_t * S,
+    q15_t * pSrc,
+    q15_t * pBuf);
+
+/**
+ * @brief Real FFT of a mixed radix plan.
+ * @param[in]     S     Plan set up by rfft_mixed_plan_create()
+ * @param[in,out] pSrc  Real input, S->fftLenReal values (used as work buffer)
+ * @param[in,out] pBuf  Second work buffer, S->fftLenReal values
+ * @param[out]    pDst  Bins 0 to S->fftLenReal / 2, S->fftLenReal + 2 values,
+ *                      neither pSrc nor pBuf
+ *
+ * @note The bins are scaled as those of arm_rfft_q15(), which also
+ *       writes the complex conjugate upper half this leaves out.
+ */
+void arm_rfft_q15_mixed(
+    const rfft_mixed_q15_t * S,
+    q15_t * pSrc,
+    q15_t * pBuf,
+    q15_t * pDst);
+
+/**
+ * @brief arm_rfft_q15_mag_sq() for a mixed radix plan.
+ * @param[in]     S     Plan set up by rfft_mixed_plan_create()
+ * @param[in,out] pSrc  Real input, S->fftLenReal values (used as work buffer)
+ * @param[in,out] pBuf  Second work buffer, S->fftLenReal values
+ * @param[in]     fn    Called once per bin, in ascending bin order
+ * @param[in]     user  Passed through to fn
+ */
+void arm_rfft_q15_mag_sq_mixed(
+    const rfft_mixed_q15_t * S,
+    q15_t * pSrc,
+    q15_t * pBuf,
+    rfft_q15_bin_fn fn,
+    void * user);
+
+/**
+ * @brief One complex bin of the spectrum behind the last arm_rfft_q15_mag_sq_mixed().
+ * @param[in]  S     Plan passed to arm_rfft_q15_mag_sq_mixed()
+ * @param[in]  pSrc  Input buffer passed to it, not modified since
+ * @param[in]  pBuf  Work buffer passed to it, not modified since
+ * @param[in]  bin   Bin index, 0 to fftLenReal / 2
+ * @param[out] pOut  Real and imaginary part of the bin
+ */
+void arm_rfft_q15_mag_sq_mixed_bin(
+    const rfft_mixed_q15_t * S,
+    const q15_t * pSrc,
+    const q15_t * pBuf,
+    uint32_t bin,
+    q15_t * pOut);
+
+/* ========================================================================= */
+/* Magnitude Functions                                                       */
+/* ========================================================================= */
+
+/*
+ * Whole-spectrum kernels on the complex bins of arm_rfft_q15() or
+ * arm_cfft_q15(). Each reads two bins per iteration as two 32-bit words,
+ * the magnitude² being one dual multiply-add with the DSP extension. The
+ * bins must be 4-byte aligned, see RFFT_Q15_ALIGN.
+ *
+ * arm_rfft_q15() returns the spectrum scaled by 1/fftLenReal, in
+ * (b + 1).(15 - b) format for b = log2(fftLenReal): 13.3 for 4096 points,
+ * 14.2 for 8192. The log kernels take that b, or the block exponent of
+ * arm_rfft_q15_bfp(), as exponent and undo it, so they report the
+ * unscaled DFT of the 1.15 input and spectra of different lengths and
+ * scalings share one scale.
+ */
+
+/** Result of the log kernels for a bin of magnitude 0. */
+#define CMPLX_MAG_LOG_ZERO  INT16_MIN
+
+/**
+ * @brief Magnitude squared of complex Q15 bins.
+ * @param[in]  pSrc      numBins complex values, real and imaginary interleaved
+ * @param[out] pDst      numBins values of real² + imag², as
+ *                       arm_rfft_q15_mag_sq() reports them
+ * @param[in]  numBins   bins to process, fftLenReal / 2 + 1 for an RFFT
+ *
+ * @note The values are those that spectral_psd_push() and
+ *       psd_pack_encode() take.
+ */
+void cmplx_mag_squared_q15(
+    const q15_t * pSrc,
+    uint32_t * pDst,
+    uint32_t numBins);
+
+/**
+ * @brief log2 of the power of complex Q15 bins, in Q8.
+ * @param[in]  pSrc      numBins complex values, real and imaginary interleaved
+ * @param[out] pDst      numBins values of log2(|X|²) * 256, for the
+ *                       unscaled DFT X of a full-scale 1.0 input, or
+ *                       CMPLX_MAG_LOG_ZERO for a bin of 0
+ * @param[in]  numBins   bins to process
+ * @param[in]  exponent  log2 of the scaling of pSrc: log2(fftLenReal) for
+ *                       arm_rfft_q15(), the return value of arm_rfft_q15_bfp()
+ *
+ * @note The logarithm is a cubic fit of the mantissa, within 0.003 of
+ *       log2 with the rounding to Q8. A full-scale tone of an N-point RFFT
+ *       is at 2 * log2(N) - 2.
+ */
+void cmplx_mag_log2_q15(
+    const q15_t * pSrc,
+    int16_t * pDst,
+    uint32_t numBins,
+    int32_t exponent);
+
+/**
+ * @brief Power of complex Q15 bins in dB, in Q8.
+ * @param[in]  pSrc      numBins complex values, real and imaginary interleaved
+ * @param[out] pDst      numBins values of 10 * log10(|X|²) * 256, X as
+ *                       for cmplx_mag_log2_q15(), or CMPLX_MAG_LOG_ZERO
+ * @param[in]  numBins   bins to process
+ * @param[in]  exponent  log2 of the scaling of pSrc, see cmplx_mag_log2_q15()
+ */
+void cmplx_mag_db_q15(
+    const q15_t * pSrc,
+    int16_t * pDst,
+    uint32_t numBins,
+    int32_t exponent);
+
 /* ========================================================================= */
 /* Helper Functions                                                          */
 /* ========================================================================= */
@@ -168,62 +759,341 @@ static inline q15_t float_to_q15(float float_value) {
     return (q15_t)(float_value * 32768.0f);
 }
 
+/**
+ * @brief Advance a bit-reversed counter.
+ * @param[in] r    current value, bit-reversed
+ * @param[in] top  highest bit of the counter (half its range)
+ * @return bit reversal of (bitreverse(r) + 1), wrapping to 0
+ *
+ * @note Walks index pairs i, bitreverse(i) without a table. Costs two
+ *       iterations on average.
+ */
+static inline uint32_t rfft_bitrev_next(uint32_t r, uint32_t top) {
+    while ((r & top) != 0U) {
+        r ^= top;
+        top >>= 1U;
+    }
+    return r | top;
+}
+
+/**
+ * @brief log2 of a positive integer, in Q8.
+ * @param[in] x  value, above 0
+ * @return log2(x) * 256, within 0.003 of log2 with the rounding to Q8
+ *
+ * @note The leading one and a cubic fit of the mantissa, no tables.
+ */
+static inline int32_t rfft_q15_log2_q8(uint32_t x) {
+    uint32_t msb = 31U - (uint32_t) __builtin_clz(x);
+    uint32_t f = ((msb >= 16U) ? (x >> (msb - 16U)) : (x << (16U - msb))) & 0xFFFFU;
+
+    /* log2(1 + f) ~ f + f * (1 - f) * (0.4227 - 0.1587 * f), in Q16 */
+    f += (((f * (0x10000U - f)) >> 16) * (27700U - ((10400U * f) >> 16))) >> 16;
+
+    return (int32_t) (msb << 8) + (int32_t) ((f + 0x80U) >> 8);
+}
+
 /* ========================================================================= */
-/* DSP Intrinsics Compatibility                                              */
+/* Build Options                                                             */
 /* ========================================================================= */
 
-#if defined (ARM_MATH_DSP)
-/* DSP intrinsics are available - use CMSIS-Core definitions */
-#include "cmsis_compiler.h"
+/** Alignment for Q15 buffers and tables that are accessed as Q15 pairs. */
+#define RFFT_Q15_ALIGN __attribute__((aligned(4)))
 
-/* Helper macros for reading/writing Q15 pairs */
-#define read_q15x2(addr)        (*((q31_t *)(addr)))
-#define read_q15x2_ia(addr)     (*((q31_t *)(addr))++)
-#define read_q15x2_da(addr)     (*((q31_t *)(addr))--)
-#define write_q15x2(addr, val)  (*((q31_t *)(addr)) = (val))
-#define write_q15x2_ia(addr, val) (*((q31_t *)(addr))++ = (val))
+/*
+ * RFFT_Q15_FRAME places a frame buffer of the library, the input buffer of
+ * find_fft_top_bins(), on lines of its own of a data cache of
+ * RFFT_Q15_FRAME_ALIGN bytes, 32 unless the build sets it, so that it is
+ * cleaned or invalidated without its neighbours. RFFT_Q15_FRAME_SECTION
+ * puts the frame buffers in a linker section of their own, unset leaves
+ * them in .bss.
+ */
+#ifndef RFFT_Q15_FRAME_ALIGN
+#define RFFT_Q15_FRAME_ALIGN 32
+#endif
+
+#if defined(RFFT_Q15_FRAME_SECTION)
+#define RFFT_Q15_FRAME \
+    __attribute__((aligned(RFFT_Q15_FRAME_ALIGN), section(RFFT_Q15_FRAME_SECTION)))
+#else
+#define RFFT_Q15_FRAME __attribute__((aligned(RFFT_Q15_FRAME_ALIGN)))
+#endif
 
+/*
+ * RFFT_Q15_HOT_SECTION puts the functions the transform spends its time
+ * in, the butterflies, the split RFFT and the bit reversal, in a linker
+ * section of their own, for example .ramfunc to run them from SRAM while
+ * the rest of the code executes in place from flash. Unset leaves them
+ * in .text.
+ */
+#if defined(RFFT_Q15_HOT_SECTION)
+#define RFFT_Q15_HOT __attribute__((section(RFFT_Q15_HOT_SECTION)))
 #else
-/* No DSP intrinsics - provide scalar fallbacks */
-#define __SSAT(val, bits)       ((val) > ((1 << ((bits)-1)) - 1) ? ((1 << ((bits)-1)) - 1) : \
-                                 (val) < (-(1 << ((bits)-1))) ? (-(1 << ((bits)-1))) : (val))
+#define RFFT_Q15_HOT
+#endif
 
-#define read_q15x2(addr)        (*((q31_t *)(addr)))
-#define read_q15x2_ia(addr)     (*((q31_t *)(addr))++)
-#define read_q15x2_da(addr)     (*((q31_t *)(addr))--)
-#define write_q15x2(addr, val)  (*((q31_t *)(addr)) = (val))
-#define write_q15x2_ia(addr, val) (*((q31_t *)(addr))++ = (val))
+/*
+ * RFFT_Q15_COMPACT_TWIDDLES replaces the shared twiddle table (24 KB with
+ * 8192-point support) with a quarter-wave sine table of a sixth of its
+ * size, for cores that have to copy their constants into SRAM, like the
+ * nRF54L15 FLPR. Each twiddle is derived from the sine table by index
+ * symmetry with the rounding of the full table, so results are
+ * bit-exact. Only the scalar code paths support it.
+ */
+#if defined(RFFT_Q15_COMPACT_TWIDDLES) && \
+    (defined(ARM_MATH_DSP) || defined(ARM_MATH_MVEI) || defined(ARM_MATH_NEON))
+#error "RFFT_Q15_COMPACT_TWIDDLES requires the scalar code paths"
+#endif
 
-#endif /* ARM_MATH_DSP */
+/*
+ * RFFT_Q15_STOCKHAM runs the forward CFFT of arm_rfft_q15() in Stockham
+ * (autosort) order with the packed butterfly, and adds
+ * arm_cfft_q15_stockham() and arm_rfft_q15_mag_sq_stockham() for callers
+ * with a second buffer: every stage reads its inputs and writes its
+ * outputs in sequential runs, ping-ponging between two buffers, the two
+ * halves of the RFFT output buffer for arm_rfft_q15(), and reads its
+ * twiddles front to back from a table of its own, so the result is in
+ * natural order without a bit reversal pass and no stage strides through
+ * the shared twiddle table. Results are bit-exact; the stage tables cost about
+ * 20 KB of constants with 8192-point support, see gen_tables.py.
+ */
+#if defined(RFFT_Q15_STOCKHAM) && \
+    (defined(ARM_MATH_DSP) || !defined(RFFT_Q15_PACKED_BUTTERFLY) || \
+     defined(RFFT_Q15_RUNTIME_TWIDDLES))
+#error "RFFT_Q15_STOCKHAM requires the packed butterfly and generated tables"
+#endif
+
+/*
+ * RFFT_Q15_FIXED_KERNELS gives the packed butterfly one kernel per CFFT
+ * length, generated by gen_kernels.py into cfft_fixed_q15.inc, which
+ * cfft_radix4_q15.c includes from the include path. Each kernel runs the
+ * stages of its length with constant loop bounds, strides and twiddle
+ * modifiers, and writes out the last stage of the CFFTs of up to 64
+ * points. Results are bit-exact; the code grows by several KB per length
+ * at -O3.
+ */
+#if defined(RFFT_Q15_FIXED_KERNELS) && \
+    (defined(ARM_MATH_DSP) || !defined(RFFT_Q15_PACKED_BUTTERFLY))
+#error "RFFT_Q15_FIXED_KERNELS requires the packed butterfly"
+#endif
 
 /* ========================================================================= */
 /* External Table Declarations                                               */
 /* ========================================================================= */
 
-/* CFFT Twiddle Coefficients */
-extern const q15_t twiddleCoef_2048_q15[3072];
+/*
+ * All CFFT sizes and the RFFT split step share one twiddle table in steps
+ * of 2*pi/RFFT_TWIDDLE_TABLE_LEN, the resolution the split step of the
+ * largest RFFT needs. Smaller transforms read it with a stride, see
+ * RFFT_TWIDDLE_STRIDE().
+ */
+#define RFFT_TWIDDLE_TABLE_LEN  ((uint32_t) RFFT_Q15_MAX_FFT_LEN)
 
-#ifdef ENABLE_FFT_8K
-extern const q15_t twiddleCoef_4096_q15[6144];
+#define RFFT_Q15_CAT_(a, b, c)  a##b##c
+#define RFFT_Q15_CAT(a, b, c)   RFFT_Q15_CAT_(a, b, c)
+
+#if defined(RFFT_Q15_COMPACT_TWIDDLES)
+/* Quarter-wave sin(2*pi*k/RFFT_TWIDDLE_TABLE_LEN), twiddleSinQ15_<len> */
+#define RFFT_TWIDDLE_TABLE_ENTRIES  (RFFT_Q15_MAX_FFT_LEN / 4 + 1)
+#define RFFT_TWIDDLE_TABLE_GEN  RFFT_Q15_CAT(twiddleSinQ15_, RFFT_Q15_MAX_FFT_LEN, )
+#else
+/* cos and sin for 3 quarters of a turn, twiddleCoef_<len>_q15 */
+#define RFFT_TWIDDLE_TABLE_ENTRIES  (3 * RFFT_Q15_MAX_FFT_LEN / 2)
+#define RFFT_TWIDDLE_TABLE_GEN  RFFT_Q15_CAT(twiddleCoef_, RFFT_Q15_MAX_FFT_LEN, _q15)
 #endif
 
-/* RFFT Real Coefficients */
-extern const q15_t realCoefAQ15[8192];
-extern const q15_t realCoefBQ15[8192];
+/*
+ * RFFT_Q15_LAZY_TWIDDLES leaves RFFT_TWIDDLE_TABLE where the image was
+ * linked, flash on a core that executes in place, and points the
+ * instances at an SRAM copy that rfft_q15_twiddles_init() fills, so the
+ * table is not copied at boot. Code that reads RFFT_TWIDDLE_TABLE
+ * directly still gets the original.
+ *
+ * RFFT_Q15_RUNTIME_TWIDDLES drops the generated table: the SRAM table
+ * is computed by rfft_q15_twiddles_init() and is RFFT_TWIDDLE_TABLE, so
+ * twiddle_tables.c is not linked at all. Only the scalar code paths
+ * support it, the DSP ones need the bit reversal tables.
+ */
+#if defined(RFFT_Q15_RUNTIME_TWIDDLES)
+#if defined(ARM_MATH_DSP) || defined(ARM_MATH_MVEI) || defined(ARM_MATH_NEON)
+#error "RFFT_Q15_RUNTIME_TWIDDLES requires the scalar code paths"
+#endif
+#define RFFT_TWIDDLE_TABLE  rfft_q15_twiddle_ram
+#else
+#define RFFT_TWIDDLE_TABLE  RFFT_TWIDDLE_TABLE_GEN
+extern const q15_t RFFT_TWIDDLE_TABLE[RFFT_TWIDDLE_TABLE_ENTRIES];
+#endif
 
-/* Bit Reversal Tables */
-extern const uint16_t armBitRevIndexTable_fixed_2048[];
+#if defined(RFFT_Q15_LAZY_TWIDDLES) || defined(RFFT_Q15_RUNTIME_TWIDDLES)
+extern q15_t rfft_q15_twiddle_ram[RFFT_TWIDDLE_TABLE_ENTRIES];
+#define RFFT_TWIDDLE_DATA  ((const q15_t *) rfft_q15_twiddle_ram)
+#else
+#define RFFT_TWIDDLE_DATA  RFFT_TWIDDLE_TABLE
+#endif
 
-#ifdef ENABLE_FFT_8K
+/* Prebuilt forward RFFT instances, usable without an init call */
+#if RFFT_Q15_HAS_LEN(32)
+extern const arm_rfft_instance_q15 arm_rfft_sR_q15_len32;
+#endif
+#if RFFT_Q15_HAS_LEN(64)
+extern const arm_rfft_instance_q15 arm_rfft_sR_q15_len64;
+#endif
+#if RFFT_Q15_HAS_LEN(128)
+extern const arm_rfft_instance_q15 arm_rfft_sR_q15_len128;
+#endif
+#if RFFT_Q15_HAS_LEN(256)
+extern const arm_rfft_instance_q15 arm_rfft_sR_q15_len256;
+#endif
+#if RFFT_Q15_HAS_LEN(512)
+extern const arm_rfft_instance_q15 arm_rfft_sR_q15_len512;
+#endif
+#if RFFT_Q15_HAS_LEN(1024)
+extern const arm_rfft_instance_q15 arm_rfft_sR_q15_len1024;
+#endif
+#if RFFT_Q15_HAS_LEN(2048)
+extern const arm_rfft_instance_q15 arm_rfft_sR_q15_len2048;
+#endif
+#if RFFT_Q15_HAS_LEN(4096)
+extern const arm_rfft_instance_q15 arm_rfft_sR_q15_len4096;
+#endif
+#if RFFT_Q15_HAS_LEN(8192)
+extern const arm_rfft_instance_q15 arm_rfft_sR_q15_len8192;
+#endif
+
+/*
+ * Bit Reversal Tables, generated for the CFFTs of the built-in lengths.
+ * Only the ARM_MATH_DSP instances point at them. RFFT_Q15_NO_BITREV_TABLES
+ * leaves them out there too: every CFFT then walks the swap pairs with
+ * rfft_bitrev_next(), see arm_bitreversal_q15_notable(), with the same
+ * result and no table load per index.
+ */
+#if !defined(RFFT_Q15_NO_BITREV_TABLES)
+extern const uint16_t armBitRevIndexTable_fixed_16[];
+extern const uint16_t armBitRevIndexTable_fixed_32[];
+extern const uint16_t armBitRevIndexTable_fixed_64[];
+extern const uint16_t armBitRevIndexTable_fixed_128[];
+extern const uint16_t armBitRevIndexTable_fixed_256[];
+extern const uint16_t armBitRevIndexTable_fixed_512[];
+extern const uint16_t armBitRevIndexTable_fixed_1024[];
+extern const uint16_t armBitRevIndexTable_fixed_2048[];
 extern const uint16_t armBitRevIndexTable_fixed_4096[];
 #endif
 
 /* Bit Reversal Table Lengths */
+#define ARMBITREVINDEXTABLE_FIXED_16_TABLE_LENGTH    12
+#define ARMBITREVINDEXTABLE_FIXED_32_TABLE_LENGTH    24
+#define ARMBITREVINDEXTABLE_FIXED_64_TABLE_LENGTH    56
+#define ARMBITREVINDEXTABLE_FIXED_128_TABLE_LENGTH   112
+#define ARMBITREVINDEXTABLE_FIXED_256_TABLE_LENGTH   240
+#define ARMBITREVINDEXTABLE_FIXED_512_TABLE_LENGTH   480
+#define ARMBITREVINDEXTABLE_FIXED_1024_TABLE_LENGTH  992
 #define ARMBITREVINDEXTABLE_FIXED_2048_TABLE_LENGTH  1984
-
-#ifdef ENABLE_FFT_8K
 #define ARMBITREVINDEXTABLE_FIXED_4096_TABLE_LENGTH  4032
+
+#if defined(RFFT_Q15_STOCKHAM)
+/* Stage tables of the radix-4 stages of 16 to RFFT_Q15_MAX_FFT_LEN / 2 points */
+extern const q15_t rfftStockhamQ15_16[];
+extern const q15_t rfftStockhamQ15_64[];
+extern const q15_t rfftStockhamQ15_256[];
+extern const q15_t rfftStockhamQ15_1024[];
+extern const q15_t rfftStockhamQ15_4096[];
+
+/* Radix-2 step tables of the 4x2 CFFTs of the built-in lengths */
+extern const q15_t rfftStockhamR2Q15_32[];
+extern const q15_t rfftStockhamR2Q15_128[];
+extern const q15_t rfftStockhamR2Q15_512[];
+extern const q15_t rfftStockhamR2Q15_2048[];
+#endif
+
+/*
+ * RFFT_Q15_SPLIT_TABLES gives every prebuilt RFFT instance the split
+ * coefficients of its length as pTwiddleBReal: A[0], A[1], B[0], B[1] of
+ * bins 0 to fftLenReal / 4, read front to back by the split step instead
+ * of derived from the twiddles at a stride of the modifier. Bin
+ * fftLenReal / 2 - i has those of bin i with A[1] and B[1] negated. The
+ * tables cost 2 * fftLenReal + 8 bytes per length; instances of
+ * rfft_plan_create() keep deriving them.
+ */
+#if defined(RFFT_Q15_SPLIT_TABLES)
+#if defined(RFFT_Q15_RUNTIME_TWIDDLES)
+#error "RFFT_Q15_SPLIT_TABLES requires the generated tables"
+#endif
+extern const q15_t rfftSplitQ15_32[];
+extern const q15_t rfftSplitQ15_64[];
+extern const q15_t rfftSplitQ15_128[];
+extern const q15_t rfftSplitQ15_256[];
+extern const q15_t rfftSplitQ15_512[];
+extern const q15_t rfftSplitQ15_1024[];
+extern const q15_t rfftSplitQ15_2048[];
+extern const q15_t rfftSplitQ15_4096[];
+extern const q15_t rfftSplitQ15_8192[];
+#endif
+
+/*
+ * RFFT_Q15_CONST_WINDOWS links the window tables of gen_tables.py
+ * --windows, the half tables of fft_context_set_window() for every
+ * built-in length, so they take flash instead of SRAM and no time at
+ * startup. rfft_q15_window_table() looks one up by fft_window_type_t and
+ * length, NULL when it was not generated.
+ */
+#if defined(RFFT_Q15_CONST_WINDOWS)
+#if defined(RFFT_Q15_RUNTIME_TWIDDLES)
+#error "RFFT_Q15_CONST_WINDOWS requires the generated tables"
 #endif
+const q15_t *rfft_q15_window_table(uint32_t window, uint32_t fft_len);
+#endif
+
+/* ========================================================================= */
+/* Twiddle Access                                                            */
+/* ========================================================================= */
+
+/*
+ * The CFFT kernels and the RFFT split step read twiddle k of
+ * RFFT_TWIDDLE_TABLE, cos and sin of 2*pi*k/RFFT_TWIDDLE_TABLE_LEN,
+ * through these macros. An fftLen-point CFFT scales its indices by
+ * RFFT_TWIDDLE_STRIDE(fftLen).
+ */
+#define RFFT_TWIDDLE_STRIDE(fftLen)  (RFFT_TWIDDLE_TABLE_LEN / (fftLen))
+
+#if defined(RFFT_Q15_COMPACT_TWIDDLES)
+
+#define RFFT_TWIDDLE_QUARTER  (RFFT_TWIDDLE_TABLE_LEN / 4U)
+
+/* cos(2*pi*k/RFFT_TWIDDLE_TABLE_LEN) for k < 3 quarters. Negative values
+ * of the full table are rounded down, which is ~x of the positive sine
+ * entry. */
+static inline q15_t rfft_twiddle_cos_q15(const q15_t *pSin, uint32_t k)
+{
+    if (k <= RFFT_TWIDDLE_QUARTER) {
+        return pSin[RFFT_TWIDDLE_QUARTER - k];
+    }
+    if (k <= 2U * RFFT_TWIDDLE_QUARTER) {
+        return (q15_t) ~pSin[k - RFFT_TWIDDLE_QUARTER];
+    }
+    return (q15_t) ~pSin[3U * RFFT_TWIDDLE_QUARTER - k];
+}
+
+/* sin(2*pi*k/RFFT_TWIDDLE_TABLE_LEN) for k < 3 quarters */
+static inline q15_t rfft_twiddle_sin_q15(const q15_t *pSin, uint32_t k)
+{
+    if (k <= RFFT_TWIDDLE_QUARTER) {
+        return pSin[k];
+    }
+    if (k <= 2U * RFFT_TWIDDLE_QUARTER) {
+        return pSin[2U * RFFT_TWIDDLE_QUARTER - k];
+    }
+    return (q15_t) ~pSin[k - 2U * RFFT_TWIDDLE_QUARTER];
+}
+
+#define RFFT_TWIDDLE_COS(pCoef, k)   rfft_twiddle_cos_q15((pCoef), (k))
+#define RFFT_TWIDDLE_SIN(pCoef, k)   rfft_twiddle_sin_q15((pCoef), (k))
+
+#else
+
+#define RFFT_TWIDDLE_COS(pCoef, k)   ((pCoef)[2U * (k)])
+#define RFFT_TWIDDLE_SIN(pCoef, k)   ((pCoef)[2U * (k) + 1U])
+
+#endif /* RFFT_Q15_COMPACT_TWIDDLES */
 
 #ifdef __cplusplus
 }
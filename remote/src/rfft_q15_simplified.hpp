@@ -0,0 +1,267 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library - Simplified Q15 RFFT
+ * Title:        rfft_q15_simplified.hpp
+ * Description:  Header-only C++ RFFT of a fixed length, tables computed
+ *               by the compiler
+ *
+ * Target Processor: ARM Cortex-M33, nRF54L15 FLPR (RISC-V)
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2021 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * RfftQ15<N> is an N-point forward RFFT for C++17 firmware. Its instances
+ * are the arm_rfft_instance_q15 and arm_cfft_instance_q15 of the C
+ * library, constant and ready without an init call, and point to a
+ * twiddle table and, with ARM_MATH_DSP and without
+ * RFFT_Q15_NO_BITREV_TABLES, a bit reversal table that the
+ * compiler computes as rfft_plan_create() does at run time, bit-exact
+ * with the tables of gen_tables.py. A table is emitted only in the
+ * products that use it, and N need not be one of the built-in lengths
+ * from RFFT_Q15_MIN_FFT_LEN: any power of two from 32 to
+ * RFFT_Q15_MAX_FFT_LEN, the length the kernels index the twiddle table
+ * by, like every caller of the C library.
+ *
+ *     static RfftQ15<1024>::Samples samples;
+ *     static RfftQ15<1024>::Spectrum spectrum;
+ *
+ *     RfftQ15<1024>::forward(samples, spectrum);
+ *     arm_rfft_q15_mag_sq(RfftQ15<1024>::instance(), samples.data(), fn, user);
+ */
+
+#ifndef RFFT_Q15_SIMPLIFIED_HPP
+#define RFFT_Q15_SIMPLIFIED_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "rfft_q15_simplified.h"
+
+#if __cplusplus < 201703L
+#error "rfft_q15_simplified.hpp requires C++17"
+#endif
+
+namespace rfft_q15_detail {
+
+/* rfft_twiddle_step_q62 of rfft_plan_q15.c, cos and sin of 2*pi/n for n = 2^(k+5) */
+constexpr uint64_t step_q62[][2] = {
+    { 0x3EC52F9FEEB96056ULL, 0x0C7C5C1E34D3055BULL },  /* 32 */
+    { 0x3FB11B47A24A4B3CULL, 0x0645E9AF0A6D0AF8ULL },  /* 64 */
+    { 0x3FEC43C6F2DAFBC7ULL, 0x0323ECBE21BB027DULL },  /* 128 */
+    { 0x3FFB10C1099A1976ULL, 0x0192155F7A3667E0ULL },  /* 256 */
+    { 0x3FFEC42D3725B6AFULL, 0x00C90E8FE6F63C23ULL },  /* 512 */
+    { 0x3FFFB10B1D15249BULL, 0x006487C3F99C01C4ULL },  /* 1024 */
+    { 0x3FFFEC42C43A03A5ULL, 0x003243F17D994975ULL },  /* 2048 */
+    { 0x3FFFFB10B0DDCC8DULL, 0x001921FAAEE6472EULL },  /* 4096 */
+    { 0x3FFFFEC42C3467DEULL, 0x000C90FD957659B0ULL },  /* 8192 */
+};
+
+constexpr bool is_length(std::size_t n)
+{
+    return n >= 32U && n <= 8192U && (n & (n - 1U)) == 0U;
+}
+
+constexpr uint32_t log2(uint32_t n)
+{
+    uint32_t k = 0U;
+
+    while ((1UL << k) < n) {
+        k++;
+    }
+    return k;
+}
+
+/* floor(a * b / 2^62) for a, b up to 2^62, as rfft_mul_q62() */
+constexpr uint64_t mul_q62(uint64_t a, uint64_t b)
+{
+    uint64_t a0 = static_cast<uint32_t>(a), a1 = a >> 32;
+    uint64_t b0 = static_cast<uint32_t>(b), b1 = b >> 32;
+    uint64_t p00 = a0 * b0;
+    uint64_t p01 = a0 * b1;
+    uint64_t p10 = a1 * b0;
+    uint64_t mid = (p00 >> 32) + static_cast<uint32_t>(p01) + static_cast<uint32_t>(p10);
+    uint64_t hi = a1 * b1 + (p01 >> 32) + (p10 >> 32) + (mid >> 32);
+
+    return (hi << 2) | (static_cast<uint32_t>(mid) >> 30);
+}
+
+/* floor(32768 * x) of x = sign * v / 2^62 saturated to Q15, as rfft_q62_to_q15() */
+constexpr q15_t q62_to_q15(uint64_t v, bool negative)
+{
+    uint32_t q = static_cast<uint32_t>(v >> 47);
+
+    if (negative) {
+        return static_cast<q15_t>(-static_cast<int32_t>(q + ((v & ((1ULL << 47) - 1U)) != 0U)));
+    }
+    return static_cast<q15_t>((q > 32767U) ? 32767U : q);
+}
+
+/* rfft_bitrev_next(), usable in constant expressions */
+constexpr uint32_t bitrev_next(uint32_t r, uint32_t top)
+{
+    while ((r & top) != 0U) {
+        r ^= top;
+        top >>= 1U;
+    }
+    return r | top;
+}
+
+/* As rfft_twiddle_put() */
+template <uint32_t n, std::size_t entries>
+constexpr void put_twiddle(std::array<q15_t, entries> &table, uint32_t k, uint64_t c, bool c_neg,
+                           uint64_t s, bool s_neg)
+{
+    if (k < 3U * n / 4U) {
+        table[2U * k] = q62_to_q15(c, c_neg);
+        table[2U * k + 1U] = q62_to_q15(s, s_neg);
+    }
+}
+
+/* RFFT_TWIDDLE_TABLE for a table length of n, as rfft_q15_twiddles_generate() */
+template <uint32_t n, std::size_t entries>
+constexpr std::array<q15_t, entries> make_twiddles()
+{
+    std::array<q15_t, entries> table{};
+    const uint64_t *step = step_q62[log2(n) - 5U];
+    uint64_t c = 1ULL << 62;
+    uint64_t s = 0U;
+
+    for (uint32_t j = 0U; j <= n / 8U; j++) {
+#if defined(RFFT_Q15_COMPACT_TWIDDLES)
+        table[j] = q62_to_q15(s, false);
+        table[n / 4U - j] = q62_to_q15(c, false);
+#else
+        put_twiddle<n>(table, j, c, false, s, false);
+        put_twiddle<n>(table, n / 4U - j, s, false, c, false);
+        put_twiddle<n>(table, n / 4U + j, s, true, c, false);
+        put_twiddle<n>(table, n / 2U - j, c, true, s, false);
+        put_twiddle<n>(table, n / 2U + j, c, true, s, true);
+        put_twiddle<n>(table, 3U * n / 4U - j, s, true, c, true);
+#endif
+
+        uint64_t c_next = mul_q62(c, step[0]) - mul_q62(s, step[1]);
+        uint64_t s_next = mul_q62(s, step[0]) + mul_q62(c, step[1]);
+
+        c = c_next;
+        s = s_next;
+    }
+    return table;
+}
+
+/* Entries of the bit reversal table of an n-point CFFT, two per swapped pair */
+constexpr std::size_t bitrev_entries(uint32_t n)
+{
+    std::size_t count = 0U;
+
+    for (uint32_t i = 0U, r = 0U; i < n; i++) {
+        if (i < r) {
+            count += 2U;
+        }
+        r = bitrev_next(r, n >> 1);
+    }
+    return count;
+}
+
+/* Swap pairs in gen_tables.py order, 8 * element index, as rfft_plan_create() */
+template <uint32_t n>
+constexpr std::array<uint16_t, bitrev_entries(n)> make_bitrev()
+{
+    std::array<uint16_t, bitrev_entries(n)> table{};
+    std::size_t count = 0U;
+
+    for (uint32_t i = 0U, r = 0U; i < n; i++) {
+        if (i < r) {
+            table[count++] = static_cast<uint16_t>(8U * i);
+            table[count++] = static_cast<uint16_t>(8U * r);
+        }
+        r = bitrev_next(r, n >> 1);
+    }
+    return table;
+}
+
+/* Shared by every RfftQ15<N>, emitted once in the products that use one */
+template <uint32_t n>
+alignas(4) inline constexpr std::array<q15_t, RFFT_TWIDDLE_TABLE_ENTRIES> twiddles =
+    make_twiddles<n, RFFT_TWIDDLE_TABLE_ENTRIES>();
+
+template <uint32_t n>
+alignas(4) inline constexpr std::array<uint16_t, bitrev_entries(n)> bitrev = make_bitrev<n>();
+
+} /* namespace rfft_q15_detail */
+
+/**
+ * @brief N-point forward Q15 RFFT on compile-time tables.
+ * @tparam N  RFFT length, a power of two from 32 to RFFT_Q15_MAX_FFT_LEN
+ *
+ * All members are static, the class is never instantiated. The results
+ * are those of the C library with rfft_q15_get_instance(N).
+ */
+template <std::size_t N>
+class RfftQ15 {
+    static_assert(rfft_q15_detail::is_length(N) && N <= RFFT_Q15_MAX_FFT_LEN,
+                  "RfftQ15<N> needs a power of two from 32 to RFFT_Q15_MAX_FFT_LEN");
+
+    static constexpr uint32_t cfft_len = static_cast<uint32_t>(N / 2U);
+    static constexpr const q15_t *twiddle_data =
+        rfft_q15_detail::twiddles<RFFT_TWIDDLE_TABLE_LEN>.data();
+
+#if defined(ARM_MATH_DSP) && !defined(RFFT_Q15_NO_BITREV_TABLES)
+    static constexpr const uint16_t *bitrev_data = rfft_q15_detail::bitrev<cfft_len>.data();
+    static constexpr uint16_t bitrev_len =
+        static_cast<uint16_t>(rfft_q15_detail::bitrev_entries(cfft_len));
+#else
+    /* As the prebuilt instances, the scalar code paths reverse without a table */
+    static constexpr const uint16_t *bitrev_data = nullptr;
+    static constexpr uint16_t bitrev_len = 0U;
+#endif
+
+    static constexpr arm_cfft_instance_q15 cfft = {
+        static_cast<uint16_t>(cfft_len), twiddle_data, bitrev_data, bitrev_len,
+    };
+
+    static constexpr arm_rfft_instance_q15 rfft = {
+        static_cast<uint32_t>(N), 0U, 1U, RFFT_TWIDDLE_STRIDE(static_cast<uint32_t>(N)),
+        twiddle_data, nullptr, &cfft,
+    };
+
+public:
+    RfftQ15() = delete;
+
+    /** Input of N samples, aligned for the packed butterfly. */
+    struct alignas(4) Samples : std::array<q15_t, N> {
+    };
+
+    /** Output of forward(), laid out as by arm_rfft_q15(). */
+    struct alignas(4) Spectrum : std::array<q15_t, 2U * N> {
+    };
+
+    /** Instance for the C functions, such as arm_rfft_q15_mag_sq(). */
+    static constexpr const arm_rfft_instance_q15 *instance()
+    {
+        return &rfft;
+    }
+
+    /** arm_rfft_q15(), samples is used as work buffer. */
+    static void forward(Samples &samples, Spectrum &spectrum)
+    {
+        arm_rfft_q15(&rfft, samples.data(), spectrum.data());
+    }
+
+    /** arm_rfft_q15_packed(), the spectrum replaces the samples. */
+    static void forward_packed(Samples &samples)
+    {
+        arm_rfft_q15_packed(&rfft, samples.data());
+    }
+
+    /** arm_rfft_q15_mag_sq(), samples is used as work buffer. */
+    static void mag_sq(Samples &samples, rfft_q15_bin_fn fn, void *user)
+    {
+        arm_rfft_q15_mag_sq(&rfft, samples.data(), fn, user);
+    }
+};
+
+#endif /* RFFT_Q15_SIMPLIFIED_HPP */
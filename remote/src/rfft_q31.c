@@ -0,0 +1,341 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library - Simplified Q31 RFFT
+ * Title:        rfft_q31.c
+ * Description:  Simplified RFFT Q31 process function
+ *
+ * Target Processor: nRF54L15 FLPR (RISC-V)
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2021 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "rfft_q31_simplified.h"
+
+/* Internal split function for RFFT */
+static void arm_split_rfft_q31(
+        q31_t * pSrc,
+        uint32_t fftLen,
+  const q31_t * pTable,
+        q31_t * pDst,
+        uint32_t modifier);
+
+/* Internal split function for RIFFT */
+static void arm_split_rifft_q31(
+        q31_t * pSrc,
+        uint32_t fftLen,
+  const q31_t * pTable,
+        q31_t * pDst,
+        uint32_t modifier);
+
+/*
+ * floor(2^31 * sin) and floor(2^31 * cos) of 2*pi*k/RFFT_Q31_MAX_FFT_LEN,
+ * k < half a turn, from the quarter-wave table. A negative cosine is the
+ * floor of the negated value, ~q.
+ */
+#define RFFT_Q31_QUARTER  ((uint32_t) RFFT_Q31_MAX_FFT_LEN / 4U)
+
+static inline q31_t arm_rfft_sin_q31(const q31_t * pTable, uint32_t k)
+{
+    return (k <= RFFT_Q31_QUARTER) ? pTable[k] : pTable[2U * RFFT_Q31_QUARTER - k];
+}
+
+static inline q31_t arm_rfft_cos_q31(const q31_t * pTable, uint32_t k)
+{
+    return (k <= RFFT_Q31_QUARTER) ? pTable[RFFT_Q31_QUARTER - k] : ~pTable[k - RFFT_Q31_QUARTER];
+}
+
+/*
+ * Split coefficients k: pCoef[0..1] = A = (1 - sin, -cos) / 2 and
+ * pCoef[2..3] = B = (1 + sin, cos) / 2. Rounded and saturated as the
+ * CMSIS realCoefAQ31 and realCoefBQ31 tables, which
+ * round(2^30 * x) = (floor(2^31 * x) + 1) >> 1 gives from the sine table,
+ * summed in 64 bits for the saturated sin = 0x7FFFFFFF.
+ */
+static inline void arm_rfft_coef_q31(
+  const q31_t * pTable,
+        uint32_t k,
+        q31_t * pCoef)
+{
+    q31_t a0 = 0x40000000 - (q31_t) (((q63_t) arm_rfft_sin_q31(pTable, k) + 1) >> 1);
+    q31_t a1 = (-arm_rfft_cos_q31(pTable, k)) >> 1;
+
+    pCoef[0] = a0;
+    pCoef[1] = a1;
+    pCoef[2] = (a0 > 0) ? (q31_t) (0x80000000U - (uint32_t) a0) : 0x7FFFFFFF;
+    pCoef[3] = -a1;
+}
+
+/**
+ * @brief Processing function for the Q31 RFFT.
+ * @param[in]     S     points to an instance of the Q31 RFFT structure
+ * @param[in]     pSrc  points to input buffer (modified by this function)
+ * @param[out]    pDst  points to output buffer
+ */
+void arm_rfft_q31(
+  const arm_rfft_instance_q31 * S,
+        q31_t * pSrc,
+        q31_t * pDst)
+{
+    const arm_cfft_instance_q31 *S_CFFT = S->pCfft;
+    uint32_t L2 = S->fftLenReal >> 1U;
+
+    /* Calculation of RIFFT of input */
+    if (S->ifftFlagR == 1U)
+    {
+        /* Real IFFT core process */
+        arm_split_rifft_q31(pSrc, L2, S->pTwiddleAReal, pDst, S->twidCoefRModifier);
+
+        /* Complex IFFT process */
+        arm_cfft_q31(S_CFFT, pDst, S->ifftFlagR, S->bitReverseFlagR);
+
+        /* Shift output by 1 for IFFT */
+        for (uint32_t i = 0; i < S->fftLenReal; i++)
+        {
+            pDst[i] = pDst[i] << 1;
+        }
+    }
+    else
+    {
+        /* Calculation of RFFT of input */
+
+        /* Complex FFT process */
+        arm_cfft_q31(S_CFFT, pSrc, S->ifftFlagR, S->bitReverseFlagR);
+
+        /* Real FFT core process */
+        arm_split_rfft_q31(pSrc, L2, S->pTwiddleAReal, pDst, S->twidCoefRModifier);
+    }
+}
+
+/*
+ * One output bin of arm_split_rfft_q31(): a = X[i], b = X[fftLen - i],
+ * pCoef from arm_rfft_coef_q31(). The products are accumulated in the
+ * order of CMSIS-DSP, every one rounded on its own.
+ */
+static inline void arm_split_rfft_bin_q31(
+        q31_t aR,
+        q31_t aI,
+        q31_t bR,
+        q31_t bI,
+  const q31_t * pCoef,
+        q31_t * pOutR,
+        q31_t * pOutI)
+{
+    q31_t outR, outI;
+    q31_t CoefA1 = pCoef[0];
+    q31_t CoefA2 = pCoef[1];
+    q31_t CoefB1 = pCoef[2];
+
+    /* outR = (pSrc[2 * i] * pATable[2 * i] */
+    mult_32x32_keep32_R(outR, aR, CoefA1);
+
+    /* outI = pIn[2 * i] * pATable[2 * i + 1] */
+    mult_32x32_keep32_R(outI, aR, CoefA2);
+
+    /* - pSrc[2 * i + 1] * pATable[2 * i + 1] */
+    multSub_32x32_keep32_R(outR, aI, CoefA2);
+
+    /* (pIn[2 * i + 1] * pATable[2 * i] */
+    multAcc_32x32_keep32_R(outI, aI, CoefA1);
+
+    /* pSrc[2 * n - 2 * i + 1] * pBTable[2 * i + 1], pBTable[2 * i + 1] = -pATable[2 * i + 1] */
+    multSub_32x32_keep32_R(outR, bI, CoefA2);
+
+    /* - pIn[2 * n - 2 * i + 1] * pBTable[2 * i] */
+    multSub_32x32_keep32_R(outI, bI, CoefB1);
+
+    /* pSrc[2 * n - 2 * i] * pBTable[2 * i] */
+    multAcc_32x32_keep32_R(outR, bR, CoefB1);
+
+    /* pIn[2 * n - 2 * i] * pBTable[2 * i + 1] */
+    multSub_32x32_keep32_R(outI, bR, CoefA2);
+
+    *pOutR = outR;
+    *pOutI = outI;
+}
+
+/**
+ * @brief Core Real FFT process
+ * @param[in]     pSrc      points to input buffer
+ * @param[in]     fftLen    length of FFT
+ * @param[in]     pTable    points to the quarter-wave sine table
+ * @param[out]    pDst      points to output buffer
+ * @param[in]     modifier  twiddle coefficient modifier
+ */
+static void arm_split_rfft_q31(
+        q31_t * pSrc,
+        uint32_t fftLen,
+  const q31_t * pTable,
+        q31_t * pDst,
+        uint32_t modifier)
+{
+    uint32_t i;
+    q31_t outR, outI;
+    q31_t coef[4];
+    q31_t *pOut1 = &pDst[2], *pOut2 = &pDst[4U * fftLen - 1U];
+    q31_t *pIn1 =  &pSrc[2], *pIn2 =  &pSrc[2U * fftLen - 2U];
+
+    for (i = 1U; i < fftLen; i++)
+    {
+        /*
+          outR = (  pSrc[2 * i]             * pATable[2 * i]
+                  - pSrc[2 * i + 1]         * pATable[2 * i + 1]
+                  + pSrc[2 * n - 2 * i]     * pBTable[2 * i]
+                  + pSrc[2 * n - 2 * i + 1] * pBTable[2 * i + 1]);
+
+          outI = (  pIn[2 * i + 1]         * pATable[2 * i]
+                  + pIn[2 * i]             * pATable[2 * i + 1]
+                  + pIn[2 * n - 2 * i]     * pBTable[2 * i + 1]
+                  - pIn[2 * n - 2 * i + 1] * pBTable[2 * i]);
+         */
+
+        arm_rfft_coef_q31(pTable, modifier * i, coef);
+        arm_split_rfft_bin_q31(pIn1[0], pIn1[1], pIn2[0], pIn2[1], coef, &outR, &outI);
+
+        /* update input pointers */
+        pIn1 += 2U;
+        pIn2 -= 2U;
+
+        /* write output */
+        *pOut1++ = outR;
+        *pOut1++ = outI;
+
+        /* write complex conjugate output */
+        *pOut2-- = -outI;
+        *pOut2-- = outR;
+    }
+
+    pDst[2U * fftLen]      = (pSrc[0] - pSrc[1]) >> 1U;
+    pDst[2U * fftLen + 1U] = 0;
+
+    pDst[0] = (pSrc[0] + pSrc[1]) >> 1U;
+    pDst[1] = 0;
+}
+
+/* Magnitude squared of a bin as stored by arm_rfft_q31(). */
+static inline uint64_t arm_rfft_bin_mag_sq_q31(q31_t re, q31_t im)
+{
+    return (uint64_t) ((q63_t) re * re) + (uint64_t) ((q63_t) im * im);
+}
+
+/**
+ * @brief Real FFT reporting the magnitude squared of each bin.
+ * @param[in]     S     points to an instance of the Q31 RFFT structure
+ * @param[in,out] pSrc  points to input buffer (modified by this function)
+ * @param[in]     fn    called once per bin, bins 0 to fftLenReal / 2
+ * @param[in]     user  passed through to fn
+ *
+ * Like arm_rfft_q15_mag_sq(): the CFFT output stays in bit-reversed
+ * order and the split step reads X[i] and X[fftLen - i] from there.
+ */
+void arm_rfft_q31_mag_sq(
+  const arm_rfft_instance_q31 * S,
+        q31_t * pSrc,
+        rfft_q31_bin_fn fn,
+        void * user)
+{
+    uint32_t L2 = S->fftLenReal >> 1U;
+    uint32_t modifier = S->twidCoefRModifier;
+    uint32_t i, r, rPrev;
+    q31_t outR, outI;
+
+    /* Complex FFT process, output left in bit-reversed order */
+    arm_cfft_q31(S->pCfft, pSrc, 0U, 0U);
+
+    /* X[0] is at position 0 */
+    fn(0U, arm_rfft_bin_mag_sq_q31((pSrc[0] + pSrc[1]) >> 1, 0), user);
+
+    /* r = bitrev(i); bitrev(L2 - i) = (L2 - 1) ^ bitrev(i - 1) */
+    rPrev = 0U;
+    r = rfft_bitrev_next(0U, L2 >> 1U);
+
+    for (i = 1U; i < L2; i++)
+    {
+        uint32_t k = (L2 - 1U) ^ rPrev;
+        q31_t coef[4];
+
+        arm_rfft_coef_q31(S->pTwiddleAReal, modifier * i, coef);
+        arm_split_rfft_bin_q31(pSrc[2U * r], pSrc[2U * r + 1U],
+                               pSrc[2U * k], pSrc[2U * k + 1U],
+                               coef, &outR, &outI);
+
+        fn(i, arm_rfft_bin_mag_sq_q31(outR, outI), user);
+
+        rPrev = r;
+        r = rfft_bitrev_next(r, L2 >> 1U);
+    }
+
+    fn(L2, arm_rfft_bin_mag_sq_q31((pSrc[0] - pSrc[1]) >> 1, 0), user);
+}
+
+/**
+ * @brief Core Real IFFT process
+ * @param[in]     pSrc      points to input buffer
+ * @param[in]     fftLen    length of FFT
+ * @param[in]     pTable    points to the quarter-wave sine table
+ * @param[out]    pDst      points to output buffer
+ * @param[in]     modifier  twiddle coefficient modifier
+ */
+static void arm_split_rifft_q31(
+        q31_t * pSrc,
+        uint32_t fftLen,
+  const q31_t * pTable,
+        q31_t * pDst,
+        uint32_t modifier)
+{
+    uint32_t i;
+    q31_t outR, outI;
+    q31_t coef[4];
+    q31_t CoefA1, CoefA2, CoefB1;
+    q31_t *pIn1 = &pSrc[0];
+    q31_t *pIn2 = &pSrc[2U * fftLen + 1U];
+
+    for (i = 0U; i < fftLen; i++)
+    {
+        /*
+          outR = (  pIn[2 * i]             * pATable[2 * i]
+                  + pIn[2 * i + 1]         * pATable[2 * i + 1]
+                  + pIn[2 * n - 2 * i]     * pBTable[2 * i]
+                  - pIn[2 * n - 2 * i + 1] * pBTable[2 * i + 1]);
+
+          outI = (  pIn[2 * i + 1]         * pATable[2 * i]
+                  - pIn[2 * i]             * pATable[2 * i + 1]
+                  - pIn[2 * n - 2 * i]     * pBTable[2 * i + 1]
+                  - pIn[2 * n - 2 * i + 1] * pBTable[2 * i]);
+         */
+
+        arm_rfft_coef_q31(pTable, modifier * i, coef);
+        CoefA1 = coef[0];
+        CoefA2 = coef[1];
+        CoefB1 = coef[2];
+
+        /* outR = (pIn[2 * i] * pATable[2 * i] */
+        mult_32x32_keep32_R(outR, *pIn1, CoefA1);
+
+        /* - pIn[2 * i] * pATable[2 * i + 1] */
+        mult_32x32_keep32_R(outI, *pIn1++, -CoefA2);
+
+        /* pIn[2 * i + 1] * pATable[2 * i + 1] */
+        multAcc_32x32_keep32_R(outR, *pIn1, CoefA2);
+
+        /* pIn[2 * i + 1] * pATable[2 * i] */
+        multAcc_32x32_keep32_R(outI, *pIn1++, CoefA1);
+
+        /* - pIn[2 * n - 2 * i + 1] * pBTable[2 * i + 1], pBTable[2 * i + 1] = -pATable[2 * i + 1] */
+        multAcc_32x32_keep32_R(outR, *pIn2, CoefA2);
+
+        /* - pIn[2 * n - 2 * i + 1] * pBTable[2 * i] */
+        multSub_32x32_keep32_R(outI, *pIn2--, CoefB1);
+
+        /* pIn[2 * n - 2 * i] * pBTable[2 * i] */
+        multAcc_32x32_keep32_R(outR, *pIn2, CoefB1);
+
+        /* - pIn[2 * n - 2 * i] * pBTable[2 * i + 1] */
+        multAcc_32x32_keep32_R(outI, *pIn2--, CoefA2);
+
+        /* write output */
+        *pDst++ = outR;
+        *pDst++ = outI;
+    }
+}
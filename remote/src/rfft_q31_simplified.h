@@ -0,0 +1,266 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library - Simplified Q31 RFFT
+ * Title:        rfft_q31.h
+ * Description:  Public header file for simplified Q31 RFFT implementation
+ *
+ * Target Processor: nRF54L15 FLPR (RISC-V)
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2021 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef RFFT_Q31_H
+#define RFFT_Q31_H
+
+/* q31_t, rfft_status_t and rfft_bitrev_next() */
+#include "rfft_q15_simplified.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ========================================================================= */
+/* Type Definitions                                                          */
+/* ========================================================================= */
+
+/**
+ * @brief 64-bit fractional data type in 1.63 format.
+ */
+typedef int64_t q63_t;
+
+/**
+ * @brief Instance structure for the Q31 CFFT/CIFFT function.
+ *
+ * The bit reversal is always computed, so unlike arm_cfft_instance_q15
+ * there is no index table.
+ */
+typedef struct {
+    uint16_t fftLen;                   /**< length of the FFT. */
+    const q31_t *pTwiddle;             /**< points to the Twiddle factor table. */
+} arm_cfft_instance_q31;
+
+/**
+ * @brief Instance structure for the Q31 RFFT/RIFFT function.
+ */
+typedef struct {
+    uint32_t fftLenReal;                      /**< length of the real FFT. */
+    uint8_t ifftFlagR;                        /**< flag that selects forward (ifftFlagR=0) or inverse (ifftFlagR=1) transform. */
+    uint8_t bitReverseFlagR;                  /**< flag that enables (bitReverseFlagR=1) or disables (bitReverseFlagR=0) bit reversal of output. */
+    uint32_t twidCoefRModifier;               /**< twiddle coefficient modifier that supports different size FFTs with the same twiddle factor table. */
+    const q31_t *pTwiddleAReal;               /**< points to the sine table the split coefficients are derived from. */
+    const q31_t *pTwiddleBReal;               /**< unused (NULL), B is derived together with A. */
+    const arm_cfft_instance_q31 *pCfft;       /**< points to the complex FFT instance. */
+} arm_rfft_instance_q31;
+
+/* ========================================================================= */
+/* Supported Lengths                                                         */
+/* ========================================================================= */
+
+/*
+ * RFFT lengths that are built in: the powers of two from
+ * RFFT_Q31_MIN_FFT_LEN to RFFT_Q31_MAX_FFT_LEN, within 32 to 8192.
+ * twiddle_tables_q31.c must be generated for the same maximum by
+ * gen_tables.py --q31. Both values must be plain decimal literals, the
+ * table names are pasted from them.
+ */
+#ifndef RFFT_Q31_MIN_FFT_LEN
+#define RFFT_Q31_MIN_FFT_LEN  4096
+#endif
+
+#ifndef RFFT_Q31_MAX_FFT_LEN
+#define RFFT_Q31_MAX_FFT_LEN  4096
+#endif
+
+#if (RFFT_Q31_MIN_FFT_LEN & (RFFT_Q31_MIN_FFT_LEN - 1)) != 0 || \
+    (RFFT_Q31_MAX_FFT_LEN & (RFFT_Q31_MAX_FFT_LEN - 1)) != 0 || \
+    RFFT_Q31_MIN_FFT_LEN < 32 || RFFT_Q31_MAX_FFT_LEN > 8192 || \
+    RFFT_Q31_MIN_FFT_LEN > RFFT_Q31_MAX_FFT_LEN
+#error "RFFT_Q31_MIN_FFT_LEN and RFFT_Q31_MAX_FFT_LEN must be powers of two from 32 to 8192"
+#endif
+
+/** Nonzero when n-point Q31 RFFTs are built in, usable in #if */
+#define RFFT_Q31_HAS_LEN(n)  ((n) >= RFFT_Q31_MIN_FFT_LEN && (n) <= RFFT_Q31_MAX_FFT_LEN)
+
+/* ========================================================================= */
+/* Public API Functions                                                      */
+/* ========================================================================= */
+
+/**
+ * @brief Prebuilt forward Q31 RFFT instance of a given length.
+ * @param[in] fftLenReal  RFFT length
+ * @return Instance, or NULL when fftLenReal is not built in
+ */
+const arm_rfft_instance_q31 *rfft_q31_get_instance(uint32_t fftLenReal);
+
+/**
+ * @brief Initialize Q31 RFFT instance of a given length.
+ * @param[out] S           Pointer to RFFT instance structure
+ * @param[in]  fftLenReal  RFFT length
+ * @return Status code
+ *
+ * @note Copies the forward instance; set S->ifftFlagR to 1 for the inverse.
+ */
+rfft_status_t rfft_q31_init(arm_rfft_instance_q31 *S, uint32_t fftLenReal);
+
+/**
+ * @brief Process real FFT on Q31 data.
+ * @param[in]  S     Pointer to RFFT instance structure
+ * @param[in]  pSrc  Pointer to input buffer (modified in-place)
+ * @param[out] pDst  Pointer to output buffer
+ *
+ * @note Same layouts and scaling as the CMSIS-DSP arm_rfft_q31(): the
+ *       forward transform writes 2 * fftLenReal values, the spectrum and
+ *       its complex conjugate, in 1.31 format downscaled by fftLenReal
+ *       (13.19 at 4096 points). The inverse reads fftLenReal + 2 values
+ *       and writes fftLenReal samples.
+ */
+void arm_rfft_q31(
+    const arm_rfft_instance_q31 * S,
+    q31_t * pSrc,
+    q31_t * pDst);
+
+/**
+ * @brief Process complex FFT on Q31 data.
+ * @param[in]     S               Pointer to CFFT instance structure
+ * @param[in,out] p1              Pointer to complex data buffer (in-place)
+ * @param[in]     ifftFlag        0=forward FFT, 1=inverse FFT
+ * @param[in]     bitReverseFlag  0=disable bit reversal, 1=enable bit reversal
+ */
+void arm_cfft_q31(
+    const arm_cfft_instance_q31 * S,
+    q31_t * p1,
+    uint8_t ifftFlag,
+    uint8_t bitReverseFlag);
+
+/**
+ * @brief In-place bit reversal for Q31 data, without an index table.
+ * @param[in,out] pSrc    Pointer to complex data buffer
+ * @param[in]     fftLen  Complex FFT length (power of two)
+ */
+void arm_bitreversal_q31_notable(
+    q31_t * pSrc,
+    uint32_t fftLen);
+
+/**
+ * @brief Callback receiving one bin of arm_rfft_q31_mag_sq().
+ * @param[in] bin     bin index, 0 (DC) to fftLenReal / 2 (Nyquist)
+ * @param[in] mag_sq  real² + imag² of the bin, as arm_rfft_q31() outputs it
+ * @param[in] user    user pointer passed to arm_rfft_q31_mag_sq()
+ */
+typedef void (*rfft_q31_bin_fn)(uint32_t bin, uint64_t mag_sq, void *user);
+
+/**
+ * @brief Real FFT reporting the magnitude squared of each bin.
+ * @param[in]     S     Pointer to a forward RFFT instance structure
+ * @param[in,out] pSrc  Pointer to input buffer (modified in-place)
+ * @param[in]     fn    Called once per bin, in ascending bin order
+ * @param[in]     user  Passed through to fn
+ *
+ * @note Computes the same bins as arm_rfft_q31() followed by real² + imag²
+ *       on its output, without the 2 * fftLenReal output buffer: a
+ *       4096-point transform needs the 16 KB input buffer only.
+ */
+void arm_rfft_q31_mag_sq(
+    const arm_rfft_instance_q31 * S,
+    q31_t * pSrc,
+    rfft_q31_bin_fn fn,
+    void * user);
+
+/* ========================================================================= */
+/* Helper Functions                                                          */
+/* ========================================================================= */
+
+/* Q31 products of CMSIS-DSP: high word of x * y, rounded */
+#define mult_32x32_keep32_R(a, x, y) \
+    a = (q31_t) (((q63_t) (x) * (y) + 0x80000000LL) >> 32)
+
+#define multAcc_32x32_keep32_R(a, x, y) \
+    a += (q31_t) (((q63_t) (x) * (y) + 0x80000000LL) >> 32)
+
+#define multSub_32x32_keep32_R(a, x, y) \
+    a -= (q31_t) (((q63_t) (x) * (y) + 0x80000000LL) >> 32)
+
+/* ========================================================================= */
+/* External Table Declarations                                               */
+/* ========================================================================= */
+
+/*
+ * The CMSIS-DSP Q31 tables are rounded differently: the CFFT twiddles are
+ * floor(2^31 * x + 0.05), the split coefficients floor(2^31 * x) based.
+ * One table cannot give both bit-exactly, so there are two:
+ *
+ * - RFFT_Q31_TWIDDLE_TABLE, cos and sin for 3 quarters of a turn of the
+ *   largest CFFT, twiddleCoef_<len>_q31. Smaller CFFTs read it with the
+ *   stride RFFT_Q31_TWIDDLE_STRIDE().
+ * - RFFT_Q31_SPLIT_TABLE, a quarter-wave sine in steps of
+ *   2*pi/RFFT_Q31_MAX_FFT_LEN, twiddleSinQ31_<len>, from which the split
+ *   coefficients A and B are derived.
+ *
+ * At 4096 points that is 16 KB instead of the 12 KB twiddle table plus
+ * 2 x 32 KB realCoefAQ31 / realCoefBQ31 of CMSIS-DSP.
+ */
+#define RFFT_Q31_TWIDDLE_TABLE_LEN  ((uint32_t) RFFT_Q31_MAX_FFT_LEN / 2U)
+
+#if RFFT_Q31_MAX_FFT_LEN == 32
+#define RFFT_Q31_TWIDDLE_TABLE  twiddleCoef_16_q31
+#elif RFFT_Q31_MAX_FFT_LEN == 64
+#define RFFT_Q31_TWIDDLE_TABLE  twiddleCoef_32_q31
+#elif RFFT_Q31_MAX_FFT_LEN == 128
+#define RFFT_Q31_TWIDDLE_TABLE  twiddleCoef_64_q31
+#elif RFFT_Q31_MAX_FFT_LEN == 256
+#define RFFT_Q31_TWIDDLE_TABLE  twiddleCoef_128_q31
+#elif RFFT_Q31_MAX_FFT_LEN == 512
+#define RFFT_Q31_TWIDDLE_TABLE  twiddleCoef_256_q31
+#elif RFFT_Q31_MAX_FFT_LEN == 1024
+#define RFFT_Q31_TWIDDLE_TABLE  twiddleCoef_512_q31
+#elif RFFT_Q31_MAX_FFT_LEN == 2048
+#define RFFT_Q31_TWIDDLE_TABLE  twiddleCoef_1024_q31
+#elif RFFT_Q31_MAX_FFT_LEN == 4096
+#define RFFT_Q31_TWIDDLE_TABLE  twiddleCoef_2048_q31
+#else
+#define RFFT_Q31_TWIDDLE_TABLE  twiddleCoef_4096_q31
+#endif
+extern const q31_t RFFT_Q31_TWIDDLE_TABLE[3 * RFFT_Q31_MAX_FFT_LEN / 4];
+
+#define RFFT_Q31_SPLIT_TABLE  RFFT_Q15_CAT(twiddleSinQ31_, RFFT_Q31_MAX_FFT_LEN, )
+extern const q31_t RFFT_Q31_SPLIT_TABLE[RFFT_Q31_MAX_FFT_LEN / 4 + 1];
+
+/** Stride of an fftLen-point CFFT through RFFT_Q31_TWIDDLE_TABLE */
+#define RFFT_Q31_TWIDDLE_STRIDE(fftLen)  (RFFT_Q31_TWIDDLE_TABLE_LEN / (fftLen))
+
+/* Prebuilt forward RFFT instances, usable without an init call */
+#if RFFT_Q31_HAS_LEN(32)
+extern const arm_rfft_instance_q31 arm_rfft_sR_q31_len32;
+#endif
+#if RFFT_Q31_HAS_LEN(64)
+extern const arm_rfft_instance_q31 arm_rfft_sR_q31_len64;
+#endif
+#if RFFT_Q31_HAS_LEN(128)
+extern const arm_rfft_instance_q31 arm_rfft_sR_q31_len128;
+#endif
+#if RFFT_Q31_HAS_LEN(256)
+extern const arm_rfft_instance_q31 arm_rfft_sR_q31_len256;
+#endif
+#if RFFT_Q31_HAS_LEN(512)
+extern const arm_rfft_instance_q31 arm_rfft_sR_q31_len512;
+#endif
+#if RFFT_Q31_HAS_LEN(1024)
+extern const arm_rfft_instance_q31 arm_rfft_sR_q31_len1024;
+#endif
+#if RFFT_Q31_HAS_LEN(2048)
+extern const arm_rfft_instance_q31 arm_rfft_sR_q31_len2048;
+#endif
+#if RFFT_Q31_HAS_LEN(4096)
+extern const arm_rfft_instance_q31 arm_rfft_sR_q31_len4096;
+#endif
+#if RFFT_Q31_HAS_LEN(8192)
+extern const arm_rfft_instance_q31 arm_rfft_sR_q31_len8192;
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RFFT_Q31_H */
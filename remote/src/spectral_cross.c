@@ -0,0 +1,91 @@
+/* ----------------------------------------------------------------------
+ * Project:      FFT Utility Functions
+ * Title:        spectral_cross.c
+ * Description:  Averaged cross spectrum and coherence of two channels
+ *
+ * Target Processor: nRF54L15 FLPR (RISC-V)
+ * -------------------------------------------------------------------- */
+
+#include "spectral_cross.h"
+#include <string.h>
+
+/* Bits of the divisor of a coherence, so the Q15 quotient fits 32 bits */
+#define CROSS_DIVISOR_BITS  17U
+
+/**
+ * @brief Start a new average of two channels
+ */
+rfft_status_t spectral_cross_init(
+    spectral_cross_t *cross,
+    int32_t *cross_acc,
+    uint32_t *x_acc,
+    uint32_t *y_acc,
+    uint16_t num_bins,
+    spectral_psd_mode_t mode,
+    uint8_t shift
+)
+{
+    rfft_status_t status;
+
+    if (cross == NULL || cross_acc == NULL) {
+        return RFFT_ERROR_NULL_POINTER;
+    }
+
+    status = spectral_psd_init(&cross->x, x_acc, num_bins, mode, shift);
+    if (status == RFFT_SUCCESS) {
+        status = spectral_psd_init(&cross->y, y_acc, num_bins, mode, shift);
+    }
+    if (status != RFFT_SUCCESS) {
+        return status;
+    }
+
+    cross->cross = cross_acc;
+    memset(cross->cross, 0, 2U * num_bins * sizeof(int32_t));
+
+    return RFFT_SUCCESS;
+}
+
+/**
+ * @brief Clear the averages, e.g. after they were read out
+ */
+void spectral_cross_reset(spectral_cross_t *cross)
+{
+    spectral_psd_reset(&cross->x);
+    spectral_psd_reset(&cross->y);
+    memset(cross->cross, 0, 2U * cross->x.num_bins * sizeof(int32_t));
+}
+
+/**
+ * @brief Magnitude-squared coherence of the averages
+ */
+void spectral_cross_coherence(const spectral_cross_t *cross, q15_t *out)
+{
+    for (uint32_t bin = 0; bin < cross->x.num_bins; bin++) {
+        int64_t re = cross->cross[2U * bin];
+        int64_t im = cross->cross[2U * bin + 1U];
+        uint64_t den = (uint64_t) cross->x.acc[bin] * cross->y.acc[bin];
+        /* Each square is at most 2^62 */
+        uint64_t num = (uint64_t) (re * re) + (uint64_t) (im * im);
+        uint32_t shift, n, d;
+
+        if (den == 0U) {
+            out[bin] = 0;
+            continue;
+        }
+
+        /* Both scaled alike, the divisor to 17 bits and the quotient to 32 */
+        shift = (den >> CROSS_DIVISOR_BITS) != 0U ?
+                64U - (uint32_t) __builtin_clzll(den) - CROSS_DIVISOR_BITS : 0U;
+        d = (uint32_t) (den >> shift);
+        num >>= shift;
+
+        /* Rounding of the averages may leave |Sxy|² a little above the product */
+        if (num >= d) {
+            out[bin] = 0x7FFF;
+            continue;
+        }
+
+        n = (uint32_t) num;
+        out[bin] = (q15_t) ((n << 15) / d);
+    }
+}
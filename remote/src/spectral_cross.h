@@ -0,0 +1,171 @@
+/* ----------------------------------------------------------------------
+ * Project:      FFT Utility Functions
+ * Title:        spectral_cross.h
+ * Description:  Averaged cross spectrum and coherence of two channels
+ *
+ * Target Processor: nRF54L15 FLPR (RISC-V)
+ * -------------------------------------------------------------------- */
+
+#ifndef SPECTRAL_CROSS_H
+#define SPECTRAL_CROSS_H
+
+#include "spectral_psd.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Welch-style average of the cross spectrum X * conj(Y)
+ *
+ * The power spectra of both channels are spectral_psd_t averages, and the
+ * cross spectrum is averaged next to them in the same mode and over the
+ * same frames, signed: cross[2 * bin] is the real part of X * conj(Y),
+ * in the Q31 of their magnitudes², cross[2 * bin + 1] the imaginary part.
+ * A bin costs four dual 16-bit multiplies, SMUAD and SMUSDX on the
+ * Cortex-M33, for |X|², |Y|² and both parts of X * conj(Y), each added
+ * accumulated in 32 bits next to the magnitudes² of spectral_psd_push().
+ *
+ * spectral_cross_coherence() divides the averages into the
+ * magnitude-squared coherence, |Sxy|² / (Sxx * Syy), once per readout;
+ * averaging over several frames is what makes it other than 1.
+ */
+typedef struct {
+    spectral_psd_t x;      /**< Average of |X|², channel 0 */
+    spectral_psd_t y;      /**< Average of |Y|², channel 1 */
+    int32_t *cross;        /**< 2 * num_bins averaged re and im of X * conj(Y) (Q31) */
+} spectral_cross_t;
+
+/**
+ * @brief Start a new average of two channels
+ *
+ * @param[out] cross        Average state
+ * @param[in]  cross_acc    2 * num_bins values, owned by the caller
+ * @param[in]  x_acc        SPECTRAL_PSD_STORAGE_LEN(num_bins) values, owned by the caller
+ * @param[in]  y_acc        SPECTRAL_PSD_STORAGE_LEN(num_bins) values, owned by the caller
+ * @param[in]  num_bins     Bins per frame, fft_size / 2 + 1 for an RFFT
+ * @param[in]  mode         Linear or exponential averaging
+ * @param[in]  shift        log2 of the frames averaged (0 to 15)
+ *
+ * @return rfft_status_t, as for spectral_psd_init()
+ *
+ * @example
+ *   static int32_t sxy[2 * (1024 / 2 + 1)];
+ *   static uint32_t sxx[SPECTRAL_PSD_STORAGE_LEN(1024 / 2 + 1)];
+ *   static uint32_t syy[SPECTRAL_PSD_STORAGE_LEN(1024 / 2 + 1)];
+ *   static spectral_cross_t cross;
+ *
+ *   // Mean of 16 frame pairs
+ *   spectral_cross_init(&cross, sxy, sxx, syy, 1024 / 2 + 1, SPECTRAL_PSD_LINEAR, 4);
+ */
+rfft_status_t spectral_cross_init(
+    spectral_cross_t *cross,
+    int32_t *cross_acc,
+    uint32_t *x_acc,
+    uint32_t *y_acc,
+    uint16_t num_bins,
+    spectral_psd_mode_t mode,
+    uint8_t shift
+);
+
+/**
+ * @brief Clear the averages, e.g. after they were read out
+ *
+ * @param[in,out] cross  Initialized average state
+ */
+void spectral_cross_reset(spectral_cross_t *cross);
+
+/**
+ * @brief Check whether the next frame pair is added
+ *
+ * @return false once a linear average holds its 2^shift frames
+ */
+static inline bool spectral_cross_accepts(const spectral_cross_t *cross)
+{
+    return spectral_psd_accepts(&cross->x);
+}
+
+/*
+ * Move a signed average by one product. A linear one adds every product
+ * rounded to the nearest, whose errors of both signs cancel over the
+ * frames, where the magnitudes² of spectral_psd_push() keep their low bits.
+ */
+static inline void spectral_cross_acc(const spectral_cross_t *cross, int32_t *acc, q31_t v)
+{
+    const spectral_psd_t *psd = &cross->x;
+    int64_t half = (int64_t) ((1U << psd->shift) >> 1);
+
+    if (psd->mode == SPECTRAL_PSD_LINEAR) {
+        *acc += (int32_t) (((int64_t) v + half) >> psd->shift);
+    } else if (psd->frames == 0) {
+        *acc = v;
+    } else {
+        /* Both are within 2^31, their distance is not */
+        *acc += (int32_t) (((int64_t) v - *acc + half) >> psd->shift);
+    }
+}
+
+/**
+ * @brief Add one bin of the current frame pair
+ *
+ * x and y are the bin of each channel as one word, the real part in the
+ * low half and the imaginary part in the high half, as read_q15x2() reads
+ * it from an RFFT output. The products wrap at 2^31 as the instructions
+ * do, for bins of -32768 in both parts. Only call while
+ * spectral_cross_accepts() holds, and end every frame pair with
+ * spectral_cross_end_frame().
+ *
+ * @param[in,out] cross  Initialized average state
+ * @param[in]     bin    Bin index, below num_bins
+ * @param[in]     x      Bin of channel 0
+ * @param[in]     y      Bin of channel 1
+ */
+static inline void spectral_cross_push(spectral_cross_t *cross, uint32_t bin, q31_t x, q31_t y)
+{
+#if defined (ARM_MATH_DSP)
+    q31_t xx = __SMUAD(x, x);
+    q31_t yy = __SMUAD(y, y);
+    /* (a + jb)(c - jd) = (ac + bd) + j(bc - ad) */
+    q31_t re = __SMUAD(x, y);
+    q31_t im = __SMUSDX(y, x);
+#else
+    q31_t xx = rfft_q15_smuad(x, x);
+    q31_t yy = rfft_q15_smuad(y, y);
+    q31_t re = rfft_q15_smuad(x, y);
+    q31_t im = rfft_q15_smusdx(y, x);
+#endif
+
+    spectral_psd_push(&cross->x, bin, (uint32_t) xx);
+    spectral_psd_push(&cross->y, bin, (uint32_t) yy);
+    spectral_cross_acc(cross, &cross->cross[2U * bin], re);
+    spectral_cross_acc(cross, &cross->cross[2U * bin + 1U], im);
+}
+
+/**
+ * @brief Count the frame pair whose bins were pushed
+ *
+ * @param[in,out] cross  Initialized average state
+ */
+static inline void spectral_cross_end_frame(spectral_cross_t *cross)
+{
+    spectral_psd_end_frame(&cross->x);
+    spectral_psd_end_frame(&cross->y);
+}
+
+/**
+ * @brief Magnitude-squared coherence of the averages
+ *
+ * out[bin] = |Sxy|² / (Sxx * Syy) in Q15, 0 to 32767, and 0 where either
+ * channel has no power. The quotient of each bin is one 32-bit division,
+ * with the divisor kept to 17 bits.
+ *
+ * @param[in]  cross  Average state
+ * @param[out] out    num_bins coherences
+ */
+void spectral_cross_coherence(const spectral_cross_t *cross, q15_t *out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SPECTRAL_CROSS_H */
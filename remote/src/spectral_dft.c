@@ -0,0 +1,296 @@
+/* ----------------------------------------------------------------------
+ * Project:      FFT Utility Functions
+ * Title:        spectral_dft.c
+ * Description:  Magnitude² of a sparse set of DFT bins, per frame or sliding
+ *
+ * Target Processor: nRF54L15 FLPR (RISC-V)
+ * -------------------------------------------------------------------- */
+
+#include "spectral_dft.h"
+#include <stddef.h>
+#include <string.h>
+
+/* log2 of a power of two */
+static uint8_t dft_log2(uint32_t n)
+{
+    uint8_t log2_n = 0;
+
+    while ((1U << log2_n) < n) {
+        log2_n++;
+    }
+
+    return log2_n;
+}
+
+/* Check a bin set for frames of fft_size samples */
+static bool dft_bins_valid(uint16_t fft_size, const uint16_t *bins, uint16_t num_bins)
+{
+    /* Only sizes the build has tables for, so the twiddle stride is whole */
+    if (num_bins == 0 || rfft_q15_get_instance(fft_size) == NULL) {
+        return false;
+    }
+
+    for (uint16_t i = 0; i < num_bins; i++) {
+        if (bins[i] > fft_size / 2U || (i > 0 && bins[i] <= bins[i - 1])) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/* cos and sin of phase m in steps of the twiddle table, m below its length */
+static inline void dft_twiddle(uint32_t m, q31_t *c, q31_t *s)
+{
+    if (m <= RFFT_TWIDDLE_TABLE_LEN / 2U) {
+        *c = RFFT_TWIDDLE_COS(RFFT_TWIDDLE_TABLE, m);
+        *s = RFFT_TWIDDLE_SIN(RFFT_TWIDDLE_TABLE, m);
+    } else {
+        *c = RFFT_TWIDDLE_COS(RFFT_TWIDDLE_TABLE, RFFT_TWIDDLE_TABLE_LEN - m);
+        *s = -RFFT_TWIDDLE_SIN(RFFT_TWIDDLE_TABLE, RFFT_TWIDDLE_TABLE_LEN - m);
+    }
+}
+
+/* Saturate a bin to Q15, as arm_rfft_q15() stores it */
+static q15_t dft_sat(int64_t v)
+{
+    return (q15_t) ((v > 32767) ? 32767 : ((v < -32768) ? -32768 : v));
+}
+
+/* Magnitude squared of a bin, as arm_rfft_q15_mag_sq() reports it */
+static uint32_t dft_mag_sq(q15_t re, q15_t im)
+{
+    return (uint32_t) ((q31_t) re * re) + (uint32_t) ((q31_t) im * im);
+}
+
+/**
+ * @brief Watch a set of bins of frames of one size
+ */
+rfft_status_t spectral_dft_init(
+    spectral_dft_t *dft,
+    uint16_t fft_size,
+    const uint16_t *bins,
+    uint16_t num_bins
+)
+{
+    if (dft == NULL || bins == NULL) {
+        return RFFT_ERROR_NULL_POINTER;
+    }
+
+    if (!dft_bins_valid(fft_size, bins, num_bins)) {
+        return RFFT_ERROR_INVALID_SIZE;
+    }
+
+    dft->bins = bins;
+    dft->num_bins = num_bins;
+    dft->fft_size = fft_size;
+    dft->log2_size = dft_log2(fft_size);
+
+    return RFFT_SUCCESS;
+}
+
+/**
+ * @brief Check whether num_bins bins are cheaper to correlate than a full RFFT
+ */
+bool spectral_dft_preferred(uint16_t fft_size, uint16_t num_bins)
+{
+    uint32_t log2_size = dft_log2(fft_size);
+
+    /* 2 n per bin < 3/4 n (log2 n - 1) + 3 n, in units of n / 4 */
+    return 8U * num_bins < 3U * (log2_size - 1U) + 12U;
+}
+
+/**
+ * @brief Magnitude² of the watched bins of one frame
+ */
+void spectral_dft_mag_sq(
+    const spectral_dft_t *dft,
+    const q15_t *input,
+    rfft_q15_bin_fn fn,
+    void *user
+)
+{
+    const uint32_t mask = RFFT_TWIDDLE_TABLE_LEN - 1U;
+    const uint32_t stride = RFFT_TWIDDLE_STRIDE(dft->fft_size);
+    const uint8_t shift = dft->log2_size;
+
+    for (uint16_t b = 0; b < dft->num_bins; b++) {
+        uint32_t step = dft->bins[b] * stride;
+        uint32_t m = 0;
+        q31_t re = 0;
+        q31_t im = 0;
+
+        /*
+         * Phase k n of sample n, in table steps modulo the table. Each
+         * product is scaled by 1/fft_size before it is added, so the sum
+         * is X[k] / fft_size in Q30 and cannot overflow.
+         */
+        for (uint32_t n = 0; n < dft->fft_size; n++) {
+            q31_t x = input[n];
+            q31_t c;
+            q31_t s;
+
+            dft_twiddle(m, &c, &s);
+
+            re += (x * c) >> shift;
+            im -= (x * s) >> shift;
+
+            m = (m + step) & mask;
+        }
+
+        /* Back to the scale of arm_rfft_q15(), rounded */
+        fn(dft->bins[b],
+           dft_mag_sq(dft_sat((re + (1 << 14)) >> 15), dft_sat((im + (1 << 14)) >> 15)),
+           user);
+    }
+}
+
+/**
+ * @brief Track a set of bins of a stream of samples
+ */
+rfft_status_t spectral_sdft_init(
+    spectral_sdft_t *sdft,
+    q15_t *ring,
+    int64_t *acc,
+    uint16_t fft_size,
+    const uint16_t *bins,
+    uint16_t num_bins
+)
+{
+    if (sdft == NULL || ring == NULL || acc == NULL || bins == NULL) {
+        return RFFT_ERROR_NULL_POINTER;
+    }
+
+    if (!dft_bins_valid(fft_size, bins, num_bins)) {
+        return RFFT_ERROR_INVALID_SIZE;
+    }
+
+    sdft->ring = ring;
+    sdft->acc = acc;
+    sdft->bins = bins;
+    sdft->num_bins = num_bins;
+    sdft->fft_size = fft_size;
+    sdft->log2_size = dft_log2(fft_size);
+    spectral_sdft_reset(sdft);
+
+    return RFFT_SUCCESS;
+}
+
+/**
+ * @brief Forget the history, e.g. after a gap in the stream
+ */
+void spectral_sdft_reset(spectral_sdft_t *sdft)
+{
+    memset(sdft->ring, 0, sdft->fft_size * sizeof(q15_t));
+    memset(sdft->acc, 0, 2U * sdft->num_bins * sizeof(int64_t));
+    sdft->pos = 0;
+}
+
+/**
+ * @brief Slide the frame over new samples
+ */
+void spectral_sdft_push(spectral_sdft_t *sdft, const q15_t *samples, uint32_t count)
+{
+    const uint32_t mask = RFFT_TWIDDLE_TABLE_LEN - 1U;
+    const uint32_t ring_mask = sdft->fft_size - 1U;
+    const uint32_t stride = RFFT_TWIDDLE_STRIDE(sdft->fft_size);
+
+    /* In runs of at most a frame, so the ring holds every sample that drops out */
+    while (count > 0) {
+        uint32_t run = (count < sdft->fft_size) ? count : sdft->fft_size;
+
+        /* Bin by bin over the run, so the phase is one add per sample */
+        for (uint16_t b = 0; b < sdft->num_bins; b++) {
+            uint32_t step = sdft->bins[b] * stride;
+            uint32_t m = (step * sdft->pos) & mask;
+            uint32_t r = sdft->pos;
+            int64_t re = sdft->acc[2U * b];
+            int64_t im = sdft->acc[2U * b + 1U];
+
+            for (uint32_t n = 0; n < run; n++) {
+                /* At most 2^16 - 1 times 2^15, the product fits in 32 bits */
+                q31_t d = (q31_t) samples[n] - sdft->ring[r];
+                q31_t c;
+                q31_t s;
+
+                dft_twiddle(m, &c, &s);
+
+                re += d * c;
+                im -= d * s;
+
+                m = (m + step) & mask;
+                r = (r + 1U) & ring_mask;
+            }
+
+            sdft->acc[2U * b] = re;
+            sdft->acc[2U * b + 1U] = im;
+        }
+
+        for (uint32_t n = 0; n < run; n++) {
+            sdft->ring[sdft->pos] = samples[n];
+            sdft->pos = (sdft->pos + 1U) & ring_mask;
+        }
+
+        samples += run;
+        count -= run;
+    }
+}
+
+/**
+ * @brief Magnitude² of the tracked bins over the last fft_size samples
+ */
+void spectral_sdft_mag_sq(const spectral_sdft_t *sdft, rfft_q15_bin_fn fn, void *user)
+{
+    /* The sums are X[k] in Q15 times 2^15, scale to X[k] / fft_size */
+    const uint32_t shift = 15U + sdft->log2_size;
+    const int64_t round = (int64_t) 1 << (shift - 1U);
+
+    for (uint16_t b = 0; b < sdft->num_bins; b++) {
+        fn(sdft->bins[b],
+           dft_mag_sq(dft_sat((sdft->acc[2U * b] + round) >> shift),
+                      dft_sat((sdft->acc[2U * b + 1U] + round) >> shift)),
+           user);
+    }
+}
+
+/* rfft_q15_bin_fn: offer one bin to the top N selection, DC skipped */
+static void sdft_top_bins_add(uint32_t bin, uint32_t mag_sq, void *user)
+{
+    if (bin == 0) {
+        return;
+    }
+
+    spectral_topk_push(user, (uint16_t) bin, mag_sq);
+}
+
+/**
+ * @brief Find the strongest of the tracked bins
+ */
+rfft_status_t spectral_sdft_top_bins(
+    const spectral_sdft_t *sdft,
+    spectral_peak_t *storage,
+    uint16_t *output_bin_indices,
+    uint16_t num_top_bins
+)
+{
+    spectral_topk_t topk;
+    const spectral_peak_t *top_bins;
+
+    if (sdft == NULL || storage == NULL || output_bin_indices == NULL) {
+        return RFFT_ERROR_NULL_POINTER;
+    }
+
+    if (num_top_bins == 0 || num_top_bins > sdft->num_bins) {
+        return RFFT_ERROR_INVALID_SIZE;
+    }
+
+    spectral_topk_init(&topk, storage, num_top_bins);
+    spectral_sdft_mag_sq(sdft, sdft_top_bins_add, &topk);
+    top_bins = spectral_topk_finish(&topk);
+
+    for (uint16_t i = 0; i < num_top_bins; i++) {
+        output_bin_indices[i] = top_bins[i].bin_index;
+    }
+
+    return RFFT_SUCCESS;
+}
@@ -0,0 +1,208 @@
+/* ----------------------------------------------------------------------
+ * Project:      FFT Utility Functions
+ * Title:        spectral_dft.h
+ * Description:  Magnitude² of a sparse set of DFT bins, per frame or sliding
+ *
+ * Target Processor: nRF54L15 FLPR (RISC-V)
+ * -------------------------------------------------------------------- */
+
+#ifndef SPECTRAL_DFT_H
+#define SPECTRAL_DFT_H
+
+#include <stdbool.h>
+#include "rfft_q15_simplified.h"
+#include "spectral_topk.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief A fixed set of bins of an fft_size-point real DFT
+ *
+ * Each bin is correlated with the frame directly, against cos and sin
+ * read from the shared twiddle table, two 16 x 16 multiplies per sample
+ * and bin. A Goertzel resonator needs one multiply, but by a coefficient
+ * 2 cos(w) that the Q15 table detunes by up to several bins near DC, on
+ * a state that outgrows Q31 there; the direct sum has neither problem.
+ *
+ * The magnitude² is on the scale arm_rfft_q15_mag_sq() reports for the
+ * same bins, so the two paths can be swapped freely; spectral_dft_preferred()
+ * tells which one is cheaper. Rounded once, it is the closer of the two:
+ * within 1 LSB of the exact magnitude, where the rounding of every RFFT
+ * stage leaves up to about 14 LSB at 4096 points.
+ */
+typedef struct {
+    const uint16_t *bins;   /**< Watched bins, ascending, owned by the caller */
+    uint16_t num_bins;      /**< Entries in bins */
+    uint16_t fft_size;      /**< Frame length */
+    uint8_t log2_size;      /**< log2 of fft_size */
+} spectral_dft_t;
+
+/**
+ * @brief Watch a set of bins of frames of one size
+ *
+ * @param[out] dft       Bin set
+ * @param[in]  fft_size  Frame length, an RFFT size of the build
+ * @param[in]  bins      num_bins bin indices in ascending order, each at
+ *                       most fft_size / 2, owned by the caller
+ * @param[in]  num_bins  Number of bins (>= 1)
+ *
+ * @return rfft_status_t
+ *         - RFFT_SUCCESS: Operation successful
+ *         - RFFT_ERROR_NULL_POINTER: NULL pointer provided
+ *         - RFFT_ERROR_INVALID_SIZE: Unsupported fft_size, no bins, or
+ *           bins out of range or out of order
+ */
+rfft_status_t spectral_dft_init(
+    spectral_dft_t *dft,
+    uint16_t fft_size,
+    const uint16_t *bins,
+    uint16_t num_bins
+);
+
+/**
+ * @brief Check whether num_bins bins are cheaper to correlate than a full RFFT
+ *
+ * Counts multiplies: 2 * fft_size per correlated bin against about
+ * 3/4 fft_size log2(fft_size / 2) for the CFFT, 2 * fft_size for the
+ * split step and fft_size for the magnitudes of arm_rfft_q15_mag_sq().
+ * Up to 5 bins are correlated at 4096 and at 8192 points.
+ *
+ * @param[in] fft_size  Frame length
+ * @param[in] num_bins  Number of bins wanted
+ */
+bool spectral_dft_preferred(uint16_t fft_size, uint16_t num_bins);
+
+/**
+ * @brief Magnitude² of the watched bins of one frame
+ *
+ * @param[in] dft    Initialized bin set
+ * @param[in] input  fft_size samples (Q15), windowed if wanted, not modified
+ * @param[in] fn     Called once per watched bin, in ascending bin order,
+ *                   with the magnitude² arm_rfft_q15_mag_sq() would report
+ * @param[in] user   Passed through to fn
+ */
+void spectral_dft_mag_sq(
+    const spectral_dft_t *dft,
+    const q15_t *input,
+    rfft_q15_bin_fn fn,
+    void *user
+);
+
+/**
+ * @brief A fixed set of bins over the last fft_size samples of a stream
+ *
+ * Every new sample x[n] replaces x[n - fft_size] in the ring and adds
+ * (x[n] - x[n - fft_size]) W^-kn to bin k, two multiplies per sample and
+ * bin, so the bins are current after every sample instead of every frame.
+ * W^-kn repeats every fft_size samples, so a sample is removed with
+ * exactly the product it was added with. The sums are kept exact in 64
+ * bits and never drift, however long the stream runs; the usual rotating
+ * form would multiply its rounding error into every later sample.
+ *
+ * The frame is not windowed. Until fft_size samples arrived, the missing
+ * history reads as zeros.
+ */
+typedef struct {
+    q15_t *ring;            /**< fft_size samples of history, owned by the caller */
+    int64_t *acc;           /**< 2 * num_bins sums, real and imaginary, owned by the caller */
+    const uint16_t *bins;   /**< Tracked bins, ascending, owned by the caller */
+    uint16_t num_bins;      /**< Entries in bins */
+    uint16_t fft_size;      /**< Length of the sliding frame */
+    uint16_t pos;           /**< Ring index of the oldest sample, n modulo fft_size */
+    uint8_t log2_size;      /**< log2 of fft_size */
+} spectral_sdft_t;
+
+/**
+ * @brief Track a set of bins of a stream of samples
+ *
+ * @param[out] sdft      Sliding state
+ * @param[in]  ring      fft_size samples of history, owned by the caller
+ * @param[in]  acc       2 * num_bins sums, owned by the caller
+ * @param[in]  fft_size  Frame length, an RFFT size of the build
+ * @param[in]  bins      num_bins bin indices in ascending order, each at
+ *                       most fft_size / 2, owned by the caller
+ * @param[in]  num_bins  Number of bins (>= 1)
+ *
+ * @return rfft_status_t, as for spectral_dft_init()
+ *
+ * @example
+ *   static const uint16_t tones[] = { 256, 512, 1024 };
+ *   static q15_t ring[4096];
+ *   static int64_t acc[2 * 3];
+ *   static spectral_peak_t peaks[2];
+ *   static spectral_sdft_t sdft;
+ *   uint16_t top_bins[2];
+ *
+ *   spectral_sdft_init(&sdft, ring, acc, 4096, tones, 3);
+ *
+ *   while (read_block(block, &count)) {
+ *       spectral_sdft_push(&sdft, block, count);
+ *       spectral_sdft_top_bins(&sdft, peaks, top_bins, 2);
+ *   }
+ */
+rfft_status_t spectral_sdft_init(
+    spectral_sdft_t *sdft,
+    q15_t *ring,
+    int64_t *acc,
+    uint16_t fft_size,
+    const uint16_t *bins,
+    uint16_t num_bins
+);
+
+/**
+ * @brief Forget the history, e.g. after a gap in the stream
+ *
+ * @param[in,out] sdft  Initialized sliding state
+ */
+void spectral_sdft_reset(spectral_sdft_t *sdft);
+
+/**
+ * @brief Slide the frame over new samples
+ *
+ * @param[in,out] sdft     Initialized sliding state
+ * @param[in]     samples  New samples (Q15), any number
+ * @param[in]     count    Number of new samples
+ */
+void spectral_sdft_push(spectral_sdft_t *sdft, const q15_t *samples, uint32_t count);
+
+/**
+ * @brief Magnitude² of the tracked bins over the last fft_size samples
+ *
+ * @param[in] sdft  Initialized sliding state
+ * @param[in] fn    Called once per tracked bin, in ascending bin order,
+ *                  with the magnitude² arm_rfft_q15_mag_sq() would report
+ *                  for the frame
+ * @param[in] user  Passed through to fn
+ */
+void spectral_sdft_mag_sq(const spectral_sdft_t *sdft, rfft_q15_bin_fn fn, void *user);
+
+/**
+ * @brief Find the strongest of the tracked bins
+ *
+ * The same selection as find_fft_top_bins(), restricted to the tracked
+ * bins: sorted by magnitude², DC skipped, places left over read as bin 0.
+ *
+ * @param[in]  sdft                Initialized sliding state
+ * @param[out] storage             num_top_bins entries for the selection
+ * @param[out] output_bin_indices  Array to store sorted bin indices (size >= num_top_bins)
+ * @param[in]  num_top_bins        Number of top bins to find, 1 to num_bins
+ *
+ * @return rfft_status_t
+ *         - RFFT_SUCCESS: Operation successful
+ *         - RFFT_ERROR_NULL_POINTER: NULL pointer provided
+ *         - RFFT_ERROR_INVALID_SIZE: Invalid num_top_bins
+ */
+rfft_status_t spectral_sdft_top_bins(
+    const spectral_sdft_t *sdft,
+    spectral_peak_t *storage,
+    uint16_t *output_bin_indices,
+    uint16_t num_top_bins
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SPECTRAL_DFT_H */
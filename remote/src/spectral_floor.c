@@ -0,0 +1,109 @@
+/* ----------------------------------------------------------------------
+ * Project:      FFT Utility Functions
+ * Title:        spectral_floor.c
+ * Description:  Noise floor of RFFT frames from the median of block means
+ *
+ * Target Processor: nRF54L15 FLPR (RISC-V)
+ * -------------------------------------------------------------------- */
+
+#include "spectral_floor.h"
+
+/**
+ * @brief Start an estimate
+ */
+rfft_status_t spectral_floor_init(
+    spectral_floor_t *est,
+    uint32_t *storage,
+    uint16_t num_bins,
+    uint8_t block_shift,
+    uint8_t margin_shift
+)
+{
+    if (est == NULL || storage == NULL) {
+        return RFFT_ERROR_NULL_POINTER;
+    }
+
+    if (num_bins == 0 || block_shift > 8U || margin_shift > 31U) {
+        return RFFT_ERROR_INVALID_SIZE;
+    }
+
+    est->block = storage;
+    est->num_bins = num_bins;
+    est->num_blocks = (uint16_t) SPECTRAL_FLOOR_BLOCKS((uint32_t) num_bins, block_shift);
+    est->block_shift = block_shift;
+    est->margin_shift = margin_shift;
+    est->floor = 0;
+    est->threshold = 0;
+
+    spectral_floor_begin_frame(est);
+
+    return RFFT_SUCCESS;
+}
+
+/* Close the block of the bins summed so far. */
+void spectral_floor_next_block(spectral_floor_t *est)
+{
+    if (est->current < est->num_blocks) {
+        est->block[est->current] = (uint32_t) (est->sum >> est->block_shift);
+    }
+    est->sum = 0;
+    est->current++;
+}
+
+/* Value of rank k of values[0..n-1], reordering them (Wirth's selection). */
+static uint32_t floor_select(uint32_t *values, int32_t n, int32_t k)
+{
+    int32_t lo = 0;
+    int32_t hi = n - 1;
+
+    while (lo < hi) {
+        uint32_t pivot = values[k];
+        int32_t i = lo;
+        int32_t j = hi;
+
+        do {
+            while (values[i] < pivot) {
+                i++;
+            }
+            while (pivot < values[j]) {
+                j--;
+            }
+            if (i <= j) {
+                uint32_t t = values[i];
+
+                values[i] = values[j];
+                values[j] = t;
+                i++;
+                j--;
+            }
+        } while (i <= j);
+
+        if (j < k) {
+            lo = i;
+        }
+        if (k < i) {
+            hi = j;
+        }
+    }
+
+    return values[k];
+}
+
+/**
+ * @brief End a frame and update floor and threshold from its blocks
+ */
+void spectral_floor_end_frame(spectral_floor_t *est)
+{
+    uint32_t n = est->num_blocks;
+    uint32_t last_bins = est->num_bins - ((n - 1U) << est->block_shift);
+
+    /* The last block holds what is left of the bins */
+    if (est->current == n - 1U) {
+        est->block[n - 1U] = (uint32_t) (est->sum / last_bins);
+    }
+    spectral_floor_begin_frame(est);
+
+    est->floor = floor_select(est->block, (int32_t) n, (int32_t) (n / 2U));
+    est->threshold = (est->floor > (UINT32_MAX >> est->margin_shift)) ?
+                       UINT32_MAX : est->floor << est->margin_shift;
+}
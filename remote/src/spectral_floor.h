@@ -0,0 +1,122 @@
+/* ----------------------------------------------------------------------
+ * Project:      FFT Utility Functions
+ * Title:        spectral_floor.h
+ * Description:  Noise floor of RFFT frames from the median of block means
+ *
+ * Target Processor: nRF54L15 FLPR (RISC-V)
+ * -------------------------------------------------------------------- */
+
+#ifndef SPECTRAL_FLOOR_H
+#define SPECTRAL_FLOOR_H
+
+#include "rfft_q15_simplified.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Blocks of the storage of a floor over num_bins bins of 2^block_shift. */
+#define SPECTRAL_FLOOR_BLOCKS(num_bins, block_shift) \
+    (((num_bins) + (1U << (block_shift)) - 1U) >> (block_shift))
+
+/**
+ * @brief Noise floor of the magnitude² of a stream of frames
+ *
+ * The bins of a frame are averaged in blocks of 2^block_shift, and the
+ * median of the block means is the floor: as long as fewer than half of
+ * the blocks hold a tone, the tones do not move it, however strong. The
+ * bins cost an add and a compare each, the median a selection over the
+ * blocks once per frame.
+ *
+ * threshold, the floor times 2^margin_shift, is meant for the next frame:
+ * spectral_topk_set_floor() drops the bins below it with the compare
+ * that rejects the bins below the kept ones, and the encoders can start
+ * their log codes there. It stays 0, nothing dropped, until the first
+ * frame ends.
+ */
+typedef struct {
+    uint32_t *block;       /**< num_blocks means of the current frame, owned by the caller */
+    uint64_t sum;          /**< Magnitude² of the current block so far */
+    uint32_t floor;        /**< Median block mean of the last frame */
+    uint32_t threshold;    /**< floor << margin_shift, saturated */
+    uint16_t num_bins;     /**< Bins per frame */
+    uint16_t num_blocks;   /**< Blocks per frame */
+    uint16_t current;      /**< Block of the next bin */
+    uint8_t block_shift;   /**< log2 of the bins per block */
+    uint8_t margin_shift;  /**< log2 of threshold / floor */
+} spectral_floor_t;
+
+/**
+ * @brief Start an estimate
+ *
+ * @param[out] est           Estimator state
+ * @param[in]  storage       SPECTRAL_FLOOR_BLOCKS(num_bins, block_shift)
+ *                           values, owned by the caller
+ * @param[in]  num_bins      Bins per frame, fft_size / 2 + 1 for an RFFT
+ * @param[in]  block_shift   log2 of the bins per block, up to 8
+ * @param[in]  margin_shift  log2 of the threshold over the floor, up to 31
+ *
+ * @return rfft_status_t
+ *         - RFFT_SUCCESS: Operation successful
+ *         - RFFT_ERROR_NULL_POINTER: NULL pointer provided
+ *         - RFFT_ERROR_INVALID_SIZE: No bins, or a shift out of range
+ *
+ * @example
+ *   static uint32_t blocks[SPECTRAL_FLOOR_BLOCKS(4096 / 2 + 1, 4)];
+ *   static spectral_floor_t noise;
+ *
+ *   // Bins 4 times (6 dB) over the median of 16-bin blocks stand out
+ *   spectral_floor_init(&noise, blocks, 4096 / 2 + 1, 4, 2);
+ */
+rfft_status_t spectral_floor_init(
+    spectral_floor_t *est,
+    uint32_t *storage,
+    uint16_t num_bins,
+    uint8_t block_shift,
+    uint8_t margin_shift
+);
+
+/**
+ * @brief Start the blocks of a frame
+ *
+ * @param[in,out] est  Initialized estimator
+ */
+static inline void spectral_floor_begin_frame(spectral_floor_t *est)
+{
+    est->sum = 0;
+    est->current = 0;
+}
+
+/* Close the block of the bins summed so far. */
+void spectral_floor_next_block(spectral_floor_t *est);
+
+/**
+ * @brief Add one bin of the current frame
+ *
+ * @param[in,out] est     Estimator after spectral_floor_begin_frame()
+ * @param[in]     bin     Bin index, one above the bin pushed before or 0
+ * @param[in]     mag_sq  Magnitude² of the bin
+ */
+static inline void spectral_floor_push(spectral_floor_t *est, uint32_t bin, uint32_t mag_sq)
+{
+    if ((bin >> est->block_shift) != est->current) {
+        spectral_floor_next_block(est);
+    }
+    est->sum += mag_sq;
+}
+
+/**
+ * @brief End a frame and update floor and threshold from its blocks
+ *
+ * A last block shorter than the others is averaged over the bins it
+ * has. The block means are reordered, and the next frame may start.
+ *
+ * @param[in,out] est  Estimator after all bins of a frame
+ */
+void spectral_floor_end_frame(spectral_floor_t *est);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SPECTRAL_FLOOR_H */
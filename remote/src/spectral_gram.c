@@ -0,0 +1,45 @@
+/* ----------------------------------------------------------------------
+ * Project:      FFT Utility Functions
+ * Title:        spectral_gram.c
+ * Description:  Max-pooled spectrogram rows of RFFT frames
+ *
+ * Target Processor: nRF54L15 FLPR (RISC-V)
+ * -------------------------------------------------------------------- */
+
+#include "spectral_gram.h"
+
+/**
+ * @brief Lay the columns of a row out over the bins of a frame
+ */
+rfft_status_t spectral_gram_init(
+    spectral_gram_t *gram,
+    uint32_t *storage,
+    uint16_t num_bins,
+    uint16_t num_columns
+)
+{
+    if (gram == NULL || storage == NULL) {
+        return RFFT_ERROR_NULL_POINTER;
+    }
+
+    if (num_columns == 0 || num_columns > num_bins) {
+        return RFFT_ERROR_INVALID_SIZE;
+    }
+
+    gram->column = storage;
+    gram->num_bins = num_bins;
+    gram->num_columns = num_columns;
+
+    spectral_gram_begin_frame(gram);
+
+    return RFFT_SUCCESS;
+}
+
+/* Move on to the column of the next bin. */
+void spectral_gram_next_column(spectral_gram_t *gram)
+{
+    /* No wider than bins, every column holds at least one */
+    gram->current++;
+    gram->next_edge = (uint16_t) (((uint32_t) gram->current + 1U) * gram->num_bins /
+                                  gram->num_columns);
+}
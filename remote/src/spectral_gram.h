@@ -0,0 +1,100 @@
+/* ----------------------------------------------------------------------
+ * Project:      FFT Utility Functions
+ * Title:        spectral_gram.h
+ * Description:  Max-pooled spectrogram rows of RFFT frames
+ *
+ * Target Processor: nRF54L15 FLPR (RISC-V)
+ * -------------------------------------------------------------------- */
+
+#ifndef SPECTRAL_GRAM_H
+#define SPECTRAL_GRAM_H
+
+#include <string.h>
+#include "rfft_q15_simplified.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Row of a spectrogram, the bins of a frame pooled into columns
+ *
+ * Column c holds the largest magnitude² of bins c * num_bins / num_columns
+ * up to the first bin of column c + 1, so a tone narrower than a column
+ * keeps its height instead of being averaged into the noise around it.
+ * The columns differ by at most one bin in width. A bin costs a compare
+ * or two, and the first bin of each column a division.
+ */
+typedef struct {
+    uint32_t *column;      /**< num_columns maxima of the current frame, owned by the caller */
+    uint16_t num_bins;     /**< Bins per frame */
+    uint16_t num_columns;  /**< Columns per row */
+    uint16_t current;      /**< Column of the next bin */
+    uint16_t next_edge;    /**< First bin of column current + 1 */
+} spectral_gram_t;
+
+/**
+ * @brief Lay the columns of a row out over the bins of a frame
+ *
+ * @param[out] gram         Row to set up
+ * @param[in]  storage      num_columns values, owned by the caller
+ * @param[in]  num_bins     Bins per frame, fft_size / 2 + 1 for an RFFT
+ * @param[in]  num_columns  Columns per row, 1 to num_bins
+ *
+ * @return rfft_status_t
+ *         - RFFT_SUCCESS: Operation successful
+ *         - RFFT_ERROR_NULL_POINTER: NULL pointer provided
+ *         - RFFT_ERROR_INVALID_SIZE: No columns, or more than bins
+ *
+ * @example
+ *   static uint32_t columns[64];
+ *   static spectral_gram_t row;
+ *
+ *   // 2049 bins of a 4096-point RFFT in 64 columns of 32 or 33
+ *   spectral_gram_init(&row, columns, 4096 / 2 + 1, 64);
+ */
+rfft_status_t spectral_gram_init(
+    spectral_gram_t *gram,
+    uint32_t *storage,
+    uint16_t num_bins,
+    uint16_t num_columns
+);
+
+/**
+ * @brief Start the columns of a frame
+ *
+ * @param[in,out] gram  Initialized row
+ */
+static inline void spectral_gram_begin_frame(spectral_gram_t *gram)
+{
+    memset(gram->column, 0, gram->num_columns * sizeof(uint32_t));
+    gram->current = 0;
+    gram->next_edge = (uint16_t) (gram->num_bins / gram->num_columns);
+}
+
+/* Move on to the column of the next bin. */
+void spectral_gram_next_column(spectral_gram_t *gram);
+
+/**
+ * @brief Add one bin of the current frame
+ *
+ * @param[in,out] gram    Row after spectral_gram_begin_frame()
+ * @param[in]     bin     Bin index, one above the bin pushed before or 0,
+ *                        below num_bins
+ * @param[in]     mag_sq  Magnitude² of the bin
+ */
+static inline void spectral_gram_push(spectral_gram_t *gram, uint32_t bin, uint32_t mag_sq)
+{
+    if (bin >= gram->next_edge) {
+        spectral_gram_next_column(gram);
+    }
+    if (mag_sq > gram->column[gram->current]) {
+        gram->column[gram->current] = mag_sq;
+    }
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SPECTRAL_GRAM_H */
@@ -0,0 +1,231 @@
+/* ----------------------------------------------------------------------
+ * Project:      FFT Utility Functions
+ * Title:        spectral_mel.c
+ * Description:  Mel or log-spaced triangular filterbank and MFCC
+ *
+ * Target Processor: nRF54L15 FLPR (RISC-V)
+ * -------------------------------------------------------------------- */
+
+#include "spectral_mel.h"
+
+/* Break frequency of the mel scale [Hz] */
+#define MEL_BREAK_HZ  700U
+
+/* log2(x) in Q24 for x > 0, bit by bit from the squares of the mantissa */
+static int32_t mel_log2_q24(uint64_t x)
+{
+    uint32_t msb = 63U - (uint32_t) __builtin_clzll(x);
+    uint64_t m = (msb >= 30U) ? (x >> (msb - 30U)) : (x << (30U - msb));
+    int32_t r = (int32_t) (msb << 24);
+
+    /* m is in [1, 2) in Q30, its square below 2^62 */
+    for (int32_t bit = 1 << 23; bit != 0; bit >>= 1) {
+        m = (m * m) >> 30;
+        if (m >= (2ULL << 30)) {
+            m >>= 1;
+            r |= bit;
+        }
+    }
+
+    return r;
+}
+
+/*
+ * Position of a frequency on the scale, in Q24 log2 up to a constant.
+ * With f = bin * sample_rate / fft_size both are scaled by fft_size: the
+ * mel scale is log2(700 + f), the log scale log2(f).
+ */
+static int32_t mel_warp(const spectral_mel_config_t *config, uint64_t scaled_hz)
+{
+    uint64_t offset = (config->scale == SPECTRAL_MEL_SCALE_MEL) ?
+                      (uint64_t) MEL_BREAK_HZ * config->fft_size : 0U;
+
+    return mel_log2_q24(offset + scaled_hz);
+}
+
+/* Centre j of num_filters between low and high, on the scale */
+static int64_t mel_centre(int32_t low, int32_t high, uint32_t j, uint32_t num_filters)
+{
+    return low + ((int64_t) j * (high - low)) / (int64_t) (num_filters + 1U);
+}
+
+/* cos(2 * pi * num / den) in Q15 for num <= den, interpolated in the twiddle table */
+static q15_t mel_cos(uint32_t num, uint32_t den)
+{
+    uint64_t pos;
+    uint32_t k;
+    int32_t frac, c0, c1;
+
+    if (2U * num > den) {
+        num = den - num;
+    }
+
+    /* In table steps, up to half a turn */
+    pos = (uint64_t) num * RFFT_TWIDDLE_TABLE_LEN;
+    k = (uint32_t) (pos / den);
+    frac = (int32_t) (((pos % den) << 15) / den);
+
+    c0 = RFFT_TWIDDLE_COS(RFFT_TWIDDLE_TABLE, k);
+    c1 = (frac != 0) ? RFFT_TWIDDLE_COS(RFFT_TWIDDLE_TABLE, k + 1U) : c0;
+
+    return (q15_t) (c0 + (((c1 - c0) * frac) >> 15));
+}
+
+/**
+ * @brief Lay a filterbank out over the bins of an RFFT
+ */
+rfft_status_t spectral_mel_init(
+    spectral_mel_t *mel,
+    const spectral_mel_config_t *config,
+    uint64_t *energy,
+    q15_t *weight,
+    uint16_t *edge
+)
+{
+    uint32_t num_bins, high_hz, num_filters, seg;
+    int32_t low, high;
+
+    if (mel == NULL || config == NULL || energy == NULL || weight == NULL ||
+        edge == NULL) {
+        return RFFT_ERROR_NULL_POINTER;
+    }
+
+    high_hz = (config->high_hz != 0U) ? config->high_hz : config->sample_rate / 2U;
+    if (rfft_q15_get_instance(config->fft_size) == NULL || config->num_filters < 2U ||
+        config->sample_rate == 0U || config->low_hz >= high_hz ||
+        high_hz > config->sample_rate / 2U ||
+        (config->scale != SPECTRAL_MEL_SCALE_MEL && config->scale != SPECTRAL_MEL_SCALE_LOG) ||
+        (config->scale == SPECTRAL_MEL_SCALE_LOG && config->low_hz == 0U)) {
+        return RFFT_ERROR_INVALID_SIZE;
+    }
+
+    num_bins = config->fft_size / 2U + 1U;
+    num_filters = config->num_filters;
+    low = mel_warp(config, (uint64_t) config->low_hz * config->fft_size);
+    high = mel_warp(config, (uint64_t) high_hz * config->fft_size);
+    if (high - low < (int32_t) (num_filters + 1U)) {
+        return RFFT_ERROR_INVALID_SIZE;
+    }
+
+    /*
+     * Each bin is placed between the two centres around it, the bins
+     * arrive in order. Centre num_filters + 1 ends the last filter.
+     */
+    seg = 0;
+    for (uint32_t bin = (config->scale == SPECTRAL_MEL_SCALE_LOG) ? 1U : 0U;
+         bin < num_bins; bin++) {
+        int32_t w = mel_warp(config, (uint64_t) bin * config->sample_rate);
+        int64_t c0, c1;
+
+        while (seg <= num_filters + 1U && w >= mel_centre(low, high, seg, num_filters)) {
+            edge[seg++] = (uint16_t) bin;
+        }
+
+        if (seg == 0U || seg > num_filters + 1U) {
+            continue;
+        }
+
+        c0 = mel_centre(low, high, seg - 1U, num_filters);
+        c1 = mel_centre(low, high, seg, num_filters);
+        weight[bin - edge[0]] = (q15_t) (((w - c0) << 15) / (c1 - c0));
+    }
+    for (; seg <= num_filters + 1U; seg++) {
+        edge[seg] = (uint16_t) num_bins;
+    }
+
+    mel->energy = energy;
+    mel->weight = weight;
+    mel->edge = edge;
+    mel->dct = NULL;
+    mel->dct_scale = 0;
+    mel->fft_size = config->fft_size;
+    mel->num_filters = config->num_filters;
+    mel->num_coeffs = 0;
+
+    spectral_mel_begin_frame(mel);
+
+    return RFFT_SUCCESS;
+}
+
+/**
+ * @brief Prepare the cosines of a DCT-II of the log filterbank
+ */
+rfft_status_t spectral_mel_set_dct(
+    spectral_mel_t *mel,
+    q15_t *table,
+    uint16_t num_coeffs
+)
+{
+    uint32_t m_len;
+
+    if (mel == NULL || table == NULL) {
+        return RFFT_ERROR_NULL_POINTER;
+    }
+
+    if (num_coeffs == 0U || num_coeffs > mel->num_filters) {
+        return RFFT_ERROR_INVALID_SIZE;
+    }
+
+    /* pi * n * (2m + 1) / (2M), a turn of n * (2m + 1) / (4M) */
+    m_len = mel->num_filters;
+    for (uint32_t n = 0; n < num_coeffs; n++) {
+        for (uint32_t m = 0; m < m_len; m++) {
+            table[n * m_len + m] = mel_cos((n * (2U * m + 1U)) % (4U * m_len), 4U * m_len);
+        }
+    }
+
+    mel->dct = table;
+    mel->dct_scale = (int32_t) (32768U / m_len);
+    mel->num_coeffs = num_coeffs;
+
+    return RFFT_SUCCESS;
+}
+
+/**
+ * @brief Filter energies of the frame, saturated to 32 bits
+ */
+void spectral_mel_energies(const spectral_mel_t *mel, uint32_t *out)
+{
+    for (uint32_t i = 0; i < mel->num_filters; i++) {
+        out[i] = (mel->energy[i] > UINT32_MAX) ? UINT32_MAX : (uint32_t) mel->energy[i];
+    }
+}
+
+/**
+ * @brief Log filter energies of the frame, in Q8 log2
+ */
+void spectral_mel_log2(const spectral_mel_t *mel, int16_t *out, int32_t exponent)
+{
+    /* As the log kernels of cmplx_mag_q15.c, a Q15 square is Q30 */
+    int32_t offset = (2 * exponent - 30) * 256;
+
+    for (uint32_t i = 0; i < mel->num_filters; i++) {
+        uint64_t e = (mel->energy[i] != 0U) ? mel->energy[i] : 1U;
+        uint32_t hi = (uint32_t) (e >> 32);
+        uint32_t shift = (hi != 0U) ? 32U - (uint32_t) __builtin_clz(hi) : 0U;
+        int32_t v = rfft_q15_log2_q8((uint32_t) (e >> shift)) + (int32_t) (shift << 8) + offset;
+
+        out[i] = (int16_t) rfft_q15_ssat(v, 16U);
+    }
+}
+
+/**
+ * @brief Cepstral coefficients of log filter energies
+ */
+void spectral_mel_dct(const spectral_mel_t *mel, const int16_t *logs, int16_t *out)
+{
+    uint32_t m_len = mel->num_filters;
+
+    for (uint32_t n = 0; n < mel->num_coeffs; n++) {
+        const q15_t *row = &mel->dct[n * m_len];
+        int32_t acc = 0;
+
+        /* Q8 * Q15 products kept in Q16, at most 2^23 each */
+        for (uint32_t m = 0; m < m_len; m++) {
+            acc += ((int32_t) logs[m] * row[m]) >> 7;
+        }
+
+        out[n] = (int16_t) rfft_q15_ssat(
+            (int32_t) (((int64_t) acc * mel->dct_scale) >> 23), 16U);
+    }
+}
@@ -0,0 +1,216 @@
+/* ----------------------------------------------------------------------
+ * Project:      FFT Utility Functions
+ * Title:        spectral_mel.h
+ * Description:  Mel or log-spaced triangular filterbank and MFCC
+ *
+ * Target Processor: nRF54L15 FLPR (RISC-V)
+ * -------------------------------------------------------------------- */
+
+#ifndef SPECTRAL_MEL_H
+#define SPECTRAL_MEL_H
+
+#include <string.h>
+#include "rfft_q15_simplified.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Spacing of the filter centres
+ */
+typedef enum {
+    SPECTRAL_MEL_SCALE_MEL = 0,  /**< Equal steps of 2595 * log10(1 + f / 700) */
+    SPECTRAL_MEL_SCALE_LOG,      /**< Equal steps of log(f), low_hz above 0 */
+} spectral_mel_scale_t;
+
+/**
+ * @brief Filterbank layout, for spectral_mel_init()
+ */
+typedef struct {
+    uint16_t fft_size;       /**< RFFT length of the frames */
+    uint16_t num_filters;    /**< Triangular filters, 2 or more */
+    uint32_t sample_rate;    /**< Sample rate of the frames [Hz] */
+    uint32_t low_hz;         /**< Lower edge of the first filter [Hz] */
+    uint32_t high_hz;        /**< Upper edge of the last filter, 0 for sample_rate / 2 */
+    spectral_mel_scale_t scale;
+} spectral_mel_config_t;
+
+/** Entries of the weight storage of an fft_size-point filterbank. */
+#define SPECTRAL_MEL_WEIGHTS(fft_size)  ((fft_size) / 2U + 1U)
+
+/** Entries of the edge storage of a filterbank of num_filters. */
+#define SPECTRAL_MEL_EDGES(num_filters)  ((num_filters) + 2U)
+
+/**
+ * @brief Triangular filterbank over the magnitude² of RFFT bins
+ *
+ * The centres of filters 1 to num_filters, with low_hz and high_hz as
+ * centres 0 and num_filters + 1, are equally spaced on the scale. Filter
+ * i rises from centre i to centre i + 1 and falls to centre i + 2, so
+ * between two centres the rising edge of one filter and the falling edge
+ * of the one before split each bin: weight is the share of the rising
+ * one, in Q15, and the other gets the rest. Every bin from edge[0] on is
+ * read once and touches at most two filters, the filters are never
+ * stored as dense rows.
+ *
+ * spectral_mel_init() does the logarithms and divisions of the layout
+ * once; a frame costs one multiply per bin.
+ */
+typedef struct {
+    uint64_t *energy;      /**< num_filters weighted sums of magnitude², current frame */
+    q15_t *weight;         /**< Rising weight of bins edge[0] to edge[num_filters + 1] - 1 */
+    uint16_t *edge;        /**< First bin past each centre, SPECTRAL_MEL_EDGES() entries */
+    const q15_t *dct;      /**< num_coeffs * num_filters cosines, or NULL */
+    int32_t dct_scale;     /**< 1 / num_filters in Q15 */
+    uint16_t fft_size;     /**< RFFT length of the frames */
+    uint16_t num_filters;  /**< Filters */
+    uint16_t num_coeffs;   /**< Cepstral coefficients of spectral_mel_dct() */
+    uint16_t segment;      /**< Centre below the next bin pushed */
+} spectral_mel_t;
+
+/**
+ * @brief Lay a filterbank out over the bins of an RFFT
+ *
+ * @param[out] mel     Filterbank to set up
+ * @param[in]  config  Layout
+ * @param[in]  energy  config->num_filters sums, owned by the caller
+ * @param[in]  weight  SPECTRAL_MEL_WEIGHTS(config->fft_size) weights, owned by the caller
+ * @param[in]  edge    SPECTRAL_MEL_EDGES(config->num_filters) bins, owned by the caller
+ *
+ * @return rfft_status_t
+ *         - RFFT_SUCCESS: Operation successful
+ *         - RFFT_ERROR_NULL_POINTER: NULL pointer provided
+ *         - RFFT_ERROR_INVALID_SIZE: fft_size not a supported length, fewer
+ *           than 2 filters, no sample rate, low_hz not below high_hz,
+ *           high_hz above sample_rate / 2, a range too narrow for the
+ *           filters, low_hz of 0 on a log scale or an unknown scale
+ *
+ * @example
+ *   static uint64_t energy[32];
+ *   static q15_t weight[SPECTRAL_MEL_WEIGHTS(1024)];
+ *   static uint16_t edge[SPECTRAL_MEL_EDGES(32)];
+ *   static spectral_mel_t mel;
+ *   const spectral_mel_config_t config = {
+ *       .fft_size = 1024, .num_filters = 32, .sample_rate = 16000,
+ *       .low_hz = 20, .high_hz = 0, .scale = SPECTRAL_MEL_SCALE_MEL,
+ *   };
+ *
+ *   spectral_mel_init(&mel, &config, energy, weight, edge);
+ */
+rfft_status_t spectral_mel_init(
+    spectral_mel_t *mel,
+    const spectral_mel_config_t *config,
+    uint64_t *energy,
+    q15_t *weight,
+    uint16_t *edge
+);
+
+/**
+ * @brief Prepare the cosines of a DCT-II of the log filterbank
+ *
+ * table[n * num_filters + m] is cos(pi * n * (m + 1/2) / num_filters) in
+ * Q15, interpolated in the shared twiddle table, so no floating point is
+ * needed. With RFFT_Q15_RUNTIME_TWIDDLES an RFFT instance must exist.
+ *
+ * @param[in,out] mel         Initialized filterbank
+ * @param[out]    table       num_coeffs * num_filters entries owned by the caller
+ * @param[in]     num_coeffs  Coefficients, 1 to num_filters
+ *
+ * @return rfft_status_t
+ *         - RFFT_SUCCESS: Operation successful
+ *         - RFFT_ERROR_NULL_POINTER: NULL pointer provided
+ *         - RFFT_ERROR_INVALID_SIZE: num_coeffs of 0 or above num_filters
+ */
+rfft_status_t spectral_mel_set_dct(
+    spectral_mel_t *mel,
+    q15_t *table,
+    uint16_t num_coeffs
+);
+
+/**
+ * @brief Start the sums of a frame
+ *
+ * @param[in,out] mel  Initialized filterbank
+ */
+static inline void spectral_mel_begin_frame(spectral_mel_t *mel)
+{
+    memset(mel->energy, 0, mel->num_filters * sizeof(uint64_t));
+    mel->segment = 0;
+}
+
+/**
+ * @brief Add one bin of the current frame
+ *
+ * Bins must come in ascending order, as rfft_q15_bin_fn has them; those
+ * outside the filters cost two compares.
+ *
+ * @param[in,out] mel     Filterbank after spectral_mel_begin_frame()
+ * @param[in]     bin     Bin index, up to fft_size / 2
+ * @param[in]     mag_sq  Magnitude² of the bin
+ */
+static inline void spectral_mel_push(spectral_mel_t *mel, uint32_t bin, uint32_t mag_sq)
+{
+    const uint16_t *edge = mel->edge;
+    uint32_t seg = mel->segment;
+    uint64_t rise;
+
+    if (bin < edge[0] || bin >= edge[mel->num_filters + 1U]) {
+        return;
+    }
+
+    /* Centres narrower than a bin leave segments without bins */
+    while (bin >= edge[seg + 1U]) {
+        seg++;
+    }
+    mel->segment = (uint16_t) seg;
+
+    /* Below mag_sq, the weight is at most 32767 / 32768 */
+    rise = ((uint64_t) mag_sq * (uint16_t) mel->weight[bin - edge[0]]) >> 15;
+    if (seg < mel->num_filters) {
+        mel->energy[seg] += rise;
+    }
+    if (seg > 0U) {
+        mel->energy[seg - 1U] += mag_sq - rise;
+    }
+}
+
+/**
+ * @brief Filter energies of the frame, saturated to 32 bits
+ *
+ * @param[in]  mel  Filterbank after a frame
+ * @param[out] out  num_filters energies, magnitude² as the bins pushed
+ */
+void spectral_mel_energies(const spectral_mel_t *mel, uint32_t *out);
+
+/**
+ * @brief Log filter energies of the frame, in Q8 log2
+ *
+ * As cmplx_mag_log2_q15(): exponent is the scaling of the RFFT output,
+ * log2(fft_size) for arm_rfft_q15(), and the result refers to the
+ * unscaled DFT of a full-scale input. A filter of no energy counts as
+ * one, so the DCT stays finite.
+ *
+ * @param[in]  mel       Filterbank after a frame
+ * @param[out] out       num_filters values of log2(energy) * 256
+ * @param[in]  exponent  log2 of the scaling of the bins pushed
+ */
+void spectral_mel_log2(const spectral_mel_t *mel, int16_t *out, int32_t exponent);
+
+/**
+ * @brief Cepstral coefficients of log filter energies
+ *
+ * out[n] = 1 / num_filters * sum of logs[m] * cos(pi * n * (m + 1/2) / num_filters),
+ * so out[0] is the mean log energy, in the Q8 of log2.
+ *
+ * @param[in]  mel   Filterbank after spectral_mel_set_dct()
+ * @param[in]  logs  num_filters values of spectral_mel_log2()
+ * @param[out] out   num_coeffs coefficients
+ */
+void spectral_mel_dct(const spectral_mel_t *mel, const int16_t *logs, int16_t *out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SPECTRAL_MEL_H */
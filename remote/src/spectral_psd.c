@@ -0,0 +1,65 @@
+/* ----------------------------------------------------------------------
+ * Project:      FFT Utility Functions
+ * Title:        spectral_psd.c
+ * Description:  Averaged power spectrum of a stream of RFFT frames
+ *
+ * Target Processor: nRF54L15 FLPR (RISC-V)
+ * -------------------------------------------------------------------- */
+
+#include "spectral_psd.h"
+#include <string.h>
+
+/**
+ * @brief Start a new average
+ */
+rfft_status_t spectral_psd_init(
+    spectral_psd_t *psd,
+    uint32_t *storage,
+    uint16_t num_bins,
+    spectral_psd_mode_t mode,
+    uint8_t shift
+)
+{
+    if (psd == NULL || storage == NULL) {
+        return RFFT_ERROR_NULL_POINTER;
+    }
+
+    if (num_bins == 0 || shift > 15U ||
+        (mode != SPECTRAL_PSD_LINEAR && mode != SPECTRAL_PSD_EXPONENTIAL)) {
+        return RFFT_ERROR_INVALID_SIZE;
+    }
+
+    psd->acc = storage;
+    psd->rem = (uint16_t *) &storage[num_bins];
+    psd->num_bins = num_bins;
+    psd->mode = (uint8_t) mode;
+    psd->shift = shift;
+
+    spectral_psd_reset(psd);
+
+    return RFFT_SUCCESS;
+}
+
+/**
+ * @brief Clear the average, e.g. after it was read out
+ */
+void spectral_psd_reset(spectral_psd_t *psd)
+{
+    memset(psd->acc, 0, SPECTRAL_PSD_STORAGE_LEN(psd->num_bins) * sizeof(uint32_t));
+    psd->frames = 0;
+}
+
+/**
+ * @brief Round the sums of a linear average to its mean
+ */
+void spectral_psd_round(spectral_psd_t *psd)
+{
+    if (psd->shift == 0U) {
+        return;
+    }
+
+    for (uint32_t bin = 0; bin < psd->num_bins; bin++) {
+        psd->acc[bin] += (uint32_t) psd->rem[bin] >> (psd->shift - 1U);
+        psd->rem[bin] = 0;
+    }
+}
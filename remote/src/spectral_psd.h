@@ -0,0 +1,218 @@
+/* ----------------------------------------------------------------------
+ * Project:      FFT Utility Functions
+ * Title:        spectral_psd.h
+ * Description:  Averaged power spectrum of a stream of RFFT frames
+ *
+ * Target Processor: nRF54L15 FLPR (RISC-V)
+ * -------------------------------------------------------------------- */
+
+#ifndef SPECTRAL_PSD_H
+#define SPECTRAL_PSD_H
+
+#include <stdbool.h>
+#include "rfft_q15_simplified.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief How the frames of a spectral_psd_t are averaged
+ */
+typedef enum {
+    SPECTRAL_PSD_LINEAR = 0,    /**< Mean of 2^shift frames, then stops */
+    SPECTRAL_PSD_EXPONENTIAL,   /**< Running average, weight 2^-shift per frame */
+} spectral_psd_mode_t;
+
+/**
+ * @brief Welch-style average of the magnitude² of consecutive frames
+ *
+ * Each bin is a Q31 value of magnitude², as arm_rfft_q15_mag_sq() reports
+ * it, clamped to 0x7FFFFFFF. Windowed, overlapping frames from fft_stft_t
+ * make it a Welch estimate; fft_context_set_psd() feeds it from the RFFT
+ * of every frame a context analyses.
+ *
+ * SPECTRAL_PSD_LINEAR sums the frames at full precision, 31 + shift
+ * bits a bin: acc holds the sum divided by 2^shift, rounded down, and
+ * rem the low shift bits the division leaves. The 2^shift-th frame
+ * rounds acc to their mean; further frames are ignored until
+ * spectral_psd_reset(). Before that, acc is the mean scaled by
+ * frames / 2^shift, so a bin far below 1 LSB a frame still adds up.
+ *
+ * SPECTRAL_PSD_EXPONENTIAL moves every bin by 2^-shift of the distance
+ * to the new frame, starting from the first frame. It keeps running, so
+ * acc can be read at any time.
+ *
+ * Both modes divide by shifting, hence the averaging lengths of powers
+ * of two: a division for every bin of every frame costs many times the
+ * shift on the FLPR and the Cortex-M33 alike.
+ */
+typedef struct {
+    uint32_t *acc;      /**< num_bins averaged magnitude² (Q31), owned by the caller */
+    uint16_t *rem;      /**< num_bins low shift bits of the linear sums, after acc */
+    uint16_t num_bins;  /**< Bins per frame, fft_size / 2 + 1 for an RFFT */
+    uint16_t frames;    /**< Frames averaged since the reset, saturates at 65535 */
+    uint8_t mode;       /**< spectral_psd_mode_t */
+    uint8_t shift;      /**< log2 of the averaging length */
+} spectral_psd_t;
+
+/** uint32_t words of the storage of an average of num_bins bins, acc then rem */
+#define SPECTRAL_PSD_STORAGE_LEN(num_bins)  ((num_bins) + ((num_bins) + 1U) / 2U)
+
+/**
+ * @brief Start a new average
+ *
+ * @param[out] psd       Average state
+ * @param[in]  storage   SPECTRAL_PSD_STORAGE_LEN(num_bins) values, owned by
+ *                       the caller
+ * @param[in]  num_bins  Bins per frame, fft_size / 2 + 1 for an RFFT
+ * @param[in]  mode      Linear or exponential averaging
+ * @param[in]  shift     log2 of the frames averaged (0 to 15)
+ *
+ * @return rfft_status_t
+ *         - RFFT_SUCCESS: Operation successful
+ *         - RFFT_ERROR_NULL_POINTER: NULL pointer provided
+ *         - RFFT_ERROR_INVALID_SIZE: num_bins of 0, unknown mode or shift
+ *           above 15
+ */
+rfft_status_t spectral_psd_init(
+    spectral_psd_t *psd,
+    uint32_t *storage,
+    uint16_t num_bins,
+    spectral_psd_mode_t mode,
+    uint8_t shift
+);
+
+/**
+ * @brief Clear the average, e.g. after it was read out
+ *
+ * @param[in,out] psd  Initialized average state
+ */
+void spectral_psd_reset(spectral_psd_t *psd);
+
+/**
+ * @brief Round the sums of a linear average to its mean
+ *
+ * Called by spectral_psd_end_frame() with the 2^shift-th frame.
+ *
+ * @param[in,out] psd  Initialized linear average of 2^shift frames
+ */
+void spectral_psd_round(spectral_psd_t *psd);
+
+/**
+ * @brief Check whether the next frame is added
+ *
+ * @return false once a linear average holds its 2^shift frames
+ */
+static inline bool spectral_psd_accepts(const spectral_psd_t *psd)
+{
+    return psd->mode != SPECTRAL_PSD_LINEAR ||
+           psd->frames < (1U << psd->shift);
+}
+
+/**
+ * @brief Check whether 2^shift frames have been averaged
+ */
+static inline bool spectral_psd_complete(const spectral_psd_t *psd)
+{
+    return psd->frames >= (1U << psd->shift);
+}
+
+/**
+ * @brief Add one bin of the current frame
+ *
+ * Only call while spectral_psd_accepts() holds, and end every frame with
+ * spectral_psd_end_frame().
+ *
+ * @param[in,out] psd     Initialized average state
+ * @param[in]     bin     Bin index, below num_bins
+ * @param[in]     mag_sq  Magnitude² of the bin
+ */
+static inline void spectral_psd_push(spectral_psd_t *psd, uint32_t bin, uint32_t mag_sq)
+{
+    uint32_t *acc = &psd->acc[bin];
+    uint32_t x = rfft_q15_minu(mag_sq, 0x7FFFFFFFU);
+    uint32_t half = (1U << psd->shift) >> 1;
+
+    if (psd->mode == SPECTRAL_PSD_LINEAR) {
+        /* The low bits carry into rem, acc stays below 2^31 over 2^shift frames */
+        uint32_t mask = (1U << psd->shift) - 1U;
+        uint32_t low = psd->rem[bin] + (x & mask);
+
+        *acc += (x >> psd->shift) + (low >> psd->shift);
+        psd->rem[bin] = (uint16_t) (low & mask);
+    } else if (psd->frames == 0) {
+        *acc = x;
+    } else {
+        /* Both are below 2^31, so is the distance */
+        *acc += (uint32_t) (((int32_t) (x - *acc) + (int32_t) half) >> psd->shift);
+    }
+}
+
+/**
+ * @brief Count the frame whose bins were pushed
+ *
+ * @param[in,out] psd  Initialized average state
+ */
+static inline void spectral_psd_end_frame(spectral_psd_t *psd)
+{
+    if (psd->frames < UINT16_MAX) {
+        psd->frames++;
+    }
+
+    if (psd->mode == SPECTRAL_PSD_LINEAR && psd->frames == (1U << psd->shift)) {
+        spectral_psd_round(psd);
+    }
+}
+
+/**
+ * @brief Add a whole frame and count it
+ *
+ * For the num_bins magnitudes² of cmplx_mag_squared_q15(), bin 0 first.
+ * Only call while spectral_psd_accepts() holds.
+ *
+ * @param[in,out] psd     Initialized average state
+ * @param[in]     mag_sq  num_bins magnitudes²
+ */
+static inline void spectral_psd_push_frame(spectral_psd_t *psd, const uint32_t *mag_sq)
+{
+    for (uint32_t bin = 0; bin < psd->num_bins; bin++) {
+        spectral_psd_push(psd, bin, mag_sq[bin]);
+    }
+    spectral_psd_end_frame(psd);
+}
+
+/**
+ * @brief Energy of one frame in a range of bins
+ *
+ * fft_context_set_bands() sums the magnitude² of bins first_bin to
+ * last_bin of every frame into energy, from the RFFT pass that feeds the
+ * average, so a band can be compared with its own running baseline.
+ */
+typedef struct {
+    uint16_t first_bin;  /**< First bin of the band */
+    uint16_t last_bin;   /**< Last bin of the band, at least first_bin */
+    uint64_t energy;     /**< Sum of magnitude² over the band, last frame */
+} spectral_band_t;
+
+/** Set in spectral_band_edge_t.band for the edge after the last bin */
+#define SPECTRAL_BAND_EDGE_END  0x8000U
+
+/**
+ * @brief Edge of a band of a band table
+ *
+ * fft_context_set_band_table() sorts two per band by bin. The running sum
+ * of the magnitude² of all bins below bin is subtracted from the energy
+ * of the band at its first bin and added one past its last, so each band
+ * costs two updates however many bins it spans or other bands it overlaps.
+ */
+typedef struct {
+    uint16_t bin;   /**< first_bin, or last_bin + 1 */
+    uint16_t band;  /**< Index of the band, with SPECTRAL_BAND_EDGE_END at its end */
+} spectral_band_edge_t;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SPECTRAL_PSD_H */
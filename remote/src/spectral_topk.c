@@ -0,0 +1,202 @@
+/* ----------------------------------------------------------------------
+ * Project:      FFT Utility Functions
+ * Title:        spectral_topk.c
+ * Description:  Bounded top-K selection of spectral bins
+ *
+ * Target Processor: nRF54L15 FLPR (RISC-V)
+ * -------------------------------------------------------------------- */
+
+#include "spectral_topk.h"
+
+/*
+ * Heap order: a is weaker than b. Among equal magnitudes the later
+ * (higher) bin is weaker, which keeps the stable-sort tie order.
+ */
+static inline bool weaker(const spectral_peak_t *a, const spectral_peak_t *b)
+{
+    return a->magnitude_squared < b->magnitude_squared ||
+           (a->magnitude_squared == b->magnitude_squared &&
+            a->bin_index > b->bin_index);
+}
+
+/* Restore the heap below index i, considering the first n entries. */
+static void sift_down(spectral_peak_t *heap, uint16_t n, uint16_t i)
+{
+    spectral_peak_t item = heap[i];
+
+    for (;;) {
+        uint32_t child = 2U * i + 1U;
+
+        if (child >= n) {
+            break;
+        }
+        if (child + 1U < n && weaker(&heap[child + 1U], &heap[child])) {
+            child++;
+        }
+        if (!weaker(&heap[child], &item)) {
+            break;
+        }
+        heap[i] = heap[child];
+        i = (uint16_t)child;
+    }
+
+    heap[i] = item;
+}
+
+void spectral_topk_init(spectral_topk_t *topk, spectral_peak_t *storage, uint16_t k)
+{
+    topk->heap = storage;
+    topk->k = k;
+
+    /* All placeholders are equal, which is a valid heap */
+    for (uint16_t i = 0; i < k; i++) {
+        storage[i].bin_index = 0;
+        storage[i].magnitude_squared = 0;
+    }
+}
+
+void spectral_topk_set_floor(spectral_topk_t *topk, uint32_t floor_mag)
+{
+    /* Still all equal placeholders */
+    for (uint16_t i = 0; i < topk->k; i++) {
+        topk->heap[i].magnitude_squared = floor_mag;
+    }
+}
+
+void spectral_topk_push_slow(spectral_topk_t *topk, uint16_t bin_index, uint32_t magnitude_sq)
+{
+    /* The new bin is stronger than the root, which it replaces */
+    topk->heap[0].bin_index = bin_index;
+    topk->heap[0].magnitude_squared = magnitude_sq;
+    sift_down(topk->heap, topk->k, 0);
+}
+
+const spectral_peak_t *spectral_topk_finish(spectral_topk_t *topk)
+{
+    spectral_peak_t *heap = topk->heap;
+
+    /* Heap sort: move the weakest remaining entry to the back each round */
+    for (uint16_t n = topk->k; n > 1; n--) {
+        spectral_peak_t weakest = heap[0];
+
+        heap[0] = heap[n - 1];
+        heap[n - 1] = weakest;
+        sift_down(heap, n - 1, 0);
+    }
+
+    return heap;
+}
+
+void spectral_peaks_init(spectral_peaks_t *peaks, spectral_peak_t *storage, uint16_t k,
+                         uint16_t min_spacing)
+{
+    spectral_topk_init(&peaks->topk, storage, k);
+
+    /* So that bin 0 is never rising */
+    peaks->prev_mag = UINT32_MAX;
+    peaks->pending_mag = 0;
+    peaks->pending_bin = 0;
+    peaks->last_bin = 0;
+    peaks->min_spacing = min_spacing;
+    peaks->rising = false;
+}
+
+void spectral_peaks_push_max(spectral_peaks_t *peaks, uint16_t bin_index, uint32_t magnitude_sq)
+{
+    /*
+     * A maximum too close to the pending one replaces it if stronger.
+     * The pending one was min_spacing from the last offered, a later bin
+     * is further still.
+     */
+    if (peaks->pending_mag != 0U &&
+        (uint32_t)(bin_index - peaks->pending_bin) < peaks->min_spacing) {
+        if (magnitude_sq > peaks->pending_mag) {
+            peaks->pending_bin = bin_index;
+            peaks->pending_mag = magnitude_sq;
+        }
+        return;
+    }
+
+    if (peaks->pending_mag != 0U) {
+        spectral_topk_push(&peaks->topk, peaks->pending_bin, peaks->pending_mag);
+    }
+    peaks->pending_bin = bin_index;
+    peaks->pending_mag = magnitude_sq;
+}
+
+const spectral_peak_t *spectral_peaks_finish(spectral_peaks_t *peaks)
+{
+    if (peaks->min_spacing != 0U) {
+        if (peaks->rising) {
+            spectral_peaks_push_max(peaks, peaks->last_bin, peaks->prev_mag);
+        }
+        if (peaks->pending_mag != 0U) {
+            spectral_topk_push(&peaks->topk, peaks->pending_bin, peaks->pending_mag);
+        }
+    }
+
+    return spectral_topk_finish(&peaks->topk);
+}
+
+/* Insertion sort, strongest first; count is small */
+static void sort_peaks(spectral_peak_t *peaks, uint16_t count)
+{
+    for (uint16_t i = 1; i < count; i++) {
+        spectral_peak_t item = peaks[i];
+        uint16_t j = i;
+
+        for (; j > 0 && weaker(&peaks[j - 1U], &item); j--) {
+            peaks[j] = peaks[j - 1U];
+        }
+        peaks[j] = item;
+    }
+}
+
+uint16_t spectral_peaks_group_harmonics(spectral_peak_t *peaks, uint16_t count,
+                                        uint16_t max_harmonic)
+{
+    uint16_t groups = 0;
+
+    /* Unused places hold bin 0 and stay at the end */
+    while (count > 0 && peaks[count - 1U].bin_index == 0U) {
+        count--;
+    }
+
+    if (max_harmonic >= 2U) {
+        /* Sorted strongest first, so only the peaks after i are weaker */
+        for (uint16_t i = 0; i < count; i++) {
+            uint32_t f0 = peaks[i].bin_index;
+
+            if (f0 == 0U) {
+                continue;
+            }
+
+            for (uint16_t j = i + 1U; j < count; j++) {
+                uint32_t bin = peaks[j].bin_index;
+                uint32_t n = (bin + f0 / 2U) / f0;
+                uint32_t target = n * f0;
+                uint32_t spread = (bin > target) ? bin - target : target - bin;
+
+                if (bin == 0U || n < 2U || n > max_harmonic ||
+                    spread > n / 2U + 1U) {
+                    continue;
+                }
+
+                peaks[i].magnitude_squared =
+                    (peaks[i].magnitude_squared > UINT32_MAX - peaks[j].magnitude_squared) ?
+                    UINT32_MAX : peaks[i].magnitude_squared + peaks[j].magnitude_squared;
+                peaks[j].bin_index = 0;
+                peaks[j].magnitude_squared = 0;
+            }
+        }
+
+        /* The removed ones are weakest and sort to the end */
+        sort_peaks(peaks, count);
+    }
+
+    while (groups < count && peaks[groups].bin_index != 0U) {
+        groups++;
+    }
+
+    return groups;
+}
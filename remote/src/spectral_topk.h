@@ -0,0 +1,199 @@
+/* ----------------------------------------------------------------------
+ * Project:      FFT Utility Functions
+ * Title:        spectral_topk.h
+ * Description:  Bounded top-K selection of spectral bins
+ *
+ * Target Processor: nRF54L15 FLPR (RISC-V)
+ * -------------------------------------------------------------------- */
+
+#ifndef SPECTRAL_TOPK_H
+#define SPECTRAL_TOPK_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief One spectral bin and its magnitude².
+ */
+typedef struct {
+    uint16_t bin_index;
+    uint32_t magnitude_squared;
+} spectral_peak_t;
+
+/**
+ * @brief Keeps the K largest bins of a stream of (bin, magnitude²) pairs.
+ *
+ * The K entries are kept as a min-heap, so the weakest kept bin is always
+ * at the root. A bin that does not beat it is rejected with one compare;
+ * otherwise it replaces the root in O(log K). The storage is supplied by
+ * the caller.
+ *
+ * Bins must be pushed in ascending bin order. Ties are then resolved like
+ * a stable sort: of two bins with equal magnitude² the lower one ranks
+ * first. Bins with magnitude² 0 are never kept; unused places read as
+ * bin 0 with magnitude² 0.
+ */
+typedef struct {
+    spectral_peak_t *heap;
+    uint16_t k;
+} spectral_topk_t;
+
+/**
+ * @brief Start a new selection.
+ *
+ * @param[out] topk     Selection state
+ * @param[in]  storage  Array of at least k entries, owned by the caller
+ * @param[in]  k        Number of bins to keep (>= 1)
+ */
+void spectral_topk_init(spectral_topk_t *topk, spectral_peak_t *storage, uint16_t k);
+
+/**
+ * @brief Drop the bins at or below a floor from a new selection.
+ *
+ * The unused places start at magnitude² floor_mag instead of 0, so the
+ * compare that rejects a bin below the kept ones also rejects the bins
+ * below the floor, at no cost per bin. Places never filled read as bin 0
+ * with magnitude² floor_mag.
+ *
+ * @param[in,out] topk       Selection right after spectral_topk_init()
+ * @param[in]     floor_mag  Largest magnitude² dropped
+ */
+void spectral_topk_set_floor(spectral_topk_t *topk, uint32_t floor_mag);
+
+/**
+ * @brief Weakest magnitude² still kept; a bin must exceed it to enter.
+ */
+static inline uint32_t spectral_topk_threshold(const spectral_topk_t *topk)
+{
+    return topk->heap[0].magnitude_squared;
+}
+
+/**
+ * @brief Offer one bin to the selection.
+ *
+ * @param[in,out] topk           Selection state
+ * @param[in]     bin_index      Bin index, larger than any bin pushed before
+ * @param[in]     magnitude_sq   Magnitude² of the bin
+ */
+void spectral_topk_push_slow(spectral_topk_t *topk, uint16_t bin_index, uint32_t magnitude_sq);
+
+static inline void spectral_topk_push(spectral_topk_t *topk, uint16_t bin_index, uint32_t magnitude_sq)
+{
+    /* Early reject, the common case once the selection has filled up */
+    if (magnitude_sq > spectral_topk_threshold(topk)) {
+        spectral_topk_push_slow(topk, bin_index, magnitude_sq);
+    }
+}
+
+/**
+ * @brief Sort the kept bins, strongest first, and end the selection.
+ *
+ * After this call storage[0..k-1] holds the bins in descending order of
+ * magnitude²; no further bins may be pushed without spectral_topk_init().
+ *
+ * @param[in,out] topk  Selection state
+ * @return The sorted array, i.e. the storage passed to spectral_topk_init()
+ */
+const spectral_peak_t *spectral_topk_finish(spectral_topk_t *topk);
+
+/**
+ * @brief Keeps the K strongest distinct peaks of a stream of bins.
+ *
+ * A front end to spectral_topk_t: only local maxima of the magnitude²
+ * are offered to the selection, bin b when b - 1 is weaker and b + 1 not
+ * stronger, so the bins a tone leaks into do not take places of their
+ * own. Of two maxima less than min_spacing bins apart only the stronger
+ * is offered, which keeps every pair of bins selected at least
+ * min_spacing apart. Bin 0 is compared against but never selected. The
+ * cost per bin is two compares until a maximum is found.
+ *
+ * A min_spacing of 0 passes every bin on to the selection as it is.
+ */
+typedef struct {
+    spectral_topk_t topk;
+    uint32_t prev_mag;       /* Magnitude² of the last bin pushed */
+    uint32_t pending_mag;    /* Maximum not yet offered, 0 for none */
+    uint16_t pending_bin;
+    uint16_t last_bin;       /* Last bin pushed */
+    uint16_t min_spacing;
+    bool rising;             /* The last bin was stronger than the one before */
+} spectral_peaks_t;
+
+/**
+ * @brief Start a new peak selection.
+ *
+ * @param[out] peaks        Selection state
+ * @param[in]  storage      Array of at least k entries, owned by the caller
+ * @param[in]  k            Number of peaks to keep (>= 1)
+ * @param[in]  min_spacing  Bins between two peaks kept, 0 for every bin
+ */
+void spectral_peaks_init(spectral_peaks_t *peaks, spectral_peak_t *storage, uint16_t k,
+                         uint16_t min_spacing);
+
+/* Offer a local maximum, after the one before if it was far enough. */
+void spectral_peaks_push_max(spectral_peaks_t *peaks, uint16_t bin_index, uint32_t magnitude_sq);
+
+/**
+ * @brief Offer one bin to the peak selection.
+ *
+ * @param[in,out] peaks          Selection state
+ * @param[in]     bin_index      Bin index, one above the bin pushed before
+ *                               or 0 for the first
+ * @param[in]     magnitude_sq   Magnitude² of the bin
+ */
+static inline void spectral_peaks_push(spectral_peaks_t *peaks, uint16_t bin_index,
+                                       uint32_t magnitude_sq)
+{
+    if (peaks->min_spacing == 0U) {
+        if (bin_index != 0U) {
+            spectral_topk_push(&peaks->topk, bin_index, magnitude_sq);
+        }
+        return;
+    }
+
+    /* The bin before was a maximum, bin 0 never is */
+    if (peaks->rising && magnitude_sq <= peaks->prev_mag) {
+        spectral_peaks_push_max(peaks, (uint16_t)(bin_index - 1U), peaks->prev_mag);
+    }
+    peaks->rising = magnitude_sq > peaks->prev_mag;
+    peaks->prev_mag = magnitude_sq;
+    peaks->last_bin = bin_index;
+}
+
+/**
+ * @brief Offer what the last bins left pending, sort and end the selection.
+ *
+ * The last bin pushed counts as a maximum if it was rising.
+ *
+ * @param[in,out] peaks  Selection state
+ * @return The sorted array, as spectral_topk_finish()
+ */
+const spectral_peak_t *spectral_peaks_finish(spectral_peaks_t *peaks);
+
+/**
+ * @brief Fold the harmonics of each peak into it.
+ *
+ * Goes down the peaks from the strongest, at bin f0. A weaker peak within
+ * n / 2 + 1 bins of n * f0, for n from 2 to max_harmonic, is removed and
+ * its magnitude² added to that of f0, saturated; a weak peak below a
+ * strong one never takes it as a harmonic. The peaks then are sorted
+ * again, strongest group first, and the places freed at the end read as
+ * bin 0 with magnitude² 0. Places of bin 0 count as unused.
+ *
+ * @param[in,out] peaks         count peaks, as spectral_topk_finish() sorts them
+ * @param[in]     count         Number of peaks
+ * @param[in]     max_harmonic  Highest harmonic grouped, below 2 for none
+ * @return Number of groups, the peaks left
+ */
+uint16_t spectral_peaks_group_harmonics(spectral_peak_t *peaks, uint16_t count,
+                                        uint16_t max_harmonic);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SPECTRAL_TOPK_H */
@@ -0,0 +1,256 @@
+/* ----------------------------------------------------------------------
+ * Project:      FFT Utility Functions
+ * Title:        spectral_track.c
+ * Description:  Top bins tracked from frame to frame, reported as changes
+ *
+ * Target Processor: nRF54L15 FLPR (RISC-V)
+ * -------------------------------------------------------------------- */
+
+#include "spectral_track.h"
+
+/**
+ * @brief Start tracking with no peak
+ */
+rfft_status_t spectral_track_init(
+    spectral_track_t *track,
+    spectral_track_place_t *places,
+    spectral_track_change_t *changes,
+    uint16_t k,
+    uint16_t move_bins,
+    uint8_t hyst_shift
+)
+{
+    if (track == NULL || places == NULL || changes == NULL) {
+        return RFFT_ERROR_NULL_POINTER;
+    }
+
+    if (k == 0 || k > 255U || hyst_shift > 31U) {
+        return RFFT_ERROR_INVALID_SIZE;
+    }
+
+    track->place = places;
+    track->changes = changes;
+    track->k = (uint8_t) k;
+    track->move_bins = move_bins;
+    track->hyst_shift = hyst_shift;
+
+    for (uint32_t i = 0; i < k; i++) {
+        places[i].id = (uint8_t) i;
+    }
+    spectral_track_reset(track);
+
+    return RFFT_SUCCESS;
+}
+
+/**
+ * @brief Free every place, without reporting it
+ */
+void spectral_track_reset(spectral_track_t *track)
+{
+    for (uint32_t i = 0; i < track->k; i++) {
+        track->place[i].bin_index = 0;
+        track->place[i].magnitude_squared = 0;
+        track->place[i].change = 0;
+    }
+    track->active = 0;
+    track->next = 0;
+    track->num_changes = 0;
+}
+
+/* magnitude_sq plus its 2^-hyst_shift, saturated */
+static uint32_t track_margin(const spectral_track_t *track, uint32_t magnitude_sq)
+{
+    uint64_t m = (uint64_t) magnitude_sq + (magnitude_sq >> track->hyst_shift);
+
+    return (m > UINT32_MAX) ? UINT32_MAX : (uint32_t) m;
+}
+
+/* Active place of the lowest magnitude², the first of equal ones */
+static uint32_t track_weakest(const spectral_track_t *track)
+{
+    uint32_t weakest = 0;
+
+    for (uint32_t i = 1; i < track->active; i++) {
+        if (track->place[i].magnitude_squared < track->place[weakest].magnitude_squared) {
+            weakest = i;
+        }
+    }
+
+    return weakest;
+}
+
+/**
+ * @brief Least magnitude² of a bin that enters the full set, 0 while a place is free
+ */
+uint32_t spectral_track_threshold(const spectral_track_t *track)
+{
+    if (track->active < track->k) {
+        return 0;
+    }
+
+    return track_margin(track, track->place[track_weakest(track)].magnitude_squared);
+}
+
+/**
+ * @brief Start the comparison of a frame with the set
+ */
+void spectral_track_begin_frame(spectral_track_t *track)
+{
+    for (uint32_t i = 0; i < track->active; i++) {
+        track->place[i].seen_mag = 0;
+        track->place[i].seen_bin = track->place[i].bin_index;
+    }
+    track->next = 0;
+}
+
+/* Compare a bin with the tracked peaks it is near. */
+void spectral_track_push_slow(spectral_track_t *track, uint32_t bin, uint32_t mag_sq)
+{
+    /* DC is never a peak, a place of bin 0 is free */
+    if (bin == 0) {
+        return;
+    }
+
+    /* The windows are as wide and sorted, so they end in order too */
+    for (uint32_t i = track->next; i < track->active; i++) {
+        spectral_track_place_t *p = &track->place[i];
+
+        if (bin + track->move_bins < p->bin_index) {
+            break;
+        }
+        if (bin > (uint32_t) p->bin_index + track->move_bins) {
+            track->next = (uint16_t) (i + 1U);
+            continue;
+        }
+        if (mag_sq > p->seen_mag) {
+            p->seen_mag = mag_sq;
+            p->seen_bin = (uint16_t) bin;
+        }
+    }
+}
+
+/* Move place[i] of the active ones to where its bin sorts */
+static void track_sort_place(spectral_track_t *track, uint32_t i)
+{
+    spectral_track_place_t p = track->place[i];
+
+    while (i > 0 && track->place[i - 1U].bin_index > p.bin_index) {
+        track->place[i] = track->place[i - 1U];
+        i--;
+    }
+    while (i + 1U < track->active && track->place[i + 1U].bin_index < p.bin_index) {
+        track->place[i] = track->place[i + 1U];
+        i++;
+    }
+    track->place[i] = p;
+}
+
+/* A tracked peak within move_bins of bin, by binary search of the sorted places */
+static bool track_near(const spectral_track_t *track, uint32_t bin)
+{
+    uint32_t lo = 0;
+    uint32_t hi = track->active;
+
+    /* First place at or above bin - move_bins */
+    while (lo < hi) {
+        uint32_t mid = (lo + hi) / 2U;
+
+        if ((uint32_t) track->place[mid].bin_index + track->move_bins < bin) {
+            lo = mid + 1U;
+        } else {
+            hi = mid;
+        }
+    }
+
+    return lo < track->active && track->place[lo].bin_index <= bin + track->move_bins;
+}
+
+/**
+ * @brief End a frame, update the set from its selection and list the changes
+ */
+uint16_t spectral_track_end_frame(
+    spectral_track_t *track,
+    const spectral_peak_t *top,
+    uint16_t count,
+    uint32_t floor_mag
+)
+{
+    spectral_track_place_t *place = track->place;
+    uint32_t kept = 0;
+    uint32_t n = 0;
+
+    /*
+     * Every peak to the strongest bin near it. The leftmost maximum of a
+     * sliding window never moves back, so of two peaks that met at one
+     * bin the second follows the first right away and is removed.
+     */
+    for (uint32_t i = 0; i < track->active; i++) {
+        spectral_track_place_t *p = &place[i];
+
+        if (p->seen_mag <= floor_mag ||
+            (kept != 0 && place[kept - 1U].bin_index == p->seen_bin)) {
+            p->change = SPECTRAL_TRACK_REMOVED;
+            p->magnitude_squared = 0;
+        } else {
+            if (p->seen_bin != p->bin_index) {
+                p->change = SPECTRAL_TRACK_MOVED;
+                p->bin_index = p->seen_bin;
+            }
+            p->magnitude_squared = p->seen_mag;
+
+            /* The places kept stay in order at the front, the removed go behind */
+            if (kept != i) {
+                spectral_track_place_t t = place[kept];
+
+                place[kept] = *p;
+                *p = t;
+            }
+            kept++;
+        }
+    }
+    track->active = (uint16_t) kept;
+
+    /* New peaks, away from the tracked ones, strongest first */
+    for (uint32_t c = 0; c < count; c++) {
+        uint32_t i;
+
+        if (top[c].bin_index == 0 || top[c].magnitude_squared <= floor_mag ||
+            track_near(track, top[c].bin_index)) {
+            continue;
+        }
+
+        if (track->active < track->k) {
+            i = track->active++;
+        } else {
+            i = track_weakest(track);
+            if (top[c].magnitude_squared <= track_margin(track, place[i].magnitude_squared)) {
+                /* The rest are weaker still, and the weakest kept only stronger */
+                break;
+            }
+        }
+
+        place[i].bin_index = top[c].bin_index;
+        place[i].magnitude_squared = top[c].magnitude_squared;
+        place[i].change = SPECTRAL_TRACK_ADDED;
+        track_sort_place(track, i);
+    }
+
+    /* At most one change per place; the free ones read as bin 0 again */
+    for (uint32_t i = 0; i < track->k; i++) {
+        spectral_track_place_t *p = &place[i];
+
+        if (p->change != 0) {
+            track->changes[n].op = p->change;
+            track->changes[n].id = p->id;
+            track->changes[n].bin_index = p->bin_index;
+            n++;
+            p->change = 0;
+        }
+        if (i >= track->active) {
+            p->bin_index = 0;
+        }
+    }
+    track->num_changes = (uint16_t) n;
+
+    return (uint16_t) n;
+}
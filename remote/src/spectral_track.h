@@ -0,0 +1,179 @@
+/* ----------------------------------------------------------------------
+ * Project:      FFT Utility Functions
+ * Title:        spectral_track.h
+ * Description:  Top bins tracked from frame to frame, reported as changes
+ *
+ * Target Processor: nRF54L15 FLPR (RISC-V)
+ * -------------------------------------------------------------------- */
+
+#ifndef SPECTRAL_TRACK_H
+#define SPECTRAL_TRACK_H
+
+#include "rfft_q15_simplified.h"
+#include "spectral_topk.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Changes of a place of the tracked set */
+#define SPECTRAL_TRACK_ADDED    1U  /**< The place holds a new peak, whatever it held before */
+#define SPECTRAL_TRACK_REMOVED  2U  /**< The place is free, bin_index is the peak it held */
+#define SPECTRAL_TRACK_MOVED    3U  /**< The peak of the place is at another bin */
+
+/**
+ * @brief One place of the tracked set
+ *
+ * The id of a place never changes, it is what the changes refer to. A
+ * free place has bin_index 0.
+ */
+typedef struct {
+    uint32_t magnitude_squared;  /**< Magnitude² of the peak in the last frame */
+    uint32_t seen_mag;           /**< Strongest magnitude² near the peak in the current frame */
+    uint16_t bin_index;          /**< Bin of the peak, 0 for a free place */
+    uint16_t seen_bin;           /**< Bin of seen_mag */
+    uint8_t id;                  /**< Number of the place, 0 to k - 1 */
+    uint8_t change;              /**< SPECTRAL_TRACK_* of the current frame, 0 for none */
+} spectral_track_place_t;
+
+/** @brief Change of one place in a frame */
+typedef struct {
+    uint8_t op;          /**< SPECTRAL_TRACK_* */
+    uint8_t id;          /**< Place changed */
+    uint16_t bin_index;  /**< Bin the place holds now, or held for SPECTRAL_TRACK_REMOVED */
+} spectral_track_change_t;
+
+/**
+ * @brief The top bins of a stream of frames, kept in stable places
+ *
+ * In steady state the top bins barely change from frame to frame, so the
+ * set of the frame before is checked first: every bin of the new frame
+ * within move_bins of a tracked peak is compared with it on the way, one
+ * compare per bin, and the strongest of them becomes the new position
+ * and magnitude² of the peak, a SPECTRAL_TRACK_MOVED if it is another
+ * bin. A tracked peak then stays in its place as long as no new one
+ * beats it with a margin: a bin of the new selection away from every
+ * tracked peak takes the place of the weakest only above its magnitude²
+ * times 1 + 2^-hyst_shift, so two bins of about equal magnitude² do not
+ * swap places every frame. A peak at or below the floor of
+ * spectral_track_end_frame() is removed.
+ *
+ * Only the places that changed are reported, at most one change per
+ * place and frame. spectral_track_threshold() is the least magnitude² a
+ * new bin needs to enter the full set; as the floor of the next
+ * selection it lets that selection reject nearly every bin with its first
+ * compare. It is of the frame before, so a peak that overtakes a tracked
+ * one falling away in the same frame enters a frame later.
+ *
+ * The active places are kept sorted by bin, the free ones after them.
+ */
+typedef struct {
+    spectral_track_place_t *place;     /**< k places, owned by the caller */
+    spectral_track_change_t *changes;  /**< k changes of the last frame, owned by the caller */
+    uint16_t num_changes;              /**< Entries of changes */
+    uint16_t active;                   /**< Places holding a peak, place[0..active-1] */
+    uint16_t next;                     /**< First active place the current bin may still reach */
+    uint16_t move_bins;                /**< Farthest a peak moves and keeps its place */
+    uint8_t k;                         /**< Places */
+    uint8_t hyst_shift;                /**< log2 of the magnitude² over the margin to replace */
+} spectral_track_t;
+
+/**
+ * @brief Start tracking with no peak
+ *
+ * @param[out] track       Tracker state
+ * @param[in]  places      k places, owned by the caller
+ * @param[in]  changes     k changes, owned by the caller
+ * @param[in]  k           Places, 1 to 255
+ * @param[in]  move_bins   Farthest a peak moves from one frame to the next
+ *                         and keeps its place
+ * @param[in]  hyst_shift  A new peak replaces a tracked one above its
+ *                         magnitude² times 1 + 2^-hyst_shift, up to 31
+ *
+ * @return rfft_status_t
+ *         - RFFT_SUCCESS: Operation successful
+ *         - RFFT_ERROR_NULL_POINTER: NULL pointer provided
+ *         - RFFT_ERROR_INVALID_SIZE: k or hyst_shift out of range
+ *
+ * @example
+ *   static spectral_track_place_t places[20];
+ *   static spectral_track_change_t changes[20];
+ *   static spectral_track_t track;
+ *
+ *   // Peaks move up to 2 bins, 1 dB to take the place of another
+ *   spectral_track_init(&track, places, changes, 20, 2, 2);
+ *   fft_context_set_track(&ctx, &track);
+ */
+rfft_status_t spectral_track_init(
+    spectral_track_t *track,
+    spectral_track_place_t *places,
+    spectral_track_change_t *changes,
+    uint16_t k,
+    uint16_t move_bins,
+    uint8_t hyst_shift
+);
+
+/**
+ * @brief Free every place, without reporting it
+ *
+ * For a new frame length, whose bins are not those of the set.
+ *
+ * @param[in,out] track  Initialized tracker
+ */
+void spectral_track_reset(spectral_track_t *track);
+
+/**
+ * @brief Least magnitude² of a bin that enters the full set, 0 while a place is free
+ */
+uint32_t spectral_track_threshold(const spectral_track_t *track);
+
+/**
+ * @brief Start the comparison of a frame with the set
+ *
+ * @param[in,out] track  Initialized tracker
+ */
+void spectral_track_begin_frame(spectral_track_t *track);
+
+/* Compare a bin with the tracked peaks it is near. */
+void spectral_track_push_slow(spectral_track_t *track, uint32_t bin, uint32_t mag_sq);
+
+/**
+ * @brief Compare one bin of the current frame with the set
+ *
+ * @param[in,out] track   Tracker after spectral_track_begin_frame()
+ * @param[in]     bin     Bin index, above the bin pushed before
+ * @param[in]     mag_sq  Magnitude² of the bin
+ */
+static inline void spectral_track_push(spectral_track_t *track, uint32_t bin, uint32_t mag_sq)
+{
+    /* One compare for the bins below the next tracked peak */
+    if (track->next < track->active &&
+        bin + track->move_bins >= track->place[track->next].bin_index) {
+        spectral_track_push_slow(track, bin, mag_sq);
+    }
+}
+
+/**
+ * @brief End a frame, update the set from its selection and list the changes
+ *
+ * @param[in,out] track      Tracker after all bins of a frame
+ * @param[in]     top        Selection of the frame, strongest first, as
+ *                           spectral_topk_finish() sorts it; places of
+ *                           bin 0 are unused
+ * @param[in]     count      Entries of top
+ * @param[in]     floor_mag  Largest magnitude² of a peak removed
+ *
+ * @return Number of changes, in track->changes
+ */
+uint16_t spectral_track_end_frame(
+    spectral_track_t *track,
+    const spectral_peak_t *top,
+    uint16_t count,
+    uint32_t floor_mag
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SPECTRAL_TRACK_H */
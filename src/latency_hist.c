@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <zephyr/sys/util.h>
+
+#include "latency_hist.h"
+
+static uint32_t bucket_of(uint32_t us)
+{
+	uint32_t exp;
+
+	if (us < 4) {
+		return us;
+	}
+
+	/* The two bits below the leading one pick the quarter, 2^24 - 1 lands in 91. */
+	exp = 31 - __builtin_clz(us);
+
+	return 4 * (exp - 1) + ((us >> (exp - 2)) & 3);
+}
+
+static uint32_t bucket_upper(uint32_t bucket)
+{
+	uint32_t exp;
+	uint32_t width;
+
+	if (bucket < 4) {
+		return bucket;
+	}
+
+	exp = bucket / 4 + 1;
+	width = 1U << (exp - 2);
+
+	return (4 + (bucket % 4)) * width + width - 1;
+}
+
+void latency_hist_reset(struct latency_hist *hist)
+{
+	memset(hist, 0, sizeof(*hist));
+}
+
+void latency_hist_add(struct latency_hist *hist, uint32_t us)
+{
+	us = MIN(us, LATENCY_HIST_MAX_US);
+
+	hist->buckets[bucket_of(us)]++;
+	hist->count++;
+	hist->max = MAX(hist->max, us);
+}
+
+uint32_t latency_hist_percentile(const struct latency_hist *hist, uint32_t permille)
+{
+	/* Rank of the value, counted from 1. */
+	uint64_t rank = ((uint64_t)hist->count * permille + 999) / 1000;
+	uint64_t seen = 0;
+
+	if (hist->count == 0) {
+		return 0;
+	}
+
+	rank = MAX(rank, 1);
+
+	for (uint32_t i = 0; i < LATENCY_HIST_BUCKETS; i++) {
+		seen += hist->buckets[i];
+		if (seen >= rank) {
+			return MIN(bucket_upper(i), hist->max);
+		}
+	}
+
+	return hist->max;
+}
@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef LATENCY_HIST_H
+#define LATENCY_HIST_H
+
+#include <stdint.h>
+
+/* Four buckets per power of two up to 2^24 us, about 17 s. */
+#define LATENCY_HIST_MAX_US  ((1U << 24) - 1)
+#define LATENCY_HIST_BUCKETS 92
+
+/**
+ * Histogram of latencies in microseconds. Values below 4 us have a bucket
+ * each, above that every power of two is split into four, so a percentile
+ * is reported to within 25 % of its value and the histogram stays small
+ * enough to fill from an interrupt or receive callback.
+ */
+struct latency_hist {
+	uint32_t buckets[LATENCY_HIST_BUCKETS];
+	uint32_t count;
+	uint32_t max;
+};
+
+/**
+ * @brief Empty a histogram.
+ */
+void latency_hist_reset(struct latency_hist *hist);
+
+/**
+ * @brief Count one latency, values above LATENCY_HIST_MAX_US in the last bucket.
+ */
+void latency_hist_add(struct latency_hist *hist, uint32_t us);
+
+/**
+ * @brief Latency below which @p permille of the values lie.
+ *
+ * @return Upper bound of the bucket holding that value in microseconds,
+ *         capped to the largest value seen, 0 for an empty histogram.
+ */
+uint32_t latency_hist_percentile(const struct latency_hist *hist, uint32_t permille);
+
+#endif /* LATENCY_HIST_H */
@@ -12,77 +12,2794 @@
 
 #include <zephyr/ipc/ipc_service.h>
 
+#if defined(CONFIG_APP_FFT_PERF_SHELL)
+#include <zephyr/shell/shell.h>
+#endif
+
+#if defined(CONFIG_APP_IPC_BATCH)
+#include "ipc_batch.h"
+#endif
+
+#if defined(CONFIG_APP_IPC_CREDIT)
+#include "ipc_credit.h"
+#endif
+
+#if defined(CONFIG_APP_IPC_TRACE)
+#include "ipc_trace.h"
+#endif
+
+#if defined(CONFIG_APP_IPC_SWEEP)
+#include "ipc_sweep.h"
+#endif
+
+#if defined(CONFIG_APP_IPC_BENCH)
+#include "ipc_bench.h"
+#endif
+
+#if defined(CONFIG_APP_FFT_STREAM)
+#include "fft_stream_msg.h"
+#if defined(CONFIG_APP_FFT_SAADC)
+#include "saadc_source.h"
+#else
+#include "sample_source.h"
+#endif
+#if defined(CONFIG_APP_FFT_PSD_COMPACT)
+#include "psd_pack.h"
+#endif
+#endif
+
+#include "fft_cache.h"
+#if defined(CONFIG_APP_FFT_SHM_POOL) || defined(CONFIG_APP_FFT_SHM_RING) || \
+	defined(CONFIG_APP_FFT_RETRANSMIT)
+#include "fft_frame_pool.h"
+#endif
+
+#if defined(CONFIG_APP_FFT_LATENCY)
+#include "latency_hist.h"
+#endif
+
+#if defined(CONFIG_APP_FFT_FANOUT)
+#include "result_fanout.h"
+#endif
+
+#if defined(CONFIG_APP_FFT_DUTY_CYCLE)
+#include <hal/nrf_oscillators.h>
+#endif
+
+#if defined(CONFIG_APP_FFT_COOP)
+#include "rfft_q15_simplified.h"
+#endif
+
+#if defined(CONFIG_APP_FFT_OFFLOAD)
+#include <cmsis_core.h>
+#include "fft_utils.h"
+#endif
+
+#if defined(CONFIG_APP_FFT_BENCH)
+#include "fft_bench.h"
+#endif
+
+#if defined(CONFIG_APP_FFT_STORE)
+#include <zephyr/drivers/flash.h>
+#include "fft_store.h"
+#endif
+
 #ifdef CONFIG_TEST_EXTRA_STACK_SIZE
 #define STACKSIZE	(1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
 #else
 #define STACKSIZE	(1024)
 #endif
 
-K_THREAD_STACK_DEFINE(ipc0_stack, STACKSIZE);
+K_THREAD_STACK_DEFINE(ipc0_stack, STACKSIZE);
+
+LOG_MODULE_REGISTER(host, LOG_LEVEL_INF);
+
+struct payload {
+	unsigned long cnt;
+	unsigned long size;
+	uint8_t data[];
+};
+
+#if defined(CONFIG_APP_IPC_TRACE)
+/* The summary for the other core rides in the filler of the test payload. */
+BUILD_ASSERT(CONFIG_APP_IPC_SERVICE_MESSAGE_LEN >=
+	     offsetof(struct payload, data) + sizeof(struct ipc_trace_summary),
+	     "APP_IPC_SERVICE_MESSAGE_LEN too short for the IPC trace summary");
+#endif
+
+struct payload *p_payload;
+
+/* ep0, and the control plane endpoint with APP_FFT_CTRL_PLANE. */
+#define NUM_ENDPOINTS (1 + IS_ENABLED(CONFIG_APP_FFT_CTRL_PLANE))
+
+static K_SEM_DEFINE(bound_sem, 0, NUM_ENDPOINTS);
+
+static void ep_bound(void *priv)
+{
+	k_sem_give(&bound_sem);
+}
+
+#if defined(CONFIG_APP_FFT_CTRL_PLANE)
+/*
+ * Endpoint of the control plane, on the ipc1 instance with buffers of its
+ * own: commands, their answers, flow control and events never queue behind
+ * the sample blocks and results of ep0, the data plane.
+ */
+static struct ipc_ept ctrl_ep;
+
+static inline struct ipc_ept *ctrl_plane(struct ipc_ept *ep)
+{
+	ARG_UNUSED(ep);
+
+	return &ctrl_ep;
+}
+#else
+static inline struct ipc_ept *ctrl_plane(struct ipc_ept *ep)
+{
+	return ep;
+}
+#endif
+
+#if defined(CONFIG_APP_FFT_STREAM)
+static uint32_t frames_received;
+
+/* Frame length the remote core analyses, bins are converted at it. */
+static uint32_t frame_len = CONFIG_APP_FFT_FRAME_LEN;
+
+/* Set while the remote core has no frame left to fill, see FFT_STREAM_MSG_FLOW. */
+static atomic_t remote_paused;
+static uint32_t blocks_held;
+
+#if defined(CONFIG_APP_FFT_RETRANSMIT)
+/* The last APP_FFT_RETRANSMIT_WINDOW blocks sent, in the otherwise unused frame pool. */
+#define RESEND_SLOT_SIZE ROUND_UP(FFT_SAMPLE_BLOCK_SIZE(CONFIG_APP_FFT_BLOCK_SAMPLES), 4)
+BUILD_ASSERT(CONFIG_APP_FFT_RETRANSMIT_WINDOW * RESEND_SLOT_SIZE <= FFT_POOL_SIZE,
+	     "fft_pool cannot hold APP_FFT_RETRANSMIT_WINDOW sample blocks");
+
+/* Ranges of blocks the remote core asked for again, see FFT_STREAM_MSG_NACK. */
+K_MSGQ_DEFINE(resend_requests, sizeof(struct fft_stream_hdr), 4, 4);
+static uint32_t blocks_resent;
+static uint32_t blocks_deferred;
+static uint32_t resends_dropped;
+
+static inline struct fft_sample_block *resend_slot(uint32_t seq)
+{
+	return (struct fft_sample_block *)(FFT_POOL_ADDR + (seq % CONFIG_APP_FFT_RETRANSMIT_WINDOW) *
+							       RESEND_SLOT_SIZE);
+}
+#endif
+
+#if defined(CONFIG_APP_FFT_SHM_POOL)
+BUILD_ASSERT(FFT_POOL_NUM_SLOTS > 0, "fft_pool cannot hold a single frame");
+BUILD_ASSERT((CONFIG_APP_FFT_FRAME_LEN % CONFIG_APP_FFT_BLOCK_SAMPLES) == 0,
+	     "Frame length must be a multiple of the block size");
+
+/* Pool slots not currently owned by the remote core. */
+K_MSGQ_DEFINE(free_slots, sizeof(uint8_t), FFT_POOL_NUM_SLOTS, 1);
+
+static uint32_t frames_skipped;
+#endif
+
+#if defined(CONFIG_APP_FFT_OFFLOAD)
+/* Frame of the pool waiting for the application core. */
+struct local_frame {
+	uint32_t seq;
+	uint8_t slot;
+};
+
+/* One frame waits while the one before is analysed. */
+K_MSGQ_DEFINE(local_frames, sizeof(struct local_frame), 1, 4);
+
+/* Frames sent to the remote core and not answered yet. */
+static atomic_t remote_queued;
+
+/* Remote cycles per frame of the last profile, 0 before the first. */
+static uint32_t remote_frame_cycles;
+
+/* Microseconds per frame on this core, smoothed, 0 before the first. */
+static uint32_t local_frame_us;
+
+static uint32_t frames_local;
+#endif
+
+#if defined(CONFIG_APP_FFT_PSD)
+/* Strongest bin above DC of the power spectrum being received. */
+static uint32_t psd_peak_bin;
+static uint32_t psd_peak;
+
+static void psd_peak_update(uint32_t bin, uint32_t value)
+{
+	if ((bin != 0) && (value > psd_peak)) {
+		psd_peak_bin = bin;
+		psd_peak = value;
+	}
+}
+
+/* Print the peak once the chunk ending before bin end completes the readout. */
+static void psd_chunk_done(uint32_t seq, uint32_t frames, uint32_t end)
+{
+	uint32_t peak_hz;
+
+	if (end == frame_len / 2 + 1) {
+		peak_hz = psd_peak_bin * CONFIG_APP_FFT_SAMPLE_RATE / frame_len;
+		printk("PSD %u over %u frames: peak %u Hz (bin %u), magnitude² %u\n",
+		       seq, frames, peak_hz, psd_peak_bin, psd_peak);
+	}
+}
+
+#if defined(CONFIG_APP_FFT_PSD_COMPACT)
+static void psd_packed_bin(uint32_t bin, uint8_t code, void *user_data)
+{
+	/* The smallest magnitude² of the code, so the peak reads low by up to 0.4 dB. */
+	psd_peak_update((uintptr_t)user_data + bin, psd_pack_exp8(code));
+}
+
+static void psd_packed_recv(const struct fft_psd_packed_msg *msg, size_t len)
+{
+	int bins;
+
+	if ((len < FFT_PSD_PACKED_MSG_SIZE(0)) || (len > sizeof(*msg))) {
+		printk("Malformed power spectrum chunk, len: %d\n", len);
+		return;
+	}
+
+	if (msg->first_bin == 0) {
+		psd_peak_bin = 0;
+		psd_peak = 0;
+	}
+
+	bins = psd_pack_decode(msg->data, len - FFT_PSD_PACKED_MSG_SIZE(0), psd_packed_bin,
+			       (void *)(uintptr_t)msg->first_bin);
+	if (bins != msg->hdr.count) {
+		printk("Malformed power spectrum chunk, %d of %u bins\n", bins, msg->hdr.count);
+		return;
+	}
+
+	psd_chunk_done(msg->hdr.seq, msg->frames, msg->first_bin + msg->hdr.count);
+}
+#else
+static void psd_recv(const struct fft_psd_msg *msg, size_t len)
+{
+	if ((len < FFT_PSD_MSG_SIZE(0)) || (msg->hdr.count > FFT_PSD_MSG_BINS) ||
+	    (len != FFT_PSD_MSG_SIZE(msg->hdr.count))) {
+		printk("Malformed power spectrum chunk, len: %d\n", len);
+		return;
+	}
+
+	if (msg->first_bin == 0) {
+		psd_peak_bin = 0;
+		psd_peak = 0;
+	}
+
+	for (uint32_t i = 0; i < msg->hdr.count; i++) {
+		psd_peak_update(msg->first_bin + i, msg->bins[i]);
+	}
+
+	psd_chunk_done(msg->hdr.seq, msg->frames, msg->first_bin + msg->hdr.count);
+}
+#endif /* CONFIG_APP_FFT_PSD_COMPACT */
+#endif
+
+#if defined(CONFIG_APP_FFT_LATENCY)
+/* Capture times of the last blocks or pool frames, by sequence number. */
+#define CAPTURE_RING_LEN 64
+
+static struct {
+	uint32_t seq;
+	uint32_t us;
+} capture_ring[CAPTURE_RING_LEN];
+
+/* Remote clock minus application clock, valid once clock_synced. */
+static int32_t clock_offset;
+static uint32_t clock_rtt;
+static bool clock_synced;
+
+/* Capture to result delivery, and its stages. */
+enum {
+	LAT_TOTAL,
+	LAT_IN,
+	LAT_QUEUE,
+	LAT_FFT,
+	LAT_OUT,
+	LAT_NUM,
+};
+
+static struct latency_hist lat_hist[LAT_NUM];
+static struct k_spinlock lat_lock;
+
+/* Microseconds since boot, low 32 bits, the unit of every stamp. */
+static uint32_t now_us(void)
+{
+	return (uint32_t)k_cyc_to_us_floor64(k_cycle_get_64());
+}
+
+/* Note when the last sample of a block or pool frame was captured. */
+static void stamp_capture(uint32_t seq)
+{
+	capture_ring[seq % CAPTURE_RING_LEN].seq = seq;
+	capture_ring[seq % CAPTURE_RING_LEN].us = now_us();
+}
+
+/* Stretch from a to b, negative ones from a stale offset count as 0. */
+static uint32_t elapsed(uint32_t a, uint32_t b)
+{
+	int32_t d = (int32_t)(b - a);
+
+	return (d > 0) ? (uint32_t)d : 0;
+}
+
+static void sync_recv(const struct fft_sync_msg *msg)
+{
+	uint32_t app_rx = now_us();
+
+	/* NTP style: the time the reply waited on the remote core is taken out. */
+	clock_rtt = elapsed(msg->app_tx, app_rx) - elapsed(msg->remote_rx, msg->remote_tx);
+	clock_offset = ((int32_t)(msg->remote_rx - msg->app_tx) +
+			(int32_t)(msg->remote_tx - app_rx)) / 2;
+	clock_synced = true;
+}
+
+static void latency_recv(const struct fft_result_times *t)
+{
+	uint32_t delivered = now_us();
+	uint32_t slot = t->last_seq % CAPTURE_RING_LEN;
+	uint32_t captured;
+	k_spinlock_key_t key;
+
+	/* Stamps of the remote core, read on the application clock. */
+	if (!clock_synced || (capture_ring[slot].seq != t->last_seq)) {
+		return;
+	}
+
+	captured = capture_ring[slot].us;
+
+	key = k_spin_lock(&lat_lock);
+	latency_hist_add(&lat_hist[LAT_TOTAL], elapsed(captured, delivered));
+	latency_hist_add(&lat_hist[LAT_IN], elapsed(captured, t->recv - clock_offset));
+	latency_hist_add(&lat_hist[LAT_QUEUE], elapsed(t->recv, t->fft_start));
+	latency_hist_add(&lat_hist[LAT_FFT], elapsed(t->fft_start, t->fft_end));
+	latency_hist_add(&lat_hist[LAT_OUT], elapsed(t->send - clock_offset, delivered));
+	k_spin_unlock(&lat_lock, key);
+}
+#else
+static inline void stamp_capture(uint32_t seq)
+{
+	ARG_UNUSED(seq);
+}
+#endif /* CONFIG_APP_FFT_LATENCY */
+
+#if defined(CONFIG_APP_FFT_RECONFIG)
+/* Set from a configuration request until its reply arrives. */
+static atomic_t config_pending;
+
+static void config_recv(const struct fft_config_msg *msg)
+{
+	if (msg->status < 0) {
+		printk("FFT config %u refused (%d), still %u samples, window %u\n",
+		       msg->hdr.seq, msg->status, msg->hdr.count, msg->window);
+	} else {
+		printk("FFT config %u: %u samples, window %u\n", msg->hdr.seq,
+		       msg->hdr.count, msg->window);
+	}
+
+	/* Results that follow are of frames of this length. */
+	frame_len = msg->hdr.count;
+	atomic_clear(&config_pending);
+}
+#endif
+
+#if defined(CONFIG_APP_FFT_PIPELINE)
+/* Whether the chain in effect sends results, the band energies count the frames otherwise. */
+static bool pipeline_results = true;
+
+static void pipeline_recv(const struct fft_pipeline_msg *msg)
+{
+	uint32_t count = MIN(msg->hdr.count, FFT_PIPELINE_MAX_STAGES);
+
+	pipeline_results = false;
+	for (uint32_t i = 0; i < count; i++) {
+		if (msg->stages[i].id == FFT_STAGE_SEND_RESULT) {
+			pipeline_results = true;
+		}
+	}
+
+	if (msg->status < 0) {
+		printk("FFT pipeline %u refused (%d), still %u stages\n", msg->hdr.seq,
+		       msg->status, count);
+	} else {
+		printk("FFT pipeline %u: %u stages\n", msg->hdr.seq, count);
+	}
+
+	atomic_clear(&config_pending);
+}
+#endif
+
+#if defined(CONFIG_APP_FFT_PERF_SHELL)
+/* To the shell that asked, or to the console when sh is NULL. */
+#define report(sh, fmt, ...)                                                                      \
+	do {                                                                                      \
+		if ((sh) != NULL) {                                                               \
+			shell_print(sh, fmt, ##__VA_ARGS__);                                      \
+		} else {                                                                          \
+			printk(fmt "\n", ##__VA_ARGS__);                                          \
+		}                                                                                 \
+	} while (0)
+#else
+struct shell;
+
+#define report(sh, fmt, ...) printk(fmt "\n", ##__VA_ARGS__)
+#endif
+
+#if defined(CONFIG_APP_FFT_CTRL)
+/* Commands sent and not answered yet, up to FFT_CTRL_MAX_PENDING. */
+static atomic_t ctrl_in_flight;
+
+#if defined(CONFIG_APP_FFT_PERF_SHELL)
+/* Response to a query of the shell. */
+union ctrl_answer {
+	struct fft_ctrl_msg ctrl;
+	struct fft_ctrl_stats_msg stats;
+	struct fft_ctrl_perf_msg perf;
+};
+
+/* Command the shell waits for the response of, 0 for none. */
+static atomic_t query_cmd;
+static union ctrl_answer query_answer;
+static K_SEM_DEFINE(query_sem, 0, 1);
+#endif
+
+static void stats_report(const struct shell *sh, const struct fft_ctrl_stats_msg *stats)
+{
+	report(sh, "FFT stats %u: %u blocks, %u frames, %u lost, %u dropped, "
+	       "%u skipped, %u bad, %u overruns, %u late", stats->ctrl.id, stats->blocks,
+	       stats->frames, stats->lost_blocks, stats->dropped_blocks, stats->dropped_frames,
+	       stats->bad_blocks, stats->overruns, stats->late_frames);
+}
+
+#if defined(CONFIG_APP_FFT_PERF)
+static void perf_report(const struct shell *sh, const struct fft_ctrl_perf_msg *perf)
+{
+	const struct fft_perf_stage *analysis = &perf->stage[FFT_PERF_STAGE_ANALYSIS];
+	const struct fft_perf_stage *send = &perf->stage[FFT_PERF_STAGE_SEND];
+
+	report(sh, "FFT perf %u: %u frames, %u overruns, %u IPC retries, %u frames queued at most",
+	       perf->ctrl.id, perf->frames, perf->overruns, perf->ipc_retries,
+	       perf->queue_high_water);
+	report(sh, "  cycles avg/max per frame: analysis %u/%u | send %u/%u",
+	       analysis->avg_cycles, analysis->max_cycles, send->avg_cycles, send->max_cycles);
+	report(sh, "  arena: %u of %u B in use at most", perf->arena_high_water, perf->arena_size);
+}
+#endif
+
+static void ctrl_recv(const void *data, size_t len)
+{
+	const struct fft_ctrl_stats_msg *stats = data;
+	const struct fft_ctrl_msg *msg = &stats->ctrl;
+	uint8_t cmd = msg->cmd & ~FFT_CTRL_RESPONSE;
+
+	atomic_dec(&ctrl_in_flight);
+
+#if defined(CONFIG_APP_FFT_PERF_SHELL)
+	/* Answered once, a response after the shell gave up goes to the console. */
+	if (atomic_cas(&query_cmd, cmd, 0)) {
+		memcpy(&query_answer, data, MIN(len, sizeof(query_answer)));
+		k_sem_give(&query_sem);
+		return;
+	}
+#endif
+
+	if (msg->status < 0) {
+		printk("FFT ctrl %u: command %u failed (%d)\n", msg->id, cmd, msg->status);
+	} else if ((cmd == FFT_CTRL_GET_STATS) && (len == sizeof(*stats))) {
+		stats_report(NULL, stats);
+#if defined(CONFIG_APP_FFT_PERF)
+	} else if ((cmd == FFT_CTRL_GET_PERF) && (len == sizeof(struct fft_ctrl_perf_msg))) {
+		perf_report(NULL, data);
+#endif
+	} else {
+		printk("FFT ctrl %u: command %u done\n", msg->id, cmd);
+	}
+
+	if (cmd == FFT_CTRL_CONFIGURE) {
+		/* Results that follow are of frames of this length. */
+		frame_len = msg->arg[0];
+	}
+}
+#endif
+
+#if defined(CONFIG_APP_FFT_EVENTS)
+static void event_recv(const struct fft_event_msg *msg)
+{
+	uint32_t peak_hz;
+
+	if (msg->cause == 0) {
+		printk("FFT event frame %u: back to baseline\n", msg->hdr.seq);
+		return;
+	}
+
+	if (msg->cause & FFT_EVENT_PEAK) {
+		peak_hz = (uint32_t)msg->peak_bin * CONFIG_APP_FFT_SAMPLE_RATE / frame_len;
+		printk("FFT event frame %u: peak %u Hz (bin %u), magnitude² %u over %u\n",
+		       msg->hdr.seq, peak_hz, msg->peak_bin, msg->peak, msg->peak_baseline);
+	}
+
+	if (msg->cause & FFT_EVENT_BAND) {
+		printk("FFT event frame %u: band energy %u over %u\n", msg->hdr.seq,
+		       msg->band_energy, msg->band_baseline);
+	}
+}
+#endif
+
+#if defined(CONFIG_APP_FFT_BANDS) || defined(CONFIG_APP_FFT_PIPELINE)
+/* Print the strongest band of a frame, the vector that replaces its result or comes with it. */
+static void bands_recv(const struct fft_bands_msg *msg)
+{
+	uint32_t strongest = 0;
+
+#if defined(CONFIG_APP_FFT_PIPELINE)
+	/* Next to a result, the band energies are of a frame counted already. */
+	frames_received += pipeline_results ? 0 : 1;
+#else
+	frames_received++;
+#endif
+
+	if (msg->hdr.count == 0) {
+		printk("FFT frame %u: no band energies\n", msg->hdr.seq);
+		return;
+	}
+
+	for (uint32_t i = 1; i < msg->hdr.count; i++) {
+		if (msg->energy[i] > msg->energy[strongest]) {
+			strongest = i;
+		}
+	}
+
+	printk("FFT frame %u: band %u strongest of %u, energy %u\n", msg->hdr.seq, strongest,
+	       msg->hdr.count, msg->energy[strongest]);
+}
+#endif
+
+#if defined(CONFIG_APP_FFT_MEL)
+/* Print the first feature and the largest of a frame, the vector that replaces its result. */
+static void features_recv(const struct fft_features_msg *msg)
+{
+	uint32_t largest = 0;
+
+	frames_received++;
+
+	if (msg->hdr.count == 0) {
+		printk("FFT frame %u: no features\n", msg->hdr.seq);
+		return;
+	}
+
+	for (uint32_t i = 1; i < msg->hdr.count; i++) {
+		if (msg->features[i] > msg->features[largest]) {
+			largest = i;
+		}
+	}
+
+	printk("FFT frame %u: %u features, first %d, largest %d at %u\n", msg->hdr.seq,
+	       msg->hdr.count, msg->features[0], msg->features[largest], largest);
+}
+#endif
+
+#if defined(CONFIG_APP_FFT_TRACK)
+/* Bin of every place of the tracked top bins, 0 for a free place. */
+static uint16_t track_bins[CONFIG_APP_FFT_TOP_BINS];
+
+/* Apply the changes of a frame to the places and print them. */
+static void track_recv(const struct fft_track_msg *msg)
+{
+	static const char *const ops[] = {
+		[FFT_TRACK_ADDED] = "added",
+		[FFT_TRACK_REMOVED] = "removed",
+		[FFT_TRACK_MOVED] = "moved",
+	};
+	uint32_t held = 0;
+
+	if (msg->hdr.slot & FFT_TRACK_RESTART) {
+		memset(track_bins, 0, sizeof(track_bins));
+	}
+
+	for (uint32_t i = 0; i < msg->hdr.count; i++) {
+		const struct fft_track_change *c = &msg->change[i];
+
+		if ((c->place >= CONFIG_APP_FFT_TOP_BINS) || (c->op < FFT_TRACK_ADDED) ||
+		    (c->op > FFT_TRACK_MOVED)) {
+			continue;
+		}
+
+		track_bins[c->place] = (c->op == FFT_TRACK_REMOVED) ? 0 : c->bin;
+		printk("FFT frame %u: place %u %s, %u Hz (bin %u)\n", msg->hdr.seq, c->place,
+		       ops[c->op], (uint32_t)c->bin * CONFIG_APP_FFT_SAMPLE_RATE / frame_len,
+		       c->bin);
+	}
+
+	for (uint32_t i = 0; i < CONFIG_APP_FFT_TOP_BINS; i++) {
+		held += (track_bins[i] != 0) ? 1 : 0;
+	}
+	printk("FFT frame %u: %u places held\n", msg->hdr.seq, held);
+}
+#endif
+
+#if defined(CONFIG_APP_FFT_SPECTROGRAM)
+/* Shades of a column by how far it is below the loudest one, in 6 dB steps. */
+static const char gram_shades[] = "@%#*+=-:. ";
+
+/* Print a row as one line of shades, with the column of its loudest bin. */
+static void spectrogram_recv(const struct fft_spectrogram_msg *msg)
+{
+	char line[CONFIG_APP_FFT_SPECTROGRAM_COLUMNS + 1];
+	uint32_t loudest = 0;
+
+	for (uint32_t i = 1; i < msg->hdr.count; i++) {
+		if (msg->column[i] > msg->column[loudest]) {
+			loudest = i;
+		}
+	}
+
+	/* A log code is 1/8 octave of magnitude², 16 codes are 6 dB. */
+	for (uint32_t i = 0; i < msg->hdr.count; i++) {
+		uint32_t step = (msg->column[loudest] - msg->column[i]) / 16;
+
+		line[i] = gram_shades[MIN(step, sizeof(gram_shades) - 2)];
+	}
+	line[msg->hdr.count] = '\0';
+
+	printk("FFT spectrogram frame %u: |%s| loudest at column %u of %u, %u dropped\n",
+	       msg->hdr.seq, line, loudest, msg->hdr.count, msg->dropped);
+}
+
+/* Ask for a row every APP_FFT_SPECTROGRAM_DECIMATION frames. */
+static int subscribe_spectrogram(struct ipc_ept *ep)
+{
+	struct fft_stream_hdr req = {
+		.type = FFT_STREAM_MSG_SPECTROGRAM,
+		.count = CONFIG_APP_FFT_SPECTROGRAM_DECIMATION,
+	};
+	int ret;
+
+	do {
+		ret = ipc_service_send(ctrl_plane(ep), &req, sizeof(req));
+	} while (ret == -ENOMEM);
+
+	if (ret < 0) {
+		printk("send_message(spectrogram subscription) failed with ret %d\n", ret);
+		return ret;
+	}
+
+	return 0;
+}
+#endif
+
+#if defined(CONFIG_APP_FFT_DUTY_CYCLE)
+/* Run the HFPLL, and with it both cores, at the clock the remote core asks for. */
+static void clock_recv(const struct fft_clock_msg *msg)
+{
+	switch (msg->hdr.count) {
+	case 64:
+		nrf_oscillators_pll_freq_set(NRF_OSCILLATORS, NRF_OSCILLATORS_PLL_FREQ_64M);
+		break;
+	case 128:
+		nrf_oscillators_pll_freq_set(NRF_OSCILLATORS, NRF_OSCILLATORS_PLL_FREQ_128M);
+		break;
+	default:
+		printk("FFT clock %u: %u MHz not supported\n", msg->hdr.seq, msg->hdr.count);
+		return;
+	}
+
+	printk("FFT clock %u: %u MHz, %u of %u cycles per frame\n", msg->hdr.seq,
+	       msg->hdr.count, msg->busy, msg->budget);
+}
+#endif
+
+#if defined(CONFIG_APP_FFT_SHED)
+static const char *const shed_names[FFT_SHED_LEVELS] = {
+	[FFT_SHED_NONE] = "full",
+	[FFT_SHED_HALF] = "half length",
+	[FFT_SHED_RECT] = "no window",
+	[FFT_SHED_TOP_K] = "half the top bins",
+	[FFT_SHED_DECIMATE] = "every other frame",
+};
+
+/* Results from here on are of the analysis at this level, the bins keep their meaning. */
+static void shed_recv(const struct fft_shed_msg *msg)
+{
+	if (msg->hdr.count >= FFT_SHED_LEVELS) {
+		printk("FFT shed %u: unknown level %u\n", msg->hdr.seq, msg->hdr.count);
+		return;
+	}
+
+	printk("FFT shed %u: level %u (%s), at %u of %u cycles per frame\n", msg->hdr.seq,
+	       msg->hdr.count, shed_names[msg->hdr.count], msg->busy, msg->budget);
+}
+#endif
+
+#if defined(CONFIG_APP_FFT_STORE)
+/* RRAM of the fft_store partition, written for the remote core, which only reads it. */
+BUILD_ASSERT(DT_FIXED_PARTITION_EXISTS(FFT_STORE_NODE),
+	     "fft_store must be a partition of cpuapp_rram, the flash the RRAM driver writes");
+static const struct device *const store_dev =
+	DEVICE_DT_GET(DT_MTD_FROM_FIXED_PARTITION(FFT_STORE_NODE));
+
+/* Write a chunk of the remote core's state image into the region, the header chunk last. */
+static void store_recv(const struct fft_store_msg *msg, size_t len)
+{
+	struct fft_store_hdr hdr;
+	int ret;
+
+	if ((len < FFT_STORE_MSG_SIZE(0)) || (msg->hdr.count > FFT_STORE_MSG_MAX) ||
+	    (len != FFT_STORE_MSG_SIZE(msg->hdr.count)) ||
+	    ((msg->offset | msg->hdr.count) % FFT_STORE_ALIGN != 0) ||
+	    (msg->offset > FFT_STORE_SIZE - msg->hdr.count)) {
+		printk("Malformed store chunk, len: %d\n", len);
+		return;
+	}
+
+	ret = flash_write(store_dev, FFT_STORE_ADDR + msg->offset, msg->data, msg->hdr.count);
+	if (ret < 0) {
+		printk("FFT store %u: write at %u failed with ret %d\n", msg->hdr.seq,
+		       msg->offset, ret);
+		return;
+	}
+
+	if ((msg->offset == 0) && (msg->hdr.count >= sizeof(hdr))) {
+		memcpy(&hdr, msg->data, sizeof(hdr));
+		printk("FFT store %u: %u bytes of state saved\n", msg->hdr.seq, hdr.len);
+	}
+}
+#endif
+
+#if defined(CONFIG_APP_FFT_COOP)
+/* Endpoint of the stream, for the answers of the system work queue. */
+static struct ipc_ept *coop_ep;
+/*
+ * Requests and withdrawals in the order they came. The remote core has at
+ * most a request and its withdrawal in flight, and the next request only
+ * after the answer to the first, so the queue never has more than two.
+ */
+K_MSGQ_DEFINE(coop_requests, sizeof(struct fft_coop_msg), 4, 4);
+/* Sequence number of the last withdrawn request, not to be started. */
+static atomic_t coop_withdrawn;
+
+/* Run a half the remote core handed over in the frame pool, answer with the request. */
+static void coop_run(struct fft_coop_msg *msg)
+{
+	/* The CFFT of the RFFT of twice the length. */
+	const arm_rfft_instance_q15 *rfft = rfft_q15_get_instance(2U * msg->hdr.count);
+	size_t len = msg->hdr.count * 2U * sizeof(q15_t);
+	q15_t *half = (q15_t *)(FFT_POOL_ADDR + (uintptr_t)msg->offset);
+	int ret;
+
+	if ((rfft == NULL) || (msg->hdr.seq == (uint32_t)atomic_get(&coop_withdrawn)) ||
+	    !FFT_CACHE_IS_ALIGNED(msg->offset) || (msg->offset > FFT_POOL_SIZE) ||
+	    (len > FFT_POOL_SIZE - msg->offset)) {
+		/* Left to the remote core, also the answer to a withdrawal. */
+		msg->hdr.count = 0;
+	} else {
+		fft_cache_invd(half, len);
+		arm_cfft_q15_half(rfft->pCfft, half);
+		fft_cache_flush(half, len);
+	}
+
+	do {
+		ret = ipc_service_send(coop_ep, msg, sizeof(*msg));
+		if (ret == -ENOMEM) {
+			k_yield();
+		}
+	} while (ret == -ENOMEM);
+
+	if (ret < 0) {
+		printk("send_message(coop %u) failed with ret %d\n", msg->hdr.seq, ret);
+	}
+}
+
+/*
+ * Run the halves of split CFFTs the remote core handed over, while it runs
+ * the others. The remote core waits for every answer before it touches
+ * the half again.
+ */
+static void coop_work_handler(struct k_work *work)
+{
+	struct fft_coop_msg msg;
+
+	ARG_UNUSED(work);
+
+	while (k_msgq_get(&coop_requests, &msg, K_NO_WAIT) == 0) {
+		coop_run(&msg);
+	}
+}
+
+static K_WORK_DEFINE(coop_work, coop_work_handler);
+#endif
+
+/* Print the peak of a result, of either core. */
+static void result_print(const struct fft_result_msg *result)
+{
+#if defined(CONFIG_APP_FFT_ORDER)
+	uint32_t peak_order;
+#else
+	uint32_t peak_hz;
+#endif
+#if defined(CONFIG_APP_FFT_STATS)
+	uint32_t crest;
+	uint32_t kurtosis;
+#endif
+
+	if (result->hdr.count == 0) {
+		printk("FFT frame %u: analysis failed\n", result->hdr.seq);
+		return;
+	}
+
+#if defined(CONFIG_APP_FFT_ORDER)
+	/* A frame of frame_len / APP_FFT_ORDER_SAMPLES_PER_REV revolutions, in 1/100 orders. */
+	peak_order = (uint32_t)result->bins[0] * CONFIG_APP_FFT_ORDER_SAMPLES_PER_REV * 100U /
+		     frame_len;
+	printk("FFT frame %u: peak order %u.%02u (bin %u)\n", result->hdr.seq, peak_order / 100U,
+	       peak_order % 100U, result->bins[0]);
+#else
+	peak_hz = (uint32_t)result->bins[0] * CONFIG_APP_FFT_SAMPLE_RATE / frame_len;
+	printk("FFT frame %u: peak %u Hz (bin %u)\n", result->hdr.seq, peak_hz, result->bins[0]);
+#endif
+
+#if defined(CONFIG_APP_FFT_STATS)
+	/* Crest factor and kurtosis from Q8 to two decimals. */
+	crest = (uint32_t)result->stats.crest * 100U / 256U;
+	kurtosis = (uint32_t)(((uint64_t)result->stats.kurtosis * 100U) / 256U);
+	printk("  mean %d rms %u peak %u crest %u.%02u kurtosis %u.%02u\n", result->stats.mean,
+	       result->stats.rms, result->stats.peak, crest / 100U, crest % 100U,
+	       kurtosis / 100U, kurtosis % 100U);
+#endif
+}
+
+#if defined(CONFIG_APP_FFT_FANOUT)
+/* The console is one subscriber of the results among others. */
+RESULT_FANOUT_SUB_DEFINE(fanout_console, CONFIG_APP_FFT_FANOUT_CONSOLE_DEPTH);
+
+static void fanout_console_task(void *arg1, void *arg2, void *arg3)
+{
+	const struct fft_result_msg *result;
+
+	ARG_UNUSED(arg1);
+	ARG_UNUSED(arg2);
+	ARG_UNUSED(arg3);
+
+	while (true) {
+		result = result_fanout_get(&fanout_console, K_FOREVER);
+		if (result != NULL) {
+			result_print(result);
+			result_fanout_release(result);
+		}
+	}
+}
+
+K_THREAD_DEFINE(fanout_console_id, STACKSIZE, fanout_console_task, NULL, NULL, NULL,
+		K_PRIO_PREEMPT(2), 0, -1);
+
+#if CONFIG_APP_FFT_FANOUT_SLOW_MS > 0
+/* Stands in for a BLE link, a result per connection event. */
+RESULT_FANOUT_SUB_DEFINE(fanout_slow, CONFIG_APP_FFT_FANOUT_SLOW_DEPTH);
+
+static void fanout_slow_task(void *arg1, void *arg2, void *arg3)
+{
+	const struct fft_result_msg *result;
+
+	ARG_UNUSED(arg1);
+	ARG_UNUSED(arg2);
+	ARG_UNUSED(arg3);
+
+	while (true) {
+		result = result_fanout_get(&fanout_slow, K_FOREVER);
+		if (result != NULL) {
+			k_msleep(CONFIG_APP_FFT_FANOUT_SLOW_MS);
+			result_fanout_release(result);
+		}
+	}
+}
+
+K_THREAD_DEFINE(fanout_slow_id, STACKSIZE, fanout_slow_task, NULL, NULL, NULL,
+		K_PRIO_PREEMPT(3), 0, -1);
+#endif
+
+/* Subscribe before the first result can arrive. */
+static int fanout_start(void)
+{
+	int ret;
+
+	ret = result_fanout_subscribe(&fanout_console);
+	if (ret < 0) {
+		return ret;
+	}
+	k_thread_start(fanout_console_id);
+
+#if CONFIG_APP_FFT_FANOUT_SLOW_MS > 0
+	ret = result_fanout_subscribe(&fanout_slow);
+	if (ret < 0) {
+		return ret;
+	}
+	k_thread_start(fanout_slow_id);
+#endif
+
+	return 0;
+}
+
+static void fanout_report(const struct shell *sh)
+{
+	const struct result_fanout_sub *sub;
+
+	for (uint32_t i = 0; (sub = result_fanout_sub_get(i)) != NULL; i++) {
+		if (atomic_get(&sub->dropped) > 0) {
+			report(sh, "Results dropped, %s behind: %ld", sub->name,
+			       atomic_get(&sub->dropped));
+		}
+	}
+
+	if (result_fanout_skipped() > 0) {
+		report(sh, "Results skipped, every record held: %u", result_fanout_skipped());
+	}
+}
+#endif /* CONFIG_APP_FFT_FANOUT */
+
+/* To every subscriber with APP_FFT_FANOUT, else straight to the console. */
+static void result_deliver(const struct fft_result_msg *result)
+{
+#if defined(CONFIG_APP_FFT_FANOUT)
+	result_fanout_publish(result);
+#else
+	result_print(result);
+#endif
+}
+
+/* Print a row of the stage profile of a remote core built with CONFIG_APP_FFT_PROFILE. */
+static void profile_recv(const struct fft_profile_msg *msg)
+{
+	static uint32_t total;
+
+	if (msg->row == 0) {
+		printk("FFT profile %u, remote cycles per frame over %u frames:\n",
+		       msg->hdr.seq, msg->frames);
+		total = 0;
+	}
+
+	printk("  %-16.*s %8u\n", (int)sizeof(msg->name), msg->name, msg->cycles);
+	total += msg->cycles;
+
+	if (msg->row + 1U == msg->hdr.count) {
+		printk("  %-16s %8u\n", "total", total);
+#if defined(CONFIG_APP_FFT_OFFLOAD)
+		remote_frame_cycles = total;
+#endif
+	}
+}
+
+#if defined(CONFIG_APP_FFT_PRIO)
+static void msg_dispatch(const void *data, size_t len)
+#else
+static void ep_recv(const void *data, size_t len, void *priv)
+#endif
+{
+	const struct fft_result_msg *result = data;
+
+#if defined(CONFIG_APP_FFT_PSD_COMPACT)
+	if ((len >= sizeof(result->hdr)) && (result->hdr.type == FFT_STREAM_MSG_PSD_PACKED)) {
+		psd_packed_recv(data, len);
+		return;
+	}
+#elif defined(CONFIG_APP_FFT_PSD)
+	if ((len >= sizeof(result->hdr)) && (result->hdr.type == FFT_STREAM_MSG_PSD)) {
+		psd_recv(data, len);
+		return;
+	}
+#endif
+
+#if defined(CONFIG_APP_FFT_LATENCY)
+	if ((len == sizeof(struct fft_sync_msg)) && (result->hdr.type == FFT_STREAM_MSG_SYNC)) {
+		sync_recv(data);
+		return;
+	}
+#endif
+
+#if defined(CONFIG_APP_FFT_RECONFIG)
+	if ((len == sizeof(struct fft_config_msg)) && (result->hdr.type == FFT_STREAM_MSG_CONFIG)) {
+		config_recv(data);
+		return;
+	}
+#endif
+
+#if defined(CONFIG_APP_FFT_PIPELINE)
+	if ((len == sizeof(struct fft_pipeline_msg)) &&
+	    (result->hdr.type == FFT_STREAM_MSG_PIPELINE)) {
+		pipeline_recv(data);
+		return;
+	}
+#endif
+
+#if defined(CONFIG_APP_FFT_CTRL)
+	if ((len >= sizeof(struct fft_ctrl_msg)) && (result->hdr.type == FFT_STREAM_MSG_CTRL)) {
+		ctrl_recv(data, len);
+		return;
+	}
+#endif
+
+#if defined(CONFIG_APP_FFT_EVENTS)
+	if ((len >= sizeof(result->hdr)) && (result->hdr.type == FFT_STREAM_MSG_EVENT) &&
+	    (result->hdr.count <= CONFIG_APP_FFT_TOP_BINS) &&
+	    (len == FFT_EVENT_MSG_SIZE(result->hdr.count))) {
+		event_recv(data);
+		return;
+	}
+#endif
+
+#if defined(CONFIG_APP_FFT_BANDS) || defined(CONFIG_APP_FFT_PIPELINE)
+	if ((len >= sizeof(result->hdr)) && (result->hdr.type == FFT_STREAM_MSG_BANDS) &&
+	    (result->hdr.count <= CONFIG_APP_FFT_BANDS_MAX) &&
+	    (len == FFT_BANDS_MSG_SIZE(result->hdr.count))) {
+		bands_recv(data);
+		return;
+	}
+#endif
+
+#if defined(CONFIG_APP_FFT_MEL)
+	if ((len >= sizeof(result->hdr)) && (result->hdr.type == FFT_STREAM_MSG_FEATURES) &&
+	    (result->hdr.count <= CONFIG_APP_FFT_MEL_FILTERS) &&
+	    (len == FFT_FEATURES_MSG_SIZE(result->hdr.count))) {
+		features_recv(data);
+		return;
+	}
+#endif
+
+#if defined(CONFIG_APP_FFT_TRACK)
+	if ((len >= sizeof(result->hdr)) && (result->hdr.type == FFT_STREAM_MSG_TRACK) &&
+	    (result->hdr.count <= CONFIG_APP_FFT_TOP_BINS) &&
+	    (len == FFT_TRACK_MSG_SIZE(result->hdr.count))) {
+		track_recv(data);
+		return;
+	}
+#endif
+
+#if defined(CONFIG_APP_FFT_SPECTROGRAM)
+	if ((len >= sizeof(result->hdr)) && (result->hdr.type == FFT_STREAM_MSG_SPECTROGRAM) &&
+	    (result->hdr.count != 0) &&
+	    (result->hdr.count <= CONFIG_APP_FFT_SPECTROGRAM_COLUMNS) &&
+	    (len == FFT_SPECTROGRAM_MSG_SIZE(result->hdr.count))) {
+		spectrogram_recv(data);
+		return;
+	}
+#endif
+
+#if defined(CONFIG_APP_FFT_COOP)
+	if ((len == sizeof(struct fft_coop_msg)) && (result->hdr.type == FFT_STREAM_MSG_COOP)) {
+		/* Not in the receive callback, the other messages keep coming. */
+		if (result->hdr.count == 0) {
+			atomic_set(&coop_withdrawn, result->hdr.seq);
+		}
+		if (k_msgq_put(&coop_requests, data, K_NO_WAIT) != 0) {
+			printk("coop %u dropped, queue full\n", result->hdr.seq);
+			return;
+		}
+		(void)k_work_submit(&coop_work);
+		return;
+	}
+#endif
+
+#if defined(CONFIG_APP_FFT_DUTY_CYCLE)
+	if ((len == sizeof(struct fft_clock_msg)) && (result->hdr.type == FFT_STREAM_MSG_CLOCK)) {
+		clock_recv(data);
+		return;
+	}
+#endif
+
+#if defined(CONFIG_APP_FFT_SHED)
+	if ((len == sizeof(struct fft_shed_msg)) && (result->hdr.type == FFT_STREAM_MSG_SHED)) {
+		shed_recv(data);
+		return;
+	}
+#endif
+
+#if defined(CONFIG_APP_FFT_STORE)
+	if ((len >= sizeof(result->hdr)) && (result->hdr.type == FFT_STREAM_MSG_STORE)) {
+		store_recv(data, len);
+		return;
+	}
+#endif
+
+	if ((len == sizeof(struct fft_profile_msg)) &&
+	    (result->hdr.type == FFT_STREAM_MSG_PROFILE)) {
+		profile_recv(data);
+		return;
+	}
+
+	if ((len == sizeof(result->hdr)) && (result->hdr.type == FFT_STREAM_MSG_FLOW)) {
+		atomic_set(&remote_paused, result->hdr.count != 0);
+		return;
+	}
+
+#if defined(CONFIG_APP_FFT_RETRANSMIT)
+	if ((len == sizeof(result->hdr)) && (result->hdr.type == FFT_STREAM_MSG_NACK)) {
+		/* Sent by stream_loop(), between the blocks. */
+		if (k_msgq_put(&resend_requests, &result->hdr, K_NO_WAIT) != 0) {
+			resends_dropped++;
+		}
+		return;
+	}
+#endif
+
+	if ((len != sizeof(*result)) || (result->hdr.type != FFT_STREAM_MSG_RESULT)) {
+		printk("Unexpected message type: %d, len: %d\n", *((uint8_t *)data), len);
+		return;
+	}
+
+#if defined(CONFIG_APP_FFT_SHM_POOL)
+	(void)k_msgq_put(&free_slots, &result->hdr.slot, K_NO_WAIT);
+#endif
+#if defined(CONFIG_APP_FFT_OFFLOAD)
+	atomic_dec(&remote_queued);
+#endif
+
+	frames_received++;
+
+#if defined(CONFIG_APP_FFT_LATENCY)
+	latency_recv(&result->times);
+#endif
+
+	result_deliver(result);
+}
+
+#if defined(CONFIG_APP_FFT_PRIO)
+/* Message waiting for the work queue of its class. */
+struct prio_msg {
+	void *fifo_reserved;
+	size_t len;
+	uint8_t data[];
+};
+
+/* Work queue of a priority class, and the messages it has to dispatch. */
+struct prio_class {
+	struct k_work_q wq;
+	struct k_work work;
+	struct k_fifo fifo;
+	struct k_heap heap;
+	atomic_t dropped;
+};
+
+static struct prio_class prio_classes[FFT_STREAM_NUM_CLASSES];
+static uint8_t prio_heap_mem[FFT_STREAM_NUM_CLASSES][CONFIG_APP_FFT_PRIO_HEAP_SIZE] __aligned(8);
+K_THREAD_STACK_ARRAY_DEFINE(prio_stacks, FFT_STREAM_NUM_CLASSES, CONFIG_APP_FFT_PRIO_STACK_SIZE);
+
+static const int prio_priorities[FFT_STREAM_NUM_CLASSES] = {
+	[FFT_STREAM_CLASS_ALARM] = CONFIG_APP_FFT_PRIO_ALARM_PRIORITY,
+	[FFT_STREAM_CLASS_RESULT] = CONFIG_APP_FFT_PRIO_RESULT_PRIORITY,
+	[FFT_STREAM_CLASS_BULK] = CONFIG_APP_FFT_PRIO_BULK_PRIORITY,
+};
+
+static const char *const prio_names[FFT_STREAM_NUM_CLASSES] = {
+	[FFT_STREAM_CLASS_ALARM] = "fft_alarm",
+	[FFT_STREAM_CLASS_RESULT] = "fft_result",
+	[FFT_STREAM_CLASS_BULK] = "fft_bulk",
+};
+
+static void prio_work_handler(struct k_work *work)
+{
+	struct prio_class *pc = CONTAINER_OF(work, struct prio_class, work);
+	struct prio_msg *msg;
+
+	while ((msg = k_fifo_get(&pc->fifo, K_NO_WAIT)) != NULL) {
+		msg_dispatch(msg->data, msg->len);
+		k_heap_free(&pc->heap, msg);
+	}
+}
+
+/* Start the work queues, before the endpoints can receive. */
+static void prio_start(void)
+{
+	for (int i = 0; i < FFT_STREAM_NUM_CLASSES; i++) {
+		struct prio_class *pc = &prio_classes[i];
+		struct k_work_queue_config cfg = {
+			.name = prio_names[i],
+		};
+
+		k_heap_init(&pc->heap, prio_heap_mem[i], sizeof(prio_heap_mem[i]));
+		k_fifo_init(&pc->fifo);
+		k_work_init(&pc->work, prio_work_handler);
+		k_work_queue_start(&pc->wq, prio_stacks[i], K_THREAD_STACK_SIZEOF(prio_stacks[i]),
+				   prio_priorities[i], &cfg);
+	}
+}
+
+/*
+ * Copy every message into the heap of its class and leave it to the work
+ * queue of the class, so a long spectrum or spectrogram in a low class
+ * never delays an event. A message that finds the heap full is dropped.
+ */
+static void ep_recv(const void *data, size_t len, void *priv)
+{
+	const struct fft_stream_hdr *hdr = data;
+	struct prio_class *pc;
+	struct prio_msg *msg;
+
+	ARG_UNUSED(priv);
+
+	if ((len < sizeof(*hdr)) || (hdr->type == FFT_STREAM_MSG_FLOW) ||
+	    (hdr->type == FFT_STREAM_MSG_SYNC) || (hdr->type == FFT_STREAM_MSG_NACK)) {
+		/* An atomic, a queue, or timed on arrival: dispatched here. */
+		msg_dispatch(data, len);
+		return;
+	}
+
+	pc = &prio_classes[fft_stream_msg_class(hdr->type)];
+	msg = k_heap_alloc(&pc->heap, sizeof(*msg) + len, K_NO_WAIT);
+	if (msg == NULL) {
+		atomic_inc(&pc->dropped);
+		return;
+	}
+
+	msg->len = len;
+	memcpy(msg->data, data, len);
+	k_fifo_put(&pc->fifo, msg);
+	(void)k_work_submit_to_queue(&pc->wq, &pc->work);
+}
+#endif /* CONFIG_APP_FFT_PRIO */
+#else
+#if defined(CONFIG_APP_IPC_SWEEP)
+static struct ipc_sweep sweep;
+
+static void ep_recv(const void *data, size_t len, void *priv)
+{
+	ARG_UNUSED(priv);
+
+	ipc_sweep_recv(&sweep, data, len);
+}
+#elif defined(CONFIG_APP_IPC_BENCH)
+static struct ipc_bench bench;
+static uint8_t bench_buf[CONFIG_APP_IPC_BENCH_MAX_LEN] __aligned(4);
+
+static void ep_recv(const void *data, size_t len, void *priv)
+{
+	ARG_UNUSED(priv);
+
+	ipc_bench_recv(&bench, data, len);
+}
+#else
+#if defined(CONFIG_APP_IPC_CREDIT)
+static struct ipc_credit credit_fc;
+#endif
+
+#if defined(CONFIG_APP_IPC_BATCH) || defined(CONFIG_APP_IPC_CREDIT)
+static void payload_recv(const void *data, size_t len, void *priv)
+#else
+static void ep_recv(const void *data, size_t len, void *priv)
+#endif
+{
+	uint8_t received_val = *((uint8_t *)data);
+	static uint8_t expected_val;
+
+#if defined(CONFIG_APP_IPC_TRACE)
+	ipc_trace_record(IPC_TRACE_RX, len, 0, 0);
+#endif
+
+	if ((received_val != expected_val) || (len != CONFIG_APP_IPC_SERVICE_MESSAGE_LEN)) {
+		printk("Unexpected message received_val: %d , expected_val: %d\n",
+			received_val,
+			expected_val);
+	}
+
+	expected_val++;
+
+#if defined(CONFIG_APP_IPC_TRACE)
+	if (len > offsetof(struct payload, data)) {
+		ipc_trace_peer_recv((const uint8_t *)data + offsetof(struct payload, data),
+				    len - offsetof(struct payload, data));
+	}
+#endif
+}
+
+#if defined(CONFIG_APP_IPC_BATCH)
+static void ep_recv(const void *data, size_t len, void *priv)
+{
+	if (ipc_batch_unpack(data, len, payload_recv, priv) < 0) {
+		printk("Malformed batch received, len: %d\n", len);
+	}
+}
+#elif defined(CONFIG_APP_IPC_CREDIT)
+static void ep_recv(const void *data, size_t len, void *priv)
+{
+	const void *payload;
+	size_t payload_len;
+	int ret;
+
+	ret = ipc_credit_recv(&credit_fc, data, len, &payload, &payload_len);
+	if (ret < 0) {
+		printk("Malformed message received, len: %d\n", len);
+		return;
+	}
+
+	if (ret > 0) {
+		payload_recv(payload, payload_len, priv);
+		ipc_credit_release(&credit_fc);
+	}
+}
+#endif
+#endif /* CONFIG_APP_IPC_SWEEP */
+#endif /* CONFIG_APP_FFT_STREAM */
+
+static struct ipc_ept_cfg ep_cfg = {
+	.name = "ep0",
+	.cb = {
+		.bound    = ep_bound,
+		.received = ep_recv,
+	},
+};
+
+#if defined(CONFIG_APP_FFT_CTRL_PLANE)
+/* Both endpoints share ep_recv(), every message carries its type. */
+static struct ipc_ept_cfg ctrl_ep_cfg = {
+	.name = "ctrl",
+	.cb = {
+		.bound    = ep_bound,
+		.received = ep_recv,
+	},
+};
+
+static int ctrl_plane_open(void)
+{
+	const struct device *ipc1_instance = DEVICE_DT_GET(DT_NODELABEL(ipc1));
+	int ret;
+
+	ret = ipc_service_open_instance(ipc1_instance);
+	if ((ret < 0) && (ret != -EALREADY)) {
+		LOG_INF("ipc_service_open_instance(ipc1) failure (%d)", ret);
+		return ret;
+	}
+
+	ret = ipc_service_register_endpoint(ipc1_instance, &ctrl_ep, &ctrl_ep_cfg);
+	if (ret < 0) {
+		printk("ipc_service_register_endpoint(ctrl) failure (%d)\n", ret);
+		return ret;
+	}
+
+	return 0;
+}
+#endif
+
+#if defined(CONFIG_APP_FFT_STREAM)
+static uint32_t blocks_sent;
+
+#if defined(CONFIG_APP_FFT_LATENCY)
+/* Percentiles since start, in place of the rates. */
+static void local_report(const struct shell *sh)
+{
+	uint32_t p50[LAT_NUM];
+	uint32_t p99[LAT_NUM];
+	uint32_t count;
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&lat_lock);
+	for (int i = 0; i < LAT_NUM; i++) {
+		p50[i] = latency_hist_percentile(&lat_hist[i], 500);
+		p99[i] = latency_hist_percentile(&lat_hist[i], 990);
+	}
+	count = lat_hist[LAT_TOTAL].count;
+	k_spin_unlock(&lat_lock, key);
+
+	report(sh, "Latency p50/p99 [us] over %u frames: total %u/%u | in %u/%u | "
+	       "queue %u/%u | fft %u/%u | out %u/%u",
+	       count, p50[LAT_TOTAL], p99[LAT_TOTAL], p50[LAT_IN], p99[LAT_IN],
+	       p50[LAT_QUEUE], p99[LAT_QUEUE], p50[LAT_FFT], p99[LAT_FFT],
+	       p50[LAT_OUT], p99[LAT_OUT]);
+	report(sh, "Clock offset: %d us, sync round trip: %u us", clock_offset, clock_rtt);
+#if defined(CONFIG_APP_FFT_FANOUT)
+	fanout_report(sh);
+#endif
+}
+
+static void check_task(void *arg1, void *arg2, void *arg3)
+{
+	ARG_UNUSED(arg1);
+	ARG_UNUSED(arg2);
+	ARG_UNUSED(arg3);
+
+#if defined(CONFIG_APP_FFT_PERF_SHELL)
+	/* Read with fft local instead. */
+	k_sleep(K_FOREVER);
+#endif
+
+	while (1) {
+		k_sleep(K_MSEC(1000));
+		local_report(NULL);
+	}
+}
+#else
+/* Of the last second. */
+static uint32_t blocks_rate;
+static uint32_t frames_rate;
+
+static void local_report(const struct shell *sh)
+{
+	report(sh, "Local blocks: %u/s (%u samples/blk) | frames: %u/s", blocks_rate,
+	       CONFIG_APP_FFT_BLOCK_SAMPLES, frames_rate);
+#if defined(CONFIG_APP_FFT_SHM_POOL)
+	report(sh, "Frames skipped, no free slot: %u", frames_skipped);
+#if defined(CONFIG_APP_FFT_OFFLOAD)
+	report(sh, "Frames analysed on the application core: %u", frames_local);
+#endif
+#else
+	if (blocks_held > 0) {
+		report(sh, "Blocks held back, remote core busy: %u", blocks_held);
+	}
+#endif
+#if defined(CONFIG_APP_FFT_RETRANSMIT)
+	report(sh, "Blocks resent: %u, deferred without room: %u, requests dropped: %u",
+	       blocks_resent, blocks_deferred, resends_dropped);
+#endif
+#if defined(CONFIG_APP_FFT_PRIO)
+	for (int i = 0; i < FFT_STREAM_NUM_CLASSES; i++) {
+		if (atomic_get(&prio_classes[i].dropped) > 0) {
+			report(sh, "Messages dropped, %s heap full: %ld", prio_names[i],
+			       atomic_get(&prio_classes[i].dropped));
+		}
+	}
+#endif
+#if defined(CONFIG_APP_FFT_FANOUT)
+	fanout_report(sh);
+#endif
+}
+
+static void check_task(void *arg1, void *arg2, void *arg3)
+{
+	ARG_UNUSED(arg1);
+	ARG_UNUSED(arg2);
+	ARG_UNUSED(arg3);
+
+	uint32_t last_blocks = blocks_sent;
+	uint32_t last_frames = frames_received;
+
+	while (1) {
+		k_sleep(K_MSEC(1000));
+
+		blocks_rate = blocks_sent - last_blocks;
+		frames_rate = frames_received - last_frames;
+#if !defined(CONFIG_APP_FFT_PERF_SHELL)
+		/* Read with fft local instead. */
+		local_report(NULL);
+#endif
+
+		last_blocks = blocks_sent;
+		last_frames = frames_received;
+	}
+}
+#endif /* CONFIG_APP_FFT_LATENCY */
+#else
+static void check_task(void *arg1, void *arg2, void *arg3)
+{
+	ARG_UNUSED(arg1);
+	ARG_UNUSED(arg2);
+	ARG_UNUSED(arg3);
+
+	unsigned long last_cnt = p_payload->cnt;
+	unsigned long delta;
+
+	while (1) {
+		k_sleep(K_MSEC(1000));
+
+		delta = p_payload->cnt - last_cnt;
+
+		printk("Local Δpkt: %ld (%ld B/pkt) | throughput: %ld bit/s\n",
+			delta, p_payload->size, delta * CONFIG_APP_IPC_SERVICE_MESSAGE_LEN * 8);
+#if defined(CONFIG_APP_IPC_TRACE)
+		ipc_trace_report("Local", p_payload->data);
+#endif
+
+		last_cnt = p_payload->cnt;
+	}
+}
+#endif /* CONFIG_APP_FFT_STREAM */
+
+K_THREAD_DEFINE(thread_check_id, STACKSIZE, check_task, NULL, NULL, NULL,
+		K_PRIO_COOP(1), 0, -1);
+
+#if defined(CONFIG_APP_FFT_STREAM)
+#if defined(CONFIG_APP_FFT_SAADC)
+/* The SAADC internal timer divides 16 MHz by 80 to 2047. */
+BUILD_ASSERT((16000000 / CONFIG_APP_FFT_SAMPLE_RATE >= 80) &&
+	     (16000000 / CONFIG_APP_FFT_SAMPLE_RATE <= 2047),
+	     "APP_FFT_SAMPLE_RATE out of the SAADC range");
+#else
+/* Duration of one sample block in microseconds. */
+#define BLOCK_PERIOD_US \
+	((uint64_t)CONFIG_APP_FFT_BLOCK_SAMPLES * 1000000U / CONFIG_APP_FFT_SAMPLE_RATE)
+
+static K_TIMER_DEFINE(block_timer, NULL, NULL);
+#endif
+
+#if defined(CONFIG_APP_FFT_PSD)
+/* Ask for the averaged power spectrum every APP_FFT_PSD_READ_INTERVAL_MS. */
+static int request_psd(struct ipc_ept *ep)
+{
+	static int64_t next_request = CONFIG_APP_FFT_PSD_READ_INTERVAL_MS;
+	static uint32_t seq;
+	struct fft_stream_hdr req = {
+		.type = FFT_STREAM_MSG_PSD_REQUEST,
+	};
+	int ret;
+
+	if (k_uptime_get() < next_request) {
+		return 0;
+	}
+
+	next_request += CONFIG_APP_FFT_PSD_READ_INTERVAL_MS;
+	req.seq = seq++;
+
+	do {
+		ret = ipc_service_send(ctrl_plane(ep), &req, sizeof(req));
+	} while (ret == -ENOMEM);
+
+	if (ret < 0) {
+		printk("send_message(psd request %u) failed with ret %d\n", req.seq, ret);
+		return ret;
+	}
+
+	return 0;
+}
+#endif
+
+#if defined(CONFIG_APP_FFT_PIPELINE)
+/*
+ * Set the chain of the remote core's analysis from the APP_FFT_PIPELINE_*
+ * options. Answered like a configuration, so it waits for config_pending.
+ */
+static int request_pipeline(struct ipc_ept *ep)
+{
+	struct fft_pipeline_msg req = {
+		.hdr.type = FFT_STREAM_MSG_PIPELINE,
+	};
+	uint16_t n = 0;
+	int ret;
+
+	if (IS_ENABLED(CONFIG_APP_FFT_PIPELINE_DC_BLOCK)) {
+		req.stages[n++].id = FFT_STAGE_DC_BLOCK;
+	}
+	req.stages[n].id = FFT_STAGE_WINDOW;
+	req.stages[n++].param = FFT_STREAM_WINDOW_HANN;
+	req.stages[n++].id = FFT_STAGE_FFT;
+	if (CONFIG_APP_FFT_PIPELINE_BANDS > 0) {
+		req.stages[n].id = FFT_STAGE_BANDS;
+		req.stages[n++].param = CONFIG_APP_FFT_PIPELINE_BANDS;
+	}
+	if (IS_ENABLED(CONFIG_APP_FFT_PSD)) {
+		/* The readouts of the average go on. */
+		req.stages[n++].id = FFT_STAGE_PSD;
+	}
+	req.stages[n++].id = FFT_STAGE_TOP_K;
+	req.stages[n++].id = FFT_STAGE_SEND_RESULT;
+	if (CONFIG_APP_FFT_PIPELINE_BANDS > 0) {
+		req.stages[n++].id = FFT_STAGE_SEND_BANDS;
+	}
+	req.hdr.count = n;
+	atomic_set(&config_pending, 1);
+
+	do {
+		ret = ipc_service_send(ctrl_plane(ep), &req, sizeof(req));
+	} while (ret == -ENOMEM);
+
+	if (ret < 0) {
+		printk("send_message(pipeline) failed with ret %d\n", ret);
+		return ret;
+	}
+
+	return 0;
+}
+#endif
+
+#if defined(CONFIG_APP_FFT_RECONFIG)
+/*
+ * Alternate the analysis between APP_FFT_FRAME_LEN and APP_FFT_RECONFIG_LEN
+ * every APP_FFT_RECONFIG_INTERVAL_MS, once the last request was answered.
+ */
+static int request_config(struct ipc_ept *ep)
+{
+	static int64_t next_request = CONFIG_APP_FFT_RECONFIG_INTERVAL_MS;
+	static uint32_t seq;
+	struct fft_config_msg req = {
+		.hdr.type = FFT_STREAM_MSG_CONFIG,
+		.window = FFT_STREAM_WINDOW_KEEP,
+	};
+	int ret;
+
+#if defined(CONFIG_APP_FFT_PIPELINE)
+	static bool pipeline_sent;
+
+	/* The chain first, the lengths alternate under it. */
+	if (!pipeline_sent) {
+		pipeline_sent = true;
+		return request_pipeline(ep);
+	}
+#endif
+
+	if ((k_uptime_get() < next_request) || atomic_get(&config_pending)) {
+		return 0;
+	}
+
+	next_request += CONFIG_APP_FFT_RECONFIG_INTERVAL_MS;
+	req.hdr.seq = seq++;
+	req.hdr.count = (frame_len == CONFIG_APP_FFT_FRAME_LEN) ?
+			CONFIG_APP_FFT_RECONFIG_LEN : CONFIG_APP_FFT_FRAME_LEN;
+	atomic_set(&config_pending, 1);
+
+	do {
+		ret = ipc_service_send(ctrl_plane(ep), &req, sizeof(req));
+	} while (ret == -ENOMEM);
+
+	if (ret < 0) {
+		printk("send_message(config %u) failed with ret %d\n", req.hdr.seq, ret);
+		return ret;
+	}
+
+	return 0;
+}
+#endif
+
+#if defined(CONFIG_APP_FFT_CTRL)
+/*
+ * Send a command without waiting for its response, which ep_recv() gets.
+ * -EBUSY while FFT_CTRL_MAX_PENDING are unanswered.
+ */
+static int ctrl_send(struct ipc_ept *ep, uint8_t cmd, uint32_t arg0, uint32_t arg1)
+{
+	/* The shell sends from a thread of its own. */
+	static atomic_t id;
+	struct fft_ctrl_msg msg = {
+		.type = FFT_STREAM_MSG_CTRL,
+		.version = FFT_CTRL_VERSION,
+		.cmd = cmd,
+		.arg = { arg0, arg1 },
+	};
+	int ret;
+
+	if (atomic_inc(&ctrl_in_flight) >= FFT_CTRL_MAX_PENDING) {
+		atomic_dec(&ctrl_in_flight);
+		return -EBUSY;
+	}
+
+	msg.id = (uint32_t)atomic_inc(&id);
+
+	do {
+		ret = ipc_service_send(ctrl_plane(ep), &msg, sizeof(msg));
+	} while (ret == -ENOMEM);
+
+	if (ret < 0) {
+		atomic_dec(&ctrl_in_flight);
+		printk("send_message(ctrl %u) failed with ret %d\n", msg.id, ret);
+		return ret;
+	}
+
+	return 0;
+}
+
+/* Ask for the stream statistics every APP_FFT_CTRL_STATS_INTERVAL_MS. */
+static int request_stats(struct ipc_ept *ep)
+{
+	static int64_t next_request = CONFIG_APP_FFT_CTRL_STATS_INTERVAL_MS;
+	int ret;
+
+	if ((CONFIG_APP_FFT_CTRL_STATS_INTERVAL_MS == 0) || (k_uptime_get() < next_request)) {
+		return 0;
+	}
+
+	next_request += CONFIG_APP_FFT_CTRL_STATS_INTERVAL_MS;
+
+	ret = ctrl_send(ep, FFT_CTRL_GET_STATS, 0, 0);
+#if defined(CONFIG_APP_FFT_PERF) && !defined(CONFIG_APP_FFT_PERF_SHELL)
+	if (ret == 0) {
+		ret = ctrl_send(ep, FFT_CTRL_GET_PERF, 0, 0);
+	}
+#endif
+
+	/* Asked again next time. */
+	return (ret == -EBUSY) ? 0 : ret;
+}
+#endif
+
+#if defined(CONFIG_APP_FFT_PERF_SHELL)
+/* How long a shell command waits for the remote core to answer. */
+#define QUERY_TIMEOUT K_MSEC(500)
+
+/* Endpoint of the stream, set before the shell may use it. */
+static struct ipc_ept *shell_ep;
+
+/* Send a command and wait for its response, in query_answer when 0 is returned. */
+static int query(const struct shell *sh, uint8_t cmd, uint32_t arg0)
+{
+	int ret;
+
+	if (shell_ep == NULL) {
+		shell_error(sh, "Remote core not bound yet");
+		return -EAGAIN;
+	}
+
+	k_sem_reset(&query_sem);
+	atomic_set(&query_cmd, cmd);
+
+	ret = ctrl_send(shell_ep, cmd, arg0, 0);
+	if (ret == 0) {
+		ret = k_sem_take(&query_sem, QUERY_TIMEOUT);
+	}
+	if (ret < 0) {
+		/* A response still on its way is printed on arrival. */
+		atomic_clear(&query_cmd);
+		shell_error(sh, "No response from the remote core (%d)", ret);
+		return ret;
+	}
+
+	if (query_answer.ctrl.status < 0) {
+		shell_error(sh, "Command %u failed on the remote core (%d)", cmd,
+			    query_answer.ctrl.status);
+		return query_answer.ctrl.status;
+	}
+
+	return 0;
+}
+
+static int cmd_fft_perf(const struct shell *sh, size_t argc, char **argv)
+{
+	bool restart = (argc > 1);
+	int ret;
+
+	if (restart && (strcmp(argv[1], "reset") != 0)) {
+		shell_error(sh, "Unknown argument %s", argv[1]);
+		return -EINVAL;
+	}
+
+	ret = query(sh, FFT_CTRL_GET_PERF, restart ? 1 : 0);
+	if (ret == 0) {
+		perf_report(sh, &query_answer.perf);
+	}
+
+	return ret;
+}
+
+static int cmd_fft_stats(const struct shell *sh, size_t argc, char **argv)
+{
+	int ret;
+
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	ret = query(sh, FFT_CTRL_GET_STATS, 0);
+	if (ret == 0) {
+		stats_report(sh, &query_answer.stats);
+	}
+
+	return ret;
+}
+
+static int cmd_fft_bench(const struct shell *sh, size_t argc, char **argv)
+{
+	int ret;
+
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	if (shell_ep == NULL) {
+		shell_error(sh, "Remote core not bound yet");
+		return -EAGAIN;
+	}
+
+	/* Runs for seconds, its response is printed on arrival. */
+	ret = ctrl_send(shell_ep, FFT_CTRL_RUN_BENCH, 0, 0);
+	if (ret < 0) {
+		shell_error(sh, "Benchmark not started (%d)", ret);
+		return ret;
+	}
+
+	shell_print(sh, "Benchmark started, its rows go to the console of the remote core");
+
+	return 0;
+}
+
+static int cmd_fft_local(const struct shell *sh, size_t argc, char **argv)
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	local_report(sh);
+
+	return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(fft_cmds,
+	SHELL_CMD_ARG(perf, NULL, "Performance counters of the remote core, "
+		      "then started over with reset", cmd_fft_perf, 1, 1),
+	SHELL_CMD(stats, NULL, "Stream statistics of the remote core", cmd_fft_stats),
+	SHELL_CMD(local, NULL, "Rates or latencies of this core", cmd_fft_local),
+	SHELL_CMD(bench, NULL, "Benchmark matrix on the remote core", cmd_fft_bench),
+	SHELL_SUBCMD_SET_END);
+
+SHELL_CMD_REGISTER(fft, &fft_cmds, "FFT stream counters", NULL);
+#endif
+
+#if defined(CONFIG_APP_FFT_EVENTS) && !defined(CONFIG_APP_FFT_SAADC)
+/* Move the test tone every APP_FFT_EVENT_TONE_INTERVAL_MS, a change to report. */
+static void event_tone_step(void)
+{
+	static int64_t next_step = CONFIG_APP_FFT_EVENT_TONE_INTERVAL_MS;
+	static bool moved;
+
+	if ((CONFIG_APP_FFT_EVENT_TONE_INTERVAL_MS == 0) || (k_uptime_get() < next_step)) {
+		return;
+	}
+
+	next_step += CONFIG_APP_FFT_EVENT_TONE_INTERVAL_MS;
+	moved = !moved;
+	sample_source_init(CONFIG_APP_FFT_SAMPLE_RATE,
+			   moved ? CONFIG_APP_FFT_EVENT_TONE_HZ : CONFIG_APP_FFT_TEST_TONE_HZ);
+}
+#endif
+
+#if defined(CONFIG_APP_FFT_ORDER)
+/* Angle of the generated shaft, 2^32 a revolution, and its advance per sample. */
+static uint32_t shaft_angle;
+static uint32_t shaft_step;
+
+/* Set the speed of the shaft over block seq, the test tone follows as its order. */
+static void shaft_speed(uint32_t seq)
+{
+	const uint64_t sweep = CONFIG_APP_FFT_ORDER_TEST_SWEEP_MS;
+	uint64_t ms = (uint64_t)seq * CONFIG_APP_FFT_BLOCK_SAMPLES * 1000U /
+		      CONFIG_APP_FFT_SAMPLE_RATE;
+	uint64_t t = ms % (2U * sweep);
+	uint64_t rpm;
+
+	/* Up from the lowest speed to the highest and back down. */
+	rpm = CONFIG_APP_FFT_ORDER_TEST_RPM_MIN +
+	      (uint64_t)(CONFIG_APP_FFT_ORDER_TEST_RPM_MAX - CONFIG_APP_FFT_ORDER_TEST_RPM_MIN) *
+	      MIN(t, 2U * sweep - t) / sweep;
+	shaft_step = (uint32_t)((rpm << 32) / (60U * CONFIG_APP_FFT_SAMPLE_RATE));
+
+	/* Both start at 0, so the tone stays at the order times the shaft angle. */
+	sample_source_set_step(shaft_step * CONFIG_APP_FFT_ORDER_TEST_ORDER);
+}
+
+/*
+ * Turn the shaft over block seq and send the pulses of the revolutions
+ * it completes in the block, at the fraction of a sample they fall on.
+ * The block is skipped without a pulse if ep is NULL.
+ */
+static int shaft_turn(struct ipc_ept *ep, uint32_t seq)
+{
+	static struct fft_tacho_msg msg;
+	const uint64_t end = (uint64_t)shaft_step * CONFIG_APP_FFT_BLOCK_SAMPLES;
+	uint32_t base = seq * CONFIG_APP_FFT_BLOCK_SAMPLES * 256U;
+	/* Angle to the next pulse, 0 right at the first sample. */
+	uint64_t to_pulse = (uint32_t)(0U - shaft_angle);
+	uint16_t count = 0;
+	int ret = 0;
+
+	shaft_angle += (uint32_t)end;
+
+	if ((ep == NULL) || (shaft_step == 0)) {
+		return 0;
+	}
+
+	for (; to_pulse < end; to_pulse += BIT64(32)) {
+		msg.pos[count++] = base + (uint32_t)((to_pulse << 8) / shaft_step);
+
+		if ((count == FFT_TACHO_MSG_PULSES) || (to_pulse + BIT64(32) >= end)) {
+			msg.hdr.type = FFT_STREAM_MSG_TACHO;
+			msg.hdr.count = count;
+			msg.hdr.seq = seq;
+
+			do {
+				ret = ipc_service_send(ep, &msg, FFT_TACHO_MSG_SIZE(count));
+			} while (ret == -ENOMEM);
+
+			if (ret < 0) {
+				printk("send_message(tacho %u) failed with ret %d\n", seq, ret);
+				return ret;
+			}
+			count = 0;
+		}
+	}
+
+	return 0;
+}
+#endif
+
+#if defined(CONFIG_APP_FFT_LATENCY)
+/* Sync the clock offset to the remote core once a second. */
+static int request_sync(struct ipc_ept *ep)
+{
+	static int64_t next_request;
+	static uint32_t seq;
+	struct fft_sync_msg req = {
+		.hdr.type = FFT_STREAM_MSG_SYNC,
+	};
+	int ret;
+
+	if (k_uptime_get() < next_request) {
+		return 0;
+	}
+
+	next_request += 1000;
+	req.hdr.seq = seq++;
+
+	do {
+		req.app_tx = now_us();
+		ret = ipc_service_send(ctrl_plane(ep), &req, sizeof(req));
+	} while (ret == -ENOMEM);
+
+	if (ret < 0) {
+		printk("send_message(sync %u) failed with ret %d\n", req.hdr.seq, ret);
+		return ret;
+	}
+
+	return 0;
+}
+#endif
+
+#if defined(CONFIG_APP_FFT_OFFLOAD)
+/*
+ * Whether the frame about to be sent is better analysed here: the remote
+ * core holds at least CONFIG_APP_FFT_OFFLOAD_DEPTH frames, this core has
+ * room for one more, and it would be done before the remote core got to
+ * the frame. The PLL clocks both cores, so the remote cycles convert at
+ * the clock of this one.
+ */
+static bool frame_offload(void)
+{
+	uint32_t queued = (uint32_t)atomic_get(&remote_queued);
+	uint32_t remote_us;
+
+	if ((queued < CONFIG_APP_FFT_OFFLOAD_DEPTH) || (k_msgq_num_free_get(&local_frames) == 0)) {
+		return false;
+	}
+
+	if ((remote_frame_cycles == 0) || (local_frame_us == 0)) {
+		/* No estimate yet, the depth decides. */
+		return true;
+	}
+
+	remote_us = remote_frame_cycles / (SystemCoreClock / USEC_PER_SEC);
+
+	return local_frame_us < (queued + 1U) * remote_us;
+}
+
+/* Analyse the frames frame_offload() kept back, at a lower priority than the stream. */
+static void local_task(void *arg1, void *arg2, void *arg3)
+{
+	static spectral_peak_t peaks[CONFIG_APP_FFT_TOP_BINS];
+	static struct fft_result_msg result;
+	static fft_context_t ctx;
+	struct local_frame frame;
+	rfft_status_t status;
+	uint32_t start;
+	uint32_t us;
+
+	ARG_UNUSED(arg1);
+	ARG_UNUSED(arg2);
+	ARG_UNUSED(arg3);
+
+	/* In place on the pool slot, as on the remote core. */
+	status = fft_context_init(&ctx, CONFIG_APP_FFT_FRAME_LEN, NULL, peaks,
+				  CONFIG_APP_FFT_TOP_BINS);
+	if (status != RFFT_SUCCESS) {
+		printk("fft_context_init(%u) failed with status: %d\n", CONFIG_APP_FFT_FRAME_LEN,
+		       status);
+		return;
+	}
+
+	result.hdr.type = FFT_STREAM_MSG_RESULT;
+
+	while (true) {
+		(void)k_msgq_get(&local_frames, &frame, K_FOREVER);
+
+		start = k_cycle_get_32();
+		status = fft_context_top_bins_inplace(&ctx, fft_pool_slot(frame.slot), result.bins,
+						      CONFIG_APP_FFT_TOP_BINS);
+		us = k_cyc_to_us_floor32(k_cycle_get_32() - start);
+
+		/* Average over about eight frames, the first one taken as is. */
+		local_frame_us = (local_frame_us == 0) ? us :
+				 local_frame_us - (local_frame_us >> 3) + (us >> 3);
+
+		result.hdr.slot = frame.slot;
+		result.hdr.seq = frame.seq;
+		result.hdr.count = (status == RFFT_SUCCESS) ? CONFIG_APP_FFT_TOP_BINS : 0;
+
+		(void)k_msgq_put(&free_slots, &frame.slot, K_NO_WAIT);
+		frames_local++;
+
+		result_deliver(&result);
+	}
+}
+
+K_THREAD_DEFINE(thread_local_id, 2 * STACKSIZE, local_task, NULL, NULL, NULL,
+		K_PRIO_PREEMPT(1), 0, 0);
+#endif
+
+#if defined(CONFIG_APP_FFT_SHM_POOL)
+/* Hand a filled pool slot to the remote core, or with CONFIG_APP_FFT_OFFLOAD maybe to this one. */
+static int frame_send(struct ipc_ept *ep, const struct fft_stream_hdr *desc)
+{
+	int ret;
+
+#if defined(CONFIG_APP_FFT_OFFLOAD)
+	if (frame_offload()) {
+		struct local_frame frame = {
+			.seq = desc->seq,
+			.slot = desc->slot,
+		};
+
+		if (k_msgq_put(&local_frames, &frame, K_NO_WAIT) == 0) {
+			return 0;
+		}
+	}
+#endif
+
+#if defined(CONFIG_APP_FFT_OFFLOAD)
+	/* Counted before the send, the answer may come back before it returns. */
+	atomic_inc(&remote_queued);
+#endif
+
+	do {
+		ret = ipc_service_send(ep, desc, sizeof(*desc));
+	} while (ret == -ENOMEM);
+
+	if (ret < 0) {
+#if defined(CONFIG_APP_FFT_OFFLOAD)
+		atomic_dec(&remote_queued);
+#endif
+		printk("send_message(%u) failed with ret %d\n", desc->seq, ret);
+		return ret;
+	}
+
+	return 0;
+}
+#endif
+
+#if defined(CONFIG_APP_FFT_SAADC) && defined(CONFIG_APP_FFT_SHM_POOL)
+/* Index of the pool slot a frame buffer lies in. */
+static uint8_t pool_slot_of(const int16_t *frame)
+{
+	return (uint8_t)(((uintptr_t)frame - FFT_POOL_ADDR) / FFT_POOL_SLOT_SIZE);
+}
+
+/* Let the SAADC fill pool slots by DMA and send only their descriptors. */
+static int stream_loop(struct ipc_ept *ep)
+{
+	struct fft_stream_hdr desc = {
+		.type = FFT_STREAM_MSG_FRAME,
+		.count = CONFIG_APP_FFT_FRAME_LEN,
+	};
+	uint32_t queued = 0;
+	uint32_t seq = 0;
+	int16_t *frame;
+	uint8_t slot;
+	int ret;
+
+	for (slot = 0; slot < FFT_POOL_NUM_SLOTS; slot++) {
+		(void)k_msgq_put(&free_slots, &slot, K_NO_WAIT);
+	}
+
+	/* Ping-pong: one slot being filled, the next one already queued. */
+	while ((queued < 2) && (k_msgq_get(&free_slots, &slot, K_NO_WAIT) == 0)) {
+		saadc_source_queue(fft_pool_slot(slot));
+		queued++;
+	}
+
+	ret = saadc_source_start(CONFIG_APP_FFT_SAMPLE_RATE, CONFIG_APP_FFT_FRAME_LEN);
+	if (ret < 0) {
+		printk("saadc_source_start() failed with ret %d\n", ret);
+		return ret;
+	}
+
+	while (true) {
+		ret = saadc_source_wait(&frame, K_FOREVER);
+
+		if (ret == 0) {
+			stamp_capture(seq);
+			queued--;
+			fft_cache_flush(frame, FFT_POOL_SLOT_SIZE);
+
+			desc.slot = pool_slot_of(frame);
+			desc.seq = seq;
+
+			ret = frame_send(ep, &desc);
+			if (ret < 0) {
+				return ret;
+			}
+		} else {
+			/* Remote core is behind, the frame went to the drop buffer. */
+			frames_skipped++;
+		}
+
+		seq++;
+		blocks_sent += CONFIG_APP_FFT_FRAME_LEN / CONFIG_APP_FFT_BLOCK_SAMPLES;
+
+		/* Refill the DMA queue with the slots the remote core returned. */
+		while ((queued < 2) && (k_msgq_get(&free_slots, &slot, K_NO_WAIT) == 0)) {
+			saadc_source_queue(fft_pool_slot(slot));
+			queued++;
+		}
+
+#if defined(CONFIG_APP_FFT_PSD)
+		ret = request_psd(ep);
+		if (ret < 0) {
+			return ret;
+		}
+#endif
+
+#if defined(CONFIG_APP_FFT_LATENCY)
+		ret = request_sync(ep);
+		if (ret < 0) {
+			return ret;
+		}
+#endif
+	}
+
+	return 0;
+}
+#elif defined(CONFIG_APP_FFT_SAADC)
+/* Let the SAADC fill the sample blocks by DMA and send them as they complete. */
+static int stream_loop(struct ipc_ept *ep)
+{
+	static union {
+		struct fft_sample_block blk;
+		uint8_t raw[FFT_SAMPLE_BLOCK_SIZE(CONFIG_APP_FFT_BLOCK_SAMPLES)];
+	} msg[2] __aligned(4);
+	struct fft_sample_block *blk;
+	uint32_t seq = 0;
+	int16_t *samples;
+	int ret;
+
+	saadc_source_queue(msg[0].blk.samples);
+	saadc_source_queue(msg[1].blk.samples);
+
+	ret = saadc_source_start(CONFIG_APP_FFT_SAMPLE_RATE, CONFIG_APP_FFT_BLOCK_SAMPLES);
+	if (ret < 0) {
+		printk("saadc_source_start() failed with ret %d\n", ret);
+		return ret;
+	}
+
+	while (true) {
+		ret = saadc_source_wait(&samples, K_FOREVER);
+		if (ret < 0) {
+			/* Only if this thread fell a whole block behind. */
+			printk("SAADC block %u dropped\n", seq++);
+			continue;
+		}
+
+		stamp_capture(seq);
+
+		if (atomic_get(&remote_paused)) {
+			/* The block would be dropped, the sequence gap tells the remote core. */
+			saadc_source_queue(samples);
+			seq++;
+			blocks_held++;
+			continue;
+		}
+
+		blk = (samples == msg[0].blk.samples) ? &msg[0].blk : &msg[1].blk;
+		blk->hdr.type = FFT_STREAM_MSG_SAMPLES;
+		blk->hdr.count = CONFIG_APP_FFT_BLOCK_SAMPLES;
+		blk->hdr.seq = seq;
+
+		do {
+			ret = ipc_service_send(ep, blk,
+					       FFT_SAMPLE_BLOCK_SIZE(CONFIG_APP_FFT_BLOCK_SAMPLES));
+		} while (ret == -ENOMEM);
+
+		/* The transport copied the block, DMA may fill it again. */
+		saadc_source_queue(samples);
+
+		if (ret < 0) {
+			printk("send_message(%u) failed with ret %d\n", seq, ret);
+			return ret;
+		}
+
+		seq++;
+		blocks_sent++;
+
+#if defined(CONFIG_APP_FFT_PSD)
+		ret = request_psd(ep);
+		if (ret < 0) {
+			return ret;
+		}
+#endif
+
+#if defined(CONFIG_APP_FFT_RECONFIG)
+		ret = request_config(ep);
+		if (ret < 0) {
+			return ret;
+		}
+#endif
+
+#if defined(CONFIG_APP_FFT_CTRL)
+		ret = request_stats(ep);
+		if (ret < 0) {
+			return ret;
+		}
+#endif
+
+#if defined(CONFIG_APP_FFT_LATENCY)
+		ret = request_sync(ep);
+		if (ret < 0) {
+			return ret;
+		}
+#endif
+	}
+
+	return 0;
+}
+#elif defined(CONFIG_APP_FFT_SHM_POOL)
+/* Acquire frames straight into the shared pool and send only their descriptors. */
+static int stream_loop(struct ipc_ept *ep)
+{
+	static int16_t discard[CONFIG_APP_FFT_BLOCK_SAMPLES];
+	struct fft_stream_hdr desc = {
+		.type = FFT_STREAM_MSG_FRAME,
+		.count = CONFIG_APP_FFT_FRAME_LEN,
+	};
+	int16_t *frame = NULL;
+	uint32_t fill_pos = 0;
+	uint32_t seq = 0;
+	uint8_t slot;
+	int ret;
+
+	for (slot = 0; slot < FFT_POOL_NUM_SLOTS; slot++) {
+		(void)k_msgq_put(&free_slots, &slot, K_NO_WAIT);
+	}
+
+	sample_source_init(CONFIG_APP_FFT_SAMPLE_RATE, CONFIG_APP_FFT_TEST_TONE_HZ);
+
+	k_timer_start(&block_timer, K_USEC(BLOCK_PERIOD_US), K_USEC(BLOCK_PERIOD_US));
+
+	while (true) {
+		if (fill_pos == 0) {
+			if (k_msgq_get(&free_slots, &slot, K_NO_WAIT) == 0) {
+				frame = fft_pool_slot(slot);
+			} else {
+				/* Remote core is behind, skip this frame's worth of samples. */
+				frames_skipped++;
+			}
+		}
+
+		sample_source_read((frame != NULL) ? &frame[fill_pos] : discard,
+				   CONFIG_APP_FFT_BLOCK_SAMPLES);
+		fill_pos += CONFIG_APP_FFT_BLOCK_SAMPLES;
+		blocks_sent++;
+
+#if defined(CONFIG_APP_FFT_PSD)
+		ret = request_psd(ep);
+		if (ret < 0) {
+			return ret;
+		}
+#endif
+
+#if defined(CONFIG_APP_FFT_LATENCY)
+		ret = request_sync(ep);
+		if (ret < 0) {
+			return ret;
+		}
+#endif
+
+		if (fill_pos == CONFIG_APP_FFT_FRAME_LEN) {
+			fill_pos = 0;
+
+			if (frame != NULL) {
+				stamp_capture(seq);
+				fft_cache_flush(frame, FFT_POOL_SLOT_SIZE);
+
+				desc.slot = slot;
+				desc.seq = seq;
+
+				ret = frame_send(ep, &desc);
+				if (ret < 0) {
+					return ret;
+				}
+
+				frame = NULL;
+			}
+
+			seq++;
+		}
+
+		k_timer_status_sync(&block_timer);
+	}
+
+	return 0;
+}
+#elif defined(CONFIG_APP_FFT_SHM_RING)
+BUILD_ASSERT(FFT_RING_NUM_SLOTS >= 2, "fft_pool cannot hold a ring of sample blocks");
+
+static const struct mbox_dt_spec ring_doorbell = MBOX_DT_SPEC_GET(DT_PATH(zephyr_user), fft_ring);
+static struct shm_ring sample_ring;
+
+/* Generate the sample stream in place in the slots of the shared ring. */
+static int stream_loop(struct ipc_ept *ep)
+{
+	struct fft_sample_block *blk;
+	uint32_t seq = 0;
+	int ret;
+
+	sample_source_init(CONFIG_APP_FFT_SAMPLE_RATE, CONFIG_APP_FFT_TEST_TONE_HZ);
+
+	k_timer_start(&block_timer, K_USEC(BLOCK_PERIOD_US), K_USEC(BLOCK_PERIOD_US));
+
+	while (true) {
+		blk = shm_ring_reserve(&sample_ring);
+		if (blk == NULL) {
+			/* Remote core is behind, the sequence gap tells it. */
+			sample_source_skip(CONFIG_APP_FFT_BLOCK_SAMPLES);
+			blocks_held++;
+		} else {
+			blk->hdr.type = FFT_STREAM_MSG_SAMPLES;
+			blk->hdr.count = CONFIG_APP_FFT_BLOCK_SAMPLES;
+			blk->hdr.seq = seq;
+			sample_source_read(blk->samples, CONFIG_APP_FFT_BLOCK_SAMPLES);
+			stamp_capture(seq);
+
+			ret = shm_ring_commit(&sample_ring);
+			if (ret < 0) {
+				printk("mbox_send_dt(%u) failed with ret %d\n", seq, ret);
+				return ret;
+			}
+
+			blocks_sent++;
+		}
+
+		seq++;
+
+#if defined(CONFIG_APP_FFT_PSD)
+		ret = request_psd(ep);
+		if (ret < 0) {
+			return ret;
+		}
+#endif
+
+#if defined(CONFIG_APP_FFT_RECONFIG)
+		ret = request_config(ep);
+		if (ret < 0) {
+			return ret;
+		}
+#endif
 
-LOG_MODULE_REGISTER(host, LOG_LEVEL_INF);
+#if defined(CONFIG_APP_FFT_CTRL)
+		ret = request_stats(ep);
+		if (ret < 0) {
+			return ret;
+		}
+#endif
 
-struct payload {
-	unsigned long cnt;
-	unsigned long size;
-	uint8_t data[];
-};
+#if defined(CONFIG_APP_FFT_EVENTS)
+		event_tone_step();
+#endif
 
-struct payload *p_payload;
+#if defined(CONFIG_APP_FFT_LATENCY)
+		ret = request_sync(ep);
+		if (ret < 0) {
+			return ret;
+		}
+#endif
 
-static K_SEM_DEFINE(bound_sem, 0, 1);
+		/* Wait until the next block worth of samples has been "acquired". */
+		k_timer_status_sync(&block_timer);
+	}
 
-static void ep_bound(void *priv)
+	return 0;
+}
+#elif defined(CONFIG_APP_IPC_NOCOPY)
+/* Generate the sample stream in the transmit buffers of the backend. */
+static int stream_loop(struct ipc_ept *ep)
 {
-	k_sem_give(&bound_sem);
+	const uint32_t len = FFT_SAMPLE_BLOCK_SIZE(CONFIG_APP_FFT_BLOCK_SAMPLES);
+	struct fft_sample_block *blk;
+	uint32_t size;
+	uint32_t seq = 0;
+	int ret;
+
+	sample_source_init(CONFIG_APP_FFT_SAMPLE_RATE, CONFIG_APP_FFT_TEST_TONE_HZ);
+
+	k_timer_start(&block_timer, K_USEC(BLOCK_PERIOD_US), K_USEC(BLOCK_PERIOD_US));
+
+	while (true) {
+		if (atomic_get(&remote_paused)) {
+			/* The block would be dropped, the sequence gap tells the remote core. */
+			sample_source_skip(CONFIG_APP_FFT_BLOCK_SAMPLES);
+			seq++;
+			blocks_held++;
+			k_timer_status_sync(&block_timer);
+			continue;
+		}
+
+		/* Waits for the remote core to release blocks, no -ENOMEM to spin on. */
+		size = len;
+		ret = ipc_service_get_tx_buffer(ep, (void **)&blk, &size, K_FOREVER);
+		if (ret < 0) {
+			printk("ipc_service_get_tx_buffer(%u) failed with ret %d\n", seq, ret);
+			return ret;
+		}
+
+		blk->hdr.type = FFT_STREAM_MSG_SAMPLES;
+		blk->hdr.count = CONFIG_APP_FFT_BLOCK_SAMPLES;
+		blk->hdr.seq = seq;
+		sample_source_read(blk->samples, CONFIG_APP_FFT_BLOCK_SAMPLES);
+		stamp_capture(seq);
+
+		ret = ipc_service_send_nocopy(ep, blk, len);
+		if (ret < 0) {
+			(void)ipc_service_drop_tx_buffer(ep, blk);
+			printk("send_message(%u) failed with ret %d\n", seq, ret);
+			return ret;
+		}
+
+		seq++;
+		blocks_sent++;
+
+#if defined(CONFIG_APP_FFT_PSD)
+		ret = request_psd(ep);
+		if (ret < 0) {
+			return ret;
+		}
+#endif
+
+#if defined(CONFIG_APP_FFT_RECONFIG)
+		ret = request_config(ep);
+		if (ret < 0) {
+			return ret;
+		}
+#endif
+
+#if defined(CONFIG_APP_FFT_CTRL)
+		ret = request_stats(ep);
+		if (ret < 0) {
+			return ret;
+		}
+#endif
+
+#if defined(CONFIG_APP_FFT_EVENTS)
+		event_tone_step();
+#endif
+
+#if defined(CONFIG_APP_FFT_LATENCY)
+		ret = request_sync(ep);
+		if (ret < 0) {
+			return ret;
+		}
+#endif
+
+		/* Wait until the next block worth of samples has been "acquired". */
+		k_timer_status_sync(&block_timer);
+	}
+
+	return 0;
+}
+#else
+#if defined(CONFIG_APP_FFT_RETRANSMIT)
+/*
+ * Send the blocks the remote core asked for again, as far as they are
+ * still in the window, up to one that finds no room, which waits for the
+ * next block period. Blocks skipped while the remote core was paused are
+ * marked as not in the window.
+ */
+static int resend_blocks(struct ipc_ept *ep, uint32_t next_seq)
+{
+	static struct fft_stream_hdr req;
+	struct fft_sample_block *blk;
+	int ret;
+
+	while (true) {
+		if ((req.count == 0) && (k_msgq_get(&resend_requests, &req, K_NO_WAIT) != 0)) {
+			return 0;
+		}
+
+		if ((int32_t)(next_seq - req.seq) <= 0) {
+			/* Not sent yet, nothing to send again. */
+			req.count = 0;
+			continue;
+		}
+
+		if (next_seq - req.seq > CONFIG_APP_FFT_RETRANSMIT_WINDOW) {
+			/* Overwritten by now. */
+			uint32_t gone = MIN(next_seq - CONFIG_APP_FFT_RETRANSMIT_WINDOW - req.seq,
+					    req.count);
+
+			req.seq += gone;
+			req.count -= gone;
+			continue;
+		}
+
+		blk = resend_slot(req.seq);
+		if (blk->hdr.type == FFT_STREAM_MSG_SAMPLES) {
+			ret = ipc_service_send(ep, blk,
+					       FFT_SAMPLE_BLOCK_SIZE(CONFIG_APP_FFT_BLOCK_SAMPLES));
+			if (ret == -ENOMEM) {
+				return 0;
+			}
+			if (ret < 0) {
+				printk("send_message(resend %u) failed with ret %d\n", req.seq, ret);
+				return ret;
+			}
+			blocks_resent++;
+		}
+
+		req.seq++;
+		req.count--;
+	}
 }
+#endif
 
-static void ep_recv(const void *data, size_t len, void *priv)
+/* Send the sample stream to the remote core in real time. */
+static int stream_loop(struct ipc_ept *ep)
 {
-	uint8_t received_val = *((uint8_t *)data);
-	static uint8_t expected_val;
+#if defined(CONFIG_APP_FFT_RETRANSMIT)
+	struct fft_sample_block *blk;
+#elif defined(CONFIG_APP_FFT_INPUT_Q7)
+	/* Half the bytes of a block of Q15 samples. */
+	static union {
+		struct fft_sample_block_q7 blk;
+		uint8_t raw[FFT_SAMPLE_BLOCK_Q7_SIZE(CONFIG_APP_FFT_BLOCK_SAMPLES)];
+	} msg;
+	struct fft_sample_block_q7 *blk = &msg.blk;
+#else
+	static union {
+		struct fft_sample_block blk;
+		uint8_t raw[FFT_SAMPLE_BLOCK_SIZE(CONFIG_APP_FFT_BLOCK_SAMPLES)];
+	} msg;
+	struct fft_sample_block *blk = &msg.blk;
+#endif
+	uint32_t seq = 0;
+	int ret;
+
+#if defined(CONFIG_APP_FFT_RETRANSMIT)
+	/* No block in the window yet, whatever the pool holds. */
+	for (uint32_t i = 0; i < CONFIG_APP_FFT_RETRANSMIT_WINDOW; i++) {
+		resend_slot(i)->hdr.type = 0;
+	}
+#endif
 
+	sample_source_init(CONFIG_APP_FFT_SAMPLE_RATE, CONFIG_APP_FFT_TEST_TONE_HZ);
 
-	if ((received_val != expected_val) || (len != CONFIG_APP_IPC_SERVICE_MESSAGE_LEN)) {
-		printk("Unexpected message received_val: %d , expected_val: %d\n",
-			received_val,
-			expected_val);
+	k_timer_start(&block_timer, K_USEC(BLOCK_PERIOD_US), K_USEC(BLOCK_PERIOD_US));
+
+	while (true) {
+		if (atomic_get(&remote_paused)) {
+			/* The block would be dropped, the sequence gap tells the remote core. */
+#if defined(CONFIG_APP_FFT_ORDER)
+			shaft_speed(seq);
+			(void)shaft_turn(NULL, seq);
+#endif
+			sample_source_skip(CONFIG_APP_FFT_BLOCK_SAMPLES);
+#if defined(CONFIG_APP_FFT_RETRANSMIT)
+			/* Not to be sent again either. */
+			resend_slot(seq)->hdr.type = 0;
+#endif
+			seq++;
+			blocks_held++;
+			k_timer_status_sync(&block_timer);
+			continue;
+		}
+
+#if defined(CONFIG_APP_FFT_RETRANSMIT)
+		/* The blocks asked for again go first, they are older. */
+		ret = resend_blocks(ep, seq);
+		if (ret < 0) {
+			return ret;
+		}
+
+		/* Built in the window, where it stays to be sent again. */
+		blk = resend_slot(seq);
+#endif
+#if defined(CONFIG_APP_FFT_INPUT_Q7)
+		blk->hdr.type = FFT_STREAM_MSG_SAMPLES_Q7;
+#else
+		blk->hdr.type = FFT_STREAM_MSG_SAMPLES;
+#endif
+		blk->hdr.count = CONFIG_APP_FFT_BLOCK_SAMPLES;
+		blk->hdr.seq = seq;
+#if defined(CONFIG_APP_FFT_ORDER)
+		shaft_speed(seq);
+#endif
+#if defined(CONFIG_APP_FFT_INPUT_Q7)
+		sample_source_read_q7(blk->samples, CONFIG_APP_FFT_BLOCK_SAMPLES);
+#else
+		sample_source_read(blk->samples, CONFIG_APP_FFT_BLOCK_SAMPLES);
+#endif
+		stamp_capture(seq);
+
+#if defined(CONFIG_APP_FFT_RETRANSMIT)
+		ret = ipc_service_send(ep, blk, FFT_SAMPLE_BLOCK_SIZE(CONFIG_APP_FFT_BLOCK_SAMPLES));
+		if (ret == -ENOMEM) {
+			/* No spinning, the remote core asks for it once the next block lands. */
+			blocks_deferred++;
+			ret = 0;
+		}
+#else
+		do {
+			ret = ipc_service_send(ep, blk, sizeof(msg));
+		} while (ret == -ENOMEM);
+#endif
+
+		if (ret < 0) {
+			printk("send_message(%u) failed with ret %d\n", seq, ret);
+			return ret;
+		}
+
+#if defined(CONFIG_APP_FFT_ORDER)
+		/* After the block, which the remote core may resample up to its pulses. */
+		ret = shaft_turn(ep, seq);
+		if (ret < 0) {
+			return ret;
+		}
+#endif
+
+		seq++;
+		blocks_sent++;
+
+#if defined(CONFIG_APP_FFT_PSD)
+		ret = request_psd(ep);
+		if (ret < 0) {
+			return ret;
+		}
+#endif
+
+#if defined(CONFIG_APP_FFT_RECONFIG)
+		ret = request_config(ep);
+		if (ret < 0) {
+			return ret;
+		}
+#endif
+
+#if defined(CONFIG_APP_FFT_CTRL)
+		ret = request_stats(ep);
+		if (ret < 0) {
+			return ret;
+		}
+#endif
+
+#if defined(CONFIG_APP_FFT_EVENTS)
+		event_tone_step();
+#endif
+
+#if defined(CONFIG_APP_FFT_LATENCY)
+		ret = request_sync(ep);
+		if (ret < 0) {
+			return ret;
+		}
+#endif
+
+		/* Wait until the next block worth of samples has been "acquired". */
+		k_timer_status_sync(&block_timer);
 	}
 
-	expected_val++;
+	return 0;
 }
+#endif /* CONFIG_APP_FFT_SAADC, CONFIG_APP_FFT_SHM_POOL, CONFIG_APP_FFT_SHM_RING, CONFIG_APP_IPC_NOCOPY */
+#endif /* CONFIG_APP_FFT_STREAM */
 
-static struct ipc_ept_cfg ep_cfg = {
-	.name = "ep0",
-	.cb = {
-		.bound    = ep_bound,
-		.received = ep_recv,
-	},
-};
+#if defined(CONFIG_APP_IPC_BATCH)
+/* Send the test payload as records packed into batched transfers. */
+static int batch_loop(struct ipc_ept *ep)
+{
+	static uint8_t batch_buf[CONFIG_APP_IPC_BATCH_SIZE] __aligned(IPC_BATCH_ALIGN);
+	static struct ipc_batch batch;
+	uint32_t retries = 0;
+	int ret;
 
-static void check_task(void *arg1, void *arg2, void *arg3)
+	ret = ipc_batch_init(&batch, ep, batch_buf, sizeof(batch_buf),
+			     CONFIG_APP_IPC_BATCH_FLUSH_THRESHOLD,
+			     K_USEC(CONFIG_APP_IPC_BATCH_TIMEOUT_US));
+	if (ret < 0) {
+		printk("ipc_batch_init() failure (%d)\n", ret);
+		return ret;
+	}
+
+	while (true) {
+		ret = ipc_batch_add(&batch, p_payload, CONFIG_APP_IPC_SERVICE_MESSAGE_LEN);
+		if (ret == -ENOMEM) {
+			/* Transport full. Sleep instead of spinning until it drains. */
+			retries++;
+			k_sleep(K_TICKS(1));
+			continue;
+		} else if (ret < 0) {
+			printk("send_message(%ld) failed with ret %d\n", p_payload->cnt, ret);
+			return ret;
+		}
+
+#if defined(CONFIG_APP_IPC_TRACE)
+		/* Records waiting in the batch. */
+		ipc_trace_record(IPC_TRACE_TX, CONFIG_APP_IPC_SERVICE_MESSAGE_LEN, retries,
+				 (batch.used - sizeof(struct ipc_batch_hdr)) /
+				 IPC_BATCH_RECORD_SIZE(CONFIG_APP_IPC_SERVICE_MESSAGE_LEN));
+#endif
+		retries = 0;
+
+		p_payload->cnt++;
+	}
+
+	return 0;
+}
+#endif /* CONFIG_APP_IPC_BATCH */
+
+#if defined(CONFIG_APP_IPC_CREDIT)
+/* Send the test payload as fast as the receiver hands back credits. */
+static int credit_loop(void)
 {
-	ARG_UNUSED(arg1);
-	ARG_UNUSED(arg2);
-	ARG_UNUSED(arg3);
+	static uint8_t msg[sizeof(struct ipc_credit_hdr) + CONFIG_APP_IPC_SERVICE_MESSAGE_LEN]
+		__aligned(4);
+	uint32_t retries = 0;
+	int ret;
 
-	unsigned long last_cnt = p_payload->cnt;
-	unsigned long delta;
+	while (true) {
+		memcpy(&msg[sizeof(struct ipc_credit_hdr)], p_payload,
+		       CONFIG_APP_IPC_SERVICE_MESSAGE_LEN);
 
-	while (1) {
-		k_sleep(K_MSEC(1000));
+		ret = ipc_credit_send(&credit_fc, msg, sizeof(msg), K_FOREVER);
+		if (ret == -ENOMEM) {
+			/* Window larger than the backend buffers. */
+			retries++;
+			k_sleep(K_TICKS(1));
+			continue;
+		} else if (ret < 0) {
+			printk("send_message(%ld) failed with ret %d\n", p_payload->cnt, ret);
+			return ret;
+		}
 
-		delta = p_payload->cnt - last_cnt;
+#if defined(CONFIG_APP_IPC_TRACE)
+		/* Messages in flight, the credits spent. */
+		ipc_trace_record(IPC_TRACE_TX, CONFIG_APP_IPC_SERVICE_MESSAGE_LEN, retries,
+				 CONFIG_APP_IPC_CREDIT_WINDOW - k_sem_count_get(&credit_fc.credits));
+#endif
+		retries = 0;
 
-		printk("Local Δpkt: %ld (%ld B/pkt) | throughput: %ld bit/s\n",
-			delta, p_payload->size, delta * CONFIG_APP_IPC_SERVICE_MESSAGE_LEN * 8);
+		p_payload->cnt++;
+	}
 
-		last_cnt = p_payload->cnt;
+	return 0;
+}
+#endif /* CONFIG_APP_IPC_CREDIT */
+
+#if defined(CONFIG_APP_IPC_SWEEP)
+/* Sweep the message sizes up to the largest the backend takes. */
+static int sweep_loop(struct ipc_ept *ep)
+{
+	static uint8_t sweep_buf[CONFIG_APP_IPC_SWEEP_MAX_LEN] __aligned(4);
+	size_t max_len = sizeof(sweep_buf);
+	int ret;
+
+	/* icbmsg tells its largest transmit buffer, icmsg does not. */
+	ret = ipc_service_get_tx_buffer_size(ep);
+	if (ret >= IPC_SWEEP_MIN_LEN) {
+		max_len = MIN(max_len, (size_t)ret);
 	}
+
+	return ipc_sweep_run(&sweep, sweep_buf, max_len,
+			     IS_ENABLED(CONFIG_IPC_SERVICE_BACKEND_ICBMSG) ? "icbmsg" : "icmsg");
 }
+#endif /* CONFIG_APP_IPC_SWEEP */
 
-K_THREAD_DEFINE(thread_check_id, STACKSIZE, check_task, NULL, NULL, NULL,
-		K_PRIO_COOP(1), 0, -1);
+#if defined(CONFIG_APP_IPC_BENCH)
+/* Every transport and size, once the remote core answers. */
+static int bench_loop(struct ipc_ept *ep)
+{
+	size_t max_len = sizeof(bench_buf);
+	int ret;
+
+	ret = ipc_bench_start(&bench);
+	if (ret < 0) {
+		printk("ipc_bench_start() failure (%d)\n", ret);
+		return ret;
+	}
+
+	/* icbmsg tells its largest transmit buffer, icmsg does not. */
+	ret = ipc_service_get_tx_buffer_size(ep);
+	if (ret >= IPC_BENCH_MIN_LEN) {
+		max_len = MIN(max_len, (size_t)ret);
+	}
+
+	return ipc_bench_run(&bench, max_len,
+			     IS_ENABLED(CONFIG_IPC_SERVICE_BACKEND_ICBMSG) ? "icbmsg" : "icmsg");
+}
+#endif /* CONFIG_APP_IPC_BENCH */
 
 int main(void)
 {
@@ -90,9 +2807,15 @@ int main(void)
 	struct ipc_ept ep;
 	int ret;
 
-	p_payload = (struct payload *) k_malloc(CONFIG_APP_IPC_SERVICE_MESSAGE_LEN);
+#if defined(CONFIG_APP_FFT_STREAM)
+	printk("IPC-service %s FFT stream started\n", CONFIG_BOARD_TARGET);
+#else
+	/* On cache lines of its own, as the buffers of the ipc0 region. */
+	p_payload = (struct payload *)k_aligned_alloc(FFT_CACHE_LINE,
+						       ROUND_UP(CONFIG_APP_IPC_SERVICE_MESSAGE_LEN,
+								FFT_CACHE_LINE));
 	if (!p_payload) {
-		printk("k_malloc() failure\n");
+		printk("k_aligned_alloc() failure\n");
 		return -ENOMEM;
 	}
 
@@ -103,6 +2826,16 @@ int main(void)
 
 	printk("Remote IPC-service %s demo started\n", CONFIG_BOARD_TARGET);
 
+#if defined(CONFIG_APP_IPC_TRACE)
+	ipc_trace_init();
+#endif
+#endif /* CONFIG_APP_FFT_STREAM */
+
+#if defined(CONFIG_APP_FFT_BENCH)
+	/* Before IPC is up, nothing interrupts the FFT. */
+	fft_bench_run("off", true);
+#endif
+
 	ipc0_instance = DEVICE_DT_GET(DT_NODELABEL(ipc0));
 
 #if defined(CONFIG_IPC_SERVICE_BACKEND_ICBMSG)
@@ -116,25 +2849,120 @@ int main(void)
 		return ret;
 	}
 
+#if defined(CONFIG_APP_IPC_SWEEP)
+	/* Messages of the sweep may arrive as soon as the endpoint is registered. */
+	ipc_sweep_init(&sweep, &ep);
+#endif
+
+#if defined(CONFIG_APP_IPC_BENCH)
+	/* Empties the ring to the remote core before it can see the endpoint bound. */
+	ret = ipc_bench_init(&bench, &ep, bench_buf, true);
+	if (ret < 0) {
+		printk("ipc_bench_init() failure (%d)\n", ret);
+		return ret;
+	}
+#endif
+
+#if defined(CONFIG_APP_IPC_CREDIT)
+	/* Credits may arrive as soon as the endpoint is registered. */
+	ret = ipc_credit_init(&credit_fc, &ep, CONFIG_APP_IPC_CREDIT_WINDOW);
+	if (ret < 0) {
+		printk("ipc_credit_init() failure (%d)\n", ret);
+		return ret;
+	}
+#endif
+
+#if defined(CONFIG_APP_FFT_SHM_RING)
+	/* Empty before the remote core can see the endpoint bound. */
+	ret = shm_ring_init_writer(&sample_ring, (void *)FFT_POOL_ADDR, FFT_RING_NUM_SLOTS,
+				   FFT_RING_SLOT_SIZE, &ring_doorbell);
+	if (ret < 0) {
+		printk("shm_ring_init_writer() failure (%d)\n", ret);
+		return ret;
+	}
+
+	shm_ring_set_coalescing(&sample_ring, CONFIG_APP_FFT_SHM_RING_NOTIFY_BLOCKS,
+				K_USEC(CONFIG_APP_FFT_SHM_RING_NOTIFY_US));
+#endif
+
+#if defined(CONFIG_APP_FFT_COOP)
+	coop_ep = &ep;
+#endif
+
+#if defined(CONFIG_APP_FFT_PRIO)
+	prio_start();
+#endif
+
+#if defined(CONFIG_APP_FFT_FANOUT)
+	ret = fanout_start();
+	if (ret < 0) {
+		printk("Result fan-out setup failure (%d)\n", ret);
+		return ret;
+	}
+#endif
+
 	ret = ipc_service_register_endpoint(ipc0_instance, &ep, &ep_cfg);
 	if (ret < 0) {
 		printf("ipc_service_register_endpoint() failure (%d)", ret);
 		return ret;
 	}
 
-	k_sem_take(&bound_sem, K_FOREVER);
+#if defined(CONFIG_APP_FFT_CTRL_PLANE)
+	ret = ctrl_plane_open();
+	if (ret < 0) {
+		return ret;
+	}
+#endif
+
+	for (int i = 0; i < NUM_ENDPOINTS; i++) {
+		k_sem_take(&bound_sem, K_FOREVER);
+	}
+#if !defined(CONFIG_APP_IPC_SWEEP) && !defined(CONFIG_APP_IPC_BENCH)
+	/* The sweep and the benchmark print their own steps. */
 	k_thread_start(thread_check_id);
+#endif
+
+#if defined(CONFIG_APP_FFT_SPECTROGRAM)
+	/* The rows start with the frame after it arrives. */
+	ret = subscribe_spectrogram(&ep);
+	if (ret < 0) {
+		return ret;
+	}
+#endif
+
+#if defined(CONFIG_APP_FFT_PERF_SHELL)
+	shell_ep = &ep;
+#endif
+
+#if defined(CONFIG_APP_FFT_STREAM)
+	return stream_loop(&ep);
+#elif defined(CONFIG_APP_IPC_BATCH)
+	return batch_loop(&ep);
+#elif defined(CONFIG_APP_IPC_CREDIT)
+	return credit_loop();
+#elif defined(CONFIG_APP_IPC_SWEEP)
+	return sweep_loop(&ep);
+#elif defined(CONFIG_APP_IPC_BENCH)
+	return bench_loop(&ep);
+#else
+	uint32_t retries = 0;
 
 	while (true) {
 		ret = ipc_service_send(&ep, p_payload, CONFIG_APP_IPC_SERVICE_MESSAGE_LEN);
 		if (ret == -ENOMEM) {
 			/* No space in the buffer. Retry. */
+			retries++;
 			continue;
 		} else if (ret < 0) {
 			printk("send_message(%ld) failed with ret %d\n", p_payload->cnt, ret);
 			break;
 		}
 
+#if defined(CONFIG_APP_IPC_TRACE)
+		ipc_trace_record(IPC_TRACE_TX, CONFIG_APP_IPC_SERVICE_MESSAGE_LEN, retries, 0);
+#endif
+		retries = 0;
+
 		p_payload->cnt++;
 
 		/* Quasi minimal busy wait time which allows to continuously send
@@ -149,4 +2977,5 @@ int main(void)
 	}
 
 	return 0;
+#endif /* CONFIG_APP_FFT_STREAM */
 }
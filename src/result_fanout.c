@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include "result_fanout.h"
+
+#define NUM_RECORDS CONFIG_APP_FFT_FANOUT_RECORDS
+#define NUM_SUBS    CONFIG_APP_FFT_FANOUT_SUBSCRIBERS
+
+BUILD_ASSERT(NUM_SUBS <= 32, "subscribers do not fit in a word of flags");
+
+/* A result and the references to it, free at 0. */
+struct fanout_record {
+	atomic_t refs;
+	struct fft_result_msg msg;
+};
+
+static struct fanout_record records[NUM_RECORDS];
+static struct result_fanout_sub *subs[NUM_SUBS];
+static uint32_t num_subs;
+static uint32_t records_needed;
+
+/* The queues have one producer, publishers take turns. */
+static struct k_spinlock publish_lock;
+static uint32_t next_record;
+static uint32_t skipped;
+
+int result_fanout_subscribe(struct result_fanout_sub *sub)
+{
+	/* Its queue full and one record in hand. */
+	uint32_t needed = records_needed + sub->len;
+
+	/* With one free for the next result. */
+	if ((num_subs == NUM_SUBS) || (needed + 1 > NUM_RECORDS)) {
+		return -ENOMEM;
+	}
+
+	fft_spsc_init(&sub->queue, sub->slots, sub->len);
+	k_sem_init(&sub->ready, 0, sub->len - 1);
+	atomic_clear(&sub->dropped);
+
+	subs[num_subs++] = sub;
+	records_needed = needed;
+
+	return 0;
+}
+
+/* The next free record after the last one taken, NULL if every one is held. */
+static struct fanout_record *record_take(void)
+{
+	for (uint32_t n = 0; n < NUM_RECORDS; n++) {
+		struct fanout_record *record = &records[next_record];
+
+		next_record = (next_record + 1 == NUM_RECORDS) ? 0 : next_record + 1;
+		if (atomic_get(&record->refs) == 0) {
+			return record;
+		}
+	}
+
+	return NULL;
+}
+
+void result_fanout_publish(const struct fft_result_msg *msg)
+{
+	struct fanout_record *record;
+	k_spinlock_key_t key;
+	uint32_t queued = 0;
+
+	key = k_spin_lock(&publish_lock);
+
+	record = record_take();
+	if (record == NULL) {
+		skipped++;
+		k_spin_unlock(&publish_lock, key);
+		return;
+	}
+
+	/* Held by the publisher until every subscriber has its reference. */
+	atomic_set(&record->refs, 1);
+	memcpy(&record->msg, msg, sizeof(record->msg));
+
+	for (uint32_t i = 0; i < num_subs; i++) {
+		/* Counted first, the subscriber may release it before the put returns. */
+		(void)atomic_inc(&record->refs);
+		if (fft_spsc_put(&subs[i]->queue, &record->msg)) {
+			queued |= BIT(i);
+		} else {
+			(void)atomic_dec(&record->refs);
+			(void)atomic_inc(&subs[i]->dropped);
+		}
+	}
+
+	k_spin_unlock(&publish_lock, key);
+
+	/* Outside the lock, so that a subscriber above the publisher runs at once. */
+	for (uint32_t i = 0; i < num_subs; i++) {
+		if (queued & BIT(i)) {
+			k_sem_give(&subs[i]->ready);
+		}
+	}
+
+	result_fanout_release(&record->msg);
+}
+
+const struct fft_result_msg *result_fanout_get(struct result_fanout_sub *sub,
+					       k_timeout_t timeout)
+{
+	void *msg;
+
+	if (k_sem_take(&sub->ready, timeout) < 0) {
+		return NULL;
+	}
+
+	return fft_spsc_get(&sub->queue, &msg) ? msg : NULL;
+}
+
+void result_fanout_release(const struct fft_result_msg *msg)
+{
+	struct fanout_record *record = CONTAINER_OF(msg, struct fanout_record, msg);
+
+	(void)atomic_dec(&record->refs);
+}
+
+uint32_t result_fanout_skipped(void)
+{
+	return skipped;
+}
+
+const struct result_fanout_sub *result_fanout_sub_get(uint32_t i)
+{
+	return (i < num_subs) ? subs[i] : NULL;
+}
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/*
+ * Fan-out of the frame results of the remote core to several subscribers
+ * of the application core, BLE reporting, logging or an alarm handler,
+ * without a copy per subscriber. Each result lands once in a record of a
+ * shared pool, and every subscriber gets a reference to it through a
+ * queue of its own; the record returns to the pool when the last of them
+ * releases it.
+ *
+ * Publishing never waits. A subscriber whose queue is full loses the
+ * record, which is counted against it alone: the others still get it, and
+ * the remote core is never held up. The pool has a record for every
+ * reference the subscribers may hold, their queues full and one record
+ * each in hand, so a slow subscriber cannot take the records of the
+ * others either.
+ */
+
+#ifndef RESULT_FANOUT_H
+#define RESULT_FANOUT_H
+
+#include <stdint.h>
+#include <zephyr/kernel.h>
+
+#include "fft_spsc.h"
+#include "fft_stream_msg.h"
+
+/** A subscriber, defined with RESULT_FANOUT_SUB_DEFINE(). */
+struct result_fanout_sub {
+	const char *name;
+	void **slots;              /**< Of the queue, FFT_SPSC_SLOTS(depth). */
+	uint32_t len;              /**< Entries of slots. */
+	struct fft_spsc queue;     /**< References to the subscriber's records. */
+	struct k_sem ready;        /**< Given for every reference queued. */
+	atomic_t dropped;          /**< Records its queue had no room for. */
+};
+
+/**
+ * Define a subscriber with a queue of depth records. Subscribe it with
+ * result_fanout_subscribe() before the first result arrives.
+ */
+#define RESULT_FANOUT_SUB_DEFINE(_name, _depth)                                                   \
+	static void *_name##_slots[FFT_SPSC_SLOTS(_depth)];                                       \
+	static struct result_fanout_sub _name = {                                                 \
+		.name = #_name,                                                                   \
+		.slots = _name##_slots,                                                           \
+		.len = FFT_SPSC_SLOTS(_depth),                                                    \
+	}
+
+/**
+ * @brief Add a subscriber. Not while results are published.
+ *
+ * @retval 0 when added, -ENOMEM when CONFIG_APP_FFT_FANOUT_SUBSCRIBERS are
+ *         subscribed already or the queues of all of them, plus one record
+ *         each, would need more than CONFIG_APP_FFT_FANOUT_RECORDS.
+ */
+int result_fanout_subscribe(struct result_fanout_sub *sub);
+
+/**
+ * @brief Copy a result into a record and queue it to every subscriber.
+ *
+ * Never waits, from the receive callback or any thread.
+ */
+void result_fanout_publish(const struct fft_result_msg *msg);
+
+/**
+ * @brief Next record of a subscriber, from its thread only.
+ *
+ * The record stays valid until result_fanout_release(). Release it before
+ * getting the next, the pool only counts one record in hand per subscriber.
+ *
+ * @return The record, or NULL when none came within timeout.
+ */
+const struct fft_result_msg *result_fanout_get(struct result_fanout_sub *sub,
+					       k_timeout_t timeout);
+
+/**
+ * @brief Give a record of result_fanout_get() back.
+ */
+void result_fanout_release(const struct fft_result_msg *msg);
+
+/**
+ * @brief Results published while every record was held, lost to all subscribers.
+ *
+ * Stays 0 as long as each subscriber holds at most one record.
+ */
+uint32_t result_fanout_skipped(void);
+
+/**
+ * @brief Subscriber i, NULL past the last one. For the reports.
+ */
+const struct result_fanout_sub *result_fanout_sub_get(uint32_t i);
+
+#endif /* RESULT_FANOUT_H */
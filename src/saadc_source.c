@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <errno.h>
+#include <zephyr/kernel.h>
+#include <zephyr/irq.h>
+#include <nrfx_saadc.h>
+
+#if defined(__ARM_FEATURE_DSP)
+#include <cmsis_core.h>
+#endif
+
+#include "saadc_source.h"
+#include "fft_cache.h"
+
+/*
+ * Calibrated results go through the conversion of the FFT library, the
+ * uncalibrated ones through saadc_to_q15(), with the same result.
+ */
+#define SAADC_CALIBRATED ((CONFIG_APP_FFT_SAADC_OFFSET != 0) ||		\
+			  (CONFIG_APP_FFT_SAADC_GAIN != 16384) ||		\
+			  (CONFIG_APP_FFT_SAADC_DC_SHIFT != 0))
+
+#if SAADC_CALIBRATED
+#include "adc_q15.h"
+#endif
+
+/* The SAADC internal timer runs at 16 MHz, its divider from 80 to 2047. */
+#define SAADC_TIMER_HZ 16000000U
+#define SAADC_CC_MIN   80U
+#define SAADC_CC_MAX   2047U
+
+/* Empty buffers waiting for DMA, and buffers DMA has filled. */
+K_MSGQ_DEFINE(queued_bufs, sizeof(int16_t *), 4, 4);
+K_MSGQ_DEFINE(filled_bufs, sizeof(int16_t *), 4, 4);
+
+/* Takes the samples no buffer was queued for. */
+static int16_t drop_buf[CONFIG_APP_FFT_FRAME_LEN] FFT_CACHE_ALIGNED;
+
+static uint32_t buf_count;
+
+#if SAADC_CALIBRATED
+static adc_q15_t calibration;
+#endif
+
+static void saadc_handler(nrfx_saadc_evt_t const *evt)
+{
+	int16_t *buf;
+
+	switch (evt->type) {
+	case NRFX_SAADC_EVT_BUF_REQ:
+		if (k_msgq_get(&queued_bufs, &buf, K_NO_WAIT) != 0) {
+			buf = drop_buf;
+		}
+		(void)nrfx_saadc_buffer_set(buf, buf_count);
+		break;
+	case NRFX_SAADC_EVT_DONE:
+		buf = evt->data.done.p_buffer;
+		(void)k_msgq_put(&filled_bufs, &buf, K_NO_WAIT);
+		break;
+	default:
+		break;
+	}
+}
+
+int saadc_source_start(uint32_t sample_rate, uint32_t count)
+{
+	nrfx_saadc_channel_t channel = NRFX_SAADC_DEFAULT_CHANNEL_SE(
+		NRFX_ANALOG_EXTERNAL_AIN0 + CONFIG_APP_FFT_SAADC_AIN, 0);
+	nrfx_saadc_adv_config_t adv = NRFX_SAADC_DEFAULT_ADV_CONFIG;
+	uint32_t cc = (sample_rate != 0) ? (SAADC_TIMER_HZ + sample_rate / 2) / sample_rate : 0;
+	int16_t *first;
+
+	if ((cc < SAADC_CC_MIN) || (cc > SAADC_CC_MAX) ||
+	    (count == 0) || (count > ARRAY_SIZE(drop_buf))) {
+		return -EINVAL;
+	}
+
+	buf_count = count;
+
+#if SAADC_CALIBRATED
+	if (adc_q15_init(&calibration, ADC_Q15_S16, 12, 2048 + CONFIG_APP_FFT_SAADC_OFFSET,
+			 CONFIG_APP_FFT_SAADC_GAIN, CONFIG_APP_FFT_SAADC_DC_SHIFT) != RFFT_SUCCESS) {
+		return -EINVAL;
+	}
+#endif
+
+	IRQ_CONNECT(DT_IRQN(DT_NODELABEL(adc)), DT_IRQ(DT_NODELABEL(adc), priority),
+		    nrfx_isr, nrfx_saadc_irq_handler, 0);
+
+	if (nrfx_saadc_init(DT_IRQ(DT_NODELABEL(adc), priority)) != NRFX_SUCCESS) {
+		return -EIO;
+	}
+
+	if (nrfx_saadc_channel_config(&channel) != NRFX_SUCCESS) {
+		return -EIO;
+	}
+
+	/* Sample on the internal timer, restart on END: no CPU per sample. */
+	adv.internal_timer_cc = cc;
+	adv.start_on_end = true;
+
+	if (nrfx_saadc_advanced_mode_set(BIT(0), NRF_SAADC_RESOLUTION_12BIT, &adv,
+					 saadc_handler) != NRFX_SUCCESS) {
+		return -EIO;
+	}
+
+	if (k_msgq_get(&queued_bufs, &first, K_NO_WAIT) != 0) {
+		first = drop_buf;
+	}
+
+	if ((nrfx_saadc_buffer_set(first, count) != NRFX_SUCCESS) ||
+	    (nrfx_saadc_mode_trigger() != NRFX_SUCCESS)) {
+		return -EIO;
+	}
+
+	return 0;
+}
+
+void saadc_source_queue(int16_t *buf)
+{
+	(void)k_msgq_put(&queued_bufs, &buf, K_NO_WAIT);
+}
+
+int saadc_source_wait(int16_t **buf, k_timeout_t timeout)
+{
+	int16_t *filled;
+
+	if (k_msgq_get(&filled_bufs, &filled, timeout) != 0) {
+		return -EAGAIN;
+	}
+
+	if (filled == drop_buf) {
+		return -ENOBUFS;
+	}
+
+	/* Written by DMA behind the cache, if there is one. */
+	fft_cache_invd(filled, buf_count * sizeof(int16_t));
+#if SAADC_CALIBRATED
+	adc_q15_convert(&calibration, filled, filled, buf_count);
+#else
+	saadc_to_q15(filled, buf_count);
+#endif
+
+	*buf = filled;
+
+	return 0;
+}
+
+void saadc_to_q15(int16_t *samples, size_t count)
+{
+	size_t i = 0;
+
+#if defined(__ARM_FEATURE_DSP)
+	uint32_t *words = (uint32_t *)samples;
+
+	/*
+	 * Per halfword: saturate to 0..4095, flip bit 11 to make it a 12-bit
+	 * two's complement value around mid-scale, shift up to Q15. The
+	 * saturation clears bits 12 to 15, so nothing crosses into the upper
+	 * halfword.
+	 */
+	for (; i + 2 <= count; i += 2) {
+		uint32_t w = __USAT16(*words, 12);
+
+		*words++ = (w ^ 0x08000800U) << 4;
+	}
+#endif
+
+	for (; i < count; i++) {
+		int32_t x = CLAMP(samples[i], 0, 4095);
+
+		samples[i] = (int16_t)((x ^ 0x800) << 4);
+	}
+}
@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef SAADC_SOURCE_H
+#define SAADC_SOURCE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <zephyr/kernel.h>
+
+/**
+ * @brief Start continuous sampling of the SAADC.
+ *
+ * The SAADC samples on its internal timer and EasyDMA writes the results
+ * straight into the buffers handed over with saadc_source_queue(), one
+ * buffer of @p count samples after the other. The CPU only sees two
+ * interrupts per buffer. When no buffer is queued in time, a buffer's
+ * worth of samples goes to an internal buffer and is dropped.
+ *
+ * Queue at least two buffers first, so DMA can switch to the second one
+ * while the first is being processed.
+ *
+ * @param sample_rate Sample rate in Hz, 16 MHz divided by 80 to 2047.
+ * @param count       Samples per buffer, at most CONFIG_APP_FFT_FRAME_LEN.
+ *
+ * @retval 0 on success, -EINVAL for an unsupported rate or count, -EIO
+ *         when the SAADC driver fails.
+ */
+int saadc_source_start(uint32_t sample_rate, uint32_t count);
+
+/**
+ * @brief Hand an empty buffer to the DMA queue.
+ *
+ * @param buf Buffer of the count samples passed to saadc_source_start(),
+ *            FFT_CACHE_LINE aligned, in RAM reachable by EasyDMA.
+ */
+void saadc_source_queue(int16_t *buf);
+
+/**
+ * @brief Wait for the next filled buffer.
+ *
+ * The samples are converted to Q15 in place before the buffer is
+ * returned; the buffer belongs to the caller until it is queued again.
+ *
+ * @param buf     Set to the filled buffer.
+ * @param timeout How long to wait.
+ *
+ * @retval 0 on success, -ENOBUFS when a buffer of samples was dropped for
+ *         lack of a queued buffer, -EAGAIN on timeout.
+ */
+int saadc_source_wait(int16_t **buf, k_timeout_t timeout);
+
+/**
+ * @brief Convert 12-bit single-ended SAADC results to Q15, in place.
+ *
+ * 0 maps to -1.0 and 4095 to 1 - 2^-11. Results outside 0 to 4095, e.g.
+ * small negative values from the offset, are clamped first. Two samples
+ * are converted per 32-bit word with the DSP extension.
+ */
+void saadc_to_q15(int16_t *samples, size_t count);
+
+#endif /* SAADC_SOURCE_H */
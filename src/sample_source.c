@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <math.h>
+#include <zephyr/kernel.h>
+
+#include "sample_source.h"
+
+/* One period of a half-scale sine, indexed by the top bits of the phase. */
+#define SINE_TABLE_BITS 10
+#define SINE_TABLE_LEN  (1U << SINE_TABLE_BITS)
+
+static int16_t sine_table[SINE_TABLE_LEN];
+static uint32_t phase;
+static uint32_t phase_step;
+
+void sample_source_init(uint32_t sample_rate, uint32_t tone_hz)
+{
+	for (uint32_t i = 0; i < SINE_TABLE_LEN; i++) {
+		sine_table[i] = (int16_t)(16384.0f * sinf(2.0f * 3.14159265f * i / SINE_TABLE_LEN));
+	}
+
+	phase = 0;
+	phase_step = (uint32_t)(((uint64_t)tone_hz << 32) / sample_rate);
+}
+
+void sample_source_set_step(uint32_t step)
+{
+	phase_step = step;
+}
+
+void sample_source_read(int16_t *buf, size_t count)
+{
+	for (size_t i = 0; i < count; i++) {
+		buf[i] = sine_table[phase >> (32 - SINE_TABLE_BITS)];
+		phase += phase_step;
+	}
+}
+
+void sample_source_read_q7(int8_t *buf, size_t count)
+{
+	for (size_t i = 0; i < count; i++) {
+		buf[i] = (int8_t)(sine_table[phase >> (32 - SINE_TABLE_BITS)] >> 8);
+		phase += phase_step;
+	}
+}
+
+void sample_source_skip(size_t count)
+{
+	phase += phase_step * (uint32_t)count;
+}
@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef SAMPLE_SOURCE_H
+#define SAMPLE_SOURCE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Prepare the generated test tone.
+ *
+ * @param sample_rate Sample rate in Hz.
+ * @param tone_hz     Frequency of the tone in Hz.
+ */
+void sample_source_init(uint32_t sample_rate, uint32_t tone_hz);
+
+/**
+ * @brief Change the frequency of the tone, without a jump in its phase.
+ *
+ * @param step Phase advance per sample, 2^32 a period.
+ */
+void sample_source_set_step(uint32_t step);
+
+/**
+ * @brief Produce the next @p count Q15 samples of the stream.
+ */
+void sample_source_read(int16_t *buf, size_t count);
+
+/**
+ * @brief Produce the next @p count samples of the stream in 8 bits, the Q15 ones / 256.
+ */
+void sample_source_read_q7(int8_t *buf, size_t count);
+
+/**
+ * @brief Advance the stream by @p count samples without producing them.
+ */
+void sample_source_skip(size_t count);
+
+#endif /* SAMPLE_SOURCE_H */
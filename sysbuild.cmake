@@ -6,6 +6,11 @@ if("${SB_CONFIG_REMOTE_BOARD}" STREQUAL "")
   message(FATAL_ERROR "REMOTE_BOARD must be set to a valid board name")
 endif()
 
+# Memory split computed from the FFT pipeline instead of the flpr-128k snippet
+if(SB_CONFIG_FLPR_MEMORY_SPLIT)
+  include(${APP_DIR}/cmake/flpr_memory.cmake)
+endif()
+
 # Add remote project
 ExternalZephyrProject_Add(
   APPLICATION remote